@@ -113,7 +113,7 @@
 #define RL_MAX_SHADER_LOCATIONS               32      // Maximum number of shader locations supported
 
 #define RL_CULL_DISTANCE_NEAR               0.01      // Default projection matrix near cull distance
-#define RL_CULL_DISTANCE_FAR               20000      // Default projection matrix far cull distance
+#define RL_CULL_DISTANCE_FAR              1000.0      // Default projection matrix far cull distance
 
 // Default shader vertex attribute locations
 #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION    0
@@ -0,0 +1,39 @@
+project "FontBaker"
+    language "C++"
+    cppdialect "C++17"
+    kind "ConsoleApp"
+
+    files {
+        "src/**.cpp",
+        "src/**.h"
+    }
+
+    externalincludedirs {
+        RaylibDir .. "/src"
+    }
+
+    links {
+        "raylib"
+    }
+
+    filter "system:windows"
+        links {
+            "Winmm",
+            "opengl32",
+            "gdi32",
+            "shell32",
+            "User32"
+        }
+
+    filter "system:linux"
+        links {
+            "GL",
+            "X11",
+            "rt",
+            "dl",
+            "m"
+        }
+
+    filter "system:macosx"
+        linkoptions "-framework AppKit -framework iokit -framework OpenGl"
+    filter {}
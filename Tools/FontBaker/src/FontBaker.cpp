@@ -0,0 +1,141 @@
+/*
+    Rasterizes a TTF at the given pixel sizes into font atlases and writes them as a header for Zurvan,
+    see Zurvan/src/BakedFont.h. Uses the same raylib functions LoadFontEx does, so the baked atlases match
+    what the application used to generate at startup.
+
+    Usage: FontBaker <font.ttf> <output.h> [--sdf] <size> [size...]
+    Sizes after --sdf are baked as signed distance fields, such an atlas can be drawn crisply at any size.
+    The output is only rewritten if its content changed, so unchanged builds don't recompile anything.
+*/
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+#include "raylib.h"
+
+namespace
+{
+    constexpr int GlyphCount = 95;  // printable ASCII, the default of LoadFontEx
+    constexpr int GlyphPadding = 4; // FONT_TTF_DEFAULT_CHARS_PADDING, SDF glyphs already contain their padding
+
+    std::string FileName(const std::string& path)
+    {
+        const std::size_t slash = path.find_last_of("/\\");
+        return slash == std::string::npos ? path : path.substr(slash + 1);
+    }
+
+    bool WriteAtlas(std::ostringstream& out, const unsigned char* ttf, int ttfSize, int fontSize, bool sdf)
+    {
+        GlyphInfo* glyphs = LoadFontData(ttf, ttfSize, fontSize, nullptr, GlyphCount, sdf ? FONT_SDF : FONT_DEFAULT);
+        if (glyphs == nullptr)
+            return false;
+
+        // Same parameters as raylib's SDF example, skyline packing wastes less space on the padded glyphs
+        const int padding = sdf ? 0 : GlyphPadding;
+        Rectangle* recs = nullptr;
+        Image atlas = GenImageFontAtlas(glyphs, &recs, GlyphCount, fontSize, padding, sdf ? 1 : 0);
+
+        // The atlas is white, only the alpha channel carries information
+        const int pixelCount = atlas.width * atlas.height;
+        std::vector<unsigned char> alpha(static_cast<std::size_t>(pixelCount));
+        for (int i = 0; i < pixelCount; ++i)
+            alpha[static_cast<std::size_t>(i)] = static_cast<const unsigned char*>(atlas.data)[2 * i + 1];
+
+        int compressedSize = 0;
+        unsigned char* compressed = CompressData(alpha.data(), pixelCount, &compressedSize);
+
+        const std::string name = std::string(sdf ? "sg_FontAtlasSdf" : "sg_FontAtlas") + std::to_string(fontSize);
+        out << "static const unsigned char " << name << "Alpha[] =\n{";
+        for (int i = 0; i < compressedSize; ++i)
+        {
+            if (i % 16 == 0) out << "\n\t";
+            char byte[8];
+            std::snprintf(byte, sizeof(byte), "0x%02X,", compressed[i]);
+            out << byte << (i % 16 == 15 || i + 1 == compressedSize ? "" : " ");
+        }
+        out << "\n};\n\n";
+
+        out << "static const BakedFont::Glyph " << name << "Glyphs[] =\n{\n";
+        for (int i = 0; i < GlyphCount; ++i)
+        {
+            out << "\t{ " << glyphs[i].value << ", " << glyphs[i].offsetX << ", " << glyphs[i].offsetY << ", " << glyphs[i].advanceX << ", "
+                << static_cast<int>(recs[i].x) << ".f, " << static_cast<int>(recs[i].y) << ".f, "
+                << static_cast<int>(recs[i].width) << ".f, " << static_cast<int>(recs[i].height) << ".f },\n";
+        }
+        out << "};\n\n";
+
+        out << "static const BakedFont::Atlas " << name << " = { " << fontSize << ", " << GlyphCount << ", " << padding << ", "
+            << atlas.width << ", " << atlas.height << ", " << (sdf ? "true" : "false") << ", " << name << "Glyphs, " << name << "Alpha, sizeof(" << name << "Alpha) };\n\n";
+
+        std::printf("FontBaker: %dpx %satlas %dx%d, %d bytes compressed\n", fontSize, sdf ? "SDF " : "", atlas.width, atlas.height, compressedSize);
+        MemFree(compressed);
+        UnloadImage(atlas);
+        MemFree(recs);
+        UnloadFontData(glyphs, GlyphCount);
+        return true;
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    if (argc < 4)
+    {
+        std::fprintf(stderr, "Usage: %s <font.ttf> <output.h> [--sdf] <size> [size...]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    SetTraceLogLevel(LOG_WARNING);
+
+    int ttfSize = 0;
+    unsigned char* ttf = LoadFileData(argv[1], &ttfSize);
+    if (ttf == nullptr)
+    {
+        std::fprintf(stderr, "FontBaker: Failed to read %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    std::ostringstream out;
+    out << "#ifndef FONT_ATLAS_H\n#define FONT_ATLAS_H\n"
+        << "// Generated by Tools/FontBaker from " << FileName(argv[1]) << ", do not edit\n\n"
+        << "#include \"BakedFont.h\"\n\n";
+
+    bool sdf = false;
+    for (int i = 3; i < argc; ++i)
+    {
+        if (std::string(argv[i]) == "--sdf")
+        {
+            sdf = true;
+            continue;
+        }
+
+        const int fontSize = std::atoi(argv[i]);
+        if (fontSize <= 0 || !WriteAtlas(out, ttf, ttfSize, fontSize, sdf))
+        {
+            std::fprintf(stderr, "FontBaker: Failed to bake %s at size %s\n", argv[1], argv[i]);
+            UnloadFileData(ttf);
+            return EXIT_FAILURE;
+        }
+    }
+    out << "#endif // FONT_ATLAS_H\n";
+    UnloadFileData(ttf);
+
+    const std::string content = out.str();
+    std::ifstream existing(argv[2], std::ios::binary);
+    const std::string previous((std::istreambuf_iterator<char>(existing)), std::istreambuf_iterator<char>());
+    if (previous == content)
+        return EXIT_SUCCESS;
+
+    std::ofstream file(argv[2], std::ios::binary);
+    file << content;
+    if (!file)
+    {
+        std::fprintf(stderr, "FontBaker: Failed to write %s\n", argv[2]);
+        return EXIT_FAILURE;
+    }
+    std::printf("FontBaker: Wrote %s\n", argv[2]);
+    return EXIT_SUCCESS;
+}
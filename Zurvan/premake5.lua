@@ -24,6 +24,15 @@ project "Zurvan"
         "raygui"
     }
 
+    -- Bakes the font atlases into src/FontAtlas.h, the header is checked in so web builds (which can't
+    -- run host tools) and builds without the tool use the last baked version
+    filter "system:not emscripten"
+        dependson "FontBaker"
+        prebuildcommands {
+            '"' .. cwd .. '/BIN/%{cfg.toolset}/%{cfg.shortname}/FontBaker/bin/FontBaker" "' .. cwd .. '/Zurvan/res/Fonts/Roboto/static/Roboto-Regular.ttf" "' .. cwd .. '/Zurvan/src/FontAtlas.h" --sdf 32'
+        }
+    filter {}
+
     filter "system:windows"
         defines "SYSTEM_WINDOWS"
         links {
@@ -93,6 +102,7 @@ project "Zurvan"
             "shift-overflow"
         }
         disablewarnings { "unknown-warning-option", "deprecated-copy" }
+        buildoptions "-fno-math-errno" -- sqrt doesn't have to set errno, otherwise loops using it can't be vectorized (Kepler.h)
 
     filter { "toolset:gcc*", "configurations:Release or configurations:Distribution or configurations:MinSizeDistribution" }
         warnings "Extra"
@@ -1,15 +1,20 @@
+#include <array>
+#include <cmath>
 #include <cstdio>
 #include <chrono>
 #include <vector>
 #include <cstring>
 #include <cstdint>
+#include <algorithm>
+#include <exception>
 
 #include "Camera.h"
 #include "Config.h"
 #include "Renderer.h"
+#include "Profiler.h"
 #include "Application.h"
 
-Application::Application(int width, int height) noexcept
+Application::Application(int width, int height, const char* catalogPath) noexcept
     : m_ScreenWidth(width), m_ScreenHeight(height)
 {
     m_Camera.position = Vector3{ 250.0f, 1900.0f, 3350.0f };
@@ -17,19 +22,18 @@ Application::Application(int width, int height) noexcept
     m_Camera.up = Vector3{ 0.0f, 1.0f, 0.0f };
     m_Camera.fovy = 60;
     m_Camera.projection = CAMERA_PERSPECTIVE;
+    RebaseCamera();
+
+    if (catalogPath == nullptr || !Catalog::Load(catalogPath, &m_Catalog) || m_Catalog.Size() == 0)
+    {
+        if (catalogPath != nullptr)
+            TraceLog(LOG_WARNING, "CATALOG: Using the built-in solar system instead of %s", catalogPath);
+        Catalog::ParseText(Catalog::SolarSystem, std::strlen(Catalog::SolarSystem), &m_Catalog, "built-in");
+    }
+
+    m_CentralBody = Catalog::AddBodies(m_Catalog, &m_Bodies, &m_Subsystems);
+    Physics::ToBarycentricFrame(&m_Bodies.Items());
 
-    m_Bodies.emplace_back(0.0, 0.0, Physics::Const::SUN_MASS, Physics::Const::SUN_RADIUS, Physics::Const::SUN_INCLINE, "Sun", YELLOW);
-    m_Bodies.emplace_back(Physics::Const::EARTH_SUN_DISTANCE, -Physics::Const::EARTH_SPEED, Physics::Const::EARTH_MASS, Physics::Const::EARTH_RADIUS, Physics::Const::EARTH_INCLINE, "Earth", BLUE);
-    m_Bodies.emplace_back(Physics::Const::JUPTIER_SUN_DISTANCE, -Physics::Const::JUPTIER_SPEED, Physics::Const::JUPITER_MASS, Physics::Const::JUPITER_RADIUS, Physics::Const::JUPTIER_INCLINE, "Jupiter", BROWN);
-    m_Bodies.emplace_back(Physics::Const::MERCURY_SUN_DISTANCE, -Physics::Const::MERCURY_SPEED, Physics::Const::MERCURY_MASS, Physics::Const::MERCURY_RADIUS, Physics::Const::MERCURY_INCLINE, "Mercury", GRAY);
-    m_Bodies.emplace_back(Physics::Const::VENUS_SUN_DISTANCE, -Physics::Const::VENUS_SPEED, Physics::Const::VENUS_MASS, Physics::Const::VENUS_RADIUS, Physics::Const::VENUS_INCLINE, "Venus", RED);
-    m_Bodies.emplace_back(Physics::Const::MARS_SUN_DISTANCE, -Physics::Const::MARS_SPEED, Physics::Const::MARS_MASS, Physics::Const::MARS_RADIUS, Physics::Const::MARS_INCLINE, "Mars", ORANGE);
-    m_Bodies.emplace_back(Physics::Const::SATURN_SUN_DISTANCE, -Physics::Const::SATURN_SPEED, Physics::Const::SATURN_MASS, Physics::Const::SATURN_RADIUS, Physics::Const::SATURN_INCLINE, "Saturn", VIOLET);
-    m_Bodies.emplace_back(Physics::Const::URANUS_SUN_DISTANCE, -Physics::Const::URANUS_SPEED, Physics::Const::URANUS_MASS, Physics::Const::URANUS_RADIUS, Physics::Const::URANUS_INCLINE, "Uranus", SKYBLUE);
-    m_Bodies.emplace_back(Physics::Const::NEPTUN_SUN_DISTANCE, -Physics::Const::NEPTUN_SPEED, Physics::Const::NEPTUN_MASS, Physics::Const::NEPTUN_RADIUS, Physics::Const::NEPTUN_INCLINE, "Neptun", DARKBLUE);
-    m_Bodies.emplace_back(Physics::Const::PLUTO_SUN_DISTANCE, -Physics::Const::PLUTO_SPEED, Physics::Const::PLUTO_MASS, Physics::Const::PLUTO_RADIUS, Physics::Const::PLUTO_INCLINE, "Pluto", WHITE);
-
-    m_SelectedBody = nullptr;
     m_InfoTimer = std::chrono::steady_clock::now();
 }
 
@@ -50,33 +54,216 @@ void Application::SetScreenSize(int width, int height) noexcept
 }
 
 
+// Called from OnUpdate(), so errors are only reported and never propagated
+void Application::ToggleRecording() noexcept
+{
+    try
+    {
+        if (m_Recorder.IsOpen())
+        {
+            const uint64_t frames = m_Recorder.FrameCount();
+            if (m_Recorder.Close())
+                TraceLog(LOG_INFO, "TRAJECTORY: Recorded %llu frames to %s", (unsigned long long)frames, RECORDING_PATH);
+            else
+                TraceLog(LOG_WARNING, "TRAJECTORY: Failed to finish recording %s", RECORDING_PATH);
+        }
+        else if (!m_Recorder.Open(RECORDING_PATH, m_Bodies.Size(), RECORDING_ERROR_BOUND))
+        {
+            TraceLog(LOG_WARNING, "TRAJECTORY: Failed to open %s for recording", RECORDING_PATH);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        TraceLog(LOG_WARNING, "TRAJECTORY: Recording %s failed: %s", RECORDING_PATH, e.what());
+    }
+}
+
+
+void Application::ToggleEncounterLog()
+{
+    if (m_Encounters.IsOpen())
+    {
+        TraceLog(LOG_INFO, "ENCOUNTERS: Logged %zu encounters to %s", m_Encounters.EventCount(), ENCOUNTER_PATH);
+        m_Encounters.Close();
+    }
+    else if (!m_Encounters.Open(ENCOUNTER_PATH, ENCOUNTER_DISTANCE))
+    {
+        TraceLog(LOG_WARNING, "ENCOUNTERS: Failed to open %s", ENCOUNTER_PATH);
+    }
+}
+
+
+// Called from OnUpdate(), so errors are only reported and never propagated
+void Application::ToggleReplay() noexcept
+{
+    try
+    {
+        if (m_Player.IsOpen())
+        {
+            m_Player.Close();
+            m_Drift.Reset(); // integration continues from the replayed state
+            return;
+        }
+
+        if (m_Recorder.IsOpen())
+            ToggleRecording();
+
+        if (!m_Player.Open(RECORDING_PATH))
+        {
+            TraceLog(LOG_WARNING, "TRAJECTORY: Failed to open %s for replay", RECORDING_PATH);
+        }
+        else if (m_Player.BodyCount() != m_Bodies.Size())
+        {
+            TraceLog(LOG_WARNING, "TRAJECTORY: %s contains %zu bodies, expected %zu", RECORDING_PATH, m_Player.BodyCount(), m_Bodies.Size());
+            m_Player.Close();
+        }
+        else
+        {
+            m_Player.SetSpeed(REPLAY_SPEED);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        TraceLog(LOG_WARNING, "TRAJECTORY: Replaying %s failed: %s", RECORDING_PATH, e.what());
+    }
+}
+
+
+// Floating origin: the camera's movement is folded into the double precision world position and the
+// camera itself is moved back to the origin, so render space coordinates stay small wherever it goes
+void Application::RebaseCamera() noexcept
+{
+    m_CameraPosition += Math::Vector3<double>(m_Camera.position.x, m_Camera.position.y, m_Camera.position.z);
+    m_Camera.target = Vector3Subtract(m_Camera.target, m_Camera.position);
+    m_Camera.position = { 0.f, 0.f, 0.f };
+}
+
+
+void Application::LogCounterSummary() const
+{
+    if (!PerfCounters::Available())
+    {
+        TraceLog(LOG_INFO, "PERF: Hardware counters unavailable");
+        return;
+    }
+
+    using PerfCounters::Counter;
+    char values[5][24];
+    constexpr std::array<const char*, PerfCounters::PhaseCount> phaseNames = { "Accelerations", "Update" };
+    for (std::size_t i = 0; i < PerfCounters::PhaseCount; ++i)
+    {
+        const PerfCounters::Values v = PerfCounters::Totals(static_cast<PerfCounters::Phase>(i));
+        const double cycles = static_cast<double>(v[static_cast<std::size_t>(Counter::Cycles)]);
+        const double instructions = static_cast<double>(v[static_cast<std::size_t>(Counter::Instructions)]);
+        TraceLog(LOG_INFO, "PERF: %-13s cycles %s  IPC %s  L1D misses %s  LLC misses %s  branch misses %s", phaseNames[i],
+            PerfCounters::Format(values[0], sizeof(values[0]), Counter::Cycles, cycles, 3, true),
+            PerfCounters::Format(values[1], sizeof(values[1]), Counter::Instructions, cycles > 0.0 ? instructions / cycles : 0.0, 2),
+            PerfCounters::Format(values[2], sizeof(values[2]), Counter::L1DMisses, static_cast<double>(v[static_cast<std::size_t>(Counter::L1DMisses)]), 3, true),
+            PerfCounters::Format(values[3], sizeof(values[3]), Counter::LLCMisses, static_cast<double>(v[static_cast<std::size_t>(Counter::LLCMisses)]), 3, true),
+            PerfCounters::Format(values[4], sizeof(values[4]), Counter::BranchMisses, static_cast<double>(v[static_cast<std::size_t>(Counter::BranchMisses)]), 3, true));
+    }
+
+    TraceLog(LOG_INFO, "PERF: Last %zu frames: IPC %s, per interaction L1D %s  LLC %s  branch %s misses", m_PerformanceStats.FrameTimes().Size(),
+        PerfCounters::Format(values[0], sizeof(values[0]), Counter::Instructions, m_PerformanceStats.InstructionsPerCycle(), 2),
+        PerfCounters::Format(values[1], sizeof(values[1]), Counter::L1DMisses, m_PerformanceStats.CounterPerInteraction(Counter::L1DMisses), 3),
+        PerfCounters::Format(values[2], sizeof(values[2]), Counter::LLCMisses, m_PerformanceStats.CounterPerInteraction(Counter::LLCMisses), 4),
+        PerfCounters::Format(values[3], sizeof(values[3]), Counter::BranchMisses, m_PerformanceStats.CounterPerInteraction(Counter::BranchMisses), 4));
+}
+
+
 void Application::Simulate(float dt)
 {
+    PROFILE_FUNCTION();
     const auto start = std::chrono::high_resolution_clock::now();
-    if (dt < 0.1f) // We need atleast 10 FPS to simulate properly
+    m_FrameInteractions = 0.0;
+    m_FrameSimulatedTime = 0.0;
+    if (m_Player.IsOpen())
+    {
+        // Replaying a recording, nothing to integrate
+        const double previousTime = m_Player.Time();
+        m_Player.Update(dt);
+        m_Player.Apply(&m_Bodies.Items());
+        m_FrameSimulatedTime = m_Player.Time() - previousTime;
+    }
+    else if (dt < 0.1f) // We need atleast 10 FPS to simulate properly
     {
-        switch (m_SettingsWindow.GetSimulationMode())
+        double forceEvaluations = 0.0; // full N^2 acceleration passes per step
+        m_PreviousPositions.resize(m_Bodies.Size());
+        m_PreviousVelocities.resize(m_Bodies.Size());
+        for (std::size_t i = 0; i < m_Bodies.Size(); ++i)
         {
-        case (int)Physics::SimulationAlgorithm::EulerIntegration:
-            Physics::EulerIntegration(&m_Bodies, TIME_STEP * m_SettingsWindow.GetSimulationRate(), dt);
-            break;
-        case (int)Physics::SimulationAlgorithm::VerletAlgorithm:
-            Physics::VelocityVerlet(&m_Bodies, TIME_STEP * m_SettingsWindow.GetSimulationRate(), dt);
-            break;
-        case (int)Physics::SimulationAlgorithm::RungeKutta:
-            Physics::RungeKutta4th(&m_Bodies, TIME_STEP * m_SettingsWindow.GetSimulationRate(), dt);
-            break;
-        default:
-            break;
+            m_PreviousPositions[i] = m_Bodies[i].GetPosition();
+            m_PreviousVelocities[i] = m_Bodies[i].GetVelocity();
+        }
+
+        // Planets with moons are integrated here only as their barycenters, the moons are substepped by m_Subsystems
+        const auto Integrate = [&](std::vector<Physics::RigidBody<FLOAT>>* bodies)
+        {
+            switch (m_SettingsWindow.GetSimulationMode())
+            {
+            case (int)Physics::SimulationAlgorithm::EulerIntegration:
+                Physics::EulerIntegration(bodies, TIME_STEP * m_SettingsWindow.GetSimulationRate(), dt, &m_Invariants);
+                forceEvaluations = 1.0;
+                break;
+            case (int)Physics::SimulationAlgorithm::VerletAlgorithm:
+                Physics::VelocityVerlet(bodies, TIME_STEP * m_SettingsWindow.GetSimulationRate(), dt, &m_Invariants);
+                forceEvaluations = 2.0;
+                break;
+            case (int)Physics::SimulationAlgorithm::RungeKutta:
+                Physics::RungeKutta4th(bodies, TIME_STEP * m_SettingsWindow.GetSimulationRate(), dt, &m_Invariants);
+                forceEvaluations = 4.0;
+                break;
+            default:
+                break;
+            }
+        };
+        m_FrameSimulatedTime = TIME_STEP * m_SettingsWindow.GetSimulationRate() * dt;
+        const double subsystemInteractions = m_Subsystems.Advance(&m_Bodies, m_FrameSimulatedTime, Integrate, &m_Invariants);
+        m_Drift.Update(m_Invariants);
+
+        const double n = static_cast<double>(m_Subsystems.PrimaryCount());
+        m_FrameInteractions = forceEvaluations * n * (n - 1.0) + subsystemInteractions;
+
+        // Has to run before merging, afterwards the previous state isn't parallel to the bodies anymore
+        m_Encounters.Detect(m_Bodies.Items(), m_PreviousPositions, m_PreviousVelocities, m_ElapsedTime, m_FrameSimulatedTime);
+
+        // The recording format has a fixed number of bodies
+        const std::size_t merges = m_Collisions.Resolve(&m_Bodies, m_PreviousPositions);
+        if (merges > 0)
+        {
+            TraceLog(LOG_INFO, "PHYSICS: %zu collisions merged, %zu bodies left", merges, m_Bodies.Size());
+            m_Drift.Reset(); // merging loses kinetic energy on purpose
+            if (m_Recorder.IsOpen())
+                ToggleRecording();
+        }
+
+        // m_ElapsedTime is advanced afterwards in OnUpdate()
+        if (m_Recorder.IsOpen() && !m_Recorder.AddFrame(m_ElapsedTime + TIME_STEP * m_SettingsWindow.GetSimulationRate() * dt, m_Bodies.Items()))
+        {
+            TraceLog(LOG_WARNING, "TRAJECTORY: Failed to write to %s, recording stopped", RECORDING_PATH);
+            ToggleRecording();
         }
     }
+
+    // A hidden belt costs nothing, it catches up on the simulated time once it's shown
+    m_BeltPendingTime += m_FrameSimulatedTime;
+    if (m_SettingsWindow.ShowAsteroidBelt())
+    {
+        if (m_AsteroidBelt.Count() == 0)
+            m_AsteroidBelt.Generate(ASTEROID_COUNT, ASTEROID_BELT_INNER, ASTEROID_BELT_OUTER, ASTEROID_BELT_INCLINATION);
+        m_AsteroidBelt.Advance(m_BeltPendingTime);
+        m_BeltPendingTime = 0.0;
+    }
+
     const auto end = std::chrono::high_resolution_clock::now();
     m_SimulationTime = std::chrono::duration<double, std::milli>(end - start).count();
+    m_PerformanceStats.AddPhaseTime(FramePhase::Physics, m_SimulationTime);
 }
 
 
 void Application::OnUpdate(float dt) noexcept
 {
+    PROFILE_FUNCTION();
     if (m_ShowInfoText)
     {
         const auto endInfoTimer = std::chrono::steady_clock::now();
@@ -85,83 +272,213 @@ void Application::OnUpdate(float dt) noexcept
             m_ShowInfoText = false;
     }
 
-    if (!m_SettingsWindow.Visible())
+    if (!FloatingWindow::AnyVisible())
+    {
         UpdateCameraOverride(&m_Camera, CAMERA_FREE);
+        RebaseCamera();
+    }
+
+    if (IsKeyPressed(KEY_F2))
+        ToggleRecording();
+
+    if (IsKeyPressed(KEY_F3))
+        ToggleReplay();
+
+    if (IsKeyPressed(KEY_F6)) // F5 is the performance window
+        ToggleEncounterLog();
+
+#ifdef PROFILER_ENABLED
+    if (IsKeyPressed(KEY_F4))
+    {
+        if (Profiler::WriteChromeTrace(TRACE_PATH))
+            TraceLog(LOG_INFO, "PROFILER: Trace written to %s", TRACE_PATH);
+        else
+            TraceLog(LOG_WARNING, "PROFILER: Failed to write %s", TRACE_PATH);
+        LogCounterSummary();
+    }
+#endif
+
+    if (m_Player.IsOpen())
+    {
+        // Scrubbing, speed doubles with every key press and can go negative to play backwards
+        if (IsKeyPressed(KEY_PERIOD))
+            m_Player.SetSpeed(m_Player.Speed() < 0.0 ? (m_Player.Speed() < -REPLAY_SPEED ? m_Player.Speed() * 0.5 : REPLAY_SPEED) : m_Player.Speed() * 2.0);
+        if (IsKeyPressed(KEY_COMMA))
+            m_Player.SetSpeed(m_Player.Speed() > 0.0 ? (m_Player.Speed() > REPLAY_SPEED ? m_Player.Speed() * 0.5 : -REPLAY_SPEED) : m_Player.Speed() * 2.0);
+        if (IsKeyPressed(KEY_HOME))
+            m_Player.Seek(0.0);
+        if (IsKeyPressed(KEY_END))
+            m_Player.Seek(static_cast<double>(m_Player.FrameCount()));
+    }
 
     if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT))
     {
-        // ray cast check if player clicked on a planet
+        // ray cast check if player clicked on a planet, the nearest hit wins
         const Vector2 center = { ScreenWidth() / 2.0f, ScreenHeight() / 2.0f };
-        const Ray ray = GetScreenToWorldRay(center, m_Camera);
-
-        for (size_t i = 0; i < m_Bodies.size(); i++)
-        {
-            const Vector3 pos = m_Bodies[i].GetRenderPos();
-            const float radius = static_cast<float>((m_Bodies[i].GetRadius() / m_SettingsWindow.GetRenderRadiusScale()) + 70);
+        Ray ray = GetCameraRay(m_Camera, center, ScreenWidth(), ScreenHeight());
 
-            const RayCollision collision = GetRayCollisionSphere(ray, pos, radius);
-            if (collision.hit)
-            {
-                m_SelectedBody = &m_Bodies[i];
-                break; // only one even if multiple are hit due to increased hitbox
-            }
-            else
-                m_SelectedBody = nullptr;
-        }
+        // The tree was refit relative to the camera position of the last render, the camera moved since
+        ray.position = Vector3Add(ray.position, (m_CameraPosition - m_PickOrigin).ToRaylibVector());
+        const int64_t hit = m_PickBounds.Size() == m_Bodies.Size() ? m_PickBvh.Raycast(m_PickBounds, ray) : -1;
+        m_SelectedBody = hit >= 0 ? m_Bodies.HandleAt(static_cast<std::size_t>(hit)) : SlotHandle();
     }
 
-    m_ElapsedTime += TIME_STEP * m_SettingsWindow.GetSimulationRate() * dt;
+    if (m_Player.IsOpen())
+        m_ElapsedTime = m_Player.Time();
+    else
+        m_ElapsedTime += TIME_STEP * m_SettingsWindow.GetSimulationRate() * dt;
 }
 
 
-// We can't let renderer do this because we need to modify the render positions of the bodies
-void Application::RenderPlanets(std::vector<Physics::RigidBody<FLOAT>>* bodies, const Physics::RigidBody<FLOAT>& sun) const
+// We can't let renderer do this because we need to modify the render positions of the bodies.
+// sun is one of bodies or nullptr if the central body is gone (merged).
+void Application::RenderPlanets(std::vector<Physics::RigidBody<FLOAT>>* bodies, const Physics::RigidBody<FLOAT>* sun, const Frustum& frustum)
 {
+    PROFILE_FUNCTION();
     std::vector<Physics::RigidBody<FLOAT>>& bodiesRef = *bodies;
+    const double sunRadius = sun != nullptr ? sun->GetRadius() / m_SettingsWindow.GetRenderRadiusScale() : 0.0;
 
+    m_BodyBounds.Resize(bodiesRef.size());
+    m_PickBounds.Resize(bodiesRef.size());
+    const float pixelToWorld = std::tan(0.5f * m_Camera.fovy * DEG2RAD) / (0.5f * static_cast<float>(GetScreenHeight()));
     for (size_t i = 0; i < bodiesRef.size(); i++)
     {
-        Vector3 pos = Renderer::MetersToWorld(bodiesRef[i].GetPosition().ToRaylibVector(), m_SettingsWindow.GetRenderDistanceScale());
+        Math::Vector3<double> pos = Renderer::MetersToWorld(bodiesRef[i].GetPosition(), m_SettingsWindow.GetRenderDistanceScale());
         const float renderedRadius = (float)(bodiesRef[i].GetRadius() / m_SettingsWindow.GetRenderRadiusScale());
 
         // Quick and dirty fix to add the radius off the planet and the sun to it's position to
         // properly render it
-        if (i != 0)
+        if (&bodiesRef[i] != sun)
         {
-            Vector3 direction = Vector3Normalize(pos);
-            pos = Vector3Add(pos, Vector3Scale(direction, renderedRadius)); // move forward by its rendered radius
-            pos = Vector3Add(pos, Vector3Scale(direction, (float)(sun.GetRadius() / m_SettingsWindow.GetRenderRadiusScale())));
+            Math::Vector3<double> direction = pos;
+            direction.Normalize();
+            pos = pos + direction * (double)renderedRadius; // move forward by its rendered radius
+            pos = pos + direction * sunRadius;
         }
-        bodiesRef[i].SetRenderPos(pos);
-        DrawSphere(pos, renderedRadius, bodiesRef[i].GetColor());
+        const Vector3 renderPos = Renderer::WorldToRender(pos, m_CameraPosition);
+        bodiesRef[i].SetRenderPos(renderPos);
+        m_BodyBounds.Set(i, renderPos, renderedRadius);
+        m_PickBounds.Set(i, renderPos, std::max(renderedRadius, Vector3Length(renderPos) * pixelToWorld * PICK_RADIUS_PIXELS));
     }
+    m_PickBvh.Refit(m_PickBounds);
+    m_PickOrigin = m_CameraPosition;
+
+    // Render positions are needed by picking and labels even for culled bodies, only drawing is skipped
+    frustum.TestSpheres(m_BodyBounds, &m_BodyVisible);
+    SphereRenderer::Begin(m_Camera);
+    for (size_t i = 0; i < bodiesRef.size(); i++)
+        if (m_BodyVisible[i])
+            SphereRenderer::Add(bodiesRef[i].GetRenderPos(), m_BodyBounds.radius[i], bodiesRef[i].GetColor());
+    SphereRenderer::Flush();
+}
+
+
+void Application::RenderTrails(const Frustum& frustum)
+{
+    PROFILE_FUNCTION();
+    // Samples are stored in world units, they don't line up anymore once a scale changed
+    const Vector2 scales = { m_SettingsWindow.GetRenderDistanceScale(), m_SettingsWindow.GetRenderRadiusScale() };
+    if (scales.x != m_TrailScales.x || scales.y != m_TrailScales.y)
+    {
+        TrailRenderer::Clear();
+        m_TrailAnchor = m_CameraPosition;
+        m_TrailScales = scales;
+        m_TrailTime = TRAIL_SAMPLE_INTERVAL;
+    }
+
+    m_TrailTime += std::abs(m_FrameSimulatedTime);
+    if (m_TrailTime >= TRAIL_SAMPLE_INTERVAL)
+    {
+        TrailRenderer::Push(m_Bodies.Items(), (m_CameraPosition - m_TrailAnchor).ToRaylibVector());
+        m_TrailTime = 0.0;
+    }
+    TrailRenderer::Draw(frustum, (m_TrailAnchor - m_CameraPosition).ToRaylibVector());
+}
+
+
+void Application::RenderAsteroidBelt(const Physics::RigidBody<FLOAT>& sun, const Frustum& frustum)
+{
+    PROFILE_FUNCTION();
+    // The whole belt is bounded by a sphere around the sun, positions aren't even updated if it's hidden
+    const float distanceScale = m_SettingsWindow.GetRenderDistanceScale();
+    const Vector3 center = sun.GetRenderPos();
+    if (!frustum.TestSphere(center, (float)(ASTEROID_BELT_OUTER / distanceScale)))
+        return;
+
+    // Positions are relative to the sun so they only change with the simulation, not with the camera
+    const uint64_t beltVersion = m_AsteroidBelt.UpdatePositions({ 0.f, 0.f, 0.f }, distanceScale);
+    ParticleRenderer::Upload(m_AsteroidBelt.Positions(), m_AsteroidBelt.Count(), beltVersion);
+    ParticleRenderer::Draw(m_Camera, center, 0.f, 1.f, Fade(LIGHTGRAY, 0.8f));
 }
 
 
 void Application::OnRender()
 {
+    PROFILE_FUNCTION();
+    using Clock = std::chrono::steady_clock;
+    const auto Milliseconds = [](Clock::time_point a, Clock::time_point b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+    const Clock::time_point renderStart = Clock::now();
+
     BeginDrawing();
     ClearBackground(BLACK);
     BeginMode3D(m_Camera);
 
-    Renderer::Draw3DGridWithAxes(100, 30.0f);
-    RenderPlanets(&m_Bodies, m_Bodies[0]);
+    // Planes are extracted once and shared by everything culled this frame
+    const Frustum frustum(LabelLayer::ViewProjection(m_Camera, GetScreenWidth(), GetScreenHeight()));
+    Renderer::Draw3DGridWithAxes(100, 30.0f, m_CameraPosition.ToRaylibVector());
+    // The belt orbits the sun, without it (empty catalog, merged away) there's nothing to center it on
+    const Physics::RigidBody<FLOAT>* sun = m_Bodies.Get(m_CentralBody);
+    RenderPlanets(&m_Bodies.Items(), sun, frustum);
+    RenderTrails(frustum);
+    if (sun != nullptr && m_SettingsWindow.ShowAsteroidBelt())
+        RenderAsteroidBelt(*sun, frustum);
 
 
     //DrawLine3D(MetersToWorld(earth.GetPosition().ToRaylibVector()), MetersToWorld(moonA.GetPosition().ToRaylibVector()), RED);
     //DrawLine3D(MetersToWorld(earth.GetPosition().ToRaylibVector()), MetersToWorld(moonB.GetPosition().ToRaylibVector()), RED);
 
     // Optional: show barycenter
-    //Vector3 bary = MetersToWorld(Physics::ComputeBarycenter(bodies, 3).ToRaylibVector());
-    //DrawSphere(bary, 10.0f, RED);
     EndMode3D();
+    const Clock::time_point guiStart = Clock::now();
 
-    Renderer::RenderCoordinateAxis(m_Camera);
-    Renderer::RenderPlanetLabels(m_Bodies, m_Camera, m_SettingsWindow.GetRenderRadiusScale());
+    Renderer::BeginText();
+    HudText::Begin();
+    Renderer::RenderCoordinateAxis(m_Camera, m_CameraPosition.ToRaylibVector());
+    Renderer::RenderPlanetLabels(m_Bodies.Items(), m_BodyVisible, m_Camera, m_SettingsWindow.GetRenderRadiusScale(), m_Bodies.Get(m_SelectedBody));
     Renderer::RenderStats(m_ElapsedTime, m_ShowInfoText, m_SimulationTime, ScreenWidth());
-    Renderer::RenderPlanetStats(m_SelectedBody);
-    m_SettingsWindow.Draw();
+    Renderer::RenderPlanetStats(m_Bodies.Get(m_SelectedBody));
+    if (m_Recorder.IsOpen())
+        HudText::Set(HudLine::Recording, "REC", ScreenWidth() - 60.f, 10, RED);
+    if (m_Encounters.IsOpen())
+        HudText::Format(HudLine::Encounters, ScreenWidth() - 160.f, 40, ORANGE, "ENC %zu", m_Encounters.EventCount());
+    if (m_Drift.HasValues() && !m_Player.IsOpen())
+    {
+        HudText::Format(HudLine::EnergyDrift, ScreenWidth() - 160.f, 70, WHITE, "dE/E %.2e", m_Drift.EnergyDrift());
+        HudText::Format(HudLine::MomentumDrift, ScreenWidth() - 160.f, 90, WHITE, "dP/P %.2e", m_Drift.MomentumDrift());
+        HudText::Format(HudLine::AngularMomentumDrift, ScreenWidth() - 160.f, 110, WHITE, "dL/L %.2e", m_Drift.AngularMomentumDrift());
+    }
+    HudText::Draw();
+    m_SettingsWindow.Draw(&m_Player);
+    m_PerformanceWindow.Draw(m_PerformanceStats);
+    Renderer::EndText();
 
     DrawCircle(ScreenWidth() / 2, ScreenHeight() / 2, 1, WHITE);
-    EndDrawing();
+    const Clock::time_point presentStart = Clock::now();
+
+    {
+        PROFILE_SCOPE("EndDrawing");
+        EndDrawing();
+    }
+    const Clock::time_point presentEnd = Clock::now();
+
+    m_PerformanceStats.AddPhaseTime(FramePhase::Render, Milliseconds(renderStart, guiStart));
+    m_PerformanceStats.AddPhaseTime(FramePhase::GUI, Milliseconds(guiStart, presentStart));
+    m_PerformanceStats.AddPhaseTime(FramePhase::Present, Milliseconds(presentStart, presentEnd));
+
+    const PerfCounters::Values totals = PerfCounters::Totals();
+    PerfCounters::Values counters;
+    for (std::size_t i = 0; i < PerfCounters::CounterCount; ++i)
+        counters[i] = totals[i] - m_CounterTotals[i];
+    m_CounterTotals = totals;
+    m_PerformanceStats.EndFrame(GetFrameTime() * 1000.0, m_FrameInteractions, m_FrameSimulatedTime, counters);
 }
\ No newline at end of file
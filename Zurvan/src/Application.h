@@ -8,11 +8,36 @@
 #include "GUI.h"
 #include "Config.h"
 #include "Physics.h"
+#include "Catalog.h"
+#include "Bvh.h"
+#include "SlotMap.h"
+#include "Collisions.h"
+#include "Encounters.h"
+#include "Subsystems.h"
+#include "Frustum.h"
+#include "AsteroidBelt.h"
+#include "PerformanceStats.h"
+#include "Trajectory.h"
+#include "TrajectoryPlayer.h"
 
 class Application
 {
 private:
     const double TIME_STEP = 60 * 60; // 1 hour per second
+    const double RECORDING_ERROR_BOUND = 1000; // meters
+    const char* RECORDING_PATH = "trajectory.ztr";
+    const double REPLAY_SPEED = 30; // recorded frames per second
+    const std::size_t ASTEROID_COUNT = 50000;
+    const double ASTEROID_BELT_INNER = 3.3e11; // meters, ~2.2 AU
+    const double ASTEROID_BELT_OUTER = 4.9e11; // meters, ~3.3 AU
+    const double ASTEROID_BELT_INCLINATION = 0.2; // radians
+    const double TRAIL_SAMPLE_INTERVAL = 60 * 60 * 24 * 2; // simulated seconds between two trail samples
+    const char* ENCOUNTER_PATH = "encounters.csv";
+    const double ENCOUNTER_DISTANCE = 7.5e9; // meters, ~0.05 AU
+    const float PICK_RADIUS_PIXELS = 8.f; // bodies smaller than this on screen are picked as if they were this large
+#ifdef PROFILER_ENABLED
+    const char* TRACE_PATH = "zurvan_trace.json";
+#endif
 private:
     int m_ScreenWidth;
     int m_ScreenHeight;
@@ -20,21 +45,57 @@ private:
     double m_ElapsedTime = 0.0;
     double m_SimulationTime = 0.0;
 
-    Camera3D m_Camera;
+    double m_FrameInteractions = 0.0;
+    double m_FrameSimulatedTime = 0.0;
+    double m_TrailTime = 0.0; // simulated seconds since the last trail sample
+    Vector2 m_TrailScales = { 0.f, 0.f }; // render distance and radius scale the trail samples were taken with
+    Math::Vector3<double> m_TrailAnchor; // world position the trail samples are stored relative to
+    PerfCounters::Values m_CounterTotals{}; // PerfCounters::Totals() at the end of the previous frame
+    SphereBatch m_BodyBounds; // rendered bounding spheres, rebuilt every frame
+    std::vector<uint8_t> m_BodyVisible; // 1 if the body intersects the view frustum this frame
+    SphereBatch m_PickBounds; // render positions with the pick radius, refit into m_PickBvh every frame
+    SphereBvh m_PickBvh;
+    Math::Vector3<double> m_PickOrigin; // camera position m_PickBounds are relative to
+
+    Camera3D m_Camera; // always at the render origin, see RebaseCamera()
+    Math::Vector3<double> m_CameraPosition; // world position of the camera and thereby of the render origin
     SettingsWindow m_SettingsWindow;
-    Physics::RigidBody<FLOAT>* m_SelectedBody;
-    std::vector<Physics::RigidBody<FLOAT>> m_Bodies;
+    PerformanceStats m_PerformanceStats;
+    PerformanceWindow m_PerformanceWindow;
+    SlotHandle m_SelectedBody; // null while nothing is selected
+    SlotHandle m_CentralBody; // the catalog's first body, the sun
+    Catalog::Bodies m_Catalog; // owns the labels of m_Bodies
+    SlotMap<Physics::RigidBody<FLOAT>> m_Bodies;
+    std::vector<Math::Vector3<FLOAT>> m_PreviousPositions; // before the last step, swept by m_Collisions and m_Encounters
+    std::vector<Math::Vector3<FLOAT>> m_PreviousVelocities;
+    Physics::Subsystems m_Subsystems; // planets with moons
+    Physics::Collisions m_Collisions;
+    Physics::Encounters m_Encounters;
+    Physics::Invariants m_Invariants; // of the state before the last step
+    Physics::DriftMonitor m_Drift;
+    AsteroidBelt m_AsteroidBelt; // generated when first shown
+    double m_BeltPendingTime = 0.0; // simulated seconds the hidden belt hasn't been advanced by
+    Trajectory::Writer m_Recorder;
+    Trajectory::Player m_Player;
     std::chrono::steady_clock::time_point m_InfoTimer;
 public:
-    Application(int width, int height) noexcept;
+    // catalogPath is a text or binary catalog (see Catalog.h), the built-in solar system is used without one
+    Application(int width, int height, const char* catalogPath = nullptr) noexcept;
     ~Application() noexcept = default;
 
     constexpr int ScreenWidth() const noexcept;
     constexpr int ScreenHeight() const noexcept;
     void SetScreenSize(int width, int height) noexcept;
+    void ToggleRecording() noexcept;
+    void ToggleReplay() noexcept;
+    void ToggleEncounterLog();
+    void LogCounterSummary() const;
+    void RebaseCamera() noexcept;
 
     void Simulate(float dt);
     void OnUpdate(float dt) noexcept;
-    void RenderPlanets(std::vector<Physics::RigidBody<FLOAT>>* bodies, const Physics::RigidBody<FLOAT>& sun) const;
+    void RenderPlanets(std::vector<Physics::RigidBody<FLOAT>>* bodies, const Physics::RigidBody<FLOAT>* sun, const Frustum& frustum);
+    void RenderTrails(const Frustum& frustum);
+    void RenderAsteroidBelt(const Physics::RigidBody<FLOAT>& sun, const Frustum& frustum);
     void OnRender();
 };
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+#include <cmath>
+#include <random>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include "raylib.h"
+
+#include "Math.h"
+#include "Config.h"
+#include "Physics.h"
+#include "Profiler.h"
+
+// Massless particles on circular Kepler orbits around the sun. They don't take part in the N-body
+// integration, their phase is advanced analytically which keeps even 10^6 particles cheap.
+class AsteroidBelt
+{
+private:
+    // Structure of arrays, Advance() only ever touches the phases
+    std::vector<double> m_Radius;          // meters
+    std::vector<double> m_Phase;           // radians
+    std::vector<double> m_AngularVelocity; // radians per second
+    std::vector<float> m_CosInclination;
+    std::vector<float> m_SinInclination;
+    std::vector<float> m_CosNode;
+    std::vector<float> m_SinNode;
+
+    std::vector<float> m_Positions; // x, y, z in world units
+    uint64_t m_Version = 0;
+    bool m_Dirty = true;
+    float m_DistanceScale = 0.f;
+    Vector3 m_Center = { 0, 0, 0 };
+public:
+    void Generate(std::size_t count, double innerRadius, double outerRadius, double maxInclination, uint32_t seed = 1)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> radius(innerRadius, outerRadius);
+        std::uniform_real_distribution<double> angle(0.0, 2.0 * Physics::Const::Pi);
+        std::uniform_real_distribution<double> inclination(-maxInclination, maxInclination);
+
+        m_Radius.resize(count);
+        m_Phase.resize(count);
+        m_AngularVelocity.resize(count);
+        m_CosInclination.resize(count);
+        m_SinInclination.resize(count);
+        m_CosNode.resize(count);
+        m_SinNode.resize(count);
+        m_Positions.resize(count * 3);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const double r = radius(rng);
+            const double incline = inclination(rng);
+            const double node = angle(rng);
+            m_Radius[i] = r;
+            m_Phase[i] = angle(rng);
+            m_AngularVelocity[i] = std::sqrt(Physics::Const::G * Physics::Const::SUN_MASS / (r * r * r));
+            m_CosInclination[i] = static_cast<float>(std::cos(incline));
+            m_SinInclination[i] = static_cast<float>(std::sin(incline));
+            m_CosNode[i] = static_cast<float>(std::cos(node));
+            m_SinNode[i] = static_cast<float>(std::sin(node));
+        }
+        m_Dirty = true;
+    }
+
+    void Advance(double seconds) noexcept
+    {
+        PROFILE_FUNCTION();
+        if (seconds == 0.0) return;
+
+        const double fullTurn = 2.0 * Physics::Const::Pi;
+        for (std::size_t i = 0; i < m_Phase.size(); ++i)
+            m_Phase[i] = std::fmod(m_Phase[i] + m_AngularVelocity[i] * seconds, fullTurn);
+        m_Dirty = true;
+    }
+
+    // Recomputes the world positions if anything changed since the last call, center is the world position
+    // of the sun. Returns the version of the positions, it only changes if they did.
+    uint64_t UpdatePositions(Vector3 center, float distanceScale) noexcept
+    {
+        PROFILE_FUNCTION();
+        if (!m_Dirty && distanceScale == m_DistanceScale && center.x == m_Center.x && center.y == m_Center.y && center.z == m_Center.z)
+            return m_Version;
+
+        for (std::size_t i = 0; i < m_Radius.size(); ++i)
+        {
+            // Same orientation as the planets, prograde motion goes towards -z
+            const float r = static_cast<float>(m_Radius[i] / distanceScale);
+            const float x = r * static_cast<float>(std::cos(m_Phase[i]));
+            const float s = -r * static_cast<float>(std::sin(m_Phase[i]));
+            const float y = s * m_SinInclination[i];
+            const float z = s * m_CosInclination[i];
+
+            m_Positions[i * 3 + 0] = center.x + x * m_CosNode[i] - z * m_SinNode[i];
+            m_Positions[i * 3 + 1] = center.y + y;
+            m_Positions[i * 3 + 2] = center.z + x * m_SinNode[i] + z * m_CosNode[i];
+        }
+
+        m_Dirty = false;
+        m_DistanceScale = distanceScale;
+        m_Center = center;
+        return ++m_Version;
+    }
+
+    const float* Positions() const noexcept { return m_Positions.data(); }
+    std::size_t Count() const noexcept { return m_Radius.size(); }
+};
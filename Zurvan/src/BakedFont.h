@@ -0,0 +1,75 @@
+#pragma once
+#include <cstddef>
+
+#include "raylib.h"
+
+// Font atlases rasterized at build time by Tools/FontBaker, see FontAtlas.h. At startup the atlas only has
+// to be inflated and uploaded, the TTF is neither parsed nor shipped.
+namespace BakedFont
+{
+    struct Glyph
+    {
+        int value;
+        int offsetX;
+        int offsetY;
+        int advanceX;
+        float x, y, width, height; // rectangle in the atlas
+    };
+
+    struct Atlas
+    {
+        int baseSize;
+        int glyphCount;
+        int glyphPadding;
+        int width;
+        int height;
+        bool sdf; // alpha holds signed distances with the outline at 0.5, has to be drawn with Shaders::SdfTextFragment
+        const Glyph* glyphs;
+        const unsigned char* alpha; // DEFLATE compressed coverage or distance, one byte per pixel
+        std::size_t alphaSize;
+    };
+
+    // The returned font owns its memory like one from LoadFont and has to be released with UnloadFont
+    inline Font Load(const Atlas& atlas) noexcept
+    {
+        int size = 0;
+        unsigned char* alpha = DecompressData(atlas.alpha, static_cast<int>(atlas.alphaSize), &size);
+        if (alpha == nullptr || size != atlas.width * atlas.height)
+        {
+            TraceLog(LOG_WARNING, "FONT: Baked atlas is corrupted, falling back to the default font");
+            MemFree(alpha);
+            return GetFontDefault();
+        }
+
+        // Same layout GenImageFontAtlas produces, white with the coverage in alpha
+        Image image = { MemAlloc(static_cast<unsigned int>(size * 2)), atlas.width, atlas.height, 1, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA };
+        unsigned char* pixels = static_cast<unsigned char*>(image.data);
+        for (int i = 0; i < size; ++i)
+        {
+            pixels[2 * i] = 255;
+            pixels[2 * i + 1] = alpha[i];
+        }
+        MemFree(alpha);
+
+        Font font = {};
+        font.baseSize = atlas.baseSize;
+        font.glyphCount = atlas.glyphCount;
+        font.glyphPadding = atlas.glyphPadding;
+        font.texture = LoadTextureFromImage(image);
+        UnloadImage(image);
+
+        // Glyph images stay empty, they're only needed by ImageDrawText
+        font.recs = static_cast<Rectangle*>(MemAlloc(static_cast<unsigned int>(atlas.glyphCount) * sizeof(Rectangle)));
+        font.glyphs = static_cast<GlyphInfo*>(MemAlloc(static_cast<unsigned int>(atlas.glyphCount) * sizeof(GlyphInfo)));
+        for (int i = 0; i < atlas.glyphCount; ++i)
+        {
+            const Glyph& g = atlas.glyphs[i];
+            font.recs[i] = { g.x, g.y, g.width, g.height };
+            font.glyphs[i].value = g.value;
+            font.glyphs[i].offsetX = g.offsetX;
+            font.glyphs[i].offsetY = g.offsetY;
+            font.glyphs[i].advanceX = g.advanceX;
+        }
+        return font;
+    }
+}
@@ -0,0 +1,234 @@
+#pragma once
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+#include "raylib.h"
+
+#include "Frustum.h"
+#include "Profiler.h"
+
+// Bounding volume hierarchy over a SphereBatch answering nearest hit ray queries. The tree is built once
+// with median splits and then only refit as the spheres move, it's rebuilt when refitting made the boxes
+// too loose or the number of spheres changed.
+class SphereBvh
+{
+private:
+    struct Node
+    {
+        float min[3];
+        float max[3];
+        uint32_t start; // first index for leaves, right child for inner nodes (left child is the next node)
+        uint32_t count; // 0 for inner nodes
+    };
+
+    static constexpr uint32_t LeafSize = 4;
+    static constexpr float RebuildFactor = 2.f; // rebuild once the summed node area grew by this factor
+private:
+    std::vector<Node> m_Nodes;
+    std::vector<uint32_t> m_Indices;
+    float m_BuildArea = 0.f;
+private:
+    static float Area(const Node& n) noexcept
+    {
+        const float dx = n.max[0] - n.min[0], dy = n.max[1] - n.min[1], dz = n.max[2] - n.min[2];
+        return dx * dy + dy * dz + dz * dx;
+    }
+
+    static void FitLeaf(Node* node, const SphereBatch& s, const uint32_t* indices) noexcept
+    {
+        constexpr float inf = std::numeric_limits<float>::infinity();
+        float mn[3] = { inf, inf, inf }, mx[3] = { -inf, -inf, -inf };
+        for (uint32_t k = 0; k < node->count; ++k)
+        {
+            const uint32_t i = indices[node->start + k];
+            const float c[3] = { s.x[i], s.y[i], s.z[i] };
+            for (int a = 0; a < 3; ++a)
+            {
+                mn[a] = std::min(mn[a], c[a] - s.radius[i]);
+                mx[a] = std::max(mx[a], c[a] + s.radius[i]);
+            }
+        }
+        std::copy(mn, mn + 3, node->min);
+        std::copy(mx, mx + 3, node->max);
+    }
+
+    static void FitInner(Node* node, const Node& left, const Node& right) noexcept
+    {
+        for (int a = 0; a < 3; ++a)
+        {
+            node->min[a] = std::min(left.min[a], right.min[a]);
+            node->max[a] = std::max(left.max[a], right.max[a]);
+        }
+    }
+
+    void Build(const SphereBatch& s, uint32_t start, uint32_t count)
+    {
+        const std::size_t nodeIndex = m_Nodes.size();
+        m_Nodes.push_back({ {}, {}, start, count });
+        if (count <= LeafSize)
+        {
+            FitLeaf(&m_Nodes[nodeIndex], s, m_Indices.data());
+            return;
+        }
+
+        // Split at the median along the axis with the largest spread of centers
+        constexpr float inf = std::numeric_limits<float>::infinity();
+        float mn[3] = { inf, inf, inf }, mx[3] = { -inf, -inf, -inf };
+        for (uint32_t k = start; k < start + count; ++k)
+        {
+            const uint32_t i = m_Indices[k];
+            const float c[3] = { s.x[i], s.y[i], s.z[i] };
+            for (int a = 0; a < 3; ++a)
+            {
+                mn[a] = std::min(mn[a], c[a]);
+                mx[a] = std::max(mx[a], c[a]);
+            }
+        }
+        const int axis = (mx[0] - mn[0] >= mx[1] - mn[1] && mx[0] - mn[0] >= mx[2] - mn[2]) ? 0 : (mx[1] - mn[1] >= mx[2] - mn[2] ? 1 : 2);
+        const float* center = axis == 0 ? s.x.data() : (axis == 1 ? s.y.data() : s.z.data());
+
+        const uint32_t half = count / 2;
+        std::nth_element(m_Indices.begin() + start, m_Indices.begin() + start + half, m_Indices.begin() + start + count,
+            [center](uint32_t a, uint32_t b) { return center[a] < center[b]; });
+
+        Build(s, start, half);
+        const uint32_t right = static_cast<uint32_t>(m_Nodes.size());
+        Build(s, start + half, count - half);
+
+        Node& node = m_Nodes[nodeIndex];
+        node.start = right;
+        node.count = 0;
+        FitInner(&node, m_Nodes[nodeIndex + 1], m_Nodes[right]);
+    }
+
+    // Slab test, returns the entry distance or infinity if the box is missed or further away than maxDistance
+    static float Enter(const Node& n, const float origin[3], const float invDir[3], float maxDistance) noexcept
+    {
+        float tmin = 0.f, tmax = maxDistance;
+        for (int a = 0; a < 3; ++a)
+        {
+            float t0 = (n.min[a] - origin[a]) * invDir[a];
+            float t1 = (n.max[a] - origin[a]) * invDir[a];
+            if (t0 > t1) std::swap(t0, t1);
+            tmin = std::max(tmin, t0);
+            tmax = std::min(tmax, t1);
+        }
+        return tmin <= tmax ? tmin : std::numeric_limits<float>::infinity();
+    }
+
+    static float SphereHit(const SphereBatch& s, uint32_t i, const Ray& ray) noexcept
+    {
+        const float ox = ray.position.x - s.x[i], oy = ray.position.y - s.y[i], oz = ray.position.z - s.z[i];
+        const float b = ox * ray.direction.x + oy * ray.direction.y + oz * ray.direction.z;
+
+        // Distance of the center to the ray from the closest point, avoids cancellation for far away spheres
+        const float px = ox - b * ray.direction.x, py = oy - b * ray.direction.y, pz = oz - b * ray.direction.z;
+        const float discriminant = s.radius[i] * s.radius[i] - (px * px + py * py + pz * pz);
+        if (discriminant < 0.f)
+            return std::numeric_limits<float>::infinity();
+
+        const float root = std::sqrt(discriminant);
+        const float t = -b - root >= 0.f ? -b - root : -b + root; // the far side if the ray starts inside
+        return t >= 0.f ? t : std::numeric_limits<float>::infinity();
+    }
+public:
+    // Updates the boxes to the current spheres, the tree is rebuilt if needed
+    void Refit(const SphereBatch& s)
+    {
+        PROFILE_FUNCTION();
+        if (s.Size() != m_Indices.size() || m_Nodes.empty())
+        {
+            Rebuild(s);
+            return;
+        }
+
+        // Children always come after their parent, walking backwards visits them first
+        float area = 0.f;
+        for (std::size_t n = m_Nodes.size(); n-- > 0;)
+        {
+            Node& node = m_Nodes[n];
+            if (node.count > 0)
+                FitLeaf(&node, s, m_Indices.data());
+            else
+                FitInner(&node, m_Nodes[n + 1], m_Nodes[node.start]);
+            area += Area(node);
+        }
+
+        if (area > RebuildFactor * m_BuildArea)
+            Rebuild(s);
+    }
+
+    void Rebuild(const SphereBatch& s)
+    {
+        PROFILE_FUNCTION();
+        m_Nodes.clear();
+        m_Indices.resize(s.Size());
+        for (std::size_t i = 0; i < m_Indices.size(); ++i)
+            m_Indices[i] = static_cast<uint32_t>(i);
+        if (m_Indices.empty())
+            return;
+
+        m_Nodes.reserve(2 * m_Indices.size() / LeafSize + 1);
+        Build(s, 0, static_cast<uint32_t>(m_Indices.size()));
+
+        m_BuildArea = 0.f;
+        for (const Node& node : m_Nodes)
+            m_BuildArea += Area(node);
+    }
+
+    // Index of the nearest sphere hit by the ray or -1, the ray direction has to be normalized.
+    // Expects the same batch the tree was last refit with.
+    int64_t Raycast(const SphereBatch& s, const Ray& ray, float* distance = nullptr) const
+    {
+        PROFILE_FUNCTION();
+        if (m_Nodes.empty()) return -1;
+
+        const float origin[3] = { ray.position.x, ray.position.y, ray.position.z };
+        const float invDir[3] = { 1.f / ray.direction.x, 1.f / ray.direction.y, 1.f / ray.direction.z };
+
+        float best = std::numeric_limits<float>::infinity();
+        int64_t hit = -1;
+
+        uint32_t stack[64];
+        int top = 0;
+        if (Enter(m_Nodes[0], origin, invDir, best) < best)
+            stack[top++] = 0;
+
+        while (top > 0)
+        {
+            const Node& node = m_Nodes[stack[--top]];
+            if (node.count > 0)
+            {
+                for (uint32_t k = 0; k < node.count; ++k)
+                {
+                    const uint32_t i = m_Indices[node.start + k];
+                    const float t = SphereHit(s, i, ray);
+                    if (t < best)
+                    {
+                        best = t;
+                        hit = i;
+                    }
+                }
+                continue;
+            }
+
+            // Visit the nearer child first so the far one can be rejected with a tighter best distance
+            const uint32_t left = static_cast<uint32_t>(&node - m_Nodes.data()) + 1;
+            const uint32_t right = node.start;
+            const float tLeft = Enter(m_Nodes[left], origin, invDir, best);
+            const float tRight = Enter(m_Nodes[right], origin, invDir, best);
+            const bool leftFirst = tLeft <= tRight;
+            const float tNear = leftFirst ? tLeft : tRight, tFar = leftFirst ? tRight : tLeft;
+            if (tFar < best) stack[top++] = leftFirst ? right : left;
+            if (tNear < best) stack[top++] = leftFirst ? left : right;
+        }
+
+        if (distance != nullptr && hit >= 0)
+            *distance = best;
+        return hit;
+    }
+};
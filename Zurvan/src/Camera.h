@@ -1,4 +1,6 @@
 #pragma once
+#include <cmath>
+
 #include "raylib.h"
 #include "raymath.h"
 #include "rcamera.h"
@@ -102,4 +104,20 @@ inline void UpdateCameraOverride(Camera* camera, int mode)
         if (IsKeyPressed(KEY_KP_SUBTRACT)) CameraMoveToTarget(camera, 2.0f);
         if (IsKeyPressed(KEY_KP_ADD)) CameraMoveToTarget(camera, -2.0f);
     }
-}
\ No newline at end of file
+}
+// Ray through a screen position built from the camera basis. raylib's GetScreenToWorldRay unprojects the far
+// plane, which overflows a float matrix at our far distance and yields a NaN direction. Perspective only.
+inline Ray GetCameraRay(const Camera& camera, Vector2 screenPos, int width, int height) noexcept
+{
+    const Vector3 forward = Vector3Normalize(Vector3Subtract(camera.target, camera.position));
+    const Vector3 right = Vector3Normalize(Vector3CrossProduct(forward, camera.up));
+    const Vector3 up = Vector3CrossProduct(right, forward);
+
+    const float tanHalfFovy = std::tan(0.5f * camera.fovy * DEG2RAD);
+    const float aspect = static_cast<float>(width) / static_cast<float>(height);
+    const float x = (2.f * screenPos.x / static_cast<float>(width) - 1.f) * tanHalfFovy * aspect;
+    const float y = (1.f - 2.f * screenPos.y / static_cast<float>(height)) * tanHalfFovy;
+
+    const Vector3 direction = Vector3Add(forward, Vector3Add(Vector3Scale(right, x), Vector3Scale(up, y)));
+    return { camera.position, Vector3Normalize(direction) };
+}
@@ -0,0 +1,619 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+#include <charconv>
+#include <algorithm>
+#include <string_view>
+
+#include "raylib.h"
+
+#include "Math.h"
+#include "Kepler.h"
+#include "Physics.h"
+#include "SlotMap.h"
+#include "Subsystems.h"
+#include "Profiler.h"
+#include "MappedFile.h"
+
+/*
+    Body catalogs (scenarios)
+
+    Text catalogs have one body per line, '#' starts a comment. The first body is the central one.
+    A row either places the body on the x axis at distance from the origin, moving with speed around it
+        label, mass [kg], radius [m], distance [m], speed [m/s], inclination [rad], color
+    or gives the Keplerian elements of its orbit around the central body (elliptic only, angles in degrees
+    like in the usual asteroid catalogs)
+        label, mass [kg], radius [m], a [m], e, i, node, argument of periapsis, mean anomaly, color
+    color is a raylib color name (YELLOW) or hex RRGGBB / RRGGBBAA. Elements are converted to state
+    vectors in one batch after parsing (Kepler.h). A label of the form Parent/Moon makes the elements
+    relative to the earlier row labeled Parent instead, such bodies form a sub-system (Subsystems.h).
+
+    Binary catalogs hold the resulting state vectors for large scenarios and are recognized by their
+    magic. Layout (little endian):
+        Header  magic "ZCAT", u32 version, u64 rowCount, u64 labelBytes
+        Columns f64 mass[n], f64 radius[n], f64 x[n], f64 y[n], f64 z[n], f64 vx[n], f64 vy[n], f64 vz[n], u8 rgba[n * 4], u32 label[n], u32 parent[n]
+        Labels  labelBytes of NUL terminated strings, label[i] is the offset of the row's string
+    parent[i] is the row a moon orbits, NoParent for bodies orbiting the central one.
+*/
+namespace Catalog
+{
+    constexpr char Magic[4] = { 'Z', 'C', 'A', 'T' };
+    constexpr uint32_t Version = 3;
+    constexpr uint32_t NoParent = UINT32_MAX;
+    constexpr std::size_t HeaderSize = 24;
+    static_assert(sizeof(Color) == 4, "Colors are stored as four bytes");
+
+    // Replaces the bodies that used to be hard-coded in the Application constructor
+    inline constexpr const char* SolarSystem = R"(
+        # label,  mass,        radius,    distance,      speed,       inclination, color
+        Sun,      1.988416e30, 696265000, 0,             0,           0,           YELLOW
+        Earth,    5.972e24,    6378000,   149000000000,  -29722.2222, 0,           BLUE
+        Jupiter,  1.89813e27,  69911000,  778000000000,  -13000,      0.023,       BROWN
+        Mercury,  3.30104e23,  2439700,   58000000000,   -47870,      0.122,       GRAY
+        Venus,    4.867e24,    6051800,   108000000000,  -35000,      0.059,       RED
+        Mars,     6.39e23,     3389500,   227900000000,  -24100,      0.032,       ORANGE
+        Saturn,   5.683e26,    58232000,  1400000000000, -9672,       0.044,       VIOLET
+        Uranus,   8.681e25,    25362000,  2900000000000, -6835,       0.013,       SKYBLUE
+        Neptun,   1.024e26,    24622000,  4500000000000, -5430,       0.031,       DARKBLUE
+        Pluto,    1.303e22,    1188000,   5900000000000, -4748,       0.2994985,   WHITE
+    )";
+
+
+    // Structure of arrays, every label is stored once in a single arena
+    class Bodies
+    {
+    public:
+        std::vector<double> mass;
+        std::vector<double> radius;
+        std::vector<double> x, y, z;    // position in meters
+        std::vector<double> vx, vy, vz; // velocity in meters per second
+        std::vector<Color> color;
+        std::vector<uint32_t> label; // offset into the label arena
+        std::vector<uint32_t> parent; // earlier row this one is a moon of, NoParent otherwise
+    private:
+        std::vector<char> m_Labels;        // NUL terminated strings back to back
+        std::vector<uint32_t> m_LabelSlots; // open addressing table, offset + 1 or 0 for empty slots
+        std::size_t m_LabelCount = 0;
+    private:
+        static std::size_t Hash(std::string_view text) noexcept
+        {
+            uint64_t hash = 1469598103934665603ull; // FNV-1a
+            for (const char c : text)
+                hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+            return static_cast<std::size_t>(hash);
+        }
+
+        // Rebuilt from the arena itself, this also indexes labels that were loaded from a binary catalog.
+        // The table is kept at most a quarter full after growing.
+        void RebuildSlots(std::size_t minimumLabels)
+        {
+            m_LabelCount = 0;
+            for (std::size_t offset = 0; offset < m_Labels.size(); offset += std::strlen(m_Labels.data() + offset) + 1)
+                m_LabelCount++;
+
+            std::size_t slots = 64;
+            while (slots < 4 * std::max(m_LabelCount, minimumLabels)) slots *= 2;
+            m_LabelSlots.assign(slots, 0);
+
+            for (std::size_t offset = 0; offset < m_Labels.size();)
+            {
+                const std::string_view text(m_Labels.data() + offset);
+                std::size_t slot = Hash(text) & (slots - 1);
+                while (m_LabelSlots[slot] != 0)
+                    slot = (slot + 1) & (slots - 1);
+                m_LabelSlots[slot] = static_cast<uint32_t>(offset + 1);
+                offset += text.size() + 1;
+            }
+        }
+    public:
+        std::size_t Size() const noexcept
+        {
+            return mass.size();
+        }
+
+        const char* Label(std::size_t i) const noexcept
+        {
+            return m_Labels.data() + label[i];
+        }
+
+        void Reserve(std::size_t rows)
+        {
+            mass.reserve(rows);
+            radius.reserve(rows);
+            x.reserve(rows);
+            y.reserve(rows);
+            z.reserve(rows);
+            vx.reserve(rows);
+            vy.reserve(rows);
+            vz.reserve(rows);
+            color.reserve(rows);
+            label.reserve(rows);
+            parent.reserve(rows);
+        }
+
+        void Clear() noexcept
+        {
+            mass.clear();
+            radius.clear();
+            x.clear();
+            y.clear();
+            z.clear();
+            vx.clear();
+            vy.clear();
+            vz.clear();
+            color.clear();
+            label.clear();
+            parent.clear();
+            m_Labels.clear();
+            m_LabelSlots.clear();
+            m_LabelCount = 0;
+        }
+
+        // Offset of the label in the arena, equal labels share one copy. Fails (returns false) once the
+        // arena outgrows 32 bit offsets.
+        bool Intern(std::string_view text, uint32_t* offset)
+        {
+            if (m_LabelSlots.empty() || 2 * (m_LabelCount + 1) > m_LabelSlots.size())
+                RebuildSlots(m_LabelCount + 1);
+
+            const std::size_t mask = m_LabelSlots.size() - 1;
+            std::size_t slot = Hash(text) & mask;
+            for (; m_LabelSlots[slot] != 0; slot = (slot + 1) & mask)
+            {
+                const char* existing = m_Labels.data() + m_LabelSlots[slot] - 1;
+                if (std::strncmp(existing, text.data(), text.size()) == 0 && existing[text.size()] == '\0')
+                {
+                    *offset = m_LabelSlots[slot] - 1;
+                    return true;
+                }
+            }
+
+            if (m_Labels.size() + text.size() + 1 >= UINT32_MAX)
+                return false;
+
+            *offset = static_cast<uint32_t>(m_Labels.size());
+            m_Labels.insert(m_Labels.end(), text.begin(), text.end());
+            m_Labels.push_back('\0');
+            m_LabelSlots[slot] = *offset + 1;
+            m_LabelCount++;
+            return true;
+        }
+
+        // Offset of an already interned label
+        bool Find(std::string_view text, uint32_t* offset) const noexcept
+        {
+            if (m_LabelSlots.empty())
+                return false;
+
+            const std::size_t mask = m_LabelSlots.size() - 1;
+            for (std::size_t slot = Hash(text) & mask; m_LabelSlots[slot] != 0; slot = (slot + 1) & mask)
+            {
+                const char* existing = m_Labels.data() + m_LabelSlots[slot] - 1;
+                if (std::strncmp(existing, text.data(), text.size()) == 0 && existing[text.size()] == '\0')
+                {
+                    *offset = m_LabelSlots[slot] - 1;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void Add(double bodyMass, double bodyRadius, const Math::Vector3<double>& position, const Math::Vector3<double>& velocity, Color bodyColor, uint32_t labelOffset, uint32_t parentRow = NoParent)
+        {
+            mass.push_back(bodyMass);
+            radius.push_back(bodyRadius);
+            x.push_back(position.x);
+            y.push_back(position.y);
+            z.push_back(position.z);
+            vx.push_back(velocity.x);
+            vy.push_back(velocity.y);
+            vz.push_back(velocity.z);
+            color.push_back(bodyColor);
+            label.push_back(labelOffset);
+            parent.push_back(parentRow);
+        }
+
+        const std::vector<char>& Labels() const noexcept
+        {
+            return m_Labels;
+        }
+
+        // Replaces the arena with already interned labels, e.g. from a binary catalog
+        void AssignLabels(const char* labels, std::size_t bytes)
+        {
+            m_Labels.assign(labels, labels + bytes);
+            m_LabelSlots.clear();
+            m_LabelCount = 0;
+        }
+    };
+
+
+    namespace Detail
+    {
+        inline const char* SkipSpaces(const char* p, const char* end) noexcept
+        {
+            while (p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+                ++p;
+            return p;
+        }
+
+        inline const char* TrimRight(const char* begin, const char* p) noexcept
+        {
+            while (p > begin && (p[-1] == ' ' || p[-1] == '\t' || p[-1] == '\r'))
+                --p;
+            return p;
+        }
+
+        // Output columns for rows [first, first + count)
+        inline Kepler::StateVectors Columns(Bodies* bodies, std::size_t first) noexcept
+        {
+            return { bodies->x.data() + first, bodies->y.data() + first, bodies->z.data() + first, bodies->vx.data() + first, bodies->vy.data() + first, bodies->vz.data() + first };
+        }
+
+        // Elements are relative to the central body (row 0) or the parent row. In the usual case of a catalog
+        // where every other row has elements they're written straight into the columns, otherwise scattered.
+        inline void ConvertElements(const Kepler::Elements& elements, const std::vector<uint32_t>& rows, Bodies* bodies)
+        {
+            const std::size_t count = elements.Size();
+            if (count == 0) return;
+
+            if (rows.front() == 1 && rows.back() == count)
+            {
+                Kepler::ToStateVectors(elements, Columns(bodies, 1));
+            }
+            else
+            {
+                Bodies converted;
+                converted.Reserve(count);
+                for (std::vector<double>* column : { &converted.x, &converted.y, &converted.z, &converted.vx, &converted.vy, &converted.vz })
+                    column->resize(count);
+                Kepler::ToStateVectors(elements, Columns(&converted, 0));
+                for (std::size_t k = 0; k < count; ++k)
+                {
+                    const std::size_t row = rows[k];
+                    bodies->x[row] = converted.x[k];
+                    bodies->y[row] = converted.y[k];
+                    bodies->z[row] = converted.z[k];
+                    bodies->vx[row] = converted.vx[k];
+                    bodies->vy[row] = converted.vy[k];
+                    bodies->vz[row] = converted.vz[k];
+                }
+            }
+
+            // Parents come first, so their state is already absolute when a moon is moved
+            for (const uint32_t row : rows)
+            {
+                const uint32_t center = bodies->parent[row] != NoParent ? bodies->parent[row] : 0;
+                bodies->x[row] += bodies->x[center];
+                bodies->y[row] += bodies->y[center];
+                bodies->z[row] += bodies->z[center];
+                bodies->vx[row] += bodies->vx[center];
+                bodies->vy[row] += bodies->vy[center];
+                bodies->vz[row] += bodies->vz[center];
+            }
+        }
+
+        inline bool ParseColor(std::string_view text, Color* color) noexcept
+        {
+            struct Named { std::string_view name; Color color; };
+            static const std::array<Named, 26> names = { {
+                { "LIGHTGRAY", LIGHTGRAY }, { "GRAY", GRAY }, { "DARKGRAY", DARKGRAY }, { "YELLOW", YELLOW }, { "GOLD", GOLD },
+                { "ORANGE", ORANGE }, { "PINK", PINK }, { "RED", RED }, { "MAROON", MAROON }, { "GREEN", GREEN },
+                { "LIME", LIME }, { "DARKGREEN", DARKGREEN }, { "SKYBLUE", SKYBLUE }, { "BLUE", BLUE }, { "DARKBLUE", DARKBLUE },
+                { "PURPLE", PURPLE }, { "VIOLET", VIOLET }, { "DARKPURPLE", DARKPURPLE }, { "BEIGE", BEIGE }, { "BROWN", BROWN },
+                { "DARKBROWN", DARKBROWN }, { "WHITE", WHITE }, { "BLACK", BLACK }, { "BLANK", BLANK }, { "MAGENTA", MAGENTA },
+                { "RAYWHITE", RAYWHITE }
+            } };
+            for (const Named& named : names)
+            {
+                if (named.name == text)
+                {
+                    *color = named.color;
+                    return true;
+                }
+            }
+
+            if (text.size() != 6 && text.size() != 8)
+                return false;
+
+            // Hex digits by hand, libstdc++'s base 16 from_chars trips -Wstrict-overflow in Release
+            uint32_t value = 0;
+            for (const char c : text)
+            {
+                uint32_t digit;
+                if (c >= '0' && c <= '9') digit = static_cast<uint32_t>(c - '0');
+                else if (c >= 'a' && c <= 'f') digit = static_cast<uint32_t>(c - 'a' + 10);
+                else if (c >= 'A' && c <= 'F') digit = static_cast<uint32_t>(c - 'A' + 10);
+                else return false;
+                value = (value << 4) | digit;
+            }
+
+            if (text.size() == 6)
+                value = (value << 8) | 0xFF;
+            *color = { static_cast<unsigned char>(value >> 24), static_cast<unsigned char>(value >> 16), static_cast<unsigned char>(value >> 8), static_cast<unsigned char>(value) };
+            return true;
+        }
+
+        template <typename T>
+        inline T Load(const char* data) noexcept
+        {
+            T value;
+            std::memcpy(&value, data, sizeof(T));
+            return value;
+        }
+
+        template <typename T>
+        inline void Column(const char** data, std::vector<T>* column, std::size_t count)
+        {
+            column->resize(count);
+            std::memcpy(column->data(), *data, count * sizeof(T));
+            *data += count * sizeof(T);
+        }
+    }
+
+
+    // Parses a text catalog, name is only used for error messages. Numbers are read with std::from_chars
+    // straight from the buffer, nothing is allocated per line.
+    inline bool ParseText(const char* text, std::size_t size, Bodies* bodies, const char* name)
+    {
+        PROFILE_FUNCTION();
+        bodies->Clear();
+        const char* p = text;
+        const char* end = text + size;
+
+        // The row count is estimated from the start of the file, counting all lines would be another pass
+        const std::size_t sample = std::min<std::size_t>(size, 4096);
+        const std::size_t sampleLines = static_cast<std::size_t>(std::count(p, p + sample, '\n')) + 1;
+        bodies->Reserve(size / std::max<std::size_t>(sample / sampleLines, 1) + sampleLines);
+
+        Kepler::Elements elements;
+        std::vector<uint32_t> elementRows;
+        const auto Fail = [&](std::size_t line, const char* message)
+        {
+            TraceLog(LOG_WARNING, "CATALOG: %s:%zu: %s", name, line, message);
+            bodies->Clear();
+            return false;
+        };
+
+        for (std::size_t line = 1; p < end; ++line)
+        {
+            const char* newline = static_cast<const char*>(std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+            const char* next = newline != nullptr ? newline + 1 : end;
+            const char* lineEnd = newline != nullptr ? newline : end;
+            if (const char* comment = static_cast<const char*>(std::memchr(p, '#', static_cast<std::size_t>(lineEnd - p))))
+                lineEnd = comment;
+            p = Detail::SkipSpaces(p, lineEnd);
+            if (p == lineEnd)
+            {
+                p = next;
+                continue;
+            }
+
+            const char* comma = static_cast<const char*>(std::memchr(p, ',', static_cast<std::size_t>(lineEnd - p)));
+            if (comma == nullptr)
+                return Fail(line, "expected 7 or 10 comma separated columns");
+
+            std::string_view label(p, static_cast<std::size_t>(Detail::TrimRight(p, comma) - p));
+            std::string_view parentLabel;
+            const std::size_t slash = label.find('/');
+            if (slash != std::string_view::npos)
+            {
+                parentLabel = label.substr(0, slash);
+                label.remove_prefix(slash + 1);
+            }
+            p = comma + 1;
+
+            // Numbers up to the color, the last column
+            double values[8];
+            std::size_t count = 0;
+            while (true)
+            {
+                p = Detail::SkipSpaces(p, lineEnd);
+                double value;
+                const std::from_chars_result result = std::from_chars(p, lineEnd, value);
+                const char* after = Detail::SkipSpaces(result.ptr, lineEnd);
+                if (result.ec != std::errc() || after == lineEnd || *after != ',')
+                    break;
+                if (count == 8)
+                    return Fail(line, "expected 7 or 10 comma separated columns");
+                values[count++] = value;
+                p = after + 1;
+            }
+
+            if (std::memchr(p, ',', static_cast<std::size_t>(lineEnd - p)) != nullptr)
+                return Fail(line, "invalid number");
+            if (count != 5 && count != 8)
+                return Fail(line, "expected 7 or 10 comma separated columns");
+
+            p = Detail::SkipSpaces(p, lineEnd);
+            const char* colorEnd = p;
+            while (colorEnd < lineEnd && *colorEnd != ' ' && *colorEnd != '\t' && *colorEnd != '\r')
+                ++colorEnd;
+
+            Color color;
+            if (!Detail::ParseColor(std::string_view(p, static_cast<std::size_t>(colorEnd - p)), &color))
+                return Fail(line, "invalid color");
+
+            p = Detail::SkipSpaces(colorEnd, lineEnd);
+            if (p != lineEnd)
+                return Fail(line, "unexpected text after the color");
+
+            uint32_t labelOffset = 0;
+            if (!bodies->Intern(label, &labelOffset))
+                return Fail(line, "too many labels");
+
+            if (count == 5)
+            {
+                if (!parentLabel.empty())
+                    return Fail(line, "moons need orbital elements");
+
+                const double distance = values[2], speed = values[3], inclination = values[4];
+                const Math::Vector3<double> position(distance, distance * std::sin(inclination), 0.0);
+                const Math::Vector3<double> velocity(0.0, speed * std::sin(inclination), speed * std::cos(inclination));
+                bodies->Add(values[0], values[1], position, velocity, color, labelOffset);
+            }
+            else
+            {
+                if (bodies->Size() == 0)
+                    return Fail(line, "orbital elements need a central body in the first row");
+                if (!(values[2] > 0.0) || !(values[3] >= 0.0 && values[3] < 1.0))
+                    return Fail(line, "orbital elements need a > 0 and 0 <= e < 1");
+
+                // The parent is looked up backwards, moons are usually listed right after their planet
+                uint32_t parentRow = NoParent, parentOffset = 0;
+                if (!parentLabel.empty())
+                {
+                    if (bodies->Find(parentLabel, &parentOffset))
+                        for (std::size_t row = bodies->Size(); row-- > 0 && parentRow == NoParent;)
+                            if (bodies->label[row] == parentOffset)
+                                parentRow = static_cast<uint32_t>(row);
+                    if (parentRow == NoParent)
+                        return Fail(line, "unknown parent, it has to be listed before its moons");
+                }
+
+                constexpr double Radians = 0.017453292519943295; // Const::Pi is only float precise
+                const double mu = Physics::Const::G * (bodies->mass[parentRow != NoParent ? parentRow : 0] + values[0]);
+                elements.Add(values[2], values[3], values[4] * Radians, values[5] * Radians, values[6] * Radians, values[7] * Radians, mu);
+                elementRows.push_back(static_cast<uint32_t>(bodies->Size()));
+                bodies->Add(values[0], values[1], {}, {}, color, labelOffset, parentRow);
+            }
+            p = next;
+        }
+
+        Detail::ConvertElements(elements, elementRows, bodies);
+        return true;
+    }
+
+
+    inline bool LoadBinary(const char* data, std::size_t size, Bodies* bodies, const char* name)
+    {
+        PROFILE_FUNCTION();
+        bodies->Clear();
+        if (size < HeaderSize || std::memcmp(data, Magic, sizeof(Magic)) != 0 || Detail::Load<uint32_t>(data + 4) != Version)
+        {
+            TraceLog(LOG_WARNING, "CATALOG: %s is not a version %u catalog", name, Version);
+            return false;
+        }
+
+        const uint64_t count = Detail::Load<uint64_t>(data + 8);
+        const uint64_t labelBytes = Detail::Load<uint64_t>(data + 16);
+        constexpr uint64_t RowBytes = 8 * sizeof(double) + sizeof(Color) + 2 * sizeof(uint32_t);
+        if (count > (size - HeaderSize) / RowBytes || labelBytes != size - HeaderSize - count * RowBytes || labelBytes >= UINT32_MAX || (labelBytes > 0 && data[size - 1] != '\0'))
+        {
+            TraceLog(LOG_WARNING, "CATALOG: %s is truncated or corrupted", name);
+            return false;
+        }
+
+        const std::size_t n = static_cast<std::size_t>(count);
+        const char* p = data + HeaderSize;
+        Detail::Column(&p, &bodies->mass, n);
+        Detail::Column(&p, &bodies->radius, n);
+        for (std::vector<double>* column : { &bodies->x, &bodies->y, &bodies->z, &bodies->vx, &bodies->vy, &bodies->vz })
+            Detail::Column(&p, column, n);
+        Detail::Column(&p, &bodies->color, n);
+        Detail::Column(&p, &bodies->label, n);
+        Detail::Column(&p, &bodies->parent, n);
+        bodies->AssignLabels(p, static_cast<std::size_t>(labelBytes));
+
+        // The arena ends with a NUL, so every offset inside it is a terminated string
+        for (const uint32_t offset : bodies->label)
+        {
+            if (offset >= labelBytes)
+            {
+                TraceLog(LOG_WARNING, "CATALOG: %s contains an invalid label", name);
+                bodies->Clear();
+                return false;
+            }
+        }
+
+        for (std::size_t row = 0; row < n; ++row)
+        {
+            if (bodies->parent[row] != NoParent && bodies->parent[row] >= row)
+            {
+                TraceLog(LOG_WARNING, "CATALOG: %s contains an invalid parent", name);
+                bodies->Clear();
+                return false;
+            }
+        }
+        return true;
+    }
+
+
+    inline bool SaveBinary(const char* path, const Bodies& bodies)
+    {
+        std::FILE* file = std::fopen(path, "wb");
+        if (file == nullptr)
+            return false;
+
+        const uint64_t count = bodies.Size();
+        const uint64_t labelBytes = bodies.Labels().size();
+        const auto Write = [file](const void* data, std::size_t bytes) { return bytes == 0 || std::fwrite(data, 1, bytes, file) == bytes; };
+
+        bool ok = Write(Magic, sizeof(Magic)) && Write(&Version, sizeof(Version)) && Write(&count, sizeof(count)) && Write(&labelBytes, sizeof(labelBytes));
+        ok = ok && Write(bodies.mass.data(), bodies.mass.size() * sizeof(double));
+        ok = ok && Write(bodies.radius.data(), bodies.radius.size() * sizeof(double));
+        for (const std::vector<double>* column : { &bodies.x, &bodies.y, &bodies.z, &bodies.vx, &bodies.vy, &bodies.vz })
+            ok = ok && Write(column->data(), column->size() * sizeof(double));
+        ok = ok && Write(bodies.color.data(), bodies.color.size() * sizeof(Color));
+        ok = ok && Write(bodies.label.data(), bodies.label.size() * sizeof(uint32_t));
+        ok = ok && Write(bodies.parent.data(), bodies.parent.size() * sizeof(uint32_t));
+        ok = ok && Write(bodies.Labels().data(), bodies.Labels().size());
+        return std::fclose(file) == 0 && ok;
+    }
+
+
+    // Memory maps the file and picks the parser by the magic
+    inline bool Load(const char* path, Bodies* bodies)
+    {
+        PROFILE_FUNCTION();
+        const auto start = std::chrono::steady_clock::now();
+        MappedFile file;
+        if (!file.Open(path))
+        {
+            TraceLog(LOG_WARNING, "CATALOG: Failed to open %s", path);
+            return false;
+        }
+
+        const bool binary = file.Size() >= sizeof(Magic) && std::memcmp(file.Data(), Magic, sizeof(Magic)) == 0;
+        if (!(binary ? LoadBinary(file.Data(), file.Size(), bodies, path) : ParseText(file.Data(), file.Size(), bodies, path)))
+            return false;
+
+        const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        TraceLog(LOG_INFO, "CATALOG: Loaded %zu bodies from %s in %.1f ms", bodies->Size(), path, milliseconds);
+        return true;
+    }
+
+
+    // Adds every row as a rigid body, the labels stay owned by catalog. Moons are grouped into the sub-system
+    // of the planet at the top of their parent chain. Returns the handle of the central body.
+    inline SlotHandle AddBodies(const Bodies& catalog, SlotMap<Physics::RigidBody<FLOAT>>* bodies, Physics::Subsystems* subsystems)
+    {
+        SlotHandle central;
+        const std::size_t first = bodies->Size();
+        bodies->Reserve(first + catalog.Size());
+        for (std::size_t i = 0; i < catalog.Size(); ++i)
+        {
+            const Math::Vector3<FLOAT> position(static_cast<FLOAT>(catalog.x[i]), static_cast<FLOAT>(catalog.y[i]), static_cast<FLOAT>(catalog.z[i]));
+            const Math::Vector3<FLOAT> velocity(static_cast<FLOAT>(catalog.vx[i]), static_cast<FLOAT>(catalog.vy[i]), static_cast<FLOAT>(catalog.vz[i]));
+            const SlotHandle handle = bodies->Emplace(position, velocity, static_cast<FLOAT>(catalog.mass[i]), catalog.radius[i], catalog.Label(i), catalog.color[i]);
+            if (i == 0)
+                central = handle;
+        }
+
+        for (std::size_t i = 0; i < catalog.Size(); ++i)
+        {
+            if (catalog.parent[i] == NoParent) continue;
+
+            std::size_t host = catalog.parent[i];
+            while (catalog.parent[host] != NoParent)
+                host = catalog.parent[host];
+            subsystems->Add(bodies->HandleAt(first + host), bodies->HandleAt(first + i));
+        }
+        return central;
+    }
+}
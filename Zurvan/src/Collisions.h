@@ -0,0 +1,133 @@
+#pragma once
+#include <cmath>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+#include "Math.h"
+#include "Config.h"
+#include "Physics.h"
+#include "SlotMap.h"
+#include "Profiler.h"
+#include "SweepAndPrune.h"
+
+namespace Physics
+{
+    // Continuous collision detection and inelastic merging. Every body sweeps its sphere along the straight
+    // line from its position before the step to the one after it, so fast bodies can't tunnel through each
+    // other within a step. Candidate pairs come from sweep and prune over the swept spheres.
+    class Collisions
+    {
+    private:
+        struct Contact
+        {
+            double time; // fraction of the step at which the spheres touch
+            uint32_t a;
+            uint32_t b;
+        };
+    private:
+        SweepAndPrune m_BroadPhase;
+        std::vector<double> m_Min; // swept interval along the broad phase axis
+        std::vector<double> m_Max;
+        std::vector<Contact> m_Contacts;
+        std::vector<uint8_t> m_Merged;
+        std::size_t m_MergeCount = 0;
+    private:
+        static double Dot(const Math::Vector3<FLOAT>& a, const Math::Vector3<FLOAT>& b) noexcept
+        {
+            return static_cast<double>(a.x * b.x + a.y * b.y + a.z * b.z);
+        }
+
+        // First time in [0, 1] at which the distance between the linearly moving centers drops to
+        // radius, -1 if it never does
+        static double ContactTime(const Math::Vector3<FLOAT>& start, const Math::Vector3<FLOAT>& end, double radius) noexcept
+        {
+            const double c = Dot(start, start) - radius * radius;
+            if (c <= 0.0) return 0.0;
+
+            const Math::Vector3<FLOAT> motion = end - start;
+            const double a = Dot(motion, motion);
+            const double b = Dot(start, motion);
+            if (b >= 0.0 || a == 0.0) return -1.0; // moving apart
+
+            const double discriminant = b * b - a * c;
+            if (discriminant < 0.0) return -1.0;
+            const double t = (-b - std::sqrt(discriminant)) / a;
+            return t <= 1.0 ? t : -1.0;
+        }
+
+        void FindContacts(const std::vector<RigidBody<FLOAT>>& bodies, const std::vector<Math::Vector3<FLOAT>>& previous)
+        {
+            PROFILE_FUNCTION();
+            const std::size_t n = bodies.size();
+            const int axis = SweepAndPrune::LargestSpreadAxis(bodies);
+            m_Min.resize(n);
+            m_Max.resize(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const double start = SweepAndPrune::Component(previous[i], axis), end = SweepAndPrune::Component(bodies[i].GetPosition(), axis);
+                m_Min[i] = std::min(start, end) - bodies[i].GetRadius();
+                m_Max[i] = std::max(start, end) + bodies[i].GetRadius();
+            }
+
+            m_Contacts.clear();
+            m_BroadPhase.ForEachOverlap(m_Min, m_Max, axis, [&](uint32_t a, uint32_t b)
+            {
+                const double t = ContactTime(previous[b] - previous[a], bodies[b].GetPosition() - bodies[a].GetPosition(), bodies[a].GetRadius() + bodies[b].GetRadius());
+                if (t >= 0.0)
+                    m_Contacts.push_back({ t, a, b });
+            });
+        }
+    public:
+        // previous holds the positions before the step, parallel to bodies.Items(). Merged bodies keep the
+        // handle, label and color of the heavier one, the lighter one is removed. Returns the number of merges.
+        std::size_t Resolve(SlotMap<RigidBody<FLOAT>>* bodies, const std::vector<Math::Vector3<FLOAT>>& previous)
+        {
+            PROFILE_FUNCTION();
+            std::vector<RigidBody<FLOAT>>& items = bodies->Items();
+            if (items.size() < 2 || previous.size() != items.size())
+                return 0;
+
+            FindContacts(items, previous);
+            if (m_Contacts.empty())
+                return 0;
+
+            // Earliest contacts first, a body merges at most once per step, later contacts are found again next step
+            std::sort(m_Contacts.begin(), m_Contacts.end(), [](const Contact& l, const Contact& r) { return l.time < r.time; });
+            m_Merged.assign(items.size(), 0);
+            std::vector<SlotHandle> removed;
+            for (const Contact& contact : m_Contacts)
+            {
+                if (m_Merged[contact.a] || m_Merged[contact.b])
+                    continue;
+
+                const bool aHeavier = items[contact.a].GetMass() >= items[contact.b].GetMass();
+                RigidBody<FLOAT>& survivor = items[aHeavier ? contact.a : contact.b];
+                const RigidBody<FLOAT>& absorbed = items[aHeavier ? contact.b : contact.a];
+
+                // Momentum and center of mass are conserved, the volume too
+                const FLOAT mass = survivor.GetMass() + absorbed.GetMass();
+                const FLOAT wSurvivor = survivor.GetMass() / mass, wAbsorbed = absorbed.GetMass() / mass;
+                survivor.SetPosition(survivor.GetPosition() * wSurvivor + absorbed.GetPosition() * wAbsorbed);
+                survivor.SetVelocity(survivor.GetVelocity() * wSurvivor + absorbed.GetVelocity() * wAbsorbed);
+                survivor.SetMass(mass);
+                survivor.SetRadius(std::cbrt(std::pow(survivor.GetRadius(), 3.0) + std::pow(absorbed.GetRadius(), 3.0)));
+
+                m_Merged[contact.a] = m_Merged[contact.b] = 1;
+                removed.push_back(bodies->HandleAt(aHeavier ? contact.b : contact.a));
+            }
+
+            // Handles because every removal moves another body into the freed index
+            for (const SlotHandle handle : removed)
+                bodies->Remove(handle);
+            m_MergeCount += removed.size();
+            return removed.size();
+        }
+
+        std::size_t MergeCount() const noexcept
+        {
+            return m_MergeCount;
+        }
+    };
+}
@@ -0,0 +1,184 @@
+#pragma once
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+#include "Math.h"
+#include "Config.h"
+#include "Physics.h"
+#include "Profiler.h"
+#include "SweepAndPrune.h"
+
+namespace Physics
+{
+    // Close approaches between bodies. Candidate pairs come from sweep and prune over the path of every
+    // body during the step widened by the threshold. For those the minimum distance is found on the cubic
+    // Hermite interpolant through the positions and velocities at both ends of the step (the usual dense
+    // output of RK4 and Verlet) by bracketing the sign change of d|r|^2/dt and bisecting it.
+    class Encounters
+    {
+    public:
+        struct Event
+        {
+            double time;     // simulated seconds
+            double distance; // between the centers in meters
+            double speed;    // relative speed in meters per second
+            const char* a;
+            const char* b;
+        };
+    private:
+        static constexpr int Brackets = 8;    // samples of the derivative per step, catches up to 8 minima
+        static constexpr int Bisections = 40; // brackets are 1/8 of a step, 2^-43 of it in the end
+    private:
+        SweepAndPrune m_BroadPhase;
+        std::vector<double> m_Min;
+        std::vector<double> m_Max;
+        std::vector<Event> m_Events; // found by the last Detect()
+        std::FILE* m_Log = nullptr;
+        double m_Threshold = 0.0;
+        std::size_t m_EventCount = 0; // since Open()
+    private:
+        // Relative state of a pair, s in [0, 1] over a step of length h
+        struct Hermite
+        {
+            Math::Vector3<FLOAT> p0, p1, m0, m1; // positions and velocities * h
+
+            Math::Vector3<FLOAT> Position(double s) const noexcept
+            {
+                const double s2 = s * s, s3 = s2 * s;
+                return p0 * static_cast<FLOAT>(2 * s3 - 3 * s2 + 1) + m0 * static_cast<FLOAT>(s3 - 2 * s2 + s)
+                    + p1 * static_cast<FLOAT>(3 * s2 - 2 * s3) + m1 * static_cast<FLOAT>(s3 - s2);
+            }
+
+            Math::Vector3<FLOAT> Derivative(double s) const noexcept
+            {
+                const double s2 = s * s;
+                return p0 * static_cast<FLOAT>(6 * s2 - 6 * s) + m0 * static_cast<FLOAT>(3 * s2 - 4 * s + 1)
+                    + p1 * static_cast<FLOAT>(6 * s - 6 * s2) + m1 * static_cast<FLOAT>(3 * s2 - 2 * s);
+            }
+
+            // Half the derivative of the squared distance, negative while approaching
+            double Closing(double s) const noexcept
+            {
+                const Math::Vector3<FLOAT> p = Position(s), v = Derivative(s);
+                return static_cast<double>(p.x * v.x + p.y * v.y + p.z * v.z);
+            }
+        };
+
+        void Refine(const Hermite& path, const Physics::RigidBody<FLOAT>& a, const Physics::RigidBody<FLOAT>& b, double startTime, double step)
+        {
+            double lo = 0.0, closingLo = path.Closing(0.0);
+            for (int k = 1; k <= Brackets; ++k)
+            {
+                const double hi = static_cast<double>(k) / Brackets;
+                const double closingHi = path.Closing(hi);
+
+                // Half open so a minimum exactly at the end of a step isn't reported again by the next one
+                if (closingLo < 0.0 && closingHi >= 0.0)
+                {
+                    double l = lo, h = hi;
+                    for (int i = 0; i < Bisections; ++i)
+                    {
+                        const double mid = 0.5 * (l + h);
+                        if (path.Closing(mid) < 0.0)
+                            l = mid;
+                        else
+                            h = mid;
+                    }
+
+                    const double s = 0.5 * (l + h);
+                    const double distance = path.Position(s).Length();
+                    if (distance < m_Threshold)
+                        m_Events.push_back({ startTime + s * step, distance, path.Derivative(s).Length() / step, a.GetLabel(), b.GetLabel() });
+                }
+                lo = hi;
+                closingLo = closingHi;
+            }
+        }
+    public:
+        // Events are appended to a text log, one per line
+        bool Open(const char* path, double threshold)
+        {
+            Close();
+            m_Log = std::fopen(path, "w");
+            if (m_Log == nullptr)
+                return false;
+
+            m_Threshold = threshold;
+            m_EventCount = 0;
+            std::fprintf(m_Log, "# time [s], body, body, distance [m], relative speed [m/s], closer than %.6e m\n", threshold);
+            return true;
+        }
+
+        void Close() noexcept
+        {
+            if (m_Log != nullptr)
+                std::fclose(m_Log);
+            m_Log = nullptr;
+        }
+
+        ~Encounters() noexcept
+        {
+            Close();
+        }
+
+        bool IsOpen() const noexcept
+        {
+            return m_Log != nullptr;
+        }
+
+        // previousPositions and previousVelocities hold the state before the step of length step seconds
+        // that started at startTime, parallel to bodies. Returns the number of encounters in this step.
+        std::size_t Detect(const std::vector<RigidBody<FLOAT>>& bodies, const std::vector<Math::Vector3<FLOAT>>& previousPositions, const std::vector<Math::Vector3<FLOAT>>& previousVelocities, double startTime, double step)
+        {
+            PROFILE_FUNCTION();
+            m_Events.clear();
+            const std::size_t n = bodies.size();
+            if (m_Log == nullptr || n < 2 || step <= 0.0 || previousPositions.size() != n || previousVelocities.size() != n)
+                return 0;
+
+            // The interpolant leaves the chord by at most |change of velocity| * step / 8 for constant acceleration
+            const int axis = SweepAndPrune::LargestSpreadAxis(bodies);
+            m_Min.resize(n);
+            m_Max.resize(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const double start = SweepAndPrune::Component(previousPositions[i], axis), end = SweepAndPrune::Component(bodies[i].GetPosition(), axis);
+                const double bulge = (bodies[i].GetVelocity() - previousVelocities[i]).Length() * step * 0.125;
+                m_Min[i] = std::min(start, end) - bulge - 0.5 * m_Threshold;
+                m_Max[i] = std::max(start, end) + bulge + 0.5 * m_Threshold;
+            }
+
+            const FLOAT h = static_cast<FLOAT>(step);
+            m_BroadPhase.ForEachOverlap(m_Min, m_Max, axis, [&](uint32_t a, uint32_t b)
+            {
+                const Hermite path = {
+                    previousPositions[b] - previousPositions[a],
+                    bodies[b].GetPosition() - bodies[a].GetPosition(),
+                    (previousVelocities[b] - previousVelocities[a]) * h,
+                    (bodies[b].GetVelocity() - bodies[a].GetVelocity()) * h
+                };
+                Refine(path, bodies[a], bodies[b], startTime, step);
+            });
+
+            std::sort(m_Events.begin(), m_Events.end(), [](const Event& l, const Event& r) { return l.time < r.time; });
+            for (const Event& event : m_Events)
+                std::fprintf(m_Log, "%.3f, %s, %s, %.6e, %.6e\n", event.time, event.a, event.b, event.distance, event.speed);
+            m_EventCount += m_Events.size();
+            return m_Events.size();
+        }
+
+        const std::vector<Event>& Events() const noexcept
+        {
+            return m_Events;
+        }
+
+        std::size_t EventCount() const noexcept
+        {
+            return m_EventCount;
+        }
+    };
+}
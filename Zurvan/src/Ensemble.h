@@ -0,0 +1,336 @@
+#pragma once
+#include <cmath>
+#include <thread>
+#include <random>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+#include "Math.h"
+#include "Config.h"
+#include "Physics.h"
+#include "Profiler.h"
+
+namespace Physics
+{
+    // Many copies (members) of the same system with perturbed initial conditions, stepped in lockstep with
+    // RK4. A system of ten bodies is far too small to vectorize, so the members are interleaved instead:
+    // they're stored in blocks of Lanes members where every coordinate of every body is a run of Lanes
+    // values, one per member. All loops of the kernel go over these runs and vectorize without shuffles.
+    // Blocks are independent and split across threads.
+    //
+    // Every member integrates all bodies at the global step, planets with moons aren't substepped here.
+    class Ensemble
+    {
+    public:
+        static constexpr std::size_t Lanes = 8; // one AVX-512 or two AVX registers of doubles
+
+        struct MemberStatistics
+        {
+            double deviation;            // largest distance of a body from its position in the nominal member
+            std::size_t farthestBody;    // the body with that distance
+            double energyDrift;          // relative to the member's initial state
+            double angularMomentumDrift;
+        };
+    private:
+        static constexpr std::size_t MinBlocksPerThread = 4;
+
+        // Per thread, every array holds one block
+        struct Scratch
+        {
+            std::vector<FLOAT> stage;      // state the derivative is evaluated at
+            std::vector<FLOAT> derivative;
+            std::vector<FLOAT> sum;        // weighted sum of the derivatives
+        };
+    private:
+        std::vector<FLOAT> m_State; // per block the positions then the velocities, [body][axis][lane] each
+        std::vector<FLOAT> m_Mass;
+        std::vector<const char*> m_Labels;
+        std::vector<double> m_InitialEnergy; // per member, padding lanes included
+        std::vector<Math::Vector3<double>> m_InitialAngularMomentum;
+        std::size_t m_Members = 0;
+        std::size_t m_Blocks = 0;
+        double m_Time = 0.0;
+    private:
+        std::size_t BlockSize() const noexcept
+        {
+            return 6 * m_Mass.size() * Lanes;
+        }
+
+        // Derivative of a block's state, the velocities followed by the accelerations. potential receives
+        // the potential energy of every lane if it isn't null.
+        void Derivative(const FLOAT* state, FLOAT* derivative, double* potential) const noexcept
+        {
+            const std::size_t n = m_Mass.size();
+            const std::size_t half = 3 * n * Lanes;
+            std::copy(state + half, state + 2 * half, derivative);
+
+            FLOAT* acc = derivative + half;
+            std::fill(acc, acc + half, static_cast<FLOAT>(0));
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const FLOAT* pi = state + 3 * i * Lanes;
+                FLOAT* ai = acc + 3 * i * Lanes;
+                const FLOAT gmi = static_cast<FLOAT>(Const::G) * m_Mass[i];
+                for (std::size_t j = i + 1; j < n; ++j)
+                {
+                    const FLOAT* pj = state + 3 * j * Lanes;
+                    FLOAT* aj = acc + 3 * j * Lanes;
+                    const FLOAT gmj = static_cast<FLOAT>(Const::G) * m_Mass[j];
+
+                    // Same 1 m clamp as RigidBody::ComputeAcceleration
+#if defined(__GNUC__)
+    #pragma GCC ivdep
+#endif
+                    for (std::size_t l = 0; l < Lanes; ++l)
+                    {
+                        const FLOAT dx = pj[l] - pi[l];
+                        const FLOAT dy = pj[Lanes + l] - pi[Lanes + l];
+                        const FLOAT dz = pj[2 * Lanes + l] - pi[2 * Lanes + l];
+                        const FLOAT distance = std::max(std::sqrt(dx * dx + dy * dy + dz * dz), static_cast<FLOAT>(1));
+                        const FLOAT inverse = static_cast<FLOAT>(1) / (distance * distance * distance);
+                        ai[l] += dx * gmj * inverse;
+                        ai[Lanes + l] += dy * gmj * inverse;
+                        ai[2 * Lanes + l] += dz * gmj * inverse;
+                        aj[l] -= dx * gmi * inverse;
+                        aj[Lanes + l] -= dy * gmi * inverse;
+                        aj[2 * Lanes + l] -= dz * gmi * inverse;
+                    }
+
+                    if (potential != nullptr)
+                        for (std::size_t l = 0; l < Lanes; ++l)
+                        {
+                            const FLOAT dx = pj[l] - pi[l], dy = pj[Lanes + l] - pi[Lanes + l], dz = pj[2 * Lanes + l] - pi[2 * Lanes + l];
+                            potential[l] -= static_cast<double>(gmi * m_Mass[j] / std::max(std::sqrt(dx * dx + dy * dy + dz * dz), static_cast<FLOAT>(1)));
+                        }
+                }
+            }
+        }
+
+        void StepBlock(FLOAT* state, Scratch* scratch, FLOAT h) const noexcept
+        {
+            const std::size_t size = BlockSize();
+            FLOAT* stage = scratch->stage.data();
+            FLOAT* derivative = scratch->derivative.data();
+            FLOAT* sum = scratch->sum.data();
+
+            // Classic RK4 over the whole block, k1 + 2 k2 + 2 k3 + k4
+            Derivative(state, sum, nullptr);
+            for (std::size_t k = 0; k < size; ++k)
+                stage[k] = state[k] + sum[k] * (h * static_cast<FLOAT>(0.5));
+
+            Derivative(stage, derivative, nullptr);
+            for (std::size_t k = 0; k < size; ++k)
+            {
+                sum[k] += 2 * derivative[k];
+                stage[k] = state[k] + derivative[k] * (h * static_cast<FLOAT>(0.5));
+            }
+
+            Derivative(stage, derivative, nullptr);
+            for (std::size_t k = 0; k < size; ++k)
+            {
+                sum[k] += 2 * derivative[k];
+                stage[k] = state[k] + derivative[k] * h;
+            }
+
+            Derivative(stage, derivative, nullptr);
+            for (std::size_t k = 0; k < size; ++k)
+                state[k] += (sum[k] + derivative[k]) * (h / static_cast<FLOAT>(6));
+        }
+
+        void AdvanceBlocks(std::size_t begin, std::size_t end, FLOAT step, uint64_t steps)
+        {
+            PROFILE_FUNCTION();
+            Scratch scratch;
+            scratch.stage.resize(BlockSize());
+            scratch.derivative.resize(BlockSize());
+            scratch.sum.resize(BlockSize());
+
+            // All steps of one block at once, it stays in the L1 cache
+            for (std::size_t block = begin; block < end; ++block)
+                for (uint64_t s = 0; s < steps; ++s)
+                    StepBlock(m_State.data() + block * BlockSize(), &scratch, step);
+        }
+
+        // Energy and angular momentum of every member
+        void Measure(std::vector<double>* energy, std::vector<Math::Vector3<double>>* angularMomentum) const
+        {
+            const std::size_t n = m_Mass.size();
+            const std::size_t half = 3 * n * Lanes;
+            std::vector<FLOAT> derivative(BlockSize());
+            energy->assign(m_Blocks * Lanes, 0.0);
+            angularMomentum->assign(m_Blocks * Lanes, Math::Vector3<double>());
+            for (std::size_t block = 0; block < m_Blocks; ++block)
+            {
+                const FLOAT* state = m_State.data() + block * BlockSize();
+                Derivative(state, derivative.data(), energy->data() + block * Lanes);
+                for (std::size_t i = 0; i < n; ++i)
+                    for (std::size_t l = 0; l < Lanes; ++l)
+                    {
+                        const FLOAT* p = state + 3 * i * Lanes + l;
+                        const FLOAT* v = state + half + 3 * i * Lanes + l;
+                        Invariants body;
+                        body.AddBody(Math::Vector3<FLOAT>(p[0], p[Lanes], p[2 * Lanes]), Math::Vector3<FLOAT>(v[0], v[Lanes], v[2 * Lanes]), m_Mass[i]);
+                        (*energy)[block * Lanes + l] += body.kinetic;
+                        (*angularMomentum)[block * Lanes + l] += body.angularMomentum;
+                    }
+            }
+        }
+
+        FLOAT& At(std::size_t member, std::size_t column) noexcept
+        {
+            return m_State[(member / Lanes) * BlockSize() + column * Lanes + member % Lanes];
+        }
+
+        FLOAT At(std::size_t member, std::size_t column) const noexcept
+        {
+            return m_State[(member / Lanes) * BlockSize() + column * Lanes + member % Lanes];
+        }
+    public:
+        // Member 0 is the nominal system. Every other member gets each coordinate of each body perturbed by
+        // a normal distribution with sigma times the body's distance and speed relative to the first body
+        // (the sun), which stays as it is. The members are moved to their barycentric frame afterwards.
+        void Generate(const std::vector<RigidBody<FLOAT>>& nominal, std::size_t members, double sigma, uint32_t seed = 1)
+        {
+            PROFILE_FUNCTION();
+            const std::size_t n = nominal.size();
+            m_Members = std::max<std::size_t>(members, 1);
+            m_Blocks = (m_Members + Lanes - 1) / Lanes;
+            m_Time = 0.0;
+            m_Mass.resize(n);
+            m_Labels.resize(n);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                m_Mass[i] = nominal[i].GetMass();
+                m_Labels[i] = nominal[i].GetLabel();
+            }
+            m_State.resize(m_Blocks * BlockSize());
+
+            std::mt19937 rng(seed);
+            std::normal_distribution<double> normal(0.0, sigma);
+            std::vector<RigidBody<FLOAT>> member;
+            const auto Perturb = [&](const Math::Vector3<FLOAT>& v, FLOAT scale) {
+                return v + Math::Vector3<FLOAT>(static_cast<FLOAT>(normal(rng)), static_cast<FLOAT>(normal(rng)), static_cast<FLOAT>(normal(rng))) * scale;
+            };
+
+            // Padding lanes of the last block hold the nominal system, they're stepped but never reported
+            for (std::size_t m = 0; m < m_Blocks * Lanes; ++m)
+            {
+                member = nominal;
+                if (m > 0 && m < m_Members)
+                {
+                    for (std::size_t i = 1; i < n; ++i)
+                    {
+                        const FLOAT distance = (member[i].GetPosition() - member[0].GetPosition()).Length();
+                        const FLOAT speed = (member[i].GetVelocity() - member[0].GetVelocity()).Length();
+                        member[i].SetPosition(Perturb(member[i].GetPosition(), distance));
+                        member[i].SetVelocity(Perturb(member[i].GetVelocity(), speed));
+                    }
+                    ToBarycentricFrame(&member);
+                }
+
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    const Math::Vector3<FLOAT>& p = member[i].GetPosition();
+                    const Math::Vector3<FLOAT>& v = member[i].GetVelocity();
+                    At(m, 3 * i) = p.x;
+                    At(m, 3 * i + 1) = p.y;
+                    At(m, 3 * i + 2) = p.z;
+                    At(m, 3 * (n + i)) = v.x;
+                    At(m, 3 * (n + i) + 1) = v.y;
+                    At(m, 3 * (n + i) + 2) = v.z;
+                }
+            }
+
+            Measure(&m_InitialEnergy, &m_InitialAngularMomentum);
+        }
+
+        // steps RK4 steps of step seconds for every member
+        void Advance(double step, uint64_t steps)
+        {
+            PROFILE_FUNCTION();
+            const std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+            const std::size_t threads = std::min(hardware, m_Blocks / MinBlocksPerThread + 1);
+            const FLOAT h = static_cast<FLOAT>(step);
+            m_Time += step * static_cast<double>(steps);
+            if (threads <= 1)
+            {
+                AdvanceBlocks(0, m_Blocks, h, steps);
+                return;
+            }
+
+            std::vector<std::thread> workers;
+            workers.reserve(threads - 1);
+            const std::size_t perThread = (m_Blocks + threads - 1) / threads;
+            for (std::size_t t = 1; t < threads; ++t)
+                workers.emplace_back(&Ensemble::AdvanceBlocks, this, std::min(m_Blocks, t * perThread), std::min(m_Blocks, (t + 1) * perThread), h, steps);
+            AdvanceBlocks(0, std::min(m_Blocks, perThread), h, steps);
+            for (std::thread& worker : workers)
+                worker.join();
+        }
+
+        std::vector<MemberStatistics> Statistics() const
+        {
+            PROFILE_FUNCTION();
+            std::vector<double> energy;
+            std::vector<Math::Vector3<double>> angularMomentum;
+            Measure(&energy, &angularMomentum);
+
+            const std::size_t n = m_Mass.size();
+            std::vector<MemberStatistics> statistics(m_Members);
+            for (std::size_t m = 0; m < m_Members; ++m)
+            {
+                MemberStatistics& s = statistics[m];
+                s.deviation = 0.0;
+                s.farthestBody = 0;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    const Math::Vector3<FLOAT> offset = Position(m, i) - Position(0, i);
+                    if (static_cast<double>(offset.Length()) > s.deviation)
+                    {
+                        s.deviation = static_cast<double>(offset.Length());
+                        s.farthestBody = i;
+                    }
+                }
+
+                s.energyDrift = m_InitialEnergy[m] != 0.0 ? std::abs((energy[m] - m_InitialEnergy[m]) / m_InitialEnergy[m]) : 0.0;
+                const double initial = m_InitialAngularMomentum[m].Length();
+                s.angularMomentumDrift = initial != 0.0 ? (angularMomentum[m] - m_InitialAngularMomentum[m]).Length() / initial : 0.0;
+            }
+            return statistics;
+        }
+
+        Math::Vector3<FLOAT> Position(std::size_t member, std::size_t body) const noexcept
+        {
+            return Math::Vector3<FLOAT>(At(member, 3 * body), At(member, 3 * body + 1), At(member, 3 * body + 2));
+        }
+
+        Math::Vector3<FLOAT> Velocity(std::size_t member, std::size_t body) const noexcept
+        {
+            const std::size_t n = m_Mass.size();
+            return Math::Vector3<FLOAT>(At(member, 3 * (n + body)), At(member, 3 * (n + body) + 1), At(member, 3 * (n + body) + 2));
+        }
+
+        const char* Label(std::size_t body) const noexcept
+        {
+            return m_Labels[body];
+        }
+
+        std::size_t Members() const noexcept
+        {
+            return m_Members;
+        }
+
+        std::size_t BodyCount() const noexcept
+        {
+            return m_Mass.size();
+        }
+
+        // Simulated seconds since Generate()
+        double Time() const noexcept
+        {
+            return m_Time;
+        }
+    };
+}
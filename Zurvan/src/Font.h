@@ -1,9143 +0,0 @@
-#ifndef FONT_H
-#define FONT_H
-//////////////////////////////////////////////////////////////////////////////////
-//                                                                              //
-// FileAsCode exporter                                                          //
-//                                                                              //
-// more infos and bug-reports: https://github.com/cunterrainer/FileAsCode       //
-//                                                                              //
-// or try out the web version: https://cunterrainer.github.io/FileAsCode/       //
-//                                                                              //
-//////////////////////////////////////////////////////////////////////////////////
-
-static const unsigned char sg_Font[] =
-{
-	0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x04, 0x00, 0x20, 0x47, 0x44, 0x45, 0x46,
-	0xA6, 0x43, 0xA4, 0x4C, 0x00, 0x00, 0x03, 0x94, 0x00, 0x00, 0x02, 0x58, 0x47, 0x50, 0x4F, 0x53,
-	0x07, 0xD2, 0xDA, 0xE4, 0x00, 0x00, 0x5D, 0xE8, 0x00, 0x00, 0x58, 0xC0, 0x47, 0x53, 0x55, 0x42,
-	0xFB, 0x94, 0xE5, 0x31, 0x00, 0x00, 0x47, 0xF0, 0x00, 0x00, 0x15, 0xF6, 0x4F, 0x53, 0x2F, 0x32,
-	0x97, 0x83, 0xB1, 0x86, 0x00, 0x00, 0x02, 0x34, 0x00, 0x00, 0x00, 0x60, 0x53, 0x54, 0x41, 0x54,
-	0x5E, 0xFF, 0x43, 0x39, 0x00, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x00, 0x5E, 0x63, 0x6D, 0x61, 0x70,
-	0xC1, 0x25, 0x61, 0xD3, 0x00, 0x00, 0x08, 0xBC, 0x00, 0x00, 0x06, 0x84, 0x63, 0x76, 0x74, 0x20,
-	0x3B, 0xF8, 0x26, 0x7D, 0x00, 0x00, 0x02, 0x94, 0x00, 0x00, 0x00, 0xFE, 0x66, 0x70, 0x67, 0x6D,
-	0xA8, 0x05, 0x84, 0x32, 0x00, 0x00, 0x23, 0xC4, 0x00, 0x00, 0x0F, 0x86, 0x67, 0x61, 0x73, 0x70,
-	0x00, 0x08, 0x00, 0x19, 0x00, 0x00, 0x01, 0x2C, 0x00, 0x00, 0x00, 0x0C, 0x67, 0x6C, 0x79, 0x66,
-	0xDF, 0x67, 0x5C, 0xDE, 0x00, 0x00, 0xB6, 0xA8, 0x00, 0x01, 0x83, 0xAC, 0x68, 0x65, 0x61, 0x64,
-	0x09, 0x40, 0x61, 0x31, 0x00, 0x00, 0x01, 0x9C, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
-	0x0A, 0xBA, 0x0A, 0xCA, 0x00, 0x00, 0x01, 0x78, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6D, 0x74, 0x78,
-	0xFF, 0xF9, 0x9E, 0x52, 0x00, 0x00, 0x33, 0x4C, 0x00, 0x00, 0x14, 0xA4, 0x6C, 0x6F, 0x63, 0x61,
-	0xA4, 0x95, 0x01, 0x27, 0x00, 0x00, 0x19, 0x70, 0x00, 0x00, 0x0A, 0x54, 0x6D, 0x61, 0x78, 0x70,
-	0x08, 0xD9, 0x10, 0xC6, 0x00, 0x00, 0x01, 0x38, 0x00, 0x00, 0x00, 0x20, 0x6E, 0x61, 0x6D, 0x65,
-	0xB2, 0x14, 0xA0, 0x60, 0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, 0x0A, 0x2E, 0x70, 0x6F, 0x73, 0x74,
-	0xFF, 0x6D, 0x00, 0x64, 0x00, 0x00, 0x01, 0x58, 0x00, 0x00, 0x00, 0x20, 0x70, 0x72, 0x65, 0x70,
-	0x79, 0x58, 0xCE, 0xD3, 0x00, 0x00, 0x05, 0xEC, 0x00, 0x00, 0x02, 0xCE, 0x00, 0x01, 0x00, 0x02,
-	0x00, 0x08, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x05, 0x29, 0x00, 0xA9,
-	0x00, 0x15, 0x00, 0x76, 0x00, 0x07, 0x00, 0x02, 0x00, 0x10, 0x00, 0x2F, 0x00, 0x9A, 0x00, 0x00,
-	0x02, 0xE6, 0x0F, 0x75, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0x6A, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x6C, 0xFE, 0x0C,
-	0x00, 0x00, 0x09, 0x4A, 0xFA, 0x1A, 0xFE, 0x4A, 0x09, 0x31, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x29, 0x00, 0x01, 0x00, 0x00,
-	0x00, 0x03, 0x02, 0x4E, 0xB8, 0x99, 0xFB, 0x39, 0x5F, 0x0F, 0x3C, 0xF5, 0x00, 0x1B, 0x08, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xC4, 0xF0, 0x11, 0x2E, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xD4, 0x02, 0x6F,
-	0xFA, 0x1A, 0xFD, 0xD5, 0x09, 0x31, 0x08, 0x73, 0x00, 0x00, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14,
-	0x00, 0x03, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x02, 0x77, 0x64, 0x74, 0x68, 0x01, 0x01, 0x00, 0x00,
-	0x77, 0x67, 0x68, 0x74, 0x01, 0x00, 0x00, 0x01, 0x69, 0x74, 0x61, 0x6C, 0x01, 0x02, 0x00, 0x02,
-	0x00, 0x26, 0x00, 0x16, 0x00, 0x06, 0x00, 0x03, 0x00, 0x02, 0x00, 0x02, 0x01, 0x28, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x01, 0x06, 0x01, 0x90,
-	0x00, 0x00, 0x02, 0xBC, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x01, 0x27, 0x00, 0x64,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x84, 0x01, 0x90, 0x00, 0x05, 0x00, 0x00, 0x05, 0x9A,
-	0x05, 0x33, 0x00, 0x00, 0x01, 0x1F, 0x05, 0x9A, 0x05, 0x33, 0x00, 0x00, 0x03, 0xD1, 0x00, 0x66,
-	0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00,
-	0x02, 0xFF, 0x50, 0x00, 0x20, 0x5B, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x47, 0x4F,
-	0x4F, 0x47, 0x00, 0x40, 0x00, 0x00, 0xFF, 0xFD, 0x06, 0x00, 0xFE, 0x00, 0x00, 0x66, 0x07, 0x9A,
-	0x02, 0x00, 0x20, 0x00, 0x01, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3A, 0x05, 0xB0, 0x00, 0x00,
-	0x00, 0x20, 0x00, 0x03, 0x06, 0x00, 0x00, 0x15, 0x05, 0xB0, 0x00, 0x14, 0x05, 0xB0, 0x00, 0x14,
-	0x04, 0x3A, 0x00, 0x14, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xEC,
-	0xFE, 0x60, 0xFF, 0xF5, 0x05, 0xB0, 0x00, 0x15, 0x00, 0x00, 0xFF, 0xEB, 0x00, 0x00, 0x00, 0xBD,
-	0x00, 0xC0, 0x00, 0x9D, 0x00, 0x9D, 0x00, 0xBA, 0x00, 0x97, 0x00, 0x97, 0x00, 0x27, 0x00, 0xC0,
-	0x00, 0x9D, 0x00, 0x86, 0x00, 0xBC, 0x00, 0xAB, 0x00, 0xBA, 0x00, 0x9A, 0x00, 0xD3, 0x00, 0xB3,
-	0x00, 0x99, 0x01, 0xE0, 0x00, 0x96, 0x00, 0xBA, 0x00, 0x9A, 0x00, 0xA9, 0x01, 0x0B, 0x00, 0x82,
-	0x00, 0xAE, 0x00, 0xA0, 0x00, 0x8C, 0x00, 0x95, 0x00, 0xB9, 0x00, 0xA9, 0x00, 0x17, 0x00, 0x93,
-	0x00, 0x9A, 0x00, 0x7B, 0x00, 0x8B, 0x00, 0xA1, 0x00, 0xDE, 0x00, 0xA0, 0x00, 0x8C, 0x00, 0x9D,
-	0x00, 0xB6, 0x00, 0x27, 0x00, 0xC0, 0x00, 0x9D, 0x00, 0xA4, 0x00, 0x86, 0x00, 0xA2, 0x00, 0xAB,
-	0x00, 0xB6, 0x00, 0xBF, 0x00, 0xBA, 0x00, 0x82, 0x00, 0x8E, 0x00, 0x9A, 0x00, 0xA2, 0x00, 0xB2,
-	0x00, 0xD3, 0x00, 0x91, 0x00, 0x99, 0x00, 0xAD, 0x00, 0xB3, 0x00, 0xBE, 0x01, 0xC9, 0x01, 0xFD,
-	0x00, 0x96, 0x00, 0xBA, 0x00, 0x47, 0x00, 0x98, 0x00, 0x9D, 0x00, 0xA9, 0x01, 0x0B, 0x00, 0x82,
-	0x00, 0x99, 0x00, 0x9F, 0x00, 0xA9, 0x00, 0xB0, 0x00, 0x81, 0x00, 0x85, 0x00, 0x8B, 0x00, 0x94,
-	0x00, 0xA9, 0x00, 0xB5, 0x00, 0xBA, 0x00, 0x17, 0x00, 0x50, 0x00, 0x63, 0x00, 0x78, 0x00, 0x7D,
-	0x00, 0x83, 0x00, 0x8B, 0x00, 0x90, 0x00, 0x98, 0x00, 0xA2, 0x00, 0xAE, 0x00, 0xD4, 0x00, 0xDE,
-	0x01, 0x26, 0x00, 0x7B, 0x00, 0x89, 0x00, 0x93, 0x00, 0x9D, 0x00, 0xA5, 0x00, 0xB4, 0x04, 0x8D,
-	0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x02, 0x28, 0x00, 0x02, 0x00, 0x59, 0x00, 0x25, 0x00, 0x3E, 0x00, 0x01, 0x00, 0x44, 0x00, 0x5E,
-	0x00, 0x01, 0x00, 0x6A, 0x00, 0x6A, 0x00, 0x01, 0x00, 0x70, 0x00, 0x70, 0x00, 0x01, 0x00, 0x75,
-	0x00, 0x75, 0x00, 0x01, 0x00, 0x81, 0x00, 0x81, 0x00, 0x01, 0x00, 0x83, 0x00, 0x83, 0x00, 0x01,
-	0x00, 0x86, 0x00, 0x86, 0x00, 0x01, 0x00, 0x89, 0x00, 0x89, 0x00, 0x01, 0x00, 0x8B, 0x00, 0x96,
-	0x00, 0x01, 0x00, 0x98, 0x00, 0x9F, 0x00, 0x01, 0x00, 0xA1, 0x00, 0xA3, 0x00, 0x01, 0x00, 0xA5,
-	0x00, 0xA6, 0x00, 0x01, 0x00, 0xA8, 0x00, 0xAD, 0x00, 0x03, 0x00, 0xB1, 0x00, 0xB1, 0x00, 0x01,
-	0x00, 0xBA, 0x00, 0xBB, 0x00, 0x01, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x01, 0x00, 0xC1, 0x00, 0xC1,
-	0x00, 0x01, 0x00, 0xC3, 0x00, 0xC4, 0x00, 0x01, 0x00, 0xC7, 0x00, 0xC7, 0x00, 0x01, 0x00, 0xCB,
-	0x00, 0xCB, 0x00, 0x01, 0x00, 0xCD, 0x00, 0xCE, 0x00, 0x01, 0x00, 0xD0, 0x00, 0xD1, 0x00, 0x01,
-	0x00, 0xD3, 0x00, 0xD3, 0x00, 0x01, 0x00, 0xDA, 0x00, 0xDE, 0x00, 0x01, 0x00, 0xE1, 0x00, 0xE1,
-	0x00, 0x01, 0x00, 0xE5, 0x00, 0xE5, 0x00, 0x01, 0x00, 0xE7, 0x00, 0xE9, 0x00, 0x01, 0x00, 0xEB,
-	0x00, 0xFB, 0x00, 0x01, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x00, 0x01,
-	0x01, 0x03, 0x01, 0x03, 0x00, 0x01, 0x01, 0x08, 0x01, 0x09, 0x00, 0x01, 0x01, 0x16, 0x01, 0x1A,
-	0x00, 0x01, 0x01, 0x1C, 0x01, 0x1C, 0x00, 0x01, 0x01, 0x20, 0x01, 0x22, 0x00, 0x01, 0x01, 0x24,
-	0x01, 0x27, 0x00, 0x03, 0x01, 0x2A, 0x01, 0x2B, 0x00, 0x01, 0x01, 0x33, 0x01, 0x34, 0x00, 0x01,
-	0x01, 0x36, 0x01, 0x36, 0x00, 0x01, 0x01, 0x3B, 0x01, 0x3C, 0x00, 0x01, 0x01, 0x41, 0x01, 0x44,
-	0x00, 0x01, 0x01, 0x47, 0x01, 0x48, 0x00, 0x01, 0x01, 0x4B, 0x01, 0x4D, 0x00, 0x01, 0x01, 0x51,
-	0x01, 0x51, 0x00, 0x01, 0x01, 0x54, 0x01, 0x58, 0x00, 0x01, 0x01, 0x5D, 0x01, 0x5E, 0x00, 0x01,
-	0x01, 0x62, 0x01, 0x62, 0x00, 0x01, 0x01, 0x64, 0x01, 0x64, 0x00, 0x01, 0x01, 0x68, 0x01, 0x68,
-	0x00, 0x01, 0x01, 0x6A, 0x01, 0x6C, 0x00, 0x01, 0x01, 0x6E, 0x01, 0x6E, 0x00, 0x01, 0x01, 0x70,
-	0x01, 0x70, 0x00, 0x01, 0x01, 0xD5, 0x01, 0xDB, 0x00, 0x02, 0x01, 0xEC, 0x02, 0x00, 0x00, 0x01,
-	0x02, 0x04, 0x02, 0x04, 0x00, 0x01, 0x02, 0x0D, 0x02, 0x0D, 0x00, 0x01, 0x02, 0x0F, 0x02, 0x0F,
-	0x00, 0x01, 0x02, 0x16, 0x02, 0x18, 0x00, 0x01, 0x02, 0x1A, 0x02, 0x1B, 0x00, 0x01, 0x02, 0x1D,
-	0x02, 0x1D, 0x00, 0x01, 0x02, 0x21, 0x02, 0x21, 0x00, 0x01, 0x02, 0x23, 0x02, 0x25, 0x00, 0x01,
-	0x02, 0x2B, 0x02, 0x2B, 0x00, 0x01, 0x02, 0x30, 0x02, 0x32, 0x00, 0x01, 0x02, 0x34, 0x02, 0x34,
-	0x00, 0x01, 0x02, 0x42, 0x02, 0x42, 0x00, 0x01, 0x02, 0x45, 0x02, 0x45, 0x00, 0x01, 0x02, 0x47,
-	0x02, 0x47, 0x00, 0x01, 0x02, 0x4A, 0x02, 0x4D, 0x00, 0x01, 0x02, 0x79, 0x02, 0x7D, 0x00, 0x01,
-	0x02, 0x8D, 0x02, 0x92, 0x00, 0x01, 0x02, 0x95, 0x02, 0xFD, 0x00, 0x01, 0x03, 0x00, 0x03, 0xBF,
-	0x00, 0x01, 0x03, 0xC1, 0x03, 0xC1, 0x00, 0x01, 0x03, 0xC3, 0x03, 0xCD, 0x00, 0x01, 0x03, 0xCF,
-	0x03, 0xD8, 0x00, 0x01, 0x03, 0xDA, 0x03, 0xF5, 0x00, 0x01, 0x03, 0xF9, 0x03, 0xF9, 0x00, 0x01,
-	0x03, 0xFB, 0x04, 0x02, 0x00, 0x01, 0x04, 0x04, 0x04, 0x06, 0x00, 0x01, 0x04, 0x09, 0x04, 0x0D,
-	0x00, 0x01, 0x04, 0x0F, 0x04, 0x9A, 0x00, 0x01, 0x04, 0x9D, 0x04, 0x9E, 0x00, 0x01, 0x04, 0xA0,
-	0x04, 0xA1, 0x00, 0x01, 0x04, 0xA3, 0x04, 0xA6, 0x00, 0x01, 0x04, 0xB0, 0x05, 0x0C, 0x00, 0x01,
-	0x05, 0x0E, 0x05, 0x18, 0x00, 0x01, 0x05, 0x1B, 0x05, 0x28, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03,
-	0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x02, 0x00, 0x02,
-	0x00, 0xA8, 0x00, 0xAC, 0x00, 0x00, 0x01, 0x24, 0x01, 0x27, 0x00, 0x05, 0x00, 0x02, 0x00, 0x01,
-	0x00, 0xA8, 0x00, 0xAC, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0xAD, 0x40, 0xFF, 0x7E, 0x34,
-	0x7D, 0x55, 0x7C, 0x3E, 0xFF, 0x1F, 0x7B, 0x3B, 0xFF, 0x1F, 0x7A, 0x3D, 0xFF, 0x1F, 0x79, 0x3B,
-	0x40, 0x1F, 0x78, 0x3C, 0xFF, 0x1F, 0x77, 0x3C, 0x3D, 0x1F, 0x76, 0x35, 0x07, 0x1F, 0x75, 0x3A,
-	0xFF, 0x1F, 0x74, 0x3A, 0x67, 0x1F, 0x73, 0x39, 0x4F, 0x1F, 0x72, 0x39, 0xFF, 0x1F, 0x71, 0x36,
-	0xFF, 0x1F, 0x70, 0x38, 0xCD, 0x1F, 0x6F, 0x38, 0xFF, 0x1F, 0x6E, 0x37, 0x5E, 0x1F, 0x6D, 0x37,
-	0xCD, 0x1F, 0x6C, 0x37, 0xFF, 0x1F, 0x6B, 0x37, 0x2D, 0x1F, 0x6A, 0x37, 0x18, 0x1F, 0x69, 0x34,
-	0xFF, 0x1F, 0x68, 0x32, 0xFF, 0x1F, 0x67, 0x32, 0xCD, 0x1F, 0x66, 0x33, 0xFF, 0x1F, 0x65, 0x31,
-	0xFF, 0x1F, 0x64, 0x30, 0xFF, 0x1F, 0x63, 0x30, 0xAB, 0x1F, 0x62, 0x30, 0x67, 0x1F, 0x61, 0x2E,
-	0xFF, 0x1F, 0x60, 0x2E, 0x80, 0x1F, 0x5F, 0x2F, 0xFF, 0x1F, 0x5E, 0x2F, 0x93, 0x1F, 0x5D, 0x2D,
-	0xFF, 0x1F, 0x5C, 0x2C, 0xFF, 0x1F, 0x5B, 0x2B, 0xFF, 0x1F, 0x5A, 0x2A, 0xCD, 0x1F, 0x59, 0x2A,
-	0xFF, 0x1F, 0x58, 0x2A, 0x0D, 0x1F, 0x57, 0x29, 0xFF, 0x1F, 0x56, 0x28, 0xFF, 0x1F, 0x55, 0x27,
-	0x24, 0x1F, 0x54, 0x27, 0x2D, 0x1F, 0x53, 0x25, 0x5E, 0x1F, 0x52, 0x25, 0xFF, 0x1F, 0x51, 0x25,
-	0xAB, 0x1F, 0x50, 0x26, 0xFF, 0x1F, 0x4F, 0x26, 0x80, 0x1F, 0x4E, 0x24, 0xFF, 0x1F, 0x4D, 0x23,
-	0x2B, 0x1F, 0x4C, 0x23, 0xAB, 0x1F, 0x4B, 0x23, 0xFF, 0x1F, 0x4A, 0x23, 0x56, 0x1F, 0x49, 0x23,
-	0x2B, 0x1F, 0x48, 0x22, 0xFF, 0x1F, 0x47, 0x20, 0xFF, 0x1F, 0x46, 0x20, 0x72, 0x1F, 0x45, 0x21,
-	0xFF, 0x1F, 0x44, 0x21, 0x72, 0x1F, 0x43, 0x1F, 0xFF, 0x1F, 0x42, 0x1E, 0x93, 0x1F, 0x41, 0x1E,
-	0xFF, 0x1F, 0x40, 0x1D, 0xFF, 0x1F, 0x3F, 0x1C, 0xFF, 0x1F, 0x3D, 0x3B, 0x93, 0x40, 0xEA, 0x1F,
-	0x3C, 0x3B, 0x34, 0x1F, 0x3A, 0x35, 0x0E, 0x1F, 0x39, 0x36, 0x72, 0x1F, 0x38, 0x36, 0x4F, 0x1F,
-	0x37, 0x36, 0x22, 0x1F, 0x36, 0x35, 0x93, 0x1F, 0x33, 0x32, 0x40, 0x1F, 0x31, 0x30, 0x72, 0x1F,
-	0x2F, 0x2E, 0x4A, 0x1F, 0x2B, 0x2A, 0x40, 0x1F, 0x27, 0x19, 0x04, 0x1F, 0x26, 0x25, 0x28, 0x1F,
-	0x25, 0x33, 0x1B, 0x19, 0x5C, 0x24, 0x1A, 0x12, 0x1F, 0x23, 0x05, 0x1A, 0x19, 0x5C, 0x22, 0x19,
-	0xFF, 0x1F, 0x21, 0x20, 0x3D, 0x1F, 0x20, 0x38, 0x18, 0x16, 0x5C, 0x1F, 0x18, 0x2D, 0x1F, 0x1E,
-	0x17, 0xFF, 0x1F, 0x1D, 0x16, 0xFF, 0x1F, 0x1C, 0x16, 0x07, 0x1F, 0x1B, 0x33, 0x19, 0x1C, 0x5B,
-	0x18, 0x34, 0x16, 0x1C, 0x5B, 0x1A, 0x33, 0x19, 0x1C, 0x5B, 0x17, 0x34, 0x16, 0x1C, 0x5B, 0x15,
-	0x19, 0x3E, 0x16, 0xA6, 0x5A, 0x13, 0x31, 0x12, 0x55, 0x11, 0x31, 0x10, 0x55, 0x12, 0x59, 0x10,
-	0x59, 0x0D, 0x34, 0x0C, 0x55, 0x05, 0x34, 0x04, 0x55, 0x0C, 0x59, 0x04, 0x59, 0x1F, 0x04, 0x5F,
-	0x04, 0x02, 0x0F, 0x04, 0x7F, 0x04, 0xEF, 0x04, 0x03, 0x0F, 0x5E, 0x0E, 0x55, 0x0B, 0x34, 0x0A,
-	0x55, 0x07, 0x34, 0x06, 0x55, 0x01, 0x31, 0x00, 0x55, 0x0E, 0x59, 0x0A, 0x59, 0x06, 0x59, 0x7F,
-	0x06, 0x01, 0x2F, 0x06, 0x4F, 0x06, 0x6F, 0x06, 0x03, 0x3F, 0x06, 0x5F, 0x06, 0x7F, 0x06, 0x03,
-	0x00, 0x59, 0x2F, 0x00, 0x01, 0x2F, 0x00, 0x6F, 0x00, 0xEF, 0x00, 0x03, 0x09, 0x34, 0x08, 0x55,
-	0x03, 0x34, 0x02, 0x55, 0x08, 0x59, 0x02, 0x59, 0x1F, 0x02, 0x5F, 0x02, 0x02, 0x0F, 0x02, 0x7F,
-	0x02, 0xEF, 0x02, 0x03, 0x03, 0x40, 0x40, 0x05, 0x01, 0xB8, 0x01, 0x90, 0xB0, 0x54, 0x2B, 0x4B,
-	0xB8, 0x07, 0xFF, 0x52, 0x4B, 0xB0, 0x09, 0x50, 0x5B, 0xB0, 0x01, 0x88, 0xB0, 0x25, 0x53, 0xB0,
-	0x01, 0x88, 0xB0, 0x40, 0x51, 0x5A, 0xB0, 0x06, 0x88, 0xB0, 0x00, 0x55, 0x5A, 0x5B, 0x58, 0xB1,
-	0x01, 0x01, 0x8E, 0x59, 0x85, 0x8D, 0x8D, 0x00, 0x1D, 0x42, 0x4B, 0xB0, 0x90, 0x53, 0x58, 0xB2,
-	0x03, 0x00, 0x00, 0x1D, 0x42, 0x59, 0xB1, 0x02, 0x02, 0x43, 0x51, 0x58, 0xB1, 0x04, 0x03, 0x8E,
-	0x59, 0x73, 0x74, 0x00, 0x2B, 0x00, 0x2B, 0x2B, 0x2B, 0x73, 0x74, 0x00, 0x2B, 0x73, 0x74, 0x75,
-	0x00, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x73, 0x74, 0x00, 0x2B, 0x00, 0x2B,
-	0x2B, 0x2B, 0x00, 0x2B, 0x00, 0x2B, 0x2B, 0x2B, 0x01, 0x2B, 0x01, 0x2B, 0x01, 0x2B, 0x01, 0x2B,
-	0x01, 0x2B, 0x01, 0x2B, 0x2B, 0x00, 0x2B, 0x2B, 0x01, 0x2B, 0x2B, 0x01, 0x2B, 0x00, 0x2B, 0x00,
-	0x2B, 0x01, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x01, 0x2B, 0x2B, 0x00, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
-	0x2B, 0x2B, 0x01, 0x2B, 0x2B, 0x00, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x01, 0x2B, 0x00,
-	0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x01, 0x2B, 0x2B,
-	0x00, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x01, 0x2B, 0x2B, 0x2B, 0x2B,
-	0x2B, 0x2B, 0x2B, 0x00, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
-	0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14,
-	0x00, 0x04, 0x06, 0x70, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x02, 0x00, 0x0D, 0x00, 0x7E, 0x00, 0xA0, 0x00, 0xAC, 0x00, 0xAD, 0x00, 0xBF, 0x00, 0xC6,
-	0x00, 0xCF, 0x00, 0xE6, 0x00, 0xEF, 0x00, 0xFE, 0x01, 0x0F, 0x01, 0x11, 0x01, 0x25, 0x01, 0x27,
-	0x01, 0x30, 0x01, 0x38, 0x01, 0x40, 0x01, 0x53, 0x01, 0x5F, 0x01, 0x67, 0x01, 0x7E, 0x01, 0x7F,
-	0x01, 0x8F, 0x01, 0x92, 0x01, 0xA1, 0x01, 0xB0, 0x01, 0xF0, 0x01, 0xFB, 0x01, 0xFF, 0x02, 0x1B,
-	0x02, 0x37, 0x02, 0x59, 0x02, 0xBC, 0x02, 0xC7, 0x02, 0xC9, 0x02, 0xDD, 0x02, 0xF3, 0x03, 0x01,
-	0x03, 0x03, 0x03, 0x09, 0x03, 0x0F, 0x03, 0x23, 0x03, 0x8A, 0x03, 0x8C, 0x03, 0x92, 0x03, 0xA1,
-	0x03, 0xB0, 0x03, 0xB9, 0x03, 0xC9, 0x03, 0xCE, 0x03, 0xD2, 0x03, 0xD6, 0x04, 0x25, 0x04, 0x2F,
-	0x04, 0x45, 0x04, 0x4F, 0x04, 0x62, 0x04, 0x6F, 0x04, 0x79, 0x04, 0x86, 0x04, 0x8B, 0x04, 0x9F,
-	0x04, 0xA9, 0x04, 0xB1, 0x04, 0xBA, 0x04, 0xC2, 0x04, 0xCA, 0x04, 0xCE, 0x04, 0xD7, 0x04, 0xE1,
-	0x04, 0xF5, 0x05, 0x01, 0x05, 0x10, 0x05, 0x13, 0x1E, 0x01, 0x1E, 0x3F, 0x1E, 0x85, 0x1E, 0xF1,
-	0x1E, 0xF3, 0x1E, 0xF9, 0x1F, 0x4D, 0x20, 0x09, 0x20, 0x0B, 0x20, 0x11, 0x20, 0x15, 0x20, 0x1E,
-	0x20, 0x22, 0x20, 0x27, 0x20, 0x30, 0x20, 0x33, 0x20, 0x3A, 0x20, 0x3C, 0x20, 0x44, 0x20, 0x70,
-	0x20, 0x8E, 0x20, 0xA4, 0x20, 0xAA, 0x20, 0xAC, 0x20, 0xB1, 0x20, 0xBA, 0x20, 0xBD, 0x21, 0x05,
-	0x21, 0x13, 0x21, 0x16, 0x21, 0x22, 0x21, 0x26, 0x21, 0x2E, 0x21, 0x5E, 0x22, 0x02, 0x22, 0x06,
-	0x22, 0x0F, 0x22, 0x12, 0x22, 0x1A, 0x22, 0x1E, 0x22, 0x2B, 0x22, 0x48, 0x22, 0x60, 0x22, 0x65,
-	0x25, 0xCA, 0xEE, 0x02, 0xF6, 0xC3, 0xFB, 0x04, 0xFE, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x02, 0x00, 0x0D, 0x00, 0x20, 0x00, 0xA0, 0x00, 0xA1, 0x00, 0xAD, 0x00, 0xAE,
-	0x00, 0xC0, 0x00, 0xC7, 0x00, 0xD0, 0x00, 0xE7, 0x00, 0xF0, 0x00, 0xFF, 0x01, 0x10, 0x01, 0x12,
-	0x01, 0x26, 0x01, 0x28, 0x01, 0x31, 0x01, 0x39, 0x01, 0x41, 0x01, 0x54, 0x01, 0x60, 0x01, 0x68,
-	0x01, 0x7F, 0x01, 0x8F, 0x01, 0x92, 0x01, 0xA0, 0x01, 0xAF, 0x01, 0xF0, 0x01, 0xFA, 0x01, 0xFC,
-	0x02, 0x18, 0x02, 0x37, 0x02, 0x59, 0x02, 0xBC, 0x02, 0xC6, 0x02, 0xC9, 0x02, 0xD8, 0x02, 0xF3,
-	0x03, 0x00, 0x03, 0x03, 0x03, 0x09, 0x03, 0x0F, 0x03, 0x23, 0x03, 0x84, 0x03, 0x8C, 0x03, 0x8E,
-	0x03, 0x93, 0x03, 0xA3, 0x03, 0xB1, 0x03, 0xBA, 0x03, 0xCA, 0x03, 0xD1, 0x03, 0xD6, 0x04, 0x00,
-	0x04, 0x26, 0x04, 0x30, 0x04, 0x46, 0x04, 0x50, 0x04, 0x63, 0x04, 0x70, 0x04, 0x7A, 0x04, 0x88,
-	0x04, 0x8C, 0x04, 0xA0, 0x04, 0xAA, 0x04, 0xB2, 0x04, 0xBB, 0x04, 0xC3, 0x04, 0xCB, 0x04, 0xCF,
-	0x04, 0xD8, 0x04, 0xE2, 0x04, 0xF6, 0x05, 0x02, 0x05, 0x11, 0x1E, 0x00, 0x1E, 0x3E, 0x1E, 0x80,
-	0x1E, 0xA0, 0x1E, 0xF2, 0x1E, 0xF4, 0x1F, 0x4D, 0x20, 0x00, 0x20, 0x0A, 0x20, 0x10, 0x20, 0x13,
-	0x20, 0x17, 0x20, 0x20, 0x20, 0x25, 0x20, 0x30, 0x20, 0x32, 0x20, 0x39, 0x20, 0x3C, 0x20, 0x44,
-	0x20, 0x70, 0x20, 0x74, 0x20, 0xA3, 0x20, 0xA6, 0x20, 0xAB, 0x20, 0xB1, 0x20, 0xB9, 0x20, 0xBC,
-	0x21, 0x05, 0x21, 0x13, 0x21, 0x16, 0x21, 0x22, 0x21, 0x26, 0x21, 0x2E, 0x21, 0x5B, 0x22, 0x02,
-	0x22, 0x06, 0x22, 0x0F, 0x22, 0x11, 0x22, 0x1A, 0x22, 0x1E, 0x22, 0x2B, 0x22, 0x48, 0x22, 0x60,
-	0x22, 0x64, 0x25, 0xCA, 0xEE, 0x01, 0xF6, 0xC3, 0xFB, 0x01, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-	0x00, 0x01, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xE4, 0x01, 0xF3, 0xFF, 0xC2, 0x01, 0xE7, 0xFF, 0xC1,
-	0x00, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x01, 0xD5, 0x00, 0x00, 0x01, 0xD1, 0x00, 0x00, 0x01, 0xCF,
-	0x00, 0x00, 0x01, 0xCD, 0x00, 0x00, 0x01, 0xCB, 0x00, 0x00, 0x01, 0xC5, 0x00, 0x00, 0x01, 0xC7,
-	0xFF, 0x16, 0xFF, 0x07, 0xFF, 0x05, 0xFE, 0xF8, 0xFE, 0xEB, 0x02, 0x09, 0x00, 0x00, 0x01, 0x4A,
-	0x00, 0x00, 0xFE, 0x65, 0xFE, 0x44, 0x01, 0x3E, 0xFD, 0xD8, 0xFD, 0xD7, 0xFD, 0xC9, 0xFD, 0xB4,
-	0xFD, 0xA8, 0xFD, 0xA7, 0xFD, 0xA2, 0xFD, 0x9D, 0xFD, 0x8A, 0x00, 0x00, 0x00, 0x19, 0x00, 0x18,
-	0x00, 0x00, 0x00, 0x00, 0xFD, 0x0A, 0x00, 0x00, 0xFF, 0xF9, 0xFC, 0xFE, 0xFC, 0xFB, 0x00, 0x00,
-	0xFC, 0xBA, 0x00, 0x00, 0xFC, 0xB2, 0x00, 0x00, 0xFC, 0xA7, 0x00, 0x00, 0xFC, 0xA1, 0xFC, 0xA0,
-	0x00, 0x00, 0xFC, 0x99, 0x00, 0x00, 0xFC, 0x91, 0x00, 0x00, 0xFC, 0x8B, 0x00, 0x00, 0xFF, 0x43,
-	0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFC, 0x5E, 0x00, 0x00, 0xE5, 0xFD, 0xE5, 0xBD, 0xE5, 0x6E,
-	0xE5, 0x99, 0xE5, 0x02, 0xE5, 0x97, 0xE5, 0x98, 0xE1, 0x72, 0xE1, 0x73, 0xE1, 0x6F, 0x00, 0x00,
-	0xE1, 0x6C, 0xE1, 0x6B, 0xE1, 0x69, 0xE1, 0x61, 0xE3, 0xC4, 0xE1, 0x59, 0xE3, 0xBC, 0xE1, 0x50,
-	0xE1, 0x25, 0xE1, 0x22, 0x00, 0x00, 0xE1, 0x0C, 0x00, 0x00, 0xE1, 0x07, 0xE1, 0x00, 0xE0, 0xFF,
-	0xE0, 0xB8, 0xE0, 0xAB, 0xE0, 0xA9, 0xE0, 0x9E, 0xDF, 0x94, 0xE0, 0x93, 0xE0, 0x67, 0xDF, 0xC4,
-	0xDE, 0xAC, 0xDF, 0xB8, 0xDF, 0xB7, 0xDF, 0xB0, 0xDF, 0xAD, 0xDF, 0xA1, 0xDF, 0x85, 0xDF, 0x6E,
-	0xDF, 0x6B, 0xDC, 0x07, 0x13, 0xD1, 0x0B, 0x11, 0x06, 0xD5, 0x02, 0xDD, 0x01, 0xE1, 0x00, 0x01,
-	0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xF2, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0x26, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,
-	0x01, 0x40, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x4C, 0x00, 0x00, 0x01, 0x6E, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6E, 0x00, 0x00,
-	0x01, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5C, 0x00, 0x00, 0x00, 0x00,
-	0x01, 0x64, 0x01, 0x80, 0x00, 0x00, 0x01, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xB0,
-	0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x02, 0x42, 0x00, 0x00, 0x00, 0x00,
-	0x02, 0x50, 0x00, 0x00, 0x02, 0x74, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x02, 0x8C, 0x00, 0x00,
-	0x02, 0x90, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x02, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA4,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x02, 0x94, 0x00, 0x00, 0x02, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x02, 0x02, 0x9A, 0x02, 0x9B, 0x02, 0x9C, 0x02, 0x9D, 0x02, 0x9E, 0x02, 0x9F, 0x00, 0x81,
-	0x02, 0x96, 0x02, 0xAA, 0x02, 0xAB, 0x02, 0xAC, 0x02, 0xAD, 0x02, 0xAE, 0x02, 0xAF, 0x00, 0x82,
-	0x00, 0x83, 0x02, 0xB0, 0x02, 0xB1, 0x02, 0xB2, 0x02, 0xB3, 0x02, 0xB4, 0x00, 0x84, 0x00, 0x85,
-	0x02, 0xB5, 0x02, 0xB6, 0x02, 0xB7, 0x02, 0xB8, 0x02, 0xB9, 0x02, 0xBA, 0x00, 0x86, 0x00, 0x87,
-	0x02, 0xC5, 0x02, 0xC6, 0x02, 0xC7, 0x02, 0xC8, 0x02, 0xC9, 0x02, 0xCA, 0x00, 0x88, 0x00, 0x89,
-	0x02, 0xCB, 0x02, 0xCC, 0x02, 0xCD, 0x02, 0xCE, 0x02, 0xCF, 0x00, 0x8A, 0x02, 0x95, 0x00, 0x8B,
-	0x00, 0x8C, 0x02, 0x97, 0x00, 0x8D, 0x02, 0xFE, 0x02, 0xFF, 0x03, 0x00, 0x03, 0x01, 0x03, 0x02,
-	0x03, 0x03, 0x00, 0x8E, 0x00, 0x8F, 0x00, 0x90, 0x03, 0x0C, 0x03, 0x0D, 0x03, 0x0E, 0x03, 0x0F,
-	0x03, 0x10, 0x03, 0x11, 0x03, 0x12, 0x00, 0x91, 0x00, 0x92, 0x03, 0x13, 0x03, 0x14, 0x03, 0x15,
-	0x03, 0x16, 0x03, 0x17, 0x03, 0x18, 0x00, 0x93, 0x00, 0x94, 0x03, 0x27, 0x03, 0x28, 0x03, 0x2B,
-	0x03, 0x2C, 0x03, 0x2D, 0x03, 0x2E, 0x02, 0x98, 0x02, 0x99, 0x02, 0xA0, 0x02, 0xBB, 0x03, 0x25,
-	0x03, 0x26, 0x03, 0x29, 0x03, 0x2A, 0x00, 0xAE, 0x00, 0xAF, 0x03, 0xA1, 0x00, 0xB0, 0x03, 0xA2,
-	0x03, 0xA3, 0x03, 0xA4, 0x00, 0xB1, 0x00, 0xB2, 0x03, 0xAB, 0x03, 0xAC, 0x03, 0xAD, 0x00, 0xB3,
-	0x03, 0xAE, 0x03, 0xAF, 0x00, 0xB4, 0x03, 0xB0, 0x03, 0xB1, 0x00, 0xB5, 0x03, 0xB2, 0x00, 0xB6,
-	0x03, 0xB3, 0x00, 0xB7, 0x03, 0xB4, 0x03, 0xB5, 0x00, 0xB8, 0x03, 0xB6, 0x00, 0xB9, 0x00, 0xBA,
-	0x03, 0xB7, 0x03, 0xB8, 0x03, 0xB9, 0x03, 0xBA, 0x03, 0xBB, 0x03, 0xBC, 0x03, 0xBD, 0x03, 0xBE,
-	0x00, 0xC4, 0x03, 0xC0, 0x03, 0xC1, 0x00, 0xC5, 0x03, 0xBF, 0x00, 0xC6, 0x00, 0xC7, 0x00, 0xC8,
-	0x00, 0xC9, 0x00, 0xCA, 0x00, 0xCB, 0x00, 0xCC, 0x03, 0xC2, 0x00, 0xCD, 0x00, 0xCE, 0x03, 0xFF,
-	0x03, 0xC8, 0x00, 0xD2, 0x03, 0xC9, 0x00, 0xD3, 0x03, 0xCA, 0x03, 0xCB, 0x03, 0xCC, 0x03, 0xCD,
-	0x00, 0xD4, 0x00, 0xD5, 0x00, 0xD6, 0x03, 0xCF, 0x04, 0x00, 0x03, 0xD0, 0x00, 0xD7, 0x03, 0xD1,
-	0x00, 0xD8, 0x03, 0xD2, 0x03, 0xD3, 0x00, 0xD9, 0x03, 0xD4, 0x00, 0xDA, 0x00, 0xDB, 0x00, 0xDC,
-	0x03, 0xD5, 0x03, 0xCE, 0x00, 0xDD, 0x03, 0xD6, 0x03, 0xD7, 0x03, 0xD8, 0x03, 0xD9, 0x03, 0xDA,
-	0x03, 0xDB, 0x03, 0xDC, 0x00, 0xDE, 0x00, 0xDF, 0x03, 0xDD, 0x03, 0xDE, 0x00, 0xEA, 0x00, 0xEB,
-	0x00, 0xEC, 0x00, 0xED, 0x03, 0xDF, 0x00, 0xEE, 0x00, 0xEF, 0x00, 0xF0, 0x03, 0xE0, 0x00, 0xF1,
-	0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF4, 0x03, 0xE1, 0x00, 0xF5, 0x03, 0xE2, 0x03, 0xE3, 0x00, 0xF6,
-	0x03, 0xE4, 0x00, 0xF7, 0x03, 0xE5, 0x04, 0x01, 0x03, 0xE6, 0x01, 0x02, 0x03, 0xE7, 0x01, 0x03,
-	0x03, 0xE8, 0x03, 0xE9, 0x03, 0xEA, 0x03, 0xEB, 0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x03, 0xEC,
-	0x04, 0x02, 0x03, 0xED, 0x01, 0x07, 0x01, 0x08, 0x01, 0x09, 0x04, 0x9C, 0x04, 0x03, 0x04, 0x04,
-	0x01, 0x17, 0x01, 0x18, 0x01, 0x19, 0x01, 0x1A, 0x04, 0x05, 0x04, 0x06, 0x04, 0x08, 0x04, 0x07,
-	0x04, 0x9B, 0x01, 0x2C, 0x01, 0x2D, 0x01, 0x2E, 0x01, 0x2F, 0x01, 0x30, 0x04, 0x9D, 0x04, 0x9E,
-	0x01, 0x31, 0x01, 0x32, 0x01, 0x33, 0x01, 0x34, 0x04, 0x09, 0x04, 0x0A, 0x01, 0x35, 0x01, 0x36,
-	0x01, 0x37, 0x01, 0x38, 0x04, 0x9F, 0x04, 0xA0, 0x04, 0x0B, 0x04, 0x0C, 0x04, 0x92, 0x04, 0x93,
-	0x04, 0x0D, 0x04, 0x0E, 0x04, 0xA1, 0x04, 0xA2, 0x04, 0x9A, 0x01, 0x4C, 0x01, 0x4D, 0x04, 0x98,
-	0x04, 0x99, 0x04, 0x0F, 0x04, 0x10, 0x04, 0x11, 0x04, 0x94, 0x04, 0x95, 0x01, 0x56, 0x01, 0x57,
-	0x01, 0x58, 0x04, 0x1C, 0x04, 0x1B, 0x04, 0x1D, 0x04, 0x1E, 0x04, 0x1F, 0x04, 0x20, 0x04, 0x21,
-	0x01, 0x59, 0x01, 0x5A, 0x04, 0x96, 0x04, 0x97, 0x04, 0x36, 0x04, 0x37, 0x01, 0x5B, 0x01, 0x5C,
-	0x01, 0x5D, 0x01, 0x5E, 0x04, 0xA3, 0x04, 0xA4, 0x01, 0x5F, 0x04, 0x38, 0x04, 0xA5, 0x01, 0x6F,
-	0x01, 0x70, 0x01, 0x81, 0x01, 0x82, 0x04, 0xA7, 0x04, 0xA6, 0x01, 0xB1, 0x04, 0x91, 0x01, 0xB7,
-	0x00, 0x00, 0x00, 0x39, 0x02, 0xB2, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x00, 0x00, 0xB2,
-	0x06, 0xCA, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x0C, 0x06, 0xBE, 0x00, 0x03,
-	0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00, 0x0E, 0x06, 0xB0, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-	0x00, 0x03, 0x00, 0x32, 0x06, 0x7E, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x04, 0x00, 0x1C,
-	0x06, 0x62, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x26, 0x06, 0x3C, 0x00, 0x03,
-	0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x1C, 0x06, 0x20, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-	0x00, 0x07, 0x00, 0x40, 0x05, 0xE0, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x08, 0x00, 0x0C,
-	0x05, 0xD4, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x09, 0x00, 0x26, 0x05, 0xAE, 0x00, 0x03,
-	0x00, 0x01, 0x04, 0x09, 0x00, 0x0B, 0x00, 0x14, 0x05, 0x9A, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-	0x00, 0x0C, 0x00, 0x14, 0x05, 0x9A, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0D, 0x01, 0x22,
-	0x04, 0x78, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0E, 0x00, 0x36, 0x04, 0x42, 0x00, 0x03,
-	0x00, 0x01, 0x04, 0x09, 0x00, 0x19, 0x00, 0x0C, 0x06, 0xBE, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-	0x01, 0x00, 0x00, 0x0C, 0x04, 0x36, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x01, 0x00, 0x0A,
-	0x04, 0x2C, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x02, 0x00, 0x0C, 0x04, 0x20, 0x00, 0x03,
-	0x00, 0x01, 0x04, 0x09, 0x01, 0x03, 0x00, 0x08, 0x04, 0x18, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-	0x01, 0x04, 0x00, 0x14, 0x04, 0x04, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x05, 0x00, 0x0A,
-	0x03, 0xFA, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x06, 0x00, 0x0E, 0x06, 0xB0, 0x00, 0x03,
-	0x00, 0x01, 0x04, 0x09, 0x01, 0x07, 0x00, 0x0C, 0x03, 0xEE, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-	0x01, 0x08, 0x00, 0x10, 0x03, 0xDE, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x09, 0x00, 0x08,
-	0x03, 0xD6, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x0A, 0x00, 0x12, 0x03, 0xC4, 0x00, 0x03,
-	0x00, 0x01, 0x04, 0x09, 0x01, 0x0B, 0x00, 0x0A, 0x03, 0xBA, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-	0x01, 0x14, 0x00, 0x1C, 0x03, 0x9E, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x15, 0x00, 0x28,
-	0x03, 0x76, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x16, 0x00, 0x1E, 0x03, 0x58, 0x00, 0x03,
-	0x00, 0x01, 0x04, 0x09, 0x01, 0x17, 0x00, 0x22, 0x03, 0x36, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-	0x01, 0x18, 0x00, 0x20, 0x03, 0x16, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x19, 0x00, 0x24,
-	0x02, 0xF2, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x1A, 0x00, 0x1C, 0x02, 0xD6, 0x00, 0x03,
-	0x00, 0x01, 0x04, 0x09, 0x01, 0x1B, 0x00, 0x26, 0x02, 0xB0, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-	0x01, 0x1C, 0x00, 0x1E, 0x02, 0x92, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x26, 0x00, 0x12,
-	0x02, 0x80, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x27, 0x00, 0x0C, 0x02, 0x74, 0x00, 0x03,
-	0x00, 0x01, 0x04, 0x09, 0x01, 0x28, 0x00, 0x0A, 0x02, 0x6A, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-	0x01, 0x29, 0x00, 0x16, 0x02, 0x54, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x2A, 0x00, 0x22,
-	0x02, 0x32, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x2B, 0x00, 0x18, 0x02, 0x1A, 0x00, 0x03,
-	0x00, 0x01, 0x04, 0x09, 0x01, 0x2C, 0x00, 0x1C, 0x06, 0x20, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-	0x01, 0x2D, 0x00, 0x1A, 0x02, 0x00, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x2E, 0x00, 0x1E,
-	0x01, 0xE2, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x2F, 0x00, 0x16, 0x01, 0xCC, 0x00, 0x03,
-	0x00, 0x01, 0x04, 0x09, 0x01, 0x30, 0x00, 0x20, 0x01, 0xAC, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-	0x01, 0x31, 0x00, 0x18, 0x01, 0x94, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x3B, 0x00, 0x28,
-	0x01, 0x6C, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x3C, 0x00, 0x34, 0x01, 0x38, 0x00, 0x03,
-	0x00, 0x01, 0x04, 0x09, 0x01, 0x3D, 0x00, 0x2A, 0x01, 0x0E, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-	0x01, 0x3E, 0x00, 0x2E, 0x00, 0xE0, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x3F, 0x00, 0x2C,
-	0x00, 0xB4, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x40, 0x00, 0x30, 0x00, 0x84, 0x00, 0x03,
-	0x00, 0x01, 0x04, 0x09, 0x01, 0x41, 0x00, 0x28, 0x00, 0x5C, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-	0x01, 0x42, 0x00, 0x32, 0x00, 0x2A, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x43, 0x00, 0x2A,
-	0x00, 0x00, 0x00, 0x52, 0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x6F, 0x00, 0x2D,
-	0x00, 0x43, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x65,
-	0x00, 0x64, 0x00, 0x42, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x63, 0x00, 0x6B, 0x00, 0x52, 0x00, 0x6F,
-	0x00, 0x62, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x6F, 0x00, 0x2D, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x6E,
-	0x00, 0x64, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x45, 0x00, 0x78,
-	0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x52,
-	0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x6F, 0x00, 0x2D, 0x00, 0x43, 0x00, 0x6F,
-	0x00, 0x6E, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x42,
-	0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x52, 0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74,
-	0x00, 0x6F, 0x00, 0x2D, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6E,
-	0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x53, 0x00, 0x65, 0x00, 0x6D, 0x00, 0x69, 0x00, 0x42,
-	0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x52, 0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74,
-	0x00, 0x6F, 0x00, 0x2D, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6E,
-	0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x4D, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x75,
-	0x00, 0x6D, 0x00, 0x52, 0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x6F, 0x00, 0x2D,
-	0x00, 0x43, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x65,
-	0x00, 0x64, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x72,
-	0x00, 0x52, 0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x6F, 0x00, 0x2D, 0x00, 0x43,
-	0x00, 0x6F, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64,
-	0x00, 0x4C, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x52, 0x00, 0x6F, 0x00, 0x62,
-	0x00, 0x6F, 0x00, 0x74, 0x00, 0x6F, 0x00, 0x2D, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x64,
-	0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x45, 0x00, 0x78, 0x00, 0x74,
-	0x00, 0x72, 0x00, 0x61, 0x00, 0x4C, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x52,
-	0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x6F, 0x00, 0x2D, 0x00, 0x43, 0x00, 0x6F,
-	0x00, 0x6E, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x54,
-	0x00, 0x68, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x52, 0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74,
-	0x00, 0x6F, 0x00, 0x2D, 0x00, 0x42, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x63, 0x00, 0x6B, 0x00, 0x52,
-	0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x6F, 0x00, 0x2D, 0x00, 0x45, 0x00, 0x78,
-	0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x52,
-	0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x6F, 0x00, 0x2D, 0x00, 0x42, 0x00, 0x6F,
-	0x00, 0x6C, 0x00, 0x64, 0x00, 0x52, 0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x6F,
-	0x00, 0x2D, 0x00, 0x53, 0x00, 0x65, 0x00, 0x6D, 0x00, 0x69, 0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C,
-	0x00, 0x64, 0x00, 0x52, 0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x6F, 0x00, 0x2D,
-	0x00, 0x4D, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x75, 0x00, 0x6D, 0x00, 0x52, 0x00, 0x6F,
-	0x00, 0x62, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x6F, 0x00, 0x2D, 0x00, 0x4C, 0x00, 0x69, 0x00, 0x67,
-	0x00, 0x68, 0x00, 0x74, 0x00, 0x52, 0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x6F,
-	0x00, 0x2D, 0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x4C, 0x00, 0x69,
-	0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x52, 0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74,
-	0x00, 0x6F, 0x00, 0x2D, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x52, 0x00, 0x6F,
-	0x00, 0x6D, 0x00, 0x61, 0x00, 0x6E, 0x00, 0x4E, 0x00, 0x6F, 0x00, 0x72, 0x00, 0x6D, 0x00, 0x61,
-	0x00, 0x6C, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73,
-	0x00, 0x65, 0x00, 0x64, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6E,
-	0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x42, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x63,
-	0x00, 0x6B, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73,
-	0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61,
-	0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x64,
-	0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x42, 0x00, 0x6F,
-	0x00, 0x6C, 0x00, 0x64, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6E,
-	0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x53, 0x00, 0x65, 0x00, 0x6D, 0x00, 0x69,
-	0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x64,
-	0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x4D, 0x00, 0x65,
-	0x00, 0x64, 0x00, 0x69, 0x00, 0x75, 0x00, 0x6D, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x64,
-	0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x52, 0x00, 0x65,
-	0x00, 0x67, 0x00, 0x75, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x72, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x6E,
-	0x00, 0x64, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x4C,
-	0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x64,
-	0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x45, 0x00, 0x78,
-	0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x4C, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74,
-	0x00, 0x43, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x65,
-	0x00, 0x64, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x42, 0x00, 0x6C,
-	0x00, 0x61, 0x00, 0x63, 0x00, 0x6B, 0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61,
-	0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64,
-	0x00, 0x53, 0x00, 0x65, 0x00, 0x6D, 0x00, 0x69, 0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64,
-	0x00, 0x4D, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x75, 0x00, 0x6D, 0x00, 0x4C, 0x00, 0x69,
-	0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61,
-	0x00, 0x4C, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69,
-	0x00, 0x6E, 0x00, 0x49, 0x00, 0x74, 0x00, 0x61, 0x00, 0x6C, 0x00, 0x69, 0x00, 0x63, 0x00, 0x57,
-	0x00, 0x69, 0x00, 0x64, 0x00, 0x74, 0x00, 0x68, 0x00, 0x57, 0x00, 0x65, 0x00, 0x69, 0x00, 0x67,
-	0x00, 0x68, 0x00, 0x74, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x73, 0x00, 0x3A,
-	0x00, 0x2F, 0x00, 0x2F, 0x00, 0x6F, 0x00, 0x70, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x66, 0x00, 0x6F,
-	0x00, 0x6E, 0x00, 0x74, 0x00, 0x6C, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73,
-	0x00, 0x65, 0x00, 0x2E, 0x00, 0x6F, 0x00, 0x72, 0x00, 0x67, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69,
-	0x00, 0x73, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53,
-	0x00, 0x6F, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x20,
-	0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6C, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6E,
-	0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x65,
-	0x00, 0x72, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x53, 0x00, 0x49,
-	0x00, 0x4C, 0x00, 0x20, 0x00, 0x4F, 0x00, 0x70, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x46,
-	0x00, 0x6F, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x20, 0x00, 0x4C, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65,
-	0x00, 0x6E, 0x00, 0x73, 0x00, 0x65, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72,
-	0x00, 0x73, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2E, 0x00, 0x31,
-	0x00, 0x2E, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6C,
-	0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x65, 0x00, 0x20, 0x00, 0x69,
-	0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x76, 0x00, 0x61, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x61,
-	0x00, 0x62, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x20, 0x00, 0x77, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68,
-	0x00, 0x20, 0x00, 0x61, 0x00, 0x20, 0x00, 0x46, 0x00, 0x41, 0x00, 0x51, 0x00, 0x20, 0x00, 0x61,
-	0x00, 0x74, 0x00, 0x3A, 0x00, 0x20, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x73,
-	0x00, 0x3A, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x6F, 0x00, 0x70, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x66,
-	0x00, 0x6F, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x6C, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6E,
-	0x00, 0x73, 0x00, 0x65, 0x00, 0x2E, 0x00, 0x6F, 0x00, 0x72, 0x00, 0x67, 0x00, 0x47, 0x00, 0x6F,
-	0x00, 0x6F, 0x00, 0x67, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x2E, 0x00, 0x63, 0x00, 0x6F, 0x00, 0x6D,
-	0x00, 0x43, 0x00, 0x68, 0x00, 0x72, 0x00, 0x69, 0x00, 0x73, 0x00, 0x74, 0x00, 0x69, 0x00, 0x61,
-	0x00, 0x6E, 0x00, 0x20, 0x00, 0x52, 0x00, 0x6F, 0x00, 0x62, 0x00, 0x65, 0x00, 0x72, 0x00, 0x74,
-	0x00, 0x73, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x47, 0x00, 0x6F, 0x00, 0x6F, 0x00, 0x67, 0x00, 0x6C,
-	0x00, 0x65, 0x00, 0x52, 0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x6F, 0x00, 0x20,
-	0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x20, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61,
-	0x00, 0x64, 0x00, 0x65, 0x00, 0x6D, 0x00, 0x61, 0x00, 0x72, 0x00, 0x6B, 0x00, 0x20, 0x00, 0x6F,
-	0x00, 0x66, 0x00, 0x20, 0x00, 0x47, 0x00, 0x6F, 0x00, 0x6F, 0x00, 0x67, 0x00, 0x6C, 0x00, 0x65,
-	0x00, 0x2E, 0x00, 0x52, 0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x6F, 0x00, 0x2D,
-	0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x72, 0x00, 0x56,
-	0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x33,
-	0x00, 0x2E, 0x00, 0x30, 0x00, 0x30, 0x00, 0x39, 0x00, 0x3B, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30,
-	0x00, 0x32, 0x00, 0x34, 0x00, 0x52, 0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x6F,
-	0x00, 0x20, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x72,
-	0x00, 0x33, 0x00, 0x2E, 0x00, 0x30, 0x00, 0x30, 0x00, 0x39, 0x00, 0x3B, 0x00, 0x47, 0x00, 0x4F,
-	0x00, 0x4F, 0x00, 0x47, 0x00, 0x3B, 0x00, 0x52, 0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74,
-	0x00, 0x6F, 0x00, 0x2D, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6C, 0x00, 0x61,
-	0x00, 0x72, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x72,
-	0x00, 0x52, 0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x6F, 0x00, 0x43, 0x00, 0x6F,
-	0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20,
-	0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x31, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x65,
-	0x00, 0x20, 0x00, 0x52, 0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x6F, 0x00, 0x20,
-	0x00, 0x50, 0x00, 0x72, 0x00, 0x6F, 0x00, 0x6A, 0x00, 0x65, 0x00, 0x63, 0x00, 0x74, 0x00, 0x20,
-	0x00, 0x41, 0x00, 0x75, 0x00, 0x74, 0x00, 0x68, 0x00, 0x6F, 0x00, 0x72, 0x00, 0x73, 0x00, 0x20,
-	0x00, 0x28, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x73, 0x00, 0x3A, 0x00, 0x2F,
-	0x00, 0x2F, 0x00, 0x67, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x75, 0x00, 0x62, 0x00, 0x2E,
-	0x00, 0x63, 0x00, 0x6F, 0x00, 0x6D, 0x00, 0x2F, 0x00, 0x67, 0x00, 0x6F, 0x00, 0x6F, 0x00, 0x67,
-	0x00, 0x6C, 0x00, 0x65, 0x00, 0x66, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x73, 0x00, 0x2F,
-	0x00, 0x72, 0x00, 0x6F, 0x00, 0x62, 0x00, 0x6F, 0x00, 0x74, 0x00, 0x6F, 0x00, 0x2D, 0x00, 0x63,
-	0x00, 0x6C, 0x00, 0x61, 0x00, 0x73, 0x00, 0x73, 0x00, 0x69, 0x00, 0x63, 0x00, 0x29, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x32, 0x00, 0x5A, 0x00, 0x79,
-	0x00, 0xB0, 0x01, 0x25, 0x01, 0xA6, 0x02, 0x1A, 0x02, 0x2E, 0x02, 0x5E, 0x02, 0x8E, 0x02, 0xBB,
-	0x02, 0xD8, 0x02, 0xF2, 0x03, 0x03, 0x03, 0x1E, 0x03, 0x32, 0x03, 0x7F, 0x03, 0x98, 0x03, 0xD7,
-	0x04, 0x3E, 0x04, 0x69, 0x04, 0xB6, 0x05, 0x10, 0x05, 0x2D, 0x05, 0x9C, 0x05, 0xF5, 0x06, 0x01,
-	0x06, 0x0D, 0x06, 0x33, 0x06, 0x4E, 0x06, 0x74, 0x06, 0xC5, 0x07, 0x6D, 0x07, 0xA4, 0x08, 0x04,
-	0x08, 0x48, 0x08, 0x86, 0x08, 0xB6, 0x08, 0xDF, 0x09, 0x2E, 0x09, 0x56, 0x09, 0x6A, 0x09, 0x95,
-	0x09, 0xC8, 0x09, 0xE6, 0x0A, 0x19, 0x0A, 0x3C, 0x0A, 0x88, 0x0A, 0xBB, 0x0B, 0x14, 0x0B, 0x59,
-	0x0B, 0xB8, 0x0B, 0xD6, 0x0C, 0x04, 0x0C, 0x2B, 0x0C, 0x6D, 0x0C, 0x9A, 0x0C, 0xBE, 0x0C, 0xEB,
-	0x0D, 0x04, 0x0D, 0x18, 0x0D, 0x31, 0x0D, 0x56, 0x0D, 0x66, 0x0D, 0x7A, 0x0D, 0xE2, 0x0E, 0x35,
-	0x0E, 0x7B, 0x0E, 0xCE, 0x0F, 0x1B, 0x0F, 0x4A, 0x0F, 0xB2, 0x0F, 0xEA, 0x10, 0x10, 0x10, 0x49,
-	0x10, 0x7C, 0x10, 0x90, 0x10, 0xEC, 0x11, 0x26, 0x11, 0x6C, 0x11, 0xC0, 0x12, 0x14, 0x12, 0x48,
-	0x12, 0x9F, 0x12, 0xCF, 0x13, 0x06, 0x13, 0x2C, 0x13, 0x70, 0x13, 0x9C, 0x13, 0xD8, 0x14, 0x04,
-	0x14, 0x4A, 0x14, 0x5C, 0x14, 0xA3, 0x14, 0xE2, 0x15, 0x06, 0x15, 0x60, 0x15, 0xAB, 0x16, 0x0C,
-	0x16, 0x53, 0x16, 0x6D, 0x16, 0xFF, 0x17, 0x2C, 0x17, 0xA4, 0x17, 0xFA, 0x18, 0x06, 0x18, 0x23,
-	0x18, 0xBC, 0x18, 0xCD, 0x19, 0x00, 0x19, 0x25, 0x19, 0x5C, 0x19, 0xBA, 0x19, 0xCE, 0x1A, 0x0E,
-	0x1A, 0x2D, 0x1A, 0x47, 0x1A, 0x70, 0x1A, 0x87, 0x1A, 0xC5, 0x1A, 0xD1, 0x1A, 0xE2, 0x1A, 0xF3,
-	0x1B, 0x04, 0x1B, 0x54, 0x1B, 0xA1, 0x1B, 0xBF, 0x1C, 0x18, 0x1C, 0x51, 0x1C, 0xAE, 0x1D, 0x4C,
-	0x1D, 0xAD, 0x1D, 0xE4, 0x1E, 0x38, 0x1E, 0x8D, 0x1E, 0xE9, 0x1F, 0x1A, 0x1F, 0x2E, 0x1F, 0x60,
-	0x1F, 0x89, 0x1F, 0xA8, 0x1F, 0xE4, 0x20, 0x31, 0x20, 0x9C, 0x21, 0x25, 0x21, 0x4B, 0x21, 0x99,
-	0x21, 0xE8, 0x22, 0x49, 0x22, 0xA0, 0x22, 0xDF, 0x23, 0x29, 0x23, 0x4F, 0x23, 0x99, 0x23, 0xB8,
-	0x23, 0xD6, 0x23, 0xDE, 0x24, 0x00, 0x24, 0x1B, 0x24, 0x4B, 0x24, 0x76, 0x24, 0xB2, 0x24, 0xD0,
-	0x24, 0xFC, 0x25, 0x10, 0x25, 0x24, 0x25, 0x2D, 0x25, 0x58, 0x25, 0x75, 0x25, 0x8F, 0x25, 0xA2,
-	0x25, 0xDD, 0x25, 0xE5, 0x25, 0xFC, 0x26, 0x2B, 0x26, 0x83, 0x26, 0xAA, 0x26, 0xD1, 0x26, 0xEE,
-	0x27, 0x22, 0x27, 0x75, 0x27, 0xB2, 0x28, 0x11, 0x28, 0x7B, 0x28, 0xDD, 0x29, 0x0B, 0x29, 0x75,
-	0x29, 0xDB, 0x2A, 0x2C, 0x2A, 0x66, 0x2A, 0xC1, 0x2A, 0xE7, 0x2B, 0x3A, 0x2B, 0xAA, 0x2B, 0xE3,
-	0x2C, 0x31, 0x2C, 0x7B, 0x2C, 0xCE, 0x2C, 0xFE, 0x2D, 0x36, 0x2D, 0x87, 0x2D, 0xC7, 0x2E, 0x2E,
-	0x2E, 0x8D, 0x2E, 0xE3, 0x2F, 0x54, 0x2F, 0x9D, 0x2F, 0xED, 0x30, 0x49, 0x30, 0x91, 0x30, 0xD0,
-	0x30, 0xF4, 0x31, 0x37, 0x31, 0x89, 0x31, 0xD5, 0x32, 0x3C, 0x32, 0x5F, 0x32, 0x97, 0x32, 0xD4,
-	0x33, 0x25, 0x33, 0x4E, 0x33, 0x84, 0x33, 0xA9, 0x33, 0xDA, 0x34, 0x17, 0x34, 0x56, 0x34, 0x8B,
-	0x34, 0xDB, 0x35, 0x3D, 0x35, 0x7C, 0x35, 0xEA, 0x36, 0x4E, 0x36, 0x65, 0x36, 0xAA, 0x36, 0xF9,
-	0x37, 0x5D, 0x37, 0x80, 0x37, 0xB2, 0x37, 0xEA, 0x38, 0x19, 0x38, 0x41, 0x38, 0x67, 0x38, 0x83,
-	0x39, 0x17, 0x39, 0x3F, 0x39, 0x73, 0x39, 0x98, 0x39, 0xC9, 0x3A, 0x07, 0x3A, 0x46, 0x3A, 0x7B,
-	0x3A, 0xC9, 0x3B, 0x27, 0x3B, 0x67, 0x3B, 0xC2, 0x3C, 0x10, 0x3C, 0x6B, 0x3C, 0xB4, 0x3C, 0xF4,
-	0x3D, 0x19, 0x3D, 0x6E, 0x3D, 0xC4, 0x3E, 0x03, 0x3E, 0x5C, 0x3E, 0xB6, 0x3E, 0xF1, 0x3F, 0x2A,
-	0x3F, 0x7C, 0x3F, 0xCB, 0x40, 0x2E, 0x40, 0x8E, 0x41, 0x04, 0x41, 0x7A, 0x41, 0xF7, 0x42, 0x72,
-	0x42, 0xD8, 0x43, 0x2A, 0x43, 0x60, 0x43, 0x98, 0x43, 0xFD, 0x44, 0x5C, 0x45, 0x00, 0x45, 0xA3,
-	0x46, 0x0B, 0x46, 0x74, 0x46, 0xB7, 0x46, 0xF8, 0x47, 0x28, 0x47, 0x46, 0x47, 0x71, 0x47, 0x86,
-	0x47, 0x9C, 0x48, 0x34, 0x48, 0x85, 0x48, 0xA1, 0x48, 0xBD, 0x48, 0xF9, 0x49, 0x3C, 0x49, 0xA1,
-	0x49, 0xC3, 0x49, 0xE5, 0x4A, 0x20, 0x4A, 0x5B, 0x4A, 0x6E, 0x4A, 0x81, 0x4A, 0x8D, 0x4A, 0xA0,
-	0x4A, 0xDE, 0x4B, 0x1B, 0x4B, 0x56, 0x4B, 0x90, 0x4B, 0xA3, 0x4B, 0xB6, 0x4B, 0xE7, 0x4C, 0x18,
-	0x4C, 0x57, 0x4C, 0x9F, 0x4D, 0x08, 0x4D, 0x6F, 0x4D, 0x82, 0x4D, 0x95, 0x4D, 0xC7, 0x4D, 0xFA,
-	0x4E, 0x0D, 0x4E, 0x20, 0x4E, 0x64, 0x4E, 0xA6, 0x4E, 0xDC, 0x4F, 0x3C, 0x4F, 0x9A, 0x4F, 0xE3,
-	0x50, 0x2A, 0x50, 0x3D, 0x50, 0x50, 0x50, 0x87, 0x50, 0xC0, 0x50, 0xD3, 0x50, 0xE6, 0x50, 0xF9,
-	0x51, 0x0C, 0x51, 0x5B, 0x51, 0xA6, 0x51, 0xF1, 0x52, 0x00, 0x52, 0x0F, 0x52, 0x1B, 0x52, 0x27,
-	0x52, 0x59, 0x52, 0xAF, 0x53, 0x24, 0x53, 0x99, 0x54, 0x0D, 0x54, 0x79, 0x54, 0xE4, 0x55, 0x40,
-	0x55, 0x9F, 0x55, 0xEB, 0x56, 0x3A, 0x56, 0x86, 0x56, 0xD0, 0x57, 0x11, 0x57, 0x52, 0x57, 0xBA,
-	0x57, 0xC6, 0x57, 0xD2, 0x57, 0xFA, 0x57, 0xFA, 0x57, 0xFA, 0x57, 0xFA, 0x57, 0xFA, 0x57, 0xFA,
-	0x57, 0xFA, 0x57, 0xFA, 0x57, 0xFA, 0x57, 0xFA, 0x57, 0xFA, 0x57, 0xFA, 0x57, 0xFA, 0x57, 0xFA,
-	0x58, 0x02, 0x58, 0x0A, 0x58, 0x1B, 0x58, 0x2C, 0x58, 0x46, 0x58, 0x60, 0x58, 0x7B, 0x58, 0x95,
-	0x58, 0xAF, 0x58, 0xBB, 0x58, 0xC7, 0x58, 0xF3, 0x59, 0x12, 0x59, 0x3C, 0x59, 0x58, 0x59, 0x64,
-	0x59, 0x74, 0x59, 0x8E, 0x5A, 0x42, 0x5A, 0x66, 0x5A, 0x86, 0x5A, 0x9D, 0x5A, 0xA6, 0x5A, 0xAF,
-	0x5A, 0xB8, 0x5A, 0xC1, 0x5A, 0xCA, 0x5A, 0xD3, 0x5A, 0xDC, 0x5A, 0xFB, 0x5B, 0x0C, 0x5B, 0x26,
-	0x5B, 0x50, 0x5B, 0x7B, 0x5B, 0xB0, 0x5B, 0xB9, 0x5B, 0xC2, 0x5B, 0xCB, 0x5B, 0xD4, 0x5B, 0xDD,
-	0x5B, 0xE6, 0x5B, 0xEF, 0x5B, 0xF8, 0x5C, 0x01, 0x5C, 0x0A, 0x5C, 0x13, 0x5C, 0x1C, 0x5C, 0x25,
-	0x5C, 0x4C, 0x5C, 0x73, 0x5C, 0xC5, 0x5C, 0xFC, 0x5D, 0x54, 0x5D, 0x60, 0x5D, 0xB8, 0x5D, 0xFE,
-	0x5E, 0x50, 0x5E, 0x9A, 0x5E, 0xEA, 0x5F, 0x29, 0x5F, 0x65, 0x5F, 0xA0, 0x60, 0x1E, 0x60, 0x68,
-	0x60, 0xC9, 0x61, 0x02, 0x61, 0x4A, 0x61, 0x60, 0x61, 0x71, 0x61, 0x87, 0x61, 0x9D, 0x62, 0x02,
-	0x62, 0x1C, 0x62, 0x4F, 0x62, 0x60, 0x62, 0x8B, 0x63, 0x19, 0x63, 0x53, 0x63, 0xB2, 0x63, 0xDF,
-	0x64, 0x11, 0x64, 0x43, 0x64, 0x77, 0x64, 0x84, 0x64, 0xA0, 0x64, 0xBA, 0x64, 0xC6, 0x64, 0xFD,
-	0x65, 0x39, 0x65, 0x95, 0x65, 0xF8, 0x66, 0x53, 0x66, 0xFA, 0x66, 0xFA, 0x67, 0xF0, 0x68, 0x36,
-	0x68, 0x6B, 0x68, 0x8F, 0x68, 0xCC, 0x69, 0x1E, 0x69, 0x8F, 0x69, 0xA9, 0x69, 0xF9, 0x6A, 0x3D,
-	0x6A, 0x65, 0x6A, 0xC7, 0x6B, 0x01, 0x6B, 0x19, 0x6B, 0x5F, 0x6B, 0x8B, 0x6B, 0xBC, 0x6B, 0xE7,
-	0x6C, 0x29, 0x6C, 0x4D, 0x6C, 0x79, 0x6C, 0x95, 0x6C, 0xF1, 0x6D, 0x31, 0x6D, 0x86, 0x6D, 0xB8,
-	0x6D, 0xFE, 0x6E, 0x1E, 0x6E, 0x4E, 0x6E, 0x69, 0x6E, 0x99, 0x6E, 0xC1, 0x6E, 0xD3, 0x6E, 0xFA,
-	0x6F, 0x42, 0x6F, 0x6B, 0x6F, 0xDD, 0x70, 0x2A, 0x70, 0x67, 0x70, 0x82, 0x70, 0xB2, 0x71, 0x02,
-	0x71, 0x25, 0x71, 0x4B, 0x71, 0x6E, 0x71, 0xA4, 0x71, 0xF0, 0x72, 0x2F, 0x72, 0x8E, 0x72, 0xD5,
-	0x73, 0x21, 0x73, 0x77, 0x73, 0xBB, 0x73, 0xF7, 0x74, 0x26, 0x74, 0x61, 0x74, 0xA8, 0x74, 0xF9,
-	0x75, 0x5D, 0x75, 0x88, 0x75, 0xBA, 0x75, 0xF2, 0x76, 0x2C, 0x76, 0x5D, 0x76, 0x8F, 0x76, 0xBD,
-	0x76, 0xFA, 0x77, 0x32, 0x77, 0x3E, 0x77, 0x6E, 0x77, 0xBB, 0x78, 0x16, 0x78, 0x5E, 0x78, 0x86,
-	0x78, 0xE1, 0x79, 0x1E, 0x79, 0x5C, 0x79, 0x95, 0x79, 0xFC, 0x7A, 0x08, 0x7A, 0x40, 0x7A, 0x79,
-	0x7A, 0xB8, 0x7A, 0xE9, 0x7B, 0x3F, 0x7B, 0x88, 0x7B, 0xD2, 0x7C, 0x30, 0x7C, 0x88, 0x7C, 0xD9,
-	0x7D, 0x3C, 0x7D, 0x78, 0x7D, 0xCC, 0x7D, 0xF4, 0x7E, 0x31, 0x7E, 0x7C, 0x7E, 0x95, 0x7E, 0xFB,
-	0x7F, 0x46, 0x7F, 0x57, 0x7F, 0x90, 0x7F, 0xBF, 0x80, 0x5E, 0x80, 0xB8, 0x81, 0x0E, 0x81, 0x41,
-	0x81, 0x73, 0x81, 0xA3, 0x81, 0xD6, 0x82, 0x11, 0x82, 0x53, 0x82, 0xB2, 0x82, 0xE2, 0x82, 0xFD,
-	0x83, 0x28, 0x83, 0x64, 0x83, 0x89, 0x83, 0xB0, 0x83, 0xEE, 0x84, 0x33, 0x84, 0x5C, 0x84, 0x87,
-	0x84, 0xD4, 0x84, 0xDD, 0x84, 0xE6, 0x84, 0xEF, 0x84, 0xF8, 0x85, 0x01, 0x85, 0x0A, 0x85, 0x13,
-	0x85, 0x5A, 0x85, 0xAA, 0x85, 0xE7, 0x86, 0x33, 0x86, 0x8E, 0x86, 0xAB, 0x86, 0xEA, 0x87, 0x2A,
-	0x87, 0x51, 0x87, 0x9A, 0x87, 0xB5, 0x88, 0x05, 0x88, 0x16, 0x88, 0x86, 0x88, 0xE2, 0x89, 0x05,
-	0x89, 0x0D, 0x89, 0x15, 0x89, 0x1D, 0x89, 0x25, 0x89, 0x2D, 0x89, 0x35, 0x89, 0x3D, 0x89, 0x45,
-	0x89, 0x4D, 0x89, 0x55, 0x89, 0x5D, 0x89, 0x65, 0x89, 0x6D, 0x89, 0x7F, 0x89, 0x87, 0x89, 0xE7,
-	0x8A, 0x2C, 0x8A, 0x49, 0x8A, 0x9C, 0x8A, 0xE2, 0x8B, 0x35, 0x8B, 0x9D, 0x8B, 0xE3, 0x8C, 0x37,
-	0x8C, 0x8B, 0x8C, 0xD4, 0x8D, 0x3B, 0x8D, 0x88, 0x8D, 0x90, 0x8D, 0xFC, 0x8E, 0x26, 0x8E, 0x73,
-	0x8E, 0xA6, 0x8E, 0xFB, 0x8F, 0x2A, 0x8F, 0x69, 0x8F, 0x69, 0x8F, 0x71, 0x8F, 0xBA, 0x90, 0x03,
-	0x90, 0x43, 0x90, 0x68, 0x90, 0xA4, 0x90, 0xB7, 0x90, 0xCA, 0x90, 0xDD, 0x90, 0xF0, 0x91, 0x04,
-	0x91, 0x18, 0x91, 0x2E, 0x91, 0x41, 0x91, 0x54, 0x91, 0x67, 0x91, 0x7A, 0x91, 0x8E, 0x91, 0xA1,
-	0x91, 0xB4, 0x91, 0xC7, 0x91, 0xDB, 0x91, 0xEE, 0x92, 0x01, 0x92, 0x14, 0x92, 0x27, 0x92, 0x3A,
-	0x92, 0x4E, 0x92, 0x61, 0x92, 0x74, 0x92, 0x87, 0x92, 0x9B, 0x92, 0xAE, 0x92, 0xC1, 0x92, 0xD4,
-	0x92, 0xE6, 0x92, 0xF8, 0x93, 0x0C, 0x93, 0x20, 0x93, 0x36, 0x93, 0x49, 0x93, 0x5C, 0x93, 0x6F,
-	0x93, 0x81, 0x93, 0x95, 0x93, 0xA7, 0x93, 0xB9, 0x93, 0xCC, 0x93, 0xE0, 0x93, 0xF2, 0x94, 0x05,
-	0x94, 0x18, 0x94, 0x2A, 0x94, 0x3C, 0x94, 0x50, 0x94, 0x63, 0x94, 0x76, 0x94, 0x88, 0x94, 0x9C,
-	0x94, 0xAF, 0x94, 0xC2, 0x94, 0xD5, 0x94, 0xE7, 0x94, 0xFA, 0x95, 0x0D, 0x95, 0x63, 0x95, 0xEB,
-	0x95, 0xFE, 0x96, 0x11, 0x96, 0x24, 0x96, 0x36, 0x96, 0x49, 0x96, 0x5C, 0x96, 0x6F, 0x96, 0x81,
-	0x96, 0x94, 0x96, 0xA7, 0x96, 0xBA, 0x96, 0xCC, 0x96, 0xDF, 0x96, 0xF2, 0x97, 0x05, 0x97, 0x18,
-	0x97, 0x6D, 0x97, 0xDB, 0x97, 0xEE, 0x98, 0x00, 0x98, 0x13, 0x98, 0x25, 0x98, 0x38, 0x98, 0x4A,
-	0x98, 0x5D, 0x98, 0x70, 0x98, 0x84, 0x98, 0x97, 0x98, 0xAA, 0x98, 0xBD, 0x98, 0xD0, 0x98, 0xE3,
-	0x98, 0xF6, 0x99, 0x09, 0x99, 0x1C, 0x99, 0x2F, 0x99, 0x41, 0x99, 0x53, 0x99, 0x66, 0x99, 0x72,
-	0x99, 0x7E, 0x99, 0x91, 0x99, 0xA4, 0x99, 0xB8, 0x99, 0xCC, 0x99, 0xDF, 0x99, 0xF2, 0x9A, 0x06,
-	0x9A, 0x1A, 0x9A, 0x2D, 0x9A, 0x40, 0x9A, 0x4C, 0x9A, 0x58, 0x9A, 0x6B, 0x9A, 0x7E, 0x9A, 0x92,
-	0x9A, 0xA6, 0x9A, 0xB9, 0x9A, 0xCB, 0x9A, 0xDE, 0x9A, 0xF1, 0x9B, 0x03, 0x9B, 0x16, 0x9B, 0x29,
-	0x9B, 0x3D, 0x9B, 0x51, 0x9B, 0x64, 0x9B, 0x77, 0x9B, 0x8B, 0x9B, 0x9F, 0x9B, 0xB2, 0x9B, 0xC4,
-	0x9B, 0xD7, 0x9B, 0xEA, 0x9B, 0xFD, 0x9C, 0x0F, 0x9C, 0x22, 0x9C, 0x35, 0x9C, 0x49, 0x9C, 0x5D,
-	0x9C, 0x70, 0x9C, 0x82, 0x9C, 0x96, 0x9C, 0xAA, 0x9C, 0xBD, 0x9C, 0xD0, 0x9C, 0xE3, 0x9C, 0xF7,
-	0x9D, 0x0A, 0x9D, 0x1C, 0x9D, 0x2F, 0x9D, 0x41, 0x9D, 0x54, 0x9D, 0x67, 0x9D, 0x7B, 0x9D, 0x8F,
-	0x9D, 0xA3, 0x9D, 0xB7, 0x9E, 0x07, 0x9E, 0x62, 0x9E, 0x75, 0x9E, 0x88, 0x9E, 0x9B, 0x9E, 0xAD,
-	0x9E, 0xC1, 0x9E, 0xD4, 0x9E, 0xE7, 0x9E, 0xFA, 0x9F, 0x0D, 0x9F, 0x20, 0x9F, 0x32, 0x9F, 0x45,
-	0x9F, 0x58, 0x9F, 0x6B, 0x9F, 0x7E, 0x9F, 0x8A, 0x9F, 0x96, 0x9F, 0xA1, 0x9F, 0xB4, 0x9F, 0xC7,
-	0x9F, 0xD9, 0x9F, 0xEB, 0x9F, 0xFF, 0xA0, 0x13, 0xA0, 0x1F, 0xA0, 0x2B, 0xA0, 0x3E, 0xA0, 0x51,
-	0xA0, 0x63, 0xA0, 0x76, 0xA0, 0x88, 0xA0, 0x9A, 0xA0, 0xAD, 0xA0, 0xC1, 0xA0, 0xD4, 0xA0, 0xE7,
-	0xA0, 0xFA, 0xA1, 0x0D, 0xA1, 0x20, 0xA1, 0x34, 0xA1, 0x47, 0xA1, 0x5A, 0xA1, 0x6C, 0xA1, 0x80,
-	0xA1, 0x93, 0xA1, 0xA5, 0xA1, 0xB8, 0xA2, 0x09, 0xA2, 0x1C, 0xA2, 0x2E, 0xA2, 0x41, 0xA2, 0x54,
-	0xA2, 0x66, 0xA2, 0x78, 0xA2, 0x8A, 0xA2, 0x9D, 0xA2, 0xEF, 0xA3, 0x01, 0xA3, 0x13, 0xA3, 0x26,
-	0xA3, 0x39, 0xA3, 0x4D, 0xA3, 0x60, 0xA3, 0x73, 0xA3, 0x86, 0xA3, 0x99, 0xA3, 0xA4, 0xA3, 0xB6,
-	0xA3, 0xC9, 0xA3, 0xD5, 0xA3, 0xE7, 0xA3, 0xFB, 0xA4, 0x07, 0xA4, 0x13, 0xA4, 0x26, 0xA4, 0x32,
-	0xA4, 0x45, 0xA4, 0x58, 0xA4, 0x6B, 0xA4, 0x7F, 0xA4, 0x92, 0xA4, 0x9E, 0xA4, 0xB0, 0xA4, 0xC3,
-	0xA4, 0xD5, 0xA4, 0xE1, 0xA4, 0xF3, 0xA5, 0x07, 0xA5, 0x19, 0xA5, 0x25, 0xA5, 0x37, 0xA5, 0x49,
-	0xA5, 0x5C, 0xA5, 0x70, 0xA5, 0x84, 0xA5, 0xD3, 0xA5, 0xE6, 0xA5, 0xF8, 0xA6, 0x0B, 0xA6, 0x1E,
-	0xA6, 0x31, 0xA6, 0x43, 0xA6, 0x56, 0xA6, 0x6A, 0xA6, 0x76, 0xA6, 0x8A, 0xA6, 0x9E, 0xA6, 0xB1,
-	0xA6, 0xC5, 0xA6, 0xDA, 0xA6, 0xE2, 0xA6, 0xEA, 0xA6, 0xF2, 0xA6, 0xFA, 0xA7, 0x02, 0xA7, 0x0A,
-	0xA7, 0x12, 0xA7, 0x1A, 0xA7, 0x22, 0xA7, 0x2A, 0xA7, 0x32, 0xA7, 0x3A, 0xA7, 0x42, 0xA7, 0x4A,
-	0xA7, 0x5E, 0xA7, 0x72, 0xA7, 0x85, 0xA7, 0x98, 0xA7, 0xAB, 0xA7, 0xBD, 0xA7, 0xD1, 0xA7, 0xD9,
-	0xA7, 0xE1, 0xA7, 0xE9, 0xA7, 0xF1, 0xA7, 0xF9, 0xA8, 0x0D, 0xA8, 0x20, 0xA8, 0x33, 0xA8, 0x46,
-	0xA8, 0x59, 0xA8, 0x6D, 0xA8, 0x80, 0xA8, 0xDD, 0xA8, 0xE5, 0xA8, 0xF9, 0xA9, 0x01, 0xA9, 0x09,
-	0xA9, 0x1C, 0xA9, 0x2F, 0xA9, 0x37, 0xA9, 0x3F, 0xA9, 0x47, 0xA9, 0x4F, 0xA9, 0x62, 0xA9, 0x6A,
-	0xA9, 0x72, 0xA9, 0x7A, 0xA9, 0x82, 0xA9, 0x8A, 0xA9, 0x92, 0xA9, 0x9A, 0xA9, 0xA2, 0xA9, 0xAA,
-	0xA9, 0xB2, 0xA9, 0xC5, 0xA9, 0xCD, 0xA9, 0xD5, 0xAA, 0x18, 0xAA, 0x20, 0xAA, 0x28, 0xAA, 0x3C,
-	0xAA, 0x4F, 0xAA, 0x57, 0xAA, 0x5F, 0xAA, 0x73, 0xAA, 0x7B, 0xAA, 0x8E, 0xAA, 0xA0, 0xAA, 0xB3,
-	0xAA, 0xC6, 0xAA, 0xD9, 0xAA, 0xEC, 0xAB, 0x00, 0xAB, 0x14, 0xAB, 0x27, 0xAB, 0x3A, 0xAB, 0x42,
-	0xAB, 0x4A, 0xAB, 0x56, 0xAB, 0x69, 0xAB, 0x71, 0xAB, 0x84, 0xAB, 0x97, 0xAB, 0xAC, 0xAB, 0xC1,
-	0xAB, 0xD4, 0xAB, 0xE7, 0xAB, 0xFA, 0xAC, 0x0D, 0xAC, 0x15, 0xAC, 0x1D, 0xAC, 0x31, 0xAC, 0x45,
-	0xAC, 0x51, 0xAC, 0x5D, 0xAC, 0x70, 0xAC, 0x83, 0xAC, 0x96, 0xAC, 0xA9, 0xAC, 0xB1, 0xAC, 0xB9,
-	0xAC, 0xC1, 0xAC, 0xD4, 0xAC, 0xE7, 0xAC, 0xEF, 0xAD, 0x02, 0xAD, 0x15, 0xAD, 0x29, 0xAD, 0x3D,
-	0xAD, 0x45, 0xAD, 0x4D, 0xAD, 0x60, 0xAD, 0x73, 0xAD, 0x87, 0xAD, 0x8F, 0xAD, 0xA3, 0xAD, 0xB7,
-	0xAD, 0xCB, 0xAD, 0xDF, 0xAD, 0xF2, 0xAE, 0x05, 0xAE, 0x17, 0xAE, 0x2B, 0xAE, 0x3F, 0xAE, 0x53,
-	0xAE, 0x67, 0xAE, 0x6F, 0xAE, 0x77, 0xAE, 0x8B, 0xAE, 0x9F, 0xAE, 0xB3, 0xAE, 0xC6, 0xAE, 0xD9,
-	0xAE, 0xEB, 0xAE, 0xFF, 0xAF, 0x12, 0xAF, 0x26, 0xAF, 0x3A, 0xAF, 0x4E, 0xAF, 0x61, 0xAF, 0x75,
-	0xAF, 0x89, 0xAF, 0x91, 0xAF, 0xA5, 0xAF, 0xB9, 0xAF, 0xCC, 0xAF, 0xDF, 0xAF, 0xF3, 0xB0, 0x06,
-	0xB0, 0x1A, 0xB0, 0x2D, 0xB0, 0x41, 0xB0, 0x54, 0xB0, 0x68, 0xB0, 0x7B, 0xB0, 0x98, 0xB0, 0xB4,
-	0xB0, 0xC8, 0xB0, 0xDC, 0xB0, 0xF0, 0xB1, 0x04, 0xB1, 0x18, 0xB1, 0x2C, 0xB1, 0x40, 0xB1, 0x54,
-	0xB1, 0x71, 0xB1, 0x8E, 0xB1, 0xA2, 0xB1, 0xB6, 0xB1, 0xC9, 0xB1, 0xDC, 0xB1, 0xEF, 0xB2, 0x01,
-	0xB2, 0x15, 0xB2, 0x28, 0xB2, 0x3C, 0xB2, 0x4F, 0xB2, 0x63, 0xB2, 0x76, 0xB2, 0x8A, 0xB2, 0x9D,
-	0xB2, 0xBA, 0xB2, 0xD6, 0xB2, 0xE9, 0xB2, 0xFC, 0xB3, 0x10, 0xB3, 0x24, 0xB3, 0x38, 0xB3, 0x4C,
-	0xB3, 0x5F, 0xB3, 0x72, 0xB3, 0x86, 0xB3, 0x99, 0xB3, 0xAD, 0xB3, 0xC0, 0xB3, 0xD4, 0xB3, 0xE7,
-	0xB3, 0xFB, 0xB4, 0x0E, 0xB4, 0x2B, 0xB4, 0x47, 0xB4, 0x5A, 0xB4, 0x6D, 0xB4, 0x80, 0xB4, 0x93,
-	0xB4, 0xA6, 0xB4, 0xB9, 0xB4, 0xCC, 0xB4, 0xDE, 0xB4, 0xF2, 0xB5, 0x06, 0xB5, 0x1A, 0xB5, 0x2E,
-	0xB5, 0x41, 0xB5, 0x54, 0xB5, 0x67, 0xB5, 0x7A, 0xB5, 0x8D, 0xB5, 0xA0, 0xB5, 0xB3, 0xB5, 0xC6,
-	0xB5, 0xD9, 0xB5, 0xEB, 0xB5, 0xFF, 0xB6, 0x13, 0xB6, 0x27, 0xB6, 0x3B, 0xB6, 0x4E, 0xB6, 0x61,
-	0xB6, 0x74, 0xB6, 0x86, 0xB6, 0xA3, 0xB6, 0xB6, 0xB6, 0xC9, 0xB6, 0xDC, 0xB6, 0xEF, 0xB7, 0x02,
-	0xB7, 0x15, 0xB7, 0x28, 0xB7, 0x3B, 0xB7, 0x43, 0xB7, 0x80, 0xB7, 0xBC, 0xB7, 0xDE, 0xB8, 0x00,
-	0xB8, 0x40, 0xB8, 0x81, 0xB8, 0xAF, 0xB8, 0xE3, 0xB9, 0x19, 0xB9, 0x4E, 0xB9, 0x56, 0xB9, 0x6A,
-	0xB9, 0x72, 0xB9, 0x7A, 0xB9, 0x82, 0xB9, 0x8A, 0xB9, 0x92, 0xB9, 0x9A, 0xB9, 0xA2, 0xB9, 0xAA,
-	0xB9, 0xB2, 0xB9, 0xC5, 0xB9, 0xD8, 0xB9, 0xEB, 0xB9, 0xFE, 0xBA, 0x12, 0xBA, 0x26, 0xBA, 0x3A,
-	0xBA, 0x4E, 0xBA, 0x62, 0xBA, 0x76, 0xBA, 0x8A, 0xBA, 0x9E, 0xBA, 0xB2, 0xBA, 0xC6, 0xBA, 0xDA,
-	0xBA, 0xEE, 0xBA, 0xFA, 0xBB, 0x0E, 0xBB, 0x22, 0xBB, 0x36, 0xBB, 0x4A, 0xBB, 0x5E, 0xBB, 0x72,
-	0xBB, 0x86, 0xBB, 0x9A, 0xBB, 0xAD, 0xBB, 0xC0, 0xBB, 0xD4, 0xBB, 0xE8, 0xBB, 0xFC, 0xBC, 0x10,
-	0xBC, 0x24, 0xBC, 0x38, 0xBC, 0x4C, 0xBC, 0x60, 0xBC, 0x74, 0xBC, 0x87, 0xBC, 0x9A, 0xBC, 0xAE,
-	0xBC, 0xC2, 0xBC, 0xD6, 0xBC, 0xEA, 0xBC, 0xFE, 0xBD, 0x12, 0xBD, 0x26, 0xBD, 0x39, 0xBD, 0x4B,
-	0xBD, 0x5F, 0xBD, 0x73, 0xBD, 0x87, 0xBD, 0x9B, 0xBD, 0xAF, 0xBD, 0xC3, 0xBD, 0xD7, 0xBD, 0xE3,
-	0xBD, 0xEF, 0xBD, 0xFB, 0xBE, 0x07, 0xBE, 0x13, 0xBE, 0x1F, 0xBE, 0x2B, 0xBE, 0x33, 0xBE, 0x3B,
-	0xBE, 0x43, 0xBE, 0x4B, 0xBE, 0x53, 0xBE, 0x5B, 0xBE, 0x63, 0xBE, 0x6B, 0xBE, 0x73, 0xBE, 0x7B,
-	0xBE, 0x83, 0xBE, 0x8B, 0xBE, 0x93, 0xBE, 0x9B, 0xBE, 0xAF, 0xBE, 0xC2, 0xBE, 0xD5, 0xBE, 0xE8,
-	0xBE, 0xF0, 0xBE, 0xF8, 0xBF, 0x0C, 0xBF, 0x14, 0xBF, 0x27, 0xBF, 0x39, 0xBF, 0x41, 0xBF, 0x49,
-	0xBF, 0x51, 0xBF, 0x59, 0xBF, 0x6C, 0xBF, 0x74, 0xBF, 0x7C, 0xBF, 0x84, 0xBF, 0x8C, 0xBF, 0x94,
-	0xBF, 0x9C, 0xBF, 0xA4, 0xBF, 0xAC, 0xC0, 0x1C, 0xC0, 0x4D, 0xC0, 0x99, 0xC0, 0xA1, 0xC0, 0xAD,
-	0xC0, 0xC0, 0xC0, 0xD2, 0xC0, 0xDA, 0xC0, 0xE6, 0xC0, 0xF9, 0xC1, 0x0C, 0xC1, 0x18, 0xC1, 0x2B,
-	0xC1, 0x3E, 0xC1, 0x52, 0xC1, 0x5E, 0xC1, 0x71, 0xC1, 0x84, 0xC1, 0x97, 0xC1, 0xAA, 0xC1, 0xB6,
-	0xC1, 0xC2, 0xC1, 0xD6, 0x40, 0x4A, 0x99, 0x98, 0x97, 0x96, 0x87, 0x86, 0x85, 0x84, 0x83, 0x82,
-	0x81, 0x80, 0x7F, 0x7E, 0x7D, 0x7C, 0x7B, 0x7A, 0x79, 0x78, 0x77, 0x76, 0x75, 0x74, 0x73, 0x72,
-	0x71, 0x70, 0x6F, 0x6E, 0x6D, 0x6C, 0x6B, 0x6A, 0x69, 0x68, 0x67, 0x66, 0x65, 0x64, 0x63, 0x62,
-	0x61, 0x60, 0x5F, 0x5E, 0x5D, 0x5C, 0x5B, 0x5A, 0x59, 0x58, 0x57, 0x56, 0x55, 0x54, 0x53, 0x51,
-	0x50, 0x4F, 0x4E, 0x4D, 0x4C, 0x4B, 0x4A, 0x49, 0x48, 0x47, 0x46, 0x28, 0x1F, 0x10, 0x0A, 0x09,
-	0x2C, 0x01, 0xB1, 0x0B, 0x0A, 0x43, 0x23, 0x43, 0x65, 0x0A, 0x2D, 0x2C, 0x00, 0xB1, 0x0A, 0x0B,
-	0x43, 0x23, 0x43, 0x0B, 0x2D, 0x2C, 0x01, 0xB0, 0x06, 0x43, 0xB0, 0x07, 0x43, 0x65, 0x0A, 0x2D,
-	0x2C, 0xB0, 0x4F, 0x2B, 0x20, 0xB0, 0x40, 0x51, 0x58, 0x21, 0x4B, 0x52, 0x58, 0x45, 0x44, 0x1B,
-	0x21, 0x21, 0x59, 0x1B, 0x23, 0x21, 0xB0, 0x40, 0xB0, 0x04, 0x25, 0x45, 0xB0, 0x04, 0x25, 0x45,
-	0x61, 0x64, 0x8A, 0x63, 0x52, 0x58, 0x45, 0x44, 0x1B, 0x21, 0x21, 0x59, 0x59, 0x2D, 0x2C, 0x00,
-	0xB0, 0x07, 0x43, 0xB0, 0x06, 0x43, 0x0B, 0x2D, 0x2C, 0x4B, 0x53, 0x23, 0x4B, 0x51, 0x5A, 0x58,
-	0x20, 0x45, 0x8A, 0x60, 0x44, 0x1B, 0x21, 0x21, 0x59, 0x2D, 0x2C, 0x4B, 0x54, 0x58, 0x20, 0x45,
-	0x8A, 0x60, 0x44, 0x1B, 0x21, 0x21, 0x59, 0x2D, 0x2C, 0x4B, 0x53, 0x23, 0x4B, 0x51, 0x5A, 0x58,
-	0x38, 0x1B, 0x21, 0x21, 0x59, 0x2D, 0x2C, 0x4B, 0x54, 0x58, 0x38, 0x1B, 0x21, 0x21, 0x59, 0x2D,
-	0x2C, 0xB0, 0x02, 0x43, 0x54, 0x58, 0xB0, 0x46, 0x2B, 0x1B, 0x21, 0x21, 0x21, 0x21, 0x59, 0x2D,
-	0x2C, 0xB0, 0x02, 0x43, 0x54, 0x58, 0xB0, 0x47, 0x2B, 0x1B, 0x21, 0x21, 0x21, 0x59, 0x2D, 0x2C,
-	0xB0, 0x02, 0x43, 0x54, 0x58, 0xB0, 0x48, 0x2B, 0x1B, 0x21, 0x21, 0x21, 0x21, 0x59, 0x2D, 0x2C,
-	0xB0, 0x02, 0x43, 0x54, 0x58, 0xB0, 0x49, 0x2B, 0x1B, 0x21, 0x21, 0x21, 0x59, 0x2D, 0x2C, 0x23,
-	0x20, 0xB0, 0x00, 0x50, 0x8A, 0x8A, 0x64, 0xB1, 0x00, 0x03, 0x25, 0x54, 0x58, 0xB0, 0x40, 0x1B,
-	0xB1, 0x01, 0x03, 0x25, 0x54, 0x58, 0xB0, 0x05, 0x43, 0x8B, 0x59, 0xB0, 0x4F, 0x2B, 0x59, 0x23,
-	0xB0, 0x62, 0x2B, 0x23, 0x21, 0x23, 0x58, 0x65, 0x59, 0x2D, 0x2C, 0xB1, 0x08, 0x00, 0x0C, 0x21,
-	0x54, 0x60, 0x43, 0x2D, 0x2C, 0xB1, 0x0C, 0x00, 0x0C, 0x21, 0x54, 0x60, 0x43, 0x2D, 0x2C, 0x01,
-	0x20, 0x47, 0xB0, 0x02, 0x43, 0x20, 0xB8, 0x10, 0x00, 0x62, 0xB8, 0x10, 0x00, 0x63, 0x57, 0x23,
-	0xB8, 0x01, 0x00, 0x62, 0xB8, 0x10, 0x00, 0x63, 0x57, 0x5A, 0x58, 0xB0, 0x20, 0x60, 0x66, 0x59,
-	0x48, 0x2D, 0x2C, 0xB1, 0x00, 0x02, 0x25, 0xB0, 0x02, 0x25, 0xB0, 0x02, 0x25, 0x53, 0xB8, 0x00,
-	0x35, 0x23, 0x78, 0xB0, 0x02, 0x25, 0xB0, 0x02, 0x25, 0x60, 0xB0, 0x20, 0x63, 0x20, 0x20, 0xB0,
-	0x06, 0x25, 0x23, 0x62, 0x50, 0x58, 0x8A, 0x21, 0xB0, 0x01, 0x60, 0x23, 0x1B, 0x20, 0x20, 0xB0,
-	0x06, 0x25, 0x23, 0x62, 0x52, 0x58, 0x23, 0x21, 0xB0, 0x01, 0x61, 0x1B, 0x8A, 0x21, 0x23, 0x21,
-	0x20, 0x59, 0x59, 0xB8, 0xFF, 0xC1, 0x1C, 0x60, 0xB0, 0x20, 0x63, 0x23, 0x21, 0x2D, 0x2C, 0xB1,
-	0x02, 0x00, 0x42, 0xB1, 0x23, 0x01, 0x88, 0x51, 0xB1, 0x40, 0x01, 0x88, 0x53, 0x5A, 0x58, 0xB8,
-	0x10, 0x00, 0xB0, 0x20, 0x88, 0x54, 0x58, 0xB2, 0x02, 0x01, 0x02, 0x43, 0x60, 0x42, 0x59, 0xB1,
-	0x24, 0x01, 0x88, 0x51, 0x58, 0xB8, 0x20, 0x00, 0xB0, 0x40, 0x88, 0x54, 0x58, 0xB2, 0x02, 0x02,
-	0x02, 0x43, 0x60, 0x42, 0xB1, 0x24, 0x01, 0x88, 0x54, 0x58, 0xB2, 0x02, 0x20, 0x02, 0x43, 0x60,
-	0x42, 0x00, 0x4B, 0x01, 0x4B, 0x52, 0x58, 0xB2, 0x02, 0x08, 0x02, 0x43, 0x60, 0x42, 0x59, 0x1B,
-	0xB8, 0x40, 0x00, 0xB0, 0x80, 0x88, 0x54, 0x58, 0xB2, 0x02, 0x04, 0x02, 0x43, 0x60, 0x42, 0x59,
-	0xB8, 0x40, 0x00, 0xB0, 0x80, 0x63, 0xB8, 0x01, 0x00, 0x88, 0x54, 0x58, 0xB2, 0x02, 0x08, 0x02,
-	0x43, 0x60, 0x42, 0x59, 0xB9, 0x40, 0x00, 0x01, 0x00, 0x63, 0xB8, 0x02, 0x00, 0x88, 0x54, 0x58,
-	0xB2, 0x02, 0x10, 0x02, 0x43, 0x60, 0x42, 0x59, 0xB1, 0x26, 0x01, 0x88, 0x51, 0x58, 0xB9, 0x40,
-	0x00, 0x02, 0x00, 0x63, 0xB8, 0x04, 0x00, 0x88, 0x54, 0x58, 0xB2, 0x02, 0x40, 0x02, 0x43, 0x60,
-	0x42, 0x59, 0xB9, 0x40, 0x00, 0x04, 0x00, 0x63, 0xB8, 0x08, 0x00, 0x88, 0x54, 0x58, 0xB2, 0x02,
-	0x80, 0x02, 0x43, 0x60, 0x42, 0x59, 0xB1, 0x28, 0x01, 0x88, 0x51, 0x58, 0xB9, 0x40, 0x00, 0x08,
-	0x00, 0x63, 0xB8, 0x10, 0x00, 0x88, 0x54, 0x58, 0xB9, 0x00, 0x02, 0x01, 0x00, 0xB0, 0x02, 0x43,
-	0x60, 0x42, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0xB1, 0x00, 0x02, 0x43, 0x54, 0x58, 0x40,
-	0x0A, 0x05, 0x40, 0x08, 0x40, 0x09, 0x40, 0x0C, 0x02, 0x0D, 0x02, 0x1B, 0xB1, 0x01, 0x02, 0x43,
-	0x54, 0x58, 0xB2, 0x05, 0x40, 0x08, 0xBA, 0x01, 0x00, 0x00, 0x09, 0x01, 0x00, 0xB3, 0x0C, 0x01,
-	0x0D, 0x01, 0x1B, 0xB1, 0x80, 0x02, 0x43, 0x52, 0x58, 0xB2, 0x05, 0x40, 0x08, 0xB8, 0x01, 0x80,
-	0xB1, 0x09, 0x40, 0x1B, 0xB8, 0x01, 0x00, 0xB0, 0x02, 0x43, 0x52, 0x58, 0xB2, 0x05, 0x40, 0x08,
-	0xBA, 0x01, 0x80, 0x00, 0x09, 0x01, 0x40, 0x1B, 0xB8, 0x01, 0x80, 0xB0, 0x02, 0x43, 0x52, 0x58,
-	0xB2, 0x05, 0x40, 0x08, 0xB8, 0x02, 0x00, 0xB1, 0x09, 0x40, 0x1B, 0xB2, 0x05, 0x40, 0x08, 0xBA,
-	0x01, 0x00, 0x00, 0x09, 0x01, 0x00, 0x59, 0x59, 0x59, 0xB8, 0x40, 0x00, 0xB0, 0x80, 0x88, 0x55,
-	0xB9, 0x40, 0x00, 0x02, 0x00, 0x63, 0xB8, 0x04, 0x00, 0x88, 0x55, 0x5A, 0x58, 0xB3, 0x0C, 0x00,
-	0x0D, 0x01, 0x1B, 0xB3, 0x0C, 0x00, 0x0D, 0x01, 0x59, 0x59, 0x59, 0x42, 0x42, 0x42, 0x42, 0x42,
-	0x2D, 0x2C, 0x45, 0xB1, 0x02, 0x4E, 0x2B, 0x23, 0xB0, 0x4F, 0x2B, 0x20, 0xB0, 0x40, 0x51, 0x58,
-	0x21, 0x4B, 0x51, 0x58, 0xB0, 0x02, 0x25, 0x45, 0xB1, 0x01, 0x4E, 0x2B, 0x60, 0x59, 0x1B, 0x23,
-	0x4B, 0x51, 0x58, 0xB0, 0x03, 0x25, 0x45, 0x20, 0x64, 0x8A, 0x63, 0xB0, 0x40, 0x53, 0x58, 0xB1,
-	0x02, 0x4E, 0x2B, 0x60, 0x1B, 0x21, 0x59, 0x1B, 0x21, 0x59, 0x59, 0x44, 0x2D, 0x2C, 0x20, 0xB0,
-	0x00, 0x50, 0x20, 0x58, 0x23, 0x65, 0x1B, 0x23, 0x59, 0xB1, 0x14, 0x14, 0x8A, 0x70, 0x45, 0xB0,
-	0x4F, 0x2B, 0x23, 0xB1, 0x61, 0x06, 0x26, 0x60, 0x2B, 0x8A, 0x58, 0xB0, 0x05, 0x43, 0x8B, 0x59,
-	0x23, 0x58, 0x65, 0x59, 0x23, 0x10, 0x3A, 0x2D, 0x2C, 0xB0, 0x03, 0x25, 0x49, 0x63, 0x23, 0x46,
-	0x60, 0xB0, 0x4F, 0x2B, 0x23, 0xB0, 0x04, 0x25, 0xB0, 0x04, 0x25, 0x49, 0xB0, 0x03, 0x25, 0x63,
-	0x56, 0x20, 0x60, 0xB0, 0x62, 0x60, 0x2B, 0xB0, 0x03, 0x25, 0x20, 0x10, 0x46, 0x8A, 0x46, 0x60,
-	0xB0, 0x20, 0x63, 0x61, 0x3A, 0x2D, 0x2C, 0xB0, 0x00, 0x16, 0xB1, 0x02, 0x03, 0x25, 0xB1, 0x01,
-	0x04, 0x25, 0x01, 0x3E, 0x00, 0x3E, 0xB1, 0x01, 0x02, 0x06, 0x0C, 0xB0, 0x0A, 0x23, 0x65, 0x42,
-	0xB0, 0x0B, 0x23, 0x42, 0xB1, 0x02, 0x03, 0x25, 0xB1, 0x01, 0x04, 0x25, 0x01, 0x3F, 0x00, 0x3F,
-	0xB1, 0x01, 0x02, 0x06, 0x0C, 0xB0, 0x06, 0x23, 0x65, 0x42, 0xB0, 0x07, 0x23, 0x42, 0xB0, 0x01,
-	0x16, 0xB1, 0x00, 0x02, 0x43, 0x54, 0x58, 0x45, 0x23, 0x45, 0x20, 0x18, 0x69, 0x8A, 0x63, 0x23,
-	0x62, 0x20, 0x20, 0xB0, 0x40, 0x50, 0x58, 0x67, 0x1B, 0x66, 0x59, 0x61, 0xB0, 0x20, 0x63, 0xB0,
-	0x40, 0x23, 0x61, 0xB0, 0x04, 0x23, 0x42, 0x1B, 0xB1, 0x04, 0x00, 0x42, 0x21, 0x21, 0x59, 0x18,
-	0x01, 0x2D, 0x2C, 0x20, 0x45, 0xB1, 0x00, 0x4E, 0x2B, 0x44, 0x2D, 0x2C, 0x4B, 0x51, 0xB1, 0x40,
-	0x4F, 0x2B, 0x50, 0x5B, 0x58, 0x20, 0x45, 0xB1, 0x01, 0x4E, 0x2B, 0x20, 0x8A, 0x8A, 0x44, 0x20,
-	0xB1, 0x40, 0x04, 0x26, 0x61, 0x63, 0x61, 0xB1, 0x01, 0x4E, 0x2B, 0x44, 0x21, 0x1B, 0x23, 0x21,
-	0x8A, 0x45, 0xB1, 0x01, 0x4E, 0x2B, 0x20, 0x8A, 0x23, 0x44, 0x44, 0x59, 0x2D, 0x2C, 0x4B, 0x51,
-	0xB1, 0x40, 0x4F, 0x2B, 0x50, 0x5B, 0x58, 0x45, 0x20, 0x8A, 0xB0, 0x40, 0x61, 0x63, 0x60, 0x1B,
-	0x23, 0x21, 0x45, 0x59, 0xB1, 0x01, 0x4E, 0x2B, 0x44, 0x2D, 0x2C, 0x23, 0x45, 0x20, 0x8A, 0x45,
-	0x23, 0x61, 0x20, 0x64, 0xB0, 0x40, 0x51, 0xB0, 0x04, 0x25, 0x20, 0xB0, 0x00, 0x53, 0x23, 0xB0,
-	0x40, 0x51, 0x5A, 0x5A, 0xB1, 0x40, 0x4F, 0x2B, 0x54, 0x5A, 0x58, 0x8A, 0x0C, 0x64, 0x23, 0x64,
-	0x23, 0x53, 0x58, 0xB1, 0x40, 0x40, 0x8A, 0x61, 0x20, 0x63, 0x61, 0x1B, 0x20, 0x63, 0x59, 0x1B,
-	0x8A, 0x59, 0x63, 0xB1, 0x02, 0x4E, 0x2B, 0x60, 0x44, 0x2D, 0x2C, 0x01, 0x2D, 0x2C, 0x00, 0x2D,
-	0x2C, 0x05, 0xB1, 0x0B, 0x0A, 0x43, 0x23, 0x43, 0x65, 0x0A, 0x2D, 0x2C, 0xB1, 0x0A, 0x0B, 0x43,
-	0x23, 0x43, 0x0B, 0x02, 0x2D, 0x2C, 0xB0, 0x02, 0x25, 0x63, 0x66, 0xB0, 0x02, 0x25, 0xB8, 0x20,
-	0x00, 0x62, 0x60, 0x23, 0x62, 0x2D, 0x2C, 0xB0, 0x02, 0x25, 0x63, 0xB0, 0x20, 0x60, 0x66, 0xB0,
-	0x02, 0x25, 0xB8, 0x20, 0x00, 0x62, 0x60, 0x23, 0x62, 0x2D, 0x2C, 0xB0, 0x02, 0x25, 0x63, 0x67,
-	0xB0, 0x02, 0x25, 0xB8, 0x20, 0x00, 0x62, 0x60, 0x23, 0x62, 0x2D, 0x2C, 0xB0, 0x02, 0x25, 0x63,
-	0x66, 0xB0, 0x20, 0x60, 0xB0, 0x02, 0x25, 0xB8, 0x20, 0x00, 0x62, 0x60, 0x23, 0x62, 0x2D, 0x2C,
-	0x23, 0x4A, 0xB1, 0x02, 0x4E, 0x2B, 0x2D, 0x2C, 0x23, 0x4A, 0xB1, 0x01, 0x4E, 0x2B, 0x2D, 0x2C,
-	0x23, 0x8A, 0x4A, 0x23, 0x45, 0x64, 0xB0, 0x02, 0x25, 0x64, 0xB0, 0x02, 0x25, 0x61, 0x64, 0xB0,
-	0x03, 0x43, 0x52, 0x58, 0x21, 0x20, 0x64, 0x59, 0xB1, 0x02, 0x4E, 0x2B, 0x23, 0xB0, 0x00, 0x50,
-	0x58, 0x65, 0x59, 0x2D, 0x2C, 0x23, 0x8A, 0x4A, 0x23, 0x45, 0x64, 0xB0, 0x02, 0x25, 0x64, 0xB0,
-	0x02, 0x25, 0x61, 0x64, 0xB0, 0x03, 0x43, 0x52, 0x58, 0x21, 0x20, 0x64, 0x59, 0xB1, 0x01, 0x4E,
-	0x2B, 0x23, 0xB0, 0x00, 0x50, 0x58, 0x65, 0x59, 0x2D, 0x2C, 0x20, 0xB0, 0x03, 0x25, 0x4A, 0xB1,
-	0x02, 0x4E, 0x2B, 0x8A, 0x10, 0x3B, 0x2D, 0x2C, 0x20, 0xB0, 0x03, 0x25, 0x4A, 0xB1, 0x01, 0x4E,
-	0x2B, 0x8A, 0x10, 0x3B, 0x2D, 0x2C, 0xB0, 0x03, 0x25, 0xB0, 0x03, 0x25, 0x8A, 0xB0, 0x67, 0x2B,
-	0x8A, 0x10, 0x3B, 0x2D, 0x2C, 0xB0, 0x03, 0x25, 0xB0, 0x03, 0x25, 0x8A, 0xB0, 0x68, 0x2B, 0x8A,
-	0x10, 0x3B, 0x2D, 0x2C, 0xB0, 0x03, 0x25, 0x46, 0xB0, 0x03, 0x25, 0x46, 0x60, 0xB0, 0x04, 0x25,
-	0x2E, 0xB0, 0x04, 0x25, 0xB0, 0x04, 0x25, 0xB0, 0x04, 0x26, 0x20, 0xB0, 0x00, 0x50, 0x58, 0x21,
-	0xB0, 0x6A, 0x1B, 0xB0, 0x6C, 0x59, 0x2B, 0xB0, 0x03, 0x25, 0x46, 0xB0, 0x03, 0x25, 0x46, 0x60,
-	0x61, 0xB0, 0x80, 0x62, 0x20, 0x8A, 0x20, 0x10, 0x23, 0x3A, 0x23, 0x20, 0x10, 0x23, 0x3A, 0x2D,
-	0x2C, 0xB0, 0x03, 0x25, 0x47, 0xB0, 0x03, 0x25, 0x47, 0x60, 0xB0, 0x05, 0x25, 0x47, 0xB0, 0x80,
-	0x63, 0x61, 0xB0, 0x02, 0x25, 0xB0, 0x06, 0x25, 0x49, 0x63, 0x23, 0xB0, 0x05, 0x25, 0x4A, 0xB0,
-	0x80, 0x63, 0x20, 0x58, 0x62, 0x1B, 0x21, 0x59, 0xB0, 0x04, 0x26, 0x46, 0x60, 0x8A, 0x46, 0x8A,
-	0x46, 0x60, 0xB0, 0x20, 0x63, 0x61, 0x2D, 0x2C, 0xB0, 0x04, 0x26, 0xB0, 0x04, 0x25, 0xB0, 0x04,
-	0x25, 0xB0, 0x04, 0x26, 0xB0, 0x6E, 0x2B, 0x20, 0x8A, 0x20, 0x10, 0x23, 0x3A, 0x23, 0x20, 0x10,
-	0x23, 0x3A, 0x2D, 0x2C, 0x23, 0x20, 0xB0, 0x01, 0x54, 0x58, 0x21, 0xB0, 0x02, 0x25, 0xB1, 0x02,
-	0x4E, 0x2B, 0xB0, 0x80, 0x50, 0x20, 0x60, 0x59, 0x20, 0x60, 0x60, 0x20, 0xB0, 0x01, 0x51, 0x58,
-	0x21, 0x21, 0x1B, 0x20, 0xB0, 0x05, 0x51, 0x58, 0x21, 0x20, 0x66, 0x61, 0xB0, 0x40, 0x23, 0x61,
-	0xB1, 0x00, 0x03, 0x25, 0x50, 0xB0, 0x03, 0x25, 0xB0, 0x03, 0x25, 0x50, 0x5A, 0x58, 0x20, 0xB0,
-	0x03, 0x25, 0x61, 0x8A, 0x53, 0x58, 0x21, 0xB0, 0x00, 0x59, 0x1B, 0x21, 0x59, 0x1B, 0xB0, 0x07,
-	0x54, 0x58, 0x20, 0x66, 0x61, 0x65, 0x23, 0x21, 0x1B, 0x21, 0x21, 0xB0, 0x00, 0x59, 0x59, 0x59,
-	0xB1, 0x02, 0x4E, 0x2B, 0x2D, 0x2C, 0xB0, 0x02, 0x25, 0xB0, 0x04, 0x25, 0x4A, 0xB0, 0x00, 0x53,
-	0x58, 0xB0, 0x00, 0x1B, 0x8A, 0x8A, 0x23, 0x8A, 0xB0, 0x01, 0x59, 0xB0, 0x04, 0x25, 0x46, 0x20,
-	0x66, 0x61, 0x20, 0xB0, 0x05, 0x26, 0xB0, 0x06, 0x26, 0x49, 0xB0, 0x05, 0x26, 0xB0, 0x05, 0x26,
-	0xB0, 0x70, 0x2B, 0x23, 0x61, 0x65, 0xB0, 0x20, 0x60, 0x20, 0x66, 0x61, 0xB0, 0x20, 0x61, 0x65,
-	0x2D, 0x2C, 0xB0, 0x02, 0x25, 0x46, 0x20, 0x8A, 0x20, 0xB0, 0x00, 0x50, 0x58, 0x21, 0xB1, 0x02,
-	0x4E, 0x2B, 0x1B, 0x45, 0x23, 0x21, 0x59, 0x61, 0x65, 0xB0, 0x02, 0x25, 0x10, 0x3B, 0x2D, 0x2C,
-	0xB0, 0x04, 0x26, 0x20, 0xB8, 0x02, 0x00, 0x62, 0x20, 0xB8, 0x02, 0x00, 0x63, 0x8A, 0x23, 0x61,
-	0x20, 0xB0, 0x5D, 0x60, 0x2B, 0xB0, 0x05, 0x25, 0x11, 0x8A, 0x12, 0x8A, 0x20, 0x39, 0x8A, 0x58,
-	0xB9, 0x00, 0x5D, 0x10, 0x00, 0xB0, 0x04, 0x26, 0x63, 0x56, 0x60, 0x2B, 0x23, 0x21, 0x20, 0x10,
-	0x20, 0x46, 0x20, 0xB1, 0x02, 0x4E, 0x2B, 0x23, 0x61, 0x1B, 0x23, 0x21, 0x20, 0x8A, 0x20, 0x10,
-	0x49, 0xB1, 0x02, 0x4E, 0x2B, 0x59, 0x3B, 0x2D, 0x2C, 0xB9, 0x00, 0x5D, 0x10, 0x00, 0xB0, 0x09,
-	0x25, 0x63, 0x56, 0x60, 0x2B, 0xB0, 0x05, 0x25, 0xB0, 0x05, 0x25, 0xB0, 0x05, 0x26, 0xB0, 0x6D,
-	0x2B, 0xB1, 0x5D, 0x07, 0x25, 0x60, 0x2B, 0xB0, 0x05, 0x25, 0xB0, 0x05, 0x25, 0xB0, 0x05, 0x25,
-	0xB0, 0x05, 0x25, 0xB0, 0x6F, 0x2B, 0xB9, 0x00, 0x5D, 0x10, 0x00, 0xB0, 0x08, 0x26, 0x63, 0x56,
-	0x60, 0x2B, 0x20, 0xB0, 0x00, 0x52, 0x58, 0xB0, 0x50, 0x2B, 0xB0, 0x05, 0x25, 0xB0, 0x05, 0x25,
-	0xB0, 0x07, 0x25, 0xB0, 0x07, 0x25, 0xB0, 0x05, 0x25, 0xB0, 0x71, 0x2B, 0xB0, 0x02, 0x17, 0x38,
-	0xB0, 0x00, 0x52, 0xB0, 0x02, 0x25, 0xB0, 0x01, 0x52, 0x5A, 0x58, 0xB0, 0x04, 0x25, 0xB0, 0x06,
-	0x25, 0x49, 0xB0, 0x03, 0x25, 0xB0, 0x05, 0x25, 0x49, 0x60, 0x20, 0xB0, 0x40, 0x52, 0x58, 0x21,
-	0x1B, 0xB0, 0x00, 0x52, 0x58, 0x20, 0xB0, 0x02, 0x54, 0x58, 0xB0, 0x04, 0x25, 0xB0, 0x04, 0x25,
-	0xB0, 0x07, 0x25, 0xB0, 0x07, 0x25, 0x49, 0xB0, 0x02, 0x17, 0x38, 0x1B, 0xB0, 0x04, 0x25, 0xB0,
-	0x04, 0x25, 0xB0, 0x04, 0x25, 0xB0, 0x06, 0x25, 0x49, 0xB0, 0x02, 0x17, 0x38, 0x59, 0x59, 0x59,
-	0x59, 0x59, 0x21, 0x21, 0x21, 0x21, 0x21, 0x2D, 0x2C, 0xB9, 0x00, 0x5D, 0x10, 0x00, 0xB0, 0x0B,
-	0x25, 0x63, 0x56, 0x60, 0x2B, 0xB0, 0x07, 0x25, 0xB0, 0x07, 0x25, 0xB0, 0x06, 0x25, 0xB0, 0x06,
-	0x25, 0xB0, 0x0C, 0x25, 0xB0, 0x0C, 0x25, 0xB0, 0x09, 0x25, 0xB0, 0x08, 0x25, 0xB0, 0x6E, 0x2B,
-	0xB0, 0x04, 0x17, 0x38, 0xB0, 0x07, 0x25, 0xB0, 0x07, 0x25, 0xB0, 0x07, 0x26, 0xB0, 0x6D, 0x2B,
-	0xB0, 0x04, 0x25, 0xB0, 0x04, 0x25, 0xB0, 0x04, 0x26, 0xB0, 0x6D, 0x2B, 0xB0, 0x50, 0x2B, 0xB0,
-	0x06, 0x25, 0xB0, 0x06, 0x25, 0xB0, 0x03, 0x25, 0xB0, 0x71, 0x2B, 0xB0, 0x05, 0x25, 0xB0, 0x05,
-	0x25, 0xB0, 0x03, 0x25, 0xB0, 0x02, 0x17, 0x38, 0x20, 0xB0, 0x06, 0x25, 0xB0, 0x06, 0x25, 0xB0,
-	0x05, 0x25, 0xB0, 0x71, 0x2B, 0x60, 0xB0, 0x06, 0x25, 0xB0, 0x06, 0x25, 0xB0, 0x04, 0x25, 0x65,
-	0xB0, 0x02, 0x17, 0x38, 0xB0, 0x02, 0x25, 0xB0, 0x02, 0x25, 0x60, 0x20, 0xB0, 0x40, 0x53, 0x58,
-	0x21, 0xB0, 0x40, 0x61, 0x23, 0xB0, 0x40, 0x61, 0x23, 0x1B, 0xB8, 0xFF, 0xC0, 0x50, 0x58, 0xB0,
-	0x40, 0x60, 0x23, 0xB0, 0x40, 0x60, 0x23, 0x59, 0x59, 0xB0, 0x08, 0x25, 0xB0, 0x08, 0x25, 0xB0,
-	0x04, 0x26, 0xB0, 0x02, 0x17, 0x38, 0xB0, 0x05, 0x25, 0xB0, 0x05, 0x25, 0x8A, 0xB0, 0x02, 0x17,
-	0x38, 0x20, 0xB0, 0x00, 0x52, 0x58, 0xB0, 0x06, 0x25, 0xB0, 0x08, 0x25, 0x49, 0xB0, 0x03, 0x25,
-	0xB0, 0x05, 0x25, 0x49, 0x60, 0x20, 0xB0, 0x40, 0x52, 0x58, 0x21, 0x1B, 0xB0, 0x00, 0x52, 0x58,
-	0xB0, 0x06, 0x25, 0xB0, 0x06, 0x25, 0xB0, 0x06, 0x25, 0xB0, 0x06, 0x25, 0xB0, 0x0B, 0x25, 0xB0,
-	0x0B, 0x25, 0x49, 0xB0, 0x04, 0x17, 0x38, 0xB0, 0x06, 0x25, 0xB0, 0x06, 0x25, 0xB0, 0x06, 0x25,
-	0xB0, 0x06, 0x25, 0xB0, 0x0A, 0x25, 0xB0, 0x0A, 0x25, 0xB0, 0x07, 0x25, 0xB0, 0x71, 0x2B, 0xB0,
-	0x04, 0x17, 0x38, 0xB0, 0x04, 0x25, 0xB0, 0x04, 0x25, 0xB0, 0x05, 0x25, 0xB0, 0x07, 0x25, 0xB0,
-	0x05, 0x25, 0xB0, 0x71, 0x2B, 0xB0, 0x02, 0x17, 0x38, 0x1B, 0xB0, 0x04, 0x25, 0xB0, 0x04, 0x25,
-	0xB8, 0xFF, 0xC0, 0xB0, 0x02, 0x17, 0x38, 0x59, 0x59, 0x59, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
-	0x21, 0x21, 0x2D, 0x2C, 0xB0, 0x04, 0x25, 0xB0, 0x03, 0x25, 0x87, 0xB0, 0x03, 0x25, 0xB0, 0x03,
-	0x25, 0x8A, 0x20, 0xB0, 0x00, 0x50, 0x58, 0x21, 0xB0, 0x65, 0x1B, 0xB0, 0x68, 0x59, 0x2B, 0x64,
-	0xB0, 0x04, 0x25, 0xB0, 0x04, 0x25, 0x06, 0xB0, 0x04, 0x25, 0xB0, 0x04, 0x25, 0x49, 0x20, 0x20,
-	0x63, 0xB0, 0x03, 0x25, 0x20, 0x63, 0x51, 0xB1, 0x00, 0x03, 0x25, 0x54, 0x5B, 0x58, 0x21, 0x21,
-	0x23, 0x21, 0x07, 0x1B, 0x20, 0x63, 0xB0, 0x02, 0x25, 0x20, 0x63, 0x61, 0x20, 0xB0, 0x53, 0x2B,
-	0x8A, 0x63, 0xB0, 0x05, 0x25, 0xB0, 0x05, 0x25, 0x87, 0xB0, 0x04, 0x25, 0xB0, 0x04, 0x26, 0x4A,
-	0xB0, 0x00, 0x50, 0x58, 0x65, 0x59, 0xB0, 0x04, 0x26, 0x20, 0x01, 0x46, 0x23, 0x00, 0x46, 0xB0,
-	0x05, 0x26, 0x20, 0x01, 0x46, 0x23, 0x00, 0x46, 0xB0, 0x00, 0x16, 0x00, 0xB0, 0x00, 0x23, 0x48,
-	0x01, 0xB0, 0x00, 0x23, 0x48, 0x00, 0x20, 0xB0, 0x01, 0x23, 0x48, 0xB0, 0x02, 0x23, 0x48, 0x01,
-	0x20, 0xB0, 0x01, 0x23, 0x48, 0xB0, 0x02, 0x23, 0x48, 0x23, 0xB2, 0x02, 0x00, 0x01, 0x08, 0x23,
-	0x38, 0xB2, 0x02, 0x00, 0x01, 0x09, 0x23, 0x38, 0xB1, 0x02, 0x01, 0x07, 0xB0, 0x01, 0x16, 0x59,
-	0x2D, 0x2C, 0x23, 0x10, 0x0D, 0x0C, 0x8A, 0x63, 0x23, 0x8A, 0x63, 0x60, 0x64, 0xB9, 0x40, 0x00,
-	0x04, 0x00, 0x63, 0x50, 0x58, 0xB0, 0x00, 0x38, 0x1B, 0x3C, 0x59, 0x2D, 0x2C, 0xB0, 0x06, 0x25,
-	0xB0, 0x09, 0x25, 0xB0, 0x09, 0x25, 0xB0, 0x07, 0x26, 0xB0, 0x76, 0x2B, 0x23, 0xB0, 0x00, 0x54,
-	0x58, 0x05, 0x1B, 0x04, 0x59, 0xB0, 0x04, 0x25, 0xB0, 0x06, 0x26, 0xB0, 0x77, 0x2B, 0xB0, 0x05,
-	0x25, 0xB0, 0x05, 0x26, 0xB0, 0x05, 0x25, 0xB0, 0x05, 0x26, 0xB0, 0x76, 0x2B, 0xB0, 0x00, 0x54,
-	0x58, 0x05, 0x1B, 0x04, 0x59, 0xB0, 0x77, 0x2B, 0x2D, 0x2C, 0xB0, 0x07, 0x25, 0xB0, 0x0A, 0x25,
-	0xB0, 0x0A, 0x25, 0xB0, 0x08, 0x26, 0xB0, 0x76, 0x2B, 0x8A, 0xB0, 0x00, 0x54, 0x58, 0x05, 0x1B,
-	0x04, 0x59, 0xB0, 0x05, 0x25, 0xB0, 0x07, 0x26, 0xB0, 0x77, 0x2B, 0xB0, 0x06, 0x25, 0xB0, 0x06,
-	0x26, 0xB0, 0x06, 0x25, 0xB0, 0x06, 0x26, 0xB0, 0x76, 0x2B, 0x08, 0xB0, 0x77, 0x2B, 0x2D, 0x2C,
-	0xB0, 0x07, 0x25, 0xB0, 0x0A, 0x25, 0xB0, 0x0A, 0x25, 0xB0, 0x08, 0x26, 0xB0, 0x76, 0x2B, 0x8A,
-	0x8A, 0x08, 0xB0, 0x04, 0x25, 0xB0, 0x06, 0x26, 0xB0, 0x77, 0x2B, 0xB0, 0x05, 0x25, 0xB0, 0x05,
-	0x26, 0xB0, 0x05, 0x25, 0xB0, 0x05, 0x26, 0xB0, 0x76, 0x2B, 0xB0, 0x00, 0x54, 0x58, 0x05, 0x1B,
-	0x04, 0x59, 0xB0, 0x77, 0x2B, 0x2D, 0x2C, 0xB0, 0x08, 0x25, 0xB0, 0x0B, 0x25, 0xB0, 0x0B, 0x25,
-	0xB0, 0x09, 0x26, 0xB0, 0x76, 0x2B, 0xB0, 0x04, 0x26, 0xB0, 0x04, 0x26, 0x08, 0xB0, 0x05, 0x25,
-	0xB0, 0x07, 0x26, 0xB0, 0x77, 0x2B, 0xB0, 0x06, 0x25, 0xB0, 0x06, 0x26, 0xB0, 0x06, 0x25, 0xB0,
-	0x06, 0x26, 0xB0, 0x76, 0x2B, 0x08, 0xB0, 0x77, 0x2B, 0x2D, 0x2C, 0x03, 0xB0, 0x03, 0x25, 0xB0,
-	0x03, 0x25, 0x4A, 0xB0, 0x04, 0x25, 0xB0, 0x03, 0x25, 0x4A, 0x02, 0xB0, 0x05, 0x25, 0xB0, 0x05,
-	0x26, 0x4A, 0xB0, 0x05, 0x26, 0xB0, 0x05, 0x26, 0x4A, 0xB0, 0x04, 0x26, 0x63, 0x8A, 0x8A, 0x63,
-	0x61, 0x2D, 0x2C, 0xB1, 0x5D, 0x0E, 0x25, 0x60, 0x2B, 0xB0, 0x0C, 0x26, 0x11, 0xB0, 0x05, 0x26,
-	0x12, 0xB0, 0x0A, 0x25, 0x39, 0xB0, 0x07, 0x25, 0x39, 0xB0, 0x0A, 0x25, 0xB0, 0x0A, 0x25, 0xB0,
-	0x09, 0x25, 0xB0, 0x7C, 0x2B, 0xB0, 0x00, 0x50, 0xB0, 0x0B, 0x25, 0xB0, 0x08, 0x25, 0xB0, 0x0A,
-	0x25, 0xB0, 0x7C, 0x2B, 0xB0, 0x00, 0x50, 0x54, 0x58, 0xB0, 0x07, 0x25, 0xB0, 0x0B, 0x25, 0x87,
-	0xB0, 0x04, 0x25, 0xB0, 0x04, 0x25, 0x0B, 0xB0, 0x0A, 0x25, 0x10, 0xB0, 0x09, 0x25, 0xC1, 0xB0,
-	0x02, 0x25, 0xB0, 0x02, 0x25, 0x0B, 0xB0, 0x07, 0x25, 0x10, 0xB0, 0x06, 0x25, 0xC1, 0x1B, 0xB0,
-	0x07, 0x25, 0xB0, 0x0B, 0x25, 0xB0, 0x0B, 0x25, 0xB8, 0xFF, 0xFF, 0xB0, 0x76, 0x2B, 0xB0, 0x04,
-	0x25, 0xB0, 0x04, 0x25, 0x0B, 0xB0, 0x07, 0x25, 0xB0, 0x0A, 0x25, 0xB0, 0x77, 0x2B, 0xB0, 0x0A,
-	0x25, 0xB0, 0x08, 0x25, 0xB0, 0x08, 0x25, 0xB8, 0xFF, 0xFF, 0xB0, 0x76, 0x2B, 0xB0, 0x02, 0x25,
-	0xB0, 0x02, 0x25, 0x0B, 0xB0, 0x0A, 0x25, 0xB0, 0x07, 0x25, 0xB0, 0x77, 0x2B, 0x59, 0xB0, 0x0A,
-	0x25, 0x46, 0xB0, 0x0A, 0x25, 0x46, 0x60, 0xB0, 0x08, 0x25, 0x46, 0xB0, 0x08, 0x25, 0x46, 0x60,
-	0xB0, 0x06, 0x25, 0xB0, 0x06, 0x25, 0x0B, 0xB0, 0x0C, 0x25, 0xB0, 0x0C, 0x25, 0xB0, 0x0C, 0x26,
-	0x20, 0xB0, 0x00, 0x50, 0x58, 0x21, 0xB0, 0x6A, 0x1B, 0xB0, 0x6C, 0x59, 0x2B, 0xB0, 0x04, 0x25,
-	0xB0, 0x04, 0x25, 0x0B, 0xB0, 0x09, 0x25, 0xB0, 0x09, 0x25, 0xB0, 0x09, 0x26, 0x20, 0xB0, 0x00,
-	0x50, 0x58, 0x21, 0xB0, 0x6A, 0x1B, 0xB0, 0x6C, 0x59, 0x2B, 0x23, 0xB0, 0x0A, 0x25, 0x46, 0xB0,
-	0x0A, 0x25, 0x46, 0x60, 0x61, 0xB0, 0x20, 0x63, 0x23, 0xB0, 0x08, 0x25, 0x46, 0xB0, 0x08, 0x25,
-	0x46, 0x60, 0x61, 0xB0, 0x20, 0x63, 0xB1, 0x01, 0x0C, 0x25, 0x54, 0x58, 0x04, 0x1B, 0x05, 0x59,
-	0xB0, 0x0A, 0x26, 0x20, 0x10, 0xB0, 0x03, 0x25, 0x3A, 0xB0, 0x06, 0x26, 0xB0, 0x06, 0x26, 0x0B,
-	0xB0, 0x07, 0x26, 0x20, 0x10, 0x8A, 0x3A, 0xB1, 0x01, 0x07, 0x26, 0x54, 0x58, 0x04, 0x1B, 0x05,
-	0x59, 0xB0, 0x05, 0x26, 0x20, 0x10, 0xB0, 0x02, 0x25, 0x3A, 0x8A, 0x8A, 0x0B, 0x23, 0x20, 0x10,
-	0x23, 0x3A, 0x2D, 0x2C, 0x23, 0xB0, 0x01, 0x54, 0x58, 0xB9, 0x00, 0x00, 0x40, 0x00, 0x1B, 0xB8,
-	0x40, 0x00, 0xB0, 0x00, 0x59, 0x8A, 0xB0, 0x01, 0x54, 0x58, 0xB9, 0x00, 0x00, 0x40, 0x00, 0x1B,
-	0xB8, 0x40, 0x00, 0xB0, 0x00, 0x59, 0xB0, 0x7D, 0x2B, 0x2D, 0x2C, 0x8A, 0x8A, 0x08, 0x0D, 0x8A,
-	0xB0, 0x01, 0x54, 0x58, 0xB9, 0x00, 0x00, 0x40, 0x00, 0x1B, 0xB8, 0x40, 0x00, 0xB0, 0x00, 0x59,
-	0xB0, 0x7D, 0x2B, 0x2D, 0x2C, 0x08, 0xB0, 0x01, 0x54, 0x58, 0xB9, 0x00, 0x00, 0x40, 0x00, 0x1B,
-	0xB8, 0x40, 0x00, 0xB0, 0x00, 0x59, 0x0D, 0xB0, 0x7D, 0x2B, 0x2D, 0x2C, 0xB0, 0x04, 0x26, 0xB0,
-	0x04, 0x26, 0x08, 0x0D, 0xB0, 0x04, 0x26, 0xB0, 0x04, 0x26, 0x08, 0x0D, 0xB0, 0x7D, 0x2B, 0x2D,
-	0x2C, 0x20, 0x01, 0x46, 0x23, 0x00, 0x46, 0xB0, 0x0A, 0x43, 0xB0, 0x0B, 0x43, 0x8A, 0x63, 0x23,
-	0x62, 0x61, 0x2D, 0x2C, 0xB0, 0x09, 0x2B, 0xB0, 0x06, 0x25, 0x2E, 0xB0, 0x05, 0x25, 0x7D, 0xC5,
-	0xB0, 0x06, 0x25, 0xB0, 0x05, 0x25, 0xB0, 0x04, 0x25, 0x20, 0xB0, 0x00, 0x50, 0x58, 0x21, 0xB0,
-	0x6A, 0x1B, 0xB0, 0x6C, 0x59, 0x2B, 0xB0, 0x05, 0x25, 0xB0, 0x04, 0x25, 0xB0, 0x03, 0x25, 0x20,
-	0xB0, 0x00, 0x50, 0x58, 0x21, 0xB0, 0x6A, 0x1B, 0xB0, 0x6C, 0x59, 0x2B, 0x18, 0xB0, 0x08, 0x25,
-	0xB0, 0x07, 0x25, 0xB0, 0x06, 0x25, 0xB0, 0x0A, 0x25, 0xB0, 0x6F, 0x2B, 0xB0, 0x06, 0x25, 0xB0,
-	0x05, 0x25, 0xB0, 0x04, 0x26, 0x20, 0xB0, 0x00, 0x50, 0x58, 0x21, 0xB0, 0x66, 0x1B, 0xB0, 0x68,
-	0x59, 0x2B, 0xB0, 0x05, 0x25, 0xB0, 0x04, 0x25, 0xB0, 0x04, 0x26, 0x20, 0xB0, 0x00, 0x50, 0x58,
-	0x21, 0xB0, 0x66, 0x1B, 0xB0, 0x68, 0x59, 0x2B, 0x54, 0x58, 0x7D, 0xB0, 0x04, 0x25, 0x10, 0xB0,
-	0x03, 0x25, 0xC5, 0xB0, 0x02, 0x25, 0x10, 0xB0, 0x01, 0x25, 0xC5, 0xB0, 0x05, 0x26, 0x21, 0xB0,
-	0x05, 0x26, 0x21, 0x1B, 0xB0, 0x06, 0x26, 0xB0, 0x04, 0x25, 0xB0, 0x03, 0x25, 0xB0, 0x08, 0x26,
-	0xB0, 0x6F, 0x2B, 0x59, 0xB1, 0x00, 0x02, 0x43, 0x54, 0x58, 0x7D, 0xB0, 0x02, 0x25, 0xB0, 0x82,
-	0x2B, 0xB0, 0x05, 0x25, 0xB0, 0x82, 0x2B, 0x20, 0x20, 0x69, 0x61, 0xB0, 0x04, 0x43, 0x01, 0x23,
-	0x61, 0xB0, 0x60, 0x60, 0x20, 0x69, 0x61, 0xB0, 0x20, 0x61, 0x20, 0xB0, 0x08, 0x26, 0xB0, 0x08,
-	0x26, 0x8A, 0xB0, 0x02, 0x17, 0x38, 0x8A, 0x8A, 0x61, 0x20, 0x69, 0x61, 0x61, 0xB0, 0x02, 0x17,
-	0x38, 0x1B, 0x21, 0x21, 0x21, 0x21, 0x59, 0x18, 0x2D, 0x2C, 0x4B, 0x52, 0xB1, 0x01, 0x02, 0x43,
-	0x53, 0x5A, 0x58, 0x23, 0x10, 0x20, 0x01, 0x3C, 0x00, 0x3C, 0x1B, 0x21, 0x21, 0x59, 0x2D, 0x2C,
-	0x23, 0xB0, 0x02, 0x25, 0xB0, 0x02, 0x25, 0x53, 0x58, 0x20, 0xB0, 0x04, 0x25, 0x58, 0x3C, 0x1B,
-	0x39, 0x59, 0xB0, 0x01, 0x60, 0xB8, 0xFF, 0xE9, 0x1C, 0x59, 0x21, 0x21, 0x21, 0x2D, 0x2C, 0xB0,
-	0x02, 0x25, 0x47, 0xB0, 0x02, 0x25, 0x47, 0x54, 0x8A, 0x20, 0x20, 0x10, 0x11, 0xB0, 0x01, 0x60,
-	0x8A, 0x20, 0x12, 0xB0, 0x01, 0x61, 0xB0, 0x85, 0x2B, 0x2D, 0x2C, 0xB0, 0x04, 0x25, 0x47, 0xB0,
-	0x02, 0x25, 0x47, 0x54, 0x23, 0x20, 0x12, 0xB0, 0x01, 0x61, 0x23, 0x20, 0xB0, 0x06, 0x26, 0x20,
-	0x20, 0x10, 0x11, 0xB0, 0x01, 0x60, 0xB0, 0x06, 0x26, 0xB0, 0x85, 0x2B, 0x8A, 0x8A, 0xB0, 0x85,
-	0x2B, 0x2D, 0x2C, 0xB0, 0x02, 0x43, 0x54, 0x58, 0x0C, 0x02, 0x8A, 0x4B, 0x53, 0xB0, 0x04, 0x26,
-	0x4B, 0x51, 0x5A, 0x58, 0x0A, 0x38, 0x1B, 0x0A, 0x21, 0x21, 0x59, 0x1B, 0x21, 0x21, 0x21, 0x21,
-	0x59, 0x2D, 0x2C, 0xB0, 0x98, 0x2B, 0x58, 0x0C, 0x02, 0x8A, 0x4B, 0x53, 0xB0, 0x04, 0x26, 0x4B,
-	0x51, 0x5A, 0x58, 0x0A, 0x38, 0x1B, 0x0A, 0x21, 0x21, 0x59, 0x1B, 0x21, 0x21, 0x21, 0x21, 0x59,
-	0x2D, 0x2C, 0x20, 0xB0, 0x02, 0x43, 0x54, 0xB0, 0x01, 0x23, 0xB8, 0x00, 0x68, 0x23, 0x78, 0x21,
-	0xB1, 0x00, 0x02, 0x43, 0xB8, 0x00, 0x5E, 0x23, 0x79, 0x21, 0xB0, 0x02, 0x43, 0x23, 0xB0, 0x20,
-	0x20, 0x5C, 0x58, 0x21, 0x21, 0x21, 0xB0, 0x00, 0xB8, 0x00, 0x4D, 0x1C, 0x59, 0x8A, 0x8A, 0x20,
-	0x8A, 0x20, 0x8A, 0x23, 0xB8, 0x10, 0x00, 0x63, 0x56, 0x58, 0xB8, 0x10, 0x00, 0x63, 0x56, 0x58,
-	0x21, 0x21, 0x21, 0xB0, 0x01, 0xB8, 0x00, 0x30, 0x1C, 0x59, 0x1B, 0x21, 0x59, 0xB0, 0x80, 0x62,
-	0x20, 0x5C, 0x58, 0x21, 0x21, 0x21, 0xB0, 0x00, 0xB8, 0x00, 0x1D, 0x1C, 0x59, 0x23, 0xB0, 0x80,
-	0x62, 0x20, 0x5C, 0x58, 0x21, 0x21, 0x21, 0xB0, 0x00, 0xB8, 0x00, 0x0C, 0x1C, 0x59, 0x8A, 0xB0,
-	0x01, 0x61, 0xB8, 0xFF, 0xAB, 0x1C, 0x23, 0x21, 0x2D, 0x2C, 0x20, 0xB0, 0x02, 0x43, 0x54, 0xB0,
-	0x01, 0x23, 0xB8, 0x00, 0x81, 0x23, 0x78, 0x21, 0xB1, 0x00, 0x02, 0x43, 0xB8, 0x00, 0x77, 0x23,
-	0x79, 0x21, 0xB1, 0x00, 0x02, 0x43, 0x8A, 0xB0, 0x20, 0x20, 0x5C, 0x58, 0x21, 0x21, 0x21, 0xB8,
-	0x00, 0x67, 0x1C, 0x59, 0x8A, 0x8A, 0x20, 0x8A, 0x20, 0x8A, 0x23, 0xB8, 0x10, 0x00, 0x63, 0x56,
-	0x58, 0xB8, 0x10, 0x00, 0x63, 0x56, 0x58, 0xB0, 0x04, 0x26, 0xB0, 0x01, 0x5B, 0xB0, 0x04, 0x26,
-	0xB0, 0x04, 0x26, 0xB0, 0x04, 0x26, 0x1B, 0x21, 0x21, 0x21, 0x21, 0xB8, 0x00, 0x38, 0xB0, 0x00,
-	0x23, 0x1C, 0x59, 0x1B, 0x21, 0x59, 0xB0, 0x04, 0x26, 0x23, 0xB0, 0x80, 0x62, 0x20, 0x5C, 0x58,
-	0x8A, 0x5C, 0x8A, 0x5A, 0x23, 0x21, 0x23, 0x21, 0xB8, 0x00, 0x1E, 0x1C, 0x59, 0x8A, 0xB0, 0x80,
-	0x62, 0x20, 0x5C, 0x58, 0x21, 0x21, 0x23, 0x21, 0xB8, 0x00, 0x0E, 0x1C, 0x59, 0xB0, 0x04, 0x26,
-	0xB0, 0x01, 0x61, 0xB8, 0xFF, 0x93, 0x1C, 0x23, 0x21, 0x2D, 0x00, 0x00, 0x03, 0x8C, 0x00, 0x64,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
-	0x02, 0x10, 0x00, 0xA1, 0x02, 0x90, 0x00, 0x89, 0x04, 0xED, 0x00, 0x77, 0x04, 0x7F, 0x00, 0x6E,
-	0x05, 0xDC, 0x00, 0x69, 0x04, 0xFA, 0x00, 0x66, 0x01, 0x66, 0x00, 0x68, 0x02, 0xBD, 0x00, 0x86,
-	0x02, 0xC9, 0x00, 0x27, 0x03, 0x72, 0x00, 0x1C, 0x04, 0x8A, 0x00, 0x4E, 0x01, 0x93, 0x00, 0x1D,
-	0x02, 0x36, 0x00, 0x26, 0x02, 0x1C, 0x00, 0x90, 0x03, 0x4D, 0x00, 0x13, 0x04, 0x7F, 0x00, 0x73,
-	0x04, 0x7F, 0x00, 0xAB, 0x04, 0x7F, 0x00, 0x5E, 0x04, 0x7F, 0x00, 0x5F, 0x04, 0x7F, 0x00, 0x35,
-	0x04, 0x7F, 0x00, 0x9A, 0x04, 0x7F, 0x00, 0x85, 0x04, 0x7F, 0x00, 0x4E, 0x04, 0x7F, 0x00, 0x71,
-	0x04, 0x7F, 0x00, 0x64, 0x01, 0xF0, 0x00, 0x85, 0x01, 0xB1, 0x00, 0x29, 0x04, 0x11, 0x00, 0x48,
-	0x04, 0x64, 0x00, 0x98, 0x04, 0x2F, 0x00, 0x87, 0x03, 0xC8, 0x00, 0x4B, 0x07, 0x2F, 0x00, 0x6D,
-	0x05, 0x38, 0x00, 0x1D, 0x04, 0xFC, 0x00, 0xA9, 0x05, 0x35, 0x00, 0x78, 0x05, 0x40, 0x00, 0xA9,
-	0x04, 0x8C, 0x00, 0xA9, 0x04, 0x6C, 0x00, 0xA9, 0x05, 0x73, 0x00, 0x7A, 0x05, 0xB5, 0x00, 0xA9,
-	0x02, 0x2D, 0x00, 0xB7, 0x04, 0x6A, 0x00, 0x35, 0x05, 0x05, 0x00, 0xA9, 0x04, 0x4F, 0x00, 0xA9,
-	0x06, 0xFC, 0x00, 0xA9, 0x05, 0xB5, 0x00, 0xA9, 0x05, 0x81, 0x00, 0x77, 0x05, 0x0C, 0x00, 0xA9,
-	0x05, 0x81, 0x00, 0x6E, 0x04, 0xEE, 0x00, 0xA9, 0x04, 0xC0, 0x00, 0x51, 0x04, 0xC6, 0x00, 0x32,
-	0x05, 0x30, 0x00, 0x8C, 0x05, 0x18, 0x00, 0x1D, 0x07, 0x19, 0x00, 0x3D, 0x05, 0x04, 0x00, 0x3A,
-	0x04, 0xCE, 0x00, 0x0F, 0x04, 0xCB, 0x00, 0x57, 0x02, 0x1F, 0x00, 0x93, 0x03, 0x49, 0x00, 0x29,
-	0x02, 0x1F, 0x00, 0x0A, 0x03, 0x58, 0x00, 0x40, 0x03, 0x9C, 0x00, 0x04, 0x02, 0x79, 0x00, 0x39,
-	0x04, 0x5A, 0x00, 0x6D, 0x04, 0x7E, 0x00, 0x8C, 0x04, 0x30, 0x00, 0x5D, 0x04, 0x83, 0x00, 0x5F,
-	0x04, 0x3E, 0x00, 0x5D, 0x02, 0xC8, 0x00, 0x3D, 0x04, 0x7E, 0x00, 0x61, 0x04, 0x68, 0x00, 0x8D,
-	0x01, 0xF2, 0x00, 0x8E, 0x01, 0xEA, 0xFF, 0xBE, 0x04, 0x0E, 0x00, 0x8D, 0x01, 0xF2, 0x00, 0x9C,
-	0x07, 0x04, 0x00, 0x8B, 0x04, 0x6B, 0x00, 0x8D, 0x04, 0x90, 0x00, 0x5C, 0x04, 0x7E, 0x00, 0x8C,
-	0x04, 0x8C, 0x00, 0x5F, 0x02, 0xB6, 0x00, 0x8D, 0x04, 0x21, 0x00, 0x5F, 0x02, 0x9E, 0x00, 0x09,
-	0x04, 0x69, 0x00, 0x89, 0x03, 0xE0, 0x00, 0x21, 0x06, 0x03, 0x00, 0x2B, 0x03, 0xF8, 0x00, 0x2A,
-	0x03, 0xC9, 0x00, 0x16, 0x03, 0xF8, 0x00, 0x59, 0x02, 0xB5, 0x00, 0x40, 0x01, 0xF4, 0x00, 0xB0,
-	0x02, 0xB5, 0x00, 0x14, 0x05, 0x71, 0x00, 0x83, 0x01, 0xF4, 0x00, 0x8B, 0x04, 0x61, 0x00, 0x69,
-	0x04, 0xA7, 0x00, 0x5B, 0x05, 0xB5, 0x00, 0x69, 0x04, 0x34, 0x00, 0x0F, 0x01, 0xEC, 0x00, 0x94,
-	0x04, 0xE8, 0x00, 0x5B, 0x03, 0x59, 0x00, 0x65, 0x06, 0x49, 0x00, 0x5C, 0x03, 0x94, 0x00, 0x93,
-	0x03, 0xC1, 0x00, 0x65, 0x04, 0x6E, 0x00, 0x7F, 0x06, 0x4A, 0x00, 0x5B, 0x03, 0xAB, 0x00, 0x8F,
-	0x02, 0xFD, 0x00, 0x83, 0x04, 0x47, 0x00, 0x61, 0x02, 0xEF, 0x00, 0x42, 0x02, 0xEF, 0x00, 0x3F,
-	0x02, 0x82, 0x00, 0x7B, 0x04, 0x89, 0x00, 0x9B, 0x03, 0xEA, 0x00, 0x44, 0x02, 0x17, 0x00, 0x94,
-	0x01, 0xFC, 0x00, 0x74, 0x02, 0xEF, 0x00, 0x7B, 0x03, 0xA4, 0x00, 0x7B, 0x03, 0xC0, 0x00, 0x67,
-	0x05, 0xDC, 0x00, 0x55, 0x06, 0x35, 0x00, 0x50, 0x06, 0x39, 0x00, 0x70, 0x03, 0xCA, 0x00, 0x44,
-	0x07, 0x7A, 0xFF, 0xF1, 0x04, 0x45, 0x00, 0x59, 0x05, 0x81, 0x00, 0x77, 0x04, 0xBA, 0x00, 0xA7,
-	0x04, 0xC2, 0x00, 0x8C, 0x06, 0xC2, 0x00, 0x4F, 0x04, 0xB1, 0x00, 0x7E, 0x04, 0x92, 0x00, 0x47,
-	0x04, 0x89, 0x00, 0x5C, 0x04, 0x9C, 0x00, 0x95, 0x04, 0xC8, 0x00, 0x5F, 0x05, 0x9B, 0x00, 0x1E,
-	0x01, 0xFB, 0x00, 0x9C, 0x04, 0x74, 0x00, 0x9B, 0x04, 0x4F, 0x00, 0x23, 0x02, 0x2A, 0x00, 0x23,
-	0x05, 0x8B, 0x00, 0xA2, 0x04, 0x89, 0x00, 0x92, 0x07, 0xA1, 0x00, 0x69, 0x07, 0x44, 0x00, 0x61,
-	0x01, 0xFC, 0x00, 0xA1, 0x05, 0x87, 0x00, 0x5E, 0x02, 0xBA, 0xFF, 0xE3, 0x05, 0x7F, 0x00, 0x66,
-	0x04, 0x93, 0x00, 0x5C, 0x05, 0x90, 0x00, 0x8C, 0x04, 0xF3, 0x00, 0x89, 0x02, 0x04, 0xFF, 0xB4,
-	0x04, 0x38, 0x00, 0x63, 0x03, 0xC4, 0x00, 0xAA, 0x03, 0x8E, 0x00, 0x8E, 0x03, 0xAB, 0x00, 0x8F,
-	0x03, 0x6B, 0x00, 0x82, 0x01, 0xF2, 0x00, 0x8E, 0x02, 0xAE, 0x00, 0x79, 0x02, 0x2B, 0x00, 0x32,
-	0x03, 0xC6, 0x00, 0x7B, 0x02, 0xFC, 0x00, 0x5F, 0x02, 0x5A, 0x00, 0x7F, 0x00, 0x00, 0xFC, 0xA7,
-	0x00, 0x00, 0xFD, 0x6E, 0x00, 0x00, 0xFC, 0x8A, 0x00, 0x00, 0xFD, 0x5D, 0x00, 0x00, 0xFC, 0x27,
-	0x00, 0x00, 0xFD, 0x38, 0x02, 0x0E, 0x00, 0xB8, 0x04, 0x0C, 0x00, 0x72, 0x02, 0x17, 0x00, 0x94,
-	0x04, 0x73, 0x00, 0xB2, 0x05, 0xA4, 0x00, 0x20, 0x05, 0x72, 0x00, 0x67, 0x05, 0x3F, 0x00, 0x32,
-	0x04, 0x92, 0x00, 0x78, 0x05, 0xB5, 0x00, 0xB2, 0x04, 0x92, 0x00, 0x46, 0x05, 0xBB, 0x00, 0x4E,
-	0x05, 0x89, 0x00, 0x5A, 0x05, 0x52, 0x00, 0x72, 0x04, 0x86, 0x00, 0x64, 0x04, 0xBD, 0x00, 0xA1,
-	0x04, 0x03, 0x00, 0x2F, 0x04, 0x89, 0x00, 0x61, 0x04, 0x51, 0x00, 0x64, 0x04, 0x25, 0x00, 0x6D,
-	0x04, 0x89, 0x00, 0x92, 0x04, 0x8F, 0x00, 0x7B, 0x02, 0x98, 0x00, 0xC3, 0x04, 0x6F, 0x00, 0x26,
-	0x03, 0xEC, 0x00, 0x66, 0x04, 0xC5, 0x00, 0x29, 0x04, 0x89, 0x00, 0x92, 0x04, 0x4E, 0x00, 0x65,
-	0x04, 0x88, 0x00, 0x61, 0x04, 0x2C, 0x00, 0x51, 0x04, 0x5E, 0x00, 0x90, 0x05, 0xA3, 0x00, 0x58,
-	0x05, 0x9A, 0x00, 0x60, 0x06, 0x97, 0x00, 0x7A, 0x04, 0xA2, 0x00, 0x7A, 0x04, 0x43, 0xFF, 0xDA,
-	0x06, 0x48, 0x00, 0x4B, 0x06, 0x00, 0x00, 0x2B, 0x05, 0x65, 0x00, 0x7B, 0x08, 0x92, 0x00, 0x32,
-	0x08, 0xA5, 0x00, 0xB2, 0x06, 0x83, 0x00, 0x3E, 0x05, 0xB4, 0x00, 0xB0, 0x05, 0x0B, 0x00, 0xA3,
-	0x06, 0x04, 0x00, 0x33, 0x07, 0x43, 0x00, 0x1B, 0x04, 0xC0, 0x00, 0x50, 0x05, 0xB5, 0x00, 0xB2,
-	0x05, 0xAA, 0x00, 0x30, 0x05, 0x08, 0x00, 0x4D, 0x06, 0x2D, 0x00, 0x54, 0x05, 0xDA, 0x00, 0xAF,
-	0x05, 0x7A, 0x00, 0x97, 0x07, 0x87, 0x00, 0xB0, 0x07, 0xC0, 0x00, 0xB0, 0x06, 0x12, 0x00, 0x11,
-	0x06, 0xEB, 0x00, 0xB2, 0x05, 0x05, 0x00, 0xA3, 0x05, 0x65, 0x00, 0x94, 0x07, 0x27, 0x00, 0xB7,
-	0x05, 0x18, 0x00, 0x5A, 0x04, 0x6D, 0x00, 0x62, 0x04, 0x93, 0x00, 0x9E, 0x03, 0x5C, 0x00, 0x9B,
-	0x04, 0xD4, 0x00, 0x2E, 0x06, 0x21, 0x00, 0x16, 0x04, 0x10, 0x00, 0x58, 0x04, 0x9E, 0x00, 0x9D,
-	0x04, 0x53, 0x00, 0x9D, 0x04, 0xA0, 0x00, 0x2C, 0x05, 0xEF, 0x00, 0x9E, 0x04, 0x9D, 0x00, 0x9D,
-	0x04, 0x9E, 0x00, 0x9D, 0x03, 0xD9, 0x00, 0x28, 0x05, 0xCE, 0x00, 0x64, 0x04, 0xBE, 0x00, 0x9D,
-	0x04, 0x5A, 0x00, 0x68, 0x06, 0x79, 0x00, 0x9D, 0x06, 0x9F, 0x00, 0x92, 0x04, 0xF7, 0x00, 0x1E,
-	0x06, 0x36, 0x00, 0x9E, 0x04, 0x58, 0x00, 0x9E, 0x04, 0x4E, 0x00, 0x64, 0x06, 0x88, 0x00, 0x9E,
-	0x04, 0x64, 0x00, 0x2F, 0x04, 0x68, 0xFF, 0xE7, 0x04, 0x4E, 0x00, 0x67, 0x06, 0xC9, 0x00, 0x27,
-	0x06, 0xE4, 0x00, 0x9D, 0x04, 0x89, 0xFF, 0xFD, 0x04, 0x9E, 0x00, 0x9D, 0x07, 0x09, 0x00, 0x9C,
-	0x06, 0x2C, 0x00, 0x81, 0x04, 0x57, 0xFF, 0xDB, 0x07, 0x2C, 0x00, 0xB8, 0x05, 0xF9, 0x00, 0x9A,
-	0x04, 0xD3, 0x00, 0x28, 0x04, 0x47, 0x00, 0x0F, 0x07, 0x0C, 0x00, 0xCA, 0x06, 0x0C, 0x00, 0xBD,
-	0x06, 0xD2, 0x00, 0x93, 0x05, 0xE2, 0x00, 0x97, 0x09, 0x05, 0x00, 0xB7, 0x07, 0xD1, 0x00, 0x9C,
-	0x04, 0x24, 0x00, 0x50, 0x03, 0xDB, 0x00, 0x4C, 0x05, 0x72, 0x00, 0x67, 0x04, 0x8C, 0x00, 0x5C,
-	0x05, 0x0B, 0x00, 0x16, 0x04, 0x04, 0x00, 0x2F, 0x05, 0x72, 0x00, 0x67, 0x04, 0x89, 0x00, 0x5C,
-	0x07, 0x01, 0x00, 0x9C, 0x06, 0x24, 0x00, 0x7E, 0x07, 0x09, 0x00, 0x9C, 0x06, 0x2C, 0x00, 0x81,
-	0x05, 0x32, 0x00, 0x76, 0x04, 0x48, 0x00, 0x64, 0x04, 0xFE, 0x00, 0x74, 0x00, 0x00, 0xFC, 0x66,
-	0x00, 0x00, 0xFC, 0x70, 0x00, 0x00, 0xFD, 0x65, 0x00, 0x00, 0xFD, 0xA4, 0x00, 0x00, 0xFA, 0x1A,
-	0x00, 0x00, 0xFA, 0x2B, 0x06, 0x09, 0x00, 0xB2, 0x04, 0xED, 0x00, 0x9D, 0x04, 0x57, 0xFF, 0xDB,
-	0x05, 0x1B, 0x00, 0xA9, 0x04, 0x8A, 0x00, 0x8C, 0x04, 0x64, 0x00, 0xA2, 0x03, 0x91, 0x00, 0x92,
-	0x04, 0xDB, 0x00, 0xB2, 0x04, 0x06, 0x00, 0x92, 0x07, 0xA2, 0x00, 0x1B, 0x06, 0x61, 0x00, 0x16,
-	0x05, 0x9A, 0x00, 0xB2, 0x04, 0xB8, 0x00, 0x9D, 0x05, 0x0A, 0x00, 0xA4, 0x04, 0x7E, 0x00, 0x9B,
-	0x06, 0x8C, 0x00, 0x45, 0x05, 0x84, 0x00, 0x3F, 0x05, 0xFF, 0x00, 0xA9, 0x04, 0xD9, 0x00, 0x9D,
-	0x07, 0xCF, 0x00, 0xA9, 0x05, 0xB4, 0x00, 0x92, 0x08, 0x31, 0x00, 0xB0, 0x06, 0xF4, 0x00, 0x92,
-	0x05, 0xEF, 0x00, 0x71, 0x04, 0xD4, 0x00, 0x6E, 0x05, 0x18, 0x00, 0x3A, 0x04, 0x2A, 0x00, 0x2A,
-	0x07, 0x2D, 0x00, 0x34, 0x05, 0x5D, 0x00, 0x1F, 0x05, 0xBC, 0x00, 0x97, 0x04, 0x96, 0x00, 0x68,
-	0x05, 0x70, 0x00, 0x97, 0x04, 0x6B, 0x00, 0x84, 0x05, 0x70, 0x00, 0x89, 0x06, 0x30, 0x00, 0x3F,
-	0x04, 0xBE, 0xFF, 0xDD, 0x05, 0x0A, 0x00, 0xA4, 0x04, 0x5A, 0x00, 0x9B, 0x05, 0xFE, 0x00, 0x30,
-	0x04, 0xEF, 0x00, 0x2C, 0x05, 0xB3, 0x00, 0xB2, 0x04, 0x89, 0x00, 0x92, 0x06, 0x12, 0x00, 0xA9,
-	0x04, 0xEC, 0x00, 0x9D, 0x07, 0x4F, 0x00, 0xA9, 0x06, 0x3E, 0x00, 0x9E, 0x05, 0x87, 0x00, 0x5E,
-	0x04, 0xA8, 0x00, 0x68, 0x04, 0xA8, 0x00, 0x6A, 0x04, 0xB8, 0x00, 0x39, 0x03, 0xAB, 0x00, 0x3A,
-	0x05, 0x2E, 0x00, 0x3A, 0x04, 0x40, 0x00, 0x2A, 0x04, 0xF7, 0x00, 0x57, 0x06, 0x95, 0x00, 0x5A,
-	0x06, 0xE5, 0x00, 0x64, 0x06, 0x57, 0x00, 0x36, 0x05, 0x2C, 0x00, 0x31, 0x04, 0x4A, 0x00, 0x53,
-	0x04, 0x08, 0x00, 0x79, 0x07, 0xC2, 0x00, 0x45, 0x06, 0x76, 0x00, 0x3F, 0x07, 0xFB, 0x00, 0xAA,
-	0x06, 0xA2, 0x00, 0x90, 0x04, 0xF7, 0x00, 0x76, 0x04, 0x1E, 0x00, 0x66, 0x05, 0xAE, 0x00, 0x24,
-	0x05, 0x21, 0x00, 0x46, 0x05, 0x65, 0x00, 0x97, 0x06, 0x02, 0x00, 0x30, 0x04, 0xF3, 0x00, 0x2C,
-	0x03, 0x21, 0x00, 0x70, 0x04, 0x14, 0x00, 0x00, 0x08, 0x29, 0x00, 0x00, 0x04, 0x14, 0x00, 0x00,
-	0x08, 0x29, 0x00, 0x00, 0x02, 0xB9, 0x00, 0x00, 0x02, 0x0A, 0x00, 0x00, 0x01, 0x5C, 0x00, 0x00,
-	0x04, 0x7F, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x00, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x34, 0x00, 0x26, 0x02, 0x34, 0x00, 0x26,
-	0x05, 0x40, 0x00, 0xA2, 0x06, 0x3F, 0x00, 0x90, 0x03, 0xA6, 0x00, 0x0D, 0x01, 0x9A, 0x00, 0x61,
-	0x01, 0x9A, 0x00, 0x30, 0x01, 0x98, 0x00, 0x24, 0x01, 0x9A, 0x00, 0x4F, 0x02, 0xD4, 0x00, 0x69,
-	0x02, 0xDC, 0x00, 0x3C, 0x02, 0xC2, 0x00, 0x24, 0x04, 0x6A, 0x00, 0x46, 0x04, 0x90, 0x00, 0x57,
-	0x02, 0xB3, 0x00, 0x8B, 0x03, 0xC4, 0x00, 0x94, 0x05, 0x5A, 0x00, 0x94, 0x01, 0x7F, 0x00, 0x52,
-	0x07, 0xAA, 0x00, 0x44, 0x02, 0x67, 0x00, 0x6C, 0x02, 0x67, 0x00, 0x5A, 0x03, 0xA3, 0x00, 0x3C,
-	0x02, 0xEF, 0x00, 0x51, 0x02, 0xEF, 0x00, 0x36, 0x02, 0xEF, 0x00, 0x5C, 0x02, 0xEF, 0x00, 0x56,
-	0x02, 0xEF, 0x00, 0x3B, 0x02, 0xEF, 0x00, 0x4F, 0x02, 0xEF, 0x00, 0x4A, 0x03, 0x38, 0x00, 0x50,
-	0x02, 0xF8, 0x00, 0x50, 0x02, 0xF8, 0x00, 0x50, 0x01, 0xF1, 0x00, 0x54, 0x01, 0xF1, 0x00, 0x50,
-	0x03, 0x61, 0x00, 0x7A, 0x02, 0xEF, 0x00, 0x51, 0x02, 0xEF, 0x00, 0x7B, 0x02, 0xEF, 0x00, 0x42,
-	0x02, 0xEF, 0x00, 0x3F, 0x02, 0xEF, 0x00, 0x36, 0x02, 0xEF, 0x00, 0x5C, 0x02, 0xEF, 0x00, 0x56,
-	0x02, 0xEF, 0x00, 0x3B, 0x02, 0xEF, 0x00, 0x4F, 0x02, 0xEF, 0x00, 0x4A, 0x03, 0x38, 0x00, 0x50,
-	0x02, 0xF8, 0x00, 0x50, 0x02, 0xF8, 0x00, 0x50, 0x01, 0xF1, 0x00, 0x54, 0x01, 0xF1, 0x00, 0x50,
-	0x04, 0xA7, 0x00, 0x5B, 0x06, 0x56, 0x00, 0x1F, 0x06, 0x91, 0x00, 0xA7, 0x08, 0x76, 0x00, 0xA9,
-	0x05, 0xEB, 0x00, 0x1F, 0x06, 0x2B, 0x00, 0x8C, 0x04, 0x7F, 0x00, 0x5F, 0x05, 0xDA, 0x00, 0x1F,
-	0x04, 0x23, 0x00, 0x2B, 0x04, 0x74, 0x00, 0x21, 0x05, 0x48, 0x00, 0x5D, 0x05, 0x4F, 0x00, 0x1F,
-	0x05, 0xE8, 0x00, 0x7B, 0x03, 0xCE, 0x00, 0x68, 0x08, 0x3A, 0x00, 0xA2, 0x05, 0x01, 0x00, 0x68,
-	0x05, 0x18, 0x00, 0x98, 0x06, 0x26, 0x00, 0x54, 0x06, 0xD7, 0x00, 0x65, 0x06, 0xCF, 0x00, 0x64,
-	0x06, 0x6A, 0x00, 0x5A, 0x04, 0x90, 0x00, 0x6A, 0x05, 0x8F, 0x00, 0xA9, 0x04, 0xAF, 0x00, 0x46,
-	0x04, 0x93, 0x00, 0xA8, 0x04, 0xC5, 0x00, 0x3F, 0x08, 0x3A, 0x00, 0x63, 0x02, 0x0D, 0xFF, 0xAF,
-	0x04, 0x82, 0x00, 0x65, 0x04, 0x64, 0x00, 0x98, 0x04, 0x11, 0x00, 0x3D, 0x04, 0x2F, 0x00, 0x84,
-	0x04, 0x08, 0x00, 0x2C, 0x02, 0x4C, 0x00, 0xB5, 0x02, 0x90, 0x00, 0x6F, 0x02, 0x04, 0x00, 0x5D,
-	0x04, 0xF3, 0x00, 0x3D, 0x04, 0x6F, 0x00, 0x20, 0x04, 0x8B, 0x00, 0x3D, 0x06, 0xD4, 0x00, 0x3D,
-	0x06, 0xD4, 0x00, 0x3D, 0x04, 0xEE, 0x00, 0x3D, 0x06, 0x9B, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x00,
-	0x08, 0x34, 0x00, 0x5B, 0x08, 0x35, 0x00, 0x5C, 0x02, 0xEF, 0x00, 0x42, 0x02, 0xEF, 0x00, 0x7B,
-	0x02, 0xEF, 0x00, 0x51, 0x04, 0x10, 0x00, 0x56, 0x04, 0x10, 0x00, 0x61, 0x04, 0x10, 0x00, 0x42,
-	0x04, 0x0F, 0x00, 0x72, 0x04, 0x10, 0x00, 0x81, 0x04, 0x10, 0x00, 0x31, 0x04, 0x10, 0x00, 0x4F,
-	0x04, 0x10, 0x00, 0x4F, 0x04, 0x10, 0x00, 0x99, 0x04, 0x10, 0x00, 0x63, 0x04, 0x23, 0x00, 0x48,
-	0x04, 0x2B, 0x00, 0x0E, 0x04, 0x54, 0x00, 0x27, 0x06, 0x15, 0x00, 0x31, 0x04, 0x68, 0x00, 0x14,
-	0x04, 0x7D, 0x00, 0x75, 0x04, 0x27, 0x00, 0x29, 0x04, 0x20, 0x00, 0x44, 0x04, 0x4A, 0x00, 0x8A,
-	0x04, 0xBC, 0x00, 0x5A, 0x04, 0x5D, 0x00, 0x8B, 0x04, 0xBC, 0x00, 0x60, 0x04, 0xE3, 0x00, 0x8B,
-	0x06, 0x02, 0x00, 0x8B, 0x03, 0xB5, 0x00, 0x8B, 0x04, 0x55, 0x00, 0x8B, 0x03, 0xCF, 0x00, 0x2C,
-	0x01, 0xE9, 0x00, 0x98, 0x04, 0xE4, 0x00, 0x8B, 0x04, 0xAC, 0x00, 0x64, 0x03, 0xCC, 0x00, 0x8B,
-	0x04, 0x20, 0x00, 0x44, 0x04, 0x34, 0x00, 0x31, 0x03, 0xA1, 0x00, 0x0E, 0x03, 0xAF, 0x00, 0x8B,
-	0x04, 0x68, 0x00, 0x14, 0x04, 0xBC, 0x00, 0x60, 0x04, 0x68, 0x00, 0x14, 0x03, 0x89, 0x00, 0x3E,
-	0x04, 0xCF, 0x00, 0x8B, 0x03, 0xF0, 0x00, 0x40, 0x05, 0x67, 0x00, 0x61, 0x05, 0x17, 0x00, 0x61,
-	0x04, 0xF3, 0x00, 0x76, 0x05, 0x73, 0x00, 0x27, 0x04, 0x7C, 0x00, 0x61, 0x07, 0x42, 0x00, 0x28,
-	0x07, 0x50, 0x00, 0x8B, 0x05, 0x74, 0x00, 0x29, 0x04, 0xCE, 0x00, 0x8B, 0x04, 0x5A, 0x00, 0x8B,
-	0x05, 0x25, 0x00, 0x2E, 0x06, 0x0B, 0x00, 0x1F, 0x04, 0x40, 0x00, 0x48, 0x04, 0xEC, 0x00, 0x8B,
-	0x04, 0x4E, 0x00, 0x8C, 0x04, 0xC1, 0x00, 0x28, 0x04, 0x20, 0x00, 0x23, 0x05, 0x29, 0x00, 0x8B,
-	0x04, 0x6A, 0x00, 0x3D, 0x06, 0x51, 0x00, 0x8B, 0x06, 0xAC, 0x00, 0x8B, 0x05, 0x1D, 0x00, 0x09,
-	0x05, 0xF1, 0x00, 0x8B, 0x04, 0x4F, 0x00, 0x8B, 0x04, 0x7C, 0x00, 0x4B, 0x06, 0x77, 0x00, 0x8B,
-	0x04, 0x87, 0x00, 0x50, 0x04, 0x12, 0x00, 0x0B, 0x06, 0x48, 0x00, 0x1F, 0x04, 0x79, 0x00, 0x8C,
-	0x05, 0x0A, 0x00, 0x8C, 0x05, 0x37, 0x00, 0x24, 0x05, 0xC3, 0x00, 0x60, 0x04, 0x5F, 0x00, 0x0E,
-	0x04, 0xA8, 0x00, 0x27, 0x06, 0x62, 0x00, 0x27, 0x04, 0x6A, 0x00, 0x3D, 0x04, 0x6A, 0x00, 0x8B,
-	0x05, 0xC4, 0x00, 0x02, 0x04, 0xCB, 0x00, 0x5E, 0x04, 0x40, 0x00, 0x48, 0x04, 0xBC, 0x00, 0x60,
-	0x04, 0x34, 0x00, 0x31, 0x03, 0xE4, 0x00, 0x43, 0x08, 0x22, 0x00, 0x8B, 0x04, 0xAB, 0x00, 0x28,
-	0x02, 0xEF, 0x00, 0x3F, 0x02, 0xEF, 0x00, 0x36, 0x02, 0xEF, 0x00, 0x5C, 0x02, 0xEF, 0x00, 0x56,
-	0x02, 0xEF, 0x00, 0x3B, 0x02, 0xEF, 0x00, 0x4F, 0x02, 0xEF, 0x00, 0x4A, 0x03, 0x97, 0x00, 0x8F,
-	0x02, 0xB5, 0x00, 0x9F, 0x03, 0xE6, 0x00, 0x8B, 0x04, 0x3A, 0x00, 0x1F, 0x04, 0xC4, 0x00, 0x64,
-	0x05, 0x4C, 0x00, 0xB2, 0x05, 0x24, 0x00, 0xB2, 0x04, 0x14, 0x00, 0x93, 0x05, 0x3D, 0x00, 0xB2,
-	0x04, 0x0F, 0x00, 0x93, 0x04, 0x80, 0x00, 0x8B, 0x04, 0x7C, 0x00, 0x61, 0x04, 0x51, 0x00, 0x8B,
-	0x04, 0x86, 0x00, 0x14, 0x01, 0xFE, 0x00, 0x9F, 0x03, 0xA5, 0x00, 0x82, 0x00, 0x00, 0xFC, 0xA3,
-	0x03, 0xF0, 0x00, 0x6F, 0x03, 0xF4, 0xFF, 0x5D, 0x04, 0x0F, 0x00, 0x69, 0x03, 0xF5, 0x00, 0x69,
-	0x03, 0xAF, 0x00, 0x8B, 0x03, 0xA0, 0x00, 0x82, 0x03, 0x9F, 0x00, 0x82, 0x02, 0xEF, 0x00, 0x51,
-	0x02, 0xEF, 0x00, 0x36, 0x02, 0xEF, 0x00, 0x5C, 0x02, 0xEF, 0x00, 0x56, 0x02, 0xEF, 0x00, 0x3B,
-	0x02, 0xEF, 0x00, 0x4F, 0x02, 0xEF, 0x00, 0x4A, 0x05, 0x82, 0x00, 0x7E, 0x05, 0xAF, 0x00, 0x7E,
-	0x05, 0x93, 0x00, 0xB2, 0x05, 0xE0, 0x00, 0x7E, 0x05, 0xE3, 0x00, 0x7E, 0x03, 0xD5, 0x00, 0xA0,
-	0x04, 0x82, 0x00, 0x83, 0x04, 0x58, 0x00, 0x0F, 0x04, 0xCF, 0x00, 0x3E, 0x04, 0x6B, 0x00, 0x65,
-	0x04, 0x2E, 0x00, 0x4A, 0x03, 0xA5, 0x00, 0x84, 0x01, 0x92, 0x00, 0x68, 0x06, 0xA4, 0x00, 0x60,
-	0x04, 0xBA, 0x00, 0x82, 0x01, 0xFC, 0xFF, 0xB6, 0x04, 0x7F, 0x00, 0x3B, 0x04, 0x7F, 0x00, 0x73,
-	0x04, 0x7F, 0x00, 0x22, 0x04, 0x7F, 0x00, 0x76, 0x04, 0x7F, 0x00, 0x76, 0x04, 0x7F, 0x00, 0x36,
-	0x04, 0x7F, 0x00, 0x7E, 0x04, 0x7F, 0x00, 0x5E, 0x04, 0x7F, 0x00, 0x71, 0x04, 0x7F, 0x00, 0xF4,
-	0x02, 0x06, 0xFF, 0xB4, 0x02, 0x04, 0xFF, 0xB4, 0x01, 0xFB, 0x00, 0x9C, 0x01, 0xFB, 0xFF, 0xF9,
-	0x01, 0xFB, 0x00, 0x9C, 0x04, 0x51, 0x00, 0x8B, 0x05, 0x00, 0x00, 0x78, 0x04, 0x21, 0x00, 0x3B,
-	0x04, 0x7E, 0x00, 0x8C, 0x04, 0x33, 0x00, 0x5D, 0x04, 0x93, 0x00, 0x5B, 0x04, 0x8C, 0x00, 0x5B,
-	0x04, 0x9F, 0x00, 0x5A, 0x04, 0x8E, 0x00, 0x8C, 0x04, 0x9C, 0x00, 0x5B, 0x04, 0x3E, 0x00, 0x5D,
-	0x04, 0x7E, 0x00, 0x61, 0x04, 0x70, 0x00, 0x5A, 0x03, 0x79, 0x00, 0x57, 0x04, 0xD6, 0x00, 0x68,
-	0x03, 0xB5, 0x00, 0x01, 0x06, 0x3A, 0x00, 0x09, 0x03, 0xF9, 0x00, 0x8B, 0x04, 0xBC, 0x00, 0x60,
-	0x04, 0xE3, 0x00, 0x30, 0x04, 0xE3, 0x00, 0x8B, 0x01, 0xFC, 0x00, 0x00, 0x02, 0x36, 0x00, 0x26,
-	0x05, 0x5E, 0x00, 0x25, 0x05, 0x5E, 0x00, 0x25, 0x04, 0x86, 0x00, 0x01, 0x04, 0xC6, 0x00, 0x32,
-	0x02, 0x9E, 0xFF, 0xF4, 0x05, 0x38, 0x00, 0x1D, 0x05, 0x38, 0x00, 0x1D, 0x05, 0x38, 0x00, 0x1D,
-	0x05, 0x38, 0x00, 0x1D, 0x05, 0x38, 0x00, 0x1D, 0x05, 0x38, 0x00, 0x1D, 0x05, 0x38, 0x00, 0x1D,
-	0x05, 0x35, 0x00, 0x78, 0x04, 0x8C, 0x00, 0xA9, 0x04, 0x8C, 0x00, 0xA9, 0x04, 0x8C, 0x00, 0xA9,
-	0x04, 0x8C, 0x00, 0xA9, 0x02, 0x2D, 0xFF, 0xDF, 0x02, 0x2D, 0x00, 0xB1, 0x02, 0x2D, 0xFF, 0xEA,
-	0x02, 0x2D, 0xFF, 0xD5, 0x05, 0xB5, 0x00, 0xA9, 0x05, 0x81, 0x00, 0x77, 0x05, 0x81, 0x00, 0x77,
-	0x05, 0x81, 0x00, 0x77, 0x05, 0x81, 0x00, 0x77, 0x05, 0x81, 0x00, 0x77, 0x05, 0x30, 0x00, 0x8C,
-	0x05, 0x30, 0x00, 0x8C, 0x05, 0x30, 0x00, 0x8C, 0x05, 0x30, 0x00, 0x8C, 0x04, 0xCE, 0x00, 0x0F,
-	0x04, 0x5A, 0x00, 0x6D, 0x04, 0x5A, 0x00, 0x6D, 0x04, 0x5A, 0x00, 0x6D, 0x04, 0x5A, 0x00, 0x6D,
-	0x04, 0x5A, 0x00, 0x6D, 0x04, 0x5A, 0x00, 0x6D, 0x04, 0x5A, 0x00, 0x6D, 0x04, 0x30, 0x00, 0x5D,
-	0x04, 0x3E, 0x00, 0x5D, 0x04, 0x3E, 0x00, 0x5D, 0x04, 0x3E, 0x00, 0x5D, 0x04, 0x3E, 0x00, 0x5D,
-	0x01, 0xFB, 0xFF, 0xC4, 0x01, 0xFB, 0x00, 0x96, 0x01, 0xFB, 0xFF, 0xCF, 0x01, 0xFB, 0xFF, 0xBA,
-	0x04, 0x6B, 0x00, 0x8D, 0x04, 0x90, 0x00, 0x5C, 0x04, 0x90, 0x00, 0x5C, 0x04, 0x90, 0x00, 0x5C,
-	0x04, 0x90, 0x00, 0x5C, 0x04, 0x90, 0x00, 0x5C, 0x04, 0x69, 0x00, 0x89, 0x04, 0x69, 0x00, 0x89,
-	0x04, 0x69, 0x00, 0x89, 0x04, 0x69, 0x00, 0x89, 0x03, 0xC9, 0x00, 0x16, 0x03, 0xC9, 0x00, 0x16,
-	0x05, 0x38, 0x00, 0x1D, 0x04, 0x5A, 0x00, 0x6D, 0x05, 0x38, 0x00, 0x1D, 0x04, 0x5A, 0x00, 0x6D,
-	0x05, 0x38, 0x00, 0x1D, 0x04, 0x5A, 0x00, 0x6D, 0x05, 0x35, 0x00, 0x78, 0x04, 0x30, 0x00, 0x5D,
-	0x05, 0x35, 0x00, 0x78, 0x04, 0x30, 0x00, 0x5D, 0x05, 0x35, 0x00, 0x78, 0x04, 0x30, 0x00, 0x5D,
-	0x05, 0x35, 0x00, 0x78, 0x04, 0x30, 0x00, 0x5D, 0x05, 0x40, 0x00, 0xA9, 0x05, 0x19, 0x00, 0x5F,
-	0x04, 0x8C, 0x00, 0xA9, 0x04, 0x3E, 0x00, 0x5D, 0x04, 0x8C, 0x00, 0xA9, 0x04, 0x3E, 0x00, 0x5D,
-	0x04, 0x8C, 0x00, 0xA9, 0x04, 0x3E, 0x00, 0x5D, 0x04, 0x8C, 0x00, 0xA9, 0x04, 0x3E, 0x00, 0x5D,
-	0x04, 0x8C, 0x00, 0xA9, 0x04, 0x3E, 0x00, 0x5D, 0x05, 0x73, 0x00, 0x7A, 0x04, 0x7E, 0x00, 0x61,
-	0x05, 0x73, 0x00, 0x7A, 0x04, 0x7E, 0x00, 0x61, 0x05, 0x73, 0x00, 0x7A, 0x04, 0x7E, 0x00, 0x61,
-	0x05, 0x73, 0x00, 0x7A, 0x04, 0x7E, 0x00, 0x61, 0x05, 0xB5, 0x00, 0xA9, 0x04, 0x68, 0x00, 0x8D,
-	0x02, 0x2D, 0xFF, 0xB6, 0x01, 0xFB, 0xFF, 0x9B, 0x02, 0x2D, 0xFF, 0xCD, 0x01, 0xFB, 0xFF, 0xB2,
-	0x02, 0x2D, 0xFF, 0xEC, 0x01, 0xFB, 0xFF, 0xD1, 0x02, 0x2D, 0x00, 0x17, 0x01, 0xF2, 0xFF, 0xFA,
-	0x02, 0x2D, 0x00, 0xAA, 0x06, 0x97, 0x00, 0xB7, 0x03, 0xDC, 0x00, 0x8E, 0x04, 0x6A, 0x00, 0x35,
-	0x02, 0x04, 0xFF, 0xB4, 0x05, 0x05, 0x00, 0xA9, 0x04, 0x0E, 0x00, 0x8D, 0x04, 0x4F, 0x00, 0xA2,
-	0x01, 0xF2, 0x00, 0x93, 0x04, 0x4F, 0x00, 0xA9, 0x01, 0xF2, 0x00, 0x56, 0x04, 0x4F, 0x00, 0xA9,
-	0x02, 0x88, 0x00, 0x9C, 0x04, 0x4F, 0x00, 0xA9, 0x02, 0xCE, 0x00, 0x9C, 0x05, 0xB5, 0x00, 0xA9,
-	0x04, 0x6B, 0x00, 0x8D, 0x05, 0xB5, 0x00, 0xA9, 0x04, 0x6B, 0x00, 0x8D, 0x05, 0xB5, 0x00, 0xA9,
-	0x04, 0x6B, 0x00, 0x8D, 0x04, 0x6B, 0xFF, 0xBB, 0x05, 0x81, 0x00, 0x77, 0x04, 0x90, 0x00, 0x5C,
-	0x05, 0x81, 0x00, 0x77, 0x04, 0x90, 0x00, 0x5C, 0x05, 0x81, 0x00, 0x77, 0x04, 0x90, 0x00, 0x5C,
-	0x04, 0xEE, 0x00, 0xA9, 0x02, 0xB6, 0x00, 0x8D, 0x04, 0xEE, 0x00, 0xA9, 0x02, 0xB6, 0x00, 0x53,
-	0x04, 0xEE, 0x00, 0xA9, 0x02, 0xB6, 0x00, 0x64, 0x04, 0xC0, 0x00, 0x51, 0x04, 0x21, 0x00, 0x5F,
-	0x04, 0xC0, 0x00, 0x51, 0x04, 0x21, 0x00, 0x5F, 0x04, 0xC0, 0x00, 0x51, 0x04, 0x21, 0x00, 0x5F,
-	0x04, 0xC0, 0x00, 0x51, 0x04, 0x21, 0x00, 0x5F, 0x04, 0xC0, 0x00, 0x51, 0x04, 0x21, 0x00, 0x5F,
-	0x04, 0xC6, 0x00, 0x32, 0x02, 0x9E, 0x00, 0x09, 0x04, 0xC6, 0x00, 0x32, 0x02, 0x9E, 0x00, 0x09,
-	0x04, 0xC6, 0x00, 0x32, 0x02, 0xC6, 0x00, 0x09, 0x05, 0x30, 0x00, 0x8C, 0x04, 0x69, 0x00, 0x89,
-	0x05, 0x30, 0x00, 0x8C, 0x04, 0x69, 0x00, 0x89, 0x05, 0x30, 0x00, 0x8C, 0x04, 0x69, 0x00, 0x89,
-	0x05, 0x30, 0x00, 0x8C, 0x04, 0x69, 0x00, 0x89, 0x05, 0x30, 0x00, 0x8C, 0x04, 0x69, 0x00, 0x89,
-	0x05, 0x30, 0x00, 0x8C, 0x04, 0x69, 0x00, 0x89, 0x07, 0x19, 0x00, 0x3D, 0x06, 0x03, 0x00, 0x2B,
-	0x04, 0xCE, 0x00, 0x0F, 0x03, 0xC9, 0x00, 0x16, 0x04, 0xCE, 0x00, 0x0F, 0x04, 0xCB, 0x00, 0x57,
-	0x03, 0xF8, 0x00, 0x59, 0x04, 0xCB, 0x00, 0x57, 0x03, 0xF8, 0x00, 0x59, 0x04, 0xCB, 0x00, 0x57,
-	0x03, 0xF8, 0x00, 0x59, 0x07, 0x7A, 0xFF, 0xF1, 0x06, 0xC2, 0x00, 0x4F, 0x05, 0x81, 0x00, 0x77,
-	0x04, 0x89, 0x00, 0x5C, 0x04, 0x80, 0xFF, 0xBD, 0x04, 0x80, 0xFF, 0xBD, 0x04, 0x27, 0x00, 0x29,
-	0x04, 0x86, 0x00, 0x14, 0x04, 0x86, 0x00, 0x14, 0x04, 0x86, 0x00, 0x14, 0x04, 0x86, 0x00, 0x14,
-	0x04, 0x86, 0x00, 0x14, 0x04, 0x86, 0x00, 0x14, 0x04, 0x86, 0x00, 0x14, 0x04, 0x7C, 0x00, 0x61,
-	0x03, 0xE6, 0x00, 0x8B, 0x03, 0xE6, 0x00, 0x8B, 0x03, 0xE6, 0x00, 0x8B, 0x03, 0xE6, 0x00, 0x8B,
-	0x01, 0xE9, 0xFF, 0xBC, 0x01, 0xE9, 0x00, 0x8E, 0x01, 0xE9, 0xFF, 0xC7, 0x01, 0xE9, 0xFF, 0xB2,
-	0x04, 0xE3, 0x00, 0x8B, 0x04, 0xBC, 0x00, 0x60, 0x04, 0xBC, 0x00, 0x60, 0x04, 0xBC, 0x00, 0x60,
-	0x04, 0xBC, 0x00, 0x60, 0x04, 0xBC, 0x00, 0x60, 0x04, 0x7D, 0x00, 0x75, 0x04, 0x7D, 0x00, 0x75,
-	0x04, 0x7D, 0x00, 0x75, 0x04, 0x7D, 0x00, 0x75, 0x04, 0x2B, 0x00, 0x0E, 0x04, 0x86, 0x00, 0x14,
-	0x04, 0x86, 0x00, 0x14, 0x04, 0x86, 0x00, 0x14, 0x04, 0x7C, 0x00, 0x61, 0x04, 0x7C, 0x00, 0x61,
-	0x04, 0x7C, 0x00, 0x61, 0x04, 0x7C, 0x00, 0x61, 0x04, 0x80, 0x00, 0x8B, 0x03, 0xE6, 0x00, 0x8B,
-	0x03, 0xE6, 0x00, 0x8B, 0x03, 0xE6, 0x00, 0x8B, 0x03, 0xE6, 0x00, 0x8B, 0x03, 0xE6, 0x00, 0x8B,
-	0x04, 0xAC, 0x00, 0x64, 0x04, 0xAC, 0x00, 0x64, 0x04, 0xAC, 0x00, 0x64, 0x04, 0xAC, 0x00, 0x64,
-	0x04, 0xE4, 0x00, 0x8B, 0x01, 0xE9, 0xFF, 0x93, 0x01, 0xE9, 0xFF, 0xAA, 0x01, 0xE9, 0xFF, 0xC9,
-	0x01, 0xE9, 0x00, 0x05, 0x01, 0xE9, 0x00, 0x87, 0x03, 0xCF, 0x00, 0x2C, 0x04, 0x55, 0x00, 0x8B,
-	0x03, 0xB5, 0x00, 0x83, 0x03, 0xB5, 0x00, 0x8B, 0x03, 0xB5, 0x00, 0x8B, 0x03, 0xB5, 0x00, 0x8B,
-	0x04, 0xE3, 0x00, 0x8B, 0x04, 0xE3, 0x00, 0x8B, 0x04, 0xE3, 0x00, 0x8B, 0x04, 0xBC, 0x00, 0x60,
-	0x04, 0xBC, 0x00, 0x60, 0x04, 0xBC, 0x00, 0x60, 0x04, 0x4A, 0x00, 0x8A, 0x04, 0x4A, 0x00, 0x8A,
-	0x04, 0x4A, 0x00, 0x8A, 0x04, 0x20, 0x00, 0x44, 0x04, 0x20, 0x00, 0x44, 0x04, 0x20, 0x00, 0x44,
-	0x04, 0x20, 0x00, 0x44, 0x04, 0x27, 0x00, 0x29, 0x04, 0x27, 0x00, 0x29, 0x04, 0x27, 0x00, 0x29,
-	0x04, 0x7D, 0x00, 0x75, 0x04, 0x7D, 0x00, 0x75, 0x04, 0x7D, 0x00, 0x75, 0x04, 0x7D, 0x00, 0x75,
-	0x04, 0x7D, 0x00, 0x75, 0x04, 0x7D, 0x00, 0x75, 0x06, 0x15, 0x00, 0x31, 0x04, 0x2B, 0x00, 0x0E,
-	0x04, 0x2B, 0x00, 0x0E, 0x04, 0x23, 0x00, 0x48, 0x04, 0x23, 0x00, 0x48, 0x04, 0x23, 0x00, 0x48,
-	0x05, 0x38, 0x00, 0x1D, 0x04, 0xF0, 0xFF, 0x8C, 0x06, 0x19, 0xFF, 0x9A, 0x02, 0x91, 0xFF, 0xA0,
-	0x05, 0x95, 0xFF, 0xFA, 0x05, 0x32, 0xFF, 0x76, 0x05, 0x66, 0xFF, 0xFC, 0x02, 0x98, 0xFF, 0x9B,
-	0x05, 0x38, 0x00, 0x1D, 0x04, 0xFC, 0x00, 0xA9, 0x04, 0x8C, 0x00, 0xA9, 0x04, 0xCB, 0x00, 0x57,
-	0x05, 0xB5, 0x00, 0xA9, 0x02, 0x2D, 0x00, 0xB7, 0x05, 0x05, 0x00, 0xA9, 0x06, 0xFC, 0x00, 0xA9,
-	0x05, 0xB5, 0x00, 0xA9, 0x05, 0x81, 0x00, 0x77, 0x05, 0x0C, 0x00, 0xA9, 0x04, 0xC6, 0x00, 0x32,
-	0x04, 0xCE, 0x00, 0x0F, 0x05, 0x04, 0x00, 0x3A, 0x02, 0x2D, 0xFF, 0xD5, 0x04, 0xCE, 0x00, 0x0F,
-	0x04, 0x86, 0x00, 0x64, 0x04, 0x51, 0x00, 0x64, 0x04, 0x89, 0x00, 0x92, 0x02, 0x98, 0x00, 0xC3,
-	0x04, 0x5E, 0x00, 0x90, 0x04, 0x74, 0x00, 0x9B, 0x04, 0x90, 0x00, 0x5C, 0x04, 0x89, 0x00, 0x9B,
-	0x03, 0xE0, 0x00, 0x21, 0x04, 0x70, 0x00, 0x5A, 0x02, 0x98, 0xFF, 0xE4, 0x04, 0x5E, 0x00, 0x90,
-	0x04, 0x90, 0x00, 0x5C, 0x04, 0x5E, 0x00, 0x90, 0x06, 0x97, 0x00, 0x7A, 0x04, 0x8C, 0x00, 0xA9,
-	0x04, 0x73, 0x00, 0xB2, 0x04, 0xC0, 0x00, 0x51, 0x02, 0x2D, 0x00, 0xB7, 0x02, 0x2D, 0xFF, 0xD5,
-	0x04, 0x6A, 0x00, 0x35, 0x05, 0x24, 0x00, 0xB2, 0x05, 0x05, 0x00, 0xA9, 0x05, 0x08, 0x00, 0x4D,
-	0x05, 0x38, 0x00, 0x1D, 0x04, 0xFC, 0x00, 0xA9, 0x04, 0x73, 0x00, 0xB2, 0x04, 0x8C, 0x00, 0xA9,
-	0x05, 0xB5, 0x00, 0xB2, 0x06, 0xFC, 0x00, 0xA9, 0x05, 0xB5, 0x00, 0xA9, 0x05, 0x81, 0x00, 0x77,
-	0x05, 0xB5, 0x00, 0xB2, 0x05, 0x0C, 0x00, 0xA9, 0x05, 0x35, 0x00, 0x78, 0x04, 0xC6, 0x00, 0x32,
-	0x05, 0x04, 0x00, 0x3A, 0x04, 0x5A, 0x00, 0x6D, 0x04, 0x3E, 0x00, 0x5D, 0x04, 0x9E, 0x00, 0x9D,
-	0x04, 0x90, 0x00, 0x5C, 0x04, 0x7E, 0x00, 0x8C, 0x04, 0x30, 0x00, 0x5D, 0x03, 0xC9, 0x00, 0x16,
-	0x03, 0xF8, 0x00, 0x2A, 0x04, 0x3E, 0x00, 0x5D, 0x03, 0x5C, 0x00, 0x9B, 0x04, 0x21, 0x00, 0x5F,
-	0x01, 0xF2, 0x00, 0x8E, 0x01, 0xFB, 0xFF, 0xBA, 0x01, 0xEA, 0xFF, 0xBE, 0x04, 0x53, 0x00, 0x9D,
-	0x03, 0xC9, 0x00, 0x16, 0x07, 0x19, 0x00, 0x3D, 0x06, 0x03, 0x00, 0x2B, 0x07, 0x19, 0x00, 0x3D,
-	0x06, 0x03, 0x00, 0x2B, 0x07, 0x19, 0x00, 0x3D, 0x06, 0x03, 0x00, 0x2B, 0x04, 0xCE, 0x00, 0x0F,
-	0x03, 0xC9, 0x00, 0x16, 0x01, 0x66, 0x00, 0x68, 0x02, 0x90, 0x00, 0x89, 0x04, 0x20, 0x00, 0xA1,
-	0x02, 0x04, 0xFF, 0xB4, 0x01, 0x9A, 0x00, 0x30, 0x06, 0xFC, 0x00, 0xA9, 0x07, 0x04, 0x00, 0x8B,
-	0x05, 0x38, 0x00, 0x1D, 0x04, 0x5A, 0x00, 0x6D, 0x04, 0x8C, 0x00, 0xA9, 0x05, 0xB5, 0x00, 0xB2,
-	0x04, 0x3E, 0x00, 0x5D, 0x04, 0x9E, 0x00, 0x9D, 0x05, 0x89, 0x00, 0x5A, 0x05, 0x9A, 0x00, 0x60,
-	0x05, 0x0B, 0x00, 0x16, 0x04, 0x04, 0xFF, 0xFB, 0x08, 0x59, 0x00, 0x5C, 0x09, 0x4A, 0x00, 0x77,
-	0x04, 0xC0, 0x00, 0x50, 0x04, 0x10, 0x00, 0x58, 0x05, 0x35, 0x00, 0x78, 0x04, 0x30, 0x00, 0x5D,
-	0x04, 0xCE, 0x00, 0x0F, 0x04, 0x03, 0x00, 0x2F, 0x02, 0x2D, 0x00, 0xB7, 0x07, 0x43, 0x00, 0x1B,
-	0x06, 0x21, 0x00, 0x16, 0x02, 0x2D, 0x00, 0xB7, 0x05, 0x38, 0x00, 0x1D, 0x04, 0x5A, 0x00, 0x6D,
-	0x05, 0x38, 0x00, 0x1D, 0x04, 0x5A, 0x00, 0x6D, 0x07, 0x7A, 0xFF, 0xF1, 0x06, 0xC2, 0x00, 0x4F,
-	0x04, 0x8C, 0x00, 0xA9, 0x04, 0x3E, 0x00, 0x5D, 0x05, 0x87, 0x00, 0x5E, 0x04, 0x38, 0x00, 0x63,
-	0x04, 0x38, 0x00, 0x63, 0x07, 0x43, 0x00, 0x1B, 0x06, 0x21, 0x00, 0x16, 0x04, 0xC0, 0x00, 0x50,
-	0x04, 0x10, 0x00, 0x58, 0x05, 0xB5, 0x00, 0xB2, 0x04, 0x9E, 0x00, 0x9D, 0x05, 0xB5, 0x00, 0xB2,
-	0x04, 0x9E, 0x00, 0x9D, 0x05, 0x81, 0x00, 0x77, 0x04, 0x90, 0x00, 0x5C, 0x05, 0x72, 0x00, 0x67,
-	0x04, 0x8C, 0x00, 0x5C, 0x05, 0x72, 0x00, 0x67, 0x04, 0x8C, 0x00, 0x5C, 0x05, 0x65, 0x00, 0x94,
-	0x04, 0x4E, 0x00, 0x64, 0x05, 0x08, 0x00, 0x4D, 0x03, 0xC9, 0x00, 0x16, 0x05, 0x08, 0x00, 0x4D,
-	0x03, 0xC9, 0x00, 0x16, 0x05, 0x08, 0x00, 0x4D, 0x03, 0xC9, 0x00, 0x16, 0x05, 0x7A, 0x00, 0x97,
-	0x04, 0x5A, 0x00, 0x68, 0x06, 0xEB, 0x00, 0xB2, 0x06, 0x36, 0x00, 0x9E, 0x04, 0x83, 0x00, 0x5F,
-	0x05, 0x38, 0x00, 0x1D, 0x04, 0x5A, 0x00, 0x6D, 0x05, 0x38, 0x00, 0x1D, 0x04, 0x5A, 0x00, 0x6D,
-	0x05, 0x38, 0x00, 0x1D, 0x04, 0x5A, 0x00, 0x6D, 0x05, 0x38, 0x00, 0x1D, 0x04, 0x5A, 0xFF, 0xC9,
-	0x05, 0x38, 0x00, 0x1D, 0x04, 0x5A, 0x00, 0x6D, 0x05, 0x38, 0x00, 0x1D, 0x04, 0x5A, 0x00, 0x6D,
-	0x05, 0x38, 0x00, 0x1D, 0x04, 0x5A, 0x00, 0x6D, 0x05, 0x38, 0x00, 0x1D, 0x04, 0x5A, 0x00, 0x6D,
-	0x05, 0x38, 0x00, 0x1D, 0x04, 0x5A, 0x00, 0x6D, 0x05, 0x38, 0x00, 0x1D, 0x04, 0x5A, 0x00, 0x6D,
-	0x05, 0x38, 0x00, 0x1D, 0x04, 0x5A, 0x00, 0x6D, 0x05, 0x38, 0x00, 0x1D, 0x04, 0x5A, 0x00, 0x6D,
-	0x04, 0x8C, 0x00, 0xA9, 0x04, 0x3E, 0x00, 0x5D, 0x04, 0x8C, 0x00, 0xA9, 0x04, 0x3E, 0x00, 0x5D,
-	0x04, 0x8C, 0x00, 0xA9, 0x04, 0x3E, 0x00, 0x5D, 0x04, 0x8C, 0x00, 0xA9, 0x04, 0x3E, 0x00, 0x5D,
-	0x04, 0x8C, 0xFF, 0xEE, 0x04, 0x3E, 0xFF, 0xB8, 0x04, 0x8C, 0x00, 0xA9, 0x04, 0x3E, 0x00, 0x5D,
-	0x04, 0x8C, 0x00, 0xA9, 0x04, 0x3E, 0x00, 0x5D, 0x04, 0x8C, 0x00, 0xA9, 0x04, 0x3E, 0x00, 0x5D,
-	0x02, 0x2D, 0x00, 0xB7, 0x01, 0xFB, 0x00, 0x9C, 0x02, 0x2D, 0x00, 0xA4, 0x01, 0xF2, 0x00, 0x86,
-	0x05, 0x81, 0x00, 0x77, 0x04, 0x90, 0x00, 0x5C, 0x05, 0x81, 0x00, 0x77, 0x04, 0x90, 0x00, 0x5C,
-	0x05, 0x81, 0x00, 0x77, 0x04, 0x90, 0x00, 0x5C, 0x05, 0x81, 0x00, 0x46, 0x04, 0x90, 0xFF, 0xC2,
-	0x05, 0x81, 0x00, 0x77, 0x04, 0x90, 0x00, 0x5C, 0x05, 0x81, 0x00, 0x77, 0x04, 0x90, 0x00, 0x5C,
-	0x05, 0x81, 0x00, 0x77, 0x04, 0x90, 0x00, 0x5C, 0x05, 0x7F, 0x00, 0x66, 0x04, 0x93, 0x00, 0x5C,
-	0x05, 0x7F, 0x00, 0x66, 0x04, 0x93, 0x00, 0x5C, 0x05, 0x7F, 0x00, 0x66, 0x04, 0x93, 0x00, 0x5C,
-	0x05, 0x7F, 0x00, 0x66, 0x04, 0x93, 0x00, 0x5C, 0x05, 0x7F, 0x00, 0x66, 0x04, 0x93, 0x00, 0x5C,
-	0x05, 0x30, 0x00, 0x8C, 0x04, 0x69, 0x00, 0x89, 0x05, 0x30, 0x00, 0x8C, 0x04, 0x69, 0x00, 0x89,
-	0x05, 0x90, 0x00, 0x8C, 0x04, 0xF3, 0x00, 0x89, 0x05, 0x90, 0x00, 0x8C, 0x04, 0xF3, 0x00, 0x89,
-	0x05, 0x90, 0x00, 0x8C, 0x04, 0xF3, 0x00, 0x89, 0x05, 0x90, 0x00, 0x8C, 0x04, 0xF3, 0x00, 0x89,
-	0x05, 0x90, 0x00, 0x8C, 0x04, 0xF3, 0x00, 0x89, 0x04, 0xCE, 0x00, 0x0F, 0x03, 0xC9, 0x00, 0x16,
-	0x04, 0xCE, 0x00, 0x0F, 0x03, 0xC9, 0x00, 0x16, 0x04, 0xCE, 0x00, 0x0F, 0x03, 0xC9, 0x00, 0x16,
-	0x04, 0xA1, 0x00, 0x5F, 0x04, 0xC6, 0x00, 0x32, 0x03, 0xD9, 0x00, 0x28, 0x05, 0x7A, 0x00, 0x97,
-	0x04, 0x5A, 0x00, 0x68, 0x04, 0x73, 0x00, 0xB2, 0x03, 0x5C, 0x00, 0x9B, 0x06, 0x30, 0x00, 0x3F,
-	0x04, 0xBE, 0xFF, 0xDD, 0x04, 0x68, 0x00, 0x8D, 0x05, 0x05, 0xFF, 0xD4, 0x05, 0x05, 0xFF, 0xD4,
-	0x04, 0x73, 0x00, 0x03, 0x03, 0x5C, 0xFF, 0xFD, 0x05, 0x38, 0x00, 0x0B, 0x04, 0x28, 0xFF, 0xD3,
-	0x04, 0xCE, 0x00, 0x0F, 0x04, 0x03, 0x00, 0x2F, 0x05, 0x04, 0x00, 0x3A, 0x03, 0xF8, 0x00, 0x2A,
-	0x04, 0x51, 0x00, 0x64, 0x04, 0x6C, 0x00, 0x12, 0x06, 0x3F, 0x00, 0x90, 0x04, 0x7F, 0x00, 0x5E,
-	0x04, 0x7F, 0x00, 0x5F, 0x04, 0x7F, 0x00, 0x35, 0x04, 0x7F, 0x00, 0x9A, 0x04, 0x93, 0x00, 0x99,
-	0x04, 0xA7, 0x00, 0x85, 0x04, 0x93, 0x00, 0x64, 0x04, 0xA7, 0x00, 0x87, 0x05, 0x73, 0x00, 0x7A,
-	0x04, 0x7E, 0x00, 0x61, 0x05, 0xB5, 0x00, 0xA9, 0x04, 0x6B, 0x00, 0x8D, 0x05, 0x38, 0x00, 0x1D,
-	0x04, 0x5A, 0x00, 0x3A, 0x04, 0x8C, 0x00, 0x5F, 0x04, 0x3E, 0x00, 0x29, 0x02, 0x2D, 0xFF, 0x0B,
-	0x01, 0xFB, 0xFE, 0xF0, 0x05, 0x81, 0x00, 0x77, 0x04, 0x90, 0x00, 0x33, 0x04, 0xEE, 0x00, 0x56,
-	0x02, 0xB6, 0xFF, 0x8C, 0x05, 0x30, 0x00, 0x8C, 0x04, 0x69, 0x00, 0x2B, 0x04, 0xA7, 0xFF, 0x38,
-	0x04, 0xFC, 0x00, 0xA9, 0x04, 0x7E, 0x00, 0x8C, 0x05, 0x40, 0x00, 0xA9, 0x04, 0x83, 0x00, 0x5F,
-	0x05, 0x40, 0x00, 0xA9, 0x04, 0x83, 0x00, 0x5F, 0x05, 0xB5, 0x00, 0xA9, 0x04, 0x68, 0x00, 0x8D,
-	0x05, 0x05, 0x00, 0xA9, 0x04, 0x0E, 0x00, 0x8D, 0x05, 0x05, 0x00, 0xA9, 0x04, 0x0E, 0x00, 0x8D,
-	0x04, 0x4F, 0x00, 0xA9, 0x01, 0xF2, 0x00, 0x86, 0x06, 0xFC, 0x00, 0xA9, 0x07, 0x04, 0x00, 0x8B,
-	0x05, 0xB5, 0x00, 0xA9, 0x04, 0x6B, 0x00, 0x8D, 0x05, 0x81, 0x00, 0x77, 0x05, 0x0C, 0x00, 0xA9,
-	0x04, 0x7E, 0x00, 0x8C, 0x04, 0xEE, 0x00, 0xA9, 0x02, 0xB6, 0x00, 0x83, 0x04, 0xC0, 0x00, 0x51,
-	0x04, 0x21, 0x00, 0x5F, 0x04, 0xC6, 0x00, 0x32, 0x02, 0x9E, 0x00, 0x09, 0x05, 0x30, 0x00, 0x8C,
-	0x05, 0x18, 0x00, 0x1D, 0x03, 0xE0, 0x00, 0x21, 0x05, 0x18, 0x00, 0x1D, 0x03, 0xE0, 0x00, 0x21,
-	0x07, 0x19, 0x00, 0x3D, 0x06, 0x03, 0x00, 0x2B, 0x04, 0xCB, 0x00, 0x57, 0x03, 0xF8, 0x00, 0x59,
-	0x05, 0xC7, 0xFE, 0x78, 0x04, 0x86, 0x00, 0x14, 0x04, 0x22, 0xFF, 0x9F, 0x05, 0x20, 0xFF, 0xBB,
-	0x02, 0x25, 0xFF, 0xC0, 0x04, 0xC6, 0xFF, 0xDF, 0x04, 0x67, 0xFF, 0x55, 0x04, 0xFD, 0xFF, 0xF7,
-	0x04, 0x86, 0x00, 0x14, 0x04, 0x51, 0x00, 0x8B, 0x03, 0xE6, 0x00, 0x8B, 0x04, 0x23, 0x00, 0x48,
-	0x04, 0xE4, 0x00, 0x8B, 0x01, 0xE9, 0x00, 0x98, 0x04, 0x55, 0x00, 0x8B, 0x06, 0x02, 0x00, 0x8B,
-	0x04, 0xE3, 0x00, 0x8B, 0x04, 0xBC, 0x00, 0x60, 0x04, 0x5D, 0x00, 0x8B, 0x04, 0x27, 0x00, 0x29,
-	0x04, 0x2B, 0x00, 0x0E, 0x04, 0x54, 0x00, 0x27, 0x01, 0xE9, 0xFF, 0xB2, 0x04, 0x2B, 0x00, 0x0E,
-	0x03, 0xE6, 0x00, 0x8B, 0x03, 0xAF, 0x00, 0x8B, 0x04, 0x20, 0x00, 0x44, 0x01, 0xE9, 0x00, 0x98,
-	0x01, 0xE9, 0xFF, 0xB2, 0x03, 0xCF, 0x00, 0x2C, 0x04, 0x55, 0x00, 0x8B, 0x04, 0x20, 0x00, 0x23,
-	0x04, 0x86, 0x00, 0x14, 0x04, 0x51, 0x00, 0x8B, 0x03, 0xAF, 0x00, 0x8B, 0x03, 0xE6, 0x00, 0x8B,
-	0x04, 0xEC, 0x00, 0x8B, 0x06, 0x02, 0x00, 0x8B, 0x04, 0xE4, 0x00, 0x8B, 0x04, 0xBC, 0x00, 0x60,
-	0x04, 0xCF, 0x00, 0x8B, 0x04, 0x5D, 0x00, 0x8B, 0x04, 0x7C, 0x00, 0x61, 0x04, 0x27, 0x00, 0x29,
-	0x04, 0x54, 0x00, 0x27, 0x04, 0x40, 0x00, 0x48, 0x04, 0xE4, 0x00, 0x8B, 0x04, 0x7C, 0x00, 0x61,
-	0x04, 0x2B, 0x00, 0x0E, 0x05, 0xC4, 0x00, 0x02, 0x04, 0xEC, 0x00, 0x8B, 0x04, 0x20, 0x00, 0x23,
-	0x05, 0x67, 0x00, 0x61, 0x05, 0xB8, 0x00, 0x98, 0x06, 0x3A, 0x00, 0x09, 0x04, 0xBC, 0x00, 0x60,
-	0x04, 0x20, 0x00, 0x44, 0x06, 0x15, 0x00, 0x31, 0x06, 0x15, 0x00, 0x31, 0x06, 0x15, 0x00, 0x31,
-	0x04, 0x2B, 0x00, 0x0E, 0x05, 0x38, 0x00, 0x1D, 0x04, 0x5A, 0x00, 0x6D, 0x04, 0x8C, 0x00, 0xA9,
-	0x04, 0x3E, 0x00, 0x5D, 0x04, 0x86, 0x00, 0x14, 0x03, 0xE6, 0x00, 0x8B, 0x01, 0xFB, 0x00, 0x86,
-	0x00, 0x01, 0x00, 0x00, 0x00, 0x0A, 0x01, 0xAC, 0x03, 0x00, 0x00, 0x04, 0x44, 0x46, 0x4C, 0x54,
-	0x01, 0x70, 0x63, 0x79, 0x72, 0x6C, 0x01, 0x70, 0x67, 0x72, 0x65, 0x6B, 0x01, 0x70, 0x6C, 0x61,
-	0x74, 0x6E, 0x00, 0x1A, 0x01, 0x26, 0x00, 0x07, 0x41, 0x5A, 0x45, 0x20, 0x00, 0xF6, 0x43, 0x52,
-	0x54, 0x20, 0x00, 0xF6, 0x46, 0x52, 0x41, 0x20, 0x00, 0xC4, 0x4D, 0x4F, 0x4C, 0x20, 0x00, 0x92,
-	0x4E, 0x41, 0x56, 0x20, 0x00, 0x60, 0x52, 0x4F, 0x4D, 0x20, 0x00, 0x2E, 0x54, 0x52, 0x4B, 0x20,
-	0x00, 0xF6, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03,
-	0x00, 0x04, 0x00, 0x06, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x0D, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x10,
-	0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18,
-	0x00, 0x19, 0x00, 0x1A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02,
-	0x00, 0x03, 0x00, 0x04, 0x00, 0x06, 0x00, 0x08, 0x00, 0x0B, 0x00, 0x0D, 0x00, 0x0E, 0x00, 0x0F,
-	0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17,
-	0x00, 0x18, 0x00, 0x19, 0x00, 0x1A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01,
-	0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x06, 0x00, 0x08, 0x00, 0x0A, 0x00, 0x0D, 0x00, 0x0E,
-	0x00, 0x0F, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16,
-	0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x16, 0x00, 0x00,
-	0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x06, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0D,
-	0x00, 0x0E, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15,
-	0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x15,
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x08, 0x00, 0x0D,
-	0x00, 0x0E, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15,
-	0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x15,
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x07, 0x00, 0x08, 0x00, 0x0D,
-	0x00, 0x0E, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15,
-	0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1A, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x08,
-	0x00, 0x0D, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14,
-	0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1A, 0x00, 0x1B, 0x63, 0x32,
-	0x73, 0x63, 0x01, 0x4E, 0x63, 0x63, 0x6D, 0x70, 0x01, 0x46, 0x64, 0x6C, 0x69, 0x67, 0x01, 0x40,
-	0x64, 0x6E, 0x6F, 0x6D, 0x01, 0x3A, 0x66, 0x72, 0x61, 0x63, 0x01, 0x30, 0x6C, 0x69, 0x67, 0x61,
-	0x01, 0x2A, 0x6C, 0x69, 0x67, 0x61, 0x01, 0x1E, 0x6C, 0x69, 0x67, 0x61, 0x01, 0x16, 0x6C, 0x6E,
-	0x75, 0x6D, 0x01, 0x10, 0x6C, 0x6F, 0x63, 0x6C, 0x01, 0x0A, 0x6C, 0x6F, 0x63, 0x6C, 0x01, 0x04,
-	0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xFE, 0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xF8, 0x6E, 0x75, 0x6D, 0x72,
-	0x00, 0xF2, 0x6F, 0x6E, 0x75, 0x6D, 0x00, 0xEC, 0x70, 0x6E, 0x75, 0x6D, 0x00, 0xE6, 0x73, 0x6D,
-	0x63, 0x70, 0x00, 0xE0, 0x73, 0x73, 0x30, 0x31, 0x00, 0xDA, 0x73, 0x73, 0x30, 0x32, 0x00, 0xD4,
-	0x73, 0x73, 0x30, 0x33, 0x00, 0xCE, 0x73, 0x73, 0x30, 0x34, 0x00, 0xC8, 0x73, 0x73, 0x30, 0x35,
-	0x00, 0xC2, 0x73, 0x73, 0x30, 0x36, 0x00, 0xBC, 0x73, 0x73, 0x30, 0x37, 0x00, 0xB6, 0x73, 0x75,
-	0x62, 0x73, 0x00, 0xB0, 0x73, 0x75, 0x70, 0x73, 0x00, 0xAA, 0x74, 0x6E, 0x75, 0x6D, 0x00, 0xA4,
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x01,
-	0x00, 0x1E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11, 0x00, 0x00,
-	0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0E,
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01,
-	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x13, 0x00, 0x00,
-	0x00, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07,
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01,
-	0x00, 0x16, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x04, 0x00, 0x09,
-	0x00, 0x0A, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x03,
-	0x00, 0x17, 0x00, 0x18, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x01,
-	0x00, 0x0B, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-	0x00, 0x1F, 0x0E, 0xFC, 0x0B, 0x3E, 0x0A, 0xBE, 0x0A, 0xA4, 0x04, 0x00, 0x03, 0xEA, 0x03, 0xEA,
-	0x03, 0xC0, 0x03, 0xAC, 0x03, 0x82, 0x03, 0x5E, 0x03, 0x22, 0x03, 0x0E, 0x02, 0xFA, 0x02, 0xE6,
-	0x02, 0xCC, 0x02, 0xBA, 0x02, 0x78, 0x02, 0x5A, 0x02, 0x08, 0x01, 0xC2, 0x01, 0x60, 0x01, 0x02,
-	0x00, 0xEE, 0x00, 0xB4, 0x00, 0x92, 0x00, 0x70, 0x00, 0x92, 0x00, 0x70, 0x00, 0x4E, 0x00, 0x40,
-	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x86, 0x01, 0x8E, 0x00, 0x01,
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x78, 0x00, 0x0A, 0x01, 0x95, 0x00, 0x7A,
-	0x00, 0x73, 0x00, 0x74, 0x01, 0x96, 0x01, 0x97, 0x01, 0x98, 0x01, 0x99, 0x01, 0x9A, 0x01, 0x9B,
-	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x56, 0x00, 0x0A, 0x02, 0x58,
-	0x00, 0x7A, 0x00, 0x73, 0x00, 0x74, 0x02, 0x59, 0x02, 0x5A, 0x02, 0x5B, 0x02, 0x5C, 0x02, 0x5D,
-	0x02, 0x5E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x34, 0x00, 0x0A,
-	0x01, 0xE1, 0x01, 0xE0, 0x01, 0xDF, 0x02, 0x39, 0x02, 0x3A, 0x02, 0x3B, 0x02, 0x3C, 0x02, 0x3D,
-	0x02, 0x3E, 0x02, 0x3F, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x03, 0x00, 0x01,
-	0x00, 0x1C, 0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x02,
-	0x00, 0x01, 0x00, 0x14, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x01, 0x94, 0x01, 0x94,
-	0x00, 0x00, 0x01, 0xDF, 0x01, 0xE1, 0x00, 0x01, 0x02, 0x39, 0x02, 0x3F, 0x00, 0x04, 0x00, 0x01,
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x01, 0x81, 0x00, 0x01, 0x00, 0x01,
-	0x00, 0x13, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x2E, 0x00, 0x14,
-	0x04, 0xAC, 0x04, 0xAD, 0x02, 0x8B, 0x04, 0xA8, 0x04, 0xA9, 0x04, 0xAA, 0x04, 0xAB, 0x02, 0x80,
-	0x04, 0xAE, 0x00, 0x17, 0x00, 0x19, 0x00, 0x18, 0x00, 0x16, 0x00, 0x1B, 0x00, 0x14, 0x00, 0x1A,
-	0x00, 0x1D, 0x00, 0x1C, 0x00, 0x15, 0x04, 0xAF, 0x00, 0x02, 0x00, 0x06, 0x00, 0x1A, 0x00, 0x1A,
-	0x00, 0x00, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x01, 0x02, 0x64, 0x02, 0x69, 0x00, 0x02, 0x02, 0x6D,
-	0x02, 0x6D, 0x00, 0x08, 0x02, 0x6F, 0x02, 0x78, 0x00, 0x09, 0x02, 0x7F, 0x02, 0x7F, 0x00, 0x13,
-	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x2E, 0x00, 0x14, 0x02, 0x75,
-	0x02, 0x77, 0x02, 0x78, 0x02, 0x72, 0x02, 0x6F, 0x02, 0x71, 0x02, 0x70, 0x02, 0x73, 0x02, 0x76,
-	0x02, 0x74, 0x00, 0x1B, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1A,
-	0x00, 0x1C, 0x00, 0x1D, 0x00, 0x14, 0x00, 0x01, 0x00, 0x14, 0x00, 0x1A, 0x00, 0x1C, 0x02, 0x64,
-	0x02, 0x65, 0x02, 0x66, 0x02, 0x67, 0x02, 0x68, 0x02, 0x69, 0x02, 0x6D, 0x02, 0x7F, 0x02, 0x80,
-	0x02, 0x8B, 0x04, 0xA8, 0x04, 0xA9, 0x04, 0xAA, 0x04, 0xAB, 0x04, 0xAC, 0x04, 0xAD, 0x04, 0xAE,
-	0x04, 0xAF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x2E, 0x00, 0x14,
-	0x04, 0xAF, 0x02, 0x8B, 0x04, 0xA8, 0x04, 0xA9, 0x04, 0xAA, 0x04, 0xAB, 0x04, 0xAC, 0x02, 0x80,
-	0x04, 0xAD, 0x04, 0xAE, 0x02, 0x66, 0x02, 0x68, 0x02, 0x67, 0x02, 0x65, 0x02, 0x69, 0x02, 0x7F,
-	0x00, 0x1A, 0x02, 0x6D, 0x00, 0x1C, 0x02, 0x64, 0x00, 0x02, 0x00, 0x02, 0x00, 0x14, 0x00, 0x1D,
-	0x00, 0x00, 0x02, 0x6F, 0x02, 0x78, 0x00, 0x0A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08,
-	0x00, 0x02, 0x00, 0x2E, 0x00, 0x14, 0x02, 0x74, 0x02, 0x78, 0x02, 0x72, 0x02, 0x6F, 0x02, 0x71,
-	0x02, 0x70, 0x02, 0x75, 0x02, 0x73, 0x02, 0x77, 0x02, 0x76, 0x02, 0x69, 0x02, 0x64, 0x02, 0x65,
-	0x02, 0x66, 0x02, 0x67, 0x02, 0x68, 0x00, 0x1A, 0x00, 0x1C, 0x02, 0x6D, 0x02, 0x7F, 0x00, 0x02,
-	0x00, 0x04, 0x00, 0x14, 0x00, 0x1D, 0x00, 0x00, 0x02, 0x80, 0x02, 0x80, 0x00, 0x0A, 0x02, 0x8B,
-	0x02, 0x8B, 0x00, 0x0B, 0x04, 0xA8, 0x04, 0xAF, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-	0x00, 0x08, 0x00, 0x02, 0x00, 0x0C, 0x00, 0x03, 0x02, 0x88, 0x02, 0x89, 0x02, 0x89, 0x00, 0x01,
-	0x00, 0x03, 0x00, 0x49, 0x00, 0x4B, 0x02, 0x84, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08,
-	0x00, 0x02, 0x00, 0x1E, 0x00, 0x0C, 0x02, 0x5F, 0x02, 0x61, 0x02, 0x60, 0x02, 0x62, 0x02, 0x63,
-	0x02, 0x81, 0x02, 0x82, 0x02, 0x83, 0x02, 0x84, 0x02, 0x85, 0x02, 0x86, 0x02, 0x87, 0x00, 0x01,
-	0x00, 0x0C, 0x00, 0x27, 0x00, 0x28, 0x00, 0x2B, 0x00, 0x33, 0x00, 0x35, 0x00, 0x46, 0x00, 0x47,
-	0x00, 0x48, 0x00, 0x4B, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-	0x00, 0x08, 0x00, 0x02, 0x00, 0x1C, 0x00, 0x02, 0x02, 0x48, 0x02, 0x49, 0x00, 0x01, 0x00, 0x00,
-	0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x0A, 0x00, 0x02, 0x02, 0x46, 0x02, 0x47, 0x00, 0x01,
-	0x00, 0x02, 0x00, 0x2F, 0x00, 0x4F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01,
-	0x00, 0x06, 0x02, 0x0F, 0x00, 0x01, 0x00, 0x01, 0x00, 0x36, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-	0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x01, 0x89, 0x00, 0x01, 0x00, 0x01, 0x00, 0xBB, 0x00, 0x01,
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x01, 0xF8, 0x00, 0x01, 0x00, 0x01,
-	0x00, 0x4B, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x2A, 0x00, 0x03,
-	0x00, 0x20, 0x00, 0x16, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x04, 0x01, 0xDA, 0x00, 0x02, 0x00, 0x58,
-	0x00, 0x01, 0x00, 0x04, 0x01, 0xDB, 0x00, 0x02, 0x00, 0x58, 0x00, 0x01, 0x00, 0x04, 0x01, 0xD5,
-	0x00, 0x02, 0x00, 0x4A, 0x00, 0x01, 0x00, 0x03, 0x00, 0x4A, 0x00, 0x57, 0x00, 0x95, 0x00, 0x04,
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x40, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02,
-	0x00, 0x0C, 0x00, 0x06, 0x01, 0xD7, 0x00, 0x02, 0x00, 0x50, 0x01, 0xD9, 0x00, 0x03, 0x00, 0x4A,
-	0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x1C, 0x00, 0x01,
-	0x00, 0x08, 0x00, 0x02, 0x00, 0x0C, 0x00, 0x06, 0x01, 0xD6, 0x00, 0x02, 0x00, 0x4D, 0x01, 0xD8,
-	0x00, 0x03, 0x00, 0x4A, 0x00, 0x4D, 0x00, 0x01, 0x00, 0x01, 0x00, 0x4A, 0x00, 0x01, 0x00, 0x00,
-	0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x7B,
-	0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x12, 0x00, 0x06, 0x05, 0x22,
-	0x05, 0x23, 0x05, 0x24, 0x05, 0x25, 0x05, 0x26, 0x05, 0x27, 0x00, 0x01, 0x00, 0x06, 0x02, 0xD5,
-	0x02, 0xD6, 0x02, 0xE7, 0x02, 0xE8, 0x03, 0x6A, 0x03, 0x73, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-	0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x03, 0x23, 0x03, 0x24,
-	0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x06, 0x32, 0x00, 0x36, 0x06, 0x00,
-	0x05, 0xF6, 0x05, 0xEC, 0x05, 0xDA, 0x05, 0xA8, 0x05, 0x96, 0x05, 0x8C, 0x05, 0x5A, 0x05, 0x40,
-	0x05, 0x26, 0x05, 0x14, 0x04, 0xEA, 0x04, 0xAE, 0x04, 0xA4, 0x04, 0x82, 0x04, 0x68, 0x04, 0x56,
-	0x04, 0x1A, 0x04, 0x08, 0x03, 0xEE, 0x03, 0xC4, 0x03, 0xB2, 0x03, 0x80, 0x03, 0x76, 0x03, 0x6C,
-	0x03, 0x5A, 0x03, 0x28, 0x03, 0x1E, 0x03, 0x14, 0x03, 0x0A, 0x02, 0xF0, 0x02, 0xD6, 0x02, 0xC4,
-	0x02, 0x9A, 0x02, 0x68, 0x02, 0x5E, 0x02, 0x3C, 0x02, 0x22, 0x02, 0x10, 0x01, 0xDE, 0x01, 0xCC,
-	0x01, 0xB2, 0x01, 0x88, 0x01, 0x76, 0x01, 0x6C, 0x01, 0x62, 0x01, 0x58, 0x01, 0x4E, 0x01, 0x24,
-	0x00, 0xFA, 0x00, 0xD0, 0x00, 0xA6, 0x00, 0x7C, 0x00, 0x72, 0x00, 0x01, 0x00, 0x04, 0x04, 0xC0,
-	0x00, 0x02, 0x00, 0xA9, 0x00, 0x05, 0x00, 0x24, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0C,
-	0x04, 0x88, 0x00, 0x02, 0x00, 0xAA, 0x04, 0x86, 0x00, 0x02, 0x00, 0xAB, 0x04, 0x84, 0x00, 0x02,
-	0x00, 0xA8, 0x04, 0x8A, 0x00, 0x02, 0x00, 0xAD, 0x04, 0x82, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x05,
-	0x00, 0x24, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0C, 0x04, 0x87, 0x00, 0x02, 0x00, 0xAA,
-	0x04, 0x85, 0x00, 0x02, 0x00, 0xAB, 0x04, 0x83, 0x00, 0x02, 0x00, 0xA8, 0x04, 0x89, 0x00, 0x02,
-	0x00, 0xAD, 0x04, 0x81, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x05, 0x00, 0x24, 0x00, 0x1E, 0x00, 0x18,
-	0x00, 0x12, 0x00, 0x0C, 0x04, 0x7A, 0x00, 0x02, 0x00, 0xAA, 0x04, 0x78, 0x00, 0x02, 0x00, 0xAB,
-	0x04, 0x76, 0x00, 0x02, 0x00, 0xA8, 0x04, 0x7C, 0x00, 0x02, 0x00, 0xAD, 0x04, 0x74, 0x00, 0x02,
-	0x00, 0xA9, 0x00, 0x05, 0x00, 0x24, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0C, 0x04, 0x79,
-	0x00, 0x02, 0x00, 0xAA, 0x04, 0x77, 0x00, 0x02, 0x00, 0xAB, 0x04, 0x75, 0x00, 0x02, 0x00, 0xA8,
-	0x04, 0x7B, 0x00, 0x02, 0x00, 0xAD, 0x04, 0x73, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x05, 0x00, 0x24,
-	0x00, 0x1E, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0C, 0x04, 0xB9, 0x00, 0x02, 0x00, 0xAC, 0x02, 0xF6,
-	0x00, 0x02, 0x00, 0xAA, 0x04, 0x62, 0x00, 0x02, 0x00, 0xAB, 0x02, 0xC1, 0x00, 0x02, 0x00, 0xA8,
-	0x02, 0xC2, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x01, 0x00, 0x04, 0x03, 0x49, 0x00, 0x02, 0x00, 0xA9,
-	0x00, 0x01, 0x00, 0x04, 0x03, 0x47, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x01, 0x00, 0x04, 0x03, 0x48,
-	0x00, 0x02, 0x00, 0xA9, 0x00, 0x01, 0x00, 0x04, 0x03, 0x46, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x02,
-	0x00, 0x0C, 0x00, 0x06, 0x04, 0xE4, 0x00, 0x02, 0x00, 0xAD, 0x03, 0x41, 0x00, 0x02, 0x00, 0xA9,
-	0x00, 0x05, 0x00, 0x24, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0C, 0x04, 0x90, 0x00, 0x02,
-	0x00, 0xAA, 0x04, 0x8E, 0x00, 0x02, 0x00, 0xAB, 0x03, 0xF5, 0x00, 0x02, 0x00, 0xA8, 0x04, 0x8C,
-	0x00, 0x02, 0x00, 0xAD, 0x02, 0xCF, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x03, 0x00, 0x14, 0x00, 0x0E,
-	0x00, 0x08, 0x03, 0xEF, 0x00, 0x02, 0x00, 0xA8, 0x04, 0xE2, 0x00, 0x02, 0x00, 0xAD, 0x03, 0xF1,
-	0x00, 0x02, 0x00, 0xA9, 0x00, 0x02, 0x00, 0x0C, 0x00, 0x06, 0x04, 0xDE, 0x00, 0x02, 0x00, 0xAA,
-	0x04, 0xE0, 0x00, 0x02, 0x00, 0xAD, 0x00, 0x06, 0x00, 0x2C, 0x00, 0x26, 0x00, 0x20, 0x00, 0x1A,
-	0x00, 0x14, 0x00, 0x0E, 0x04, 0xBF, 0x00, 0x02, 0x00, 0xAC, 0x03, 0x30, 0x00, 0x02, 0x00, 0xAA,
-	0x04, 0x80, 0x00, 0x02, 0x00, 0xAB, 0x02, 0xCB, 0x00, 0x02, 0x00, 0xA8, 0x04, 0x7E, 0x00, 0x02,
-	0x00, 0xAD, 0x02, 0xCC, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x02, 0x00, 0x0C, 0x00, 0x06, 0x04, 0xDB,
-	0x00, 0x02, 0x00, 0xAD, 0x03, 0x2A, 0x00, 0x02, 0x01, 0xD4, 0x00, 0x03, 0x00, 0x14, 0x00, 0x0E,
-	0x00, 0x08, 0x04, 0xD9, 0x00, 0x02, 0x00, 0xAD, 0x03, 0x26, 0x00, 0x02, 0x01, 0xD4, 0x03, 0x20,
-	0x00, 0x02, 0x00, 0xA9, 0x00, 0x04, 0x00, 0x1C, 0x00, 0x16, 0x00, 0x10, 0x00, 0x0A, 0x04, 0xBD,
-	0x00, 0x02, 0x00, 0xAC, 0x04, 0xD7, 0x00, 0x02, 0x00, 0xAD, 0x03, 0x1C, 0x00, 0x02, 0x01, 0xD4,
-	0x03, 0x1A, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x01, 0x00, 0x04, 0x04, 0xD5, 0x00, 0x02, 0x00, 0xA9,
-	0x00, 0x06, 0x00, 0x2C, 0x00, 0x26, 0x00, 0x20, 0x00, 0x1A, 0x00, 0x14, 0x00, 0x0E, 0x04, 0xBB,
-	0x00, 0x02, 0x00, 0xAC, 0x02, 0xC9, 0x00, 0x02, 0x00, 0xAA, 0x04, 0x68, 0x00, 0x02, 0x00, 0xAB,
-	0x02, 0xC6, 0x00, 0x02, 0x00, 0xA8, 0x04, 0x66, 0x00, 0x02, 0x00, 0xAD, 0x02, 0xC7, 0x00, 0x02,
-	0x00, 0xA9, 0x00, 0x05, 0x00, 0x24, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0C, 0x02, 0xC5,
-	0x00, 0x02, 0x00, 0xAA, 0x04, 0xB3, 0x00, 0x02, 0x00, 0xA8, 0x04, 0xD2, 0x00, 0x02, 0x00, 0xAD,
-	0x03, 0x0F, 0x00, 0x02, 0x01, 0xD4, 0x03, 0x0D, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x02, 0x00, 0x0C,
-	0x00, 0x06, 0x04, 0xD0, 0x00, 0x02, 0x00, 0xAD, 0x03, 0xFC, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x03,
-	0x00, 0x14, 0x00, 0x0E, 0x00, 0x08, 0x04, 0xCE, 0x00, 0x02, 0x00, 0xAD, 0x03, 0x07, 0x00, 0x02,
-	0x01, 0xD4, 0x03, 0x05, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x03, 0x00, 0x14, 0x00, 0x0E, 0x00, 0x08,
-	0x04, 0xCC, 0x00, 0x02, 0x00, 0xAD, 0x03, 0x03, 0x00, 0x02, 0x01, 0xD4, 0x04, 0xCA, 0x00, 0x02,
-	0x00, 0xA9, 0x00, 0x01, 0x00, 0x04, 0x04, 0x64, 0x00, 0x02, 0x00, 0xAD, 0x00, 0x01, 0x00, 0x04,
-	0x04, 0xC8, 0x00, 0x02, 0x00, 0xAD, 0x00, 0x01, 0x00, 0x04, 0x04, 0xB1, 0x00, 0x02, 0x00, 0xA9,
-	0x00, 0x06, 0x00, 0x2C, 0x00, 0x26, 0x00, 0x20, 0x00, 0x1A, 0x00, 0x14, 0x00, 0x0E, 0x04, 0xB7,
-	0x00, 0x02, 0x00, 0xAC, 0x04, 0x56, 0x00, 0x02, 0x00, 0xAA, 0x04, 0x54, 0x00, 0x02, 0x00, 0xAB,
-	0x02, 0xBD, 0x00, 0x02, 0x00, 0xA8, 0x04, 0x52, 0x00, 0x02, 0x00, 0xAD, 0x02, 0xBE, 0x00, 0x02,
-	0x00, 0xA9, 0x00, 0x02, 0x00, 0x0C, 0x00, 0x06, 0x04, 0xC4, 0x00, 0x02, 0x00, 0xAD, 0x04, 0xC6,
-	0x00, 0x02, 0x01, 0xD4, 0x00, 0x01, 0x00, 0x04, 0x02, 0xD8, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x01,
-	0x00, 0x04, 0x04, 0xC2, 0x00, 0x02, 0x00, 0xAD, 0x00, 0x06, 0x00, 0x2C, 0x00, 0x26, 0x00, 0x20,
-	0x00, 0x1A, 0x00, 0x14, 0x00, 0x0E, 0x04, 0xB5, 0x00, 0x02, 0x00, 0xAC, 0x02, 0xB8, 0x00, 0x02,
-	0x00, 0xAA, 0x04, 0x3C, 0x00, 0x02, 0x00, 0xAB, 0x02, 0xB5, 0x00, 0x02, 0x00, 0xA8, 0x04, 0x3A,
-	0x00, 0x02, 0x00, 0xAD, 0x02, 0xB6, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x02, 0x00, 0x0C, 0x00, 0x06,
-	0x04, 0xE3, 0x00, 0x02, 0x00, 0xAD, 0x03, 0x40, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x05, 0x00, 0x24,
-	0x00, 0x1E, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0C, 0x04, 0x8F, 0x00, 0x02, 0x00, 0xAA, 0x04, 0x8D,
-	0x00, 0x02, 0x00, 0xAB, 0x03, 0xF4, 0x00, 0x02, 0x00, 0xA8, 0x04, 0x8B, 0x00, 0x02, 0x00, 0xAD,
-	0x02, 0xB4, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x03, 0x00, 0x14, 0x00, 0x0E, 0x00, 0x08, 0x03, 0xEE,
-	0x00, 0x02, 0x00, 0xA8, 0x04, 0xE1, 0x00, 0x02, 0x00, 0xAD, 0x03, 0xF0, 0x00, 0x02, 0x00, 0xA9,
-	0x00, 0x02, 0x00, 0x0C, 0x00, 0x06, 0x04, 0xDD, 0x00, 0x02, 0x00, 0xAA, 0x04, 0xDF, 0x00, 0x02,
-	0x00, 0xAD, 0x00, 0x07, 0x00, 0x34, 0x00, 0x2E, 0x00, 0x28, 0x00, 0x22, 0x00, 0x1C, 0x00, 0x16,
-	0x00, 0x10, 0x04, 0xBE, 0x00, 0x02, 0x00, 0xAC, 0x03, 0x2F, 0x00, 0x02, 0x00, 0xAA, 0x04, 0x7F,
-	0x00, 0x02, 0x00, 0xAB, 0x02, 0xB0, 0x00, 0x02, 0x00, 0xA8, 0x04, 0x7D, 0x00, 0x02, 0x00, 0xAD,
-	0x02, 0xB1, 0x00, 0x02, 0x00, 0xA9, 0x04, 0xDC, 0x00, 0x03, 0x00, 0xAA, 0x00, 0xA9, 0x00, 0x02,
-	0x00, 0x0C, 0x00, 0x06, 0x04, 0xDA, 0x00, 0x02, 0x00, 0xAD, 0x03, 0x29, 0x00, 0x02, 0x01, 0xD4,
-	0x00, 0x03, 0x00, 0x14, 0x00, 0x0E, 0x00, 0x08, 0x04, 0xD8, 0x00, 0x02, 0x00, 0xAD, 0x03, 0x25,
-	0x00, 0x02, 0x01, 0xD4, 0x03, 0x1F, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x04, 0x00, 0x1C, 0x00, 0x16,
-	0x00, 0x10, 0x00, 0x0A, 0x04, 0xBC, 0x00, 0x02, 0x00, 0xAC, 0x04, 0xD6, 0x00, 0x02, 0x00, 0xAD,
-	0x03, 0x1B, 0x00, 0x02, 0x01, 0xD4, 0x03, 0x19, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x01, 0x00, 0x04,
-	0x04, 0xD4, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x07, 0x00, 0x34, 0x00, 0x2E, 0x00, 0x28, 0x00, 0x22,
-	0x00, 0x1C, 0x00, 0x16, 0x00, 0x10, 0x04, 0xBA, 0x00, 0x02, 0x00, 0xAC, 0x02, 0xAE, 0x00, 0x02,
-	0x00, 0xAA, 0x04, 0x67, 0x00, 0x02, 0x00, 0xAB, 0x02, 0xAB, 0x00, 0x02, 0x00, 0xA8, 0x04, 0x65,
-	0x00, 0x02, 0x00, 0xAD, 0x02, 0xAC, 0x00, 0x02, 0x00, 0xA9, 0x04, 0xD3, 0x00, 0x03, 0x00, 0xAA,
-	0x00, 0xA9, 0x00, 0x05, 0x00, 0x24, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0C, 0x02, 0xAA,
-	0x00, 0x02, 0x00, 0xAA, 0x04, 0xB2, 0x00, 0x02, 0x00, 0xA8, 0x04, 0xD1, 0x00, 0x02, 0x00, 0xAD,
-	0x03, 0x0E, 0x00, 0x02, 0x01, 0xD4, 0x03, 0x0C, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x02, 0x00, 0x0C,
-	0x00, 0x06, 0x04, 0xCF, 0x00, 0x02, 0x00, 0xAD, 0x03, 0xFB, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x03,
-	0x00, 0x14, 0x00, 0x0E, 0x00, 0x08, 0x04, 0xCD, 0x00, 0x02, 0x00, 0xAD, 0x03, 0x06, 0x00, 0x02,
-	0x01, 0xD4, 0x03, 0x04, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x03, 0x00, 0x14, 0x00, 0x0E, 0x00, 0x08,
-	0x04, 0xCB, 0x00, 0x02, 0x00, 0xAD, 0x03, 0x02, 0x00, 0x02, 0x01, 0xD4, 0x04, 0xC9, 0x00, 0x02,
-	0x00, 0xA9, 0x00, 0x06, 0x00, 0x2C, 0x00, 0x26, 0x00, 0x20, 0x00, 0x1A, 0x00, 0x14, 0x00, 0x0E,
-	0x04, 0xB8, 0x00, 0x02, 0x00, 0xAC, 0x02, 0xF5, 0x00, 0x02, 0x00, 0xAA, 0x04, 0x61, 0x00, 0x02,
-	0x00, 0xAB, 0x02, 0xA6, 0x00, 0x02, 0x00, 0xA8, 0x04, 0x63, 0x00, 0x02, 0x00, 0xAD, 0x02, 0xA7,
-	0x00, 0x02, 0x00, 0xA9, 0x00, 0x01, 0x00, 0x04, 0x04, 0xC7, 0x00, 0x02, 0x00, 0xAD, 0x00, 0x02,
-	0x00, 0x0C, 0x00, 0x06, 0x02, 0xF1, 0x00, 0x02, 0x01, 0xD4, 0x04, 0xB0, 0x00, 0x02, 0x00, 0xA9,
-	0x00, 0x06, 0x00, 0x2C, 0x00, 0x26, 0x00, 0x20, 0x00, 0x1A, 0x00, 0x14, 0x00, 0x0E, 0x04, 0xB6,
-	0x00, 0x02, 0x00, 0xAC, 0x04, 0x55, 0x00, 0x02, 0x00, 0xAA, 0x04, 0x53, 0x00, 0x02, 0x00, 0xAB,
-	0x02, 0xA2, 0x00, 0x02, 0x00, 0xA8, 0x04, 0x51, 0x00, 0x02, 0x00, 0xAD, 0x02, 0xA3, 0x00, 0x02,
-	0x00, 0xA9, 0x00, 0x02, 0x00, 0x0C, 0x00, 0x06, 0x04, 0xC3, 0x00, 0x02, 0x00, 0xAD, 0x04, 0xC5,
-	0x00, 0x02, 0x01, 0xD4, 0x00, 0x01, 0x00, 0x04, 0x02, 0xD7, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x01,
-	0x00, 0x04, 0x04, 0xC1, 0x00, 0x02, 0x00, 0xAD, 0x00, 0x06, 0x00, 0x2C, 0x00, 0x26, 0x00, 0x20,
-	0x00, 0x1A, 0x00, 0x14, 0x00, 0x0E, 0x04, 0xB4, 0x00, 0x02, 0x00, 0xAC, 0x02, 0x9D, 0x00, 0x02,
-	0x00, 0xAA, 0x04, 0x3B, 0x00, 0x02, 0x00, 0xAB, 0x02, 0x9A, 0x00, 0x02, 0x00, 0xA8, 0x04, 0x39,
-	0x00, 0x02, 0x00, 0xAD, 0x02, 0x9B, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x02, 0x00, 0x11, 0x00, 0x25,
-	0x00, 0x29, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x2D, 0x00, 0x05, 0x00, 0x2F, 0x00, 0x34, 0x00, 0x08,
-	0x00, 0x36, 0x00, 0x3B, 0x00, 0x0E, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x14, 0x00, 0x45, 0x00, 0x49,
-	0x00, 0x16, 0x00, 0x4B, 0x00, 0x4D, 0x00, 0x1B, 0x00, 0x4F, 0x00, 0x54, 0x00, 0x1E, 0x00, 0x56,
-	0x00, 0x5B, 0x00, 0x24, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x2A, 0x00, 0x81, 0x00, 0x81, 0x00, 0x2C,
-	0x00, 0x83, 0x00, 0x83, 0x00, 0x2D, 0x00, 0x86, 0x00, 0x86, 0x00, 0x2E, 0x00, 0x89, 0x00, 0x89,
-	0x00, 0x2F, 0x00, 0x8D, 0x00, 0x8D, 0x00, 0x30, 0x00, 0x98, 0x00, 0x9B, 0x00, 0x31, 0x00, 0xD0,
-	0x00, 0xD0, 0x00, 0x35, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x82,
-	0x00, 0x06, 0x02, 0x7B, 0x02, 0x79, 0x02, 0x7C, 0x02, 0x7D, 0x02, 0x7A, 0x05, 0x28, 0x00, 0x06,
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x68, 0x00, 0x64, 0x00, 0x3C, 0x00, 0x2C,
-	0x00, 0x07, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x1A, 0x00, 0x1A, 0x00, 0x1A, 0x00, 0x1A, 0x00, 0x1A,
-	0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
-	0x00, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0xA8, 0x00, 0xAC, 0x00, 0x01, 0x01, 0x24, 0x01, 0x27,
-	0x00, 0x01, 0x00, 0x02, 0x00, 0x06, 0x00, 0x4D, 0x00, 0x4D, 0x00, 0x06, 0x00, 0x4E, 0x00, 0x4E,
-	0x00, 0x04, 0x02, 0xFC, 0x02, 0xFC, 0x00, 0x05, 0x03, 0xE9, 0x03, 0xE9, 0x00, 0x03, 0x03, 0xEB,
-	0x03, 0xEB, 0x00, 0x02, 0x04, 0x64, 0x04, 0x64, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01,
-	0x00, 0x06, 0x00, 0x4D, 0x00, 0x4E, 0x02, 0xFC, 0x03, 0xE9, 0x03, 0xEB, 0x04, 0x64, 0x00, 0x01,
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x01, 0xDC, 0x00, 0xEB, 0x02, 0x8C, 0x02, 0x4D,
-	0x02, 0x4C, 0x02, 0x4B, 0x02, 0x4A, 0x02, 0x42, 0x02, 0x00, 0x01, 0xFF, 0x01, 0xFE, 0x01, 0xFD,
-	0x01, 0xFC, 0x01, 0xFB, 0x01, 0xFA, 0x01, 0xF9, 0x01, 0xF8, 0x01, 0xF7, 0x01, 0xF6, 0x01, 0xF5,
-	0x01, 0xF4, 0x01, 0xF3, 0x01, 0xF2, 0x01, 0xF1, 0x01, 0xF0, 0x01, 0xEF, 0x01, 0xEE, 0x01, 0xED,
-	0x01, 0xEC, 0x02, 0x7E, 0x02, 0x8E, 0x03, 0x4B, 0x02, 0x90, 0x02, 0x8F, 0x03, 0x4A, 0x01, 0xFD,
-	0x02, 0x8D, 0x02, 0x92, 0x02, 0x6C, 0x04, 0xED, 0x04, 0xEE, 0x02, 0x04, 0x02, 0x05, 0x04, 0xEF,
-	0x04, 0xF0, 0x04, 0xF1, 0x02, 0x06, 0x04, 0xF2, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x04, 0xF7,
-	0x02, 0x0A, 0x02, 0x0A, 0x04, 0xF8, 0x04, 0xF9, 0x02, 0x0B, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x14,
-	0x05, 0x06, 0x05, 0x07, 0x02, 0x15, 0x02, 0x16, 0x02, 0x17, 0x02, 0x18, 0x02, 0x19, 0x02, 0x1A,
-	0x05, 0x0A, 0x05, 0x0B, 0x05, 0x0D, 0x05, 0x10, 0x05, 0x19, 0x02, 0x1C, 0x02, 0x1D, 0x02, 0x1E,
-	0x02, 0x1F, 0x02, 0x20, 0x02, 0x21, 0x02, 0x22, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02, 0x0E,
-	0x02, 0x0F, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02, 0x55, 0x02, 0x27, 0x02, 0x28,
-	0x02, 0x29, 0x02, 0x2A, 0x05, 0x13, 0x02, 0x2B, 0x02, 0x2D, 0x02, 0x2E, 0x02, 0x2F, 0x02, 0x31,
-	0x02, 0x33, 0x02, 0x91, 0x03, 0x4C, 0x03, 0x4D, 0x03, 0x4E, 0x03, 0x4F, 0x03, 0x50, 0x03, 0x51,
-	0x03, 0x52, 0x03, 0x53, 0x03, 0x54, 0x03, 0x55, 0x03, 0x56, 0x03, 0x57, 0x03, 0x58, 0x03, 0x59,
-	0x03, 0x5A, 0x03, 0x5B, 0x03, 0x5C, 0x03, 0x5D, 0x03, 0x5E, 0x03, 0x5F, 0x03, 0x60, 0x03, 0x61,
-	0x03, 0x62, 0x03, 0x63, 0x03, 0x64, 0x03, 0x65, 0x03, 0x66, 0x03, 0x67, 0x03, 0x9D, 0x03, 0x68,
-	0x03, 0x69, 0x03, 0x6A, 0x03, 0x6B, 0x03, 0x6C, 0x03, 0x6D, 0x03, 0x6E, 0x03, 0x6F, 0x03, 0x70,
-	0x03, 0x71, 0x03, 0x72, 0x03, 0x73, 0x03, 0x74, 0x03, 0x75, 0x03, 0x76, 0x03, 0x77, 0x03, 0x78,
-	0x03, 0x79, 0x03, 0x7A, 0x03, 0x7B, 0x03, 0x7C, 0x03, 0x7D, 0x05, 0x1A, 0x03, 0x7F, 0x03, 0x80,
-	0x03, 0x81, 0x03, 0x82, 0x03, 0x83, 0x03, 0x84, 0x03, 0x85, 0x03, 0x86, 0x03, 0x87, 0x03, 0x88,
-	0x03, 0x89, 0x03, 0x8A, 0x03, 0x8B, 0x03, 0x8C, 0x03, 0x8D, 0x03, 0x8E, 0x03, 0x8F, 0x03, 0x90,
-	0x05, 0x1D, 0x03, 0x91, 0x03, 0x92, 0x03, 0x94, 0x03, 0x93, 0x03, 0x95, 0x03, 0x96, 0x03, 0x97,
-	0x03, 0x98, 0x03, 0x99, 0x03, 0x9A, 0x03, 0x9B, 0x03, 0x9C, 0x03, 0x9E, 0x03, 0x9F, 0x03, 0xA0,
-	0x05, 0x1B, 0x05, 0x1C, 0x04, 0xE6, 0x04, 0xE7, 0x04, 0xE8, 0x04, 0xE9, 0x04, 0xF3, 0x04, 0xF6,
-	0x04, 0xF4, 0x04, 0xF5, 0x04, 0xFA, 0x04, 0xFB, 0x04, 0xFC, 0x04, 0xEA, 0x04, 0xEB, 0x04, 0xEC,
-	0x05, 0x05, 0x05, 0x08, 0x05, 0x09, 0x05, 0x0C, 0x05, 0x0E, 0x05, 0x0F, 0x02, 0x1B, 0x05, 0x11,
-	0x04, 0xFD, 0x04, 0xFE, 0x04, 0xFF, 0x05, 0x00, 0x05, 0x01, 0x05, 0x02, 0x05, 0x03, 0x05, 0x04,
-	0x05, 0x1E, 0x05, 0x1F, 0x05, 0x20, 0x05, 0x21, 0x05, 0x12, 0x05, 0x14, 0x05, 0x15, 0x02, 0x32,
-	0x05, 0x17, 0x02, 0x34, 0x05, 0x18, 0x05, 0x16, 0x02, 0x30, 0x02, 0x26, 0x02, 0x2C, 0x05, 0x26,
-	0x05, 0x27, 0x00, 0x01, 0x00, 0xEB, 0x00, 0x0A, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48,
-	0x00, 0x49, 0x00, 0x4A, 0x00, 0x4B, 0x00, 0x4C, 0x00, 0x4D, 0x00, 0x4E, 0x00, 0x4F, 0x00, 0x50,
-	0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58,
-	0x00, 0x59, 0x00, 0x5A, 0x00, 0x5B, 0x00, 0x5C, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x85, 0x00, 0x86,
-	0x00, 0x87, 0x00, 0x89, 0x00, 0x8A, 0x00, 0x8B, 0x00, 0x8D, 0x00, 0x90, 0x00, 0x92, 0x00, 0x94,
-	0x00, 0xBB, 0x00, 0xBC, 0x00, 0xBD, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0xC0, 0x00, 0xC1, 0x00, 0xC2,
-	0x00, 0xC3, 0x00, 0xC4, 0x00, 0xC5, 0x00, 0xC6, 0x00, 0xC7, 0x00, 0xC8, 0x00, 0xC9, 0x00, 0xCA,
-	0x00, 0xCB, 0x00, 0xCC, 0x00, 0xCD, 0x00, 0xCE, 0x00, 0xEA, 0x00, 0xEB, 0x00, 0xEC, 0x00, 0xED,
-	0x00, 0xEE, 0x00, 0xEF, 0x00, 0xF0, 0x00, 0xF1, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF5,
-	0x00, 0xF6, 0x00, 0xF7, 0x00, 0xF8, 0x00, 0xF9, 0x00, 0xFA, 0x00, 0xFB, 0x00, 0xFC, 0x00, 0xFD,
-	0x00, 0xFE, 0x00, 0xFF, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x03, 0x01, 0x04, 0x01, 0x05,
-	0x01, 0x06, 0x01, 0x07, 0x01, 0x30, 0x01, 0x34, 0x01, 0x36, 0x01, 0x38, 0x01, 0x3A, 0x01, 0x3C,
-	0x01, 0x42, 0x01, 0x44, 0x01, 0x46, 0x01, 0x4A, 0x01, 0x4D, 0x01, 0x5A, 0x02, 0x97, 0x02, 0x99,
-	0x02, 0xB5, 0x02, 0xB6, 0x02, 0xB7, 0x02, 0xB8, 0x02, 0xB9, 0x02, 0xBA, 0x02, 0xBB, 0x02, 0xBC,
-	0x02, 0xBD, 0x02, 0xBE, 0x02, 0xBF, 0x02, 0xC0, 0x02, 0xC1, 0x02, 0xC2, 0x02, 0xC3, 0x02, 0xC4,
-	0x02, 0xC5, 0x02, 0xC6, 0x02, 0xC7, 0x02, 0xC8, 0x02, 0xC9, 0x02, 0xCA, 0x02, 0xCB, 0x02, 0xCC,
-	0x02, 0xCD, 0x02, 0xCE, 0x02, 0xCF, 0x02, 0xD0, 0x02, 0xD2, 0x02, 0xD4, 0x02, 0xD6, 0x02, 0xD8,
-	0x02, 0xDA, 0x02, 0xDC, 0x02, 0xDE, 0x02, 0xE0, 0x02, 0xE2, 0x02, 0xE4, 0x02, 0xE6, 0x02, 0xE8,
-	0x02, 0xEA, 0x02, 0xEC, 0x02, 0xEE, 0x02, 0xF0, 0x02, 0xF2, 0x02, 0xF4, 0x02, 0xF6, 0x02, 0xF8,
-	0x02, 0xFA, 0x02, 0xFC, 0x02, 0xFF, 0x03, 0x01, 0x03, 0x03, 0x03, 0x05, 0x03, 0x07, 0x03, 0x09,
-	0x03, 0x0B, 0x03, 0x0D, 0x03, 0x0F, 0x03, 0x11, 0x03, 0x14, 0x03, 0x16, 0x03, 0x18, 0x03, 0x1A,
-	0x03, 0x1C, 0x03, 0x1E, 0x03, 0x20, 0x03, 0x22, 0x03, 0x24, 0x03, 0x26, 0x03, 0x28, 0x03, 0x2A,
-	0x03, 0x2C, 0x03, 0x2E, 0x03, 0x30, 0x03, 0x32, 0x03, 0x34, 0x03, 0x36, 0x03, 0x38, 0x03, 0x3A,
-	0x03, 0x3C, 0x03, 0x3E, 0x03, 0x41, 0x03, 0x43, 0x03, 0x45, 0x03, 0x47, 0x03, 0x49, 0x03, 0xB9,
-	0x03, 0xBA, 0x03, 0xBB, 0x03, 0xBC, 0x03, 0xBE, 0x03, 0xBF, 0x03, 0xC0, 0x03, 0xC1, 0x03, 0xC2,
-	0x03, 0xC3, 0x03, 0xC4, 0x03, 0xC5, 0x03, 0xC6, 0x03, 0xC7, 0x03, 0xDE, 0x03, 0xDF, 0x03, 0xE0,
-	0x03, 0xE1, 0x03, 0xE2, 0x03, 0xE3, 0x03, 0xE4, 0x03, 0xE5, 0x03, 0xE6, 0x03, 0xE7, 0x03, 0xE8,
-	0x03, 0xE9, 0x03, 0xEA, 0x03, 0xEB, 0x03, 0xEC, 0x03, 0xED, 0x03, 0xEF, 0x03, 0xF1, 0x03, 0xF3,
-	0x03, 0xF5, 0x04, 0x0A, 0x04, 0x0C, 0x04, 0x0E, 0x04, 0x1C, 0x04, 0x23, 0x04, 0x29, 0x04, 0x2F,
-	0x04, 0x99, 0x04, 0x9A, 0x04, 0x9E, 0x04, 0xA2, 0x05, 0x23, 0x05, 0x25, 0x00, 0x01, 0x00, 0x00,
-	0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x01, 0xFA, 0x00, 0xFA, 0x02, 0x01, 0x02, 0x8C, 0x01, 0xEB,
-	0x01, 0xEA, 0x01, 0xE9, 0x01, 0xE8, 0x01, 0xE7, 0x01, 0xE6, 0x01, 0xE5, 0x01, 0xE4, 0x01, 0xE3,
-	0x01, 0xE2, 0x02, 0x4D, 0x02, 0x4C, 0x02, 0x4B, 0x02, 0x4A, 0x02, 0x42, 0x02, 0x00, 0x01, 0xFF,
-	0x01, 0xFE, 0x01, 0xFD, 0x01, 0xFC, 0x01, 0xFB, 0x01, 0xFA, 0x01, 0xF9, 0x01, 0xF8, 0x01, 0xF7,
-	0x01, 0xF6, 0x01, 0xF5, 0x01, 0xF4, 0x01, 0xF3, 0x01, 0xF2, 0x01, 0xF1, 0x01, 0xF0, 0x01, 0xEF,
-	0x01, 0xEE, 0x01, 0xED, 0x01, 0xEC, 0x02, 0x02, 0x02, 0x03, 0x02, 0x8E, 0x02, 0x90, 0x02, 0x8F,
-	0x02, 0x91, 0x02, 0x8D, 0x02, 0x92, 0x02, 0x6C, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07,
-	0x02, 0x08, 0x02, 0x09, 0x02, 0x0A, 0x02, 0x0B, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0F,
-	0x02, 0x10, 0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02, 0x14, 0x02, 0x15, 0x02, 0x16, 0x02, 0x17,
-	0x02, 0x18, 0x02, 0x1A, 0x02, 0x1B, 0x05, 0x19, 0x02, 0x1C, 0x02, 0x1D, 0x02, 0x1E, 0x02, 0x1F,
-	0x02, 0x20, 0x02, 0x21, 0x02, 0x22, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02, 0x55, 0x02, 0x27,
-	0x02, 0x28, 0x02, 0x29, 0x02, 0x2A, 0x05, 0x13, 0x02, 0x2B, 0x02, 0x2D, 0x02, 0x2E, 0x02, 0x2F,
-	0x02, 0x30, 0x02, 0x31, 0x02, 0x32, 0x02, 0x33, 0x02, 0x35, 0x02, 0x36, 0x02, 0x38, 0x02, 0x37,
-	0x03, 0x4A, 0x03, 0x4B, 0x03, 0x4C, 0x03, 0x4D, 0x03, 0x4E, 0x03, 0x4F, 0x03, 0x50, 0x03, 0x51,
-	0x03, 0x52, 0x03, 0x53, 0x03, 0x54, 0x03, 0x55, 0x03, 0x56, 0x03, 0x57, 0x03, 0x58, 0x03, 0x59,
-	0x03, 0x5A, 0x03, 0x5B, 0x03, 0x5C, 0x03, 0x5D, 0x03, 0x5E, 0x03, 0x5F, 0x03, 0x60, 0x03, 0x61,
-	0x03, 0x62, 0x03, 0x63, 0x03, 0x64, 0x03, 0x65, 0x03, 0x66, 0x03, 0x67, 0x03, 0x68, 0x03, 0x69,
-	0x03, 0x6A, 0x03, 0x6B, 0x03, 0x6C, 0x03, 0x6D, 0x03, 0x6E, 0x03, 0x6F, 0x03, 0x70, 0x03, 0x71,
-	0x03, 0x72, 0x03, 0x73, 0x03, 0x74, 0x03, 0x75, 0x03, 0x76, 0x03, 0x77, 0x03, 0x78, 0x03, 0x79,
-	0x03, 0x7A, 0x03, 0x7B, 0x03, 0x7C, 0x03, 0x7D, 0x03, 0x7E, 0x05, 0x1A, 0x03, 0x7F, 0x03, 0x80,
-	0x03, 0x81, 0x03, 0x82, 0x03, 0x83, 0x03, 0x84, 0x03, 0x85, 0x03, 0x86, 0x03, 0x87, 0x03, 0x88,
-	0x03, 0x89, 0x03, 0x8A, 0x03, 0x8B, 0x03, 0x8C, 0x03, 0x8D, 0x03, 0x8E, 0x03, 0x8F, 0x03, 0x90,
-	0x05, 0x1D, 0x03, 0x91, 0x03, 0x92, 0x03, 0x94, 0x03, 0x93, 0x03, 0x95, 0x03, 0x96, 0x03, 0x97,
-	0x03, 0x98, 0x03, 0x99, 0x03, 0x9A, 0x03, 0x9B, 0x03, 0x9C, 0x03, 0x9D, 0x03, 0x9E, 0x03, 0x9F,
-	0x03, 0xA0, 0x05, 0x1B, 0x05, 0x1C, 0x04, 0xE6, 0x04, 0xE7, 0x04, 0xE8, 0x04, 0xE9, 0x04, 0xEA,
-	0x04, 0xEB, 0x04, 0xEC, 0x04, 0xED, 0x04, 0xEE, 0x04, 0xEF, 0x04, 0xF0, 0x04, 0xF1, 0x04, 0xF2,
-	0x04, 0xF3, 0x04, 0xF4, 0x04, 0xF5, 0x04, 0xF6, 0x04, 0xF7, 0x04, 0xF8, 0x04, 0xF9, 0x04, 0xFA,
-	0x04, 0xFB, 0x04, 0xFC, 0x04, 0xFD, 0x04, 0xFE, 0x04, 0xFF, 0x05, 0x00, 0x05, 0x01, 0x05, 0x02,
-	0x02, 0x19, 0x05, 0x03, 0x05, 0x04, 0x05, 0x05, 0x05, 0x06, 0x05, 0x07, 0x05, 0x08, 0x05, 0x09,
-	0x05, 0x0A, 0x05, 0x0B, 0x05, 0x0C, 0x05, 0x0D, 0x05, 0x0E, 0x05, 0x0F, 0x05, 0x10, 0x05, 0x11,
-	0x05, 0x1E, 0x05, 0x1F, 0x05, 0x20, 0x05, 0x21, 0x05, 0x12, 0x05, 0x14, 0x05, 0x15, 0x05, 0x17,
-	0x02, 0x34, 0x05, 0x18, 0x05, 0x16, 0x02, 0x26, 0x02, 0x2C, 0x05, 0x26, 0x05, 0x27, 0x00, 0x01,
-	0x00, 0xFA, 0x00, 0x08, 0x00, 0x0A, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18,
-	0x00, 0x19, 0x00, 0x1A, 0x00, 0x1B, 0x00, 0x1C, 0x00, 0x1D, 0x00, 0x25, 0x00, 0x26, 0x00, 0x27,
-	0x00, 0x28, 0x00, 0x29, 0x00, 0x2A, 0x00, 0x2B, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2F,
-	0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37,
-	0x00, 0x38, 0x00, 0x39, 0x00, 0x3A, 0x00, 0x3B, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x65,
-	0x00, 0x67, 0x00, 0x81, 0x00, 0x83, 0x00, 0x84, 0x00, 0x8C, 0x00, 0x8F, 0x00, 0x91, 0x00, 0x93,
-	0x00, 0xB1, 0x00, 0xB2, 0x00, 0xB3, 0x00, 0xB4, 0x00, 0xB5, 0x00, 0xB6, 0x00, 0xB7, 0x00, 0xB8,
-	0x00, 0xB9, 0x00, 0xBA, 0x00, 0xD2, 0x00, 0xD3, 0x00, 0xD4, 0x00, 0xD5, 0x00, 0xD6, 0x00, 0xD7,
-	0x00, 0xD8, 0x00, 0xD9, 0x00, 0xDA, 0x00, 0xDB, 0x00, 0xDC, 0x00, 0xDD, 0x00, 0xDE, 0x00, 0xDF,
-	0x00, 0xE0, 0x00, 0xE1, 0x00, 0xE2, 0x00, 0xE3, 0x00, 0xE4, 0x00, 0xE5, 0x00, 0xE6, 0x00, 0xE7,
-	0x00, 0xE8, 0x00, 0xE9, 0x01, 0x2F, 0x01, 0x33, 0x01, 0x35, 0x01, 0x37, 0x01, 0x39, 0x01, 0x3B,
-	0x01, 0x41, 0x01, 0x43, 0x01, 0x45, 0x01, 0x49, 0x01, 0x4B, 0x01, 0x4C, 0x01, 0x58, 0x01, 0x59,
-	0x01, 0xB1, 0x01, 0xB7, 0x01, 0xBC, 0x01, 0xBF, 0x02, 0x95, 0x02, 0x96, 0x02, 0x98, 0x02, 0x9A,
-	0x02, 0x9B, 0x02, 0x9C, 0x02, 0x9D, 0x02, 0x9E, 0x02, 0x9F, 0x02, 0xA0, 0x02, 0xA1, 0x02, 0xA2,
-	0x02, 0xA3, 0x02, 0xA4, 0x02, 0xA5, 0x02, 0xA6, 0x02, 0xA7, 0x02, 0xA8, 0x02, 0xA9, 0x02, 0xAA,
-	0x02, 0xAB, 0x02, 0xAC, 0x02, 0xAD, 0x02, 0xAE, 0x02, 0xAF, 0x02, 0xB0, 0x02, 0xB1, 0x02, 0xB2,
-	0x02, 0xB3, 0x02, 0xB4, 0x02, 0xD1, 0x02, 0xD3, 0x02, 0xD5, 0x02, 0xD7, 0x02, 0xD9, 0x02, 0xDB,
-	0x02, 0xDD, 0x02, 0xDF, 0x02, 0xE1, 0x02, 0xE3, 0x02, 0xE5, 0x02, 0xE7, 0x02, 0xE9, 0x02, 0xEB,
-	0x02, 0xED, 0x02, 0xEF, 0x02, 0xF1, 0x02, 0xF3, 0x02, 0xF5, 0x02, 0xF7, 0x02, 0xF9, 0x02, 0xFB,
-	0x02, 0xFD, 0x02, 0xFE, 0x03, 0x00, 0x03, 0x02, 0x03, 0x04, 0x03, 0x06, 0x03, 0x08, 0x03, 0x0A,
-	0x03, 0x0C, 0x03, 0x0E, 0x03, 0x10, 0x03, 0x13, 0x03, 0x15, 0x03, 0x17, 0x03, 0x19, 0x03, 0x1B,
-	0x03, 0x1D, 0x03, 0x1F, 0x03, 0x21, 0x03, 0x23, 0x03, 0x25, 0x03, 0x27, 0x03, 0x29, 0x03, 0x2B,
-	0x03, 0x2D, 0x03, 0x2F, 0x03, 0x31, 0x03, 0x33, 0x03, 0x35, 0x03, 0x37, 0x03, 0x39, 0x03, 0x3B,
-	0x03, 0x3D, 0x03, 0x3F, 0x03, 0x40, 0x03, 0x42, 0x03, 0x44, 0x03, 0x46, 0x03, 0x48, 0x03, 0xA1,
-	0x03, 0xA2, 0x03, 0xA3, 0x03, 0xA4, 0x03, 0xA5, 0x03, 0xA6, 0x03, 0xA7, 0x03, 0xA9, 0x03, 0xAA,
-	0x03, 0xAB, 0x03, 0xAC, 0x03, 0xAD, 0x03, 0xAE, 0x03, 0xAF, 0x03, 0xB0, 0x03, 0xB1, 0x03, 0xB2,
-	0x03, 0xB3, 0x03, 0xB4, 0x03, 0xB5, 0x03, 0xB6, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xC8, 0x03, 0xC9,
-	0x03, 0xCA, 0x03, 0xCB, 0x03, 0xCC, 0x03, 0xCD, 0x03, 0xCE, 0x03, 0xCF, 0x03, 0xD0, 0x03, 0xD1,
-	0x03, 0xD2, 0x03, 0xD3, 0x03, 0xD4, 0x03, 0xD5, 0x03, 0xD6, 0x03, 0xD7, 0x03, 0xD8, 0x03, 0xD9,
-	0x03, 0xDA, 0x03, 0xDB, 0x03, 0xDC, 0x03, 0xDD, 0x03, 0xEE, 0x03, 0xF0, 0x03, 0xF2, 0x03, 0xF4,
-	0x04, 0x09, 0x04, 0x0B, 0x04, 0x0D, 0x04, 0x22, 0x04, 0x28, 0x04, 0x2E, 0x04, 0x98, 0x04, 0x9D,
-	0x04, 0xA1, 0x05, 0x22, 0x05, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x5C,
-	0x00, 0xA0, 0x00, 0x04, 0x44, 0x46, 0x4C, 0x54, 0x00, 0x44, 0x63, 0x79, 0x72, 0x6C, 0x00, 0x36,
-	0x67, 0x72, 0x65, 0x6B, 0x00, 0x28, 0x6C, 0x61, 0x74, 0x6E, 0x00, 0x1A, 0x00, 0x04, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x02,
-	0x00, 0x00, 0x00, 0x02, 0x00, 0x05, 0x63, 0x70, 0x73, 0x70, 0x00, 0x3E, 0x6B, 0x65, 0x72, 0x6E,
-	0x00, 0x36, 0x6B, 0x65, 0x72, 0x6E, 0x00, 0x30, 0x6B, 0x65, 0x72, 0x6E, 0x00, 0x28, 0x6B, 0x65,
-	0x72, 0x6E, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,
-	0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04,
-	0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x56, 0x16, 0x30, 0xFC, 0x25, 0xDC,
-	0x01, 0x58, 0x00, 0x0C, 0x00, 0x02, 0x00, 0x08, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x0A, 0x00, 0x02,
-	0x00, 0x38, 0x00, 0x04, 0x00, 0x00, 0x00, 0xC4, 0x00, 0x60, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00,
-	0xFF, 0x95, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x88, 0x00, 0x00, 0xFF, 0x56, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x88,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x06, 0x00, 0x0B, 0x00, 0x10,
-	0x00, 0x12, 0x00, 0x96, 0x00, 0xB2, 0x01, 0x84, 0x01, 0x85, 0x01, 0x86, 0x01, 0x87, 0x01, 0x88,
-	0x01, 0x89, 0x01, 0x8A, 0x01, 0x8E, 0x01, 0x8F, 0x03, 0xF6, 0x03, 0xF7, 0x03, 0xFA, 0x00, 0x02,
-	0x00, 0x10, 0x00, 0x06, 0x00, 0x06, 0x00, 0x01, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x01, 0x00, 0x10,
-	0x00, 0x10, 0x00, 0x02, 0x00, 0x11, 0x00, 0x11, 0x00, 0x03, 0x00, 0x12, 0x00, 0x12, 0x00, 0x02,
-	0x00, 0xB2, 0x00, 0xB2, 0x00, 0x04, 0x01, 0x81, 0x01, 0x82, 0x00, 0x03, 0x01, 0x84, 0x01, 0x85,
-	0x00, 0x01, 0x01, 0x86, 0x01, 0x86, 0x00, 0x02, 0x01, 0x87, 0x01, 0x89, 0x00, 0x01, 0x01, 0x8A,
-	0x01, 0x8A, 0x00, 0x02, 0x01, 0x8E, 0x01, 0x8F, 0x00, 0x02, 0x02, 0x94, 0x02, 0x94, 0x00, 0x03,
-	0x03, 0xF6, 0x03, 0xF7, 0x00, 0x01, 0x03, 0xFA, 0x03, 0xFA, 0x00, 0x01, 0x04, 0xA7, 0x04, 0xA7,
-	0x00, 0x03, 0x00, 0x02, 0x00, 0x07, 0x00, 0x10, 0x00, 0x10, 0x00, 0x01, 0x00, 0x12, 0x00, 0x12,
-	0x00, 0x01, 0x00, 0x96, 0x00, 0x96, 0x00, 0x02, 0x00, 0xB2, 0x00, 0xB2, 0x00, 0x03, 0x01, 0x86,
-	0x01, 0x86, 0x00, 0x01, 0x01, 0x8A, 0x01, 0x8A, 0x00, 0x01, 0x01, 0x8E, 0x01, 0x8F, 0x00, 0x01,
-	0x00, 0x01, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x4A, 0x00, 0x20, 0x00, 0x1A,
-	0x00, 0x01, 0x00, 0x03, 0x00, 0x13, 0x00, 0x9D, 0x00, 0xB2, 0x00, 0x01, 0x00, 0x23, 0xFF, 0xC3,
-	0x00, 0x0A, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x01, 0x85,
-	0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0x89, 0x00, 0x00, 0x03, 0xF6,
-	0x00, 0x00, 0x03, 0xF7, 0x00, 0x00, 0x03, 0xFA, 0x00, 0x00, 0x00, 0x01, 0x00, 0x13, 0xFF, 0x20,
-	0x00, 0x02, 0x00, 0x08, 0x00, 0x02, 0x17, 0x4C, 0x00, 0x0A, 0x00, 0x02, 0x09, 0x5C, 0x00, 0x04,
-	0x00, 0x00, 0x11, 0xB6, 0x0B, 0x7C, 0x00, 0x23, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xED, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x9A,
-	0xFF, 0xE5, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEA, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xEA, 0xFF, 0xF5, 0xFF, 0xED, 0xFF, 0xEB, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0xFF, 0xF5,
-	0xFF, 0xF4, 0xFF, 0xEF, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0xFF, 0xCE, 0xFF, 0x88, 0xFF, 0xA2,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xBB, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x0C, 0xFF, 0xC4, 0xFF, 0xA9, 0x00, 0x00, 0xFF, 0xDD, 0xFF, 0xC7, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1,
-	0xFF, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xED,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xFF, 0xED, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xED, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF3, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0x78, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEA, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEB, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xEB, 0xFF, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEA,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEE, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF2, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF3, 0x00, 0x00, 0xFF, 0xF1,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x95, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC5,
-	0xFF, 0x88, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xE3, 0xFF, 0xBF, 0xFF, 0xA2, 0xFF, 0xB7, 0xFF, 0xCB, 0xFF, 0xD9, 0xFF, 0xBF, 0xFF, 0xA0,
-	0xFF, 0xD8, 0x00, 0x00, 0xFF, 0xAB, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x12, 0xFF, 0xC6, 0xFF, 0xF0,
-	0x00, 0x11, 0xFF, 0x2D, 0x00, 0x11, 0x00, 0x00, 0xFF, 0xCC, 0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00,
-	0x00, 0x12, 0xFF, 0xA0, 0xFF, 0xF3, 0xFF, 0xF3, 0x00, 0x0D, 0xFF, 0xEF, 0xFF, 0xAB, 0xFF, 0xA2,
-	0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00,
-	0xFF, 0xF2, 0xFF, 0xD4, 0x00, 0x00, 0xFF, 0xCA, 0x00, 0x00, 0xFF, 0xDA, 0x00, 0x13, 0xFF, 0x7B,
-	0x00, 0x00, 0xFF, 0x11, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x71, 0x00, 0x00, 0xFE, 0xED, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0xFF, 0x51, 0x00, 0x00, 0xFF, 0x91, 0xFF, 0x3B,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE4, 0xFF, 0x9D,
-	0xFF, 0xB1, 0xFF, 0x8F, 0xFF, 0xB9, 0xFF, 0xA1, 0xFF, 0x9D, 0x00, 0x00, 0xFF, 0x93, 0x00, 0x00,
-	0xFF, 0xAF, 0xFF, 0xB8, 0x00, 0x00, 0x00, 0x10, 0xFF, 0x8C, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0x26,
-	0x00, 0x10, 0x00, 0x00, 0xFF, 0x18, 0xFF, 0xBC, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x10, 0xFF, 0x10,
-	0xFF, 0xF1, 0xFF, 0xF1, 0x00, 0x00, 0xFF, 0xED, 0xFF, 0xAF, 0xFF, 0xB1, 0xFF, 0xB3, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xE1, 0xFF, 0xD5, 0xFF, 0xDF, 0xFF, 0xE7, 0xFF, 0xED, 0xFF, 0xE1, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0x85, 0x00, 0x0E, 0x00, 0x00, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xCB, 0xFF, 0xD5,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xED, 0x00, 0x00, 0xFF, 0xD8,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
-	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x85, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE6, 0xFF, 0xEB,
-	0x00, 0x0D, 0x00, 0x00, 0xFF, 0xEC, 0xFF, 0xED, 0xFF, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x0D, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0xFF, 0xBB, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE1, 0xFF, 0xE6,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0xFF, 0xE9, 0xFF, 0xE5, 0x00, 0x00, 0xFF, 0xE9, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xF3, 0xFF, 0xD4, 0xFF, 0xB5, 0xFF, 0xD2, 0xFF, 0xD9, 0xFF, 0xE4, 0xFF, 0xD2, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xB4, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB4, 0xFF, 0xB5,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF3,
-	0xFF, 0x76, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xC6, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xBC,
-	0x00, 0x00, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x38,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xE1, 0x00, 0x00, 0xFF, 0xC6, 0xFF, 0x76, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0xFF, 0xEB,
-	0xFF, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD2, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0xFF, 0xC0,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xED, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x9A,
-	0xFF, 0xE5, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEA, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xEA, 0xFF, 0xF5, 0xFF, 0xED, 0xFF, 0xEB, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0xFF, 0xF5, 0xFF, 0xF4, 0xFF, 0xEF,
-	0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0xFF, 0xCE, 0x00, 0x00, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xBB, 0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xC4,
-	0xFF, 0xA9, 0x00, 0x00, 0xFF, 0xDD, 0xFF, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5A, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00,
-	0x00, 0x0B, 0x00, 0x0B, 0x00, 0x01, 0x00, 0x25, 0x00, 0x29, 0x00, 0x02, 0x00, 0x2C, 0x00, 0x34,
-	0x00, 0x07, 0x00, 0x38, 0x00, 0x3E, 0x00, 0x10, 0x00, 0x45, 0x00, 0x47, 0x00, 0x17, 0x00, 0x49,
-	0x00, 0x49, 0x00, 0x1A, 0x00, 0x4C, 0x00, 0x4C, 0x00, 0x1B, 0x00, 0x51, 0x00, 0x54, 0x00, 0x1C,
-	0x00, 0x56, 0x00, 0x56, 0x00, 0x20, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x21, 0x00, 0x5C, 0x00, 0x5E,
-	0x00, 0x22, 0x00, 0x8A, 0x00, 0x8A, 0x00, 0x25, 0x00, 0x96, 0x00, 0x96, 0x00, 0x26, 0x00, 0xB2,
-	0x00, 0xB2, 0x00, 0x27, 0x01, 0x84, 0x01, 0x85, 0x00, 0x28, 0x01, 0x87, 0x01, 0x89, 0x00, 0x2A,
-	0x01, 0xF2, 0x01, 0xF2, 0x00, 0x2D, 0x01, 0xF7, 0x01, 0xF7, 0x00, 0x2E, 0x01, 0xFA, 0x01, 0xFB,
-	0x00, 0x2F, 0x02, 0x05, 0x02, 0x05, 0x00, 0x31, 0x02, 0x4A, 0x02, 0x4A, 0x00, 0x32, 0x02, 0x4D,
-	0x02, 0x4D, 0x00, 0x33, 0x02, 0x5F, 0x02, 0x5F, 0x00, 0x34, 0x02, 0x61, 0x02, 0x62, 0x00, 0x35,
-	0x02, 0x95, 0x02, 0x96, 0x00, 0x37, 0x02, 0x98, 0x02, 0x98, 0x00, 0x39, 0x02, 0x9A, 0x02, 0xC0,
-	0x00, 0x3A, 0x02, 0xC5, 0x02, 0xCA, 0x00, 0x61, 0x02, 0xCF, 0x02, 0xDF, 0x00, 0x67, 0x02, 0xE1,
-	0x02, 0xEA, 0x00, 0x78, 0x02, 0xF3, 0x02, 0xF5, 0x00, 0x82, 0x02, 0xF7, 0x02, 0xF7, 0x00, 0x85,
-	0x02, 0xF9, 0x02, 0xF9, 0x00, 0x86, 0x02, 0xFB, 0x02, 0xFB, 0x00, 0x87, 0x02, 0xFD, 0x02, 0xFD,
-	0x00, 0x88, 0x03, 0x00, 0x03, 0x00, 0x00, 0x89, 0x03, 0x02, 0x03, 0x02, 0x00, 0x8A, 0x03, 0x04,
-	0x03, 0x04, 0x00, 0x8B, 0x03, 0x06, 0x03, 0x06, 0x00, 0x8C, 0x03, 0x08, 0x03, 0x08, 0x00, 0x8D,
-	0x03, 0x0A, 0x03, 0x0A, 0x00, 0x8E, 0x03, 0x0C, 0x03, 0x18, 0x00, 0x8F, 0x03, 0x1A, 0x03, 0x1A,
-	0x00, 0x9C, 0x03, 0x1C, 0x03, 0x1C, 0x00, 0x9D, 0x03, 0x1E, 0x03, 0x1E, 0x00, 0x9E, 0x03, 0x29,
-	0x03, 0x29, 0x00, 0x9F, 0x03, 0x2B, 0x03, 0x2B, 0x00, 0xA0, 0x03, 0x2D, 0x03, 0x2D, 0x00, 0xA1,
-	0x03, 0x2F, 0x03, 0x2F, 0x00, 0xA2, 0x03, 0x31, 0x03, 0x31, 0x00, 0xA3, 0x03, 0x33, 0x03, 0x33,
-	0x00, 0xA4, 0x03, 0x35, 0x03, 0x35, 0x00, 0xA5, 0x03, 0x37, 0x03, 0x37, 0x00, 0xA6, 0x03, 0x39,
-	0x03, 0x39, 0x00, 0xA7, 0x03, 0x3B, 0x03, 0x3B, 0x00, 0xA8, 0x03, 0x3D, 0x03, 0x45, 0x00, 0xA9,
-	0x03, 0x4A, 0x03, 0x53, 0x00, 0xB2, 0x03, 0x5E, 0x03, 0x62, 0x00, 0xBC, 0x03, 0x68, 0x03, 0x6A,
-	0x00, 0xC1, 0x03, 0x6F, 0x03, 0x6F, 0x00, 0xC4, 0x03, 0x80, 0x03, 0x84, 0x00, 0xC5, 0x03, 0x88,
-	0x03, 0x8A, 0x00, 0xCA, 0x03, 0x93, 0x03, 0x93, 0x00, 0xCD, 0x03, 0xEE, 0x03, 0xEE, 0x00, 0xCE,
-	0x03, 0xF0, 0x03, 0xF0, 0x00, 0xCF, 0x03, 0xF2, 0x03, 0xF2, 0x00, 0xD0, 0x03, 0xF4, 0x03, 0xF7,
-	0x00, 0xD1, 0x03, 0xFA, 0x03, 0xFE, 0x00, 0xD5, 0x04, 0x39, 0x04, 0x61, 0x00, 0xDA, 0x04, 0x63,
-	0x04, 0x63, 0x01, 0x03, 0x04, 0x65, 0x04, 0x72, 0x01, 0x04, 0x04, 0x7A, 0x04, 0x7A, 0x01, 0x12,
-	0x04, 0x7D, 0x04, 0x7D, 0x01, 0x13, 0x04, 0x7F, 0x04, 0x7F, 0x01, 0x14, 0x04, 0x8B, 0x04, 0x90,
-	0x01, 0x15, 0x04, 0xB2, 0x04, 0xB6, 0x01, 0x1B, 0x04, 0xB8, 0x04, 0xB8, 0x01, 0x20, 0x04, 0xBA,
-	0x04, 0xBB, 0x01, 0x21, 0x04, 0xBD, 0x04, 0xBD, 0x01, 0x23, 0x04, 0xC1, 0x04, 0xC3, 0x01, 0x24,
-	0x04, 0xC5, 0x04, 0xC5, 0x01, 0x27, 0x04, 0xC7, 0x04, 0xC9, 0x01, 0x28, 0x04, 0xCB, 0x04, 0xCB,
-	0x01, 0x2B, 0x04, 0xCD, 0x04, 0xCD, 0x01, 0x2C, 0x04, 0xCF, 0x04, 0xD5, 0x01, 0x2D, 0x04, 0xD7,
-	0x04, 0xD7, 0x01, 0x34, 0x04, 0xDA, 0x04, 0xDA, 0x01, 0x35, 0x04, 0xDC, 0x04, 0xE1, 0x01, 0x36,
-	0x04, 0xE3, 0x04, 0xE4, 0x01, 0x3C, 0x00, 0x02, 0x01, 0x09, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0D,
-	0x00, 0x0B, 0x00, 0x0B, 0x00, 0x0D, 0x00, 0x10, 0x00, 0x10, 0x00, 0x12, 0x00, 0x11, 0x00, 0x11,
-	0x00, 0x15, 0x00, 0x12, 0x00, 0x12, 0x00, 0x12, 0x00, 0x25, 0x00, 0x25, 0x00, 0x03, 0x00, 0x27,
-	0x00, 0x27, 0x00, 0x01, 0x00, 0x2B, 0x00, 0x2B, 0x00, 0x01, 0x00, 0x2E, 0x00, 0x2E, 0x00, 0x1A,
-	0x00, 0x33, 0x00, 0x33, 0x00, 0x01, 0x00, 0x35, 0x00, 0x35, 0x00, 0x01, 0x00, 0x37, 0x00, 0x37,
-	0x00, 0x10, 0x00, 0x38, 0x00, 0x38, 0x00, 0x13, 0x00, 0x39, 0x00, 0x39, 0x00, 0x08, 0x00, 0x3A,
-	0x00, 0x3A, 0x00, 0x19, 0x00, 0x3B, 0x00, 0x3B, 0x00, 0x11, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x1D,
-	0x00, 0x3D, 0x00, 0x3D, 0x00, 0x0E, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x14, 0x00, 0x45, 0x00, 0x45,
-	0x00, 0x04, 0x00, 0x47, 0x00, 0x49, 0x00, 0x02, 0x00, 0x4B, 0x00, 0x4B, 0x00, 0x02, 0x00, 0x51,
-	0x00, 0x52, 0x00, 0x09, 0x00, 0x53, 0x00, 0x53, 0x00, 0x07, 0x00, 0x54, 0x00, 0x54, 0x00, 0x09,
-	0x00, 0x55, 0x00, 0x55, 0x00, 0x02, 0x00, 0x57, 0x00, 0x57, 0x00, 0x0F, 0x00, 0x59, 0x00, 0x59,
-	0x00, 0x06, 0x00, 0x5A, 0x00, 0x5A, 0x00, 0x0C, 0x00, 0x5C, 0x00, 0x5C, 0x00, 0x21, 0x00, 0x5D,
-	0x00, 0x5D, 0x00, 0x0C, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x17, 0x00, 0x83, 0x00, 0x83, 0x00, 0x01,
-	0x00, 0x93, 0x00, 0x93, 0x00, 0x01, 0x00, 0x94, 0x00, 0x94, 0x00, 0x02, 0x00, 0x98, 0x00, 0x98,
-	0x00, 0x01, 0x00, 0x99, 0x00, 0x99, 0x00, 0x02, 0x00, 0x9B, 0x00, 0x9B, 0x00, 0x06, 0x00, 0xB2,
-	0x00, 0xB2, 0x00, 0x20, 0x01, 0x81, 0x01, 0x82, 0x00, 0x15, 0x01, 0x84, 0x01, 0x85, 0x00, 0x0D,
-	0x01, 0x86, 0x01, 0x86, 0x00, 0x12, 0x01, 0x87, 0x01, 0x89, 0x00, 0x0D, 0x01, 0x8A, 0x01, 0x8A,
-	0x00, 0x12, 0x01, 0x8E, 0x01, 0x8F, 0x00, 0x12, 0x01, 0xDB, 0x01, 0xDB, 0x00, 0x0F, 0x01, 0xED,
-	0x01, 0xED, 0x00, 0x18, 0x01, 0xEE, 0x01, 0xEE, 0x00, 0x1E, 0x01, 0xEF, 0x01, 0xEF, 0x00, 0x1B,
-	0x01, 0xF1, 0x01, 0xF1, 0x00, 0x0A, 0x01, 0xF2, 0x01, 0xF2, 0x00, 0x1C, 0x01, 0xF3, 0x01, 0xF3,
-	0x00, 0x16, 0x01, 0xF5, 0x01, 0xF5, 0x00, 0x05, 0x01, 0xF7, 0x01, 0xF7, 0x00, 0x05, 0x01, 0xFF,
-	0x01, 0xFF, 0x00, 0x05, 0x02, 0x05, 0x02, 0x05, 0x00, 0x1F, 0x02, 0x4B, 0x02, 0x4B, 0x00, 0x05,
-	0x02, 0x4D, 0x02, 0x4D, 0x00, 0x0B, 0x02, 0x5F, 0x02, 0x60, 0x00, 0x01, 0x02, 0x62, 0x02, 0x63,
-	0x00, 0x01, 0x02, 0x94, 0x02, 0x94, 0x00, 0x15, 0x02, 0x9A, 0x02, 0xA0, 0x00, 0x03, 0x02, 0xA1,
-	0x02, 0xA1, 0x00, 0x01, 0x02, 0xAB, 0x02, 0xAF, 0x00, 0x01, 0x02, 0xB0, 0x02, 0xB3, 0x00, 0x08,
-	0x02, 0xB4, 0x02, 0xB4, 0x00, 0x0E, 0x02, 0xB5, 0x02, 0xBB, 0x00, 0x04, 0x02, 0xBC, 0x02, 0xC0,
-	0x00, 0x02, 0x02, 0xC5, 0x02, 0xC5, 0x00, 0x09, 0x02, 0xC6, 0x02, 0xCA, 0x00, 0x07, 0x02, 0xCB,
-	0x02, 0xCE, 0x00, 0x06, 0x02, 0xCF, 0x02, 0xD0, 0x00, 0x0C, 0x02, 0xD1, 0x02, 0xD1, 0x00, 0x03,
-	0x02, 0xD2, 0x02, 0xD2, 0x00, 0x04, 0x02, 0xD3, 0x02, 0xD3, 0x00, 0x03, 0x02, 0xD4, 0x02, 0xD4,
-	0x00, 0x04, 0x02, 0xD5, 0x02, 0xD5, 0x00, 0x03, 0x02, 0xD6, 0x02, 0xD6, 0x00, 0x04, 0x02, 0xD7,
-	0x02, 0xD7, 0x00, 0x01, 0x02, 0xD8, 0x02, 0xD8, 0x00, 0x02, 0x02, 0xD9, 0x02, 0xD9, 0x00, 0x01,
-	0x02, 0xDA, 0x02, 0xDA, 0x00, 0x02, 0x02, 0xDB, 0x02, 0xDB, 0x00, 0x01, 0x02, 0xDC, 0x02, 0xDC,
-	0x00, 0x02, 0x02, 0xDD, 0x02, 0xDD, 0x00, 0x01, 0x02, 0xDE, 0x02, 0xDE, 0x00, 0x02, 0x02, 0xE0,
-	0x02, 0xE0, 0x00, 0x02, 0x02, 0xE2, 0x02, 0xE2, 0x00, 0x02, 0x02, 0xE4, 0x02, 0xE4, 0x00, 0x02,
-	0x02, 0xE6, 0x02, 0xE6, 0x00, 0x02, 0x02, 0xE8, 0x02, 0xE8, 0x00, 0x02, 0x02, 0xEA, 0x02, 0xEA,
-	0x00, 0x02, 0x02, 0xEB, 0x02, 0xEB, 0x00, 0x01, 0x02, 0xEC, 0x02, 0xEC, 0x00, 0x02, 0x02, 0xED,
-	0x02, 0xED, 0x00, 0x01, 0x02, 0xEE, 0x02, 0xEE, 0x00, 0x02, 0x02, 0xEF, 0x02, 0xEF, 0x00, 0x01,
-	0x02, 0xF0, 0x02, 0xF0, 0x00, 0x02, 0x02, 0xF1, 0x02, 0xF1, 0x00, 0x01, 0x02, 0xF2, 0x02, 0xF2,
-	0x00, 0x02, 0x03, 0x00, 0x03, 0x00, 0x00, 0x1A, 0x03, 0x0D, 0x03, 0x0D, 0x00, 0x09, 0x03, 0x0F,
-	0x03, 0x0F, 0x00, 0x09, 0x03, 0x11, 0x03, 0x12, 0x00, 0x09, 0x03, 0x13, 0x03, 0x13, 0x00, 0x01,
-	0x03, 0x14, 0x03, 0x14, 0x00, 0x07, 0x03, 0x15, 0x03, 0x15, 0x00, 0x01, 0x03, 0x16, 0x03, 0x16,
-	0x00, 0x07, 0x03, 0x17, 0x03, 0x17, 0x00, 0x01, 0x03, 0x18, 0x03, 0x18, 0x00, 0x07, 0x03, 0x1F,
-	0x03, 0x1F, 0x00, 0x10, 0x03, 0x20, 0x03, 0x20, 0x00, 0x0F, 0x03, 0x21, 0x03, 0x21, 0x00, 0x10,
-	0x03, 0x22, 0x03, 0x22, 0x00, 0x0F, 0x03, 0x23, 0x03, 0x23, 0x00, 0x10, 0x03, 0x24, 0x03, 0x24,
-	0x00, 0x0F, 0x03, 0x25, 0x03, 0x25, 0x00, 0x10, 0x03, 0x26, 0x03, 0x26, 0x00, 0x0F, 0x03, 0x27,
-	0x03, 0x27, 0x00, 0x10, 0x03, 0x28, 0x03, 0x28, 0x00, 0x0F, 0x03, 0x29, 0x03, 0x29, 0x00, 0x13,
-	0x03, 0x2B, 0x03, 0x2B, 0x00, 0x13, 0x03, 0x2D, 0x03, 0x2D, 0x00, 0x13, 0x03, 0x2F, 0x03, 0x2F,
-	0x00, 0x08, 0x03, 0x30, 0x03, 0x30, 0x00, 0x06, 0x03, 0x31, 0x03, 0x31, 0x00, 0x08, 0x03, 0x32,
-	0x03, 0x32, 0x00, 0x06, 0x03, 0x33, 0x03, 0x33, 0x00, 0x08, 0x03, 0x34, 0x03, 0x34, 0x00, 0x06,
-	0x03, 0x35, 0x03, 0x35, 0x00, 0x08, 0x03, 0x36, 0x03, 0x36, 0x00, 0x06, 0x03, 0x37, 0x03, 0x37,
-	0x00, 0x08, 0x03, 0x38, 0x03, 0x38, 0x00, 0x06, 0x03, 0x39, 0x03, 0x39, 0x00, 0x08, 0x03, 0x3A,
-	0x03, 0x3A, 0x00, 0x06, 0x03, 0x3B, 0x03, 0x3B, 0x00, 0x11, 0x03, 0x3D, 0x03, 0x3D, 0x00, 0x0E,
-	0x03, 0x3E, 0x03, 0x3E, 0x00, 0x0C, 0x03, 0x3F, 0x03, 0x3F, 0x00, 0x0E, 0x03, 0x40, 0x03, 0x40,
-	0x00, 0x14, 0x03, 0x41, 0x03, 0x41, 0x00, 0x17, 0x03, 0x42, 0x03, 0x42, 0x00, 0x14, 0x03, 0x43,
-	0x03, 0x43, 0x00, 0x17, 0x03, 0x44, 0x03, 0x44, 0x00, 0x14, 0x03, 0x45, 0x03, 0x45, 0x00, 0x17,
-	0x03, 0x48, 0x03, 0x48, 0x00, 0x01, 0x03, 0x4D, 0x03, 0x53, 0x00, 0x0B, 0x03, 0x54, 0x03, 0x54,
-	0x00, 0x05, 0x03, 0x5E, 0x03, 0x62, 0x00, 0x05, 0x03, 0x63, 0x03, 0x66, 0x00, 0x0A, 0x03, 0x67,
-	0x03, 0x67, 0x00, 0x18, 0x03, 0x68, 0x03, 0x6A, 0x00, 0x0B, 0x03, 0x6B, 0x03, 0x6E, 0x00, 0x05,
-	0x03, 0x75, 0x03, 0x78, 0x00, 0x05, 0x03, 0x88, 0x03, 0x8A, 0x00, 0x05, 0x03, 0x8E, 0x03, 0x91,
-	0x00, 0x16, 0x03, 0x93, 0x03, 0x93, 0x00, 0x1C, 0x03, 0x95, 0x03, 0x9A, 0x00, 0x0A, 0x03, 0x9B,
-	0x03, 0x9B, 0x00, 0x1B, 0x03, 0x9C, 0x03, 0x9D, 0x00, 0x18, 0x03, 0xEE, 0x03, 0xEE, 0x00, 0x11,
-	0x03, 0xF0, 0x03, 0xF0, 0x00, 0x11, 0x03, 0xF2, 0x03, 0xF2, 0x00, 0x11, 0x03, 0xF4, 0x03, 0xF4,
-	0x00, 0x0E, 0x03, 0xF5, 0x03, 0xF5, 0x00, 0x0C, 0x03, 0xF6, 0x03, 0xF7, 0x00, 0x0D, 0x03, 0xFA,
-	0x03, 0xFA, 0x00, 0x0D, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x09, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x03,
-	0x03, 0xFE, 0x03, 0xFE, 0x00, 0x04, 0x04, 0x39, 0x04, 0x39, 0x00, 0x03, 0x04, 0x3A, 0x04, 0x3A,
-	0x00, 0x04, 0x04, 0x3B, 0x04, 0x3B, 0x00, 0x03, 0x04, 0x3C, 0x04, 0x3C, 0x00, 0x04, 0x04, 0x3D,
-	0x04, 0x3D, 0x00, 0x03, 0x04, 0x3E, 0x04, 0x3E, 0x00, 0x04, 0x04, 0x3F, 0x04, 0x3F, 0x00, 0x03,
-	0x04, 0x40, 0x04, 0x40, 0x00, 0x04, 0x04, 0x41, 0x04, 0x41, 0x00, 0x03, 0x04, 0x42, 0x04, 0x42,
-	0x00, 0x04, 0x04, 0x43, 0x04, 0x43, 0x00, 0x03, 0x04, 0x44, 0x04, 0x44, 0x00, 0x04, 0x04, 0x45,
-	0x04, 0x45, 0x00, 0x03, 0x04, 0x46, 0x04, 0x46, 0x00, 0x04, 0x04, 0x47, 0x04, 0x47, 0x00, 0x03,
-	0x04, 0x48, 0x04, 0x48, 0x00, 0x04, 0x04, 0x49, 0x04, 0x49, 0x00, 0x03, 0x04, 0x4A, 0x04, 0x4A,
-	0x00, 0x04, 0x04, 0x4B, 0x04, 0x4B, 0x00, 0x03, 0x04, 0x4C, 0x04, 0x4C, 0x00, 0x04, 0x04, 0x4D,
-	0x04, 0x4D, 0x00, 0x03, 0x04, 0x4E, 0x04, 0x4E, 0x00, 0x04, 0x04, 0x4F, 0x04, 0x4F, 0x00, 0x03,
-	0x04, 0x50, 0x04, 0x50, 0x00, 0x04, 0x04, 0x52, 0x04, 0x52, 0x00, 0x02, 0x04, 0x54, 0x04, 0x54,
-	0x00, 0x02, 0x04, 0x56, 0x04, 0x56, 0x00, 0x02, 0x04, 0x58, 0x04, 0x58, 0x00, 0x02, 0x04, 0x5A,
-	0x04, 0x5A, 0x00, 0x02, 0x04, 0x5C, 0x04, 0x5C, 0x00, 0x02, 0x04, 0x5E, 0x04, 0x5E, 0x00, 0x02,
-	0x04, 0x60, 0x04, 0x60, 0x00, 0x02, 0x04, 0x65, 0x04, 0x65, 0x00, 0x01, 0x04, 0x66, 0x04, 0x66,
-	0x00, 0x07, 0x04, 0x67, 0x04, 0x67, 0x00, 0x01, 0x04, 0x68, 0x04, 0x68, 0x00, 0x07, 0x04, 0x69,
-	0x04, 0x69, 0x00, 0x01, 0x04, 0x6A, 0x04, 0x6A, 0x00, 0x07, 0x04, 0x6B, 0x04, 0x6B, 0x00, 0x01,
-	0x04, 0x6C, 0x04, 0x6C, 0x00, 0x07, 0x04, 0x6D, 0x04, 0x6D, 0x00, 0x01, 0x04, 0x6E, 0x04, 0x6E,
-	0x00, 0x07, 0x04, 0x6F, 0x04, 0x6F, 0x00, 0x01, 0x04, 0x70, 0x04, 0x70, 0x00, 0x07, 0x04, 0x71,
-	0x04, 0x71, 0x00, 0x01, 0x04, 0x72, 0x04, 0x72, 0x00, 0x07, 0x04, 0x73, 0x04, 0x73, 0x00, 0x01,
-	0x04, 0x74, 0x04, 0x74, 0x00, 0x02, 0x04, 0x75, 0x04, 0x75, 0x00, 0x01, 0x04, 0x76, 0x04, 0x76,
-	0x00, 0x02, 0x04, 0x77, 0x04, 0x77, 0x00, 0x01, 0x04, 0x78, 0x04, 0x78, 0x00, 0x02, 0x04, 0x79,
-	0x04, 0x79, 0x00, 0x01, 0x04, 0x7A, 0x04, 0x7A, 0x00, 0x07, 0x04, 0x7B, 0x04, 0x7B, 0x00, 0x01,
-	0x04, 0x7C, 0x04, 0x7C, 0x00, 0x02, 0x04, 0x7D, 0x04, 0x7D, 0x00, 0x08, 0x04, 0x7E, 0x04, 0x7E,
-	0x00, 0x06, 0x04, 0x7F, 0x04, 0x7F, 0x00, 0x08, 0x04, 0x80, 0x04, 0x80, 0x00, 0x06, 0x04, 0x82,
-	0x04, 0x82, 0x00, 0x06, 0x04, 0x84, 0x04, 0x84, 0x00, 0x06, 0x04, 0x86, 0x04, 0x86, 0x00, 0x06,
-	0x04, 0x88, 0x04, 0x88, 0x00, 0x06, 0x04, 0x8A, 0x04, 0x8A, 0x00, 0x06, 0x04, 0x8B, 0x04, 0x8B,
-	0x00, 0x0E, 0x04, 0x8C, 0x04, 0x8C, 0x00, 0x0C, 0x04, 0x8D, 0x04, 0x8D, 0x00, 0x0E, 0x04, 0x8E,
-	0x04, 0x8E, 0x00, 0x0C, 0x04, 0x8F, 0x04, 0x8F, 0x00, 0x0E, 0x04, 0x90, 0x04, 0x90, 0x00, 0x0C,
-	0x04, 0xA7, 0x04, 0xA7, 0x00, 0x15, 0x04, 0xB3, 0x04, 0xB3, 0x00, 0x09, 0x04, 0xB4, 0x04, 0xB4,
-	0x00, 0x03, 0x04, 0xB5, 0x04, 0xB5, 0x00, 0x04, 0x04, 0xB7, 0x04, 0xB7, 0x00, 0x02, 0x04, 0xBA,
-	0x04, 0xBA, 0x00, 0x01, 0x04, 0xBB, 0x04, 0xBB, 0x00, 0x07, 0x04, 0xBF, 0x04, 0xBF, 0x00, 0x06,
-	0x04, 0xC4, 0x04, 0xC4, 0x00, 0x02, 0x04, 0xC6, 0x04, 0xC6, 0x00, 0x02, 0x04, 0xD0, 0x04, 0xD0,
-	0x00, 0x09, 0x04, 0xD2, 0x04, 0xD2, 0x00, 0x09, 0x04, 0xD3, 0x04, 0xD3, 0x00, 0x01, 0x04, 0xD8,
-	0x04, 0xD8, 0x00, 0x10, 0x04, 0xD9, 0x04, 0xD9, 0x00, 0x0F, 0x04, 0xDA, 0x04, 0xDA, 0x00, 0x13,
-	0x04, 0xDC, 0x04, 0xDC, 0x00, 0x08, 0x04, 0xDD, 0x04, 0xDD, 0x00, 0x19, 0x04, 0xDE, 0x04, 0xDE,
-	0x00, 0x0C, 0x04, 0xDF, 0x04, 0xDF, 0x00, 0x19, 0x04, 0xE0, 0x04, 0xE0, 0x00, 0x0C, 0x04, 0xE1,
-	0x04, 0xE1, 0x00, 0x11, 0x04, 0xE3, 0x04, 0xE3, 0x00, 0x14, 0x04, 0xE4, 0x04, 0xE4, 0x00, 0x17,
-	0x00, 0x02, 0x00, 0xEC, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x0C,
-	0x00, 0x25, 0x00, 0x25, 0x00, 0x02, 0x00, 0x26, 0x00, 0x26, 0x00, 0x1B, 0x00, 0x27, 0x00, 0x27,
-	0x00, 0x0E, 0x00, 0x29, 0x00, 0x29, 0x00, 0x04, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x01, 0x00, 0x2E,
-	0x00, 0x2E, 0x00, 0x07, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0x0F,
-	0x00, 0x31, 0x00, 0x32, 0x00, 0x01, 0x00, 0x34, 0x00, 0x34, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x38,
-	0x00, 0x10, 0x00, 0x39, 0x00, 0x39, 0x00, 0x07, 0x00, 0x3A, 0x00, 0x3A, 0x00, 0x19, 0x00, 0x3B,
-	0x00, 0x3B, 0x00, 0x11, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x3D, 0x00, 0x3D, 0x00, 0x0D,
-	0x00, 0x3E, 0x00, 0x3E, 0x00, 0x14, 0x00, 0x45, 0x00, 0x45, 0x00, 0x03, 0x00, 0x46, 0x00, 0x46,
-	0x00, 0x15, 0x00, 0x47, 0x00, 0x47, 0x00, 0x12, 0x00, 0x49, 0x00, 0x49, 0x00, 0x05, 0x00, 0x4C,
-	0x00, 0x4C, 0x00, 0x08, 0x00, 0x51, 0x00, 0x52, 0x00, 0x08, 0x00, 0x53, 0x00, 0x53, 0x00, 0x06,
-	0x00, 0x54, 0x00, 0x54, 0x00, 0x15, 0x00, 0x56, 0x00, 0x56, 0x00, 0x13, 0x00, 0x5A, 0x00, 0x5A,
-	0x00, 0x0B, 0x00, 0x5C, 0x00, 0x5C, 0x00, 0x22, 0x00, 0x5D, 0x00, 0x5D, 0x00, 0x0B, 0x00, 0x5E,
-	0x00, 0x5E, 0x00, 0x17, 0x00, 0x8A, 0x00, 0x8A, 0x00, 0x15, 0x00, 0x96, 0x00, 0x96, 0x00, 0x20,
-	0x00, 0xB2, 0x00, 0xB2, 0x00, 0x21, 0x01, 0x84, 0x01, 0x85, 0x00, 0x0C, 0x01, 0x87, 0x01, 0x89,
-	0x00, 0x0C, 0x01, 0xF2, 0x01, 0xF2, 0x00, 0x1A, 0x01, 0xF7, 0x01, 0xF7, 0x00, 0x09, 0x01, 0xFA,
-	0x01, 0xFA, 0x00, 0x16, 0x01, 0xFB, 0x01, 0xFB, 0x00, 0x1D, 0x02, 0x05, 0x02, 0x05, 0x00, 0x1F,
-	0x02, 0x4A, 0x02, 0x4A, 0x00, 0x09, 0x02, 0x4D, 0x02, 0x4D, 0x00, 0x0A, 0x02, 0x5F, 0x02, 0x5F,
-	0x00, 0x0E, 0x02, 0x98, 0x02, 0x98, 0x00, 0x10, 0x02, 0x9A, 0x02, 0xA0, 0x00, 0x02, 0x02, 0xA1,
-	0x02, 0xA1, 0x00, 0x0E, 0x02, 0xA2, 0x02, 0xA5, 0x00, 0x04, 0x02, 0xA6, 0x02, 0xAA, 0x00, 0x01,
-	0x02, 0xB0, 0x02, 0xB3, 0x00, 0x07, 0x02, 0xB4, 0x02, 0xB4, 0x00, 0x0D, 0x02, 0xB5, 0x02, 0xBB,
-	0x00, 0x03, 0x02, 0xBC, 0x02, 0xBC, 0x00, 0x12, 0x02, 0xBD, 0x02, 0xC0, 0x00, 0x05, 0x02, 0xC5,
-	0x02, 0xC5, 0x00, 0x08, 0x02, 0xC6, 0x02, 0xCA, 0x00, 0x06, 0x02, 0xCF, 0x02, 0xD0, 0x00, 0x0B,
-	0x02, 0xD1, 0x02, 0xD1, 0x00, 0x02, 0x02, 0xD2, 0x02, 0xD2, 0x00, 0x03, 0x02, 0xD3, 0x02, 0xD3,
-	0x00, 0x02, 0x02, 0xD4, 0x02, 0xD4, 0x00, 0x03, 0x02, 0xD5, 0x02, 0xD5, 0x00, 0x02, 0x02, 0xD6,
-	0x02, 0xD6, 0x00, 0x03, 0x02, 0xD7, 0x02, 0xD7, 0x00, 0x0E, 0x02, 0xD8, 0x02, 0xD8, 0x00, 0x12,
-	0x02, 0xD9, 0x02, 0xD9, 0x00, 0x0E, 0x02, 0xDA, 0x02, 0xDA, 0x00, 0x12, 0x02, 0xDB, 0x02, 0xDB,
-	0x00, 0x0E, 0x02, 0xDC, 0x02, 0xDC, 0x00, 0x12, 0x02, 0xDD, 0x02, 0xDD, 0x00, 0x0E, 0x02, 0xDE,
-	0x02, 0xDE, 0x00, 0x12, 0x02, 0xE1, 0x02, 0xE1, 0x00, 0x04, 0x02, 0xE2, 0x02, 0xE2, 0x00, 0x05,
-	0x02, 0xE3, 0x02, 0xE3, 0x00, 0x04, 0x02, 0xE4, 0x02, 0xE4, 0x00, 0x05, 0x02, 0xE5, 0x02, 0xE5,
-	0x00, 0x04, 0x02, 0xE6, 0x02, 0xE6, 0x00, 0x05, 0x02, 0xE7, 0x02, 0xE7, 0x00, 0x04, 0x02, 0xE8,
-	0x02, 0xE8, 0x00, 0x05, 0x02, 0xE9, 0x02, 0xE9, 0x00, 0x04, 0x02, 0xEA, 0x02, 0xEA, 0x00, 0x05,
-	0x02, 0xF3, 0x02, 0xF3, 0x00, 0x01, 0x02, 0xF4, 0x02, 0xF4, 0x00, 0x08, 0x02, 0xF5, 0x02, 0xF5,
-	0x00, 0x01, 0x02, 0xF7, 0x02, 0xF7, 0x00, 0x01, 0x02, 0xF9, 0x02, 0xF9, 0x00, 0x01, 0x02, 0xFB,
-	0x02, 0xFB, 0x00, 0x01, 0x02, 0xFD, 0x02, 0xFD, 0x00, 0x01, 0x03, 0x00, 0x03, 0x00, 0x00, 0x07,
-	0x03, 0x02, 0x03, 0x02, 0x00, 0x18, 0x03, 0x04, 0x03, 0x04, 0x00, 0x0F, 0x03, 0x06, 0x03, 0x06,
-	0x00, 0x0F, 0x03, 0x08, 0x03, 0x08, 0x00, 0x0F, 0x03, 0x0A, 0x03, 0x0A, 0x00, 0x0F, 0x03, 0x0C,
-	0x03, 0x0C, 0x00, 0x01, 0x03, 0x0D, 0x03, 0x0D, 0x00, 0x08, 0x03, 0x0E, 0x03, 0x0E, 0x00, 0x01,
-	0x03, 0x0F, 0x03, 0x0F, 0x00, 0x08, 0x03, 0x10, 0x03, 0x10, 0x00, 0x01, 0x03, 0x11, 0x03, 0x12,
-	0x00, 0x08, 0x03, 0x14, 0x03, 0x14, 0x00, 0x06, 0x03, 0x16, 0x03, 0x16, 0x00, 0x06, 0x03, 0x18,
-	0x03, 0x18, 0x00, 0x06, 0x03, 0x1A, 0x03, 0x1A, 0x00, 0x13, 0x03, 0x1C, 0x03, 0x1C, 0x00, 0x13,
-	0x03, 0x1E, 0x03, 0x1E, 0x00, 0x13, 0x03, 0x29, 0x03, 0x29, 0x00, 0x10, 0x03, 0x2B, 0x03, 0x2B,
-	0x00, 0x10, 0x03, 0x2D, 0x03, 0x2D, 0x00, 0x10, 0x03, 0x2F, 0x03, 0x2F, 0x00, 0x07, 0x03, 0x31,
-	0x03, 0x31, 0x00, 0x07, 0x03, 0x33, 0x03, 0x33, 0x00, 0x07, 0x03, 0x35, 0x03, 0x35, 0x00, 0x07,
-	0x03, 0x37, 0x03, 0x37, 0x00, 0x07, 0x03, 0x39, 0x03, 0x39, 0x00, 0x07, 0x03, 0x3B, 0x03, 0x3B,
-	0x00, 0x11, 0x03, 0x3D, 0x03, 0x3D, 0x00, 0x0D, 0x03, 0x3E, 0x03, 0x3E, 0x00, 0x0B, 0x03, 0x3F,
-	0x03, 0x3F, 0x00, 0x0D, 0x03, 0x40, 0x03, 0x40, 0x00, 0x14, 0x03, 0x41, 0x03, 0x41, 0x00, 0x17,
-	0x03, 0x42, 0x03, 0x42, 0x00, 0x14, 0x03, 0x43, 0x03, 0x43, 0x00, 0x17, 0x03, 0x44, 0x03, 0x44,
-	0x00, 0x14, 0x03, 0x45, 0x03, 0x45, 0x00, 0x17, 0x03, 0x4A, 0x03, 0x4B, 0x00, 0x09, 0x03, 0x4C,
-	0x03, 0x4C, 0x00, 0x1A, 0x03, 0x4D, 0x03, 0x53, 0x00, 0x0A, 0x03, 0x5E, 0x03, 0x62, 0x00, 0x09,
-	0x03, 0x68, 0x03, 0x6A, 0x00, 0x0A, 0x03, 0x6F, 0x03, 0x6F, 0x00, 0x09, 0x03, 0x80, 0x03, 0x80,
-	0x00, 0x1D, 0x03, 0x81, 0x03, 0x84, 0x00, 0x16, 0x03, 0x88, 0x03, 0x8A, 0x00, 0x09, 0x03, 0x93,
-	0x03, 0x93, 0x00, 0x1A, 0x03, 0xEE, 0x03, 0xEE, 0x00, 0x11, 0x03, 0xF0, 0x03, 0xF0, 0x00, 0x11,
-	0x03, 0xF2, 0x03, 0xF2, 0x00, 0x11, 0x03, 0xF4, 0x03, 0xF4, 0x00, 0x0D, 0x03, 0xF5, 0x03, 0xF5,
-	0x00, 0x0B, 0x03, 0xF6, 0x03, 0xF7, 0x00, 0x0C, 0x03, 0xFA, 0x03, 0xFA, 0x00, 0x0C, 0x03, 0xFB,
-	0x03, 0xFB, 0x00, 0x01, 0x03, 0xFC, 0x03, 0xFC, 0x00, 0x08, 0x03, 0xFD, 0x03, 0xFD, 0x00, 0x02,
-	0x03, 0xFE, 0x03, 0xFE, 0x00, 0x03, 0x04, 0x39, 0x04, 0x39, 0x00, 0x02, 0x04, 0x3A, 0x04, 0x3A,
-	0x00, 0x03, 0x04, 0x3B, 0x04, 0x3B, 0x00, 0x02, 0x04, 0x3C, 0x04, 0x3C, 0x00, 0x03, 0x04, 0x3D,
-	0x04, 0x3D, 0x00, 0x02, 0x04, 0x3E, 0x04, 0x3E, 0x00, 0x03, 0x04, 0x3F, 0x04, 0x3F, 0x00, 0x02,
-	0x04, 0x40, 0x04, 0x40, 0x00, 0x03, 0x04, 0x41, 0x04, 0x41, 0x00, 0x02, 0x04, 0x42, 0x04, 0x42,
-	0x00, 0x03, 0x04, 0x43, 0x04, 0x43, 0x00, 0x02, 0x04, 0x44, 0x04, 0x44, 0x00, 0x03, 0x04, 0x45,
-	0x04, 0x45, 0x00, 0x02, 0x04, 0x46, 0x04, 0x46, 0x00, 0x03, 0x04, 0x47, 0x04, 0x47, 0x00, 0x02,
-	0x04, 0x48, 0x04, 0x48, 0x00, 0x03, 0x04, 0x49, 0x04, 0x49, 0x00, 0x02, 0x04, 0x4A, 0x04, 0x4A,
-	0x00, 0x03, 0x04, 0x4B, 0x04, 0x4B, 0x00, 0x02, 0x04, 0x4C, 0x04, 0x4C, 0x00, 0x03, 0x04, 0x4D,
-	0x04, 0x4D, 0x00, 0x02, 0x04, 0x4E, 0x04, 0x4E, 0x00, 0x03, 0x04, 0x4F, 0x04, 0x4F, 0x00, 0x02,
-	0x04, 0x50, 0x04, 0x50, 0x00, 0x03, 0x04, 0x51, 0x04, 0x51, 0x00, 0x04, 0x04, 0x52, 0x04, 0x52,
-	0x00, 0x05, 0x04, 0x53, 0x04, 0x53, 0x00, 0x04, 0x04, 0x54, 0x04, 0x54, 0x00, 0x05, 0x04, 0x55,
-	0x04, 0x55, 0x00, 0x04, 0x04, 0x56, 0x04, 0x56, 0x00, 0x05, 0x04, 0x57, 0x04, 0x57, 0x00, 0x04,
-	0x04, 0x58, 0x04, 0x58, 0x00, 0x05, 0x04, 0x59, 0x04, 0x59, 0x00, 0x04, 0x04, 0x5A, 0x04, 0x5A,
-	0x00, 0x05, 0x04, 0x5B, 0x04, 0x5B, 0x00, 0x04, 0x04, 0x5C, 0x04, 0x5C, 0x00, 0x05, 0x04, 0x5D,
-	0x04, 0x5D, 0x00, 0x04, 0x04, 0x5E, 0x04, 0x5E, 0x00, 0x05, 0x04, 0x5F, 0x04, 0x5F, 0x00, 0x04,
-	0x04, 0x60, 0x04, 0x60, 0x00, 0x05, 0x04, 0x61, 0x04, 0x61, 0x00, 0x01, 0x04, 0x63, 0x04, 0x63,
-	0x00, 0x01, 0x04, 0x66, 0x04, 0x66, 0x00, 0x06, 0x04, 0x68, 0x04, 0x68, 0x00, 0x06, 0x04, 0x6A,
-	0x04, 0x6A, 0x00, 0x06, 0x04, 0x6C, 0x04, 0x6C, 0x00, 0x06, 0x04, 0x6E, 0x04, 0x6E, 0x00, 0x06,
-	0x04, 0x70, 0x04, 0x70, 0x00, 0x06, 0x04, 0x72, 0x04, 0x72, 0x00, 0x06, 0x04, 0x7A, 0x04, 0x7A,
-	0x00, 0x06, 0x04, 0x7D, 0x04, 0x7D, 0x00, 0x07, 0x04, 0x7F, 0x04, 0x7F, 0x00, 0x07, 0x04, 0x8B,
-	0x04, 0x8B, 0x00, 0x0D, 0x04, 0x8C, 0x04, 0x8C, 0x00, 0x0B, 0x04, 0x8D, 0x04, 0x8D, 0x00, 0x0D,
-	0x04, 0x8E, 0x04, 0x8E, 0x00, 0x0B, 0x04, 0x8F, 0x04, 0x8F, 0x00, 0x0D, 0x04, 0x90, 0x04, 0x90,
-	0x00, 0x0B, 0x04, 0xB2, 0x04, 0xB2, 0x00, 0x01, 0x04, 0xB3, 0x04, 0xB3, 0x00, 0x08, 0x04, 0xB4,
-	0x04, 0xB4, 0x00, 0x02, 0x04, 0xB5, 0x04, 0xB5, 0x00, 0x03, 0x04, 0xB6, 0x04, 0xB6, 0x00, 0x04,
-	0x04, 0xB8, 0x04, 0xB8, 0x00, 0x01, 0x04, 0xBB, 0x04, 0xBB, 0x00, 0x06, 0x04, 0xBD, 0x04, 0xBD,
-	0x00, 0x13, 0x04, 0xC1, 0x04, 0xC1, 0x00, 0x1B, 0x04, 0xC2, 0x04, 0xC2, 0x00, 0x15, 0x04, 0xC7,
-	0x04, 0xC7, 0x00, 0x01, 0x04, 0xC8, 0x04, 0xC8, 0x00, 0x08, 0x04, 0xC9, 0x04, 0xC9, 0x00, 0x18,
-	0x04, 0xCB, 0x04, 0xCB, 0x00, 0x18, 0x04, 0xCD, 0x04, 0xCD, 0x00, 0x0F, 0x04, 0xCF, 0x04, 0xCF,
-	0x00, 0x01, 0x04, 0xD0, 0x04, 0xD0, 0x00, 0x08, 0x04, 0xD1, 0x04, 0xD1, 0x00, 0x01, 0x04, 0xD2,
-	0x04, 0xD2, 0x00, 0x08, 0x04, 0xD4, 0x04, 0xD4, 0x00, 0x1C, 0x04, 0xD5, 0x04, 0xD5, 0x00, 0x15,
-	0x04, 0xD7, 0x04, 0xD7, 0x00, 0x13, 0x04, 0xDA, 0x04, 0xDA, 0x00, 0x10, 0x04, 0xDC, 0x04, 0xDC,
-	0x00, 0x07, 0x04, 0xDD, 0x04, 0xDD, 0x00, 0x19, 0x04, 0xDE, 0x04, 0xDE, 0x00, 0x0B, 0x04, 0xDF,
-	0x04, 0xDF, 0x00, 0x19, 0x04, 0xE0, 0x04, 0xE0, 0x00, 0x0B, 0x04, 0xE1, 0x04, 0xE1, 0x00, 0x11,
-	0x04, 0xE3, 0x04, 0xE3, 0x00, 0x14, 0x04, 0xE4, 0x04, 0xE4, 0x00, 0x17, 0x00, 0x01, 0x01, 0xF2,
-	0x00, 0x04, 0x00, 0x00, 0x00, 0xF4, 0x0D, 0x22, 0x0D, 0x1C, 0x0D, 0x1C, 0x0C, 0xD6, 0x0C, 0xC0,
-	0x0C, 0xB2, 0x0C, 0xAC, 0x0C, 0x9E, 0x0A, 0x00, 0x09, 0xF2, 0x09, 0xDC, 0x0C, 0xAC, 0x09, 0xD2,
-	0x09, 0x48, 0x09, 0x06, 0x08, 0xE4, 0x08, 0xD2, 0x08, 0xBC, 0x08, 0xB2, 0x08, 0x74, 0x08, 0x66,
-	0x08, 0x24, 0x16, 0xC4, 0x07, 0x4A, 0x16, 0xC4, 0x06, 0xA4, 0x16, 0xC4, 0x16, 0xC4, 0x16, 0xC4,
-	0x06, 0x96, 0x06, 0x48, 0x06, 0x42, 0x06, 0x28, 0x06, 0x42, 0x05, 0xE6, 0x0C, 0xAC, 0x05, 0x90,
-	0x05, 0x7E, 0x0D, 0x1C, 0x04, 0x54, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x04, 0x4E, 0x04, 0x28,
-	0x04, 0x02, 0x03, 0xFC, 0x03, 0xF2, 0x03, 0xEC, 0x03, 0xDE, 0x03, 0xEC, 0x0C, 0xB2, 0x0C, 0xAC,
-	0x0C, 0xAC, 0x0C, 0xAC, 0x0C, 0xAC, 0x08, 0xE4, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0,
-	0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xB2, 0x0C, 0x9E, 0x0C, 0x9E, 0x0C, 0x9E, 0x0C, 0x9E,
-	0x0C, 0xAC, 0x0C, 0xAC, 0x0C, 0xAC, 0x0C, 0xAC, 0x0C, 0xAC, 0x08, 0x74, 0x16, 0xC4, 0x16, 0xC4,
-	0x16, 0xC4, 0x16, 0xC4, 0x16, 0xC4, 0x16, 0xC4, 0x16, 0xC4, 0x16, 0xC4, 0x16, 0xC4, 0x16, 0xC4,
-	0x06, 0x42, 0x06, 0x42, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xB2, 0x0C, 0xB2, 0x0C, 0xB2,
-	0x0C, 0xB2, 0x0C, 0xAC, 0x0C, 0x9E, 0x16, 0xC4, 0x0C, 0x9E, 0x16, 0xC4, 0x0C, 0x9E, 0x16, 0xC4,
-	0x0C, 0x9E, 0x16, 0xC4, 0x0C, 0x9E, 0x16, 0xC4, 0x16, 0xC4, 0x09, 0xF2, 0x09, 0xDC, 0x09, 0xDC,
-	0x09, 0xDC, 0x09, 0xDC, 0x16, 0xC4, 0x16, 0xC4, 0x16, 0xC4, 0x16, 0xC4, 0x0C, 0xAC, 0x16, 0xC4,
-	0x0C, 0xAC, 0x16, 0xC4, 0x0C, 0xAC, 0x16, 0xC4, 0x06, 0x96, 0x06, 0x96, 0x06, 0x96, 0x08, 0xE4,
-	0x08, 0xE4, 0x08, 0xE4, 0x08, 0xBC, 0x08, 0x74, 0x06, 0x42, 0x08, 0x74, 0x08, 0x66, 0x08, 0x66,
-	0x08, 0x66, 0x03, 0xFC, 0x03, 0xFC, 0x04, 0x4E, 0x03, 0xEC, 0x03, 0xEC, 0x03, 0xEC, 0x03, 0xEC,
-	0x03, 0xEC, 0x03, 0xEC, 0x03, 0xEC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC,
-	0x03, 0xEC, 0x03, 0xEC, 0x03, 0xEC, 0x03, 0xFC, 0x03, 0xF2, 0x03, 0xF2, 0x03, 0xF2, 0x03, 0xF2,
-	0x03, 0xFC, 0x03, 0xFC, 0x03, 0xFC, 0x04, 0x4E, 0x08, 0xBC, 0x08, 0xBC, 0x08, 0xBC, 0x08, 0x74,
-	0x06, 0x42, 0x0D, 0x1C, 0x0D, 0x1C, 0x0D, 0x1C, 0x16, 0xC4, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0,
-	0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0xC0,
-	0x0C, 0xC0, 0x0C, 0xC0, 0x0C, 0x9E, 0x16, 0xC4, 0x0C, 0x9E, 0x16, 0xC4, 0x0C, 0x9E, 0x16, 0xC4,
-	0x0C, 0x9E, 0x16, 0xC4, 0x0C, 0x9E, 0x16, 0xC4, 0x0C, 0x9E, 0x16, 0xC4, 0x0C, 0x9E, 0x16, 0xC4,
-	0x0C, 0x9E, 0x16, 0xC4, 0x0C, 0xAC, 0x16, 0xC4, 0x0C, 0xAC, 0x16, 0xC4, 0x0C, 0xAC, 0x16, 0xC4,
-	0x0C, 0xAC, 0x16, 0xC4, 0x0C, 0xAC, 0x16, 0xC4, 0x0C, 0xAC, 0x16, 0xC4, 0x0C, 0xAC, 0x16, 0xC4,
-	0x16, 0xC4, 0x08, 0x74, 0x06, 0x42, 0x08, 0x74, 0x06, 0x42, 0x08, 0x74, 0x06, 0x42, 0x16, 0xC4,
-	0x0C, 0xC0, 0x0C, 0x9E, 0x0C, 0xAC, 0x16, 0xC4, 0x06, 0x96, 0x0C, 0xAC, 0x0C, 0xAC, 0x16, 0xC4,
-	0x09, 0xF2, 0x09, 0xF2, 0x09, 0xDC, 0x16, 0xC4, 0x16, 0xC4, 0x0C, 0xAC, 0x09, 0xD2, 0x06, 0x96,
-	0x08, 0xE4, 0x08, 0xD2, 0x06, 0x42, 0x08, 0xD2, 0x06, 0x42, 0x08, 0xBC, 0x08, 0x66, 0x00, 0x01,
-	0x00, 0xF4, 0x00, 0x04, 0x00, 0x06, 0x00, 0x0B, 0x00, 0x0C, 0x00, 0x25, 0x00, 0x27, 0x00, 0x28,
-	0x00, 0x29, 0x00, 0x2A, 0x00, 0x2F, 0x00, 0x30, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36,
-	0x00, 0x38, 0x00, 0x3A, 0x00, 0x3B, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x49,
-	0x00, 0x4A, 0x00, 0x4C, 0x00, 0x4F, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x56, 0x00, 0x58,
-	0x00, 0x5A, 0x00, 0x5B, 0x00, 0x5D, 0x00, 0x5F, 0x00, 0x96, 0x00, 0x9D, 0x00, 0xB2, 0x01, 0x84,
-	0x01, 0x85, 0x01, 0x87, 0x01, 0x88, 0x01, 0x89, 0x01, 0xF2, 0x01, 0xF4, 0x01, 0xF5, 0x01, 0xF7,
-	0x01, 0xFA, 0x02, 0x05, 0x02, 0x4A, 0x02, 0x4D, 0x02, 0x5F, 0x02, 0x61, 0x02, 0x62, 0x02, 0x95,
-	0x02, 0x96, 0x02, 0x98, 0x02, 0x9A, 0x02, 0x9B, 0x02, 0x9C, 0x02, 0x9D, 0x02, 0x9E, 0x02, 0x9F,
-	0x02, 0xA0, 0x02, 0xA1, 0x02, 0xA2, 0x02, 0xA3, 0x02, 0xA4, 0x02, 0xA5, 0x02, 0xAB, 0x02, 0xAC,
-	0x02, 0xAD, 0x02, 0xAE, 0x02, 0xAF, 0x02, 0xB4, 0x02, 0xBD, 0x02, 0xBE, 0x02, 0xBF, 0x02, 0xC0,
-	0x02, 0xC5, 0x02, 0xC6, 0x02, 0xC7, 0x02, 0xC8, 0x02, 0xC9, 0x02, 0xCA, 0x02, 0xCF, 0x02, 0xD0,
-	0x02, 0xD1, 0x02, 0xD3, 0x02, 0xD5, 0x02, 0xD7, 0x02, 0xD9, 0x02, 0xDB, 0x02, 0xDD, 0x02, 0xDF,
-	0x02, 0xE1, 0x02, 0xE2, 0x02, 0xE3, 0x02, 0xE4, 0x02, 0xE5, 0x02, 0xE6, 0x02, 0xE7, 0x02, 0xE8,
-	0x02, 0xE9, 0x02, 0xEA, 0x02, 0xF4, 0x03, 0x02, 0x03, 0x04, 0x03, 0x06, 0x03, 0x08, 0x03, 0x0A,
-	0x03, 0x0D, 0x03, 0x0F, 0x03, 0x11, 0x03, 0x12, 0x03, 0x13, 0x03, 0x14, 0x03, 0x15, 0x03, 0x16,
-	0x03, 0x17, 0x03, 0x18, 0x03, 0x1A, 0x03, 0x1C, 0x03, 0x1E, 0x03, 0x29, 0x03, 0x2B, 0x03, 0x2D,
-	0x03, 0x3B, 0x03, 0x3D, 0x03, 0x3E, 0x03, 0x3F, 0x03, 0x40, 0x03, 0x42, 0x03, 0x44, 0x03, 0x4A,
-	0x03, 0x4B, 0x03, 0x4C, 0x03, 0x4D, 0x03, 0x4E, 0x03, 0x4F, 0x03, 0x50, 0x03, 0x51, 0x03, 0x52,
-	0x03, 0x53, 0x03, 0x5E, 0x03, 0x5F, 0x03, 0x60, 0x03, 0x61, 0x03, 0x62, 0x03, 0x68, 0x03, 0x69,
-	0x03, 0x6A, 0x03, 0x6F, 0x03, 0x81, 0x03, 0x82, 0x03, 0x83, 0x03, 0x84, 0x03, 0x88, 0x03, 0x89,
-	0x03, 0x8A, 0x03, 0x93, 0x03, 0xEE, 0x03, 0xF0, 0x03, 0xF2, 0x03, 0xF4, 0x03, 0xF5, 0x03, 0xF6,
-	0x03, 0xF7, 0x03, 0xFA, 0x03, 0xFC, 0x03, 0xFD, 0x04, 0x39, 0x04, 0x3B, 0x04, 0x3D, 0x04, 0x3F,
-	0x04, 0x41, 0x04, 0x43, 0x04, 0x45, 0x04, 0x47, 0x04, 0x49, 0x04, 0x4B, 0x04, 0x4D, 0x04, 0x4F,
-	0x04, 0x51, 0x04, 0x52, 0x04, 0x53, 0x04, 0x54, 0x04, 0x55, 0x04, 0x56, 0x04, 0x57, 0x04, 0x58,
-	0x04, 0x59, 0x04, 0x5A, 0x04, 0x5B, 0x04, 0x5C, 0x04, 0x5D, 0x04, 0x5E, 0x04, 0x5F, 0x04, 0x60,
-	0x04, 0x65, 0x04, 0x66, 0x04, 0x67, 0x04, 0x68, 0x04, 0x69, 0x04, 0x6A, 0x04, 0x6B, 0x04, 0x6C,
-	0x04, 0x6D, 0x04, 0x6E, 0x04, 0x6F, 0x04, 0x70, 0x04, 0x71, 0x04, 0x72, 0x04, 0x7A, 0x04, 0x8B,
-	0x04, 0x8C, 0x04, 0x8D, 0x04, 0x8E, 0x04, 0x8F, 0x04, 0x90, 0x04, 0xB3, 0x04, 0xB4, 0x04, 0xB6,
-	0x04, 0xBA, 0x04, 0xBB, 0x04, 0xBD, 0x04, 0xC3, 0x04, 0xC5, 0x04, 0xC8, 0x04, 0xC9, 0x04, 0xCB,
-	0x04, 0xCD, 0x04, 0xD0, 0x04, 0xD2, 0x04, 0xD3, 0x04, 0xD4, 0x04, 0xD7, 0x04, 0xDA, 0x04, 0xDD,
-	0x04, 0xDE, 0x04, 0xDF, 0x04, 0xE0, 0x04, 0xE1, 0x04, 0xE3, 0x00, 0x03, 0x01, 0xEF, 0xFF, 0xF5,
-	0x01, 0xF0, 0xFF, 0xEE, 0x03, 0x9B, 0xFF, 0xF5, 0x00, 0x01, 0x01, 0xF0, 0xFF, 0xC7, 0x00, 0x02,
-	0x01, 0xF0, 0xFF, 0xB7, 0x01, 0xF5, 0xFF, 0xF0, 0x00, 0x01, 0x01, 0xF0, 0xFF, 0xF1, 0x00, 0x09,
-	0x01, 0xED, 0xFF, 0xE5, 0x01, 0xEF, 0xFF, 0xF1, 0x01, 0xF0, 0xFF, 0xEB, 0x01, 0xF2, 0xFF, 0xE9,
-	0x03, 0x67, 0xFF, 0xE5, 0x03, 0x93, 0xFF, 0xE9, 0x03, 0x9B, 0xFF, 0xF1, 0x03, 0x9C, 0xFF, 0xE5,
-	0x03, 0x9D, 0xFF, 0xE5, 0x00, 0x09, 0x01, 0xED, 0xFF, 0xEE, 0x01, 0xEF, 0xFF, 0xF5, 0x01, 0xF0,
-	0xFF, 0xF1, 0x01, 0xF2, 0xFF, 0xF2, 0x03, 0x67, 0xFF, 0xEE, 0x03, 0x93, 0xFF, 0xF2, 0x03, 0x9B,
-	0xFF, 0xF5, 0x03, 0x9C, 0xFF, 0xEE, 0x03, 0x9D, 0xFF, 0xEE, 0x00, 0x01, 0x01, 0xF0, 0x00, 0x0D,
-	0x00, 0x4A, 0x00, 0x47, 0xFF, 0xC5, 0x00, 0x48, 0xFF, 0xC5, 0x00, 0x49, 0xFF, 0xC5, 0x00, 0x4B,
-	0xFF, 0xC5, 0x00, 0x4C, 0x00, 0x20, 0x00, 0x4F, 0x00, 0x20, 0x00, 0x50, 0x00, 0x20, 0x00, 0x53,
-	0xFF, 0x80, 0x00, 0x55, 0xFF, 0xC5, 0x00, 0x57, 0xFF, 0x90, 0x00, 0x5B, 0x00, 0x0B, 0x00, 0x94,
-	0xFF, 0xC5, 0x00, 0x99, 0xFF, 0xC5, 0x01, 0xDB, 0xFF, 0x90, 0x02, 0xBC, 0xFF, 0xC5, 0x02, 0xBD,
-	0xFF, 0xC5, 0x02, 0xBE, 0xFF, 0xC5, 0x02, 0xBF, 0xFF, 0xC5, 0x02, 0xC0, 0xFF, 0xC5, 0x02, 0xC6,
-	0xFF, 0x80, 0x02, 0xC7, 0xFF, 0x80, 0x02, 0xC8, 0xFF, 0x80, 0x02, 0xC9, 0xFF, 0x80, 0x02, 0xCA,
-	0xFF, 0x80, 0x02, 0xD8, 0xFF, 0xC5, 0x02, 0xDA, 0xFF, 0xC5, 0x02, 0xDC, 0xFF, 0xC5, 0x02, 0xDE,
-	0xFF, 0xC5, 0x02, 0xE0, 0xFF, 0xC5, 0x02, 0xE2, 0xFF, 0xC5, 0x02, 0xE4, 0xFF, 0xC5, 0x02, 0xE6,
-	0xFF, 0xC5, 0x02, 0xE8, 0xFF, 0xC5, 0x02, 0xEA, 0xFF, 0xC5, 0x02, 0xEC, 0xFF, 0xC5, 0x02, 0xEE,
-	0xFF, 0xC5, 0x02, 0xF0, 0xFF, 0xC5, 0x02, 0xF2, 0xFF, 0xC5, 0x03, 0x14, 0xFF, 0x80, 0x03, 0x16,
-	0xFF, 0x80, 0x03, 0x18, 0xFF, 0x80, 0x03, 0x20, 0xFF, 0x90, 0x03, 0x22, 0xFF, 0x90, 0x03, 0x24,
-	0xFF, 0x90, 0x03, 0x26, 0xFF, 0x90, 0x03, 0x28, 0xFF, 0x90, 0x04, 0x52, 0xFF, 0xC5, 0x04, 0x54,
-	0xFF, 0xC5, 0x04, 0x56, 0xFF, 0xC5, 0x04, 0x58, 0xFF, 0xC5, 0x04, 0x5A, 0xFF, 0xC5, 0x04, 0x5C,
-	0xFF, 0xC5, 0x04, 0x5E, 0xFF, 0xC5, 0x04, 0x60, 0xFF, 0xC5, 0x04, 0x66, 0xFF, 0x80, 0x04, 0x68,
-	0xFF, 0x80, 0x04, 0x6A, 0xFF, 0x80, 0x04, 0x6C, 0xFF, 0x80, 0x04, 0x6E, 0xFF, 0x80, 0x04, 0x70,
-	0xFF, 0x80, 0x04, 0x72, 0xFF, 0x80, 0x04, 0x74, 0xFF, 0xC5, 0x04, 0x76, 0xFF, 0xC5, 0x04, 0x78,
-	0xFF, 0xC5, 0x04, 0x7A, 0xFF, 0x80, 0x04, 0x7C, 0xFF, 0xC5, 0x04, 0xB7, 0xFF, 0xC5, 0x04, 0xBB,
-	0xFF, 0x80, 0x04, 0xC4, 0xFF, 0xC5, 0x04, 0xC6, 0xFF, 0xC5, 0x04, 0xC8, 0x00, 0x20, 0x04, 0xCA,
-	0x00, 0x20, 0x04, 0xCC, 0x00, 0x20, 0x04, 0xD9, 0xFF, 0x90, 0x00, 0x04, 0x00, 0x58, 0xFF, 0xEF,
-	0x00, 0x5B, 0xFF, 0xDF, 0x00, 0x9A, 0xFF, 0xEE, 0x01, 0xF0, 0xFF, 0xCD, 0x00, 0x15, 0x00, 0x06,
-	0xFF, 0xF2, 0x00, 0x0B, 0xFF, 0xF2, 0x00, 0x5A, 0xFF, 0xF3, 0x00, 0x5D, 0xFF, 0xF3, 0x01, 0x84,
-	0xFF, 0xF2, 0x01, 0x85, 0xFF, 0xF2, 0x01, 0x87, 0xFF, 0xF2, 0x01, 0x88, 0xFF, 0xF2, 0x01, 0x89,
-	0xFF, 0xF2, 0x02, 0xCF, 0xFF, 0xF3, 0x02, 0xD0, 0xFF, 0xF3, 0x03, 0x3E, 0xFF, 0xF3, 0x03, 0xF5,
-	0xFF, 0xF3, 0x03, 0xF6, 0xFF, 0xF2, 0x03, 0xF7, 0xFF, 0xF2, 0x03, 0xFA, 0xFF, 0xF2, 0x04, 0x8C,
-	0xFF, 0xF3, 0x04, 0x8E, 0xFF, 0xF3, 0x04, 0x90, 0xFF, 0xF3, 0x04, 0xDE, 0xFF, 0xF3, 0x04, 0xE0,
-	0xFF, 0xF3, 0x00, 0x10, 0x00, 0x2E, 0xFF, 0xEC, 0x00, 0x39, 0xFF, 0xEC, 0x02, 0xB0, 0xFF, 0xEC,
-	0x02, 0xB1, 0xFF, 0xEC, 0x02, 0xB2, 0xFF, 0xEC, 0x02, 0xB3, 0xFF, 0xEC, 0x03, 0x00, 0xFF, 0xEC,
-	0x03, 0x2F, 0xFF, 0xEC, 0x03, 0x31, 0xFF, 0xEC, 0x03, 0x33, 0xFF, 0xEC, 0x03, 0x35, 0xFF, 0xEC,
-	0x03, 0x37, 0xFF, 0xEC, 0x03, 0x39, 0xFF, 0xEC, 0x04, 0x7D, 0xFF, 0xEC, 0x04, 0x7F, 0xFF, 0xEC,
-	0x04, 0xDC, 0xFF, 0xEC, 0x00, 0x06, 0x00, 0x10, 0xFF, 0x84, 0x00, 0x12, 0xFF, 0x84, 0x01, 0x86,
-	0xFF, 0x84, 0x01, 0x8A, 0xFF, 0x84, 0x01, 0x8E, 0xFF, 0x84, 0x01, 0x8F, 0xFF, 0x84, 0x00, 0x01,
-	0x00, 0x4A, 0x00, 0x0D, 0x00, 0x13, 0x00, 0x53, 0xFF, 0xEC, 0x01, 0x85, 0x00, 0x00, 0x02, 0xC6,
-	0xFF, 0xEC, 0x02, 0xC7, 0xFF, 0xEC, 0x02, 0xC8, 0xFF, 0xEC, 0x02, 0xC9, 0xFF, 0xEC, 0x02, 0xCA,
-	0xFF, 0xEC, 0x03, 0x14, 0xFF, 0xEC, 0x03, 0x16, 0xFF, 0xEC, 0x03, 0x18, 0xFF, 0xEC, 0x04, 0x66,
-	0xFF, 0xEC, 0x04, 0x68, 0xFF, 0xEC, 0x04, 0x6A, 0xFF, 0xEC, 0x04, 0x6C, 0xFF, 0xEC, 0x04, 0x6E,
-	0xFF, 0xEC, 0x04, 0x70, 0xFF, 0xEC, 0x04, 0x72, 0xFF, 0xEC, 0x04, 0x7A, 0xFF, 0xEC, 0x04, 0xBB,
-	0xFF, 0xEC, 0x00, 0x03, 0x00, 0x4A, 0x00, 0x0F, 0x00, 0x58, 0x00, 0x32, 0x00, 0x5B, 0x00, 0x11,
-	0x00, 0x29, 0x00, 0x47, 0xFF, 0xEC, 0x00, 0x48, 0xFF, 0xEC, 0x00, 0x49, 0xFF, 0xEC, 0x00, 0x4B,
-	0xFF, 0xEC, 0x00, 0x55, 0xFF, 0xEC, 0x00, 0x94, 0xFF, 0xEC, 0x00, 0x99, 0xFF, 0xEC, 0x02, 0xBC,
-	0xFF, 0xEC, 0x02, 0xBD, 0xFF, 0xEC, 0x02, 0xBE, 0xFF, 0xEC, 0x02, 0xBF, 0xFF, 0xEC, 0x02, 0xC0,
-	0xFF, 0xEC, 0x02, 0xD8, 0xFF, 0xEC, 0x02, 0xDA, 0xFF, 0xEC, 0x02, 0xDC, 0xFF, 0xEC, 0x02, 0xDE,
-	0xFF, 0xEC, 0x02, 0xE0, 0xFF, 0xEC, 0x02, 0xE2, 0xFF, 0xEC, 0x02, 0xE4, 0xFF, 0xEC, 0x02, 0xE6,
-	0xFF, 0xEC, 0x02, 0xE8, 0xFF, 0xEC, 0x02, 0xEA, 0xFF, 0xEC, 0x02, 0xEC, 0xFF, 0xEC, 0x02, 0xEE,
-	0xFF, 0xEC, 0x02, 0xF0, 0xFF, 0xEC, 0x02, 0xF2, 0xFF, 0xEC, 0x04, 0x52, 0xFF, 0xEC, 0x04, 0x54,
-	0xFF, 0xEC, 0x04, 0x56, 0xFF, 0xEC, 0x04, 0x58, 0xFF, 0xEC, 0x04, 0x5A, 0xFF, 0xEC, 0x04, 0x5C,
-	0xFF, 0xEC, 0x04, 0x5E, 0xFF, 0xEC, 0x04, 0x60, 0xFF, 0xEC, 0x04, 0x74, 0xFF, 0xEC, 0x04, 0x76,
-	0xFF, 0xEC, 0x04, 0x78, 0xFF, 0xEC, 0x04, 0x7C, 0xFF, 0xEC, 0x04, 0xB7, 0xFF, 0xEC, 0x04, 0xC4,
-	0xFF, 0xEC, 0x04, 0xC6, 0xFF, 0xEC, 0x00, 0x36, 0x00, 0x06, 0x00, 0x10, 0x00, 0x0B, 0x00, 0x10,
-	0x00, 0x0D, 0x00, 0x14, 0x00, 0x41, 0x00, 0x12, 0x00, 0x47, 0xFF, 0xE8, 0x00, 0x48, 0xFF, 0xE8,
-	0x00, 0x49, 0xFF, 0xE8, 0x00, 0x4B, 0xFF, 0xE8, 0x00, 0x55, 0xFF, 0xE8, 0x00, 0x61, 0x00, 0x13,
-	0x00, 0x94, 0xFF, 0xE8, 0x00, 0x99, 0xFF, 0xE8, 0x01, 0x84, 0x00, 0x10, 0x01, 0x85, 0x00, 0x10,
-	0x01, 0x87, 0x00, 0x10, 0x01, 0x88, 0x00, 0x10, 0x01, 0x89, 0x00, 0x10, 0x02, 0xBC, 0xFF, 0xE8,
-	0x02, 0xBD, 0xFF, 0xE8, 0x02, 0xBE, 0xFF, 0xE8, 0x02, 0xBF, 0xFF, 0xE8, 0x02, 0xC0, 0xFF, 0xE8,
-	0x02, 0xD8, 0xFF, 0xE8, 0x02, 0xDA, 0xFF, 0xE8, 0x02, 0xDC, 0xFF, 0xE8, 0x02, 0xDE, 0xFF, 0xE8,
-	0x02, 0xE0, 0xFF, 0xE8, 0x02, 0xE2, 0xFF, 0xE8, 0x02, 0xE4, 0xFF, 0xE8, 0x02, 0xE6, 0xFF, 0xE8,
-	0x02, 0xE8, 0xFF, 0xE8, 0x02, 0xEA, 0xFF, 0xE8, 0x02, 0xEC, 0xFF, 0xE8, 0x02, 0xEE, 0xFF, 0xE8,
-	0x02, 0xF0, 0xFF, 0xE8, 0x02, 0xF2, 0xFF, 0xE8, 0x03, 0xF6, 0x00, 0x10, 0x03, 0xF7, 0x00, 0x10,
-	0x03, 0xFA, 0x00, 0x10, 0x04, 0x52, 0xFF, 0xE8, 0x04, 0x54, 0xFF, 0xE8, 0x04, 0x56, 0xFF, 0xE8,
-	0x04, 0x58, 0xFF, 0xE8, 0x04, 0x5A, 0xFF, 0xE8, 0x04, 0x5C, 0xFF, 0xE8, 0x04, 0x5E, 0xFF, 0xE8,
-	0x04, 0x60, 0xFF, 0xE8, 0x04, 0x74, 0xFF, 0xE8, 0x04, 0x76, 0xFF, 0xE8, 0x04, 0x78, 0xFF, 0xE8,
-	0x04, 0x7C, 0xFF, 0xE8, 0x04, 0xB7, 0xFF, 0xE8, 0x04, 0xC4, 0xFF, 0xE8, 0x04, 0xC6, 0xFF, 0xE8,
-	0x00, 0x10, 0x00, 0x2E, 0xFF, 0xEE, 0x00, 0x39, 0xFF, 0xEE, 0x02, 0xB0, 0xFF, 0xEE, 0x02, 0xB1,
-	0xFF, 0xEE, 0x02, 0xB2, 0xFF, 0xEE, 0x02, 0xB3, 0xFF, 0xEE, 0x03, 0x00, 0xFF, 0xEE, 0x03, 0x2F,
-	0xFF, 0xEE, 0x03, 0x31, 0xFF, 0xEE, 0x03, 0x33, 0xFF, 0xEE, 0x03, 0x35, 0xFF, 0xEE, 0x03, 0x37,
-	0xFF, 0xEE, 0x03, 0x39, 0xFF, 0xEE, 0x04, 0x7D, 0xFF, 0xEE, 0x04, 0x7F, 0xFF, 0xEE, 0x04, 0xDC,
-	0xFF, 0xEE, 0x00, 0x03, 0x00, 0x5B, 0xFF, 0xE5, 0x01, 0xFF, 0xFF, 0xEB, 0x02, 0x4B, 0xFF, 0xED,
-	0x00, 0x0F, 0x00, 0x0A, 0xFF, 0xE2, 0x00, 0x0D, 0x00, 0x14, 0x00, 0x0E, 0xFF, 0xCF, 0x00, 0x41,
-	0x00, 0x12, 0x00, 0x4A, 0xFF, 0xEA, 0x00, 0x56, 0xFF, 0xD8, 0x00, 0x58, 0xFF, 0xEA, 0x00, 0x61,
-	0x00, 0x13, 0x00, 0x6D, 0xFF, 0xAE, 0x00, 0x7C, 0xFF, 0xCD, 0x00, 0x81, 0xFF, 0xA0, 0x00, 0x86,
-	0xFF, 0xC1, 0x00, 0x89, 0xFF, 0xC0, 0x01, 0x8D, 0xFF, 0xD3, 0x02, 0x4B, 0xFF, 0xCD, 0x00, 0x02,
-	0x01, 0xF5, 0xFF, 0xE9, 0x02, 0x4B, 0xFF, 0xE9, 0x00, 0x05, 0x00, 0x0D, 0x00, 0x0F, 0x00, 0x41,
-	0x00, 0x0C, 0x00, 0x56, 0xFF, 0xEB, 0x00, 0x61, 0x00, 0x0E, 0x02, 0x4B, 0xFF, 0xE9, 0x00, 0x04,
-	0x00, 0x0D, 0x00, 0x14, 0x00, 0x41, 0x00, 0x11, 0x00, 0x56, 0xFF, 0xE2, 0x00, 0x61, 0x00, 0x13,
-	0x00, 0x08, 0x00, 0x04, 0xFF, 0xD8, 0x00, 0x56, 0xFF, 0xB5, 0x00, 0x5B, 0xFF, 0xC7, 0x00, 0x6D,
-	0xFE, 0xB8, 0x00, 0x7C, 0xFF, 0x28, 0x00, 0x81, 0xFF, 0x4D, 0x00, 0x86, 0xFF, 0x8E, 0x00, 0x89,
-	0xFF, 0xA1, 0x00, 0x10, 0x00, 0x38, 0xFF, 0xB0, 0x00, 0x3A, 0xFF, 0xED, 0x00, 0x3D, 0xFF, 0xD0,
-	0x02, 0xB4, 0xFF, 0xD0, 0x03, 0x29, 0xFF, 0xB0, 0x03, 0x2B, 0xFF, 0xB0, 0x03, 0x2D, 0xFF, 0xB0,
-	0x03, 0x3D, 0xFF, 0xD0, 0x03, 0x3F, 0xFF, 0xD0, 0x03, 0xF4, 0xFF, 0xD0, 0x04, 0x8B, 0xFF, 0xD0,
-	0x04, 0x8D, 0xFF, 0xD0, 0x04, 0x8F, 0xFF, 0xD0, 0x04, 0xDA, 0xFF, 0xB0, 0x04, 0xDD, 0xFF, 0xED,
-	0x04, 0xDF, 0xFF, 0xED, 0x00, 0x22, 0x00, 0x38, 0xFF, 0xD5, 0x00, 0x3A, 0xFF, 0xE4, 0x00, 0x3B,
-	0xFF, 0xEC, 0x00, 0x3D, 0xFF, 0xDD, 0x02, 0x05, 0x00, 0x0E, 0x02, 0x4D, 0x00, 0x0E, 0x02, 0xB4,
-	0xFF, 0xDD, 0x03, 0x29, 0xFF, 0xD5, 0x03, 0x2B, 0xFF, 0xD5, 0x03, 0x2D, 0xFF, 0xD5, 0x03, 0x3B,
-	0xFF, 0xEC, 0x03, 0x3D, 0xFF, 0xDD, 0x03, 0x3F, 0xFF, 0xDD, 0x03, 0x4D, 0x00, 0x0E, 0x03, 0x4E,
-	0x00, 0x0E, 0x03, 0x4F, 0x00, 0x0E, 0x03, 0x50, 0x00, 0x0E, 0x03, 0x51, 0x00, 0x0E, 0x03, 0x52,
-	0x00, 0x0E, 0x03, 0x53, 0x00, 0x0E, 0x03, 0x68, 0x00, 0x0E, 0x03, 0x69, 0x00, 0x0E, 0x03, 0x6A,
-	0x00, 0x0E, 0x03, 0xEE, 0xFF, 0xEC, 0x03, 0xF0, 0xFF, 0xEC, 0x03, 0xF2, 0xFF, 0xEC, 0x03, 0xF4,
-	0xFF, 0xDD, 0x04, 0x8B, 0xFF, 0xDD, 0x04, 0x8D, 0xFF, 0xDD, 0x04, 0x8F, 0xFF, 0xDD, 0x04, 0xDA,
-	0xFF, 0xD5, 0x04, 0xDD, 0xFF, 0xE4, 0x04, 0xDF, 0xFF, 0xE4, 0x04, 0xE1, 0xFF, 0xEC, 0x00, 0x02,
-	0x00, 0x58, 0x00, 0x0E, 0x00, 0x81, 0xFF, 0x9F, 0x00, 0x05, 0x00, 0x5B, 0xFF, 0xA4, 0x01, 0xF0,
-	0xFF, 0x54, 0x01, 0xF5, 0xFF, 0xF1, 0x01, 0xFF, 0xFF, 0xF1, 0x02, 0x4B, 0xFF, 0xF3, 0x00, 0x03,
-	0x00, 0x5B, 0xFF, 0xC1, 0x01, 0xFF, 0xFF, 0xE6, 0x02, 0x4B, 0xFF, 0xE8, 0x00, 0xA7, 0x00, 0x10,
-	0xFF, 0x16, 0x00, 0x12, 0xFF, 0x16, 0x00, 0x25, 0xFF, 0x56, 0x00, 0x2E, 0xFE, 0xF8, 0x00, 0x38,
-	0x00, 0x14, 0x00, 0x45, 0xFF, 0xDE, 0x00, 0x47, 0xFF, 0xEB, 0x00, 0x48, 0xFF, 0xEB, 0x00, 0x49,
-	0xFF, 0xEB, 0x00, 0x4B, 0xFF, 0xEB, 0x00, 0x53, 0xFF, 0xEB, 0x00, 0x55, 0xFF, 0xEB, 0x00, 0x56,
-	0xFF, 0xE6, 0x00, 0x59, 0xFF, 0xEA, 0x00, 0x5A, 0xFF, 0xE8, 0x00, 0x5D, 0xFF, 0xE8, 0x00, 0x94,
-	0xFF, 0xEB, 0x00, 0x99, 0xFF, 0xEB, 0x00, 0x9B, 0xFF, 0xEA, 0x00, 0xB2, 0xFF, 0x56, 0x01, 0x86,
-	0xFF, 0x16, 0x01, 0x8A, 0xFF, 0x16, 0x01, 0x8E, 0xFF, 0x16, 0x01, 0x8F, 0xFF, 0x16, 0x02, 0x05,
-	0xFF, 0xC0, 0x02, 0x4D, 0xFF, 0xC0, 0x02, 0x9A, 0xFF, 0x56, 0x02, 0x9B, 0xFF, 0x56, 0x02, 0x9C,
-	0xFF, 0x56, 0x02, 0x9D, 0xFF, 0x56, 0x02, 0x9E, 0xFF, 0x56, 0x02, 0x9F, 0xFF, 0x56, 0x02, 0xA0,
-	0xFF, 0x56, 0x02, 0xB5, 0xFF, 0xDE, 0x02, 0xB6, 0xFF, 0xDE, 0x02, 0xB7, 0xFF, 0xDE, 0x02, 0xB8,
-	0xFF, 0xDE, 0x02, 0xB9, 0xFF, 0xDE, 0x02, 0xBA, 0xFF, 0xDE, 0x02, 0xBB, 0xFF, 0xDE, 0x02, 0xBC,
-	0xFF, 0xEB, 0x02, 0xBD, 0xFF, 0xEB, 0x02, 0xBE, 0xFF, 0xEB, 0x02, 0xBF, 0xFF, 0xEB, 0x02, 0xC0,
-	0xFF, 0xEB, 0x02, 0xC6, 0xFF, 0xEB, 0x02, 0xC7, 0xFF, 0xEB, 0x02, 0xC8, 0xFF, 0xEB, 0x02, 0xC9,
-	0xFF, 0xEB, 0x02, 0xCA, 0xFF, 0xEB, 0x02, 0xCB, 0xFF, 0xEA, 0x02, 0xCC, 0xFF, 0xEA, 0x02, 0xCD,
-	0xFF, 0xEA, 0x02, 0xCE, 0xFF, 0xEA, 0x02, 0xCF, 0xFF, 0xE8, 0x02, 0xD0, 0xFF, 0xE8, 0x02, 0xD1,
-	0xFF, 0x56, 0x02, 0xD2, 0xFF, 0xDE, 0x02, 0xD3, 0xFF, 0x56, 0x02, 0xD4, 0xFF, 0xDE, 0x02, 0xD5,
-	0xFF, 0x56, 0x02, 0xD6, 0xFF, 0xDE, 0x02, 0xD8, 0xFF, 0xEB, 0x02, 0xDA, 0xFF, 0xEB, 0x02, 0xDC,
-	0xFF, 0xEB, 0x02, 0xDE, 0xFF, 0xEB, 0x02, 0xE0, 0xFF, 0xEB, 0x02, 0xE2, 0xFF, 0xEB, 0x02, 0xE4,
-	0xFF, 0xEB, 0x02, 0xE6, 0xFF, 0xEB, 0x02, 0xE8, 0xFF, 0xEB, 0x02, 0xEA, 0xFF, 0xEB, 0x02, 0xEC,
-	0xFF, 0xEB, 0x02, 0xEE, 0xFF, 0xEB, 0x02, 0xF0, 0xFF, 0xEB, 0x02, 0xF2, 0xFF, 0xEB, 0x03, 0x00,
-	0xFE, 0xF8, 0x03, 0x14, 0xFF, 0xEB, 0x03, 0x16, 0xFF, 0xEB, 0x03, 0x18, 0xFF, 0xEB, 0x03, 0x29,
-	0x00, 0x14, 0x03, 0x2B, 0x00, 0x14, 0x03, 0x2D, 0x00, 0x14, 0x03, 0x30, 0xFF, 0xEA, 0x03, 0x32,
-	0xFF, 0xEA, 0x03, 0x34, 0xFF, 0xEA, 0x03, 0x36, 0xFF, 0xEA, 0x03, 0x38, 0xFF, 0xEA, 0x03, 0x3A,
-	0xFF, 0xEA, 0x03, 0x3E, 0xFF, 0xE8, 0x03, 0x4D, 0xFF, 0xC0, 0x03, 0x4E, 0xFF, 0xC0, 0x03, 0x4F,
-	0xFF, 0xC0, 0x03, 0x50, 0xFF, 0xC0, 0x03, 0x51, 0xFF, 0xC0, 0x03, 0x52, 0xFF, 0xC0, 0x03, 0x53,
-	0xFF, 0xC0, 0x03, 0x68, 0xFF, 0xC0, 0x03, 0x69, 0xFF, 0xC0, 0x03, 0x6A, 0xFF, 0xC0, 0x03, 0xF5,
-	0xFF, 0xE8, 0x03, 0xFD, 0xFF, 0x56, 0x03, 0xFE, 0xFF, 0xDE, 0x04, 0x39, 0xFF, 0x56, 0x04, 0x3A,
-	0xFF, 0xDE, 0x04, 0x3B, 0xFF, 0x56, 0x04, 0x3C, 0xFF, 0xDE, 0x04, 0x3D, 0xFF, 0x56, 0x04, 0x3E,
-	0xFF, 0xDE, 0x04, 0x3F, 0xFF, 0x56, 0x04, 0x40, 0xFF, 0xDE, 0x04, 0x41, 0xFF, 0x56, 0x04, 0x42,
-	0xFF, 0xDE, 0x04, 0x43, 0xFF, 0x56, 0x04, 0x44, 0xFF, 0xDE, 0x04, 0x45, 0xFF, 0x56, 0x04, 0x46,
-	0xFF, 0xDE, 0x04, 0x47, 0xFF, 0x56, 0x04, 0x48, 0xFF, 0xDE, 0x04, 0x49, 0xFF, 0x56, 0x04, 0x4A,
-	0xFF, 0xDE, 0x04, 0x4B, 0xFF, 0x56, 0x04, 0x4C, 0xFF, 0xDE, 0x04, 0x4D, 0xFF, 0x56, 0x04, 0x4E,
-	0xFF, 0xDE, 0x04, 0x4F, 0xFF, 0x56, 0x04, 0x50, 0xFF, 0xDE, 0x04, 0x52, 0xFF, 0xEB, 0x04, 0x54,
-	0xFF, 0xEB, 0x04, 0x56, 0xFF, 0xEB, 0x04, 0x58, 0xFF, 0xEB, 0x04, 0x5A, 0xFF, 0xEB, 0x04, 0x5C,
-	0xFF, 0xEB, 0x04, 0x5E, 0xFF, 0xEB, 0x04, 0x60, 0xFF, 0xEB, 0x04, 0x66, 0xFF, 0xEB, 0x04, 0x68,
-	0xFF, 0xEB, 0x04, 0x6A, 0xFF, 0xEB, 0x04, 0x6C, 0xFF, 0xEB, 0x04, 0x6E, 0xFF, 0xEB, 0x04, 0x70,
-	0xFF, 0xEB, 0x04, 0x72, 0xFF, 0xEB, 0x04, 0x74, 0xFF, 0xEB, 0x04, 0x76, 0xFF, 0xEB, 0x04, 0x78,
-	0xFF, 0xEB, 0x04, 0x7A, 0xFF, 0xEB, 0x04, 0x7C, 0xFF, 0xEB, 0x04, 0x7E, 0xFF, 0xEA, 0x04, 0x80,
-	0xFF, 0xEA, 0x04, 0x82, 0xFF, 0xEA, 0x04, 0x84, 0xFF, 0xEA, 0x04, 0x86, 0xFF, 0xEA, 0x04, 0x88,
-	0xFF, 0xEA, 0x04, 0x8A, 0xFF, 0xEA, 0x04, 0x8C, 0xFF, 0xE8, 0x04, 0x8E, 0xFF, 0xE8, 0x04, 0x90,
-	0xFF, 0xE8, 0x04, 0xB4, 0xFF, 0x56, 0x04, 0xB5, 0xFF, 0xDE, 0x04, 0xB7, 0xFF, 0xEB, 0x04, 0xBB,
-	0xFF, 0xEB, 0x04, 0xBF, 0xFF, 0xEA, 0x04, 0xC4, 0xFF, 0xEB, 0x04, 0xC6, 0xFF, 0xEB, 0x04, 0xDA,
-	0x00, 0x14, 0x04, 0xDE, 0xFF, 0xE8, 0x04, 0xE0, 0xFF, 0xE8, 0x00, 0x03, 0x00, 0x4A, 0xFF, 0xEE,
-	0x00, 0x5B, 0xFF, 0xEA, 0x01, 0xF0, 0xFF, 0xF0, 0x00, 0x01, 0x00, 0x81, 0xFF, 0xDF, 0x00, 0x03,
-	0x00, 0x0D, 0xFF, 0xE6, 0x00, 0x41, 0xFF, 0xF4, 0x00, 0x61, 0xFF, 0xEF, 0x00, 0x05, 0x00, 0x23,
-	0xFF, 0xC3, 0x00, 0x58, 0xFF, 0xEF, 0x00, 0x5B, 0xFF, 0xDF, 0x00, 0x9A, 0xFF, 0xEE, 0x01, 0xF0,
-	0xFF, 0xCD, 0x00, 0x11, 0x00, 0x3A, 0x00, 0x14, 0x00, 0x3B, 0x00, 0x12, 0x00, 0x3D, 0x00, 0x16,
-	0x02, 0xB4, 0x00, 0x16, 0x03, 0x3B, 0x00, 0x12, 0x03, 0x3D, 0x00, 0x16, 0x03, 0x3F, 0x00, 0x16,
-	0x03, 0xEE, 0x00, 0x12, 0x03, 0xF0, 0x00, 0x12, 0x03, 0xF2, 0x00, 0x12, 0x03, 0xF4, 0x00, 0x16,
-	0x04, 0x8B, 0x00, 0x16, 0x04, 0x8D, 0x00, 0x16, 0x04, 0x8F, 0x00, 0x16, 0x04, 0xDD, 0x00, 0x14,
-	0x04, 0xDF, 0x00, 0x14, 0x04, 0xE1, 0x00, 0x12, 0x00, 0x01, 0x00, 0x5B, 0x00, 0x0B, 0x00, 0x05,
-	0x00, 0x38, 0xFF, 0xD8, 0x03, 0x29, 0xFF, 0xD8, 0x03, 0x2B, 0xFF, 0xD8, 0x03, 0x2D, 0xFF, 0xD8,
-	0x04, 0xDA, 0xFF, 0xD8, 0x00, 0x02, 0x00, 0x08, 0x00, 0x02, 0x06, 0x6C, 0x00, 0x0A, 0x00, 0x02,
-	0x03, 0xD0, 0x00, 0x04, 0x00, 0x00, 0x05, 0x6E, 0x04, 0x3E, 0x00, 0x18, 0x00, 0x14, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC5, 0x00, 0x00, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEB, 0x00, 0x00, 0xFF, 0xD5,
-	0xFF, 0xED, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEA, 0xFF, 0xE9,
-	0xFF, 0xED, 0xFF, 0xF5, 0xFF, 0xEB, 0x00, 0x00, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xF5, 0x00, 0x00, 0xFF, 0xF5, 0xFF, 0xA2, 0x00, 0x00, 0xFF, 0xC4, 0x00, 0x00, 0xFF, 0xCE,
-	0xFF, 0xF5, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0x2D, 0xFF, 0xCC, 0xFF, 0xBF, 0xFF, 0xD9, 0xFF, 0xA2, 0xFF, 0xE3, 0x00, 0x12,
-	0xFF, 0xAB, 0x00, 0x00, 0xFF, 0xD8, 0xFF, 0xEC, 0xFF, 0xCB, 0xFF, 0xBF, 0x00, 0x0D, 0x00, 0x00,
-	0xFF, 0xAB, 0xFF, 0xEF, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xED, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xE6, 0x00, 0x00, 0xFF, 0xED, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x0F, 0xFF, 0x95, 0x00, 0x00, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEA, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xD2, 0xFF, 0xE6, 0xFF, 0xEB, 0x00, 0x00, 0xFF, 0xE7, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE1, 0xFF, 0xE7, 0xFF, 0xEB, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7A, 0xFE, 0x62, 0xFF, 0x44,
-	0xFF, 0x4B, 0xFF, 0x3E, 0xFF, 0xBD, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x33, 0xFF, 0x72,
-	0x00, 0x00, 0xFF, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3E, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xFF, 0xE6, 0xFF, 0xE9, 0x00, 0x00, 0xFF, 0xE1, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xE9, 0xFF, 0xD8, 0xFF, 0xE7, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xBC, 0x00, 0x00, 0xFF, 0xF3,
-	0x00, 0x00, 0xFF, 0x76, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-	0x00, 0x00, 0xFF, 0xF3, 0xFF, 0xE1, 0xFF, 0xE6, 0xFF, 0xC6, 0x00, 0x00, 0xFF, 0x76, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0x26, 0xFF, 0x18, 0xFF, 0x9D, 0xFF, 0xA1, 0xFF, 0xB1, 0xFF, 0xE4, 0x00, 0x10,
-	0xFF, 0xAF, 0x00, 0x00, 0xFF, 0x93, 0xFF, 0xB8, 0xFF, 0xB9, 0xFF, 0x9D, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xAF, 0xFF, 0xED, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEB,
-	0xFF, 0xED, 0x00, 0x0D, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE5,
-	0xFF, 0xEC, 0xFF, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF5,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xF5, 0x00, 0x00, 0xFF, 0xF5, 0xFF, 0xA2, 0x00, 0x00, 0xFF, 0xC4, 0x00, 0x00, 0xFF, 0xCE,
-	0xFF, 0xF5, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-	0x00, 0x35, 0x00, 0x06, 0x00, 0x0B, 0x00, 0x96, 0x00, 0xB1, 0x00, 0xB2, 0x00, 0xB3, 0x00, 0xB4,
-	0x00, 0xBD, 0x00, 0xC1, 0x00, 0xC7, 0x01, 0x84, 0x01, 0x85, 0x01, 0x87, 0x01, 0x88, 0x01, 0x89,
-	0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x03, 0xA1, 0x03, 0xA2, 0x03, 0xA3, 0x03, 0xA4, 0x03, 0xA5,
-	0x03, 0xA6, 0x03, 0xA9, 0x03, 0xAA, 0x03, 0xAB, 0x03, 0xAC, 0x03, 0xAD, 0x03, 0xAE, 0x03, 0xAF,
-	0x03, 0xB0, 0x03, 0xB1, 0x03, 0xB2, 0x03, 0xB3, 0x03, 0xB4, 0x03, 0xB5, 0x03, 0xB6, 0x03, 0xB7,
-	0x03, 0xB8, 0x03, 0xBB, 0x03, 0xBF, 0x03, 0xC1, 0x03, 0xC5, 0x03, 0xF6, 0x03, 0xF7, 0x03, 0xFA,
-	0x04, 0xE5, 0x04, 0xE6, 0x04, 0xEA, 0x04, 0xED, 0x04, 0xF3, 0x04, 0xF8, 0x00, 0x02, 0x00, 0x32,
-	0x00, 0x06, 0x00, 0x06, 0x00, 0x01, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x01, 0x00, 0x10, 0x00, 0x10,
-	0x00, 0x02, 0x00, 0x11, 0x00, 0x11, 0x00, 0x03, 0x00, 0x12, 0x00, 0x12, 0x00, 0x02, 0x00, 0xB2,
-	0x00, 0xB2, 0x00, 0x13, 0x00, 0xB3, 0x00, 0xB3, 0x00, 0x07, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0x06,
-	0x00, 0xBB, 0x00, 0xBB, 0x00, 0x04, 0x00, 0xBD, 0x00, 0xBD, 0x00, 0x0C, 0x00, 0xC1, 0x00, 0xC1,
-	0x00, 0x0B, 0x00, 0xC8, 0x00, 0xC9, 0x00, 0x04, 0x00, 0xCB, 0x00, 0xCB, 0x00, 0x05, 0x01, 0x81,
-	0x01, 0x82, 0x00, 0x03, 0x01, 0x84, 0x01, 0x85, 0x00, 0x01, 0x01, 0x86, 0x01, 0x86, 0x00, 0x02,
-	0x01, 0x87, 0x01, 0x89, 0x00, 0x01, 0x01, 0x8A, 0x01, 0x8A, 0x00, 0x02, 0x01, 0x8E, 0x01, 0x8F,
-	0x00, 0x02, 0x02, 0x05, 0x02, 0x05, 0x00, 0x11, 0x02, 0x06, 0x02, 0x06, 0x00, 0x0D, 0x02, 0x07,
-	0x02, 0x07, 0x00, 0x09, 0x02, 0x94, 0x02, 0x94, 0x00, 0x03, 0x03, 0xA1, 0x03, 0xA1, 0x00, 0x06,
-	0x03, 0xA5, 0x03, 0xA5, 0x00, 0x07, 0x03, 0xA6, 0x03, 0xA6, 0x00, 0x08, 0x03, 0xA9, 0x03, 0xA9,
-	0x00, 0x06, 0x03, 0xAC, 0x03, 0xAC, 0x00, 0x10, 0x03, 0xB2, 0x03, 0xB2, 0x00, 0x07, 0x03, 0xB5,
-	0x03, 0xB5, 0x00, 0x08, 0x03, 0xB6, 0x03, 0xB6, 0x00, 0x0F, 0x03, 0xB8, 0x03, 0xB8, 0x00, 0x08,
-	0x03, 0xB9, 0x03, 0xB9, 0x00, 0x04, 0x03, 0xBB, 0x03, 0xBB, 0x00, 0x0B, 0x03, 0xBD, 0x03, 0xBD,
-	0x00, 0x05, 0x03, 0xBF, 0x03, 0xBF, 0x00, 0x0E, 0x03, 0xC1, 0x03, 0xC1, 0x00, 0x0C, 0x03, 0xC4,
-	0x03, 0xC4, 0x00, 0x05, 0x03, 0xC5, 0x03, 0xC5, 0x00, 0x0E, 0x03, 0xC6, 0x03, 0xC6, 0x00, 0x05,
-	0x03, 0xF6, 0x03, 0xF7, 0x00, 0x01, 0x03, 0xFA, 0x03, 0xFA, 0x00, 0x01, 0x04, 0xA7, 0x04, 0xA7,
-	0x00, 0x03, 0x04, 0xE6, 0x04, 0xE6, 0x00, 0x09, 0x04, 0xEA, 0x04, 0xEA, 0x00, 0x0D, 0x04, 0xEB,
-	0x04, 0xEB, 0x00, 0x0A, 0x04, 0xED, 0x04, 0xED, 0x00, 0x09, 0x04, 0xF9, 0x04, 0xF9, 0x00, 0x0A,
-	0x04, 0xFA, 0x04, 0xFA, 0x00, 0x12, 0x04, 0xFC, 0x04, 0xFC, 0x00, 0x0A, 0x00, 0x02, 0x00, 0x28,
-	0x00, 0x96, 0x00, 0x96, 0x00, 0x16, 0x00, 0xB1, 0x00, 0xB1, 0x00, 0x0D, 0x00, 0xB2, 0x00, 0xB2,
-	0x00, 0x17, 0x00, 0xB3, 0x00, 0xB3, 0x00, 0x02, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0x03, 0x00, 0xBD,
-	0x00, 0xBD, 0x00, 0x08, 0x00, 0xC1, 0x00, 0xC1, 0x00, 0x07, 0x00, 0xC7, 0x00, 0xC7, 0x00, 0x15,
-	0x02, 0x05, 0x02, 0x05, 0x00, 0x12, 0x02, 0x06, 0x02, 0x06, 0x00, 0x09, 0x02, 0x07, 0x02, 0x07,
-	0x00, 0x05, 0x03, 0xA1, 0x03, 0xA1, 0x00, 0x03, 0x03, 0xA2, 0x03, 0xA2, 0x00, 0x06, 0x03, 0xA3,
-	0x03, 0xA4, 0x00, 0x01, 0x03, 0xA5, 0x03, 0xA5, 0x00, 0x02, 0x03, 0xA6, 0x03, 0xA6, 0x00, 0x04,
-	0x03, 0xA9, 0x03, 0xA9, 0x00, 0x03, 0x03, 0xAA, 0x03, 0xAA, 0x00, 0x0B, 0x03, 0xAB, 0x03, 0xAB,
-	0x00, 0x06, 0x03, 0xAC, 0x03, 0xAC, 0x00, 0x11, 0x03, 0xAD, 0x03, 0xAE, 0x00, 0x01, 0x03, 0xAF,
-	0x03, 0xAF, 0x00, 0x0E, 0x03, 0xB0, 0x03, 0xB1, 0x00, 0x01, 0x03, 0xB2, 0x03, 0xB2, 0x00, 0x02,
-	0x03, 0xB3, 0x03, 0xB3, 0x00, 0x0F, 0x03, 0xB4, 0x03, 0xB4, 0x00, 0x10, 0x03, 0xB5, 0x03, 0xB5,
-	0x00, 0x04, 0x03, 0xB6, 0x03, 0xB6, 0x00, 0x0C, 0x03, 0xB7, 0x03, 0xB7, 0x00, 0x01, 0x03, 0xB8,
-	0x03, 0xB8, 0x00, 0x04, 0x03, 0xBB, 0x03, 0xBB, 0x00, 0x07, 0x03, 0xBF, 0x03, 0xBF, 0x00, 0x0A,
-	0x03, 0xC1, 0x03, 0xC1, 0x00, 0x08, 0x03, 0xC5, 0x03, 0xC5, 0x00, 0x0A, 0x04, 0xE5, 0x04, 0xE5,
-	0x00, 0x02, 0x04, 0xE6, 0x04, 0xE6, 0x00, 0x05, 0x04, 0xEA, 0x04, 0xEA, 0x00, 0x09, 0x04, 0xED,
-	0x04, 0xED, 0x00, 0x05, 0x04, 0xF3, 0x04, 0xF3, 0x00, 0x13, 0x04, 0xF8, 0x04, 0xF8, 0x00, 0x14,
-	0x00, 0x01, 0x00, 0x5C, 0x00, 0x04, 0x00, 0x00, 0x00, 0x29, 0x04, 0xA6, 0x04, 0x98, 0x04, 0x8E,
-	0x04, 0x5C, 0x04, 0x46, 0x04, 0x38, 0x04, 0x22, 0x04, 0x10, 0x03, 0xFA, 0x03, 0xD4, 0x03, 0xA6,
-	0x03, 0xA0, 0x03, 0x8E, 0x03, 0x88, 0x03, 0x26, 0x03, 0x20, 0x02, 0xBA, 0x02, 0x68, 0x02, 0x3A,
-	0x02, 0x34, 0x02, 0x2E, 0x01, 0xB0, 0x01, 0xA6, 0x01, 0x8C, 0x04, 0x22, 0x04, 0x38, 0x01, 0x36,
-	0x04, 0x22, 0x01, 0x2C, 0x01, 0x22, 0x04, 0x38, 0x01, 0x14, 0x00, 0xDE, 0x01, 0x36, 0x00, 0xBC,
-	0x01, 0x36, 0x03, 0x20, 0x00, 0xB2, 0x03, 0x8E, 0x00, 0xB2, 0x04, 0x38, 0x00, 0x01, 0x00, 0x29,
-	0x00, 0x0C, 0x00, 0x96, 0x00, 0x9D, 0x00, 0xB1, 0x00, 0xB2, 0x00, 0xB3, 0x00, 0xB4, 0x00, 0xB5,
-	0x00, 0xB7, 0x00, 0xB8, 0x00, 0xB9, 0x00, 0xBB, 0x00, 0xBD, 0x00, 0xBE, 0x00, 0xC0, 0x00, 0xC1,
-	0x00, 0xC3, 0x00, 0xC4, 0x00, 0xC5, 0x00, 0xC7, 0x00, 0xC9, 0x00, 0xCA, 0x00, 0xCE, 0x01, 0x85,
-	0x03, 0xA1, 0x03, 0xA5, 0x03, 0xA6, 0x03, 0xA9, 0x03, 0xAC, 0x03, 0xAF, 0x03, 0xB2, 0x03, 0xB3,
-	0x03, 0xB4, 0x03, 0xB5, 0x03, 0xB6, 0x03, 0xB8, 0x03, 0xBB, 0x03, 0xBF, 0x03, 0xC1, 0x03, 0xC5,
-	0x04, 0xE5, 0x00, 0x02, 0x00, 0xCA, 0xFF, 0xEA, 0x01, 0x85, 0xFF, 0xB0, 0x00, 0x08, 0x00, 0xB8,
-	0xFF, 0xD4, 0x00, 0xBE, 0xFF, 0xF0, 0x00, 0xC2, 0xFF, 0xED, 0x00, 0xC4, 0x00, 0x11, 0x00, 0xCA,
-	0xFF, 0xE0, 0x00, 0xCC, 0xFF, 0xE7, 0x00, 0xCD, 0xFF, 0xE5, 0x00, 0xCE, 0xFF, 0xEE, 0x00, 0x0D,
-	0x00, 0x04, 0xFF, 0xD8, 0x00, 0x6D, 0xFE, 0xB8, 0x00, 0x7C, 0xFF, 0x28, 0x00, 0xB8, 0xFF, 0xAE,
-	0x00, 0xBE, 0xFF, 0xC9, 0x00, 0xBF, 0xFF, 0x7E, 0x00, 0xC3, 0xFF, 0x67, 0x00, 0xC6, 0xFF, 0x87,
-	0x00, 0xC7, 0xFF, 0x65, 0x00, 0xCA, 0xFF, 0x9E, 0x00, 0xCC, 0xFF, 0x6A, 0x00, 0xCD, 0xFF, 0x73,
-	0x00, 0xCE, 0xFF, 0x5E, 0x00, 0x03, 0x00, 0xBE, 0xFF, 0xF5, 0x00, 0xC4, 0xFF, 0xDE, 0x00, 0xC7,
-	0xFF, 0xE5, 0x00, 0x02, 0x00, 0xB8, 0xFF, 0xC5, 0x00, 0xCA, 0xFF, 0xB4, 0x00, 0x02, 0x00, 0xB8,
-	0xFF, 0xCB, 0x00, 0xCD, 0xFF, 0xE4, 0x00, 0x15, 0x00, 0x0A, 0xFF, 0xE2, 0x00, 0x0D, 0x00, 0x14,
-	0x00, 0x0E, 0xFF, 0xCF, 0x00, 0x41, 0x00, 0x12, 0x00, 0x61, 0x00, 0x13, 0x00, 0x6D, 0xFF, 0xAE,
-	0x00, 0x7C, 0xFF, 0xCD, 0x00, 0xB8, 0xFF, 0xD0, 0x00, 0xBC, 0xFF, 0xEA, 0x00, 0xBE, 0xFF, 0xEE,
-	0x00, 0xBF, 0xFF, 0xC6, 0x00, 0xC0, 0x00, 0x0D, 0x00, 0xC2, 0xFF, 0xE9, 0x00, 0xC3, 0xFF, 0xD6,
-	0x00, 0xC6, 0xFF, 0xE8, 0x00, 0xC7, 0xFF, 0xBA, 0x00, 0xCA, 0xFF, 0xE9, 0x00, 0xCC, 0xFF, 0xCB,
-	0x00, 0xCD, 0xFF, 0xDA, 0x00, 0xCE, 0xFF, 0xC7, 0x01, 0x8D, 0xFF, 0xD3, 0x00, 0x06, 0x00, 0xBB,
-	0xFF, 0xC5, 0x00, 0xC8, 0xFF, 0xC5, 0x00, 0xC9, 0xFF, 0xC5, 0x03, 0xB9, 0xFF, 0xC5, 0x03, 0xBF,
-	0xFF, 0x80, 0x03, 0xC5, 0xFF, 0x80, 0x00, 0x02, 0x00, 0xBD, 0xFF, 0xF4, 0x03, 0xC1, 0xFF, 0xF4,
-	0x00, 0x1F, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x0B, 0x00, 0x0C, 0x00, 0xBB, 0xFF, 0xE8, 0x00, 0xBD,
-	0x00, 0x0B, 0x00, 0xBE, 0xFF, 0xED, 0x00, 0xC4, 0x00, 0x00, 0x00, 0xC6, 0x00, 0x0B, 0x00, 0xC8,
-	0xFF, 0xE8, 0x00, 0xC9, 0xFF, 0xE8, 0x00, 0xCA, 0x00, 0x0C, 0x01, 0x84, 0x00, 0x0C, 0x01, 0x85,
-	0x00, 0x0C, 0x01, 0x87, 0x00, 0x0C, 0x01, 0x88, 0x00, 0x0C, 0x01, 0x89, 0x00, 0x0C, 0x02, 0x05,
-	0xFF, 0xBF, 0x02, 0x06, 0xFF, 0xED, 0x02, 0x07, 0xFF, 0xBF, 0x03, 0xB9, 0xFF, 0xE8, 0x03, 0xBF,
-	0xFF, 0xEA, 0x03, 0xC1, 0x00, 0x0B, 0x03, 0xC5, 0xFF, 0xEA, 0x03, 0xF6, 0x00, 0x0C, 0x03, 0xF7,
-	0x00, 0x0C, 0x03, 0xFA, 0x00, 0x0C, 0x04, 0xE6, 0xFF, 0xBF, 0x04, 0xEA, 0xFF, 0xED, 0x04, 0xEB,
-	0x00, 0x0D, 0x04, 0xED, 0xFF, 0xBF, 0x04, 0xF9, 0x00, 0x0D, 0x04, 0xFC, 0x00, 0x0D, 0x00, 0x01,
-	0x00, 0xCA, 0x00, 0x0B, 0x00, 0x01, 0x00, 0xCA, 0xFF, 0xEA, 0x00, 0x0B, 0x00, 0x10, 0x00, 0x00,
-	0x00, 0x12, 0x00, 0x00, 0x00, 0xBB, 0xFF, 0xE7, 0x00, 0xC4, 0x00, 0x0F, 0x00, 0xC8, 0xFF, 0xE7,
-	0x00, 0xC9, 0xFF, 0xE7, 0x01, 0x86, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x00,
-	0x01, 0x8F, 0x00, 0x00, 0x03, 0xB9, 0xFF, 0xE7, 0x00, 0x14, 0x00, 0x06, 0xFF, 0xA0, 0x00, 0x0B,
-	0xFF, 0xA0, 0x00, 0xBD, 0xFF, 0xC5, 0x00, 0xC2, 0xFF, 0xEE, 0x00, 0xC4, 0x00, 0x10, 0x00, 0xC6,
-	0xFF, 0xEC, 0x00, 0xCA, 0xFF, 0x20, 0x00, 0xCB, 0xFF, 0xF1, 0x01, 0x84, 0xFF, 0xA0, 0x01, 0x85,
-	0xFF, 0xA0, 0x01, 0x87, 0xFF, 0xA0, 0x01, 0x88, 0xFF, 0xA0, 0x01, 0x89, 0xFF, 0xA0, 0x03, 0xBD,
-	0xFF, 0xF1, 0x03, 0xC1, 0xFF, 0xC5, 0x03, 0xC4, 0xFF, 0xF1, 0x03, 0xC6, 0xFF, 0xF1, 0x03, 0xF6,
-	0xFF, 0xA0, 0x03, 0xF7, 0xFF, 0xA0, 0x03, 0xFA, 0xFF, 0xA0, 0x00, 0x19, 0x00, 0x06, 0xFF, 0xDA,
-	0x00, 0x0B, 0xFF, 0xDA, 0x00, 0xBB, 0xFF, 0xF0, 0x00, 0xBD, 0xFF, 0xDC, 0x00, 0xC2, 0xFF, 0xEC,
-	0x00, 0xC4, 0x00, 0x0F, 0x00, 0xC6, 0xFF, 0xEA, 0x00, 0xC8, 0xFF, 0xF0, 0x00, 0xC9, 0xFF, 0xF0,
-	0x00, 0xCA, 0xFF, 0xC4, 0x00, 0xCB, 0xFF, 0xEF, 0x00, 0xCC, 0xFF, 0xE7, 0x01, 0x84, 0xFF, 0xDA,
-	0x01, 0x85, 0xFF, 0xDA, 0x01, 0x87, 0xFF, 0xDA, 0x01, 0x88, 0xFF, 0xDA, 0x01, 0x89, 0xFF, 0xDA,
-	0x03, 0xB9, 0xFF, 0xF0, 0x03, 0xBD, 0xFF, 0xEF, 0x03, 0xC1, 0xFF, 0xDC, 0x03, 0xC4, 0xFF, 0xEF,
-	0x03, 0xC6, 0xFF, 0xEF, 0x03, 0xF6, 0xFF, 0xDA, 0x03, 0xF7, 0xFF, 0xDA, 0x03, 0xFA, 0xFF, 0xDA,
-	0x00, 0x01, 0x01, 0x85, 0xFF, 0xB0, 0x00, 0x18, 0x00, 0xBB, 0xFF, 0xDC, 0x00, 0xBD, 0xFF, 0xE1,
-	0x00, 0xBE, 0xFF, 0xEE, 0x00, 0xBF, 0xFF, 0xE6, 0x00, 0xC1, 0xFF, 0xF3, 0x00, 0xC2, 0xFF, 0xEB,
-	0x00, 0xC3, 0xFF, 0xE9, 0x00, 0xC5, 0xFF, 0xF0, 0x00, 0xC6, 0xFF, 0xE7, 0x00, 0xC8, 0xFF, 0xDC,
-	0x00, 0xC9, 0xFF, 0xDC, 0x00, 0xCA, 0xFF, 0xE3, 0x00, 0xCB, 0xFF, 0xDD, 0x00, 0xCC, 0xFF, 0xCE,
-	0x00, 0xCD, 0xFF, 0xD4, 0x00, 0xCE, 0xFF, 0xDB, 0x03, 0xB9, 0xFF, 0xDC, 0x03, 0xBB, 0xFF, 0xF3,
-	0x03, 0xBD, 0xFF, 0xDD, 0x03, 0xBF, 0xFF, 0xD6, 0x03, 0xC1, 0xFF, 0xE1, 0x03, 0xC4, 0xFF, 0xDD,
-	0x03, 0xC5, 0xFF, 0xD6, 0x03, 0xC6, 0xFF, 0xDD, 0x00, 0x01, 0x00, 0xCA, 0xFF, 0xED, 0x00, 0x04,
-	0x00, 0xBE, 0xFF, 0xF5, 0x00, 0xC6, 0x00, 0x0B, 0x00, 0xC7, 0xFF, 0xEA, 0x00, 0xCA, 0x00, 0x0C,
-	0x00, 0x01, 0x00, 0xC4, 0x00, 0x0E, 0x00, 0x0B, 0x00, 0x10, 0xFF, 0x1E, 0x00, 0x12, 0xFF, 0x1E,
-	0x00, 0xB2, 0xFF, 0xCD, 0x00, 0xB4, 0xFF, 0xCD, 0x00, 0xC7, 0xFF, 0xF2, 0x01, 0x86, 0xFF, 0x1E,
-	0x01, 0x8A, 0xFF, 0x1E, 0x01, 0x8E, 0xFF, 0x1E, 0x01, 0x8F, 0xFF, 0x1E, 0x03, 0xA1, 0xFF, 0xCD,
-	0x03, 0xA9, 0xFF, 0xCD, 0x00, 0x09, 0x00, 0xB2, 0xFF, 0xE4, 0x00, 0xB4, 0xFF, 0xE4, 0x00, 0xC4,
-	0xFF, 0xE2, 0x03, 0xA1, 0xFF, 0xE4, 0x03, 0xA6, 0xFF, 0xD3, 0x03, 0xA9, 0xFF, 0xE4, 0x03, 0xB5,
-	0xFF, 0xD3, 0x03, 0xB6, 0xFF, 0xD2, 0x03, 0xB8, 0xFF, 0xD3, 0x00, 0x05, 0x00, 0xB3, 0xFF, 0xE6,
-	0x00, 0xB8, 0xFF, 0xC2, 0x00, 0xC4, 0x00, 0x10, 0x03, 0xA5, 0xFF, 0xE6, 0x03, 0xB2, 0xFF, 0xE6,
-	0x00, 0x04, 0x00, 0xB3, 0xFF, 0xF3, 0x00, 0xC4, 0x00, 0x0D, 0x03, 0xA5, 0xFF, 0xF3, 0x03, 0xB2,
-	0xFF, 0xF3, 0x00, 0x05, 0x00, 0x23, 0xFF, 0xC3, 0x00, 0xB8, 0xFF, 0xE5, 0x00, 0xB9, 0xFF, 0xD1,
-	0x00, 0xC4, 0x00, 0x11, 0x00, 0xCA, 0xFF, 0xC8, 0x00, 0x03, 0x00, 0xB5, 0xFF, 0xF3, 0x00, 0xB7,
-	0xFF, 0xF0, 0x00, 0xC4, 0xFF, 0xEA, 0x00, 0x05, 0x00, 0x23, 0x00, 0x00, 0x00, 0xB8, 0xFF, 0xE5,
-	0x00, 0xB9, 0xFF, 0xD1, 0x00, 0xC4, 0x00, 0x11, 0x00, 0xCA, 0xFF, 0xC8, 0x00, 0x0C, 0x00, 0x6D,
-	0xFD, 0xBF, 0x00, 0x7C, 0xFE, 0x7D, 0x00, 0xB8, 0xFF, 0x61, 0x00, 0xBE, 0xFF, 0x8F, 0x00, 0xBF,
-	0xFF, 0x0F, 0x00, 0xC3, 0xFE, 0xE8, 0x00, 0xC6, 0xFF, 0x1F, 0x00, 0xC7, 0xFE, 0xE5, 0x00, 0xCA,
-	0xFF, 0x46, 0x00, 0xCC, 0xFE, 0xED, 0x00, 0xCD, 0xFE, 0xFD, 0x00, 0xCE, 0xFE, 0xD9, 0x00, 0x02,
-	0x00, 0xBD, 0x00, 0x00, 0x03, 0xC1, 0x00, 0x00, 0x00, 0x03, 0x00, 0xB5, 0x00, 0x00, 0x00, 0xB7,
-	0x00, 0x00, 0x00, 0xC4, 0x00, 0x00, 0x00, 0x03, 0x03, 0xA6, 0x00, 0x16, 0x03, 0xB5, 0x00, 0x16,
-	0x03, 0xB8, 0x00, 0x16, 0x00, 0x02, 0x00, 0x08, 0x00, 0x02, 0x0F, 0x6C, 0x00, 0x0A, 0x00, 0x02,
-	0x08, 0x08, 0x00, 0x04, 0x00, 0x00, 0x0C, 0xDC, 0x09, 0x18, 0x00, 0x22, 0x00, 0x1E, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
-	0xFF, 0xE4, 0x00, 0x11, 0x00, 0x00, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE4,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0xFF, 0xC5,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xC3, 0x00, 0x00, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x0F,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD7, 0xFF, 0xF1, 0x00, 0x00,
-	0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE6, 0xFF, 0xE7, 0x00, 0x00, 0xFF, 0xE1, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0x00, 0x00, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xFF, 0xEB, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE9, 0xFF, 0xE6,
-	0xFF, 0xE1, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0x00, 0x00,
-	0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xE5, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF2,
-	0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0x33, 0xFF, 0x44, 0xFF, 0xBD, 0x00, 0x00, 0xFF, 0x72, 0x00, 0x00, 0xFF, 0x6A, 0xFE, 0x7A,
-	0x00, 0x00, 0x00, 0x07, 0xFE, 0x62, 0x00, 0x00, 0xFF, 0x92, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3E,
-	0x00, 0x00, 0xFF, 0x0F, 0xFF, 0x44, 0xFF, 0x0C, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0x3E, 0x00, 0x00, 0xFF, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xC9, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xF5,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0xFF, 0xEB, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC8, 0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x9A, 0xFF, 0xBD, 0xFF, 0xE9, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x6D, 0x00, 0x00, 0x00, 0x12, 0xFF, 0x89, 0x00, 0x00,
-	0xFF, 0xCA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xA5, 0x00, 0x00, 0xFF, 0xBB, 0xFF, 0xBD, 0xFF, 0xE9,
-	0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xA5, 0x00, 0x00,
-	0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0xFF, 0xF5, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0x79, 0xFF, 0xDD, 0x00, 0x00, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xED, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xED, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0xFF, 0x88, 0xFF, 0xCE, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0xFF, 0x7F, 0x00, 0x00, 0xFF, 0xC7, 0x00, 0x11, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC9, 0x00, 0x12, 0xFF, 0xF4, 0xFF, 0x8F, 0x00, 0x00, 0xFF, 0xC4,
-	0xFF, 0xA9, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x78, 0xFF, 0xF1, 0x00, 0x00, 0xFF, 0xEB, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEA, 0x00, 0x00, 0xFF, 0x9A, 0x00, 0x00, 0xFF, 0xE5,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xE1, 0x00, 0x00, 0xFF, 0xF5, 0xFF, 0xEB, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEA, 0xFF, 0xD5, 0xFF, 0xED, 0xFF, 0xED,
-	0xFF, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBD,
-	0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0x93, 0xFF, 0x9D, 0xFF, 0xE4, 0x00, 0x00, 0xFF, 0xB8, 0x00, 0x00, 0xFF, 0xB3, 0xFF, 0x26,
-	0xFF, 0xB9, 0x00, 0x10, 0xFF, 0x18, 0xFF, 0xF1, 0xFF, 0xCB, 0x00, 0x00, 0xFF, 0xED, 0xFF, 0xB1,
-	0x00, 0x00, 0xFF, 0x7E, 0xFF, 0x9D, 0xFF, 0x7C, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10,
-	0xFF, 0xAF, 0xFF, 0xAF, 0xFF, 0xB1, 0xFF, 0x10, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD4, 0xFF, 0xF3, 0x00, 0x00,
-	0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0xFF, 0xD9, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD2, 0x00, 0x00,
-	0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB4, 0xFF, 0xB4, 0xFF, 0xB5, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0xFF, 0xBF, 0xFF, 0xE3, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x0D,
-	0xFF, 0xE9, 0xFF, 0x2D, 0xFF, 0xCB, 0x00, 0x11, 0xFF, 0xCC, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xEF, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0xFF, 0xB7, 0x00, 0x00,
-	0x00, 0x12, 0x00, 0x12, 0xFF, 0xAB, 0xFF, 0xAB, 0xFF, 0xA2, 0xFF, 0xA0, 0xFF, 0xC6, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF2, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEE,
-	0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xF5, 0x00, 0x00, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF5, 0xFF, 0x7F,
-	0x00, 0x00, 0xFF, 0xC7, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC9, 0x00, 0x12,
-	0xFF, 0xF4, 0xFF, 0x8F, 0x00, 0x00, 0xFF, 0xC4, 0xFF, 0xA9, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEB, 0xFF, 0xEB, 0xFF, 0xEA, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF3,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xE8, 0xFF, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE1, 0x00, 0x00, 0xFE, 0xBC,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC9, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x76,
-	0x00, 0x00, 0xFF, 0xD9, 0xFF, 0xF3, 0x00, 0x00, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xFF, 0xC6, 0xFF, 0xC6, 0xFF, 0x76, 0xFF, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0xFF, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x86, 0x00, 0x06, 0x00, 0x0B, 0x00, 0x96,
-	0x00, 0xB2, 0x00, 0xD4, 0x00, 0xD5, 0x00, 0xD7, 0x00, 0xDA, 0x00, 0xDC, 0x00, 0xDD, 0x00, 0xDE,
-	0x00, 0xE0, 0x00, 0xE1, 0x00, 0xE2, 0x00, 0xE3, 0x00, 0xE4, 0x00, 0xE5, 0x00, 0xE6, 0x00, 0xEC,
-	0x00, 0xEE, 0x00, 0xF7, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFF, 0x01, 0x04, 0x01, 0x05, 0x01, 0x0A,
-	0x01, 0x0D, 0x01, 0x18, 0x01, 0x19, 0x01, 0x1A, 0x01, 0x2E, 0x01, 0x2F, 0x01, 0x30, 0x01, 0x33,
-	0x01, 0x34, 0x01, 0x35, 0x01, 0x37, 0x01, 0x39, 0x01, 0x3B, 0x01, 0x43, 0x01, 0x44, 0x01, 0x54,
-	0x01, 0x56, 0x01, 0x58, 0x01, 0x5C, 0x01, 0x5D, 0x01, 0x5E, 0x01, 0x84, 0x01, 0x85, 0x01, 0x87,
-	0x01, 0x88, 0x01, 0x89, 0x02, 0x05, 0x02, 0x19, 0x02, 0x28, 0x02, 0x29, 0x02, 0x2A, 0x03, 0xC8,
-	0x03, 0xC9, 0x03, 0xCB, 0x03, 0xCC, 0x03, 0xCD, 0x03, 0xCE, 0x03, 0xCF, 0x03, 0xD0, 0x03, 0xD1,
-	0x03, 0xD2, 0x03, 0xD3, 0x03, 0xD4, 0x03, 0xD6, 0x03, 0xD7, 0x03, 0xD8, 0x03, 0xDA, 0x03, 0xDB,
-	0x03, 0xDC, 0x03, 0xDD, 0x03, 0xDE, 0x03, 0xDF, 0x03, 0xE1, 0x03, 0xE2, 0x03, 0xE3, 0x03, 0xE4,
-	0x03, 0xE5, 0x03, 0xE6, 0x03, 0xE7, 0x03, 0xED, 0x03, 0xF6, 0x03, 0xF7, 0x03, 0xFA, 0x03, 0xFF,
-	0x04, 0x01, 0x04, 0x05, 0x04, 0x06, 0x04, 0x0B, 0x04, 0x0C, 0x04, 0x0D, 0x04, 0x0E, 0x04, 0x0F,
-	0x04, 0x10, 0x04, 0x11, 0x04, 0x12, 0x04, 0x13, 0x04, 0x14, 0x04, 0x15, 0x04, 0x16, 0x04, 0x19,
-	0x04, 0x1A, 0x04, 0x1C, 0x04, 0x1D, 0x04, 0x1E, 0x04, 0x1F, 0x04, 0x26, 0x04, 0x27, 0x04, 0x2B,
-	0x04, 0x2D, 0x04, 0x2E, 0x04, 0x2F, 0x04, 0x30, 0x04, 0x31, 0x04, 0x32, 0x04, 0x33, 0x04, 0x92,
-	0x04, 0x96, 0x04, 0x97, 0x04, 0x9A, 0x04, 0x9C, 0x04, 0x9D, 0x04, 0x9F, 0x04, 0xA1, 0x05, 0x03,
-	0x05, 0x05, 0x05, 0x0C, 0x05, 0x10, 0x00, 0x02, 0x00, 0xA0, 0x00, 0x06, 0x00, 0x06, 0x00, 0x04,
-	0x00, 0x0B, 0x00, 0x0B, 0x00, 0x04, 0x00, 0x10, 0x00, 0x10, 0x00, 0x08, 0x00, 0x11, 0x00, 0x11,
-	0x00, 0x0B, 0x00, 0x12, 0x00, 0x12, 0x00, 0x08, 0x00, 0xB2, 0x00, 0xB2, 0x00, 0x1B, 0x00, 0xD2,
-	0x00, 0xD2, 0x00, 0x0A, 0x00, 0xD3, 0x00, 0xD3, 0x00, 0x03, 0x00, 0xD4, 0x00, 0xD4, 0x00, 0x0D,
-	0x00, 0xD6, 0x00, 0xD6, 0x00, 0x0A, 0x00, 0xDA, 0x00, 0xDA, 0x00, 0x06, 0x00, 0xDD, 0x00, 0xDD,
-	0x00, 0x0D, 0x00, 0xDE, 0x00, 0xDE, 0x00, 0x0E, 0x00, 0xE1, 0x00, 0xE1, 0x00, 0x11, 0x00, 0xEC,
-	0x00, 0xEC, 0x00, 0x01, 0x00, 0xEE, 0x00, 0xEE, 0x00, 0x07, 0x00, 0xF0, 0x00, 0xF1, 0x00, 0x01,
-	0x00, 0xF2, 0x00, 0xF2, 0x00, 0x12, 0x00, 0xF3, 0x00, 0xF5, 0x00, 0x01, 0x00, 0xF7, 0x00, 0xF7,
-	0x00, 0x02, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x01, 0x00, 0xF9, 0x00, 0xF9, 0x00, 0x14, 0x00, 0xFA,
-	0x00, 0xFB, 0x00, 0x01, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01,
-	0x01, 0x03, 0x01, 0x03, 0x00, 0x02, 0x01, 0x04, 0x01, 0x04, 0x00, 0x12, 0x01, 0x05, 0x01, 0x05,
-	0x00, 0x01, 0x01, 0x08, 0x01, 0x08, 0x00, 0x03, 0x01, 0x0D, 0x01, 0x0D, 0x00, 0x10, 0x01, 0x17,
-	0x01, 0x17, 0x00, 0x03, 0x01, 0x18, 0x01, 0x18, 0x00, 0x13, 0x01, 0x19, 0x01, 0x19, 0x00, 0x17,
-	0x01, 0x1A, 0x01, 0x1A, 0x00, 0x05, 0x01, 0x1B, 0x01, 0x1B, 0x00, 0x03, 0x01, 0x1D, 0x01, 0x1D,
-	0x00, 0x03, 0x01, 0x1E, 0x01, 0x1E, 0x00, 0x02, 0x01, 0x1F, 0x01, 0x1F, 0x00, 0x03, 0x01, 0x21,
-	0x01, 0x21, 0x00, 0x03, 0x01, 0x22, 0x01, 0x22, 0x00, 0x02, 0x01, 0x2B, 0x01, 0x2B, 0x00, 0x01,
-	0x01, 0x33, 0x01, 0x33, 0x00, 0x06, 0x01, 0x34, 0x01, 0x34, 0x00, 0x07, 0x01, 0x36, 0x01, 0x36,
-	0x00, 0x01, 0x01, 0x39, 0x01, 0x39, 0x00, 0x0A, 0x01, 0x3C, 0x01, 0x3C, 0x00, 0x01, 0x01, 0x3E,
-	0x01, 0x3E, 0x00, 0x01, 0x01, 0x41, 0x01, 0x41, 0x00, 0x03, 0x01, 0x42, 0x01, 0x42, 0x00, 0x02,
-	0x01, 0x43, 0x01, 0x43, 0x00, 0x06, 0x01, 0x44, 0x01, 0x44, 0x00, 0x07, 0x01, 0x45, 0x01, 0x45,
-	0x00, 0x0A, 0x01, 0x47, 0x01, 0x47, 0x00, 0x11, 0x01, 0x48, 0x01, 0x48, 0x00, 0x14, 0x01, 0x50,
-	0x01, 0x50, 0x00, 0x0D, 0x01, 0x51, 0x01, 0x51, 0x00, 0x12, 0x01, 0x53, 0x01, 0x53, 0x00, 0x01,
-	0x01, 0x55, 0x01, 0x55, 0x00, 0x01, 0x01, 0x57, 0x01, 0x57, 0x00, 0x01, 0x01, 0x5C, 0x01, 0x5C,
-	0x00, 0x01, 0x01, 0x5D, 0x01, 0x5D, 0x00, 0x06, 0x01, 0x5E, 0x01, 0x5E, 0x00, 0x07, 0x01, 0x60,
-	0x01, 0x61, 0x00, 0x02, 0x01, 0x66, 0x01, 0x66, 0x00, 0x0D, 0x01, 0x6A, 0x01, 0x6A, 0x00, 0x03,
-	0x01, 0x6B, 0x01, 0x6B, 0x00, 0x02, 0x01, 0x6F, 0x01, 0x6F, 0x00, 0x0D, 0x01, 0x70, 0x01, 0x70,
-	0x00, 0x12, 0x01, 0x81, 0x01, 0x82, 0x00, 0x0B, 0x01, 0x84, 0x01, 0x85, 0x00, 0x04, 0x01, 0x86,
-	0x01, 0x86, 0x00, 0x08, 0x01, 0x87, 0x01, 0x89, 0x00, 0x04, 0x01, 0x8A, 0x01, 0x8A, 0x00, 0x08,
-	0x01, 0x8E, 0x01, 0x8F, 0x00, 0x08, 0x02, 0x05, 0x02, 0x05, 0x00, 0x19, 0x02, 0x0E, 0x02, 0x0E,
-	0x00, 0x0C, 0x02, 0x0F, 0x02, 0x0F, 0x00, 0x09, 0x02, 0x12, 0x02, 0x12, 0x00, 0x0C, 0x02, 0x16,
-	0x02, 0x16, 0x00, 0x0F, 0x02, 0x27, 0x02, 0x27, 0x00, 0x0F, 0x02, 0x2A, 0x02, 0x2A, 0x00, 0x0C,
-	0x02, 0x2B, 0x02, 0x2B, 0x00, 0x09, 0x02, 0x2C, 0x02, 0x2C, 0x00, 0x16, 0x02, 0x2D, 0x02, 0x2D,
-	0x00, 0x0F, 0x02, 0x2E, 0x02, 0x2E, 0x00, 0x0C, 0x02, 0x34, 0x02, 0x34, 0x00, 0x09, 0x02, 0x94,
-	0x02, 0x94, 0x00, 0x0B, 0x03, 0xCD, 0x03, 0xCD, 0x00, 0x1C, 0x03, 0xD0, 0x03, 0xD0, 0x00, 0x0E,
-	0x03, 0xD1, 0x03, 0xD1, 0x00, 0x10, 0x03, 0xD8, 0x03, 0xD8, 0x00, 0x03, 0x03, 0xDB, 0x03, 0xDB,
-	0x00, 0x03, 0x03, 0xDC, 0x03, 0xDC, 0x00, 0x0A, 0x03, 0xDD, 0x03, 0xDD, 0x00, 0x06, 0x03, 0xDE,
-	0x03, 0xDE, 0x00, 0x15, 0x03, 0xDF, 0x03, 0xDF, 0x00, 0x02, 0x03, 0xE0, 0x03, 0xE0, 0x00, 0x01,
-	0x03, 0xE1, 0x03, 0xE1, 0x00, 0x13, 0x03, 0xE2, 0x03, 0xE2, 0x00, 0x01, 0x03, 0xE3, 0x03, 0xE3,
-	0x00, 0x02, 0x03, 0xE4, 0x03, 0xE4, 0x00, 0x05, 0x03, 0xE5, 0x03, 0xE5, 0x00, 0x07, 0x03, 0xE6,
-	0x03, 0xE6, 0x00, 0x02, 0x03, 0xE7, 0x03, 0xE7, 0x00, 0x01, 0x03, 0xE8, 0x03, 0xE8, 0x00, 0x1D,
-	0x03, 0xEC, 0x03, 0xEC, 0x00, 0x01, 0x03, 0xED, 0x03, 0xED, 0x00, 0x05, 0x03, 0xF6, 0x03, 0xF7,
-	0x00, 0x04, 0x03, 0xFA, 0x03, 0xFA, 0x00, 0x04, 0x04, 0x01, 0x04, 0x01, 0x00, 0x02, 0x04, 0x02,
-	0x04, 0x02, 0x00, 0x01, 0x04, 0x05, 0x04, 0x05, 0x00, 0x17, 0x04, 0x06, 0x04, 0x06, 0x00, 0x05,
-	0x04, 0x07, 0x04, 0x07, 0x00, 0x02, 0x04, 0x08, 0x04, 0x08, 0x00, 0x03, 0x04, 0x0B, 0x04, 0x0B,
-	0x00, 0x03, 0x04, 0x0C, 0x04, 0x0C, 0x00, 0x02, 0x04, 0x0D, 0x04, 0x0D, 0x00, 0x18, 0x04, 0x0E,
-	0x04, 0x0E, 0x00, 0x05, 0x04, 0x10, 0x04, 0x10, 0x00, 0x06, 0x04, 0x11, 0x04, 0x11, 0x00, 0x07,
-	0x04, 0x13, 0x04, 0x13, 0x00, 0x10, 0x04, 0x14, 0x04, 0x14, 0x00, 0x15, 0x04, 0x15, 0x04, 0x15,
-	0x00, 0x10, 0x04, 0x16, 0x04, 0x16, 0x00, 0x15, 0x04, 0x1A, 0x04, 0x1A, 0x00, 0x02, 0x04, 0x1C,
-	0x04, 0x1D, 0x00, 0x02, 0x04, 0x1E, 0x04, 0x1E, 0x00, 0x06, 0x04, 0x1F, 0x04, 0x1F, 0x00, 0x07,
-	0x04, 0x23, 0x04, 0x23, 0x00, 0x01, 0x04, 0x25, 0x04, 0x25, 0x00, 0x01, 0x04, 0x26, 0x04, 0x26,
-	0x00, 0x03, 0x04, 0x27, 0x04, 0x27, 0x00, 0x13, 0x04, 0x28, 0x04, 0x28, 0x00, 0x03, 0x04, 0x29,
-	0x04, 0x29, 0x00, 0x02, 0x04, 0x2A, 0x04, 0x2A, 0x00, 0x03, 0x04, 0x2B, 0x04, 0x2B, 0x00, 0x13,
-	0x04, 0x2E, 0x04, 0x2E, 0x00, 0x0E, 0x04, 0x2F, 0x04, 0x2F, 0x00, 0x05, 0x04, 0x30, 0x04, 0x30,
-	0x00, 0x0E, 0x04, 0x31, 0x04, 0x31, 0x00, 0x05, 0x04, 0x32, 0x04, 0x32, 0x00, 0x0E, 0x04, 0x33,
-	0x04, 0x33, 0x00, 0x05, 0x04, 0x34, 0x04, 0x34, 0x00, 0x11, 0x04, 0x35, 0x04, 0x35, 0x00, 0x14,
-	0x04, 0x37, 0x04, 0x37, 0x00, 0x01, 0x04, 0x38, 0x04, 0x38, 0x00, 0x02, 0x04, 0x92, 0x04, 0x92,
-	0x00, 0x0A, 0x04, 0x94, 0x04, 0x94, 0x00, 0x11, 0x04, 0x95, 0x04, 0x95, 0x00, 0x14, 0x04, 0x97,
-	0x04, 0x97, 0x00, 0x01, 0x04, 0xA1, 0x04, 0xA1, 0x00, 0x18, 0x04, 0xA7, 0x04, 0xA7, 0x00, 0x0B,
-	0x05, 0x05, 0x05, 0x05, 0x00, 0x1A, 0x05, 0x0C, 0x05, 0x0C, 0x00, 0x09, 0x05, 0x0F, 0x05, 0x0F,
-	0x00, 0x09, 0x05, 0x10, 0x05, 0x10, 0x00, 0x0C, 0x05, 0x11, 0x05, 0x11, 0x00, 0x0F, 0x05, 0x14,
-	0x05, 0x14, 0x00, 0x09, 0x05, 0x15, 0x05, 0x15, 0x00, 0x16, 0x00, 0x02, 0x00, 0x6B, 0x00, 0x06,
-	0x00, 0x06, 0x00, 0x01, 0x00, 0x0B, 0x00, 0x0B, 0x00, 0x01, 0x00, 0x96, 0x00, 0x96, 0x00, 0x1C,
-	0x00, 0xB2, 0x00, 0xB2, 0x00, 0x1D, 0x00, 0xD4, 0x00, 0xD5, 0x00, 0x09, 0x00, 0xDA, 0x00, 0xDA,
-	0x00, 0x03, 0x00, 0xDE, 0x00, 0xDE, 0x00, 0x0A, 0x00, 0xE4, 0x00, 0xE4, 0x00, 0x09, 0x00, 0xE6,
-	0x00, 0xE6, 0x00, 0x09, 0x00, 0xEC, 0x00, 0xEC, 0x00, 0x0B, 0x00, 0xEE, 0x00, 0xEE, 0x00, 0x04,
-	0x00, 0xF7, 0x00, 0xF7, 0x00, 0x0C, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x0D, 0x00, 0xFE, 0x00, 0xFE,
-	0x00, 0x0D, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x0C, 0x01, 0x04, 0x01, 0x05, 0x00, 0x0D, 0x01, 0x0A,
-	0x01, 0x0A, 0x00, 0x0D, 0x01, 0x0D, 0x01, 0x0D, 0x00, 0x0F, 0x01, 0x18, 0x01, 0x18, 0x00, 0x10,
-	0x01, 0x19, 0x01, 0x19, 0x00, 0x16, 0x01, 0x1A, 0x01, 0x1A, 0x00, 0x02, 0x01, 0x2E, 0x01, 0x2E,
-	0x00, 0x0C, 0x01, 0x2F, 0x01, 0x2F, 0x00, 0x08, 0x01, 0x30, 0x01, 0x30, 0x00, 0x0B, 0x01, 0x33,
-	0x01, 0x33, 0x00, 0x03, 0x01, 0x34, 0x01, 0x34, 0x00, 0x04, 0x01, 0x35, 0x01, 0x35, 0x00, 0x05,
-	0x01, 0x37, 0x01, 0x37, 0x00, 0x05, 0x01, 0x39, 0x01, 0x39, 0x00, 0x05, 0x01, 0x43, 0x01, 0x43,
-	0x00, 0x03, 0x01, 0x44, 0x01, 0x44, 0x00, 0x04, 0x01, 0x58, 0x01, 0x58, 0x00, 0x11, 0x01, 0x5C,
-	0x01, 0x5C, 0x00, 0x0B, 0x01, 0x5D, 0x01, 0x5D, 0x00, 0x03, 0x01, 0x5E, 0x01, 0x5E, 0x00, 0x04,
-	0x01, 0x84, 0x01, 0x85, 0x00, 0x01, 0x01, 0x87, 0x01, 0x89, 0x00, 0x01, 0x02, 0x05, 0x02, 0x05,
-	0x00, 0x18, 0x02, 0x19, 0x02, 0x19, 0x00, 0x07, 0x02, 0x28, 0x02, 0x2A, 0x00, 0x07, 0x03, 0xC8,
-	0x03, 0xC8, 0x00, 0x0E, 0x03, 0xC9, 0x03, 0xC9, 0x00, 0x08, 0x03, 0xCD, 0x03, 0xCD, 0x00, 0x1E,
-	0x03, 0xCE, 0x03, 0xCF, 0x00, 0x05, 0x03, 0xD0, 0x03, 0xD0, 0x00, 0x0A, 0x03, 0xD1, 0x03, 0xD1,
-	0x00, 0x0F, 0x03, 0xD2, 0x03, 0xD2, 0x00, 0x1F, 0x03, 0xD3, 0x03, 0xD3, 0x00, 0x08, 0x03, 0xD4,
-	0x03, 0xD4, 0x00, 0x0E, 0x03, 0xD8, 0x03, 0xD8, 0x00, 0x11, 0x03, 0xDA, 0x03, 0xDA, 0x00, 0x20,
-	0x03, 0xDB, 0x03, 0xDB, 0x00, 0x13, 0x03, 0xDC, 0x03, 0xDC, 0x00, 0x14, 0x03, 0xDD, 0x03, 0xDD,
-	0x00, 0x03, 0x03, 0xDE, 0x03, 0xDE, 0x00, 0x12, 0x03, 0xDF, 0x03, 0xDF, 0x00, 0x06, 0x03, 0xE1,
-	0x03, 0xE1, 0x00, 0x10, 0x03, 0xE2, 0x03, 0xE2, 0x00, 0x0C, 0x03, 0xE3, 0x03, 0xE3, 0x00, 0x15,
-	0x03, 0xE4, 0x03, 0xE4, 0x00, 0x02, 0x03, 0xE5, 0x03, 0xE5, 0x00, 0x04, 0x03, 0xE6, 0x03, 0xE6,
-	0x00, 0x06, 0x03, 0xE7, 0x03, 0xE7, 0x00, 0x0B, 0x03, 0xED, 0x03, 0xED, 0x00, 0x02, 0x03, 0xF6,
-	0x03, 0xF7, 0x00, 0x01, 0x03, 0xFA, 0x03, 0xFA, 0x00, 0x01, 0x03, 0xFF, 0x03, 0xFF, 0x00, 0x0E,
-	0x04, 0x01, 0x04, 0x01, 0x00, 0x06, 0x04, 0x05, 0x04, 0x05, 0x00, 0x16, 0x04, 0x06, 0x04, 0x06,
-	0x00, 0x02, 0x04, 0x0B, 0x04, 0x0B, 0x00, 0x13, 0x04, 0x0C, 0x04, 0x0C, 0x00, 0x15, 0x04, 0x0D,
-	0x04, 0x0D, 0x00, 0x17, 0x04, 0x0E, 0x04, 0x0E, 0x00, 0x02, 0x04, 0x10, 0x04, 0x10, 0x00, 0x03,
-	0x04, 0x11, 0x04, 0x11, 0x00, 0x04, 0x04, 0x13, 0x04, 0x13, 0x00, 0x0F, 0x04, 0x14, 0x04, 0x14,
-	0x00, 0x12, 0x04, 0x15, 0x04, 0x15, 0x00, 0x0F, 0x04, 0x16, 0x04, 0x16, 0x00, 0x12, 0x04, 0x19,
-	0x04, 0x19, 0x00, 0x0E, 0x04, 0x1A, 0x04, 0x1A, 0x00, 0x06, 0x04, 0x1C, 0x04, 0x1D, 0x00, 0x06,
-	0x04, 0x1E, 0x04, 0x1E, 0x00, 0x03, 0x04, 0x1F, 0x04, 0x1F, 0x00, 0x04, 0x04, 0x26, 0x04, 0x26,
-	0x00, 0x11, 0x04, 0x27, 0x04, 0x27, 0x00, 0x10, 0x04, 0x2B, 0x04, 0x2B, 0x00, 0x10, 0x04, 0x2D,
-	0x04, 0x2D, 0x00, 0x0C, 0x04, 0x2E, 0x04, 0x2E, 0x00, 0x0A, 0x04, 0x2F, 0x04, 0x2F, 0x00, 0x02,
-	0x04, 0x30, 0x04, 0x30, 0x00, 0x0A, 0x04, 0x31, 0x04, 0x31, 0x00, 0x02, 0x04, 0x32, 0x04, 0x32,
-	0x00, 0x0A, 0x04, 0x33, 0x04, 0x33, 0x00, 0x02, 0x04, 0x92, 0x04, 0x92, 0x00, 0x14, 0x04, 0x96,
-	0x04, 0x96, 0x00, 0x08, 0x04, 0x97, 0x04, 0x97, 0x00, 0x0B, 0x04, 0x9A, 0x04, 0x9A, 0x00, 0x21,
-	0x04, 0x9C, 0x04, 0x9C, 0x00, 0x09, 0x04, 0x9D, 0x04, 0x9D, 0x00, 0x08, 0x04, 0x9F, 0x04, 0x9F,
-	0x00, 0x05, 0x04, 0xA1, 0x04, 0xA1, 0x00, 0x17, 0x05, 0x03, 0x05, 0x03, 0x00, 0x07, 0x05, 0x05,
-	0x05, 0x05, 0x00, 0x19, 0x05, 0x0C, 0x05, 0x0C, 0x00, 0x1A, 0x05, 0x10, 0x05, 0x10, 0x00, 0x1B,
-	0x00, 0x01, 0x01, 0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x85, 0x15, 0x94, 0x15, 0x82, 0x15, 0x7C,
-	0x15, 0x76, 0x15, 0x68, 0x15, 0x42, 0x15, 0x0C, 0x13, 0x9E, 0x12, 0x88, 0x11, 0x42, 0x10, 0x74,
-	0x10, 0x52, 0x0F, 0x38, 0x0E, 0x4A, 0x0E, 0x18, 0x0D, 0x96, 0x10, 0x52, 0x10, 0x52, 0x0D, 0x4C,
-	0x10, 0x52, 0x10, 0x52, 0x10, 0x52, 0x0C, 0x62, 0x0B, 0xE4, 0x10, 0x52, 0x0B, 0xBA, 0x0B, 0x3C,
-	0x0A, 0xC6, 0x0A, 0xA4, 0x09, 0xFA, 0x09, 0x9C, 0x09, 0x92, 0x08, 0xF4, 0x08, 0xEE, 0x08, 0xC4,
-	0x08, 0x4A, 0x07, 0x38, 0x07, 0x22, 0x06, 0xE4, 0x06, 0x5A, 0x06, 0x04, 0x05, 0xDE, 0x07, 0x22,
-	0x05, 0x88, 0x05, 0x5E, 0x05, 0x0C, 0x04, 0xD6, 0x05, 0xDE, 0x04, 0x9C, 0x04, 0x7A, 0x04, 0x6C,
-	0x04, 0x62, 0x08, 0xC4, 0x07, 0x22, 0x03, 0xD8, 0x09, 0x92, 0x0E, 0x18, 0x08, 0xEE, 0x03, 0xA2,
-	0x03, 0xA2, 0x03, 0xA2, 0x10, 0x52, 0x0E, 0x18, 0x08, 0xEE, 0x10, 0x52, 0x10, 0x52, 0x03, 0x94,
-	0x09, 0x92, 0x0E, 0x18, 0x08, 0xEE, 0x03, 0x32, 0x03, 0xD8, 0x10, 0x52, 0x10, 0x52, 0x03, 0xA2,
-	0x03, 0xA2, 0x0D, 0x4C, 0x04, 0x9C, 0x03, 0x28, 0x03, 0xD8, 0x10, 0x52, 0x10, 0x52, 0x03, 0x94,
-	0x03, 0x1A, 0x03, 0x08, 0x02, 0x7A, 0x0E, 0x18, 0x02, 0x58, 0x02, 0x4E, 0x04, 0x7A, 0x07, 0x22,
-	0x04, 0x62, 0x08, 0xEE, 0x02, 0x4E, 0x09, 0x92, 0x04, 0x62, 0x02, 0x4E, 0x04, 0x6C, 0x04, 0x62,
-	0x03, 0x08, 0x02, 0x2C, 0x04, 0x62, 0x10, 0x52, 0x0E, 0x18, 0x08, 0xEE, 0x10, 0x52, 0x04, 0x9C,
-	0x02, 0x58, 0x04, 0x9C, 0x02, 0x58, 0x02, 0x4E, 0x02, 0x4E, 0x02, 0x4E, 0x0E, 0x18, 0x08, 0xEE,
-	0x03, 0x94, 0x04, 0x7A, 0x04, 0x7A, 0x07, 0x22, 0x0D, 0x4C, 0x04, 0x62, 0x0D, 0x4C, 0x04, 0x62,
-	0x0D, 0x4C, 0x04, 0x62, 0x02, 0x7A, 0x03, 0xD8, 0x09, 0x92, 0x02, 0x22, 0x0B, 0xBA, 0x03, 0xD8,
-	0x03, 0xA2, 0x02, 0x2C, 0x00, 0x01, 0x00, 0x85, 0x00, 0x04, 0x00, 0x0C, 0x00, 0x3F, 0x00, 0x5F,
-	0x00, 0x96, 0x00, 0x9D, 0x00, 0xB2, 0x00, 0xD2, 0x00, 0xD4, 0x00, 0xD5, 0x00, 0xD6, 0x00, 0xD7,
-	0x00, 0xD8, 0x00, 0xD9, 0x00, 0xDA, 0x00, 0xDB, 0x00, 0xDC, 0x00, 0xDD, 0x00, 0xDE, 0x00, 0xE0,
-	0x00, 0xE1, 0x00, 0xE2, 0x00, 0xE3, 0x00, 0xE4, 0x00, 0xE5, 0x00, 0xE6, 0x00, 0xE7, 0x00, 0xE8,
-	0x00, 0xE9, 0x00, 0xEA, 0x00, 0xEB, 0x00, 0xEC, 0x00, 0xED, 0x00, 0xEE, 0x00, 0xEF, 0x00, 0xF1,
-	0x00, 0xF6, 0x00, 0xF7, 0x00, 0xF8, 0x00, 0xFB, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFF, 0x01, 0x00,
-	0x01, 0x03, 0x01, 0x04, 0x01, 0x05, 0x01, 0x0A, 0x01, 0x0D, 0x01, 0x18, 0x01, 0x19, 0x01, 0x1A,
-	0x01, 0x22, 0x01, 0x2E, 0x01, 0x2F, 0x01, 0x30, 0x01, 0x33, 0x01, 0x34, 0x01, 0x35, 0x01, 0x37,
-	0x01, 0x39, 0x01, 0x3B, 0x01, 0x43, 0x01, 0x44, 0x01, 0x54, 0x01, 0x56, 0x01, 0x58, 0x01, 0x5C,
-	0x01, 0x5D, 0x01, 0x5E, 0x01, 0x85, 0x03, 0xC9, 0x03, 0xCB, 0x03, 0xCC, 0x03, 0xCE, 0x03, 0xCF,
-	0x03, 0xD0, 0x03, 0xD1, 0x03, 0xD2, 0x03, 0xD3, 0x03, 0xD6, 0x03, 0xD7, 0x03, 0xD8, 0x03, 0xDA,
-	0x03, 0xDB, 0x03, 0xDC, 0x03, 0xDD, 0x03, 0xDE, 0x03, 0xDF, 0x03, 0xE1, 0x03, 0xE2, 0x03, 0xE4,
-	0x03, 0xE5, 0x03, 0xE6, 0x03, 0xE7, 0x03, 0xED, 0x04, 0x01, 0x04, 0x05, 0x04, 0x06, 0x04, 0x0B,
-	0x04, 0x0D, 0x04, 0x0E, 0x04, 0x0F, 0x04, 0x10, 0x04, 0x11, 0x04, 0x12, 0x04, 0x13, 0x04, 0x14,
-	0x04, 0x15, 0x04, 0x16, 0x04, 0x1A, 0x04, 0x1C, 0x04, 0x1D, 0x04, 0x1E, 0x04, 0x1F, 0x04, 0x26,
-	0x04, 0x27, 0x04, 0x2B, 0x04, 0x2D, 0x04, 0x2E, 0x04, 0x2F, 0x04, 0x30, 0x04, 0x31, 0x04, 0x32,
-	0x04, 0x33, 0x04, 0x92, 0x04, 0x96, 0x04, 0x97, 0x04, 0x9A, 0x04, 0x9C, 0x04, 0x9D, 0x04, 0x9F,
-	0x04, 0xA1, 0x00, 0x02, 0x00, 0xF6, 0xFF, 0xC0, 0x01, 0x85, 0xFF, 0xB0, 0x00, 0x08, 0x00, 0x0A,
-	0xFF, 0xE2, 0x00, 0x0D, 0x00, 0x14, 0x00, 0x0E, 0xFF, 0xCF, 0x00, 0x41, 0x00, 0x12, 0x00, 0x61,
-	0x00, 0x13, 0x00, 0x6D, 0xFF, 0xAE, 0x00, 0x7C, 0xFF, 0xCD, 0x01, 0x8D, 0xFF, 0xD3, 0x00, 0x02,
-	0x00, 0xF6, 0xFF, 0xF5, 0x01, 0x85, 0xFF, 0xB0, 0x00, 0x08, 0x00, 0xF6, 0xFF, 0xF0, 0x00, 0xFE,
-	0x00, 0x00, 0x01, 0x09, 0xFF, 0xF1, 0x01, 0x20, 0xFF, 0xF3, 0x01, 0x3A, 0xFF, 0xF1, 0x01, 0x63,
-	0xFF, 0xF3, 0x01, 0x65, 0xFF, 0xE9, 0x01, 0x6D, 0xFF, 0xD3, 0x00, 0x23, 0x00, 0x04, 0xFF, 0xD8,
-	0x00, 0x6D, 0xFE, 0xB8, 0x00, 0x7C, 0xFF, 0x28, 0x00, 0xD9, 0xFF, 0xA5, 0x00, 0xE6, 0x00, 0x0F,
-	0x00, 0xEA, 0xFF, 0xE4, 0x00, 0xEB, 0xFF, 0xA0, 0x00, 0xED, 0xFF, 0x74, 0x00, 0xEF, 0xFF, 0x80,
-	0x00, 0xF6, 0xFF, 0xB2, 0x00, 0xFD, 0xFF, 0x7D, 0x00, 0xFE, 0xFF, 0x93, 0x00, 0xFF, 0xFF, 0x80,
-	0x01, 0x01, 0xFF, 0x79, 0x01, 0x02, 0x00, 0x00, 0x01, 0x07, 0xFF, 0x7D, 0x01, 0x09, 0xFF, 0x7F,
-	0x01, 0x1C, 0xFF, 0x98, 0x01, 0x20, 0xFF, 0xDA, 0x01, 0x2E, 0xFF, 0x81, 0x01, 0x30, 0xFF, 0x98,
-	0x01, 0x38, 0xFF, 0x7D, 0x01, 0x3A, 0xFF, 0xB3, 0x01, 0x40, 0xFF, 0xA0, 0x01, 0x4A, 0xFF, 0x7C,
-	0x01, 0x4C, 0xFF, 0x9A, 0x01, 0x4D, 0xFF, 0x6C, 0x01, 0x58, 0xFF, 0xE6, 0x01, 0x5F, 0xFF, 0x6B,
-	0x01, 0x63, 0xFF, 0x92, 0x01, 0x65, 0xFF, 0xAD, 0x01, 0x69, 0xFF, 0x7B, 0x01, 0x6C, 0x00, 0x0F,
-	0x01, 0x6D, 0xFF, 0x91, 0x01, 0x6E, 0xFF, 0xF2, 0x00, 0x04, 0x00, 0x0D, 0xFF, 0xE6, 0x00, 0x41,
-	0xFF, 0xF4, 0x00, 0x61, 0xFF, 0xEF, 0x01, 0x4D, 0xFF, 0xED, 0x00, 0x03, 0x00, 0xD9, 0xFF, 0xA8,
-	0x00, 0xED, 0xFF, 0xCA, 0x01, 0x5F, 0xFF, 0xE3, 0x00, 0x02, 0x01, 0x11, 0x00, 0x0B, 0x01, 0x6C,
-	0xFF, 0xE6, 0x00, 0x18, 0x00, 0xF7, 0xFF, 0xC5, 0x01, 0x03, 0xFF, 0xC5, 0x01, 0x18, 0xFF, 0x80,
-	0x01, 0x1E, 0xFF, 0xC5, 0x01, 0x22, 0xFF, 0xC5, 0x01, 0x42, 0xFF, 0xC5, 0x01, 0x60, 0xFF, 0xC5,
-	0x01, 0x61, 0xFF, 0xC5, 0x01, 0x6B, 0xFF, 0xC5, 0x03, 0xDF, 0xFF, 0xC5, 0x03, 0xE1, 0xFF, 0x80,
-	0x03, 0xE3, 0xFF, 0xC5, 0x03, 0xE6, 0xFF, 0xC5, 0x03, 0xE8, 0xFF, 0x90, 0x04, 0x01, 0xFF, 0xC5,
-	0x04, 0x07, 0xFF, 0xC5, 0x04, 0x0C, 0xFF, 0xC5, 0x04, 0x1A, 0xFF, 0xC5, 0x04, 0x1C, 0xFF, 0xC5,
-	0x04, 0x1D, 0xFF, 0xC5, 0x04, 0x27, 0xFF, 0x80, 0x04, 0x29, 0xFF, 0xC5, 0x04, 0x2B, 0xFF, 0x80,
-	0x04, 0x38, 0xFF, 0xC5, 0x00, 0x03, 0x00, 0xD9, 0xFF, 0xDF, 0x00, 0xE6, 0xFF, 0xE0, 0x01, 0x6C,
-	0xFF, 0xE0, 0x00, 0x0D, 0x00, 0xEA, 0xFF, 0xD7, 0x00, 0xF6, 0xFF, 0xB9, 0x00, 0xFE, 0xFF, 0xE9,
-	0x01, 0x09, 0xFF, 0xB2, 0x01, 0x1C, 0xFF, 0xD2, 0x01, 0x20, 0xFF, 0xC8, 0x01, 0x3A, 0xFF, 0xA0,
-	0x01, 0x4A, 0xFF, 0xC5, 0x01, 0x58, 0xFF, 0xE4, 0x01, 0x63, 0xFF, 0xCC, 0x01, 0x65, 0xFF, 0xCC,
-	0x01, 0x6D, 0xFF, 0xCB, 0x01, 0x6E, 0xFF, 0xEF, 0x00, 0x22, 0x00, 0x6D, 0xFD, 0xBF, 0x00, 0x7C,
-	0xFE, 0x7D, 0x00, 0xD9, 0xFF, 0x52, 0x00, 0xE6, 0x00, 0x05, 0x00, 0xEA, 0xFF, 0xBD, 0x00, 0xEB,
-	0xFF, 0x49, 0x00, 0xED, 0xFE, 0xFE, 0x00, 0xEF, 0xFF, 0x13, 0x00, 0xF6, 0xFF, 0x68, 0x00, 0xFD,
-	0xFF, 0x0E, 0x00, 0xFE, 0xFF, 0x33, 0x00, 0xFF, 0xFF, 0x13, 0x01, 0x01, 0xFF, 0x07, 0x01, 0x02,
-	0x00, 0x00, 0x01, 0x07, 0xFF, 0x0E, 0x01, 0x09, 0xFF, 0x11, 0x01, 0x1C, 0xFF, 0x3C, 0x01, 0x20,
-	0xFF, 0xAC, 0x01, 0x2E, 0xFF, 0x15, 0x01, 0x30, 0xFF, 0x3C, 0x01, 0x38, 0xFF, 0x0E, 0x01, 0x3A,
-	0xFF, 0x6A, 0x01, 0x40, 0xFF, 0x49, 0x01, 0x4A, 0xFF, 0x0C, 0x01, 0x4C, 0xFF, 0x3F, 0x01, 0x4D,
-	0xFE, 0xF1, 0x01, 0x58, 0xFF, 0xC0, 0x01, 0x5F, 0xFE, 0xEF, 0x01, 0x63, 0xFF, 0x31, 0x01, 0x65,
-	0xFF, 0x5F, 0x01, 0x69, 0xFF, 0x0A, 0x01, 0x6C, 0x00, 0x05, 0x01, 0x6D, 0xFF, 0x30, 0x01, 0x6E,
-	0xFF, 0xD5, 0x00, 0x02, 0x00, 0xED, 0xFF, 0xC8, 0x01, 0x1C, 0xFF, 0xF1, 0x00, 0x03, 0x00, 0x0D,
-	0x00, 0x14, 0x00, 0x41, 0x00, 0x11, 0x00, 0x61, 0x00, 0x13, 0x00, 0x08, 0x00, 0xED, 0xFF, 0xB8,
-	0x00, 0xF6, 0xFF, 0xEA, 0x01, 0x09, 0xFF, 0xF0, 0x01, 0x20, 0xFF, 0xF1, 0x01, 0x3A, 0xFF, 0xEB,
-	0x01, 0x63, 0xFF, 0xF5, 0x01, 0x6D, 0xFF, 0xEC, 0x01, 0x85, 0xFF, 0xB0, 0x00, 0x0E, 0x00, 0x23,
-	0xFF, 0xC3, 0x00, 0xD9, 0x00, 0x13, 0x00, 0xE6, 0xFF, 0xC5, 0x00, 0xF6, 0xFF, 0xCA, 0x01, 0x3A,
-	0xFF, 0x9F, 0x01, 0x49, 0xFF, 0x51, 0x01, 0x4A, 0xFF, 0x7B, 0x01, 0x4C, 0xFF, 0xCA, 0x01, 0x4D,
-	0xFF, 0xDD, 0x01, 0x58, 0xFF, 0xF2, 0x01, 0x62, 0xFF, 0x75, 0x01, 0x64, 0xFF, 0xCA, 0x01, 0x6C,
-	0xFF, 0x4F, 0x01, 0x6D, 0xFF, 0x8C, 0x00, 0x0D, 0x00, 0xF6, 0xFF, 0xBA, 0x00, 0xF9, 0xFF, 0xD9,
-	0x00, 0xFE, 0x00, 0x00, 0x01, 0x09, 0xFF, 0xCF, 0x01, 0x20, 0xFF, 0xDB, 0x01, 0x3A, 0xFF, 0x50,
-	0x01, 0x48, 0xFF, 0xD9, 0x01, 0x4A, 0xFF, 0x9D, 0x01, 0x63, 0xFF, 0xF0, 0x01, 0x65, 0xFF, 0xF2,
-	0x01, 0x6D, 0xFF, 0x4C, 0x04, 0x35, 0xFF, 0xD9, 0x04, 0x95, 0xFF, 0xD9, 0x00, 0x14, 0x00, 0xEE,
-	0xFF, 0xF5, 0x00, 0xF6, 0xFF, 0xBA, 0x00, 0xF9, 0xFF, 0xD9, 0x00, 0xFE, 0x00, 0x00, 0x01, 0x09,
-	0xFF, 0xCF, 0x01, 0x20, 0xFF, 0xDB, 0x01, 0x34, 0xFF, 0xF5, 0x01, 0x3A, 0xFF, 0x50, 0x01, 0x44,
-	0xFF, 0xF5, 0x01, 0x48, 0xFF, 0xD9, 0x01, 0x4A, 0xFF, 0x9D, 0x01, 0x5E, 0xFF, 0xF5, 0x01, 0x63,
-	0xFF, 0xF0, 0x01, 0x65, 0xFF, 0xF2, 0x01, 0x6D, 0xFF, 0x4C, 0x03, 0xE5, 0xFF, 0xF5, 0x04, 0x11,
-	0xFF, 0xF5, 0x04, 0x1F, 0xFF, 0xF5, 0x04, 0x35, 0xFF, 0xD9, 0x04, 0x95, 0xFF, 0xD9, 0x00, 0x0A,
-	0x00, 0x06, 0xFF, 0xD6, 0x00, 0x0B, 0xFF, 0xD6, 0x01, 0x84, 0xFF, 0xD6, 0x01, 0x85, 0xFF, 0xD6,
-	0x01, 0x87, 0xFF, 0xD6, 0x01, 0x88, 0xFF, 0xD6, 0x01, 0x89, 0xFF, 0xD6, 0x03, 0xF6, 0xFF, 0xD6,
-	0x03, 0xF7, 0xFF, 0xD6, 0x03, 0xFA, 0xFF, 0xD6, 0x00, 0x15, 0x00, 0xED, 0xFF, 0xEF, 0x00, 0xEE,
-	0xFF, 0xF0, 0x00, 0xF2, 0xFF, 0xF3, 0x00, 0xFE, 0x00, 0x00, 0x01, 0x04, 0xFF, 0xF3, 0x01, 0x1A,
-	0xFF, 0xF4, 0x01, 0x34, 0xFF, 0xF0, 0x01, 0x44, 0xFF, 0xF0, 0x01, 0x51, 0xFF, 0xF3, 0x01, 0x5E,
-	0xFF, 0xF0, 0x01, 0x70, 0xFF, 0xF3, 0x03, 0xE4, 0xFF, 0xF4, 0x03, 0xE5, 0xFF, 0xF0, 0x03, 0xED,
-	0xFF, 0xF4, 0x04, 0x06, 0xFF, 0xF4, 0x04, 0x0E, 0xFF, 0xF4, 0x04, 0x11, 0xFF, 0xF0, 0x04, 0x1F,
-	0xFF, 0xF0, 0x04, 0x2F, 0xFF, 0xF4, 0x04, 0x31, 0xFF, 0xF4, 0x04, 0x33, 0xFF, 0xF4, 0x00, 0x09,
-	0x00, 0xF6, 0xFF, 0xBA, 0x00, 0xFE, 0x00, 0x00, 0x01, 0x09, 0xFF, 0xCF, 0x01, 0x20, 0xFF, 0xDB,
-	0x01, 0x3A, 0xFF, 0x50, 0x01, 0x4A, 0xFF, 0x9D, 0x01, 0x63, 0xFF, 0xF0, 0x01, 0x65, 0xFF, 0xF2,
-	0x01, 0x6D, 0xFF, 0x4C, 0x00, 0x15, 0x00, 0xF6, 0xFF, 0xBA, 0x00, 0xF9, 0xFF, 0xD9, 0x00, 0xFE,
-	0x00, 0x00, 0x01, 0x09, 0xFF, 0xCF, 0x01, 0x1A, 0xFF, 0xDD, 0x01, 0x20, 0xFF, 0xDB, 0x01, 0x3A,
-	0xFF, 0x50, 0x01, 0x48, 0xFF, 0xD9, 0x01, 0x4A, 0xFF, 0x9D, 0x01, 0x63, 0xFF, 0xF0, 0x01, 0x65,
-	0xFF, 0xF2, 0x01, 0x6D, 0xFF, 0x4C, 0x03, 0xE4, 0xFF, 0xDD, 0x03, 0xED, 0xFF, 0xDD, 0x04, 0x06,
-	0xFF, 0xDD, 0x04, 0x0E, 0xFF, 0xDD, 0x04, 0x2F, 0xFF, 0xDD, 0x04, 0x31, 0xFF, 0xDD, 0x04, 0x33,
-	0xFF, 0xDD, 0x04, 0x35, 0xFF, 0xD9, 0x04, 0x95, 0xFF, 0xD9, 0x00, 0x22, 0x00, 0xED, 0x00, 0x3A,
-	0x00, 0xF2, 0x00, 0x18, 0x00, 0xF6, 0xFF, 0xE3, 0x00, 0xF7, 0x00, 0x0C, 0x00, 0xF9, 0xFF, 0xF7,
-	0x00, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0x03, 0x00, 0x0C, 0x01, 0x04, 0x00, 0x18,
-	0x01, 0x1E, 0x00, 0x0C, 0x01, 0x22, 0x00, 0x0C, 0x01, 0x3A, 0xFF, 0xE2, 0x01, 0x42, 0x00, 0x0C,
-	0x01, 0x48, 0xFF, 0xF7, 0x01, 0x4A, 0xFF, 0xE3, 0x01, 0x51, 0x00, 0x18, 0x01, 0x60, 0x00, 0x0C,
-	0x01, 0x61, 0x00, 0x0C, 0x01, 0x6B, 0x00, 0x0C, 0x01, 0x6D, 0xFF, 0xE3, 0x01, 0x70, 0x00, 0x18,
-	0x03, 0xDF, 0x00, 0x0C, 0x03, 0xE3, 0x00, 0x0C, 0x03, 0xE6, 0x00, 0x0C, 0x04, 0x01, 0x00, 0x0C,
-	0x04, 0x07, 0x00, 0x0C, 0x04, 0x0C, 0x00, 0x0C, 0x04, 0x1A, 0x00, 0x0C, 0x04, 0x1C, 0x00, 0x0C,
-	0x04, 0x1D, 0x00, 0x0C, 0x04, 0x29, 0x00, 0x0C, 0x04, 0x35, 0xFF, 0xF7, 0x04, 0x38, 0x00, 0x0C,
-	0x04, 0x95, 0xFF, 0xF7, 0x00, 0x0F, 0x00, 0xED, 0x00, 0x14, 0x00, 0xF2, 0x00, 0x10, 0x00, 0xF6,
-	0xFF, 0xF0, 0x00, 0xF9, 0xFF, 0xF0, 0x00, 0xFE, 0x00, 0x00, 0x01, 0x01, 0x00, 0x0C, 0x01, 0x04,
-	0x00, 0x10, 0x01, 0x3A, 0xFF, 0xF0, 0x01, 0x48, 0xFF, 0xF0, 0x01, 0x4A, 0xFF, 0xE6, 0x01, 0x51,
-	0x00, 0x10, 0x01, 0x6D, 0xFF, 0xF0, 0x01, 0x70, 0x00, 0x10, 0x04, 0x35, 0xFF, 0xF0, 0x04, 0x95,
-	0xFF, 0xF0, 0x00, 0x05, 0x00, 0xED, 0xFF, 0xEE, 0x00, 0xF6, 0xFF, 0xB0, 0x00, 0xFE, 0x00, 0x00,
-	0x01, 0x3A, 0xFF, 0xEC, 0x01, 0x6D, 0xFF, 0xEC, 0x00, 0x44, 0x00, 0x06, 0x00, 0x0D, 0x00, 0x0B,
-	0x00, 0x0D, 0x00, 0xED, 0xFF, 0xAA, 0x00, 0xF2, 0xFF, 0xAF, 0x00, 0xF7, 0xFF, 0xB0, 0x01, 0x03,
-	0xFF, 0xB0, 0x01, 0x04, 0xFF, 0xAF, 0x01, 0x18, 0xFF, 0xD6, 0x01, 0x1A, 0x00, 0x0B, 0x01, 0x1C,
-	0xFF, 0xE2, 0x01, 0x1E, 0xFF, 0xB0, 0x01, 0x20, 0x00, 0x0C, 0x01, 0x22, 0xFF, 0xB0, 0x01, 0x42,
-	0xFF, 0xB0, 0x01, 0x51, 0xFF, 0xAF, 0x01, 0x60, 0xFF, 0xB0, 0x01, 0x61, 0xFF, 0xB0, 0x01, 0x63,
-	0x00, 0x0B, 0x01, 0x65, 0x00, 0x0B, 0x01, 0x6B, 0xFF, 0xB0, 0x01, 0x70, 0xFF, 0xAF, 0x01, 0x84,
-	0x00, 0x0D, 0x01, 0x85, 0x00, 0x0D, 0x01, 0x87, 0x00, 0x0D, 0x01, 0x88, 0x00, 0x0D, 0x01, 0x89,
-	0x00, 0x0D, 0x02, 0x05, 0xFF, 0xBF, 0x02, 0x0E, 0x00, 0x0E, 0x02, 0x0F, 0xFF, 0xED, 0x02, 0x12,
-	0x00, 0x0E, 0x02, 0x2A, 0x00, 0x0E, 0x02, 0x2B, 0xFF, 0xED, 0x02, 0x2C, 0x00, 0x0D, 0x02, 0x2E,
-	0x00, 0x0E, 0x02, 0x34, 0xFF, 0xED, 0x03, 0xDE, 0xFF, 0xF0, 0x03, 0xDF, 0xFF, 0xB0, 0x03, 0xE1,
-	0xFF, 0xD6, 0x03, 0xE3, 0xFF, 0xB0, 0x03, 0xE4, 0x00, 0x0B, 0x03, 0xE6, 0xFF, 0xB0, 0x03, 0xED,
-	0x00, 0x0B, 0x03, 0xF6, 0x00, 0x0D, 0x03, 0xF7, 0x00, 0x0D, 0x03, 0xFA, 0x00, 0x0D, 0x04, 0x01,
-	0xFF, 0xB0, 0x04, 0x06, 0x00, 0x0B, 0x04, 0x07, 0xFF, 0xB0, 0x04, 0x0C, 0xFF, 0xB0, 0x04, 0x0E,
-	0x00, 0x0B, 0x04, 0x14, 0xFF, 0xF0, 0x04, 0x16, 0xFF, 0xF0, 0x04, 0x1A, 0xFF, 0xB0, 0x04, 0x1C,
-	0xFF, 0xB0, 0x04, 0x1D, 0xFF, 0xB0, 0x04, 0x27, 0xFF, 0xD6, 0x04, 0x29, 0xFF, 0xB0, 0x04, 0x2B,
-	0xFF, 0xD6, 0x04, 0x2F, 0x00, 0x0B, 0x04, 0x31, 0x00, 0x0B, 0x04, 0x33, 0x00, 0x0B, 0x04, 0x38,
-	0xFF, 0xB0, 0x05, 0x05, 0xFF, 0xBF, 0x05, 0x0C, 0xFF, 0xED, 0x05, 0x0F, 0xFF, 0xED, 0x05, 0x10,
-	0x00, 0x0E, 0x05, 0x14, 0xFF, 0xED, 0x05, 0x15, 0x00, 0x0D, 0x00, 0x1E, 0x00, 0xF7, 0xFF, 0xF0,
-	0x01, 0x03, 0xFF, 0xF0, 0x01, 0x18, 0xFF, 0xEB, 0x01, 0x1C, 0xFF, 0xEB, 0x01, 0x1E, 0xFF, 0xF0,
-	0x01, 0x22, 0xFF, 0xF0, 0x01, 0x42, 0xFF, 0xF0, 0x01, 0x60, 0xFF, 0xF0, 0x01, 0x61, 0xFF, 0xF0,
-	0x01, 0x6B, 0xFF, 0xF0, 0x02, 0x0F, 0xFF, 0xEB, 0x02, 0x2B, 0xFF, 0xEB, 0x02, 0x34, 0xFF, 0xEB,
-	0x03, 0xDF, 0xFF, 0xF0, 0x03, 0xE1, 0xFF, 0xEB, 0x03, 0xE3, 0xFF, 0xF0, 0x03, 0xE6, 0xFF, 0xF0,
-	0x04, 0x01, 0xFF, 0xF0, 0x04, 0x07, 0xFF, 0xF0, 0x04, 0x0C, 0xFF, 0xF0, 0x04, 0x1A, 0xFF, 0xF0,
-	0x04, 0x1C, 0xFF, 0xF0, 0x04, 0x1D, 0xFF, 0xF0, 0x04, 0x27, 0xFF, 0xEB, 0x04, 0x29, 0xFF, 0xF0,
-	0x04, 0x2B, 0xFF, 0xEB, 0x04, 0x38, 0xFF, 0xF0, 0x05, 0x0C, 0xFF, 0xEB, 0x05, 0x0F, 0xFF, 0xEB,
-	0x05, 0x14, 0xFF, 0xEB, 0x00, 0x0A, 0x00, 0x06, 0xFF, 0xF5, 0x00, 0x0B, 0xFF, 0xF5, 0x01, 0x84,
-	0xFF, 0xF5, 0x01, 0x85, 0xFF, 0xF5, 0x01, 0x87, 0xFF, 0xF5, 0x01, 0x88, 0xFF, 0xF5, 0x01, 0x89,
-	0xFF, 0xF5, 0x03, 0xF6, 0xFF, 0xF5, 0x03, 0xF7, 0xFF, 0xF5, 0x03, 0xFA, 0xFF, 0xF5, 0x00, 0x01,
-	0x01, 0x1C, 0xFF, 0xF1, 0x00, 0x27, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xED, 0x00, 0x14, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0xF1, 0x00, 0x00, 0x00, 0xF3, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF5,
-	0x00, 0x00, 0x00, 0xF6, 0xFF, 0xED, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xED, 0x00, 0xFA,
-	0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xE2, 0x00, 0xFE, 0x00, 0x00, 0x01, 0x00,
-	0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x01, 0x2B, 0x00, 0x00, 0x01, 0x36, 0x00, 0x00, 0x01, 0x3A,
-	0xFF, 0xED, 0x01, 0x3C, 0x00, 0x00, 0x01, 0x3E, 0x00, 0x00, 0x01, 0x48, 0xFF, 0xED, 0x01, 0x4A,
-	0xFF, 0xED, 0x01, 0x53, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0x57, 0x00, 0x00, 0x01, 0x5C,
-	0x00, 0x00, 0x01, 0x6D, 0xFF, 0xED, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE2, 0x00, 0x00, 0x03, 0xE7,
-	0x00, 0x00, 0x03, 0xEC, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x04, 0x23, 0x00, 0x00, 0x04, 0x25,
-	0x00, 0x00, 0x04, 0x35, 0xFF, 0xED, 0x04, 0x37, 0x00, 0x00, 0x04, 0x95, 0xFF, 0xED, 0x04, 0x97,
-	0x00, 0x00, 0x00, 0x02, 0x00, 0xED, 0xFF, 0xC9, 0x01, 0x1C, 0xFF, 0xEE, 0x00, 0x17, 0x00, 0x06,
-	0xFF, 0xF2, 0x00, 0x0B, 0xFF, 0xF2, 0x00, 0xF6, 0xFF, 0xF4, 0x00, 0xFE, 0x00, 0x00, 0x01, 0x09,
-	0xFF, 0xF5, 0x01, 0x1A, 0xFF, 0xF5, 0x01, 0x3A, 0xFF, 0xF5, 0x01, 0x6D, 0xFF, 0xF5, 0x01, 0x84,
-	0xFF, 0xF2, 0x01, 0x85, 0xFF, 0xF2, 0x01, 0x87, 0xFF, 0xF2, 0x01, 0x88, 0xFF, 0xF2, 0x01, 0x89,
-	0xFF, 0xF2, 0x03, 0xE4, 0xFF, 0xF5, 0x03, 0xED, 0xFF, 0xF5, 0x03, 0xF6, 0xFF, 0xF2, 0x03, 0xF7,
-	0xFF, 0xF2, 0x03, 0xFA, 0xFF, 0xF2, 0x04, 0x06, 0xFF, 0xF5, 0x04, 0x0E, 0xFF, 0xF5, 0x04, 0x2F,
-	0xFF, 0xF5, 0x04, 0x31, 0xFF, 0xF5, 0x04, 0x33, 0xFF, 0xF5, 0x00, 0x2A, 0x00, 0xEC, 0xFF, 0xEF,
-	0x00, 0xED, 0xFF, 0xEE, 0x00, 0xEE, 0xFF, 0xF0, 0x00, 0xF0, 0xFF, 0xEF, 0x00, 0xF1, 0xFF, 0xEF,
-	0x00, 0xF3, 0xFF, 0xEF, 0x00, 0xF4, 0xFF, 0xEF, 0x00, 0xF5, 0xFF, 0xEF, 0x00, 0xF6, 0xFF, 0xEE,
-	0x00, 0xF8, 0xFF, 0xEF, 0x00, 0xFA, 0xFF, 0xEF, 0x00, 0xFB, 0xFF, 0xEF, 0x00, 0xFE, 0xFF, 0xEF,
-	0x01, 0x00, 0xFF, 0xEF, 0x01, 0x05, 0xFF, 0xEF, 0x01, 0x09, 0xFF, 0xF4, 0x01, 0x20, 0xFF, 0xF1,
-	0x01, 0x2B, 0xFF, 0xEF, 0x01, 0x34, 0xFF, 0xF0, 0x01, 0x36, 0xFF, 0xEF, 0x01, 0x3A, 0xFF, 0xEF,
-	0x01, 0x3C, 0xFF, 0xEF, 0x01, 0x3E, 0xFF, 0xEF, 0x01, 0x44, 0xFF, 0xF0, 0x01, 0x53, 0xFF, 0xEF,
-	0x01, 0x55, 0xFF, 0xEF, 0x01, 0x57, 0xFF, 0xEF, 0x01, 0x5C, 0xFF, 0xEF, 0x01, 0x5E, 0xFF, 0xF0,
-	0x01, 0x6D, 0xFF, 0xEF, 0x03, 0xE0, 0xFF, 0xEF, 0x03, 0xE2, 0xFF, 0xEF, 0x03, 0xE5, 0xFF, 0xF0,
-	0x03, 0xE7, 0xFF, 0xEF, 0x03, 0xEC, 0xFF, 0xEF, 0x04, 0x02, 0xFF, 0xEF, 0x04, 0x11, 0xFF, 0xF0,
-	0x04, 0x1F, 0xFF, 0xF0, 0x04, 0x23, 0xFF, 0xEF, 0x04, 0x25, 0xFF, 0xEF, 0x04, 0x37, 0xFF, 0xEF,
-	0x04, 0x97, 0xFF, 0xEF, 0x00, 0x08, 0x00, 0xD2, 0xFF, 0xEB, 0x00, 0xD6, 0xFF, 0xEB, 0x01, 0x39,
-	0xFF, 0xEB, 0x01, 0x45, 0xFF, 0xEB, 0x03, 0xDC, 0xFF, 0xEB, 0x04, 0x0D, 0xFF, 0xF3, 0x04, 0x92,
-	0xFF, 0xEB, 0x04, 0xA1, 0xFF, 0xF3, 0x00, 0x1D, 0x00, 0xD2, 0xFF, 0xE2, 0x00, 0xD4, 0xFF, 0xE4,
-	0x00, 0xD6, 0xFF, 0xE2, 0x00, 0xD9, 0xFF, 0xE1, 0x00, 0xDA, 0xFF, 0xE4, 0x00, 0xDD, 0xFF, 0xE4,
-	0x00, 0xDE, 0xFF, 0xE9, 0x00, 0xED, 0xFF, 0xE4, 0x00, 0xF2, 0xFF, 0xEB, 0x01, 0x04, 0xFF, 0xEB,
-	0x01, 0x33, 0xFF, 0xE4, 0x01, 0x39, 0xFF, 0xE2, 0x01, 0x43, 0xFF, 0xE4, 0x01, 0x45, 0xFF, 0xE2,
-	0x01, 0x50, 0xFF, 0xE4, 0x01, 0x51, 0xFF, 0xEB, 0x01, 0x5D, 0xFF, 0xE4, 0x01, 0x66, 0xFF, 0xE4,
-	0x01, 0x6F, 0xFF, 0xE4, 0x01, 0x70, 0xFF, 0xEB, 0x03, 0xD0, 0xFF, 0xE9, 0x03, 0xDC, 0xFF, 0xE2,
-	0x03, 0xDD, 0xFF, 0xE4, 0x04, 0x10, 0xFF, 0xE4, 0x04, 0x1E, 0xFF, 0xE4, 0x04, 0x2E, 0xFF, 0xE9,
-	0x04, 0x30, 0xFF, 0xE9, 0x04, 0x32, 0xFF, 0xE9, 0x04, 0x92, 0xFF, 0xE2, 0x00, 0x1F, 0x00, 0xD2,
-	0xFF, 0xE3, 0x00, 0xD4, 0xFF, 0xE5, 0x00, 0xD6, 0xFF, 0xE3, 0x00, 0xD9, 0xFF, 0xE2, 0x00, 0xDA,
-	0xFF, 0xE5, 0x00, 0xDD, 0xFF, 0xE5, 0x00, 0xDE, 0xFF, 0xE9, 0x00, 0xF2, 0xFF, 0xEA, 0x01, 0x04,
-	0xFF, 0xEA, 0x01, 0x33, 0xFF, 0xE5, 0x01, 0x39, 0xFF, 0xE3, 0x01, 0x43, 0xFF, 0xE5, 0x01, 0x45,
-	0xFF, 0xE3, 0x01, 0x50, 0xFF, 0xE5, 0x01, 0x51, 0xFF, 0xEA, 0x01, 0x5D, 0xFF, 0xE5, 0x01, 0x66,
-	0xFF, 0xE5, 0x01, 0x6C, 0xFF, 0xE4, 0x01, 0x6F, 0xFF, 0xE5, 0x01, 0x70, 0xFF, 0xEA, 0x03, 0xD0,
-	0xFF, 0xE9, 0x03, 0xDC, 0xFF, 0xE3, 0x03, 0xDD, 0xFF, 0xE5, 0x04, 0x0D, 0xFF, 0xE4, 0x04, 0x10,
-	0xFF, 0xE5, 0x04, 0x1E, 0xFF, 0xE5, 0x04, 0x2E, 0xFF, 0xE9, 0x04, 0x30, 0xFF, 0xE9, 0x04, 0x32,
-	0xFF, 0xE9, 0x04, 0x92, 0xFF, 0xE3, 0x04, 0xA1, 0xFF, 0xE4, 0x00, 0x0A, 0x00, 0xE6, 0xFF, 0xC3,
-	0x00, 0xF6, 0xFF, 0xCF, 0x00, 0xFE, 0x00, 0x00, 0x01, 0x3A, 0xFF, 0xCE, 0x01, 0x49, 0xFF, 0xE7,
-	0x01, 0x4C, 0xFF, 0xDF, 0x01, 0x62, 0xFF, 0xD1, 0x01, 0x64, 0xFF, 0xEC, 0x01, 0x6C, 0xFF, 0xA0,
-	0x01, 0x6D, 0xFF, 0xD1, 0x00, 0x1F, 0x00, 0x06, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0xDE,
-	0xFF, 0xEB, 0x00, 0xE1, 0xFF, 0xE7, 0x00, 0xE6, 0xFF, 0xC3, 0x00, 0xF6, 0xFF, 0xCF, 0x00, 0xFE,
-	0x00, 0x00, 0x01, 0x19, 0xFF, 0xC8, 0x01, 0x3A, 0xFF, 0xCE, 0x01, 0x47, 0xFF, 0xE7, 0x01, 0x49,
-	0xFF, 0xE7, 0x01, 0x4C, 0xFF, 0xDF, 0x01, 0x62, 0xFF, 0xD1, 0x01, 0x64, 0xFF, 0xEC, 0x01, 0x6C,
-	0xFF, 0xA0, 0x01, 0x6D, 0xFF, 0xD1, 0x01, 0x84, 0xFF, 0xC0, 0x01, 0x85, 0xFF, 0xC0, 0x01, 0x87,
-	0xFF, 0xC0, 0x01, 0x88, 0xFF, 0xC0, 0x01, 0x89, 0xFF, 0xC0, 0x03, 0xD0, 0xFF, 0xEB, 0x03, 0xF6,
-	0xFF, 0xC0, 0x03, 0xF7, 0xFF, 0xC0, 0x03, 0xFA, 0xFF, 0xC0, 0x04, 0x05, 0xFF, 0xC8, 0x04, 0x2E,
-	0xFF, 0xEB, 0x04, 0x30, 0xFF, 0xEB, 0x04, 0x32, 0xFF, 0xEB, 0x04, 0x34, 0xFF, 0xE7, 0x04, 0x94,
-	0xFF, 0xE7, 0x00, 0x3A, 0x00, 0xB2, 0x00, 0x0F, 0x00, 0xD2, 0xFF, 0xE6, 0x00, 0xD4, 0x00, 0x0E,
-	0x00, 0xD6, 0xFF, 0xE6, 0x00, 0xD9, 0x00, 0x13, 0x00, 0xDA, 0x00, 0x0E, 0x00, 0xDD, 0x00, 0x0E,
-	0x00, 0xDE, 0x00, 0x0B, 0x00, 0xE1, 0xFF, 0xE5, 0x00, 0xE6, 0xFF, 0xE6, 0x00, 0xE7, 0xFF, 0xF4,
-	0x00, 0xED, 0x00, 0x12, 0x00, 0xF2, 0x00, 0x0F, 0x00, 0xF6, 0xFF, 0xE7, 0x00, 0xF9, 0xFF, 0xE8,
-	0x00, 0xFE, 0x00, 0x00, 0x01, 0x04, 0x00, 0x0F, 0x01, 0x0D, 0x00, 0x0F, 0x01, 0x19, 0xFF, 0xE6,
-	0x01, 0x33, 0x00, 0x0E, 0x01, 0x39, 0xFF, 0xE6, 0x01, 0x3A, 0xFF, 0xE7, 0x01, 0x43, 0x00, 0x0E,
-	0x01, 0x45, 0xFF, 0xE6, 0x01, 0x47, 0xFF, 0xE5, 0x01, 0x48, 0xFF, 0xE8, 0x01, 0x49, 0xFF, 0xE5,
-	0x01, 0x4A, 0xFF, 0xE8, 0x01, 0x4C, 0xFF, 0xE4, 0x01, 0x50, 0x00, 0x0E, 0x01, 0x51, 0x00, 0x0F,
-	0x01, 0x5D, 0x00, 0x0E, 0x01, 0x62, 0xFF, 0xE6, 0x01, 0x64, 0xFF, 0xE6, 0x01, 0x66, 0x00, 0x0E,
-	0x01, 0x6C, 0xFF, 0xE6, 0x01, 0x6D, 0xFF, 0xE7, 0x01, 0x6F, 0x00, 0x0E, 0x01, 0x70, 0x00, 0x0F,
-	0x03, 0xD0, 0x00, 0x0B, 0x03, 0xD1, 0x00, 0x0F, 0x03, 0xDC, 0xFF, 0xE6, 0x03, 0xDD, 0x00, 0x0E,
-	0x04, 0x05, 0xFF, 0xE6, 0x04, 0x0D, 0xFF, 0xE6, 0x04, 0x10, 0x00, 0x0E, 0x04, 0x13, 0x00, 0x0F,
-	0x04, 0x15, 0x00, 0x0F, 0x04, 0x1E, 0x00, 0x0E, 0x04, 0x2E, 0x00, 0x0B, 0x04, 0x30, 0x00, 0x0B,
-	0x04, 0x32, 0x00, 0x0B, 0x04, 0x34, 0xFF, 0xE5, 0x04, 0x35, 0xFF, 0xE8, 0x04, 0x92, 0xFF, 0xE6,
-	0x04, 0x94, 0xFF, 0xE5, 0x04, 0x95, 0xFF, 0xE8, 0x04, 0xA1, 0xFF, 0xE6, 0x00, 0x12, 0x00, 0xD9,
-	0xFF, 0xAE, 0x00, 0xE6, 0x00, 0x12, 0x00, 0xEB, 0xFF, 0xE0, 0x00, 0xED, 0xFF, 0xAD, 0x00, 0xEF,
-	0xFF, 0xD6, 0x00, 0xFD, 0xFF, 0xDF, 0x01, 0x01, 0xFF, 0xD2, 0x01, 0x07, 0xFF, 0xE0, 0x01, 0x1C,
-	0xFF, 0xCE, 0x01, 0x2E, 0xFF, 0xDD, 0x01, 0x30, 0xFF, 0xE2, 0x01, 0x38, 0xFF, 0xE0, 0x01, 0x40,
-	0xFF, 0xE0, 0x01, 0x4A, 0xFF, 0xE9, 0x01, 0x4D, 0xFF, 0xDA, 0x01, 0x5F, 0xFF, 0xBD, 0x01, 0x69,
-	0xFF, 0xDF, 0x01, 0x6C, 0x00, 0x11, 0x00, 0x20, 0x00, 0x1B, 0xFF, 0xF2, 0x00, 0xD2, 0xFF, 0xF1,
-	0x00, 0xD4, 0xFF, 0xF5, 0x00, 0xD6, 0xFF, 0xF1, 0x00, 0xDA, 0xFF, 0xF4, 0x00, 0xDD, 0xFF, 0xF5,
-	0x00, 0xDE, 0xFF, 0xF3, 0x00, 0xE6, 0xFF, 0xF1, 0x01, 0x19, 0xFF, 0xF4, 0x01, 0x33, 0xFF, 0xF4,
-	0x01, 0x39, 0xFF, 0xF1, 0x01, 0x43, 0xFF, 0xF4, 0x01, 0x45, 0xFF, 0xF1, 0x01, 0x50, 0xFF, 0xF5,
-	0x01, 0x5D, 0xFF, 0xF4, 0x01, 0x62, 0xFF, 0xF2, 0x01, 0x64, 0xFF, 0xF2, 0x01, 0x66, 0xFF, 0xF5,
-	0x01, 0x6C, 0xFF, 0xF2, 0x01, 0x6F, 0xFF, 0xF5, 0x03, 0xD0, 0xFF, 0xF3, 0x03, 0xDC, 0xFF, 0xF1,
-	0x03, 0xDD, 0xFF, 0xF4, 0x04, 0x05, 0xFF, 0xF4, 0x04, 0x0D, 0xFF, 0xF0, 0x04, 0x10, 0xFF, 0xF4,
-	0x04, 0x1E, 0xFF, 0xF4, 0x04, 0x2E, 0xFF, 0xF3, 0x04, 0x30, 0xFF, 0xF3, 0x04, 0x32, 0xFF, 0xF3,
-	0x04, 0x92, 0xFF, 0xF1, 0x04, 0xA1, 0xFF, 0xF0, 0x00, 0x0C, 0x00, 0xD9, 0x00, 0x12, 0x00, 0xEA,
-	0xFF, 0xE9, 0x00, 0xF6, 0xFF, 0xD7, 0x01, 0x3A, 0xFF, 0xD7, 0x01, 0x4A, 0xFF, 0xD3, 0x01, 0x4C,
-	0xFF, 0xD6, 0x01, 0x4D, 0xFF, 0xC5, 0x01, 0x58, 0xFF, 0xE7, 0x01, 0x62, 0x00, 0x0D, 0x01, 0x64,
-	0x00, 0x0C, 0x01, 0x6D, 0xFF, 0xD6, 0x01, 0x6E, 0xFF, 0xF2, 0x00, 0x3B, 0x00, 0xB2, 0x00, 0x10,
-	0x00, 0xD2, 0xFF, 0xE0, 0x00, 0xD3, 0xFF, 0xE8, 0x00, 0xD4, 0x00, 0x10, 0x00, 0xD6, 0xFF, 0xE0,
-	0x00, 0xD9, 0x00, 0x14, 0x00, 0xDD, 0x00, 0x10, 0x00, 0xE1, 0xFF, 0xE1, 0x00, 0xE6, 0xFF, 0xE0,
-	0x00, 0xED, 0x00, 0x13, 0x00, 0xF2, 0x00, 0x10, 0x00, 0xF9, 0xFF, 0xE0, 0x01, 0x04, 0x00, 0x10,
-	0x01, 0x08, 0xFF, 0xE8, 0x01, 0x0D, 0x00, 0x10, 0x01, 0x17, 0xFF, 0xE8, 0x01, 0x19, 0xFF, 0xE0,
-	0x01, 0x1B, 0xFF, 0xE8, 0x01, 0x1D, 0xFF, 0xE8, 0x01, 0x1F, 0xFF, 0xE8, 0x01, 0x21, 0xFF, 0xE8,
-	0x01, 0x39, 0xFF, 0xE0, 0x01, 0x41, 0xFF, 0xE8, 0x01, 0x45, 0xFF, 0xE0, 0x01, 0x47, 0xFF, 0xE1,
-	0x01, 0x48, 0xFF, 0xE0, 0x01, 0x49, 0xFF, 0xE1, 0x01, 0x4A, 0xFF, 0xE0, 0x01, 0x4D, 0xFF, 0xE1,
-	0x01, 0x50, 0x00, 0x10, 0x01, 0x51, 0x00, 0x10, 0x01, 0x58, 0xFF, 0xE9, 0x01, 0x62, 0xFF, 0xDF,
-	0x01, 0x64, 0xFF, 0xDE, 0x01, 0x66, 0x00, 0x10, 0x01, 0x6A, 0xFF, 0xE8, 0x01, 0x6C, 0xFF, 0xDF,
-	0x01, 0x6E, 0xFF, 0xF2, 0x01, 0x6F, 0x00, 0x10, 0x01, 0x70, 0x00, 0x10, 0x03, 0xD1, 0x00, 0x10,
-	0x03, 0xD8, 0xFF, 0xE8, 0x03, 0xDB, 0xFF, 0xE8, 0x03, 0xDC, 0xFF, 0xE0, 0x04, 0x05, 0xFF, 0xE0,
-	0x04, 0x08, 0xFF, 0xE8, 0x04, 0x0B, 0xFF, 0xE8, 0x04, 0x0D, 0xFF, 0xDF, 0x04, 0x13, 0x00, 0x10,
-	0x04, 0x15, 0x00, 0x10, 0x04, 0x26, 0xFF, 0xE8, 0x04, 0x28, 0xFF, 0xE8, 0x04, 0x2A, 0xFF, 0xE8,
-	0x04, 0x34, 0xFF, 0xE1, 0x04, 0x35, 0xFF, 0xE0, 0x04, 0x92, 0xFF, 0xE0, 0x04, 0x94, 0xFF, 0xE1,
-	0x04, 0x95, 0xFF, 0xE0, 0x04, 0xA1, 0xFF, 0xDF, 0x00, 0x46, 0x00, 0xD2, 0xFF, 0xE6, 0x00, 0xD6,
-	0xFF, 0xE6, 0x00, 0xDA, 0xFF, 0xF2, 0x00, 0xDE, 0xFF, 0xEE, 0x00, 0xE1, 0xFF, 0xE8, 0x00, 0xE6,
-	0xFF, 0xE6, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xEE, 0xFF, 0xF1, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF1,
-	0x00, 0x00, 0x00, 0xF3, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0xF6,
-	0xFF, 0xD0, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0xFE,
-	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x01, 0x19, 0xFF, 0xE7, 0x01, 0x2B,
-	0x00, 0x00, 0x01, 0x33, 0xFF, 0xF2, 0x01, 0x34, 0xFF, 0xF1, 0x01, 0x36, 0x00, 0x00, 0x01, 0x39,
-	0xFF, 0xE6, 0x01, 0x3A, 0xFF, 0xCE, 0x01, 0x3C, 0x00, 0x00, 0x01, 0x3E, 0x00, 0x00, 0x01, 0x43,
-	0xFF, 0xF2, 0x01, 0x44, 0xFF, 0xF1, 0x01, 0x45, 0xFF, 0xE6, 0x01, 0x47, 0xFF, 0xE8, 0x01, 0x49,
-	0xFF, 0xE8, 0x01, 0x53, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0x57, 0x00, 0x00, 0x01, 0x5C,
-	0x00, 0x00, 0x01, 0x5D, 0xFF, 0xF2, 0x01, 0x5E, 0xFF, 0xF1, 0x01, 0x62, 0xFF, 0xE7, 0x01, 0x64,
-	0xFF, 0xED, 0x01, 0x6C, 0xFF, 0xE6, 0x01, 0x6D, 0xFF, 0xD0, 0x03, 0xD0, 0xFF, 0xEE, 0x03, 0xDC,
-	0xFF, 0xE6, 0x03, 0xDD, 0xFF, 0xF2, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE2, 0x00, 0x00, 0x03, 0xE5,
-	0xFF, 0xF1, 0x03, 0xE7, 0x00, 0x00, 0x03, 0xEC, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x04, 0x05,
-	0xFF, 0xE7, 0x04, 0x0D, 0xFF, 0xE7, 0x04, 0x10, 0xFF, 0xF2, 0x04, 0x11, 0xFF, 0xF1, 0x04, 0x1E,
-	0xFF, 0xF2, 0x04, 0x1F, 0xFF, 0xF1, 0x04, 0x23, 0x00, 0x00, 0x04, 0x25, 0x00, 0x00, 0x04, 0x2E,
-	0xFF, 0xEE, 0x04, 0x30, 0xFF, 0xEE, 0x04, 0x32, 0xFF, 0xEE, 0x04, 0x34, 0xFF, 0xE8, 0x04, 0x37,
-	0x00, 0x00, 0x04, 0x92, 0xFF, 0xE6, 0x04, 0x94, 0xFF, 0xE8, 0x04, 0x97, 0x00, 0x00, 0x04, 0xA1,
-	0xFF, 0xE7, 0x00, 0x08, 0x00, 0xD9, 0x00, 0x15, 0x00, 0xED, 0x00, 0x15, 0x01, 0x49, 0xFF, 0xE4,
-	0x01, 0x4A, 0xFF, 0xE5, 0x01, 0x4C, 0xFF, 0xE4, 0x01, 0x62, 0xFF, 0xE3, 0x01, 0x64, 0xFF, 0xE2,
-	0x01, 0x6C, 0xFF, 0xE4, 0x00, 0x33, 0x00, 0xD2, 0xFF, 0xBE, 0x00, 0xD6, 0xFF, 0xBE, 0x00, 0xE6,
-	0xFF, 0xC9, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF1, 0x00, 0x00, 0x00, 0xF3,
-	0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xDF, 0x00, 0xF8,
-	0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0x00,
-	0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x01, 0x09, 0xFF, 0xED, 0x01, 0x1A, 0xFF, 0xEF, 0x01, 0x20,
-	0xFF, 0xEB, 0x01, 0x2B, 0x00, 0x00, 0x01, 0x36, 0x00, 0x00, 0x01, 0x39, 0xFF, 0xBE, 0x01, 0x3A,
-	0xFF, 0xDF, 0x01, 0x3C, 0x00, 0x00, 0x01, 0x3E, 0x00, 0x00, 0x01, 0x45, 0xFF, 0xBE, 0x01, 0x4C,
-	0xFF, 0xE9, 0x01, 0x53, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0x57, 0x00, 0x00, 0x01, 0x5C,
-	0x00, 0x00, 0x01, 0x63, 0xFF, 0xF5, 0x01, 0x6D, 0xFF, 0xE0, 0x03, 0xDC, 0xFF, 0xBE, 0x03, 0xE0,
-	0x00, 0x00, 0x03, 0xE2, 0x00, 0x00, 0x03, 0xE4, 0xFF, 0xEF, 0x03, 0xE7, 0x00, 0x00, 0x03, 0xEC,
-	0x00, 0x00, 0x03, 0xED, 0xFF, 0xEF, 0x04, 0x02, 0x00, 0x00, 0x04, 0x06, 0xFF, 0xEF, 0x04, 0x0E,
-	0xFF, 0xEF, 0x04, 0x23, 0x00, 0x00, 0x04, 0x25, 0x00, 0x00, 0x04, 0x2F, 0xFF, 0xEF, 0x04, 0x31,
-	0xFF, 0xEF, 0x04, 0x33, 0xFF, 0xEF, 0x04, 0x37, 0x00, 0x00, 0x04, 0x92, 0xFF, 0xBE, 0x04, 0x97,
-	0x00, 0x00, 0x00, 0x51, 0x00, 0x06, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0xC0, 0x00, 0xD2, 0xFE, 0xF5,
-	0x00, 0xD6, 0xFE, 0xF5, 0x00, 0xDA, 0xFF, 0xF0, 0x00, 0xDE, 0xFF, 0xEB, 0x00, 0xE1, 0xFF, 0xE7,
-	0x00, 0xE6, 0xFF, 0xC3, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xEE, 0xFF, 0xC9, 0x00, 0xF0, 0x00, 0x00,
-	0x00, 0xF1, 0x00, 0x00, 0x00, 0xF3, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF5, 0x00, 0x00,
-	0x00, 0xF6, 0xFF, 0xCF, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00,
-	0x00, 0xFE, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x01, 0x19, 0xFF, 0xC8,
-	0x01, 0x2B, 0x00, 0x00, 0x01, 0x33, 0xFF, 0xF0, 0x01, 0x34, 0xFF, 0xC9, 0x01, 0x36, 0x00, 0x00,
-	0x01, 0x39, 0xFE, 0xF5, 0x01, 0x3A, 0xFF, 0xCE, 0x01, 0x3C, 0x00, 0x00, 0x01, 0x3E, 0x00, 0x00,
-	0x01, 0x43, 0xFF, 0xF0, 0x01, 0x44, 0xFF, 0xC9, 0x01, 0x45, 0xFE, 0xF5, 0x01, 0x47, 0xFF, 0xE7,
-	0x01, 0x49, 0xFF, 0xE7, 0x01, 0x4C, 0xFF, 0xDF, 0x01, 0x53, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00,
-	0x01, 0x57, 0x00, 0x00, 0x01, 0x5C, 0x00, 0x00, 0x01, 0x5D, 0xFF, 0xF0, 0x01, 0x5E, 0xFF, 0xC9,
-	0x01, 0x62, 0xFF, 0xD1, 0x01, 0x64, 0xFF, 0xEC, 0x01, 0x6C, 0xFF, 0xA0, 0x01, 0x6D, 0xFF, 0xD1,
-	0x01, 0x84, 0xFF, 0xC0, 0x01, 0x85, 0xFF, 0xC0, 0x01, 0x87, 0xFF, 0xC0, 0x01, 0x88, 0xFF, 0xC0,
-	0x01, 0x89, 0xFF, 0xC0, 0x03, 0xD0, 0xFF, 0xEB, 0x03, 0xDC, 0xFE, 0xF5, 0x03, 0xDD, 0xFF, 0xF0,
-	0x03, 0xE0, 0x00, 0x00, 0x03, 0xE2, 0x00, 0x00, 0x03, 0xE5, 0xFF, 0xC9, 0x03, 0xE7, 0x00, 0x00,
-	0x03, 0xEC, 0x00, 0x00, 0x03, 0xF6, 0xFF, 0xC0, 0x03, 0xF7, 0xFF, 0xC0, 0x03, 0xFA, 0xFF, 0xC0,
-	0x04, 0x02, 0x00, 0x00, 0x04, 0x05, 0xFF, 0xC8, 0x04, 0x0D, 0xFF, 0xAD, 0x04, 0x10, 0xFF, 0xF0,
-	0x04, 0x11, 0xFF, 0xC9, 0x04, 0x1E, 0xFF, 0xF0, 0x04, 0x1F, 0xFF, 0xC9, 0x04, 0x23, 0x00, 0x00,
-	0x04, 0x25, 0x00, 0x00, 0x04, 0x2E, 0xFF, 0xEB, 0x04, 0x30, 0xFF, 0xEB, 0x04, 0x32, 0xFF, 0xEB,
-	0x04, 0x34, 0xFF, 0xE7, 0x04, 0x37, 0x00, 0x00, 0x04, 0x92, 0xFE, 0xF5, 0x04, 0x94, 0xFF, 0xE7,
-	0x04, 0x97, 0x00, 0x00, 0x04, 0xA1, 0xFF, 0xAD, 0x00, 0x45, 0x00, 0xD2, 0xFE, 0xF5, 0x00, 0xD4,
-	0xFF, 0xF5, 0x00, 0xD6, 0xFE, 0xF5, 0x00, 0xDA, 0xFF, 0xF0, 0x00, 0xDD, 0xFF, 0xF5, 0x00, 0xDE,
-	0xFF, 0xEB, 0x00, 0xE1, 0xFF, 0xE7, 0x00, 0xE6, 0xFF, 0xC3, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xF0,
-	0x00, 0x00, 0x00, 0xF1, 0x00, 0x00, 0x00, 0xF3, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xF5,
-	0x00, 0x00, 0x00, 0xF6, 0xFF, 0xCF, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0xFB,
-	0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x01, 0x19,
-	0xFF, 0xC8, 0x01, 0x2B, 0x00, 0x00, 0x01, 0x33, 0xFF, 0xF0, 0x01, 0x36, 0x00, 0x00, 0x01, 0x39,
-	0xFE, 0xF5, 0x01, 0x3A, 0xFF, 0xCE, 0x01, 0x3C, 0x00, 0x00, 0x01, 0x3E, 0x00, 0x00, 0x01, 0x43,
-	0xFF, 0xF0, 0x01, 0x45, 0xFE, 0xF5, 0x01, 0x47, 0xFF, 0xE7, 0x01, 0x49, 0xFF, 0xE7, 0x01, 0x4C,
-	0xFF, 0xDF, 0x01, 0x50, 0xFF, 0xF5, 0x01, 0x53, 0x00, 0x00, 0x01, 0x55, 0x00, 0x00, 0x01, 0x57,
-	0x00, 0x00, 0x01, 0x5C, 0x00, 0x00, 0x01, 0x5D, 0xFF, 0xF0, 0x01, 0x62, 0xFF, 0xD1, 0x01, 0x64,
-	0xFF, 0xEC, 0x01, 0x66, 0xFF, 0xF5, 0x01, 0x6C, 0xFF, 0xA0, 0x01, 0x6D, 0xFF, 0xD1, 0x01, 0x6F,
-	0xFF, 0xF5, 0x03, 0xD0, 0xFF, 0xEB, 0x03, 0xDC, 0xFE, 0xF5, 0x03, 0xDD, 0xFF, 0xF0, 0x03, 0xE0,
-	0x00, 0x00, 0x03, 0xE2, 0x00, 0x00, 0x03, 0xE7, 0x00, 0x00, 0x03, 0xEC, 0x00, 0x00, 0x04, 0x02,
-	0x00, 0x00, 0x04, 0x05, 0xFF, 0xC8, 0x04, 0x0D, 0xFF, 0xAD, 0x04, 0x10, 0xFF, 0xF0, 0x04, 0x1E,
-	0xFF, 0xF0, 0x04, 0x23, 0x00, 0x00, 0x04, 0x25, 0x00, 0x00, 0x04, 0x2E, 0xFF, 0xEB, 0x04, 0x30,
-	0xFF, 0xEB, 0x04, 0x32, 0xFF, 0xEB, 0x04, 0x34, 0xFF, 0xE7, 0x04, 0x37, 0x00, 0x00, 0x04, 0x92,
-	0xFE, 0xF5, 0x04, 0x94, 0xFF, 0xE7, 0x04, 0x97, 0x00, 0x00, 0x04, 0xA1, 0xFF, 0xAD, 0x00, 0x5B,
-	0x00, 0x06, 0xFF, 0xCA, 0x00, 0x0B, 0xFF, 0xCA, 0x00, 0xD2, 0xFF, 0xD2, 0x00, 0xD6, 0xFF, 0xD2,
-	0x00, 0xDA, 0xFF, 0xF4, 0x00, 0xDE, 0xFF, 0xED, 0x00, 0xE1, 0xFF, 0xE1, 0x00, 0xE6, 0xFF, 0xD4,
-	0x00, 0xEC, 0xFF, 0xD1, 0x00, 0xEE, 0xFF, 0xEF, 0x00, 0xF0, 0xFF, 0xD1, 0x00, 0xF1, 0xFF, 0xD1,
-	0x00, 0xF3, 0xFF, 0xD1, 0x00, 0xF4, 0xFF, 0xD1, 0x00, 0xF5, 0xFF, 0xD1, 0x00, 0xF6, 0xFF, 0xC9,
-	0x00, 0xF8, 0xFF, 0xD1, 0x00, 0xFA, 0xFF, 0xD1, 0x00, 0xFB, 0xFF, 0xD1, 0x00, 0xFE, 0xFF, 0xD1,
-	0x01, 0x00, 0xFF, 0xD1, 0x01, 0x05, 0xFF, 0xD1, 0x01, 0x09, 0xFF, 0xE5, 0x01, 0x19, 0xFF, 0xD4,
-	0x01, 0x1A, 0xFF, 0xE6, 0x01, 0x20, 0xFF, 0xE3, 0x01, 0x2B, 0xFF, 0xD1, 0x01, 0x33, 0xFF, 0xF4,
-	0x01, 0x34, 0xFF, 0xEF, 0x01, 0x36, 0xFF, 0xD1, 0x01, 0x39, 0xFF, 0xD2, 0x01, 0x3A, 0xFF, 0xC4,
-	0x01, 0x3C, 0xFF, 0xD1, 0x01, 0x3E, 0xFF, 0xD1, 0x01, 0x43, 0xFF, 0xF4, 0x01, 0x44, 0xFF, 0xEF,
-	0x01, 0x45, 0xFF, 0xD2, 0x01, 0x47, 0xFF, 0xE1, 0x01, 0x49, 0xFF, 0xE1, 0x01, 0x53, 0xFF, 0xD1,
-	0x01, 0x55, 0xFF, 0xD1, 0x01, 0x57, 0xFF, 0xD1, 0x01, 0x5C, 0xFF, 0xD1, 0x01, 0x5D, 0xFF, 0xF4,
-	0x01, 0x5E, 0xFF, 0xEF, 0x01, 0x62, 0xFF, 0xD4, 0x01, 0x63, 0xFF, 0xF5, 0x01, 0x64, 0xFF, 0xE7,
-	0x01, 0x6C, 0xFF, 0xD2, 0x01, 0x6D, 0xFF, 0xC9, 0x01, 0x84, 0xFF, 0xCA, 0x01, 0x85, 0xFF, 0xCA,
-	0x01, 0x87, 0xFF, 0xCA, 0x01, 0x88, 0xFF, 0xCA, 0x01, 0x89, 0xFF, 0xCA, 0x03, 0xD0, 0xFF, 0xED,
-	0x03, 0xDC, 0xFF, 0xD2, 0x03, 0xDD, 0xFF, 0xF4, 0x03, 0xE0, 0xFF, 0xD1, 0x03, 0xE2, 0xFF, 0xD1,
-	0x03, 0xE4, 0xFF, 0xE6, 0x03, 0xE5, 0xFF, 0xEF, 0x03, 0xE7, 0xFF, 0xD1, 0x03, 0xEC, 0xFF, 0xD1,
-	0x03, 0xED, 0xFF, 0xE6, 0x03, 0xF6, 0xFF, 0xCA, 0x03, 0xF7, 0xFF, 0xCA, 0x03, 0xFA, 0xFF, 0xCA,
-	0x04, 0x02, 0xFF, 0xD1, 0x04, 0x05, 0xFF, 0xD4, 0x04, 0x06, 0xFF, 0xE6, 0x04, 0x0D, 0xFF, 0xD3,
-	0x04, 0x0E, 0xFF, 0xE6, 0x04, 0x10, 0xFF, 0xF4, 0x04, 0x11, 0xFF, 0xEF, 0x04, 0x1E, 0xFF, 0xF4,
-	0x04, 0x1F, 0xFF, 0xEF, 0x04, 0x23, 0xFF, 0xD1, 0x04, 0x25, 0xFF, 0xD1, 0x04, 0x2E, 0xFF, 0xED,
-	0x04, 0x2F, 0xFF, 0xE6, 0x04, 0x30, 0xFF, 0xED, 0x04, 0x31, 0xFF, 0xE6, 0x04, 0x32, 0xFF, 0xED,
-	0x04, 0x33, 0xFF, 0xE6, 0x04, 0x34, 0xFF, 0xE1, 0x04, 0x37, 0xFF, 0xD1, 0x04, 0x92, 0xFF, 0xD2,
-	0x04, 0x94, 0xFF, 0xE1, 0x04, 0x97, 0xFF, 0xD1, 0x04, 0xA1, 0xFF, 0xD3, 0x00, 0x0D, 0x00, 0xD9,
-	0x00, 0x13, 0x00, 0xE6, 0xFF, 0xC5, 0x00, 0xF6, 0xFF, 0xCA, 0x01, 0x3A, 0xFF, 0x9F, 0x01, 0x49,
-	0xFF, 0x51, 0x01, 0x4A, 0xFF, 0x7B, 0x01, 0x4C, 0xFF, 0xCA, 0x01, 0x4D, 0xFF, 0xDD, 0x01, 0x58,
-	0xFF, 0xF2, 0x01, 0x62, 0xFF, 0x75, 0x01, 0x64, 0xFF, 0xCA, 0x01, 0x6C, 0xFF, 0x4F, 0x01, 0x6D,
-	0xFF, 0x8C, 0x00, 0x09, 0x00, 0xF6, 0x00, 0x00, 0x01, 0x1A, 0x00, 0x00, 0x03, 0xE4, 0x00, 0x00,
-	0x03, 0xED, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x04, 0x0E, 0x00, 0x00, 0x04, 0x2F, 0x00, 0x00,
-	0x04, 0x31, 0x00, 0x00, 0x04, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0xD9, 0x00, 0x00, 0x00, 0xE6,
-	0x00, 0x00, 0x01, 0x6C, 0x00, 0x00, 0x00, 0x01, 0x03, 0xCD, 0xFF, 0xEC, 0x00, 0x01, 0x03, 0xCD,
-	0xFF, 0xEE, 0x00, 0x04, 0x01, 0x19, 0x00, 0x14, 0x04, 0x05, 0x00, 0x14, 0x04, 0x0D, 0x00, 0x16,
-	0x04, 0xA1, 0x00, 0x16, 0x00, 0x06, 0x00, 0xD2, 0xFF, 0xD8, 0x00, 0xD6, 0xFF, 0xD8, 0x01, 0x39,
-	0xFF, 0xD8, 0x01, 0x45, 0xFF, 0xD8, 0x03, 0xDC, 0xFF, 0xD8, 0x04, 0x92, 0xFF, 0xD8, 0x00, 0x01,
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x0A, 0x00, 0x05, 0x00, 0x24, 0x00, 0x48,
-	0x00, 0x01, 0x00, 0xFA, 0x00, 0x08, 0x00, 0x0A, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17,
-	0x00, 0x18, 0x00, 0x19, 0x00, 0x1A, 0x00, 0x1B, 0x00, 0x1C, 0x00, 0x1D, 0x00, 0x25, 0x00, 0x26,
-	0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2A, 0x00, 0x2B, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x2E,
-	0x00, 0x2F, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36,
-	0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3A, 0x00, 0x3B, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E,
-	0x00, 0x65, 0x00, 0x67, 0x00, 0x81, 0x00, 0x83, 0x00, 0x84, 0x00, 0x8C, 0x00, 0x8F, 0x00, 0x91,
-	0x00, 0x93, 0x00, 0xB1, 0x00, 0xB2, 0x00, 0xB3, 0x00, 0xB4, 0x00, 0xB5, 0x00, 0xB6, 0x00, 0xB7,
-	0x00, 0xB8, 0x00, 0xB9, 0x00, 0xBA, 0x00, 0xD2, 0x00, 0xD3, 0x00, 0xD4, 0x00, 0xD5, 0x00, 0xD6,
-	0x00, 0xD7, 0x00, 0xD8, 0x00, 0xD9, 0x00, 0xDA, 0x00, 0xDB, 0x00, 0xDC, 0x00, 0xDD, 0x00, 0xDE,
-	0x00, 0xDF, 0x00, 0xE0, 0x00, 0xE1, 0x00, 0xE2, 0x00, 0xE3, 0x00, 0xE4, 0x00, 0xE5, 0x00, 0xE6,
-	0x00, 0xE7, 0x00, 0xE8, 0x00, 0xE9, 0x01, 0x2F, 0x01, 0x33, 0x01, 0x35, 0x01, 0x37, 0x01, 0x39,
-	0x01, 0x3B, 0x01, 0x41, 0x01, 0x43, 0x01, 0x45, 0x01, 0x49, 0x01, 0x4B, 0x01, 0x4C, 0x01, 0x58,
-	0x01, 0x59, 0x01, 0xB1, 0x01, 0xB7, 0x01, 0xBC, 0x01, 0xBF, 0x02, 0x95, 0x02, 0x96, 0x02, 0x98,
-	0x02, 0x9A, 0x02, 0x9B, 0x02, 0x9C, 0x02, 0x9D, 0x02, 0x9E, 0x02, 0x9F, 0x02, 0xA0, 0x02, 0xA1,
-	0x02, 0xA2, 0x02, 0xA3, 0x02, 0xA4, 0x02, 0xA5, 0x02, 0xA6, 0x02, 0xA7, 0x02, 0xA8, 0x02, 0xA9,
-	0x02, 0xAA, 0x02, 0xAB, 0x02, 0xAC, 0x02, 0xAD, 0x02, 0xAE, 0x02, 0xAF, 0x02, 0xB0, 0x02, 0xB1,
-	0x02, 0xB2, 0x02, 0xB3, 0x02, 0xB4, 0x02, 0xD1, 0x02, 0xD3, 0x02, 0xD5, 0x02, 0xD7, 0x02, 0xD9,
-	0x02, 0xDB, 0x02, 0xDD, 0x02, 0xDF, 0x02, 0xE1, 0x02, 0xE3, 0x02, 0xE5, 0x02, 0xE7, 0x02, 0xE9,
-	0x02, 0xEB, 0x02, 0xED, 0x02, 0xEF, 0x02, 0xF1, 0x02, 0xF3, 0x02, 0xF5, 0x02, 0xF7, 0x02, 0xF9,
-	0x02, 0xFB, 0x02, 0xFD, 0x02, 0xFE, 0x03, 0x00, 0x03, 0x02, 0x03, 0x04, 0x03, 0x06, 0x03, 0x08,
-	0x03, 0x0A, 0x03, 0x0C, 0x03, 0x0E, 0x03, 0x10, 0x03, 0x13, 0x03, 0x15, 0x03, 0x17, 0x03, 0x19,
-	0x03, 0x1B, 0x03, 0x1D, 0x03, 0x1F, 0x03, 0x21, 0x03, 0x23, 0x03, 0x25, 0x03, 0x27, 0x03, 0x29,
-	0x03, 0x2B, 0x03, 0x2D, 0x03, 0x2F, 0x03, 0x31, 0x03, 0x33, 0x03, 0x35, 0x03, 0x37, 0x03, 0x39,
-	0x03, 0x3B, 0x03, 0x3D, 0x03, 0x3F, 0x03, 0x40, 0x03, 0x42, 0x03, 0x44, 0x03, 0x46, 0x03, 0x48,
-	0x03, 0xA1, 0x03, 0xA2, 0x03, 0xA3, 0x03, 0xA4, 0x03, 0xA5, 0x03, 0xA6, 0x03, 0xA7, 0x03, 0xA9,
-	0x03, 0xAA, 0x03, 0xAB, 0x03, 0xAC, 0x03, 0xAD, 0x03, 0xAE, 0x03, 0xAF, 0x03, 0xB0, 0x03, 0xB1,
-	0x03, 0xB2, 0x03, 0xB3, 0x03, 0xB4, 0x03, 0xB5, 0x03, 0xB6, 0x03, 0xB7, 0x03, 0xB8, 0x03, 0xC8,
-	0x03, 0xC9, 0x03, 0xCA, 0x03, 0xCB, 0x03, 0xCC, 0x03, 0xCD, 0x03, 0xCE, 0x03, 0xCF, 0x03, 0xD0,
-	0x03, 0xD1, 0x03, 0xD2, 0x03, 0xD3, 0x03, 0xD4, 0x03, 0xD5, 0x03, 0xD6, 0x03, 0xD7, 0x03, 0xD8,
-	0x03, 0xD9, 0x03, 0xDA, 0x03, 0xDB, 0x03, 0xDC, 0x03, 0xDD, 0x03, 0xEE, 0x03, 0xF0, 0x03, 0xF2,
-	0x03, 0xF4, 0x04, 0x09, 0x04, 0x0B, 0x04, 0x0D, 0x04, 0x22, 0x04, 0x28, 0x04, 0x2E, 0x04, 0x98,
-	0x04, 0x9D, 0x04, 0xA1, 0x05, 0x22, 0x05, 0x24, 0x00, 0x06, 0x00, 0x64, 0x00, 0x00, 0x03, 0x28,
-	0x05, 0xB0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00,
-	0x41, 0x15, 0x21, 0x35, 0x33, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x13, 0x15, 0x21, 0x35,
-	0x01, 0x01, 0x23, 0x01, 0x11, 0x01, 0x33, 0x01, 0x03, 0x09, 0xFD, 0x76, 0x1B, 0x36, 0x02, 0xC4,
-	0x36, 0x17, 0xFD, 0x76, 0x02, 0x8A, 0xFD, 0xAF, 0x3A, 0x02, 0x51, 0xFD, 0xAF, 0x3A, 0x02, 0x51,
-	0x05, 0xB0, 0x36, 0x36, 0xFA, 0x50, 0x05, 0xB0, 0xFA, 0x50, 0x05, 0xB0, 0xFA, 0x86, 0x36, 0x36,
-	0x05, 0x5C, 0xFA, 0x8C, 0x05, 0x74, 0xFA, 0x8C, 0x05, 0x74, 0xFA, 0x8C, 0x00, 0x02, 0x00, 0xA1,
-	0xFF, 0xF4, 0x01, 0x7C, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x13, 0x40, 0x09, 0x02, 0x02,
-	0x07, 0x0D, 0x0B, 0x72, 0x00, 0x02, 0x72, 0x00, 0x2B, 0x2B, 0xDD, 0xCE, 0x2F, 0x30, 0x31, 0x41,
-	0x03, 0x23, 0x03, 0x03, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x01,
-	0x69, 0x0D, 0xA7, 0x0E, 0x06, 0x37, 0x36, 0x35, 0x39, 0x39, 0x35, 0x36, 0x37, 0x05, 0xB0, 0xFB,
-	0xEB, 0x04, 0x15, 0xFA, 0xAD, 0x2D, 0x3E, 0x3E, 0x2D, 0x2B, 0x3E, 0x3E, 0x00, 0x02, 0x00, 0x89,
-	0x04, 0x13, 0x02, 0x24, 0x06, 0x00, 0x00, 0x05, 0x00, 0x0B, 0x00, 0x0C, 0xB3, 0x09, 0x03, 0x0B,
-	0x05, 0x00, 0x2F, 0x33, 0xCD, 0x32, 0x30, 0x31, 0x41, 0x15, 0x03, 0x23, 0x11, 0x35, 0x21, 0x15,
-	0x03, 0x23, 0x11, 0x35, 0x01, 0x16, 0x1E, 0x6F, 0x01, 0x9B, 0x1E, 0x6F, 0x06, 0x00, 0x88, 0xFE,
-	0x9B, 0x01, 0x5C, 0x91, 0x88, 0xFE, 0x9B, 0x01, 0x63, 0x8A, 0x00, 0x04, 0x00, 0x77, 0x00, 0x00,
-	0x04, 0xD3, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x23, 0x40, 0x11,
-	0x04, 0x00, 0x05, 0x0D, 0x0E, 0x0E, 0x00, 0x0A, 0x09, 0x09, 0x00, 0x02, 0x02, 0x72, 0x00, 0x12,
-	0x72, 0x00, 0x2B, 0x2B, 0x11, 0x39, 0x2F, 0x33, 0x11, 0x39, 0x2F, 0x33, 0x32, 0x11, 0x33, 0x30,
-	0x31, 0x61, 0x01, 0x33, 0x01, 0x21, 0x01, 0x33, 0x01, 0x01, 0x21, 0x35, 0x21, 0x03, 0x21, 0x35,
-	0x21, 0x01, 0x17, 0x01, 0x1B, 0x90, 0xFE, 0xE4, 0x01, 0x08, 0x01, 0x1C, 0x8F, 0xFE, 0xE4, 0x01,
-	0x96, 0xFB, 0xF0, 0x04, 0x10, 0x4B, 0xFB, 0xEF, 0x04, 0x11, 0x05, 0xB0, 0xFA, 0x50, 0x05, 0xB0,
-	0xFA, 0x50, 0x03, 0x85, 0x8B, 0xFD, 0x8A, 0x8A, 0x00, 0x03, 0x00, 0x6E, 0xFF, 0x30, 0x04, 0x12,
-	0x06, 0x9C, 0x00, 0x03, 0x00, 0x07, 0x00, 0x3D, 0x00, 0x36, 0x40, 0x1C, 0x04, 0x07, 0x3A, 0x3A,
-	0x08, 0x2B, 0x10, 0x23, 0x04, 0x14, 0x2F, 0x35, 0x35, 0x06, 0x2F, 0x0D, 0x72, 0x01, 0x02, 0x1F,
-	0x1F, 0x14, 0x1A, 0x1A, 0x03, 0x14, 0x05, 0x72, 0x00, 0x2B, 0xCD, 0x33, 0x2F, 0x11, 0x33, 0x12,
-	0x39, 0x39, 0x2B, 0xCD, 0x33, 0x2F, 0x11, 0x12, 0x17, 0x39, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31,
-	0x41, 0x11, 0x23, 0x11, 0x13, 0x11, 0x23, 0x11, 0x01, 0x34, 0x26, 0x26, 0x27, 0x2E, 0x02, 0x35,
-	0x34, 0x36, 0x36, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x23, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06,
-	0x15, 0x14, 0x16, 0x16, 0x17, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x2E, 0x02, 0x35,
-	0x33, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x02, 0xA2, 0x96, 0x84, 0x95, 0x01, 0x5D, 0x36,
-	0x7C, 0x68, 0x7E, 0xB7, 0x63, 0x6A, 0xC2, 0x83, 0x66, 0xA0, 0x6F, 0x3B, 0xB8, 0x20, 0x40, 0x5C,
-	0x3C, 0x54, 0x6D, 0x34, 0x34, 0x7D, 0x6E, 0x81, 0xB4, 0x5E, 0x74, 0xD2, 0x8D, 0x55, 0xA6, 0x86,
-	0x50, 0xBA, 0x31, 0x52, 0x63, 0x31, 0x5A, 0x7D, 0x42, 0x06, 0x9C, 0xFE, 0xCF, 0x01, 0x31, 0xF9,
-	0x9F, 0xFE, 0xF5, 0x01, 0x0B, 0x01, 0x3C, 0x3C, 0x60, 0x50, 0x22, 0x27, 0x70, 0xA6, 0x76, 0x7B,
-	0xB2, 0x60, 0x3D, 0x78, 0xAE, 0x72, 0x43, 0x70, 0x53, 0x2D, 0x3A, 0x69, 0x45, 0x40, 0x60, 0x4D,
-	0x25, 0x29, 0x6F, 0xA1, 0x77, 0x81, 0xB1, 0x5C, 0x2E, 0x69, 0xAD, 0x7E, 0x55, 0x6F, 0x41, 0x1B,
-	0x39, 0x6A, 0x00, 0x05, 0x00, 0x69, 0xFF, 0xEB, 0x05, 0x83, 0x05, 0xC5, 0x00, 0x11, 0x00, 0x23,
-	0x00, 0x35, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x23, 0x40, 0x11, 0x49, 0x32, 0x4B, 0x05, 0x3B, 0x44,
-	0x29, 0x32, 0x17, 0x0E, 0x20, 0x05, 0x05, 0x72, 0x32, 0x0D, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0xC4,
-	0x32, 0x10, 0xC4, 0x32, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x53, 0x35, 0x34, 0x36, 0x36,
-	0x33, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14,
-	0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x01,
-	0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26,
-	0x26, 0x37, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23,
-	0x22, 0x06, 0x06, 0x13, 0x01, 0x27, 0x01, 0x69, 0x48, 0x86, 0x5C, 0x5E, 0x85, 0x48, 0x47, 0x85,
-	0x5D, 0x5D, 0x87, 0x48, 0x8B, 0x23, 0x48, 0x36, 0x36, 0x46, 0x22, 0x23, 0x47, 0x36, 0x35, 0x47,
-	0x23, 0x02, 0x3A, 0x48, 0x86, 0x5C, 0x5E, 0x85, 0x48, 0x47, 0x85, 0x5D, 0x5D, 0x86, 0x49, 0x8B,
-	0x23, 0x48, 0x36, 0x36, 0x47, 0x22, 0x23, 0x47, 0x37, 0x35, 0x47, 0x23, 0xCD, 0xFD, 0x39, 0x68,
-	0x02, 0xC7, 0x04, 0x4B, 0x4D, 0x53, 0x88, 0x52, 0x52, 0x88, 0x53, 0x4D, 0x51, 0x88, 0x52, 0x52,
-	0x88, 0x9E, 0x4D, 0x2E, 0x52, 0x33, 0x33, 0x52, 0x2E, 0x4D, 0x2F, 0x53, 0x33, 0x33, 0x53, 0xFC,
-	0x50, 0x4E, 0x52, 0x88, 0x52, 0x52, 0x88, 0x52, 0x4E, 0x52, 0x88, 0x52, 0x52, 0x88, 0xA0, 0x4E,
-	0x2E, 0x53, 0x33, 0x33, 0x52, 0x2F, 0x4E, 0x2F, 0x52, 0x33, 0x33, 0x52, 0x03, 0x4D, 0xFB, 0x8E,
-	0x42, 0x04, 0x72, 0x00, 0x00, 0x01, 0x00, 0x66, 0xFF, 0xEC, 0x04, 0xF3, 0x05, 0xC4, 0x00, 0x42,
-	0x00, 0x24, 0x40, 0x14, 0x23, 0x12, 0x00, 0x0F, 0x22, 0x01, 0x06, 0x1A, 0x30, 0x30, 0x2B, 0x11,
-	0x11, 0x3B, 0x13, 0x72, 0x07, 0x1A, 0x03, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x2F, 0x32, 0x32,
-	0x2F, 0x11, 0x17, 0x39, 0x30, 0x31, 0x41, 0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
-	0x06, 0x15, 0x14, 0x16, 0x16, 0x17, 0x01, 0x23, 0x01, 0x2E, 0x02, 0x35, 0x34, 0x36, 0x36, 0x33,
-	0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x05, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33,
-	0x32, 0x3E, 0x02, 0x35, 0x33, 0x14, 0x06, 0x06, 0x07, 0x06, 0x06, 0x07, 0x06, 0x06, 0x23, 0x22,
-	0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x01, 0x9A, 0xDA, 0x3F, 0x45, 0x5C, 0x54, 0x3A, 0x50, 0x28,
-	0x2C, 0x4E, 0x32, 0x02, 0xB1, 0xDE, 0xFD, 0xCB, 0x4B, 0x76, 0x43, 0x5B, 0xA4, 0x6E, 0x6B, 0x9B,
-	0x54, 0x32, 0x59, 0x3B, 0xFE, 0xDF, 0x48, 0x42, 0x13, 0x3E, 0x7F, 0x60, 0x54, 0x9F, 0x7E, 0x4B,
-	0xA6, 0x26, 0x4F, 0x3D, 0x09, 0x0A, 0x09, 0x4B, 0xDB, 0x6E, 0x91, 0xD3, 0x72, 0x4F, 0x8B, 0x03,
-	0x28, 0x9B, 0x2B, 0x57, 0x4C, 0x3B, 0x61, 0x36, 0x59, 0x35, 0x2D, 0x60, 0x68, 0x3A, 0xFC, 0xC6,
-	0x02, 0xA4, 0x58, 0x93, 0x8A, 0x4A, 0x72, 0x9D, 0x52, 0x55, 0x8B, 0x53, 0x46, 0x6F, 0x5C, 0x2C,
-	0xD7, 0x35, 0x60, 0x4A, 0x16, 0x47, 0x76, 0x47, 0x4D, 0x8F, 0xC7, 0x79, 0x63, 0xB0, 0x97, 0x3E,
-	0x09, 0x18, 0x09, 0x51, 0x51, 0x6A, 0xBA, 0x78, 0x5C, 0x8C, 0x7A, 0x00, 0x00, 0x01, 0x00, 0x68,
-	0x04, 0x22, 0x00, 0xFE, 0x06, 0x00, 0x00, 0x05, 0x00, 0x08, 0xB1, 0x03, 0x05, 0x00, 0x2F, 0xC6,
-	0x30, 0x31, 0x53, 0x15, 0x03, 0x23, 0x13, 0x35, 0xFE, 0x15, 0x81, 0x01, 0x06, 0x00, 0x6E, 0xFE,
-	0x90, 0x01, 0x5F, 0x7F, 0x00, 0x01, 0x00, 0x86, 0xFE, 0x2A, 0x02, 0x96, 0x06, 0x6B, 0x00, 0x17,
-	0x00, 0x08, 0xB1, 0x06, 0x13, 0x00, 0x2F, 0x2F, 0x30, 0x31, 0x53, 0x35, 0x34, 0x12, 0x12, 0x36,
-	0x37, 0x17, 0x0E, 0x02, 0x02, 0x15, 0x15, 0x14, 0x12, 0x16, 0x16, 0x17, 0x07, 0x26, 0x26, 0x02,
-	0x02, 0x86, 0x62, 0x98, 0xA8, 0x47, 0x27, 0x3B, 0x79, 0x65, 0x3E, 0x3E, 0x65, 0x79, 0x3B, 0x27,
-	0x47, 0xA8, 0x98, 0x62, 0x02, 0x46, 0x0A, 0xDA, 0x01, 0x61, 0x01, 0x0A, 0xAF, 0x27, 0x7A, 0x2D,
-	0x9E, 0xE6, 0xFE, 0xD0, 0xBE, 0x0E, 0xBE, 0xFE, 0xCF, 0xE8, 0xA3, 0x30, 0x70, 0x27, 0xAF, 0x01,
-	0x09, 0x01, 0x62, 0x00, 0x00, 0x01, 0x00, 0x27, 0xFE, 0x2A, 0x02, 0x37, 0x06, 0x6B, 0x00, 0x17,
-	0x00, 0x08, 0xB1, 0x13, 0x06, 0x00, 0x2F, 0x2F, 0x30, 0x31, 0x41, 0x15, 0x14, 0x02, 0x02, 0x06,
-	0x07, 0x27, 0x3E, 0x02, 0x12, 0x35, 0x35, 0x34, 0x02, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16, 0x12,
-	0x12, 0x02, 0x37, 0x62, 0x98, 0xA8, 0x47, 0x27, 0x3B, 0x78, 0x66, 0x3E, 0x42, 0x69, 0x77, 0x35,
-	0x27, 0x47, 0xA8, 0x98, 0x62, 0x02, 0x50, 0x0A, 0xDB, 0xFE, 0x9E, 0xFE, 0xF7, 0xAF, 0x27, 0x70,
-	0x2D, 0xA1, 0xEB, 0x01, 0x33, 0xBE, 0x0E, 0xBE, 0x01, 0x33, 0xEA, 0xA1, 0x2C, 0x71, 0x27, 0xAF,
-	0xFE, 0xF6, 0xFE, 0x9F, 0x00, 0x01, 0x00, 0x1C, 0x02, 0x62, 0x03, 0x56, 0x05, 0xB1, 0x00, 0x0E,
-	0x00, 0x14, 0x40, 0x0A, 0x0D, 0x01, 0x07, 0x04, 0x04, 0x0E, 0x0C, 0x06, 0x02, 0x72, 0x00, 0x2B,
-	0xC4, 0x32, 0x17, 0x39, 0x30, 0x31, 0x53, 0x13, 0x25, 0x37, 0x05, 0x03, 0x33, 0x03, 0x25, 0x17,
-	0x05, 0x13, 0x07, 0x03, 0x03, 0x81, 0xC9, 0xFE, 0xD2, 0x2F, 0x01, 0x2E, 0x09, 0x98, 0x0A, 0x01,
-	0x2A, 0x2E, 0xFE, 0xCD, 0xC5, 0x7C, 0xB9, 0xB5, 0x02, 0xC4, 0x01, 0x14, 0x5A, 0x96, 0x6F, 0x01,
-	0x58, 0xFE, 0xA2, 0x6F, 0x99, 0x5B, 0xFE, 0xF1, 0x5D, 0x01, 0x20, 0xFE, 0xE7, 0x00, 0x00, 0x02,
-	0x00, 0x4E, 0x00, 0x92, 0x04, 0x34, 0x04, 0xB6, 0x00, 0x03, 0x00, 0x07, 0x00, 0x10, 0xB5, 0x07,
-	0x07, 0x03, 0x03, 0x06, 0x02, 0x00, 0x2F, 0xC6, 0x33, 0x10, 0xC6, 0x2F, 0x30, 0x31, 0x41, 0x15,
-	0x21, 0x35, 0x01, 0x11, 0x23, 0x11, 0x04, 0x34, 0xFC, 0x1A, 0x02, 0x50, 0xB9, 0x03, 0x0D, 0xAE,
-	0xAE, 0x01, 0xA9, 0xFB, 0xDC, 0x04, 0x24, 0x00, 0x00, 0x01, 0x00, 0x1D, 0xFE, 0xDD, 0x01, 0x35,
-	0x00, 0xDC, 0x00, 0x0A, 0x00, 0x08, 0xB1, 0x04, 0x00, 0x00, 0x2F, 0xCD, 0x30, 0x31, 0x65, 0x15,
-	0x14, 0x06, 0x07, 0x27, 0x3E, 0x02, 0x35, 0x35, 0x01, 0x35, 0x5C, 0x53, 0x69, 0x20, 0x2C, 0x17,
-	0xDC, 0x95, 0x5B, 0xCB, 0x44, 0x49, 0x2C, 0x5B, 0x61, 0x36, 0x98, 0x00, 0x00, 0x01, 0x00, 0x26,
-	0x02, 0x1F, 0x02, 0x0E, 0x02, 0xB7, 0x00, 0x03, 0x00, 0x08, 0xB1, 0x03, 0x02, 0x00, 0x2F, 0x33,
-	0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x02, 0x0E, 0xFE, 0x18, 0x02, 0xB7, 0x98, 0x98, 0x00, 0x01,
-	0x00, 0x90, 0xFF, 0xF4, 0x01, 0x76, 0x00, 0xD2, 0x00, 0x0B, 0x00, 0x0A, 0xB3, 0x03, 0x09, 0x0B,
-	0x72, 0x00, 0x2B, 0x32, 0x30, 0x31, 0x77, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
-	0x22, 0x26, 0x90, 0x3B, 0x38, 0x38, 0x3B, 0x3B, 0x38, 0x38, 0x3B, 0x62, 0x2F, 0x41, 0x41, 0x2F,
-	0x2E, 0x40, 0x40, 0x00, 0x00, 0x01, 0x00, 0x13, 0xFF, 0x83, 0x03, 0x11, 0x05, 0xB0, 0x00, 0x03,
-	0x00, 0x09, 0xB2, 0x00, 0x02, 0x01, 0x00, 0x2F, 0x3F, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x03,
-	0x11, 0xFD, 0xA1, 0x9F, 0x02, 0x60, 0x05, 0xB0, 0xF9, 0xD3, 0x06, 0x2D, 0x00, 0x02, 0x00, 0x73,
-	0xFF, 0xEC, 0x04, 0x0B, 0x05, 0xC4, 0x00, 0x17, 0x00, 0x2F, 0x00, 0x13, 0x40, 0x09, 0x2B, 0x06,
-	0x1F, 0x12, 0x05, 0x72, 0x06, 0x0D, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41,
-	0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x03, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E,
-	0x03, 0x03, 0x11, 0x34, 0x2E, 0x03, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x11, 0x14, 0x1E, 0x03, 0x33,
-	0x32, 0x3E, 0x02, 0x04, 0x0B, 0x40, 0x78, 0xA9, 0x6A, 0x54, 0x8E, 0x71, 0x50, 0x2A, 0x41, 0x78,
-	0xA9, 0x69, 0x55, 0x8F, 0x70, 0x4F, 0x2A, 0xBA, 0x17, 0x2C, 0x43, 0x57, 0x36, 0x42, 0x66, 0x45,
-	0x24, 0x17, 0x2E, 0x42, 0x57, 0x35, 0x44, 0x66, 0x45, 0x22, 0x03, 0x4C, 0xDE, 0xB3, 0xF6, 0x96,
-	0x43, 0x2A, 0x5D, 0x96, 0xD6, 0x8F, 0xDE, 0xB3, 0xF2, 0x93, 0x40, 0x29, 0x59, 0x93, 0xD4, 0xFE,
-	0x75, 0x01, 0x1B, 0x62, 0x95, 0x6A, 0x42, 0x1F, 0x31, 0x6A, 0xAC, 0x7B, 0xFE, 0xE5, 0x62, 0x96,
-	0x6D, 0x46, 0x21, 0x34, 0x6F, 0xAF, 0x00, 0x01, 0x00, 0xAB, 0x00, 0x00, 0x02, 0xD9, 0x05, 0xB8,
-	0x00, 0x06, 0x00, 0x0C, 0xB5, 0x06, 0x04, 0x72, 0x01, 0x0C, 0x72, 0x00, 0x2B, 0x2B, 0x30, 0x31,
-	0x41, 0x11, 0x23, 0x11, 0x05, 0x35, 0x25, 0x02, 0xD9, 0xB9, 0xFE, 0x8B, 0x02, 0x11, 0x05, 0xB8,
-	0xFA, 0x48, 0x04, 0xD1, 0x88, 0xA7, 0xC8, 0x00, 0x00, 0x01, 0x00, 0x5E, 0x00, 0x00, 0x04, 0x33,
-	0x05, 0xC4, 0x00, 0x1F, 0x00, 0x19, 0x40, 0x0C, 0x10, 0x10, 0x0C, 0x15, 0x05, 0x72, 0x03, 0x1F,
-	0x1F, 0x02, 0x0C, 0x72, 0x00, 0x2B, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x32, 0x2F, 0x30, 0x31, 0x65,
-	0x15, 0x21, 0x35, 0x01, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23,
-	0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x07, 0x01, 0x04, 0x33, 0xFC,
-	0x47, 0x01, 0xDD, 0x58, 0x61, 0x27, 0x3B, 0x72, 0x51, 0x61, 0x81, 0x40, 0xB9, 0x6C, 0xD4, 0x9B,
-	0x8A, 0xC4, 0x69, 0x2B, 0x4B, 0x63, 0x38, 0xFE, 0x7A, 0x98, 0x98, 0x85, 0x02, 0x13, 0x62, 0x89,
-	0x6D, 0x39, 0x48, 0x75, 0x46, 0x4B, 0x86, 0x57, 0x7B, 0xCC, 0x79, 0x61, 0xAF, 0x75, 0x40, 0x83,
-	0x82, 0x7E, 0x3D, 0xFE, 0x59, 0x00, 0x00, 0x02, 0x00, 0x5F, 0xFF, 0xEC, 0x03, 0xFA, 0x05, 0xC4,
-	0x00, 0x1C, 0x00, 0x3B, 0x00, 0x2A, 0x40, 0x16, 0x1B, 0x1C, 0x1E, 0x1F, 0x04, 0x00, 0x00, 0x1D,
-	0x1D, 0x12, 0x33, 0x2F, 0x2F, 0x29, 0x0D, 0x72, 0x0D, 0x0D, 0x09, 0x12, 0x05, 0x72, 0x00, 0x2B,
-	0x32, 0x32, 0x2F, 0x2B, 0x32, 0x2F, 0x32, 0x11, 0x39, 0x2F, 0x33, 0x12, 0x17, 0x39, 0x30, 0x31,
-	0x41, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34,
-	0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x23, 0x15, 0x35, 0x33, 0x32,
-	0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x33, 0x14, 0x16, 0x16, 0x33,
-	0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x01, 0x87, 0x84, 0x61, 0x7F, 0x3F, 0x38, 0x70,
-	0x56, 0x4E, 0x77, 0x43, 0xB9, 0x70, 0xCB, 0x86, 0x84, 0xC6, 0x6E, 0x33, 0x6B, 0xAA, 0x77, 0x9E,
-	0x9E, 0x8B, 0xB6, 0x69, 0x2B, 0x45, 0x7D, 0xA8, 0x63, 0x5F, 0xA7, 0x80, 0x48, 0xB9, 0x43, 0x7D,
-	0x55, 0x55, 0x7B, 0x43, 0x4C, 0x8B, 0x5E, 0x03, 0x33, 0x41, 0x71, 0x47, 0x54, 0x72, 0x3A, 0x3D,
-	0x70, 0x4C, 0x6F, 0xB6, 0x6C, 0x5D, 0xB7, 0x88, 0x37, 0x7D, 0x6C, 0x45, 0x28, 0x6F, 0x42, 0x6E,
-	0x83, 0x41, 0x66, 0x9E, 0x6E, 0x38, 0x36, 0x67, 0x97, 0x61, 0x4C, 0x72, 0x3F, 0x3B, 0x78, 0x5B,
-	0x5B, 0x75, 0x39, 0x00, 0x00, 0x02, 0x00, 0x35, 0x00, 0x00, 0x04, 0x51, 0x05, 0xB0, 0x00, 0x07,
-	0x00, 0x0B, 0x00, 0x1D, 0x40, 0x0E, 0x03, 0x07, 0x07, 0x06, 0x02, 0x02, 0x05, 0x09, 0x0C, 0x72,
-	0x0B, 0x05, 0x04, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x12, 0x39, 0x2F, 0x39, 0x33, 0x12, 0x39, 0x30,
-	0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x33, 0x03, 0x01, 0x01, 0x11, 0x23, 0x11, 0x04, 0x51, 0xFB,
-	0xE4, 0x02, 0x8C, 0x97, 0xA2, 0xFE, 0x51, 0x02, 0x7F, 0xB9, 0x01, 0xEA, 0x98, 0x6D, 0x03, 0xF1,
-	0xFE, 0xDC, 0xFD, 0x5E, 0x03, 0xC6, 0xFA, 0x50, 0x05, 0xB0, 0x00, 0x01, 0x00, 0x9A, 0xFF, 0xEC,
-	0x04, 0x2E, 0x05, 0xB0, 0x00, 0x29, 0x00, 0x1D, 0x40, 0x0E, 0x27, 0x09, 0x09, 0x02, 0x1D, 0x19,
-	0x19, 0x13, 0x0D, 0x72, 0x05, 0x02, 0x04, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x2F, 0x32, 0x11,
-	0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x27, 0x13, 0x21, 0x15, 0x21, 0x03, 0x36, 0x36, 0x33, 0x32,
-	0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x27, 0x33, 0x1E, 0x02, 0x33, 0x32,
-	0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x01, 0x63, 0x94, 0x49, 0x02, 0xEB, 0xFD,
-	0xB2, 0x2C, 0x28, 0x7B, 0x50, 0x65, 0xA0, 0x71, 0x3C, 0x39, 0x72, 0xAD, 0x75, 0x58, 0x9D, 0x7B,
-	0x4D, 0x0A, 0xB0, 0x0C, 0x48, 0x75, 0x4E, 0x42, 0x66, 0x46, 0x25, 0x26, 0x4B, 0x6C, 0x46, 0x5D,
-	0x5F, 0x02, 0xB5, 0x26, 0x02, 0xD5, 0xAB, 0xFE, 0x74, 0x17, 0x28, 0x45, 0x80, 0xB4, 0x6F, 0x69,
-	0xB0, 0x83, 0x48, 0x31, 0x65, 0x97, 0x66, 0x52, 0x70, 0x39, 0x2E, 0x56, 0x7A, 0x4C, 0x45, 0x76,
-	0x58, 0x31, 0x32, 0x00, 0x00, 0x01, 0x00, 0x85, 0xFF, 0xEC, 0x04, 0x1D, 0x05, 0xB2, 0x00, 0x36,
-	0x00, 0x1B, 0x40, 0x0D, 0x0E, 0x2C, 0x18, 0x22, 0x22, 0x2C, 0x03, 0x00, 0x04, 0x72, 0x2C, 0x0D,
-	0x72, 0x00, 0x2B, 0x2B, 0x32, 0x11, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x15,
-	0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E,
-	0x02, 0x23, 0x22, 0x06, 0x06, 0x07, 0x27, 0x3E, 0x03, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E,
-	0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x12, 0x36, 0x24, 0x03, 0x3F, 0x10, 0x10, 0x93,
-	0xC6, 0x74, 0x33, 0x2E, 0x50, 0x65, 0x37, 0x40, 0x64, 0x45, 0x24, 0x20, 0x42, 0x63, 0x44, 0x4D,
-	0x85, 0x55, 0x06, 0x62, 0x0E, 0x4D, 0x73, 0x8F, 0x50, 0x6D, 0x9E, 0x66, 0x31, 0x3A, 0x73, 0xA8,
-	0x6F, 0x76, 0xB0, 0x74, 0x3A, 0x3E, 0x99, 0x01, 0x10, 0x05, 0xB2, 0x9D, 0x5F, 0x9F, 0xC6, 0x66,
-	0xD6, 0x61, 0x95, 0x66, 0x34, 0x31, 0x59, 0x7A, 0x49, 0x41, 0x79, 0x5F, 0x37, 0x4B, 0x79, 0x47,
-	0x01, 0x70, 0x9F, 0x65, 0x2F, 0x52, 0x89, 0xAB, 0x5A, 0x67, 0xB4, 0x88, 0x4C, 0x61, 0xA2, 0xC6,
-	0x66, 0x57, 0x9A, 0x01, 0x28, 0xF0, 0x8E, 0x00, 0x00, 0x01, 0x00, 0x4E, 0x00, 0x00, 0x04, 0x26,
-	0x05, 0xB0, 0x00, 0x06, 0x00, 0x13, 0x40, 0x09, 0x01, 0x05, 0x05, 0x06, 0x04, 0x72, 0x03, 0x0C,
-	0x72, 0x00, 0x2B, 0x2B, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x01, 0x23, 0x01, 0x21, 0x35,
-	0x04, 0x26, 0xFD, 0xA5, 0xC3, 0x02, 0x5A, 0xFC, 0xEC, 0x05, 0xB0, 0x68, 0xFA, 0xB8, 0x05, 0x18,
-	0x98, 0x00, 0x00, 0x04, 0x00, 0x71, 0xFF, 0xEC, 0x04, 0x0F, 0x05, 0xC4, 0x00, 0x10, 0x00, 0x20,
-	0x00, 0x30, 0x00, 0x40, 0x00, 0x21, 0x40, 0x10, 0x0D, 0x3D, 0x3D, 0x25, 0x2D, 0x15, 0x15, 0x04,
-	0x35, 0x2D, 0x05, 0x72, 0x1D, 0x04, 0x0D, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x12, 0x39, 0x2F,
-	0x12, 0x39, 0x33, 0x12, 0x39, 0x30, 0x31, 0x41, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35,
-	0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x07, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
-	0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x13, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35,
-	0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x07, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
-	0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x04, 0x0F, 0x7B, 0xD1, 0x83, 0x83, 0xD2, 0x7A, 0x43,
-	0x7B, 0xA9, 0x66, 0x86, 0xD2, 0x79, 0xBA, 0x46, 0x7E, 0x53, 0x55, 0x7B, 0x44, 0x43, 0x7D, 0x56,
-	0x56, 0x7C, 0x43, 0x98, 0x70, 0xC2, 0x7B, 0x7D, 0xC3, 0x6E, 0x6F, 0xC2, 0x7C, 0x7D, 0xC2, 0x6F,
-	0xB9, 0x3E, 0x6E, 0x49, 0x49, 0x6D, 0x3D, 0x3D, 0x6E, 0x49, 0x49, 0x6D, 0x3E, 0x01, 0x8A, 0x85,
-	0xB9, 0x60, 0x60, 0xB9, 0x85, 0x57, 0x91, 0x6C, 0x3B, 0x67, 0xB4, 0x70, 0x51, 0x7D, 0x46, 0x46,
-	0x7D, 0x51, 0x54, 0x77, 0x3F, 0x3F, 0x77, 0x02, 0xFB, 0x6A, 0xAA, 0x62, 0x62, 0xAA, 0x6A, 0x7F,
-	0xB2, 0x5E, 0x5E, 0xB2, 0x82, 0x49, 0x70, 0x41, 0x3D, 0x70, 0x4D, 0x4B, 0x70, 0x3E, 0x3E, 0x70,
-	0x00, 0x01, 0x00, 0x64, 0xFF, 0xFE, 0x03, 0xF8, 0x05, 0xC4, 0x00, 0x38, 0x00, 0x1B, 0x40, 0x0D,
-	0x00, 0x38, 0x16, 0x21, 0x21, 0x38, 0x0C, 0x2B, 0x05, 0x72, 0x38, 0x0C, 0x72, 0x00, 0x2B, 0x2B,
-	0x32, 0x11, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x30, 0x31, 0x65, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35,
-	0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x37,
-	0x33, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02,
-	0x15, 0x15, 0x14, 0x0E, 0x03, 0x23, 0x23, 0x01, 0x31, 0x13, 0xA0, 0xC8, 0x6C, 0x28, 0x2D, 0x4F,
-	0x64, 0x38, 0x40, 0x65, 0x45, 0x24, 0x20, 0x42, 0x63, 0x43, 0x3E, 0x6D, 0x55, 0x33, 0x04, 0x58,
-	0x41, 0x74, 0x9C, 0x5C, 0x6C, 0x9E, 0x65, 0x31, 0x3A, 0x72, 0xA9, 0x6F, 0x7D, 0xB0, 0x6F, 0x34,
-	0x1D, 0x51, 0x9A, 0xF7, 0xB5, 0x13, 0x9B, 0x5A, 0x98, 0xBF, 0x65, 0xDF, 0x63, 0x9A, 0x68, 0x36,
-	0x33, 0x5C, 0x7C, 0x49, 0x41, 0x7A, 0x62, 0x39, 0x31, 0x55, 0x6C, 0x3B, 0x53, 0xA1, 0x84, 0x4F,
-	0x54, 0x8C, 0xAD, 0x59, 0x68, 0xB6, 0x8B, 0x4E, 0x64, 0xA8, 0xD2, 0x6F, 0x43, 0x71, 0xE9, 0xD4,
-	0xA7, 0x61, 0xFF, 0xFF, 0x00, 0x85, 0xFF, 0xF4, 0x01, 0x6C, 0x04, 0x45, 0x04, 0x26, 0x00, 0x12,
-	0xF5, 0x00, 0x00, 0x07, 0x00, 0x12, 0xFF, 0xF6, 0x03, 0x73, 0xFF, 0xFF, 0x00, 0x29, 0xFE, 0xDD,
-	0x01, 0x54, 0x04, 0x45, 0x04, 0x27, 0x00, 0x12, 0xFF, 0xDE, 0x03, 0x73, 0x00, 0x06, 0x00, 0x10,
-	0x0C, 0x00, 0x00, 0x02, 0x00, 0x48, 0x00, 0xC4, 0x03, 0x7A, 0x04, 0x4A, 0x00, 0x04, 0x00, 0x09,
-	0x00, 0x16, 0x40, 0x0C, 0x01, 0x03, 0x07, 0x06, 0x00, 0x04, 0x08, 0x05, 0x08, 0x02, 0x09, 0x02,
-	0x00, 0x2F, 0x2F, 0x12, 0x17, 0x39, 0x30, 0x31, 0x53, 0x01, 0x15, 0x01, 0x35, 0x25, 0x01, 0x07,
-	0x35, 0x01, 0xC7, 0x02, 0xB3, 0xFC, 0xCE, 0x03, 0x32, 0xFD, 0x4E, 0x80, 0x03, 0x32, 0x02, 0xA0,
-	0xFE, 0xE8, 0xC4, 0x01, 0x7B, 0x73, 0xD4, 0xFE, 0xE4, 0x0E, 0x74, 0x01, 0x7A, 0x00, 0x00, 0x02,
-	0x00, 0x98, 0x01, 0x8F, 0x03, 0xDA, 0x03, 0xCF, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0E, 0xB5, 0x06,
-	0x07, 0x12, 0x03, 0x02, 0x10, 0x00, 0x3F, 0x33, 0x3F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35,
-	0x01, 0x15, 0x21, 0x35, 0x03, 0xDA, 0xFC, 0xBE, 0x03, 0x42, 0xFC, 0xBE, 0x03, 0xCF, 0xA1, 0xA1,
-	0xFE, 0x61, 0xA1, 0xA1, 0x00, 0x02, 0x00, 0x87, 0x00, 0xC5, 0x03, 0xDD, 0x04, 0x4C, 0x00, 0x04,
-	0x00, 0x09, 0x00, 0x15, 0x40, 0x0B, 0x05, 0x08, 0x04, 0x00, 0x06, 0x03, 0x01, 0x07, 0x02, 0x09,
-	0x02, 0x00, 0x2F, 0x2F, 0x12, 0x17, 0x39, 0x30, 0x31, 0x41, 0x01, 0x35, 0x01, 0x15, 0x05, 0x01,
-	0x37, 0x15, 0x01, 0x03, 0x4E, 0xFD, 0x39, 0x03, 0x56, 0xFC, 0xAA, 0x02, 0xC9, 0x8D, 0xFC, 0xAA,
-	0x02, 0x78, 0x01, 0x15, 0xBF, 0xFE, 0x86, 0x75, 0xD9, 0x01, 0x1B, 0x15, 0x74, 0xFE, 0x85, 0x00,
-	0x00, 0x02, 0x00, 0x4B, 0xFF, 0xF4, 0x03, 0x77, 0x05, 0xC4, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x1B,
-	0x40, 0x0D, 0x01, 0x01, 0x24, 0x24, 0x2A, 0x0B, 0x72, 0x11, 0x11, 0x0D, 0x16, 0x03, 0x72, 0x00,
-	0x2B, 0x32, 0x32, 0x2F, 0x2B, 0x32, 0x11, 0x33, 0x2F, 0x30, 0x31, 0x41, 0x23, 0x3E, 0x02, 0x37,
-	0x3E, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x07, 0x23, 0x3E, 0x02, 0x33, 0x32,
-	0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x06, 0x06, 0x03, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
-	0x14, 0x06, 0x23, 0x22, 0x26, 0x02, 0x1F, 0xBA, 0x01, 0x21, 0x4C, 0x3F, 0x2E, 0x4D, 0x30, 0x31,
-	0x5F, 0x46, 0x3A, 0x68, 0x40, 0x01, 0xB9, 0x02, 0x6D, 0xBA, 0x73, 0x7F, 0xB3, 0x5E, 0x49, 0x72,
-	0x40, 0x37, 0x26, 0xC2, 0x38, 0x35, 0x36, 0x38, 0x38, 0x36, 0x35, 0x38, 0x01, 0x9A, 0x60, 0x7B,
-	0x66, 0x41, 0x2F, 0x53, 0x61, 0x44, 0x45, 0x64, 0x36, 0x2A, 0x57, 0x46, 0x71, 0xA2, 0x56, 0x5C,
-	0xAB, 0x75, 0x5A, 0x97, 0x84, 0x3C, 0x33, 0x80, 0xFE, 0x79, 0x2D, 0x3E, 0x3E, 0x2D, 0x2B, 0x3E,
-	0x3E, 0x00, 0x00, 0x02, 0x00, 0x6D, 0xFE, 0x3B, 0x06, 0xCF, 0x05, 0x97, 0x00, 0x41, 0x00, 0x68,
-	0x00, 0x27, 0x40, 0x12, 0x12, 0x05, 0x05, 0x47, 0x52, 0x13, 0x72, 0x61, 0x64, 0x64, 0x0B, 0x5D,
-	0x5D, 0x1D, 0x1D, 0x3C, 0x29, 0x30, 0x00, 0x2F, 0x33, 0x2F, 0x33, 0x11, 0x33, 0x2F, 0x33, 0x33,
-	0x11, 0x33, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x0E, 0x03, 0x23, 0x22, 0x2E, 0x02,
-	0x37, 0x13, 0x33, 0x03, 0x06, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x37, 0x36, 0x2E, 0x03, 0x23,
-	0x22, 0x0E, 0x03, 0x07, 0x06, 0x1E, 0x03, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22,
-	0x2E, 0x02, 0x02, 0x37, 0x36, 0x12, 0x36, 0x36, 0x24, 0x33, 0x32, 0x1E, 0x02, 0x12, 0x05, 0x06,
-	0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x37, 0x17, 0x0E, 0x03, 0x23, 0x22, 0x2E, 0x02, 0x37, 0x3E,
-	0x04, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x06, 0xC8, 0x04, 0x30,
-	0x60, 0x99, 0x6C, 0x45, 0x67, 0x41, 0x19, 0x08, 0x33, 0x93, 0x33, 0x06, 0x13, 0x28, 0x33, 0x18,
-	0x3C, 0x5E, 0x41, 0x24, 0x04, 0x07, 0x29, 0x61, 0x9C, 0xD8, 0x8B, 0x7E, 0xD5, 0xA9, 0x79, 0x45,
-	0x06, 0x07, 0x2E, 0x67, 0x9E, 0xD0, 0x80, 0x58, 0xB5, 0x3D, 0x26, 0x46, 0xD1, 0x5D, 0x98, 0xFB,
-	0xC1, 0x80, 0x3C, 0x07, 0x07, 0x55, 0x94, 0xCD, 0x01, 0x01, 0x97, 0x9A, 0xFA, 0xBD, 0x7C, 0x39,
-	0xFB, 0xF6, 0x07, 0x0E, 0x28, 0x41, 0x2C, 0x1D, 0x40, 0x3E, 0x36, 0x12, 0x42, 0x17, 0x49, 0x5A,
-	0x65, 0x34, 0x49, 0x6E, 0x44, 0x1B, 0x09, 0x09, 0x38, 0x53, 0x69, 0x76, 0x3E, 0x6C, 0x7C, 0x38,
-	0x55, 0x1D, 0x5E, 0x40, 0x37, 0x60, 0x4D, 0x34, 0x01, 0xF7, 0x5C, 0xB9, 0x9A, 0x5D, 0x31, 0x5C,
-	0x82, 0x50, 0x02, 0x2A, 0xFD, 0xD6, 0x49, 0x5C, 0x31, 0x12, 0x3F, 0x6F, 0x93, 0x54, 0x95, 0xFA,
-	0xC2, 0x86, 0x46, 0x4D, 0x90, 0xCA, 0xFD, 0x92, 0x96, 0xFB, 0xC5, 0x89, 0x47, 0x2A, 0x24, 0x72,
-	0x2D, 0x2C, 0x53, 0x9F, 0xE3, 0x01, 0x22, 0xAC, 0xA4, 0x01, 0x22, 0xEC, 0xAB, 0x5C, 0x54, 0x9E,
-	0xE4, 0xFE, 0xE0, 0xFF, 0x46, 0x6E, 0x4C, 0x27, 0x1D, 0x3E, 0x64, 0x46, 0x48, 0x52, 0x7C, 0x54,
-	0x2B, 0x3F, 0x74, 0xA1, 0x63, 0x69, 0xB2, 0x8C, 0x62, 0x33, 0x3F, 0x2B, 0x63, 0x1C, 0x30, 0x38,
-	0x70, 0xA5, 0x00, 0x03, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E, 0x05, 0xB0, 0x00, 0x04, 0x00, 0x09,
-	0x00, 0x0D, 0x00, 0x29, 0x40, 0x14, 0x04, 0x07, 0x07, 0x0A, 0x0D, 0x0D, 0x06, 0x00, 0x0B, 0x0C,
-	0x0C, 0x02, 0x08, 0x03, 0x02, 0x72, 0x05, 0x02, 0x08, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x11,
-	0x39, 0x2F, 0x33, 0x39, 0x39, 0x33, 0x11, 0x33, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x01, 0x23,
-	0x01, 0x33, 0x01, 0x01, 0x27, 0x33, 0x01, 0x03, 0x15, 0x21, 0x35, 0x02, 0xC4, 0xFE, 0x1E, 0xC5,
-	0x02, 0x2B, 0x7F, 0x01, 0x91, 0xFE, 0x1D, 0x03, 0x7F, 0x02, 0x2D, 0xDF, 0xFC, 0xCE, 0x05, 0x2F,
-	0xFA, 0xD1, 0x05, 0xB0, 0xFA, 0x50, 0x05, 0x2F, 0x81, 0xFA, 0x50, 0x02, 0x1B, 0x9E, 0x9E, 0x00,
-	0x00, 0x02, 0x00, 0xA9, 0x00, 0x00, 0x04, 0x88, 0x05, 0xB0, 0x00, 0x19, 0x00, 0x30, 0x00, 0x29,
-	0x40, 0x14, 0x19, 0x29, 0x26, 0x02, 0x27, 0x27, 0x01, 0x26, 0x26, 0x0E, 0x0C, 0x0F, 0x02, 0x72,
-	0x1C, 0x1B, 0x1B, 0x0E, 0x08, 0x72, 0x00, 0x2B, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x11, 0x39, 0x2F,
-	0x33, 0x33, 0x11, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x21, 0x27, 0x21, 0x32, 0x36, 0x36,
-	0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x11, 0x23, 0x11, 0x21, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x06,
-	0x06, 0x07, 0x03, 0x21, 0x37, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x37,
-	0x21, 0x17, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x06, 0x02, 0xB0, 0xFE, 0x8F, 0x02, 0x01, 0x4F, 0x53,
-	0x7C, 0x45, 0x3D, 0x7D, 0x60, 0xFE, 0xE4, 0xC1, 0x01, 0xDD, 0x70, 0xB0, 0x7B, 0x40, 0x5C, 0xA3,
-	0x6D, 0x4E, 0xFE, 0x4C, 0x6D, 0x01, 0x47, 0x5C, 0x81, 0x44, 0x3A, 0x7C, 0x62, 0xFE, 0xED, 0x02,
-	0x01, 0x78, 0x29, 0x69, 0x92, 0x4D, 0x77, 0xD8, 0x02, 0xA9, 0x9B, 0x38, 0x69, 0x49, 0x50, 0x65,
-	0x2F, 0xFA, 0xEE, 0x05, 0xB0, 0x2D, 0x5F, 0x92, 0x66, 0x5A, 0x91, 0x5C, 0x0D, 0xFD, 0x28, 0x9D,
-	0x40, 0x75, 0x50, 0x51, 0x76, 0x40, 0x9B, 0x38, 0x09, 0x65, 0x9C, 0x5E, 0x88, 0xBB, 0x61, 0x00,
-	0x00, 0x01, 0x00, 0x78, 0xFF, 0xEC, 0x04, 0xD8, 0x05, 0xC4, 0x00, 0x27, 0x00, 0x15, 0x40, 0x0A,
-	0x19, 0x15, 0x10, 0x03, 0x72, 0x24, 0x00, 0x05, 0x09, 0x72, 0x00, 0x2B, 0xCC, 0x33, 0x2B, 0xCC,
-	0x33, 0x30, 0x31, 0x41, 0x33, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02,
-	0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E,
-	0x02, 0x33, 0x32, 0x36, 0x36, 0x04, 0x18, 0xC0, 0x0F, 0x80, 0xEA, 0xAF, 0x80, 0xD1, 0x96, 0x51,
-	0x51, 0x99, 0xD8, 0x87, 0xA5, 0xE4, 0x7F, 0x0F, 0xC0, 0x0E, 0x4C, 0x8C, 0x71, 0x61, 0x93, 0x63,
-	0x32, 0x2D, 0x5C, 0x8E, 0x61, 0x7B, 0x92, 0x4B, 0x01, 0xCF, 0x8A, 0xDA, 0x7F, 0x60, 0xB1, 0xF9,
-	0x99, 0x91, 0x99, 0xF9, 0xB2, 0x60, 0x7C, 0xDB, 0x90, 0x66, 0x93, 0x50, 0x4A, 0x88, 0xBE, 0x74,
-	0x93, 0x6B, 0xBC, 0x8E, 0x51, 0x4E, 0x92, 0x00, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x00, 0x04, 0xC7,
-	0x05, 0xB0, 0x00, 0x1A, 0x00, 0x1E, 0x00, 0x1B, 0x40, 0x0D, 0x02, 0x01, 0x01, 0x1D, 0x0E, 0x0F,
-	0x0F, 0x1E, 0x02, 0x72, 0x1D, 0x08, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x11, 0x33, 0x11, 0x33, 0x11,
-	0x33, 0x30, 0x31, 0x61, 0x21, 0x37, 0x21, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x2E, 0x02, 0x23,
-	0x21, 0x35, 0x21, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14, 0x0E, 0x02, 0x01, 0x11, 0x23, 0x11, 0x02,
-	0x33, 0xFE, 0xD0, 0x02, 0x01, 0x2E, 0x9C, 0xD0, 0x69, 0x3C, 0x74, 0xA7, 0x6C, 0xFE, 0xB8, 0x01,
-	0x48, 0x8F, 0xEC, 0xAB, 0x5C, 0x5C, 0xAD, 0xF3, 0xFE, 0x9F, 0xC1, 0x9D, 0x83, 0xED, 0x9F, 0x59,
-	0x7D, 0xC3, 0x87, 0x46, 0x9E, 0x5F, 0xB3, 0xFD, 0x9E, 0x57, 0x9E, 0xFD, 0xB2, 0x5F, 0x05, 0xB0,
-	0xFA, 0x50, 0x05, 0xB0, 0x00, 0x04, 0x00, 0xA9, 0x00, 0x00, 0x04, 0x46, 0x05, 0xB0, 0x00, 0x03,
-	0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x1D, 0x40, 0x0E, 0x0B, 0x0A, 0x0A, 0x06, 0x0F, 0x0E,
-	0x07, 0x02, 0x72, 0x03, 0x02, 0x06, 0x08, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x2B, 0x32, 0x32, 0x11,
-	0x39, 0x2F, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21,
-	0x35, 0x01, 0x15, 0x21, 0x35, 0x04, 0x46, 0xFC, 0xFD, 0x27, 0xC1, 0x03, 0x37, 0xFD, 0x63, 0x02,
-	0xF9, 0xFD, 0x07, 0x9D, 0x9D, 0x9D, 0x05, 0x13, 0xFA, 0x50, 0x05, 0xB0, 0xFD, 0x8E, 0x9D, 0x9D,
-	0x02, 0x72, 0x9E, 0x9E, 0x00, 0x03, 0x00, 0xA9, 0x00, 0x00, 0x04, 0x2F, 0x05, 0xB0, 0x00, 0x03,
-	0x00, 0x07, 0x00, 0x0B, 0x00, 0x1B, 0x40, 0x0D, 0x07, 0x06, 0x06, 0x02, 0x0A, 0x0B, 0x0B, 0x03,
-	0x02, 0x72, 0x02, 0x08, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x11, 0x33, 0x11, 0x39, 0x2F, 0x33, 0x30,
-	0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x6A, 0xC1,
-	0x03, 0x23, 0xFD, 0x74, 0x02, 0xEF, 0xFD, 0x11, 0x05, 0xB0, 0xFA, 0x50, 0x05, 0xB0, 0xFD, 0x71,
-	0x9E, 0x9E, 0x02, 0x8F, 0x9E, 0x9E, 0x00, 0x01, 0x00, 0x7A, 0xFF, 0xEC, 0x04, 0xDD, 0x05, 0xC4,
-	0x00, 0x2B, 0x00, 0x1B, 0x40, 0x0D, 0x2B, 0x2A, 0x2A, 0x05, 0x19, 0x15, 0x10, 0x03, 0x72, 0x24,
-	0x05, 0x09, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0xCC, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41,
-	0x11, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x02, 0x35, 0x35, 0x34, 0x12, 0x36, 0x36, 0x33, 0x32,
-	0x16, 0x16, 0x17, 0x23, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33,
-	0x32, 0x36, 0x36, 0x37, 0x11, 0x21, 0x35, 0x04, 0xDD, 0x1B, 0x76, 0xCF, 0xA3, 0x85, 0xDF, 0xA3,
-	0x59, 0x4D, 0x96, 0xDA, 0x8D, 0xA7, 0xE1, 0x7F, 0x12, 0xC1, 0x0D, 0x4D, 0x8E, 0x70, 0x65, 0x94,
-	0x60, 0x2F, 0x3B, 0x6E, 0x99, 0x5D, 0x67, 0x80, 0x48, 0x13, 0xFE, 0xAF, 0x02, 0xD5, 0xFD, 0xEB,
-	0x28, 0x63, 0x49, 0x5D, 0xB3, 0x01, 0x01, 0xA3, 0x71, 0xA3, 0x01, 0x00, 0xB3, 0x5D, 0x73, 0xCA,
-	0x81, 0x4F, 0x82, 0x4F, 0x4A, 0x8A, 0xC4, 0x7B, 0x73, 0x7E, 0xC6, 0x8B, 0x48, 0x23, 0x31, 0x16,
-	0x01, 0x46, 0x9C, 0x00, 0x00, 0x03, 0x00, 0xA9, 0x00, 0x00, 0x05, 0x08, 0x05, 0xB0, 0x00, 0x03,
-	0x00, 0x07, 0x00, 0x0B, 0x00, 0x1B, 0x40, 0x0D, 0x09, 0x06, 0x08, 0x03, 0x02, 0x02, 0x06, 0x07,
-	0x02, 0x72, 0x06, 0x08, 0x72, 0x00, 0x2B, 0x2B, 0x11, 0x39, 0x2F, 0x33, 0x32, 0x11, 0x33, 0x30,
-	0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x04, 0x60, 0xFC,
-	0xEC, 0x1E, 0xC1, 0x04, 0x5F, 0xC0, 0x03, 0x3E, 0x9D, 0x9D, 0x02, 0x72, 0xFA, 0x50, 0x05, 0xB0,
-	0xFA, 0x50, 0x05, 0xB0, 0x00, 0x01, 0x00, 0xB7, 0x00, 0x00, 0x01, 0x78, 0x05, 0xB0, 0x00, 0x03,
-	0x00, 0x0C, 0xB5, 0x00, 0x02, 0x72, 0x01, 0x08, 0x72, 0x00, 0x2B, 0x2B, 0x30, 0x31, 0x41, 0x11,
-	0x23, 0x11, 0x01, 0x78, 0xC1, 0x05, 0xB0, 0xFA, 0x50, 0x05, 0xB0, 0x00, 0x00, 0x01, 0x00, 0x35,
-	0xFF, 0xEC, 0x03, 0xCC, 0x05, 0xB0, 0x00, 0x13, 0x00, 0x13, 0x40, 0x09, 0x10, 0x0C, 0x0C, 0x07,
-	0x09, 0x72, 0x02, 0x02, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x2F, 0x32, 0x30, 0x31, 0x41, 0x11, 0x33,
-	0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36,
-	0x36, 0x03, 0x0C, 0xC0, 0x76, 0xCF, 0x86, 0x86, 0xD0, 0x76, 0xC1, 0x44, 0x79, 0x4E, 0x4C, 0x79,
-	0x46, 0x01, 0xA9, 0x04, 0x07, 0xFB, 0xF9, 0x90, 0xC6, 0x67, 0x5C, 0xBC, 0x8F, 0x5C, 0x76, 0x38,
-	0x41, 0x81, 0x00, 0x03, 0x00, 0xA9, 0x00, 0x00, 0x05, 0x05, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x09,
-	0x00, 0x0D, 0x00, 0x1C, 0x40, 0x10, 0x06, 0x07, 0x0B, 0x05, 0x0C, 0x08, 0x06, 0x02, 0x04, 0x03,
-	0x02, 0x72, 0x0A, 0x02, 0x08, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31,
-	0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x01, 0x27, 0x01, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x6A,
-	0xC1, 0x04, 0x30, 0xFD, 0xA3, 0xFE, 0xAC, 0x20, 0x01, 0x00, 0x01, 0xE9, 0x2E, 0xFD, 0xE5, 0x73,
-	0x02, 0x8E, 0x05, 0xB0, 0xFA, 0x50, 0x05, 0xB0, 0xFD, 0x59, 0xFE, 0x9F, 0xCE, 0x01, 0x1A, 0x02,
-	0x20, 0xFA, 0x50, 0x02, 0xC6, 0x99, 0xFC, 0xA1, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x00, 0x04, 0x1C,
-	0x05, 0xB0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x15, 0x40, 0x0A, 0x03, 0x02, 0x02, 0x06, 0x07, 0x02,
-	0x72, 0x06, 0x08, 0x72, 0x00, 0x2B, 0x2B, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21,
-	0x35, 0x13, 0x11, 0x23, 0x11, 0x04, 0x1C, 0xFD, 0x28, 0x26, 0xC1, 0x9D, 0x9D, 0x9D, 0x05, 0x13,
-	0xFA, 0x50, 0x05, 0xB0, 0x00, 0x03, 0x00, 0xA9, 0x00, 0x00, 0x06, 0x52, 0x05, 0xB0, 0x00, 0x06,
-	0x00, 0x0B, 0x00, 0x10, 0x00, 0x1B, 0x40, 0x0D, 0x02, 0x07, 0x0E, 0x05, 0x0B, 0x08, 0x72, 0x0C,
-	0x04, 0x00, 0x07, 0x02, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x32, 0x2B, 0x32, 0x32, 0x11, 0x39, 0x30,
-	0x31, 0x53, 0x33, 0x01, 0x01, 0x33, 0x01, 0x23, 0x01, 0x33, 0x13, 0x11, 0x23, 0x01, 0x33, 0x11,
-	0x23, 0x11, 0xE6, 0xBB, 0x01, 0xDD, 0x01, 0xDC, 0xBC, 0xFD, 0xB0, 0x92, 0xFD, 0x75, 0xA5, 0x1B,
-	0xC0, 0x05, 0x04, 0xA5, 0xC0, 0x05, 0xB0, 0xFB, 0x5D, 0x04, 0xA3, 0xFA, 0x50, 0x05, 0xB0, 0xFC,
-	0x88, 0xFD, 0xC8, 0x05, 0xB0, 0xFA, 0x50, 0x02, 0x38, 0x00, 0x00, 0x01, 0x00, 0xA9, 0x00, 0x00,
-	0x05, 0x09, 0x05, 0xB0, 0x00, 0x09, 0x00, 0x17, 0x40, 0x0B, 0x03, 0x08, 0x05, 0x09, 0x07, 0x02,
-	0x72, 0x02, 0x05, 0x08, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41,
-	0x11, 0x23, 0x01, 0x11, 0x23, 0x11, 0x33, 0x01, 0x11, 0x05, 0x09, 0xC2, 0xFD, 0x23, 0xC1, 0xC1,
-	0x02, 0xE0, 0x05, 0xB0, 0xFA, 0x50, 0x04, 0x63, 0xFB, 0x9D, 0x05, 0xB0, 0xFB, 0x9A, 0x04, 0x66,
-	0x00, 0x02, 0x00, 0x77, 0xFF, 0xEC, 0x05, 0x0A, 0x05, 0xC4, 0x00, 0x15, 0x00, 0x2B, 0x00, 0x13,
-	0x40, 0x09, 0x27, 0x06, 0x1C, 0x11, 0x03, 0x72, 0x06, 0x09, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x11,
-	0x33, 0x30, 0x31, 0x41, 0x15, 0x14, 0x02, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x02, 0x35, 0x35,
-	0x34, 0x12, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x12, 0x03, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22,
-	0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x05, 0x0A, 0x52, 0x9A, 0xD7,
-	0x85, 0x81, 0xD7, 0x9D, 0x56, 0x55, 0x9C, 0xD7, 0x81, 0x85, 0xD7, 0x9B, 0x53, 0xBF, 0x35, 0x66,
-	0x93, 0x5D, 0x5A, 0x91, 0x67, 0x38, 0x38, 0x69, 0x91, 0x5A, 0x5E, 0x92, 0x65, 0x34, 0x03, 0x06,
-	0x5C, 0xA4, 0xFE, 0xFC, 0xB6, 0x60, 0x60, 0xB6, 0x01, 0x04, 0xA4, 0x5C, 0xA4, 0x01, 0x03, 0xB7,
-	0x60, 0x60, 0xB7, 0xFE, 0xFD, 0xFF, 0x00, 0x5E, 0x82, 0xC8, 0x88, 0x46, 0x46, 0x88, 0xC8, 0x82,
-	0x5E, 0x83, 0xC9, 0x89, 0x46, 0x46, 0x89, 0xC9, 0x00, 0x01, 0x00, 0xA9, 0x00, 0x00, 0x04, 0xC1,
-	0x05, 0xB0, 0x00, 0x17, 0x00, 0x17, 0x40, 0x0B, 0x02, 0x01, 0x01, 0x0E, 0x0C, 0x0F, 0x02, 0x72,
-	0x0E, 0x08, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x11, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x21, 0x35,
-	0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x11, 0x23, 0x11, 0x21, 0x32, 0x16,
-	0x16, 0x15, 0x14, 0x06, 0x06, 0x02, 0xC2, 0xFE, 0x7B, 0x01, 0x85, 0x71, 0x8C, 0x41, 0x41, 0x8C,
-	0x71, 0xFE, 0xA8, 0xC1, 0x02, 0x19, 0xA5, 0xE4, 0x76, 0x76, 0xE4, 0x02, 0x3B, 0x9D, 0x48, 0x80,
-	0x52, 0x4B, 0x84, 0x51, 0xFA, 0xEE, 0x05, 0xB0, 0x72, 0xC9, 0x81, 0x8C, 0xC6, 0x67, 0x00, 0x03,
-	0x00, 0x6E, 0xFF, 0x0A, 0x05, 0x06, 0x05, 0xC4, 0x00, 0x03, 0x00, 0x19, 0x00, 0x2F, 0x00, 0x19,
-	0x40, 0x0C, 0x20, 0x15, 0x03, 0x72, 0x00, 0x2B, 0x2B, 0x03, 0x0A, 0x09, 0x72, 0x02, 0x00, 0x2F,
-	0x2B, 0x32, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x30, 0x31, 0x65, 0x01, 0x07, 0x01, 0x01, 0x15, 0x14,
-	0x02, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x02, 0x35, 0x35, 0x34, 0x12, 0x36, 0x36, 0x33, 0x32,
-	0x16, 0x16, 0x12, 0x03, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E,
-	0x02, 0x33, 0x32, 0x3E, 0x02, 0x03, 0x94, 0x01, 0x72, 0x82, 0xFE, 0x94, 0x01, 0xE9, 0x52, 0x9A,
-	0xD7, 0x85, 0x81, 0xD7, 0x9D, 0x56, 0x55, 0x9C, 0xD7, 0x81, 0x85, 0xD8, 0x9A, 0x53, 0xBF, 0x35,
-	0x66, 0x92, 0x5E, 0x59, 0x91, 0x68, 0x38, 0x38, 0x69, 0x92, 0x59, 0x5E, 0x92, 0x65, 0x34, 0xA7,
-	0xFE, 0xDB, 0x78, 0x01, 0x21, 0x02, 0xDB, 0x5C, 0xA4, 0xFE, 0xFC, 0xB6, 0x60, 0x60, 0xB6, 0x01,
-	0x04, 0xA4, 0x5C, 0xA4, 0x01, 0x03, 0xB7, 0x60, 0x60, 0xB7, 0xFE, 0xFD, 0xFF, 0x00, 0x5E, 0x82,
-	0xC8, 0x88, 0x46, 0x46, 0x88, 0xC8, 0x82, 0x5E, 0x83, 0xC9, 0x89, 0x46, 0x46, 0x89, 0xC9, 0x00,
-	0x00, 0x02, 0x00, 0xA9, 0x00, 0x00, 0x04, 0xCA, 0x05, 0xB0, 0x00, 0x18, 0x00, 0x1D, 0x00, 0x23,
-	0x40, 0x12, 0x1B, 0x1A, 0x09, 0x03, 0x0C, 0x0C, 0x0B, 0x0B, 0x00, 0x1C, 0x19, 0x18, 0x08, 0x72,
-	0x16, 0x00, 0x02, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x32, 0x12, 0x39, 0x2F, 0x33, 0x12, 0x17,
-	0x39, 0x30, 0x31, 0x53, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x07, 0x21, 0x27,
-	0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x11, 0x23, 0x21, 0x01, 0x37, 0x01,
-	0x15, 0xA9, 0x01, 0xE2, 0xA4, 0xE3, 0x77, 0x51, 0x97, 0x69, 0x36, 0xFE, 0x3B, 0x02, 0x01, 0x56,
-	0x68, 0x8A, 0x46, 0x42, 0x8D, 0x6F, 0xFE, 0xDF, 0xC1, 0x03, 0x53, 0xFE, 0x9E, 0xC9, 0x01, 0x67,
-	0x05, 0xB0, 0x64, 0xC3, 0x8E, 0x64, 0xA5, 0x73, 0x1C, 0x15, 0x9D, 0x49, 0x7C, 0x4B, 0x54, 0x7E,
-	0x45, 0xFA, 0xEE, 0x02, 0x94, 0x01, 0xFD, 0x77, 0x0C, 0x00, 0x00, 0x01, 0x00, 0x51, 0xFF, 0xEC,
-	0x04, 0x73, 0x05, 0xC4, 0x00, 0x39, 0x00, 0x1F, 0x40, 0x0F, 0x0A, 0x26, 0x0F, 0x36, 0x31, 0x31,
-	0x2B, 0x09, 0x72, 0x18, 0x14, 0x14, 0x0F, 0x03, 0x72, 0x00, 0x2B, 0x32, 0x2F, 0x32, 0x2B, 0x32,
-	0x2F, 0x32, 0x11, 0x39, 0x39, 0x30, 0x31, 0x41, 0x34, 0x2E, 0x02, 0x27, 0x2E, 0x03, 0x35, 0x34,
-	0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
-	0x14, 0x1E, 0x02, 0x17, 0x1E, 0x03, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x33,
-	0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x03, 0xB1, 0x1F, 0x4D, 0x87, 0x67, 0x6C, 0xAE, 0x7C,
-	0x42, 0x46, 0x83, 0xB6, 0x70, 0xA4, 0xE5, 0x78, 0xC0, 0x46, 0x8E, 0x6D, 0x67, 0x86, 0x41, 0x27,
-	0x53, 0x81, 0x5A, 0x7C, 0xB4, 0x75, 0x39, 0x48, 0x86, 0xBB, 0x73, 0x65, 0xC3, 0x9F, 0x5F, 0xC0,
-	0x3A, 0x65, 0x81, 0x46, 0x65, 0x8C, 0x49, 0x01, 0x70, 0x33, 0x4F, 0x40, 0x3A, 0x1E, 0x20, 0x4F,
-	0x66, 0x84, 0x55, 0x55, 0x90, 0x6B, 0x3C, 0x7D, 0xC9, 0x72, 0x52, 0x7F, 0x49, 0x3E, 0x6A, 0x44,
-	0x2E, 0x4B, 0x40, 0x36, 0x19, 0x23, 0x56, 0x6B, 0x87, 0x55, 0x59, 0x90, 0x66, 0x37, 0x38, 0x70,
-	0xA5, 0x6D, 0x4B, 0x6B, 0x46, 0x21, 0x38, 0x68, 0x00, 0x02, 0x00, 0x32, 0x00, 0x00, 0x04, 0x97,
-	0x05, 0xB0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x15, 0x40, 0x0A, 0x00, 0x03, 0x03, 0x06, 0x07, 0x02,
-	0x72, 0x01, 0x08, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23,
-	0x11, 0x21, 0x15, 0x21, 0x35, 0x02, 0xC3, 0xBE, 0x02, 0x92, 0xFB, 0x9B, 0x05, 0xB0, 0xFA, 0x50,
-	0x05, 0xB0, 0x9E, 0x9E, 0x00, 0x01, 0x00, 0x8C, 0xFF, 0xEC, 0x04, 0xAA, 0x05, 0xB0, 0x00, 0x15,
-	0x00, 0x13, 0x40, 0x09, 0x01, 0x11, 0x06, 0x0B, 0x02, 0x72, 0x06, 0x09, 0x72, 0x00, 0x2B, 0x2B,
-	0x11, 0x33, 0x32, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35,
-	0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x03, 0xEA, 0xC0, 0x92, 0xF1,
-	0x8D, 0x94, 0xEF, 0x8B, 0xBF, 0x54, 0x97, 0x64, 0x65, 0x97, 0x54, 0x05, 0xB0, 0xFC, 0x27, 0xA4,
-	0xDA, 0x6D, 0x6D, 0xDA, 0xA4, 0x03, 0xD9, 0xFC, 0x27, 0x72, 0x94, 0x48, 0x48, 0x94, 0x72, 0x00,
-	0x00, 0x02, 0x00, 0x1D, 0x00, 0x00, 0x04, 0xFD, 0x05, 0xB0, 0x00, 0x04, 0x00, 0x09, 0x00, 0x17,
-	0x40, 0x0B, 0x00, 0x06, 0x08, 0x01, 0x09, 0x02, 0x72, 0x03, 0x08, 0x08, 0x72, 0x00, 0x2B, 0x32,
-	0x2B, 0x32, 0x12, 0x39, 0x39, 0x30, 0x31, 0x65, 0x01, 0x33, 0x01, 0x23, 0x01, 0x01, 0x17, 0x23,
-	0x01, 0x02, 0x7F, 0x01, 0xAD, 0xD1, 0xFD, 0xE5, 0x95, 0xFE, 0xA1, 0x01, 0xA9, 0x35, 0x95, 0xFD,
-	0xE6, 0xDD, 0x04, 0xD3, 0xFA, 0x50, 0x05, 0xB0, 0xFB, 0x2D, 0xDD, 0x05, 0xB0, 0x00, 0x00, 0x04,
-	0x00, 0x3D, 0x00, 0x00, 0x06, 0xED, 0x05, 0xB0, 0x00, 0x05, 0x00, 0x0A, 0x00, 0x0F, 0x00, 0x15,
-	0x00, 0x1B, 0x40, 0x0D, 0x10, 0x0C, 0x01, 0x0A, 0x02, 0x72, 0x13, 0x12, 0x0E, 0x04, 0x09, 0x08,
-	0x72, 0x00, 0x2B, 0x32, 0x32, 0x32, 0x32, 0x2B, 0x32, 0x32, 0x32, 0x30, 0x31, 0x41, 0x01, 0x33,
-	0x03, 0x01, 0x23, 0x03, 0x13, 0x13, 0x23, 0x01, 0x01, 0x13, 0x33, 0x01, 0x23, 0x01, 0x01, 0x13,
-	0x23, 0x01, 0x03, 0x02, 0x28, 0x01, 0x21, 0x8C, 0x51, 0xFE, 0xC9, 0x8B, 0xC5, 0xE6, 0x45, 0x8A,
-	0xFE, 0x9F, 0x05, 0x0E, 0xE1, 0xC1, 0xFE, 0xA0, 0x8A, 0xFE, 0xE7, 0x01, 0x19, 0x66, 0x8B, 0xFE,
-	0xD4, 0x52, 0x01, 0xB8, 0x03, 0xF8, 0xFE, 0x75, 0xFB, 0xDB, 0x05, 0xB0, 0xFC, 0x1C, 0xFE, 0x34,
-	0x05, 0xB0, 0xFC, 0x1D, 0x03, 0xE3, 0xFA, 0x50, 0x05, 0xB0, 0xFC, 0x08, 0xFE, 0x48, 0x04, 0x25,
-	0x01, 0x8B, 0x00, 0x01, 0x00, 0x3A, 0x00, 0x00, 0x04, 0xCE, 0x05, 0xB0, 0x00, 0x0B, 0x00, 0x1A,
-	0x40, 0x0E, 0x07, 0x04, 0x0A, 0x01, 0x04, 0x09, 0x03, 0x0B, 0x02, 0x72, 0x06, 0x09, 0x08, 0x72,
-	0x00, 0x2B, 0x32, 0x2B, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31, 0x49, 0x02, 0x33, 0x01, 0x01, 0x23,
-	0x01, 0x01, 0x23, 0x01, 0x01, 0x01, 0x26, 0x01, 0x5E, 0x01, 0x5E, 0xE1, 0xFE, 0x34, 0x01, 0xD7,
-	0xE3, 0xFE, 0x99, 0xFE, 0x99, 0xE3, 0x01, 0xD7, 0xFE, 0x34, 0x05, 0xB0, 0xFD, 0xD2, 0x02, 0x2E,
-	0xFD, 0x2F, 0xFD, 0x21, 0x02, 0x39, 0xFD, 0xC7, 0x02, 0xDF, 0x02, 0xD1, 0x00, 0x01, 0x00, 0x0F,
-	0x00, 0x00, 0x04, 0xBC, 0x05, 0xB0, 0x00, 0x08, 0x00, 0x17, 0x40, 0x0C, 0x04, 0x07, 0x01, 0x03,
-	0x06, 0x03, 0x08, 0x02, 0x72, 0x06, 0x08, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x12, 0x17, 0x39, 0x30,
-	0x31, 0x53, 0x01, 0x01, 0x33, 0x01, 0x11, 0x23, 0x11, 0x01, 0xEC, 0x01, 0x7A, 0x01, 0x7B, 0xDB,
-	0xFE, 0x0A, 0xC1, 0xFE, 0x0A, 0x05, 0xB0, 0xFD, 0x25, 0x02, 0xDB, 0xFC, 0x70, 0xFD, 0xE0, 0x02,
-	0x20, 0x03, 0x90, 0x00, 0x00, 0x03, 0x00, 0x57, 0x00, 0x00, 0x04, 0x7A, 0x05, 0xB0, 0x00, 0x03,
-	0x00, 0x09, 0x00, 0x0D, 0x00, 0x1F, 0x40, 0x0F, 0x04, 0x0C, 0x0C, 0x09, 0x0D, 0x02, 0x72, 0x07,
-	0x03, 0x03, 0x02, 0x02, 0x06, 0x08, 0x72, 0x00, 0x2B, 0x32, 0x11, 0x33, 0x11, 0x33, 0x2B, 0x32,
-	0x32, 0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x01, 0x23, 0x35, 0x01, 0x33, 0x23,
-	0x15, 0x21, 0x35, 0x04, 0x7A, 0xFC, 0x26, 0x03, 0xBA, 0xFC, 0x74, 0x77, 0x03, 0x8B, 0x78, 0x52,
-	0xFC, 0x5C, 0x9D, 0x9D, 0x9D, 0x04, 0x87, 0xFA, 0xDC, 0x90, 0x05, 0x20, 0x9E, 0x9E, 0x00, 0x01,
-	0x00, 0x93, 0xFE, 0xC8, 0x02, 0x0B, 0x06, 0x80, 0x00, 0x07, 0x00, 0x0E, 0xB4, 0x03, 0x06, 0x02,
-	0x07, 0x06, 0x00, 0x2F, 0x2F, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x23, 0x11, 0x33, 0x15,
-	0x21, 0x11, 0x02, 0x0B, 0xBF, 0xBF, 0xFE, 0x88, 0x06, 0x80, 0x98, 0xF9, 0x78, 0x98, 0x07, 0xB8,
-	0x00, 0x01, 0x00, 0x29, 0xFF, 0x83, 0x03, 0x39, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x09, 0xB2, 0x01,
-	0x02, 0x00, 0x00, 0x2F, 0x3F, 0x30, 0x31, 0x45, 0x01, 0x33, 0x01, 0x02, 0x89, 0xFD, 0xA0, 0xB0,
-	0x02, 0x60, 0x7D, 0x06, 0x2D, 0xF9, 0xD3, 0x00, 0x00, 0x01, 0x00, 0x0A, 0xFE, 0xC8, 0x01, 0x84,
-	0x06, 0x80, 0x00, 0x07, 0x00, 0x0E, 0xB4, 0x05, 0x04, 0x00, 0x01, 0x04, 0x00, 0x2F, 0x2F, 0x33,
-	0x11, 0x33, 0x30, 0x31, 0x53, 0x35, 0x21, 0x11, 0x21, 0x35, 0x33, 0x11, 0x0A, 0x01, 0x7A, 0xFE,
-	0x86, 0xC0, 0x05, 0xE8, 0x98, 0xF8, 0x48, 0x98, 0x06, 0x88, 0x00, 0x02, 0x00, 0x40, 0x02, 0xD9,
-	0x03, 0x15, 0x05, 0xB0, 0x00, 0x04, 0x00, 0x09, 0x00, 0x16, 0x40, 0x09, 0x08, 0x07, 0x07, 0x06,
-	0x00, 0x05, 0x02, 0x03, 0x02, 0x00, 0x3F, 0xCD, 0x32, 0x39, 0x39, 0x33, 0x11, 0x33, 0x30, 0x31,
-	0x41, 0x03, 0x23, 0x01, 0x33, 0x13, 0x03, 0x27, 0x33, 0x01, 0x01, 0xB7, 0xCB, 0xAC, 0x01, 0x2B,
-	0x70, 0x8E, 0xCA, 0x25, 0x71, 0x01, 0x2A, 0x04, 0xDA, 0xFD, 0xFF, 0x02, 0xD7, 0xFD, 0x29, 0x02,
-	0x01, 0xD6, 0xFD, 0x29, 0x00, 0x01, 0x00, 0x04, 0xFF, 0x68, 0x03, 0x99, 0x00, 0x00, 0x00, 0x03,
-	0x00, 0x08, 0xB1, 0x02, 0x03, 0x00, 0x2F, 0x33, 0x30, 0x31, 0x61, 0x15, 0x21, 0x35, 0x03, 0x99,
-	0xFC, 0x6B, 0x98, 0x98, 0x00, 0x01, 0x00, 0x39, 0x04, 0xDA, 0x01, 0xDA, 0x06, 0x00, 0x00, 0x03,
-	0x00, 0x0A, 0xB2, 0x03, 0x80, 0x02, 0x00, 0x2F, 0x1A, 0xCD, 0x30, 0x31, 0x41, 0x13, 0x23, 0x01,
-	0x01, 0x19, 0xC1, 0x9F, 0xFE, 0xFE, 0x06, 0x00, 0xFE, 0xDA, 0x01, 0x26, 0x00, 0x02, 0x00, 0x6D,
-	0xFF, 0xEC, 0x03, 0xEA, 0x04, 0x4E, 0x00, 0x1B, 0x00, 0x3A, 0x00, 0x29, 0x40, 0x15, 0x2B, 0x2C,
-	0x1E, 0x27, 0x1E, 0x3A, 0x3A, 0x0F, 0x27, 0x31, 0x0B, 0x72, 0x18, 0x19, 0x0A, 0x72, 0x09, 0x05,
-	0x0F, 0x07, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x2B, 0x32, 0x2B, 0x32, 0x12, 0x39, 0x2F, 0x33, 0x11,
-	0x12, 0x39, 0x39, 0x30, 0x31, 0x65, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23,
-	0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x14, 0x16, 0x17, 0x15, 0x23, 0x26, 0x26,
-	0x13, 0x17, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x17,
-	0x0E, 0x03, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x03, 0x0B, 0x33, 0x66, 0x4B,
-	0x46, 0x69, 0x3B, 0xB9, 0x3C, 0x71, 0x9F, 0x62, 0x76, 0xB5, 0x67, 0x13, 0x13, 0xC1, 0x0E, 0x10,
-	0x20, 0x02, 0xBB, 0x4F, 0x7C, 0x54, 0x2C, 0x2E, 0x5D, 0x44, 0x55, 0x82, 0x4D, 0x03, 0x4F, 0x07,
-	0x3E, 0x67, 0x8D, 0x58, 0x6E, 0xA5, 0x5B, 0x44, 0x80, 0xB4, 0x6F, 0xB9, 0x02, 0x2D, 0x40, 0x5F,
-	0x34, 0x30, 0x4E, 0x2D, 0x3A, 0x72, 0x5D, 0x37, 0x50, 0xA1, 0x79, 0xFE, 0x08, 0x36, 0x7A, 0x2C,
-	0x10, 0x20, 0x6B, 0x02, 0x05, 0x82, 0x19, 0x32, 0x4B, 0x32, 0x33, 0x54, 0x31, 0x48, 0x68, 0x31,
-	0x59, 0x2A, 0x66, 0x5D, 0x3D, 0x56, 0x91, 0x5A, 0x57, 0x85, 0x59, 0x2E, 0x00, 0x03, 0x00, 0x8C,
-	0xFF, 0xEC, 0x04, 0x21, 0x06, 0x00, 0x00, 0x04, 0x00, 0x1A, 0x00, 0x2F, 0x00, 0x19, 0x40, 0x0E,
-	0x21, 0x16, 0x07, 0x72, 0x2B, 0x0B, 0x0B, 0x72, 0x04, 0x0A, 0x72, 0x00, 0x00, 0x72, 0x00, 0x2B,
-	0x2B, 0x2B, 0x32, 0x2B, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x07, 0x23, 0x01, 0x15, 0x14, 0x0E,
-	0x02, 0x23, 0x22, 0x2E, 0x02, 0x27, 0x35, 0x3E, 0x03, 0x33, 0x32, 0x1E, 0x02, 0x07, 0x35, 0x34,
-	0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x07, 0x15, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x8C, 0xBA,
-	0x10, 0xAA, 0x03, 0x95, 0x38, 0x6C, 0x9C, 0x65, 0x67, 0x9B, 0x6A, 0x3F, 0x0C, 0x0C, 0x3F, 0x6A,
-	0x9A, 0x66, 0x66, 0x9E, 0x6B, 0x38, 0xBA, 0x1E, 0x42, 0x6C, 0x4F, 0x46, 0x67, 0x48, 0x2D, 0x0B,
-	0x10, 0x49, 0x7B, 0x5B, 0x4B, 0x6B, 0x43, 0x20, 0x06, 0x00, 0xFA, 0xD2, 0xD2, 0x02, 0x26, 0x15,
-	0x76, 0xC9, 0x94, 0x52, 0x47, 0x86, 0xBE, 0x77, 0x5C, 0x78, 0xBE, 0x87, 0x47, 0x4F, 0x92, 0xCB,
-	0x91, 0x15, 0x51, 0x8F, 0x6D, 0x3F, 0x30, 0x51, 0x67, 0x37, 0xF1, 0x46, 0x81, 0x52, 0x3D, 0x6C,
-	0x8E, 0x00, 0x00, 0x01, 0x00, 0x5D, 0xFF, 0xEC, 0x03, 0xED, 0x04, 0x4E, 0x00, 0x27, 0x00, 0x19,
-	0x40, 0x0C, 0x1D, 0x19, 0x19, 0x14, 0x07, 0x72, 0x04, 0x04, 0x00, 0x09, 0x0B, 0x72, 0x00, 0x2B,
-	0x32, 0x32, 0x2F, 0x2B, 0x32, 0x2F, 0x32, 0x30, 0x31, 0x65, 0x32, 0x36, 0x36, 0x37, 0x33, 0x0E,
-	0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23,
-	0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x02, 0x3E, 0x42, 0x70, 0x48,
-	0x05, 0xB0, 0x05, 0x77, 0xC0, 0x73, 0x7A, 0xB5, 0x77, 0x3B, 0x3B, 0x77, 0xB5, 0x7A, 0x7F, 0xBE,
-	0x6D, 0x05, 0xB0, 0x05, 0x41, 0x6F, 0x4A, 0x55, 0x73, 0x43, 0x1D, 0x1C, 0x43, 0x73, 0x84, 0x36,
-	0x5F, 0x3D, 0x60, 0xA5, 0x65, 0x56, 0x96, 0xC3, 0x6D, 0x2A, 0x6D, 0xC3, 0x96, 0x56, 0x67, 0xB1,
-	0x70, 0x43, 0x6C, 0x41, 0x43, 0x71, 0x89, 0x47, 0x2A, 0x47, 0x8A, 0x70, 0x43, 0x00, 0x00, 0x03,
-	0x00, 0x5F, 0xFF, 0xEC, 0x03, 0xF1, 0x06, 0x00, 0x00, 0x04, 0x00, 0x1A, 0x00, 0x2F, 0x00, 0x19,
-	0x40, 0x0D, 0x21, 0x04, 0x04, 0x16, 0x0B, 0x72, 0x2B, 0x0B, 0x07, 0x72, 0x01, 0x00, 0x72, 0x00,
-	0x2B, 0x2B, 0x32, 0x2B, 0x32, 0x2F, 0x32, 0x30, 0x31, 0x65, 0x11, 0x33, 0x11, 0x23, 0x01, 0x35,
-	0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x17, 0x15, 0x0E, 0x03, 0x23, 0x22, 0x2E, 0x02, 0x37,
-	0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x35, 0x2E, 0x03, 0x23, 0x22, 0x0E, 0x02,
-	0x03, 0x37, 0xBA, 0xAA, 0xFD, 0x18, 0x3D, 0x71, 0x9D, 0x61, 0x66, 0x99, 0x6B, 0x3E, 0x0C, 0x0B,
-	0x3F, 0x6B, 0x9A, 0x67, 0x5F, 0x9D, 0x71, 0x3D, 0xBA, 0x21, 0x46, 0x6C, 0x4B, 0x5C, 0x77, 0x48,
-	0x14, 0x0C, 0x2D, 0x47, 0x67, 0x46, 0x4C, 0x6D, 0x46, 0x21, 0xD2, 0x05, 0x2E, 0xFA, 0x00, 0x02,
-	0x11, 0x15, 0x7C, 0xCB, 0x92, 0x4F, 0x47, 0x87, 0xBE, 0x78, 0x5C, 0x77, 0xBE, 0x86, 0x47, 0x52,
-	0x94, 0xC9, 0x8B, 0x15, 0x51, 0x8E, 0x6C, 0x3D, 0x4E, 0x80, 0x4B, 0xF1, 0x37, 0x67, 0x51, 0x30,
-	0x3F, 0x6D, 0x8F, 0x00, 0x00, 0x01, 0x00, 0x5D, 0xFF, 0xEC, 0x03, 0xF3, 0x04, 0x4E, 0x00, 0x2B,
-	0x00, 0x1F, 0x40, 0x10, 0x67, 0x13, 0x01, 0x06, 0x13, 0x12, 0x12, 0x00, 0x19, 0x0B, 0x07, 0x72,
-	0x24, 0x00, 0x0B, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x11, 0x39, 0x2F, 0x33, 0x5F, 0x5D, 0x30,
-	0x31, 0x45, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x15,
-	0x21, 0x35, 0x21, 0x35, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33,
-	0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x02, 0x4E, 0x71, 0xB7, 0x83, 0x46, 0x4E, 0x86, 0xAA, 0x5B,
-	0x74, 0xA9, 0x6C, 0x34, 0xFC, 0xD8, 0x02, 0x6F, 0x04, 0x33, 0x6E, 0x5F, 0x3F, 0x6A, 0x4C, 0x2A,
-	0x2B, 0x53, 0x77, 0x4C, 0x62, 0x88, 0x33, 0x70, 0x23, 0x6C, 0x9D, 0x14, 0x4D, 0x8C, 0xC0, 0x72,
-	0x2A, 0x84, 0xCF, 0x90, 0x4A, 0x50, 0x8F, 0xC1, 0x72, 0x53, 0x97, 0x0E, 0x48, 0x88, 0x58, 0x35,
-	0x68, 0x96, 0x62, 0x2A, 0x4D, 0x87, 0x66, 0x3A, 0x50, 0x43, 0x59, 0x35, 0x60, 0x3C, 0x00, 0x02,
-	0x00, 0x3D, 0x00, 0x00, 0x02, 0xCB, 0x06, 0x15, 0x00, 0x11, 0x00, 0x15, 0x00, 0x15, 0x40, 0x0B,
-	0x14, 0x15, 0x06, 0x72, 0x0D, 0x06, 0x01, 0x72, 0x01, 0x0A, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x2B,
-	0x32, 0x30, 0x31, 0x61, 0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26,
-	0x23, 0x22, 0x06, 0x06, 0x15, 0x17, 0x15, 0x21, 0x35, 0x01, 0xA1, 0xB9, 0x55, 0xA0, 0x6E, 0x20,
-	0x41, 0x1F, 0x0A, 0x15, 0x35, 0x1A, 0x3B, 0x55, 0x2C, 0xE6, 0xFD, 0xB6, 0x04, 0xAC, 0x75, 0xA1,
-	0x53, 0x08, 0x08, 0x97, 0x05, 0x04, 0x2F, 0x5A, 0x42, 0x72, 0x8E, 0x8E, 0x00, 0x03, 0x00, 0x61,
-	0xFE, 0x55, 0x03, 0xF2, 0x04, 0x4E, 0x00, 0x13, 0x00, 0x29, 0x00, 0x3E, 0x00, 0x1B, 0x40, 0x0F,
-	0x30, 0x25, 0x0B, 0x72, 0x3A, 0x1A, 0x07, 0x72, 0x0E, 0x06, 0x0F, 0x72, 0x00, 0x06, 0x72, 0x00,
-	0x2B, 0x2B, 0x32, 0x2B, 0x32, 0x2B, 0x32, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23,
-	0x22, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x01, 0x35, 0x34,
-	0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x17, 0x15, 0x0E, 0x03, 0x23, 0x22, 0x2E, 0x02, 0x37, 0x15,
-	0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x35, 0x2E, 0x03, 0x23, 0x22, 0x0E, 0x02, 0x03,
-	0x4A, 0xA8, 0x74, 0xCF, 0x87, 0x38, 0x97, 0x91, 0x31, 0x61, 0x44, 0x95, 0x49, 0x58, 0x80, 0x47,
-	0xFD, 0x28, 0x3B, 0x6F, 0x9E, 0x63, 0x66, 0x99, 0x6B, 0x3E, 0x0C, 0x0B, 0x3F, 0x6B, 0x9A, 0x67,
-	0x61, 0x9D, 0x70, 0x3B, 0xB9, 0x21, 0x45, 0x6C, 0x4B, 0x5C, 0x78, 0x47, 0x14, 0x0B, 0x2D, 0x47,
-	0x68, 0x46, 0x4C, 0x6D, 0x45, 0x21, 0x04, 0x3A, 0xFB, 0xDD, 0x8F, 0xCA, 0x69, 0x23, 0x53, 0x46,
-	0x6E, 0x52, 0x40, 0x42, 0x81, 0x5E, 0x03, 0x3E, 0xFE, 0xC5, 0x15, 0x7C, 0xCB, 0x92, 0x4F, 0x47,
-	0x87, 0xBE, 0x78, 0x5C, 0x77, 0xBE, 0x86, 0x47, 0x52, 0x94, 0xC9, 0x8B, 0x15, 0x51, 0x8E, 0x6C,
-	0x3D, 0x4E, 0x80, 0x4B, 0xF1, 0x37, 0x67, 0x51, 0x30, 0x3F, 0x6D, 0x8F, 0x00, 0x02, 0x00, 0x8D,
-	0x00, 0x00, 0x03, 0xE0, 0x06, 0x00, 0x00, 0x03, 0x00, 0x1A, 0x00, 0x17, 0x40, 0x0C, 0x11, 0x02,
-	0x16, 0x0A, 0x07, 0x72, 0x03, 0x00, 0x72, 0x02, 0x0A, 0x72, 0x00, 0x2B, 0x2B, 0x2B, 0x32, 0x11,
-	0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13, 0x27, 0x3E, 0x03, 0x33, 0x32, 0x1E, 0x02, 0x15,
-	0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x01, 0x46, 0xB9, 0x8D, 0x4D, 0x01,
-	0x40, 0x74, 0xA1, 0x62, 0x50, 0x80, 0x5B, 0x30, 0xBA, 0x32, 0x60, 0x46, 0x45, 0x71, 0x51, 0x2D,
-	0x06, 0x00, 0xFA, 0x00, 0x06, 0x00, 0xFC, 0x46, 0x03, 0x6F, 0xBD, 0x8C, 0x4D, 0x2B, 0x5E, 0x95,
-	0x6B, 0xFD, 0x3B, 0x02, 0xC7, 0x55, 0x67, 0x2F, 0x3A, 0x66, 0x83, 0x00, 0x00, 0x02, 0x00, 0x8E,
-	0x00, 0x00, 0x01, 0x69, 0x05, 0xC4, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x10, 0xB7, 0x07, 0x0D, 0x03,
-	0x06, 0x72, 0x02, 0x0A, 0x72, 0x00, 0x2B, 0x2B, 0xCE, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11,
-	0x03, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x01, 0x56, 0xBA, 0x0E,
-	0x37, 0x36, 0x35, 0x39, 0x39, 0x35, 0x36, 0x37, 0x04, 0x3A, 0xFB, 0xC6, 0x04, 0x3A, 0x01, 0x1F,
-	0x2D, 0x3E, 0x3E, 0x2D, 0x2B, 0x3D, 0x3D, 0x00, 0x00, 0x02, 0xFF, 0xBE, 0xFE, 0x4B, 0x01, 0x5A,
-	0x05, 0xC4, 0x00, 0x11, 0x00, 0x1D, 0x00, 0x13, 0x40, 0x09, 0x0D, 0x06, 0x0F, 0x72, 0x15, 0x1B,
-	0x00, 0x06, 0x72, 0x00, 0x2B, 0xCE, 0x32, 0x2B, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x14, 0x06,
-	0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x03, 0x34, 0x36,
-	0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x92, 0xBA, 0x3F, 0x7D, 0x5F, 0x19, 0x43,
-	0x17, 0x01, 0x13, 0x30, 0x12, 0x29, 0x38, 0x1D, 0x13, 0x38, 0x35, 0x36, 0x38, 0x38, 0x36, 0x35,
-	0x38, 0x04, 0x3A, 0xFB, 0x45, 0x63, 0x8A, 0x47, 0x0A, 0x07, 0x95, 0x04, 0x05, 0x1E, 0x42, 0x37,
-	0x05, 0xDA, 0x2D, 0x3E, 0x3E, 0x2D, 0x2B, 0x3D, 0x3D, 0x00, 0x00, 0x03, 0x00, 0x8D, 0x00, 0x00,
-	0x04, 0x0D, 0x06, 0x00, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x1D, 0x40, 0x11, 0x06, 0x07,
-	0x0B, 0x05, 0x0C, 0x08, 0x06, 0x02, 0x09, 0x06, 0x03, 0x00, 0x72, 0x0A, 0x02, 0x0A, 0x72, 0x00,
-	0x2B, 0x32, 0x2B, 0x3F, 0x12, 0x17, 0x39, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x09, 0x02, 0x27,
-	0x37, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x47, 0xBA, 0x03, 0x4F, 0xFE, 0x28, 0xFE, 0xF8, 0x0F,
-	0xBD, 0x01, 0x50, 0x39, 0xFE, 0x7E, 0x60, 0x01, 0xFC, 0x06, 0x00, 0xFA, 0x00, 0x06, 0x00, 0xFE,
-	0x3A, 0xFE, 0x07, 0xFE, 0xEE, 0xC5, 0xE2, 0x01, 0x64, 0xFB, 0xC6, 0x02, 0x04, 0xA5, 0xFD, 0x57,
-	0x00, 0x01, 0x00, 0x9C, 0x00, 0x00, 0x01, 0x56, 0x06, 0x00, 0x00, 0x03, 0x00, 0x0C, 0xB5, 0x03,
-	0x00, 0x72, 0x02, 0x0A, 0x72, 0x00, 0x2B, 0x2B, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x56,
-	0xBA, 0x06, 0x00, 0xFA, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x8B, 0x00, 0x00, 0x06, 0x79,
-	0x04, 0x4E, 0x00, 0x04, 0x00, 0x1B, 0x00, 0x32, 0x00, 0x21, 0x40, 0x11, 0x29, 0x12, 0x02, 0x2E,
-	0x22, 0x22, 0x17, 0x0B, 0x03, 0x06, 0x72, 0x0B, 0x07, 0x72, 0x02, 0x0A, 0x72, 0x00, 0x2B, 0x2B,
-	0x2B, 0x11, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x33,
-	0x03, 0x27, 0x3E, 0x03, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23,
-	0x22, 0x0E, 0x02, 0x25, 0x07, 0x3E, 0x03, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34,
-	0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x01, 0x45, 0xBA, 0xB0, 0x1C, 0x56, 0x01, 0x38, 0x6E, 0xA4,
-	0x6C, 0x4C, 0x80, 0x5E, 0x34, 0xB9, 0x39, 0x68, 0x46, 0x52, 0x6E, 0x42, 0x1D, 0x02, 0xBD, 0x7C,
-	0x01, 0x39, 0x6D, 0xA0, 0x67, 0x57, 0x87, 0x5D, 0x30, 0xBA, 0x39, 0x67, 0x47, 0x3D, 0x5E, 0x40,
-	0x21, 0x03, 0x63, 0xFC, 0x9D, 0x04, 0x3A, 0xFE, 0x0C, 0x03, 0x6F, 0xBD, 0x8C, 0x4D, 0x2B, 0x5C,
-	0x90, 0x66, 0xFD, 0x2F, 0x02, 0xC8, 0x55, 0x66, 0x2F, 0x3A, 0x66, 0x83, 0x1D, 0x26, 0x59, 0xA4,
-	0x80, 0x4B, 0x2E, 0x5F, 0x94, 0x66, 0xFD, 0x39, 0x02, 0xC9, 0x5B, 0x65, 0x29, 0x2A, 0x49, 0x5E,
-	0x00, 0x02, 0x00, 0x8D, 0x00, 0x00, 0x03, 0xE0, 0x04, 0x4E, 0x00, 0x04, 0x00, 0x1B, 0x00, 0x19,
-	0x40, 0x0D, 0x12, 0x02, 0x17, 0x0B, 0x03, 0x06, 0x72, 0x0B, 0x07, 0x72, 0x02, 0x0A, 0x72, 0x00,
-	0x2B, 0x2B, 0x2B, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x33, 0x03, 0x27,
-	0x3E, 0x03, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0E,
-	0x02, 0x01, 0x46, 0xB9, 0xAF, 0x22, 0x4D, 0x01, 0x40, 0x74, 0xA1, 0x62, 0x50, 0x80, 0x5B, 0x30,
-	0xBA, 0x32, 0x60, 0x46, 0x45, 0x71, 0x51, 0x2D, 0x03, 0x53, 0xFC, 0xAD, 0x04, 0x3A, 0xFE, 0x0C,
-	0x03, 0x6F, 0xBD, 0x8C, 0x4D, 0x2B, 0x5E, 0x95, 0x6B, 0xFD, 0x3B, 0x02, 0xC7, 0x55, 0x67, 0x2F,
-	0x3A, 0x66, 0x83, 0x00, 0x00, 0x02, 0x00, 0x5C, 0xFF, 0xEC, 0x04, 0x35, 0x04, 0x4E, 0x00, 0x15,
-	0x00, 0x2B, 0x00, 0x10, 0xB7, 0x1C, 0x11, 0x0B, 0x72, 0x27, 0x06, 0x07, 0x72, 0x00, 0x2B, 0x32,
-	0x2B, 0x32, 0x30, 0x31, 0x53, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14,
-	0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x37, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35,
-	0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x5C, 0x44, 0x80, 0xB6, 0x71, 0x72, 0xB7, 0x81,
-	0x44, 0x44, 0x81, 0xB5, 0x72, 0x72, 0xB6, 0x81, 0x44, 0xB9, 0x26, 0x4D, 0x74, 0x4D, 0x4C, 0x73,
-	0x4C, 0x27, 0x27, 0x4D, 0x73, 0x4D, 0x4C, 0x73, 0x4D, 0x26, 0x02, 0x11, 0x17, 0x75, 0xC9, 0x95,
-	0x53, 0x53, 0x95, 0xC9, 0x75, 0x17, 0x75, 0xC8, 0x95, 0x53, 0x53, 0x95, 0xC8, 0x8C, 0x17, 0x51,
-	0x8F, 0x6E, 0x3F, 0x3F, 0x6E, 0x8F, 0x51, 0x17, 0x50, 0x8F, 0x6F, 0x40, 0x40, 0x6F, 0x8F, 0x00,
-	0x00, 0x03, 0x00, 0x8C, 0xFE, 0x60, 0x04, 0x1F, 0x04, 0x4E, 0x00, 0x04, 0x00, 0x1A, 0x00, 0x2F,
-	0x00, 0x19, 0x40, 0x0E, 0x21, 0x16, 0x07, 0x72, 0x2B, 0x0B, 0x0B, 0x72, 0x03, 0x06, 0x72, 0x02,
-	0x0E, 0x72, 0x00, 0x2B, 0x2B, 0x2B, 0x32, 0x2B, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x33,
-	0x01, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x27, 0x35, 0x3E, 0x03, 0x33, 0x32, 0x1E,
-	0x02, 0x07, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x07, 0x11, 0x1E, 0x02, 0x33, 0x32,
-	0x3E, 0x02, 0x01, 0x46, 0xBA, 0xAA, 0x02, 0xE9, 0x38, 0x6B, 0x9C, 0x65, 0x67, 0x9E, 0x6E, 0x41,
-	0x0C, 0x0C, 0x42, 0x6D, 0x9C, 0x66, 0x66, 0x9E, 0x6C, 0x37, 0xBA, 0x22, 0x47, 0x6E, 0x4C, 0x46,
-	0x67, 0x48, 0x2D, 0x0B, 0x14, 0x48, 0x78, 0x5B, 0x4B, 0x6D, 0x47, 0x22, 0x03, 0x6A, 0xFA, 0xF6,
-	0x05, 0xDA, 0xFD, 0xEC, 0x15, 0x76, 0xC9, 0x94, 0x52, 0x44, 0x82, 0xB6, 0x72, 0x70, 0x78, 0xBE,
-	0x87, 0x47, 0x4F, 0x92, 0xCB, 0x91, 0x15, 0x51, 0x8F, 0x6D, 0x3F, 0x30, 0x51, 0x67, 0x37, 0xFE,
-	0xFD, 0x46, 0x7B, 0x4B, 0x3F, 0x6E, 0x8F, 0x00, 0x00, 0x03, 0x00, 0x5F, 0xFE, 0x60, 0x03, 0xF0,
-	0x04, 0x4E, 0x00, 0x04, 0x00, 0x1A, 0x00, 0x2F, 0x00, 0x19, 0x40, 0x0E, 0x21, 0x16, 0x0B, 0x72,
-	0x2B, 0x0B, 0x07, 0x72, 0x04, 0x0E, 0x72, 0x03, 0x06, 0x72, 0x00, 0x2B, 0x2B, 0x2B, 0x32, 0x2B,
-	0x32, 0x30, 0x31, 0x41, 0x11, 0x37, 0x33, 0x11, 0x01, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E,
-	0x02, 0x17, 0x15, 0x0E, 0x03, 0x23, 0x22, 0x2E, 0x02, 0x37, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32,
-	0x36, 0x36, 0x37, 0x35, 0x2E, 0x03, 0x23, 0x22, 0x0E, 0x02, 0x03, 0x36, 0x10, 0xAA, 0xFC, 0x6F,
-	0x3A, 0x70, 0x9F, 0x66, 0x66, 0x9B, 0x6D, 0x40, 0x0C, 0x0B, 0x40, 0x6D, 0x9D, 0x67, 0x64, 0x9F,
-	0x6F, 0x3B, 0xBA, 0x22, 0x47, 0x6D, 0x4B, 0x5C, 0x7B, 0x4A, 0x14, 0x0B, 0x2F, 0x4A, 0x69, 0x46,
-	0x4C, 0x6E, 0x47, 0x22, 0xFE, 0x60, 0x05, 0x0A, 0xD0, 0xFA, 0x26, 0x03, 0xB1, 0x15, 0x7C, 0xCB,
-	0x92, 0x4F, 0x47, 0x87, 0xBE, 0x78, 0x5C, 0x77, 0xBE, 0x86, 0x47, 0x52, 0x94, 0xC9, 0x8B, 0x15,
-	0x51, 0x8F, 0x6E, 0x3F, 0x50, 0x83, 0x4B, 0xF1, 0x37, 0x68, 0x53, 0x31, 0x40, 0x6F, 0x90, 0x00,
-	0x00, 0x02, 0x00, 0x8D, 0x00, 0x00, 0x02, 0x98, 0x04, 0x4E, 0x00, 0x04, 0x00, 0x16, 0x00, 0x19,
-	0x40, 0x0D, 0x06, 0x09, 0x09, 0x05, 0x14, 0x07, 0x72, 0x03, 0x06, 0x72, 0x02, 0x0A, 0x72, 0x00,
-	0x2B, 0x2B, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x33, 0x25, 0x07,
-	0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x07, 0x07, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x01, 0x46,
-	0xB9, 0xB4, 0x01, 0x57, 0x01, 0x17, 0x29, 0x1A, 0x40, 0x62, 0x44, 0x27, 0x06, 0x34, 0x27, 0x52,
-	0x7F, 0x58, 0x14, 0x34, 0x03, 0x90, 0xFC, 0x70, 0x04, 0x3A, 0x06, 0xAC, 0x05, 0x03, 0x28, 0x48,
-	0x63, 0x3B, 0x1E, 0x62, 0xAC, 0x85, 0x4B, 0x09, 0x00, 0x01, 0x00, 0x5F, 0xFF, 0xEC, 0x03, 0xBC,
-	0x04, 0x4E, 0x00, 0x35, 0x00, 0x17, 0x40, 0x0B, 0x1B, 0x00, 0x0E, 0x32, 0x29, 0x0B, 0x72, 0x17,
-	0x0E, 0x07, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x11, 0x39, 0x39, 0x30, 0x31, 0x41, 0x34, 0x26,
-	0x26, 0x27, 0x2E, 0x03, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26,
-	0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1E, 0x02, 0x17, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02,
-	0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x03, 0x03, 0x23, 0x6B,
-	0x6B, 0x5A, 0x91, 0x65, 0x36, 0x39, 0x69, 0x94, 0x5B, 0x82, 0xB8, 0x62, 0xB9, 0x35, 0x65, 0x49,
-	0x4D, 0x5F, 0x2B, 0x15, 0x36, 0x62, 0x4C, 0x85, 0xAC, 0x54, 0x3B, 0x6F, 0x99, 0x5F, 0x8F, 0xC6,
-	0x66, 0xBA, 0x04, 0x50, 0x74, 0x39, 0x4C, 0x67, 0x36, 0x01, 0x1F, 0x28, 0x45, 0x39, 0x15, 0x13,
-	0x34, 0x4A, 0x64, 0x43, 0x40, 0x72, 0x58, 0x32, 0x5C, 0x99, 0x5D, 0x2D, 0x55, 0x38, 0x2F, 0x48,
-	0x28, 0x1E, 0x2F, 0x27, 0x22, 0x11, 0x1E, 0x54, 0x7A, 0x57, 0x47, 0x76, 0x55, 0x2F, 0x66, 0xA2,
-	0x5A, 0x4C, 0x59, 0x25, 0x28, 0x46, 0x00, 0x02, 0x00, 0x09, 0xFF, 0xEC, 0x02, 0x57, 0x05, 0x41,
-	0x00, 0x03, 0x00, 0x15, 0x00, 0x13, 0x40, 0x09, 0x0A, 0x11, 0x0B, 0x72, 0x04, 0x02, 0x03, 0x06,
-	0x72, 0x00, 0x2B, 0x32, 0x2F, 0x2B, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x33, 0x11,
-	0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x02,
-	0x52, 0xFD, 0xB7, 0xC6, 0xB9, 0x22, 0x36, 0x1F, 0x17, 0x33, 0x0D, 0x01, 0x16, 0x47, 0x32, 0x44,
-	0x72, 0x43, 0x04, 0x3A, 0x8E, 0x8E, 0x01, 0x07, 0xFB, 0xCB, 0x37, 0x38, 0x12, 0x09, 0x03, 0x97,
-	0x07, 0x0D, 0x36, 0x7F, 0x6C, 0x00, 0x00, 0x02, 0x00, 0x89, 0xFF, 0xEC, 0x03, 0xDD, 0x04, 0x3A,
-	0x00, 0x04, 0x00, 0x1B, 0x00, 0x15, 0x40, 0x0A, 0x01, 0x11, 0x06, 0x72, 0x18, 0x03, 0x03, 0x0B,
-	0x0B, 0x72, 0x00, 0x2B, 0x32, 0x2F, 0x32, 0x2B, 0x32, 0x30, 0x31, 0x65, 0x11, 0x33, 0x11, 0x23,
-	0x13, 0x37, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1E, 0x02,
-	0x33, 0x32, 0x36, 0x36, 0x03, 0x23, 0xBA, 0xB1, 0x1A, 0x4D, 0x2D, 0x64, 0xA2, 0x74, 0x4F, 0x83,
-	0x5E, 0x33, 0xB9, 0x21, 0x39, 0x47, 0x26, 0x76, 0x8A, 0x3D, 0xFA, 0x03, 0x40, 0xFB, 0xC6, 0x01,
-	0xDE, 0x02, 0x6C, 0xB7, 0x86, 0x4B, 0x2E, 0x60, 0x9A, 0x6C, 0x02, 0xBA, 0xFD, 0x44, 0x49, 0x5F,
-	0x37, 0x16, 0x5B, 0x9B, 0x00, 0x02, 0x00, 0x21, 0x00, 0x00, 0x03, 0xBB, 0x04, 0x3A, 0x00, 0x04,
-	0x00, 0x09, 0x00, 0x17, 0x40, 0x0B, 0x00, 0x06, 0x08, 0x01, 0x09, 0x06, 0x72, 0x03, 0x08, 0x0A,
-	0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x12, 0x39, 0x39, 0x30, 0x31, 0x65, 0x01, 0x33, 0x01, 0x23,
-	0x03, 0x01, 0x17, 0x23, 0x01, 0x01, 0xD6, 0x01, 0x28, 0xBD, 0xFE, 0x7B, 0x7C, 0xDB, 0x01, 0x31,
-	0x15, 0x7C, 0xFE, 0x78, 0xA7, 0x03, 0x93, 0xFB, 0xC6, 0x04, 0x3A, 0xFC, 0x68, 0xA2, 0x04, 0x3A,
-	0x00, 0x04, 0x00, 0x2B, 0x00, 0x00, 0x05, 0xD3, 0x04, 0x3A, 0x00, 0x05, 0x00, 0x0A, 0x00, 0x0F,
-	0x00, 0x15, 0x00, 0x24, 0x40, 0x14, 0x07, 0x0B, 0x00, 0x11, 0x03, 0x14, 0x06, 0x09, 0x10, 0x0C,
-	0x01, 0x0A, 0x06, 0x72, 0x12, 0x0E, 0x04, 0x09, 0x0A, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x32, 0x2B,
-	0x32, 0x32, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31, 0x65, 0x01, 0x33, 0x07, 0x01, 0x23, 0x03, 0x13,
-	0x17, 0x23, 0x01, 0x01, 0x13, 0x33, 0x01, 0x23, 0x03, 0x01, 0x17, 0x23, 0x01, 0x27, 0x01, 0x9F,
-	0x01, 0x16, 0x7A, 0x18, 0xFE, 0xE5, 0x77, 0xA1, 0xED, 0x11, 0x7D, 0xFE, 0xC6, 0x04, 0x0E, 0xE2,
-	0xB8, 0xFE, 0xC6, 0x7C, 0xD3, 0x01, 0x10, 0x1F, 0x76, 0xFE, 0xDD, 0x18, 0xC0, 0x03, 0x7A, 0xB1,
-	0xFC, 0x77, 0x04, 0x3A, 0xFC, 0x7C, 0xB6, 0x04, 0x3A, 0xFC, 0x83, 0x03, 0x7D, 0xFB, 0xC6, 0x04,
-	0x3A, 0xFC, 0x95, 0xCF, 0x03, 0x8B, 0xAF, 0x00, 0x00, 0x01, 0x00, 0x2A, 0x00, 0x00, 0x03, 0xCB,
-	0x04, 0x3A, 0x00, 0x0B, 0x00, 0x1A, 0x40, 0x0E, 0x07, 0x04, 0x0A, 0x01, 0x04, 0x09, 0x03, 0x0B,
-	0x06, 0x72, 0x06, 0x09, 0x0A, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31,
-	0x41, 0x13, 0x13, 0x33, 0x01, 0x01, 0x23, 0x03, 0x03, 0x23, 0x01, 0x01, 0x01, 0x0A, 0xED, 0xF0,
-	0xD9, 0xFE, 0x9E, 0x01, 0x6D, 0xD6, 0xFA, 0xFA, 0xD7, 0x01, 0x6C, 0xFE, 0x9F, 0x04, 0x3A, 0xFE,
-	0x76, 0x01, 0x8A, 0xFD, 0xEA, 0xFD, 0xDC, 0x01, 0x96, 0xFE, 0x6A, 0x02, 0x24, 0x02, 0x16, 0x00,
-	0x00, 0x02, 0x00, 0x16, 0xFE, 0x4B, 0x03, 0xB0, 0x04, 0x3A, 0x00, 0x13, 0x00, 0x18, 0x00, 0x19,
-	0x40, 0x0D, 0x17, 0x16, 0x15, 0x03, 0x08, 0x02, 0x18, 0x06, 0x72, 0x0F, 0x08, 0x0F, 0x72, 0x00,
-	0x2B, 0x32, 0x2B, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31, 0x65, 0x01, 0x33, 0x01, 0x0E, 0x03, 0x23,
-	0x22, 0x26, 0x27, 0x27, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x03, 0x01, 0x17, 0x07, 0x01,
-	0x01, 0xBD, 0x01, 0x2D, 0xC6, 0xFE, 0x4E, 0x0F, 0x31, 0x4C, 0x6B, 0x4A, 0x16, 0x44, 0x0E, 0x01,
-	0x08, 0x23, 0x07, 0x3F, 0x58, 0x3D, 0x16, 0x90, 0x01, 0x19, 0x30, 0x85, 0xFE, 0x72, 0x70, 0x03,
-	0xCA, 0xFB, 0x1F, 0x28, 0x5D, 0x54, 0x35, 0x0C, 0x04, 0x96, 0x01, 0x03, 0x21, 0x4D, 0x43, 0x04,
-	0x9C, 0xFC, 0xB8, 0xC3, 0x44, 0x04, 0x4F, 0x00, 0x00, 0x03, 0x00, 0x59, 0x00, 0x00, 0x03, 0xB3,
-	0x04, 0x3A, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x1C, 0x40, 0x0D, 0x04, 0x0C, 0x0C, 0x09,
-	0x0D, 0x06, 0x72, 0x07, 0x03, 0x03, 0x06, 0x02, 0x12, 0x00, 0x3F, 0x33, 0x33, 0x11, 0x33, 0x2B,
-	0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x01, 0x23, 0x35, 0x01, 0x33,
-	0x23, 0x15, 0x21, 0x35, 0x03, 0xB3, 0xFC, 0xED, 0x02, 0xF6, 0xFD, 0x34, 0x71, 0x02, 0xC7, 0x76,
-	0x52, 0xFD, 0x1D, 0x98, 0x98, 0x98, 0x03, 0x1F, 0xFC, 0x49, 0x88, 0x03, 0xB2, 0x99, 0x99, 0x00,
-	0x00, 0x02, 0x00, 0x40, 0xFE, 0x92, 0x02, 0x9F, 0x06, 0x3D, 0x00, 0x11, 0x00, 0x25, 0x00, 0x19,
-	0x40, 0x0A, 0x1D, 0x09, 0x0A, 0x0A, 0x1C, 0x1C, 0x12, 0x13, 0x01, 0x00, 0x00, 0x2F, 0x32, 0x2F,
-	0x33, 0x39, 0x2F, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x17, 0x06, 0x06, 0x15, 0x15, 0x14,
-	0x06, 0x06, 0x23, 0x35, 0x32, 0x36, 0x35, 0x35, 0x34, 0x36, 0x36, 0x13, 0x07, 0x2E, 0x02, 0x35,
-	0x35, 0x34, 0x26, 0x26, 0x23, 0x35, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x16, 0x16, 0x02, 0x78,
-	0x27, 0x77, 0x5A, 0x51, 0xAF, 0x8E, 0x71, 0x63, 0x41, 0x9B, 0xAF, 0x27, 0x88, 0x9B, 0x41, 0x2C,
-	0x5D, 0x4B, 0x8E, 0xAF, 0x51, 0x27, 0x5B, 0x06, 0x3D, 0x72, 0x25, 0xBF, 0x7B, 0xCF, 0x64, 0xA3,
-	0x60, 0x7A, 0x80, 0x6D, 0xCF, 0x69, 0xB7, 0x8B, 0xF8, 0xEE, 0x73, 0x27, 0x8A, 0xB7, 0x69, 0xCE,
-	0x49, 0x6A, 0x3B, 0x7A, 0x60, 0xA3, 0x65, 0xCE, 0x52, 0x8C, 0x67, 0x00, 0x00, 0x01, 0x00, 0xB0,
-	0xFE, 0xF2, 0x01, 0x45, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x09, 0xB2, 0x00, 0x02, 0x01, 0x00, 0x2F,
-	0x3F, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x45, 0x95, 0x05, 0xB0, 0xF9, 0x42, 0x06, 0xBE,
-	0x00, 0x02, 0x00, 0x14, 0xFE, 0x92, 0x02, 0x73, 0x06, 0x3D, 0x00, 0x13, 0x00, 0x26, 0x00, 0x1B,
-	0x40, 0x0B, 0x1E, 0x0B, 0x0A, 0x0A, 0x1F, 0x1F, 0x01, 0x15, 0x14, 0x00, 0x01, 0x00, 0x2F, 0x33,
-	0x2F, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x53, 0x37, 0x1E, 0x02, 0x15,
-	0x15, 0x14, 0x16, 0x16, 0x33, 0x15, 0x22, 0x26, 0x26, 0x35, 0x35, 0x34, 0x26, 0x26, 0x03, 0x27,
-	0x3E, 0x02, 0x35, 0x35, 0x34, 0x36, 0x36, 0x33, 0x15, 0x22, 0x06, 0x15, 0x15, 0x14, 0x06, 0x06,
-	0x14, 0x27, 0x89, 0x9B, 0x40, 0x2C, 0x5D, 0x4B, 0x8D, 0xB0, 0x51, 0x26, 0x5B, 0x29, 0x27, 0x4F,
-	0x5B, 0x27, 0x51, 0xB0, 0x8D, 0x70, 0x64, 0x40, 0x9B, 0x05, 0xCB, 0x72, 0x26, 0x8B, 0xB7, 0x69,
-	0xCF, 0x48, 0x6B, 0x3A, 0x71, 0x5B, 0x9F, 0x64, 0xCF, 0x52, 0x8D, 0x67, 0xF8, 0xE0, 0x73, 0x19,
-	0x67, 0x8C, 0x52, 0xCE, 0x65, 0x9E, 0x5B, 0x70, 0x81, 0x6D, 0xCE, 0x69, 0xB7, 0x8A, 0x00, 0x01,
-	0x00, 0x83, 0x01, 0x93, 0x04, 0xEF, 0x03, 0x23, 0x00, 0x1F, 0x00, 0x1B, 0x40, 0x0B, 0x0C, 0x00,
-	0x00, 0x16, 0x06, 0x80, 0x1C, 0x06, 0x10, 0x10, 0x06, 0x00, 0x2F, 0x33, 0x2F, 0x11, 0x33, 0x1A,
-	0x10, 0xCD, 0x32, 0x2F, 0x32, 0x30, 0x31, 0x41, 0x37, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x27,
-	0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x07, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x17, 0x16,
-	0x16, 0x33, 0x32, 0x36, 0x36, 0x04, 0x57, 0x98, 0x2F, 0x57, 0x77, 0x47, 0x57, 0x85, 0x4E, 0x33,
-	0x56, 0x32, 0x33, 0x48, 0x27, 0xA1, 0x2F, 0x56, 0x77, 0x47, 0x58, 0x89, 0x49, 0x37, 0x53, 0x31,
-	0x34, 0x4D, 0x2B, 0x03, 0x09, 0x01, 0x4D, 0x88, 0x67, 0x3B, 0x46, 0x44, 0x2F, 0x34, 0x31, 0x5A,
-	0x3F, 0x02, 0x4E, 0x86, 0x64, 0x37, 0x4A, 0x41, 0x32, 0x31, 0x36, 0x60, 0x00, 0x02, 0x00, 0x8B,
-	0xFE, 0x97, 0x01, 0x66, 0x04, 0x4D, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x0C, 0xB3, 0x01, 0x07, 0x0D,
-	0x00, 0x00, 0x2F, 0x2F, 0xDD, 0xCE, 0x30, 0x31, 0x53, 0x13, 0x33, 0x13, 0x13, 0x14, 0x06, 0x23,
-	0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x9D, 0x0E, 0xA7, 0x0E, 0x06, 0x37, 0x36, 0x35,
-	0x39, 0x39, 0x35, 0x36, 0x37, 0xFE, 0x97, 0x04, 0x15, 0xFB, 0xEB, 0x05, 0x4D, 0x2C, 0x3E, 0x3E,
-	0x2C, 0x2C, 0x3D, 0x3D, 0x00, 0x03, 0x00, 0x69, 0xFF, 0x0B, 0x03, 0xFA, 0x05, 0x26, 0x00, 0x03,
-	0x00, 0x07, 0x00, 0x2F, 0x00, 0x25, 0x40, 0x12, 0x02, 0x01, 0x25, 0x25, 0x21, 0x03, 0x1C, 0x07,
-	0x72, 0x07, 0x04, 0x08, 0x08, 0x0C, 0x06, 0x11, 0x0D, 0x72, 0x00, 0x2B, 0xCD, 0xCC, 0x33, 0x12,
-	0x39, 0x39, 0x2B, 0xCD, 0xCC, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13,
-	0x11, 0x23, 0x11, 0x37, 0x32, 0x36, 0x36, 0x37, 0x33, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35,
-	0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02,
-	0x15, 0x15, 0x14, 0x1E, 0x02, 0x02, 0x9E, 0xBA, 0xBA, 0xBA, 0x67, 0x42, 0x70, 0x48, 0x05, 0xB0,
-	0x05, 0x78, 0xBF, 0x73, 0x7A, 0xB6, 0x77, 0x3B, 0x3B, 0x78, 0xB5, 0x7A, 0x7F, 0xBE, 0x6D, 0x05,
-	0xB0, 0x05, 0x41, 0x6F, 0x4A, 0x55, 0x73, 0x43, 0x1D, 0x1C, 0x43, 0x73, 0x05, 0x26, 0xFE, 0xE0,
-	0x01, 0x20, 0xFB, 0x04, 0xFE, 0xE1, 0x01, 0x1F, 0x5A, 0x36, 0x5F, 0x3D, 0x60, 0xA5, 0x65, 0x56,
-	0x96, 0xC3, 0x6D, 0x2A, 0x6D, 0xC3, 0x96, 0x56, 0x67, 0xB1, 0x70, 0x43, 0x6C, 0x41, 0x43, 0x71,
-	0x89, 0x47, 0x2A, 0x47, 0x8A, 0x70, 0x43, 0x00, 0x00, 0x03, 0x00, 0x5B, 0x00, 0x00, 0x04, 0x68,
-	0x05, 0xC4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x22, 0x00, 0x21, 0x40, 0x10, 0x06, 0x05, 0x05, 0x01,
-	0x1F, 0x16, 0x05, 0x72, 0x0C, 0x0D, 0x0D, 0x02, 0x02, 0x01, 0x0C, 0x72, 0x00, 0x2B, 0x32, 0x11,
-	0x33, 0x11, 0x33, 0x2B, 0x32, 0x11, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x61, 0x21, 0x35, 0x21, 0x01,
-	0x21, 0x35, 0x21, 0x01, 0x13, 0x16, 0x06, 0x07, 0x27, 0x3E, 0x02, 0x35, 0x03, 0x34, 0x36, 0x36,
-	0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x04, 0x68, 0xFB,
-	0xF7, 0x04, 0x09, 0xFE, 0x93, 0xFD, 0x60, 0x02, 0xA0, 0xFE, 0xB8, 0x16, 0x01, 0x38, 0x38, 0xAE,
-	0x23, 0x29, 0x11, 0x16, 0x74, 0xC9, 0x7F, 0x83, 0xB8, 0x62, 0xC0, 0x43, 0x6C, 0x3E, 0x42, 0x6B,
-	0x3F, 0x9D, 0x01, 0xD2, 0x9D, 0x01, 0x03, 0xFD, 0x83, 0x5E, 0xA3, 0x29, 0x35, 0x09, 0x53, 0x6C,
-	0x2C, 0x02, 0x7E, 0x8A, 0xC3, 0x68, 0x62, 0xAF, 0x74, 0x54, 0x66, 0x2E, 0x41, 0x7D, 0x00, 0x06,
-	0x00, 0x69, 0xFF, 0xE5, 0x05, 0x5B, 0x04, 0xF1, 0x00, 0x13, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F,
-	0x00, 0x33, 0x00, 0x37, 0x00, 0x0E, 0xB5, 0x0F, 0x19, 0x05, 0x23, 0x0D, 0x72, 0x00, 0x2B, 0x32,
-	0x2F, 0x33, 0x30, 0x31, 0x41, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02,
-	0x23, 0x22, 0x0E, 0x02, 0x07, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02,
-	0x23, 0x22, 0x2E, 0x02, 0x01, 0x07, 0x27, 0x37, 0x01, 0x07, 0x27, 0x37, 0x01, 0x27, 0x37, 0x17,
-	0x01, 0x27, 0x37, 0x17, 0x01, 0x38, 0x42, 0x74, 0x99, 0x58, 0x58, 0x99, 0x74, 0x41, 0x41, 0x74,
-	0x99, 0x58, 0x58, 0x99, 0x74, 0x42, 0xAC, 0x5D, 0xA3, 0xD8, 0x7B, 0x7B, 0xD8, 0xA4, 0x5C, 0x5C,
-	0xA4, 0xD8, 0x7B, 0x7B, 0xD8, 0xA3, 0x5D, 0x04, 0xCF, 0xCA, 0x84, 0xCA, 0xFC, 0xDF, 0xCA, 0x83,
-	0xCA, 0x03, 0xA4, 0xCA, 0x84, 0xCA, 0xFB, 0xD8, 0xCA, 0x83, 0xCA, 0x02, 0x60, 0x5E, 0xA6, 0x7D,
-	0x47, 0x47, 0x7D, 0xA6, 0x5E, 0x5F, 0xA4, 0x7D, 0x46, 0x46, 0x7D, 0xA4, 0x5F, 0x85, 0xE4, 0xAA,
-	0x5F, 0x5F, 0xAA, 0xE4, 0x85, 0x85, 0xE4, 0xAB, 0x60, 0x60, 0xAB, 0xE4, 0x02, 0x8D, 0xCE, 0x89,
-	0xCE, 0xFB, 0xC3, 0xCE, 0x88, 0xCD, 0xFE, 0xAA, 0xCE, 0x88, 0xCD, 0x03, 0x2C, 0xCE, 0x88, 0xCE,
-	0x00, 0x05, 0x00, 0x0F, 0x00, 0x00, 0x04, 0x24, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0C,
-	0x00, 0x11, 0x00, 0x15, 0x00, 0x2D, 0x40, 0x16, 0x0B, 0x10, 0x10, 0x06, 0x07, 0x12, 0x15, 0x15,
-	0x08, 0x0E, 0x03, 0x03, 0x02, 0x02, 0x11, 0x14, 0x0C, 0x72, 0x09, 0x11, 0x04, 0x72, 0x00, 0x2B,
-	0x32, 0x2B, 0x12, 0x39, 0x2F, 0x33, 0x12, 0x39, 0x39, 0x32, 0x11, 0x33, 0xCE, 0x32, 0x33, 0x11,
-	0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x25, 0x01, 0x33, 0x01, 0x23,
-	0x01, 0x01, 0x07, 0x23, 0x01, 0x01, 0x11, 0x23, 0x11, 0x03, 0xBB, 0xFC, 0xBD, 0x03, 0x43, 0xFC,
-	0xBD, 0x01, 0x68, 0x01, 0x6F, 0xD5, 0xFE, 0x4F, 0x7B, 0xFE, 0xF0, 0x01, 0x71, 0x1D, 0x7A, 0xFE,
-	0x4D, 0x02, 0x67, 0xC0, 0x02, 0xE1, 0x7D, 0x7D, 0xFE, 0xDD, 0x7C, 0x7C, 0xDC, 0x03, 0x16, 0xFC,
-	0xAC, 0x03, 0x54, 0xFC, 0xE3, 0x37, 0x03, 0x54, 0xFD, 0x56, 0xFC, 0xFA, 0x03, 0x06, 0x00, 0x02,
-	0x00, 0x94, 0xFE, 0xF2, 0x01, 0x4D, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0D, 0xB4, 0x01,
-	0x02, 0x06, 0x07, 0x02, 0x00, 0x3F, 0xDD, 0xDE, 0xCD, 0x30, 0x31, 0x41, 0x23, 0x11, 0x33, 0x11,
-	0x11, 0x23, 0x11, 0x01, 0x4D, 0xB9, 0xB9, 0xB9, 0xFE, 0xF2, 0x03, 0x18, 0x03, 0xA6, 0xFD, 0x0A,
-	0x02, 0xF6, 0x00, 0x02, 0x00, 0x5B, 0xFE, 0x11, 0x04, 0x79, 0x05, 0xC5, 0x00, 0x2F, 0x00, 0x61,
-	0x00, 0x1E, 0x40, 0x13, 0x53, 0x3F, 0x00, 0x01, 0x05, 0x2B, 0x5D, 0x35, 0x31, 0x30, 0x0F, 0x21,
-	0x0C, 0x4F, 0x44, 0x1D, 0x14, 0x11, 0x72, 0x00, 0x2B, 0x32, 0x2F, 0x33, 0x17, 0x39, 0x30, 0x31,
-	0x65, 0x35, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2E, 0x02, 0x27, 0x2E, 0x03, 0x35, 0x34, 0x3E, 0x02,
-	0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1E,
-	0x02, 0x17, 0x1E, 0x03, 0x15, 0x14, 0x0E, 0x02, 0x01, 0x15, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1E,
-	0x02, 0x17, 0x1E, 0x03, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x37, 0x14, 0x1E,
-	0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2E, 0x02, 0x27, 0x2E, 0x03, 0x35, 0x34, 0x3E, 0x02,
-	0x02, 0xBB, 0x53, 0x74, 0x3E, 0x23, 0x52, 0x8A, 0x66, 0x6D, 0xAB, 0x77, 0x3E, 0x45, 0x80, 0xB4,
-	0x70, 0x99, 0xDC, 0x76, 0xB9, 0x47, 0x88, 0x63, 0x69, 0x86, 0x41, 0x1F, 0x4C, 0x89, 0x69, 0x70,
-	0xAE, 0x78, 0x3F, 0x3F, 0x75, 0xA5, 0xFE, 0xED, 0x53, 0x6C, 0x34, 0x1F, 0x4E, 0x8B, 0x6B, 0x6F,
-	0xAC, 0x76, 0x3E, 0x45, 0x80, 0xB3, 0x6F, 0x60, 0xBA, 0x97, 0x59, 0xB9, 0x3C, 0x63, 0x77, 0x3B,
-	0x60, 0x87, 0x47, 0x22, 0x50, 0x88, 0x65, 0x6D, 0xAE, 0x78, 0x40, 0x3C, 0x70, 0x9E, 0x6C, 0x76,
-	0x34, 0x5C, 0x3A, 0x2F, 0x47, 0x3B, 0x37, 0x1F, 0x1E, 0x45, 0x5F, 0x85, 0x5D, 0x53, 0x87, 0x60,
-	0x34, 0x64, 0xC0, 0x8B, 0x4D, 0x7F, 0x4B, 0x3A, 0x60, 0x3A, 0x32, 0x48, 0x38, 0x33, 0x1D, 0x1F,
-	0x47, 0x5F, 0x86, 0x5D, 0x4C, 0x78, 0x53, 0x2C, 0x02, 0xFE, 0x79, 0x34, 0x5A, 0x3A, 0x32, 0x49,
-	0x3A, 0x34, 0x1E, 0x1F, 0x46, 0x5D, 0x84, 0x5D, 0x57, 0x88, 0x5E, 0x31, 0x2C, 0x64, 0xA6, 0x79,
-	0x02, 0x4F, 0x6D, 0x40, 0x1D, 0x38, 0x60, 0x3C, 0x2F, 0x45, 0x39, 0x36, 0x1E, 0x1E, 0x47, 0x60,
-	0x87, 0x5D, 0x4A, 0x77, 0x54, 0x2E, 0x00, 0x02, 0x00, 0x65, 0x04, 0xF1, 0x02, 0xEF, 0x05, 0xC6,
-	0x00, 0x0B, 0x00, 0x17, 0x00, 0x0E, 0xB4, 0x03, 0x09, 0x09, 0x0F, 0x15, 0x00, 0x2F, 0x33, 0x33,
-	0x2F, 0x33, 0x30, 0x31, 0x53, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26,
-	0x25, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x65, 0x38, 0x35, 0x36,
-	0x38, 0x38, 0x36, 0x35, 0x38, 0x01, 0xAF, 0x37, 0x36, 0x35, 0x39, 0x39, 0x35, 0x36, 0x37, 0x05,
-	0x5B, 0x2D, 0x3E, 0x3E, 0x2D, 0x2B, 0x3D, 0x3D, 0x29, 0x2D, 0x3E, 0x3E, 0x2D, 0x2B, 0x3D, 0x3D,
-	0x00, 0x03, 0x00, 0x5C, 0xFF, 0xEB, 0x05, 0xE7, 0x05, 0xC4, 0x00, 0x1F, 0x00, 0x33, 0x00, 0x47,
-	0x00, 0x1F, 0x40, 0x0E, 0x1D, 0x04, 0x04, 0x25, 0x25, 0x43, 0x14, 0x0D, 0x0D, 0x2F, 0x2F, 0x39,
-	0x03, 0x72, 0x00, 0x2B, 0x32, 0x11, 0x33, 0x11, 0x33, 0x2F, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30,
-	0x31, 0x41, 0x33, 0x14, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
-	0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32,
-	0x36, 0x25, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E,
-	0x02, 0x07, 0x34, 0x12, 0x36, 0x24, 0x33, 0x32, 0x04, 0x16, 0x12, 0x15, 0x14, 0x02, 0x06, 0x04,
-	0x23, 0x22, 0x24, 0x26, 0x02, 0x03, 0xCE, 0x92, 0xB3, 0x99, 0x6A, 0x9B, 0x55, 0x55, 0x9B, 0x6A,
-	0x99, 0xB4, 0x92, 0x5F, 0x5C, 0x42, 0x5A, 0x2E, 0x2E, 0x5A, 0x42, 0x5C, 0x5E, 0xFD, 0x01, 0x5C,
-	0xA4, 0xD8, 0x7B, 0x7B, 0xD7, 0xA3, 0x5C, 0x5C, 0xA3, 0xD7, 0x7B, 0x7B, 0xD8, 0xA4, 0x5C, 0x73,
-	0x6E, 0xC4, 0x01, 0x01, 0x93, 0x93, 0x01, 0x01, 0xC3, 0x6E, 0x6E, 0xC3, 0xFE, 0xFF, 0x93, 0x93,
-	0xFE, 0xFF, 0xC4, 0x6E, 0x02, 0x56, 0x9D, 0x9D, 0x62, 0xAE, 0x73, 0x73, 0x73, 0xAE, 0x62, 0x9C,
-	0x9D, 0x63, 0x56, 0x42, 0x75, 0x4B, 0x74, 0x4C, 0x75, 0x42, 0x56, 0xE7, 0x85, 0xE6, 0xAC, 0x60,
-	0x60, 0xAC, 0xE6, 0x85, 0x86, 0xE4, 0xAB, 0x5F, 0x5F, 0xAB, 0xE4, 0x86, 0x9F, 0x01, 0x10, 0xCB,
-	0x71, 0x71, 0xCB, 0xFE, 0xF0, 0x9F, 0x9F, 0xFE, 0xF0, 0xCD, 0x72, 0x72, 0xCD, 0x01, 0x10, 0x00,
-	0x00, 0x02, 0x00, 0x93, 0x02, 0xB4, 0x03, 0x10, 0x05, 0xC5, 0x00, 0x17, 0x00, 0x31, 0x00, 0x1A,
-	0xB5, 0x31, 0x1A, 0x1A, 0x0D, 0x16, 0x2A, 0xB8, 0x01, 0x00, 0xB2, 0x08, 0x0D, 0x03, 0x00, 0x3F,
-	0x33, 0x1A, 0xDC, 0xC4, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x11, 0x34, 0x26, 0x26, 0x23,
-	0x22, 0x06, 0x15, 0x27, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x14, 0x16, 0x17,
-	0x23, 0x26, 0x13, 0x17, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35,
-	0x17, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x02, 0x53, 0x1B, 0x37, 0x2A,
-	0x45, 0x4F, 0xA1, 0x4D, 0x8B, 0x5D, 0x56, 0x81, 0x48, 0x0C, 0x0E, 0xA5, 0x18, 0x28, 0x01, 0x95,
-	0x3C, 0x4F, 0x26, 0x3D, 0x40, 0x2B, 0x57, 0x3A, 0x12, 0x0F, 0x3F, 0x63, 0x44, 0x78, 0x81, 0x4B,
-	0x97, 0x71, 0x03, 0x5E, 0x01, 0x54, 0x2B, 0x3C, 0x1F, 0x35, 0x34, 0x0D, 0x44, 0x69, 0x3C, 0x3E,
-	0x7A, 0x5C, 0xFE, 0xC6, 0x31, 0x58, 0x2C, 0x4B, 0x01, 0x70, 0x6F, 0x20, 0x34, 0x20, 0x2B, 0x32,
-	0x27, 0x38, 0x19, 0x70, 0x20, 0x44, 0x2D, 0x7B, 0x67, 0x4A, 0x67, 0x36, 0xFF, 0xFF, 0x00, 0x65,
-	0x00, 0x96, 0x03, 0x65, 0x03, 0xB2, 0x04, 0x26, 0x01, 0x92, 0xF9, 0xFD, 0x00, 0x07, 0x01, 0x92,
-	0x01, 0x44, 0xFF, 0xFD, 0x00, 0x02, 0x00, 0x7F, 0x01, 0x78, 0x03, 0xBE, 0x03, 0x21, 0x00, 0x03,
-	0x00, 0x07, 0x00, 0x12, 0xB6, 0x06, 0x07, 0x03, 0x06, 0x02, 0x02, 0x03, 0x00, 0x2F, 0x33, 0x11,
-	0x33, 0x12, 0x39, 0x2F, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x05, 0x11, 0x23, 0x11, 0x03, 0xBE,
-	0xFC, 0xC1, 0x03, 0x3F, 0xB9, 0x03, 0x21, 0xA2, 0xA2, 0x4B, 0xFE, 0xA2, 0x01, 0x5E, 0x00, 0x04,
-	0x00, 0x5B, 0xFF, 0xEB, 0x05, 0xE6, 0x05, 0xC4, 0x00, 0x1E, 0x00, 0x2F, 0x00, 0x43, 0x00, 0x57,
-	0x00, 0x35, 0x40, 0x1B, 0x1F, 0x1B, 0x18, 0x20, 0x04, 0x02, 0x02, 0x01, 0x01, 0x0F, 0x29, 0x0D,
-	0x0D, 0x35, 0x35, 0x53, 0x0C, 0x0F, 0x0F, 0x49, 0x53, 0x13, 0x72, 0x3F, 0x49, 0x03, 0x72, 0x00,
-	0x2B, 0x32, 0x2B, 0x12, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2F, 0x33, 0x12, 0x39, 0x7D,
-	0x2F, 0x33, 0x12, 0x17, 0x39, 0x30, 0x31, 0x41, 0x23, 0x27, 0x33, 0x3E, 0x02, 0x35, 0x34, 0x26,
-	0x26, 0x23, 0x23, 0x11, 0x23, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x22,
-	0x06, 0x23, 0x0E, 0x02, 0x23, 0x37, 0x32, 0x16, 0x15, 0x15, 0x14, 0x16, 0x17, 0x15, 0x23, 0x26,
-	0x26, 0x35, 0x35, 0x34, 0x26, 0x25, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E,
-	0x02, 0x23, 0x22, 0x0E, 0x02, 0x07, 0x34, 0x12, 0x36, 0x24, 0x33, 0x32, 0x04, 0x16, 0x12, 0x15,
-	0x14, 0x02, 0x06, 0x04, 0x23, 0x22, 0x24, 0x26, 0x02, 0x03, 0x3B, 0xDA, 0x02, 0xCB, 0x2A, 0x49,
-	0x2D, 0x22, 0x4F, 0x44, 0x88, 0x8D, 0x01, 0x15, 0x63, 0x90, 0x4E, 0x32, 0x60, 0x45, 0x03, 0x07,
-	0x03, 0x11, 0x09, 0x09, 0x1E, 0x14, 0x9B, 0x71, 0x08, 0x09, 0x91, 0x0A, 0x03, 0x43, 0xFD, 0x4D,
-	0x5C, 0xA4, 0xD8, 0x7B, 0x7B, 0xD7, 0xA3, 0x5C, 0x5C, 0xA3, 0xD7, 0x7B, 0x7B, 0xD8, 0xA4, 0x5C,
-	0x73, 0x6E, 0xC4, 0x01, 0x01, 0x93, 0x93, 0x01, 0x01, 0xC3, 0x6E, 0x6E, 0xC3, 0xFE, 0xFF, 0x93,
-	0x93, 0xFE, 0xFF, 0xC4, 0x6E, 0x02, 0x8F, 0x80, 0x01, 0x1C, 0x35, 0x27, 0x32, 0x3A, 0x1A, 0xFD,
-	0x2F, 0x03, 0x50, 0x38, 0x71, 0x56, 0x36, 0x56, 0x3E, 0x13, 0x0D, 0x0A, 0x09, 0x02, 0x5A, 0x83,
-	0x64, 0x36, 0x25, 0x43, 0x17, 0x10, 0x1A, 0x60, 0x16, 0x34, 0x49, 0x45, 0x4A, 0x85, 0xE6, 0xAC,
-	0x60, 0x60, 0xAC, 0xE6, 0x85, 0x86, 0xE4, 0xAB, 0x5F, 0x5F, 0xAB, 0xE4, 0x86, 0x9F, 0x01, 0x10,
-	0xCB, 0x71, 0x71, 0xCB, 0xFE, 0xF0, 0x9F, 0x9F, 0xFE, 0xF0, 0xCD, 0x72, 0x72, 0xCD, 0x01, 0x10,
-	0x00, 0x01, 0x00, 0x8F, 0x05, 0x17, 0x03, 0x2E, 0x05, 0xA5, 0x00, 0x03, 0x00, 0x08, 0xB1, 0x03,
-	0x02, 0x00, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x03, 0x2E, 0xFD, 0x61, 0x05, 0xA5,
-	0x8E, 0x8E, 0x00, 0x02, 0x00, 0x83, 0x03, 0xC0, 0x02, 0x7D, 0x05, 0xC5, 0x00, 0x0F, 0x00, 0x1B,
-	0x00, 0x0F, 0xB5, 0x13, 0x0C, 0xC0, 0x19, 0x04, 0x03, 0x00, 0x3F, 0x33, 0x1A, 0xCC, 0x32, 0x30,
-	0x31, 0x53, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26,
-	0x26, 0x37, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x83, 0x46, 0x74,
-	0x45, 0x45, 0x72, 0x44, 0x44, 0x72, 0x45, 0x45, 0x74, 0x46, 0x7C, 0x4D, 0x36, 0x36, 0x49, 0x49,
-	0x36, 0x36, 0x4D, 0x04, 0xC1, 0x47, 0x76, 0x47, 0x47, 0x76, 0x47, 0x47, 0x75, 0x45, 0x45, 0x75,
-	0x47, 0x37, 0x4A, 0x4A, 0x37, 0x38, 0x4C, 0x4C, 0x00, 0x03, 0x00, 0x61, 0x00, 0x01, 0x03, 0xF5,
-	0x04, 0xF3, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x12, 0xB7, 0x0B, 0x02, 0x03, 0x03, 0x04,
-	0x0A, 0x12, 0x72, 0x00, 0x2B, 0x2F, 0x39, 0x2F, 0x33, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35,
-	0x01, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x03, 0xF5, 0xFC, 0x6C, 0x02, 0x29, 0xA7, 0x01,
-	0xE8, 0xFC, 0xBD, 0x03, 0x57, 0x98, 0x98, 0x01, 0x9C, 0xFC, 0x2E, 0x03, 0xD2, 0xFB, 0xA5, 0x97,
-	0x97, 0x00, 0x00, 0x01, 0x00, 0x42, 0x02, 0x9B, 0x02, 0xAB, 0x05, 0xBB, 0x00, 0x1C, 0x00, 0x13,
-	0xB1, 0x1C, 0x02, 0xB8, 0x01, 0x00, 0xB3, 0x0B, 0x13, 0x03, 0x72, 0x00, 0x2B, 0x32, 0x1A, 0xCC,
-	0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
-	0x15, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x07, 0x02,
-	0xAB, 0xFD, 0xAA, 0x01, 0x20, 0x2D, 0x34, 0x17, 0x40, 0x3B, 0x4B, 0x47, 0x9E, 0x48, 0x86, 0x5E,
-	0x5A, 0x80, 0x44, 0x2F, 0x56, 0x3B, 0xAF, 0x03, 0x1B, 0x80, 0x6C, 0x01, 0x0F, 0x2A, 0x42, 0x35,
-	0x16, 0x30, 0x3E, 0x4C, 0x39, 0x48, 0x76, 0x47, 0x3A, 0x69, 0x49, 0x35, 0x5C, 0x5C, 0x35, 0x92,
-	0x00, 0x02, 0x00, 0x3F, 0x02, 0x90, 0x02, 0x9B, 0x05, 0xBB, 0x00, 0x19, 0x00, 0x33, 0x00, 0x2C,
-	0x40, 0x0C, 0x1C, 0x18, 0x00, 0x00, 0x1A, 0x1A, 0x10, 0x2C, 0x29, 0x29, 0x24, 0x10, 0xB8, 0x01,
-	0x00, 0xB5, 0x0B, 0x0B, 0x08, 0x10, 0x03, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x2F, 0x1A, 0x10, 0xCC,
-	0x32, 0x2F, 0x32, 0x11, 0x39, 0x2F, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x33, 0x32, 0x36,
-	0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
-	0x15, 0x14, 0x06, 0x06, 0x23, 0x23, 0x15, 0x35, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
-	0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
-	0x01, 0x0A, 0x54, 0x31, 0x40, 0x21, 0x40, 0x45, 0x39, 0x4B, 0x9D, 0x4C, 0x82, 0x50, 0x57, 0x84,
-	0x4A, 0x41, 0x7B, 0x58, 0x6F, 0x6F, 0x64, 0x80, 0x3E, 0x50, 0x8B, 0x57, 0x4B, 0x89, 0x56, 0x9D,
-	0x50, 0x42, 0x46, 0x49, 0x27, 0x47, 0x31, 0x04, 0x66, 0x1C, 0x31, 0x20, 0x2C, 0x3C, 0x32, 0x2B,
-	0x44, 0x63, 0x36, 0x33, 0x64, 0x49, 0x35, 0x59, 0x35, 0x25, 0x4E, 0x30, 0x5A, 0x40, 0x49, 0x68,
-	0x36, 0x31, 0x68, 0x51, 0x2D, 0x3D, 0x3E, 0x31, 0x2A, 0x33, 0x17, 0x00, 0x00, 0x01, 0x00, 0x7B,
-	0x04, 0xDA, 0x02, 0x1C, 0x06, 0x00, 0x00, 0x03, 0x00, 0x0A, 0xB2, 0x01, 0x80, 0x00, 0x00, 0x2F,
-	0x1A, 0xCD, 0x30, 0x31, 0x53, 0x13, 0x33, 0x01, 0x7B, 0xC2, 0xDF, 0xFE, 0xF4, 0x04, 0xDA, 0x01,
-	0x26, 0xFE, 0xDA, 0x00, 0x00, 0x03, 0x00, 0x9B, 0xFE, 0x60, 0x03, 0xEE, 0x04, 0x3A, 0x00, 0x04,
-	0x00, 0x1A, 0x00, 0x1E, 0x00, 0x19, 0x40, 0x0C, 0x1D, 0x05, 0x00, 0x16, 0x0B, 0x13, 0x72, 0x03,
-	0x12, 0x72, 0x1C, 0x00, 0x00, 0x2F, 0x32, 0x2B, 0x2B, 0x32, 0x11, 0x39, 0x2F, 0x30, 0x31, 0x41,
-	0x33, 0x11, 0x23, 0x27, 0x37, 0x37, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x27, 0x03, 0x33,
-	0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x01, 0x33, 0x11, 0x23, 0x03, 0x35, 0xB9, 0xA7, 0x12,
-	0x21, 0x45, 0x29, 0x56, 0x86, 0x5E, 0x4C, 0x77, 0x55, 0x1C, 0x25, 0x74, 0x22, 0x3D, 0x50, 0x2E,
-	0x59, 0x73, 0x40, 0x1A, 0xFD, 0x45, 0xB8, 0xB8, 0x04, 0x3A, 0xFB, 0xC6, 0xFA, 0xFD, 0x02, 0x72,
-	0xC0, 0x8E, 0x4E, 0x27, 0x55, 0x44, 0x01, 0x21, 0x67, 0x82, 0x46, 0x1A, 0x37, 0x64, 0x88, 0x02,
-	0x94, 0xFA, 0x26, 0x00, 0x00, 0x01, 0x00, 0x44, 0x00, 0x00, 0x03, 0x41, 0x05, 0xB0, 0x00, 0x0C,
-	0x00, 0x0E, 0xB6, 0x03, 0x0B, 0x02, 0x72, 0x00, 0x12, 0x72, 0x00, 0x2B, 0x2B, 0xCD, 0x30, 0x31,
-	0x61, 0x23, 0x11, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x21, 0x03, 0x41, 0xBA,
-	0x57, 0x9F, 0xDC, 0x71, 0x71, 0xDC, 0x9F, 0x01, 0x11, 0x02, 0x08, 0x79, 0xD4, 0x87, 0x86, 0xD4,
-	0x7A, 0x00, 0x00, 0x01, 0x00, 0x94, 0x02, 0x6C, 0x01, 0x79, 0x03, 0x49, 0x00, 0x0B, 0x00, 0x08,
-	0xB1, 0x03, 0x09, 0x00, 0x2F, 0x33, 0x30, 0x31, 0x53, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
-	0x06, 0x23, 0x22, 0x26, 0x94, 0x3A, 0x38, 0x38, 0x3B, 0x3B, 0x38, 0x38, 0x3A, 0x02, 0xD9, 0x2F,
-	0x41, 0x41, 0x2F, 0x2E, 0x3F, 0x3F, 0x00, 0x01, 0x00, 0x74, 0xFE, 0x4D, 0x01, 0xAA, 0x00, 0x00,
-	0x00, 0x13, 0x00, 0x11, 0xB6, 0x0B, 0x0A, 0x80, 0x13, 0x02, 0x00, 0x12, 0x00, 0x3F, 0x32, 0x32,
-	0x1A, 0xCC, 0x32, 0x30, 0x31, 0x73, 0x33, 0x07, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x27,
-	0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x27, 0x98, 0x85, 0x0C, 0x3A, 0x5F, 0x27, 0x4C, 0x71,
-	0x4B, 0x07, 0x2E, 0x4B, 0x2D, 0x22, 0x47, 0x38, 0x35, 0x0A, 0x4C, 0x57, 0x2F, 0x4D, 0x37, 0x1E,
-	0x6B, 0x14, 0x2C, 0x23, 0x21, 0x26, 0x13, 0x04, 0x00, 0x01, 0x00, 0x7B, 0x02, 0x9B, 0x01, 0xEF,
-	0x05, 0xB0, 0x00, 0x06, 0x00, 0x0A, 0xB3, 0x06, 0x02, 0x72, 0x01, 0x00, 0x2F, 0x2B, 0x30, 0x31,
-	0x41, 0x11, 0x23, 0x11, 0x07, 0x35, 0x25, 0x01, 0xEF, 0x9C, 0xD8, 0x01, 0x62, 0x05, 0xB0, 0xFC,
-	0xEB, 0x02, 0x59, 0x39, 0x81, 0x74, 0x00, 0x02, 0x00, 0x7B, 0x02, 0xB3, 0x03, 0x27, 0x05, 0xC5,
-	0x00, 0x11, 0x00, 0x23, 0x00, 0x10, 0xB6, 0x17, 0x0E, 0x20, 0x05, 0x03, 0x72, 0x0E, 0x00, 0x2F,
-	0x2B, 0x32, 0x11, 0x33, 0x30, 0x31, 0x53, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
-	0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36,
-	0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x7B, 0x54, 0x99, 0x69, 0x6A, 0x99,
-	0x53, 0x53, 0x98, 0x69, 0x6A, 0x9A, 0x54, 0xA3, 0x27, 0x51, 0x3D, 0x3C, 0x4F, 0x27, 0x28, 0x4F,
-	0x3D, 0x3C, 0x50, 0x27, 0x04, 0x13, 0x51, 0x67, 0x9F, 0x5B, 0x5B, 0x9F, 0x67, 0x51, 0x67, 0x9F,
-	0x5A, 0x5A, 0x9F, 0xB8, 0x51, 0x3D, 0x60, 0x38, 0x38, 0x60, 0x3D, 0x51, 0x3C, 0x60, 0x38, 0x38,
-	0x60, 0x00, 0xFF, 0xFF, 0x00, 0x67, 0x00, 0x99, 0x03, 0x79, 0x03, 0xB5, 0x04, 0x26, 0x01, 0x93,
-	0x0D, 0x00, 0x00, 0x07, 0x01, 0x93, 0x01, 0x6A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x55, 0x00, 0x00,
-	0x05, 0x92, 0x05, 0xAD, 0x04, 0x27, 0x01, 0xE0, 0xFF, 0xDA, 0x02, 0x98, 0x00, 0x27, 0x01, 0x94,
-	0x01, 0x18, 0x00, 0x08, 0x00, 0x07, 0x02, 0x3A, 0x02, 0xD6, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x50,
-	0x00, 0x00, 0x05, 0xC9, 0x05, 0xAD, 0x04, 0x27, 0x01, 0x94, 0x00, 0xEC, 0x00, 0x08, 0x00, 0x27,
-	0x01, 0xE0, 0xFF, 0xD5, 0x02, 0x98, 0x00, 0x07, 0x01, 0xDF, 0x03, 0x1E, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x70, 0x00, 0x00, 0x05, 0xEE, 0x05, 0xBB, 0x04, 0x27, 0x01, 0x94, 0x01, 0x97, 0x00, 0x08,
-	0x00, 0x27, 0x02, 0x3A, 0x03, 0x32, 0x00, 0x00, 0x00, 0x07, 0x02, 0x39, 0x00, 0x31, 0x02, 0x9B,
-	0x00, 0x02, 0x00, 0x44, 0xFE, 0x7E, 0x03, 0x79, 0x04, 0x4E, 0x00, 0x21, 0x00, 0x2D, 0x00, 0x18,
-	0x40, 0x0A, 0x00, 0x00, 0x25, 0x25, 0x2B, 0x10, 0x11, 0x11, 0x0D, 0x16, 0x00, 0x2F, 0x33, 0x33,
-	0x2F, 0x3F, 0x33, 0x2F, 0x33, 0x2F, 0x30, 0x31, 0x41, 0x33, 0x0E, 0x02, 0x07, 0x0E, 0x02, 0x15,
-	0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x33, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35,
-	0x34, 0x36, 0x36, 0x37, 0x3E, 0x02, 0x13, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33,
-	0x32, 0x16, 0x01, 0x93, 0xBA, 0x01, 0x21, 0x49, 0x3E, 0x2A, 0x4C, 0x30, 0x34, 0x64, 0x48, 0x3B,
-	0x66, 0x41, 0xB9, 0x01, 0x6D, 0xB9, 0x74, 0x82, 0xB7, 0x61, 0x49, 0x70, 0x3C, 0x24, 0x27, 0x0F,
-	0xC2, 0x38, 0x35, 0x36, 0x38, 0x38, 0x36, 0x35, 0x38, 0x02, 0xA8, 0x60, 0x77, 0x64, 0x43, 0x2D,
-	0x54, 0x64, 0x45, 0x49, 0x64, 0x33, 0x2C, 0x5B, 0x45, 0x71, 0xA5, 0x58, 0x5A, 0xAA, 0x78, 0x5B,
-	0x9B, 0x85, 0x3A, 0x23, 0x4D, 0x58, 0x01, 0x6E, 0x2C, 0x3E, 0x3E, 0x2C, 0x2C, 0x3D, 0x3D, 0x00,
-	0x00, 0x06, 0xFF, 0xF1, 0x00, 0x00, 0x07, 0x58, 0x05, 0xB0, 0x00, 0x04, 0x00, 0x08, 0x00, 0x0C,
-	0x00, 0x10, 0x00, 0x14, 0x00, 0x18, 0x00, 0x31, 0x40, 0x18, 0x00, 0x17, 0x17, 0x08, 0x07, 0x14,
-	0x13, 0x07, 0x13, 0x07, 0x13, 0x02, 0x0D, 0x03, 0x18, 0x02, 0x72, 0x0C, 0x0B, 0x0B, 0x0E, 0x02,
-	0x08, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x32, 0x11, 0x39, 0x39, 0x2F, 0x2F,
-	0x11, 0x33, 0x11, 0x33, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x33, 0x13, 0x15,
-	0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x03, 0x13, 0x23, 0x03, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15,
-	0x21, 0x35, 0x03, 0xCA, 0xFD, 0x0A, 0xE3, 0x03, 0x71, 0x77, 0x82, 0xFD, 0x19, 0x05, 0xE4, 0xFD,
-	0x23, 0x1A, 0x3D, 0xBA, 0x3D, 0x03, 0x22, 0xFD, 0x8A, 0x02, 0xC7, 0xFD, 0x24, 0x05, 0x1B, 0xFA,
-	0xE5, 0x05, 0xB0, 0xFC, 0x60, 0xAF, 0xAF, 0xFE, 0x88, 0x98, 0x98, 0x05, 0x18, 0xFA, 0x50, 0x05,
-	0xB0, 0xFD, 0x92, 0x98, 0x98, 0x02, 0x6E, 0x98, 0x98, 0x00, 0x00, 0x02, 0x00, 0x59, 0x00, 0xCE,
-	0x03, 0xDE, 0x04, 0x64, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0C, 0xB3, 0x04, 0x06, 0x02, 0x00, 0x00,
-	0x2F, 0x2F, 0x33, 0x32, 0x30, 0x31, 0x77, 0x27, 0x01, 0x17, 0x03, 0x01, 0x37, 0x01, 0xD0, 0x77,
-	0x03, 0x0B, 0x77, 0x74, 0xFC, 0xF5, 0x77, 0x03, 0x0B, 0xCE, 0x7B, 0x03, 0x1B, 0x7C, 0xFC, 0xE6,
-	0x03, 0x1A, 0x7C, 0xFC, 0xE5, 0x00, 0x00, 0x03, 0x00, 0x77, 0xFF, 0xA3, 0x05, 0x1D, 0x05, 0xEC,
-	0x00, 0x03, 0x00, 0x1B, 0x00, 0x33, 0x00, 0x17, 0x40, 0x0B, 0x01, 0x00, 0x2F, 0x0A, 0x23, 0x16,
-	0x03, 0x72, 0x0A, 0x09, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x11, 0x33, 0x32, 0x33, 0x30, 0x31, 0x41,
-	0x01, 0x23, 0x01, 0x13, 0x15, 0x14, 0x02, 0x06, 0x06, 0x23, 0x22, 0x2E, 0x03, 0x35, 0x35, 0x34,
-	0x12, 0x36, 0x36, 0x33, 0x32, 0x1E, 0x03, 0x07, 0x35, 0x34, 0x2E, 0x03, 0x23, 0x22, 0x0E, 0x02,
-	0x15, 0x15, 0x14, 0x1E, 0x03, 0x33, 0x32, 0x3E, 0x02, 0x05, 0x1D, 0xFC, 0x16, 0x8F, 0x03, 0xED,
-	0x79, 0x52, 0x9A, 0xD7, 0x85, 0x67, 0xB4, 0x91, 0x68, 0x37, 0x55, 0x9C, 0xD7, 0x81, 0x6A, 0xB5,
-	0x90, 0x65, 0x36, 0xBF, 0x22, 0x42, 0x60, 0x7C, 0x4B, 0x5A, 0x91, 0x67, 0x38, 0x24, 0x45, 0x61,
-	0x7A, 0x48, 0x5E, 0x92, 0x65, 0x34, 0x05, 0xEC, 0xF9, 0xB7, 0x06, 0x49, 0xFD, 0x1A, 0x5C, 0xA4,
-	0xFE, 0xFC, 0xB6, 0x60, 0x3E, 0x77, 0xAB, 0xDB, 0x83, 0x5C, 0xA4, 0x01, 0x03, 0xB7, 0x60, 0x3E,
-	0x77, 0xAB, 0xDB, 0xDF, 0x5E, 0x68, 0xA9, 0x82, 0x58, 0x2D, 0x46, 0x88, 0xC8, 0x82, 0x5E, 0x69,
-	0xAA, 0x83, 0x58, 0x2D, 0x46, 0x89, 0xC9, 0x00, 0x00, 0x02, 0x00, 0xA7, 0x00, 0x00, 0x04, 0x5D,
-	0x05, 0xB0, 0x00, 0x03, 0x00, 0x19, 0x00, 0x1D, 0x40, 0x0E, 0x0F, 0x0E, 0x0E, 0x03, 0x19, 0x04,
-	0x04, 0x03, 0x00, 0x02, 0x72, 0x03, 0x08, 0x72, 0x00, 0x2B, 0x2B, 0x11, 0x39, 0x2F, 0x33, 0x11,
-	0x39, 0x2F, 0x33, 0x30, 0x31, 0x53, 0x33, 0x11, 0x23, 0x13, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14,
-	0x06, 0x06, 0x23, 0x21, 0x35, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0xA7,
-	0xB9, 0xB9, 0x5D, 0x01, 0x72, 0x9E, 0xD9, 0x70, 0x70, 0xD9, 0x9E, 0xFE, 0xC1, 0x01, 0x3F, 0x6C,
-	0x85, 0x3D, 0x3D, 0x85, 0x6C, 0xFE, 0xE8, 0x05, 0xB0, 0xFA, 0x50, 0x04, 0x8B, 0x6E, 0xC0, 0x7B,
-	0x7A, 0xC0, 0x6E, 0x97, 0x4F, 0x7C, 0x44, 0x46, 0x7E, 0x50, 0x00, 0x01, 0x00, 0x8C, 0xFF, 0xEC,
-	0x04, 0x6A, 0x06, 0x12, 0x00, 0x39, 0x00, 0x19, 0x40, 0x0D, 0x23, 0x1B, 0x36, 0x08, 0x02, 0x0A,
-	0x72, 0x08, 0x01, 0x72, 0x1B, 0x0B, 0x72, 0x00, 0x2B, 0x2B, 0x2B, 0x11, 0x33, 0x11, 0x33, 0x30,
-	0x31, 0x41, 0x11, 0x23, 0x11, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02,
-	0x15, 0x14, 0x1E, 0x03, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16,
-	0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2E, 0x03, 0x35, 0x34, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x26,
-	0x23, 0x22, 0x06, 0x06, 0x01, 0x44, 0xB8, 0x39, 0x68, 0x90, 0x58, 0x6D, 0xA9, 0x62, 0x27, 0x32,
-	0x27, 0x46, 0x68, 0x69, 0x46, 0x63, 0xAE, 0x70, 0x36, 0x78, 0x63, 0x1A, 0x2A, 0x23, 0x85, 0x46,
-	0x4E, 0x61, 0x2C, 0x46, 0x68, 0x69, 0x46, 0x2A, 0x36, 0x2A, 0x32, 0x56, 0x37, 0x45, 0x62, 0x34,
-	0x04, 0x58, 0xFB, 0xA8, 0x04, 0x58, 0x6E, 0xA5, 0x6F, 0x38, 0x48, 0x95, 0x74, 0x50, 0x6B, 0x51,
-	0x4E, 0x33, 0x37, 0x57, 0x50, 0x5A, 0x72, 0x4D, 0x72, 0x96, 0x49, 0x15, 0x21, 0x12, 0x9B, 0x16,
-	0x36, 0x30, 0x50, 0x31, 0x39, 0x57, 0x51, 0x5A, 0x76, 0x51, 0x3C, 0x5C, 0x51, 0x59, 0x39, 0x43,
-	0x59, 0x2E, 0x3E, 0x81, 0x00, 0x03, 0x00, 0x4F, 0xFF, 0xEB, 0x06, 0x7D, 0x04, 0x4F, 0x00, 0x14,
-	0x00, 0x32, 0x00, 0x5E, 0x00, 0x37, 0x40, 0x1C, 0x57, 0x33, 0x33, 0x32, 0x17, 0x46, 0x45, 0x14,
-	0x25, 0x00, 0x03, 0x29, 0x17, 0x45, 0x17, 0x45, 0x0F, 0x1F, 0x29, 0x0B, 0x72, 0x4C, 0x3E, 0x3E,
-	0x05, 0x0F, 0x07, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x12, 0x39, 0x39, 0x2F,
-	0x2F, 0x12, 0x17, 0x39, 0x11, 0x33, 0x11, 0x33, 0x32, 0x11, 0x33, 0x30, 0x31, 0x65, 0x11, 0x34,
-	0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x27, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15,
-	0x11, 0x03, 0x15, 0x21, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3E, 0x02, 0x37,
-	0x17, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x01, 0x22, 0x2E, 0x02,
-	0x35, 0x35, 0x34, 0x3E, 0x02, 0x17, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x21, 0x35, 0x21, 0x35, 0x34,
-	0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17,
-	0x0E, 0x02, 0x02, 0xED, 0x31, 0x60, 0x45, 0x4A, 0x6E, 0x3C, 0xB8, 0x3E, 0x71, 0x9D, 0x60, 0x76,
-	0xB1, 0x63, 0x8B, 0xFE, 0xFB, 0x57, 0x76, 0x3C, 0x2D, 0x5B, 0x46, 0x36, 0x71, 0x5F, 0x3B, 0x01,
-	0x60, 0x1B, 0x75, 0xB7, 0x7F, 0x72, 0x9F, 0x52, 0x39, 0x71, 0xA8, 0x6E, 0x02, 0xE0, 0x7B, 0xBC,
-	0x80, 0x42, 0x45, 0x7D, 0xA8, 0x63, 0x6C, 0xA5, 0x70, 0x39, 0xFC, 0xDC, 0x02, 0x6A, 0x32, 0x70,
-	0x5E, 0x45, 0x6A, 0x49, 0x26, 0x26, 0x50, 0x7D, 0x57, 0x77, 0x92, 0x32, 0x41, 0x16, 0x61, 0x9A,
-	0xB7, 0x02, 0x19, 0x48, 0x67, 0x37, 0x34, 0x56, 0x34, 0x12, 0x46, 0x76, 0x58, 0x30, 0x56, 0xAA,
-	0x80, 0xFE, 0x0C, 0x01, 0xA2, 0x8C, 0x37, 0x59, 0x34, 0x30, 0x4D, 0x2D, 0x29, 0x41, 0x48, 0x1F,
-	0x90, 0x31, 0x64, 0x43, 0x50, 0x93, 0x62, 0x4F, 0x7B, 0x55, 0x2D, 0xFD, 0x6F, 0x50, 0x91, 0xC6,
-	0x76, 0x2C, 0x77, 0xC5, 0x90, 0x4F, 0x01, 0x43, 0x7F, 0xB4, 0x70, 0x76, 0x8E, 0x1F, 0x4C, 0x7E,
-	0x4D, 0x3C, 0x6A, 0x8C, 0x50, 0x2C, 0x51, 0x8D, 0x6B, 0x3C, 0x49, 0x22, 0x88, 0x11, 0x3B, 0x2F,
-	0x00, 0x02, 0x00, 0x7E, 0xFF, 0xEC, 0x04, 0x2E, 0x06, 0x2D, 0x00, 0x34, 0x00, 0x38, 0x00, 0x19,
-	0x40, 0x0B, 0x36, 0x20, 0x16, 0x16, 0x01, 0x2A, 0x0C, 0x0B, 0x72, 0x38, 0x01, 0x00, 0x2F, 0x33,
-	0x2B, 0x32, 0x12, 0x39, 0x2F, 0x33, 0x33, 0x30, 0x31, 0x53, 0x37, 0x16, 0x04, 0x16, 0x12, 0x15,
-	0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16,
-	0x15, 0x27, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E,
-	0x02, 0x35, 0x35, 0x34, 0x02, 0x26, 0x26, 0x25, 0x01, 0x27, 0x01, 0xFF, 0x39, 0xA9, 0x01, 0x16,
-	0xCA, 0x6D, 0x45, 0x7E, 0xAB, 0x66, 0x69, 0xAF, 0x7F, 0x45, 0x43, 0x79, 0xA3, 0x61, 0x71, 0xB5,
-	0x6A, 0x45, 0x24, 0x47, 0x6C, 0x48, 0x49, 0x72, 0x4E, 0x29, 0x27, 0x4B, 0x6D, 0x47, 0x41, 0x66,
-	0x49, 0x26, 0x63, 0xAF, 0xE3, 0x02, 0x5D, 0xFD, 0xE7, 0x49, 0x02, 0x19, 0x05, 0x8D, 0xA0, 0x26,
-	0xA4, 0xF3, 0xFE, 0xC6, 0xBD, 0x62, 0x7B, 0xCC, 0x94, 0x50, 0x4B, 0x86, 0xB1, 0x66, 0x74, 0xBB,
-	0x87, 0x48, 0x6B, 0xA7, 0x5B, 0x01, 0x21, 0x4A, 0x41, 0x28, 0x32, 0x5D, 0x84, 0x53, 0x3E, 0x77,
-	0x61, 0x3A, 0x3D, 0x6D, 0x93, 0x56, 0x64, 0xB0, 0x01, 0x08, 0xBE, 0x7B, 0x1D, 0xFE, 0x92, 0x64,
-	0x01, 0x6D, 0x00, 0x03, 0x00, 0x47, 0x00, 0xAC, 0x04, 0x2D, 0x04, 0xBA, 0x00, 0x03, 0x00, 0x0F,
-	0x00, 0x1B, 0x00, 0x13, 0xB7, 0x19, 0x13, 0x02, 0x07, 0x0D, 0x03, 0x02, 0x12, 0x00, 0x3F, 0xDD,
-	0xC6, 0x32, 0x10, 0xC6, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x34, 0x36, 0x33, 0x32,
-	0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x11, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
-	0x23, 0x22, 0x26, 0x04, 0x2D, 0xFC, 0x1A, 0x01, 0x87, 0x3A, 0x38, 0x38, 0x3B, 0x3B, 0x38, 0x38,
-	0x3A, 0x3A, 0x38, 0x38, 0x3B, 0x3B, 0x38, 0x38, 0x3A, 0x03, 0x10, 0xB8, 0xB8, 0x01, 0x3A, 0x30,
-	0x40, 0x40, 0x30, 0x2E, 0x3F, 0x3F, 0xFC, 0xFE, 0x2F, 0x41, 0x41, 0x2F, 0x2E, 0x40, 0x40, 0x00,
-	0x00, 0x03, 0x00, 0x5C, 0xFF, 0x79, 0x04, 0x34, 0x04, 0xB9, 0x00, 0x03, 0x00, 0x19, 0x00, 0x2F,
-	0x00, 0x19, 0x40, 0x0C, 0x20, 0x01, 0x01, 0x15, 0x0B, 0x72, 0x2B, 0x00, 0x00, 0x0A, 0x07, 0x72,
-	0x00, 0x2B, 0x32, 0x2F, 0x32, 0x2B, 0x32, 0x2F, 0x32, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x01,
-	0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E,
-	0x02, 0x37, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x34, 0x2E, 0x02, 0x23,
-	0x22, 0x0E, 0x02, 0x03, 0xD7, 0xFD, 0x69, 0x7B, 0x02, 0x97, 0xFD, 0x00, 0x44, 0x80, 0xB6, 0x71,
-	0x72, 0xB7, 0x80, 0x44, 0x44, 0x80, 0xB5, 0x72, 0x72, 0xB6, 0x81, 0x44, 0xB9, 0x26, 0x4D, 0x74,
-	0x4D, 0x4C, 0x73, 0x4C, 0x27, 0x27, 0x4D, 0x73, 0x4D, 0x4C, 0x73, 0x4D, 0x26, 0x04, 0xB9, 0xFA,
-	0xC0, 0x05, 0x40, 0xFD, 0x58, 0x17, 0x75, 0xC9, 0x95, 0x53, 0x53, 0x95, 0xC9, 0x75, 0x17, 0x75,
-	0xC8, 0x95, 0x53, 0x53, 0x95, 0xC8, 0x8C, 0x17, 0x51, 0x8F, 0x6E, 0x3F, 0x3F, 0x6E, 0x8F, 0x51,
-	0x17, 0x50, 0x8F, 0x6F, 0x40, 0x40, 0x6F, 0x8F, 0x00, 0x03, 0x00, 0x95, 0xFE, 0x60, 0x04, 0x28,
-	0x06, 0x00, 0x00, 0x03, 0x00, 0x19, 0x00, 0x2F, 0x00, 0x1B, 0x40, 0x0F, 0x2B, 0x0A, 0x20, 0x15,
-	0x07, 0x72, 0x0A, 0x0B, 0x72, 0x03, 0x00, 0x72, 0x02, 0x0E, 0x72, 0x00, 0x2B, 0x2B, 0x2B, 0x2B,
-	0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22,
-	0x2E, 0x02, 0x27, 0x35, 0x3E, 0x03, 0x33, 0x32, 0x1E, 0x02, 0x07, 0x35, 0x34, 0x2E, 0x02, 0x23,
-	0x22, 0x0E, 0x02, 0x07, 0x11, 0x1E, 0x03, 0x33, 0x32, 0x3E, 0x02, 0x01, 0x4F, 0xBA, 0x03, 0x93,
-	0x38, 0x6B, 0x9C, 0x65, 0x67, 0x9E, 0x6E, 0x41, 0x0C, 0x0C, 0x42, 0x6D, 0x9C, 0x66, 0x66, 0x9E,
-	0x6C, 0x37, 0xBA, 0x22, 0x47, 0x6E, 0x4C, 0x46, 0x67, 0x48, 0x2D, 0x0B, 0x0F, 0x2F, 0x47, 0x65,
-	0x45, 0x4B, 0x6D, 0x47, 0x22, 0x06, 0x00, 0xF8, 0x60, 0x07, 0xA0, 0xFC, 0x26, 0x15, 0x76, 0xC9,
-	0x94, 0x52, 0x44, 0x82, 0xB6, 0x72, 0x70, 0x78, 0xBE, 0x87, 0x47, 0x4F, 0x92, 0xCB, 0x91, 0x15,
-	0x51, 0x8F, 0x6D, 0x3F, 0x30, 0x51, 0x67, 0x37, 0xFE, 0xFD, 0x35, 0x60, 0x4B, 0x2C, 0x3F, 0x6E,
-	0x8F, 0x00, 0x00, 0x04, 0x00, 0x5F, 0xFF, 0xEC, 0x04, 0xAD, 0x06, 0x00, 0x00, 0x04, 0x00, 0x1A,
-	0x00, 0x2F, 0x00, 0x33, 0x00, 0x1D, 0x40, 0x0F, 0x21, 0x04, 0x04, 0x16, 0x0B, 0x72, 0x33, 0x32,
-	0x2B, 0x0B, 0x07, 0x72, 0x01, 0x00, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0xCE, 0x32, 0x2B, 0x32, 0x2F,
-	0x32, 0x30, 0x31, 0x65, 0x11, 0x33, 0x11, 0x23, 0x01, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E,
-	0x02, 0x17, 0x15, 0x0E, 0x03, 0x23, 0x22, 0x2E, 0x02, 0x37, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32,
-	0x36, 0x36, 0x37, 0x35, 0x2E, 0x03, 0x23, 0x22, 0x0E, 0x02, 0x01, 0x15, 0x21, 0x35, 0x03, 0x37,
-	0xBA, 0xAA, 0xFD, 0x18, 0x3D, 0x71, 0x9D, 0x61, 0x66, 0x99, 0x6B, 0x3E, 0x0C, 0x0B, 0x3F, 0x6B,
-	0x9A, 0x67, 0x5F, 0x9D, 0x71, 0x3D, 0xBA, 0x21, 0x46, 0x6C, 0x4B, 0x5C, 0x77, 0x48, 0x14, 0x0C,
-	0x2D, 0x47, 0x67, 0x46, 0x4C, 0x6D, 0x46, 0x21, 0x03, 0x94, 0xFD, 0x83, 0xD2, 0x05, 0x2E, 0xFA,
-	0x00, 0x02, 0x11, 0x15, 0x7C, 0xCB, 0x92, 0x4F, 0x47, 0x87, 0xBE, 0x78, 0x5C, 0x77, 0xBE, 0x86,
-	0x47, 0x52, 0x94, 0xC9, 0x8B, 0x15, 0x51, 0x8E, 0x6C, 0x3D, 0x4E, 0x80, 0x4B, 0xF1, 0x37, 0x67,
-	0x51, 0x30, 0x3F, 0x6D, 0x8F, 0x02, 0xF2, 0x98, 0x98, 0x00, 0x00, 0x04, 0x00, 0x1E, 0x00, 0x00,
-	0x05, 0x89, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x1F, 0x40, 0x0F,
-	0x03, 0x02, 0x80, 0x07, 0x06, 0x06, 0x0A, 0x0C, 0x0B, 0x02, 0x72, 0x0D, 0x0A, 0x08, 0x72, 0x00,
-	0x2B, 0x32, 0x2B, 0x32, 0x11, 0x39, 0x2F, 0x33, 0x1A, 0xCC, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21,
-	0x35, 0x01, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x05, 0x89, 0xFA,
-	0x95, 0x04, 0x3C, 0xFC, 0xEC, 0x1E, 0xC0, 0x04, 0x5F, 0xC1, 0x04, 0x8F, 0x8F, 0x8F, 0xFE, 0xAF,
-	0x9D, 0x9D, 0x02, 0x72, 0xFA, 0x50, 0x05, 0xB0, 0xFA, 0x50, 0x05, 0xB0, 0x00, 0x01, 0x00, 0x9C,
-	0x00, 0x00, 0x01, 0x55, 0x04, 0x3A, 0x00, 0x03, 0x00, 0x0C, 0xB5, 0x03, 0x06, 0x72, 0x02, 0x0A,
-	0x72, 0x00, 0x2B, 0x2B, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x55, 0xB9, 0x04, 0x3A, 0xFB,
-	0xC6, 0x04, 0x3A, 0x00, 0x00, 0x03, 0x00, 0x9B, 0x00, 0x00, 0x04, 0x40, 0x04, 0x3A, 0x00, 0x03,
-	0x00, 0x09, 0x00, 0x0D, 0x00, 0x1F, 0x40, 0x0F, 0x0C, 0x07, 0x07, 0x0B, 0x06, 0x06, 0x02, 0x09,
-	0x03, 0x06, 0x72, 0x0A, 0x02, 0x0A, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x11, 0x39, 0x2F, 0x33,
-	0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x23, 0x27, 0x33, 0x01, 0x13,
-	0x01, 0x37, 0x01, 0x01, 0x54, 0xB9, 0x03, 0x81, 0xFD, 0xE9, 0xEF, 0x1C, 0xB6, 0x01, 0x8C, 0x1A,
-	0xFE, 0x51, 0x77, 0x02, 0x22, 0x04, 0x3A, 0xFB, 0xC6, 0x04, 0x3A, 0xFD, 0x94, 0xA2, 0x01, 0xCA,
-	0xFB, 0xC6, 0x01, 0xEA, 0x86, 0xFD, 0x90, 0x00, 0x00, 0x03, 0x00, 0x23, 0x00, 0x00, 0x04, 0x1C,
-	0x05, 0xB0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x1B, 0x40, 0x0D, 0x02, 0x0A, 0x00, 0x07,
-	0x06, 0x06, 0x0A, 0x0B, 0x02, 0x72, 0x0A, 0x08, 0x72, 0x00, 0x2B, 0x2B, 0x11, 0x33, 0x11, 0x33,
-	0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x05, 0x35, 0x01, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23,
-	0x11, 0x02, 0x70, 0xFD, 0xB3, 0x03, 0xF9, 0xFD, 0x27, 0x26, 0xC0, 0x03, 0xA0, 0x7D, 0xBB, 0x7D,
-	0xFD, 0xB8, 0x9D, 0x9D, 0x05, 0x13, 0xFA, 0x50, 0x05, 0xB0, 0x00, 0x02, 0x00, 0x23, 0x00, 0x00,
-	0x02, 0x0B, 0x06, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x13, 0x40, 0x09, 0x02, 0x06, 0x00, 0x07,
-	0x00, 0x72, 0x06, 0x0A, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x05,
-	0x35, 0x01, 0x11, 0x23, 0x11, 0x02, 0x0B, 0xFE, 0x18, 0x01, 0x49, 0xB9, 0x03, 0xA2, 0x7A, 0xBB,
-	0x7A, 0x03, 0x19, 0xFA, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0xA2, 0xFE, 0x4B, 0x04, 0xF1,
-	0x05, 0xB0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x19, 0x00, 0x1D, 0x40, 0x0E, 0x15, 0x0E, 0x06, 0x07,
-	0x07, 0x03, 0x08, 0x72, 0x09, 0x05, 0x04, 0x00, 0x02, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x32, 0x2B,
-	0x32, 0x11, 0x33, 0x2F, 0x33, 0x30, 0x31, 0x53, 0x33, 0x11, 0x23, 0x13, 0x37, 0x01, 0x07, 0x11,
-	0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-	0x35, 0xA2, 0xC1, 0xC1, 0x3A, 0x87, 0x03, 0x54, 0x87, 0xC1, 0x4F, 0x92, 0x66, 0x1F, 0x36, 0x1E,
-	0x0E, 0x11, 0x42, 0x0F, 0x2C, 0x3D, 0x20, 0x05, 0xB0, 0xFA, 0x50, 0x05, 0x3E, 0x72, 0xFA, 0xC2,
-	0x72, 0x05, 0xB0, 0xF9, 0xFC, 0x72, 0x9D, 0x52, 0x07, 0x0A, 0x9A, 0x06, 0x07, 0x2F, 0x57, 0x3D,
-	0x00, 0x02, 0x00, 0x92, 0xFE, 0x4B, 0x03, 0xF1, 0x04, 0x4E, 0x00, 0x04, 0x00, 0x2A, 0x00, 0x19,
-	0x40, 0x0E, 0x1C, 0x15, 0x0F, 0x72, 0x26, 0x0B, 0x07, 0x72, 0x03, 0x06, 0x72, 0x02, 0x0A, 0x72,
-	0x00, 0x2B, 0x2B, 0x2B, 0x32, 0x2B, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x33, 0x03, 0x07,
-	0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27,
-	0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02,
-	0x01, 0x4B, 0xB9, 0xA6, 0x26, 0x2A, 0x38, 0x6A, 0x99, 0x60, 0x54, 0x88, 0x5F, 0x33, 0x4D, 0x91,
-	0x65, 0x1F, 0x35, 0x1E, 0x0E, 0x10, 0x46, 0x0E, 0x2C, 0x3D, 0x21, 0x1F, 0x3D, 0x57, 0x39, 0x53,
-	0x77, 0x4C, 0x24, 0x03, 0x53, 0xFC, 0xAD, 0x04, 0x3A, 0xFE, 0x06, 0x02, 0x73, 0xC1, 0x8E, 0x4E,
-	0x30, 0x65, 0xA0, 0x6F, 0xFC, 0xFD, 0x70, 0x9C, 0x50, 0x07, 0x0A, 0x9D, 0x06, 0x06, 0x2A, 0x53,
-	0x3D, 0x03, 0x00, 0x4B, 0x67, 0x3D, 0x1C, 0x3A, 0x66, 0x86, 0x00, 0x05, 0x00, 0x69, 0xFF, 0xEB,
-	0x07, 0x09, 0x05, 0xC5, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x33,
-	0x40, 0x1A, 0x2F, 0x2E, 0x2E, 0x26, 0x32, 0x28, 0x33, 0x02, 0x72, 0x29, 0x27, 0x26, 0x08, 0x72,
-	0x15, 0x12, 0x12, 0x16, 0x19, 0x09, 0x04, 0x07, 0x07, 0x03, 0x00, 0x03, 0x00, 0x3F, 0x32, 0x32,
-	0x11, 0x33, 0x3F, 0x33, 0x33, 0x11, 0x33, 0x2B, 0x32, 0x32, 0x2B, 0x32, 0x32, 0x11, 0x39, 0x2F,
-	0x33, 0x30, 0x31, 0x41, 0x32, 0x16, 0x17, 0x15, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x11,
-	0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x37, 0x15, 0x06, 0x06, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x11,
-	0x34, 0x3E, 0x02, 0x01, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01,
-	0x15, 0x21, 0x35, 0x02, 0x94, 0x4D, 0x96, 0x43, 0x42, 0x95, 0x4F, 0x55, 0x89, 0x61, 0x33, 0x34,
-	0x62, 0x89, 0x55, 0x4E, 0x95, 0x41, 0x43, 0x94, 0x4D, 0x7C, 0xCD, 0x94, 0x50, 0x50, 0x93, 0xCC,
-	0x04, 0xF1, 0xFC, 0xFD, 0x27, 0xC1, 0x03, 0x37, 0xFD, 0x63, 0x02, 0xF9, 0xFD, 0x07, 0x05, 0xC5,
-	0x0D, 0x08, 0x9E, 0x0C, 0x0F, 0x39, 0x70, 0xA5, 0x6D, 0xFE, 0xCE, 0x6D, 0xA6, 0x71, 0x39, 0x0F,
-	0x0C, 0x9E, 0x07, 0x0E, 0x57, 0x9F, 0xDB, 0x84, 0x01, 0x30, 0x84, 0xDB, 0x9F, 0x57, 0xFA, 0xD8,
-	0x9D, 0x9D, 0x05, 0x13, 0xFA, 0x50, 0x05, 0xB0, 0xFD, 0x8E, 0x9D, 0x9D, 0x02, 0x72, 0x9E, 0x9E,
-	0x00, 0x03, 0x00, 0x61, 0xFF, 0xEB, 0x07, 0x00, 0x04, 0x4F, 0x00, 0x2A, 0x00, 0x40, 0x00, 0x56,
-	0x00, 0x27, 0x40, 0x13, 0x24, 0x00, 0x00, 0x47, 0x3C, 0x13, 0x12, 0x12, 0x3C, 0x52, 0x19, 0x0B,
-	0x0B, 0x31, 0x07, 0x72, 0x3C, 0x0B, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x11, 0x33, 0x32, 0x11, 0x39,
-	0x2F, 0x33, 0x11, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x45, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34,
-	0x3E, 0x02, 0x17, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x21, 0x35, 0x21, 0x35, 0x34, 0x26, 0x26, 0x23,
-	0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x01,
-	0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E,
-	0x02, 0x37, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x34, 0x2E, 0x02, 0x23,
-	0x22, 0x0E, 0x02, 0x05, 0x63, 0x70, 0xB5, 0x80, 0x45, 0x4B, 0x81, 0xA7, 0x5B, 0x70, 0xA6, 0x6D,
-	0x36, 0xFC, 0xE7, 0x02, 0x60, 0x36, 0x71, 0x59, 0x3D, 0x65, 0x4A, 0x28, 0x26, 0x4D, 0x72, 0x4B,
-	0x6E, 0x95, 0x32, 0x49, 0x31, 0xBA, 0xFA, 0x6B, 0x42, 0x7D, 0xB2, 0x71, 0x73, 0xB4, 0x7D, 0x41,
-	0x41, 0x7D, 0xB3, 0x72, 0x72, 0xB3, 0x7D, 0x42, 0xBA, 0x24, 0x49, 0x70, 0x4D, 0x4D, 0x70, 0x49,
-	0x24, 0x24, 0x4A, 0x71, 0x4D, 0x4C, 0x70, 0x49, 0x23, 0x15, 0x50, 0x91, 0xC6, 0x76, 0x2C, 0x77,
-	0xC5, 0x90, 0x4F, 0x01, 0x47, 0x81, 0xB0, 0x6A, 0x7A, 0x97, 0x1A, 0x49, 0x7D, 0x4D, 0x3C, 0x6A,
-	0x8C, 0x50, 0x2C, 0x51, 0x8D, 0x6B, 0x3C, 0x3F, 0x2D, 0x7E, 0x30, 0x56, 0x02, 0x26, 0x17, 0x75,
-	0xC9, 0x95, 0x53, 0x53, 0x95, 0xC9, 0x75, 0x17, 0x75, 0xC9, 0x95, 0x53, 0x53, 0x95, 0xC9, 0x8C,
-	0x17, 0x51, 0x8F, 0x6F, 0x3F, 0x3F, 0x6F, 0x8F, 0x51, 0x17, 0x50, 0x8F, 0x6F, 0x40, 0x40, 0x6F,
-	0x8F, 0x00, 0x00, 0x01, 0x00, 0xA1, 0x00, 0x00, 0x02, 0x83, 0x06, 0x15, 0x00, 0x11, 0x00, 0x0E,
-	0xB6, 0x0D, 0x06, 0x01, 0x72, 0x01, 0x0A, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x30, 0x31, 0x61, 0x23,
-	0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
-	0x01, 0x5A, 0xB9, 0x52, 0x97, 0x69, 0x25, 0x46, 0x25, 0x18, 0x11, 0x2D, 0x1D, 0x3B, 0x51, 0x2A,
-	0x04, 0xAC, 0x75, 0xA1, 0x53, 0x0C, 0x09, 0x8E, 0x05, 0x06, 0x32, 0x5D, 0x42, 0x00, 0x00, 0x01,
-	0x00, 0x5E, 0xFF, 0xEC, 0x05, 0x12, 0x05, 0xC4, 0x00, 0x2C, 0x00, 0x1B, 0x40, 0x0D, 0x0F, 0x00,
-	0x06, 0x09, 0x09, 0x00, 0x1A, 0x22, 0x03, 0x72, 0x00, 0x09, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x11,
-	0x39, 0x2F, 0x33, 0x11, 0x33, 0x30, 0x31, 0x45, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x21, 0x15, 0x21,
-	0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x06,
-	0x07, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x12, 0x15, 0x15, 0x14, 0x02, 0x06, 0x06, 0x02,
-	0xB9, 0x94, 0xE2, 0x98, 0x4D, 0x04, 0x3E, 0xFC, 0x83, 0x2B, 0x60, 0x9D, 0x72, 0x62, 0x98, 0x69,
-	0x36, 0x35, 0x70, 0xB0, 0x7C, 0x82, 0xB0, 0x3B, 0x2F, 0x18, 0x6A, 0xA7, 0x73, 0x9F, 0xF5, 0xA7,
-	0x56, 0x5D, 0xA5, 0xDA, 0x14, 0x5C, 0xAE, 0xF5, 0x98, 0x7C, 0x95, 0x22, 0x5D, 0xA2, 0x79, 0x45,
-	0x54, 0x95, 0xC4, 0x70, 0x5E, 0x71, 0xC4, 0x95, 0x54, 0x38, 0x1C, 0x8F, 0x10, 0x30, 0x25, 0x67,
-	0xBB, 0xFE, 0xFF, 0x9B, 0x5E, 0x9B, 0xFE, 0xFF, 0xBB, 0x65, 0x00, 0x01, 0xFF, 0xE3, 0xFE, 0x4B,
-	0x02, 0xBD, 0x06, 0x15, 0x00, 0x27, 0x00, 0x29, 0x40, 0x15, 0x14, 0x02, 0x02, 0x15, 0x27, 0x06,
-	0x72, 0x1F, 0x22, 0x22, 0x1E, 0x1B, 0x01, 0x72, 0x0B, 0x0E, 0x0E, 0x0A, 0x07, 0x0F, 0x72, 0x00,
-	0x2B, 0x32, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x30,
-	0x31, 0x41, 0x15, 0x23, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33,
-	0x32, 0x36, 0x36, 0x35, 0x11, 0x23, 0x35, 0x33, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17,
-	0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x15, 0x02, 0x60, 0xCB, 0x4D, 0x90, 0x65, 0x1F,
-	0x34, 0x1D, 0x0E, 0x0F, 0x45, 0x0E, 0x2B, 0x3D, 0x21, 0xAB, 0xAB, 0x51, 0x98, 0x69, 0x24, 0x47,
-	0x24, 0x16, 0x13, 0x33, 0x1D, 0x3B, 0x4E, 0x26, 0x04, 0x3A, 0x8E, 0xFB, 0xFB, 0x70, 0x9C, 0x50,
-	0x07, 0x0A, 0x94, 0x06, 0x07, 0x2F, 0x58, 0x3D, 0x04, 0x05, 0x8E, 0x72, 0x75, 0xA1, 0x53, 0x0C,
-	0x09, 0x92, 0x05, 0x05, 0x2F, 0x5B, 0x42, 0x72, 0x00, 0x03, 0x00, 0x66, 0xFF, 0xEC, 0x05, 0x9D,
-	0x06, 0x38, 0x00, 0x09, 0x00, 0x21, 0x00, 0x39, 0x00, 0x1D, 0x40, 0x0E, 0x05, 0x06, 0x06, 0x29,
-	0x29, 0x00, 0x00, 0x1C, 0x03, 0x72, 0x35, 0x10, 0x09, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x2F,
-	0x32, 0x11, 0x39, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x35, 0x32, 0x36,
-	0x36, 0x13, 0x15, 0x14, 0x02, 0x06, 0x06, 0x23, 0x22, 0x2E, 0x03, 0x35, 0x35, 0x34, 0x12, 0x36,
-	0x36, 0x33, 0x32, 0x1E, 0x03, 0x07, 0x35, 0x34, 0x2E, 0x03, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15,
-	0x14, 0x1E, 0x03, 0x33, 0x32, 0x3E, 0x02, 0x04, 0xF6, 0xA7, 0x54, 0xA9, 0x7F, 0x4F, 0x5D, 0x29,
-	0x03, 0x52, 0x9A, 0xD7, 0x85, 0x67, 0xB4, 0x91, 0x68, 0x37, 0x55, 0x9C, 0xD7, 0x81, 0x6A, 0xB6,
-	0x8F, 0x66, 0x35, 0xBF, 0x22, 0x42, 0x60, 0x7C, 0x4B, 0x59, 0x91, 0x68, 0x38, 0x24, 0x45, 0x61,
-	0x7B, 0x47, 0x5E, 0x92, 0x65, 0x34, 0x06, 0x38, 0x81, 0xB6, 0x5F, 0x87, 0x40, 0x7A, 0xFD, 0x23,
-	0x5C, 0xA4, 0xFE, 0xFC, 0xB6, 0x60, 0x3E, 0x77, 0xAB, 0xDB, 0x83, 0x5C, 0xA4, 0x01, 0x03, 0xB7,
-	0x60, 0x3E, 0x77, 0xAB, 0xDB, 0xDF, 0x5E, 0x68, 0xA9, 0x82, 0x58, 0x2D, 0x46, 0x88, 0xC8, 0x82,
-	0x5E, 0x69, 0xAA, 0x83, 0x58, 0x2D, 0x46, 0x89, 0xC9, 0x00, 0x00, 0x03, 0x00, 0x5C, 0xFF, 0xEC,
-	0x04, 0xBA, 0x04, 0xB1, 0x00, 0x09, 0x00, 0x1F, 0x00, 0x35, 0x00, 0x15, 0x40, 0x0A, 0x26, 0x1B,
-	0x0B, 0x72, 0x31, 0x00, 0x00, 0x10, 0x07, 0x72, 0x00, 0x2B, 0x32, 0x2F, 0x32, 0x2B, 0x32, 0x30,
-	0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x35, 0x32, 0x36, 0x36, 0x01, 0x35, 0x34, 0x3E, 0x02,
-	0x33, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x37, 0x15, 0x14,
-	0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x04,
-	0x25, 0x95, 0x3C, 0x8C, 0x78, 0x4B, 0x49, 0x17, 0xFC, 0x37, 0x44, 0x80, 0xB6, 0x71, 0x72, 0xB7,
-	0x80, 0x44, 0x44, 0x80, 0xB5, 0x72, 0x72, 0xB6, 0x81, 0x44, 0xB9, 0x26, 0x4D, 0x74, 0x4D, 0x4C,
-	0x73, 0x4C, 0x27, 0x27, 0x4D, 0x73, 0x4D, 0x4C, 0x73, 0x4D, 0x26, 0x04, 0xB1, 0x6E, 0x9F, 0x56,
-	0x74, 0x3C, 0x6C, 0xFD, 0xA7, 0x17, 0x75, 0xC9, 0x95, 0x53, 0x53, 0x95, 0xC9, 0x75, 0x17, 0x75,
-	0xC8, 0x95, 0x53, 0x53, 0x95, 0xC8, 0x8C, 0x17, 0x51, 0x8F, 0x6E, 0x3F, 0x3F, 0x6E, 0x8F, 0x51,
-	0x17, 0x50, 0x8F, 0x6F, 0x40, 0x40, 0x6F, 0x8F, 0x00, 0x02, 0x00, 0x8C, 0xFF, 0xEC, 0x06, 0x1D,
-	0x06, 0x02, 0x00, 0x09, 0x00, 0x1F, 0x00, 0x19, 0x40, 0x0C, 0x05, 0x0A, 0x0A, 0x00, 0x00, 0x15,
-	0x02, 0x72, 0x1B, 0x10, 0x09, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x2F, 0x32, 0x11, 0x33, 0x30,
-	0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x35, 0x32, 0x36, 0x36, 0x25, 0x33, 0x11, 0x14, 0x06,
-	0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-	0x35, 0x05, 0x7F, 0x9E, 0x53, 0xB7, 0x97, 0x66, 0x71, 0x2C, 0xFE, 0x6B, 0xC0, 0x92, 0xF1, 0x8D,
-	0x94, 0xEF, 0x8B, 0xBF, 0x54, 0x97, 0x64, 0x65, 0x97, 0x54, 0x06, 0x02, 0x8D, 0xC0, 0x62, 0x87,
-	0x43, 0x84, 0x0F, 0xFC, 0x27, 0xA4, 0xDA, 0x6D, 0x6D, 0xDA, 0xA4, 0x03, 0xD9, 0xFC, 0x27, 0x72,
-	0x94, 0x48, 0x48, 0x94, 0x72, 0x00, 0x00, 0x03, 0x00, 0x89, 0xFF, 0xEC, 0x05, 0x10, 0x04, 0x91,
-	0x00, 0x09, 0x00, 0x0E, 0x00, 0x25, 0x00, 0x1D, 0x40, 0x0E, 0x05, 0x0B, 0x0B, 0x00, 0x00, 0x1B,
-	0x06, 0x72, 0x22, 0x0E, 0x0E, 0x15, 0x0B, 0x72, 0x00, 0x2B, 0x32, 0x2F, 0x32, 0x2B, 0x32, 0x2F,
-	0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x35, 0x32, 0x36, 0x36, 0x01,
-	0x11, 0x33, 0x11, 0x23, 0x13, 0x37, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x11, 0x33,
-	0x11, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x04, 0x82, 0x8E, 0x39, 0x8E, 0x81, 0x5A, 0x4E,
-	0x12, 0xFE, 0xA1, 0xBA, 0xB1, 0x1A, 0x4D, 0x2D, 0x64, 0xA2, 0x74, 0x4F, 0x83, 0x5E, 0x33, 0xB9,
-	0x21, 0x39, 0x47, 0x26, 0x76, 0x8A, 0x3D, 0x04, 0x91, 0x6D, 0x94, 0x4A, 0x72, 0x2D, 0x60, 0xFC,
-	0xB5, 0x03, 0x40, 0xFB, 0xC6, 0x01, 0xDE, 0x02, 0x6C, 0xB7, 0x86, 0x4B, 0x2E, 0x60, 0x9A, 0x6C,
-	0x02, 0xBA, 0xFD, 0x44, 0x49, 0x5F, 0x37, 0x16, 0x5B, 0x9B, 0x00, 0x01, 0xFF, 0xB4, 0xFE, 0x4B,
-	0x01, 0x66, 0x04, 0x3A, 0x00, 0x11, 0x00, 0x0E, 0xB6, 0x0D, 0x06, 0x0F, 0x72, 0x01, 0x06, 0x72,
-	0x00, 0x2B, 0x2B, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27,
-	0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0xAD, 0xB9, 0x4D, 0x90, 0x65, 0x1F, 0x34, 0x1D,
-	0x0E, 0x0F, 0x45, 0x0E, 0x2B, 0x3D, 0x21, 0x04, 0x3A, 0xFB, 0x6D, 0x70, 0x9C, 0x50, 0x07, 0x0A,
-	0x94, 0x06, 0x07, 0x2F, 0x58, 0x3D, 0x00, 0x01, 0x00, 0x63, 0xFF, 0xEC, 0x03, 0xEA, 0x04, 0x50,
-	0x00, 0x2A, 0x00, 0x19, 0x40, 0x0C, 0x11, 0x14, 0x14, 0x00, 0x19, 0x0B, 0x0B, 0x72, 0x24, 0x00,
-	0x07, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x32, 0x1E,
-	0x02, 0x15, 0x15, 0x14, 0x0E, 0x02, 0x27, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x21, 0x15, 0x21, 0x15,
-	0x14, 0x16, 0x16, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x07,
-	0x27, 0x36, 0x36, 0x02, 0x00, 0x70, 0xB5, 0x80, 0x45, 0x4B, 0x82, 0xA6, 0x5B, 0x70, 0xA6, 0x6D,
-	0x36, 0x03, 0x19, 0xFD, 0xA0, 0x36, 0x72, 0x58, 0x3C, 0x65, 0x4A, 0x29, 0x27, 0x4C, 0x72, 0x4B,
-	0x6D, 0x96, 0x32, 0x49, 0x32, 0xB9, 0x04, 0x50, 0x50, 0x91, 0xC6, 0x76, 0x2C, 0x76, 0xC6, 0x90,
-	0x4F, 0x01, 0x47, 0x81, 0xB0, 0x6A, 0x7A, 0x98, 0x19, 0x48, 0x7E, 0x4E, 0x3C, 0x6A, 0x8D, 0x50,
-	0x2C, 0x50, 0x8D, 0x6B, 0x3D, 0x3F, 0x2D, 0x7E, 0x30, 0x56, 0x00, 0x01, 0x00, 0xAA, 0x04, 0xE5,
-	0x03, 0x07, 0x06, 0x00, 0x00, 0x08, 0x00, 0x14, 0xB7, 0x07, 0x05, 0x05, 0x04, 0x01, 0x03, 0x80,
-	0x08, 0x00, 0x2F, 0x1A, 0xCD, 0x32, 0x39, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x13, 0x15, 0x23,
-	0x27, 0x07, 0x23, 0x35, 0x13, 0x02, 0x0F, 0xF8, 0x9A, 0x96, 0x95, 0x98, 0xF5, 0x06, 0x00, 0xFE,
-	0xEF, 0x0A, 0xA9, 0xA9, 0x0B, 0x01, 0x10, 0x00, 0x00, 0x01, 0x00, 0x8E, 0x04, 0xE3, 0x02, 0xF8,
-	0x05, 0xFF, 0x00, 0x08, 0x00, 0x12, 0xB6, 0x01, 0x06, 0x80, 0x07, 0x04, 0x02, 0x00, 0x00, 0x2F,
-	0x32, 0x32, 0x32, 0x1A, 0xCD, 0x39, 0x30, 0x31, 0x41, 0x17, 0x37, 0x33, 0x15, 0x03, 0x23, 0x03,
-	0x35, 0x01, 0x2A, 0x97, 0x97, 0xA0, 0xFE, 0x72, 0xFA, 0x05, 0xFF, 0xAA, 0xAA, 0x0A, 0xFE, 0xEE,
-	0x01, 0x12, 0x0A, 0x00, 0xFF, 0xFF, 0x00, 0x8F, 0x05, 0x17, 0x03, 0x2E, 0x05, 0xA5, 0x06, 0x06,
-	0x00, 0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x82, 0x04, 0xCC, 0x02, 0xD8, 0x05, 0xD7, 0x00, 0x0E,
-	0x00, 0x10, 0xB5, 0x01, 0x01, 0x09, 0x80, 0x0C, 0x05, 0x00, 0x2F, 0x33, 0x1A, 0xCC, 0x32, 0x2F,
-	0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33, 0x32,
-	0x36, 0x02, 0x42, 0x96, 0x48, 0x86, 0x5C, 0x8B, 0xA1, 0x96, 0x44, 0x52, 0x50, 0x44, 0x05, 0xD7,
-	0x4E, 0x79, 0x44, 0x95, 0x76, 0x3B, 0x5A, 0x5A, 0x00, 0x01, 0x00, 0x8E, 0x04, 0xEF, 0x01, 0x69,
-	0x05, 0xC2, 0x00, 0x0B, 0x00, 0x09, 0xB2, 0x03, 0x09, 0x10, 0x00, 0x3F, 0x33, 0x30, 0x31, 0x53,
-	0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x8E, 0x37, 0x36, 0x35, 0x39,
-	0x39, 0x35, 0x36, 0x37, 0x05, 0x58, 0x2C, 0x3E, 0x3E, 0x2C, 0x2C, 0x3D, 0x3D, 0x00, 0x00, 0x02,
-	0x00, 0x79, 0x04, 0xB5, 0x02, 0x27, 0x06, 0x51, 0x00, 0x0D, 0x00, 0x19, 0x00, 0x0E, 0xB4, 0x17,
-	0x04, 0x80, 0x11, 0x0B, 0x00, 0x2F, 0x33, 0x1A, 0xCC, 0x32, 0x30, 0x31, 0x53, 0x34, 0x36, 0x36,
-	0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x37, 0x14, 0x16, 0x33, 0x32, 0x36,
-	0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x79, 0x39, 0x61, 0x3D, 0x5B, 0x7C, 0x39, 0x61, 0x3D, 0x5B,
-	0x7C, 0x63, 0x41, 0x33, 0x33, 0x41, 0x41, 0x33, 0x33, 0x41, 0x05, 0x81, 0x3A, 0x5E, 0x38, 0x7A,
-	0x56, 0x3A, 0x5D, 0x35, 0x74, 0x58, 0x2C, 0x47, 0x45, 0x2E, 0x2F, 0x47, 0x47, 0x00, 0x00, 0x01,
-	0x00, 0x32, 0xFE, 0x4E, 0x01, 0x93, 0x00, 0x39, 0x00, 0x15, 0x00, 0x0E, 0xB4, 0x08, 0x0F, 0x80,
-	0x01, 0x00, 0x00, 0x2F, 0x32, 0x1A, 0xCC, 0x32, 0x30, 0x31, 0x65, 0x17, 0x0E, 0x02, 0x15, 0x14,
-	0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x01,
-	0x34, 0x4A, 0x2B, 0x4E, 0x32, 0x23, 0x2B, 0x21, 0x34, 0x0F, 0x0E, 0x19, 0x4D, 0x3B, 0x51, 0x6F,
-	0x35, 0x72, 0x39, 0x39, 0x20, 0x45, 0x4D, 0x2C, 0x21, 0x28, 0x13, 0x08, 0x7A, 0x0F, 0x1D, 0x61,
-	0x5E, 0x36, 0x6A, 0x62, 0x00, 0x01, 0x00, 0x7B, 0x04, 0xDA, 0x03, 0x3F, 0x05, 0xE8, 0x00, 0x19,
-	0x00, 0x27, 0x40, 0x13, 0x00, 0x00, 0x01, 0x01, 0x0A, 0x12, 0x40, 0x0F, 0x1A, 0x48, 0x12, 0x05,
-	0x80, 0x0D, 0x0D, 0x0E, 0x0E, 0x17, 0x05, 0x00, 0x2F, 0x33, 0x33, 0x2F, 0x33, 0x2F, 0x1A, 0x10,
-	0xCD, 0x2B, 0x32, 0x32, 0x2F, 0x33, 0x2F, 0x30, 0x31, 0x41, 0x17, 0x14, 0x06, 0x06, 0x23, 0x22,
-	0x2E, 0x02, 0x23, 0x22, 0x06, 0x15, 0x27, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1E, 0x02, 0x33, 0x32,
-	0x36, 0x02, 0xC2, 0x7D, 0x3A, 0x61, 0x3D, 0x33, 0x42, 0x34, 0x39, 0x2A, 0x2A, 0x39, 0x7D, 0x39,
-	0x62, 0x3C, 0x2B, 0x41, 0x3A, 0x3E, 0x28, 0x2A, 0x3A, 0x05, 0xE8, 0x0B, 0x49, 0x6E, 0x3C, 0x1D,
-	0x25, 0x1D, 0x40, 0x2F, 0x06, 0x49, 0x6F, 0x3F, 0x1D, 0x25, 0x1D, 0x41, 0x00, 0x02, 0x00, 0x5F,
-	0x04, 0xD0, 0x03, 0x2C, 0x05, 0xFF, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0E, 0xB4, 0x01, 0x05, 0x80,
-	0x00, 0x04, 0x00, 0x2F, 0x33, 0x1A, 0xCD, 0x32, 0x30, 0x31, 0x41, 0x13, 0x33, 0x01, 0x21, 0x13,
-	0x33, 0x03, 0x01, 0x77, 0xE6, 0xCF, 0xFE, 0xF4, 0xFE, 0x3F, 0xAA, 0xC6, 0xDA, 0x04, 0xD0, 0x01,
-	0x2F, 0xFE, 0xD1, 0x01, 0x2F, 0xFE, 0xD1, 0x00, 0x00, 0x02, 0x00, 0x7F, 0xFE, 0x6A, 0x01, 0xD6,
-	0xFF, 0xB4, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x0E, 0xB4, 0x0F, 0x09, 0x80, 0x15, 0x03, 0x00, 0x2F,
-	0x33, 0x1A, 0xCC, 0x32, 0x30, 0x31, 0x57, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
-	0x22, 0x26, 0x37, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x7F, 0x67,
-	0x47, 0x45, 0x64, 0x64, 0x45, 0x47, 0x67, 0x57, 0x33, 0x24, 0x22, 0x31, 0x31, 0x22, 0x24, 0x33,
-	0xF3, 0x49, 0x5E, 0x5E, 0x49, 0x49, 0x5A, 0x5A, 0x49, 0x22, 0x31, 0x30, 0x23, 0x25, 0x32, 0x32,
-	0x00, 0x01, 0xFC, 0xA7, 0x04, 0xDA, 0xFE, 0x47, 0x06, 0x00, 0x00, 0x03, 0x00, 0x0A, 0xB2, 0x03,
-	0x80, 0x02, 0x00, 0x2F, 0x1A, 0xCD, 0x30, 0x31, 0x41, 0x13, 0x23, 0x01, 0xFD, 0x86, 0xC1, 0x9E,
-	0xFE, 0xFE, 0x06, 0x00, 0xFE, 0xDA, 0x01, 0x26, 0x00, 0x01, 0xFD, 0x6E, 0x04, 0xDA, 0xFF, 0x0F,
-	0x06, 0x00, 0x00, 0x03, 0x00, 0x0A, 0xB2, 0x01, 0x80, 0x00, 0x00, 0x2F, 0x1A, 0xCD, 0x30, 0x31,
-	0x41, 0x13, 0x33, 0x01, 0xFD, 0x6E, 0xC2, 0xDF, 0xFE, 0xF4, 0x04, 0xDA, 0x01, 0x26, 0xFE, 0xDA,
-	0xFF, 0xFF, 0xFC, 0x8A, 0x04, 0xDA, 0xFF, 0x4E, 0x05, 0xE8, 0x04, 0x07, 0x00, 0xA5, 0xFC, 0x0F,
-	0x00, 0x00, 0x00, 0x01, 0xFD, 0x5D, 0x04, 0xDA, 0xFE, 0x93, 0x06, 0x74, 0x00, 0x14, 0x00, 0x10,
-	0xB5, 0x14, 0x02, 0x00, 0x80, 0x0B, 0x0C, 0x00, 0x2F, 0x33, 0x1A, 0xCC, 0x32, 0x32, 0x30, 0x31,
-	0x41, 0x23, 0x27, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x37, 0x32, 0x1E, 0x02, 0x15, 0x14,
-	0x06, 0x07, 0xFD, 0xF8, 0x85, 0x01, 0x33, 0x40, 0x1E, 0x1A, 0x2E, 0x3C, 0x22, 0x07, 0x4A, 0x71,
-	0x4D, 0x27, 0x60, 0x3A, 0x04, 0xDA, 0x98, 0x03, 0x0F, 0x1F, 0x1A, 0x15, 0x1D, 0x13, 0x08, 0x6A,
-	0x1A, 0x32, 0x45, 0x2A, 0x4C, 0x45, 0x08, 0x00, 0x00, 0x02, 0xFC, 0x27, 0x04, 0xE4, 0xFF, 0x06,
-	0x05, 0xEE, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0E, 0xB4, 0x07, 0x03, 0x80, 0x04, 0x00, 0x00, 0x2F,
-	0x32, 0x1A, 0xCD, 0x32, 0x30, 0x31, 0x41, 0x23, 0x01, 0x33, 0x01, 0x23, 0x03, 0x33, 0xFE, 0x01,
-	0xA9, 0xFE, 0xCF, 0xE1, 0x01, 0xFE, 0x96, 0xF6, 0xCF, 0x04, 0xE4, 0x01, 0x0A, 0xFE, 0xF6, 0x01,
-	0x0A, 0x00, 0x00, 0x01, 0xFD, 0x38, 0xFE, 0xA2, 0xFE, 0x13, 0xFF, 0x75, 0x00, 0x0B, 0x00, 0x08,
-	0xB1, 0x03, 0x09, 0x00, 0x2F, 0x33, 0x30, 0x31, 0x45, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
-	0x06, 0x23, 0x22, 0x26, 0xFD, 0x38, 0x37, 0x36, 0x35, 0x39, 0x39, 0x35, 0x36, 0x37, 0xF6, 0x2D,
-	0x3E, 0x3E, 0x2D, 0x2B, 0x3D, 0x3D, 0x00, 0x01, 0x00, 0xB8, 0x04, 0xEF, 0x01, 0x9C, 0x06, 0x3F,
-	0x00, 0x03, 0x00, 0x0A, 0xB2, 0x00, 0x80, 0x01, 0x00, 0x2F, 0x1A, 0xCD, 0x30, 0x31, 0x53, 0x13,
-	0x33, 0x03, 0xB8, 0x36, 0xAE, 0x74, 0x04, 0xEF, 0x01, 0x50, 0xFE, 0xB0, 0x00, 0x03, 0x00, 0x72,
-	0x04, 0xF1, 0x03, 0x83, 0x06, 0x89, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x19, 0x40, 0x0A,
-	0x13, 0x19, 0x19, 0x0D, 0x01, 0x80, 0x00, 0x00, 0x07, 0x0D, 0x00, 0x2F, 0x33, 0x33, 0x2F, 0x1A,
-	0xCD, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x13, 0x33, 0x03, 0x05, 0x34, 0x36, 0x33, 0x32,
-	0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x25, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
-	0x23, 0x22, 0x26, 0x01, 0xB1, 0x30, 0xBC, 0x64, 0xFE, 0x39, 0x37, 0x36, 0x35, 0x39, 0x39, 0x35,
-	0x36, 0x37, 0x02, 0x36, 0x38, 0x35, 0x36, 0x38, 0x38, 0x36, 0x35, 0x38, 0x05, 0x81, 0x01, 0x08,
-	0xFE, 0xF8, 0x26, 0x2D, 0x3E, 0x3E, 0x2D, 0x2B, 0x3D, 0x3D, 0x29, 0x2D, 0x3E, 0x3E, 0x2D, 0x2B,
-	0x3D, 0x3D, 0xFF, 0xFF, 0x00, 0x94, 0x02, 0x6C, 0x01, 0x79, 0x03, 0x49, 0x06, 0x06, 0x00, 0x78,
-	0x00, 0x00, 0x00, 0x01, 0x00, 0xB2, 0x00, 0x00, 0x04, 0x30, 0x05, 0xB0, 0x00, 0x05, 0x00, 0x0E,
-	0xB6, 0x02, 0x05, 0x02, 0x72, 0x04, 0x08, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x30, 0x31, 0x41, 0x15,
-	0x21, 0x11, 0x23, 0x11, 0x04, 0x30, 0xFD, 0x42, 0xC0, 0x05, 0xB0, 0x9E, 0xFA, 0xEE, 0x05, 0xB0,
-	0x00, 0x03, 0x00, 0x20, 0x00, 0x00, 0x05, 0x74, 0x05, 0xB0, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0D,
-	0x00, 0x1B, 0x40, 0x0D, 0x06, 0x02, 0x07, 0x03, 0x02, 0x72, 0x0D, 0x0C, 0x0C, 0x05, 0x02, 0x12,
-	0x72, 0x00, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x12, 0x39, 0x30, 0x31, 0x41, 0x01, 0x23,
-	0x01, 0x33, 0x01, 0x01, 0x37, 0x33, 0x01, 0x27, 0x15, 0x21, 0x35, 0x03, 0x02, 0xFD, 0xE4, 0xC6,
-	0x02, 0x66, 0x79, 0x01, 0xAF, 0xFE, 0x02, 0x06, 0x7A, 0x02, 0x44, 0x98, 0xFB, 0xD6, 0x05, 0x28,
-	0xFA, 0xD8, 0x05, 0xB0, 0xFA, 0x50, 0x05, 0x30, 0x80, 0xFA, 0x50, 0x9D, 0x9D, 0x9D, 0x00, 0x03,
-	0x00, 0x67, 0xFF, 0xEC, 0x04, 0xFA, 0x05, 0xC4, 0x00, 0x03, 0x00, 0x1B, 0x00, 0x33, 0x00, 0x1B,
-	0x40, 0x0D, 0x2F, 0x0A, 0x03, 0x02, 0x02, 0x0A, 0x23, 0x16, 0x03, 0x72, 0x0A, 0x09, 0x72, 0x00,
-	0x2B, 0x2B, 0x32, 0x11, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x05,
-	0x15, 0x14, 0x02, 0x06, 0x06, 0x23, 0x22, 0x2E, 0x03, 0x35, 0x35, 0x34, 0x12, 0x36, 0x36, 0x33,
-	0x32, 0x1E, 0x03, 0x07, 0x35, 0x34, 0x2E, 0x03, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E,
-	0x03, 0x33, 0x32, 0x3E, 0x02, 0x03, 0xC0, 0xFD, 0xFC, 0x03, 0x3E, 0x52, 0x9A, 0xD7, 0x85, 0x67,
-	0xB4, 0x91, 0x68, 0x37, 0x55, 0x9C, 0xD7, 0x81, 0x6A, 0xB6, 0x8F, 0x66, 0x35, 0xBF, 0x22, 0x42,
-	0x60, 0x7C, 0x4B, 0x59, 0x91, 0x68, 0x38, 0x24, 0x45, 0x61, 0x7B, 0x47, 0x5E, 0x92, 0x65, 0x34,
-	0x03, 0x2B, 0x97, 0x97, 0x25, 0x5C, 0xA4, 0xFE, 0xFC, 0xB6, 0x60, 0x3E, 0x77, 0xAB, 0xDB, 0x83,
-	0x5C, 0xA4, 0x01, 0x03, 0xB7, 0x60, 0x3E, 0x77, 0xAB, 0xDB, 0xDF, 0x5E, 0x68, 0xA9, 0x82, 0x58,
-	0x2D, 0x46, 0x88, 0xC8, 0x82, 0x5E, 0x69, 0xAA, 0x83, 0x58, 0x2D, 0x46, 0x89, 0xC9, 0x00, 0x02,
-	0x00, 0x32, 0x00, 0x00, 0x05, 0x03, 0x05, 0xB0, 0x00, 0x04, 0x00, 0x09, 0x00, 0x17, 0x40, 0x0B,
-	0x06, 0x00, 0x02, 0x07, 0x03, 0x02, 0x72, 0x05, 0x02, 0x08, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32,
-	0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x33, 0x01, 0x01, 0x37, 0x33, 0x01, 0x02,
-	0xCA, 0xFE, 0x37, 0xCF, 0x02, 0x13, 0x7E, 0x01, 0x72, 0xFE, 0x33, 0x0A, 0x7F, 0x02, 0x12, 0x05,
-	0x11, 0xFA, 0xEF, 0x05, 0xB0, 0xFA, 0x50, 0x05, 0x17, 0x99, 0xFA, 0x50, 0x00, 0x03, 0x00, 0x78,
-	0x00, 0x00, 0x04, 0x22, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x1B, 0x40, 0x0D,
-	0x01, 0x00, 0x05, 0x04, 0x04, 0x00, 0x08, 0x09, 0x02, 0x72, 0x00, 0x08, 0x72, 0x00, 0x2B, 0x2B,
-	0x32, 0x11, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x30, 0x31, 0x73, 0x35, 0x21, 0x15, 0x01, 0x35, 0x21,
-	0x15, 0x01, 0x35, 0x21, 0x15, 0x78, 0x03, 0xAA, 0xFC, 0xAD, 0x02, 0xF2, 0xFC, 0xBB, 0x03, 0x95,
-	0x9D, 0x9D, 0x02, 0xA2, 0x9D, 0x9D, 0x02, 0x70, 0x9E, 0x9E, 0x00, 0x01, 0x00, 0xB2, 0x00, 0x00,
-	0x05, 0x01, 0x05, 0xB0, 0x00, 0x07, 0x00, 0x13, 0x40, 0x09, 0x02, 0x06, 0x04, 0x07, 0x02, 0x72,
-	0x06, 0x08, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21,
-	0x11, 0x23, 0x11, 0x05, 0x01, 0xC0, 0xFD, 0x32, 0xC1, 0x05, 0xB0, 0xFA, 0x50, 0x05, 0x12, 0xFA,
-	0xEE, 0x05, 0xB0, 0x00, 0x00, 0x03, 0x00, 0x46, 0x00, 0x00, 0x04, 0x44, 0x05, 0xB0, 0x00, 0x03,
-	0x00, 0x07, 0x00, 0x10, 0x00, 0x21, 0x40, 0x10, 0x0E, 0x06, 0x06, 0x07, 0x07, 0x0F, 0x02, 0x72,
-	0x0C, 0x03, 0x03, 0x02, 0x02, 0x0B, 0x08, 0x72, 0x00, 0x2B, 0x32, 0x11, 0x33, 0x11, 0x33, 0x2B,
-	0x32, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01,
-	0x15, 0x01, 0x23, 0x35, 0x01, 0x01, 0x35, 0x33, 0x04, 0x44, 0xFC, 0x4D, 0x03, 0x83, 0xFC, 0x60,
-	0x02, 0x7F, 0xFD, 0xC7, 0x74, 0x01, 0xE1, 0xFE, 0x1F, 0x74, 0x9E, 0x9E, 0x9E, 0x05, 0x12, 0x9E,
-	0x9E, 0xFD, 0x36, 0x18, 0xFD, 0x32, 0x8F, 0x02, 0x4B, 0x02, 0x47, 0x8F, 0x00, 0x03, 0x00, 0x4E,
-	0x00, 0x00, 0x05, 0x74, 0x05, 0xB0, 0x00, 0x13, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x21, 0x40, 0x10,
-	0x14, 0x15, 0x15, 0x01, 0x00, 0x29, 0x08, 0x72, 0x1F, 0x1E, 0x1E, 0x0A, 0x0B, 0x28, 0x02, 0x72,
-	0x00, 0x2B, 0xCD, 0x32, 0x32, 0x11, 0x33, 0x2B, 0xCD, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x65,
-	0x23, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x36, 0x24, 0x33, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x06,
-	0x04, 0x25, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x23, 0x22, 0x06, 0x06, 0x15,
-	0x14, 0x1E, 0x02, 0x01, 0x11, 0x23, 0x11, 0x03, 0x32, 0xA3, 0x82, 0xD4, 0x99, 0x52, 0x92, 0x01,
-	0x01, 0xA9, 0xAC, 0x7F, 0xD2, 0x99, 0x54, 0x90, 0xFE, 0xFC, 0xFE, 0xAF, 0xA5, 0x83, 0xAA, 0x54,
-	0x30, 0x5F, 0x8F, 0x5F, 0xAE, 0x7F, 0xAA, 0x55, 0x2F, 0x60, 0x92, 0x01, 0x15, 0xC1, 0xB0, 0x4F,
-	0x91, 0xC9, 0x79, 0xA2, 0xF8, 0x8C, 0x4F, 0x93, 0xC8, 0x7A, 0xA2, 0xF7, 0x8B, 0x9F, 0x60, 0xAF,
-	0x76, 0x59, 0x8F, 0x66, 0x37, 0x61, 0xAF, 0x77, 0x58, 0x8F, 0x66, 0x36, 0x04, 0x61, 0xFA, 0x50,
-	0x05, 0xB0, 0x00, 0x02, 0x00, 0x5A, 0x00, 0x00, 0x05, 0x22, 0x05, 0xB0, 0x00, 0x19, 0x00, 0x1D,
-	0x00, 0x19, 0x40, 0x0C, 0x14, 0x07, 0x07, 0x0D, 0x1C, 0x08, 0x72, 0x1D, 0x01, 0x0D, 0x02, 0x72,
-	0x00, 0x2B, 0x32, 0x32, 0x2B, 0x11, 0x39, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x06,
-	0x04, 0x23, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1E, 0x02, 0x33, 0x33, 0x32,
-	0x36, 0x36, 0x35, 0x01, 0x11, 0x23, 0x11, 0x04, 0x60, 0xC2, 0x9D, 0xFE, 0xEE, 0xAF, 0x1D, 0x7F,
-	0xD8, 0x9E, 0x58, 0xC0, 0x3B, 0x6A, 0x92, 0x57, 0x1D, 0x7B, 0xB9, 0x67, 0xFE, 0xB7, 0xC1, 0x05,
-	0xB0, 0xFD, 0xF2, 0xB7, 0xFF, 0x85, 0x4B, 0x92, 0xD5, 0x89, 0x02, 0x0E, 0xFD, 0xF2, 0x63, 0x9A,
-	0x6A, 0x36, 0x60, 0xB9, 0x84, 0x02, 0x0E, 0xFA, 0x50, 0x05, 0xB0, 0x00, 0x00, 0x03, 0x00, 0x72,
-	0x00, 0x00, 0x04, 0xCC, 0x05, 0xC4, 0x00, 0x2D, 0x00, 0x31, 0x00, 0x35, 0x00, 0x25, 0x40, 0x12,
-	0x28, 0x12, 0x12, 0x2F, 0x29, 0x29, 0x34, 0x11, 0x11, 0x33, 0x2E, 0x32, 0x12, 0x72, 0x06, 0x1D,
-	0x03, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x32, 0x32, 0x11, 0x33, 0x33, 0x11, 0x33, 0x32, 0x11,
-	0x33, 0x30, 0x31, 0x41, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E,
-	0x02, 0x17, 0x15, 0x2E, 0x03, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x15,
-	0x14, 0x0E, 0x02, 0x07, 0x35, 0x3E, 0x03, 0x01, 0x35, 0x21, 0x15, 0x21, 0x35, 0x21, 0x15, 0x04,
-	0x09, 0x32, 0x60, 0x86, 0x54, 0x53, 0x85, 0x5E, 0x32, 0x2B, 0x50, 0x6F, 0x43, 0x6C, 0xB5, 0x85,
-	0x4A, 0x50, 0x94, 0xCB, 0x7C, 0x7D, 0xCD, 0x94, 0x51, 0x49, 0x84, 0xB3, 0x6A, 0x42, 0x6D, 0x4E,
-	0x2A, 0xFE, 0xD9, 0x01, 0xE3, 0xFB, 0xB1, 0x01, 0xEC, 0x02, 0xD6, 0x74, 0x75, 0xB2, 0x79, 0x3D,
-	0x3D, 0x79, 0xB2, 0x75, 0x74, 0x80, 0xC6, 0x8D, 0x53, 0x0D, 0x8D, 0x0D, 0x7F, 0xC5, 0xF0, 0x7F,
-	0x72, 0x8E, 0xE9, 0xA9, 0x5C, 0x5C, 0xA9, 0xE9, 0x8E, 0x72, 0x7E, 0xF0, 0xC5, 0x7F, 0x0E, 0x8D,
-	0x0E, 0x53, 0x8D, 0xC6, 0xFD, 0xA9, 0x9D, 0x9D, 0x9D, 0x9D, 0x00, 0x03, 0x00, 0x64, 0xFF, 0xEB,
-	0x04, 0x78, 0x04, 0x4E, 0x00, 0x16, 0x00, 0x2C, 0x00, 0x41, 0x00, 0x1A, 0x40, 0x0D, 0x2E, 0x06,
-	0x34, 0x3B, 0x3B, 0x1D, 0x12, 0x0B, 0x72, 0x28, 0x06, 0x07, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32,
-	0x32, 0x11, 0x33, 0x3F, 0x30, 0x31, 0x53, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x03, 0x17,
-	0x15, 0x0E, 0x03, 0x23, 0x22, 0x2E, 0x02, 0x37, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02,
-	0x37, 0x35, 0x2E, 0x03, 0x23, 0x22, 0x0E, 0x02, 0x01, 0x33, 0x11, 0x14, 0x1E, 0x02, 0x33, 0x32,
-	0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x11, 0x64, 0x38, 0x6B, 0x9E, 0x66,
-	0x4E, 0x7D, 0x60, 0x44, 0x2A, 0x09, 0x0B, 0x3C, 0x66, 0x94, 0x63, 0x64, 0x9D, 0x6C, 0x38, 0xBA,
-	0x20, 0x43, 0x6B, 0x4B, 0x49, 0x68, 0x47, 0x2F, 0x10, 0x0C, 0x2D, 0x49, 0x6A, 0x49, 0x4C, 0x6B,
-	0x44, 0x20, 0x02, 0x34, 0x9D, 0x0C, 0x17, 0x1D, 0x10, 0x0A, 0x11, 0x07, 0x17, 0x1F, 0x3C, 0x20,
-	0x2F, 0x4A, 0x34, 0x1B, 0x01, 0xF5, 0x15, 0x80, 0xD4, 0x9B, 0x55, 0x2E, 0x59, 0x7F, 0xA2, 0x61,
-	0x53, 0x78, 0xBF, 0x88, 0x48, 0x4D, 0x8C, 0xBF, 0x87, 0x15, 0x4D, 0x86, 0x66, 0x39, 0x3C, 0x67,
-	0x84, 0x47, 0x42, 0x49, 0x8A, 0x6F, 0x41, 0x44, 0x76, 0x9B, 0x01, 0xD9, 0xFC, 0xED, 0x2E, 0x3A,
-	0x21, 0x0D, 0x04, 0x02, 0x8A, 0x16, 0x0C, 0x23, 0x4B, 0x79, 0x55, 0x02, 0x28, 0x00, 0x00, 0x02,
-	0x00, 0xA1, 0xFE, 0x80, 0x04, 0x4E, 0x05, 0xC4, 0x00, 0x1C, 0x00, 0x3A, 0x00, 0x1E, 0x40, 0x0E,
-	0x35, 0x00, 0x26, 0x27, 0x27, 0x1C, 0x1C, 0x30, 0x1D, 0x03, 0x13, 0x09, 0x0B, 0x72, 0x00, 0x2B,
-	0x32, 0x3F, 0x33, 0x39, 0x2F, 0x33, 0x12, 0x39, 0x39, 0x2F, 0x30, 0x31, 0x41, 0x33, 0x32, 0x16,
-	0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x37, 0x14, 0x16, 0x16, 0x33, 0x32,
-	0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x13, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
-	0x23, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
-	0x11, 0x23, 0x11, 0x34, 0x36, 0x36, 0x02, 0x05, 0x93, 0x8B, 0xC3, 0x68, 0x75, 0xCD, 0x84, 0x4E,
-	0x99, 0x7E, 0x4B, 0x49, 0x56, 0x99, 0x65, 0x5C, 0x80, 0x43, 0x3B, 0x72, 0x53, 0x8F, 0x59, 0x82,
-	0xC0, 0x69, 0x6A, 0xC0, 0x81, 0x59, 0x55, 0x58, 0x6C, 0x32, 0x36, 0x6B, 0x51, 0x49, 0x76, 0x45,
-	0xB9, 0x7A, 0xCA, 0x03, 0x38, 0x69, 0xB4, 0x72, 0x8E, 0xC7, 0x68, 0x2C, 0x5B, 0x90, 0x63, 0x29,
-	0x49, 0x7A, 0x49, 0x4B, 0x83, 0x54, 0x46, 0x83, 0x54, 0x03, 0x02, 0x64, 0xB1, 0x73, 0x5F, 0x9D,
-	0x5E, 0x78, 0x3B, 0x68, 0x43, 0x3C, 0x6C, 0x44, 0x41, 0x72, 0x48, 0xFA, 0x4F, 0x05, 0xB1, 0x6F,
-	0xB7, 0x6D, 0x00, 0x03, 0x00, 0x2F, 0xFE, 0x5F, 0x03, 0xE0, 0x04, 0x3A, 0x00, 0x03, 0x00, 0x08,
-	0x00, 0x0D, 0x00, 0x19, 0x40, 0x0E, 0x08, 0x0C, 0x03, 0x04, 0x0A, 0x05, 0x01, 0x05, 0x0D, 0x06,
-	0x72, 0x01, 0x0E, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31, 0x65, 0x11, 0x23,
-	0x11, 0x37, 0x01, 0x33, 0x01, 0x23, 0x03, 0x01, 0x17, 0x23, 0x01, 0x02, 0x64, 0xB9, 0x57, 0x01,
-	0x20, 0xBE, 0xFE, 0x6F, 0x7B, 0xE8, 0x01, 0x28, 0x29, 0x7B, 0xFE, 0x6D, 0x84, 0xFD, 0xDB, 0x02,
-	0x25, 0x77, 0x03, 0x3F, 0xFB, 0xC6, 0x04, 0x3A, 0xFC, 0xC0, 0xFA, 0x04, 0x3A, 0x00, 0x00, 0x02,
-	0x00, 0x61, 0xFF, 0xEC, 0x04, 0x28, 0x06, 0x1D, 0x00, 0x2C, 0x00, 0x42, 0x00, 0x19, 0x40, 0x0D,
-	0x14, 0x28, 0x3E, 0x03, 0x04, 0x33, 0x1E, 0x0B, 0x72, 0x0B, 0x04, 0x01, 0x72, 0x00, 0x2B, 0x32,
-	0x2B, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31, 0x53, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07,
-	0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1E, 0x02, 0x17, 0x1E, 0x02, 0x15, 0x15, 0x14,
-	0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x36, 0x36, 0x37, 0x27, 0x2E, 0x02, 0x13,
-	0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x34, 0x2E, 0x02, 0x27, 0x22, 0x0E,
-	0x02, 0xDD, 0x5C, 0xA9, 0x76, 0x4F, 0x7E, 0x43, 0x01, 0x2E, 0x93, 0x52, 0x39, 0x54, 0x2E, 0x14,
-	0x32, 0x5A, 0x47, 0x8F, 0xBC, 0x5D, 0x41, 0x7D, 0xB3, 0x71, 0x73, 0xB4, 0x7D, 0x41, 0x5C, 0x97,
-	0x58, 0x01, 0x41, 0x5D, 0x30, 0x3E, 0x24, 0x49, 0x71, 0x4D, 0x4C, 0x6F, 0x49, 0x23, 0x2A, 0x4E,
-	0x6B, 0x42, 0x4C, 0x72, 0x4A, 0x25, 0x04, 0xF5, 0x5B, 0x85, 0x48, 0x1B, 0x1D, 0x9F, 0x11, 0x2A,
-	0x21, 0x3D, 0x29, 0x14, 0x2E, 0x30, 0x31, 0x18, 0x31, 0x9D, 0xD7, 0x87, 0x16, 0x71, 0xC1, 0x8F,
-	0x50, 0x50, 0x8F, 0xC1, 0x71, 0x16, 0x77, 0xC2, 0x82, 0x15, 0x05, 0x1A, 0x50, 0x68, 0xFD, 0x59,
-	0x16, 0x4D, 0x88, 0x69, 0x3C, 0x3C, 0x69, 0x88, 0x4D, 0x16, 0x40, 0x7C, 0x6A, 0x49, 0x0D, 0x3D,
-	0x6A, 0x89, 0x00, 0x02, 0x00, 0x64, 0xFF, 0xEC, 0x03, 0xEC, 0x04, 0x4D, 0x00, 0x1F, 0x00, 0x3F,
-	0x00, 0x1F, 0x40, 0x0F, 0x00, 0x21, 0x3E, 0x3E, 0x03, 0x03, 0x16, 0x35, 0x2B, 0x07, 0x72, 0x0C,
-	0x16, 0x0B, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x12, 0x39, 0x2F, 0x33, 0x12, 0x39, 0x39, 0x30,
-	0x31, 0x41, 0x33, 0x15, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36,
-	0x35, 0x33, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x05, 0x23, 0x22,
-	0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23,
-	0x22, 0x06, 0x06, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x33, 0x02, 0x0D, 0xDC, 0xCD, 0x53, 0x71, 0x3A,
-	0x23, 0x45, 0x63, 0x3F, 0x51, 0x78, 0x43, 0xB8, 0x4E, 0x82, 0xA1, 0x53, 0x62, 0xA5, 0x7A, 0x43,
-	0x39, 0x6D, 0x9E, 0x01, 0x41, 0xDC, 0x5C, 0x96, 0x6B, 0x39, 0x3D, 0x72, 0xA0, 0x62, 0x59, 0x9C,
-	0x79, 0x44, 0xB8, 0x43, 0x71, 0x46, 0x55, 0x6E, 0x35, 0x1B, 0x38, 0x5A, 0x3F, 0xCD, 0x02, 0x4B,
-	0x6C, 0x25, 0x4D, 0x3D, 0x23, 0x3F, 0x30, 0x1C, 0x36, 0x57, 0x31, 0x58, 0x81, 0x53, 0x28, 0x2C,
-	0x54, 0x79, 0x4C, 0x44, 0x69, 0x48, 0x25, 0x46, 0x2A, 0x4B, 0x62, 0x37, 0x4D, 0x75, 0x4F, 0x29,
-	0x2C, 0x54, 0x76, 0x4A, 0x30, 0x4D, 0x2D, 0x2F, 0x4B, 0x2A, 0x23, 0x3B, 0x2B, 0x18, 0x00, 0x02,
-	0x00, 0x6D, 0xFE, 0x80, 0x03, 0xC4, 0x05, 0xB0, 0x00, 0x28, 0x00, 0x2C, 0x00, 0x15, 0x40, 0x09,
-	0x15, 0x02, 0x2C, 0x2C, 0x29, 0x29, 0x00, 0x02, 0x72, 0x00, 0x2B, 0x32, 0x2F, 0x33, 0x11, 0x33,
-	0x2F, 0x30, 0x31, 0x41, 0x33, 0x15, 0x01, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x17, 0x17, 0x1E,
-	0x02, 0x15, 0x14, 0x06, 0x06, 0x07, 0x27, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x26, 0x27, 0x27, 0x2E,
-	0x03, 0x35, 0x34, 0x36, 0x36, 0x37, 0x01, 0x21, 0x15, 0x21, 0x03, 0x70, 0x54, 0xFE, 0xA1, 0x4D,
-	0x6B, 0x37, 0x12, 0x26, 0x3D, 0x2A, 0x82, 0x4A, 0x75, 0x43, 0x3B, 0x51, 0x24, 0x62, 0x1F, 0x2B,
-	0x17, 0x20, 0x43, 0x36, 0x5A, 0x57, 0x77, 0x4A, 0x21, 0x38, 0x7B, 0x64, 0xFE, 0x9A, 0x03, 0x1D,
-	0xFC, 0xE3, 0x05, 0xB0, 0x78, 0xFE, 0x56, 0x5C, 0xA2, 0xA8, 0x66, 0x30, 0x46, 0x33, 0x22, 0x0C,
-	0x26, 0x15, 0x27, 0x4F, 0x52, 0x35, 0x73, 0x63, 0x1D, 0x55, 0x23, 0x3C, 0x39, 0x1E, 0x17, 0x26,
-	0x20, 0x0E, 0x18, 0x17, 0x3E, 0x56, 0x75, 0x4F, 0x4A, 0xC0, 0xDE, 0x77, 0x01, 0xD4, 0x97, 0x00,
-	0x00, 0x02, 0x00, 0x92, 0xFE, 0x61, 0x03, 0xF1, 0x04, 0x4E, 0x00, 0x04, 0x00, 0x1C, 0x00, 0x17,
-	0x40, 0x0C, 0x18, 0x0B, 0x03, 0x06, 0x72, 0x02, 0x0A, 0x72, 0x0B, 0x07, 0x72, 0x11, 0x00, 0x2F,
-	0x2B, 0x2B, 0x2B, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x33, 0x03, 0x07, 0x34, 0x3E,
-	0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02,
-	0x01, 0x4B, 0xB9, 0xA6, 0x13, 0x4E, 0x3A, 0x6F, 0x9F, 0x64, 0x54, 0x88, 0x5F, 0x33, 0xB9, 0x1F,
-	0x3D, 0x57, 0x39, 0x4F, 0x70, 0x47, 0x21, 0x03, 0x53, 0xFC, 0xAD, 0x04, 0x3A, 0xFE, 0x06, 0x02,
-	0x73, 0xC1, 0x8E, 0x4E, 0x28, 0x5E, 0x9D, 0x75, 0xFB, 0xAB, 0x04, 0x52, 0x4A, 0x64, 0x3B, 0x1A,
-	0x3B, 0x68, 0x87, 0x00, 0x00, 0x03, 0x00, 0x7B, 0xFF, 0xEC, 0x04, 0x12, 0x05, 0xC4, 0x00, 0x19,
-	0x00, 0x27, 0x00, 0x36, 0x00, 0x1D, 0x40, 0x10, 0x0D, 0x28, 0x6A, 0x30, 0x20, 0x6A, 0x30, 0x30,
-	0x0D, 0x00, 0x1A, 0x6A, 0x00, 0x0D, 0x0B, 0x72, 0x00, 0x2B, 0x2F, 0x2B, 0x12, 0x39, 0x2F, 0x2B,
-	0x2B, 0x30, 0x31, 0x41, 0x32, 0x1E, 0x03, 0x15, 0x15, 0x14, 0x0E, 0x03, 0x23, 0x22, 0x2E, 0x03,
-	0x35, 0x35, 0x34, 0x3E, 0x03, 0x17, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x21, 0x35, 0x34, 0x2E, 0x03,
-	0x03, 0x32, 0x3E, 0x03, 0x35, 0x35, 0x21, 0x15, 0x14, 0x1E, 0x03, 0x02, 0x46, 0x55, 0x8E, 0x71,
-	0x4F, 0x29, 0x29, 0x4E, 0x70, 0x8E, 0x55, 0x54, 0x8E, 0x71, 0x50, 0x2A, 0x2A, 0x4F, 0x70, 0x8E,
-	0x54, 0x42, 0x67, 0x45, 0x24, 0x02, 0x25, 0x17, 0x2C, 0x43, 0x57, 0x34, 0x36, 0x57, 0x42, 0x2C,
-	0x16, 0xFD, 0xDB, 0x17, 0x2E, 0x43, 0x57, 0x05, 0xC4, 0x31, 0x65, 0x9B, 0xD3, 0x87, 0xB9, 0x87,
-	0xD4, 0x9E, 0x68, 0x33, 0x33, 0x68, 0x9E, 0xD4, 0x87, 0xB9, 0x87, 0xD3, 0x9B, 0x65, 0x31, 0x97,
-	0x3E, 0x78, 0xAE, 0x71, 0x37, 0x37, 0x5A, 0x94, 0x72, 0x4D, 0x28, 0xFB, 0x57, 0x2A, 0x50, 0x75,
-	0x96, 0x5A, 0x27, 0x27, 0x5A, 0x96, 0x75, 0x50, 0x2A, 0x00, 0x00, 0x01, 0x00, 0xC3, 0xFF, 0xF3,
-	0x02, 0x4C, 0x04, 0x3A, 0x00, 0x11, 0x00, 0x0E, 0xB6, 0x06, 0x0D, 0x0B, 0x72, 0x00, 0x06, 0x72,
-	0x00, 0x2B, 0x2B, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37,
-	0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0xC3, 0xBA, 0x22, 0x36, 0x1F, 0x17, 0x33, 0x0D,
-	0x01, 0x16, 0x47, 0x32, 0x44, 0x72, 0x44, 0x04, 0x3A, 0xFC, 0xDA, 0x37, 0x38, 0x13, 0x09, 0x03,
-	0x96, 0x07, 0x0E, 0x37, 0x7F, 0x6C, 0x00, 0x02, 0x00, 0x26, 0xFF, 0xEF, 0x04, 0x3B, 0x05, 0xEE,
-	0x00, 0x04, 0x00, 0x26, 0x00, 0x1E, 0x40, 0x10, 0x00, 0x1B, 0x04, 0x03, 0x04, 0x02, 0x20, 0x05,
-	0x00, 0x72, 0x0F, 0x16, 0x16, 0x02, 0x0A, 0x72, 0x00, 0x2B, 0x32, 0x2F, 0x33, 0x2B, 0x32, 0x12,
-	0x17, 0x39, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x17, 0x01, 0x32, 0x1E, 0x02, 0x17, 0x01, 0x1E,
-	0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x27, 0x01, 0x03, 0x2E,
-	0x02, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x02, 0x1B, 0xFE, 0xD8, 0xCD, 0x01, 0xA5, 0x82,
-	0xFE, 0xB9, 0x38, 0x52, 0x3B, 0x28, 0x0E, 0x01, 0xAB, 0x0E, 0x1C, 0x22, 0x18, 0x09, 0x15, 0x07,
-	0x06, 0x0B, 0x2B, 0x17, 0x3D, 0x57, 0x42, 0x21, 0xFE, 0xCE, 0x76, 0x0F, 0x21, 0x2B, 0x1E, 0x08,
-	0x1E, 0x09, 0x01, 0x0F, 0x3C, 0x03, 0x27, 0xFC, 0xD9, 0x04, 0x4E, 0x0C, 0x01, 0xAC, 0x18, 0x2E,
-	0x40, 0x28, 0xFB, 0xAA, 0x21, 0x27, 0x11, 0x01, 0x01, 0x98, 0x04, 0x08, 0x1D, 0x57, 0x57, 0x03,
-	0x18, 0x01, 0x1F, 0x26, 0x2C, 0x13, 0x01, 0x01, 0x8E, 0x05, 0x07, 0x00, 0x00, 0x02, 0x00, 0x66,
-	0xFE, 0x76, 0x03, 0xAA, 0x05, 0xC4, 0x00, 0x1E, 0x00, 0x46, 0x00, 0x19, 0x40, 0x0B, 0x1F, 0x11,
-	0x0F, 0x0F, 0x21, 0x21, 0x33, 0x05, 0x1B, 0x03, 0x72, 0x00, 0x2B, 0x32, 0x2F, 0x39, 0x2F, 0x33,
-	0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x07, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1E,
-	0x02, 0x33, 0x33, 0x15, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16,
-	0x03, 0x33, 0x15, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x17, 0x17, 0x1E, 0x02, 0x15,
-	0x0E, 0x02, 0x07, 0x27, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x26, 0x27, 0x27, 0x2E, 0x03, 0x35, 0x34,
-	0x3E, 0x02, 0x03, 0x8D, 0x1A, 0x25, 0x4B, 0x4D, 0x28, 0x69, 0x86, 0x3F, 0x25, 0x4E, 0x7C, 0x57,
-	0x8D, 0x91, 0x73, 0xBA, 0x86, 0x48, 0x44, 0x80, 0xB2, 0x6F, 0x2F, 0x5E, 0x55, 0xCC, 0x91, 0x8D,
-	0x7C, 0xAF, 0x5C, 0x50, 0x80, 0x49, 0x6F, 0x52, 0x73, 0x3E, 0x01, 0x3B, 0x51, 0x23, 0x6B, 0x1E,
-	0x30, 0x1C, 0x1F, 0x43, 0x38, 0x3A, 0x63, 0xA4, 0x77, 0x41, 0x54, 0x99, 0xD1, 0x05, 0x9D, 0x94,
-	0x0A, 0x10, 0x0A, 0x35, 0x55, 0x32, 0x31, 0x51, 0x3A, 0x1F, 0x74, 0x33, 0x5A, 0x78, 0x46, 0x52,
-	0x7F, 0x58, 0x2E, 0x0A, 0x12, 0xFD, 0xC6, 0x70, 0x45, 0x8F, 0x6E, 0x59, 0x7A, 0x49, 0x12, 0x1A,
-	0x14, 0x2E, 0x50, 0x47, 0x35, 0x71, 0x62, 0x1D, 0x55, 0x23, 0x36, 0x3A, 0x27, 0x1A, 0x23, 0x1B,
-	0x0D, 0x0E, 0x17, 0x42, 0x65, 0x9A, 0x70, 0x6A, 0xA0, 0x6D, 0x37, 0x00, 0x00, 0x03, 0x00, 0x29,
-	0xFF, 0xF3, 0x04, 0xA5, 0x04, 0x3A, 0x00, 0x03, 0x00, 0x07, 0x00, 0x19, 0x00, 0x19, 0x40, 0x0D,
-	0x0E, 0x15, 0x0B, 0x72, 0x06, 0x0A, 0x72, 0x09, 0x07, 0x02, 0x03, 0x06, 0x72, 0x00, 0x2B, 0x32,
-	0x32, 0x32, 0x2B, 0x2B, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x21,
-	0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26,
-	0x35, 0x04, 0x71, 0xFB, 0xB8, 0x01, 0x63, 0xBA, 0x02, 0x4A, 0xBA, 0x22, 0x36, 0x1F, 0x17, 0x33,
-	0x0D, 0x01, 0x16, 0x47, 0x32, 0x44, 0x72, 0x44, 0x04, 0x3A, 0x99, 0x99, 0xFB, 0xC6, 0x04, 0x3A,
-	0xFC, 0xDA, 0x37, 0x38, 0x13, 0x09, 0x03, 0x96, 0x07, 0x0E, 0x37, 0x7F, 0x6C, 0x00, 0x00, 0x01,
-	0x00, 0x92, 0xFE, 0x60, 0x04, 0x20, 0x04, 0x4E, 0x00, 0x2F, 0x00, 0x17, 0x40, 0x0C, 0x1E, 0x29,
-	0x06, 0x11, 0x0B, 0x72, 0x06, 0x07, 0x72, 0x00, 0x0E, 0x72, 0x00, 0x2B, 0x2B, 0x2B, 0x11, 0x33,
-	0x32, 0x30, 0x31, 0x53, 0x11, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14, 0x0E,
-	0x02, 0x23, 0x22, 0x2E, 0x02, 0x27, 0x1E, 0x02, 0x31, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35,
-	0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x03, 0x92, 0x46, 0x7C, 0xA1, 0x5B, 0x74,
-	0xAD, 0x75, 0x3A, 0x36, 0x6A, 0x9B, 0x64, 0x68, 0x9E, 0x6E, 0x41, 0x0B, 0x02, 0x2C, 0x2C, 0x14,
-	0x47, 0x78, 0x5B, 0x4B, 0x6C, 0x45, 0x21, 0x1E, 0x42, 0x6A, 0x4C, 0x46, 0x63, 0x3E, 0x1D, 0x01,
-	0xFE, 0x60, 0x03, 0xE3, 0x81, 0xC3, 0x84, 0x43, 0x55, 0x9B, 0xD4, 0x80, 0x15, 0x72, 0xBF, 0x8C,
-	0x4C, 0x44, 0x81, 0xB6, 0x73, 0x01, 0x25, 0x24, 0x46, 0x7B, 0x4B, 0x39, 0x65, 0x86, 0x4D, 0x15,
-	0x57, 0x9B, 0x76, 0x44, 0x45, 0x70, 0x83, 0x3D, 0xFC, 0x1F, 0x00, 0x01, 0x00, 0x65, 0xFE, 0x8A,
-	0x03, 0xE2, 0x04, 0x4E, 0x00, 0x2D, 0x00, 0x0E, 0xB5, 0x1B, 0x09, 0x05, 0x00, 0x07, 0x72, 0x00,
-	0x2B, 0xCC, 0x33, 0x2F, 0x30, 0x31, 0x41, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23,
-	0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x16, 0x16, 0x17, 0x1E, 0x02, 0x15, 0x0E, 0x02, 0x07, 0x27,
-	0x3E, 0x02, 0x35, 0x34, 0x26, 0x26, 0x27, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x02, 0x3E,
-	0x79, 0xBE, 0x6D, 0xB0, 0x36, 0x6D, 0x51, 0x4C, 0x6D, 0x45, 0x21, 0x4F, 0x9E, 0x76, 0x4F, 0x7D,
-	0x49, 0x01, 0x3A, 0x51, 0x23, 0x62, 0x1F, 0x2A, 0x16, 0x20, 0x44, 0x37, 0x9D, 0xD8, 0x70, 0x3F,
-	0x79, 0xB0, 0x04, 0x4E, 0x5C, 0xAF, 0x7D, 0x43, 0x6D, 0x40, 0x43, 0x71, 0x89, 0x47, 0x2A, 0x5A,
-	0x8F, 0x68, 0x20, 0x15, 0x2D, 0x55, 0x52, 0x34, 0x72, 0x61, 0x1D, 0x54, 0x23, 0x36, 0x38, 0x27,
-	0x1E, 0x26, 0x1A, 0x0C, 0x23, 0x89, 0xD0, 0x8C, 0x2A, 0x6D, 0xC3, 0x96, 0x56, 0x00, 0x00, 0x03,
-	0x00, 0x61, 0xFF, 0xEC, 0x04, 0x7C, 0x04, 0x3A, 0x00, 0x18, 0x00, 0x2E, 0x00, 0x32, 0x00, 0x13,
-	0x40, 0x09, 0x2A, 0x06, 0x32, 0x06, 0x72, 0x1F, 0x14, 0x0B, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32,
-	0x32, 0x30, 0x31, 0x53, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x1E, 0x02, 0x17, 0x1E, 0x02, 0x15, 0x15,
-	0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x37, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02,
-	0x35, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x01, 0x15, 0x21, 0x35, 0x61, 0x41, 0x7D,
-	0xB3, 0x71, 0x1F, 0x32, 0x3F, 0x33, 0x5C, 0x82, 0x44, 0x41, 0x7D, 0xB3, 0x72, 0x72, 0xB3, 0x7E,
-	0x41, 0xB9, 0x24, 0x49, 0x71, 0x4D, 0x4D, 0x70, 0x48, 0x24, 0x24, 0x49, 0x71, 0x4D, 0x4C, 0x71,
-	0x48, 0x24, 0x03, 0x62, 0xFD, 0xC6, 0x02, 0x11, 0x17, 0x71, 0xC1, 0x90, 0x50, 0x03, 0x25, 0x2D,
-	0x0E, 0x2B, 0x8B, 0xB4, 0x6B, 0x16, 0x64, 0xB8, 0x90, 0x54, 0x53, 0x95, 0xC8, 0x8C, 0x17, 0x51,
-	0x8F, 0x6E, 0x3F, 0x3F, 0x6E, 0x8F, 0x51, 0x17, 0x4B, 0x88, 0x6A, 0x3C, 0x3C, 0x6A, 0x88, 0x01,
-	0xC7, 0x99, 0x99, 0x00, 0x00, 0x02, 0x00, 0x51, 0xFF, 0xEC, 0x03, 0xDA, 0x04, 0x3A, 0x00, 0x03,
-	0x00, 0x15, 0x00, 0x15, 0x40, 0x0A, 0x05, 0x0A, 0x11, 0x02, 0x03, 0x06, 0x72, 0x11, 0x0B, 0x72,
-	0x00, 0x2B, 0x2B, 0x32, 0x11, 0x33, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x21, 0x33, 0x11,
-	0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x03,
-	0xDA, 0xFC, 0x77, 0x01, 0x5C, 0xB9, 0x1D, 0x30, 0x1C, 0x1C, 0x30, 0x11, 0x29, 0x2E, 0x58, 0x2F,
-	0x4C, 0x6D, 0x3A, 0x04, 0x3A, 0x96, 0x96, 0xFC, 0xD4, 0x36, 0x3A, 0x15, 0x10, 0x0A, 0x83, 0x21,
-	0x13, 0x3C, 0x84, 0x6C, 0x00, 0x01, 0x00, 0x90, 0xFF, 0xEB, 0x03, 0xF7, 0x04, 0x3A, 0x00, 0x1E,
-	0x00, 0x13, 0x40, 0x09, 0x10, 0x07, 0x19, 0x00, 0x06, 0x72, 0x19, 0x0B, 0x72, 0x00, 0x2B, 0x2B,
-	0x11, 0x33, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35,
-	0x26, 0x02, 0x27, 0x33, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x90,
-	0xB9, 0x1E, 0x37, 0x4A, 0x2B, 0x4A, 0x6F, 0x4B, 0x26, 0x02, 0x46, 0x33, 0xC3, 0x1E, 0x34, 0x20,
-	0x39, 0x76, 0xB2, 0x7A, 0x5B, 0x93, 0x67, 0x37, 0x04, 0x3A, 0xFD, 0x70, 0x50, 0x71, 0x46, 0x20,
-	0x4B, 0x7E, 0x99, 0x4D, 0x88, 0x01, 0x05, 0x7B, 0x3E, 0x9C, 0xBD, 0x70, 0x73, 0xD3, 0xA3, 0x5F,
-	0x35, 0x6D, 0xAA, 0x75, 0x00, 0x01, 0x00, 0x58, 0xFE, 0x22, 0x05, 0x4C, 0x04, 0x3A, 0x00, 0x2F,
-	0x00, 0x19, 0x40, 0x0C, 0x2B, 0x05, 0x05, 0x19, 0x18, 0x06, 0x72, 0x22, 0x0F, 0x0B, 0x72, 0x00,
-	0x00, 0x2F, 0x2B, 0x32, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x34, 0x36, 0x36,
-	0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x36, 0x36,
-	0x37, 0x17, 0x0E, 0x02, 0x07, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x2E, 0x03, 0x23,
-	0x22, 0x06, 0x15, 0x11, 0x02, 0x6D, 0x3F, 0x71, 0x4B, 0x63, 0xAF, 0x86, 0x4C, 0x46, 0x99, 0xF5,
-	0xAF, 0xAB, 0xEE, 0x94, 0x44, 0x3A, 0x72, 0x54, 0x64, 0x3B, 0x4A, 0x23, 0x03, 0x2E, 0x66, 0xA9,
-	0x7B, 0xA9, 0xC8, 0x59, 0x01, 0x28, 0x4B, 0x6E, 0x49, 0x20, 0x22, 0xFE, 0x22, 0x05, 0x35, 0x46,
-	0x65, 0x38, 0x50, 0x91, 0xC5, 0x74, 0x6F, 0xCB, 0x9F, 0x5C, 0x5F, 0xA4, 0xD3, 0x73, 0x70, 0xC0,
-	0x9D, 0x39, 0x84, 0x34, 0x80, 0x8A, 0x44, 0x4E, 0x99, 0x7E, 0x4C, 0x7D, 0xBE, 0x62, 0x49, 0x8A,
-	0x6E, 0x41, 0x2A, 0x1A, 0xFA, 0xC4, 0x00, 0x02, 0x00, 0x60, 0xFE, 0x27, 0x05, 0x43, 0x04, 0x3A,
-	0x00, 0x1E, 0x00, 0x22, 0x00, 0x15, 0x40, 0x0A, 0x21, 0x07, 0x19, 0x0B, 0x72, 0x20, 0x10, 0x00,
-	0x06, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x2B, 0x32, 0x2F, 0x30, 0x31, 0x53, 0x33, 0x11, 0x14, 0x1E,
-	0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x26, 0x02, 0x27, 0x33, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02,
-	0x23, 0x22, 0x2E, 0x02, 0x35, 0x01, 0x33, 0x11, 0x23, 0x60, 0xB9, 0x40, 0x73, 0x9A, 0x5A, 0x80,
-	0xB0, 0x6A, 0x30, 0x03, 0x47, 0x35, 0xC3, 0x1F, 0x35, 0x21, 0x43, 0x94, 0xF3, 0xB0, 0x8D, 0xE4,
-	0xA2, 0x56, 0x02, 0x04, 0xB9, 0xB9, 0x04, 0x3A, 0xFE, 0x18, 0x7F, 0xB1, 0x6D, 0x32, 0x4C, 0x80,
-	0x9B, 0x4E, 0x86, 0x01, 0x02, 0x7A, 0x3D, 0x9B, 0xBB, 0x6F, 0x75, 0xD4, 0xA5, 0x5F, 0x48, 0x96,
-	0xEA, 0xA1, 0x01, 0xE6, 0xF9, 0xED, 0x00, 0x02, 0x00, 0x7A, 0xFF, 0xEB, 0x06, 0x1A, 0x04, 0x3A,
-	0x00, 0x1E, 0x00, 0x3F, 0x00, 0x19, 0x40, 0x0C, 0x01, 0x17, 0x0A, 0x0A, 0x29, 0x36, 0x1F, 0x06,
-	0x72, 0x36, 0x0B, 0x72, 0x00, 0x2B, 0x2B, 0x11, 0x33, 0x33, 0x11, 0x33, 0x32, 0x30, 0x31, 0x41,
-	0x33, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14,
-	0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x26, 0x02, 0x25, 0x33, 0x06, 0x02, 0x07, 0x14, 0x1E,
-	0x03, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x03,
-	0x35, 0x34, 0x36, 0x36, 0x04, 0xD0, 0xC2, 0x24, 0x3E, 0x26, 0x2B, 0x5D, 0x98, 0x6C, 0x56, 0x86,
-	0x5D, 0x30, 0x82, 0x21, 0x3C, 0x51, 0x2F, 0x3C, 0x54, 0x34, 0x18, 0x03, 0x51, 0xFB, 0xF6, 0xC2,
-	0x3C, 0x51, 0x03, 0x0F, 0x20, 0x33, 0x49, 0x30, 0x30, 0x51, 0x3C, 0x21, 0x82, 0x30, 0x5D, 0x86,
-	0x56, 0x57, 0x83, 0x5D, 0x3A, 0x1B, 0x26, 0x3E, 0x04, 0x3A, 0x3F, 0x9C, 0xBD, 0x71, 0x73, 0xD2,
-	0xA3, 0x5E, 0x41, 0x7E, 0xB8, 0x77, 0x01, 0x29, 0xFE, 0xD5, 0x5D, 0x81, 0x51, 0x25, 0x44, 0x77,
-	0x9B, 0x58, 0x88, 0x01, 0x05, 0x7C, 0x7C, 0xFE, 0xFB, 0x88, 0x46, 0x80, 0x6B, 0x51, 0x2C, 0x25,
-	0x51, 0x81, 0x5D, 0x01, 0x2B, 0xFE, 0xD7, 0x77, 0xB8, 0x7E, 0x41, 0x3D, 0x6E, 0x93, 0xAC, 0x5C,
-	0x71, 0xBD, 0x9C, 0x00, 0x00, 0x01, 0x00, 0x7A, 0xFF, 0xEB, 0x04, 0x7A, 0x05, 0xC7, 0x00, 0x38,
-	0x00, 0x1D, 0x40, 0x0D, 0x1D, 0x1E, 0x17, 0x36, 0x04, 0x04, 0x0D, 0x23, 0x17, 0x0B, 0x72, 0x2D,
-	0x0D, 0x00, 0x2F, 0x33, 0x2B, 0x32, 0x11, 0x39, 0x2F, 0x33, 0x10, 0xCC, 0x32, 0x30, 0x31, 0x41,
-	0x17, 0x06, 0x06, 0x23, 0x22, 0x24, 0x26, 0x35, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1E, 0x02,
-	0x15, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x11, 0x37, 0x11, 0x14, 0x16, 0x16,
-	0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x15, 0x14,
-	0x16, 0x16, 0x33, 0x32, 0x36, 0x04, 0x72, 0x08, 0x2B, 0x6D, 0x35, 0xB9, 0xFE, 0xEE, 0x96, 0x57,
-	0x96, 0x60, 0x4E, 0x7D, 0x58, 0x2E, 0x6C, 0xC1, 0x82, 0x65, 0xA5, 0x77, 0x40, 0xB9, 0x40, 0x76,
-	0x52, 0x4E, 0x6E, 0x3B, 0x13, 0x27, 0x39, 0x26, 0x2A, 0x43, 0x27, 0x61, 0xBD, 0x8A, 0x33, 0x67,
-	0x03, 0x09, 0x95, 0x10, 0x14, 0x8A, 0xEE, 0x94, 0x10, 0x6E, 0x9B, 0x52, 0x31, 0x60, 0x8B, 0x59,
-	0xFD, 0x62, 0x94, 0xCC, 0x69, 0x40, 0x78, 0xA8, 0x69, 0x01, 0x4D, 0x02, 0xFE, 0xB1, 0x5E, 0x86,
-	0x47, 0x40, 0x85, 0x66, 0x02, 0x9E, 0x38, 0x51, 0x35, 0x19, 0x25, 0x53, 0x45, 0x12, 0x61, 0xA6,
-	0x65, 0x10, 0x00, 0x03, 0xFF, 0xDA, 0x00, 0x00, 0x04, 0x6F, 0x05, 0xBD, 0x00, 0x03, 0x00, 0x16,
-	0x00, 0x29, 0x00, 0x1E, 0x40, 0x0E, 0x10, 0x09, 0x09, 0x1F, 0x26, 0x03, 0x72, 0x1A, 0x18, 0x16,
-	0x03, 0x03, 0x02, 0x12, 0x00, 0x3F, 0x33, 0x11, 0x33, 0x33, 0x33, 0x2B, 0x32, 0x32, 0x11, 0x33,
-	0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x37, 0x13, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26,
-	0x26, 0x23, 0x22, 0x06, 0x06, 0x07, 0x01, 0x27, 0x03, 0x13, 0x17, 0x07, 0x01, 0x2E, 0x02, 0x23,
-	0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x02, 0x84, 0xC0, 0x5B, 0xE6, 0x21,
-	0x45, 0x53, 0x34, 0x23, 0x3B, 0x1F, 0x25, 0x04, 0x1F, 0x10, 0x15, 0x26, 0x20, 0x0F, 0xFE, 0xC9,
-	0x86, 0xA9, 0xE6, 0x2B, 0x86, 0xFE, 0xCA, 0x0E, 0x22, 0x25, 0x15, 0x10, 0x20, 0x05, 0x23, 0x1F,
-	0x3B, 0x22, 0x32, 0x54, 0x4A, 0x02, 0xAF, 0xFD, 0x51, 0x02, 0xAF, 0x4A, 0x02, 0x08, 0x4A, 0x51,
-	0x21, 0x0C, 0x0F, 0x98, 0x04, 0x05, 0x0E, 0x23, 0x1E, 0xFD, 0x5A, 0x02, 0x02, 0xE2, 0xFD, 0xF0,
-	0xD2, 0x02, 0x02, 0xA6, 0x1E, 0x23, 0x0E, 0x05, 0x04, 0x97, 0x0F, 0x0D, 0x1E, 0x51, 0x00, 0x03,
-	0x00, 0x4B, 0xFF, 0xEB, 0x06, 0x1B, 0x04, 0x3A, 0x00, 0x03, 0x00, 0x24, 0x00, 0x45, 0x00, 0x21,
-	0x40, 0x10, 0x26, 0x05, 0x03, 0x1C, 0x0F, 0x2F, 0x3C, 0x0B, 0x72, 0x3C, 0x0F, 0x02, 0x03, 0x06,
-	0x72, 0x0F, 0x00, 0x2F, 0x2B, 0x32, 0x11, 0x39, 0x2B, 0x32, 0x11, 0x33, 0x11, 0x33, 0x33, 0x30,
-	0x31, 0x41, 0x15, 0x21, 0x35, 0x21, 0x33, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x03, 0x23, 0x22, 0x2E,
-	0x02, 0x35, 0x35, 0x33, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x03, 0x35, 0x26, 0x02, 0x25,
-	0x33, 0x06, 0x02, 0x07, 0x14, 0x1E, 0x03, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x33, 0x15, 0x14,
-	0x0E, 0x02, 0x23, 0x22, 0x2E, 0x03, 0x35, 0x34, 0x36, 0x36, 0x06, 0x1B, 0xFA, 0x30, 0x04, 0x3E,
-	0xC3, 0x24, 0x3D, 0x26, 0x19, 0x34, 0x55, 0x76, 0x4F, 0x56, 0x86, 0x5C, 0x30, 0x82, 0x21, 0x3C,
-	0x50, 0x30, 0x28, 0x3C, 0x2B, 0x1B, 0x0D, 0x04, 0x51, 0xFC, 0x41, 0xC3, 0x3C, 0x52, 0x03, 0x0D,
-	0x1B, 0x2B, 0x3C, 0x28, 0x30, 0x50, 0x3C, 0x21, 0x82, 0x30, 0x5D, 0x86, 0x56, 0x4E, 0x77, 0x54,
-	0x35, 0x19, 0x26, 0x3F, 0x04, 0x3A, 0x98, 0x98, 0x3F, 0x9C, 0xBD, 0x71, 0x5C, 0xAC, 0x93, 0x6E,
-	0x3D, 0x41, 0x7E, 0xB8, 0x77, 0xF9, 0xFB, 0x5D, 0x81, 0x51, 0x25, 0x2C, 0x50, 0x6C, 0x80, 0x46,
-	0x88, 0x01, 0x05, 0x7C, 0x7C, 0xFE, 0xFB, 0x88, 0x46, 0x80, 0x6B, 0x51, 0x2C, 0x25, 0x51, 0x81,
-	0x5D, 0xFB, 0xF9, 0x77, 0xB8, 0x7E, 0x41, 0x3D, 0x6E, 0x93, 0xAC, 0x5C, 0x71, 0xBD, 0x9C, 0x00,
-	0x00, 0x03, 0x00, 0x2B, 0xFF, 0xF4, 0x05, 0xB2, 0x05, 0xB0, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
-	0x00, 0x21, 0x40, 0x11, 0x1F, 0x23, 0x18, 0x05, 0x05, 0x0E, 0x22, 0x23, 0x1E, 0x08, 0x72, 0x23,
-	0x02, 0x72, 0x0E, 0x09, 0x72, 0x00, 0x2B, 0x2B, 0x2B, 0x11, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x11,
-	0x33, 0x30, 0x31, 0x41, 0x35, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x23,
-	0x27, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x13, 0x11, 0x23, 0x11,
-	0x21, 0x15, 0x21, 0x35, 0x02, 0x3D, 0x36, 0x84, 0x82, 0x32, 0xA2, 0xE8, 0x7D, 0x3F, 0x7C, 0xBB,
-	0x7C, 0x02, 0x56, 0x76, 0x47, 0x20, 0x4A, 0x91, 0x6C, 0x3F, 0x7E, 0x79, 0x16, 0xC0, 0x02, 0xCB,
-	0xFB, 0x96, 0x02, 0x8A, 0xA7, 0x15, 0x22, 0x14, 0x6B, 0xCD, 0x93, 0x68, 0xA5, 0x73, 0x3D, 0x97,
-	0x2A, 0x4E, 0x6C, 0x41, 0x5F, 0x82, 0x44, 0x12, 0x21, 0x03, 0x0E, 0xFA, 0x50, 0x05, 0xB0, 0x9E,
-	0x9E, 0x00, 0x00, 0x02, 0x00, 0x7B, 0xFF, 0xEC, 0x04, 0xDD, 0x05, 0xC4, 0x00, 0x03, 0x00, 0x2C,
-	0x00, 0x1D, 0x40, 0x0E, 0x03, 0x02, 0x02, 0x09, 0x1D, 0x19, 0x14, 0x03, 0x72, 0x29, 0x04, 0x09,
-	0x09, 0x72, 0x00, 0x2B, 0xCC, 0x33, 0x2B, 0xCC, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41,
-	0x15, 0x21, 0x35, 0x01, 0x33, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02,
-	0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E,
-	0x03, 0x33, 0x32, 0x36, 0x36, 0x03, 0x76, 0xFD, 0xAB, 0x02, 0xFA, 0xC2, 0x0F, 0x81, 0xEA, 0xAE,
-	0x81, 0xD2, 0x96, 0x51, 0x51, 0x99, 0xD9, 0x88, 0xA5, 0xE3, 0x80, 0x0F, 0xC1, 0x0E, 0x4C, 0x8C,
-	0x70, 0x61, 0x93, 0x63, 0x32, 0x1D, 0x3A, 0x5A, 0x79, 0x4E, 0x7A, 0x92, 0x4B, 0x03, 0x2E, 0x9D,
-	0x9D, 0xFE, 0xA1, 0x8A, 0xDA, 0x7F, 0x60, 0xB1, 0xF9, 0x99, 0x90, 0x99, 0xFA, 0xB2, 0x60, 0x7C,
-	0xDB, 0x90, 0x66, 0x93, 0x50, 0x4A, 0x89, 0xBE, 0x74, 0x92, 0x56, 0x9B, 0x82, 0x5F, 0x34, 0x4D,
-	0x92, 0x00, 0x00, 0x03, 0x00, 0x32, 0x00, 0x00, 0x08, 0x3B, 0x05, 0xB0, 0x00, 0x11, 0x00, 0x15,
-	0x00, 0x2E, 0x00, 0x27, 0x40, 0x13, 0x24, 0x21, 0x21, 0x09, 0x2E, 0x16, 0x16, 0x00, 0x0A, 0x09,
-	0x08, 0x72, 0x14, 0x15, 0x15, 0x23, 0x00, 0x02, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x2B,
-	0x32, 0x12, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x03, 0x0E, 0x04,
-	0x23, 0x23, 0x35, 0x37, 0x3E, 0x04, 0x37, 0x01, 0x15, 0x21, 0x35, 0x01, 0x21, 0x32, 0x16, 0x16,
-	0x15, 0x14, 0x0E, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26,
-	0x26, 0x23, 0x21, 0x01, 0x77, 0xC0, 0x21, 0x07, 0x21, 0x3C, 0x60, 0x8B, 0x61, 0x34, 0x28, 0x38,
-	0x51, 0x39, 0x24, 0x15, 0x06, 0x02, 0xEE, 0xFD, 0x70, 0x03, 0x08, 0x01, 0x8D, 0xA0, 0xDB, 0x72,
-	0x40, 0x7E, 0xB7, 0x78, 0xFD, 0xE0, 0xC1, 0x01, 0x5F, 0x6B, 0x85, 0x3E, 0x3E, 0x85, 0x6B, 0xFE,
-	0x73, 0x05, 0xB0, 0xFD, 0x37, 0x9A, 0xF1, 0xB1, 0x73, 0x38, 0x9D, 0x03, 0x04, 0x2B, 0x58, 0x8C,
-	0xCB, 0x88, 0x02, 0xAA, 0x9E, 0x9E, 0xFD, 0xCC, 0x74, 0xCA, 0x81, 0x60, 0xA2, 0x79, 0x42, 0x05,
-	0xB0, 0xFA, 0xED, 0x54, 0x85, 0x49, 0x49, 0x83, 0x53, 0x00, 0x00, 0x03, 0x00, 0xB2, 0x00, 0x00,
-	0x08, 0x4D, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x20, 0x00, 0x23, 0x40, 0x11, 0x08, 0x20,
-	0x20, 0x03, 0x02, 0x02, 0x06, 0x15, 0x07, 0x02, 0x72, 0x16, 0x13, 0x13, 0x06, 0x08, 0x72, 0x00,
-	0x2B, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x11, 0x39, 0x2F, 0x33, 0x33, 0x2F, 0x33, 0x30, 0x31, 0x41,
-	0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02,
-	0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x04,
-	0x5B, 0xFC, 0xF9, 0x1F, 0xC1, 0x04, 0x21, 0x01, 0x8D, 0xA0, 0xDB, 0x72, 0x40, 0x7E, 0xB7, 0x78,
-	0xFD, 0xE0, 0xC1, 0x01, 0x5F, 0x6B, 0x85, 0x3E, 0x3E, 0x85, 0x6B, 0xFE, 0x73, 0x03, 0x39, 0x9D,
-	0x9D, 0x02, 0x77, 0xFA, 0x50, 0x05, 0xB0, 0xFD, 0x9F, 0x6B, 0xBC, 0x7C, 0x5D, 0x9C, 0x73, 0x40,
-	0x05, 0xB0, 0xFA, 0xF6, 0x4A, 0x79, 0x45, 0x45, 0x76, 0x49, 0x00, 0x03, 0x00, 0x3E, 0x00, 0x00,
-	0x05, 0xD4, 0x05, 0xB0, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1D, 0x00, 0x1D, 0x40, 0x0E, 0x19, 0x01,
-	0x18, 0x06, 0x11, 0x11, 0x18, 0x1C, 0x1D, 0x02, 0x72, 0x18, 0x08, 0x72, 0x00, 0x2B, 0x2B, 0x32,
-	0x11, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x32, 0x30, 0x31, 0x61, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23,
-	0x22, 0x0E, 0x02, 0x07, 0x35, 0x3E, 0x03, 0x33, 0x32, 0x16, 0x16, 0x15, 0x01, 0x11, 0x23, 0x11,
-	0x21, 0x15, 0x21, 0x35, 0x05, 0xD4, 0xC0, 0x43, 0x86, 0x65, 0x3C, 0x71, 0x6C, 0x69, 0x33, 0x32,
-	0x60, 0x67, 0x76, 0x46, 0x9B, 0xDD, 0x76, 0xFC, 0xC3, 0xC1, 0x02, 0xD1, 0xFB, 0x97, 0x01, 0xC8,
-	0x71, 0x7F, 0x34, 0x0A, 0x12, 0x19, 0x10, 0x9F, 0x0F, 0x19, 0x12, 0x0A, 0x59, 0xC5, 0xA4, 0x03,
-	0xE8, 0xFA, 0x50, 0x05, 0xB0, 0x9E, 0x9E, 0x00, 0x00, 0x02, 0x00, 0xB0, 0xFE, 0x99, 0x05, 0x00,
-	0x05, 0xB0, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x17, 0x40, 0x0B, 0x09, 0x06, 0x01, 0x02, 0x72, 0x0B,
-	0x03, 0x03, 0x00, 0x08, 0x72, 0x00, 0x2B, 0x32, 0x12, 0x39, 0x2B, 0x32, 0x2F, 0x30, 0x31, 0x73,
-	0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x25, 0x11, 0x23, 0x11, 0xB0, 0xC2, 0x02, 0xCD, 0xC1,
-	0xFE, 0x3F, 0xC0, 0x05, 0xB0, 0xFA, 0xED, 0x05, 0x13, 0xFA, 0x50, 0x8A, 0xFE, 0x0F, 0x01, 0xF1,
-	0x00, 0x02, 0x00, 0xA3, 0x00, 0x00, 0x04, 0xB1, 0x05, 0xB0, 0x00, 0x05, 0x00, 0x1E, 0x00, 0x21,
-	0x40, 0x10, 0x06, 0x1E, 0x1E, 0x04, 0x02, 0x13, 0x13, 0x05, 0x02, 0x72, 0x14, 0x11, 0x11, 0x04,
-	0x08, 0x72, 0x00, 0x2B, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x11, 0x33, 0x11, 0x39, 0x2F, 0x33, 0x30,
-	0x31, 0x41, 0x15, 0x21, 0x11, 0x23, 0x11, 0x13, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02,
-	0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x04,
-	0x21, 0xFD, 0x42, 0xC0, 0x93, 0x01, 0x8D, 0xA0, 0xDC, 0x72, 0x40, 0x7E, 0xB8, 0x78, 0xFD, 0xE0,
-	0xC1, 0x01, 0x5F, 0x6B, 0x85, 0x3E, 0x3E, 0x85, 0x6B, 0xFE, 0x73, 0x05, 0xB0, 0x9E, 0xFA, 0xEE,
-	0x05, 0xB0, 0xFD, 0xAF, 0x6B, 0xC0, 0x81, 0x60, 0x9F, 0x75, 0x3F, 0x05, 0xB0, 0xFA, 0xED, 0x4F,
-	0x80, 0x49, 0x49, 0x7A, 0x49, 0x00, 0x00, 0x06, 0x00, 0x33, 0xFE, 0x9A, 0x05, 0xCA, 0x05, 0xB0,
-	0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x25, 0x00, 0x27, 0x40, 0x13,
-	0x0B, 0x11, 0x11, 0x20, 0x03, 0x03, 0x07, 0x1E, 0x08, 0x72, 0x0E, 0x0F, 0x0F, 0x10, 0x14, 0x02,
-	0x72, 0x09, 0x05, 0x00, 0x2F, 0x33, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x32, 0x11, 0x33,
-	0x32, 0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x33, 0x11, 0x23, 0x03, 0x21, 0x03, 0x23,
-	0x11, 0x03, 0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x21, 0x33, 0x03, 0x0E, 0x05, 0x07, 0x23,
-	0x35, 0x33, 0x3E, 0x03, 0x37, 0x05, 0x22, 0xFB, 0xB2, 0x1F, 0xBF, 0x01, 0x05, 0x97, 0x02, 0xBF,
-	0xA4, 0xFD, 0x82, 0x03, 0x24, 0xC0, 0xFD, 0x5A, 0xC1, 0x1E, 0x06, 0x26, 0x38, 0x48, 0x52, 0x59,
-	0x2D, 0x58, 0x3E, 0x1A, 0x43, 0x43, 0x33, 0x09, 0x9D, 0x9D, 0x9D, 0xFD, 0xFD, 0x02, 0x03, 0xFD,
-	0xFE, 0x02, 0x02, 0x05, 0x13, 0x9E, 0x9E, 0xFA, 0x50, 0x05, 0xB0, 0xFD, 0xB6, 0x84, 0xDF, 0xB8,
-	0x91, 0x69, 0x43, 0x0E, 0x9D, 0x1C, 0x6A, 0xA9, 0xF4, 0xA6, 0x00, 0x05, 0x00, 0x1B, 0x00, 0x00,
-	0x07, 0x36, 0x05, 0xB0, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x13, 0x00, 0x17, 0x00, 0x27,
-	0x40, 0x13, 0x16, 0x11, 0x09, 0x03, 0x03, 0x00, 0x00, 0x0F, 0x0F, 0x14, 0x0C, 0x08, 0x08, 0x72,
-	0x0E, 0x0A, 0x01, 0x02, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x2B, 0x32, 0x32, 0x32, 0x2F, 0x33, 0x11,
-	0x33, 0x11, 0x33, 0x33, 0x33, 0x30, 0x31, 0x41, 0x01, 0x33, 0x01, 0x21, 0x07, 0x27, 0x01, 0x23,
-	0x01, 0x01, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x21, 0x01, 0x13, 0x01, 0x37, 0x01, 0x02,
-	0x4A, 0xFD, 0xF8, 0xE2, 0x01, 0x83, 0x01, 0x12, 0x1F, 0xE8, 0xFE, 0x59, 0xF0, 0x02, 0x1D, 0x01,
-	0xD4, 0xBF, 0x03, 0xC3, 0xFD, 0xF6, 0xFE, 0xBA, 0x1E, 0x01, 0x08, 0x01, 0x83, 0x19, 0xFE, 0x5A,
-	0x7B, 0x02, 0x1B, 0x02, 0x99, 0x03, 0x17, 0xFD, 0x89, 0xA0, 0x0F, 0xFD, 0x58, 0x03, 0x4E, 0x02,
-	0x62, 0xFA, 0x50, 0x05, 0xB0, 0xFC, 0xE9, 0xA0, 0x02, 0x77, 0xFA, 0x50, 0x02, 0xA8, 0xA6, 0xFC,
-	0xB2, 0x00, 0x00, 0x02, 0x00, 0x50, 0xFF, 0xEC, 0x04, 0x6B, 0x05, 0xC4, 0x00, 0x1E, 0x00, 0x3E,
-	0x00, 0x23, 0x40, 0x11, 0x00, 0x20, 0x02, 0x02, 0x3E, 0x3E, 0x15, 0x34, 0x30, 0x2A, 0x09, 0x72,
-	0x0F, 0x0B, 0x15, 0x03, 0x72, 0x00, 0x2B, 0x32, 0xCC, 0x2B, 0xCC, 0x33, 0x12, 0x39, 0x2F, 0x33,
-	0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
-	0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E,
-	0x02, 0x25, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x33,
-	0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x23, 0x02, 0x67, 0xAD,
-	0xA6, 0x6E, 0x88, 0x3E, 0x44, 0x8E, 0x70, 0x54, 0x88, 0x50, 0xC1, 0x4E, 0x88, 0xB3, 0x64, 0x75,
-	0xBE, 0x88, 0x48, 0x46, 0x82, 0xB6, 0xFE, 0xE3, 0xAD, 0x7B, 0xC0, 0x84, 0x45, 0x4F, 0x90, 0xC5,
-	0x75, 0x5E, 0xB7, 0x94, 0x59, 0xC1, 0x51, 0x90, 0x60, 0x6E, 0x99, 0x51, 0x2B, 0x53, 0x7B, 0x51,
-	0xA6, 0x02, 0xBB, 0x7B, 0x3E, 0x6E, 0x48, 0x45, 0x73, 0x45, 0x3F, 0x6F, 0x48, 0x5D, 0x95, 0x69,
-	0x38, 0x35, 0x68, 0x9A, 0x66, 0x4B, 0x84, 0x64, 0x39, 0x55, 0x32, 0x60, 0x8D, 0x5B, 0x66, 0x9E,
-	0x6E, 0x38, 0x31, 0x67, 0xA0, 0x70, 0x49, 0x7A, 0x49, 0x45, 0x79, 0x4C, 0x43, 0x63, 0x40, 0x1F,
-	0x00, 0x01, 0x00, 0xB2, 0x00, 0x00, 0x05, 0x00, 0x05, 0xB0, 0x00, 0x09, 0x00, 0x17, 0x40, 0x0B,
-	0x05, 0x00, 0x06, 0x02, 0x08, 0x02, 0x72, 0x04, 0x06, 0x08, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32,
-	0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x01, 0x33, 0x11, 0x23, 0x11, 0x01, 0x23, 0x11, 0x33, 0x01,
-	0x72, 0x02, 0xCD, 0xC1, 0xC1, 0xFD, 0x33, 0xC0, 0xC0, 0x01, 0x4E, 0x04, 0x62, 0xFA, 0x50, 0x04,
-	0x63, 0xFB, 0x9D, 0x05, 0xB0, 0x00, 0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x04, 0xF7, 0x05, 0xB0,
-	0x00, 0x03, 0x00, 0x07, 0x00, 0x19, 0x00, 0x19, 0x40, 0x0C, 0x12, 0x05, 0x11, 0x08, 0x72, 0x02,
-	0x03, 0x03, 0x04, 0x08, 0x02, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x32, 0x30,
-	0x31, 0x41, 0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x21, 0x33, 0x03, 0x0E, 0x04, 0x23, 0x23,
-	0x35, 0x37, 0x3E, 0x04, 0x37, 0x04, 0x51, 0xFD, 0x66, 0x03, 0x40, 0xC1, 0xFD, 0x3F, 0xC0, 0x21,
-	0x07, 0x21, 0x3C, 0x60, 0x8B, 0x61, 0x34, 0x28, 0x38, 0x51, 0x39, 0x24, 0x15, 0x06, 0x05, 0xB0,
-	0x9E, 0x9E, 0xFA, 0x50, 0x05, 0xB0, 0xFD, 0x37, 0x9A, 0xF1, 0xB1, 0x73, 0x38, 0x9D, 0x03, 0x04,
-	0x2B, 0x58, 0x8C, 0xCB, 0x88, 0x00, 0x00, 0x02, 0x00, 0x4D, 0xFF, 0xEB, 0x04, 0xCB, 0x05, 0xB0,
-	0x00, 0x13, 0x00, 0x18, 0x00, 0x1A, 0x40, 0x0E, 0x17, 0x16, 0x00, 0x15, 0x04, 0x08, 0x02, 0x18,
-	0x02, 0x72, 0x0F, 0x08, 0x09, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31,
-	0x41, 0x01, 0x33, 0x01, 0x0E, 0x03, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36,
-	0x36, 0x37, 0x03, 0x01, 0x17, 0x07, 0x01, 0x02, 0x6C, 0x01, 0x81, 0xDE, 0xFD, 0xFD, 0x16, 0x36,
-	0x4E, 0x73, 0x55, 0x18, 0x42, 0x0A, 0x06, 0x0B, 0x40, 0x0F, 0x39, 0x42, 0x29, 0x11, 0xF2, 0x01,
-	0x95, 0x30, 0xA2, 0xFE, 0x05, 0x01, 0xE3, 0x03, 0xCD, 0xFB, 0x43, 0x33, 0x5F, 0x4A, 0x2C, 0x05,
-	0x03, 0x9A, 0x02, 0x03, 0x2E, 0x47, 0x25, 0x04, 0x8E, 0xFC, 0x75, 0xB3, 0x0C, 0x04, 0x4A, 0x00,
-	0x00, 0x03, 0x00, 0x54, 0xFF, 0xC4, 0x05, 0xE3, 0x05, 0xEC, 0x00, 0x15, 0x00, 0x29, 0x00, 0x2D,
-	0x00, 0x1B, 0x40, 0x0C, 0x1F, 0x0C, 0x0C, 0x2B, 0x16, 0x00, 0x00, 0x2B, 0x2A, 0x03, 0x72, 0x2B,
-	0x00, 0x2F, 0x2B, 0x11, 0x39, 0x2F, 0x33, 0x11, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x33, 0x32,
-	0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x17,
-	0x22, 0x06, 0x06, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2E, 0x02,
-	0x23, 0x03, 0x11, 0x23, 0x11, 0x02, 0xA2, 0xF1, 0x7E, 0xD7, 0xA1, 0x5A, 0x5A, 0xA1, 0xD7, 0x7E,
-	0xF1, 0x7E, 0xD6, 0xA1, 0x59, 0x59, 0xA1, 0xD6, 0x7E, 0x83, 0xB6, 0x5E, 0x35, 0x68, 0x98, 0x62,
-	0xF3, 0x82, 0xB5, 0x5F, 0x36, 0x67, 0x97, 0x62, 0x1D, 0xB9, 0x05, 0x1F, 0x55, 0x9C, 0xD7, 0x82,
-	0x82, 0xD8, 0x9D, 0x55, 0x55, 0x9C, 0xD7, 0x82, 0x82, 0xD7, 0x9D, 0x56, 0x98, 0x6D, 0xC4, 0x83,
-	0x63, 0xA0, 0x72, 0x3E, 0x6D, 0xC5, 0x83, 0x62, 0xA0, 0x72, 0x3E, 0x01, 0x65, 0xF9, 0xD8, 0x06,
-	0x28, 0x00, 0x00, 0x02, 0x00, 0xAF, 0xFE, 0xA1, 0x05, 0x98, 0x05, 0xB0, 0x00, 0x05, 0x00, 0x0D,
-	0x00, 0x19, 0x40, 0x0C, 0x0C, 0x07, 0x02, 0x72, 0x05, 0x04, 0x04, 0x09, 0x06, 0x08, 0x72, 0x01,
-	0x00, 0x2F, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x30, 0x31, 0x65, 0x03, 0x23, 0x11, 0x23,
-	0x35, 0x05, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x05, 0x98, 0x12, 0xAD, 0x8F, 0xFC, 0x65,
-	0xC2, 0x02, 0xCD, 0xC1, 0xA2, 0xFD, 0xFF, 0x01, 0x5F, 0xA2, 0xA2, 0x05, 0xB0, 0xFA, 0xED, 0x05,
-	0x13, 0xFA, 0x50, 0x00, 0x00, 0x02, 0x00, 0x97, 0x00, 0x00, 0x04, 0xC9, 0x05, 0xB0, 0x00, 0x15,
-	0x00, 0x19, 0x00, 0x17, 0x40, 0x0B, 0x17, 0x06, 0x11, 0x11, 0x18, 0x00, 0x02, 0x72, 0x18, 0x08,
-	0x72, 0x00, 0x2B, 0x2B, 0x11, 0x39, 0x2F, 0x33, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x14, 0x16,
-	0x16, 0x33, 0x32, 0x3E, 0x02, 0x37, 0x15, 0x0E, 0x03, 0x23, 0x22, 0x26, 0x26, 0x35, 0x01, 0x33,
-	0x11, 0x23, 0x97, 0xC1, 0x42, 0x86, 0x64, 0x3C, 0x71, 0x6C, 0x69, 0x33, 0x31, 0x61, 0x67, 0x75,
-	0x47, 0x9A, 0xDD, 0x76, 0x03, 0x71, 0xC1, 0xC1, 0x05, 0xB0, 0xFE, 0x39, 0x71, 0x80, 0x34, 0x0A,
-	0x12, 0x1A, 0x0F, 0x9E, 0x0F, 0x1A, 0x12, 0x0A, 0x59, 0xC6, 0xA4, 0x01, 0xC7, 0xFA, 0x50, 0x00,
-	0x00, 0x01, 0x00, 0xB0, 0x00, 0x00, 0x06, 0xD8, 0x05, 0xB0, 0x00, 0x0B, 0x00, 0x19, 0x40, 0x0C,
-	0x05, 0x09, 0x06, 0x02, 0x02, 0x0B, 0x00, 0x02, 0x72, 0x0B, 0x08, 0x72, 0x00, 0x2B, 0x2B, 0x11,
-	0x33, 0x11, 0x33, 0x32, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x11,
-	0x33, 0x11, 0x21, 0xB0, 0xC2, 0x01, 0xF4, 0xC0, 0x01, 0xF1, 0xC1, 0xF9, 0xD8, 0x05, 0xB0, 0xFA,
-	0xED, 0x05, 0x13, 0xFA, 0xED, 0x05, 0x13, 0xFA, 0x50, 0x00, 0x00, 0x02, 0x00, 0xB0, 0xFE, 0xA1,
-	0x07, 0x6B, 0x05, 0xB0, 0x00, 0x05, 0x00, 0x11, 0x00, 0x1D, 0x40, 0x0E, 0x0C, 0x05, 0x08, 0x08,
-	0x04, 0x11, 0x08, 0x72, 0x0F, 0x0B, 0x06, 0x02, 0x72, 0x01, 0x00, 0x2F, 0x2B, 0x32, 0x32, 0x2B,
-	0x32, 0x32, 0x11, 0x33, 0x33, 0x30, 0x31, 0x65, 0x03, 0x23, 0x11, 0x23, 0x35, 0x01, 0x33, 0x11,
-	0x21, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x07, 0x6B, 0x12, 0xA6, 0x8D, 0xFA, 0x8A,
-	0xC2, 0x01, 0xF4, 0xC0, 0x01, 0xF1, 0xC1, 0xF9, 0xD8, 0x98, 0xFE, 0x09, 0x01, 0x5F, 0x98, 0x05,
-	0x18, 0xFA, 0xED, 0x05, 0x13, 0xFA, 0xED, 0x05, 0x13, 0xFA, 0x50, 0x00, 0x00, 0x02, 0x00, 0x11,
-	0x00, 0x00, 0x05, 0xB9, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x1C, 0x00, 0x1D, 0x40, 0x0E, 0x11, 0x12,
-	0x0F, 0x04, 0x1C, 0x1C, 0x0F, 0x00, 0x01, 0x02, 0x72, 0x0F, 0x08, 0x72, 0x00, 0x2B, 0x2B, 0x32,
-	0x11, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x32, 0x30, 0x31, 0x53, 0x35, 0x21, 0x15, 0x13, 0x21, 0x32,
-	0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35,
-	0x34, 0x26, 0x26, 0x23, 0x21, 0x11, 0x01, 0xC9, 0x64, 0x01, 0x8C, 0xA0, 0xDC, 0x73, 0x41, 0x7E,
-	0xB8, 0x78, 0xFD, 0xE1, 0xC0, 0x01, 0x5F, 0x6B, 0x85, 0x3E, 0x3E, 0x85, 0x6B, 0xFE, 0x74, 0x05,
-	0x18, 0x98, 0x98, 0xFE, 0x47, 0x6B, 0xC0, 0x81, 0x60, 0x9F, 0x75, 0x3F, 0x05, 0xB0, 0xFA, 0xED,
-	0x4F, 0x80, 0x49, 0x49, 0x7A, 0x49, 0x00, 0x02, 0x00, 0xB2, 0x00, 0x00, 0x06, 0x31, 0x05, 0xB0,
-	0x00, 0x18, 0x00, 0x1C, 0x00, 0x1D, 0x40, 0x0E, 0x1A, 0x19, 0x0E, 0x0B, 0x00, 0x18, 0x18, 0x0B,
-	0x0C, 0x02, 0x72, 0x0B, 0x08, 0x72, 0x00, 0x2B, 0x2B, 0x11, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x32,
-	0x33, 0x30, 0x31, 0x41, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x21, 0x11, 0x33,
-	0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x01, 0x11, 0x23, 0x11, 0x01,
-	0x45, 0x01, 0x8D, 0xA0, 0xDC, 0x72, 0x40, 0x7E, 0xB8, 0x78, 0xFD, 0xE0, 0xC1, 0x01, 0x5F, 0x6B,
-	0x85, 0x3E, 0x3E, 0x85, 0x6B, 0xFE, 0x73, 0x04, 0xEC, 0xC1, 0x03, 0x5F, 0x6B, 0xC0, 0x81, 0x60,
-	0x9F, 0x75, 0x3F, 0x05, 0xB0, 0xFA, 0xED, 0x4F, 0x80, 0x49, 0x49, 0x7A, 0x49, 0x02, 0xEF, 0xFA,
-	0x50, 0x05, 0xB0, 0x00, 0x00, 0x01, 0x00, 0xA3, 0x00, 0x00, 0x04, 0xB1, 0x05, 0xB0, 0x00, 0x18,
-	0x00, 0x19, 0x40, 0x0C, 0x0E, 0x0B, 0x00, 0x18, 0x18, 0x0B, 0x0C, 0x02, 0x72, 0x0B, 0x08, 0x72,
-	0x00, 0x2B, 0x2B, 0x11, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x21, 0x32, 0x16, 0x16,
-	0x15, 0x14, 0x0E, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26,
-	0x26, 0x23, 0x21, 0x01, 0x36, 0x01, 0x8D, 0xA0, 0xDC, 0x72, 0x40, 0x7E, 0xB8, 0x78, 0xFD, 0xE0,
-	0xC1, 0x01, 0x5F, 0x6B, 0x85, 0x3E, 0x3E, 0x85, 0x6B, 0xFE, 0x73, 0x03, 0x5F, 0x6B, 0xC0, 0x81,
-	0x60, 0x9F, 0x75, 0x3F, 0x05, 0xB0, 0xFA, 0xED, 0x4F, 0x80, 0x49, 0x49, 0x7A, 0x49, 0x00, 0x02,
-	0x00, 0x94, 0xFF, 0xEC, 0x04, 0xF4, 0x05, 0xC4, 0x00, 0x03, 0x00, 0x2C, 0x00, 0x1D, 0x40, 0x0E,
-	0x03, 0x02, 0x02, 0x1E, 0x09, 0x05, 0x29, 0x09, 0x72, 0x19, 0x15, 0x1E, 0x03, 0x72, 0x00, 0x2B,
-	0x32, 0xCC, 0x2B, 0xCC, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01,
-	0x33, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x34, 0x2E, 0x03, 0x23, 0x22, 0x06, 0x06,
-	0x07, 0x23, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x26,
-	0x26, 0x04, 0x4C, 0xFD, 0xAB, 0xFE, 0x9D, 0xC0, 0x10, 0x4B, 0x92, 0x7B, 0x61, 0x8E, 0x5C, 0x2D,
-	0x20, 0x40, 0x5F, 0x7D, 0x4D, 0x70, 0x8D, 0x4B, 0x0F, 0xC0, 0x0F, 0x80, 0xE3, 0xA5, 0x87, 0xD8,
-	0x99, 0x51, 0x51, 0x96, 0xD1, 0x80, 0xAF, 0xEA, 0x7F, 0x03, 0x25, 0x9E, 0x9E, 0xFE, 0xAA, 0x67,
-	0x92, 0x4D, 0x51, 0x8E, 0xBC, 0x6B, 0x92, 0x5D, 0x9F, 0x7F, 0x5A, 0x30, 0x50, 0x93, 0x66, 0x90,
-	0xDB, 0x7C, 0x60, 0xB2, 0xFA, 0x99, 0x90, 0x99, 0xF9, 0xB1, 0x60, 0x7F, 0xDA, 0x00, 0x00, 0x04,
-	0x00, 0xB7, 0xFF, 0xEC, 0x06, 0xDB, 0x05, 0xC4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1D, 0x00, 0x33,
-	0x00, 0x23, 0x40, 0x13, 0x2F, 0x07, 0x06, 0x06, 0x0E, 0x24, 0x19, 0x03, 0x02, 0x72, 0x02, 0x08,
-	0x72, 0x19, 0x03, 0x72, 0x0E, 0x09, 0x72, 0x00, 0x2B, 0x2B, 0x2B, 0x2B, 0x11, 0x33, 0x12, 0x39,
-	0x2F, 0x33, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x05, 0x15, 0x14,
-	0x02, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x02, 0x35, 0x35, 0x34, 0x12, 0x36, 0x36, 0x33, 0x32,
-	0x16, 0x16, 0x12, 0x03, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E,
-	0x02, 0x33, 0x32, 0x3E, 0x02, 0x01, 0x78, 0xC1, 0x02, 0x0F, 0xFE, 0xA6, 0x05, 0x6F, 0x52, 0x9A,
-	0xD7, 0x85, 0x81, 0xD7, 0x9D, 0x56, 0x55, 0x9C, 0xD7, 0x81, 0x85, 0xD7, 0x9B, 0x53, 0xBF, 0x35,
-	0x66, 0x93, 0x5D, 0x5A, 0x91, 0x67, 0x38, 0x38, 0x69, 0x91, 0x5A, 0x5E, 0x92, 0x65, 0x34, 0x05,
-	0xB0, 0xFA, 0x50, 0x05, 0xB0, 0xFD, 0x65, 0x98, 0x98, 0x0F, 0x5C, 0xA4, 0xFE, 0xFC, 0xB6, 0x60,
-	0x60, 0xB6, 0x01, 0x04, 0xA4, 0x5C, 0xA4, 0x01, 0x03, 0xB7, 0x60, 0x60, 0xB7, 0xFE, 0xFD, 0xFF,
-	0x00, 0x5E, 0x82, 0xC8, 0x88, 0x46, 0x46, 0x88, 0xC8, 0x82, 0x5E, 0x83, 0xC9, 0x89, 0x46, 0x46,
-	0x89, 0xC9, 0x00, 0x02, 0x00, 0x5A, 0x00, 0x00, 0x04, 0x65, 0x05, 0xB0, 0x00, 0x16, 0x00, 0x1A,
-	0x00, 0x1F, 0x40, 0x0F, 0x17, 0x16, 0x16, 0x00, 0x00, 0x09, 0x0C, 0x0C, 0x19, 0x08, 0x72, 0x0E,
-	0x09, 0x02, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x11, 0x12, 0x39, 0x2F, 0x33, 0x12, 0x39, 0x30,
-	0x31, 0x41, 0x21, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x21, 0x11, 0x23, 0x11, 0x21,
-	0x22, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x21, 0x05, 0x01, 0x23, 0x01, 0x03, 0xD1, 0xFE, 0x67,
-	0x5F, 0x9E, 0xAA, 0x7D, 0xE7, 0x9E, 0x01, 0xD2, 0xC1, 0xFE, 0xEF, 0xA0, 0xA1, 0x47, 0x8C, 0x68,
-	0x01, 0x45, 0xFE, 0xB7, 0xFE, 0x9E, 0xCD, 0x01, 0x6C, 0x02, 0x37, 0x27, 0x32, 0xCF, 0x9A, 0x8D,
-	0xC4, 0x66, 0xFA, 0x50, 0x05, 0x12, 0x98, 0x81, 0x54, 0x84, 0x4C, 0x3A, 0xFD, 0x65, 0x02, 0x9B,
-	0x00, 0x03, 0x00, 0x62, 0xFF, 0xEB, 0x04, 0x29, 0x06, 0x11, 0x00, 0x16, 0x00, 0x2F, 0x00, 0x44,
-	0x00, 0x19, 0x40, 0x0C, 0x3A, 0x22, 0x30, 0x17, 0x17, 0x22, 0x00, 0x01, 0x72, 0x22, 0x0B, 0x72,
-	0x00, 0x2B, 0x2B, 0x11, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x14, 0x0E, 0x02,
-	0x07, 0x0E, 0x03, 0x17, 0x15, 0x23, 0x35, 0x34, 0x12, 0x36, 0x36, 0x37, 0x3E, 0x02, 0x03, 0x32,
-	0x1E, 0x02, 0x15, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x36, 0x36,
-	0x37, 0x3E, 0x02, 0x17, 0x22, 0x06, 0x06, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02,
-	0x35, 0x35, 0x34, 0x2E, 0x02, 0x03, 0x43, 0x98, 0x3C, 0x67, 0x81, 0x45, 0x56, 0x93, 0x69, 0x31,
-	0x0B, 0x98, 0x47, 0x82, 0xB3, 0x6C, 0x4E, 0x70, 0x3B, 0xDB, 0x6A, 0xA6, 0x74, 0x3D, 0x41, 0x7D,
-	0xB3, 0x72, 0x72, 0xB3, 0x7E, 0x41, 0x12, 0x1B, 0x0B, 0x25, 0x81, 0xB5, 0x4F, 0x66, 0x83, 0x40,
-	0x24, 0x49, 0x71, 0x4D, 0x4D, 0x70, 0x48, 0x24, 0x24, 0x49, 0x71, 0x06, 0x11, 0x62, 0x73, 0x3E,
-	0x20, 0x0F, 0x12, 0x4D, 0x8C, 0xE0, 0xA5, 0x5C, 0x5C, 0xB9, 0x01, 0x14, 0xBE, 0x70, 0x15, 0x0F,
-	0x23, 0x3C, 0xFE, 0x1F, 0x4A, 0x84, 0xB3, 0x69, 0x16, 0x71, 0xC1, 0x8F, 0x50, 0x50, 0x8F, 0xC1,
-	0x71, 0x16, 0x19, 0x30, 0x32, 0x1C, 0x5A, 0x9A, 0x5F, 0x97, 0x5E, 0x9B, 0x5A, 0x16, 0x4C, 0x88,
-	0x69, 0x3C, 0x3C, 0x69, 0x88, 0x4C, 0x16, 0x44, 0x7A, 0x5E, 0x37, 0x00, 0x00, 0x02, 0x00, 0x9E,
-	0x00, 0x00, 0x04, 0x29, 0x04, 0x3A, 0x00, 0x1B, 0x00, 0x33, 0x00, 0x2D, 0x40, 0x16, 0x02, 0x01,
-	0x1B, 0x2B, 0x29, 0x29, 0x28, 0x01, 0x28, 0x01, 0x28, 0x0F, 0x0D, 0x10, 0x06, 0x72, 0x1E, 0x1D,
-	0x1D, 0x0F, 0x0A, 0x72, 0x00, 0x2B, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x11, 0x39, 0x39, 0x2F, 0x2F,
-	0x11, 0x33, 0x12, 0x39, 0x39, 0x11, 0x33, 0x30, 0x31, 0x41, 0x21, 0x27, 0x21, 0x32, 0x36, 0x36,
-	0x35, 0x34, 0x2E, 0x02, 0x23, 0x23, 0x11, 0x23, 0x11, 0x21, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E,
-	0x02, 0x07, 0x03, 0x21, 0x37, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x37,
-	0x21, 0x17, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x02, 0x89, 0xFE, 0x9D, 0x02, 0x01, 0x22, 0x56,
-	0x73, 0x3A, 0x21, 0x42, 0x61, 0x41, 0xED, 0xB9, 0x01, 0xA6, 0x67, 0xA5, 0x75, 0x3E, 0x28, 0x4E,
-	0x72, 0x4A, 0x48, 0xFE, 0x5A, 0x5C, 0x01, 0x4A, 0x4D, 0x66, 0x33, 0x33, 0x66, 0x4D, 0xFE, 0xE7,
-	0x02, 0x01, 0x5F, 0x43, 0x59, 0x7C, 0x40, 0x39, 0x6C, 0x9A, 0x01, 0xDC, 0x94, 0x22, 0x44, 0x32,
-	0x27, 0x3B, 0x27, 0x13, 0xFC, 0x5C, 0x04, 0x3A, 0x24, 0x49, 0x70, 0x4C, 0x31, 0x58, 0x44, 0x2B,
-	0x06, 0xFD, 0xED, 0x96, 0x27, 0x49, 0x33, 0x33, 0x49, 0x27, 0x94, 0x38, 0x07, 0x4A, 0x71, 0x42,
-	0x4C, 0x74, 0x4D, 0x27, 0x00, 0x01, 0x00, 0x9B, 0x00, 0x00, 0x03, 0x48, 0x04, 0x3A, 0x00, 0x05,
-	0x00, 0x0E, 0xB6, 0x02, 0x05, 0x06, 0x72, 0x04, 0x0A, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x30, 0x31,
-	0x41, 0x15, 0x21, 0x11, 0x23, 0x11, 0x03, 0x48, 0xFE, 0x0C, 0xB9, 0x04, 0x3A, 0x99, 0xFC, 0x5F,
-	0x04, 0x3A, 0x00, 0x03, 0x00, 0x2E, 0xFE, 0xC1, 0x04, 0x94, 0x04, 0x3A, 0x00, 0x0F, 0x00, 0x15,
-	0x00, 0x1D, 0x00, 0x21, 0x40, 0x10, 0x1D, 0x18, 0x09, 0x16, 0x16, 0x1B, 0x13, 0x08, 0x0A, 0x72,
-	0x15, 0x10, 0x10, 0x00, 0x06, 0x72, 0x00, 0x2B, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x32, 0x32, 0x11,
-	0x33, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x33, 0x03, 0x0E, 0x03, 0x07, 0x23, 0x37, 0x37, 0x3E, 0x03,
-	0x37, 0x13, 0x21, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01,
-	0x50, 0xB9, 0x10, 0x06, 0x3A, 0x5A, 0x6F, 0x3B, 0x5C, 0x05, 0x26, 0x21, 0x3E, 0x34, 0x23, 0x05,
-	0x3F, 0x02, 0x8B, 0xB9, 0xFE, 0x2E, 0xFE, 0xB1, 0x04, 0x65, 0xB9, 0xFD, 0x0D, 0xBA, 0x04, 0x3A,
-	0xFE, 0x6B, 0x9A, 0xE0, 0x9D, 0x6A, 0x24, 0x97, 0x01, 0x27, 0x53, 0x73, 0xA7, 0x79, 0x01, 0x95,
-	0xFB, 0xC6, 0x03, 0x8F, 0xFD, 0x09, 0xFE, 0x29, 0x01, 0x3F, 0xFE, 0xC1, 0x00, 0x05, 0x00, 0x16,
-	0x00, 0x00, 0x06, 0x04, 0x04, 0x3A, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x13, 0x00, 0x17,
-	0x00, 0x30, 0x40, 0x17, 0x15, 0x10, 0x10, 0x00, 0x16, 0x11, 0x11, 0x09, 0x03, 0x03, 0x06, 0x00,
-	0x00, 0x14, 0x07, 0x0C, 0x12, 0x13, 0x0D, 0x0D, 0x02, 0x06, 0x72, 0x00, 0x2B, 0x32, 0x11, 0x33,
-	0x3F, 0x33, 0x33, 0x39, 0x2F, 0x33, 0x33, 0x11, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33,
-	0x30, 0x31, 0x41, 0x01, 0x33, 0x01, 0x33, 0x07, 0x27, 0x01, 0x23, 0x01, 0x01, 0x11, 0x23, 0x11,
-	0x21, 0x01, 0x21, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0xD5, 0xFE, 0x66, 0xDF, 0x01,
-	0x18, 0xD8, 0x1B, 0xB5, 0xFE, 0xC6, 0xEA, 0x01, 0xAF, 0x01, 0xA4, 0xB9, 0x03, 0x30, 0xFE, 0x66,
-	0xFE, 0xE6, 0x1D, 0xD9, 0x01, 0x18, 0x1A, 0xFE, 0xC5, 0x77, 0x01, 0xAE, 0x01, 0xD7, 0x02, 0x63,
-	0xFE, 0x40, 0xA3, 0x13, 0xFE, 0x16, 0x02, 0x70, 0x01, 0xCA, 0xFB, 0xC6, 0x04, 0x3A, 0xFD, 0x9D,
-	0xA3, 0x01, 0xC0, 0xFB, 0xC6, 0x01, 0xEA, 0x86, 0xFD, 0x90, 0x00, 0x02, 0x00, 0x58, 0xFF, 0xEC,
-	0x03, 0xAD, 0x04, 0x4D, 0x00, 0x1D, 0x00, 0x3B, 0x00, 0x23, 0x40, 0x11, 0x00, 0x1F, 0x02, 0x02,
-	0x3B, 0x3B, 0x14, 0x32, 0x2E, 0x29, 0x0B, 0x72, 0x0F, 0x0B, 0x14, 0x07, 0x72, 0x00, 0x2B, 0x32,
-	0xCC, 0x2B, 0xCC, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x23, 0x35,
-	0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x36,
-	0x36, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x25, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14,
-	0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35,
-	0x34, 0x26, 0x26, 0x23, 0x23, 0x02, 0x21, 0xC7, 0xB8, 0x4D, 0x5A, 0x26, 0x2B, 0x5E, 0x4F, 0x40,
-	0x68, 0x3D, 0xB9, 0x71, 0xBD, 0x70, 0x5E, 0x95, 0x68, 0x37, 0x34, 0x62, 0x8B, 0xFE, 0xE2, 0xC7,
-	0x61, 0x94, 0x64, 0x33, 0x3D, 0x70, 0x9B, 0x5E, 0x69, 0xC6, 0x80, 0xB9, 0x3E, 0x6F, 0x49, 0x4E,
-	0x68, 0x35, 0x30, 0x63, 0x4D, 0xB8, 0x02, 0x05, 0x72, 0x27, 0x46, 0x2F, 0x2A, 0x4B, 0x2F, 0x2D,
-	0x4D, 0x30, 0x63, 0x8F, 0x4E, 0x29, 0x4F, 0x75, 0x4D, 0x37, 0x62, 0x4B, 0x2A, 0x46, 0x25, 0x48,
-	0x69, 0x44, 0x4C, 0x79, 0x54, 0x2C, 0x48, 0x97, 0x75, 0x31, 0x58, 0x36, 0x30, 0x50, 0x2F, 0x3D,
-	0x4A, 0x23, 0x00, 0x01, 0x00, 0x9D, 0x00, 0x00, 0x04, 0x02, 0x04, 0x3A, 0x00, 0x09, 0x00, 0x17,
-	0x40, 0x0B, 0x05, 0x00, 0x06, 0x02, 0x08, 0x06, 0x72, 0x04, 0x06, 0x0A, 0x72, 0x00, 0x2B, 0x32,
-	0x2B, 0x32, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x01, 0x33, 0x11, 0x23, 0x11, 0x01, 0x23, 0x11,
-	0x33, 0x01, 0x55, 0x01, 0xF3, 0xBA, 0xBA, 0xFE, 0x0D, 0xB8, 0xB8, 0x01, 0x25, 0x03, 0x15, 0xFB,
-	0xC6, 0x03, 0x15, 0xFC, 0xEB, 0x04, 0x3A, 0x00, 0x00, 0x03, 0x00, 0x9D, 0x00, 0x00, 0x04, 0x40,
-	0x04, 0x3A, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x1F, 0x40, 0x0F, 0x0C, 0x07, 0x07, 0x0B,
-	0x06, 0x06, 0x02, 0x09, 0x03, 0x06, 0x72, 0x0A, 0x02, 0x0A, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32,
-	0x11, 0x39, 0x2F, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21,
-	0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x56, 0xB9, 0x03, 0x7F, 0xFD, 0xFF, 0xFE, 0xFD,
-	0x1C, 0xD4, 0x01, 0x6B, 0x1A, 0xFE, 0x72, 0x77, 0x02, 0x02, 0x04, 0x3A, 0xFB, 0xC6, 0x04, 0x3A,
-	0xFD, 0x94, 0xA2, 0x01, 0xCA, 0xFB, 0xC6, 0x01, 0xEA, 0x86, 0xFD, 0x90, 0x00, 0x03, 0x00, 0x2C,
-	0x00, 0x00, 0x04, 0x03, 0x04, 0x3A, 0x00, 0x03, 0x00, 0x07, 0x00, 0x19, 0x00, 0x19, 0x40, 0x0C,
-	0x12, 0x05, 0x11, 0x0A, 0x72, 0x02, 0x03, 0x03, 0x04, 0x08, 0x06, 0x72, 0x00, 0x2B, 0x32, 0x32,
-	0x11, 0x33, 0x2B, 0x32, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x21,
-	0x33, 0x03, 0x0E, 0x04, 0x23, 0x23, 0x35, 0x37, 0x3E, 0x04, 0x37, 0x03, 0x60, 0xFD, 0xF5, 0x02,
-	0xAE, 0xB9, 0xFD, 0xDE, 0xBA, 0x1C, 0x07, 0x1F, 0x35, 0x4F, 0x6E, 0x48, 0x3A, 0x28, 0x2B, 0x3D,
-	0x2A, 0x1B, 0x0F, 0x04, 0x04, 0x3A, 0x99, 0x99, 0xFB, 0xC6, 0x04, 0x3A, 0xFD, 0xF6, 0x79, 0xB9,
-	0x84, 0x53, 0x27, 0xA3, 0x03, 0x03, 0x22, 0x43, 0x6A, 0x92, 0x61, 0x00, 0x00, 0x03, 0x00, 0x9E,
-	0x00, 0x00, 0x05, 0x53, 0x04, 0x3A, 0x00, 0x06, 0x00, 0x0A, 0x00, 0x0E, 0x00, 0x1B, 0x40, 0x0D,
-	0x00, 0x09, 0x0C, 0x06, 0x01, 0x0A, 0x06, 0x72, 0x0B, 0x03, 0x09, 0x0A, 0x72, 0x00, 0x2B, 0x32,
-	0x32, 0x2B, 0x32, 0x32, 0x32, 0x12, 0x39, 0x30, 0x31, 0x65, 0x01, 0x33, 0x01, 0x23, 0x01, 0x33,
-	0x23, 0x11, 0x23, 0x11, 0x01, 0x11, 0x33, 0x11, 0x02, 0xFB, 0x01, 0x70, 0xB2, 0xFE, 0x1E, 0x80,
-	0xFE, 0x20, 0xB2, 0x36, 0xB9, 0x03, 0xFB, 0xBA, 0xF6, 0x03, 0x44, 0xFB, 0xC6, 0x04, 0x3A, 0xFB,
-	0xC6, 0x04, 0x3A, 0xFB, 0xC6, 0x04, 0x3A, 0xFB, 0xC6, 0x00, 0x00, 0x03, 0x00, 0x9D, 0x00, 0x00,
-	0x04, 0x01, 0x04, 0x3A, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x1B, 0x40, 0x0D, 0x09, 0x06,
-	0x08, 0x03, 0x02, 0x02, 0x06, 0x07, 0x06, 0x72, 0x06, 0x0A, 0x72, 0x00, 0x2B, 0x2B, 0x11, 0x39,
-	0x2F, 0x33, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x21,
-	0x11, 0x23, 0x11, 0x03, 0x6B, 0xFD, 0xC4, 0x27, 0xB9, 0x03, 0x64, 0xBA, 0x02, 0x65, 0x96, 0x96,
-	0x01, 0xD5, 0xFB, 0xC6, 0x04, 0x3A, 0xFB, 0xC6, 0x04, 0x3A, 0x00, 0x03, 0x00, 0x9D, 0x00, 0x00,
-	0x04, 0x02, 0x04, 0x3A, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x19, 0x40, 0x0C, 0x09, 0x06,
-	0x08, 0x02, 0x03, 0x03, 0x07, 0x06, 0x72, 0x06, 0x0A, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x11, 0x33,
-	0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x33, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23,
-	0x11, 0x03, 0x5E, 0xFD, 0xDD, 0x1B, 0xB9, 0x03, 0x65, 0xBA, 0x04, 0x3A, 0x99, 0x99, 0xFB, 0xC6,
-	0x04, 0x3A, 0xFB, 0xC6, 0x04, 0x3A, 0x00, 0x02, 0x00, 0x28, 0x00, 0x00, 0x03, 0xB1, 0x04, 0x3A,
-	0x00, 0x03, 0x00, 0x07, 0x00, 0x10, 0xB7, 0x03, 0x06, 0x07, 0x06, 0x72, 0x02, 0x0A, 0x72, 0x00,
-	0x2B, 0x2B, 0x32, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x15, 0x21, 0x35, 0x02, 0x46,
-	0xBA, 0x02, 0x25, 0xFC, 0x77, 0x04, 0x3A, 0xFB, 0xC6, 0x04, 0x3A, 0x96, 0x96, 0x00, 0x00, 0x05,
-	0x00, 0x64, 0xFE, 0x60, 0x05, 0x69, 0x06, 0x00, 0x00, 0x16, 0x00, 0x2B, 0x00, 0x42, 0x00, 0x56,
-	0x00, 0x5A, 0x00, 0x27, 0x40, 0x15, 0x27, 0x06, 0x06, 0x49, 0x1E, 0x11, 0x11, 0x52, 0x33, 0x3E,
-	0x0B, 0x72, 0x33, 0x07, 0x72, 0x58, 0x00, 0x72, 0x57, 0x0E, 0x72, 0x00, 0x2B, 0x2B, 0x2B, 0x2B,
-	0x11, 0x33, 0x33, 0x11, 0x33, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x14, 0x0E, 0x02,
-	0x23, 0x22, 0x2E, 0x02, 0x27, 0x11, 0x3E, 0x03, 0x33, 0x32, 0x1E, 0x03, 0x07, 0x35, 0x34, 0x2E,
-	0x03, 0x23, 0x22, 0x06, 0x06, 0x07, 0x11, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x25, 0x35, 0x34,
-	0x3E, 0x03, 0x33, 0x32, 0x1E, 0x02, 0x17, 0x11, 0x0E, 0x03, 0x23, 0x22, 0x2E, 0x02, 0x37, 0x15,
-	0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x11, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x01,
-	0x11, 0x33, 0x11, 0x05, 0x69, 0x32, 0x63, 0x92, 0x60, 0x4F, 0x78, 0x53, 0x31, 0x09, 0x09, 0x31,
-	0x53, 0x76, 0x4F, 0x4E, 0x7D, 0x5F, 0x3F, 0x20, 0xB9, 0x13, 0x27, 0x3E, 0x57, 0x38, 0x3C, 0x4F,
-	0x2C, 0x0A, 0x0C, 0x2E, 0x4E, 0x3B, 0x46, 0x63, 0x3F, 0x1D, 0xFB, 0xB4, 0x20, 0x40, 0x5F, 0x7D,
-	0x4E, 0x4D, 0x73, 0x50, 0x30, 0x0A, 0x09, 0x30, 0x50, 0x75, 0x4E, 0x60, 0x92, 0x63, 0x33, 0xBA,
-	0x1B, 0x3B, 0x60, 0x46, 0x3C, 0x4E, 0x2E, 0x0C, 0x0A, 0x2D, 0x4E, 0x3D, 0x46, 0x62, 0x3B, 0x1B,
-	0x01, 0x64, 0xBA, 0x02, 0x0A, 0x15, 0x72, 0xBF, 0x8C, 0x4D, 0x2B, 0x52, 0x73, 0x48, 0x01, 0xE0,
-	0x4D, 0x7A, 0x56, 0x2E, 0x37, 0x66, 0x8F, 0xB2, 0x7B, 0x15, 0x46, 0x7F, 0x6B, 0x50, 0x2C, 0x1E,
-	0x31, 0x1B, 0xFD, 0x8D, 0x16, 0x27, 0x19, 0x39, 0x66, 0x86, 0x4D, 0x15, 0x66, 0xB2, 0x8F, 0x66,
-	0x37, 0x2E, 0x56, 0x7A, 0x4D, 0xFE, 0x33, 0x4C, 0x7A, 0x57, 0x2E, 0x4D, 0x8C, 0xBF, 0x87, 0x15,
-	0x4D, 0x86, 0x66, 0x39, 0x1E, 0x30, 0x1A, 0x02, 0x61, 0x1B, 0x31, 0x1E, 0x44, 0x76, 0x9B, 0xFB,
-	0xFF, 0x07, 0xA0, 0xF8, 0x60, 0x00, 0x00, 0x02, 0x00, 0x9D, 0xFE, 0xBF, 0x04, 0x82, 0x04, 0x3A,
-	0x00, 0x07, 0x00, 0x0D, 0x00, 0x1B, 0x40, 0x0D, 0x06, 0x01, 0x03, 0x0D, 0x0C, 0x0C, 0x00, 0x0A,
-	0x72, 0x01, 0x06, 0x72, 0x09, 0x00, 0x2F, 0x2B, 0x2B, 0x32, 0x11, 0x33, 0x32, 0x11, 0x33, 0x30,
-	0x31, 0x73, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x37, 0x03, 0x23, 0x11, 0x23, 0x35, 0x9D,
-	0xB9, 0x01, 0xF2, 0xBA, 0x80, 0x12, 0xA5, 0x8D, 0x04, 0x3A, 0xFC, 0x5E, 0x03, 0xA2, 0xFB, 0xC6,
-	0x98, 0xFE, 0x27, 0x01, 0x41, 0x98, 0x00, 0x02, 0x00, 0x68, 0x00, 0x00, 0x03, 0xBD, 0x04, 0x3C,
-	0x00, 0x03, 0x00, 0x17, 0x00, 0x17, 0x40, 0x0B, 0x0F, 0x14, 0x09, 0x09, 0x01, 0x00, 0x06, 0x72,
-	0x01, 0x0A, 0x72, 0x00, 0x2B, 0x2B, 0x11, 0x39, 0x2F, 0x33, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23,
-	0x11, 0x13, 0x15, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16,
-	0x33, 0x32, 0x36, 0x36, 0x03, 0xBD, 0xB9, 0x7A, 0x38, 0x73, 0x7F, 0x4A, 0x80, 0xBC, 0x66, 0xB9,
-	0x36, 0x68, 0x4B, 0x48, 0x7F, 0x75, 0x04, 0x3A, 0xFB, 0xC6, 0x04, 0x3A, 0xFE, 0x0F, 0x98, 0x15,
-	0x21, 0x13, 0x59, 0xB5, 0x8A, 0x01, 0x3C, 0xFE, 0xC4, 0x5A, 0x70, 0x35, 0x13, 0x20, 0x00, 0x01,
-	0x00, 0x9D, 0x00, 0x00, 0x05, 0xE0, 0x04, 0x3A, 0x00, 0x0B, 0x00, 0x19, 0x40, 0x0C, 0x05, 0x09,
-	0x06, 0x02, 0x02, 0x0B, 0x00, 0x06, 0x72, 0x0B, 0x0A, 0x72, 0x00, 0x2B, 0x2B, 0x11, 0x33, 0x11,
-	0x33, 0x32, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11,
-	0x21, 0x9D, 0xB9, 0x01, 0x8C, 0xBA, 0x01, 0x8B, 0xB9, 0xFA, 0xBD, 0x04, 0x3A, 0xFC, 0x5E, 0x03,
-	0xA2, 0xFC, 0x5E, 0x03, 0xA2, 0xFB, 0xC6, 0x00, 0x00, 0x02, 0x00, 0x92, 0xFE, 0xBF, 0x06, 0x6D,
-	0x04, 0x3A, 0x00, 0x05, 0x00, 0x11, 0x00, 0x1D, 0x40, 0x0E, 0x0C, 0x05, 0x08, 0x08, 0x04, 0x11,
-	0x0A, 0x72, 0x0F, 0x0B, 0x06, 0x06, 0x72, 0x01, 0x00, 0x2F, 0x2B, 0x32, 0x32, 0x2B, 0x32, 0x32,
-	0x11, 0x33, 0x33, 0x30, 0x31, 0x65, 0x03, 0x23, 0x11, 0x23, 0x35, 0x01, 0x33, 0x11, 0x21, 0x11,
-	0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x21, 0x06, 0x6D, 0x12, 0xA5, 0x8D, 0xFB, 0x69, 0xB9, 0x01,
-	0x8C, 0xBA, 0x01, 0x8B, 0xB9, 0xFA, 0xBD, 0x98, 0xFE, 0x27, 0x01, 0x41, 0x98, 0x03, 0xA2, 0xFC,
-	0x5E, 0x03, 0xA2, 0xFC, 0x5E, 0x03, 0xA2, 0xFB, 0xC6, 0x00, 0x00, 0x02, 0x00, 0x1E, 0x00, 0x00,
-	0x04, 0xC0, 0x04, 0x3A, 0x00, 0x03, 0x00, 0x1C, 0x00, 0x1D, 0x40, 0x0E, 0x11, 0x12, 0x0F, 0x1C,
-	0x04, 0x04, 0x0F, 0x02, 0x03, 0x06, 0x72, 0x0F, 0x0A, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x11, 0x39,
-	0x2F, 0x33, 0x11, 0x33, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x21, 0x32, 0x16, 0x16,
-	0x15, 0x14, 0x0E, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26,
-	0x26, 0x23, 0x21, 0x01, 0xF9, 0xFE, 0x25, 0x01, 0xC9, 0x01, 0x45, 0x83, 0xB4, 0x5D, 0x34, 0x67,
-	0x97, 0x62, 0xFE, 0x33, 0xBA, 0x01, 0x13, 0x50, 0x5F, 0x2A, 0x2A, 0x5F, 0x50, 0xFE, 0xBB, 0x04,
-	0x3A, 0x98, 0x98, 0xFE, 0x8C, 0x5B, 0x9F, 0x65, 0x4B, 0x83, 0x62, 0x37, 0x04, 0x3A, 0xFC, 0x5E,
-	0x3A, 0x5C, 0x32, 0x31, 0x5E, 0x3F, 0x00, 0x02, 0x00, 0x9E, 0x00, 0x00, 0x05, 0x7F, 0x04, 0x3A,
-	0x00, 0x18, 0x00, 0x1C, 0x00, 0x1D, 0x40, 0x0E, 0x1A, 0x19, 0x0E, 0x0B, 0x18, 0x00, 0x00, 0x0B,
-	0x0C, 0x06, 0x72, 0x0B, 0x0A, 0x72, 0x00, 0x2B, 0x2B, 0x11, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x32,
-	0x33, 0x30, 0x31, 0x41, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x21, 0x11, 0x33,
-	0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x01, 0x11, 0x23, 0x11, 0x01,
-	0x25, 0x01, 0x45, 0x83, 0xB4, 0x5D, 0x34, 0x67, 0x97, 0x62, 0xFE, 0x34, 0xB9, 0x01, 0x13, 0x50,
-	0x60, 0x2A, 0x2A, 0x60, 0x50, 0xFE, 0xBB, 0x04, 0x5A, 0xB9, 0x02, 0xC6, 0x5B, 0x9F, 0x65, 0x4B,
-	0x83, 0x62, 0x37, 0x04, 0x3A, 0xFC, 0x5E, 0x3A, 0x5C, 0x32, 0x31, 0x5E, 0x3F, 0x02, 0x0C, 0xFB,
-	0xC6, 0x04, 0x3A, 0x00, 0x00, 0x01, 0x00, 0x9E, 0x00, 0x00, 0x03, 0xFE, 0x04, 0x3A, 0x00, 0x18,
-	0x00, 0x19, 0x40, 0x0C, 0x0E, 0x0B, 0x18, 0x00, 0x00, 0x0B, 0x0C, 0x06, 0x72, 0x0B, 0x0A, 0x72,
-	0x00, 0x2B, 0x2B, 0x11, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x21, 0x32, 0x16, 0x16,
-	0x15, 0x14, 0x0E, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26,
-	0x26, 0x23, 0x21, 0x01, 0x25, 0x01, 0x45, 0x83, 0xB4, 0x5D, 0x34, 0x67, 0x97, 0x62, 0xFE, 0x34,
-	0xB9, 0x01, 0x13, 0x50, 0x60, 0x2A, 0x2A, 0x60, 0x50, 0xFE, 0xBB, 0x02, 0xC6, 0x5B, 0x9F, 0x65,
-	0x4B, 0x83, 0x62, 0x37, 0x04, 0x3A, 0xFC, 0x5E, 0x3A, 0x5C, 0x32, 0x31, 0x5E, 0x3F, 0x00, 0x02,
-	0x00, 0x64, 0xFF, 0xEB, 0x03, 0xE1, 0x04, 0x4E, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x1D, 0x40, 0x0E,
-	0x2B, 0x2A, 0x2A, 0x09, 0x1D, 0x19, 0x14, 0x0B, 0x72, 0x04, 0x00, 0x09, 0x07, 0x72, 0x00, 0x2B,
-	0x32, 0xCC, 0x2B, 0xCC, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x22, 0x06, 0x06, 0x15,
-	0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x26,
-	0x26, 0x35, 0x33, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x34, 0x2E, 0x02, 0x01,
-	0x15, 0x21, 0x35, 0x02, 0x08, 0x3D, 0x6F, 0x47, 0xB1, 0x78, 0xC0, 0x6C, 0x72, 0xB0, 0x79, 0x3E,
-	0x3F, 0x79, 0xAF, 0x71, 0x79, 0xBF, 0x6D, 0xB1, 0x41, 0x6E, 0x45, 0x4B, 0x6D, 0x46, 0x21, 0x21,
-	0x45, 0x6D, 0x01, 0x2D, 0xFE, 0x0D, 0x03, 0xB6, 0x36, 0x5F, 0x3E, 0x61, 0xA5, 0x65, 0x56, 0x96,
-	0xC3, 0x6D, 0x2A, 0x6D, 0xC3, 0x97, 0x56, 0x68, 0xB1, 0x6F, 0x43, 0x6D, 0x40, 0x44, 0x70, 0x8B,
-	0x46, 0x2A, 0x47, 0x8A, 0x70, 0x43, 0xFE, 0xBD, 0x97, 0x97, 0x00, 0x04, 0x00, 0x9E, 0xFF, 0xEC,
-	0x06, 0x30, 0x04, 0x4E, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1D, 0x00, 0x33, 0x00, 0x23, 0x40, 0x13,
-	0x24, 0x03, 0x02, 0x02, 0x19, 0x2F, 0x0E, 0x07, 0x06, 0x72, 0x06, 0x0A, 0x72, 0x0E, 0x07, 0x72,
-	0x19, 0x0B, 0x72, 0x00, 0x2B, 0x2B, 0x2B, 0x2B, 0x11, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x32, 0x30,
-	0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32,
-	0x1E, 0x02, 0x15, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x37, 0x15, 0x14, 0x1E, 0x02,
-	0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x02, 0xF5, 0xFD,
-	0xC1, 0xA1, 0xB9, 0x01, 0xB9, 0x44, 0x81, 0xB5, 0x71, 0x73, 0xB6, 0x81, 0x44, 0x44, 0x80, 0xB6,
-	0x72, 0x72, 0xB6, 0x81, 0x44, 0xBA, 0x26, 0x4D, 0x73, 0x4D, 0x4D, 0x73, 0x4C, 0x27, 0x27, 0x4D,
-	0x74, 0x4D, 0x4C, 0x72, 0x4D, 0x26, 0x02, 0x6F, 0x97, 0x97, 0x01, 0xCB, 0xFB, 0xC6, 0x04, 0x3A,
-	0xFD, 0xD7, 0x17, 0x75, 0xC9, 0x95, 0x53, 0x53, 0x95, 0xC9, 0x75, 0x17, 0x75, 0xC8, 0x95, 0x53,
-	0x53, 0x95, 0xC8, 0x8C, 0x17, 0x51, 0x8F, 0x6E, 0x3F, 0x3F, 0x6E, 0x8F, 0x51, 0x17, 0x50, 0x8F,
-	0x6F, 0x40, 0x40, 0x6F, 0x8F, 0x00, 0x00, 0x02, 0x00, 0x2F, 0x00, 0x00, 0x03, 0xC7, 0x04, 0x3A,
-	0x00, 0x03, 0x00, 0x1D, 0x00, 0x1D, 0x40, 0x0E, 0x01, 0x12, 0x12, 0x13, 0x13, 0x03, 0x09, 0x04,
-	0x06, 0x72, 0x07, 0x03, 0x0A, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x12, 0x39, 0x2F, 0x33, 0x12,
-	0x39, 0x30, 0x31, 0x41, 0x33, 0x01, 0x23, 0x01, 0x21, 0x11, 0x23, 0x11, 0x21, 0x22, 0x06, 0x06,
-	0x15, 0x14, 0x16, 0x16, 0x33, 0x21, 0x15, 0x21, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x01,
-	0x68, 0xC8, 0xFE, 0xC7, 0xC8, 0x01, 0xD4, 0x01, 0xC4, 0xB9, 0xFE, 0xF5, 0x4F, 0x64, 0x2E, 0x2A,
-	0x5A, 0x47, 0x01, 0x53, 0xFE, 0xAD, 0x5D, 0x90, 0x64, 0x34, 0x37, 0x69, 0x99, 0x02, 0x04, 0xFD,
-	0xFC, 0x04, 0x3A, 0xFB, 0xC6, 0x03, 0xA4, 0x35, 0x54, 0x2D, 0x2C, 0x51, 0x34, 0x98, 0x32, 0x59,
-	0x79, 0x47, 0x47, 0x78, 0x5A, 0x31, 0x00, 0x04, 0xFF, 0xE7, 0xFE, 0x4B, 0x03, 0xE0, 0x06, 0x00,
-	0x00, 0x11, 0x00, 0x15, 0x00, 0x2C, 0x00, 0x30, 0x00, 0x1D, 0x40, 0x10, 0x30, 0x2F, 0x28, 0x1C,
-	0x07, 0x72, 0x15, 0x00, 0x72, 0x14, 0x0A, 0x72, 0x0D, 0x06, 0x0F, 0x72, 0x00, 0x2B, 0x32, 0x2B,
-	0x2B, 0x2B, 0x32, 0xCC, 0x32, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26,
-	0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x01, 0x11, 0x23, 0x11, 0x13, 0x27, 0x3E,
-	0x03, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02,
-	0x01, 0x15, 0x21, 0x35, 0x03, 0x26, 0xBA, 0x4D, 0x90, 0x65, 0x1F, 0x36, 0x1E, 0x0F, 0x0F, 0x46,
-	0x0F, 0x2B, 0x3D, 0x20, 0xFE, 0x20, 0xB9, 0x8D, 0x4D, 0x01, 0x40, 0x74, 0xA1, 0x62, 0x50, 0x80,
-	0x5B, 0x30, 0xBA, 0x32, 0x60, 0x46, 0x45, 0x71, 0x51, 0x2D, 0x01, 0x4A, 0xFD, 0x83, 0x01, 0xC6,
-	0xFD, 0xE1, 0x70, 0x9C, 0x50, 0x07, 0x0A, 0x94, 0x06, 0x07, 0x2F, 0x58, 0x3D, 0x06, 0x59, 0xFA,
-	0x00, 0x06, 0x00, 0xFC, 0x46, 0x03, 0x6F, 0xBD, 0x8C, 0x4D, 0x2B, 0x5E, 0x95, 0x6B, 0xFD, 0x3B,
-	0x02, 0xC7, 0x55, 0x67, 0x2F, 0x3A, 0x66, 0x83, 0x02, 0xC2, 0x98, 0x98, 0x00, 0x02, 0x00, 0x67,
-	0xFF, 0xEC, 0x03, 0xF7, 0x04, 0x4E, 0x00, 0x03, 0x00, 0x2B, 0x00, 0x1B, 0x40, 0x0D, 0x04, 0x0D,
-	0x03, 0x02, 0x02, 0x0D, 0x21, 0x18, 0x07, 0x72, 0x0D, 0x0B, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x11,
-	0x39, 0x2F, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x32, 0x36, 0x36, 0x37,
-	0x33, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16,
-	0x17, 0x23, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x02, 0xB7, 0xFD,
-	0xD6, 0x01, 0xBC, 0x42, 0x70, 0x48, 0x05, 0xAF, 0x05, 0x77, 0xBF, 0x73, 0x7A, 0xB6, 0x77, 0x3B,
-	0x3B, 0x78, 0xB5, 0x79, 0x7F, 0xBE, 0x6D, 0x05, 0xAF, 0x05, 0x41, 0x6F, 0x4B, 0x55, 0x73, 0x43,
-	0x1D, 0x1D, 0x43, 0x73, 0x02, 0x68, 0x98, 0x98, 0xFE, 0x1C, 0x36, 0x5F, 0x3D, 0x60, 0xA5, 0x65,
-	0x56, 0x96, 0xC3, 0x6D, 0x2A, 0x6D, 0xC3, 0x96, 0x56, 0x67, 0xB1, 0x70, 0x43, 0x6C, 0x41, 0x43,
-	0x71, 0x89, 0x47, 0x2A, 0x47, 0x8A, 0x70, 0x43, 0x00, 0x03, 0x00, 0x27, 0x00, 0x00, 0x06, 0x86,
-	0x04, 0x3A, 0x00, 0x11, 0x00, 0x15, 0x00, 0x2E, 0x00, 0x25, 0x40, 0x12, 0x16, 0x2E, 0x2E, 0x00,
-	0x24, 0x21, 0x21, 0x0A, 0x09, 0x0A, 0x72, 0x14, 0x15, 0x15, 0x23, 0x00, 0x06, 0x72, 0x00, 0x2B,
-	0x32, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x11, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41,
-	0x33, 0x03, 0x0E, 0x04, 0x23, 0x23, 0x35, 0x37, 0x3E, 0x04, 0x37, 0x01, 0x15, 0x21, 0x35, 0x01,
-	0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36,
-	0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x01, 0x24, 0xB9, 0x1C, 0x07, 0x1E, 0x35, 0x50, 0x6D,
-	0x48, 0x3B, 0x29, 0x2A, 0x3D, 0x2A, 0x1B, 0x10, 0x04, 0x02, 0x2C, 0xFE, 0x0F, 0x02, 0x62, 0x01,
-	0x45, 0x84, 0xB4, 0x5C, 0x34, 0x67, 0x96, 0x63, 0xFE, 0x34, 0xB9, 0x01, 0x13, 0x51, 0x5F, 0x2A,
-	0x2A, 0x5F, 0x51, 0xFE, 0xBB, 0x04, 0x3A, 0xFD, 0xF6, 0x79, 0xB9, 0x84, 0x53, 0x27, 0xA3, 0x03,
-	0x03, 0x22, 0x43, 0x6A, 0x92, 0x61, 0x01, 0xCF, 0x99, 0x99, 0xFE, 0x64, 0x56, 0x96, 0x5F, 0x47,
-	0x7B, 0x5D, 0x34, 0x04, 0x3A, 0xFC, 0x5C, 0x3A, 0x58, 0x2D, 0x2C, 0x52, 0x34, 0x00, 0x00, 0x03,
-	0x00, 0x9D, 0x00, 0x00, 0x06, 0xA8, 0x04, 0x3A, 0x00, 0x03, 0x00, 0x07, 0x00, 0x20, 0x00, 0x25,
-	0x40, 0x12, 0x15, 0x16, 0x13, 0x13, 0x06, 0x08, 0x03, 0x20, 0x03, 0x02, 0x02, 0x06, 0x07, 0x06,
-	0x72, 0x06, 0x0A, 0x72, 0x00, 0x2B, 0x2B, 0x11, 0x39, 0x2F, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33,
-	0x11, 0x33, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x21, 0x32,
-	0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35,
-	0x34, 0x26, 0x26, 0x23, 0x21, 0x03, 0x6B, 0xFD, 0xC4, 0x27, 0xB9, 0x03, 0x31, 0x01, 0x46, 0x83,
-	0xB4, 0x5D, 0x34, 0x67, 0x97, 0x62, 0xFE, 0x33, 0xBA, 0x01, 0x13, 0x50, 0x5F, 0x2A, 0x2A, 0x5F,
-	0x50, 0xFE, 0xBA, 0x02, 0xA1, 0x96, 0x96, 0x01, 0x99, 0xFB, 0xC6, 0x04, 0x3A, 0xFE, 0x64, 0x56,
-	0x96, 0x5F, 0x47, 0x7B, 0x5D, 0x34, 0x04, 0x3A, 0xFC, 0x5C, 0x3A, 0x58, 0x2D, 0x2C, 0x52, 0x34,
-	0x00, 0x03, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0xE0, 0x06, 0x00, 0x00, 0x03, 0x00, 0x1A, 0x00, 0x1E,
-	0x00, 0x19, 0x40, 0x0D, 0x1E, 0x1D, 0x16, 0x0A, 0x07, 0x72, 0x03, 0x00, 0x72, 0x11, 0x02, 0x0A,
-	0x72, 0x00, 0x2B, 0x32, 0x2B, 0x2B, 0x32, 0xCC, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13,
-	0x27, 0x3E, 0x03, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22,
-	0x0E, 0x02, 0x01, 0x15, 0x21, 0x35, 0x01, 0x46, 0xB9, 0x8D, 0x4D, 0x01, 0x40, 0x74, 0xA1, 0x62,
-	0x50, 0x80, 0x5B, 0x30, 0xBA, 0x32, 0x60, 0x46, 0x45, 0x71, 0x51, 0x2D, 0x01, 0x60, 0xFD, 0x83,
-	0x06, 0x00, 0xFA, 0x00, 0x06, 0x00, 0xFC, 0x46, 0x03, 0x6F, 0xBD, 0x8C, 0x4D, 0x2B, 0x5E, 0x95,
-	0x6B, 0xFD, 0x3B, 0x02, 0xC7, 0x55, 0x67, 0x2F, 0x3A, 0x66, 0x83, 0x02, 0xC7, 0x98, 0x98, 0x00,
-	0x00, 0x02, 0x00, 0x9D, 0xFE, 0x9C, 0x04, 0x02, 0x04, 0x3A, 0x00, 0x03, 0x00, 0x0B, 0x00, 0x17,
-	0x40, 0x0B, 0x00, 0x06, 0x06, 0x0B, 0x0A, 0x72, 0x09, 0x04, 0x06, 0x72, 0x02, 0x00, 0x2F, 0x2B,
-	0x32, 0x2B, 0x32, 0x12, 0x39, 0x30, 0x31, 0x65, 0x33, 0x11, 0x23, 0x01, 0x33, 0x11, 0x21, 0x11,
-	0x33, 0x11, 0x21, 0x01, 0xF5, 0xBA, 0xBA, 0xFE, 0xA8, 0xB9, 0x01, 0xF2, 0xBA, 0xFC, 0x9B, 0x98,
-	0xFE, 0x04, 0x05, 0x9E, 0xFC, 0x5E, 0x03, 0xA2, 0xFB, 0xC6, 0x00, 0x02, 0x00, 0x9C, 0xFF, 0xEB,
-	0x06, 0x76, 0x05, 0xB0, 0x00, 0x18, 0x00, 0x30, 0x00, 0x1B, 0x40, 0x0E, 0x2C, 0x1F, 0x09, 0x72,
-	0x14, 0x07, 0x09, 0x72, 0x26, 0x1A, 0x0E, 0x00, 0x02, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x32, 0x2B,
-	0x32, 0x2B, 0x32, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35,
-	0x11, 0x33, 0x11, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x01, 0x33, 0x11, 0x14, 0x06,
-	0x06, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36,
-	0x35, 0x03, 0x26, 0x9C, 0x3C, 0x6C, 0x92, 0x57, 0x57, 0x94, 0x6D, 0x3D, 0xC2, 0x1F, 0x39, 0x4D,
-	0x2E, 0x47, 0x6F, 0x3F, 0x02, 0x8F, 0xC1, 0x6E, 0xBE, 0x79, 0x52, 0x8D, 0x67, 0x3A, 0x9C, 0x22,
-	0x3D, 0x54, 0x31, 0x42, 0x67, 0x3B, 0x05, 0xB0, 0xFB, 0xDE, 0x69, 0x9E, 0x68, 0x34, 0x34, 0x68,
-	0x9E, 0x69, 0x04, 0x22, 0xFB, 0xDE, 0x42, 0x62, 0x42, 0x20, 0x3A, 0x74, 0x58, 0x04, 0x22, 0xFB,
-	0xDE, 0x8C, 0xBB, 0x5C, 0x34, 0x68, 0x9E, 0x69, 0x04, 0x22, 0xFB, 0xDE, 0x42, 0x62, 0x42, 0x20,
-	0x3A, 0x74, 0x58, 0x00, 0x00, 0x02, 0x00, 0x81, 0xFF, 0xEB, 0x05, 0xAE, 0x04, 0x3A, 0x00, 0x18,
-	0x00, 0x31, 0x00, 0x1B, 0x40, 0x0E, 0x2C, 0x1F, 0x0B, 0x72, 0x14, 0x07, 0x0B, 0x72, 0x26, 0x1A,
-	0x0E, 0x00, 0x06, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x32, 0x2B, 0x32, 0x2B, 0x32, 0x30, 0x31, 0x41,
-	0x33, 0x11, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1E, 0x02,
-	0x33, 0x32, 0x36, 0x36, 0x35, 0x01, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x2E, 0x02, 0x35,
-	0x11, 0x33, 0x11, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x02, 0xBA, 0x96, 0x35, 0x61,
-	0x83, 0x4E, 0x4E, 0x83, 0x61, 0x36, 0xBA, 0x1A, 0x2F, 0x3F, 0x26, 0x3C, 0x5E, 0x37, 0x02, 0x3B,
-	0xB9, 0x62, 0xAB, 0x6C, 0x4A, 0x7D, 0x5C, 0x33, 0x96, 0x1C, 0x34, 0x46, 0x2A, 0x29, 0x46, 0x34,
-	0x1D, 0x04, 0x3A, 0xFD, 0x28, 0x5E, 0x8D, 0x5E, 0x2E, 0x2E, 0x5E, 0x8D, 0x5E, 0x02, 0xD8, 0xFD,
-	0x28, 0x38, 0x54, 0x37, 0x1C, 0x31, 0x63, 0x4B, 0x02, 0xD8, 0xFD, 0x28, 0x7E, 0xA6, 0x53, 0x2E,
-	0x5E, 0x8D, 0x5E, 0x02, 0xD8, 0xFD, 0x28, 0x38, 0x54, 0x37, 0x1C, 0x1C, 0x37, 0x54, 0x38, 0x00,
-	0x00, 0x02, 0xFF, 0xDB, 0x00, 0x00, 0x03, 0xFC, 0x06, 0x16, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x21,
-	0x40, 0x10, 0x0D, 0x0A, 0x00, 0x17, 0x17, 0x0A, 0x1A, 0x1B, 0x1B, 0x0A, 0x0B, 0x01, 0x72, 0x0A,
-	0x0A, 0x72, 0x00, 0x2B, 0x2B, 0x11, 0x39, 0x2F, 0x33, 0x11, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x30,
-	0x31, 0x41, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21,
-	0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x01, 0x15, 0x21, 0x35, 0x01, 0x23, 0x01,
-	0x45, 0x84, 0xB4, 0x5C, 0x5C, 0xB4, 0x84, 0xFE, 0x34, 0xB9, 0x01, 0x13, 0x50, 0x60, 0x2A, 0x2A,
-	0x60, 0x50, 0xFE, 0xBB, 0x01, 0x74, 0xFD, 0x44, 0x02, 0xEA, 0x60, 0xA6, 0x6B, 0x69, 0xAB, 0x65,
-	0x06, 0x16, 0xFA, 0x82, 0x3F, 0x64, 0x37, 0x35, 0x67, 0x45, 0x02, 0x7F, 0x98, 0x98, 0x00, 0x03,
-	0x00, 0xB8, 0xFF, 0xED, 0x06, 0xA1, 0x05, 0xC5, 0x00, 0x03, 0x00, 0x2C, 0x00, 0x30, 0x00, 0x20,
-	0x40, 0x11, 0x03, 0x02, 0x02, 0x2F, 0x30, 0x02, 0x72, 0x2F, 0x08, 0x1D, 0x14, 0x03, 0x72, 0x29,
-	0x09, 0x09, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x3F, 0x2B, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31,
-	0x41, 0x15, 0x21, 0x35, 0x01, 0x33, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E,
-	0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14,
-	0x1E, 0x03, 0x33, 0x32, 0x36, 0x36, 0x01, 0x11, 0x23, 0x11, 0x05, 0x1E, 0xFC, 0x11, 0x04, 0xB1,
-	0xC1, 0x0F, 0x81, 0xEA, 0xAF, 0x80, 0xD1, 0x96, 0x51, 0x51, 0x99, 0xD8, 0x87, 0xA5, 0xE4, 0x80,
-	0x0F, 0xC1, 0x0E, 0x4C, 0x8C, 0x71, 0x60, 0x93, 0x63, 0x32, 0x1D, 0x3A, 0x59, 0x7A, 0x4D, 0x7B,
-	0x92, 0x4B, 0xFB, 0xA9, 0xC1, 0x03, 0x41, 0x98, 0x98, 0xFE, 0x8F, 0x8A, 0xDA, 0x7F, 0x60, 0xB1,
-	0xF9, 0x99, 0x91, 0x99, 0xF9, 0xB2, 0x60, 0x7C, 0xDB, 0x90, 0x66, 0x93, 0x50, 0x4A, 0x88, 0xBE,
-	0x74, 0x93, 0x56, 0x9B, 0x82, 0x5F, 0x34, 0x4E, 0x92, 0x04, 0x46, 0xFA, 0x50, 0x05, 0xB0, 0x00,
-	0x00, 0x03, 0x00, 0x9A, 0xFF, 0xEC, 0x05, 0xA1, 0x04, 0x4E, 0x00, 0x03, 0x00, 0x2B, 0x00, 0x2F,
-	0x00, 0x24, 0x40, 0x13, 0x03, 0x02, 0x02, 0x2E, 0x2F, 0x06, 0x72, 0x2E, 0x0A, 0x21, 0x1D, 0x18,
-	0x07, 0x72, 0x08, 0x04, 0x0D, 0x0B, 0x72, 0x00, 0x2B, 0x32, 0xCC, 0x2B, 0xCC, 0x33, 0x3F, 0x2B,
-	0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x32, 0x36, 0x36, 0x37, 0x33,
-	0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17,
-	0x23, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x01, 0x11, 0x23, 0x11,
-	0x04, 0x82, 0xFC, 0x8F, 0x02, 0xE2, 0x42, 0x70, 0x48, 0x05, 0xAF, 0x05, 0x77, 0xBF, 0x73, 0x7A,
-	0xB6, 0x77, 0x3B, 0x3B, 0x78, 0xB5, 0x7A, 0x7F, 0xBD, 0x6D, 0x05, 0xAF, 0x05, 0x41, 0x6F, 0x4A,
-	0x56, 0x72, 0x43, 0x1D, 0x1C, 0x43, 0x73, 0xFD, 0xB6, 0xB9, 0x02, 0x68, 0x98, 0x98, 0xFE, 0x1C,
-	0x36, 0x5F, 0x3D, 0x60, 0xA5, 0x65, 0x56, 0x96, 0xC3, 0x6D, 0x2A, 0x6D, 0xC3, 0x96, 0x56, 0x67,
-	0xB1, 0x70, 0x43, 0x6C, 0x41, 0x43, 0x71, 0x89, 0x47, 0x2A, 0x47, 0x8A, 0x70, 0x43, 0x03, 0xB6,
-	0xFB, 0xC6, 0x04, 0x3A, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x04, 0xE5, 0x05, 0xB0, 0x00, 0x04,
-	0x00, 0x09, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x24, 0x40, 0x11, 0x11, 0x0D, 0x0C, 0x0C, 0x02, 0x00,
-	0x06, 0x06, 0x07, 0x03, 0x02, 0x72, 0x0F, 0x05, 0x05, 0x02, 0x08, 0x00, 0x3F, 0x33, 0x11, 0x33,
-	0x2B, 0x32, 0x32, 0x11, 0x33, 0x11, 0x39, 0x2F, 0x33, 0x33, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01,
-	0x33, 0x01, 0x01, 0x37, 0x33, 0x01, 0x03, 0x15, 0x21, 0x35, 0x05, 0x11, 0x23, 0x11, 0x02, 0xB2,
-	0xFE, 0x3C, 0xC6, 0x02, 0x0D, 0x7B, 0x01, 0x6F, 0xFE, 0x43, 0x05, 0x7A, 0x02, 0x04, 0xFF, 0xFD,
-	0x3E, 0x01, 0xBC, 0xBD, 0x05, 0x14, 0xFA, 0xEC, 0x05, 0xB0, 0xFA, 0x50, 0x05, 0x1C, 0x94, 0xFA,
-	0x50, 0x02, 0x5A, 0xA3, 0xA3, 0x33, 0xFD, 0xD9, 0x02, 0x27, 0x00, 0x04, 0x00, 0x0F, 0x00, 0x00,
-	0x04, 0x25, 0x04, 0x3A, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x1E, 0x40, 0x0E,
-	0x11, 0x0D, 0x0C, 0x0C, 0x01, 0x07, 0x03, 0x06, 0x72, 0x10, 0x05, 0x05, 0x01, 0x0A, 0x00, 0x3F,
-	0x33, 0x11, 0x33, 0x2B, 0x32, 0x12, 0x39, 0x2F, 0x33, 0x33, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01,
-	0x33, 0x01, 0x01, 0x03, 0x33, 0x01, 0x03, 0x15, 0x21, 0x35, 0x05, 0x11, 0x23, 0x11, 0x01, 0xFF,
-	0xFE, 0xCE, 0xBE, 0x01, 0xBB, 0x8D, 0x01, 0x11, 0xFE, 0xC7, 0x54, 0x8E, 0x01, 0xBC, 0xDC, 0xFD,
-	0xAD, 0x01, 0x82, 0xB8, 0x02, 0xFD, 0xFD, 0x03, 0x04, 0x3A, 0xFB, 0xC6, 0x02, 0xFD, 0x01, 0x3D,
-	0xFB, 0xC6, 0x01, 0xC1, 0x98, 0x98, 0x26, 0xFE, 0x65, 0x01, 0x9B, 0x00, 0x00, 0x06, 0x00, 0xCA,
-	0x00, 0x00, 0x06, 0xF6, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x08, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x15,
-	0x00, 0x19, 0x00, 0x34, 0x40, 0x1A, 0x09, 0x14, 0x14, 0x06, 0x06, 0x18, 0x15, 0x11, 0x11, 0x10,
-	0x10, 0x03, 0x02, 0x02, 0x18, 0x08, 0x16, 0x02, 0x72, 0x04, 0x0A, 0x0A, 0x0B, 0x07, 0x02, 0x72,
-	0x00, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x2B, 0x3F, 0x39, 0x2F, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33,
-	0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x01, 0x23, 0x01,
-	0x33, 0x01, 0x01, 0x37, 0x33, 0x01, 0x03, 0x15, 0x21, 0x35, 0x05, 0x11, 0x23, 0x11, 0x01, 0x11,
-	0x23, 0x11, 0x03, 0x5B, 0xFD, 0xDD, 0x03, 0x8B, 0xFE, 0x3C, 0xC6, 0x02, 0x0D, 0x7B, 0x01, 0x6F,
-	0xFE, 0x43, 0x05, 0x7A, 0x02, 0x04, 0xFF, 0xFD, 0x3E, 0x01, 0xBC, 0xBD, 0xFD, 0x57, 0xC1, 0x02,
-	0x5A, 0xA1, 0xA1, 0x02, 0xBA, 0xFA, 0xEC, 0x05, 0xB0, 0xFA, 0x50, 0x05, 0x1C, 0x94, 0xFA, 0x50,
-	0x02, 0x5A, 0xA3, 0xA3, 0x33, 0xFD, 0xD9, 0x02, 0x27, 0x03, 0x89, 0xFA, 0x50, 0x05, 0xB0, 0x00,
-	0x00, 0x06, 0x00, 0xBD, 0x00, 0x00, 0x05, 0xE4, 0x04, 0x3A, 0x00, 0x03, 0x00, 0x08, 0x00, 0x0D,
-	0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x2E, 0x40, 0x17, 0x15, 0x11, 0x11, 0x10, 0x10, 0x03,
-	0x02, 0x02, 0x18, 0x19, 0x06, 0x72, 0x09, 0x14, 0x14, 0x06, 0x06, 0x18, 0x0A, 0x0B, 0x07, 0x06,
-	0x72, 0x00, 0x2B, 0x32, 0x3F, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2B, 0x12, 0x39, 0x2F, 0x33, 0x33,
-	0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x01, 0x23, 0x01, 0x33, 0x01,
-	0x01, 0x03, 0x33, 0x01, 0x03, 0x15, 0x21, 0x35, 0x05, 0x11, 0x23, 0x11, 0x01, 0x11, 0x23, 0x11,
-	0x02, 0xE7, 0xFE, 0x2C, 0x02, 0xAB, 0xFE, 0xCE, 0xBE, 0x01, 0xBB, 0x8D, 0x01, 0x11, 0xFE, 0xC7,
-	0x54, 0x8E, 0x01, 0xBC, 0xDC, 0xFD, 0xAD, 0x01, 0x82, 0xB8, 0xFD, 0xF7, 0xB9, 0x01, 0xC1, 0x98,
-	0x98, 0x01, 0x3C, 0xFD, 0x03, 0x04, 0x3A, 0xFB, 0xC6, 0x02, 0xFD, 0x01, 0x3D, 0xFB, 0xC6, 0x01,
-	0xC1, 0x98, 0x98, 0x26, 0xFE, 0x65, 0x01, 0x9B, 0x02, 0x9F, 0xFB, 0xC6, 0x04, 0x3A, 0x00, 0x05,
-	0x00, 0x93, 0x00, 0x00, 0x06, 0x40, 0x05, 0xB0, 0x00, 0x16, 0x00, 0x1A, 0x00, 0x1F, 0x00, 0x24,
-	0x00, 0x28, 0x00, 0x34, 0x40, 0x19, 0x19, 0x1A, 0x1A, 0x24, 0x1B, 0x1F, 0x1F, 0x23, 0x23, 0x13,
-	0x28, 0x06, 0x06, 0x13, 0x13, 0x01, 0x1C, 0x24, 0x02, 0x72, 0x0D, 0x27, 0x27, 0x01, 0x08, 0x00,
-	0x3F, 0x33, 0x11, 0x33, 0x2B, 0x32, 0x12, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33,
-	0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x61, 0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x21,
-	0x32, 0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x21, 0x22, 0x06, 0x15, 0x01,
-	0x15, 0x21, 0x35, 0x01, 0x01, 0x33, 0x01, 0x23, 0x01, 0x01, 0x07, 0x23, 0x01, 0x01, 0x11, 0x23,
-	0x11, 0x01, 0x54, 0xC1, 0x74, 0xD9, 0x98, 0x01, 0xE2, 0x99, 0xD9, 0x74, 0xC1, 0x40, 0x82, 0x63,
-	0xFE, 0x1E, 0x93, 0x91, 0x03, 0xB1, 0xFC, 0xE0, 0x01, 0x4C, 0x01, 0xBE, 0xDB, 0xFD, 0xFF, 0x7A,
-	0xFE, 0xA4, 0x01, 0xC1, 0x22, 0x79, 0xFD, 0xFE, 0x02, 0xB6, 0xC0, 0x01, 0x72, 0xA1, 0xC2, 0x56,
-	0x56, 0xC2, 0xA1, 0xFE, 0x8E, 0x01, 0x72, 0x6E, 0x7B, 0x32, 0x76, 0xA5, 0x04, 0x3E, 0x9E, 0x9E,
-	0xFD, 0x00, 0x03, 0x00, 0xFC, 0xB2, 0x03, 0x4E, 0xFC, 0xF9, 0x47, 0x03, 0x4E, 0xFD, 0x5D, 0xFC,
-	0xF3, 0x03, 0x0D, 0x00, 0x00, 0x05, 0x00, 0x97, 0x00, 0x00, 0x05, 0x4B, 0x04, 0x3B, 0x00, 0x17,
-	0x00, 0x1B, 0x00, 0x20, 0x00, 0x25, 0x00, 0x29, 0x00, 0x30, 0x40, 0x17, 0x1A, 0x1B, 0x1B, 0x25,
-	0x20, 0x24, 0x24, 0x13, 0x29, 0x06, 0x06, 0x13, 0x13, 0x01, 0x1D, 0x25, 0x06, 0x72, 0x0D, 0x28,
-	0x28, 0x01, 0x0A, 0x00, 0x3F, 0x33, 0x11, 0x33, 0x2B, 0x32, 0x12, 0x39, 0x2F, 0x33, 0x11, 0x33,
-	0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x61, 0x23, 0x35, 0x34, 0x36, 0x36,
-	0x33, 0x21, 0x32, 0x16, 0x16, 0x15, 0x15, 0x23, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x22, 0x06,
-	0x06, 0x15, 0x01, 0x15, 0x21, 0x35, 0x01, 0x01, 0x33, 0x01, 0x23, 0x03, 0x01, 0x07, 0x23, 0x01,
-	0x01, 0x11, 0x23, 0x11, 0x01, 0x50, 0xB9, 0x6A, 0xC8, 0x8B, 0x01, 0x3A, 0x8B, 0xC7, 0x6B, 0xB9,
-	0x39, 0x73, 0x58, 0xFE, 0xC6, 0x58, 0x73, 0x39, 0x03, 0x10, 0xFD, 0x4E, 0x01, 0x13, 0x01, 0x45,
-	0xD0, 0xFE, 0x75, 0x70, 0xF3, 0x01, 0x49, 0x1D, 0x70, 0xFE, 0x74, 0x02, 0x39, 0xB9, 0xA4, 0xA1,
-	0xC1, 0x56, 0x56, 0xC1, 0xA1, 0xA4, 0xA4, 0x71, 0x7D, 0x33, 0x33, 0x7D, 0x71, 0x03, 0x97, 0x99,
-	0x99, 0xFD, 0xB9, 0x02, 0x46, 0xFD, 0x6D, 0x02, 0x93, 0xFD, 0xB5, 0x48, 0x02, 0x93, 0xFE, 0x0B,
-	0xFD, 0xBB, 0x02, 0x45, 0x00, 0x07, 0x00, 0xB7, 0x00, 0x00, 0x08, 0x72, 0x05, 0xB0, 0x00, 0x03,
-	0x00, 0x07, 0x00, 0x1E, 0x00, 0x22, 0x00, 0x27, 0x00, 0x2C, 0x00, 0x30, 0x00, 0x3C, 0x40, 0x1E,
-	0x21, 0x22, 0x22, 0x24, 0x2C, 0x02, 0x72, 0x27, 0x2B, 0x2B, 0x1B, 0x30, 0x0E, 0x0E, 0x1B, 0x1B,
-	0x03, 0x02, 0x02, 0x05, 0x07, 0x02, 0x72, 0x15, 0x2F, 0x2F, 0x09, 0x09, 0x05, 0x08, 0x00, 0x3F,
-	0x33, 0x11, 0x33, 0x11, 0x33, 0x2B, 0x12, 0x39, 0x2F, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11,
-	0x33, 0x11, 0x33, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11,
-	0x23, 0x11, 0x01, 0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x21, 0x32, 0x16, 0x16, 0x15, 0x11, 0x23,
-	0x11, 0x34, 0x26, 0x26, 0x23, 0x21, 0x22, 0x06, 0x15, 0x01, 0x15, 0x21, 0x35, 0x01, 0x01, 0x33,
-	0x01, 0x23, 0x01, 0x01, 0x07, 0x23, 0x01, 0x01, 0x11, 0x23, 0x11, 0x04, 0xF0, 0xFC, 0x6F, 0x19,
-	0xC1, 0x02, 0xD0, 0xC1, 0x74, 0xD9, 0x97, 0x01, 0xE3, 0x99, 0xD9, 0x73, 0xC0, 0x40, 0x82, 0x63,
-	0xFE, 0x1D, 0x92, 0x91, 0x03, 0xB1, 0xFC, 0xE0, 0x01, 0x4C, 0x01, 0xBE, 0xDB, 0xFD, 0xFE, 0x79,
-	0xFE, 0xA4, 0x01, 0xC1, 0x22, 0x79, 0xFD, 0xFE, 0x02, 0xB6, 0xC1, 0x03, 0x2C, 0x97, 0x97, 0x02,
-	0x84, 0xFA, 0x50, 0x05, 0xB0, 0xFA, 0x50, 0x01, 0x72, 0xA1, 0xC2, 0x56, 0x56, 0xC2, 0xA1, 0xFE,
-	0x8E, 0x01, 0x72, 0x6E, 0x7B, 0x32, 0x76, 0xA5, 0x04, 0x3E, 0x9E, 0x9E, 0xFD, 0x00, 0x03, 0x00,
-	0xFC, 0xB2, 0x03, 0x4E, 0xFC, 0xF9, 0x47, 0x03, 0x4E, 0xFD, 0x5D, 0xFC, 0xF3, 0x03, 0x0D, 0x00,
-	0x00, 0x07, 0x00, 0x9C, 0x00, 0x00, 0x07, 0x3B, 0x04, 0x3B, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1F,
-	0x00, 0x23, 0x00, 0x28, 0x00, 0x2D, 0x00, 0x31, 0x00, 0x3E, 0x40, 0x1E, 0x25, 0x22, 0x23, 0x23,
-	0x2D, 0x2D, 0x07, 0x28, 0x2C, 0x2C, 0x1B, 0x31, 0x0E, 0x0E, 0x1B, 0x1B, 0x03, 0x02, 0x02, 0x06,
-	0x07, 0x06, 0x72, 0x15, 0x30, 0x30, 0x09, 0x09, 0x06, 0x0A, 0x00, 0x3F, 0x33, 0x11, 0x33, 0x11,
-	0x33, 0x2B, 0x12, 0x39, 0x2F, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11,
-	0x33, 0x11, 0x33, 0x11, 0x33, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11,
-	0x01, 0x23, 0x35, 0x34, 0x36, 0x36, 0x33, 0x21, 0x32, 0x16, 0x16, 0x15, 0x15, 0x23, 0x35, 0x34,
-	0x26, 0x26, 0x23, 0x21, 0x22, 0x06, 0x06, 0x15, 0x01, 0x15, 0x21, 0x35, 0x01, 0x01, 0x33, 0x01,
-	0x23, 0x03, 0x01, 0x07, 0x23, 0x01, 0x01, 0x11, 0x23, 0x11, 0x04, 0xDF, 0xFC, 0x1E, 0x58, 0xB9,
-	0x02, 0xA4, 0xB9, 0x6A, 0xC8, 0x8B, 0x01, 0x3A, 0x8B, 0xC7, 0x6B, 0xB9, 0x39, 0x73, 0x58, 0xFE,
-	0xC6, 0x58, 0x73, 0x39, 0x03, 0x10, 0xFD, 0x4E, 0x01, 0x13, 0x01, 0x45, 0xD0, 0xFE, 0x75, 0x70,
-	0xF3, 0x01, 0x49, 0x1D, 0x70, 0xFE, 0x74, 0x02, 0x39, 0xB9, 0x02, 0x5C, 0x97, 0x97, 0x01, 0xDE,
-	0xFB, 0xC6, 0x04, 0x3A, 0xFB, 0xC6, 0xA4, 0xA1, 0xC1, 0x56, 0x56, 0xC1, 0xA1, 0xA4, 0xA4, 0x71,
-	0x7D, 0x33, 0x33, 0x7D, 0x71, 0x03, 0x97, 0x99, 0x99, 0xFD, 0xB9, 0x02, 0x46, 0xFD, 0x6D, 0x02,
-	0x93, 0xFD, 0xB5, 0x48, 0x02, 0x93, 0xFE, 0x0B, 0xFD, 0xBB, 0x02, 0x45, 0x00, 0x03, 0x00, 0x50,
-	0xFE, 0x46, 0x03, 0xAA, 0x07, 0x86, 0x00, 0x17, 0x00, 0x40, 0x00, 0x49, 0x00, 0x2B, 0x40, 0x14,
-	0x18, 0x0D, 0x0C, 0x40, 0x40, 0x00, 0x2B, 0x2C, 0x09, 0x45, 0x43, 0x43, 0x42, 0x48, 0x41, 0x80,
-	0x47, 0x17, 0x00, 0x02, 0x00, 0x3F, 0x32, 0xDE, 0x1A, 0xCD, 0x32, 0x39, 0x32, 0x11, 0x33, 0x3F,
-	0x33, 0x12, 0x39, 0x2F, 0x33, 0x33, 0x33, 0x30, 0x31, 0x53, 0x21, 0x32, 0x1E, 0x02, 0x15, 0x14,
-	0x0E, 0x02, 0x23, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x13,
-	0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16,
-	0x17, 0x07, 0x2E, 0x02, 0x27, 0x34, 0x36, 0x36, 0x33, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E,
-	0x02, 0x23, 0x23, 0x13, 0x17, 0x37, 0x33, 0x15, 0x03, 0x23, 0x03, 0x35, 0x84, 0x01, 0x32, 0x68,
-	0xAF, 0x80, 0x47, 0x46, 0x82, 0xB6, 0x70, 0x91, 0x8D, 0x6F, 0x8A, 0x3F, 0x3E, 0x81, 0x65, 0xFE,
-	0xCE, 0x91, 0x91, 0x7B, 0xC0, 0x85, 0x44, 0x48, 0x81, 0xAF, 0x68, 0x35, 0x50, 0x45, 0x38, 0x4C,
-	0x1E, 0x4B, 0x3D, 0x78, 0x51, 0x01, 0x51, 0x95, 0x67, 0x2D, 0x45, 0x6E, 0x4C, 0x28, 0x2C, 0x55,
-	0x7D, 0x51, 0x8D, 0x74, 0x97, 0x97, 0xA0, 0xFE, 0x72, 0xFB, 0x05, 0xB0, 0x35, 0x66, 0x92, 0x5C,
-	0x4B, 0x81, 0x61, 0x36, 0x73, 0x3E, 0x6E, 0x48, 0x41, 0x6C, 0x40, 0xFD, 0xF8, 0x32, 0x60, 0x8D,
-	0x5B, 0x66, 0x9E, 0x6D, 0x38, 0x3F, 0x32, 0x35, 0x49, 0x2E, 0x0E, 0x7C, 0x1A, 0x58, 0x7D, 0x50,
-	0x58, 0x71, 0x36, 0x28, 0x49, 0x63, 0x3A, 0x44, 0x65, 0x44, 0x21, 0x04, 0xE6, 0xAA, 0xAA, 0x0A,
-	0xFE, 0xEE, 0x01, 0x12, 0x0A, 0x00, 0x00, 0x03, 0x00, 0x4C, 0xFE, 0x46, 0x03, 0x77, 0x06, 0x31,
-	0x00, 0x18, 0x00, 0x41, 0x00, 0x4A, 0x00, 0x26, 0x40, 0x11, 0x0D, 0x19, 0x0C, 0x41, 0x41, 0x00,
-	0x2D, 0x43, 0x49, 0x46, 0x44, 0x42, 0x80, 0x48, 0x18, 0x00, 0x06, 0x00, 0x3F, 0x32, 0xDE, 0x1A,
-	0xCD, 0x32, 0x32, 0x32, 0x39, 0x2F, 0x12, 0x39, 0x2F, 0x33, 0x33, 0x33, 0x30, 0x31, 0x53, 0x21,
-	0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34,
-	0x2E, 0x02, 0x23, 0x21, 0x13, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x23, 0x22,
-	0x06, 0x15, 0x14, 0x16, 0x16, 0x17, 0x07, 0x2E, 0x02, 0x27, 0x34, 0x36, 0x36, 0x33, 0x33, 0x32,
-	0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x23, 0x13, 0x17, 0x37, 0x33, 0x15, 0x03, 0x23, 0x03,
-	0x35, 0x81, 0x01, 0x2D, 0x5E, 0x9F, 0x75, 0x41, 0x40, 0x77, 0xA6, 0x66, 0x91, 0x8D, 0x60, 0x77,
-	0x36, 0x1E, 0x3D, 0x5E, 0x40, 0xFE, 0xD3, 0x8C, 0x91, 0x71, 0xB0, 0x79, 0x3F, 0x41, 0x76, 0xA0,
-	0x5E, 0x31, 0x51, 0x44, 0x38, 0x4C, 0x1E, 0x4B, 0x3D, 0x78, 0x51, 0x01, 0x51, 0x96, 0x66, 0x29,
-	0x3B, 0x5D, 0x41, 0x22, 0x26, 0x4A, 0x6C, 0x47, 0x8D, 0x2B, 0x97, 0x97, 0xA0, 0xFE, 0x72, 0xFB,
-	0x04, 0x3A, 0x2A, 0x50, 0x73, 0x48, 0x3A, 0x62, 0x4A, 0x29, 0x73, 0x28, 0x48, 0x30, 0x20, 0x37,
-	0x29, 0x18, 0xFE, 0xA1, 0x24, 0x46, 0x66, 0x42, 0x4C, 0x78, 0x54, 0x2B, 0x3F, 0x32, 0x35, 0x49,
-	0x2E, 0x0E, 0x7C, 0x1A, 0x58, 0x7D, 0x50, 0x58, 0x71, 0x36, 0x19, 0x2D, 0x3D, 0x25, 0x2A, 0x3E,
-	0x2A, 0x14, 0x04, 0x5F, 0xAA, 0xAA, 0x0B, 0xFE, 0xEE, 0x01, 0x13, 0x0A, 0x00, 0x03, 0x00, 0x67,
-	0xFF, 0xEC, 0x04, 0xFA, 0x05, 0xC4, 0x00, 0x17, 0x00, 0x28, 0x00, 0x39, 0x00, 0x1F, 0x40, 0x12,
-	0x0C, 0x29, 0x6A, 0x32, 0x20, 0x6A, 0x32, 0x32, 0x0C, 0x00, 0x18, 0x6A, 0x00, 0x03, 0x72, 0x0C,
-	0x09, 0x72, 0x00, 0x2B, 0x2B, 0x2B, 0x12, 0x39, 0x2F, 0x2B, 0x2B, 0x30, 0x31, 0x41, 0x32, 0x1E,
-	0x03, 0x15, 0x15, 0x14, 0x02, 0x06, 0x06, 0x23, 0x22, 0x2E, 0x03, 0x35, 0x35, 0x34, 0x12, 0x36,
-	0x36, 0x17, 0x22, 0x0E, 0x02, 0x07, 0x06, 0x06, 0x15, 0x21, 0x34, 0x26, 0x27, 0x2E, 0x03, 0x03,
-	0x32, 0x3E, 0x02, 0x37, 0x36, 0x36, 0x35, 0x21, 0x16, 0x16, 0x17, 0x1E, 0x03, 0x02, 0xB0, 0x6A,
-	0xB6, 0x8F, 0x66, 0x35, 0x52, 0x9A, 0xD7, 0x85, 0x67, 0xB4, 0x91, 0x68, 0x37, 0x55, 0x9C, 0xD7,
-	0x81, 0x51, 0x88, 0x65, 0x40, 0x09, 0x01, 0x02, 0x03, 0x15, 0x01, 0x02, 0x09, 0x3C, 0x65, 0x89,
-	0x53, 0x56, 0x8A, 0x63, 0x3B, 0x08, 0x01, 0x01, 0xFC, 0xED, 0x01, 0x02, 0x01, 0x0A, 0x40, 0x66,
-	0x87, 0x05, 0xC4, 0x3E, 0x77, 0xAB, 0xDB, 0x83, 0x5C, 0xA4, 0xFE, 0xFC, 0xB6, 0x60, 0x3E, 0x77,
-	0xAB, 0xDB, 0x83, 0x5C, 0xA4, 0x01, 0x03, 0xB7, 0x60, 0xA4, 0x3A, 0x72, 0xA7, 0x6D, 0x10, 0x23,
-	0x12, 0x11, 0x22, 0x10, 0x6E, 0xA7, 0x73, 0x3A, 0xFB, 0x6F, 0x3B, 0x74, 0xAB, 0x6F, 0x0B, 0x15,
-	0x0B, 0x10, 0x1E, 0x0E, 0x6B, 0xA4, 0x70, 0x39, 0x00, 0x03, 0x00, 0x5C, 0xFF, 0xEC, 0x04, 0x34,
-	0x04, 0x4E, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2B, 0x00, 0x1F, 0x40, 0x12, 0x0B, 0x21, 0x6A, 0x27,
-	0x1B, 0x6A, 0x27, 0x27, 0x0B, 0x00, 0x16, 0x6A, 0x00, 0x07, 0x72, 0x0B, 0x0B, 0x72, 0x00, 0x2B,
-	0x2B, 0x2B, 0x12, 0x39, 0x2F, 0x2B, 0x2B, 0x30, 0x31, 0x41, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14,
-	0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x17, 0x22, 0x0E, 0x02, 0x07,
-	0x21, 0x2E, 0x03, 0x03, 0x32, 0x3E, 0x02, 0x37, 0x21, 0x1E, 0x03, 0x02, 0x47, 0x72, 0xB7, 0x80,
-	0x44, 0x44, 0x80, 0xB5, 0x72, 0x72, 0xB6, 0x81, 0x44, 0x44, 0x80, 0xB6, 0x71, 0x44, 0x6A, 0x4B,
-	0x2D, 0x08, 0x02, 0x5E, 0x07, 0x2E, 0x4C, 0x6B, 0x42, 0x45, 0x6B, 0x4C, 0x2D, 0x06, 0xFD, 0xA0,
-	0x06, 0x2D, 0x4C, 0x6C, 0x04, 0x4E, 0x53, 0x95, 0xC9, 0x75, 0x17, 0x75, 0xC8, 0x95, 0x53, 0x53,
-	0x95, 0xC8, 0x75, 0x17, 0x75, 0xC9, 0x95, 0x53, 0x98, 0x33, 0x5A, 0x77, 0x44, 0x44, 0x77, 0x5A,
-	0x33, 0xFC, 0xCE, 0x34, 0x5D, 0x7B, 0x47, 0x47, 0x7B, 0x5D, 0x34, 0x00, 0x00, 0x02, 0x00, 0x16,
-	0x00, 0x00, 0x04, 0xDD, 0x05, 0xC3, 0x00, 0x0E, 0x00, 0x13, 0x00, 0x19, 0x40, 0x0D, 0x0E, 0x12,
-	0x08, 0x05, 0x13, 0x02, 0x72, 0x05, 0x03, 0x72, 0x12, 0x08, 0x72, 0x00, 0x2B, 0x2B, 0x2B, 0x11,
-	0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x01, 0x3E, 0x02, 0x33, 0x17, 0x07, 0x23, 0x22, 0x06, 0x06,
-	0x07, 0x01, 0x23, 0x01, 0x01, 0x13, 0x23, 0x01, 0x02, 0x87, 0x01, 0x02, 0x21, 0x50, 0x6B, 0x4A,
-	0x2E, 0x01, 0x0C, 0x22, 0x33, 0x29, 0x14, 0xFE, 0x7C, 0x95, 0xFE, 0xC2, 0x01, 0x5C, 0x62, 0x95,
-	0xFE, 0x06, 0x01, 0x76, 0x03, 0x29, 0x68, 0x81, 0x3B, 0x01, 0xAA, 0x1B, 0x3E, 0x37, 0xFB, 0x78,
-	0x05, 0xB0, 0xFB, 0xC7, 0xFE, 0x89, 0x05, 0xB0, 0x00, 0x02, 0x00, 0x2F, 0x00, 0x00, 0x04, 0x0C,
-	0x04, 0x4E, 0x00, 0x12, 0x00, 0x17, 0x00, 0x15, 0x40, 0x0B, 0x17, 0x06, 0x72, 0x12, 0x16, 0x0A,
-	0x72, 0x0C, 0x05, 0x07, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x2B, 0x30, 0x31, 0x41, 0x13, 0x3E,
-	0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x07, 0x01, 0x23, 0x03,
-	0x13, 0x13, 0x23, 0x01, 0x02, 0x0C, 0x9D, 0x1C, 0x4D, 0x5D, 0x32, 0x1D, 0x35, 0x19, 0x15, 0x05,
-	0x17, 0x0F, 0x14, 0x29, 0x22, 0x0B, 0xFE, 0xD6, 0x7A, 0xD2, 0xF0, 0x4A, 0x7B, 0xFE, 0x84, 0x01,
-	0x3C, 0x02, 0x1F, 0x58, 0x6A, 0x31, 0x08, 0x11, 0x94, 0x03, 0x05, 0x16, 0x29, 0x1D, 0xFC, 0xB3,
-	0x04, 0x3A, 0xFD, 0x02, 0xFE, 0xC4, 0x04, 0x3A, 0x00, 0x04, 0x00, 0x67, 0xFF, 0x73, 0x04, 0xFA,
-	0x06, 0x35, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1F, 0x00, 0x37, 0x00, 0x24, 0x40, 0x10, 0x02, 0x02,
-	0x27, 0x27, 0x03, 0x1A, 0x03, 0x72, 0x07, 0x07, 0x33, 0x33, 0x06, 0x0E, 0x09, 0x72, 0x00, 0x2B,
-	0xCD, 0x33, 0x11, 0x33, 0x7C, 0x2F, 0x2B, 0x18, 0xCD, 0x33, 0x11, 0x33, 0x7D, 0x2F, 0x30, 0x31,
-	0x41, 0x11, 0x23, 0x11, 0x13, 0x11, 0x23, 0x11, 0x01, 0x15, 0x14, 0x02, 0x06, 0x06, 0x23, 0x22,
-	0x2E, 0x03, 0x35, 0x35, 0x34, 0x12, 0x36, 0x36, 0x33, 0x32, 0x1E, 0x03, 0x07, 0x35, 0x34, 0x2E,
-	0x03, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x03, 0x33, 0x32, 0x3E, 0x02, 0x03, 0x16,
-	0xB9, 0xB9, 0xB9, 0x02, 0x9D, 0x52, 0x9A, 0xD7, 0x85, 0x67, 0xB4, 0x91, 0x68, 0x37, 0x55, 0x9C,
-	0xD7, 0x81, 0x6A, 0xB6, 0x8F, 0x66, 0x35, 0xBF, 0x22, 0x42, 0x60, 0x7C, 0x4B, 0x59, 0x91, 0x68,
-	0x38, 0x24, 0x45, 0x61, 0x7B, 0x47, 0x5E, 0x92, 0x65, 0x34, 0x06, 0x35, 0xFE, 0x7E, 0x01, 0x82,
-	0xFA, 0xC9, 0xFE, 0x75, 0x01, 0x8B, 0x02, 0x08, 0x5C, 0xA4, 0xFE, 0xFC, 0xB6, 0x60, 0x3E, 0x77,
-	0xAB, 0xDB, 0x83, 0x5C, 0xA4, 0x01, 0x03, 0xB7, 0x60, 0x3E, 0x77, 0xAB, 0xDB, 0xDF, 0x5E, 0x68,
-	0xA9, 0x82, 0x58, 0x2D, 0x46, 0x88, 0xC8, 0x82, 0x5E, 0x69, 0xAA, 0x83, 0x58, 0x2D, 0x46, 0x89,
-	0xC9, 0x00, 0x00, 0x04, 0x00, 0x5C, 0xFF, 0x89, 0x04, 0x34, 0x04, 0xB6, 0x00, 0x03, 0x00, 0x07,
-	0x00, 0x1D, 0x00, 0x33, 0x00, 0x24, 0x40, 0x10, 0x07, 0x07, 0x24, 0x24, 0x06, 0x19, 0x0B, 0x72,
-	0x02, 0x02, 0x2F, 0x2F, 0x03, 0x0E, 0x07, 0x72, 0x00, 0x2B, 0xCD, 0x33, 0x11, 0x33, 0x7D, 0x2F,
-	0x2B, 0x18, 0xCD, 0x33, 0x11, 0x33, 0x7C, 0x2F, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13, 0x11,
-	0x23, 0x11, 0x01, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14, 0x0E, 0x02,
-	0x23, 0x22, 0x2E, 0x02, 0x37, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x34,
-	0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x02, 0xA2, 0xBA, 0xBA, 0xBA, 0xFE, 0x74, 0x44, 0x80, 0xB6,
-	0x71, 0x72, 0xB7, 0x80, 0x44, 0x44, 0x80, 0xB5, 0x72, 0x72, 0xB6, 0x81, 0x44, 0xB9, 0x26, 0x4D,
-	0x74, 0x4D, 0x4C, 0x73, 0x4C, 0x27, 0x27, 0x4D, 0x73, 0x4D, 0x4C, 0x73, 0x4D, 0x26, 0x04, 0xB6,
-	0xFE, 0x90, 0x01, 0x70, 0xFC, 0x42, 0xFE, 0x91, 0x01, 0x6F, 0x01, 0x19, 0x17, 0x75, 0xC9, 0x95,
-	0x53, 0x53, 0x95, 0xC9, 0x75, 0x17, 0x75, 0xC8, 0x95, 0x53, 0x53, 0x95, 0xC8, 0x8C, 0x17, 0x51,
-	0x8F, 0x6E, 0x3F, 0x3F, 0x6E, 0x8F, 0x51, 0x17, 0x50, 0x8F, 0x6F, 0x40, 0x40, 0x6F, 0x8F, 0x00,
-	0x00, 0x04, 0x00, 0x9C, 0xFF, 0xEB, 0x06, 0x6F, 0x07, 0x52, 0x00, 0x15, 0x00, 0x20, 0x00, 0x41,
-	0x00, 0x65, 0x00, 0x33, 0x40, 0x19, 0x5B, 0x4E, 0x09, 0x72, 0x54, 0x31, 0x31, 0x2C, 0x38, 0x09,
-	0x72, 0x42, 0x43, 0x43, 0x11, 0x08, 0x08, 0x1B, 0x1B, 0x16, 0x16, 0x22, 0x21, 0x02, 0x72, 0x00,
-	0x2B, 0x32, 0x32, 0x7C, 0x2F, 0x33, 0x18, 0x2F, 0x33, 0x11, 0x33, 0x32, 0x11, 0x33, 0x2B, 0x32,
-	0x32, 0x2F, 0x33, 0x2B, 0x32, 0x30, 0x31, 0x41, 0x33, 0x15, 0x23, 0x22, 0x2E, 0x02, 0x23, 0x22,
-	0x06, 0x15, 0x15, 0x23, 0x35, 0x34, 0x36, 0x33, 0x32, 0x1E, 0x02, 0x01, 0x27, 0x36, 0x36, 0x35,
-	0x35, 0x33, 0x15, 0x14, 0x06, 0x06, 0x25, 0x15, 0x22, 0x06, 0x06, 0x15, 0x11, 0x14, 0x1E, 0x02,
-	0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35,
-	0x11, 0x34, 0x36, 0x36, 0x05, 0x35, 0x32, 0x1E, 0x02, 0x15, 0x11, 0x14, 0x0E, 0x02, 0x23, 0x22,
-	0x2E, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x11, 0x34,
-	0x2E, 0x02, 0x05, 0x1B, 0x28, 0x2A, 0x57, 0x88, 0x6D, 0x5E, 0x2D, 0x33, 0x3E, 0x80, 0x7F, 0x6E,
-	0x3C, 0x6A, 0x6B, 0x7D, 0xFE, 0x98, 0x4C, 0x21, 0x23, 0x9E, 0x30, 0x46, 0xFE, 0xAD, 0x3D, 0x5F,
-	0x37, 0x1F, 0x39, 0x4D, 0x2E, 0x47, 0x6F, 0x3F, 0x9C, 0x3C, 0x6C, 0x92, 0x57, 0x57, 0x94, 0x6D,
-	0x3D, 0x6A, 0xB7, 0x03, 0x1E, 0x57, 0x94, 0x6D, 0x3C, 0x3C, 0x6D, 0x94, 0x57, 0x56, 0x92, 0x6C,
-	0x3C, 0x9C, 0x24, 0x42, 0x59, 0x35, 0x2E, 0x4D, 0x39, 0x20, 0x20, 0x39, 0x4D, 0x06, 0xD4, 0x7F,
-	0x26, 0x31, 0x26, 0x35, 0x37, 0x12, 0x24, 0x6E, 0x6C, 0x26, 0x32, 0x26, 0xFE, 0x58, 0x37, 0x28,
-	0x47, 0x27, 0x5F, 0x66, 0x26, 0x4E, 0x40, 0x72, 0x9E, 0x41, 0x83, 0x64, 0xFD, 0xC6, 0x4B, 0x6F,
-	0x4A, 0x24, 0x3A, 0x74, 0x58, 0x01, 0xAC, 0xFE, 0x54, 0x69, 0x9E, 0x68, 0x34, 0x38, 0x71, 0xAA,
-	0x72, 0x02, 0x3A, 0x98, 0xC9, 0x65, 0x9E, 0x9E, 0x39, 0x71, 0xAA, 0x72, 0xFD, 0xC6, 0x72, 0xAA,
-	0x71, 0x38, 0x34, 0x68, 0x9E, 0x69, 0x01, 0xAC, 0xFE, 0x54, 0x42, 0x62, 0x42, 0x20, 0x24, 0x4A,
-	0x6F, 0x4B, 0x02, 0x3A, 0x4B, 0x6F, 0x4A, 0x24, 0x00, 0x04, 0x00, 0x7E, 0xFF, 0xEB, 0x05, 0xAA,
-	0x05, 0xF1, 0x00, 0x15, 0x00, 0x20, 0x00, 0x42, 0x00, 0x66, 0x00, 0x33, 0x40, 0x19, 0x5C, 0x4F,
-	0x0B, 0x72, 0x55, 0x32, 0x32, 0x2C, 0x39, 0x0B, 0x72, 0x43, 0x44, 0x44, 0x11, 0x08, 0x08, 0x1B,
-	0x1B, 0x16, 0x16, 0x22, 0x21, 0x06, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x7C, 0x2F, 0x33, 0x18, 0x2F,
-	0x33, 0x11, 0x33, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x32, 0x2F, 0x33, 0x2B, 0x32, 0x30, 0x31, 0x41,
-	0x33, 0x15, 0x23, 0x22, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x15, 0x15, 0x23, 0x35, 0x34, 0x36, 0x33,
-	0x32, 0x1E, 0x02, 0x01, 0x27, 0x36, 0x36, 0x35, 0x35, 0x33, 0x15, 0x14, 0x06, 0x06, 0x25, 0x15,
-	0x22, 0x06, 0x06, 0x15, 0x11, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x33, 0x15,
-	0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x11, 0x34, 0x36, 0x36, 0x05, 0x35, 0x32, 0x1E,
-	0x02, 0x15, 0x11, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x33, 0x15, 0x14, 0x1E,
-	0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x11, 0x34, 0x2E, 0x02, 0x04, 0xC3, 0x2A, 0x2C, 0x57, 0x88,
-	0x6D, 0x5D, 0x2D, 0x33, 0x3F, 0x80, 0x7F, 0x6F, 0x3C, 0x69, 0x6B, 0x7D, 0xFE, 0x97, 0x4B, 0x21,
-	0x23, 0x9D, 0x30, 0x45, 0xFE, 0xBA, 0x32, 0x4F, 0x2D, 0x1A, 0x2F, 0x3F, 0x26, 0x2D, 0x4C, 0x39,
-	0x20, 0x95, 0x35, 0x61, 0x83, 0x4E, 0x4E, 0x83, 0x61, 0x36, 0x5D, 0xA3, 0x02, 0xC4, 0x4E, 0x84,
-	0x61, 0x35, 0x35, 0x61, 0x84, 0x4E, 0x4D, 0x83, 0x61, 0x35, 0x95, 0x20, 0x38, 0x4C, 0x2D, 0x26,
-	0x40, 0x2F, 0x1A, 0x1A, 0x2F, 0x40, 0x05, 0x73, 0x7F, 0x26, 0x32, 0x26, 0x35, 0x38, 0x12, 0x24,
-	0x6E, 0x6C, 0x26, 0x32, 0x26, 0xFE, 0x4F, 0x37, 0x28, 0x48, 0x26, 0x5F, 0x66, 0x26, 0x4E, 0x40,
-	0x70, 0x97, 0x39, 0x73, 0x58, 0xFE, 0xDE, 0x42, 0x62, 0x40, 0x20, 0x1C, 0x37, 0x54, 0x38, 0xEA,
-	0xEA, 0x5E, 0x8D, 0x5E, 0x2E, 0x33, 0x67, 0x9B, 0x67, 0x01, 0x22, 0x8A, 0xB7, 0x5A, 0x97, 0x97,
-	0x33, 0x66, 0x9A, 0x68, 0xFE, 0xDE, 0x67, 0x9B, 0x67, 0x33, 0x2E, 0x5E, 0x8D, 0x5E, 0xEA, 0xEA,
-	0x38, 0x54, 0x37, 0x1C, 0x20, 0x40, 0x62, 0x42, 0x01, 0x22, 0x42, 0x62, 0x40, 0x20, 0x00, 0x03,
-	0x00, 0x9C, 0xFF, 0xEB, 0x06, 0x76, 0x07, 0x04, 0x00, 0x07, 0x00, 0x20, 0x00, 0x38, 0x00, 0x2B,
-	0x40, 0x15, 0x34, 0x27, 0x09, 0x72, 0x05, 0x02, 0x01, 0x01, 0x07, 0x07, 0x2D, 0x21, 0x08, 0x08,
-	0x15, 0x02, 0x72, 0x1C, 0x0F, 0x09, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x11, 0x33, 0x33, 0x33,
-	0x7C, 0x2F, 0x33, 0x18, 0x2F, 0x33, 0x33, 0x2B, 0x32, 0x30, 0x31, 0x41, 0x21, 0x35, 0x21, 0x17,
-	0x21, 0x15, 0x23, 0x07, 0x33, 0x11, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x11, 0x33,
-	0x11, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x01, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23,
-	0x22, 0x2E, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x03,
-	0x31, 0xFE, 0xC7, 0x03, 0x2B, 0x01, 0xFE, 0xB5, 0xA8, 0x0B, 0x9C, 0x3C, 0x6C, 0x92, 0x57, 0x57,
-	0x94, 0x6D, 0x3D, 0xC2, 0x1F, 0x39, 0x4D, 0x2E, 0x47, 0x6F, 0x3F, 0x02, 0x8F, 0xC1, 0x6E, 0xBE,
-	0x79, 0x52, 0x8D, 0x67, 0x3A, 0x9C, 0x22, 0x3D, 0x54, 0x31, 0x42, 0x67, 0x3B, 0x06, 0x98, 0x6C,
-	0x6C, 0x7D, 0x6B, 0xFB, 0xDE, 0x69, 0x9E, 0x68, 0x34, 0x34, 0x68, 0x9E, 0x69, 0x04, 0x22, 0xFB,
-	0xDE, 0x42, 0x62, 0x42, 0x20, 0x3A, 0x74, 0x58, 0x04, 0x22, 0xFB, 0xDE, 0x8C, 0xBB, 0x5C, 0x34,
-	0x68, 0x9E, 0x69, 0x04, 0x22, 0xFB, 0xDE, 0x42, 0x62, 0x42, 0x20, 0x3A, 0x74, 0x58, 0x00, 0x03,
-	0x00, 0x81, 0xFF, 0xEB, 0x05, 0xAE, 0x05, 0xB1, 0x00, 0x07, 0x00, 0x20, 0x00, 0x39, 0x00, 0x2B,
-	0x40, 0x15, 0x34, 0x27, 0x0B, 0x72, 0x05, 0x02, 0x01, 0x01, 0x07, 0x07, 0x2D, 0x21, 0x08, 0x08,
-	0x15, 0x06, 0x72, 0x1C, 0x0F, 0x0B, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x11, 0x33, 0x33, 0x33,
-	0x7C, 0x2F, 0x33, 0x18, 0x2F, 0x33, 0x33, 0x2B, 0x32, 0x30, 0x31, 0x41, 0x21, 0x35, 0x21, 0x17,
-	0x21, 0x15, 0x23, 0x07, 0x33, 0x11, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x11, 0x33,
-	0x11, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x01, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23,
-	0x22, 0x2E, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x02,
-	0xC1, 0xFE, 0xC7, 0x03, 0x2B, 0x03, 0xFE, 0xB3, 0xA8, 0x07, 0x96, 0x35, 0x61, 0x83, 0x4E, 0x4E,
-	0x83, 0x61, 0x36, 0xBA, 0x1A, 0x2F, 0x3F, 0x26, 0x3C, 0x5E, 0x37, 0x02, 0x3B, 0xB9, 0x62, 0xAB,
-	0x6C, 0x4A, 0x7D, 0x5C, 0x33, 0x96, 0x1C, 0x34, 0x46, 0x2A, 0x29, 0x46, 0x34, 0x1D, 0x05, 0x45,
-	0x6C, 0x6C, 0x7F, 0x8C, 0xFD, 0x28, 0x5E, 0x8D, 0x5E, 0x2E, 0x2E, 0x5E, 0x8D, 0x5E, 0x02, 0xD8,
-	0xFD, 0x28, 0x38, 0x54, 0x37, 0x1C, 0x31, 0x63, 0x4B, 0x02, 0xD8, 0xFD, 0x28, 0x7E, 0xA6, 0x53,
-	0x2E, 0x5E, 0x8D, 0x5E, 0x02, 0xD8, 0xFD, 0x28, 0x38, 0x54, 0x37, 0x1C, 0x1C, 0x37, 0x54, 0x38,
-	0x00, 0x02, 0x00, 0x76, 0xFE, 0x84, 0x04, 0xBC, 0x05, 0xC5, 0x00, 0x21, 0x00, 0x25, 0x00, 0x19,
-	0x40, 0x0C, 0x16, 0x12, 0x0D, 0x03, 0x72, 0x25, 0x00, 0x00, 0x24, 0x01, 0x09, 0x72, 0x00, 0x2B,
-	0xCD, 0x33, 0x11, 0x33, 0x2B, 0xCC, 0x33, 0x30, 0x31, 0x65, 0x15, 0x22, 0x2E, 0x03, 0x35, 0x35,
-	0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15,
-	0x15, 0x14, 0x1E, 0x03, 0x33, 0x11, 0x23, 0x11, 0x02, 0xA2, 0x63, 0xAB, 0x89, 0x61, 0x34, 0x50,
-	0x95, 0xCD, 0x7C, 0xA4, 0xEF, 0x84, 0x01, 0xC0, 0x01, 0x50, 0x98, 0x6F, 0x55, 0x88, 0x5E, 0x32,
-	0x20, 0x3D, 0x58, 0x72, 0xB7, 0xC0, 0x88, 0x9D, 0x3C, 0x70, 0x9A, 0xBE, 0x6C, 0xFA, 0x87, 0xE3,
-	0xA9, 0x5D, 0x76, 0xDB, 0x96, 0x66, 0x93, 0x50, 0x48, 0x7F, 0xA8, 0x61, 0xFC, 0x4E, 0x8C, 0x75,
-	0x55, 0x2F, 0xFD, 0xFC, 0x02, 0x04, 0x00, 0x02, 0x00, 0x64, 0xFE, 0x82, 0x03, 0xE1, 0x04, 0x4E,
-	0x00, 0x1F, 0x00, 0x23, 0x00, 0x19, 0x40, 0x0C, 0x15, 0x11, 0x0C, 0x07, 0x72, 0x20, 0x00, 0x00,
-	0x22, 0x01, 0x0B, 0x72, 0x00, 0x2B, 0xCD, 0x33, 0x11, 0x33, 0x2B, 0xCC, 0x33, 0x30, 0x31, 0x65,
-	0x15, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34,
-	0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x11, 0x23, 0x11, 0x02,
-	0x3D, 0x71, 0xB0, 0x79, 0x3F, 0x3F, 0x79, 0xB0, 0x71, 0x79, 0xBE, 0x6D, 0xAF, 0x41, 0x6F, 0x45,
-	0x4C, 0x6D, 0x45, 0x21, 0x21, 0x44, 0x6E, 0xB2, 0xB9, 0x83, 0x98, 0x56, 0x97, 0xC3, 0x6D, 0x2A,
-	0x6D, 0xC3, 0x96, 0x56, 0x67, 0xB1, 0x70, 0x43, 0x6D, 0x40, 0x43, 0x71, 0x89, 0x47, 0x2A, 0x47,
-	0x8B, 0x70, 0x43, 0xFD, 0xFF, 0x02, 0x01, 0x00, 0x00, 0x01, 0x00, 0x74, 0x00, 0x00, 0x04, 0x91,
-	0x05, 0x3E, 0x00, 0x13, 0x00, 0x08, 0xB1, 0x0F, 0x05, 0x00, 0x2F, 0x2F, 0x30, 0x31, 0x41, 0x03,
-	0x05, 0x07, 0x25, 0x03, 0x23, 0x13, 0x25, 0x37, 0x05, 0x13, 0x25, 0x37, 0x05, 0x13, 0x33, 0x03,
-	0x05, 0x07, 0x03, 0x28, 0xCF, 0x01, 0x21, 0x45, 0xFE, 0xDD, 0xB6, 0xA8, 0xE1, 0xFE, 0xDF, 0x44,
-	0x01, 0x25, 0xCD, 0xFE, 0xDE, 0x46, 0x01, 0x23, 0xBC, 0xA5, 0xE6, 0x01, 0x25, 0x49, 0x03, 0x2B,
-	0xFE, 0x94, 0xAC, 0x7C, 0xAA, 0xFE, 0xBF, 0x01, 0x8E, 0xAB, 0x7B, 0xAB, 0x01, 0x6D, 0xAB, 0x7D,
-	0xAB, 0x01, 0x4B, 0xFE, 0x69, 0xAB, 0x7B, 0x00, 0x00, 0x01, 0xFC, 0x66, 0x04, 0xA6, 0xFF, 0x27,
-	0x05, 0xFC, 0x00, 0x07, 0x00, 0x15, 0xB7, 0x06, 0x06, 0x04, 0x04, 0x01, 0x02, 0x02, 0x01, 0x00,
-	0x2F, 0x33, 0x2F, 0x11, 0x33, 0x11, 0x33, 0x7C, 0x2F, 0x30, 0x31, 0x43, 0x21, 0x15, 0x27, 0x37,
-	0x21, 0x27, 0x17, 0xD9, 0xFD, 0xE5, 0xA6, 0x01, 0x02, 0x1C, 0x01, 0xA5, 0x05, 0x24, 0x7E, 0x01,
-	0xE9, 0x6C, 0x01, 0x00, 0x00, 0x01, 0xFC, 0x70, 0x05, 0x17, 0xFF, 0x64, 0x06, 0x15, 0x00, 0x15,
-	0x00, 0x12, 0xB6, 0x01, 0x14, 0x14, 0x0F, 0x06, 0x80, 0x0B, 0x00, 0x2F, 0x1A, 0xCC, 0x32, 0x33,
-	0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x32, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x15, 0x15, 0x23, 0x35,
-	0x34, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x23, 0x23, 0xFC, 0x70, 0x2A, 0x50, 0x7C, 0x6B, 0x69, 0x3C,
-	0x6F, 0x7F, 0x80, 0x3E, 0x34, 0x2D, 0x5D, 0x6D, 0x88, 0x57, 0x2C, 0x05, 0x97, 0x26, 0x32, 0x26,
-	0x6C, 0x6E, 0x24, 0x12, 0x38, 0x34, 0x26, 0x31, 0x26, 0x00, 0x00, 0x01, 0xFD, 0x65, 0x05, 0x17,
-	0xFE, 0x54, 0x06, 0x58, 0x00, 0x05, 0x00, 0x0A, 0xB2, 0x00, 0x80, 0x02, 0x00, 0x2F, 0x1A, 0xCD,
-	0x30, 0x31, 0x41, 0x27, 0x35, 0x33, 0x07, 0x17, 0xFE, 0x06, 0xA1, 0xB4, 0x01, 0x3C, 0x05, 0x17,
-	0xC5, 0x7C, 0x8C, 0x74, 0x00, 0x01, 0xFD, 0xA4, 0x05, 0x17, 0xFE, 0x92, 0x06, 0x58, 0x00, 0x05,
-	0x00, 0x0A, 0xB2, 0x01, 0x80, 0x04, 0x00, 0x2F, 0x1A, 0xCD, 0x30, 0x31, 0x41, 0x07, 0x27, 0x37,
-	0x27, 0x33, 0xFE, 0x92, 0xA2, 0x4C, 0x3A, 0x01, 0xB5, 0x05, 0xDC, 0xC5, 0x41, 0x74, 0x8C, 0x00,
-	0x00, 0x08, 0xFA, 0x1A, 0xFE, 0xC4, 0x01, 0xB6, 0x05, 0xAF, 0x00, 0x0D, 0x00, 0x1B, 0x00, 0x29,
-	0x00, 0x37, 0x00, 0x45, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6F, 0x00, 0x00, 0x41, 0x23, 0x34, 0x36,
-	0x33, 0x32, 0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x01, 0x23, 0x34, 0x36, 0x33, 0x32,
-	0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x13, 0x23, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
-	0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x03, 0x23, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x23, 0x34,
-	0x26, 0x23, 0x22, 0x06, 0x01, 0x23, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x23, 0x34, 0x26, 0x23,
-	0x22, 0x06, 0x01, 0x23, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06,
-	0x03, 0x23, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x13, 0x23,
-	0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0xFD, 0x78, 0x71, 0x71,
-	0x61, 0x62, 0x71, 0x70, 0x2D, 0x36, 0x35, 0x2C, 0x02, 0x50, 0x72, 0x71, 0x61, 0x62, 0x72, 0x71,
-	0x2C, 0x37, 0x34, 0x2C, 0xBA, 0x71, 0x71, 0x61, 0x62, 0x71, 0x70, 0x2C, 0x37, 0x34, 0x2D, 0xC5,
-	0x71, 0x71, 0x61, 0x62, 0x71, 0x70, 0x2C, 0x37, 0x34, 0x2D, 0xFD, 0xC0, 0x71, 0x71, 0x61, 0x62,
-	0x71, 0x70, 0x2D, 0x36, 0x34, 0x2D, 0xFD, 0xBF, 0x72, 0x72, 0x61, 0x62, 0x71, 0x70, 0x2D, 0x36,
-	0x35, 0x2C, 0xB1, 0x71, 0x71, 0x61, 0x62, 0x71, 0x70, 0x2C, 0x37, 0x34, 0x2D, 0xA7, 0x72, 0x71,
-	0x61, 0x62, 0x72, 0x71, 0x2C, 0x37, 0x34, 0x2C, 0x04, 0xF3, 0x53, 0x69, 0x69, 0x53, 0x28, 0x3D,
-	0x3D, 0xFE, 0xC3, 0x53, 0x69, 0x69, 0x53, 0x28, 0x3D, 0x3D, 0xFD, 0xE1, 0x53, 0x69, 0x69, 0x53,
-	0x28, 0x3D, 0x3D, 0xFD, 0xD1, 0x53, 0x69, 0x69, 0x53, 0x28, 0x3D, 0x3D, 0xFE, 0xBC, 0x53, 0x69,
-	0x69, 0x53, 0x28, 0x3D, 0x3D, 0x04, 0xF2, 0x53, 0x69, 0x69, 0x53, 0x28, 0x3D, 0x3D, 0xFD, 0xE1,
-	0x53, 0x69, 0x69, 0x53, 0x28, 0x3D, 0x3D, 0xFD, 0xD1, 0x53, 0x69, 0x69, 0x53, 0x28, 0x3D, 0x3D,
-	0x00, 0x08, 0xFA, 0x2B, 0xFE, 0x63, 0x01, 0x6B, 0x05, 0xC6, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0E,
-	0x00, 0x13, 0x00, 0x18, 0x00, 0x1D, 0x00, 0x22, 0x00, 0x27, 0x00, 0x00, 0x45, 0x33, 0x17, 0x03,
-	0x23, 0x13, 0x23, 0x27, 0x13, 0x33, 0x01, 0x35, 0x37, 0x05, 0x15, 0x25, 0x15, 0x07, 0x25, 0x35,
-	0x01, 0x27, 0x37, 0x25, 0x17, 0x01, 0x17, 0x07, 0x05, 0x27, 0x01, 0x07, 0x27, 0x03, 0x37, 0x01,
-	0x37, 0x17, 0x13, 0x07, 0xFD, 0xA5, 0x89, 0x0B, 0x7A, 0x60, 0x94, 0x88, 0x0C, 0x7A, 0x60, 0x01,
-	0xD8, 0x0D, 0x01, 0x4D, 0xFA, 0x1A, 0x0D, 0xFE, 0xB3, 0x05, 0x57, 0x61, 0x02, 0x01, 0x41, 0x44,
-	0xFB, 0x6C, 0x61, 0x02, 0xFE, 0xC0, 0x45, 0x01, 0x5D, 0x62, 0x11, 0x94, 0x41, 0x03, 0xC5, 0x61,
-	0x11, 0x95, 0x42, 0x3C, 0x0E, 0xFE, 0xAD, 0x06, 0x03, 0x0E, 0x01, 0x52, 0xFC, 0x26, 0x8B, 0x0C,
-	0x7C, 0x62, 0x97, 0x8B, 0x0C, 0x7C, 0x62, 0x01, 0x04, 0x63, 0x10, 0x99, 0x44, 0xFC, 0x29, 0x63,
-	0x11, 0x99, 0x45, 0x04, 0x0E, 0x62, 0x02, 0x01, 0x46, 0x45, 0xFB, 0x55, 0x63, 0x02, 0xFE, 0xBB,
-	0x47, 0x00, 0xFF, 0xFF, 0x00, 0xB2, 0xFE, 0x99, 0x05, 0xB4, 0x07, 0x19, 0x04, 0x26, 0x00, 0xDC,
-	0x00, 0x00, 0x00, 0x27, 0x00, 0xA1, 0x01, 0x31, 0x01, 0x42, 0x01, 0x07, 0x00, 0x10, 0x04, 0x7F,
-	0xFF, 0xBC, 0x00, 0x15, 0x40, 0x0E, 0x02, 0x23, 0x04, 0x00, 0x00, 0x98, 0x56, 0x01, 0x0F, 0x01,
-	0x01, 0x01, 0x5E, 0x56, 0x00, 0x2B, 0x34, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x9D, 0xFE, 0x99,
-	0x04, 0xB7, 0x05, 0xC2, 0x04, 0x26, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x27, 0x00, 0xA1, 0x00, 0xA1,
-	0xFF, 0xEB, 0x01, 0x07, 0x00, 0x10, 0x03, 0x82, 0xFF, 0xBC, 0x00, 0x15, 0x40, 0x0E, 0x02, 0x23,
-	0x04, 0x01, 0x00, 0x98, 0x56, 0x01, 0x0F, 0x01, 0x01, 0x01, 0x7D, 0x56, 0x00, 0x2B, 0x34, 0x2B,
-	0x34, 0x00, 0x00, 0x02, 0xFF, 0xDB, 0x00, 0x00, 0x03, 0xFC, 0x06, 0x72, 0x00, 0x17, 0x00, 0x1B,
-	0x00, 0x1A, 0x40, 0x0C, 0x1A, 0x0B, 0x1B, 0x02, 0x72, 0x00, 0x17, 0x17, 0x0D, 0x0D, 0x0A, 0x12,
-	0x00, 0x3F, 0x33, 0x11, 0x33, 0x2F, 0x33, 0x2B, 0xCE, 0x33, 0x30, 0x31, 0x41, 0x21, 0x32, 0x16,
-	0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34,
-	0x26, 0x26, 0x23, 0x21, 0x01, 0x15, 0x21, 0x35, 0x01, 0x23, 0x01, 0x45, 0x84, 0xB4, 0x5C, 0x5C,
-	0xB4, 0x84, 0xFE, 0x34, 0xB9, 0x01, 0x13, 0x50, 0x60, 0x2A, 0x2A, 0x60, 0x50, 0xFE, 0xBB, 0x01,
-	0x74, 0xFD, 0x44, 0x02, 0xEA, 0x60, 0xA6, 0x6B, 0x69, 0xAB, 0x65, 0x06, 0x72, 0xFA, 0x26, 0x3F,
-	0x64, 0x37, 0x35, 0x67, 0x45, 0x03, 0x5D, 0x98, 0x98, 0x00, 0x00, 0x02, 0x00, 0xA9, 0x00, 0x00,
-	0x04, 0xD8, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x1B, 0x00, 0x23, 0x40, 0x11, 0x01, 0x02, 0x05, 0x00,
-	0x03, 0x06, 0x06, 0x05, 0x05, 0x12, 0x10, 0x13, 0x02, 0x72, 0x12, 0x08, 0x72, 0x00, 0x2B, 0x2B,
-	0x32, 0x11, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x33, 0x11, 0x33, 0x33, 0x30, 0x31, 0x41, 0x01, 0x07,
-	0x01, 0x03, 0x21, 0x35, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x11, 0x23,
-	0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x03, 0x68, 0x01, 0x70, 0x6E, 0xFE, 0x91,
-	0x39, 0xFE, 0x7B, 0x01, 0x85, 0x71, 0x8C, 0x41, 0x41, 0x8C, 0x71, 0xFE, 0xA7, 0xC0, 0x02, 0x19,
-	0xA5, 0xE3, 0x76, 0x75, 0xE4, 0x03, 0xD4, 0xFE, 0x6B, 0x66, 0x01, 0x94, 0xFE, 0xCE, 0x9D, 0x48,
-	0x80, 0x52, 0x4B, 0x84, 0x51, 0xFA, 0xEE, 0x05, 0xB0, 0x72, 0xC9, 0x81, 0x8C, 0xC6, 0x67, 0x00,
-	0x00, 0x04, 0x00, 0x8C, 0xFE, 0x60, 0x04, 0x23, 0x04, 0x4E, 0x00, 0x03, 0x00, 0x08, 0x00, 0x1E,
-	0x00, 0x34, 0x00, 0x25, 0x40, 0x14, 0x00, 0x03, 0x30, 0x01, 0x02, 0x30, 0x25, 0x1A, 0x0F, 0x0B,
-	0x72, 0x07, 0x06, 0x72, 0x1A, 0x07, 0x72, 0x06, 0x0E, 0x72, 0x00, 0x2B, 0x2B, 0x2B, 0x2B, 0x11,
-	0x33, 0x32, 0x32, 0x32, 0x11, 0x33, 0x33, 0x30, 0x31, 0x41, 0x01, 0x07, 0x01, 0x01, 0x11, 0x23,
-	0x11, 0x33, 0x01, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x27, 0x35, 0x3E, 0x03, 0x33,
-	0x32, 0x1E, 0x02, 0x07, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x07, 0x11, 0x1E, 0x03,
-	0x33, 0x32, 0x3E, 0x02, 0x02, 0xD9, 0x01, 0x4A, 0x6D, 0xFE, 0xB5, 0xFE, 0xDB, 0xBA, 0xAA, 0x02,
-	0xE9, 0x38, 0x6B, 0x9C, 0x65, 0x67, 0x9E, 0x6E, 0x41, 0x0C, 0x0C, 0x42, 0x6D, 0x9C, 0x66, 0x66,
-	0x9E, 0x6C, 0x37, 0xBA, 0x22, 0x47, 0x6E, 0x4C, 0x46, 0x67, 0x48, 0x2D, 0x0B, 0x0F, 0x2F, 0x47,
-	0x65, 0x45, 0x4B, 0x6D, 0x47, 0x22, 0x01, 0x85, 0xFE, 0x8A, 0x67, 0x01, 0x76, 0x02, 0x4C, 0xFA,
-	0xF6, 0x05, 0xDA, 0xFD, 0xEC, 0x15, 0x76, 0xC9, 0x94, 0x52, 0x44, 0x82, 0xB6, 0x72, 0x70, 0x78,
-	0xBE, 0x87, 0x47, 0x4F, 0x92, 0xCB, 0x91, 0x15, 0x51, 0x8F, 0x6D, 0x3F, 0x30, 0x51, 0x67, 0x37,
-	0xFE, 0xFD, 0x35, 0x60, 0x4B, 0x2C, 0x3F, 0x6E, 0x8F, 0x00, 0x00, 0x02, 0x00, 0xA2, 0x00, 0x00,
-	0x04, 0x24, 0x07, 0x00, 0x00, 0x03, 0x00, 0x09, 0x00, 0x15, 0x40, 0x0A, 0x02, 0x06, 0x06, 0x03,
-	0x09, 0x02, 0x72, 0x08, 0x08, 0x72, 0x00, 0x2B, 0x2B, 0xCE, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41,
-	0x11, 0x23, 0x11, 0x13, 0x15, 0x21, 0x11, 0x23, 0x11, 0x04, 0x24, 0xBA, 0xB7, 0xFD, 0x42, 0xC1,
-	0x07, 0x00, 0xFE, 0x18, 0x01, 0xE8, 0xFE, 0xB0, 0x9E, 0xFA, 0xEE, 0x05, 0xB0, 0x00, 0x00, 0x02,
-	0x00, 0x92, 0x00, 0x00, 0x03, 0x43, 0x05, 0x77, 0x00, 0x03, 0x00, 0x09, 0x00, 0x15, 0x40, 0x0A,
-	0x02, 0x06, 0x06, 0x03, 0x09, 0x06, 0x72, 0x08, 0x0A, 0x72, 0x00, 0x2B, 0x2B, 0xCE, 0x33, 0x11,
-	0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13, 0x15, 0x21, 0x11, 0x23, 0x11, 0x03, 0x43, 0xBA,
-	0xB6, 0xFE, 0x0C, 0xB9, 0x05, 0x77, 0xFE, 0x2A, 0x01, 0xD6, 0xFE, 0xC3, 0x99, 0xFC, 0x5F, 0x04,
-	0x3A, 0x00, 0x00, 0x02, 0x00, 0xB2, 0xFE, 0xDE, 0x04, 0x7C, 0x05, 0xB0, 0x00, 0x05, 0x00, 0x1D,
-	0x00, 0x19, 0x40, 0x0C, 0x06, 0x07, 0x07, 0x13, 0x12, 0x02, 0x05, 0x02, 0x72, 0x04, 0x08, 0x72,
-	0x00, 0x2B, 0x2B, 0x32, 0x2F, 0x33, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x11, 0x23,
-	0x11, 0x13, 0x35, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x27, 0x32, 0x3E, 0x02,
-	0x35, 0x2E, 0x03, 0x23, 0x04, 0x30, 0xFD, 0x42, 0xC0, 0x9F, 0xD6, 0x8D, 0xDD, 0x9B, 0x50, 0x3C,
-	0x77, 0xB1, 0x75, 0x02, 0x51, 0x6F, 0x44, 0x1E, 0x01, 0x34, 0x66, 0x9A, 0x67, 0x05, 0xB0, 0x9E,
-	0xFA, 0xEE, 0x05, 0xB0, 0xFC, 0xF0, 0xA1, 0x4E, 0x95, 0xD6, 0x88, 0x82, 0xCB, 0x8C, 0x49, 0x93,
-	0x39, 0x69, 0x93, 0x5A, 0x65, 0x9B, 0x6A, 0x36, 0x00, 0x02, 0x00, 0x92, 0xFE, 0xE4, 0x03, 0xBF,
-	0x04, 0x3A, 0x00, 0x14, 0x00, 0x1A, 0x00, 0x1B, 0x40, 0x0D, 0x00, 0x01, 0x01, 0x0B, 0x17, 0x1A,
-	0x06, 0x72, 0x19, 0x0A, 0x72, 0x0C, 0x0B, 0x00, 0x2F, 0x33, 0x2B, 0x2B, 0x32, 0x11, 0x39, 0x2F,
-	0x33, 0x30, 0x31, 0x53, 0x35, 0x21, 0x32, 0x16, 0x16, 0x15, 0x0E, 0x03, 0x07, 0x27, 0x3E, 0x02,
-	0x27, 0x34, 0x26, 0x26, 0x23, 0x01, 0x15, 0x21, 0x11, 0x23, 0x11, 0xB7, 0x01, 0x08, 0x94, 0xE7,
-	0x85, 0x01, 0x29, 0x5A, 0x92, 0x6B, 0x31, 0x5E, 0x6D, 0x2E, 0x01, 0x54, 0x92, 0x60, 0x01, 0x80,
-	0xFE, 0x0C, 0xB9, 0x01, 0xE4, 0xA2, 0x71, 0xD4, 0x97, 0x37, 0x8C, 0x88, 0x67, 0x14, 0x92, 0x18,
-	0x5B, 0x7B, 0x46, 0x66, 0x8C, 0x48, 0x02, 0x56, 0x99, 0xFC, 0x5F, 0x04, 0x3A, 0x00, 0xFF, 0xFF,
-	0x00, 0x1B, 0xFE, 0x99, 0x07, 0x82, 0x05, 0xB0, 0x04, 0x26, 0x00, 0xDA, 0x00, 0x00, 0x01, 0x07,
-	0x02, 0x6B, 0x06, 0x61, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x05, 0x1B, 0x0C, 0x00, 0x00, 0x9A, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x16, 0xFE, 0x99, 0x06, 0x3D, 0x04, 0x3A, 0x04, 0x26,
-	0x00, 0xEE, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6B, 0x05, 0x1C, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x05,
-	0x1B, 0x0C, 0x00, 0x00, 0x9A, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xB2, 0xFE, 0x96,
-	0x05, 0x44, 0x05, 0xB0, 0x04, 0x26, 0x02, 0x46, 0x00, 0x00, 0x00, 0x07, 0x02, 0x6B, 0x04, 0x23,
-	0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x9D, 0xFE, 0x99, 0x04, 0x81, 0x04, 0x3A, 0x04, 0x26, 0x00, 0xF1,
-	0x00, 0x00, 0x01, 0x07, 0x02, 0x6B, 0x03, 0x60, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x03, 0x11, 0x02,
-	0x01, 0x00, 0x9A, 0x56, 0x00, 0x2B, 0x34, 0x00, 0x00, 0x04, 0x00, 0xA4, 0x00, 0x00, 0x04, 0xFF,
-	0x05, 0xB0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x2F, 0x40, 0x17, 0x0F, 0x0E,
-	0x0E, 0x0B, 0x0C, 0x04, 0x04, 0x0C, 0x0C, 0x0B, 0x07, 0x07, 0x0B, 0x0B, 0x00, 0x10, 0x03, 0x08,
-	0x72, 0x08, 0x00, 0x02, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x12, 0x39, 0x2F, 0x33, 0x2F, 0x11,
-	0x33, 0x11, 0x33, 0x2F, 0x11, 0x12, 0x39, 0x11, 0x33, 0x30, 0x31, 0x53, 0x33, 0x11, 0x23, 0x01,
-	0x33, 0x11, 0x23, 0x01, 0x33, 0x01, 0x21, 0x27, 0x21, 0x07, 0x37, 0x01, 0x23, 0xA4, 0xC0, 0xC0,
-	0x01, 0x28, 0x95, 0x95, 0x02, 0x24, 0xE3, 0xFE, 0x2E, 0xFE, 0x16, 0x1D, 0x01, 0xB3, 0x09, 0x71,
-	0x01, 0xEA, 0xF1, 0x05, 0xB0, 0xFA, 0x50, 0x04, 0x30, 0xFD, 0x6B, 0x04, 0x15, 0xFC, 0xDF, 0xA0,
-	0x87, 0xA6, 0xFC, 0xB2, 0x00, 0x04, 0x00, 0x9B, 0x00, 0x00, 0x04, 0x80, 0x04, 0x3A, 0x00, 0x03,
-	0x00, 0x07, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x2D, 0x40, 0x16, 0x0F, 0x0E, 0x0E, 0x0B, 0x04, 0x04,
-	0x0C, 0x0C, 0x0B, 0x07, 0x07, 0x0B, 0x0B, 0x00, 0x10, 0x03, 0x0A, 0x72, 0x09, 0x00, 0x06, 0x72,
-	0x00, 0x2B, 0x32, 0x2B, 0x32, 0x12, 0x39, 0x2F, 0x33, 0x2F, 0x11, 0x33, 0x11, 0x33, 0x2F, 0x11,
-	0x33, 0x11, 0x33, 0x30, 0x31, 0x53, 0x33, 0x11, 0x23, 0x01, 0x33, 0x11, 0x23, 0x01, 0x33, 0x01,
-	0x21, 0x27, 0x21, 0x07, 0x37, 0x01, 0x23, 0x9B, 0xB9, 0xB9, 0x01, 0x1E, 0x95, 0x95, 0x01, 0xC2,
-	0xE0, 0xFE, 0x67, 0xFE, 0x54, 0x1C, 0x01, 0x7E, 0x0A, 0x77, 0x01, 0x9B, 0xEB, 0x04, 0x3A, 0xFB,
-	0xC6, 0x03, 0x45, 0xFD, 0xC6, 0x03, 0x2F, 0xFD, 0x94, 0xA2, 0x86, 0x86, 0xFD, 0x90, 0x00, 0x04,
-	0x00, 0x45, 0x00, 0x00, 0x06, 0x8B, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0D, 0x00, 0x11,
-	0x00, 0x23, 0x40, 0x11, 0x10, 0x0F, 0x0F, 0x0B, 0x0A, 0x0A, 0x03, 0x0E, 0x06, 0x08, 0x72, 0x0D,
-	0x07, 0x02, 0x03, 0x02, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x32, 0x2B, 0x32, 0x12, 0x39, 0x2F, 0x33,
-	0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21,
-	0x27, 0x21, 0x01, 0x13, 0x01, 0x37, 0x01, 0x02, 0x59, 0xFD, 0xEC, 0x02, 0x9B, 0xC0, 0x04, 0x42,
-	0xFD, 0x87, 0xFE, 0xAA, 0x1D, 0x01, 0x00, 0x01, 0xFC, 0x2D, 0xFD, 0xDD, 0x6C, 0x02, 0xA3, 0x05,
-	0xB0, 0x98, 0x98, 0xFA, 0x50, 0x05, 0xB0, 0xFC, 0xDF, 0xA0, 0x02, 0x81, 0xFA, 0x50, 0x02, 0xA8,
-	0xA9, 0xFC, 0xAF, 0x00, 0x00, 0x04, 0x00, 0x3F, 0x00, 0x00, 0x05, 0x7D, 0x04, 0x3A, 0x00, 0x03,
-	0x00, 0x07, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x23, 0x40, 0x11, 0x10, 0x0F, 0x0F, 0x0B, 0x0A, 0x0A,
-	0x03, 0x0E, 0x06, 0x0A, 0x72, 0x0D, 0x07, 0x02, 0x03, 0x06, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x32,
-	0x2B, 0x32, 0x12, 0x39, 0x2F, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x21,
-	0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x02, 0x3A, 0xFE,
-	0x05, 0x02, 0x55, 0xBA, 0x03, 0x7F, 0xFE, 0x00, 0xFE, 0xFC, 0x1C, 0xD4, 0x01, 0x6B, 0x1A, 0xFE,
-	0x73, 0x76, 0x02, 0x02, 0x04, 0x3A, 0x98, 0x98, 0xFB, 0xC6, 0x04, 0x3A, 0xFD, 0x94, 0xA2, 0x01,
-	0xCA, 0xFB, 0xC6, 0x01, 0xEA, 0x86, 0xFD, 0x90, 0xFF, 0xFF, 0x00, 0xA9, 0xFE, 0x99, 0x05, 0xA9,
-	0x05, 0xB0, 0x04, 0x26, 0x00, 0x2C, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6B, 0x04, 0x88, 0x00, 0x00,
-	0x00, 0x0B, 0xB6, 0x03, 0x0F, 0x0A, 0x00, 0x00, 0x9A, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x9D, 0xFE, 0x99, 0x04, 0xA2, 0x04, 0x3A, 0x04, 0x26, 0x00, 0xF4, 0x00, 0x00, 0x01, 0x07,
-	0x02, 0x6B, 0x03, 0x81, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x03, 0x0F, 0x0A, 0x00, 0x00, 0x9A, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0x00, 0x04, 0x00, 0xA9, 0x00, 0x00, 0x07, 0x84, 0x05, 0xB0, 0x00, 0x03,
-	0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x1F, 0x40, 0x0F, 0x07, 0x06, 0x06, 0x0A, 0x02, 0x03,
-	0x03, 0x0C, 0x0B, 0x02, 0x72, 0x0D, 0x0A, 0x08, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x32, 0x11,
-	0x33, 0x11, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x27, 0x03, 0x15, 0x21, 0x35, 0x13,
-	0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x07, 0x84, 0xFD, 0x76, 0x76, 0x25, 0xFC, 0xED, 0x1E,
-	0xC1, 0x04, 0x5F, 0xC1, 0x05, 0xB0, 0x98, 0x98, 0xFD, 0x8E, 0x9D, 0x9D, 0x02, 0x72, 0xFA, 0x50,
-	0x05, 0xB0, 0xFA, 0x50, 0x05, 0xB0, 0x00, 0x04, 0x00, 0x92, 0x00, 0x00, 0x05, 0x6A, 0x04, 0x3A,
-	0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x1F, 0x40, 0x0F, 0x07, 0x06, 0x06, 0x0A,
-	0x02, 0x03, 0x03, 0x0C, 0x0B, 0x06, 0x72, 0x0D, 0x0A, 0x0A, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32,
-	0x32, 0x11, 0x33, 0x11, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x03, 0x15, 0x21,
-	0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x05, 0x6A, 0xFE, 0x2E, 0x37, 0xFD, 0xC3,
-	0x27, 0xB9, 0x03, 0x64, 0xBA, 0x04, 0x3A, 0x99, 0x99, 0xFE, 0x2B, 0x96, 0x96, 0x01, 0xD5, 0xFB,
-	0xC6, 0x04, 0x3A, 0xFB, 0xC6, 0x04, 0x3A, 0x00, 0x00, 0x02, 0x00, 0xB0, 0xFE, 0xDE, 0x07, 0xCD,
-	0x05, 0xB0, 0x00, 0x07, 0x00, 0x1F, 0x00, 0x19, 0x40, 0x0C, 0x08, 0x09, 0x09, 0x14, 0x04, 0x07,
-	0x02, 0x72, 0x06, 0x08, 0x72, 0x02, 0x00, 0x2F, 0x2B, 0x2B, 0x32, 0x2F, 0x39, 0x2F, 0x33, 0x30,
-	0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x01, 0x35, 0x33, 0x32, 0x1E, 0x02, 0x15,
-	0x14, 0x0E, 0x02, 0x23, 0x27, 0x32, 0x3E, 0x02, 0x35, 0x2E, 0x03, 0x23, 0x04, 0xFF, 0xC0, 0xFD,
-	0x32, 0xC1, 0x03, 0xF2, 0xD6, 0x8D, 0xDD, 0x9B, 0x50, 0x3C, 0x77, 0xB1, 0x75, 0x02, 0x51, 0x6F,
-	0x44, 0x1E, 0x01, 0x34, 0x66, 0x9A, 0x67, 0x05, 0xB0, 0xFA, 0x50, 0x05, 0x12, 0xFA, 0xEE, 0x05,
-	0xB0, 0xFC, 0xF0, 0xA1, 0x4E, 0x95, 0xD6, 0x88, 0x82, 0xCB, 0x8C, 0x49, 0x93, 0x39, 0x69, 0x93,
-	0x5A, 0x65, 0x9B, 0x6A, 0x36, 0x00, 0x00, 0x04, 0x00, 0x92, 0xFE, 0xE4, 0x06, 0xB0, 0x04, 0x3A,
-	0x00, 0x14, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x20, 0x00, 0x23, 0x40, 0x11, 0x1E, 0x17, 0x18, 0x18,
-	0x00, 0x01, 0x01, 0x0B, 0x1D, 0x1C, 0x06, 0x72, 0x1B, 0x0A, 0x72, 0x0C, 0x0B, 0x00, 0x2F, 0x33,
-	0x2B, 0x2B, 0x32, 0x11, 0x39, 0x2F, 0x33, 0x32, 0x11, 0x33, 0x2F, 0x30, 0x31, 0x41, 0x35, 0x21,
-	0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x07, 0x27, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23,
-	0x01, 0x15, 0x21, 0x35, 0x33, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x03, 0x8D, 0x01, 0x11,
-	0x9A, 0xEF, 0x89, 0x29, 0x5A, 0x93, 0x6A, 0x31, 0x5E, 0x6C, 0x2E, 0x59, 0x9B, 0x65, 0xFE, 0xB5,
-	0xFD, 0xDD, 0x1B, 0xB9, 0x03, 0x65, 0xBA, 0x01, 0xE4, 0xA2, 0x71, 0xD4, 0x97, 0x37, 0x8C, 0x88,
-	0x67, 0x14, 0x92, 0x18, 0x5B, 0x7B, 0x46, 0x66, 0x8C, 0x48, 0x02, 0x56, 0x99, 0x99, 0xFB, 0xC6,
-	0x04, 0x3A, 0xFB, 0xC6, 0x04, 0x3A, 0x00, 0x01, 0x00, 0x71, 0xFF, 0xE4, 0x05, 0xA3, 0x05, 0xC5,
-	0x00, 0x43, 0x00, 0x1D, 0x40, 0x0E, 0x39, 0x0C, 0x0C, 0x23, 0x22, 0x03, 0x72, 0x00, 0x01, 0x01,
-	0x2E, 0x17, 0x09, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x30,
-	0x31, 0x65, 0x15, 0x22, 0x24, 0x26, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02,
-	0x15, 0x15, 0x14, 0x06, 0x06, 0x04, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33,
-	0x15, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x34,
-	0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x05, 0xA3, 0xBB, 0xFE, 0xCD,
-	0xDE, 0x77, 0x3B, 0x6C, 0x97, 0x5C, 0x5D, 0x97, 0x6E, 0x3B, 0x64, 0xB8, 0xFF, 0x00, 0x9D, 0x8C,
-	0xE5, 0xA4, 0x58, 0x42, 0x7A, 0xA9, 0x67, 0x3E, 0x62, 0x45, 0x24, 0x3B, 0x6F, 0x9D, 0x63, 0x78,
-	0xBB, 0x81, 0x44, 0x1E, 0x38, 0x52, 0x34, 0x33, 0x51, 0x38, 0x1E, 0x54, 0xA4, 0xF0, 0x85, 0xA1,
-	0x6A, 0xC2, 0x01, 0x0B, 0xA0, 0xE3, 0x75, 0xC7, 0x95, 0x53, 0x51, 0x94, 0xCA, 0x79, 0xF3, 0x95,
-	0xFF, 0xBE, 0x6A, 0x6A, 0xBE, 0xFD, 0x93, 0xAC, 0x86, 0xE5, 0xAB, 0x60, 0xA4, 0x46, 0x7E, 0xA9,
-	0x63, 0xAE, 0x72, 0xC2, 0x90, 0x51, 0x52, 0x92, 0xC3, 0x72, 0xF8, 0x56, 0x8C, 0x67, 0x37, 0x39,
-	0x68, 0x8B, 0x52, 0xE8, 0x7E, 0xD0, 0x95, 0x51, 0x00, 0x01, 0x00, 0x6E, 0xFF, 0xEB, 0x04, 0x9D,
-	0x04, 0x50, 0x00, 0x43, 0x00, 0x1D, 0x40, 0x0E, 0x39, 0x0C, 0x0C, 0x23, 0x22, 0x07, 0x72, 0x00,
-	0x01, 0x01, 0x2E, 0x17, 0x0B, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x2F, 0x33, 0x2B, 0x32, 0x32, 0x11,
-	0x33, 0x30, 0x31, 0x65, 0x15, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E,
-	0x02, 0x15, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33,
-	0x15, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x34,
-	0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x04, 0x9D, 0x9D, 0xFD, 0xB2,
-	0x5F, 0x2C, 0x52, 0x76, 0x49, 0x49, 0x76, 0x53, 0x2C, 0x4C, 0x8E, 0xC2, 0x77, 0x6E, 0xB5, 0x82,
-	0x47, 0x33, 0x5D, 0x81, 0x4F, 0x26, 0x3D, 0x2C, 0x18, 0x2A, 0x50, 0x71, 0x48, 0x50, 0x80, 0x5A,
-	0x2F, 0x11, 0x22, 0x31, 0x20, 0x20, 0x32, 0x21, 0x11, 0x43, 0x80, 0xB9, 0x91, 0x9D, 0x59, 0x9F,
-	0xD5, 0x7C, 0x67, 0x5E, 0x9C, 0x73, 0x3F, 0x44, 0x7A, 0xA4, 0x5F, 0x69, 0x79, 0xD0, 0x9C, 0x56,
-	0x5A, 0xA1, 0xD7, 0x7D, 0x39, 0x66, 0xAD, 0x80, 0x48, 0x9D, 0x2F, 0x55, 0x74, 0x44, 0x3B, 0x5C,
-	0x9E, 0x76, 0x41, 0x3F, 0x70, 0x96, 0x58, 0x6C, 0x3C, 0x69, 0x4F, 0x2D, 0x27, 0x48, 0x63, 0x3B,
-	0x6B, 0x5E, 0x9D, 0x71, 0x3E, 0x00, 0xFF, 0xFF, 0x00, 0x3A, 0xFE, 0x99, 0x04, 0xF8, 0x05, 0xB0,
-	0x04, 0x26, 0x00, 0x3C, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6B, 0x03, 0xD7, 0x00, 0x00, 0x00, 0x0B,
-	0xB6, 0x01, 0x0F, 0x06, 0x00, 0x00, 0x9A, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x2A,
-	0xFE, 0x99, 0x04, 0x06, 0x04, 0x3A, 0x04, 0x26, 0x00, 0x5C, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6B,
-	0x02, 0xE5, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x01, 0x0F, 0x06, 0x00, 0x00, 0x9A, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0x00, 0x03, 0x00, 0x34, 0xFE, 0xA1, 0x06, 0x94, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x09,
-	0x00, 0x11, 0x00, 0x1D, 0x40, 0x0E, 0x09, 0x0D, 0x0D, 0x08, 0x0A, 0x08, 0x72, 0x05, 0x10, 0x0C,
-	0x02, 0x03, 0x02, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x32, 0x2F, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x30,
-	0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x03, 0x23, 0x11, 0x23, 0x35, 0x05, 0x11, 0x33, 0x11, 0x21,
-	0x11, 0x33, 0x11, 0x03, 0xED, 0xFC, 0x47, 0x06, 0x60, 0x12, 0xAD, 0x8F, 0xFC, 0x65, 0xC2, 0x02,
-	0xCE, 0xC0, 0x05, 0xB0, 0x98, 0x98, 0xFA, 0xF2, 0xFD, 0xFF, 0x01, 0x5F, 0xA2, 0xA2, 0x05, 0xB0,
-	0xFA, 0xED, 0x05, 0x13, 0xFA, 0x50, 0x00, 0x03, 0x00, 0x1F, 0xFE, 0xBF, 0x05, 0x17, 0x04, 0x3B,
-	0x00, 0x03, 0x00, 0x0B, 0x00, 0x11, 0x00, 0x1F, 0x40, 0x0F, 0x02, 0x03, 0x03, 0x0D, 0x0A, 0x05,
-	0x06, 0x72, 0x08, 0x07, 0x07, 0x10, 0x04, 0x0A, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x2B,
-	0x32, 0x2F, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x11, 0x33, 0x11, 0x21,
-	0x11, 0x33, 0x11, 0x37, 0x03, 0x23, 0x11, 0x23, 0x35, 0x02, 0xE3, 0xFD, 0x3C, 0x01, 0x12, 0xBA,
-	0x01, 0xF2, 0xB9, 0x81, 0x12, 0xA6, 0x8D, 0x04, 0x3B, 0x98, 0x98, 0xFB, 0xC5, 0x04, 0x3A, 0xFC,
-	0x5E, 0x03, 0xA2, 0xFB, 0xC6, 0x98, 0xFE, 0x27, 0x01, 0x41, 0x98, 0x00, 0xFF, 0xFF, 0x00, 0x97,
-	0xFE, 0x99, 0x05, 0x67, 0x05, 0xB0, 0x04, 0x26, 0x00, 0xE1, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6B,
-	0x04, 0x46, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x1D, 0x19, 0x00, 0x00, 0x9A, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x68, 0xFE, 0x99, 0x04, 0x5F, 0x04, 0x3C, 0x04, 0x26, 0x00, 0xF9,
-	0x00, 0x00, 0x01, 0x07, 0x02, 0x6B, 0x03, 0x3E, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x1B, 0x02,
-	0x00, 0x00, 0x9A, 0x56, 0x00, 0x2B, 0x34, 0x00, 0x00, 0x03, 0x00, 0x97, 0x00, 0x00, 0x04, 0xC9,
-	0x05, 0xB0, 0x00, 0x03, 0x00, 0x19, 0x00, 0x1D, 0x00, 0x23, 0x40, 0x11, 0x03, 0x03, 0x0A, 0x0A,
-	0x15, 0x02, 0x02, 0x15, 0x15, 0x04, 0x1C, 0x08, 0x72, 0x1B, 0x04, 0x02, 0x72, 0x00, 0x2B, 0x32,
-	0x2B, 0x11, 0x39, 0x2F, 0x33, 0x2F, 0x11, 0x33, 0x11, 0x33, 0x2F, 0x30, 0x31, 0x41, 0x11, 0x23,
-	0x11, 0x01, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3E, 0x02, 0x37, 0x15, 0x0E, 0x03, 0x23,
-	0x22, 0x26, 0x26, 0x35, 0x01, 0x33, 0x11, 0x23, 0x03, 0x17, 0x95, 0xFE, 0x15, 0xC1, 0x42, 0x86,
-	0x64, 0x3C, 0x71, 0x6C, 0x69, 0x33, 0x31, 0x61, 0x67, 0x75, 0x47, 0x9A, 0xDD, 0x76, 0x03, 0x71,
-	0xC1, 0xC1, 0x03, 0xFB, 0xFD, 0x43, 0x02, 0xBD, 0x01, 0xB5, 0xFE, 0x39, 0x71, 0x80, 0x34, 0x0A,
-	0x12, 0x1A, 0x0F, 0x9E, 0x0F, 0x1A, 0x12, 0x0A, 0x59, 0xC6, 0xA4, 0x01, 0xC7, 0xFA, 0x50, 0x00,
-	0x00, 0x03, 0x00, 0x84, 0x00, 0x00, 0x03, 0xD9, 0x04, 0x3C, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1B,
-	0x00, 0x23, 0x40, 0x10, 0x00, 0x00, 0x18, 0x18, 0x0D, 0x01, 0x01, 0x0D, 0x0D, 0x05, 0x0A, 0x72,
-	0x12, 0x04, 0x06, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x2F, 0x33, 0x7D, 0x2F, 0x11, 0x33, 0x11,
-	0x33, 0x18, 0x2F, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x11, 0x23, 0x11, 0x13, 0x15, 0x0E,
-	0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-	0x02, 0x86, 0x95, 0x01, 0xE8, 0xB9, 0x7A, 0x38, 0x73, 0x7F, 0x4A, 0x80, 0xBC, 0x66, 0xB9, 0x36,
-	0x68, 0x4B, 0x48, 0x7F, 0x75, 0x03, 0x1B, 0xFD, 0xCA, 0x02, 0x36, 0x01, 0x1F, 0xFB, 0xC6, 0x04,
-	0x3A, 0xFE, 0x0F, 0x98, 0x15, 0x21, 0x13, 0x59, 0xB5, 0x8A, 0x01, 0x3C, 0xFE, 0xC4, 0x5A, 0x70,
-	0x35, 0x13, 0x20, 0x00, 0x00, 0x02, 0x00, 0x89, 0x00, 0x00, 0x04, 0xBB, 0x05, 0xB0, 0x00, 0x15,
-	0x00, 0x19, 0x00, 0x19, 0x40, 0x0C, 0x01, 0x17, 0x06, 0x11, 0x11, 0x17, 0x18, 0x02, 0x72, 0x17,
-	0x08, 0x72, 0x00, 0x2B, 0x2B, 0x11, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x30, 0x31, 0x61, 0x23, 0x11,
-	0x34, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x07, 0x35, 0x3E, 0x03, 0x33, 0x32, 0x16, 0x16, 0x15,
-	0x01, 0x23, 0x11, 0x33, 0x04, 0xBB, 0xC1, 0x42, 0x85, 0x65, 0x3C, 0x71, 0x6C, 0x69, 0x33, 0x31,
-	0x61, 0x67, 0x76, 0x46, 0x9B, 0xDC, 0x76, 0xFC, 0x8F, 0xC1, 0xC1, 0x01, 0xC7, 0x72, 0x7F, 0x34,
-	0x0A, 0x12, 0x1A, 0x0F, 0x9E, 0x0F, 0x1A, 0x12, 0x0A, 0x59, 0xC6, 0xA4, 0xFE, 0x39, 0x05, 0xB0,
-	0x00, 0x02, 0x00, 0x3F, 0xFF, 0xE9, 0x05, 0xBE, 0x05, 0xC4, 0x00, 0x09, 0x00, 0x36, 0x00, 0x25,
-	0x40, 0x12, 0x05, 0x1D, 0x01, 0x01, 0x1D, 0x1D, 0x06, 0x1C, 0x1C, 0x0A, 0x24, 0x15, 0x03, 0x72,
-	0x2F, 0x0A, 0x09, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x11, 0x39, 0x2F, 0x33, 0x33, 0x11, 0x33,
-	0x2F, 0x11, 0x33, 0x30, 0x31, 0x53, 0x33, 0x14, 0x16, 0x16, 0x33, 0x15, 0x22, 0x26, 0x26, 0x01,
-	0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x17, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x21, 0x35,
-	0x21, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32,
-	0x36, 0x37, 0x17, 0x0E, 0x02, 0x3F, 0x98, 0x34, 0x6E, 0x56, 0x83, 0xB3, 0x5A, 0x03, 0xAA, 0x95,
-	0xE6, 0x9E, 0x51, 0x54, 0x95, 0xC5, 0x72, 0x86, 0xCB, 0x89, 0x45, 0xFC, 0x36, 0x03, 0x09, 0x25,
-	0x52, 0x86, 0x61, 0x54, 0x83, 0x5A, 0x2F, 0x30, 0x67, 0xA1, 0x72, 0x7C, 0xA6, 0x37, 0x2F, 0x17,
-	0x64, 0x9E, 0x04, 0x39, 0x48, 0x6D, 0x3E, 0x8C, 0x5E, 0xAD, 0xFC, 0x24, 0x5C, 0xA8, 0xE5, 0x89,
-	0xF9, 0x89, 0xE5, 0xA7, 0x5B, 0x01, 0x5D, 0xAE, 0xF6, 0x98, 0x71, 0x8B, 0x21, 0x5D, 0xA2, 0x7A,
-	0x45, 0x48, 0x80, 0xA7, 0x60, 0xF9, 0x61, 0xA9, 0x80, 0x49, 0x38, 0x1C, 0x8F, 0x10, 0x2F, 0x25,
-	0x00, 0x02, 0xFF, 0xDD, 0xFF, 0xEC, 0x04, 0x64, 0x04, 0x4E, 0x00, 0x08, 0x00, 0x35, 0x00, 0x25,
-	0x40, 0x12, 0x04, 0x1C, 0x01, 0x01, 0x1C, 0x1C, 0x05, 0x1B, 0x1B, 0x09, 0x23, 0x14, 0x07, 0x72,
-	0x2E, 0x09, 0x0B, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x12, 0x39, 0x2F, 0x33, 0x33, 0x11, 0x33,
-	0x2F, 0x11, 0x33, 0x30, 0x31, 0x43, 0x33, 0x14, 0x16, 0x33, 0x15, 0x22, 0x26, 0x26, 0x01, 0x22,
-	0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x21, 0x35, 0x21,
-	0x35, 0x2E, 0x03, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x37,
-	0x17, 0x0E, 0x02, 0x23, 0x95, 0x63, 0x6D, 0x75, 0x9F, 0x51, 0x02, 0xE1, 0x71, 0xB7, 0x83, 0x46,
-	0x4E, 0x86, 0xAA, 0x5B, 0x75, 0xA8, 0x6D, 0x34, 0xFC, 0xD7, 0x02, 0x6F, 0x03, 0x1E, 0x3B, 0x61,
-	0x47, 0x3F, 0x6A, 0x4C, 0x2A, 0x2B, 0x53, 0x77, 0x4C, 0x62, 0x88, 0x33, 0x71, 0x23, 0x6D, 0x9D,
-	0x03, 0x59, 0x61, 0x77, 0x87, 0x55, 0x9E, 0xFC, 0xFF, 0x4D, 0x8C, 0xC0, 0x72, 0x2A, 0x84, 0xCF,
-	0x90, 0x4A, 0x50, 0x8F, 0xC1, 0x72, 0x53, 0x97, 0x0E, 0x36, 0x69, 0x56, 0x33, 0x35, 0x68, 0x96,
-	0x62, 0x2A, 0x4D, 0x87, 0x66, 0x3A, 0x50, 0x43, 0x59, 0x35, 0x60, 0x3C, 0x00, 0x03, 0x00, 0xA4,
-	0xFE, 0xD6, 0x04, 0xCD, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x09, 0x00, 0x21, 0x00, 0x21, 0x40, 0x10,
-	0x0A, 0x06, 0x06, 0x0B, 0x08, 0x07, 0x07, 0x17, 0x16, 0x09, 0x03, 0x02, 0x72, 0x02, 0x08, 0x72,
-	0x00, 0x2B, 0x2B, 0x32, 0x2F, 0x33, 0x39, 0x2F, 0x33, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41,
-	0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x33, 0x01, 0x01, 0x35, 0x33, 0x32, 0x1E, 0x02, 0x15,
-	0x14, 0x0E, 0x02, 0x23, 0x27, 0x32, 0x3E, 0x02, 0x35, 0x2E, 0x03, 0x23, 0x01, 0x64, 0xC0, 0x04,
-	0x29, 0xFD, 0x70, 0xFE, 0xDA, 0x1D, 0xF0, 0x02, 0x01, 0xFD, 0xAD, 0xDC, 0x8C, 0xDE, 0x9A, 0x51,
-	0x3C, 0x78, 0xB3, 0x77, 0x02, 0x51, 0x6E, 0x44, 0x1D, 0x01, 0x33, 0x66, 0x97, 0x64, 0x05, 0xB0,
-	0xFA, 0x50, 0x05, 0xB0, 0xFC, 0xE5, 0xAA, 0x02, 0x71, 0xFC, 0xE5, 0xA7, 0x4D, 0x95, 0xD7, 0x89,
-	0x7F, 0xCB, 0x8F, 0x4B, 0x98, 0x3A, 0x69, 0x91, 0x57, 0x65, 0x99, 0x69, 0x35, 0x00, 0x00, 0x03,
-	0x00, 0x9B, 0xFE, 0xFD, 0x04, 0x1A, 0x04, 0x3A, 0x00, 0x03, 0x00, 0x09, 0x00, 0x1E, 0x00, 0x21,
-	0x40, 0x10, 0x16, 0x15, 0x09, 0x06, 0x72, 0x06, 0x0A, 0x0A, 0x07, 0x0B, 0x0B, 0x01, 0x03, 0x06,
-	0x72, 0x01, 0x00, 0x2F, 0x2B, 0x12, 0x39, 0x2F, 0x33, 0x33, 0x11, 0x33, 0x2B, 0x2F, 0x33, 0x30,
-	0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x23, 0x27, 0x33, 0x01, 0x01, 0x35, 0x21, 0x32, 0x16,
-	0x16, 0x15, 0x0E, 0x03, 0x07, 0x27, 0x3E, 0x02, 0x27, 0x34, 0x26, 0x26, 0x23, 0x01, 0x54, 0xB9,
-	0x03, 0x7F, 0xFD, 0xE2, 0xE6, 0x1C, 0xB6, 0x01, 0x89, 0xFD, 0xB2, 0x01, 0x15, 0x99, 0xEF, 0x89,
-	0x01, 0x29, 0x59, 0x93, 0x6A, 0x31, 0x5E, 0x6C, 0x2F, 0x01, 0x59, 0x9A, 0x65, 0x04, 0x3A, 0xFB,
-	0xC6, 0x04, 0x3A, 0xFD, 0x94, 0xA2, 0x01, 0xCA, 0xFD, 0x94, 0xA1, 0x62, 0xC7, 0x96, 0x35, 0x86,
-	0x82, 0x63, 0x13, 0x92, 0x17, 0x55, 0x72, 0x43, 0x66, 0x7E, 0x3A, 0x00, 0xFF, 0xFF, 0x00, 0x30,
-	0xFE, 0x99, 0x05, 0xA9, 0x05, 0xB0, 0x04, 0x26, 0x00, 0xDD, 0x00, 0x00, 0x01, 0x07, 0x00, 0x10,
-	0x04, 0x74, 0xFF, 0xBC, 0x00, 0x0B, 0xB6, 0x03, 0x24, 0x06, 0x00, 0x00, 0x98, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x2C, 0xFE, 0x99, 0x04, 0xB8, 0x04, 0x3A, 0x04, 0x26, 0x00, 0xF2,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x10, 0x03, 0x83, 0xFF, 0xBC, 0x00, 0x0B, 0xB6, 0x03, 0x24, 0x06,
-	0x01, 0x00, 0x98, 0x56, 0x00, 0x2B, 0x34, 0x00, 0x00, 0x01, 0x00, 0xB2, 0xFE, 0x4B, 0x04, 0xFF,
-	0x05, 0xB0, 0x00, 0x19, 0x00, 0x19, 0x40, 0x0C, 0x19, 0x08, 0x72, 0x17, 0x02, 0x02, 0x11, 0x0A,
-	0x05, 0x00, 0x02, 0x72, 0x00, 0x2B, 0x32, 0x2F, 0x33, 0x39, 0x2F, 0x33, 0x2B, 0x30, 0x31, 0x53,
-	0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16,
-	0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x21, 0x11, 0x23, 0xB2, 0xC1, 0x02, 0xCB, 0xC1, 0x4F, 0x92,
-	0x66, 0x1F, 0x35, 0x1E, 0x0E, 0x10, 0x43, 0x0F, 0x2B, 0x3D, 0x20, 0xFD, 0x35, 0xC1, 0x05, 0xB0,
-	0xFD, 0x6F, 0x02, 0x91, 0xF9, 0xFC, 0x72, 0x9D, 0x52, 0x07, 0x0A, 0x9A, 0x06, 0x07, 0x2F, 0x57,
-	0x3D, 0x02, 0xD6, 0xFD, 0x7E, 0x00, 0x00, 0x01, 0x00, 0x92, 0xFE, 0x4B, 0x03, 0xF6, 0x04, 0x3A,
-	0x00, 0x19, 0x00, 0x1D, 0x40, 0x0F, 0x19, 0x0A, 0x72, 0x17, 0x02, 0x02, 0x00, 0x11, 0x0A, 0x0F,
-	0x72, 0x05, 0x00, 0x06, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x12, 0x39, 0x2F, 0x33, 0x2B, 0x30,
-	0x31, 0x53, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37,
-	0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x21, 0x11, 0x23, 0x92, 0xB9, 0x01, 0xF1, 0xBA,
-	0x4D, 0x91, 0x65, 0x1E, 0x35, 0x1D, 0x0F, 0x0F, 0x45, 0x0D, 0x2C, 0x3D, 0x20, 0xFE, 0x0F, 0xB9,
-	0x04, 0x3A, 0xFE, 0x2B, 0x01, 0xD5, 0xFB, 0x6D, 0x70, 0x9C, 0x50, 0x07, 0x0A, 0x94, 0x06, 0x07,
-	0x2F, 0x58, 0x3D, 0x02, 0x28, 0xFE, 0x31, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0xFE, 0x99, 0x05, 0xBD,
-	0x05, 0xB0, 0x04, 0x26, 0x00, 0x2C, 0x00, 0x00, 0x01, 0x07, 0x00, 0x10, 0x04, 0x88, 0xFF, 0xBC,
-	0x00, 0x0B, 0xB6, 0x03, 0x16, 0x0A, 0x01, 0x00, 0x98, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x9D, 0xFE, 0x99, 0x04, 0xB6, 0x04, 0x3A, 0x04, 0x26, 0x00, 0xF4, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x10, 0x03, 0x81, 0xFF, 0xBC, 0x00, 0x0B, 0xB6, 0x03, 0x16, 0x0A, 0x01, 0x00, 0x98, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0xFE, 0x99, 0x06, 0xFA, 0x05, 0xB0, 0x04, 0x26,
-	0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0x10, 0x05, 0xC5, 0xFF, 0xBC, 0x00, 0x0B, 0xB6, 0x03,
-	0x1B, 0x0F, 0x00, 0x00, 0x98, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x9E, 0xFE, 0x99,
-	0x06, 0x08, 0x04, 0x3A, 0x04, 0x26, 0x00, 0xF3, 0x00, 0x00, 0x01, 0x07, 0x00, 0x10, 0x04, 0xD3,
-	0xFF, 0xBC, 0x00, 0x0B, 0xB6, 0x03, 0x19, 0x0B, 0x01, 0x00, 0x98, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0x00, 0x01, 0x00, 0x5E, 0xFF, 0xEB, 0x05, 0x12, 0x05, 0xC4, 0x00, 0x2C, 0x00, 0x1B, 0x40, 0x0D,
-	0x1A, 0x0B, 0x11, 0x14, 0x14, 0x0B, 0x25, 0x00, 0x03, 0x72, 0x0B, 0x09, 0x72, 0x00, 0x2B, 0x2B,
-	0x32, 0x11, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x32, 0x16, 0x16, 0x12, 0x15, 0x15,
-	0x14, 0x02, 0x06, 0x06, 0x27, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x21, 0x15, 0x21, 0x15, 0x14, 0x1E,
-	0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x07, 0x27, 0x3E,
-	0x02, 0x02, 0x81, 0x9F, 0xF5, 0xA7, 0x56, 0x5D, 0xA5, 0xDA, 0x7D, 0x94, 0xE2, 0x98, 0x4D, 0x04,
-	0x3E, 0xFC, 0x83, 0x2B, 0x60, 0x9D, 0x72, 0x62, 0x98, 0x69, 0x36, 0x35, 0x70, 0xB0, 0x7C, 0x82,
-	0xB0, 0x3B, 0x2F, 0x18, 0x6A, 0xA7, 0x05, 0xC4, 0x67, 0xBB, 0xFE, 0xFF, 0x9B, 0x5E, 0x9B, 0xFE,
-	0xFE, 0xBA, 0x66, 0x01, 0x5C, 0xAE, 0xF5, 0x98, 0x7C, 0x95, 0x22, 0x5D, 0xA2, 0x79, 0x45, 0x54,
-	0x95, 0xC4, 0x70, 0x5E, 0x71, 0xC4, 0x95, 0x54, 0x38, 0x1C, 0x8F, 0x10, 0x30, 0x25, 0x00, 0x02,
-	0x00, 0x68, 0xFF, 0xEB, 0x04, 0x2C, 0x05, 0xB0, 0x00, 0x07, 0x00, 0x25, 0x00, 0x1F, 0x40, 0x0F,
-	0x05, 0x08, 0x08, 0x04, 0x25, 0x25, 0x00, 0x1C, 0x12, 0x09, 0x72, 0x07, 0x00, 0x02, 0x72, 0x00,
-	0x2B, 0x32, 0x2B, 0x32, 0x11, 0x39, 0x11, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x53, 0x21, 0x17,
-	0x01, 0x23, 0x35, 0x01, 0x21, 0x01, 0x37, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22,
-	0x2E, 0x02, 0x35, 0x33, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
-	0x23, 0x94, 0x03, 0x6B, 0x01, 0xFE, 0x0B, 0x71, 0x01, 0x83, 0xFD, 0x77, 0x01, 0x06, 0x96, 0xA1,
-	0xE3, 0x78, 0x49, 0x84, 0xB4, 0x6B, 0x57, 0xA7, 0x89, 0x51, 0xC1, 0x46, 0x7D, 0x54, 0x5F, 0x86,
-	0x47, 0x4A, 0x91, 0x69, 0x8E, 0x05, 0xB0, 0x7C, 0xFD, 0xAC, 0x74, 0x01, 0xBE, 0xFE, 0x41, 0x01,
-	0x68, 0xC7, 0x8F, 0x66, 0x9F, 0x6D, 0x39, 0x31, 0x67, 0xA1, 0x70, 0x49, 0x7A, 0x49, 0x45, 0x79,
-	0x4C, 0x69, 0x85, 0x3E, 0x00, 0x02, 0x00, 0x6A, 0xFE, 0x75, 0x04, 0x29, 0x04, 0x3A, 0x00, 0x07,
-	0x00, 0x25, 0x00, 0x1F, 0x40, 0x0E, 0x08, 0x05, 0x05, 0x04, 0x25, 0x25, 0x00, 0x1C, 0x18, 0x12,
-	0x07, 0x00, 0x06, 0x72, 0x00, 0x2B, 0x32, 0x2F, 0xCC, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x33, 0x11,
-	0x33, 0x30, 0x31, 0x53, 0x21, 0x17, 0x01, 0x23, 0x35, 0x01, 0x21, 0x01, 0x33, 0x32, 0x16, 0x16,
-	0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x33, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36,
-	0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x94, 0x03, 0x65, 0x02, 0xFE, 0x1A, 0x7C, 0x01, 0x73,
-	0xFD, 0x88, 0x01, 0x05, 0x91, 0xA1, 0xE5, 0x79, 0x49, 0x83, 0xB3, 0x6B, 0x56, 0xA7, 0x87, 0x51,
-	0xB9, 0x47, 0x80, 0x55, 0x61, 0x87, 0x48, 0x4C, 0x93, 0x6A, 0x8D, 0x04, 0x3A, 0x76, 0xFD, 0xA5,
-	0x74, 0x01, 0xC4, 0xFE, 0x37, 0x66, 0xC5, 0x8E, 0x66, 0x9E, 0x6D, 0x39, 0x31, 0x67, 0xA1, 0x6F,
-	0x4A, 0x7C, 0x4A, 0x46, 0x7A, 0x4E, 0x6A, 0x84, 0x3D, 0x00, 0xFF, 0xFF, 0x00, 0x39, 0xFE, 0x4B,
-	0x04, 0x74, 0x05, 0xB0, 0x04, 0x26, 0x00, 0xB1, 0x44, 0x00, 0x00, 0x26, 0x02, 0x40, 0xAA, 0x40,
-	0x00, 0x07, 0x02, 0x6E, 0x00, 0xF1, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x3A, 0xFE, 0x4B, 0x03, 0x97,
-	0x04, 0x3A, 0x04, 0x26, 0x00, 0xEC, 0x4F, 0x00, 0x00, 0x26, 0x02, 0x40, 0xAB, 0x8D, 0x00, 0x07,
-	0x02, 0x6E, 0x00, 0xE1, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x3A, 0xFE, 0x4B, 0x05, 0x0F, 0x05, 0xB0,
-	0x04, 0x26, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x07, 0x02, 0x6E, 0x03, 0xA7, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x2A, 0xFE, 0x4B, 0x04, 0x1D, 0x04, 0x3A, 0x04, 0x26, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x07,
-	0x02, 0x6E, 0x02, 0xB5, 0x00, 0x00, 0x00, 0x01, 0x00, 0x57, 0x00, 0x00, 0x04, 0x65, 0x05, 0xB0,
-	0x00, 0x18, 0x00, 0x12, 0xB7, 0x03, 0x00, 0x00, 0x0B, 0x10, 0x0D, 0x02, 0x72, 0x00, 0x2B, 0x2F,
-	0x33, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x21, 0x15, 0x21, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16,
-	0x16, 0x33, 0x21, 0x11, 0x33, 0x11, 0x21, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x02, 0x45,
-	0x01, 0x8C, 0xFE, 0x74, 0x6B, 0x85, 0x3D, 0x3D, 0x85, 0x6B, 0x01, 0x5F, 0xC1, 0xFD, 0xE0, 0x9F,
-	0xDD, 0x72, 0x40, 0x7E, 0xB8, 0x03, 0x73, 0x9E, 0x4E, 0x7F, 0x49, 0x49, 0x85, 0x54, 0x05, 0x13,
-	0xFA, 0x50, 0x74, 0xC9, 0x80, 0x61, 0xA0, 0x75, 0x40, 0x00, 0x00, 0x02, 0x00, 0x5A, 0x00, 0x00,
-	0x06, 0x67, 0x05, 0xB0, 0x00, 0x18, 0x00, 0x2D, 0x00, 0x1F, 0x40, 0x0E, 0x1B, 0x0B, 0x0B, 0x10,
-	0x25, 0x25, 0x03, 0x00, 0x00, 0x1A, 0x10, 0x0D, 0x02, 0x72, 0x00, 0x2B, 0x2F, 0x33, 0x39, 0x2F,
-	0x33, 0x33, 0x2F, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x21, 0x15, 0x21, 0x22, 0x06, 0x06,
-	0x15, 0x14, 0x16, 0x16, 0x33, 0x21, 0x11, 0x33, 0x11, 0x21, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E,
-	0x02, 0x01, 0x23, 0x35, 0x37, 0x3E, 0x02, 0x37, 0x36, 0x2E, 0x02, 0x27, 0x33, 0x1E, 0x02, 0x07,
-	0x0E, 0x02, 0x02, 0x48, 0x01, 0x8D, 0xFE, 0x73, 0x6B, 0x84, 0x3D, 0x3D, 0x84, 0x6B, 0x01, 0x60,
-	0xC0, 0xFD, 0xE0, 0xA0, 0xDC, 0x72, 0x40, 0x7E, 0xB8, 0x02, 0xF1, 0x8D, 0x8D, 0x4A, 0x63, 0x34,
-	0x02, 0x01, 0x08, 0x0F, 0x17, 0x0F, 0xBA, 0x12, 0x1F, 0x14, 0x02, 0x02, 0x75, 0xBD, 0x03, 0x73,
-	0x9E, 0x4E, 0x7F, 0x49, 0x49, 0x85, 0x54, 0x05, 0x13, 0xFA, 0x50, 0x74, 0xC9, 0x80, 0x61, 0xA0,
-	0x75, 0x40, 0xFC, 0x8D, 0x9C, 0x01, 0x01, 0x43, 0x79, 0x51, 0x27, 0x53, 0x56, 0x53, 0x27, 0x34,
-	0x6F, 0x71, 0x36, 0x8E, 0xBE, 0x5F, 0x00, 0x03, 0x00, 0x64, 0xFF, 0xE9, 0x06, 0x6F, 0x06, 0x18,
-	0x00, 0x16, 0x00, 0x2B, 0x00, 0x47, 0x00, 0x1D, 0x40, 0x10, 0x33, 0x44, 0x0B, 0x72, 0x3B, 0x2D,
-	0x01, 0x72, 0x1D, 0x12, 0x0B, 0x72, 0x27, 0x06, 0x07, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x2B,
-	0x2F, 0x2B, 0x32, 0x30, 0x31, 0x53, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x03, 0x17, 0x15,
-	0x0E, 0x03, 0x23, 0x22, 0x2E, 0x02, 0x37, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37,
-	0x35, 0x2E, 0x03, 0x23, 0x22, 0x0E, 0x02, 0x01, 0x11, 0x33, 0x11, 0x06, 0x16, 0x16, 0x33, 0x3E,
-	0x03, 0x37, 0x36, 0x26, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0E, 0x03, 0x23, 0x06, 0x26, 0x26, 0x64,
-	0x38, 0x6B, 0x9E, 0x66, 0x4E, 0x7D, 0x60, 0x44, 0x2A, 0x09, 0x0B, 0x3C, 0x66, 0x94, 0x63, 0x64,
-	0x9D, 0x6C, 0x38, 0xBA, 0x20, 0x43, 0x6B, 0x4B, 0x5C, 0x77, 0x48, 0x14, 0x0C, 0x2D, 0x47, 0x67,
-	0x46, 0x4C, 0x6B, 0x44, 0x20, 0x02, 0x0D, 0xBA, 0x01, 0x2A, 0x4D, 0x35, 0x46, 0x6B, 0x4A, 0x27,
-	0x01, 0x02, 0x21, 0x1E, 0xB4, 0x1B, 0x2A, 0x02, 0x02, 0x4D, 0x85, 0xAA, 0x5F, 0x6B, 0x9C, 0x58,
-	0x01, 0xF5, 0x15, 0x80, 0xD4, 0x9B, 0x55, 0x2E, 0x58, 0x7E, 0xA0, 0x60, 0x5C, 0x77, 0xBE, 0x87,
-	0x47, 0x4D, 0x8C, 0xBF, 0x87, 0x15, 0x4D, 0x85, 0x63, 0x38, 0x4F, 0x80, 0x4B, 0xF1, 0x37, 0x67,
-	0x51, 0x30, 0x42, 0x76, 0x99, 0xFE, 0xF8, 0x04, 0xBF, 0xFB, 0x41, 0x40, 0x60, 0x36, 0x01, 0x38,
-	0x68, 0x92, 0x5B, 0x64, 0xCB, 0x64, 0x61, 0xCB, 0x67, 0x8B, 0xCF, 0x88, 0x44, 0x02, 0x4A, 0xA3,
-	0x00, 0x02, 0x00, 0x36, 0xFF, 0xE9, 0x05, 0xD4, 0x05, 0xB0, 0x00, 0x20, 0x00, 0x46, 0x00, 0x21,
-	0x40, 0x10, 0x28, 0x27, 0x27, 0x02, 0x01, 0x01, 0x0E, 0x32, 0x43, 0x09, 0x72, 0x3A, 0x0D, 0x0E,
-	0x02, 0x72, 0x00, 0x2B, 0x32, 0x2F, 0x2B, 0x32, 0x11, 0x39, 0x2F, 0x33, 0x33, 0x11, 0x33, 0x30,
-	0x31, 0x41, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x21, 0x35, 0x21,
-	0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x03, 0x07, 0x22, 0x06, 0x06, 0x07, 0x06, 0x06, 0x13, 0x35,
-	0x35, 0x34, 0x26, 0x26, 0x23, 0x37, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14, 0x16, 0x16, 0x33, 0x3E,
-	0x03, 0x37, 0x36, 0x26, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0E, 0x03, 0x23, 0x06, 0x26, 0x26, 0x01,
-	0xC2, 0xC3, 0x90, 0x72, 0x8B, 0x40, 0x22, 0x49, 0x73, 0x51, 0xFE, 0x99, 0x01, 0x67, 0x78, 0xB9,
-	0x7D, 0x41, 0x1E, 0x3A, 0x55, 0x70, 0x45, 0x03, 0x07, 0x07, 0x03, 0x28, 0x18, 0xE9, 0x3D, 0x71,
-	0x4F, 0x12, 0x7B, 0xA5, 0x62, 0x2A, 0x23, 0x43, 0x2E, 0x3C, 0x5E, 0x40, 0x23, 0x01, 0x02, 0x22,
-	0x1E, 0xBB, 0x1A, 0x2B, 0x02, 0x02, 0x49, 0x7C, 0xA0, 0x59, 0x65, 0x95, 0x53, 0x02, 0x79, 0x9E,
-	0x39, 0x72, 0x55, 0x39, 0x5C, 0x43, 0x23, 0x9E, 0x35, 0x68, 0x99, 0x65, 0x38, 0x62, 0x53, 0x41,
-	0x31, 0x10, 0x0D, 0x0C, 0x01, 0x0A, 0x04, 0xFE, 0xB3, 0x02, 0x41, 0x4E, 0x75, 0x42, 0x6D, 0x36,
-	0x63, 0x87, 0x50, 0x45, 0x31, 0x4C, 0x2C, 0x01, 0x38, 0x68, 0x90, 0x58, 0x64, 0xCB, 0x64, 0x61,
-	0xCB, 0x67, 0x8A, 0xCE, 0x89, 0x45, 0x02, 0x42, 0x91, 0x00, 0x00, 0x02, 0x00, 0x31, 0xFF, 0xE4,
-	0x04, 0xE9, 0x04, 0x3A, 0x00, 0x1D, 0x00, 0x42, 0x00, 0x25, 0x40, 0x12, 0x3E, 0x3D, 0x3D, 0x1B,
-	0x02, 0x01, 0x01, 0x0D, 0x2A, 0x2A, 0x22, 0x33, 0x0B, 0x72, 0x0C, 0x0D, 0x06, 0x72, 0x00, 0x2B,
-	0x32, 0x2B, 0x32, 0x32, 0x2F, 0x11, 0x39, 0x2F, 0x33, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41,
-	0x23, 0x27, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x27, 0x21, 0x32, 0x16,
-	0x16, 0x15, 0x14, 0x0E, 0x02, 0x07, 0x0E, 0x02, 0x07, 0x06, 0x06, 0x05, 0x35, 0x06, 0x16, 0x33,
-	0x3E, 0x03, 0x37, 0x36, 0x26, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0E, 0x03, 0x23, 0x06, 0x2E, 0x02,
-	0x27, 0x35, 0x34, 0x26, 0x26, 0x23, 0x37, 0x32, 0x16, 0x16, 0x15, 0x01, 0x74, 0xEC, 0x02, 0xBC,
-	0x54, 0x68, 0x31, 0x32, 0x6B, 0x55, 0xFE, 0xFA, 0x06, 0x01, 0x0C, 0x89, 0xBF, 0x64, 0x25, 0x48,
-	0x6B, 0x45, 0x02, 0x05, 0x05, 0x03, 0x22, 0x10, 0x01, 0x5C, 0x01, 0x28, 0x37, 0x38, 0x55, 0x3B,
-	0x20, 0x01, 0x02, 0x21, 0x20, 0xB4, 0x1A, 0x2C, 0x02, 0x02, 0x45, 0x75, 0x94, 0x52, 0x43, 0x66,
-	0x46, 0x25, 0x03, 0x30, 0x5E, 0x45, 0x23, 0x8B, 0x9D, 0x41, 0x01, 0xBA, 0x96, 0x28, 0x4A, 0x31,
-	0x33, 0x50, 0x2F, 0x95, 0x4C, 0x90, 0x65, 0x32, 0x52, 0x40, 0x30, 0x11, 0x01, 0x14, 0x14, 0x02,
-	0x07, 0x03, 0xEA, 0x01, 0x27, 0x32, 0x01, 0x29, 0x4C, 0x6C, 0x44, 0x4D, 0xA5, 0x4D, 0x4D, 0xA2,
-	0x50, 0x70, 0xA8, 0x6F, 0x37, 0x01, 0x1A, 0x3A, 0x5D, 0x41, 0x4C, 0x30, 0x44, 0x24, 0x6B, 0x43,
-	0x74, 0x4B, 0x00, 0x03, 0x00, 0x53, 0xFE, 0xD6, 0x03, 0xF6, 0x05, 0xB0, 0x00, 0x1F, 0x00, 0x34,
-	0x00, 0x3F, 0x00, 0x1F, 0x40, 0x0E, 0x3A, 0x39, 0x3F, 0x2C, 0x0C, 0x0D, 0x02, 0x72, 0x21, 0x20,
-	0x20, 0x01, 0x01, 0x02, 0x00, 0x2F, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2B, 0x32, 0x2F, 0x33, 0x2F,
-	0x33, 0x30, 0x31, 0x41, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21,
-	0x35, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x03, 0x07, 0x22, 0x06, 0x06, 0x07, 0x0E, 0x02,
-	0x07, 0x37, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x16, 0x16, 0x17, 0x15, 0x23, 0x2E, 0x02, 0x35,
-	0x35, 0x34, 0x26, 0x26, 0x01, 0x15, 0x14, 0x06, 0x07, 0x27, 0x3E, 0x02, 0x35, 0x35, 0x01, 0x8C,
-	0xDC, 0xA2, 0x77, 0x8E, 0x40, 0x3E, 0x86, 0x6D, 0xFE, 0xED, 0x01, 0x13, 0x9F, 0xDA, 0x71, 0x1D,
-	0x39, 0x55, 0x6F, 0x44, 0x03, 0x08, 0x07, 0x03, 0x1A, 0x19, 0x11, 0x0E, 0x11, 0xA6, 0xBC, 0x4E,
-	0x0D, 0x1E, 0x19, 0xBE, 0x1E, 0x1B, 0x06, 0x40, 0x76, 0x02, 0x19, 0x5C, 0x53, 0x69, 0x20, 0x2C,
-	0x17, 0x02, 0x79, 0x98, 0x3C, 0x74, 0x53, 0x50, 0x74, 0x40, 0x98, 0x5E, 0xB8, 0x88, 0x38, 0x61,
-	0x52, 0x42, 0x31, 0x10, 0x0C, 0x0B, 0x01, 0x06, 0x06, 0x03, 0x04, 0x6D, 0x5F, 0xA8, 0x6C, 0x88,
-	0x29, 0x4E, 0x42, 0x19, 0x19, 0x1C, 0x5C, 0x5B, 0x1A, 0x84, 0x4F, 0x77, 0x42, 0xFE, 0x5C, 0x95,
-	0x5B, 0xCB, 0x44, 0x49, 0x2C, 0x5B, 0x61, 0x36, 0x98, 0x00, 0x00, 0x03, 0x00, 0x79, 0xFE, 0xC6,
-	0x03, 0xD9, 0x04, 0x3A, 0x00, 0x1E, 0x00, 0x33, 0x00, 0x3E, 0x00, 0x1E, 0x40, 0x0E, 0x38, 0x20,
-	0x1F, 0x1F, 0x02, 0x01, 0x01, 0x3E, 0x2B, 0x0A, 0x0C, 0x0D, 0x06, 0x72, 0x00, 0x2B, 0x32, 0x3F,
-	0x33, 0x39, 0x2F, 0x33, 0x33, 0x11, 0x33, 0x2F, 0x30, 0x31, 0x41, 0x21, 0x35, 0x33, 0x32, 0x36,
-	0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x37, 0x21, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02,
-	0x07, 0x06, 0x06, 0x07, 0x0E, 0x02, 0x07, 0x37, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x16, 0x16,
-	0x17, 0x15, 0x23, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x26, 0x26, 0x05, 0x15, 0x14, 0x06, 0x07, 0x27,
-	0x3E, 0x02, 0x35, 0x35, 0x01, 0xCC, 0xFE, 0xF6, 0xD4, 0x56, 0x6A, 0x30, 0x30, 0x6A, 0x56, 0xFE,
-	0xE3, 0x01, 0x01, 0x1C, 0x66, 0x9E, 0x6E, 0x38, 0x25, 0x48, 0x6B, 0x46, 0x04, 0x09, 0x04, 0x16,
-	0x13, 0x0D, 0x28, 0x25, 0x8A, 0x9D, 0x41, 0x0A, 0x1A, 0x17, 0xBF, 0x1B, 0x16, 0x05, 0x30, 0x5E,
-	0x01, 0xE1, 0x5B, 0x53, 0x6A, 0x20, 0x2C, 0x17, 0x01, 0xB9, 0x96, 0x28, 0x4A, 0x32, 0x34, 0x50,
-	0x2D, 0x96, 0x2B, 0x53, 0x77, 0x4C, 0x33, 0x52, 0x41, 0x30, 0x10, 0x01, 0x27, 0x02, 0x04, 0x06,
-	0x04, 0x02, 0x6B, 0x48, 0x7E, 0x51, 0x61, 0x18, 0x3B, 0x35, 0x11, 0x13, 0x12, 0x46, 0x45, 0x10,
-	0x5F, 0x36, 0x4D, 0x2A, 0xF4, 0x95, 0x5B, 0xCB, 0x44, 0x49, 0x2C, 0x5B, 0x61, 0x36, 0x98, 0x00,
-	0x00, 0x03, 0x00, 0x45, 0xFF, 0xEB, 0x07, 0x71, 0x05, 0xB0, 0x00, 0x11, 0x00, 0x15, 0x00, 0x32,
-	0x00, 0x1D, 0x40, 0x0E, 0x26, 0x26, 0x1E, 0x2F, 0x09, 0x72, 0x17, 0x14, 0x00, 0x15, 0x02, 0x72,
-	0x0B, 0x08, 0x00, 0x2F, 0x33, 0x2B, 0x32, 0x32, 0x32, 0x2B, 0x32, 0x32, 0x2F, 0x30, 0x31, 0x41,
-	0x33, 0x03, 0x0E, 0x04, 0x23, 0x23, 0x35, 0x37, 0x3E, 0x04, 0x37, 0x01, 0x15, 0x21, 0x35, 0x01,
-	0x11, 0x33, 0x11, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x37, 0x36, 0x26, 0x27, 0x33, 0x16,
-	0x16, 0x07, 0x0E, 0x03, 0x23, 0x22, 0x26, 0x26, 0x01, 0x8A, 0xC0, 0x21, 0x07, 0x21, 0x3C, 0x60,
-	0x8B, 0x61, 0x34, 0x28, 0x38, 0x51, 0x39, 0x24, 0x15, 0x06, 0x02, 0xDF, 0xFD, 0x82, 0x02, 0x59,
-	0xC1, 0x17, 0x2C, 0x3E, 0x27, 0x44, 0x69, 0x48, 0x27, 0x01, 0x02, 0x21, 0x1E, 0xBB, 0x1B, 0x2A,
-	0x02, 0x02, 0x4E, 0x84, 0xAB, 0x5F, 0x6D, 0xA2, 0x5A, 0x05, 0xB0, 0xFD, 0x37, 0x9A, 0xF1, 0xB1,
-	0x73, 0x38, 0x9D, 0x03, 0x04, 0x2B, 0x58, 0x8C, 0xCB, 0x88, 0x02, 0xAA, 0x9E, 0x9E, 0xFB, 0xAB,
-	0x04, 0x55, 0xFB, 0xAB, 0x2F, 0x4E, 0x38, 0x1E, 0x38, 0x67, 0x90, 0x5A, 0x64, 0xCB, 0x64, 0x61,
-	0xCB, 0x67, 0x8B, 0xCF, 0x88, 0x44, 0x4A, 0xA2, 0x00, 0x03, 0x00, 0x3F, 0xFF, 0xEB, 0x06, 0x3A,
-	0x04, 0x3A, 0x00, 0x11, 0x00, 0x15, 0x00, 0x33, 0x00, 0x1F, 0x40, 0x10, 0x27, 0x27, 0x1E, 0x2F,
-	0x0B, 0x72, 0x17, 0x14, 0x00, 0x15, 0x06, 0x72, 0x0B, 0x08, 0x0A, 0x72, 0x00, 0x2B, 0x32, 0x2B,
-	0x32, 0x32, 0x32, 0x2B, 0x32, 0x32, 0x2F, 0x30, 0x31, 0x41, 0x33, 0x03, 0x0E, 0x04, 0x23, 0x23,
-	0x35, 0x37, 0x3E, 0x04, 0x37, 0x01, 0x15, 0x21, 0x35, 0x01, 0x11, 0x33, 0x11, 0x14, 0x1E, 0x02,
-	0x33, 0x32, 0x3E, 0x02, 0x37, 0x36, 0x26, 0x27, 0x37, 0x16, 0x16, 0x07, 0x0E, 0x03, 0x23, 0x22,
-	0x2E, 0x02, 0x01, 0x3C, 0xB9, 0x1C, 0x07, 0x1E, 0x36, 0x4F, 0x6E, 0x48, 0x3A, 0x29, 0x2A, 0x3D,
-	0x2A, 0x1B, 0x10, 0x04, 0x02, 0x29, 0xFE, 0x14, 0x01, 0xCC, 0xBA, 0x17, 0x2D, 0x3E, 0x27, 0x38,
-	0x56, 0x3B, 0x20, 0x01, 0x02, 0x21, 0x1D, 0xB3, 0x1A, 0x2B, 0x02, 0x02, 0x45, 0x74, 0x96, 0x53,
-	0x50, 0x82, 0x5E, 0x33, 0x04, 0x3A, 0xFD, 0xF6, 0x79, 0xB9, 0x84, 0x53, 0x27, 0xA3, 0x03, 0x03,
-	0x22, 0x43, 0x6A, 0x92, 0x61, 0x01, 0xCF, 0x99, 0x99, 0xFD, 0x1F, 0x02, 0xE1, 0xFD, 0x1F, 0x30,
-	0x4F, 0x39, 0x1E, 0x32, 0x5C, 0x82, 0x51, 0x5F, 0xC0, 0x5E, 0x01, 0x5D, 0xC0, 0x61, 0x7F, 0xBE,
-	0x7E, 0x3E, 0x29, 0x58, 0x8B, 0x00, 0x00, 0x03, 0x00, 0xAA, 0xFF, 0xE9, 0x07, 0x71, 0x05, 0xB0,
-	0x00, 0x03, 0x00, 0x07, 0x00, 0x23, 0x00, 0x20, 0x40, 0x11, 0x16, 0x16, 0x0E, 0x1F, 0x09, 0x72,
-	0x08, 0x02, 0x72, 0x00, 0x03, 0x03, 0x06, 0x08, 0x04, 0x02, 0x72, 0x00, 0x2B, 0x3F, 0x39, 0x2F,
-	0x33, 0x2B, 0x2B, 0x32, 0x32, 0x2F, 0x30, 0x31, 0x41, 0x21, 0x15, 0x21, 0x03, 0x33, 0x11, 0x23,
-	0x01, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x3E, 0x03, 0x37, 0x36, 0x26, 0x27, 0x33, 0x16, 0x16,
-	0x07, 0x0E, 0x03, 0x23, 0x06, 0x26, 0x26, 0x27, 0x01, 0x4D, 0x02, 0xF8, 0xFD, 0x08, 0xA3, 0xC0,
-	0xC0, 0x03, 0x7F, 0xC0, 0x28, 0x4C, 0x34, 0x44, 0x69, 0x49, 0x27, 0x01, 0x02, 0x22, 0x1E, 0xBA,
-	0x1B, 0x2B, 0x02, 0x02, 0x4E, 0x84, 0xAB, 0x5F, 0x6C, 0x9E, 0x58, 0x06, 0x03, 0x1F, 0x9E, 0x03,
-	0x2F, 0xFA, 0x50, 0x05, 0xB0, 0xFB, 0xAB, 0x3E, 0x60, 0x35, 0x01, 0x37, 0x67, 0x90, 0x5A, 0x64,
-	0xCB, 0x64, 0x61, 0xCB, 0x67, 0x8B, 0xCF, 0x88, 0x44, 0x02, 0x4A, 0xA4, 0x84, 0x00, 0x00, 0x03,
-	0x00, 0x90, 0xFF, 0xEA, 0x06, 0x4D, 0x04, 0x3A, 0x00, 0x03, 0x00, 0x07, 0x00, 0x25, 0x00, 0x22,
-	0x40, 0x12, 0x19, 0x19, 0x10, 0x21, 0x0B, 0x72, 0x09, 0x06, 0x72, 0x03, 0x02, 0x02, 0x05, 0x07,
-	0x06, 0x72, 0x05, 0x0A, 0x00, 0x3F, 0x2B, 0x12, 0x39, 0x2F, 0x33, 0x2B, 0x2B, 0x32, 0x32, 0x2F,
-	0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x11, 0x33, 0x11, 0x14, 0x1E,
-	0x02, 0x33, 0x3E, 0x03, 0x37, 0x36, 0x26, 0x27, 0x37, 0x16, 0x16, 0x07, 0x0E, 0x03, 0x23, 0x06,
-	0x2E, 0x02, 0x03, 0x5D, 0xFD, 0xC5, 0x28, 0xBA, 0x02, 0xB3, 0xBA, 0x17, 0x2C, 0x3F, 0x27, 0x38,
-	0x57, 0x3B, 0x20, 0x01, 0x02, 0x22, 0x1D, 0xB3, 0x1A, 0x2C, 0x02, 0x02, 0x44, 0x75, 0x96, 0x54,
-	0x50, 0x7F, 0x5C, 0x33, 0x02, 0x64, 0x96, 0x96, 0x01, 0xD6, 0xFB, 0xC6, 0x04, 0x3A, 0xFD, 0x1F,
-	0x02, 0xE1, 0xFD, 0x1F, 0x30, 0x4F, 0x38, 0x1F, 0x01, 0x31, 0x5C, 0x82, 0x51, 0x5F, 0xC0, 0x5E,
-	0x01, 0x5D, 0xC0, 0x61, 0x7F, 0xBE, 0x7E, 0x3E, 0x01, 0x28, 0x58, 0x8D, 0x00, 0x01, 0x00, 0x76,
-	0xFF, 0xEB, 0x04, 0xA2, 0x05, 0xC5, 0x00, 0x2B, 0x00, 0x15, 0x40, 0x0A, 0x12, 0x0B, 0x03, 0x72,
-	0x25, 0x25, 0x1D, 0x00, 0x09, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x2F, 0x2B, 0x32, 0x30, 0x31, 0x45,
-	0x22, 0x2E, 0x02, 0x35, 0x11, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23,
-	0x22, 0x0E, 0x02, 0x15, 0x11, 0x14, 0x1E, 0x02, 0x33, 0x3E, 0x02, 0x37, 0x36, 0x26, 0x27, 0x33,
-	0x16, 0x16, 0x07, 0x0E, 0x02, 0x02, 0xB9, 0x81, 0xD5, 0x9A, 0x53, 0x53, 0x9A, 0xD5, 0x81, 0x73,
-	0xAE, 0x42, 0x3B, 0x40, 0x91, 0x57, 0x5B, 0x8F, 0x64, 0x34, 0x34, 0x64, 0x8F, 0x5B, 0x5E, 0x82,
-	0x44, 0x02, 0x02, 0x1D, 0x17, 0xBB, 0x13, 0x27, 0x02, 0x02, 0x88, 0xDC, 0x15, 0x5D, 0xA7, 0xE1,
-	0x85, 0x01, 0x06, 0x85, 0xE1, 0xA7, 0x5D, 0x2C, 0x2B, 0x8B, 0x21, 0x23, 0x48, 0x7E, 0xA6, 0x5E,
-	0xFE, 0xF8, 0x5F, 0xA7, 0x7F, 0x48, 0x01, 0x47, 0x81, 0x59, 0x59, 0xB7, 0x58, 0x58, 0xB5, 0x5B,
-	0x97, 0xC6, 0x62, 0x00, 0x00, 0x01, 0x00, 0x66, 0xFF, 0xEB, 0x03, 0xC7, 0x04, 0x4E, 0x00, 0x2B,
-	0x00, 0x15, 0x40, 0x0A, 0x21, 0x1A, 0x07, 0x72, 0x07, 0x07, 0x00, 0x0F, 0x0B, 0x72, 0x00, 0x2B,
-	0x32, 0x32, 0x2F, 0x2B, 0x32, 0x30, 0x31, 0x65, 0x3E, 0x02, 0x37, 0x34, 0x26, 0x27, 0x33, 0x16,
-	0x16, 0x07, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16,
-	0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x02, 0x51, 0x47,
-	0x51, 0x23, 0x01, 0x09, 0x0B, 0xB2, 0x0B, 0x11, 0x01, 0x02, 0x62, 0xA7, 0x6A, 0x76, 0xB7, 0x7E,
-	0x40, 0x3E, 0x78, 0xAF, 0x71, 0x60, 0x8D, 0x2C, 0x2C, 0x2E, 0x79, 0x46, 0x4C, 0x6C, 0x45, 0x20,
-	0x23, 0x49, 0x75, 0x83, 0x01, 0x2A, 0x4B, 0x34, 0x38, 0x7B, 0x39, 0x3A, 0x77, 0x3B, 0x6D, 0x8F,
-	0x46, 0x57, 0x97, 0xC3, 0x6C, 0x2A, 0x6C, 0xC3, 0x96, 0x57, 0x22, 0x1F, 0x90, 0x1B, 0x1E, 0x44,
-	0x71, 0x8A, 0x45, 0x2A, 0x46, 0x8A, 0x71, 0x44, 0x00, 0x02, 0x00, 0x24, 0xFF, 0xE9, 0x05, 0x48,
-	0x05, 0xB0, 0x00, 0x03, 0x00, 0x20, 0x00, 0x17, 0x40, 0x0B, 0x14, 0x14, 0x0C, 0x1D, 0x09, 0x72,
-	0x05, 0x02, 0x03, 0x02, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x2B, 0x32, 0x32, 0x2F, 0x30, 0x31, 0x41,
-	0x15, 0x21, 0x35, 0x01, 0x11, 0x33, 0x11, 0x14, 0x1E, 0x02, 0x33, 0x3E, 0x03, 0x37, 0x36, 0x26,
-	0x27, 0x33, 0x16, 0x16, 0x07, 0x0E, 0x03, 0x23, 0x06, 0x26, 0x26, 0x04, 0xA4, 0xFB, 0x80, 0x01,
-	0xDB, 0xC1, 0x16, 0x2C, 0x3E, 0x27, 0x45, 0x69, 0x48, 0x26, 0x02, 0x02, 0x22, 0x1E, 0xBB, 0x1B,
-	0x2B, 0x03, 0x02, 0x4D, 0x84, 0xAB, 0x60, 0x6C, 0x9D, 0x59, 0x05, 0xB0, 0x9E, 0x9E, 0xFB, 0xAB,
-	0x04, 0x55, 0xFB, 0xAB, 0x2F, 0x4D, 0x38, 0x1F, 0x01, 0x37, 0x67, 0x90, 0x5A, 0x64, 0xCB, 0x64,
-	0x61, 0xCB, 0x67, 0x8B, 0xCF, 0x88, 0x44, 0x02, 0x4A, 0xA4, 0x00, 0x02, 0x00, 0x46, 0xFF, 0xEA,
-	0x04, 0xB8, 0x04, 0x3A, 0x00, 0x03, 0x00, 0x20, 0x00, 0x17, 0x40, 0x0B, 0x13, 0x13, 0x0B, 0x1C,
-	0x0B, 0x72, 0x05, 0x02, 0x03, 0x06, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x2B, 0x32, 0x32, 0x2F, 0x30,
-	0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x3E, 0x03, 0x37,
-	0x36, 0x26, 0x27, 0x33, 0x16, 0x16, 0x07, 0x0E, 0x03, 0x23, 0x06, 0x2E, 0x02, 0x03, 0xD1, 0xFC,
-	0x75, 0x01, 0x67, 0xB9, 0x29, 0x4E, 0x35, 0x38, 0x56, 0x3C, 0x20, 0x01, 0x02, 0x22, 0x1D, 0xB2,
-	0x1A, 0x2C, 0x02, 0x02, 0x45, 0x74, 0x96, 0x53, 0x50, 0x80, 0x5C, 0x34, 0x04, 0x3A, 0x96, 0x96,
-	0xFD, 0x1F, 0x02, 0xE1, 0xFD, 0x1F, 0x40, 0x60, 0x36, 0x01, 0x29, 0x4D, 0x6D, 0x44, 0x4F, 0xA7,
-	0x4F, 0x4F, 0xA4, 0x52, 0x71, 0xA9, 0x6F, 0x37, 0x01, 0x28, 0x58, 0x8D, 0x00, 0x02, 0x00, 0x97,
-	0xFF, 0xEB, 0x04, 0xFF, 0x05, 0xC5, 0x00, 0x20, 0x00, 0x3F, 0x00, 0x23, 0x40, 0x11, 0x00, 0x22,
-	0x3F, 0x3F, 0x02, 0x02, 0x17, 0x35, 0x31, 0x2C, 0x03, 0x72, 0x11, 0x0D, 0x17, 0x09, 0x72, 0x00,
-	0x2B, 0x32, 0xCC, 0x2B, 0xCC, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41,
-	0x33, 0x15, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x33,
-	0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x05, 0x23, 0x22, 0x2E, 0x02,
-	0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
-	0x06, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x33, 0x02, 0xC3, 0xBF, 0xB9, 0x5A, 0x8A, 0x5D, 0x30, 0x33,
-	0x62, 0x8F, 0x5B, 0x6C, 0xA2, 0x5A, 0xC0, 0x5E, 0x9F, 0xC5, 0x66, 0x7E, 0xD2, 0x9B, 0x55, 0x4A,
-	0x8E, 0xCF, 0x01, 0x44, 0xBF, 0x79, 0xC4, 0x8D, 0x4C, 0x4E, 0x92, 0xCC, 0x7E, 0x91, 0xF2, 0x91,
-	0xC0, 0x5B, 0x9A, 0x5F, 0x7D, 0xA0, 0x4C, 0x27, 0x54, 0x84, 0x5C, 0xB9, 0x03, 0x10, 0x79, 0x1F,
-	0x40, 0x63, 0x43, 0x39, 0x61, 0x48, 0x28, 0x49, 0x7A, 0x49, 0x70, 0xA1, 0x67, 0x31, 0x39, 0x6D,
-	0x9F, 0x66, 0x5B, 0x8D, 0x60, 0x32, 0x55, 0x39, 0x64, 0x84, 0x4B, 0x66, 0x9A, 0x69, 0x35, 0x62,
-	0xB5, 0x7D, 0x48, 0x6F, 0x3F, 0x45, 0x73, 0x45, 0x36, 0x59, 0x42, 0x23, 0xFF, 0xFF, 0x00, 0x30,
-	0xFE, 0x4B, 0x05, 0xAD, 0x05, 0xB0, 0x04, 0x26, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x07, 0x02, 0x6E,
-	0x04, 0x45, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2C, 0xFE, 0x4B, 0x04, 0xBC, 0x04, 0x3A, 0x04, 0x26,
-	0x00, 0xF2, 0x00, 0x00, 0x00, 0x07, 0x02, 0x6E, 0x03, 0x54, 0x00, 0x00, 0x00, 0x02, 0x00, 0x70,
-	0x04, 0x71, 0x02, 0xC9, 0x05, 0xD7, 0x00, 0x05, 0x00, 0x0F, 0x00, 0x12, 0xB6, 0x05, 0x05, 0x0D,
-	0x07, 0x02, 0x02, 0x07, 0x00, 0x2F, 0x33, 0x2F, 0x10, 0xCD, 0x32, 0x2F, 0x30, 0x31, 0x41, 0x35,
-	0x13, 0x33, 0x15, 0x03, 0x25, 0x35, 0x33, 0x15, 0x14, 0x16, 0x17, 0x07, 0x26, 0x26, 0x01, 0x92,
-	0x74, 0xC3, 0xDF, 0xFE, 0x86, 0xA7, 0x2A, 0x2A, 0x49, 0x56, 0x5C, 0x04, 0x84, 0x11, 0x01, 0x42,
-	0x15, 0xFE, 0xC2, 0xFE, 0x55, 0x4F, 0x48, 0x68, 0x2D, 0x3A, 0x2D, 0x8F, 0xFF, 0xFF, 0x00, 0x26,
-	0x02, 0x1F, 0x02, 0x0E, 0x02, 0xB7, 0x04, 0x06, 0x00, 0x11, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x26,
-	0x02, 0x1F, 0x02, 0x0E, 0x02, 0xB7, 0x04, 0x06, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0xA2,
-	0x02, 0x8B, 0x04, 0x8C, 0x03, 0x23, 0x00, 0x03, 0x00, 0x08, 0xB1, 0x03, 0x02, 0x00, 0x2F, 0x33,
-	0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x04, 0x8C, 0xFC, 0x16, 0x03, 0x23, 0x98, 0x98, 0x00, 0x01,
-	0x00, 0x90, 0x02, 0x8B, 0x05, 0xC8, 0x03, 0x23, 0x00, 0x03, 0x00, 0x08, 0xB1, 0x03, 0x02, 0x00,
-	0x2F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x05, 0xC8, 0xFA, 0xC8, 0x03, 0x23, 0x98, 0x98,
-	0x00, 0x02, 0x00, 0x0D, 0xFE, 0x6A, 0x03, 0xA1, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0E,
-	0xB4, 0x02, 0x03, 0x80, 0x06, 0x07, 0x00, 0x2F, 0x33, 0x1A, 0xCE, 0x32, 0x30, 0x31, 0x45, 0x15,
-	0x21, 0x35, 0x25, 0x15, 0x21, 0x35, 0x03, 0xA1, 0xFC, 0x6C, 0x03, 0x94, 0xFC, 0x6C, 0xFE, 0x98,
-	0x98, 0xFE, 0x98, 0x98, 0x00, 0x01, 0x00, 0x61, 0x04, 0x31, 0x01, 0x78, 0x06, 0x14, 0x00, 0x0A,
-	0x00, 0x08, 0xB1, 0x05, 0x00, 0x00, 0x2F, 0xCD, 0x30, 0x31, 0x53, 0x35, 0x34, 0x36, 0x36, 0x37,
-	0x17, 0x06, 0x06, 0x15, 0x15, 0x61, 0x29, 0x4E, 0x37, 0x69, 0x2E, 0x32, 0x04, 0x31, 0x79, 0x3D,
-	0x85, 0x7B, 0x2D, 0x49, 0x42, 0x8B, 0x51, 0x7C, 0x00, 0x01, 0x00, 0x30, 0x04, 0x16, 0x01, 0x48,
-	0x06, 0x00, 0x00, 0x0A, 0x00, 0x08, 0xB1, 0x05, 0x00, 0x00, 0x2F, 0xCD, 0x30, 0x31, 0x41, 0x15,
-	0x14, 0x06, 0x06, 0x07, 0x27, 0x36, 0x36, 0x35, 0x35, 0x01, 0x48, 0x29, 0x4E, 0x37, 0x6A, 0x2F,
-	0x31, 0x06, 0x00, 0x80, 0x3C, 0x85, 0x7B, 0x2E, 0x49, 0x42, 0x8B, 0x51, 0x83, 0x00, 0x00, 0x01,
-	0x00, 0x24, 0xFE, 0xE5, 0x01, 0x3C, 0x00, 0xB6, 0x00, 0x0A, 0x00, 0x08, 0xB1, 0x05, 0x00, 0x00,
-	0x2F, 0xCD, 0x30, 0x31, 0x65, 0x15, 0x14, 0x06, 0x06, 0x07, 0x27, 0x36, 0x36, 0x35, 0x35, 0x01,
-	0x3C, 0x29, 0x4E, 0x37, 0x6A, 0x2F, 0x30, 0xB6, 0x67, 0x3C, 0x85, 0x7B, 0x2E, 0x48, 0x42, 0x8C,
-	0x51, 0x6A, 0x00, 0x01, 0x00, 0x4F, 0x04, 0x16, 0x01, 0x67, 0x06, 0x00, 0x00, 0x0A, 0x00, 0x08,
-	0xB1, 0x06, 0x00, 0x00, 0x2F, 0xCD, 0x30, 0x31, 0x53, 0x33, 0x15, 0x14, 0x16, 0x17, 0x07, 0x2E,
-	0x02, 0x35, 0x4F, 0xB8, 0x31, 0x2F, 0x69, 0x37, 0x4F, 0x29, 0x06, 0x00, 0x83, 0x51, 0x8B, 0x42,
-	0x49, 0x2E, 0x7B, 0x85, 0x3C, 0x00, 0xFF, 0xFF, 0x00, 0x69, 0x04, 0x31, 0x02, 0xBB, 0x06, 0x14,
-	0x04, 0x26, 0x01, 0x84, 0x08, 0x00, 0x00, 0x07, 0x01, 0x84, 0x01, 0x43, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x3C, 0x04, 0x16, 0x02, 0x87, 0x06, 0x00, 0x04, 0x26, 0x01, 0x85, 0x0C, 0x00, 0x00, 0x07,
-	0x01, 0x85, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x02, 0x00, 0x24, 0xFE, 0xD2, 0x02, 0x64, 0x00, 0xF6,
-	0x00, 0x0A, 0x00, 0x15, 0x00, 0x0C, 0xB3, 0x10, 0x05, 0x0B, 0x00, 0x00, 0x2F, 0x32, 0xCD, 0x32,
-	0x30, 0x31, 0x65, 0x15, 0x14, 0x06, 0x06, 0x07, 0x27, 0x36, 0x36, 0x35, 0x35, 0x21, 0x15, 0x14,
-	0x06, 0x06, 0x07, 0x27, 0x36, 0x36, 0x35, 0x35, 0x01, 0x3C, 0x29, 0x4E, 0x37, 0x6A, 0x2F, 0x30,
-	0x01, 0xE1, 0x29, 0x4E, 0x37, 0x6A, 0x2F, 0x30, 0xF6, 0xA7, 0x40, 0x8C, 0x81, 0x30, 0x49, 0x47,
-	0x94, 0x56, 0xAA, 0xA7, 0x40, 0x8C, 0x81, 0x30, 0x49, 0x47, 0x94, 0x56, 0xAA, 0x00, 0x00, 0x02,
-	0x00, 0x46, 0x00, 0x00, 0x04, 0x24, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x15, 0x40, 0x0A,
-	0x06, 0x07, 0x07, 0x02, 0x03, 0x02, 0x72, 0x02, 0x12, 0x72, 0x00, 0x2B, 0x2B, 0x11, 0x39, 0x2F,
-	0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x02, 0x90, 0xB9, 0x02, 0x4D,
-	0xFC, 0x22, 0x05, 0xB0, 0xFA, 0x50, 0x05, 0xB0, 0xFE, 0x8A, 0x99, 0x99, 0x00, 0x03, 0x00, 0x57,
-	0xFE, 0x60, 0x04, 0x34, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x1D, 0x40, 0x0E,
-	0x0B, 0x0A, 0x06, 0x07, 0x07, 0x01, 0x03, 0x0A, 0x12, 0x72, 0x03, 0x02, 0x72, 0x01, 0x00, 0x2F,
-	0x2B, 0x2B, 0x11, 0x12, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01,
-	0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x02, 0x9E, 0xB9, 0x02, 0x4F, 0xFC, 0x23, 0x03, 0xDD,
-	0xFC, 0x23, 0x05, 0xB0, 0xF8, 0xB0, 0x07, 0x50, 0xFE, 0x8A, 0x99, 0x99, 0xFC, 0x5E, 0x98, 0x98,
-	0x00, 0x01, 0x00, 0x8B, 0x02, 0x18, 0x02, 0x23, 0x03, 0xCB, 0x00, 0x0D, 0x00, 0x08, 0xB1, 0x04,
-	0x0B, 0x00, 0x2F, 0xCD, 0x30, 0x31, 0x53, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x15, 0x14,
-	0x06, 0x23, 0x22, 0x26, 0x8B, 0x6D, 0x5E, 0x5F, 0x6E, 0x6D, 0x5F, 0x5E, 0x6E, 0x02, 0xDC, 0x29,
-	0x56, 0x70, 0x70, 0x56, 0x29, 0x55, 0x6F, 0x6F, 0xFF, 0xFF, 0x00, 0x94, 0xFF, 0xF4, 0x03, 0x2F,
-	0x00, 0xD2, 0x04, 0x26, 0x00, 0x12, 0x04, 0x00, 0x00, 0x07, 0x00, 0x12, 0x01, 0xB9, 0x00, 0x00,
-	0xFF, 0xFF, 0x00, 0x94, 0xFF, 0xF4, 0x04, 0xCE, 0x00, 0xD2, 0x04, 0x26, 0x00, 0x12, 0x04, 0x00,
-	0x00, 0x27, 0x00, 0x12, 0x01, 0xB9, 0x00, 0x00, 0x00, 0x07, 0x00, 0x12, 0x03, 0x58, 0x00, 0x00,
-	0x00, 0x01, 0x00, 0x52, 0x02, 0x02, 0x01, 0x2D, 0x02, 0xD6, 0x00, 0x0B, 0x00, 0x08, 0xB1, 0x03,
-	0x09, 0x00, 0x2F, 0xCD, 0x30, 0x31, 0x53, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
-	0x22, 0x26, 0x52, 0x38, 0x35, 0x36, 0x38, 0x38, 0x36, 0x35, 0x38, 0x02, 0x6B, 0x2D, 0x3E, 0x3E,
-	0x2D, 0x2C, 0x3D, 0x3D, 0x00, 0x07, 0x00, 0x44, 0xFF, 0xEB, 0x07, 0x57, 0x05, 0xC5, 0x00, 0x11,
-	0x00, 0x23, 0x00, 0x35, 0x00, 0x47, 0x00, 0x59, 0x00, 0x6B, 0x00, 0x6F, 0x00, 0x29, 0x40, 0x13,
-	0x5F, 0x56, 0x56, 0x32, 0x68, 0x4D, 0x4D, 0x44, 0x29, 0x29, 0x3B, 0x32, 0x0D, 0x17, 0x0E, 0x0E,
-	0x20, 0x05, 0x05, 0x00, 0x3F, 0x33, 0x33, 0x2F, 0x33, 0x3F, 0x33, 0x33, 0x2F, 0x33, 0x33, 0x2F,
-	0x33, 0x11, 0x33, 0x2F, 0x33, 0x30, 0x31, 0x53, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
-	0x15, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32,
-	0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x01, 0x35, 0x34, 0x36, 0x36,
-	0x33, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14,
-	0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x05,
-	0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26,
-	0x26, 0x37, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23,
-	0x22, 0x06, 0x06, 0x01, 0x01, 0x27, 0x01, 0x44, 0x48, 0x86, 0x5C, 0x5E, 0x86, 0x47, 0x47, 0x85,
-	0x5D, 0x5D, 0x86, 0x49, 0x8B, 0x23, 0x48, 0x36, 0x36, 0x47, 0x22, 0x23, 0x47, 0x37, 0x35, 0x47,
-	0x23, 0x02, 0x68, 0x48, 0x86, 0x5C, 0x58, 0x7D, 0x43, 0x43, 0x7C, 0x57, 0x5D, 0x86, 0x49, 0x8B,
-	0x23, 0x48, 0x36, 0x36, 0x47, 0x22, 0x23, 0x47, 0x37, 0x35, 0x47, 0x23, 0x01, 0x52, 0x44, 0x7E,
-	0x56, 0x5E, 0x85, 0x48, 0x47, 0x85, 0x5D, 0x57, 0x7F, 0x44, 0x78, 0x24, 0x47, 0x36, 0x36, 0x46,
-	0x23, 0x23, 0x47, 0x37, 0x35, 0x47, 0x23, 0xFE, 0xE9, 0xFD, 0x39, 0x69, 0x02, 0xC7, 0x04, 0x4B,
-	0x4D, 0x53, 0x88, 0x52, 0x52, 0x88, 0x53, 0x4D, 0x51, 0x88, 0x52, 0x52, 0x88, 0x9E, 0x4D, 0x2E,
-	0x52, 0x33, 0x33, 0x52, 0x2E, 0x4D, 0x2F, 0x53, 0x33, 0x33, 0x53, 0xFC, 0x50, 0x4E, 0x52, 0x88,
-	0x52, 0x52, 0x88, 0x52, 0x4E, 0x52, 0x88, 0x52, 0x52, 0x88, 0xA0, 0x4E, 0x2E, 0x53, 0x33, 0x33,
-	0x52, 0x2F, 0x4E, 0x2F, 0x52, 0x33, 0x33, 0x52, 0x7D, 0x4E, 0x52, 0x88, 0x52, 0x52, 0x88, 0x52,
-	0x4E, 0x52, 0x88, 0x52, 0x52, 0x88, 0xA0, 0x4E, 0x2E, 0x53, 0x33, 0x33, 0x52, 0x2F, 0x4E, 0x2F,
-	0x52, 0x33, 0x33, 0x52, 0x03, 0x4D, 0xFB, 0x8E, 0x42, 0x04, 0x72, 0x00, 0x00, 0x02, 0x00, 0x6C,
-	0x00, 0x99, 0x02, 0x21, 0x03, 0xB5, 0x00, 0x04, 0x00, 0x09, 0x00, 0x12, 0x40, 0x09, 0x01, 0x05,
-	0x03, 0x09, 0x02, 0x08, 0x06, 0x06, 0x00, 0x00, 0x2F, 0x2F, 0x17, 0x39, 0x30, 0x31, 0x41, 0x01,
-	0x27, 0x35, 0x01, 0x03, 0x01, 0x23, 0x01, 0x35, 0x02, 0x21, 0xFE, 0xFB, 0xB0, 0x01, 0x27, 0x77,
-	0x01, 0x05, 0x8E, 0xFE, 0xD9, 0x03, 0xB5, 0xFE, 0x6E, 0x01, 0x0D, 0x01, 0x84, 0xFE, 0x77, 0xFE,
-	0x6D, 0x01, 0x85, 0x0D, 0x00, 0x02, 0x00, 0x5A, 0x00, 0x99, 0x02, 0x0F, 0x03, 0xB5, 0x00, 0x04,
-	0x00, 0x09, 0x00, 0x0E, 0xB4, 0x02, 0x08, 0x08, 0x05, 0x00, 0x00, 0x2F, 0x2F, 0x39, 0x2F, 0x33,
-	0x30, 0x31, 0x77, 0x01, 0x17, 0x15, 0x01, 0x03, 0x33, 0x01, 0x15, 0x07, 0x5A, 0x01, 0x05, 0xB0,
-	0xFE, 0xD9, 0x8E, 0x8E, 0x01, 0x27, 0xB0, 0x99, 0x01, 0x92, 0x01, 0x0D, 0xFE, 0x7C, 0x03, 0x1C,
-	0xFE, 0x7B, 0x0D, 0x01, 0x00, 0x01, 0x00, 0x3C, 0x00, 0x6F, 0x03, 0x6B, 0x05, 0x23, 0x00, 0x03,
-	0x00, 0x0E, 0xB3, 0x00, 0x03, 0x02, 0x01, 0x00, 0x7C, 0x2F, 0x33, 0x18, 0x2F, 0x33, 0x30, 0x31,
-	0x41, 0x01, 0x27, 0x01, 0x03, 0x6B, 0xFD, 0x39, 0x68, 0x02, 0xC7, 0x04, 0xE1, 0xFB, 0x8E, 0x42,
-	0x04, 0x72, 0xFF, 0xFF, 0x00, 0x51, 0x02, 0x90, 0x02, 0x9E, 0x05, 0xBB, 0x06, 0x07, 0x01, 0xE1,
-	0x00, 0x00, 0x02, 0x9B, 0xFF, 0xFF, 0x00, 0x36, 0x02, 0x9B, 0x02, 0xBC, 0x05, 0xB0, 0x06, 0x07,
-	0x02, 0x3A, 0x00, 0x00, 0x02, 0x9B, 0xFF, 0xFF, 0x00, 0x5C, 0x02, 0x90, 0x02, 0xA8, 0x05, 0xB0,
-	0x06, 0x07, 0x02, 0x3B, 0x00, 0x00, 0x02, 0x9B, 0xFF, 0xFF, 0x00, 0x56, 0x02, 0x90, 0x02, 0xAC,
-	0x05, 0xBA, 0x06, 0x07, 0x02, 0x3C, 0x00, 0x00, 0x02, 0x9B, 0xFF, 0xFF, 0x00, 0x3B, 0x02, 0x9B,
-	0x02, 0xA6, 0x05, 0xB0, 0x06, 0x07, 0x02, 0x3D, 0x00, 0x00, 0x02, 0x9B, 0xFF, 0xFF, 0x00, 0x4F,
-	0x02, 0x90, 0x02, 0x9F, 0x05, 0xBB, 0x06, 0x07, 0x02, 0x3E, 0x00, 0x00, 0x02, 0x9B, 0xFF, 0xFF,
-	0x00, 0x4A, 0x02, 0x94, 0x02, 0x95, 0x05, 0xBB, 0x06, 0x07, 0x02, 0x3F, 0x00, 0x00, 0x02, 0x9B,
-	0x00, 0x02, 0x00, 0x50, 0x02, 0x8F, 0x02, 0xE8, 0x05, 0x50, 0x00, 0x03, 0x00, 0x07, 0x00, 0x15,
-	0xB7, 0x06, 0x06, 0x02, 0x02, 0x03, 0x07, 0x07, 0x03, 0x00, 0x2F, 0x33, 0x2F, 0x11, 0x33, 0x11,
-	0x33, 0x7D, 0x2F, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x11, 0x23, 0x11, 0x02, 0xE8, 0xFD,
-	0x68, 0x01, 0x8E, 0x84, 0x04, 0x30, 0x82, 0x82, 0x01, 0x20, 0xFD, 0x3F, 0x02, 0xC1, 0x00, 0x01,
-	0x00, 0x50, 0x03, 0xB2, 0x02, 0xA8, 0x04, 0x34, 0x00, 0x03, 0x00, 0x08, 0xB1, 0x03, 0x02, 0x00,
-	0x2F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x02, 0xA8, 0xFD, 0xA8, 0x04, 0x34, 0x82, 0x82,
-	0x00, 0x02, 0x00, 0x50, 0x03, 0x36, 0x02, 0xA8, 0x04, 0xA5, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0C,
-	0xB3, 0x02, 0x03, 0x07, 0x06, 0x00, 0x2F, 0x33, 0xCE, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35,
-	0x25, 0x15, 0x21, 0x35, 0x02, 0xA8, 0xFD, 0xA8, 0x02, 0x58, 0xFD, 0xA8, 0x03, 0xB8, 0x82, 0x82,
-	0xED, 0x82, 0x82, 0x00, 0x00, 0x01, 0x00, 0x54, 0x01, 0x8F, 0x01, 0xA1, 0x06, 0x4D, 0x00, 0x15,
-	0x00, 0x0C, 0xB3, 0x10, 0x11, 0x06, 0x05, 0x00, 0x2F, 0x33, 0x2F, 0x33, 0x30, 0x31, 0x53, 0x35,
-	0x34, 0x36, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x17, 0x07, 0x2E, 0x03,
-	0x54, 0x5F, 0x84, 0x37, 0x33, 0x28, 0x4F, 0x34, 0x1E, 0x32, 0x3D, 0x1E, 0x33, 0x2A, 0x61, 0x57,
-	0x38, 0x03, 0xE5, 0x11, 0xA7, 0xF5, 0x9C, 0x1F, 0x74, 0x25, 0x7D, 0xBC, 0x84, 0x13, 0x6A, 0x9C,
-	0x72, 0x51, 0x1E, 0x6E, 0x17, 0x62, 0x97, 0xC9, 0x00, 0x01, 0x00, 0x50, 0x01, 0x8F, 0x01, 0x9D,
-	0x06, 0x4D, 0x00, 0x15, 0x00, 0x0C, 0xB3, 0x10, 0x11, 0x06, 0x05, 0x00, 0x2F, 0x33, 0x2F, 0x33,
-	0x30, 0x31, 0x41, 0x15, 0x14, 0x06, 0x06, 0x07, 0x27, 0x3E, 0x02, 0x35, 0x35, 0x34, 0x2E, 0x02,
-	0x27, 0x37, 0x1E, 0x03, 0x01, 0x9D, 0x5F, 0x84, 0x37, 0x33, 0x29, 0x4E, 0x34, 0x1E, 0x32, 0x3D,
-	0x1E, 0x33, 0x29, 0x61, 0x58, 0x38, 0x03, 0xF6, 0x11, 0xA7, 0xF6, 0x9A, 0x1F, 0x6E, 0x28, 0x77,
-	0xBB, 0x8D, 0x13, 0x63, 0x9B, 0x74, 0x54, 0x1C, 0x74, 0x17, 0x64, 0x96, 0xC9, 0x00, 0x00, 0x02,
-	0x00, 0x7A, 0x02, 0x8B, 0x02, 0xF9, 0x05, 0xBA, 0x00, 0x04, 0x00, 0x19, 0x00, 0x13, 0xB7, 0x16,
-	0x0B, 0x04, 0x04, 0x0B, 0x02, 0x11, 0x02, 0x00, 0x2F, 0x33, 0x3F, 0x33, 0x2F, 0x11, 0x33, 0x30,
-	0x31, 0x41, 0x11, 0x23, 0x11, 0x33, 0x13, 0x07, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15,
-	0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x01, 0x24, 0xAA, 0x81, 0x12, 0x2E,
-	0x26, 0x49, 0x67, 0x40, 0x4F, 0x75, 0x40, 0xAA, 0x24, 0x41, 0x2C, 0x3D, 0x4F, 0x25, 0x05, 0x00,
-	0xFD, 0x8B, 0x03, 0x20, 0xFE, 0x8B, 0x01, 0x54, 0x8E, 0x69, 0x3A, 0x3F, 0x88, 0x6C, 0xFE, 0x04,
-	0x01, 0xDC, 0x49, 0x55, 0x25, 0x41, 0x6E, 0x00, 0xFF, 0xFF, 0x00, 0x51, 0xFE, 0x85, 0x02, 0x9E,
-	0x01, 0xB0, 0x06, 0x07, 0x01, 0xE1, 0x00, 0x00, 0xFE, 0x90, 0xFF, 0xFF, 0x00, 0x7B, 0xFE, 0x91,
-	0x01, 0xEF, 0x01, 0xA6, 0x06, 0x07, 0x01, 0xE0, 0x00, 0x00, 0xFE, 0x91, 0xFF, 0xFF, 0x00, 0x42,
-	0xFE, 0x91, 0x02, 0xAB, 0x01, 0xB1, 0x06, 0x07, 0x01, 0xDF, 0x00, 0x00, 0xFE, 0x91, 0xFF, 0xFF,
-	0x00, 0x3F, 0xFE, 0x86, 0x02, 0x9B, 0x01, 0xB1, 0x06, 0x07, 0x02, 0x39, 0x00, 0x00, 0xFE, 0x91,
-	0xFF, 0xFF, 0x00, 0x36, 0xFE, 0x91, 0x02, 0xBC, 0x01, 0xA6, 0x06, 0x07, 0x02, 0x3A, 0x00, 0x00,
-	0xFE, 0x91, 0xFF, 0xFF, 0x00, 0x5C, 0xFE, 0x86, 0x02, 0xA8, 0x01, 0xA6, 0x06, 0x07, 0x02, 0x3B,
-	0x00, 0x00, 0xFE, 0x91, 0xFF, 0xFF, 0x00, 0x56, 0xFE, 0x86, 0x02, 0xAC, 0x01, 0xB0, 0x06, 0x07,
-	0x02, 0x3C, 0x00, 0x00, 0xFE, 0x91, 0xFF, 0xFF, 0x00, 0x3B, 0xFE, 0x91, 0x02, 0xA6, 0x01, 0xA6,
-	0x06, 0x07, 0x02, 0x3D, 0x00, 0x00, 0xFE, 0x91, 0xFF, 0xFF, 0x00, 0x4F, 0xFE, 0x86, 0x02, 0x9F,
-	0x01, 0xB1, 0x06, 0x07, 0x02, 0x3E, 0x00, 0x00, 0xFE, 0x91, 0xFF, 0xFF, 0x00, 0x4A, 0xFE, 0x8A,
-	0x02, 0x95, 0x01, 0xB1, 0x06, 0x07, 0x02, 0x3F, 0x00, 0x00, 0xFE, 0x91, 0xFF, 0xFF, 0x00, 0x50,
-	0xFE, 0xA9, 0x02, 0xE8, 0x01, 0x6A, 0x06, 0x07, 0x01, 0x9C, 0x00, 0x00, 0xFC, 0x1A, 0xFF, 0xFF,
-	0x00, 0x50, 0xFF, 0xCC, 0x02, 0xA8, 0x00, 0x4E, 0x06, 0x07, 0x01, 0x9D, 0x00, 0x00, 0xFC, 0x1A,
-	0xFF, 0xFF, 0x00, 0x50, 0xFF, 0x50, 0x02, 0xA8, 0x00, 0xBF, 0x06, 0x07, 0x01, 0x9E, 0x00, 0x00,
-	0xFC, 0x1A, 0x00, 0x01, 0x00, 0x54, 0xFD, 0xE7, 0x01, 0xA1, 0x02, 0x66, 0x00, 0x14, 0x00, 0x08,
-	0xB1, 0x05, 0x10, 0x00, 0x2F, 0x2F, 0x30, 0x31, 0x77, 0x35, 0x34, 0x36, 0x36, 0x37, 0x17, 0x0E,
-	0x02, 0x15, 0x15, 0x14, 0x16, 0x16, 0x17, 0x07, 0x2E, 0x03, 0x54, 0x5F, 0x84, 0x37, 0x33, 0x28,
-	0x4F, 0x34, 0x34, 0x4F, 0x28, 0x33, 0x2A, 0x61, 0x57, 0x38, 0x1E, 0x11, 0x9E, 0xE9, 0x93, 0x1D,
-	0x74, 0x22, 0x75, 0xAF, 0x7C, 0x13, 0x84, 0xAE, 0x6F, 0x26, 0x6F, 0x16, 0x5E, 0x8E, 0xBE, 0x00,
-	0x00, 0x01, 0x00, 0x50, 0xFD, 0xE9, 0x01, 0x9D, 0x02, 0x66, 0x00, 0x14, 0x00, 0x08, 0xB1, 0x10,
-	0x05, 0x00, 0x2F, 0x2F, 0x30, 0x31, 0x65, 0x15, 0x14, 0x06, 0x06, 0x07, 0x27, 0x3E, 0x02, 0x35,
-	0x35, 0x34, 0x26, 0x26, 0x27, 0x37, 0x1E, 0x03, 0x01, 0x9D, 0x5F, 0x84, 0x37, 0x33, 0x29, 0x4E,
-	0x34, 0x34, 0x4E, 0x29, 0x33, 0x2A, 0x61, 0x57, 0x38, 0x3A, 0x11, 0xA1, 0xED, 0x95, 0x1D, 0x6F,
-	0x26, 0x71, 0xB2, 0x87, 0x13, 0x79, 0xAB, 0x72, 0x21, 0x74, 0x15, 0x5C, 0x8C, 0xBB, 0x00, 0x04,
-	0x00, 0x5B, 0x00, 0x00, 0x04, 0x68, 0x05, 0xC4, 0x00, 0x03, 0x00, 0x1E, 0x00, 0x22, 0x00, 0x26,
-	0x00, 0x22, 0x40, 0x10, 0x22, 0x21, 0x25, 0x26, 0x26, 0x01, 0x1B, 0x17, 0x12, 0x05, 0x72, 0x09,
-	0x02, 0x02, 0x01, 0x0C, 0x00, 0x3F, 0x33, 0x11, 0x33, 0x2B, 0xCC, 0x33, 0x12, 0x39, 0x2F, 0x33,
-	0xCE, 0x32, 0x30, 0x31, 0x61, 0x21, 0x35, 0x21, 0x01, 0x13, 0x16, 0x06, 0x07, 0x27, 0x3E, 0x02,
-	0x35, 0x03, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22,
-	0x06, 0x06, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x04, 0x68, 0xFB, 0xF7, 0x04, 0x09,
-	0xFD, 0x4B, 0x16, 0x01, 0x38, 0x38, 0xAE, 0x23, 0x29, 0x11, 0x16, 0x74, 0xC9, 0x7F, 0x83, 0xB8,
-	0x62, 0xC0, 0x43, 0x6C, 0x3E, 0x42, 0x6B, 0x3F, 0x01, 0x63, 0xFD, 0x45, 0x02, 0xBB, 0xFD, 0x45,
-	0x9D, 0x03, 0x72, 0xFD, 0x83, 0x5E, 0xA3, 0x29, 0x35, 0x09, 0x53, 0x6C, 0x2C, 0x02, 0x7E, 0x8A,
-	0xC3, 0x68, 0x62, 0xAF, 0x74, 0x54, 0x66, 0x2E, 0x41, 0x7D, 0xFE, 0xF0, 0x7D, 0x7D, 0xFE, 0xFA,
-	0x7D, 0x7D, 0x00, 0x03, 0x00, 0x1F, 0x00, 0x00, 0x06, 0x37, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x07,
-	0x00, 0x11, 0x00, 0x22, 0x40, 0x10, 0x03, 0x02, 0x06, 0x0B, 0x0E, 0x10, 0x07, 0x07, 0x0D, 0x11,
-	0x0E, 0x04, 0x72, 0x0A, 0x0D, 0x0C, 0x00, 0x3F, 0x33, 0x2B, 0x32, 0x12, 0x39, 0x2F, 0x39, 0x12,
-	0x39, 0x33, 0xCE, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x11,
-	0x23, 0x01, 0x11, 0x23, 0x11, 0x33, 0x01, 0x11, 0x06, 0x37, 0xF9, 0xE8, 0x06, 0x18, 0xF9, 0xE8,
-	0x05, 0x38, 0xC1, 0xFD, 0x23, 0xC1, 0xC1, 0x02, 0xE0, 0x03, 0xAD, 0x98, 0x98, 0xFE, 0xD4, 0x98,
-	0x98, 0x03, 0x2F, 0xFA, 0x50, 0x04, 0x63, 0xFB, 0x9D, 0x05, 0xB0, 0xFB, 0x9A, 0x04, 0x66, 0x00,
-	0x00, 0x03, 0x00, 0xA7, 0xFF, 0xEC, 0x06, 0x03, 0x05, 0xB0, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x2D,
-	0x00, 0x23, 0x40, 0x12, 0x22, 0x29, 0x0D, 0x1C, 0x19, 0x18, 0x06, 0x72, 0x02, 0x01, 0x01, 0x0E,
-	0x0C, 0x0F, 0x04, 0x72, 0x0E, 0x0C, 0x00, 0x3F, 0x2B, 0x32, 0x12, 0x39, 0x2F, 0x33, 0x2B, 0x32,
-	0xCC, 0x3F, 0x33, 0x30, 0x31, 0x41, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
-	0x23, 0x23, 0x11, 0x23, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x01, 0x15, 0x21,
-	0x35, 0x13, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22,
-	0x26, 0x26, 0x35, 0x02, 0x21, 0xEA, 0xEA, 0x74, 0x77, 0x2A, 0x2A, 0x77, 0x74, 0xC1, 0xB9, 0x01,
-	0x7A, 0xA5, 0xCC, 0x5E, 0x5E, 0xCC, 0x03, 0x38, 0xFD, 0xB8, 0xC5, 0xB9, 0x22, 0x36, 0x1F, 0x17,
-	0x33, 0x0D, 0x01, 0x16, 0x47, 0x31, 0x44, 0x72, 0x44, 0x02, 0x35, 0x98, 0x54, 0x86, 0x4A, 0x4B,
-	0x87, 0x55, 0xFA, 0xE8, 0x05, 0xB0, 0x74, 0xC9, 0x80, 0x80, 0xCA, 0x74, 0x02, 0x05, 0x8E, 0x8E,
-	0x01, 0x07, 0xFB, 0xCB, 0x37, 0x38, 0x12, 0x09, 0x03, 0x97, 0x07, 0x0D, 0x36, 0x7F, 0x6C, 0x00,
-	0xFF, 0xFF, 0x00, 0xA9, 0xFF, 0xEC, 0x08, 0x11, 0x05, 0xB0, 0x04, 0x26, 0x00, 0x36, 0x00, 0x00,
-	0x00, 0x07, 0x00, 0x57, 0x04, 0x55, 0x00, 0x00, 0x00, 0x06, 0x00, 0x1F, 0x00, 0x00, 0x05, 0xCC,
-	0x05, 0xB0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0D, 0x00, 0x12, 0x00, 0x17, 0x00, 0x1D, 0x00, 0x2A,
-	0x40, 0x14, 0x1D, 0x15, 0x0A, 0x0A, 0x12, 0x06, 0x07, 0x03, 0x02, 0x02, 0x11, 0x12, 0x04, 0x72,
-	0x13, 0x1B, 0x1B, 0x08, 0x11, 0x0C, 0x00, 0x3F, 0x33, 0x33, 0x11, 0x33, 0x2B, 0x12, 0x39, 0x2F,
-	0x33, 0xCE, 0x32, 0x11, 0x33, 0x11, 0x33, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x15,
-	0x21, 0x35, 0x01, 0x13, 0x13, 0x33, 0x03, 0x03, 0x01, 0x13, 0x13, 0x23, 0x01, 0x01, 0x13, 0x13,
-	0x33, 0x01, 0x01, 0x13, 0x13, 0x23, 0x03, 0x03, 0x05, 0xCC, 0xFA, 0x53, 0x05, 0xAD, 0xFA, 0x53,
-	0x01, 0x8B, 0x43, 0xB1, 0x83, 0x43, 0xB4, 0xFE, 0xD3, 0xBB, 0x35, 0x7B, 0xFE, 0xCB, 0x03, 0xC3,
-	0x34, 0xB6, 0xC1, 0xFE, 0xCA, 0xFE, 0xDD, 0xB1, 0x40, 0x86, 0xAE, 0x3F, 0x03, 0xD4, 0x97, 0x97,
-	0xFE, 0xA6, 0x97, 0x97, 0xFD, 0x86, 0x01, 0xD8, 0x03, 0xD8, 0xFE, 0x27, 0xFC, 0x29, 0x05, 0xB0,
-	0xFC, 0x2C, 0xFE, 0x24, 0x05, 0xB0, 0xFA, 0x50, 0x01, 0xDD, 0x03, 0xD3, 0xFA, 0x50, 0x05, 0xB0,
-	0xFC, 0x2B, 0xFE, 0x25, 0x03, 0xDB, 0x01, 0xD5, 0x00, 0x02, 0x00, 0x8C, 0x00, 0x00, 0x05, 0x9F,
-	0x04, 0x3A, 0x00, 0x11, 0x00, 0x22, 0x00, 0x20, 0x40, 0x0F, 0x16, 0x13, 0x13, 0x11, 0x14, 0x08,
-	0x14, 0x08, 0x11, 0x0A, 0x1C, 0x0F, 0x00, 0x06, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x3F, 0x39, 0x39,
-	0x2F, 0x2F, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x53, 0x21, 0x32, 0x1E, 0x02, 0x15, 0x11, 0x23,
-	0x11, 0x34, 0x2E, 0x02, 0x23, 0x21, 0x11, 0x23, 0x21, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36,
-	0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x0E, 0x02, 0x8C, 0x02, 0x2F, 0x50, 0x80, 0x5B, 0x30, 0xBA,
-	0x1C, 0x37, 0x50, 0x35, 0xFE, 0xC2, 0xBA, 0x03, 0xB8, 0xFD, 0xD2, 0xB9, 0x01, 0x3E, 0x47, 0x60,
-	0x32, 0xB9, 0x30, 0x5B, 0x80, 0x04, 0x3A, 0x2B, 0x5E, 0x9B, 0x70, 0xFE, 0xB7, 0x01, 0x4B, 0x45,
-	0x60, 0x3B, 0x1A, 0xFC, 0x5E, 0x02, 0xDE, 0xFD, 0xBA, 0x30, 0x6E, 0x5C, 0x02, 0xA8, 0xFD, 0x5A,
-	0x70, 0x9B, 0x5E, 0x2B, 0x00, 0x03, 0x00, 0x5F, 0xFF, 0xEC, 0x04, 0x1D, 0x05, 0xC4, 0x00, 0x23,
-	0x00, 0x27, 0x00, 0x2B, 0x00, 0x1D, 0x40, 0x0E, 0x2A, 0x2B, 0x27, 0x26, 0x26, 0x07, 0x19, 0x12,
-	0x05, 0x72, 0x00, 0x07, 0x0D, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x12, 0x39, 0x2F, 0x33, 0xCE,
-	0x32, 0x30, 0x31, 0x65, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x11,
-	0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x11,
-	0x14, 0x1E, 0x02, 0x13, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x03, 0x2F, 0x3A, 0x6E, 0x32,
-	0x14, 0x38, 0x7A, 0x3E, 0x77, 0xC6, 0x90, 0x4F, 0x4E, 0x90, 0xC5, 0x78, 0x3F, 0x75, 0x3D, 0x14,
-	0x31, 0x70, 0x3A, 0x50, 0x81, 0x5B, 0x30, 0x31, 0x5C, 0x81, 0x72, 0xFD, 0x0D, 0x02, 0xF3, 0xFD,
-	0x0D, 0x88, 0x12, 0x10, 0xA0, 0x0E, 0x10, 0x49, 0x91, 0xD9, 0x91, 0x01, 0x4D, 0x92, 0xDA, 0x92,
-	0x49, 0x11, 0x0E, 0xA1, 0x10, 0x13, 0x34, 0x68, 0xA0, 0x6C, 0xFE, 0xB1, 0x6C, 0xA0, 0x68, 0x34,
-	0x03, 0x17, 0x7D, 0x7D, 0xFE, 0xFB, 0x7C, 0x7C, 0x00, 0x03, 0x00, 0x1F, 0x00, 0x00, 0x05, 0xBC,
-	0x05, 0xB0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1F, 0x00, 0x29, 0x40, 0x13, 0x06, 0x07, 0x03, 0x02,
-	0x02, 0x14, 0x0A, 0x14, 0x17, 0x09, 0x0A, 0x0A, 0x16, 0x17, 0x04, 0x72, 0x16, 0x0C, 0x72, 0x00,
-	0x2B, 0x2B, 0x12, 0x39, 0x7D, 0x2F, 0x33, 0x11, 0x33, 0x11, 0x12, 0x39, 0x18, 0x2F, 0x33, 0xCE,
-	0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x05, 0x15, 0x21, 0x35, 0x01, 0x21, 0x35, 0x21, 0x32,
-	0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x11, 0x23, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15,
-	0x14, 0x06, 0x06, 0x05, 0xBC, 0xFA, 0x63, 0x05, 0x9D, 0xFA, 0x63, 0x02, 0xDF, 0xFE, 0x7B, 0x01,
-	0x85, 0x71, 0x8C, 0x41, 0x41, 0x8C, 0x71, 0xFE, 0xA8, 0xC1, 0x02, 0x19, 0xA5, 0xE4, 0x76, 0x76,
-	0xE4, 0x04, 0xBD, 0x98, 0x98, 0xF5, 0x98, 0x98, 0xFE, 0x73, 0x9D, 0x48, 0x80, 0x52, 0x4B, 0x84,
-	0x51, 0xFA, 0xEE, 0x05, 0xB0, 0x72, 0xC9, 0x81, 0x8C, 0xC6, 0x67, 0x00, 0x00, 0x03, 0x00, 0x2B,
-	0x00, 0x00, 0x03, 0xF9, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x1C, 0x00, 0x20, 0x00, 0x2D, 0x40, 0x15,
-	0x1F, 0x20, 0x20, 0x11, 0x03, 0x02, 0x05, 0x06, 0x06, 0x1A, 0x02, 0x1A, 0x02, 0x1A, 0x04, 0x10,
-	0x11, 0x04, 0x72, 0x04, 0x0C, 0x00, 0x3F, 0x2B, 0x32, 0x12, 0x39, 0x39, 0x7D, 0x2F, 0x2F, 0x11,
-	0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x07, 0x21, 0x37, 0x01,
-	0x01, 0x27, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x37, 0x33, 0x32, 0x16,
-	0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x01, 0x15, 0x13, 0x07, 0x21, 0x37, 0x03, 0xF9, 0x2E, 0xFC,
-	0x60, 0x2E, 0x02, 0x00, 0xFD, 0xEF, 0x01, 0xF4, 0x6A, 0x8B, 0x46, 0x42, 0x8D, 0x72, 0xFE, 0xF8,
-	0x2F, 0xD9, 0xAE, 0xE3, 0x70, 0x5D, 0xD5, 0xB4, 0x01, 0xEC, 0xBD, 0x2E, 0xFD, 0x14, 0x2E, 0x04,
-	0x4C, 0x9E, 0x9E, 0xFB, 0xB4, 0x02, 0x6A, 0x7C, 0x47, 0x7A, 0x4C, 0x55, 0x81, 0x49, 0x9E, 0x69,
-	0xC8, 0x8E, 0x7A, 0xC1, 0x6E, 0xFD, 0xC4, 0x0C, 0x05, 0xB0, 0x9E, 0x9E, 0x00, 0x04, 0x00, 0x21,
-	0xFF, 0xED, 0x04, 0x1B, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x14, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x15,
-	0x40, 0x09, 0x04, 0x04, 0x03, 0x0F, 0x01, 0x0B, 0x0D, 0x03, 0x04, 0x00, 0x3F, 0x3F, 0x33, 0x33,
-	0x12, 0x39, 0x2F, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x33, 0x15, 0x14, 0x02, 0x06, 0x06,
-	0x23, 0x22, 0x26, 0x27, 0x37, 0x32, 0x3E, 0x02, 0x35, 0x03, 0x15, 0x01, 0x35, 0x05, 0x15, 0x01,
-	0x35, 0x01, 0xD5, 0xC0, 0x02, 0x47, 0xBF, 0x53, 0x9A, 0xD8, 0x85, 0x2F, 0x5D, 0x30, 0xBC, 0x60,
-	0x93, 0x64, 0x34, 0x8C, 0xFD, 0x51, 0x02, 0xAF, 0xFD, 0x51, 0x05, 0xB0, 0xFA, 0x50, 0x05, 0xB0,
-	0xFD, 0x53, 0x58, 0xA3, 0xFE, 0xFC, 0xB7, 0x60, 0x0B, 0x08, 0x91, 0x45, 0x88, 0xC9, 0x84, 0x02,
-	0x78, 0xB2, 0xFE, 0xC6, 0xB2, 0x12, 0xB1, 0xFE, 0xC6, 0xB1, 0x00, 0x02, 0x00, 0x5D, 0x00, 0x00,
-	0x04, 0xEB, 0x04, 0x3A, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x18, 0x40, 0x0B, 0x08, 0x15, 0x15, 0x1E,
-	0x1F, 0x06, 0x72, 0x0E, 0x01, 0x1E, 0x0A, 0x00, 0x3F, 0x33, 0x33, 0x2B, 0x12, 0x39, 0x2F, 0x33,
-	0x30, 0x31, 0x61, 0x23, 0x35, 0x34, 0x2E, 0x03, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x23, 0x35,
-	0x34, 0x12, 0x36, 0x36, 0x33, 0x32, 0x1E, 0x03, 0x15, 0x01, 0x11, 0x23, 0x11, 0x04, 0xEB, 0xB9,
-	0x22, 0x43, 0x61, 0x7D, 0x4C, 0x5A, 0x92, 0x68, 0x38, 0xBA, 0x55, 0x9B, 0xD5, 0x81, 0x6A, 0xB5,
-	0x8F, 0x65, 0x35, 0xFE, 0x15, 0xBA, 0xBC, 0x69, 0xAB, 0x81, 0x58, 0x2C, 0x45, 0x88, 0xC8, 0x84,
-	0xBC, 0xBA, 0xA4, 0x01, 0x04, 0xB6, 0x60, 0x3E, 0x77, 0xAB, 0xDB, 0x83, 0x03, 0x80, 0xFB, 0xC6,
-	0x04, 0x3A, 0x00, 0x02, 0x00, 0x1F, 0x00, 0x00, 0x05, 0x04, 0x05, 0xB0, 0x00, 0x17, 0x00, 0x1B,
-	0x00, 0x1A, 0x40, 0x0C, 0x19, 0x18, 0x03, 0x00, 0x00, 0x0E, 0x0C, 0x0F, 0x04, 0x72, 0x0E, 0x0C,
-	0x00, 0x3F, 0x2B, 0x32, 0x12, 0x39, 0x2F, 0x33, 0xCE, 0x32, 0x30, 0x31, 0x41, 0x21, 0x35, 0x21,
-	0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x11, 0x23, 0x11, 0x21, 0x32, 0x16, 0x16,
-	0x15, 0x14, 0x06, 0x06, 0x07, 0x15, 0x21, 0x35, 0x03, 0x08, 0xFD, 0x17, 0x02, 0xE9, 0x6D, 0x8C,
-	0x43, 0x3F, 0x8B, 0x72, 0xFE, 0xA6, 0xC0, 0x02, 0x1A, 0xA5, 0xE2, 0x75, 0x75, 0xE2, 0xB1, 0xFD,
-	0x23, 0x02, 0x3B, 0x9D, 0x46, 0x80, 0x57, 0x47, 0x82, 0x54, 0xFA, 0xEE, 0x05, 0xB0, 0x71, 0xC7,
-	0x81, 0x8C, 0xC7, 0x69, 0x89, 0x9E, 0x9E, 0x00, 0x00, 0x04, 0x00, 0x7B, 0xFF, 0xEB, 0x05, 0x83,
-	0x05, 0xC5, 0x00, 0x21, 0x00, 0x33, 0x00, 0x45, 0x00, 0x49, 0x00, 0x25, 0x40, 0x12, 0x42, 0x27,
-	0x30, 0x47, 0x47, 0x39, 0x30, 0x0D, 0x72, 0x1F, 0x05, 0x0E, 0x49, 0x49, 0x16, 0x0E, 0x05, 0x72,
-	0x00, 0x2B, 0x32, 0x32, 0x2F, 0x10, 0xCC, 0x32, 0x2B, 0x32, 0x32, 0x2F, 0x10, 0xCC, 0x32, 0x30,
-	0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x35, 0x34, 0x36, 0x36, 0x33,
-	0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x15, 0x14, 0x16, 0x16,
-	0x33, 0x32, 0x36, 0x01, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x06,
-	0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x35,
-	0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x13, 0x01, 0x27, 0x01, 0x02, 0x1E, 0x8B, 0x42, 0x7B,
-	0x57, 0x57, 0x7E, 0x45, 0x44, 0x7E, 0x56, 0x57, 0x7C, 0x43, 0x8B, 0x44, 0x47, 0x2F, 0x3F, 0x1F,
-	0x20, 0x40, 0x2F, 0x47, 0x42, 0x01, 0x10, 0x48, 0x86, 0x5C, 0x5E, 0x85, 0x48, 0x47, 0x85, 0x5D,
-	0x5D, 0x86, 0x49, 0x8B, 0x23, 0x48, 0x36, 0x36, 0x47, 0x22, 0x23, 0x47, 0x37, 0x35, 0x47, 0x23,
-	0xCC, 0xFD, 0x39, 0x68, 0x02, 0xC7, 0x04, 0x1E, 0x45, 0x74, 0x45, 0x52, 0x88, 0x51, 0x4D, 0x53,
-	0x88, 0x52, 0x46, 0x74, 0x46, 0x35, 0x53, 0x33, 0x53, 0x2F, 0x4D, 0x2E, 0x52, 0x33, 0x57, 0xFD,
-	0x28, 0x4E, 0x52, 0x88, 0x52, 0x52, 0x88, 0x52, 0x4E, 0x52, 0x88, 0x52, 0x52, 0x88, 0xA0, 0x4E,
-	0x2E, 0x53, 0x33, 0x33, 0x52, 0x2F, 0x4E, 0x2F, 0x52, 0x33, 0x33, 0x52, 0x03, 0x4D, 0xFB, 0x8E,
-	0x42, 0x04, 0x72, 0x00, 0x00, 0x01, 0x00, 0x68, 0xFF, 0xEB, 0x03, 0x6B, 0x06, 0x13, 0x00, 0x2E,
-	0x00, 0x14, 0xB7, 0x19, 0x18, 0x18, 0x01, 0x24, 0x0C, 0x00, 0x01, 0x00, 0x2F, 0x33, 0x2F, 0x33,
-	0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x65, 0x15, 0x22, 0x2E, 0x02, 0x35, 0x11, 0x34, 0x3E, 0x02,
-	0x33, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14, 0x0E, 0x03, 0x23, 0x35, 0x32, 0x3E, 0x02, 0x35, 0x35,
-	0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x11, 0x14, 0x1E, 0x02, 0x02, 0xCC, 0x66, 0x98,
-	0x64, 0x32, 0x28, 0x4C, 0x6C, 0x44, 0x3B, 0x62, 0x4A, 0x28, 0x42, 0x80, 0xBB, 0xF2, 0x94, 0x9A,
-	0xDE, 0x8D, 0x44, 0x0C, 0x17, 0x1F, 0x13, 0x1B, 0x27, 0x1B, 0x0D, 0x16, 0x32, 0x54, 0x89, 0x9E,
-	0x40, 0x77, 0xA7, 0x66, 0x02, 0xE9, 0x59, 0x8C, 0x62, 0x34, 0x2B, 0x53, 0x74, 0x4A, 0x29, 0x67,
-	0xD9, 0xCA, 0xA1, 0x5F, 0xB0, 0x75, 0xB9, 0xD0, 0x5A, 0x2B, 0x29, 0x3C, 0x26, 0x13, 0x1B, 0x38,
-	0x52, 0x38, 0xFD, 0x17, 0x45, 0x6C, 0x4D, 0x28, 0x00, 0x04, 0x00, 0xA2, 0x00, 0x00, 0x07, 0xC6,
-	0x05, 0xC0, 0x00, 0x03, 0x00, 0x15, 0x00, 0x27, 0x00, 0x31, 0x00, 0x25, 0x40, 0x11, 0x2B, 0x30,
-	0x2E, 0x2A, 0x02, 0x03, 0x1B, 0x12, 0x24, 0x09, 0x09, 0x31, 0x2E, 0x04, 0x2A, 0x2D, 0x0C, 0x00,
-	0x3F, 0x33, 0x3F, 0x33, 0x33, 0x2F, 0x33, 0xDC, 0x32, 0xCE, 0x32, 0x11, 0x12, 0x39, 0x39, 0x30,
-	0x31, 0x41, 0x15, 0x21, 0x35, 0x03, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x15,
-	0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-	0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x01, 0x11, 0x23, 0x01, 0x11, 0x23, 0x11,
-	0x33, 0x01, 0x11, 0x07, 0xA5, 0xFD, 0x98, 0x23, 0x54, 0x99, 0x69, 0x6A, 0x99, 0x53, 0x52, 0x99,
-	0x69, 0x6A, 0x9A, 0x54, 0xA3, 0x27, 0x51, 0x3D, 0x3C, 0x4F, 0x27, 0x28, 0x4F, 0x3D, 0x3C, 0x50,
-	0x27, 0xFE, 0xBC, 0xCC, 0xFD, 0xAF, 0xBA, 0xCC, 0x02, 0x53, 0x02, 0x2B, 0x8E, 0x8E, 0x01, 0xDA,
-	0x63, 0x67, 0x9B, 0x56, 0x56, 0x9B, 0x67, 0x63, 0x67, 0x9A, 0x56, 0x56, 0x9A, 0xCA, 0x63, 0x3D,
-	0x5C, 0x33, 0x33, 0x5C, 0x3D, 0x63, 0x3C, 0x5C, 0x34, 0x34, 0x5C, 0x01, 0x0C, 0xFA, 0x50, 0x04,
-	0x6E, 0xFB, 0x92, 0x05, 0xB0, 0xFB, 0x8F, 0x04, 0x71, 0x00, 0x00, 0x02, 0x00, 0x68, 0x03, 0x97,
-	0x04, 0x38, 0x05, 0xB0, 0x00, 0x0C, 0x00, 0x14, 0x00, 0x24, 0x40, 0x11, 0x09, 0x04, 0x01, 0x03,
-	0x06, 0x0A, 0x07, 0x07, 0x13, 0x14, 0x02, 0x00, 0x03, 0x03, 0x06, 0x06, 0x11, 0x00, 0x2F, 0x33,
-	0x11, 0x33, 0x11, 0x33, 0x3F, 0x33, 0x33, 0x11, 0x33, 0x12, 0x17, 0x39, 0x30, 0x31, 0x41, 0x11,
-	0x03, 0x23, 0x03, 0x11, 0x23, 0x11, 0x33, 0x13, 0x13, 0x33, 0x11, 0x01, 0x15, 0x23, 0x11, 0x23,
-	0x11, 0x23, 0x35, 0x03, 0xDE, 0x8B, 0x34, 0x8C, 0x5A, 0x70, 0x90, 0x8F, 0x70, 0xFD, 0xB2, 0x94,
-	0x5B, 0x93, 0x03, 0x97, 0x01, 0x8B, 0xFE, 0x75, 0x01, 0x8A, 0xFE, 0x76, 0x02, 0x19, 0xFE, 0x72,
-	0x01, 0x8E, 0xFD, 0xE7, 0x02, 0x19, 0x51, 0xFE, 0x38, 0x01, 0xC8, 0x51, 0x00, 0x02, 0x00, 0x98,
-	0xFF, 0xEC, 0x04, 0x93, 0x04, 0x4E, 0x00, 0x1D, 0x00, 0x26, 0x00, 0x17, 0x40, 0x0A, 0x22, 0x17,
-	0x17, 0x04, 0x1E, 0x0E, 0x07, 0x1B, 0x04, 0x0B, 0x00, 0x3F, 0x33, 0x3F, 0x33, 0x12, 0x39, 0x2F,
-	0x33, 0x30, 0x31, 0x65, 0x17, 0x06, 0x06, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33,
-	0x32, 0x1E, 0x02, 0x15, 0x14, 0x14, 0x15, 0x21, 0x11, 0x16, 0x16, 0x33, 0x32, 0x36, 0x01, 0x22,
-	0x06, 0x07, 0x11, 0x21, 0x11, 0x26, 0x26, 0x04, 0x14, 0x02, 0x54, 0xBC, 0x62, 0x6D, 0xBE, 0x90,
-	0x51, 0x59, 0x96, 0xBB, 0x62, 0x67, 0xB3, 0x88, 0x4D, 0xFD, 0x00, 0x37, 0x8C, 0x4E, 0x5D, 0xBB,
-	0xFE, 0xE8, 0x4B, 0x8D, 0x39, 0x02, 0x1C, 0x34, 0x8A, 0xC6, 0x68, 0x34, 0x3E, 0x58, 0x9A, 0xCC,
-	0x73, 0x74, 0xCB, 0x9A, 0x58, 0x51, 0x92, 0xC5, 0x75, 0x03, 0x12, 0x1A, 0xFE, 0xB8, 0x33, 0x3B,
-	0x3B, 0x03, 0x69, 0x42, 0x38, 0xFE, 0xEB, 0x01, 0x1E, 0x34, 0x3D, 0x00, 0xFF, 0xFF, 0x00, 0x54,
-	0xFF, 0xF5, 0x05, 0xB3, 0x05, 0x9B, 0x04, 0x27, 0x01, 0xE0, 0xFF, 0xD9, 0x02, 0x86, 0x00, 0x27,
-	0x01, 0x94, 0x00, 0xE6, 0x00, 0x00, 0x01, 0x07, 0x02, 0x3E, 0x03, 0x14, 0x00, 0x00, 0x00, 0x07,
-	0xB1, 0x06, 0x04, 0x00, 0x3F, 0x30, 0x31, 0x00, 0xFF, 0xFF, 0x00, 0x65, 0xFF, 0xF5, 0x06, 0x53,
-	0x05, 0xB4, 0x04, 0x27, 0x02, 0x39, 0x00, 0x26, 0x02, 0x94, 0x00, 0x27, 0x01, 0x94, 0x01, 0xA5,
-	0x00, 0x00, 0x00, 0x07, 0x02, 0x3E, 0x03, 0xB4, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x64, 0xFF, 0xF5,
-	0x06, 0x49, 0x05, 0xA4, 0x04, 0x27, 0x02, 0x3B, 0x00, 0x08, 0x02, 0x8F, 0x00, 0x27, 0x01, 0x94,
-	0x01, 0x83, 0x00, 0x00, 0x01, 0x07, 0x02, 0x3E, 0x03, 0xAA, 0x00, 0x00, 0x00, 0x07, 0xB1, 0x02,
-	0x04, 0x00, 0x3F, 0x30, 0x31, 0x00, 0xFF, 0xFF, 0x00, 0x5A, 0xFF, 0xF5, 0x05, 0xFD, 0x05, 0xA4,
-	0x04, 0x27, 0x02, 0x3D, 0x00, 0x1F, 0x02, 0x8F, 0x00, 0x27, 0x01, 0x94, 0x01, 0x20, 0x00, 0x00,
-	0x01, 0x07, 0x02, 0x3E, 0x03, 0x5E, 0x00, 0x00, 0x00, 0x07, 0xB1, 0x06, 0x04, 0x00, 0x3F, 0x30,
-	0x31, 0x00, 0x00, 0x02, 0x00, 0x6A, 0xFF, 0xEB, 0x04, 0x33, 0x05, 0xEC, 0x00, 0x29, 0x00, 0x3F,
-	0x00, 0x19, 0x40, 0x0C, 0x2A, 0x00, 0x00, 0x12, 0x35, 0x1F, 0x0B, 0x72, 0x09, 0x12, 0x00, 0x72,
-	0x00, 0x2B, 0x32, 0x2B, 0x32, 0x11, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x32, 0x16, 0x17, 0x2E,
-	0x04, 0x23, 0x22, 0x06, 0x06, 0x07, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x12, 0x15, 0x15,
-	0x14, 0x0E, 0x03, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x17, 0x22, 0x0E, 0x02,
-	0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x2E, 0x03, 0x02, 0x3D, 0x5C,
-	0xA6, 0x3A, 0x08, 0x30, 0x47, 0x5B, 0x69, 0x39, 0x35, 0x5E, 0x5B, 0x2F, 0x10, 0x25, 0x56, 0x72,
-	0x50, 0x6E, 0xB0, 0x84, 0x58, 0x2C, 0x2A, 0x52, 0x76, 0x98, 0x5C, 0x72, 0xB3, 0x7D, 0x41, 0x3F,
-	0x79, 0xAD, 0x80, 0x4D, 0x71, 0x49, 0x24, 0x24, 0x48, 0x71, 0x4C, 0x4E, 0x71, 0x4A, 0x24, 0x05,
-	0x26, 0x46, 0x6D, 0x03, 0xFE, 0x4D, 0x43, 0x58, 0x94, 0x75, 0x51, 0x2B, 0x0E, 0x1A, 0x12, 0x96,
-	0x11, 0x1F, 0x15, 0x4B, 0x8F, 0xCB, 0xFF, 0x00, 0x96, 0x3B, 0x6F, 0xC5, 0xA1, 0x76, 0x40, 0x50,
-	0x8F, 0xC1, 0x71, 0x16, 0x69, 0xB4, 0x85, 0x4A, 0x98, 0x37, 0x5F, 0x7A, 0x44, 0x16, 0x4C, 0x88,
-	0x69, 0x3C, 0x47, 0x7E, 0xA8, 0x61, 0x43, 0x19, 0x47, 0x44, 0x2E, 0x00, 0x00, 0x01, 0x00, 0xA9,
-	0xFF, 0x2B, 0x04, 0xE6, 0x05, 0xB0, 0x00, 0x07, 0x00, 0x0E, 0xB5, 0x04, 0x07, 0x02, 0x72, 0x02,
-	0x06, 0x00, 0x2F, 0x33, 0x2B, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11,
-	0x04, 0xE6, 0xBA, 0xFD, 0x37, 0xBA, 0x05, 0xB0, 0xF9, 0x7B, 0x05, 0xED, 0xFA, 0x13, 0x06, 0x85,
-	0x00, 0x03, 0x00, 0x46, 0xFE, 0xF3, 0x04, 0xAC, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x10,
-	0x00, 0x1F, 0x40, 0x0E, 0x0E, 0x06, 0x06, 0x07, 0x07, 0x0F, 0x02, 0x72, 0x0C, 0x03, 0x03, 0x0A,
-	0x02, 0x0B, 0x00, 0x2F, 0x33, 0x33, 0x33, 0x11, 0x33, 0x2B, 0x32, 0x11, 0x33, 0x11, 0x33, 0x30,
-	0x31, 0x45, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x01, 0x23, 0x35, 0x01, 0x01,
-	0x35, 0x33, 0x04, 0xAC, 0xFB, 0xE3, 0x03, 0xD0, 0xFC, 0x0E, 0x02, 0xFE, 0xFD, 0x3D, 0x62, 0x02,
-	0x60, 0xFD, 0xA0, 0x62, 0x76, 0x97, 0x97, 0x06, 0x26, 0x97, 0x97, 0xFC, 0xAA, 0x19, 0xFC, 0xB2,
-	0x8E, 0x02, 0xCD, 0x02, 0xD3, 0x8F, 0x00, 0x01, 0x00, 0xA8, 0x02, 0x8B, 0x03, 0xEB, 0x03, 0x23,
-	0x00, 0x03, 0x00, 0x08, 0xB1, 0x03, 0x02, 0x00, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35,
-	0x03, 0xEB, 0xFC, 0xBD, 0x03, 0x23, 0x98, 0x98, 0x00, 0x03, 0x00, 0x3F, 0xFF, 0xFF, 0x04, 0x99,
-	0x05, 0xB0, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x16, 0x40, 0x0A, 0x09, 0x0B, 0x0B, 0x0A,
-	0x04, 0x08, 0x08, 0x01, 0x02, 0x72, 0x00, 0x2B, 0x3F, 0x33, 0x2F, 0x33, 0x11, 0x33, 0x30, 0x31,
-	0x65, 0x01, 0x33, 0x01, 0x23, 0x03, 0x13, 0x17, 0x23, 0x01, 0x07, 0x35, 0x21, 0x15, 0x02, 0x23,
-	0x01, 0xB8, 0xBE, 0xFD, 0xE2, 0x7B, 0x86, 0xC5, 0x29, 0x7A, 0xFE, 0xCF, 0x7E, 0x01, 0x33, 0xF6,
-	0x04, 0xBA, 0xFA, 0x4F, 0x03, 0x0F, 0xFD, 0xE8, 0xF7, 0x03, 0x0F, 0x99, 0x99, 0x99, 0x00, 0x04,
-	0x00, 0x63, 0xFF, 0xEB, 0x07, 0xCC, 0x04, 0x4E, 0x00, 0x17, 0x00, 0x2F, 0x00, 0x47, 0x00, 0x5F,
-	0x00, 0x1D, 0x40, 0x0E, 0x5B, 0x36, 0x36, 0x1E, 0x13, 0x0B, 0x72, 0x4E, 0x43, 0x43, 0x2B, 0x06,
-	0x07, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x53,
-	0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x03, 0x17, 0x15, 0x0E, 0x04, 0x23, 0x22, 0x2E, 0x02,
-	0x37, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x03, 0x37, 0x35, 0x2E, 0x04, 0x23, 0x22, 0x0E,
-	0x02, 0x05, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x03, 0x27, 0x35, 0x3E, 0x04, 0x33, 0x32,
-	0x1E, 0x02, 0x07, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x03, 0x07, 0x15, 0x1E, 0x04, 0x33,
-	0x32, 0x3E, 0x02, 0x63, 0x45, 0x80, 0xB2, 0x6D, 0x6C, 0xA3, 0x77, 0x50, 0x31, 0x0D, 0x0D, 0x31,
-	0x50, 0x76, 0xA3, 0x6B, 0x6E, 0xB3, 0x80, 0x45, 0xB9, 0x27, 0x4D, 0x70, 0x49, 0x47, 0x6F, 0x54,
-	0x39, 0x22, 0x06, 0x06, 0x22, 0x39, 0x54, 0x71, 0x47, 0x48, 0x70, 0x4C, 0x27, 0x06, 0xB0, 0x46,
-	0x80, 0xB3, 0x6D, 0x6B, 0xA3, 0x77, 0x50, 0x31, 0x0C, 0x0D, 0x31, 0x50, 0x77, 0xA3, 0x6C, 0x6C,
-	0xB2, 0x81, 0x45, 0xB9, 0x28, 0x4C, 0x6F, 0x48, 0x48, 0x70, 0x54, 0x3A, 0x22, 0x06, 0x06, 0x22,
-	0x3A, 0x53, 0x70, 0x47, 0x48, 0x70, 0x4D, 0x28, 0x02, 0x0F, 0x1B, 0x6D, 0xC5, 0x9A, 0x58, 0x55,
-	0x86, 0x95, 0x85, 0x27, 0x2A, 0x27, 0x85, 0x96, 0x86, 0x55, 0x58, 0x9A, 0xC5, 0x88, 0x1B, 0x51,
-	0x8F, 0x6E, 0x3E, 0x3F, 0x62, 0x6C, 0x5E, 0x1A, 0x2A, 0x19, 0x5D, 0x6C, 0x63, 0x3F, 0x3F, 0x6E,
-	0x8F, 0x50, 0x1B, 0x6D, 0xC5, 0x9A, 0x58, 0x55, 0x86, 0x96, 0x85, 0x27, 0x2A, 0x27, 0x85, 0x95,
-	0x86, 0x55, 0x58, 0x9A, 0xC5, 0x88, 0x1B, 0x50, 0x8F, 0x6E, 0x3F, 0x3F, 0x63, 0x6C, 0x5D, 0x19,
-	0x2A, 0x1A, 0x5E, 0x6C, 0x62, 0x3F, 0x3E, 0x6E, 0x8F, 0x00, 0x00, 0x01, 0xFF, 0xAF, 0xFE, 0x4B,
-	0x02, 0x8E, 0x06, 0x15, 0x00, 0x1F, 0x00, 0x10, 0xB7, 0x1B, 0x14, 0x01, 0x72, 0x0B, 0x04, 0x0F,
-	0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x30, 0x31, 0x45, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27,
-	0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17,
-	0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x01, 0x66, 0x4D, 0x90, 0x65, 0x1F, 0x39, 0x1D,
-	0x13, 0x0E, 0x32, 0x10, 0x31, 0x44, 0x25, 0x52, 0x98, 0x69, 0x24, 0x47, 0x24, 0x17, 0x11, 0x2D,
-	0x1D, 0x3B, 0x52, 0x29, 0x6B, 0x70, 0x93, 0x47, 0x09, 0x0A, 0x92, 0x04, 0x09, 0x26, 0x4F, 0x3D,
-	0x05, 0x19, 0x75, 0xA0, 0x52, 0x0C, 0x09, 0x8E, 0x05, 0x06, 0x31, 0x5C, 0x42, 0x00, 0x00, 0x02,
-	0x00, 0x65, 0x01, 0x18, 0x04, 0x0C, 0x03, 0xF5, 0x00, 0x19, 0x00, 0x33, 0x00, 0x1B, 0x40, 0x0B,
-	0x17, 0x04, 0x80, 0x0A, 0x11, 0x40, 0x31, 0x1E, 0x80, 0x24, 0x2B, 0x00, 0x2F, 0x33, 0x1A, 0xDD,
-	0x32, 0x1A, 0xDE, 0x32, 0x1A, 0xCD, 0x32, 0x30, 0x31, 0x53, 0x27, 0x36, 0x36, 0x33, 0x36, 0x16,
-	0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x26,
-	0x07, 0x22, 0x06, 0x03, 0x27, 0x36, 0x36, 0x33, 0x36, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36,
-	0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x26, 0x26, 0x07, 0x22, 0x06, 0x67, 0x01, 0x2F,
-	0x85, 0x41, 0x50, 0x5B, 0x3F, 0x3B, 0x55, 0x4A, 0x41, 0x7C, 0x2F, 0x01, 0x2F, 0x7C, 0x41, 0x4A,
-	0x55, 0x3B, 0x3F, 0x5C, 0x50, 0x41, 0x84, 0x30, 0x01, 0x2F, 0x85, 0x41, 0x50, 0x5B, 0x3F, 0x3B,
-	0x55, 0x4A, 0x41, 0x7C, 0x2F, 0x01, 0x2F, 0x7C, 0x41, 0x4A, 0x55, 0x3B, 0x3F, 0x5C, 0x50, 0x41,
-	0x84, 0x02, 0xC8, 0xBD, 0x33, 0x3B, 0x02, 0x2B, 0x20, 0x1E, 0x28, 0x44, 0x3C, 0xBD, 0x33, 0x3A,
-	0x27, 0x1E, 0x20, 0x2B, 0x02, 0x44, 0xFE, 0x23, 0xBD, 0x33, 0x3A, 0x02, 0x2B, 0x20, 0x1E, 0x27,
-	0x44, 0x3C, 0xBE, 0x33, 0x3A, 0x27, 0x1E, 0x20, 0x2C, 0x02, 0x44, 0x00, 0x00, 0x03, 0x00, 0x98,
-	0x00, 0x9C, 0x03, 0xDA, 0x04, 0xD5, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x1F, 0x40, 0x0D,
-	0x02, 0x01, 0x01, 0x0A, 0x0A, 0x0B, 0x00, 0x03, 0x03, 0x07, 0x07, 0x06, 0x0B, 0x00, 0x2F, 0xCE,
-	0x32, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x01, 0x27,
-	0x01, 0x13, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x03, 0x8F, 0xFD, 0xAB, 0x5F, 0x02, 0x55,
-	0xAA, 0xFC, 0xBE, 0x03, 0x42, 0xFC, 0xBE, 0x04, 0x9A, 0xFC, 0x02, 0x3B, 0x03, 0xFE, 0xFE, 0xFA,
-	0xA1, 0xA1, 0xFE, 0x61, 0xA1, 0xA1, 0x00, 0x03, 0x00, 0x3D, 0x00, 0x01, 0x03, 0x80, 0x04, 0x46,
-	0x00, 0x04, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x22, 0x40, 0x10, 0x03, 0x07, 0x06, 0x00, 0x04, 0x08,
-	0x06, 0x05, 0x09, 0x09, 0x01, 0x02, 0x02, 0x0D, 0x0D, 0x0C, 0x00, 0x2F, 0x33, 0x7C, 0x10, 0xCE,
-	0x2F, 0x32, 0x32, 0x18, 0x2F, 0x33, 0x17, 0x39, 0x30, 0x31, 0x53, 0x05, 0x15, 0x01, 0x35, 0x25,
-	0x01, 0x07, 0x35, 0x01, 0x13, 0x15, 0x21, 0x35, 0xC7, 0x02, 0xB3, 0xFC, 0xCE, 0x03, 0x32, 0xFD,
-	0x4E, 0x80, 0x03, 0x32, 0x06, 0xFC, 0xBD, 0x02, 0xC3, 0xFE, 0xB2, 0x01, 0x58, 0x69, 0xC0, 0xFE,
-	0xFE, 0x0C, 0x69, 0x01, 0x57, 0xFC, 0x53, 0x98, 0x98, 0x00, 0x00, 0x03, 0x00, 0x84, 0x00, 0x00,
-	0x03, 0xDD, 0x04, 0x5A, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x22, 0x40, 0x10, 0x03, 0x07,
-	0x06, 0x00, 0x04, 0x08, 0x06, 0x01, 0x02, 0x02, 0x05, 0x09, 0x09, 0x0D, 0x0D, 0x0C, 0x00, 0x2F,
-	0x33, 0x7C, 0x10, 0xCE, 0x2F, 0x32, 0x32, 0x18, 0x2F, 0x33, 0x17, 0x39, 0x30, 0x31, 0x41, 0x25,
-	0x35, 0x01, 0x15, 0x05, 0x01, 0x37, 0x15, 0x01, 0x05, 0x15, 0x21, 0x35, 0x03, 0x4E, 0xFD, 0x39,
-	0x03, 0x56, 0xFC, 0xAA, 0x02, 0xC9, 0x8D, 0xFC, 0xAA, 0x03, 0x40, 0xFC, 0xBD, 0x02, 0xB1, 0xFC,
-	0xAD, 0xFE, 0xA9, 0x6A, 0xC6, 0x01, 0x01, 0x14, 0x6A, 0xFE, 0xA8, 0x8E, 0x98, 0x98, 0x00, 0x02,
-	0x00, 0x2C, 0x00, 0x00, 0x03, 0xDD, 0x05, 0xB0, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x1D, 0x40, 0x0E,
-	0x05, 0x08, 0x08, 0x0E, 0x07, 0x12, 0x72, 0x03, 0x0A, 0x0A, 0x0B, 0x01, 0x02, 0x72, 0x00, 0x2B,
-	0x32, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x53, 0x01, 0x33, 0x07, 0x01,
-	0x01, 0x17, 0x23, 0x37, 0x01, 0x01, 0x27, 0x33, 0x01, 0x01, 0x23, 0x2C, 0x01, 0x90, 0x7B, 0x11,
-	0xFE, 0xC4, 0x01, 0x42, 0x0E, 0x7A, 0x22, 0x01, 0x3C, 0xFE, 0xBE, 0x0D, 0x7A, 0x01, 0x94, 0xFE,
-	0x70, 0x7B, 0x02, 0xD7, 0x02, 0xD9, 0x85, 0xFD, 0xAC, 0xFD, 0xAD, 0x84, 0x84, 0x02, 0x53, 0x02,
-	0x54, 0x85, 0xFD, 0x27, 0xFD, 0x29, 0xFF, 0xFF, 0x00, 0xB5, 0x00, 0xA6, 0x01, 0x9B, 0x04, 0xF6,
-	0x04, 0x27, 0x00, 0x12, 0x00, 0x25, 0x00, 0xB2, 0x00, 0x07, 0x00, 0x12, 0x00, 0x25, 0x04, 0x24,
-	0x00, 0x02, 0x00, 0x6F, 0x02, 0x79, 0x02, 0x33, 0x04, 0x3A, 0x00, 0x03, 0x00, 0x07, 0x00, 0x10,
-	0xB6, 0x06, 0x02, 0x02, 0x07, 0x03, 0x06, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31,
-	0x53, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0xFB, 0x8C, 0x01, 0xC4, 0x8C, 0x04, 0x3A, 0xFE,
-	0x3F, 0x01, 0xC1, 0xFE, 0x3F, 0x01, 0xC1, 0x00, 0x00, 0x01, 0x00, 0x5D, 0xFF, 0x5E, 0x01, 0x57,
-	0x00, 0xEF, 0x00, 0x09, 0x00, 0x0A, 0xB2, 0x04, 0x80, 0x09, 0x00, 0x2F, 0x1A, 0xCD, 0x30, 0x31,
-	0x65, 0x15, 0x14, 0x06, 0x07, 0x27, 0x36, 0x36, 0x35, 0x35, 0x01, 0x57, 0x47, 0x4A, 0x69, 0x25,
-	0x25, 0xEF, 0x4F, 0x4F, 0xB6, 0x3D, 0x49, 0x39, 0x78, 0x46, 0x51, 0x00, 0xFF, 0xFF, 0x00, 0x3D,
-	0x00, 0x00, 0x04, 0xF7, 0x06, 0x15, 0x04, 0x26, 0x00, 0x4A, 0x00, 0x00, 0x00, 0x07, 0x00, 0x4A,
-	0x02, 0x2C, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0x00, 0x00, 0x03, 0xCD, 0x06, 0x15, 0x00, 0x10,
-	0x00, 0x14, 0x00, 0x18, 0x00, 0x1B, 0x40, 0x0F, 0x18, 0x06, 0x17, 0x0A, 0x72, 0x13, 0x14, 0x06,
-	0x72, 0x0D, 0x06, 0x01, 0x72, 0x01, 0x0A, 0x00, 0x3F, 0x2B, 0x32, 0x2B, 0x32, 0x2B, 0x3F, 0x30,
-	0x31, 0x61, 0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22,
-	0x06, 0x15, 0x17, 0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x01, 0x84, 0xB9, 0x60, 0xB2, 0x7A,
-	0x48, 0x8A, 0x49, 0x1F, 0x2E, 0x79, 0x48, 0x77, 0x69, 0xDD, 0xFD, 0xBF, 0x03, 0xAD, 0xB9, 0x04,
-	0x98, 0x7B, 0xAA, 0x58, 0x23, 0x1A, 0x9C, 0x12, 0x21, 0x6B, 0x6C, 0x5E, 0x8E, 0x8E, 0xFB, 0xC6,
-	0x04, 0x3A, 0x00, 0x03, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xEA, 0x06, 0x15, 0x00, 0x12, 0x00, 0x16,
-	0x00, 0x1A, 0x00, 0x1B, 0x40, 0x0F, 0x19, 0x1A, 0x06, 0x72, 0x14, 0x00, 0x72, 0x0E, 0x06, 0x01,
-	0x72, 0x13, 0x01, 0x0A, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x2B, 0x2B, 0x32, 0x30, 0x31, 0x61,
-	0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06,
-	0x06, 0x15, 0x01, 0x11, 0x33, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01, 0xA1, 0xB9, 0x57, 0xA5, 0x76,
-	0x2C, 0x85, 0x97, 0x48, 0x56, 0x5F, 0x98, 0x35, 0x41, 0x59, 0x2D, 0x01, 0x90, 0xB9, 0xFE, 0x9D,
-	0xFD, 0xB6, 0x04, 0xAC, 0x75, 0xA1, 0x53, 0x12, 0x1C, 0x0F, 0x86, 0x12, 0x13, 0x2F, 0x5A, 0x42,
-	0xFB, 0x54, 0x05, 0xD8, 0xFA, 0x28, 0x04, 0x3A, 0x8E, 0x8E, 0x00, 0x05, 0x00, 0x3D, 0x00, 0x00,
-	0x06, 0x33, 0x06, 0x15, 0x00, 0x11, 0x00, 0x15, 0x00, 0x26, 0x00, 0x2A, 0x00, 0x2E, 0x00, 0x25,
-	0x40, 0x14, 0x23, 0x1C, 0x01, 0x72, 0x2E, 0x2A, 0x14, 0x15, 0x06, 0x72, 0x0D, 0x06, 0x01, 0x72,
-	0x2D, 0x17, 0x17, 0x01, 0x0A, 0x72, 0x00, 0x2B, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x2B, 0x32, 0x32,
-	0x32, 0x2B, 0x32, 0x30, 0x31, 0x61, 0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07,
-	0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x17, 0x15, 0x21, 0x35, 0x01, 0x23, 0x11, 0x34, 0x36,
-	0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x17, 0x15, 0x21, 0x35,
-	0x21, 0x11, 0x23, 0x11, 0x01, 0xA1, 0xB9, 0x55, 0xA0, 0x6E, 0x20, 0x41, 0x1F, 0x0A, 0x15, 0x35,
-	0x1A, 0x3B, 0x55, 0x2C, 0xF0, 0xFD, 0xAC, 0x03, 0xAD, 0xB9, 0x5F, 0xB2, 0x7A, 0x49, 0x8A, 0x49,
-	0x20, 0x2D, 0x7A, 0x47, 0x77, 0x69, 0xDD, 0xFD, 0xBF, 0x03, 0xAD, 0xB9, 0x04, 0xAC, 0x75, 0xA1,
-	0x53, 0x08, 0x08, 0x97, 0x05, 0x04, 0x2F, 0x5A, 0x42, 0x72, 0x8E, 0x8E, 0xFB, 0xC6, 0x04, 0x98,
-	0x7B, 0xAA, 0x58, 0x23, 0x1A, 0x9C, 0x12, 0x21, 0x6B, 0x6C, 0x5E, 0x8E, 0x8E, 0xFB, 0xC6, 0x04,
-	0x3A, 0x00, 0x00, 0x05, 0x00, 0x3D, 0x00, 0x00, 0x06, 0x33, 0x06, 0x15, 0x00, 0x11, 0x00, 0x15,
-	0x00, 0x28, 0x00, 0x2C, 0x00, 0x30, 0x00, 0x29, 0x40, 0x17, 0x2B, 0x00, 0x72, 0x24, 0x1C, 0x01,
-	0x72, 0x2E, 0x14, 0x14, 0x2D, 0x15, 0x06, 0x72, 0x0D, 0x06, 0x01, 0x72, 0x29, 0x17, 0x01, 0x0A,
-	0x72, 0x00, 0x2B, 0x32, 0x32, 0x2B, 0x32, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x2B, 0x30,
-	0x31, 0x61, 0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22,
-	0x06, 0x06, 0x15, 0x17, 0x15, 0x21, 0x35, 0x01, 0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
-	0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x01, 0x11, 0x33, 0x11, 0x01, 0x15,
-	0x21, 0x35, 0x01, 0xA1, 0xB9, 0x55, 0xA0, 0x6E, 0x20, 0x41, 0x1F, 0x0A, 0x15, 0x35, 0x1A, 0x3B,
-	0x55, 0x2C, 0xF1, 0xFD, 0xAB, 0x03, 0xAD, 0xB9, 0x57, 0xA5, 0x76, 0x2C, 0x85, 0x97, 0x48, 0x56,
-	0x5F, 0x98, 0x35, 0x41, 0x59, 0x2D, 0x01, 0x90, 0xB9, 0xFE, 0x9D, 0xFD, 0xB6, 0x04, 0xAC, 0x75,
-	0xA1, 0x53, 0x08, 0x08, 0x97, 0x05, 0x04, 0x2F, 0x5A, 0x42, 0x72, 0x8E, 0x8E, 0xFB, 0xC6, 0x04,
-	0xAC, 0x75, 0xA1, 0x53, 0x12, 0x1C, 0x0F, 0x86, 0x12, 0x13, 0x2F, 0x5A, 0x42, 0xFB, 0x54, 0x05,
-	0xD8, 0xFA, 0x28, 0x04, 0x3A, 0x8E, 0x8E, 0x00, 0x00, 0x04, 0x00, 0x3D, 0xFF, 0xEC, 0x04, 0x9B,
-	0x06, 0x15, 0x00, 0x03, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x2D, 0x00, 0x25, 0x40, 0x14, 0x22, 0x29,
-	0x0B, 0x72, 0x13, 0x0A, 0x72, 0x09, 0x1C, 0x1C, 0x0D, 0x0D, 0x04, 0x01, 0x72, 0x18, 0x02, 0x03,
-	0x06, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x2B, 0x32, 0x11, 0x33, 0x11, 0x33, 0x2B, 0x2B, 0x32, 0x30,
-	0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x32, 0x16, 0x17, 0x15, 0x23, 0x35, 0x26, 0x26, 0x23, 0x22,
-	0x06, 0x06, 0x15, 0x11, 0x23, 0x11, 0x34, 0x36, 0x36, 0x01, 0x15, 0x21, 0x35, 0x13, 0x33, 0x11,
-	0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x01,
-	0x82, 0xFE, 0xBB, 0x01, 0xFD, 0x59, 0xDD, 0x5C, 0xB9, 0x1E, 0x71, 0x2D, 0x3B, 0x51, 0x2A, 0xB9,
-	0x52, 0x97, 0x02, 0xC5, 0xFD, 0xB7, 0xC6, 0xB9, 0x22, 0x36, 0x1F, 0x17, 0x33, 0x0D, 0x01, 0x16,
-	0x47, 0x31, 0x45, 0x71, 0x44, 0x04, 0x3A, 0x8E, 0x8E, 0x01, 0xDB, 0x36, 0x2E, 0xD1, 0x79, 0x10,
-	0x14, 0x32, 0x5D, 0x42, 0xFB, 0x54, 0x04, 0xAC, 0x75, 0xA1, 0x53, 0xFE, 0x25, 0x8E, 0x8E, 0x01,
-	0x07, 0xFB, 0xCB, 0x37, 0x38, 0x12, 0x09, 0x03, 0x97, 0x07, 0x0D, 0x36, 0x7F, 0x6C, 0x00, 0x04,
-	0x00, 0x5F, 0xFF, 0xEC, 0x06, 0x55, 0x06, 0x12, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x31, 0x00, 0x67,
-	0x00, 0x31, 0x40, 0x1B, 0x3B, 0x32, 0x40, 0x64, 0x60, 0x5B, 0x0B, 0x72, 0x01, 0x45, 0x49, 0x40,
-	0x07, 0x72, 0x26, 0x2D, 0x0B, 0x72, 0x1E, 0x10, 0x1F, 0x06, 0x72, 0x14, 0x0A, 0x01, 0x72, 0x00,
-	0x2B, 0x32, 0x2B, 0x32, 0x32, 0x2B, 0x32, 0x2B, 0x32, 0xCC, 0x32, 0x2B, 0xCC, 0x33, 0x12, 0x39,
-	0x39, 0x30, 0x31, 0x41, 0x23, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15,
-	0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x1E, 0x02, 0x25, 0x15, 0x21, 0x35, 0x37,
-	0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26,
-	0x35, 0x05, 0x34, 0x26, 0x26, 0x27, 0x2E, 0x03, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16,
-	0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1E, 0x02, 0x17, 0x1E, 0x02,
-	0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36,
-	0x03, 0xB2, 0x66, 0x20, 0x52, 0x3B, 0x33, 0x5F, 0x83, 0x50, 0x77, 0x97, 0x53, 0x20, 0xB9, 0x28,
-	0x58, 0x48, 0x58, 0x5C, 0x1E, 0x26, 0x1E, 0x02, 0x9D, 0xFD, 0xC1, 0xBC, 0xB9, 0x22, 0x37, 0x1E,
-	0x17, 0x34, 0x0D, 0x01, 0x16, 0x47, 0x32, 0x44, 0x72, 0x44, 0xFE, 0x37, 0x23, 0x6B, 0x6B, 0x5A,
-	0x91, 0x65, 0x36, 0x39, 0x69, 0x94, 0x5B, 0x82, 0xB8, 0x62, 0xB9, 0x35, 0x65, 0x49, 0x4D, 0x5F,
-	0x2B, 0x15, 0x36, 0x62, 0x4C, 0x85, 0xAC, 0x54, 0x3B, 0x6F, 0x99, 0x5F, 0x8F, 0xC6, 0x66, 0xBA,
-	0x04, 0x50, 0x74, 0x39, 0x4C, 0x67, 0x36, 0x02, 0xFC, 0x61, 0xAA, 0x9D, 0x4D, 0x3D, 0x69, 0x4F,
-	0x2C, 0x49, 0x74, 0x87, 0x3E, 0x44, 0x68, 0x3B, 0x58, 0x46, 0x3C, 0x69, 0x6B, 0x7D, 0xEE, 0x8E,
-	0x8E, 0x58, 0xFC, 0x97, 0x3E, 0x45, 0x1B, 0x08, 0x04, 0x97, 0x07, 0x0D, 0x3F, 0x8C, 0x73, 0x0B,
-	0x28, 0x45, 0x39, 0x15, 0x13, 0x34, 0x4A, 0x64, 0x43, 0x40, 0x72, 0x58, 0x32, 0x5C, 0x99, 0x5D,
-	0x2D, 0x55, 0x38, 0x2F, 0x48, 0x28, 0x1E, 0x2F, 0x27, 0x22, 0x11, 0x1E, 0x54, 0x7A, 0x57, 0x47,
-	0x76, 0x55, 0x2F, 0x66, 0xA2, 0x5A, 0x4C, 0x59, 0x25, 0x28, 0x46, 0x00, 0x00, 0x15, 0x00, 0x5B,
-	0xFE, 0x72, 0x07, 0xEE, 0x05, 0xAE, 0x00, 0x05, 0x00, 0x0B, 0x00, 0x11, 0x00, 0x17, 0x00, 0x1B,
-	0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
-	0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x57, 0x00, 0x73, 0x00, 0x8C, 0x00, 0x9A, 0x00, 0xA8,
-	0x00, 0x00, 0x53, 0x23, 0x11, 0x21, 0x15, 0x23, 0x21, 0x23, 0x35, 0x21, 0x11, 0x23, 0x01, 0x21,
-	0x11, 0x33, 0x15, 0x33, 0x05, 0x21, 0x35, 0x33, 0x35, 0x33, 0x01, 0x21, 0x35, 0x21, 0x05, 0x21,
-	0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x01, 0x15, 0x23, 0x35, 0x13, 0x15, 0x23, 0x35, 0x01, 0x21,
-	0x35, 0x21, 0x01, 0x15, 0x23, 0x35, 0x01, 0x21, 0x35, 0x21, 0x05, 0x21, 0x35, 0x21, 0x01, 0x15,
-	0x23, 0x35, 0x13, 0x15, 0x23, 0x35, 0x01, 0x15, 0x23, 0x35, 0x07, 0x11, 0x33, 0x11, 0x14, 0x06,
-	0x23, 0x22, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33, 0x32, 0x36, 0x25, 0x23, 0x27, 0x33, 0x32, 0x36,
-	0x35, 0x34, 0x26, 0x23, 0x23, 0x11, 0x23, 0x11, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
-	0x07, 0x22, 0x06, 0x07, 0x06, 0x14, 0x07, 0x23, 0x37, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
-	0x23, 0x37, 0x33, 0x32, 0x14, 0x17, 0x14, 0x16, 0x31, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x01, 0x15,
-	0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x07, 0x35, 0x34, 0x26,
-	0x23, 0x22, 0x06, 0x15, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0xCC, 0x71, 0x01, 0x35, 0xC4, 0x06,
-	0xB3, 0xC7, 0x01, 0x36, 0x6F, 0xFA, 0x11, 0xFE, 0xCB, 0x71, 0xC4, 0x06, 0x5E, 0xFE, 0xCA, 0xC7,
-	0x6F, 0xFE, 0x51, 0xFE, 0xEA, 0x01, 0x16, 0xFC, 0xE0, 0xFE, 0xEC, 0x01, 0x14, 0xFE, 0xEC, 0x01,
-	0x14, 0x04, 0xCF, 0x6F, 0x6F, 0x6F, 0xFD, 0x30, 0xFE, 0xEB, 0x01, 0x15, 0xFC, 0x1D, 0x71, 0x04,
-	0x54, 0xFE, 0xEB, 0x01, 0x15, 0x01, 0x90, 0xFE, 0xEA, 0x01, 0x16, 0xFA, 0x8D, 0x71, 0x71, 0x71,
-	0x07, 0x93, 0x6F, 0xE8, 0x5C, 0x6B, 0x50, 0x58, 0x6D, 0x5D, 0x38, 0x30, 0x29, 0x36, 0xFD, 0xC2,
-	0x96, 0x01, 0x76, 0x3B, 0x3B, 0x3B, 0x3B, 0x5D, 0x5F, 0xBC, 0x42, 0x5F, 0x33, 0x22, 0x41, 0x2F,
-	0x01, 0x04, 0x02, 0x0C, 0x0E, 0xB9, 0x30, 0x89, 0x34, 0x33, 0x33, 0x34, 0x77, 0x01, 0x97, 0x0E,
-	0x0C, 0x07, 0x2B, 0x3A, 0x1E, 0x69, 0xFE, 0x84, 0x7F, 0x66, 0x67, 0x81, 0x80, 0x66, 0x67, 0x80,
-	0x5C, 0x4A, 0x41, 0x40, 0x4A, 0x4B, 0x41, 0x40, 0x49, 0x04, 0x91, 0x01, 0x1D, 0x74, 0x74, 0xFE,
-	0xE3, 0xF9, 0xE1, 0x01, 0x3B, 0xCA, 0x71, 0x71, 0xCA, 0xFE, 0xC5, 0x71, 0x71, 0x71, 0x06, 0x57,
-	0x74, 0xFB, 0x74, 0xF9, 0xF9, 0x02, 0xF2, 0xFA, 0xFA, 0xFA, 0x5E, 0x71, 0x02, 0x3F, 0xF9, 0xF9,
-	0x04, 0x18, 0x74, 0x74, 0x74, 0xFC, 0xEE, 0xFC, 0xFC, 0x01, 0x78, 0xFA, 0xFA, 0xFE, 0x88, 0xFC,
-	0xFC, 0xF3, 0x01, 0x7A, 0xFE, 0x86, 0x4F, 0x5C, 0x51, 0x53, 0x2E, 0x2D, 0x37, 0x72, 0x46, 0x29,
-	0x27, 0x29, 0x1E, 0xFE, 0x2F, 0x02, 0x25, 0x20, 0x42, 0x34, 0x22, 0x38, 0x24, 0x04, 0x13, 0x01,
-	0x04, 0x01, 0xF4, 0x4B, 0x2C, 0x27, 0x27, 0x2F, 0x46, 0x01, 0x05, 0x01, 0x13, 0x04, 0x26, 0x39,
-	0x22, 0x4C, 0x4F, 0x01, 0x48, 0x70, 0x61, 0x7A, 0x7A, 0x61, 0x70, 0x61, 0x7A, 0x7A, 0xD1, 0x70,
-	0x44, 0x4F, 0x4F, 0x44, 0x70, 0x45, 0x4E, 0x4E, 0x00, 0x05, 0x00, 0x5C, 0xFD, 0xD5, 0x07, 0xD7,
-	0x08, 0x73, 0x00, 0x03, 0x00, 0x1E, 0x00, 0x22, 0x00, 0x26, 0x00, 0x2A, 0x00, 0x00, 0x53, 0x09,
-	0x02, 0x03, 0x33, 0x34, 0x36, 0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x33,
-	0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x0E, 0x02, 0x13, 0x35, 0x23, 0x15, 0x13,
-	0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x15, 0x5C, 0x03, 0xBC, 0x03, 0xBF, 0xFC, 0x41, 0x77, 0xCA,
-	0x19, 0x29, 0x44, 0x62, 0xA7, 0x95, 0x7F, 0xB1, 0x02, 0xCB, 0x02, 0x3E, 0x27, 0x38, 0x39, 0x35,
-	0x28, 0x2F, 0x3D, 0x1D, 0xC9, 0xCA, 0x7F, 0x04, 0x06, 0x04, 0x02, 0x83, 0x03, 0xCF, 0xFC, 0x31,
-	0xFC, 0x31, 0x02, 0xDE, 0x33, 0x3E, 0x1B, 0x25, 0x81, 0x52, 0x80, 0x97, 0x7D, 0x8D, 0x37, 0x30,
-	0x40, 0x34, 0x34, 0x4D, 0x1A, 0x21, 0x3A, 0x4E, 0xFE, 0xBB, 0xAA, 0xAA, 0xFD, 0x48, 0x04, 0x04,
-	0x0A, 0x9A, 0x04, 0x04, 0x00, 0x01, 0x00, 0x42, 0x00, 0x00, 0x02, 0xAB, 0x03, 0x20, 0x00, 0x1C,
-	0x00, 0x10, 0xB5, 0x03, 0x1C, 0x1C, 0x0B, 0x13, 0x02, 0x00, 0x2F, 0xCC, 0x32, 0x33, 0x11, 0x33,
-	0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15,
-	0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x07, 0x02, 0xAB,
-	0xFD, 0xAA, 0x01, 0x20, 0x2D, 0x34, 0x17, 0x40, 0x3B, 0x4B, 0x47, 0x9E, 0x48, 0x86, 0x5E, 0x5A,
-	0x80, 0x44, 0x2F, 0x56, 0x3B, 0xAF, 0x80, 0x80, 0x6C, 0x01, 0x0F, 0x2A, 0x42, 0x35, 0x16, 0x30,
-	0x3E, 0x4C, 0x39, 0x48, 0x76, 0x47, 0x3A, 0x69, 0x49, 0x35, 0x5C, 0x5C, 0x35, 0x92, 0x00, 0x01,
-	0x00, 0x7B, 0x00, 0x00, 0x01, 0xEF, 0x03, 0x15, 0x00, 0x06, 0x00, 0x23, 0x40, 0x15, 0x04, 0x05,
-	0x05, 0x03, 0x03, 0x2F, 0x00, 0x7F, 0x00, 0x02, 0x0F, 0x00, 0x5F, 0x00, 0xAF, 0x00, 0xFF, 0x00,
-	0x04, 0x00, 0x01, 0x00, 0x2F, 0xCD, 0x5D, 0x71, 0x32, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41,
-	0x11, 0x23, 0x11, 0x07, 0x35, 0x25, 0x01, 0xEF, 0x9C, 0xD8, 0x01, 0x62, 0x03, 0x15, 0xFC, 0xEB,
-	0x02, 0x59, 0x39, 0x81, 0x74, 0x00, 0x00, 0x02, 0x00, 0x51, 0xFF, 0xF5, 0x02, 0x9E, 0x03, 0x20,
-	0x00, 0x11, 0x00, 0x23, 0x00, 0x0C, 0xB3, 0x17, 0x0E, 0x20, 0x05, 0x00, 0x2F, 0x33, 0xC4, 0x32,
-	0x30, 0x31, 0x41, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x35, 0x34, 0x36, 0x36,
-	0x33, 0x32, 0x16, 0x16, 0x03, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x15, 0x14,
-	0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x02, 0x9E, 0x49, 0x84, 0x58, 0x59, 0x85, 0x4A, 0x49, 0x85,
-	0x58, 0x59, 0x84, 0x4A, 0x9E, 0x20, 0x3D, 0x2C, 0x2C, 0x3D, 0x20, 0x20, 0x3F, 0x2C, 0x2C, 0x3C,
-	0x1F, 0x01, 0xD0, 0x8B, 0x72, 0x95, 0x49, 0x49, 0x95, 0x72, 0x8B, 0x72, 0x95, 0x49, 0x49, 0x95,
-	0xFE, 0xF6, 0xA6, 0x43, 0x55, 0x29, 0x29, 0x55, 0x43, 0xA6, 0x43, 0x56, 0x2A, 0x2A, 0x56, 0x00,
-	0x00, 0x01, 0x00, 0x56, 0xFF, 0xF9, 0x03, 0x9B, 0x04, 0x9D, 0x00, 0x32, 0x00, 0x17, 0x40, 0x0A,
-	0x14, 0x1E, 0x1E, 0x26, 0x01, 0x31, 0x0A, 0x0C, 0x26, 0x7E, 0x00, 0x3F, 0x33, 0x3F, 0x33, 0x12,
-	0x39, 0x2F, 0x33, 0x30, 0x31, 0x65, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x34, 0x2E, 0x02, 0x23,
-	0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3E, 0x02, 0x37, 0x17, 0x0E, 0x02, 0x23,
-	0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14, 0x0E, 0x02,
-	0x23, 0x23, 0x01, 0x12, 0x12, 0x7F, 0xAC, 0x66, 0x2D, 0x26, 0x42, 0x55, 0x30, 0x49, 0x68, 0x37,
-	0x32, 0x66, 0x4C, 0x36, 0x5C, 0x45, 0x29, 0x03, 0x34, 0x06, 0x53, 0x94, 0x6B, 0x80, 0xA8, 0x52,
-	0x60, 0xBA, 0x85, 0x6D, 0x9F, 0x68, 0x32, 0x3B, 0x8D, 0xF5, 0xBA, 0x13, 0x93, 0x3B, 0x6A, 0x8E,
-	0x53, 0xCA, 0x47, 0x6C, 0x49, 0x25, 0x45, 0x72, 0x44, 0x40, 0x72, 0x46, 0x23, 0x3D, 0x4C, 0x29,
-	0x64, 0x3A, 0x79, 0x51, 0x6D, 0xB3, 0x68, 0x70, 0xB8, 0x6F, 0x49, 0x82, 0xAC, 0x63, 0x44, 0x82,
-	0xE9, 0xB4, 0x67, 0x00, 0x00, 0x04, 0x00, 0x61, 0xFF, 0xF0, 0x03, 0xAE, 0x04, 0x9D, 0x00, 0x12,
-	0x00, 0x22, 0x00, 0x34, 0x00, 0x44, 0x00, 0x1D, 0x40, 0x0D, 0x28, 0x17, 0x17, 0x41, 0x0E, 0x0E,
-	0x05, 0x39, 0x31, 0x7E, 0x1F, 0x05, 0x0B, 0x00, 0x3F, 0x33, 0x3F, 0x33, 0x12, 0x39, 0x2F, 0x33,
-	0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E,
-	0x02, 0x33, 0x32, 0x1E, 0x02, 0x07, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16,
-	0x16, 0x33, 0x32, 0x36, 0x36, 0x13, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x36,
-	0x36, 0x33, 0x32, 0x16, 0x16, 0x07, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16,
-	0x16, 0x33, 0x32, 0x36, 0x36, 0x03, 0xAE, 0x41, 0x73, 0x99, 0x59, 0x77, 0xC0, 0x70, 0x3E, 0x71,
-	0x9A, 0x5C, 0x5C, 0x9A, 0x73, 0x3F, 0xBA, 0x3C, 0x6B, 0x47, 0x48, 0x6A, 0x3A, 0x3A, 0x6B, 0x49,
-	0x47, 0x6A, 0x3B, 0x9C, 0x3A, 0x6A, 0x8F, 0x55, 0x56, 0x90, 0x69, 0x3A, 0x65, 0xB1, 0x71, 0x71,
-	0xB2, 0x67, 0xB9, 0x35, 0x5E, 0x3E, 0x3E, 0x5C, 0x33, 0x33, 0x5E, 0x3E, 0x3E, 0x5D, 0x34, 0x01,
-	0x3D, 0x51, 0x7D, 0x54, 0x2B, 0x4C, 0x95, 0x6C, 0x48, 0x75, 0x56, 0x2E, 0x2E, 0x56, 0x75, 0x3E,
-	0x3B, 0x57, 0x31, 0x31, 0x57, 0x3B, 0x3C, 0x56, 0x2E, 0x2E, 0x56, 0x02, 0x50, 0x42, 0x6E, 0x51,
-	0x2C, 0x2C, 0x51, 0x6E, 0x42, 0x67, 0x90, 0x4B, 0x4B, 0x90, 0x6E, 0x34, 0x50, 0x2D, 0x2B, 0x4F,
-	0x37, 0x36, 0x50, 0x2C, 0x2C, 0x50, 0x00, 0x01, 0x00, 0x42, 0x00, 0x00, 0x03, 0xC0, 0x04, 0x8D,
-	0x00, 0x06, 0x00, 0x0E, 0xB5, 0x05, 0x01, 0x06, 0x7D, 0x03, 0x0A, 0x00, 0x3F, 0x3F, 0x33, 0x33,
-	0x30, 0x31, 0x41, 0x15, 0x01, 0x23, 0x01, 0x21, 0x35, 0x03, 0xC0, 0xFD, 0xE9, 0xC4, 0x02, 0x17,
-	0xFD, 0x46, 0x04, 0x8D, 0x69, 0xFB, 0xDC, 0x03, 0xF4, 0x99, 0x00, 0x01, 0x00, 0x72, 0xFF, 0xF0,
-	0x03, 0xBB, 0x04, 0x94, 0x00, 0x31, 0x00, 0x15, 0x40, 0x09, 0x16, 0x1F, 0x1F, 0x0E, 0x27, 0x0B,
-	0x03, 0x00, 0x7E, 0x00, 0x3F, 0x32, 0x3F, 0x33, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x33, 0x15,
-	0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26,
-	0x26, 0x23, 0x22, 0x06, 0x06, 0x07, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06,
-	0x06, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x02, 0xED, 0x14, 0x10, 0x7D, 0xAD,
-	0x6B, 0x31, 0x27, 0x43, 0x58, 0x30, 0x49, 0x68, 0x37, 0x33, 0x67, 0x4D, 0x44, 0x74, 0x48, 0x04,
-	0x34, 0x08, 0x5C, 0x98, 0x63, 0x81, 0xA5, 0x50, 0x60, 0xB7, 0x85, 0x6A, 0xA0, 0x6C, 0x37, 0x40,
-	0x92, 0xF4, 0x04, 0x94, 0x9D, 0x3E, 0x70, 0x95, 0x56, 0xA8, 0x4A, 0x71, 0x4C, 0x27, 0x3F, 0x6D,
-	0x45, 0x43, 0x6E, 0x42, 0x39, 0x5E, 0x39, 0x65, 0x3A, 0x77, 0x51, 0x6D, 0xB1, 0x67, 0x70, 0xB4,
-	0x6A, 0x48, 0x7D, 0xA4, 0x5D, 0x54, 0x86, 0xEB, 0xB3, 0x66, 0x00, 0x01, 0x00, 0x81, 0xFF, 0xF0,
-	0x03, 0xC5, 0x04, 0x8D, 0x00, 0x23, 0x00, 0x17, 0x40, 0x0A, 0x21, 0x09, 0x09, 0x02, 0x19, 0x11,
-	0x0B, 0x05, 0x02, 0x7D, 0x00, 0x3F, 0x33, 0x3F, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41,
-	0x27, 0x13, 0x21, 0x15, 0x21, 0x03, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
-	0x23, 0x22, 0x26, 0x26, 0x27, 0x33, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
-	0x23, 0x22, 0x06, 0x01, 0x39, 0x94, 0x44, 0x02, 0xA8, 0xFD, 0xF5, 0x26, 0x21, 0x6E, 0x48, 0x7A,
-	0xB2, 0x62, 0x5A, 0xB9, 0x8F, 0x6A, 0xB7, 0x77, 0x0A, 0xB2, 0x0D, 0x81, 0x62, 0x4E, 0x67, 0x34,
-	0x3C, 0x73, 0x51, 0x54, 0x56, 0x02, 0x1E, 0x25, 0x02, 0x4A, 0xA2, 0xFE, 0xDF, 0x10, 0x21, 0x5F,
-	0xAE, 0x79, 0x6C, 0xB0, 0x69, 0x4A, 0x92, 0x6C, 0x59, 0x58, 0x3E, 0x6E, 0x47, 0x44, 0x6A, 0x3C,
-	0x29, 0x00, 0x00, 0x02, 0x00, 0x31, 0x00, 0x00, 0x03, 0xE5, 0x04, 0x8D, 0x00, 0x07, 0x00, 0x0B,
-	0x00, 0x15, 0x40, 0x09, 0x00, 0x01, 0x01, 0x0A, 0x04, 0x0B, 0x7D, 0x0A, 0x12, 0x00, 0x3F, 0x3F,
-	0x33, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x27, 0x01, 0x33, 0x03, 0x01, 0x01,
-	0x11, 0x23, 0x11, 0x03, 0xE5, 0xFC, 0x4E, 0x02, 0x02, 0x42, 0x90, 0xA1, 0xFE, 0x95, 0x02, 0x3E,
-	0xB9, 0x01, 0x9E, 0x98, 0x73, 0x03, 0x14, 0xFE, 0xDD, 0xFE, 0x34, 0x02, 0xEF, 0xFB, 0x73, 0x04,
-	0x8D, 0x00, 0x00, 0x02, 0x00, 0x4F, 0xFF, 0xF0, 0x03, 0xA0, 0x04, 0x9D, 0x00, 0x1D, 0x00, 0x3D,
-	0x00, 0x1D, 0x40, 0x0D, 0x1F, 0x00, 0x00, 0x1D, 0x1E, 0x1E, 0x12, 0x34, 0x2A, 0x0B, 0x09, 0x12,
-	0x7E, 0x00, 0x3F, 0x33, 0x3F, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41,
-	0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x36,
-	0x36, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x23, 0x15, 0x35, 0x33, 0x32, 0x1E,
-	0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x33, 0x14, 0x16, 0x16, 0x33, 0x32,
-	0x36, 0x36, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x01, 0x60, 0x7B, 0x53, 0x6D, 0x36, 0x30, 0x61, 0x4A,
-	0x42, 0x65, 0x3A, 0xBA, 0x69, 0xB9, 0x78, 0x5B, 0x95, 0x6C, 0x3A, 0x2E, 0x61, 0x97, 0x68, 0x9D,
-	0x9D, 0x79, 0xA2, 0x5F, 0x29, 0x40, 0x74, 0x9B, 0x5B, 0x55, 0x98, 0x76, 0x44, 0xB9, 0x3B, 0x6B,
-	0x48, 0x4B, 0x6B, 0x39, 0x25, 0x46, 0x62, 0x3D, 0x02, 0x9C, 0x2F, 0x52, 0x35, 0x37, 0x50, 0x2C,
-	0x29, 0x4B, 0x33, 0x5D, 0x90, 0x52, 0x2A, 0x54, 0x7B, 0x51, 0x33, 0x66, 0x54, 0x33, 0x2C, 0x69,
-	0x30, 0x53, 0x6C, 0x3C, 0x51, 0x7F, 0x58, 0x2D, 0x29, 0x53, 0x7C, 0x52, 0x35, 0x51, 0x2D, 0x2D,
-	0x54, 0x3C, 0x33, 0x4A, 0x2F, 0x17, 0x00, 0x01, 0x00, 0x4F, 0x00, 0x00, 0x03, 0xCB, 0x04, 0x9D,
-	0x00, 0x1E, 0x00, 0x12, 0xB7, 0x0B, 0x14, 0x7E, 0x03, 0x1E, 0x1E, 0x02, 0x12, 0x00, 0x3F, 0x33,
-	0x11, 0x33, 0x3F, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x3E, 0x02, 0x35, 0x34, 0x26,
-	0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E,
-	0x02, 0x07, 0x01, 0x03, 0xCB, 0xFC, 0x9E, 0x01, 0xAC, 0x4C, 0x55, 0x23, 0x70, 0x63, 0x58, 0x70,
-	0x35, 0xBA, 0x67, 0xC4, 0x8C, 0x7B, 0xB2, 0x5F, 0x27, 0x45, 0x5C, 0x35, 0xFE, 0xB8, 0x98, 0x98,
-	0x83, 0x01, 0x9D, 0x46, 0x68, 0x54, 0x28, 0x50, 0x6B, 0x37, 0x62, 0x42, 0x66, 0xA9, 0x64, 0x54,
-	0x97, 0x63, 0x37, 0x67, 0x64, 0x66, 0x38, 0xFE, 0xE9, 0x00, 0x00, 0x01, 0x00, 0x99, 0x00, 0x00,
-	0x02, 0x9E, 0x04, 0x90, 0x00, 0x06, 0x00, 0x0A, 0xB3, 0x06, 0x7D, 0x02, 0x0A, 0x00, 0x3F, 0x3F,
-	0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x05, 0x35, 0x25, 0x02, 0x9E, 0xBA, 0xFE, 0xB5, 0x01, 0xEB,
-	0x04, 0x90, 0xFB, 0x70, 0x03, 0xAF, 0x62, 0x9E, 0xA5, 0x00, 0x00, 0x02, 0x00, 0x63, 0xFF, 0xF0,
-	0x03, 0xAB, 0x04, 0x9D, 0x00, 0x15, 0x00, 0x2B, 0x00, 0x0E, 0xB5, 0x1C, 0x11, 0x7E, 0x27, 0x06,
-	0x0B, 0x00, 0x3F, 0x33, 0x3F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E,
-	0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x03, 0x35, 0x34, 0x2E, 0x02, 0x23,
-	0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x03, 0xAB, 0x3B, 0x6D,
-	0x9B, 0x60, 0x5F, 0x9B, 0x6F, 0x3C, 0x3B, 0x6F, 0x9A, 0x5F, 0x60, 0x9C, 0x6E, 0x3B, 0xBA, 0x1E,
-	0x3B, 0x58, 0x3A, 0x38, 0x57, 0x3B, 0x1F, 0x1F, 0x3C, 0x58, 0x38, 0x3A, 0x57, 0x3B, 0x1D, 0x02,
-	0x9F, 0xAE, 0x83, 0xC1, 0x7F, 0x3E, 0x3E, 0x7F, 0xC1, 0x83, 0xAE, 0x83, 0xC0, 0x7E, 0x3D, 0x3D,
-	0x7E, 0xC0, 0xFE, 0xB5, 0xE4, 0x53, 0x7C, 0x52, 0x29, 0x29, 0x52, 0x7C, 0x53, 0xE4, 0x53, 0x7E,
-	0x54, 0x2B, 0x2B, 0x54, 0x7E, 0x00, 0x00, 0x03, 0x00, 0x48, 0x00, 0x00, 0x03, 0xE1, 0x04, 0x8D,
-	0x00, 0x03, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x1C, 0x40, 0x0C, 0x04, 0x0C, 0x0C, 0x0D, 0x0D, 0x08,
-	0x7D, 0x07, 0x03, 0x03, 0x06, 0x02, 0x00, 0x2F, 0x33, 0x33, 0x11, 0x33, 0x3F, 0x33, 0x2F, 0x33,
-	0x11, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x01, 0x23, 0x35, 0x01, 0x33, 0x23, 0x15,
-	0x21, 0x35, 0x03, 0xE1, 0xFC, 0xA6, 0x03, 0x41, 0xFC, 0xF8, 0x78, 0x03, 0x0A, 0x76, 0x49, 0xFC,
-	0xD2, 0x98, 0x98, 0x98, 0x03, 0x7D, 0xFB, 0xEB, 0x7C, 0x04, 0x11, 0x98, 0x98, 0x00, 0x00, 0x03,
-	0x00, 0x0E, 0x00, 0x00, 0x04, 0x1C, 0x04, 0x8D, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x1B,
-	0x40, 0x10, 0x08, 0x07, 0x03, 0x04, 0x06, 0x00, 0x0A, 0x0D, 0x08, 0x01, 0x0C, 0x0A, 0x72, 0x05,
-	0x01, 0x7D, 0x00, 0x3F, 0x33, 0x2B, 0x11, 0x17, 0x39, 0x30, 0x31, 0x41, 0x01, 0x33, 0x01, 0x23,
-	0x01, 0x01, 0x07, 0x23, 0x01, 0x01, 0x11, 0x23, 0x11, 0x01, 0xDD, 0x01, 0x6F, 0xD0, 0xFE, 0x4D,
-	0x71, 0xFE, 0xE6, 0x01, 0x71, 0x1E, 0x6F, 0xFE, 0x4C, 0x02, 0x60, 0xB8, 0x01, 0xE5, 0x02, 0xA8,
-	0xFD, 0x00, 0x03, 0x00, 0xFD, 0x53, 0x53, 0x03, 0x00, 0xFD, 0x92, 0xFD, 0xE1, 0x02, 0x1F, 0x00,
-	0x00, 0x01, 0x00, 0x27, 0x00, 0x00, 0x04, 0x32, 0x04, 0x8D, 0x00, 0x0B, 0x00, 0x15, 0x40, 0x0A,
-	0x07, 0x0A, 0x04, 0x01, 0x04, 0x09, 0x05, 0x03, 0x00, 0x7D, 0x00, 0x3F, 0x32, 0x2F, 0x33, 0x17,
-	0x39, 0x30, 0x31, 0x49, 0x02, 0x33, 0x01, 0x01, 0x23, 0x01, 0x01, 0x23, 0x01, 0x01, 0x01, 0x0B,
-	0x01, 0x1D, 0x01, 0x1F, 0xDD, 0xFE, 0x75, 0x01, 0x99, 0xDD, 0xFE, 0xD6, 0xFE, 0xD8, 0xDC, 0x01,
-	0x96, 0xFE, 0x73, 0x04, 0x8D, 0xFE, 0x4D, 0x01, 0xB3, 0xFD, 0xBE, 0xFD, 0xB5, 0x01, 0xBB, 0xFE,
-	0x45, 0x02, 0x4B, 0x02, 0x42, 0x00, 0x00, 0x04, 0x00, 0x31, 0x00, 0x00, 0x05, 0xF1, 0x04, 0x8D,
-	0x00, 0x05, 0x00, 0x0A, 0x00, 0x0F, 0x00, 0x15, 0x00, 0x20, 0x40, 0x0E, 0x12, 0x04, 0x10, 0x01,
-	0x0E, 0x04, 0x0C, 0x01, 0x08, 0x04, 0x06, 0x01, 0x7D, 0x04, 0x00, 0x2F, 0x3F, 0x33, 0x11, 0x33,
-	0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x13, 0x33, 0x07, 0x01, 0x23,
-	0x03, 0x13, 0x13, 0x23, 0x01, 0x01, 0x13, 0x33, 0x01, 0x23, 0x03, 0x13, 0x13, 0x23, 0x01, 0x27,
-	0x01, 0xC9, 0xF8, 0x81, 0x2E, 0xFE, 0xF4, 0x7E, 0xA1, 0xC7, 0x2A, 0x7F, 0xFE, 0xD6, 0x04, 0x43,
-	0xC5, 0xB8, 0xFE, 0xD6, 0x7F, 0xE2, 0xF4, 0x3E, 0x7E, 0xFE, 0xFC, 0x2F, 0x01, 0x16, 0x03, 0x77,
-	0xF7, 0xFC, 0x6A, 0x04, 0x8D, 0xFC, 0x9A, 0xFE, 0xD9, 0x04, 0x8D, 0xFC, 0x9C, 0x03, 0x64, 0xFB,
-	0x73, 0x04, 0x8D, 0xFC, 0x86, 0xFE, 0xED, 0x03, 0x96, 0xF7, 0x00, 0x02, 0x00, 0x14, 0x00, 0x00,
-	0x04, 0x54, 0x04, 0x8D, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0F, 0xB5, 0x07, 0x03, 0x05, 0x01, 0x7D,
-	0x03, 0x00, 0x2F, 0x3F, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x01, 0x33, 0x01, 0x23, 0x01, 0x01,
-	0x13, 0x23, 0x01, 0x02, 0x4E, 0x01, 0x40, 0xC6, 0xFE, 0x37, 0x8E, 0xFE, 0xDF, 0x01, 0x3E, 0x51,
-	0x8E, 0xFE, 0x37, 0x01, 0x23, 0x03, 0x6A, 0xFB, 0x73, 0x04, 0x8D, 0xFC, 0x97, 0xFE, 0xDC, 0x04,
-	0x8D, 0x00, 0x00, 0x01, 0x00, 0x75, 0xFF, 0xF0, 0x04, 0x0B, 0x04, 0x8D, 0x00, 0x15, 0x00, 0x0F,
-	0xB5, 0x0C, 0x11, 0x06, 0x00, 0x7D, 0x06, 0x00, 0x2F, 0x3F, 0x11, 0x33, 0x32, 0x30, 0x31, 0x41,
-	0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16,
-	0x33, 0x32, 0x36, 0x36, 0x35, 0x03, 0x51, 0xBA, 0x7D, 0xD1, 0x7E, 0x83, 0xCF, 0x78, 0xB7, 0x45,
-	0x7C, 0x52, 0x53, 0x7B, 0x44, 0x04, 0x8D, 0xFC, 0xF4, 0x84, 0xB3, 0x5A, 0x5A, 0xB3, 0x84, 0x03,
-	0x0C, 0xFC, 0xF4, 0x56, 0x6F, 0x35, 0x35, 0x6F, 0x56, 0x00, 0x00, 0x02, 0x00, 0x29, 0x00, 0x00,
-	0x03, 0xFD, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x07, 0x00, 0x11, 0xB6, 0x06, 0x07, 0x07, 0x01, 0x00,
-	0x7D, 0x01, 0x00, 0x2F, 0x3F, 0x11, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21,
-	0x15, 0x21, 0x35, 0x02, 0x6E, 0xB8, 0x02, 0x47, 0xFC, 0x2C, 0x04, 0x8D, 0xFB, 0x73, 0x04, 0x8D,
-	0x99, 0x99, 0x00, 0x01, 0x00, 0x44, 0xFF, 0xF0, 0x03, 0xDE, 0x04, 0x9D, 0x00, 0x39, 0x00, 0x18,
-	0x40, 0x0A, 0x0A, 0x26, 0x0F, 0x36, 0x31, 0x2B, 0x18, 0x14, 0x0F, 0x7E, 0x00, 0x3F, 0xCC, 0x33,
-	0x2F, 0xCC, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x34, 0x2E, 0x02, 0x27, 0x2E, 0x03, 0x35,
-	0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
-	0x15, 0x14, 0x1E, 0x02, 0x17, 0x1E, 0x03, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35,
-	0x33, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x03, 0x23, 0x19, 0x3C, 0x6A, 0x51, 0x61, 0x9C,
-	0x6F, 0x3B, 0x3E, 0x72, 0xA0, 0x62, 0x8C, 0xC7, 0x6A, 0xBA, 0x39, 0x73, 0x59, 0x53, 0x6E, 0x36,
-	0x20, 0x46, 0x70, 0x50, 0x61, 0x96, 0x67, 0x35, 0x3F, 0x75, 0xA3, 0x63, 0x58, 0xAB, 0x8B, 0x52,
-	0xBA, 0x2E, 0x52, 0x6A, 0x3C, 0x53, 0x72, 0x3A, 0x01, 0x2A, 0x25, 0x3B, 0x31, 0x2A, 0x13, 0x18,
-	0x3F, 0x55, 0x70, 0x49, 0x46, 0x75, 0x56, 0x2F, 0x61, 0xA1, 0x61, 0x3B, 0x5C, 0x35, 0x2C, 0x4C,
-	0x30, 0x22, 0x38, 0x2E, 0x2A, 0x14, 0x18, 0x42, 0x58, 0x72, 0x48, 0x49, 0x75, 0x52, 0x2C, 0x2D,
-	0x5B, 0x89, 0x5C, 0x3A, 0x52, 0x33, 0x18, 0x29, 0x4A, 0x00, 0x00, 0x02, 0x00, 0x8A, 0x00, 0x00,
-	0x04, 0x26, 0x04, 0x8D, 0x00, 0x19, 0x00, 0x1E, 0x00, 0x18, 0x40, 0x0A, 0x1B, 0x0D, 0x0D, 0x0C,
-	0x0C, 0x1A, 0x18, 0x17, 0x00, 0x7D, 0x00, 0x3F, 0x32, 0x2F, 0x33, 0x39, 0x2F, 0x33, 0x12, 0x39,
-	0x30, 0x31, 0x53, 0x21, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x06, 0x07, 0x07, 0x21, 0x27, 0x21,
-	0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x11, 0x23, 0x21, 0x01, 0x37, 0x01, 0x15,
-	0x8A, 0x01, 0xAA, 0x6A, 0xA6, 0x72, 0x3B, 0x45, 0x81, 0x59, 0x37, 0xFE, 0x76, 0x02, 0x01, 0x2A,
-	0x55, 0x70, 0x39, 0x36, 0x73, 0x5A, 0xF0, 0xBA, 0x02, 0xD5, 0xFE, 0xD4, 0xC3, 0x01, 0x30, 0x04,
-	0x8D, 0x2F, 0x5A, 0x84, 0x56, 0x56, 0x85, 0x5B, 0x18, 0x1B, 0x98, 0x35, 0x5B, 0x39, 0x3F, 0x5E,
-	0x35, 0xFC, 0x0C, 0x02, 0x07, 0x01, 0xFE, 0x02, 0x0A, 0x00, 0x00, 0x03, 0x00, 0x5A, 0xFF, 0x36,
-	0x04, 0x58, 0x04, 0x9D, 0x00, 0x03, 0x00, 0x19, 0x00, 0x2F, 0x00, 0x1C, 0x40, 0x0C, 0x00, 0x03,
-	0x03, 0x2B, 0x2B, 0x0A, 0x0A, 0x02, 0x20, 0x15, 0x7E, 0x02, 0x00, 0x2F, 0x3F, 0x33, 0x12, 0x39,
-	0x2F, 0x33, 0x12, 0x39, 0x11, 0x33, 0x30, 0x31, 0x65, 0x05, 0x07, 0x25, 0x01, 0x15, 0x14, 0x0E,
-	0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x07, 0x35,
-	0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02,
-	0x03, 0x14, 0x01, 0x44, 0x7D, 0xFE, 0xC5, 0x01, 0xB6, 0x48, 0x86, 0xBB, 0x74, 0x71, 0xBB, 0x89,
-	0x4A, 0x4A, 0x87, 0xBB, 0x71, 0x74, 0xBC, 0x86, 0x49, 0xB8, 0x2C, 0x54, 0x7A, 0x4D, 0x4B, 0x78,
-	0x55, 0x2D, 0x2E, 0x56, 0x78, 0x4B, 0x4D, 0x79, 0x54, 0x2B, 0x95, 0xF1, 0x6E, 0xF0, 0x02, 0x41,
-	0x42, 0x84, 0xD1, 0x93, 0x4D, 0x4D, 0x93, 0xD1, 0x84, 0x42, 0x84, 0xD1, 0x94, 0x4D, 0x4D, 0x94,
-	0xD1, 0xC6, 0x44, 0x63, 0x98, 0x68, 0x36, 0x36, 0x68, 0x98, 0x63, 0x44, 0x63, 0x99, 0x69, 0x36,
-	0x36, 0x69, 0x99, 0x00, 0x00, 0x01, 0x00, 0x8B, 0x00, 0x00, 0x04, 0x1B, 0x04, 0x8D, 0x00, 0x18,
-	0x00, 0x13, 0xB7, 0x02, 0x01, 0x01, 0x0D, 0x0C, 0x0F, 0x7D, 0x0D, 0x00, 0x2F, 0x3F, 0x33, 0x12,
-	0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x21, 0x35, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
-	0x23, 0x21, 0x11, 0x23, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x02, 0x5E, 0xFE,
-	0xB4, 0x01, 0x4C, 0x5C, 0x72, 0x36, 0x36, 0x72, 0x5C, 0xFE, 0xE6, 0xB9, 0x01, 0xD3, 0x8F, 0xC7,
-	0x67, 0x3A, 0x72, 0xA6, 0x01, 0xB6, 0x99, 0x35, 0x5C, 0x3C, 0x39, 0x62, 0x3D, 0xFC, 0x0C, 0x04,
-	0x8D, 0x5F, 0xA5, 0x6B, 0x54, 0x85, 0x5E, 0x31, 0x00, 0x02, 0x00, 0x60, 0xFF, 0xF0, 0x04, 0x5B,
-	0x04, 0x9D, 0x00, 0x15, 0x00, 0x2B, 0x00, 0x10, 0xB6, 0x27, 0x06, 0x1C, 0x11, 0x7E, 0x06, 0x0B,
-	0x00, 0x3F, 0x3F, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E,
-	0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x07, 0x35, 0x34, 0x2E, 0x02, 0x23,
-	0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x04, 0x5B, 0x48, 0x86,
-	0xBB, 0x73, 0x71, 0xBB, 0x89, 0x4A, 0x4A, 0x87, 0xBB, 0x71, 0x74, 0xBB, 0x87, 0x48, 0xB7, 0x2C,
-	0x54, 0x7A, 0x4D, 0x4A, 0x78, 0x55, 0x2E, 0x2E, 0x56, 0x79, 0x4A, 0x4E, 0x78, 0x54, 0x2B, 0x02,
-	0x67, 0x42, 0x84, 0xD1, 0x93, 0x4D, 0x4D, 0x93, 0xD1, 0x84, 0x42, 0x84, 0xD1, 0x94, 0x4D, 0x4D,
-	0x94, 0xD1, 0xC6, 0x44, 0x63, 0x98, 0x68, 0x36, 0x36, 0x68, 0x98, 0x63, 0x44, 0x63, 0x99, 0x69,
-	0x36, 0x36, 0x69, 0x99, 0x00, 0x01, 0x00, 0x8B, 0x00, 0x00, 0x04, 0x59, 0x04, 0x8D, 0x00, 0x09,
-	0x00, 0x11, 0xB6, 0x03, 0x08, 0x05, 0x01, 0x07, 0x00, 0x7D, 0x00, 0x3F, 0x32, 0x2F, 0x33, 0x39,
-	0x39, 0x30, 0x31, 0x41, 0x11, 0x23, 0x01, 0x11, 0x23, 0x11, 0x33, 0x01, 0x11, 0x04, 0x59, 0xB9,
-	0xFD, 0xA4, 0xB9, 0xB9, 0x02, 0x5C, 0x04, 0x8D, 0xFB, 0x73, 0x03, 0x6C, 0xFC, 0x94, 0x04, 0x8D,
-	0xFC, 0x94, 0x03, 0x6C, 0x00, 0x03, 0x00, 0x8B, 0x00, 0x00, 0x05, 0x78, 0x04, 0x8D, 0x00, 0x06,
-	0x00, 0x0B, 0x00, 0x10, 0x00, 0x16, 0x40, 0x09, 0x02, 0x0E, 0x0A, 0x05, 0x0C, 0x07, 0x04, 0x00,
-	0x7D, 0x00, 0x3F, 0x32, 0x32, 0x32, 0x2F, 0x33, 0x33, 0x39, 0x30, 0x31, 0x53, 0x33, 0x01, 0x01,
-	0x33, 0x01, 0x23, 0x01, 0x33, 0x13, 0x11, 0x23, 0x01, 0x33, 0x11, 0x23, 0x11, 0xCC, 0xAE, 0x01,
-	0x87, 0x01, 0x86, 0xAE, 0xFE, 0x0F, 0x87, 0xFD, 0xCE, 0x9D, 0x1B, 0xB8, 0x04, 0x4F, 0x9E, 0xB9,
-	0x04, 0x8D, 0xFC, 0x71, 0x03, 0x8F, 0xFB, 0x73, 0x04, 0x8D, 0xFD, 0x05, 0xFE, 0x6E, 0x04, 0x8D,
-	0xFB, 0x73, 0x01, 0x92, 0x00, 0x02, 0x00, 0x8B, 0x00, 0x00, 0x03, 0x8B, 0x04, 0x8D, 0x00, 0x03,
-	0x00, 0x07, 0x00, 0x0F, 0xB5, 0x06, 0x03, 0x02, 0x04, 0x7D, 0x02, 0x00, 0x2F, 0x3F, 0x11, 0x33,
-	0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x03, 0x8B, 0xFD, 0x8C, 0x2D,
-	0xB9, 0x98, 0x98, 0x98, 0x03, 0xF5, 0xFB, 0x73, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x8B, 0x00, 0x00,
-	0x04, 0x57, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x17, 0x40, 0x0C, 0x06, 0x07,
-	0x0B, 0x05, 0x0C, 0x08, 0x06, 0x0A, 0x01, 0x04, 0x00, 0x7D, 0x00, 0x3F, 0x32, 0x2F, 0x33, 0x17,
-	0x39, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x01, 0x27, 0x37, 0x01, 0x13, 0x01, 0x37,
-	0x01, 0x01, 0x44, 0xB9, 0x03, 0xAB, 0xFD, 0xFD, 0xFE, 0xE0, 0x24, 0xD7, 0x01, 0x8C, 0x24, 0xFE,
-	0x45, 0x7B, 0x02, 0x21, 0x04, 0x8D, 0xFB, 0x73, 0x04, 0x8D, 0xFD, 0xD3, 0xFE, 0xEA, 0xBC, 0xEC,
-	0x01, 0x9B, 0xFB, 0x73, 0x02, 0x2C, 0x84, 0xFD, 0x50, 0x00, 0x00, 0x01, 0x00, 0x2C, 0xFF, 0xF0,
-	0x03, 0x4D, 0x04, 0x8D, 0x00, 0x13, 0x00, 0x0D, 0xB4, 0x10, 0x0C, 0x07, 0x01, 0x7D, 0x00, 0x3F,
-	0x2F, 0xCC, 0x33, 0x30, 0x31, 0x41, 0x11, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26,
-	0x35, 0x33, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x02, 0x93, 0xBA, 0x65, 0xAF, 0x70, 0x76,
-	0xBB, 0x6C, 0xBA, 0x38, 0x67, 0x44, 0x3C, 0x5B, 0x33, 0x01, 0x53, 0x03, 0x3A, 0xFC, 0xC6, 0x6F,
-	0x9F, 0x55, 0x4B, 0x9A, 0x76, 0x45, 0x57, 0x28, 0x31, 0x5B, 0x00, 0x01, 0x00, 0x98, 0x00, 0x00,
-	0x01, 0x51, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x09, 0xB2, 0x00, 0x7D, 0x01, 0x00, 0x2F, 0x3F, 0x30,
-	0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x51, 0xB9, 0x04, 0x8D, 0xFB, 0x73, 0x04, 0x8D, 0x00, 0x03,
-	0x00, 0x8B, 0x00, 0x00, 0x04, 0x59, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x18,
-	0x40, 0x0A, 0x02, 0x03, 0x03, 0x04, 0x09, 0x05, 0x08, 0x04, 0x7D, 0x05, 0x00, 0x2F, 0x3F, 0x33,
-	0x11, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11,
-	0x21, 0x11, 0x23, 0x11, 0x03, 0xC0, 0xFD, 0x5F, 0x25, 0xB9, 0x03, 0xCE, 0xB9, 0x02, 0x8B, 0x99,
-	0x99, 0x02, 0x02, 0xFB, 0x73, 0x04, 0x8D, 0xFB, 0x73, 0x04, 0x8D, 0x00, 0x00, 0x01, 0x00, 0x64,
-	0xFF, 0xF0, 0x04, 0x36, 0x04, 0x9D, 0x00, 0x2A, 0x00, 0x16, 0x40, 0x09, 0x29, 0x2A, 0x2A, 0x05,
-	0x19, 0x10, 0x7E, 0x24, 0x05, 0x00, 0x2F, 0x33, 0x3F, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31,
-	0x41, 0x11, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16,
-	0x16, 0x17, 0x23, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32,
-	0x36, 0x37, 0x35, 0x21, 0x35, 0x04, 0x36, 0x19, 0x69, 0xB5, 0x8C, 0x74, 0xC1, 0x8D, 0x4D, 0x44,
-	0x83, 0xBD, 0x78, 0x94, 0xC5, 0x6D, 0x0F, 0xB7, 0x0B, 0x40, 0x75, 0x5C, 0x52, 0x7A, 0x51, 0x27,
-	0x30, 0x5B, 0x7F, 0x4F, 0x7C, 0x72, 0x18, 0xFE, 0xE7, 0x02, 0x50, 0xFE, 0x46, 0x20, 0x4E, 0x38,
-	0x4B, 0x8F, 0xCF, 0x84, 0x54, 0x83, 0xCE, 0x90, 0x4B, 0x5F, 0xA6, 0x6B, 0x3D, 0x62, 0x39, 0x36,
-	0x68, 0x95, 0x5F, 0x56, 0x61, 0x97, 0x68, 0x36, 0x35, 0x16, 0xEE, 0x90, 0x00, 0x03, 0x00, 0x8B,
-	0x00, 0x00, 0x03, 0x9B, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x1A, 0x40, 0x0B,
-	0x07, 0x06, 0x06, 0x01, 0x0A, 0x0B, 0x0B, 0x01, 0x00, 0x7D, 0x01, 0x00, 0x2F, 0x3F, 0x11, 0x39,
-	0x2F, 0x33, 0x11, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35,
-	0x01, 0x15, 0x21, 0x35, 0x01, 0x44, 0xB9, 0x02, 0xC1, 0xFD, 0xCC, 0x02, 0x83, 0xFD, 0x7D, 0x04,
-	0x8D, 0xFB, 0x73, 0x04, 0x8D, 0xFD, 0xFF, 0x98, 0x98, 0x02, 0x01, 0x99, 0x99, 0x00, 0x00, 0x03,
-	0x00, 0x44, 0xFF, 0x13, 0x03, 0xDE, 0x05, 0x73, 0x00, 0x03, 0x00, 0x07, 0x00, 0x41, 0x00, 0x29,
-	0x40, 0x13, 0x07, 0x3E, 0x3E, 0x24, 0x08, 0x17, 0x33, 0x06, 0x06, 0x33, 0x0B, 0x02, 0x20, 0x20,
-	0x17, 0x00, 0x00, 0x17, 0x7E, 0x00, 0x3F, 0x33, 0x2F, 0x11, 0x33, 0x11, 0x33, 0x3F, 0x33, 0x2F,
-	0x11, 0x12, 0x39, 0x39, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13, 0x11, 0x23,
-	0x11, 0x25, 0x34, 0x2E, 0x02, 0x27, 0x2E, 0x03, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16,
-	0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1E, 0x02, 0x17, 0x1E, 0x03,
-	0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x33, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36,
-	0x36, 0x02, 0x71, 0x95, 0x95, 0x95, 0x01, 0x47, 0x19, 0x3C, 0x6A, 0x51, 0x61, 0x9C, 0x6F, 0x3B,
-	0x3E, 0x72, 0xA0, 0x62, 0x8C, 0xC7, 0x6A, 0xBA, 0x39, 0x73, 0x59, 0x53, 0x6E, 0x36, 0x20, 0x46,
-	0x70, 0x50, 0x61, 0x96, 0x67, 0x35, 0x3F, 0x75, 0xA3, 0x63, 0x58, 0xAB, 0x8B, 0x52, 0xBA, 0x2E,
-	0x52, 0x6A, 0x3C, 0x53, 0x72, 0x3A, 0x05, 0x73, 0xFE, 0xCF, 0x01, 0x31, 0xFA, 0xD1, 0xFE, 0xCF,
-	0x01, 0x31, 0xE6, 0x25, 0x3B, 0x31, 0x2A, 0x13, 0x18, 0x3F, 0x55, 0x70, 0x49, 0x46, 0x75, 0x56,
-	0x2F, 0x61, 0xA1, 0x61, 0x3B, 0x5C, 0x35, 0x2C, 0x4C, 0x30, 0x22, 0x38, 0x2E, 0x2A, 0x14, 0x18,
-	0x42, 0x58, 0x72, 0x48, 0x49, 0x75, 0x52, 0x2C, 0x2D, 0x5B, 0x89, 0x5C, 0x3A, 0x52, 0x33, 0x18,
-	0x29, 0x4A, 0x00, 0x03, 0x00, 0x31, 0x00, 0x00, 0x03, 0xEF, 0x04, 0x9D, 0x00, 0x03, 0x00, 0x07,
-	0x00, 0x26, 0x00, 0x1D, 0x40, 0x0D, 0x04, 0x05, 0x05, 0x01, 0x22, 0x19, 0x7E, 0x0E, 0x02, 0x02,
-	0x0D, 0x01, 0x0A, 0x00, 0x3F, 0x33, 0x33, 0x11, 0x33, 0x3F, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x30,
-	0x31, 0x61, 0x21, 0x35, 0x21, 0x03, 0x15, 0x21, 0x35, 0x25, 0x13, 0x16, 0x06, 0x06, 0x07, 0x27,
-	0x3E, 0x03, 0x27, 0x03, 0x26, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26,
-	0x23, 0x22, 0x0E, 0x02, 0x03, 0xEF, 0xFC, 0x83, 0x03, 0x7D, 0xD2, 0xFD, 0x14, 0x01, 0x55, 0x08,
-	0x03, 0x12, 0x2E, 0x28, 0xAD, 0x1D, 0x24, 0x14, 0x07, 0x02, 0x09, 0x04, 0x33, 0x64, 0x8E, 0x58,
-	0x81, 0xAC, 0x55, 0xB9, 0x37, 0x5B, 0x37, 0x2E, 0x49, 0x32, 0x19, 0x98, 0x01, 0xD6, 0x79, 0x79,
-	0x7A, 0xFE, 0xEA, 0x50, 0x95, 0x77, 0x24, 0x46, 0x08, 0x43, 0x5E, 0x66, 0x2B, 0x01, 0x16, 0x68,
-	0xA2, 0x70, 0x3B, 0x61, 0xAE, 0x74, 0x55, 0x66, 0x2D, 0x24, 0x48, 0x69, 0x00, 0x05, 0x00, 0x0E,
-	0x00, 0x00, 0x03, 0x92, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0C, 0x00, 0x11, 0x00, 0x15,
-	0x00, 0x1B, 0x40, 0x0B, 0x06, 0x07, 0x03, 0x02, 0x02, 0x11, 0x14, 0x0A, 0x09, 0x11, 0x7D, 0x00,
-	0x3F, 0x33, 0x3F, 0x12, 0x39, 0x7C, 0x2F, 0x33, 0x18, 0xCE, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21,
-	0x35, 0x05, 0x15, 0x21, 0x35, 0x25, 0x01, 0x33, 0x01, 0x23, 0x03, 0x01, 0x07, 0x23, 0x01, 0x01,
-	0x11, 0x23, 0x11, 0x03, 0x3B, 0xFD, 0x23, 0x02, 0xDD, 0xFD, 0x23, 0x01, 0x46, 0x01, 0x2B, 0xC3,
-	0xFE, 0x92, 0x71, 0xDF, 0x01, 0x2D, 0x15, 0x6F, 0xFE, 0x91, 0x02, 0x1B, 0xB8, 0x02, 0x1A, 0x7A,
-	0x7A, 0xC4, 0x78, 0x78, 0x8F, 0x02, 0xA8, 0xFD, 0x00, 0x03, 0x00, 0xFD, 0x53, 0x53, 0x03, 0x00,
-	0xFD, 0x92, 0xFD, 0xE1, 0x02, 0x1F, 0x00, 0x02, 0x00, 0x8B, 0x00, 0x00, 0x03, 0x85, 0x04, 0x8D,
-	0x00, 0x03, 0x00, 0x07, 0x00, 0x0E, 0xB5, 0x07, 0x06, 0x03, 0x7D, 0x02, 0x0A, 0x00, 0x3F, 0x3F,
-	0x33, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x15, 0x21, 0x35, 0x01, 0x44, 0xB9, 0x02,
-	0xFA, 0xFD, 0x93, 0x04, 0x8D, 0xFB, 0x73, 0x04, 0x8D, 0x99, 0x99, 0x00, 0x00, 0x03, 0x00, 0x14,
-	0x00, 0x00, 0x04, 0x54, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x08, 0x00, 0x0D, 0x00, 0x1B, 0x40, 0x0C,
-	0x08, 0x0C, 0x7D, 0x00, 0x05, 0x05, 0x09, 0x02, 0x03, 0x03, 0x09, 0x0A, 0x00, 0x3F, 0x33, 0x11,
-	0x33, 0x11, 0x33, 0x11, 0x33, 0x3F, 0x33, 0x30, 0x31, 0x61, 0x35, 0x21, 0x15, 0x01, 0x01, 0x33,
-	0x01, 0x23, 0x01, 0x01, 0x13, 0x23, 0x01, 0x03, 0xBC, 0xFC, 0xEE, 0x01, 0xA4, 0x01, 0x40, 0xC6,
-	0xFE, 0x37, 0x8E, 0xFE, 0xDF, 0x01, 0x3E, 0x51, 0x8E, 0xFE, 0x37, 0x98, 0x98, 0x03, 0x6A, 0xFC,
-	0x96, 0x04, 0x8D, 0xFB, 0x73, 0x03, 0x69, 0x01, 0x24, 0xFB, 0x73, 0x00, 0x00, 0x03, 0x00, 0x60,
-	0xFF, 0xF0, 0x04, 0x5B, 0x04, 0x9D, 0x00, 0x03, 0x00, 0x19, 0x00, 0x2F, 0x00, 0x17, 0x40, 0x0A,
-	0x03, 0x02, 0x02, 0x0A, 0x20, 0x15, 0x7E, 0x2B, 0x0A, 0x0B, 0x00, 0x3F, 0x33, 0x3F, 0x33, 0x12,
-	0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x05, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22,
-	0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x07, 0x35, 0x34, 0x2E, 0x02,
-	0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x03, 0x55, 0xFE,
-	0x20, 0x02, 0xE6, 0x48, 0x86, 0xBB, 0x73, 0x71, 0xBB, 0x89, 0x4A, 0x4A, 0x87, 0xBB, 0x71, 0x74,
-	0xBB, 0x87, 0x48, 0xB7, 0x2C, 0x54, 0x7A, 0x4D, 0x4A, 0x78, 0x55, 0x2E, 0x2E, 0x56, 0x79, 0x4A,
-	0x4E, 0x78, 0x54, 0x2B, 0x02, 0x92, 0x98, 0x98, 0x2B, 0x42, 0x84, 0xD1, 0x93, 0x4D, 0x4D, 0x93,
-	0xD1, 0x84, 0x42, 0x84, 0xD1, 0x94, 0x4D, 0x4D, 0x94, 0xD1, 0xC6, 0x44, 0x63, 0x98, 0x68, 0x36,
-	0x36, 0x68, 0x98, 0x63, 0x44, 0x63, 0x99, 0x69, 0x36, 0x36, 0x69, 0x99, 0x00, 0x02, 0x00, 0x14,
-	0x00, 0x00, 0x04, 0x54, 0x04, 0x8D, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0E, 0xB5, 0x01, 0x09, 0x0A,
-	0x04, 0x08, 0x7D, 0x00, 0x3F, 0x33, 0x3F, 0x33, 0x30, 0x31, 0x41, 0x01, 0x33, 0x01, 0x23, 0x01,
-	0x01, 0x13, 0x23, 0x01, 0x02, 0x4E, 0x01, 0x40, 0xC6, 0xFE, 0x37, 0x8E, 0xFE, 0xDF, 0x01, 0x3E,
-	0x51, 0x8E, 0xFE, 0x37, 0x03, 0x6A, 0xFC, 0x96, 0x04, 0x8D, 0xFB, 0x73, 0x03, 0x69, 0x01, 0x24,
-	0xFB, 0x73, 0x00, 0x03, 0x00, 0x3E, 0x00, 0x00, 0x03, 0x4B, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x07,
-	0x00, 0x0B, 0x00, 0x17, 0x40, 0x0A, 0x07, 0x06, 0x06, 0x02, 0x0A, 0x0B, 0x7D, 0x03, 0x02, 0x0A,
-	0x00, 0x3F, 0x33, 0x3F, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01,
-	0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x03, 0x4B, 0xFC, 0xF3, 0x02, 0xCA, 0xFD, 0x77, 0x02,
-	0xCC, 0xFC, 0xF3, 0x98, 0x98, 0x98, 0x02, 0x14, 0x99, 0x99, 0x01, 0xE1, 0x98, 0x98, 0x00, 0x03,
-	0x00, 0x8B, 0x00, 0x00, 0x04, 0x44, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x13,
-	0xB7, 0x0A, 0x05, 0x0B, 0x07, 0x02, 0x00, 0x03, 0x7D, 0x00, 0x3F, 0x33, 0x33, 0x33, 0x33, 0x2F,
-	0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x33, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x03,
-	0xAE, 0xFD, 0x6F, 0x27, 0xB9, 0x03, 0xB9, 0xBA, 0x04, 0x8D, 0x98, 0x98, 0xFB, 0x73, 0x04, 0x8D,
-	0xFB, 0x73, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x40, 0x00, 0x01, 0x03, 0xC9, 0x04, 0x8D, 0x00, 0x03,
-	0x00, 0x07, 0x00, 0x10, 0x00, 0x25, 0x40, 0x12, 0x0D, 0x08, 0x09, 0x03, 0x0A, 0x06, 0x10, 0x10,
-	0x0E, 0x07, 0x7D, 0x0A, 0x02, 0x0C, 0x03, 0x03, 0x02, 0x0A, 0x00, 0x3F, 0x33, 0x11, 0x33, 0x11,
-	0x33, 0x3F, 0x33, 0x33, 0x11, 0x33, 0x12, 0x17, 0x39, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01,
-	0x15, 0x21, 0x35, 0x01, 0x15, 0x01, 0x23, 0x35, 0x01, 0x01, 0x35, 0x33, 0x03, 0xC9, 0xFC, 0xC1,
-	0x03, 0x0D, 0xFC, 0xD0, 0x02, 0x09, 0xFE, 0x3C, 0x6C, 0x01, 0x50, 0xFE, 0xB0, 0x6C, 0x99, 0x98,
-	0x98, 0x03, 0xF4, 0x98, 0x98, 0xFD, 0xC7, 0x19, 0xFD, 0xC6, 0x8F, 0x01, 0xB7, 0x01, 0xB7, 0x8F,
-	0x00, 0x03, 0x00, 0x61, 0x00, 0x00, 0x05, 0x06, 0x04, 0x8D, 0x00, 0x15, 0x00, 0x27, 0x00, 0x2B,
-	0x00, 0x15, 0x40, 0x09, 0x16, 0x00, 0x00, 0x2B, 0x7D, 0x1E, 0x0C, 0x2A, 0x0A, 0x00, 0x3F, 0xCD,
-	0x32, 0x3F, 0x33, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02,
-	0x23, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x17, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16,
-	0x16, 0x33, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x13, 0x11, 0x23, 0x11, 0x02,
-	0x86, 0x59, 0x75, 0xC9, 0x95, 0x54, 0x54, 0x95, 0xC9, 0x75, 0x59, 0x75, 0xC8, 0x95, 0x53, 0x53,
-	0x95, 0xC8, 0x75, 0x75, 0xA3, 0x55, 0x55, 0xA3, 0x75, 0x5B, 0x75, 0xA3, 0x56, 0x56, 0xA3, 0x75,
-	0x30, 0xBA, 0x04, 0x18, 0x3C, 0x77, 0xAE, 0x72, 0x72, 0xB0, 0x78, 0x3E, 0x3D, 0x77, 0xB0, 0x72,
-	0x72, 0xAF, 0x77, 0x3D, 0x9B, 0x41, 0x8B, 0x6E, 0x6E, 0x8C, 0x41, 0x42, 0x8D, 0x6E, 0x6E, 0x89,
-	0x41, 0x01, 0x10, 0xFB, 0x73, 0x04, 0x8D, 0x00, 0x00, 0x02, 0x00, 0x61, 0x00, 0x00, 0x04, 0xB6,
-	0x04, 0x8D, 0x00, 0x19, 0x00, 0x1D, 0x00, 0x1F, 0x40, 0x0E, 0x15, 0x14, 0x14, 0x06, 0x07, 0x07,
-	0x0D, 0x1C, 0x0E, 0x00, 0x1D, 0x1D, 0x0D, 0x7D, 0x00, 0x3F, 0x33, 0x11, 0x33, 0x3F, 0x12, 0x39,
-	0x11, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x23, 0x22,
-	0x2E, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1E, 0x02, 0x33, 0x33, 0x32, 0x36, 0x36, 0x35, 0x01,
-	0x11, 0x23, 0x11, 0x03, 0xFD, 0xB9, 0x83, 0xF7, 0xAE, 0x15, 0x7F, 0xC7, 0x8A, 0x48, 0xB9, 0x2C,
-	0x58, 0x83, 0x58, 0x15, 0x7C, 0xA2, 0x51, 0xFE, 0xEB, 0xB9, 0x04, 0x8D, 0xFE, 0xC8, 0xB6, 0xFE,
-	0x84, 0x4B, 0x91, 0xD4, 0x88, 0x01, 0x38, 0xFE, 0xC8, 0x64, 0x9B, 0x6B, 0x37, 0x61, 0xBB, 0x85,
-	0x01, 0x38, 0xFB, 0x73, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x76, 0x00, 0x00, 0x04, 0x7E, 0x04, 0x9D,
-	0x00, 0x2C, 0x00, 0x30, 0x00, 0x34, 0x00, 0x27, 0x40, 0x13, 0x2D, 0x34, 0x0A, 0x2E, 0x33, 0x0A,
-	0x28, 0x12, 0x12, 0x29, 0x11, 0x11, 0x32, 0x32, 0x31, 0x0A, 0x06, 0x1D, 0x7E, 0x00, 0x3F, 0x33,
-	0x3F, 0x33, 0x11, 0x33, 0x11, 0x33, 0x33, 0x11, 0x33, 0x3F, 0x33, 0x3F, 0x33, 0x30, 0x31, 0x41,
-	0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x17, 0x15, 0x2E,
-	0x03, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14, 0x0E, 0x02, 0x07,
-	0x35, 0x3E, 0x02, 0x01, 0x35, 0x21, 0x15, 0x21, 0x35, 0x21, 0x15, 0x03, 0xC2, 0x27, 0x51, 0x7C,
-	0x56, 0x55, 0x7C, 0x51, 0x27, 0x24, 0x46, 0x63, 0x3F, 0x6D, 0xA8, 0x74, 0x3C, 0x44, 0x83, 0xC0,
-	0x7B, 0x7B, 0xC0, 0x84, 0x44, 0x3B, 0x72, 0xA6, 0x6C, 0x5B, 0x73, 0x38, 0xFE, 0xFA, 0x01, 0xC2,
-	0xFB, 0xFC, 0x01, 0xC1, 0x02, 0x68, 0x26, 0x52, 0x88, 0x64, 0x36, 0x36, 0x64, 0x88, 0x52, 0x26,
-	0x66, 0x9D, 0x71, 0x47, 0x10, 0x7A, 0x0D, 0x5D, 0x98, 0xCA, 0x79, 0x24, 0x70, 0xC0, 0x90, 0x51,
-	0x51, 0x90, 0xC0, 0x70, 0x24, 0x79, 0xC9, 0x98, 0x5D, 0x0E, 0x7A, 0x16, 0x70, 0xBD, 0xFE, 0x20,
-	0x98, 0x98, 0x98, 0x98, 0x00, 0x03, 0x00, 0x27, 0xFF, 0xEC, 0x05, 0x2D, 0x04, 0x8D, 0x00, 0x03,
-	0x00, 0x07, 0x00, 0x23, 0x00, 0x1C, 0x40, 0x0D, 0x17, 0x16, 0x0B, 0x20, 0x0D, 0x0D, 0x03, 0x04,
-	0x0A, 0x05, 0x02, 0x03, 0x7D, 0x00, 0x3F, 0x33, 0x33, 0x3F, 0x12, 0x39, 0x2F, 0x33, 0x3F, 0x33,
-	0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x11, 0x33, 0x11, 0x03, 0x35, 0x3E, 0x02, 0x33, 0x32,
-	0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x35, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23,
-	0x22, 0x06, 0x06, 0x03, 0xB0, 0xFC, 0x77, 0x01, 0x63, 0xBA, 0x42, 0x38, 0x72, 0x80, 0x4B, 0x89,
-	0xC4, 0x69, 0x44, 0x7B, 0xA5, 0x62, 0x42, 0x65, 0x43, 0x22, 0x38, 0x6F, 0x55, 0x48, 0x80, 0x74,
-	0x04, 0x8D, 0x98, 0x98, 0xFB, 0x73, 0x04, 0x8D, 0xFB, 0x73, 0x02, 0x1C, 0x99, 0x15, 0x21, 0x12,
-	0x5A, 0xB3, 0x88, 0x6A, 0x92, 0x59, 0x27, 0x98, 0x18, 0x35, 0x58, 0x3F, 0x58, 0x6F, 0x35, 0x12,
-	0x21, 0x00, 0x00, 0x02, 0x00, 0x61, 0xFF, 0xF0, 0x04, 0x31, 0x04, 0x9D, 0x00, 0x03, 0x00, 0x2B,
-	0x00, 0x17, 0x40, 0x0A, 0x00, 0x01, 0x01, 0x09, 0x1D, 0x14, 0x7E, 0x28, 0x09, 0x0B, 0x00, 0x3F,
-	0x33, 0x3F, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x33, 0x0E,
-	0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23,
-	0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x02,
-	0xD9, 0xFD, 0xF6, 0x02, 0xA8, 0xBA, 0x0C, 0x71, 0xCD, 0x97, 0x71, 0xB6, 0x82, 0x46, 0x46, 0x84,
-	0xBB, 0x74, 0x92, 0xC8, 0x71, 0x0C, 0xBA, 0x0A, 0x3E, 0x76, 0x5F, 0x4F, 0x78, 0x51, 0x29, 0x25,
-	0x4C, 0x76, 0x50, 0x64, 0x78, 0x3F, 0x02, 0x94, 0x99, 0x99, 0xFE, 0xE5, 0x71, 0xB2, 0x66, 0x4D,
-	0x8F, 0xCA, 0x7D, 0x66, 0x7D, 0xCA, 0x90, 0x4D, 0x65, 0xB4, 0x75, 0x4D, 0x6E, 0x3B, 0x35, 0x67,
-	0x92, 0x5D, 0x67, 0x58, 0x91, 0x6A, 0x39, 0x38, 0x6D, 0x00, 0x00, 0x03, 0x00, 0x28, 0x00, 0x00,
-	0x06, 0xFB, 0x04, 0x8D, 0x00, 0x11, 0x00, 0x29, 0x00, 0x2D, 0x00, 0x20, 0x40, 0x0F, 0x28, 0x29,
-	0x29, 0x1C, 0x2C, 0x1D, 0x01, 0x2D, 0x7D, 0x1F, 0x1C, 0x0A, 0x0B, 0x08, 0x0A, 0x00, 0x3F, 0x33,
-	0x3F, 0x33, 0x3F, 0x33, 0x33, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x33, 0x03, 0x0E,
-	0x04, 0x23, 0x23, 0x37, 0x37, 0x3E, 0x04, 0x37, 0x25, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02,
-	0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x35, 0x03,
-	0x15, 0x21, 0x35, 0x01, 0x28, 0xBA, 0x14, 0x04, 0x1B, 0x33, 0x53, 0x78, 0x53, 0x36, 0x03, 0x29,
-	0x2B, 0x3E, 0x2A, 0x1B, 0x0F, 0x04, 0x04, 0x37, 0x89, 0xC1, 0x65, 0x39, 0x6F, 0xA0, 0x67, 0xFE,
-	0x31, 0xBA, 0x01, 0x15, 0x81, 0x75, 0x33, 0x6D, 0x56, 0xFE, 0xB8, 0x71, 0xFD, 0xC3, 0x04, 0x8D,
-	0xFD, 0xE6, 0x7D, 0xC9, 0x97, 0x64, 0x32, 0xA5, 0x01, 0x01, 0x22, 0x44, 0x6C, 0x97, 0x63, 0x65,
-	0x5B, 0xA2, 0x6C, 0x51, 0x86, 0x62, 0x36, 0x04, 0x8D, 0xFC, 0x0B, 0x84, 0x55, 0x37, 0x5D, 0x3A,
-	0x99, 0x01, 0xB5, 0x98, 0x98, 0x00, 0x00, 0x03, 0x00, 0x8B, 0x00, 0x00, 0x07, 0x0A, 0x04, 0x8D,
-	0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x21, 0x40, 0x0F, 0x17, 0x16, 0x16, 0x1B, 0x1A, 0x1A,
-	0x1E, 0x0B, 0x1F, 0x7D, 0x0D, 0x0A, 0x0A, 0x1E, 0x0A, 0x00, 0x3F, 0x33, 0x11, 0x33, 0x3F, 0x33,
-	0x12, 0x39, 0x2F, 0x33, 0x33, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E,
-	0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x35,
-	0x07, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x05, 0x5A, 0x89, 0xC1, 0x66, 0x3A, 0x6F, 0xA0,
-	0x67, 0xFE, 0x31, 0xBA, 0x01, 0x15, 0x82, 0x74, 0x33, 0x6C, 0x57, 0xFE, 0xB8, 0x66, 0xFD, 0x73,
-	0x25, 0xB9, 0x02, 0xD8, 0x5B, 0xA2, 0x6C, 0x51, 0x86, 0x62, 0x36, 0x04, 0x8D, 0xFC, 0x0B, 0x84,
-	0x55, 0x37, 0x5D, 0x3A, 0x99, 0x4D, 0x99, 0x99, 0x02, 0x02, 0xFB, 0x73, 0x04, 0x8D, 0x00, 0x03,
-	0x00, 0x29, 0x00, 0x00, 0x05, 0x2E, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1B, 0x00, 0x19,
-	0x40, 0x0B, 0x18, 0x0D, 0x0D, 0x03, 0x13, 0x04, 0x0A, 0x05, 0x02, 0x03, 0x7D, 0x00, 0x3F, 0x33,
-	0x33, 0x3F, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x01, 0x11, 0x33,
-	0x11, 0x03, 0x35, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26,
-	0x23, 0x22, 0x06, 0x06, 0x03, 0xB1, 0xFC, 0x78, 0x01, 0x63, 0xB9, 0x41, 0x38, 0x71, 0x80, 0x4B,
-	0x89, 0xC4, 0x69, 0xB9, 0x38, 0x70, 0x55, 0x48, 0x7F, 0x74, 0x04, 0x8D, 0x99, 0x99, 0xFB, 0x73,
-	0x04, 0x8D, 0xFB, 0x73, 0x02, 0x1C, 0x99, 0x15, 0x21, 0x12, 0x59, 0xB4, 0x8B, 0xFE, 0x9B, 0x01,
-	0x65, 0x5A, 0x71, 0x34, 0x12, 0x21, 0x00, 0x04, 0x00, 0x8B, 0xFE, 0x9A, 0x04, 0x43, 0x04, 0x8D,
-	0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x1B, 0x40, 0x0C, 0x0F, 0x0B, 0x7D, 0x03,
-	0x07, 0x07, 0x0E, 0x0A, 0x02, 0x02, 0x0A, 0x0A, 0x00, 0x3F, 0x33, 0x2F, 0x11, 0x33, 0x33, 0x11,
-	0x33, 0x3F, 0x33, 0x30, 0x31, 0x65, 0x11, 0x23, 0x11, 0x25, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23,
-	0x11, 0x21, 0x11, 0x23, 0x11, 0x02, 0xC5, 0xBA, 0x01, 0xA3, 0xFD, 0x6F, 0x27, 0xB9, 0x03, 0xB8,
-	0xB9, 0x84, 0xFE, 0x16, 0x01, 0xEA, 0x14, 0x98, 0x98, 0x03, 0xF5, 0xFB, 0x73, 0x04, 0x8D, 0xFB,
-	0x73, 0x04, 0x8D, 0x00, 0x00, 0x02, 0x00, 0x8B, 0x00, 0x00, 0x04, 0x09, 0x04, 0x8D, 0x00, 0x17,
-	0x00, 0x1B, 0x00, 0x1B, 0x40, 0x0C, 0x02, 0x01, 0x01, 0x0D, 0x0B, 0x0E, 0x0A, 0x1B, 0x1A, 0x1A,
-	0x0D, 0x7D, 0x00, 0x3F, 0x33, 0x11, 0x33, 0x3F, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41,
-	0x21, 0x15, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x23, 0x21, 0x11, 0x23, 0x11, 0x21, 0x32,
-	0x3E, 0x02, 0x35, 0x34, 0x26, 0x26, 0x13, 0x35, 0x21, 0x15, 0x02, 0x59, 0xFE, 0xB9, 0x01, 0x47,
-	0x57, 0x6C, 0x33, 0x74, 0x82, 0xFE, 0xEB, 0xB9, 0x01, 0xCE, 0x67, 0xA0, 0x6F, 0x3A, 0x66, 0xC1,
-	0xB3, 0xFD, 0x83, 0x02, 0xD8, 0x99, 0x3A, 0x5D, 0x37, 0x55, 0x84, 0x03, 0xF5, 0xFB, 0x73, 0x36,
-	0x62, 0x86, 0x51, 0x6C, 0xA2, 0x5B, 0x01, 0x1F, 0x96, 0x96, 0x00, 0x03, 0x00, 0x2E, 0xFE, 0xAC,
-	0x04, 0xE8, 0x04, 0x8D, 0x00, 0x10, 0x00, 0x16, 0x00, 0x1E, 0x00, 0x23, 0x40, 0x10, 0x1A, 0x1D,
-	0x1D, 0x09, 0x17, 0x0A, 0x0A, 0x1C, 0x14, 0x09, 0x0A, 0x16, 0x11, 0x11, 0x00, 0x7D, 0x00, 0x3F,
-	0x32, 0x11, 0x33, 0x3F, 0x33, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2F, 0x33, 0x30, 0x31, 0x41,
-	0x33, 0x03, 0x0E, 0x04, 0x07, 0x23, 0x37, 0x33, 0x3E, 0x03, 0x37, 0x13, 0x21, 0x11, 0x23, 0x11,
-	0x21, 0x01, 0x21, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x01, 0x52, 0xB7, 0x10, 0x05, 0x27, 0x3F,
-	0x4F, 0x5B, 0x2F, 0x5C, 0x05, 0x28, 0x20, 0x3F, 0x35, 0x23, 0x05, 0x3C, 0x02, 0xDB, 0xB9, 0xFD,
-	0xDE, 0xFE, 0xB1, 0x04, 0xB9, 0xBA, 0xFC, 0xBB, 0xBB, 0x04, 0x8D, 0xFE, 0x4A, 0x8A, 0xD3, 0x9D,
-	0x71, 0x4F, 0x1D, 0x98, 0x26, 0x56, 0x7C, 0xBC, 0x8D, 0x01, 0xB4, 0xFB, 0x73, 0x03, 0xF5, 0xFC,
-	0xA3, 0xFE, 0x14, 0x01, 0x54, 0xFE, 0xAD, 0x00, 0x00, 0x05, 0x00, 0x1F, 0x00, 0x00, 0x05, 0xEC,
-	0x04, 0x8D, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x13, 0x00, 0x17, 0x00, 0x35, 0x40, 0x19,
-	0x14, 0x17, 0x17, 0x11, 0x0C, 0x0B, 0x0B, 0x07, 0x07, 0x11, 0x11, 0x06, 0x0E, 0x0E, 0x0F, 0x0A,
-	0x02, 0x02, 0x15, 0x0A, 0x09, 0x03, 0x03, 0x0F, 0x7D, 0x00, 0x3F, 0x33, 0x11, 0x33, 0x3F, 0x33,
-	0x11, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11,
-	0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37,
-	0x09, 0x02, 0x33, 0x01, 0x33, 0x07, 0x27, 0x01, 0x23, 0x01, 0x03, 0x62, 0xB9, 0x03, 0x1F, 0xFE,
-	0x5D, 0xFE, 0xE2, 0x1C, 0xD1, 0x01, 0x2C, 0x1A, 0xFE, 0xB2, 0x87, 0x01, 0xB1, 0xFB, 0xF3, 0xFE,
-	0x64, 0xE1, 0x01, 0x2B, 0xD1, 0x1C, 0xAE, 0xFE, 0xB4, 0xEB, 0x01, 0xB5, 0x04, 0x8D, 0xFB, 0x73,
-	0x04, 0x8D, 0xFD, 0x6A, 0x99, 0x01, 0xFD, 0xFB, 0x73, 0x02, 0x13, 0x86, 0xFD, 0x67, 0x01, 0xF7,
-	0x02, 0x96, 0xFE, 0x03, 0x99, 0x1C, 0xFD, 0xED, 0x02, 0x99, 0x00, 0x02, 0x00, 0x48, 0xFF, 0xF0,
-	0x03, 0xD5, 0x04, 0x9D, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x1D, 0x40, 0x0D, 0x1F, 0x02, 0x02, 0x01,
-	0x3E, 0x3E, 0x15, 0x34, 0x2A, 0x0B, 0x0B, 0x15, 0x7E, 0x00, 0x3F, 0x33, 0x3F, 0x33, 0x12, 0x39,
-	0x2F, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34,
-	0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15,
-	0x14, 0x0E, 0x02, 0x27, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02,
-	0x35, 0x33, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x23, 0x02, 0x10,
-	0x92, 0x8E, 0x5A, 0x70, 0x33, 0x38, 0x74, 0x5C, 0x42, 0x6C, 0x41, 0xB9, 0x41, 0x73, 0x9A, 0x5A,
-	0x5F, 0xA3, 0x7A, 0x45, 0x43, 0x77, 0x9E, 0xEC, 0x92, 0x75, 0xAB, 0x6F, 0x36, 0x4A, 0x83, 0xA8,
-	0x5F, 0x48, 0x9A, 0x85, 0x52, 0xB9, 0x05, 0x46, 0x71, 0x44, 0x5A, 0x7E, 0x42, 0x23, 0x45, 0x65,
-	0x42, 0x8E, 0x02, 0x2C, 0x74, 0x2B, 0x4F, 0x36, 0x33, 0x50, 0x2F, 0x24, 0x4A, 0x3A, 0x4B, 0x77,
-	0x54, 0x2D, 0x25, 0x4D, 0x79, 0x53, 0x45, 0x71, 0x51, 0x2C, 0x45, 0x2F, 0x53, 0x6E, 0x3F, 0x57,
-	0x80, 0x53, 0x28, 0x20, 0x4D, 0x82, 0x61, 0x42, 0x50, 0x24, 0x2C, 0x53, 0x39, 0x33, 0x4B, 0x31,
-	0x18, 0x00, 0x00, 0x03, 0x00, 0x8B, 0x00, 0x00, 0x04, 0x62, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x07,
-	0x00, 0x0B, 0x00, 0x1B, 0x40, 0x0C, 0x00, 0x03, 0x0A, 0x07, 0x0B, 0x0A, 0x01, 0x02, 0x05, 0x05,
-	0x08, 0x7D, 0x00, 0x3F, 0x33, 0x11, 0x33, 0x33, 0x3F, 0x33, 0x33, 0x33, 0x33, 0x30, 0x31, 0x77,
-	0x01, 0x17, 0x01, 0x01, 0x33, 0x11, 0x23, 0x01, 0x33, 0x11, 0x23, 0xC0, 0x02, 0xE8, 0x83, 0xFD,
-	0x19, 0x02, 0x64, 0xBA, 0xBA, 0xFC, 0xE3, 0xB9, 0xB9, 0x5C, 0x04, 0x31, 0x5C, 0xFB, 0xCF, 0x04,
-	0x8D, 0xFB, 0x73, 0x04, 0x8D, 0xFB, 0x73, 0x00, 0x00, 0x03, 0x00, 0x8C, 0x00, 0x00, 0x04, 0x2C,
-	0x04, 0x8D, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x1F, 0x40, 0x0E, 0x0C, 0x0B, 0x0B, 0x07,
-	0x07, 0x06, 0x06, 0x02, 0x09, 0x03, 0x7D, 0x0A, 0x02, 0x0A, 0x00, 0x3F, 0x33, 0x3F, 0x33, 0x12,
-	0x39, 0x2F, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x23,
-	0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x45, 0xB9, 0x03, 0x81, 0xFD, 0xEA, 0xF0, 0x1C,
-	0xBE, 0x01, 0x84, 0x10, 0xFE, 0x5B, 0x6E, 0x02, 0x26, 0x04, 0x8D, 0xFB, 0x73, 0x04, 0x8D, 0xFD,
-	0x6A, 0x99, 0x01, 0xFD, 0xFB, 0x73, 0x02, 0x13, 0x86, 0xFD, 0x67, 0x00, 0x00, 0x03, 0x00, 0x28,
-	0x00, 0x00, 0x04, 0x37, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x07, 0x00, 0x19, 0x00, 0x18, 0x40, 0x0B,
-	0x13, 0x10, 0x0A, 0x07, 0x02, 0x03, 0x03, 0x08, 0x7D, 0x06, 0x0A, 0x00, 0x3F, 0x3F, 0x33, 0x11,
-	0x33, 0x33, 0x3F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x21, 0x11, 0x23, 0x11, 0x21, 0x33,
-	0x03, 0x0E, 0x04, 0x23, 0x23, 0x37, 0x37, 0x3E, 0x04, 0x37, 0x03, 0x93, 0xFD, 0xC3, 0x02, 0xE1,
-	0xBA, 0xFD, 0xAB, 0xBA, 0x16, 0x05, 0x1C, 0x34, 0x53, 0x76, 0x50, 0x36, 0x03, 0x29, 0x2B, 0x3D,
-	0x2A, 0x1A, 0x0F, 0x04, 0x04, 0x8D, 0x98, 0x98, 0xFB, 0x73, 0x04, 0x8D, 0xFD, 0xE6, 0x7D, 0xC9,
-	0x97, 0x64, 0x32, 0xA5, 0x03, 0x03, 0x22, 0x44, 0x6A, 0x95, 0x63, 0x00, 0x00, 0x02, 0x00, 0x23,
-	0xFF, 0xEC, 0x04, 0x0C, 0x04, 0x8D, 0x00, 0x12, 0x00, 0x17, 0x00, 0x17, 0x40, 0x0A, 0x01, 0x17,
-	0x7D, 0x15, 0x16, 0x16, 0x0E, 0x0E, 0x07, 0x0B, 0x00, 0x3F, 0x33, 0x11, 0x33, 0x11, 0x33, 0x3F,
-	0x33, 0x30, 0x31, 0x41, 0x01, 0x33, 0x01, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16,
-	0x33, 0x32, 0x36, 0x36, 0x37, 0x03, 0x13, 0x13, 0x07, 0x01, 0x02, 0x22, 0x01, 0x15, 0xD5, 0xFE,
-	0x6C, 0x21, 0x4B, 0x7C, 0x6B, 0x19, 0x42, 0x09, 0x06, 0x0B, 0x41, 0x10, 0x32, 0x41, 0x2B, 0x12,
-	0xDB, 0xFD, 0x70, 0x9F, 0xFE, 0x5D, 0x01, 0xB8, 0x02, 0xD5, 0xFC, 0x65, 0x4A, 0x77, 0x45, 0x04,
-	0x03, 0x94, 0x01, 0x03, 0x2D, 0x45, 0x24, 0x03, 0x74, 0xFD, 0xA4, 0xFE, 0xDA, 0x2F, 0x03, 0xB1,
-	0x00, 0x04, 0x00, 0x8B, 0xFE, 0xAC, 0x04, 0xF2, 0x04, 0x8D, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0D,
-	0x00, 0x11, 0x00, 0x1D, 0x40, 0x0D, 0x11, 0x0D, 0x7D, 0x05, 0x09, 0x09, 0x10, 0x0B, 0x08, 0x02,
-	0x02, 0x08, 0x0A, 0x00, 0x3F, 0x33, 0x2F, 0x11, 0x33, 0x33, 0x33, 0x11, 0x33, 0x3F, 0x33, 0x30,
-	0x31, 0x65, 0x03, 0x23, 0x11, 0x23, 0x35, 0x33, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x21,
-	0x11, 0x23, 0x11, 0x04, 0xF2, 0x12, 0xA6, 0x90, 0x04, 0xFD, 0x6F, 0x27, 0xB9, 0x03, 0xB9, 0xBA,
-	0x98, 0xFE, 0x14, 0x01, 0x54, 0x98, 0x98, 0x98, 0x03, 0xF5, 0xFB, 0x73, 0x04, 0x8D, 0xFB, 0x73,
-	0x04, 0x8D, 0x00, 0x02, 0x00, 0x3D, 0x00, 0x00, 0x03, 0xE0, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x17,
-	0x00, 0x13, 0xB7, 0x14, 0x09, 0x09, 0x02, 0x03, 0x0E, 0x7D, 0x02, 0x00, 0x2F, 0x3F, 0x33, 0x12,
-	0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13, 0x15, 0x0E, 0x02, 0x23, 0x22, 0x26,
-	0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x03, 0xE0, 0xBA, 0x42,
-	0x38, 0x72, 0x7F, 0x4C, 0x88, 0xC5, 0x69, 0xBA, 0x38, 0x70, 0x54, 0x49, 0x7F, 0x75, 0x04, 0x8D,
-	0xFB, 0x73, 0x04, 0x8D, 0xFD, 0xE6, 0x99, 0x15, 0x20, 0x13, 0x59, 0xB5, 0x8A, 0x01, 0x63, 0xFE,
-	0x9D, 0x5A, 0x70, 0x35, 0x13, 0x20, 0x00, 0x04, 0x00, 0x8B, 0x00, 0x00, 0x05, 0xC7, 0x04, 0x8D,
-	0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x19, 0x40, 0x0B, 0x0B, 0x07, 0x07, 0x0F,
-	0x10, 0x0A, 0x06, 0x06, 0x03, 0x0E, 0x7D, 0x00, 0x3F, 0x33, 0x33, 0x11, 0x33, 0x3F, 0x33, 0x11,
-	0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x21,
-	0x11, 0x23, 0x11, 0x05, 0x31, 0xFB, 0xC6, 0x02, 0x8E, 0xB9, 0x02, 0xFB, 0xBA, 0xFC, 0x37, 0xB9,
-	0x98, 0x98, 0x98, 0x03, 0xF5, 0xFB, 0x73, 0x04, 0x8D, 0xFB, 0x73, 0x04, 0x8D, 0xFB, 0x73, 0x04,
-	0x8D, 0x00, 0x00, 0x05, 0x00, 0x8B, 0xFE, 0xAC, 0x06, 0x75, 0x04, 0x8D, 0x00, 0x05, 0x00, 0x09,
-	0x00, 0x0D, 0x00, 0x11, 0x00, 0x15, 0x00, 0x27, 0x40, 0x12, 0x11, 0x0D, 0x0D, 0x15, 0x7D, 0x04,
-	0x10, 0x02, 0x02, 0x10, 0x10, 0x0C, 0x0C, 0x13, 0x13, 0x09, 0x08, 0x0A, 0x00, 0x3F, 0x33, 0x33,
-	0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2F, 0x11, 0x33, 0x3F, 0x33, 0x11, 0x33, 0x30, 0x31, 0x65,
-	0x03, 0x23, 0x11, 0x23, 0x35, 0x33, 0x15, 0x21, 0x35, 0x01, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23,
-	0x11, 0x21, 0x11, 0x23, 0x11, 0x06, 0x75, 0x12, 0xA5, 0x90, 0x03, 0xFB, 0xC6, 0x02, 0x8E, 0xB9,
-	0x02, 0xFC, 0xBB, 0xFC, 0x37, 0xB9, 0x98, 0xFE, 0x14, 0x01, 0x54, 0x98, 0x98, 0x98, 0x03, 0xF5,
-	0xFB, 0x73, 0x04, 0x8D, 0xFB, 0x73, 0x04, 0x8D, 0xFB, 0x73, 0x04, 0x8D, 0x00, 0x02, 0x00, 0x09,
-	0x00, 0x00, 0x04, 0xD7, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x1A, 0x00, 0x17, 0x40, 0x0A, 0x06, 0x05,
-	0x05, 0x0F, 0x12, 0x0A, 0x11, 0x01, 0x00, 0x7D, 0x00, 0x3F, 0x32, 0x32, 0x3F, 0x33, 0x39, 0x2F,
-	0x33, 0x30, 0x31, 0x53, 0x15, 0x21, 0x35, 0x01, 0x21, 0x15, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14,
-	0x06, 0x23, 0x21, 0x11, 0x23, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x09, 0x01,
-	0xB5, 0x01, 0x69, 0xFE, 0xB9, 0x01, 0x47, 0x57, 0x6D, 0x33, 0x75, 0x82, 0xFE, 0xEB, 0xB9, 0x01,
-	0xCE, 0x89, 0xC1, 0x66, 0x66, 0xC1, 0x04, 0x8D, 0x98, 0x98, 0xFE, 0x4B, 0x99, 0x3A, 0x5D, 0x37,
-	0x55, 0x84, 0x03, 0xF5, 0xFB, 0x73, 0x5E, 0xA6, 0x6B, 0x6C, 0xA2, 0x5B, 0xFF, 0xFF, 0x00, 0x8B,
-	0x00, 0x00, 0x05, 0x67, 0x04, 0x8D, 0x04, 0x26, 0x02, 0x22, 0x00, 0x00, 0x00, 0x07, 0x01, 0xFD,
-	0x04, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x8B, 0x00, 0x00, 0x04, 0x09, 0x04, 0x8D, 0x00, 0x16,
-	0x00, 0x15, 0x40, 0x09, 0x15, 0x16, 0x16, 0x0A, 0x0C, 0x09, 0x0A, 0x0A, 0x7D, 0x00, 0x3F, 0x3F,
-	0x33, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23,
-	0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x35, 0x02, 0x59,
-	0x89, 0xC1, 0x66, 0x66, 0xC1, 0x89, 0xFE, 0x32, 0xB9, 0x01, 0x15, 0x82, 0x74, 0x33, 0x6C, 0x57,
-	0xFE, 0xB9, 0x02, 0xD8, 0x5B, 0xA2, 0x6C, 0x6B, 0xA6, 0x5E, 0x04, 0x8D, 0xFC, 0x0B, 0x84, 0x55,
-	0x37, 0x5D, 0x3A, 0x99, 0x00, 0x02, 0x00, 0x4B, 0xFF, 0xF0, 0x04, 0x1B, 0x04, 0x9D, 0x00, 0x03,
-	0x00, 0x2B, 0x00, 0x17, 0x40, 0x0A, 0x02, 0x01, 0x01, 0x1C, 0x08, 0x27, 0x0B, 0x13, 0x1C, 0x7E,
-	0x00, 0x3F, 0x33, 0x3F, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x21, 0x35, 0x21, 0x01,
-	0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x07,
-	0x23, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26,
-	0x27, 0x03, 0xAD, 0xFD, 0xF7, 0x02, 0x09, 0xFD, 0x58, 0x0C, 0x3F, 0x79, 0x64, 0x50, 0x75, 0x4C,
-	0x25, 0x29, 0x51, 0x78, 0x4F, 0x5E, 0x76, 0x3E, 0x0B, 0xBA, 0x0D, 0x70, 0xC9, 0x91, 0x74, 0xBB,
-	0x84, 0x46, 0x46, 0x81, 0xB6, 0x71, 0x97, 0xCD, 0x71, 0x0D, 0x01, 0xFB, 0x99, 0xFE, 0xE5, 0x4D,
-	0x6D, 0x38, 0x39, 0x6A, 0x91, 0x58, 0x67, 0x5D, 0x92, 0x67, 0x35, 0x3B, 0x6E, 0x4D, 0x75, 0xB4,
-	0x65, 0x4D, 0x90, 0xCA, 0x7D, 0x66, 0x7D, 0xCA, 0x8F, 0x4D, 0x66, 0xB2, 0x71, 0x00, 0x00, 0x04,
-	0x00, 0x8B, 0xFF, 0xF0, 0x06, 0x16, 0x04, 0x9D, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1D, 0x00, 0x33,
-	0x00, 0x1D, 0x40, 0x0E, 0x24, 0x19, 0x7E, 0x2F, 0x0E, 0x0B, 0x03, 0x02, 0x02, 0x06, 0x07, 0x7D,
-	0x06, 0x0A, 0x00, 0x3F, 0x3F, 0x12, 0x39, 0x2F, 0x33, 0x3F, 0x33, 0x3F, 0x33, 0x30, 0x31, 0x41,
-	0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02,
-	0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x07, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22,
-	0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x02, 0x85, 0xFE, 0x6F, 0x50,
-	0xB9, 0x05, 0x8B, 0x48, 0x86, 0xBB, 0x73, 0x71, 0xBB, 0x89, 0x4A, 0x4A, 0x87, 0xBB, 0x71, 0x74,
-	0xBB, 0x87, 0x48, 0xB8, 0x2C, 0x54, 0x79, 0x4D, 0x4B, 0x78, 0x55, 0x2E, 0x2E, 0x57, 0x78, 0x4B,
-	0x4D, 0x79, 0x53, 0x2B, 0x02, 0x97, 0x99, 0x99, 0x01, 0xF6, 0xFB, 0x73, 0x04, 0x8D, 0xFD, 0xDA,
-	0x42, 0x84, 0xD1, 0x93, 0x4D, 0x4D, 0x93, 0xD1, 0x84, 0x42, 0x84, 0xD1, 0x94, 0x4D, 0x4D, 0x94,
-	0xD1, 0xC6, 0x44, 0x63, 0x98, 0x68, 0x36, 0x36, 0x68, 0x98, 0x63, 0x44, 0x63, 0x99, 0x69, 0x36,
-	0x36, 0x69, 0x99, 0x00, 0x00, 0x02, 0x00, 0x50, 0x00, 0x00, 0x03, 0xFD, 0x04, 0x8D, 0x00, 0x03,
-	0x00, 0x23, 0x00, 0x19, 0x40, 0x0B, 0x23, 0x00, 0x04, 0x04, 0x19, 0x1B, 0x16, 0x7D, 0x19, 0x01,
-	0x0A, 0x00, 0x3F, 0x33, 0x3F, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x33, 0x30, 0x31, 0x41, 0x01, 0x23,
-	0x01, 0x05, 0x21, 0x2E, 0x02, 0x27, 0x2E, 0x02, 0x27, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33,
-	0x21, 0x11, 0x23, 0x11, 0x21, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x21, 0x02, 0x4B, 0xFE,
-	0xCA, 0xC5, 0x01, 0x41, 0x01, 0xE5, 0xFE, 0x83, 0x0F, 0x0E, 0x11, 0x14, 0x03, 0x0E, 0x0E, 0x03,
-	0x5D, 0x77, 0x39, 0x38, 0x6E, 0x9E, 0x66, 0x01, 0xCB, 0xBA, 0xFE, 0xEF, 0x81, 0x6F, 0x30, 0x6A,
-	0x56, 0x01, 0x46, 0x02, 0x46, 0xFD, 0xBA, 0x02, 0x46, 0x66, 0x02, 0x06, 0x07, 0x04, 0x01, 0x08,
-	0x08, 0x01, 0x17, 0x59, 0x7A, 0x49, 0x51, 0x7F, 0x57, 0x2E, 0xFB, 0x73, 0x03, 0xF5, 0x6C, 0x58,
-	0x38, 0x54, 0x2D, 0x00, 0x00, 0x03, 0x00, 0x0B, 0x00, 0x00, 0x03, 0xE8, 0x04, 0x8D, 0x00, 0x03,
-	0x00, 0x07, 0x00, 0x0B, 0x00, 0x1B, 0x40, 0x0C, 0x0B, 0x0A, 0x0A, 0x03, 0x02, 0x06, 0x07, 0x07,
-	0x03, 0x7D, 0x02, 0x0A, 0x00, 0x3F, 0x3F, 0x33, 0x11, 0x33, 0x11, 0x12, 0x39, 0x2F, 0x33, 0x30,
-	0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0xA6, 0xB9,
-	0x02, 0xFB, 0xFD, 0x92, 0x01, 0x0E, 0xFD, 0x83, 0x04, 0x8D, 0xFB, 0x73, 0x04, 0x8D, 0x99, 0x99,
-	0xFE, 0x08, 0x98, 0x98, 0x00, 0x06, 0x00, 0x1F, 0xFE, 0xAC, 0x06, 0x23, 0x04, 0x8D, 0x00, 0x03,
-	0x00, 0x07, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x3B, 0x40, 0x1C, 0x02, 0x0E,
-	0x01, 0x01, 0x0E, 0x0E, 0x06, 0x1B, 0x18, 0x18, 0x15, 0x12, 0x12, 0x10, 0x0F, 0x0C, 0x09, 0x09,
-	0x13, 0x06, 0x06, 0x19, 0x0A, 0x0D, 0x07, 0x07, 0x13, 0x7D, 0x00, 0x3F, 0x33, 0x11, 0x33, 0x3F,
-	0x33, 0x11, 0x12, 0x39, 0x2F, 0x33, 0x33, 0x33, 0x33, 0x11, 0x33, 0x33, 0x11, 0x33, 0x11, 0x33,
-	0x11, 0x33, 0x2F, 0x11, 0x33, 0x30, 0x31, 0x41, 0x23, 0x11, 0x33, 0x01, 0x11, 0x23, 0x11, 0x21,
-	0x01, 0x21, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x09, 0x02, 0x33, 0x01, 0x33, 0x07, 0x27, 0x01,
-	0x23, 0x01, 0x06, 0x23, 0xA8, 0xA8, 0xFD, 0x3F, 0xB9, 0x03, 0x1F, 0xFE, 0x5D, 0xFE, 0xE2, 0x1C,
-	0xD1, 0x01, 0x2C, 0x1A, 0xFE, 0xB2, 0x87, 0x01, 0xB1, 0xFB, 0xF3, 0xFE, 0x64, 0xE1, 0x01, 0x2B,
-	0xD1, 0x1C, 0xAE, 0xFE, 0xB4, 0xEB, 0x01, 0xB5, 0xFE, 0xAC, 0x01, 0xEB, 0x03, 0xF6, 0xFB, 0x73,
-	0x04, 0x8D, 0xFD, 0x6A, 0x99, 0x01, 0xFD, 0xFB, 0x73, 0x02, 0x13, 0x86, 0xFD, 0x67, 0x01, 0xF7,
-	0x02, 0x96, 0xFE, 0x03, 0x99, 0x1C, 0xFD, 0xED, 0x02, 0x99, 0x00, 0x04, 0x00, 0x8C, 0xFE, 0xAC,
-	0x04, 0x4E, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x27, 0x40, 0x12,
-	0x10, 0x0F, 0x0F, 0x0B, 0x0A, 0x0A, 0x06, 0x0D, 0x07, 0x7D, 0x02, 0x0E, 0x01, 0x01, 0x0E, 0x0E,
-	0x06, 0x0A, 0x00, 0x3F, 0x33, 0x11, 0x33, 0x2F, 0x11, 0x33, 0x3F, 0x33, 0x12, 0x39, 0x2F, 0x33,
-	0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x23, 0x11, 0x33, 0x01, 0x11, 0x23, 0x11, 0x21, 0x01, 0x23,
-	0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x04, 0x4E, 0xA7, 0xA7, 0xFC, 0xF7, 0xB9, 0x03, 0x81,
-	0xFD, 0xEA, 0xF0, 0x1C, 0xBE, 0x01, 0x84, 0x10, 0xFE, 0x5B, 0x6E, 0x02, 0x26, 0xFE, 0xAC, 0x01,
-	0xEB, 0x03, 0xF6, 0xFB, 0x73, 0x04, 0x8D, 0xFD, 0x6A, 0x99, 0x01, 0xFD, 0xFB, 0x73, 0x02, 0x13,
-	0x86, 0xFD, 0x67, 0x00, 0x00, 0x04, 0x00, 0x8C, 0x00, 0x00, 0x04, 0xE8, 0x04, 0x8D, 0x00, 0x03,
-	0x00, 0x07, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x29, 0x40, 0x13, 0x10, 0x0F, 0x0F, 0x0A, 0x00, 0x0B,
-	0x0B, 0x0A, 0x03, 0x03, 0x0A, 0x0A, 0x06, 0x0D, 0x07, 0x7D, 0x0E, 0x06, 0x0A, 0x00, 0x3F, 0x33,
-	0x3F, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x2F, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30,
-	0x31, 0x41, 0x33, 0x11, 0x23, 0x03, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x21, 0x01, 0x13,
-	0x01, 0x37, 0x01, 0x01, 0x94, 0x95, 0x95, 0x4F, 0xB9, 0x04, 0x3D, 0xFD, 0xEA, 0xFE, 0x54, 0x1C,
-	0x01, 0x79, 0x01, 0x85, 0x10, 0xFE, 0x5B, 0x6E, 0x02, 0x26, 0x03, 0x75, 0xFD, 0xB4, 0x03, 0x64,
-	0xFB, 0x73, 0x04, 0x8D, 0xFD, 0x6A, 0x99, 0x01, 0xFD, 0xFB, 0x73, 0x02, 0x13, 0x86, 0xFD, 0x67,
-	0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x05, 0x15, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0D,
-	0x00, 0x11, 0x00, 0x21, 0x40, 0x0F, 0x10, 0x0F, 0x0F, 0x0B, 0x0A, 0x0A, 0x0E, 0x06, 0x0A, 0x0D,
-	0x07, 0x07, 0x03, 0x00, 0x7D, 0x00, 0x3F, 0x32, 0x32, 0x11, 0x33, 0x3F, 0x33, 0x39, 0x2F, 0x33,
-	0x33, 0x11, 0x33, 0x30, 0x31, 0x53, 0x21, 0x15, 0x21, 0x25, 0x11, 0x23, 0x11, 0x21, 0x01, 0x23,
-	0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x24, 0x01, 0xB5, 0xFE, 0x4B, 0x02, 0x0A, 0xB9, 0x03,
-	0x81, 0xFD, 0xEA, 0xF0, 0x1C, 0xBE, 0x01, 0x84, 0x10, 0xFE, 0x5C, 0x6D, 0x02, 0x26, 0x04, 0x8D,
-	0x98, 0x98, 0xFB, 0x73, 0x04, 0x8D, 0xFD, 0x6A, 0x99, 0x01, 0xFD, 0xFB, 0x73, 0x02, 0x13, 0x86,
-	0xFD, 0x67, 0x00, 0x01, 0x00, 0x60, 0xFF, 0xEB, 0x05, 0x5C, 0x04, 0xA0, 0x00, 0x44, 0x00, 0x1B,
-	0x40, 0x0C, 0x00, 0x01, 0x01, 0x2F, 0x18, 0x0B, 0x24, 0x23, 0x23, 0x3A, 0x0D, 0x7E, 0x00, 0x3F,
-	0x33, 0x33, 0x11, 0x33, 0x3F, 0x33, 0x33, 0x2F, 0x33, 0x30, 0x31, 0x65, 0x15, 0x22, 0x2E, 0x03,
-	0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22,
-	0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x15, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E,
-	0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15,
-	0x14, 0x1E, 0x02, 0x05, 0x5C, 0x95, 0xFC, 0xC5, 0x8A, 0x48, 0x34, 0x64, 0x91, 0x5C, 0x5C, 0x90,
-	0x65, 0x34, 0x5F, 0xAE, 0xEF, 0x91, 0x8B, 0xDC, 0x99, 0x51, 0x41, 0x79, 0xA7, 0x66, 0x3F, 0x64,
-	0x46, 0x25, 0x35, 0x67, 0x99, 0x63, 0x70, 0xAD, 0x78, 0x3E, 0x18, 0x31, 0x4D, 0x35, 0x34, 0x4D,
-	0x32, 0x18, 0x4E, 0x9B, 0xE9, 0x8A, 0x9E, 0x38, 0x6F, 0xA1, 0xD3, 0x81, 0x26, 0x75, 0xB7, 0x80,
-	0x43, 0x40, 0x7E, 0xB9, 0x78, 0x3A, 0x93, 0xEF, 0xAB, 0x5C, 0x52, 0x9F, 0xE6, 0x93, 0x1F, 0x86,
-	0xCF, 0x8E, 0x49, 0x9E, 0x30, 0x63, 0x94, 0x65, 0x21, 0x73, 0xAD, 0x73, 0x39, 0x44, 0x80, 0xB6,
-	0x71, 0x3D, 0x55, 0x7E, 0x53, 0x29, 0x2B, 0x55, 0x7D, 0x52, 0x2B, 0x80, 0xBF, 0x7E, 0x3F, 0x00,
-	0xFF, 0xFF, 0x00, 0x0E, 0x00, 0x00, 0x04, 0x1C, 0x04, 0x8D, 0x04, 0x26, 0x01, 0xED, 0x00, 0x00,
-	0x00, 0x07, 0x02, 0x40, 0x00, 0x44, 0xFE, 0xDD, 0x00, 0x02, 0x00, 0x27, 0xFE, 0xAC, 0x04, 0x71,
-	0x04, 0x8D, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x22, 0x40, 0x11, 0x0B, 0x0E, 0x08, 0x05, 0x04, 0x0A,
-	0x06, 0x0F, 0x7D, 0x02, 0x0A, 0x01, 0x01, 0x0A, 0x0A, 0x0D, 0x0A, 0x00, 0x3F, 0x33, 0x11, 0x33,
-	0x2F, 0x11, 0x33, 0x3F, 0x33, 0x12, 0x17, 0x39, 0x30, 0x31, 0x41, 0x23, 0x11, 0x33, 0x09, 0x02,
-	0x33, 0x01, 0x01, 0x23, 0x01, 0x01, 0x23, 0x01, 0x01, 0x04, 0x71, 0xA7, 0xA7, 0xFC, 0x9A, 0x01,
-	0x1D, 0x01, 0x1F, 0xDD, 0xFE, 0x75, 0x01, 0x99, 0xDD, 0xFE, 0xD6, 0xFE, 0xD8, 0xDC, 0x01, 0x96,
-	0xFE, 0x73, 0xFE, 0xAC, 0x01, 0xEB, 0x03, 0xF6, 0xFE, 0x4D, 0x01, 0xB3, 0xFD, 0xBE, 0xFD, 0xB5,
-	0x01, 0xBB, 0xFE, 0x45, 0x02, 0x4B, 0x02, 0x42, 0x00, 0x05, 0x00, 0x27, 0xFE, 0xAC, 0x05, 0xF3,
-	0x04, 0x8D, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x15, 0x00, 0x22, 0x40, 0x10,
-	0x11, 0x0D, 0x0D, 0x14, 0x15, 0x7D, 0x10, 0x12, 0x0C, 0x09, 0x04, 0x08, 0x02, 0x02, 0x08, 0x12,
-	0x00, 0x3F, 0x33, 0x2F, 0x11, 0x33, 0x33, 0x33, 0x3F, 0x3F, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31,
-	0x65, 0x03, 0x23, 0x11, 0x23, 0x35, 0x33, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11,
-	0x23, 0x11, 0x23, 0x15, 0x21, 0x35, 0x05, 0xF3, 0x12, 0xA6, 0x90, 0x04, 0xFD, 0x6E, 0x28, 0xBA,
-	0x03, 0xB9, 0xB9, 0xDB, 0xFC, 0x77, 0x98, 0xFE, 0x14, 0x01, 0x54, 0x98, 0x98, 0x98, 0x03, 0xF5,
-	0xFB, 0x73, 0x04, 0x8D, 0xFB, 0x73, 0x04, 0x8D, 0x98, 0x98, 0x00, 0x03, 0x00, 0x3D, 0x00, 0x00,
-	0x03, 0xE0, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1B, 0x00, 0x1F, 0x40, 0x0E, 0x00, 0x18,
-	0x18, 0x0D, 0x03, 0x03, 0x0D, 0x0D, 0x06, 0x07, 0x12, 0x7D, 0x06, 0x0A, 0x00, 0x3F, 0x3F, 0x33,
-	0x12, 0x39, 0x2F, 0x33, 0x2F, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x11, 0x23, 0x01,
-	0x11, 0x23, 0x11, 0x13, 0x15, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14,
-	0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x01, 0xC6, 0x94, 0x94, 0x02, 0x1A, 0xBA, 0x42, 0x38, 0x72,
-	0x7F, 0x4C, 0x88, 0xC5, 0x69, 0xBA, 0x38, 0x70, 0x54, 0x49, 0x7F, 0x75, 0x03, 0x1C, 0xFD, 0xB4,
-	0x03, 0xBD, 0xFB, 0x73, 0x04, 0x8D, 0xFD, 0xE6, 0x99, 0x15, 0x20, 0x13, 0x59, 0xB5, 0x8A, 0x01,
-	0x63, 0xFE, 0x9D, 0x5A, 0x70, 0x35, 0x13, 0x20, 0x00, 0x02, 0x00, 0x8B, 0x00, 0x00, 0x04, 0x2D,
-	0x04, 0x8D, 0x00, 0x03, 0x00, 0x17, 0x00, 0x14, 0x40, 0x09, 0x0F, 0x12, 0x14, 0x09, 0x09, 0x01,
-	0x7D, 0x00, 0x12, 0x00, 0x3F, 0x3F, 0x39, 0x2F, 0x33, 0x3F, 0x30, 0x31, 0x73, 0x11, 0x33, 0x11,
-	0x03, 0x35, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23,
-	0x22, 0x06, 0x06, 0x8B, 0xB9, 0x41, 0x38, 0x71, 0x80, 0x4B, 0x89, 0xC4, 0x69, 0xB9, 0x38, 0x70,
-	0x55, 0x48, 0x80, 0x74, 0x04, 0x8D, 0xFB, 0x73, 0x02, 0x1C, 0x99, 0x15, 0x21, 0x12, 0x59, 0xB4,
-	0x8B, 0xFE, 0x9B, 0x01, 0x65, 0x5A, 0x71, 0x34, 0x12, 0x21, 0x00, 0x01, 0x00, 0x02, 0xFF, 0xF0,
-	0x05, 0x6C, 0x04, 0x9D, 0x00, 0x34, 0x00, 0x1B, 0x40, 0x0C, 0x18, 0x18, 0x1D, 0x1D, 0x11, 0x11,
-	0x22, 0x0B, 0x7E, 0x2D, 0x00, 0x0B, 0x00, 0x3F, 0x32, 0x3F, 0x33, 0x39, 0x2F, 0x33, 0x11, 0x33,
-	0x2F, 0x30, 0x31, 0x45, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02,
-	0x15, 0x15, 0x21, 0x22, 0x2E, 0x02, 0x35, 0x33, 0x14, 0x16, 0x16, 0x33, 0x21, 0x35, 0x34, 0x26,
-	0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0E,
-	0x02, 0x03, 0x92, 0x83, 0xD0, 0x92, 0x4D, 0x4E, 0x8B, 0xBC, 0x6F, 0x80, 0xC3, 0x83, 0x42, 0xFC,
-	0x26, 0x63, 0x96, 0x64, 0x33, 0x99, 0x35, 0x6D, 0x55, 0x03, 0x21, 0x4A, 0x94, 0x71, 0x4A, 0x7A,
-	0x57, 0x2F, 0x2B, 0x5A, 0x8F, 0x64, 0x68, 0x8B, 0x30, 0x39, 0x19, 0x5D, 0x8A, 0x10, 0x4D, 0x8E,
-	0xC2, 0x76, 0x83, 0x77, 0xC4, 0x8F, 0x4D, 0x4A, 0x8A, 0xC4, 0x7B, 0x86, 0x35, 0x63, 0x8C, 0x56,
-	0x45, 0x66, 0x38, 0x1B, 0x66, 0x95, 0x51, 0x36, 0x64, 0x8C, 0x56, 0x83, 0x51, 0x87, 0x63, 0x36,
-	0x31, 0x16, 0x92, 0x0F, 0x29, 0x1F, 0x00, 0x01, 0x00, 0x5E, 0xFF, 0xF0, 0x04, 0x6A, 0x04, 0x9D,
-	0x00, 0x2B, 0x00, 0x15, 0x40, 0x09, 0x11, 0x14, 0x14, 0x19, 0x0B, 0x0B, 0x24, 0x00, 0x7E, 0x00,
-	0x3F, 0x32, 0x3F, 0x33, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14,
-	0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x21, 0x15, 0x21, 0x15, 0x14, 0x16, 0x16, 0x33,
-	0x32, 0x3E, 0x02, 0x35, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x07, 0x27, 0x3E, 0x02, 0x02,
-	0x48, 0x7F, 0xCA, 0x8E, 0x4B, 0x4D, 0x8C, 0xBC, 0x6E, 0x81, 0xC3, 0x83, 0x42, 0x03, 0x8E, 0xFD,
-	0x2C, 0x49, 0x95, 0x71, 0x4A, 0x79, 0x57, 0x2F, 0x2B, 0x5A, 0x8F, 0x64, 0x68, 0x8B, 0x2F, 0x39,
-	0x1A, 0x60, 0x90, 0x04, 0x9D, 0x4D, 0x8E, 0xC3, 0x76, 0x82, 0x77, 0xC4, 0x8F, 0x4D, 0x4A, 0x8A,
-	0xC4, 0x7B, 0x86, 0x98, 0x1A, 0x66, 0x95, 0x51, 0x36, 0x64, 0x8C, 0x56, 0x82, 0x51, 0x87, 0x63,
-	0x37, 0x31, 0x17, 0x92, 0x10, 0x29, 0x1F, 0x00, 0x00, 0x02, 0x00, 0x48, 0xFF, 0xEC, 0x03, 0xD5,
-	0x04, 0x8D, 0x00, 0x07, 0x00, 0x26, 0x00, 0x1B, 0x40, 0x0C, 0x08, 0x05, 0x05, 0x04, 0x26, 0x26,
-	0x1D, 0x13, 0x0B, 0x07, 0x00, 0x7D, 0x00, 0x3F, 0x32, 0x3F, 0x33, 0x39, 0x2F, 0x33, 0x33, 0x11,
-	0x33, 0x30, 0x31, 0x53, 0x21, 0x17, 0x01, 0x23, 0x35, 0x01, 0x21, 0x01, 0x33, 0x32, 0x1E, 0x02,
-	0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x33, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36,
-	0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x70, 0x03, 0x38, 0x01, 0xFE, 0x4A, 0x68, 0x01, 0x29, 0xFD,
-	0xBC, 0x01, 0x1B, 0x85, 0x75, 0xAB, 0x6F, 0x36, 0x4A, 0x83, 0xA8, 0x5F, 0x48, 0x9A, 0x85, 0x52,
-	0xB9, 0x05, 0x46, 0x71, 0x44, 0x5A, 0x7E, 0x42, 0x3E, 0x79, 0x58, 0x81, 0x04, 0x8D, 0x76, 0xFE,
-	0x39, 0x74, 0x01, 0x31, 0xFE, 0xC0, 0x3D, 0x67, 0x7D, 0x41, 0x5E, 0x88, 0x57, 0x2A, 0x22, 0x4D,
-	0x84, 0x61, 0x42, 0x53, 0x27, 0x2F, 0x5D, 0x45, 0x40, 0x59, 0x30, 0x00, 0x00, 0x03, 0x00, 0x60,
-	0xFF, 0xF0, 0x04, 0x5B, 0x04, 0x9D, 0x00, 0x15, 0x00, 0x24, 0x00, 0x34, 0x00, 0x1B, 0x40, 0x0E,
-	0x0B, 0x25, 0x6A, 0x2D, 0x1D, 0x6A, 0x2D, 0x2D, 0x0B, 0x00, 0x16, 0x6A, 0x00, 0x0B, 0x00, 0x2F,
-	0x2F, 0x2B, 0x12, 0x39, 0x2F, 0x2B, 0x2B, 0x30, 0x31, 0x41, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14,
-	0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x17, 0x22, 0x06, 0x06, 0x07,
-	0x06, 0x06, 0x07, 0x21, 0x26, 0x26, 0x27, 0x2E, 0x02, 0x03, 0x32, 0x36, 0x36, 0x37, 0x36, 0x34,
-	0x37, 0x21, 0x16, 0x16, 0x17, 0x1E, 0x03, 0x02, 0x5D, 0x74, 0xBB, 0x87, 0x48, 0x48, 0x86, 0xBB,
-	0x73, 0x71, 0xBB, 0x89, 0x4A, 0x4A, 0x87, 0xBB, 0x71, 0x59, 0x88, 0x55, 0x0B, 0x01, 0x01, 0x01,
-	0x02, 0x8A, 0x01, 0x01, 0x01, 0x0B, 0x53, 0x88, 0x5B, 0x5E, 0x89, 0x51, 0x0A, 0x01, 0x01, 0xFD,
-	0x76, 0x01, 0x01, 0x01, 0x08, 0x35, 0x54, 0x6F, 0x04, 0x9D, 0x4D, 0x94, 0xD1, 0x84, 0x42, 0x84,
-	0xD1, 0x93, 0x4D, 0x4D, 0x93, 0xD1, 0x84, 0x42, 0x84, 0xD1, 0x94, 0x4D, 0x9B, 0x4D, 0x95, 0x6C,
-	0x08, 0x11, 0x09, 0x09, 0x13, 0x08, 0x6B, 0x94, 0x4D, 0xFC, 0x88, 0x4E, 0x98, 0x6D, 0x08, 0x0F,
-	0x07, 0x08, 0x11, 0x08, 0x51, 0x7E, 0x55, 0x2C, 0x00, 0x04, 0x00, 0x31, 0x00, 0x00, 0x03, 0xEF,
-	0x04, 0x9D, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x2A, 0x00, 0x21, 0x40, 0x0F, 0x06, 0x07,
-	0x03, 0x02, 0x02, 0x09, 0x26, 0x1D, 0x7E, 0x12, 0x0A, 0x0A, 0x11, 0x09, 0x12, 0x00, 0x3F, 0x33,
-	0x33, 0x11, 0x33, 0x3F, 0x33, 0x12, 0x39, 0x2F, 0x33, 0xCE, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21,
-	0x35, 0x05, 0x15, 0x21, 0x35, 0x01, 0x21, 0x35, 0x21, 0x01, 0x13, 0x16, 0x06, 0x06, 0x07, 0x27,
-	0x3E, 0x03, 0x27, 0x03, 0x26, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x23, 0x34, 0x26, 0x26,
-	0x23, 0x22, 0x0E, 0x02, 0x03, 0x1D, 0xFD, 0x14, 0x02, 0xEC, 0xFD, 0x14, 0x03, 0xBE, 0xFC, 0x83,
-	0x03, 0x7D, 0xFD, 0x97, 0x08, 0x03, 0x12, 0x2E, 0x28, 0xAD, 0x1D, 0x24, 0x14, 0x07, 0x02, 0x09,
-	0x04, 0x33, 0x64, 0x8E, 0x58, 0x81, 0xAC, 0x55, 0xB9, 0x37, 0x5B, 0x37, 0x2E, 0x49, 0x32, 0x19,
-	0x02, 0xA9, 0x7A, 0x7A, 0xE7, 0x79, 0x79, 0xFE, 0x3E, 0x98, 0x02, 0x50, 0xFE, 0xEA, 0x50, 0x95,
-	0x77, 0x24, 0x46, 0x08, 0x43, 0x5E, 0x66, 0x2B, 0x01, 0x16, 0x68, 0xA2, 0x70, 0x3B, 0x61, 0xAE,
-	0x74, 0x55, 0x66, 0x2D, 0x24, 0x48, 0x69, 0x00, 0x00, 0x03, 0x00, 0x43, 0xFF, 0xF0, 0x03, 0x9F,
-	0x04, 0x9D, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x1D, 0x40, 0x0D, 0x27, 0x26, 0x26, 0x2A,
-	0x2B, 0x2B, 0x07, 0x19, 0x12, 0x7E, 0x00, 0x07, 0x0B, 0x00, 0x3F, 0x33, 0x3F, 0x33, 0x12, 0x39,
-	0x2F, 0x33, 0x33, 0x2F, 0x33, 0x30, 0x31, 0x65, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22,
-	0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22,
-	0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x13, 0x15, 0x21, 0x35, 0x05, 0x15, 0x21, 0x35, 0x02,
-	0xBA, 0x3B, 0x5B, 0x34, 0x1B, 0x37, 0x70, 0x3E, 0x71, 0xB2, 0x7C, 0x41, 0x40, 0x7B, 0xB2, 0x71,
-	0x3F, 0x6B, 0x3D, 0x15, 0x33, 0x64, 0x3B, 0x4B, 0x6E, 0x49, 0x23, 0x24, 0x49, 0x6F, 0xC1, 0xFD,
-	0x13, 0x02, 0xED, 0xFD, 0x13, 0x87, 0x0F, 0x0E, 0x95, 0x0F, 0x10, 0x40, 0x7F, 0xBC, 0x7B, 0xBC,
-	0x7B, 0xBE, 0x80, 0x42, 0x11, 0x0E, 0x94, 0x10, 0x0B, 0x2D, 0x59, 0x84, 0x57, 0xBE, 0x57, 0x83,
-	0x59, 0x2C, 0x02, 0x6E, 0x79, 0x79, 0xE6, 0x79, 0x79, 0x00, 0x00, 0x04, 0x00, 0x8B, 0x00, 0x00,
-	0x07, 0xAD, 0x04, 0x9D, 0x00, 0x03, 0x00, 0x15, 0x00, 0x27, 0x00, 0x31, 0x00, 0x29, 0x40, 0x12,
-	0x2B, 0x30, 0x2E, 0x2D, 0x24, 0x09, 0x09, 0x31, 0x2E, 0x7D, 0x2A, 0x2D, 0x0A, 0x1B, 0x12, 0x12,
-	0x02, 0x03, 0x00, 0x2F, 0x33, 0x33, 0x7C, 0x2F, 0x33, 0x18, 0x3F, 0x33, 0x3F, 0x33, 0x33, 0x2F,
-	0x33, 0x11, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x03, 0x35, 0x34, 0x36, 0x36,
-	0x33, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x37, 0x15, 0x14,
-	0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x01,
-	0x11, 0x23, 0x01, 0x11, 0x23, 0x11, 0x33, 0x01, 0x11, 0x07, 0x6F, 0xFD, 0xD3, 0x41, 0x54, 0x99,
-	0x69, 0x6A, 0x99, 0x53, 0x52, 0x99, 0x69, 0x6A, 0x9A, 0x54, 0xA3, 0x27, 0x51, 0x3D, 0x3C, 0x4F,
-	0x27, 0x28, 0x4F, 0x3D, 0x3C, 0x50, 0x27, 0xFE, 0xB5, 0xB9, 0xFD, 0xA4, 0xB9, 0xB9, 0x02, 0x5C,
-	0x01, 0x4B, 0x8E, 0x8E, 0x01, 0xB0, 0x53, 0x62, 0x97, 0x56, 0x56, 0x97, 0x62, 0x53, 0x61, 0x97,
-	0x56, 0x56, 0x97, 0xB4, 0x53, 0x38, 0x59, 0x33, 0x33, 0x59, 0x38, 0x53, 0x37, 0x58, 0x34, 0x34,
-	0x58, 0x01, 0x08, 0xFB, 0x73, 0x03, 0x6C, 0xFC, 0x94, 0x04, 0x8D, 0xFC, 0x94, 0x03, 0x6C, 0x00,
-	0x00, 0x02, 0x00, 0x28, 0x00, 0x00, 0x04, 0x67, 0x04, 0x8D, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x1B,
-	0x40, 0x0B, 0x1B, 0x1C, 0x02, 0x01, 0x01, 0x0E, 0x0C, 0x0F, 0x7D, 0x0E, 0x0A, 0x00, 0x3F, 0x3F,
-	0x33, 0x12, 0x39, 0x7C, 0x2F, 0x33, 0x18, 0xCE, 0x32, 0x30, 0x31, 0x41, 0x21, 0x35, 0x21, 0x32,
-	0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x11, 0x23, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15,
-	0x14, 0x0E, 0x02, 0x07, 0x15, 0x21, 0x35, 0x02, 0xB7, 0xFD, 0x71, 0x02, 0x8F, 0x57, 0x6C, 0x33,
-	0x33, 0x6C, 0x57, 0xFE, 0xEB, 0xB9, 0x01, 0xCE, 0x89, 0xC1, 0x66, 0x3A, 0x6F, 0xA0, 0x79, 0xFD,
-	0x83, 0x01, 0xA5, 0x98, 0x40, 0x64, 0x36, 0x39, 0x65, 0x40, 0xFC, 0x0B, 0x04, 0x8D, 0x61, 0xA8,
-	0x6B, 0x51, 0x88, 0x64, 0x37, 0x59, 0x97, 0x97, 0x00, 0x02, 0x00, 0x3F, 0xFF, 0xF5, 0x02, 0x9B,
-	0x03, 0x20, 0x00, 0x19, 0x00, 0x33, 0x00, 0x19, 0x40, 0x0A, 0x1B, 0x00, 0x00, 0x19, 0x1A, 0x1A,
-	0x08, 0x10, 0x2C, 0x24, 0x00, 0x2F, 0x33, 0xCC, 0x32, 0x39, 0x2F, 0x33, 0x33, 0x11, 0x33, 0x30,
-	0x31, 0x41, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x23, 0x34, 0x36,
-	0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x23, 0x15, 0x35, 0x33, 0x32, 0x16,
-	0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33, 0x32, 0x36,
-	0x35, 0x34, 0x26, 0x26, 0x23, 0x01, 0x0A, 0x54, 0x31, 0x40, 0x21, 0x40, 0x45, 0x39, 0x4B, 0x9D,
-	0x4C, 0x82, 0x50, 0x57, 0x84, 0x4A, 0x41, 0x7B, 0x58, 0x6F, 0x6F, 0x64, 0x80, 0x3E, 0x50, 0x8B,
-	0x57, 0x4B, 0x89, 0x56, 0x9D, 0x50, 0x42, 0x46, 0x49, 0x27, 0x47, 0x31, 0x01, 0xCB, 0x1C, 0x31,
-	0x20, 0x2C, 0x3C, 0x32, 0x2B, 0x44, 0x63, 0x36, 0x33, 0x64, 0x49, 0x35, 0x59, 0x35, 0x25, 0x4E,
-	0x30, 0x5A, 0x40, 0x49, 0x68, 0x36, 0x31, 0x68, 0x51, 0x2D, 0x3D, 0x3E, 0x31, 0x2A, 0x33, 0x17,
-	0x00, 0x02, 0x00, 0x36, 0x00, 0x00, 0x02, 0xBC, 0x03, 0x15, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x17,
-	0x40, 0x09, 0x03, 0x07, 0x07, 0x01, 0x01, 0x06, 0x05, 0x08, 0x0A, 0x00, 0x2F, 0xCC, 0x32, 0x32,
-	0x39, 0x2F, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x27, 0x01, 0x33, 0x07, 0x03, 0x01,
-	0x11, 0x23, 0x11, 0x02, 0xBC, 0xFD, 0x81, 0x07, 0x01, 0x7A, 0x7C, 0x89, 0xCF, 0x01, 0x7C, 0x9D,
-	0x01, 0x2C, 0x82, 0x66, 0x02, 0x05, 0xE5, 0xFE, 0xFC, 0x01, 0xE9, 0xFC, 0xEB, 0x03, 0x15, 0x00,
-	0x00, 0x01, 0x00, 0x5C, 0xFF, 0xF5, 0x02, 0xA8, 0x03, 0x15, 0x00, 0x21, 0x00, 0x12, 0xB6, 0x1F,
-	0x09, 0x09, 0x04, 0x03, 0x19, 0x11, 0x00, 0x2F, 0x33, 0xCC, 0x32, 0x39, 0x2F, 0x33, 0x30, 0x31,
-	0x53, 0x27, 0x13, 0x21, 0x15, 0x21, 0x07, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06,
-	0x06, 0x23, 0x22, 0x26, 0x26, 0x27, 0x33, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
-	0x22, 0x06, 0xEE, 0x7D, 0x31, 0x01, 0xDF, 0xFE, 0xA3, 0x17, 0x13, 0x4B, 0x2E, 0x55, 0x79, 0x41,
-	0x40, 0x82, 0x64, 0x4A, 0x84, 0x54, 0x04, 0x9B, 0x05, 0x4C, 0x3A, 0x49, 0x3F, 0x4E, 0x49, 0x37,
-	0x38, 0x01, 0x64, 0x20, 0x01, 0x91, 0x83, 0xAB, 0x08, 0x16, 0x3E, 0x74, 0x51, 0x47, 0x7B, 0x4B,
-	0x35, 0x66, 0x48, 0x33, 0x30, 0x52, 0x3D, 0x3E, 0x4E, 0x1C, 0x00, 0x01, 0x00, 0x56, 0xFF, 0xF5,
-	0x02, 0xAC, 0x03, 0x1F, 0x00, 0x2D, 0x00, 0x13, 0xB6, 0x13, 0x1C, 0x1C, 0x03, 0x00, 0x0C, 0x24,
-	0x00, 0x2F, 0x33, 0xCC, 0x32, 0x39, 0x7D, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x33, 0x15, 0x23, 0x22,
-	0x06, 0x06, 0x15, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22,
-	0x06, 0x06, 0x07, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22,
-	0x26, 0x26, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x02, 0x13, 0x16, 0x0B, 0x62, 0x86, 0x43, 0x26, 0x42,
-	0x2A, 0x2A, 0x3E, 0x22, 0x47, 0x44, 0x2B, 0x46, 0x2A, 0x02, 0x2A, 0x03, 0x3B, 0x6B, 0x48, 0x55,
-	0x71, 0x38, 0x47, 0x83, 0x5A, 0x5E, 0x89, 0x4B, 0x39, 0x71, 0xA6, 0x03, 0x1F, 0x83, 0x39, 0x76,
-	0x5A, 0x74, 0x38, 0x4C, 0x26, 0x26, 0x40, 0x28, 0x3E, 0x4B, 0x21, 0x34, 0x1C, 0x2F, 0x2B, 0x59,
-	0x3E, 0x46, 0x78, 0x4A, 0x4D, 0x7B, 0x47, 0x4D, 0x8D, 0x60, 0x37, 0x68, 0xA3, 0x72, 0x3C, 0x00,
-	0x00, 0x01, 0x00, 0x3B, 0x00, 0x00, 0x02, 0xA6, 0x03, 0x15, 0x00, 0x06, 0x00, 0x0C, 0xB3, 0x05,
-	0x01, 0x06, 0x02, 0x00, 0x2F, 0xCC, 0x32, 0x32, 0x30, 0x31, 0x41, 0x15, 0x01, 0x23, 0x01, 0x21,
-	0x35, 0x02, 0xA6, 0xFE, 0xA2, 0xA6, 0x01, 0x5E, 0xFE, 0x3B, 0x03, 0x15, 0x5A, 0xFD, 0x45, 0x02,
-	0x94, 0x81, 0x00, 0x04, 0x00, 0x4F, 0xFF, 0xF5, 0x02, 0x9F, 0x03, 0x20, 0x00, 0x0F, 0x00, 0x1F,
-	0x00, 0x2F, 0x00, 0x3D, 0x00, 0x17, 0x40, 0x0A, 0x0C, 0x24, 0x3B, 0x03, 0x14, 0x14, 0x34, 0x2C,
-	0x1C, 0x04, 0x00, 0x2F, 0x33, 0xCC, 0x32, 0x39, 0x2F, 0x17, 0x33, 0x30, 0x31, 0x65, 0x14, 0x06,
-	0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x07, 0x34, 0x26,
-	0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x13, 0x14, 0x06,
-	0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x07, 0x34, 0x26,
-	0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x02, 0x9F, 0x4D, 0x86, 0x54,
-	0x54, 0x86, 0x4F, 0x4D, 0x86, 0x55, 0x55, 0x86, 0x4D, 0x9C, 0x24, 0x3F, 0x29, 0x2A, 0x3E, 0x22,
-	0x22, 0x3F, 0x2A, 0x29, 0x3F, 0x23, 0x89, 0x47, 0x7C, 0x51, 0x51, 0x7D, 0x47, 0x47, 0x7D, 0x50,
-	0x50, 0x7D, 0x48, 0x9E, 0x1D, 0x35, 0x25, 0x37, 0x40, 0x1D, 0x36, 0x25, 0x37, 0x3F, 0xD8, 0x4B,
-	0x65, 0x33, 0x33, 0x65, 0x4B, 0x44, 0x62, 0x36, 0x36, 0x62, 0x38, 0x23, 0x31, 0x1B, 0x1B, 0x31,
-	0x23, 0x22, 0x32, 0x1B, 0x1B, 0x32, 0x01, 0x82, 0x3E, 0x5D, 0x33, 0x33, 0x5D, 0x3E, 0x47, 0x62,
-	0x33, 0x33, 0x62, 0x51, 0x1F, 0x2D, 0x1A, 0x36, 0x30, 0x1E, 0x2E, 0x1A, 0x38, 0x00, 0x00, 0x01,
-	0x00, 0x4A, 0xFF, 0xF9, 0x02, 0x95, 0x03, 0x20, 0x00, 0x2E, 0x00, 0x13, 0xB6, 0x12, 0x1B, 0x1B,
-	0x0A, 0x23, 0x01, 0x2D, 0x00, 0x2F, 0x33, 0xCC, 0x32, 0x39, 0x7C, 0x2F, 0x33, 0x30, 0x31, 0x77,
-	0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16,
-	0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36,
-	0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x23, 0xD1, 0x0E, 0x64, 0x7C,
-	0x3A, 0x25, 0x3E, 0x28, 0x2A, 0x3D, 0x21, 0x1F, 0x3E, 0x2D, 0x2D, 0x42, 0x25, 0x01, 0x2F, 0x02,
-	0x3C, 0x66, 0x43, 0x54, 0x74, 0x3B, 0x47, 0x83, 0x5A, 0x5D, 0x84, 0x46, 0x34, 0x6C, 0xA4, 0x71,
-	0x0F, 0x78, 0x34, 0x6C, 0x52, 0x92, 0x37, 0x48, 0x24, 0x2A, 0x45, 0x29, 0x28, 0x40, 0x26, 0x22,
-	0x34, 0x1A, 0x2D, 0x2E, 0x57, 0x38, 0x43, 0x77, 0x4E, 0x4D, 0x7F, 0x4D, 0x4D, 0x90, 0x65, 0x33,
-	0x69, 0xA1, 0x6F, 0x39, 0x00, 0x01, 0x00, 0x8F, 0x02, 0x8B, 0x03, 0x0C, 0x03, 0x23, 0x00, 0x03,
-	0x00, 0x08, 0xB1, 0x03, 0x02, 0x00, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x03, 0x0C,
-	0xFD, 0x83, 0x03, 0x23, 0x98, 0x98, 0x00, 0x03, 0x00, 0x9F, 0x04, 0x40, 0x02, 0x6F, 0x06, 0x72,
-	0x00, 0x03, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x19, 0x40, 0x09, 0x13, 0x0D, 0x0D, 0x07, 0x01, 0x03,
-	0x03, 0x19, 0x07, 0x00, 0x2F, 0x33, 0x33, 0x7C, 0x2F, 0x18, 0xCD, 0x11, 0x33, 0x11, 0x33, 0x30,
-	0x31, 0x41, 0x37, 0x33, 0x07, 0x07, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22,
-	0x26, 0x37, 0x14, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x01, 0x20, 0x92,
-	0xBD, 0xDC, 0xF4, 0x65, 0x46, 0x45, 0x63, 0x63, 0x45, 0x46, 0x65, 0x54, 0x34, 0x23, 0x23, 0x31,
-	0x31, 0x23, 0x23, 0x34, 0x05, 0xBB, 0xB7, 0xB7, 0xD8, 0x4A, 0x5D, 0x5D, 0x4A, 0x48, 0x5B, 0x5B,
-	0x48, 0x23, 0x31, 0x31, 0x23, 0x26, 0x32, 0x32, 0x00, 0x04, 0x00, 0x8B, 0x00, 0x00, 0x03, 0xAF,
-	0x04, 0x8D, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x1B, 0x40, 0x0C, 0x0B, 0x0A,
-	0x0A, 0x06, 0x0F, 0x0E, 0x07, 0x7D, 0x03, 0x02, 0x06, 0x0A, 0x00, 0x3F, 0x33, 0x33, 0x3F, 0x33,
-	0x33, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01,
-	0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x03, 0xAF, 0xFD, 0x68, 0x2D, 0xB9, 0x02, 0xCD, 0xFD,
-	0xBF, 0x02, 0x92, 0xFD, 0x6E, 0x98, 0x98, 0x98, 0x03, 0xF5, 0xFB, 0x73, 0x04, 0x8D, 0xFE, 0x19,
-	0x97, 0x97, 0x01, 0xE7, 0x99, 0x99, 0x00, 0x04, 0x00, 0x1F, 0xFE, 0x4A, 0x04, 0x11, 0x04, 0x4E,
-	0x00, 0x12, 0x00, 0x24, 0x00, 0x5B, 0x00, 0x5F, 0x00, 0x33, 0x40, 0x1A, 0x5D, 0x5F, 0x06, 0x72,
-	0x25, 0x26, 0x18, 0x18, 0x0F, 0x40, 0x41, 0x41, 0x2E, 0x53, 0x53, 0x0F, 0x0F, 0x05, 0x4A, 0x37,
-	0x0F, 0x72, 0x21, 0x05, 0x07, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x11, 0x39, 0x2F, 0x39, 0x11,
-	0x33, 0x33, 0x11, 0x33, 0x11, 0x33, 0x12, 0x39, 0x39, 0x2B, 0x32, 0x30, 0x31, 0x53, 0x35, 0x34,
-	0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x37,
-	0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
-	0x06, 0x13, 0x17, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
-	0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x36, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x15, 0x14,
-	0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x22, 0x26, 0x26, 0x35,
-	0x34, 0x36, 0x36, 0x01, 0x17, 0x21, 0x27, 0x5D, 0x6D, 0xC1, 0x7E, 0x80, 0xC1, 0x6C, 0x3E, 0x71,
-	0x9D, 0x5F, 0x7F, 0xC2, 0x6D, 0xB9, 0x3D, 0x6E, 0x4A, 0x49, 0x6D, 0x3C, 0x3D, 0x6E, 0x49, 0x48,
-	0x6E, 0x3D, 0x27, 0x5E, 0x1B, 0x40, 0x22, 0x3A, 0x23, 0xAC, 0x82, 0xB7, 0x62, 0x47, 0x8A, 0xC7,
-	0x80, 0x71, 0xAD, 0x75, 0x3C, 0x5A, 0x85, 0x42, 0x37, 0x2A, 0x48, 0x2D, 0x21, 0x45, 0x68, 0x48,
-	0x55, 0x83, 0x59, 0x2E, 0x29, 0x63, 0x56, 0xD0, 0x45, 0x75, 0x48, 0x37, 0x4D, 0x02, 0xF2, 0x02,
-	0xFE, 0x83, 0x0B, 0x02, 0xD2, 0x16, 0x68, 0xA2, 0x5C, 0x5C, 0xA2, 0x68, 0x16, 0x49, 0x82, 0x63,
-	0x38, 0x61, 0xA3, 0x78, 0x16, 0x34, 0x5F, 0x3C, 0x3C, 0x5F, 0x34, 0x16, 0x38, 0x5D, 0x39, 0x39,
-	0x5D, 0xFE, 0xAE, 0x32, 0x10, 0x3D, 0x38, 0x1F, 0x25, 0x0F, 0x3F, 0x82, 0x65, 0x39, 0x78, 0x65,
-	0x3E, 0x2C, 0x4E, 0x64, 0x37, 0x59, 0x7D, 0x4B, 0x0D, 0x4D, 0x07, 0x35, 0x4F, 0x31, 0x21, 0x3B,
-	0x2D, 0x1A, 0x23, 0x39, 0x42, 0x1F, 0x2D, 0x40, 0x22, 0x26, 0x4F, 0x3E, 0x43, 0x5C, 0x3C, 0x02,
-	0x7F, 0x92, 0x92, 0x00, 0x00, 0x04, 0x00, 0x64, 0xFF, 0xEB, 0x04, 0x59, 0x04, 0x4E, 0x00, 0x15,
-	0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x17, 0x40, 0x0C, 0x30, 0x0A, 0x2D, 0x06, 0x1C, 0x11,
-	0x0B, 0x72, 0x27, 0x06, 0x07, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x3F, 0x3F, 0x30, 0x31, 0x53,
-	0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x17, 0x15, 0x0E, 0x03, 0x23, 0x22, 0x2E, 0x02,
-	0x37, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x37, 0x35, 0x2E, 0x03, 0x23, 0x22, 0x0E,
-	0x02, 0x05, 0x13, 0x33, 0x0B, 0x02, 0x33, 0x13, 0x64, 0x38, 0x6B, 0x9E, 0x66, 0x66, 0x98, 0x6A,
-	0x3E, 0x0C, 0x0B, 0x3E, 0x6B, 0x99, 0x67, 0x64, 0x9D, 0x6C, 0x38, 0xBA, 0x20, 0x43, 0x6B, 0x4B,
-	0x3F, 0x5E, 0x43, 0x2C, 0x0E, 0x0B, 0x2A, 0x43, 0x60, 0x40, 0x4C, 0x6B, 0x44, 0x20, 0x02, 0x35,
-	0x4E, 0xB1, 0x6A, 0x40, 0x55, 0x95, 0x71, 0x01, 0xF5, 0x15, 0x80, 0xD4, 0x9B, 0x55, 0x49, 0x89,
-	0xC1, 0x79, 0x4B, 0x78, 0xC1, 0x8A, 0x49, 0x4D, 0x8C, 0xBF, 0x87, 0x15, 0x4D, 0x86, 0x66, 0x39,
-	0x40, 0x6E, 0x8C, 0x4C, 0x25, 0x4A, 0x8B, 0x71, 0x42, 0x44, 0x76, 0x9B, 0x45, 0x02, 0x1E, 0xFD,
-	0xE2, 0xFD, 0xE4, 0x02, 0x1C, 0xFD, 0xE4, 0x00, 0x00, 0x02, 0x00, 0xB2, 0x00, 0x00, 0x04, 0xE4,
-	0x05, 0xB0, 0x00, 0x19, 0x00, 0x2E, 0x00, 0x1F, 0x40, 0x0F, 0x26, 0x08, 0x1B, 0x1A, 0x1A, 0x02,
-	0x01, 0x01, 0x0E, 0x0C, 0x0F, 0x02, 0x72, 0x0E, 0x08, 0x00, 0x3F, 0x2B, 0x32, 0x12, 0x39, 0x2F,
-	0x33, 0x33, 0x11, 0x33, 0x3F, 0x30, 0x31, 0x41, 0x21, 0x27, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34,
-	0x26, 0x26, 0x23, 0x21, 0x11, 0x23, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x0F,
-	0x02, 0x37, 0x32, 0x16, 0x16, 0x15, 0x15, 0x14, 0x16, 0x16, 0x17, 0x15, 0x23, 0x2E, 0x02, 0x35,
-	0x35, 0x34, 0x26, 0x26, 0x02, 0xDF, 0xFE, 0x66, 0x02, 0x01, 0x68, 0x74, 0x8C, 0x3F, 0x3E, 0x84,
-	0x6B, 0xFE, 0xB6, 0xC1, 0x02, 0x0D, 0xA0, 0xDB, 0x71, 0x54, 0xA0, 0x72, 0x18, 0x54, 0x16, 0xA7,
-	0xBC, 0x4E, 0x0C, 0x1E, 0x1A, 0xC6, 0x1E, 0x1A, 0x06, 0x3F, 0x76, 0x02, 0x75, 0x9D, 0x3B, 0x72,
-	0x52, 0x4E, 0x74, 0x3F, 0xFA, 0xEE, 0x05, 0xB0, 0x5F, 0xB8, 0x88, 0x5D, 0x92, 0x65, 0x1A, 0x1B,
-	0x13, 0x6F, 0x5F, 0xA8, 0x6C, 0x85, 0x28, 0x4F, 0x43, 0x19, 0x19, 0x1B, 0x5D, 0x5C, 0x1A, 0x81,
-	0x4F, 0x76, 0x41, 0x00, 0x00, 0x03, 0x00, 0xB2, 0x00, 0x00, 0x05, 0x1E, 0x05, 0xB0, 0x00, 0x03,
-	0x00, 0x09, 0x00, 0x0D, 0x00, 0x20, 0x40, 0x10, 0x0A, 0x08, 0x09, 0x02, 0x0C, 0x0B, 0x0B, 0x07,
-	0x06, 0x06, 0x02, 0x03, 0x02, 0x72, 0x02, 0x08, 0x00, 0x3F, 0x2B, 0x12, 0x39, 0x2F, 0x33, 0x33,
-	0x11, 0x33, 0x3F, 0x3F, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x21, 0x01,
-	0x13, 0x01, 0x37, 0x01, 0x01, 0x73, 0xC1, 0x04, 0x42, 0xFD, 0x88, 0xFE, 0xAA, 0x1E, 0x01, 0x01,
-	0x01, 0xFC, 0x2D, 0xFD, 0xDD, 0x6C, 0x02, 0xA3, 0x05, 0xB0, 0xFA, 0x50, 0x05, 0xB0, 0xFC, 0xDF,
-	0xA0, 0x02, 0x81, 0xFA, 0x50, 0x02, 0xA8, 0xA9, 0xFC, 0xAF, 0x00, 0x03, 0x00, 0x93, 0x00, 0x00,
-	0x04, 0x15, 0x06, 0x00, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x1C, 0x40, 0x0E, 0x0B, 0x07,
-	0x06, 0x06, 0x02, 0x09, 0x06, 0x72, 0x03, 0x00, 0x72, 0x0A, 0x02, 0x0A, 0x00, 0x3F, 0x33, 0x2B,
-	0x2B, 0x12, 0x39, 0x2F, 0x33, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x01, 0x21, 0x27,
-	0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x4C, 0xB9, 0x03, 0x4E, 0xFE, 0x43, 0xFE, 0xE6, 0x16,
-	0xD6, 0x01, 0x3B, 0x34, 0xFE, 0x8C, 0x62, 0x01, 0xEE, 0x06, 0x00, 0xFA, 0x00, 0x06, 0x00, 0xFE,
-	0x3A, 0xFD, 0xBB, 0x9A, 0x01, 0xAB, 0xFB, 0xC6, 0x02, 0x02, 0xA5, 0xFD, 0x59, 0x00, 0x00, 0x03,
-	0x00, 0xB2, 0x00, 0x00, 0x04, 0xFB, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x1A,
-	0x40, 0x0E, 0x06, 0x0B, 0x07, 0x08, 0x0C, 0x05, 0x02, 0x09, 0x03, 0x02, 0x72, 0x0A, 0x02, 0x08,
-	0x00, 0x3F, 0x33, 0x2B, 0x32, 0x12, 0x17, 0x39, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01,
-	0x21, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x73, 0xC1, 0x04, 0x20, 0xFD, 0x51, 0xFE,
-	0xEE, 0x0B, 0x78, 0x02, 0x64, 0x2B, 0xFD, 0x35, 0xA1, 0x03, 0x18, 0x05, 0xB0, 0xFA, 0x50, 0x05,
-	0xB0, 0xFD, 0x1F, 0x5B, 0x02, 0x86, 0xFA, 0x50, 0x02, 0xE8, 0x65, 0xFC, 0xB3, 0x00, 0x00, 0x03,
-	0x00, 0x93, 0x00, 0x00, 0x03, 0xF2, 0x06, 0x18, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x20,
-	0x40, 0x10, 0x0C, 0x0B, 0x0B, 0x07, 0x06, 0x06, 0x02, 0x09, 0x06, 0x72, 0x03, 0x01, 0x72, 0x0A,
-	0x02, 0x0A, 0x00, 0x3F, 0x33, 0x2B, 0x2B, 0x12, 0x39, 0x2F, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31,
-	0x41, 0x11, 0x23, 0x11, 0x01, 0x01, 0x23, 0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x4C,
-	0xB9, 0x03, 0x35, 0xFD, 0xDC, 0x9A, 0x16, 0x59, 0x01, 0x8A, 0x36, 0xFE, 0x39, 0x6B, 0x02, 0x41,
-	0x06, 0x18, 0xF9, 0xE8, 0x06, 0x18, 0xFE, 0x22, 0xFD, 0xBA, 0x99, 0x01, 0xAD, 0xFB, 0xC6, 0x02,
-	0x00, 0x93, 0xFD, 0x6D, 0x00, 0x02, 0x00, 0x8B, 0x00, 0x00, 0x04, 0x20, 0x04, 0x8D, 0x00, 0x19,
-	0x00, 0x1D, 0x00, 0x16, 0x40, 0x09, 0x1B, 0x1A, 0x0F, 0x02, 0x01, 0x0E, 0x0F, 0x7D, 0x01, 0x00,
-	0x2F, 0x3F, 0x33, 0x11, 0x33, 0x11, 0x33, 0x32, 0x30, 0x31, 0x61, 0x21, 0x37, 0x21, 0x32, 0x36,
-	0x36, 0x35, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x21, 0x35, 0x21, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14,
-	0x06, 0x06, 0x01, 0x11, 0x23, 0x11, 0x01, 0xE7, 0xFE, 0xF8, 0x01, 0x01, 0x07, 0x81, 0xAB, 0x54,
-	0x30, 0x5E, 0x8B, 0x5B, 0xFE, 0xE6, 0x01, 0x1A, 0x7C, 0xCD, 0x94, 0x50, 0x8D, 0xFF, 0xFE, 0xB0,
-	0xB9, 0x98, 0x60, 0xB3, 0x7B, 0x42, 0x5F, 0x94, 0x65, 0x34, 0x99, 0x4D, 0x91, 0xCB, 0x7E, 0x40,
-	0xA7, 0xF8, 0x87, 0x04, 0x8D, 0xFB, 0x73, 0x04, 0x8D, 0x00, 0x00, 0x01, 0x00, 0x61, 0xFF, 0xF0,
-	0x04, 0x31, 0x04, 0x9D, 0x00, 0x27, 0x00, 0x11, 0xB6, 0x19, 0x15, 0x10, 0x7E, 0x24, 0x00, 0x05,
-	0x00, 0x2F, 0xCC, 0x33, 0x3F, 0xCC, 0x33, 0x30, 0x31, 0x41, 0x33, 0x0E, 0x02, 0x23, 0x22, 0x2E,
-	0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2E, 0x02, 0x23, 0x22,
-	0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x03, 0x77, 0xBA, 0x0C, 0x71,
-	0xCD, 0x97, 0x71, 0xB6, 0x82, 0x46, 0x46, 0x84, 0xBB, 0x74, 0x92, 0xC8, 0x71, 0x0C, 0xBA, 0x0A,
-	0x3E, 0x76, 0x5F, 0x4F, 0x78, 0x51, 0x29, 0x25, 0x4C, 0x76, 0x50, 0x64, 0x78, 0x3F, 0x01, 0x79,
-	0x71, 0xB2, 0x66, 0x4D, 0x8F, 0xCA, 0x7D, 0x66, 0x7D, 0xCA, 0x90, 0x4D, 0x65, 0xB4, 0x75, 0x4D,
-	0x6E, 0x3B, 0x35, 0x67, 0x92, 0x5D, 0x67, 0x58, 0x91, 0x6A, 0x39, 0x38, 0x6D, 0x00, 0x00, 0x02,
-	0x00, 0x8B, 0x00, 0x00, 0x03, 0xF0, 0x04, 0x8D, 0x00, 0x19, 0x00, 0x31, 0x00, 0x28, 0x40, 0x13,
-	0x1C, 0x1B, 0x29, 0x19, 0x02, 0x02, 0x01, 0x1B, 0x26, 0x01, 0x01, 0x26, 0x1B, 0x03, 0x0D, 0x0C,
-	0x0F, 0x7D, 0x0D, 0x00, 0x2F, 0x3F, 0x33, 0x12, 0x17, 0x39, 0x2F, 0x2F, 0x2F, 0x11, 0x33, 0x12,
-	0x39, 0x39, 0x11, 0x33, 0x30, 0x31, 0x41, 0x21, 0x27, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26,
-	0x26, 0x23, 0x23, 0x11, 0x23, 0x11, 0x21, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x06, 0x07, 0x03,
-	0x21, 0x37, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x37, 0x21, 0x17, 0x1E,
-	0x02, 0x15, 0x14, 0x0E, 0x02, 0x02, 0x52, 0xFE, 0xC1, 0x02, 0x01, 0x1D, 0x48, 0x68, 0x38, 0x38,
-	0x6D, 0x50, 0xDD, 0xB9, 0x01, 0x96, 0x63, 0x9E, 0x71, 0x3C, 0x4C, 0x8E, 0x65, 0x47, 0xFE, 0x88,
-	0x5F, 0x01, 0x19, 0x4D, 0x69, 0x37, 0x2F, 0x65, 0x50, 0xEF, 0x01, 0x01, 0x41, 0x28, 0x60, 0x81,
-	0x42, 0x3B, 0x6F, 0x9C, 0x02, 0x13, 0x8C, 0x27, 0x4B, 0x36, 0x3C, 0x4D, 0x24, 0xFC, 0x0C, 0x04,
-	0x8D, 0x26, 0x4E, 0x78, 0x52, 0x47, 0x75, 0x49, 0x07, 0xFD, 0xBD, 0x98, 0x2C, 0x52, 0x39, 0x3B,
-	0x58, 0x31, 0x8C, 0x35, 0x03, 0x51, 0x7F, 0x49, 0x53, 0x7D, 0x54, 0x2A, 0x00, 0x03, 0x00, 0x14,
-	0x00, 0x00, 0x04, 0x71, 0x04, 0x8D, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x1C, 0x40, 0x0C,
-	0x0D, 0x00, 0x06, 0x03, 0x0C, 0x0C, 0x01, 0x07, 0x03, 0x7D, 0x05, 0x01, 0x00, 0x2F, 0x33, 0x3F,
-	0x33, 0x12, 0x39, 0x2F, 0x12, 0x39, 0x39, 0x33, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x33, 0x01,
-	0x01, 0x27, 0x33, 0x01, 0x03, 0x15, 0x21, 0x35, 0x02, 0x5E, 0xFE, 0x73, 0xBD, 0x01, 0xDF, 0x79,
-	0x01, 0x49, 0xFE, 0x76, 0x0D, 0x7A, 0x01, 0xD9, 0xD7, 0xFD, 0x4C, 0x03, 0xEA, 0xFC, 0x16, 0x04,
-	0x8D, 0xFB, 0x73, 0x03, 0xEE, 0x9F, 0xFB, 0x73, 0x01, 0xAF, 0x98, 0x98, 0x00, 0x01, 0x00, 0x9F,
-	0x04, 0x8F, 0x01, 0x96, 0x06, 0x3C, 0x00, 0x0A, 0x00, 0x0A, 0xB2, 0x05, 0x80, 0x00, 0x00, 0x2F,
-	0x1A, 0xCD, 0x30, 0x31, 0x53, 0x35, 0x34, 0x36, 0x36, 0x37, 0x17, 0x06, 0x06, 0x15, 0x15, 0x9F,
-	0x2C, 0x41, 0x1F, 0x6B, 0x22, 0x1B, 0x04, 0x8F, 0x81, 0x3B, 0x75, 0x60, 0x1C, 0x53, 0x3C, 0x68,
-	0x3E, 0x78, 0x00, 0x02, 0x00, 0x82, 0x04, 0xDF, 0x02, 0xE0, 0x06, 0x8B, 0x00, 0x0F, 0x00, 0x13,
-	0x00, 0x12, 0xB5, 0x12, 0x13, 0x0A, 0x00, 0x0D, 0x05, 0x00, 0x2F, 0x33, 0x7C, 0xDC, 0x32, 0xD6,
-	0x18, 0xCD, 0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14,
-	0x16, 0x33, 0x32, 0x36, 0x27, 0x27, 0x33, 0x17, 0x02, 0x47, 0x99, 0x49, 0x88, 0x5D, 0x5E, 0x88,
-	0x4A, 0x98, 0x44, 0x54, 0x50, 0x45, 0xB5, 0xA4, 0x99, 0x71, 0x05, 0xB0, 0x3D, 0x5E, 0x36, 0x36,
-	0x5E, 0x3D, 0x2E, 0x45, 0x45, 0x42, 0xC7, 0xC7, 0x00, 0x02, 0xFC, 0xA3, 0x04, 0xBD, 0xFE, 0xCC,
-	0x06, 0x94, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1D, 0x40, 0x0C, 0x00, 0x15, 0x15, 0x05, 0x19, 0x1B,
-	0x1B, 0x09, 0x11, 0x11, 0x0C, 0x05, 0x00, 0x2F, 0x33, 0x33, 0x11, 0x33, 0x33, 0x2F, 0x33, 0x11,
-	0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x17, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x23, 0x22,
-	0x06, 0x15, 0x27, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x33, 0x32, 0x36, 0x25, 0x37, 0x33,
-	0x07, 0xFE, 0x79, 0x53, 0x2B, 0x4A, 0x31, 0x36, 0x41, 0x3A, 0x2C, 0x22, 0x30, 0x54, 0x2A, 0x4B,
-	0x31, 0x2D, 0x44, 0x42, 0x2A, 0x21, 0x32, 0xFE, 0xF0, 0x83, 0xAB, 0xB6, 0x05, 0x95, 0x18, 0x30,
-	0x52, 0x31, 0x26, 0x26, 0x33, 0x26, 0x15, 0x30, 0x53, 0x33, 0x26, 0x25, 0x33, 0x42, 0xE2, 0xE2,
-	0x00, 0x02, 0x00, 0x6F, 0x04, 0xE2, 0x04, 0x58, 0x06, 0x95, 0x00, 0x06, 0x00, 0x0A, 0x00, 0x14,
-	0xB7, 0x08, 0x07, 0x07, 0x05, 0x01, 0x80, 0x04, 0x06, 0x00, 0x2F, 0x33, 0x1A, 0xCD, 0x39, 0x33,
-	0x2F, 0xCD, 0x30, 0x31, 0x53, 0x01, 0x33, 0x01, 0x23, 0x27, 0x07, 0x25, 0x13, 0x33, 0x03, 0x6F,
-	0x01, 0x23, 0x98, 0x01, 0x23, 0xC5, 0xAA, 0xAA, 0x01, 0xCF, 0x8D, 0xC8, 0xC9, 0x04, 0xE2, 0x01,
-	0x06, 0xFE, 0xFA, 0x9E, 0x9E, 0xB1, 0x01, 0x02, 0xFE, 0xFE, 0x00, 0x02, 0xFF, 0x5D, 0x04, 0xCF,
-	0x03, 0x47, 0x06, 0x83, 0x00, 0x06, 0x00, 0x0A, 0x00, 0x17, 0x40, 0x09, 0x07, 0x40, 0x08, 0x08,
-	0x03, 0x06, 0x80, 0x02, 0x04, 0x00, 0x2F, 0x33, 0x1A, 0xCD, 0x39, 0x33, 0x2F, 0x1A, 0xCD, 0x30,
-	0x31, 0x41, 0x01, 0x23, 0x27, 0x07, 0x23, 0x01, 0x25, 0x13, 0x23, 0x03, 0x02, 0x23, 0x01, 0x24,
-	0xC6, 0xAA, 0xA9, 0xC5, 0x01, 0x22, 0xFE, 0x9A, 0x8E, 0x8D, 0xC9, 0x05, 0xD6, 0xFE, 0xF9, 0x9F,
-	0x9F, 0x01, 0x07, 0xAD, 0xFE, 0xFE, 0x01, 0x02, 0x00, 0x02, 0x00, 0x69, 0x04, 0xE4, 0x03, 0xED,
-	0x06, 0xD0, 0x00, 0x06, 0x00, 0x1A, 0x00, 0x1F, 0x40, 0x0D, 0x11, 0x12, 0x08, 0x40, 0x1A, 0x09,
-	0x08, 0x08, 0x03, 0x06, 0x80, 0x02, 0x04, 0x00, 0x2F, 0x33, 0x1A, 0xCD, 0x39, 0x33, 0x11, 0x33,
-	0x33, 0x1A, 0x10, 0xCC, 0x32, 0x30, 0x31, 0x41, 0x01, 0x23, 0x27, 0x07, 0x23, 0x01, 0x05, 0x23,
-	0x27, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x37, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x07,
-	0x02, 0x35, 0x01, 0x12, 0xAB, 0xC5, 0xC4, 0xAA, 0x01, 0x10, 0x01, 0xED, 0x73, 0x01, 0x2C, 0x36,
-	0x1A, 0x26, 0x40, 0x27, 0x06, 0x40, 0x61, 0x43, 0x22, 0x53, 0x33, 0x05, 0xEB, 0xFE, 0xF9, 0xBA,
-	0xBA, 0x01, 0x07, 0x7D, 0x84, 0x03, 0x0C, 0x19, 0x16, 0x19, 0x1D, 0x0D, 0x5D, 0x17, 0x2B, 0x3B,
-	0x25, 0x41, 0x3B, 0x07, 0x00, 0x02, 0x00, 0x69, 0x04, 0xE4, 0x03, 0x47, 0x06, 0xD4, 0x00, 0x06,
-	0x00, 0x1E, 0x00, 0x25, 0x40, 0x10, 0x08, 0x07, 0x07, 0x10, 0x18, 0x0C, 0x40, 0x14, 0x13, 0x13,
-	0x1C, 0x0C, 0x0C, 0x06, 0x80, 0x04, 0x00, 0x2F, 0x1A, 0xCD, 0x32, 0x11, 0x33, 0x33, 0x11, 0x33,
-	0x1A, 0x10, 0xCD, 0x32, 0x32, 0x11, 0x33, 0x30, 0x31, 0x41, 0x05, 0x23, 0x27, 0x07, 0x23, 0x25,
-	0x37, 0x17, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x27, 0x34, 0x36,
-	0x36, 0x33, 0x32, 0x16, 0x16, 0x33, 0x32, 0x36, 0x02, 0x19, 0x01, 0x2E, 0xAB, 0xC5, 0xC4, 0xAA,
-	0x01, 0x2D, 0xF9, 0x4D, 0x2B, 0x48, 0x2D, 0x32, 0x3C, 0x35, 0x29, 0x1F, 0x34, 0x4D, 0x2B, 0x49,
-	0x2C, 0x2A, 0x3E, 0x3D, 0x27, 0x1F, 0x34, 0x05, 0xD8, 0xF4, 0x9E, 0x9E, 0xF4, 0xFC, 0x16, 0x28,
-	0x48, 0x2D, 0x24, 0x24, 0x2F, 0x1C, 0x13, 0x28, 0x49, 0x2F, 0x23, 0x23, 0x2D, 0x00, 0x00, 0x03,
-	0x00, 0x8B, 0x00, 0x00, 0x03, 0x85, 0x05, 0xC4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x1B,
-	0x40, 0x0C, 0x02, 0x0A, 0x0A, 0x0B, 0x0B, 0x07, 0x03, 0x03, 0x07, 0x7D, 0x06, 0x0A, 0x00, 0x3F,
-	0x3F, 0x33, 0x2F, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01,
-	0x11, 0x23, 0x11, 0x21, 0x15, 0x21, 0x35, 0x03, 0x85, 0xB9, 0xFE, 0x78, 0xB9, 0x02, 0xFA, 0xFD,
-	0x93, 0x05, 0xC4, 0xFE, 0x30, 0x01, 0xD0, 0xFE, 0xC9, 0xFB, 0x73, 0x04, 0x8D, 0x99, 0x99, 0x00,
-	0x00, 0x02, 0x00, 0x82, 0x04, 0xDF, 0x02, 0xE0, 0x06, 0x8B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x12,
-	0xB5, 0x11, 0x13, 0x00, 0x0A, 0x0D, 0x05, 0x00, 0x2F, 0x33, 0x7C, 0xDC, 0x32, 0x18, 0xD6, 0xCD,
-	0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33,
-	0x32, 0x36, 0x27, 0x37, 0x33, 0x07, 0x02, 0x47, 0x99, 0x49, 0x88, 0x5D, 0x5E, 0x88, 0x4A, 0x98,
-	0x44, 0x54, 0x50, 0x45, 0xD0, 0x71, 0x99, 0xA4, 0x05, 0xB0, 0x3D, 0x5E, 0x36, 0x36, 0x5E, 0x3D,
-	0x2E, 0x45, 0x45, 0x42, 0xC7, 0xC7, 0x00, 0x02, 0x00, 0x82, 0x04, 0xE0, 0x02, 0xCB, 0x07, 0x04,
-	0x00, 0x0F, 0x00, 0x25, 0x00, 0x28, 0x40, 0x11, 0x1B, 0x1C, 0x1C, 0x11, 0x25, 0x12, 0x12, 0x11,
-	0x11, 0x09, 0x0D, 0x05, 0x00, 0x09, 0x09, 0x05, 0x10, 0x00, 0x3F, 0x33, 0x7C, 0x2F, 0x33, 0x11,
-	0x33, 0x11, 0x33, 0x18, 0x2F, 0x33, 0x11, 0x33, 0x11, 0x33, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x33,
-	0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33, 0x32, 0x36, 0x27, 0x23,
-	0x27, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x37, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x06,
-	0x07, 0x02, 0x38, 0x93, 0x47, 0x82, 0x5B, 0x5A, 0x84, 0x47, 0x92, 0x44, 0x4F, 0x4E, 0x43, 0x49,
-	0x80, 0x01, 0x31, 0x3D, 0x1E, 0x19, 0x2C, 0x3B, 0x21, 0x07, 0x48, 0x6E, 0x49, 0x26, 0x2B, 0x44,
-	0x26, 0x05, 0xB0, 0x3D, 0x5E, 0x35, 0x35, 0x5E, 0x3D, 0x2E, 0x45, 0x45, 0x3F, 0x7D, 0x02, 0x0C,
-	0x17, 0x14, 0x10, 0x17, 0x0E, 0x06, 0x52, 0x15, 0x26, 0x35, 0x20, 0x27, 0x30, 0x18, 0x05, 0x00,
-	0xFF, 0xFF, 0x00, 0x51, 0x02, 0x8D, 0x02, 0x9E, 0x05, 0xB8, 0x06, 0x07, 0x01, 0xE1, 0x00, 0x00,
-	0x02, 0x98, 0xFF, 0xFF, 0x00, 0x36, 0x02, 0x98, 0x02, 0xBC, 0x05, 0xAD, 0x06, 0x07, 0x02, 0x3A,
-	0x00, 0x00, 0x02, 0x98, 0xFF, 0xFF, 0x00, 0x5C, 0x02, 0x8D, 0x02, 0xA8, 0x05, 0xAD, 0x06, 0x07,
-	0x02, 0x3B, 0x00, 0x00, 0x02, 0x98, 0xFF, 0xFF, 0x00, 0x56, 0x02, 0x8D, 0x02, 0xAC, 0x05, 0xB7,
-	0x06, 0x07, 0x02, 0x3C, 0x00, 0x00, 0x02, 0x98, 0xFF, 0xFF, 0x00, 0x3B, 0x02, 0x98, 0x02, 0xA6,
-	0x05, 0xAD, 0x06, 0x07, 0x02, 0x3D, 0x00, 0x00, 0x02, 0x98, 0xFF, 0xFF, 0x00, 0x4F, 0x02, 0x8D,
-	0x02, 0x9F, 0x05, 0xB8, 0x06, 0x07, 0x02, 0x3E, 0x00, 0x00, 0x02, 0x98, 0xFF, 0xFF, 0x00, 0x4A,
-	0x02, 0x91, 0x02, 0x95, 0x05, 0xB8, 0x06, 0x07, 0x02, 0x3F, 0x00, 0x00, 0x02, 0x98, 0x00, 0x01,
-	0x00, 0x7E, 0xFF, 0xEB, 0x05, 0x1E, 0x05, 0xC5, 0x00, 0x29, 0x00, 0x15, 0x40, 0x0A, 0x1A, 0x16,
-	0x11, 0x03, 0x72, 0x26, 0x00, 0x05, 0x09, 0x72, 0x00, 0x2B, 0xCC, 0x33, 0x2B, 0xCC, 0x33, 0x30,
-	0x31, 0x41, 0x33, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x03, 0x35, 0x35, 0x34, 0x12, 0x36, 0x36, 0x33,
-	0x32, 0x16, 0x16, 0x17, 0x23, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x03,
-	0x33, 0x32, 0x36, 0x36, 0x04, 0x5C, 0xC1, 0x0F, 0x86, 0xEC, 0xAA, 0x6B, 0xBE, 0x9C, 0x71, 0x3E,
-	0x5A, 0xA6, 0xE3, 0x88, 0xA5, 0xF2, 0x8F, 0x0F, 0xC2, 0x0F, 0x59, 0x9A, 0x71, 0x62, 0x9D, 0x70,
-	0x3B, 0x2A, 0x4D, 0x6C, 0x84, 0x4C, 0x75, 0x94, 0x51, 0x01, 0xCF, 0x8A, 0xDB, 0x7F, 0x42, 0x7D,
-	0xB0, 0xDE, 0x81, 0x3D, 0xA2, 0x01, 0x08, 0xBF, 0x66, 0x7C, 0xDC, 0x90, 0x65, 0x94, 0x51, 0x51,
-	0x95, 0xCD, 0x7C, 0x3F, 0x64, 0xAC, 0x8A, 0x62, 0x35, 0x4E, 0x93, 0x00, 0x00, 0x01, 0x00, 0x7E,
-	0xFF, 0xEB, 0x05, 0x1F, 0x05, 0xC5, 0x00, 0x2D, 0x00, 0x1B, 0x40, 0x0D, 0x2D, 0x2C, 0x2C, 0x05,
-	0x1A, 0x16, 0x11, 0x03, 0x72, 0x26, 0x05, 0x09, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0xCC, 0x33, 0x12,
-	0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x11, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x03, 0x35, 0x35, 0x34,
-	0x12, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15,
-	0x15, 0x14, 0x1E, 0x03, 0x33, 0x32, 0x36, 0x36, 0x37, 0x11, 0x21, 0x35, 0x05, 0x1F, 0x1A, 0x82,
-	0xD7, 0x9D, 0x6F, 0xC6, 0xA4, 0x77, 0x41, 0x5C, 0xA8, 0xE2, 0x86, 0xB2, 0xEC, 0x83, 0x14, 0xC1,
-	0x0F, 0x51, 0x98, 0x7C, 0x5E, 0x9C, 0x72, 0x3F, 0x2D, 0x54, 0x73, 0x8D, 0x4F, 0x61, 0x89, 0x54,
-	0x12, 0xFE, 0xB0, 0x02, 0xD3, 0xFD, 0xEC, 0x27, 0x64, 0x49, 0x41, 0x7C, 0xB3, 0xE6, 0x89, 0x1B,
-	0xAC, 0x01, 0x11, 0xBF, 0x64, 0x74, 0xCA, 0x81, 0x4F, 0x83, 0x4F, 0x51, 0x97, 0xD5, 0x83, 0x1D,
-	0x6C, 0xB4, 0x8D, 0x62, 0x33, 0x23, 0x32, 0x16, 0x01, 0x45, 0x9B, 0x00, 0x00, 0x02, 0x00, 0xB2,
-	0x00, 0x00, 0x05, 0x11, 0x05, 0xB0, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x12, 0xB7, 0x1C, 0x0F, 0x10,
-	0x02, 0x72, 0x02, 0x1D, 0x00, 0x00, 0x2F, 0x32, 0x32, 0x2B, 0x32, 0x32, 0x30, 0x31, 0x61, 0x21,
-	0x37, 0x21, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x21, 0x35, 0x21, 0x32, 0x16,
-	0x16, 0x12, 0x15, 0x15, 0x14, 0x02, 0x06, 0x04, 0x01, 0x11, 0x23, 0x11, 0x02, 0x53, 0xFE, 0xB8,
-	0x02, 0x01, 0x45, 0x77, 0xBD, 0x84, 0x45, 0x46, 0x82, 0xB5, 0x6F, 0xFE, 0xA2, 0x01, 0x5F, 0x92,
-	0xF9, 0xBA, 0x68, 0x67, 0xBD, 0xFE, 0xFF, 0xFE, 0x87, 0xC1, 0x9D, 0x4E, 0x92, 0xCA, 0x7B, 0x2D,
-	0x81, 0xCB, 0x8D, 0x4A, 0x9E, 0x63, 0xB9, 0xFE, 0xFB, 0xA2, 0x2B, 0xA2, 0xFE, 0xFB, 0xB9, 0x62,
-	0x05, 0xB0, 0xFA, 0x50, 0x05, 0xB0, 0x00, 0x02, 0x00, 0x7E, 0xFF, 0xEB, 0x05, 0x5F, 0x05, 0xC5,
-	0x00, 0x19, 0x00, 0x31, 0x00, 0x10, 0xB7, 0x21, 0x14, 0x03, 0x72, 0x2D, 0x07, 0x09, 0x72, 0x00,
-	0x2B, 0x32, 0x2B, 0x32, 0x30, 0x31, 0x41, 0x15, 0x14, 0x0E, 0x03, 0x23, 0x22, 0x2E, 0x03, 0x35,
-	0x35, 0x34, 0x3E, 0x03, 0x33, 0x32, 0x1E, 0x03, 0x07, 0x35, 0x34, 0x2E, 0x03, 0x23, 0x22, 0x0E,
-	0x02, 0x15, 0x15, 0x14, 0x1E, 0x03, 0x33, 0x32, 0x3E, 0x02, 0x05, 0x5F, 0x3D, 0x6F, 0x9B, 0xBD,
-	0x6B, 0x68, 0xBB, 0x9D, 0x73, 0x3F, 0x3F, 0x72, 0x9C, 0xBB, 0x68, 0x6B, 0xBE, 0x9B, 0x70, 0x3D,
-	0xBE, 0x2A, 0x4E, 0x6B, 0x85, 0x4B, 0x5A, 0x9D, 0x77, 0x43, 0x2C, 0x50, 0x6D, 0x82, 0x48, 0x5F,
-	0x9E, 0x74, 0x40, 0x02, 0xEE, 0x2C, 0x80, 0xDF, 0xB3, 0x80, 0x45, 0x45, 0x80, 0xB3, 0xDF, 0x80,
-	0x2C, 0x80, 0xDE, 0xB4, 0x80, 0x45, 0x45, 0x80, 0xB4, 0xDE, 0xAC, 0x2E, 0x64, 0xAD, 0x8A, 0x62,
-	0x34, 0x51, 0x95, 0xCE, 0x7D, 0x2E, 0x65, 0xAE, 0x8A, 0x63, 0x34, 0x51, 0x95, 0xD0, 0x00, 0x03,
-	0x00, 0x7E, 0xFF, 0x04, 0x05, 0x5F, 0x05, 0xC5, 0x00, 0x03, 0x00, 0x1D, 0x00, 0x35, 0x00, 0x1B,
-	0x40, 0x0D, 0x25, 0x18, 0x03, 0x72, 0x00, 0x03, 0x03, 0x31, 0x0B, 0x09, 0x72, 0x01, 0x02, 0x00,
-	0x2F, 0x33, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x30, 0x31, 0x65, 0x01, 0x07, 0x01, 0x01,
-	0x15, 0x14, 0x0E, 0x03, 0x23, 0x22, 0x2E, 0x03, 0x35, 0x35, 0x34, 0x3E, 0x03, 0x33, 0x32, 0x1E,
-	0x03, 0x07, 0x35, 0x34, 0x2E, 0x03, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x03, 0x33,
-	0x32, 0x3E, 0x02, 0x03, 0xA9, 0x01, 0x74, 0x83, 0xFE, 0x93, 0x02, 0x32, 0x3D, 0x6F, 0x9B, 0xBD,
-	0x6B, 0x68, 0xBB, 0x9D, 0x73, 0x3F, 0x3F, 0x72, 0x9C, 0xBB, 0x68, 0x6B, 0xBE, 0x9B, 0x70, 0x3D,
-	0xBE, 0x2A, 0x4E, 0x6B, 0x85, 0x4B, 0x5A, 0x9D, 0x77, 0x43, 0x2C, 0x50, 0x6D, 0x82, 0x48, 0x5F,
-	0x9E, 0x74, 0x40, 0xA0, 0xFE, 0xDC, 0x78, 0x01, 0x21, 0x02, 0xC7, 0x2A, 0x80, 0xDF, 0xB3, 0x80,
-	0x45, 0x45, 0x80, 0xB3, 0xDF, 0x80, 0x2A, 0x80, 0xDF, 0xB4, 0x81, 0x45, 0x45, 0x81, 0xB4, 0xDF,
-	0xAA, 0x2C, 0x65, 0xAD, 0x8B, 0x62, 0x34, 0x51, 0x95, 0xCF, 0x7E, 0x2C, 0x65, 0xAE, 0x8B, 0x62,
-	0x34, 0x51, 0x95, 0xCF, 0x00, 0x01, 0x00, 0xA0, 0x00, 0x00, 0x02, 0xC9, 0x04, 0x8D, 0x00, 0x06,
-	0x00, 0x15, 0x40, 0x09, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x7D, 0x02, 0x0A, 0x00, 0x3F, 0x3F,
-	0x33, 0x2F, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x05, 0x35, 0x25, 0x02, 0xC9,
-	0xB9, 0xFE, 0x90, 0x02, 0x0A, 0x04, 0x8D, 0xFB, 0x73, 0x03, 0xA7, 0x8B, 0xA7, 0xCA, 0x00, 0x01,
-	0x00, 0x83, 0x00, 0x00, 0x04, 0x20, 0x04, 0xA0, 0x00, 0x20, 0x00, 0x17, 0x40, 0x0A, 0x10, 0x10,
-	0x0C, 0x15, 0x7E, 0x03, 0x20, 0x20, 0x02, 0x12, 0x00, 0x3F, 0x33, 0x11, 0x33, 0x3F, 0x33, 0x33,
-	0x2F, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
-	0x06, 0x06, 0x15, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x07,
-	0x01, 0x04, 0x20, 0xFC, 0x87, 0x01, 0xEA, 0x4B, 0x42, 0x10, 0x32, 0x64, 0x4D, 0x4F, 0x7A, 0x46,
-	0xB9, 0x76, 0xCE, 0x84, 0x65, 0x99, 0x69, 0x35, 0x1B, 0x35, 0x4C, 0x31, 0xFE, 0x8F, 0x98, 0x98,
-	0x84, 0x01, 0xB8, 0x41, 0x5B, 0x4A, 0x26, 0x32, 0x57, 0x37, 0x3E, 0x74, 0x51, 0x71, 0xBA, 0x70,
-	0x34, 0x5C, 0x7A, 0x46, 0x30, 0x5D, 0x5A, 0x58, 0x2C, 0xFE, 0xB3, 0x00, 0x00, 0x01, 0x00, 0x0F,
-	0xFE, 0xA3, 0x03, 0xDE, 0x04, 0x8D, 0x00, 0x1F, 0x00, 0x1A, 0x40, 0x0B, 0x06, 0x00, 0x1E, 0x1E,
-	0x03, 0x16, 0x0F, 0x05, 0x02, 0x03, 0x7D, 0x00, 0x3F, 0x33, 0x33, 0x2F, 0x33, 0x12, 0x39, 0x2F,
-	0x33, 0x33, 0x30, 0x31, 0x41, 0x01, 0x21, 0x35, 0x21, 0x15, 0x01, 0x1E, 0x02, 0x15, 0x14, 0x0E,
-	0x02, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
-	0x23, 0x23, 0x01, 0x6F, 0x01, 0x76, 0xFD, 0x73, 0x03, 0x73, 0xFE, 0x7F, 0x70, 0xB7, 0x6D, 0x54,
-	0x98, 0xCD, 0x7A, 0x6A, 0xC8, 0x6A, 0x35, 0x4C, 0xAF, 0x5B, 0x7C, 0xB1, 0x5E, 0x53, 0xA7, 0x80,
-	0x3C, 0x02, 0x63, 0x01, 0x92, 0x98, 0x75, 0xFE, 0x6C, 0x0F, 0x75, 0xBE, 0x80, 0x83, 0xCA, 0x8B,
-	0x47, 0x33, 0x34, 0x8B, 0x28, 0x30, 0x5F, 0xA6, 0x6A, 0x72, 0x95, 0x49, 0x00, 0x02, 0x00, 0x3E,
-	0xFE, 0xB6, 0x04, 0xA0, 0x04, 0x8D, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x16, 0x40, 0x09, 0x06, 0x04,
-	0x0B, 0x7D, 0x0A, 0x03, 0x07, 0x07, 0x02, 0x00, 0x2F, 0x33, 0x11, 0x33, 0x2F, 0x3F, 0x33, 0x33,
-	0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x01, 0x33, 0x03, 0x01, 0x01, 0x11, 0x23, 0x11, 0x04, 0xA0,
-	0xFB, 0x9E, 0x02, 0xD7, 0x90, 0x9F, 0xFE, 0x12, 0x02, 0xC3, 0xB9, 0x97, 0x98, 0x6E, 0x04, 0x20,
-	0xFE, 0xD0, 0xFD, 0x3A, 0x03, 0xF6, 0xFA, 0x29, 0x05, 0xD7, 0x00, 0x01, 0x00, 0x65, 0xFE, 0xA0,
-	0x04, 0x06, 0x04, 0x8C, 0x00, 0x27, 0x00, 0x16, 0x40, 0x09, 0x24, 0x09, 0x09, 0x02, 0x1A, 0x13,
-	0x05, 0x02, 0x7D, 0x00, 0x3F, 0x33, 0x2F, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x27,
-	0x13, 0x21, 0x15, 0x21, 0x03, 0x36, 0x36, 0x37, 0x36, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23,
-	0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22,
-	0x06, 0x06, 0x01, 0x20, 0x9A, 0x66, 0x03, 0x14, 0xFD, 0x7F, 0x37, 0x2C, 0x80, 0x58, 0x66, 0xA3,
-	0x74, 0x3D, 0x44, 0x85, 0xC6, 0x83, 0x6A, 0xC9, 0x5C, 0x3A, 0x43, 0xAE, 0x64, 0x4F, 0x7F, 0x5B,
-	0x30, 0x29, 0x4E, 0x6F, 0x47, 0x56, 0x63, 0x35, 0x01, 0x63, 0x11, 0x03, 0x18, 0xAB, 0xFE, 0x75,
-	0x1A, 0x26, 0x01, 0x01, 0x44, 0x82, 0xB5, 0x6F, 0x6E, 0xBF, 0x90, 0x51, 0x37, 0x3B, 0x8A, 0x34,
-	0x30, 0x38, 0x64, 0x88, 0x50, 0x44, 0x76, 0x59, 0x32, 0x23, 0x40, 0x00, 0x00, 0x01, 0x00, 0x4A,
-	0xFE, 0xB6, 0x03, 0xF2, 0x04, 0x8D, 0x00, 0x06, 0x00, 0x0F, 0xB5, 0x01, 0x05, 0x05, 0x06, 0x7D,
-	0x03, 0x00, 0x2F, 0x3F, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x15, 0x01, 0x23, 0x01, 0x21, 0x35,
-	0x03, 0xF2, 0xFD, 0xA1, 0xBB, 0x02, 0x57, 0xFD, 0x1B, 0x04, 0x8D, 0x69, 0xFA, 0x92, 0x05, 0x3F,
-	0x98, 0x00, 0x00, 0x02, 0x00, 0x84, 0x04, 0xD9, 0x02, 0xD3, 0x06, 0xD0, 0x00, 0x0F, 0x00, 0x27,
-	0x00, 0x29, 0x40, 0x11, 0x11, 0x10, 0x10, 0x19, 0x21, 0x21, 0x15, 0x1D, 0x1C, 0x1C, 0x25, 0x15,
-	0x15, 0x00, 0x09, 0x0D, 0x05, 0x00, 0x2F, 0x33, 0xCD, 0x32, 0x32, 0x7C, 0x2F, 0x33, 0x33, 0x11,
-	0x33, 0x11, 0x33, 0x18, 0x2F, 0x33, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x33, 0x14, 0x06, 0x06,
-	0x23, 0x22, 0x26, 0x26, 0x35, 0x33, 0x14, 0x16, 0x33, 0x32, 0x36, 0x13, 0x17, 0x14, 0x06, 0x06,
-	0x23, 0x22, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x27, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
-	0x33, 0x32, 0x36, 0x02, 0x3D, 0x96, 0x48, 0x84, 0x5C, 0x5B, 0x84, 0x48, 0x95, 0x42, 0x50, 0x50,
-	0x42, 0x39, 0x54, 0x2B, 0x4A, 0x31, 0x36, 0x41, 0x3A, 0x2C, 0x22, 0x30, 0x54, 0x2A, 0x4B, 0x31,
-	0x2D, 0x44, 0x41, 0x2B, 0x21, 0x31, 0x05, 0xAE, 0x3E, 0x61, 0x36, 0x36, 0x61, 0x3E, 0x2E, 0x48,
-	0x48, 0x01, 0x50, 0x18, 0x30, 0x52, 0x31, 0x26, 0x26, 0x33, 0x26, 0x15, 0x30, 0x53, 0x33, 0x26,
-	0x25, 0x33, 0x00, 0x01, 0x00, 0x68, 0xFE, 0x99, 0x01, 0x21, 0x00, 0x9A, 0x00, 0x03, 0x00, 0x08,
-	0xB1, 0x01, 0x00, 0x00, 0x2F, 0xCD, 0x30, 0x31, 0x65, 0x11, 0x23, 0x11, 0x01, 0x21, 0xB9, 0x9A,
-	0xFD, 0xFF, 0x02, 0x01, 0x00, 0x05, 0x00, 0x60, 0xFF, 0xF0, 0x06, 0x6D, 0x04, 0x9D, 0x00, 0x29,
-	0x00, 0x2D, 0x00, 0x31, 0x00, 0x35, 0x00, 0x39, 0x00, 0x31, 0x40, 0x18, 0x38, 0x39, 0x39, 0x31,
-	0x7D, 0x16, 0x2D, 0x2D, 0x17, 0x30, 0x0A, 0x35, 0x34, 0x34, 0x26, 0x1B, 0x01, 0x06, 0x06, 0x26,
-	0x7E, 0x11, 0x1B, 0x0B, 0x00, 0x3F, 0x33, 0x3F, 0x33, 0x11, 0x33, 0x11, 0x12, 0x39, 0x2F, 0x33,
-	0x3F, 0x33, 0x33, 0x11, 0x33, 0x3F, 0x33, 0x11, 0x33, 0x30, 0x31, 0x41, 0x07, 0x22, 0x2E, 0x02,
-	0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x33, 0x17, 0x22,
-	0x06, 0x06, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x01,
-	0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x03,
-	0xF2, 0x2A, 0x1E, 0x64, 0x6F, 0x60, 0x1A, 0x4A, 0x78, 0x55, 0x2E, 0x2E, 0x56, 0x79, 0x4A, 0x1B,
-	0x5E, 0x6E, 0x64, 0x1F, 0x2D, 0x51, 0x96, 0x80, 0x30, 0x71, 0xBB, 0x89, 0x4A, 0x4A, 0x87, 0xBB,
-	0x71, 0x30, 0x81, 0x96, 0x02, 0xC9, 0xFD, 0x68, 0x2D, 0xB9, 0x02, 0xCD, 0xFD, 0xBF, 0x02, 0x92,
-	0xFD, 0x6E, 0x04, 0x8D, 0x99, 0x04, 0x06, 0x04, 0x36, 0x68, 0x98, 0x63, 0x44, 0x63, 0x99, 0x69,
-	0x36, 0x03, 0x05, 0x04, 0x96, 0x08, 0x08, 0x4D, 0x93, 0xD1, 0x84, 0x42, 0x84, 0xD1, 0x94, 0x4D,
-	0x08, 0x08, 0xFC, 0x0B, 0x98, 0x98, 0x03, 0xF5, 0xFB, 0x73, 0x04, 0x8D, 0xFE, 0x19, 0x97, 0x97,
-	0x01, 0xE7, 0x99, 0x99, 0x00, 0x01, 0x00, 0x82, 0xFE, 0xA9, 0x04, 0x40, 0x04, 0xA1, 0x00, 0x3B,
-	0x00, 0x14, 0xB7, 0x00, 0x15, 0x1F, 0x1F, 0x35, 0x0B, 0x29, 0x35, 0x00, 0x2F, 0x2F, 0x33, 0x12,
-	0x39, 0x2F, 0x33, 0x32, 0x30, 0x31, 0x45, 0x32, 0x3E, 0x02, 0x35, 0x11, 0x34, 0x2E, 0x02, 0x23,
-	0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x37, 0x14, 0x06, 0x06,
-	0x23, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14, 0x0E,
-	0x03, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x01, 0xE0, 0x5D, 0x9A, 0x71, 0x3E, 0x29, 0x4F,
-	0x72, 0x49, 0x3B, 0x65, 0x4C, 0x2B, 0x27, 0x4C, 0x6B, 0x43, 0x52, 0x77, 0x4D, 0x26, 0x69, 0x74,
-	0xC3, 0x77, 0x6C, 0xAC, 0x7A, 0x40, 0x47, 0x7F, 0xA6, 0x60, 0x6F, 0xB6, 0x85, 0x48, 0x3A, 0x6A,
-	0x93, 0xB2, 0x65, 0x42, 0x94, 0x40, 0x26, 0x32, 0x6C, 0xC0, 0x47, 0x8F, 0xD5, 0x8D, 0x01, 0x08,
-	0x62, 0x93, 0x63, 0x32, 0x2E, 0x5C, 0x89, 0x5B, 0x45, 0x7F, 0x62, 0x39, 0x31, 0x50, 0x5D, 0x2C,
-	0x02, 0x88, 0xBB, 0x60, 0x4A, 0x86, 0xB8, 0x6E, 0x7D, 0xC0, 0x84, 0x44, 0x45, 0x8C, 0xD5, 0x8F,
-	0xF2, 0x8E, 0xE5, 0xAE, 0x75, 0x3B, 0x1C, 0x1F, 0x8E, 0x13, 0x1F, 0x00, 0x00, 0x01, 0xFF, 0xB6,
-	0xFE, 0x4B, 0x01, 0x68, 0x00, 0x99, 0x00, 0x11, 0x00, 0x0A, 0xB2, 0x0D, 0x06, 0x00, 0x00, 0x2F,
-	0xCC, 0x32, 0x30, 0x31, 0x77, 0x33, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16,
-	0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0xAE, 0xBA, 0x4D, 0x90, 0x65, 0x1F, 0x34, 0x1D, 0x0E, 0x0F,
-	0x45, 0x0E, 0x2B, 0x3D, 0x20, 0x99, 0xF2, 0x70, 0x9C, 0x50, 0x07, 0x0A, 0x9D, 0x06, 0x06, 0x2A,
-	0x53, 0x3D, 0xFF, 0xFF, 0x00, 0x3B, 0xFE, 0xA3, 0x04, 0x0A, 0x04, 0x8D, 0x04, 0x06, 0x02, 0x66,
-	0x2C, 0x00, 0xFF, 0xFF, 0x00, 0x73, 0xFE, 0xA0, 0x04, 0x14, 0x04, 0x8C, 0x04, 0x06, 0x02, 0x68,
-	0x0E, 0x00, 0xFF, 0xFF, 0x00, 0x22, 0xFE, 0xB6, 0x04, 0x84, 0x04, 0x8D, 0x04, 0x06, 0x02, 0x67,
-	0xE4, 0x00, 0xFF, 0xFF, 0x00, 0x76, 0x00, 0x00, 0x04, 0x13, 0x04, 0xA0, 0x04, 0x06, 0x02, 0x65,
-	0xF3, 0x00, 0xFF, 0xFF, 0x00, 0x76, 0xFE, 0xB6, 0x04, 0x1E, 0x04, 0x8D, 0x04, 0x06, 0x02, 0x69,
-	0x2C, 0x00, 0xFF, 0xFF, 0x00, 0x36, 0xFF, 0xEB, 0x04, 0x47, 0x04, 0xA1, 0x04, 0x06, 0x02, 0x7F,
-	0xBE, 0x00, 0xFF, 0xFF, 0x00, 0x7E, 0xFF, 0xEC, 0x04, 0x16, 0x05, 0xB2, 0x04, 0x06, 0x00, 0x1A,
-	0xF9, 0x00, 0xFF, 0xFF, 0x00, 0x5E, 0xFE, 0xA9, 0x04, 0x1C, 0x04, 0xA1, 0x04, 0x06, 0x02, 0x6D,
-	0xDC, 0x00, 0xFF, 0xFF, 0x00, 0x71, 0xFF, 0xEC, 0x04, 0x0F, 0x05, 0xC4, 0x06, 0x06, 0x00, 0x1C,
-	0x00, 0x00, 0xFF, 0xFF, 0x00, 0xF4, 0x00, 0x00, 0x03, 0x1D, 0x04, 0x8D, 0x04, 0x06, 0x02, 0x64,
-	0x54, 0x00, 0xFF, 0xFF, 0xFF, 0xB4, 0xFE, 0x4B, 0x01, 0x66, 0x04, 0x3A, 0x04, 0x06, 0x00, 0x9C,
-	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xB4, 0xFE, 0x4B, 0x01, 0x66, 0x04, 0x3A, 0x06, 0x06, 0x00, 0x9C,
-	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x9C, 0x00, 0x00, 0x01, 0x55, 0x04, 0x3A, 0x06, 0x06, 0x00, 0x8D,
-	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF9, 0xFE, 0x58, 0x01, 0x5A, 0x04, 0x3A, 0x06, 0x26, 0x00, 0x8D,
-	0x00, 0x00, 0x01, 0x06, 0x00, 0xA4, 0xC7, 0x0A, 0x00, 0x0B, 0xB6, 0x01, 0x04, 0x02, 0x00, 0x00,
-	0x43, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x9C, 0x00, 0x00, 0x01, 0x55, 0x04, 0x3A,
-	0x06, 0x06, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x03, 0x00, 0x8B, 0xFF, 0xEB, 0x03, 0xFA, 0x04, 0x9D,
-	0x00, 0x03, 0x00, 0x16, 0x00, 0x31, 0x00, 0x29, 0x40, 0x14, 0x0F, 0x26, 0x26, 0x0D, 0x23, 0x23,
-	0x09, 0x1B, 0x2F, 0x0B, 0x72, 0x04, 0x00, 0x00, 0x02, 0x13, 0x09, 0x7E, 0x02, 0x0A, 0x00, 0x3F,
-	0x3F, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x2B, 0x32, 0x11, 0x39, 0x2F, 0x33, 0x33, 0x11, 0x33, 0x30,
-	0x31, 0x41, 0x11, 0x23, 0x11, 0x17, 0x23, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x01, 0x23,
-	0x35, 0x13, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x13, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-	0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x35, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x06, 0x23,
-	0x22, 0x26, 0x01, 0x43, 0xB8, 0xB8, 0xB8, 0x57, 0xB1, 0x87, 0x83, 0xC0, 0x4F, 0xFE, 0x9A, 0x69,
-	0xEE, 0x1E, 0x54, 0x3F, 0x53, 0x5E, 0x26, 0x4C, 0x35, 0x1F, 0x54, 0x37, 0x43, 0x5D, 0x32, 0x3C,
-	0x79, 0x5A, 0x54, 0x75, 0x61, 0x9D, 0x6F, 0x3B, 0x65, 0xB3, 0x74, 0x38, 0x70, 0x02, 0xF1, 0xFD,
-	0x0F, 0x02, 0xF1, 0x02, 0x8F, 0xBF, 0x60, 0x6B, 0x4C, 0xFE, 0x50, 0x6B, 0x01, 0x27, 0x17, 0x27,
-	0x4D, 0x7E, 0xFC, 0xE3, 0x98, 0x13, 0x20, 0x39, 0x64, 0x41, 0x41, 0x50, 0x25, 0x8A, 0x29, 0x50,
-	0x77, 0x4D, 0x78, 0xA8, 0x59, 0x18, 0x00, 0x02, 0x00, 0x78, 0xFF, 0xEB, 0x04, 0x89, 0x04, 0xA1,
-	0x00, 0x15, 0x00, 0x2B, 0x00, 0x0E, 0xB5, 0x1C, 0x11, 0x7E, 0x27, 0x06, 0x0B, 0x00, 0x3F, 0x33,
-	0x3F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34,
-	0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x07, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15,
-	0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x04, 0x89, 0x4C, 0x8B, 0xBE, 0x72, 0x70, 0xBF,
-	0x8D, 0x4E, 0x4E, 0x8C, 0xBE, 0x70, 0x72, 0xBE, 0x8C, 0x4D, 0xB9, 0x30, 0x59, 0x7C, 0x4B, 0x4A,
-	0x7B, 0x59, 0x30, 0x31, 0x5A, 0x7B, 0x4A, 0x4C, 0x7B, 0x58, 0x2F, 0x02, 0x50, 0x14, 0x92, 0xDE,
-	0x95, 0x4C, 0x4C, 0x95, 0xDE, 0x92, 0x14, 0x92, 0xDE, 0x95, 0x4C, 0x4C, 0x95, 0xDE, 0xB2, 0x2E,
-	0x69, 0xA0, 0x6B, 0x37, 0x37, 0x6B, 0xA0, 0x69, 0x2E, 0x69, 0xA0, 0x6D, 0x37, 0x37, 0x6D, 0xA0,
-	0x00, 0x01, 0x00, 0x3B, 0x00, 0x00, 0x03, 0xD3, 0x05, 0xB0, 0x00, 0x06, 0x00, 0x13, 0x40, 0x09,
-	0x01, 0x05, 0x05, 0x06, 0x04, 0x72, 0x03, 0x0C, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x11, 0x33, 0x30,
-	0x31, 0x41, 0x15, 0x01, 0x23, 0x01, 0x21, 0x35, 0x03, 0xD3, 0xFD, 0xBE, 0xBB, 0x02, 0x40, 0xFD,
-	0x25, 0x05, 0xB0, 0x68, 0xFA, 0xB8, 0x05, 0x18, 0x98, 0x00, 0x00, 0x03, 0x00, 0x8C, 0xFF, 0xEC,
-	0x04, 0x35, 0x06, 0x00, 0x00, 0x04, 0x00, 0x1A, 0x00, 0x2F, 0x00, 0x19, 0x40, 0x0E, 0x21, 0x16,
-	0x07, 0x72, 0x2B, 0x0B, 0x0B, 0x72, 0x04, 0x0A, 0x72, 0x00, 0x00, 0x72, 0x00, 0x2B, 0x2B, 0x2B,
-	0x32, 0x2B, 0x32, 0x30, 0x31, 0x53, 0x33, 0x11, 0x07, 0x23, 0x01, 0x15, 0x14, 0x0E, 0x02, 0x23,
-	0x22, 0x2E, 0x02, 0x27, 0x35, 0x3E, 0x03, 0x33, 0x32, 0x1E, 0x02, 0x07, 0x35, 0x34, 0x2E, 0x02,
-	0x23, 0x22, 0x0E, 0x02, 0x07, 0x15, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x8C, 0xBA, 0x19, 0xA1,
-	0x03, 0xA9, 0x3E, 0x74, 0xA2, 0x65, 0x67, 0x9B, 0x6A, 0x3F, 0x0C, 0x0C, 0x3F, 0x6A, 0x9A, 0x66,
-	0x66, 0xA4, 0x73, 0x3E, 0xBA, 0x26, 0x4C, 0x71, 0x4C, 0x46, 0x67, 0x48, 0x2D, 0x0B, 0x10, 0x49,
-	0x7B, 0x5B, 0x4B, 0x71, 0x4B, 0x26, 0x06, 0x00, 0xFA, 0xD2, 0xD2, 0x02, 0x27, 0x15, 0x76, 0xC9,
-	0x95, 0x52, 0x47, 0x86, 0xBE, 0x77, 0x5C, 0x78, 0xBE, 0x87, 0x47, 0x4F, 0x92, 0xCA, 0x91, 0x15,
-	0x54, 0x8F, 0x6C, 0x3C, 0x30, 0x51, 0x67, 0x37, 0xF1, 0x46, 0x81, 0x52, 0x3E, 0x6C, 0x8E, 0x00,
-	0x00, 0x01, 0x00, 0x5D, 0xFF, 0xEC, 0x03, 0xEF, 0x04, 0x4E, 0x00, 0x27, 0x00, 0x19, 0x40, 0x0C,
-	0x1D, 0x19, 0x19, 0x14, 0x07, 0x72, 0x04, 0x04, 0x00, 0x09, 0x0B, 0x72, 0x00, 0x2B, 0x32, 0x32,
-	0x2F, 0x2B, 0x32, 0x2F, 0x32, 0x30, 0x31, 0x65, 0x32, 0x36, 0x36, 0x37, 0x33, 0x0E, 0x02, 0x23,
-	0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2E, 0x02,
-	0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x02, 0x40, 0x43, 0x70, 0x48, 0x05, 0xAF,
-	0x05, 0x77, 0xC0, 0x73, 0x7A, 0xB6, 0x78, 0x3B, 0x3C, 0x78, 0xB5, 0x7A, 0x7F, 0xBE, 0x6D, 0x05,
-	0xAF, 0x05, 0x41, 0x6F, 0x4B, 0x55, 0x73, 0x45, 0x1D, 0x1D, 0x44, 0x73, 0x83, 0x37, 0x5F, 0x3D,
-	0x60, 0xA5, 0x65, 0x56, 0x96, 0xC3, 0x6D, 0x2A, 0x6D, 0xC3, 0x96, 0x56, 0x67, 0xB1, 0x70, 0x43,
-	0x6C, 0x41, 0x43, 0x71, 0x89, 0x47, 0x2A, 0x47, 0x8B, 0x70, 0x43, 0x00, 0x00, 0x03, 0x00, 0x5B,
-	0xFF, 0xEC, 0x04, 0x01, 0x06, 0x00, 0x00, 0x04, 0x00, 0x1A, 0x00, 0x2F, 0x00, 0x19, 0x40, 0x0D,
-	0x21, 0x04, 0x04, 0x16, 0x0B, 0x72, 0x2B, 0x0B, 0x07, 0x72, 0x01, 0x00, 0x72, 0x00, 0x2B, 0x2B,
-	0x32, 0x2B, 0x32, 0x2F, 0x32, 0x30, 0x31, 0x65, 0x11, 0x33, 0x11, 0x23, 0x01, 0x35, 0x34, 0x3E,
-	0x02, 0x33, 0x32, 0x1E, 0x02, 0x17, 0x15, 0x0E, 0x03, 0x23, 0x22, 0x2E, 0x02, 0x37, 0x15, 0x14,
-	0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x35, 0x2E, 0x03, 0x23, 0x22, 0x0E, 0x02, 0x03, 0x47,
-	0xBA, 0xA1, 0xFC, 0xFB, 0x43, 0x79, 0xA3, 0x61, 0x66, 0x99, 0x6B, 0x3E, 0x0C, 0x0B, 0x3F, 0x6B,
-	0x9A, 0x67, 0x5F, 0xA3, 0x79, 0x43, 0xBA, 0x27, 0x4E, 0x72, 0x4B, 0x5C, 0x77, 0x48, 0x14, 0x0C,
-	0x2D, 0x47, 0x67, 0x46, 0x4C, 0x73, 0x4E, 0x27, 0xD2, 0x05, 0x2E, 0xFA, 0x00, 0x02, 0x11, 0x15,
-	0x7C, 0xCB, 0x92, 0x4F, 0x47, 0x87, 0xBE, 0x78, 0x5C, 0x77, 0xBE, 0x86, 0x47, 0x52, 0x94, 0xC9,
-	0x8B, 0x15, 0x51, 0x8E, 0x6C, 0x3D, 0x4E, 0x80, 0x4B, 0xF1, 0x37, 0x67, 0x51, 0x30, 0x3C, 0x6C,
-	0x90, 0x00, 0x00, 0x03, 0x00, 0x5B, 0xFE, 0x55, 0x04, 0x01, 0x04, 0x4E, 0x00, 0x13, 0x00, 0x29,
-	0x00, 0x3E, 0x00, 0x1B, 0x40, 0x0F, 0x30, 0x25, 0x0B, 0x72, 0x3A, 0x1A, 0x07, 0x72, 0x0E, 0x06,
-	0x0F, 0x72, 0x00, 0x06, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x2B, 0x32, 0x2B, 0x32, 0x30, 0x31, 0x41,
-	0x33, 0x11, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
-	0x35, 0x11, 0x01, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x17, 0x15, 0x0E, 0x03, 0x23,
-	0x22, 0x2E, 0x02, 0x37, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x35, 0x2E, 0x03,
-	0x23, 0x22, 0x0E, 0x02, 0x03, 0x64, 0x9D, 0x3E, 0x79, 0xAF, 0x71, 0x4F, 0xC8, 0x4F, 0x38, 0x3E,
-	0xA0, 0x4E, 0x64, 0x7E, 0x3D, 0xFD, 0x14, 0x41, 0x78, 0xA3, 0x63, 0x66, 0x99, 0x6B, 0x3F, 0x0C,
-	0x0C, 0x3F, 0x6A, 0x9B, 0x67, 0x61, 0xA3, 0x78, 0x41, 0xBA, 0x27, 0x4D, 0x72, 0x4B, 0x5C, 0x77,
-	0x48, 0x14, 0x0C, 0x2D, 0x47, 0x67, 0x46, 0x4C, 0x73, 0x4D, 0x27, 0x04, 0x3A, 0xFC, 0x14, 0x79,
-	0xBC, 0x81, 0x43, 0x33, 0x36, 0x8A, 0x2A, 0x31, 0x4F, 0x99, 0x70, 0x03, 0x07, 0xFE, 0xC5, 0x15,
-	0x7C, 0xCB, 0x92, 0x4F, 0x47, 0x87, 0xBE, 0x78, 0x5C, 0x77, 0xBE, 0x86, 0x47, 0x52, 0x94, 0xC9,
-	0x8B, 0x15, 0x51, 0x8E, 0x6C, 0x3D, 0x4E, 0x80, 0x4B, 0xF1, 0x37, 0x67, 0x51, 0x30, 0x3C, 0x6C,
-	0x90, 0x00, 0x00, 0x02, 0x00, 0x5A, 0xFF, 0xEC, 0x04, 0x45, 0x04, 0x4E, 0x00, 0x15, 0x00, 0x2B,
-	0x00, 0x10, 0xB7, 0x1C, 0x11, 0x0B, 0x72, 0x27, 0x06, 0x07, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32,
-	0x30, 0x31, 0x53, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14, 0x0E, 0x02,
-	0x23, 0x22, 0x2E, 0x02, 0x37, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x34,
-	0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x5A, 0x47, 0x85, 0xB8, 0x70, 0x72, 0xB9, 0x85, 0x47, 0x47,
-	0x84, 0xB9, 0x71, 0x71, 0xB9, 0x85, 0x47, 0xB9, 0x2A, 0x50, 0x77, 0x4C, 0x4C, 0x75, 0x51, 0x29,
-	0x2A, 0x50, 0x76, 0x4D, 0x4C, 0x75, 0x50, 0x2A, 0x02, 0x11, 0x17, 0x75, 0xC9, 0x95, 0x53, 0x53,
-	0x95, 0xC9, 0x75, 0x17, 0x75, 0xC8, 0x95, 0x53, 0x53, 0x95, 0xC8, 0x8C, 0x17, 0x51, 0x8F, 0x6F,
-	0x3F, 0x3F, 0x6F, 0x8F, 0x51, 0x17, 0x50, 0x8F, 0x6F, 0x40, 0x40, 0x6F, 0x8F, 0x00, 0x00, 0x03,
-	0x00, 0x8C, 0xFE, 0x60, 0x04, 0x33, 0x04, 0x4E, 0x00, 0x04, 0x00, 0x1A, 0x00, 0x2F, 0x00, 0x19,
-	0x40, 0x0E, 0x21, 0x16, 0x07, 0x72, 0x2B, 0x0B, 0x0B, 0x72, 0x03, 0x06, 0x72, 0x02, 0x0E, 0x72,
-	0x00, 0x2B, 0x2B, 0x2B, 0x32, 0x2B, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x33, 0x01, 0x15,
-	0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x27, 0x35, 0x3E, 0x03, 0x33, 0x32, 0x1E, 0x02, 0x07,
-	0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x07, 0x11, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02,
-	0x01, 0x46, 0xBA, 0x9F, 0x03, 0x08, 0x3E, 0x73, 0xA2, 0x65, 0x67, 0x9E, 0x6E, 0x41, 0x0C, 0x0C,
-	0x42, 0x6D, 0x9C, 0x66, 0x66, 0xA4, 0x74, 0x3D, 0xBA, 0x28, 0x4F, 0x74, 0x4C, 0x46, 0x67, 0x48,
-	0x2D, 0x0B, 0x14, 0x48, 0x78, 0x5B, 0x4B, 0x73, 0x4F, 0x28, 0x03, 0x6A, 0xFA, 0xF6, 0x05, 0xDA,
-	0xFD, 0xEC, 0x15, 0x76, 0xC9, 0x94, 0x52, 0x44, 0x82, 0xB6, 0x72, 0x70, 0x78, 0xBE, 0x87, 0x47,
-	0x4F, 0x92, 0xCB, 0x91, 0x15, 0x54, 0x90, 0x6C, 0x3C, 0x30, 0x51, 0x67, 0x37, 0xFE, 0xFD, 0x46,
-	0x7B, 0x4C, 0x3F, 0x6F, 0x8F, 0x00, 0x00, 0x03, 0x00, 0x5B, 0xFE, 0x60, 0x04, 0x00, 0x04, 0x4E,
-	0x00, 0x04, 0x00, 0x1A, 0x00, 0x2F, 0x00, 0x19, 0x40, 0x0E, 0x21, 0x16, 0x0B, 0x72, 0x2B, 0x0B,
-	0x07, 0x72, 0x04, 0x0E, 0x72, 0x03, 0x06, 0x72, 0x00, 0x2B, 0x2B, 0x2B, 0x32, 0x2B, 0x32, 0x30,
-	0x31, 0x41, 0x11, 0x37, 0x33, 0x11, 0x01, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x17,
-	0x15, 0x0E, 0x03, 0x23, 0x22, 0x2E, 0x02, 0x37, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36,
-	0x37, 0x35, 0x2E, 0x03, 0x23, 0x22, 0x0E, 0x02, 0x03, 0x46, 0x19, 0xA1, 0xFC, 0x5B, 0x40, 0x77,
-	0xA6, 0x66, 0x66, 0x9B, 0x6D, 0x40, 0x0C, 0x0B, 0x40, 0x6D, 0x9D, 0x67, 0x64, 0xA5, 0x77, 0x41,
-	0xBA, 0x28, 0x4F, 0x73, 0x4B, 0x5C, 0x7B, 0x4A, 0x14, 0x0B, 0x2F, 0x4A, 0x69, 0x46, 0x4C, 0x74,
-	0x4F, 0x28, 0xFE, 0x60, 0x05, 0x0A, 0xD0, 0xFA, 0x26, 0x03, 0xB0, 0x15, 0x7C, 0xCB, 0x93, 0x4F,
-	0x47, 0x87, 0xBE, 0x78, 0x5C, 0x77, 0xBE, 0x86, 0x47, 0x52, 0x93, 0xC9, 0x8B, 0x15, 0x51, 0x8F,
-	0x6E, 0x3F, 0x51, 0x83, 0x4B, 0xF1, 0x37, 0x68, 0x53, 0x31, 0x3E, 0x6E, 0x91, 0x00, 0x00, 0x01,
-	0x00, 0x5D, 0xFF, 0xEC, 0x03, 0xF3, 0x04, 0x4E, 0x00, 0x2A, 0x00, 0x19, 0x40, 0x0C, 0x13, 0x12,
-	0x12, 0x00, 0x19, 0x0B, 0x07, 0x72, 0x24, 0x00, 0x0B, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x11,
-	0x39, 0x2F, 0x33, 0x30, 0x31, 0x45, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32,
-	0x1E, 0x02, 0x15, 0x15, 0x21, 0x35, 0x21, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15,
-	0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x02, 0x72, 0x79, 0xC4, 0x8D,
-	0x4B, 0x4E, 0x86, 0xAA, 0x5B, 0x74, 0xA9, 0x6C, 0x34, 0xFC, 0xD8, 0x02, 0x6F, 0x33, 0x72, 0x5F,
-	0x3F, 0x6A, 0x4C, 0x2A, 0x30, 0x5B, 0x84, 0x55, 0x5C, 0x8C, 0x30, 0x38, 0x2C, 0xA8, 0x14, 0x4F,
-	0x91, 0xC6, 0x76, 0x2C, 0x80, 0xC8, 0x8A, 0x48, 0x49, 0x85, 0xB4, 0x6A, 0x79, 0x97, 0x1A, 0x49,
-	0x81, 0x52, 0x33, 0x62, 0x90, 0x5D, 0x2C, 0x51, 0x8D, 0x6B, 0x3C, 0x36, 0x24, 0x7F, 0x27, 0x4B,
-	0x00, 0x03, 0x00, 0x61, 0xFE, 0x55, 0x03, 0xF2, 0x04, 0x4E, 0x00, 0x12, 0x00, 0x28, 0x00, 0x3D,
-	0x00, 0x1B, 0x40, 0x0F, 0x2F, 0x24, 0x0B, 0x72, 0x39, 0x19, 0x07, 0x72, 0x0D, 0x06, 0x0F, 0x72,
-	0x00, 0x06, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x2B, 0x32, 0x2B, 0x32, 0x30, 0x31, 0x41, 0x33, 0x11,
-	0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11,
-	0x01, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x17, 0x15, 0x0E, 0x03, 0x23, 0x22, 0x2E,
-	0x02, 0x37, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x35, 0x2E, 0x03, 0x23, 0x22,
-	0x0E, 0x02, 0x03, 0x56, 0x9C, 0x6E, 0xD1, 0x97, 0x46, 0xB5, 0x47, 0x38, 0x37, 0x8C, 0x45, 0x64,
-	0x7E, 0x3D, 0xFD, 0x28, 0x3B, 0x6F, 0x9E, 0x63, 0x66, 0x99, 0x6B, 0x3E, 0x0C, 0x0B, 0x3F, 0x6B,
-	0x9A, 0x67, 0x61, 0x9D, 0x70, 0x3B, 0xB9, 0x21, 0x45, 0x6C, 0x4B, 0x5C, 0x78, 0x47, 0x14, 0x0B,
-	0x2D, 0x47, 0x68, 0x46, 0x4C, 0x6D, 0x45, 0x21, 0x04, 0x3A, 0xFC, 0x02, 0x9B, 0xDA, 0x72, 0x2B,
-	0x2B, 0x8B, 0x22, 0x27, 0x4A, 0x92, 0x6A, 0x03, 0x19, 0xFE, 0xC4, 0x15, 0x7C, 0xCB, 0x93, 0x4F,
-	0x47, 0x87, 0xBE, 0x78, 0x5C, 0x77, 0xBE, 0x86, 0x47, 0x52, 0x93, 0xC9, 0x8B, 0x15, 0x51, 0x8D,
-	0x6C, 0x3D, 0x4E, 0x80, 0x4B, 0xF1, 0x37, 0x67, 0x51, 0x30, 0x3D, 0x6C, 0x90, 0x00, 0x00, 0x02,
-	0x00, 0x5A, 0xFE, 0x4C, 0x04, 0x75, 0x04, 0x49, 0x00, 0x03, 0x00, 0x25, 0x00, 0x19, 0x40, 0x0C,
-	0x0E, 0x15, 0x01, 0x01, 0x15, 0x1F, 0x04, 0x07, 0x72, 0x03, 0x06, 0x72, 0x00, 0x2B, 0x2B, 0x32,
-	0x2F, 0x33, 0x2F, 0x11, 0x33, 0x30, 0x31, 0x41, 0x01, 0x23, 0x01, 0x25, 0x32, 0x1E, 0x02, 0x17,
-	0x01, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x37, 0x07, 0x06, 0x06, 0x23, 0x22, 0x2E, 0x02, 0x27, 0x01,
-	0x2E, 0x02, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x04, 0x17, 0xFD, 0x26, 0xC5, 0x02, 0xE4,
-	0xFD, 0x67, 0x48, 0x62, 0x41, 0x2C, 0x11, 0x01, 0x9E, 0x14, 0x2A, 0x32, 0x1F, 0x10, 0x3D, 0x10,
-	0x30, 0x0A, 0x26, 0x0D, 0x3A, 0x55, 0x40, 0x37, 0x1D, 0xFE, 0x6E, 0x13, 0x31, 0x42, 0x2E, 0x0C,
-	0x2B, 0x0D, 0x01, 0x11, 0x3F, 0x04, 0x3A, 0xFA, 0x26, 0x05, 0xDA, 0x0F, 0x35, 0x53, 0x5C, 0x27,
-	0xFC, 0x4C, 0x2B, 0x44, 0x27, 0x02, 0x03, 0x9F, 0x07, 0x07, 0x23, 0x44, 0x65, 0x42, 0x03, 0x9A,
-	0x30, 0x53, 0x34, 0x04, 0x01, 0x95, 0x05, 0x09, 0xFF, 0xFF, 0x00, 0x57, 0x00, 0x00, 0x02, 0x85,
-	0x05, 0xB8, 0x04, 0x06, 0x00, 0x15, 0xAC, 0x00, 0x00, 0x01, 0x00, 0x68, 0xFF, 0xF0, 0x04, 0x92,
-	0x04, 0x9D, 0x00, 0x41, 0x00, 0x17, 0x40, 0x0B, 0x38, 0x38, 0x10, 0x22, 0x7E, 0x19, 0x0A, 0x33,
-	0x00, 0x0B, 0x72, 0x00, 0x2B, 0x32, 0x3F, 0x3F, 0x33, 0x39, 0x2F, 0x30, 0x31, 0x45, 0x22, 0x2E,
-	0x02, 0x35, 0x34, 0x36, 0x36, 0x37, 0x25, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15,
-	0x14, 0x16, 0x16, 0x17, 0x01, 0x23, 0x01, 0x2E, 0x02, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
-	0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x05, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3E,
-	0x02, 0x35, 0x33, 0x14, 0x06, 0x07, 0x06, 0x06, 0x07, 0x06, 0x06, 0x01, 0xE8, 0x59, 0x8E, 0x64,
-	0x35, 0x2D, 0x53, 0x39, 0x01, 0x0B, 0x29, 0x2B, 0x48, 0x42, 0x40, 0x41, 0x29, 0x43, 0x27, 0x02,
-	0x8A, 0xD3, 0xFD, 0xC7, 0x37, 0x5A, 0x35, 0x4F, 0x8F, 0x5F, 0x60, 0x8C, 0x4C, 0x26, 0x41, 0x28,
-	0xFE, 0xD5, 0x27, 0x28, 0x0D, 0x30, 0x61, 0x49, 0x63, 0x9D, 0x6F, 0x3A, 0xA8, 0x4D, 0x47, 0x0A,
-	0x11, 0x0B, 0x4C, 0xD5, 0x10, 0x2D, 0x50, 0x6B, 0x3E, 0x44, 0x67, 0x55, 0x2A, 0xBF, 0x1E, 0x48,
-	0x24, 0x34, 0x46, 0x4D, 0x2C, 0x25, 0x44, 0x45, 0x29, 0xFD, 0x4D, 0x02, 0x56, 0x3A, 0x60, 0x66,
-	0x41, 0x4E, 0x76, 0x42, 0x49, 0x77, 0x46, 0x32, 0x5A, 0x4C, 0x1D, 0xD8, 0x1C, 0x36, 0x33, 0x16,
-	0x30, 0x4B, 0x2A, 0x44, 0x7B, 0xA9, 0x66, 0x77, 0xD3, 0x54, 0x0B, 0x1C, 0x0A, 0x47, 0x52, 0x00,
-	0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x03, 0x8B, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
-	0x00, 0x1D, 0x40, 0x0D, 0x08, 0x09, 0x09, 0x0B, 0x0A, 0x0A, 0x06, 0x07, 0x7D, 0x03, 0x02, 0x06,
-	0x0A, 0x00, 0x3F, 0x33, 0x33, 0x3F, 0x12, 0x39, 0x2F, 0x33, 0x33, 0x2F, 0x33, 0x30, 0x31, 0x65,
-	0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01, 0x15, 0x05, 0x35, 0x03, 0x8B, 0xFD, 0x8C, 0x2D,
-	0xB9, 0x01, 0xC3, 0xFD, 0xB3, 0x98, 0x98, 0x98, 0x03, 0xF5, 0xFB, 0x73, 0x04, 0x8D, 0xFE, 0x82,
-	0x7D, 0xBB, 0x7D, 0x00, 0x00, 0x06, 0x00, 0x09, 0x00, 0x00, 0x05, 0xF2, 0x04, 0x8D, 0x00, 0x03,
-	0x00, 0x07, 0x00, 0x0B, 0x00, 0x10, 0x00, 0x14, 0x00, 0x18, 0x00, 0x33, 0x40, 0x18, 0x0A, 0x0B,
-	0x0B, 0x18, 0x18, 0x0F, 0x07, 0x06, 0x14, 0x13, 0x06, 0x13, 0x06, 0x13, 0x0D, 0x0F, 0x7D, 0x03,
-	0x02, 0x02, 0x17, 0x17, 0x0D, 0x0A, 0x00, 0x3F, 0x33, 0x11, 0x33, 0x11, 0x33, 0x3F, 0x12, 0x39,
-	0x39, 0x2F, 0x2F, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x65,
-	0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x07, 0x01, 0x23, 0x01, 0x33,
-	0x13, 0x15, 0x21, 0x35, 0x01, 0x13, 0x23, 0x03, 0x05, 0xF2, 0xFD, 0xC4, 0x01, 0xD3, 0xFE, 0x12,
-	0x02, 0x2E, 0xFD, 0xC4, 0x83, 0xFD, 0xC6, 0xC7, 0x02, 0x97, 0x75, 0x8C, 0xFD, 0xA5, 0x02, 0x62,
-	0x28, 0xB8, 0x29, 0x96, 0x96, 0x96, 0x02, 0x15, 0x95, 0x95, 0x01, 0xE2, 0x96, 0x96, 0x70, 0xFB,
-	0xE3, 0x04, 0x8D, 0xFD, 0x37, 0x96, 0x96, 0x02, 0xC9, 0xFB, 0x73, 0x04, 0x8D, 0x00, 0x00, 0x02,
-	0x00, 0x8B, 0x00, 0x00, 0x03, 0xB7, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x19, 0x00, 0x17, 0x40, 0x0A,
-	0x0F, 0x10, 0x10, 0x01, 0x7D, 0x05, 0x04, 0x04, 0x00, 0x0A, 0x00, 0x3F, 0x32, 0x2F, 0x33, 0x3F,
-	0x33, 0x2F, 0x33, 0x30, 0x31, 0x73, 0x11, 0x33, 0x11, 0x27, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35,
-	0x34, 0x26, 0x26, 0x23, 0x23, 0x35, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x8B,
-	0xB9, 0x32, 0xE8, 0x5C, 0x72, 0x36, 0x36, 0x72, 0x5C, 0xE6, 0xE6, 0x8F, 0xC7, 0x67, 0x67, 0xC7,
-	0x8F, 0x04, 0x8D, 0xFB, 0x73, 0xEC, 0x99, 0x34, 0x5D, 0x3C, 0x39, 0x62, 0x3D, 0x99, 0x5F, 0xA5,
-	0x6B, 0x70, 0xA2, 0x56, 0x00, 0x03, 0x00, 0x60, 0xFF, 0xC6, 0x04, 0x5B, 0x04, 0xB7, 0x00, 0x15,
-	0x00, 0x2B, 0x00, 0x2F, 0x00, 0x1B, 0x40, 0x0B, 0x2F, 0x2F, 0x1C, 0x11, 0x7E, 0x2D, 0x2D, 0x27,
-	0x06, 0x0B, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x7C, 0x2F, 0x18, 0x3F, 0x33, 0x33, 0x7C, 0x2F, 0x30,
-	0x31, 0x41, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33,
-	0x32, 0x1E, 0x02, 0x07, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E,
-	0x02, 0x33, 0x32, 0x3E, 0x02, 0x13, 0x01, 0x23, 0x01, 0x04, 0x5B, 0x48, 0x86, 0xBB, 0x73, 0x71,
-	0xBB, 0x89, 0x4A, 0x4A, 0x87, 0xBB, 0x71, 0x74, 0xBB, 0x87, 0x48, 0xB7, 0x2C, 0x54, 0x7A, 0x4D,
-	0x4A, 0x78, 0x55, 0x2E, 0x2E, 0x56, 0x79, 0x4A, 0x4E, 0x78, 0x54, 0x2B, 0xAF, 0xFC, 0xB3, 0x96,
-	0x03, 0x4E, 0x02, 0x67, 0x42, 0x84, 0xD1, 0x93, 0x4D, 0x4D, 0x93, 0xD1, 0x84, 0x42, 0x84, 0xD1,
-	0x94, 0x4D, 0x4D, 0x94, 0xD1, 0xC6, 0x44, 0x63, 0x98, 0x68, 0x36, 0x36, 0x68, 0x98, 0x63, 0x44,
-	0x63, 0x99, 0x69, 0x36, 0x36, 0x69, 0x99, 0x02, 0xF5, 0xFB, 0x0F, 0x04, 0xF1, 0x00, 0x00, 0x04,
-	0x00, 0x30, 0x00, 0x00, 0x04, 0xB3, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F,
-	0x00, 0x1B, 0x40, 0x0C, 0x02, 0x03, 0x80, 0x0E, 0x0F, 0x0F, 0x0B, 0x07, 0x7D, 0x0A, 0x06, 0x0A,
-	0x00, 0x3F, 0x33, 0x3F, 0x33, 0x33, 0x2F, 0x33, 0x1A, 0xCC, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21,
-	0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x05, 0x15, 0x21, 0x35, 0x03, 0xC0, 0xFD,
-	0x5F, 0x25, 0xB9, 0x03, 0xCE, 0xB9, 0x01, 0x13, 0xFB, 0x7D, 0x02, 0x8B, 0x99, 0x99, 0x02, 0x02,
-	0xFB, 0x73, 0x04, 0x8D, 0xFB, 0x73, 0x04, 0x8D, 0xA6, 0x98, 0x98, 0x00, 0x00, 0x02, 0x00, 0x8B,
-	0xFE, 0x4B, 0x04, 0x59, 0x04, 0x8D, 0x00, 0x09, 0x00, 0x1B, 0x00, 0x1F, 0x40, 0x0F, 0x17, 0x10,
-	0x0F, 0x72, 0x09, 0x03, 0x06, 0x7D, 0x08, 0x0A, 0x0A, 0x02, 0x02, 0x05, 0x0A, 0x00, 0x3F, 0x33,
-	0x11, 0x33, 0x11, 0x33, 0x3F, 0x33, 0x33, 0x2B, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x01, 0x11,
-	0x23, 0x11, 0x33, 0x01, 0x11, 0x11, 0x33, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x27, 0x37,
-	0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x04, 0x59, 0xB9, 0xFD, 0xA4, 0xB9, 0xB9, 0x02, 0x5C,
-	0xB9, 0x4D, 0x90, 0x65, 0x1F, 0x34, 0x1D, 0x0E, 0x0F, 0x45, 0x0E, 0x2B, 0x3D, 0x21, 0x04, 0x8D,
-	0xFB, 0x73, 0x03, 0x6C, 0xFC, 0x94, 0x04, 0x8D, 0xFC, 0x94, 0x03, 0x6C, 0xFB, 0xA8, 0x8E, 0x70,
-	0x9C, 0x50, 0x07, 0x0A, 0x9D, 0x06, 0x06, 0x2A, 0x53, 0x3D, 0xFF, 0xFF, 0x00, 0x26, 0x02, 0x1F,
-	0x02, 0x0E, 0x02, 0xB7, 0x06, 0x06, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x25, 0x00, 0x00,
-	0x04, 0xE5, 0x05, 0xB0, 0x00, 0x1A, 0x00, 0x1E, 0x00, 0x22, 0x00, 0x23, 0x40, 0x11, 0x02, 0x01,
-	0x01, 0x1D, 0x22, 0x21, 0x21, 0x1D, 0x0E, 0x0F, 0x0F, 0x1E, 0x02, 0x72, 0x1D, 0x08, 0x72, 0x00,
-	0x2B, 0x2B, 0x32, 0x11, 0x33, 0x11, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30, 0x31, 0x61,
-	0x21, 0x37, 0x21, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x21, 0x35, 0x21, 0x32,
-	0x1E, 0x02, 0x15, 0x15, 0x14, 0x0E, 0x02, 0x01, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x02,
-	0x51, 0xFE, 0xD0, 0x02, 0x01, 0x2E, 0x9C, 0xD0, 0x69, 0x3C, 0x74, 0xA7, 0x6C, 0xFE, 0xB8, 0x01,
-	0x48, 0x8F, 0xEC, 0xAB, 0x5C, 0x5C, 0xAD, 0xF3, 0xFE, 0x9F, 0xC1, 0x01, 0xDB, 0xFD, 0x83, 0x9D,
-	0x83, 0xED, 0x9F, 0x59, 0x7D, 0xC3, 0x87, 0x46, 0x9E, 0x5F, 0xB3, 0xFD, 0x9E, 0x57, 0x9E, 0xFD,
-	0xB2, 0x5F, 0x05, 0xB0, 0xFA, 0x50, 0x05, 0xB0, 0xFD, 0x81, 0x98, 0x98, 0x00, 0x03, 0x00, 0x25,
-	0x00, 0x00, 0x04, 0xE5, 0x05, 0xB0, 0x00, 0x1A, 0x00, 0x1E, 0x00, 0x22, 0x00, 0x23, 0x40, 0x11,
-	0x02, 0x01, 0x01, 0x1D, 0x22, 0x21, 0x21, 0x1D, 0x0E, 0x0F, 0x0F, 0x1E, 0x02, 0x72, 0x1D, 0x08,
-	0x72, 0x00, 0x2B, 0x2B, 0x32, 0x11, 0x33, 0x11, 0x39, 0x2F, 0x33, 0x11, 0x33, 0x11, 0x33, 0x30,
-	0x31, 0x61, 0x21, 0x37, 0x21, 0x32, 0x36, 0x36, 0x35, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x21, 0x35,
-	0x21, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x14, 0x0E, 0x02, 0x01, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21,
-	0x35, 0x02, 0x51, 0xFE, 0xD0, 0x02, 0x01, 0x2E, 0x9C, 0xD0, 0x69, 0x3C, 0x74, 0xA7, 0x6C, 0xFE,
-	0xB8, 0x01, 0x48, 0x8F, 0xEC, 0xAB, 0x5C, 0x5C, 0xAD, 0xF3, 0xFE, 0x9F, 0xC1, 0x01, 0xDB, 0xFD,
-	0x83, 0x9D, 0x83, 0xED, 0x9F, 0x59, 0x7D, 0xC3, 0x87, 0x46, 0x9E, 0x5F, 0xB3, 0xFD, 0x9E, 0x57,
-	0x9E, 0xFD, 0xB2, 0x5F, 0x05, 0xB0, 0xFA, 0x50, 0x05, 0xB0, 0xFD, 0x81, 0x98, 0x98, 0x00, 0x03,
-	0x00, 0x01, 0x00, 0x00, 0x03, 0xFE, 0x06, 0x00, 0x00, 0x03, 0x00, 0x1A, 0x00, 0x1E, 0x00, 0x19,
-	0x40, 0x0D, 0x1E, 0x1D, 0x16, 0x0A, 0x07, 0x72, 0x03, 0x00, 0x72, 0x11, 0x02, 0x0A, 0x72, 0x00,
-	0x2B, 0x32, 0x2B, 0x2B, 0x32, 0xC4, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x13, 0x27, 0x3E,
-	0x03, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02,
-	0x01, 0x15, 0x21, 0x35, 0x01, 0x64, 0xB9, 0x8D, 0x4D, 0x01, 0x40, 0x74, 0xA1, 0x62, 0x50, 0x80,
-	0x5B, 0x30, 0xBA, 0x32, 0x60, 0x46, 0x45, 0x71, 0x51, 0x2D, 0x01, 0x46, 0xFD, 0x83, 0x06, 0x00,
-	0xFA, 0x00, 0x06, 0x00, 0xFC, 0x46, 0x03, 0x6F, 0xBD, 0x8C, 0x4D, 0x2B, 0x5E, 0x95, 0x6B, 0xFD,
-	0x3B, 0x02, 0xC7, 0x55, 0x67, 0x2F, 0x3A, 0x66, 0x83, 0x02, 0xDA, 0x98, 0x98, 0x00, 0x00, 0x03,
-	0x00, 0x32, 0x00, 0x00, 0x04, 0x97, 0x05, 0xB0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x15,
-	0x40, 0x0A, 0x03, 0x0A, 0x0B, 0x06, 0x07, 0x02, 0x72, 0x01, 0x08, 0x72, 0x00, 0x2B, 0x2B, 0x32,
-	0x2F, 0x33, 0x32, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21,
-	0x35, 0x02, 0xC3, 0xBE, 0x02, 0x92, 0xFB, 0x9B, 0x03, 0x79, 0xFD, 0x83, 0x05, 0xB0, 0xFA, 0x50,
-	0x05, 0xB0, 0x9E, 0x9E, 0xFE, 0x1E, 0x98, 0x98, 0x00, 0x03, 0xFF, 0xF4, 0xFF, 0xEC, 0x02, 0x71,
-	0x05, 0x41, 0x00, 0x03, 0x00, 0x15, 0x00, 0x19, 0x00, 0x1D, 0x40, 0x0E, 0x0A, 0x11, 0x0B, 0x72,
-	0x18, 0x19, 0x19, 0x02, 0x02, 0x04, 0x04, 0x03, 0x06, 0x72, 0x00, 0x2B, 0x32, 0x2F, 0x32, 0x11,
-	0x33, 0x2F, 0x33, 0x2B, 0x32, 0x30, 0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x33, 0x11, 0x14, 0x16,
-	0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x01, 0x15, 0x21,
-	0x35, 0x02, 0x52, 0xFD, 0xB7, 0xC6, 0xB9, 0x22, 0x36, 0x1F, 0x17, 0x33, 0x0D, 0x01, 0x16, 0x47,
-	0x32, 0x44, 0x72, 0x43, 0x01, 0xA2, 0xFD, 0x83, 0x04, 0x3A, 0x8E, 0x8E, 0x01, 0x07, 0xFB, 0xCB,
-	0x37, 0x38, 0x12, 0x09, 0x03, 0x97, 0x07, 0x0D, 0x36, 0x7F, 0x6C, 0x01, 0xE5, 0x98, 0x98, 0x00,
-	0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E, 0x07, 0x37, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x44, 0x01, 0x2F, 0x01, 0x37, 0x00, 0x0B, 0xB6, 0x03, 0x10, 0x07, 0x01, 0x01,
-	0x61, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E, 0x07, 0x37,
-	0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0xBF, 0x01, 0x37, 0x00, 0x0B,
-	0xB6, 0x03, 0x0E, 0x03, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x1D,
-	0x00, 0x00, 0x05, 0x1E, 0x07, 0x37, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9E,
-	0x00, 0xC9, 0x01, 0x37, 0x00, 0x0B, 0xB6, 0x03, 0x11, 0x07, 0x01, 0x01, 0x6C, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E, 0x07, 0x23, 0x06, 0x26, 0x00, 0x25,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0xA5, 0x00, 0xC4, 0x01, 0x3B, 0x00, 0x0B, 0xB6, 0x03, 0x1C, 0x03,
-	0x01, 0x01, 0x6B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E,
-	0x06, 0xFD, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x00, 0xF9, 0x01, 0x37,
-	0x00, 0x0D, 0xB7, 0x04, 0x03, 0x23, 0x07, 0x01, 0x01, 0x78, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E, 0x07, 0x93, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0xA3, 0x01, 0x50, 0x01, 0x42, 0x00, 0x0D, 0xB7, 0x04, 0x03, 0x19, 0x07, 0x01,
-	0x01, 0x47, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E,
-	0x07, 0x94, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x02, 0x41, 0x01, 0x59, 0x01, 0x22,
-	0x00, 0x12, 0xB6, 0x05, 0x04, 0x03, 0x1B, 0x07, 0x01, 0x00, 0xB8, 0xFF, 0xB2, 0xB0, 0x56, 0x00,
-	0x2B, 0x34, 0x34, 0x34, 0xFF, 0xFF, 0x00, 0x78, 0xFE, 0x43, 0x04, 0xD8, 0x05, 0xC4, 0x06, 0x26,
-	0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0x79, 0x01, 0xD3, 0xFF, 0xF6, 0x00, 0x0B, 0xB6, 0x01,
-	0x28, 0x05, 0x00, 0x00, 0x0A, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00,
-	0x04, 0x46, 0x07, 0x42, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xFA,
-	0x01, 0x42, 0x00, 0x0B, 0xB6, 0x04, 0x12, 0x07, 0x01, 0x01, 0x6C, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00, 0x04, 0x46, 0x07, 0x42, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x75, 0x01, 0x8A, 0x01, 0x42, 0x00, 0x0B, 0xB6, 0x04, 0x10, 0x07, 0x01, 0x01,
-	0x6C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00, 0x04, 0x46, 0x07, 0x42,
-	0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9E, 0x00, 0x94, 0x01, 0x42, 0x00, 0x0B,
-	0xB6, 0x04, 0x13, 0x07, 0x01, 0x01, 0x77, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9,
-	0x00, 0x00, 0x04, 0x46, 0x07, 0x08, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A,
-	0x00, 0xC4, 0x01, 0x42, 0x00, 0x0D, 0xB7, 0x05, 0x04, 0x25, 0x07, 0x01, 0x01, 0x83, 0x56, 0x00,
-	0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x01, 0x80, 0x07, 0x42, 0x06, 0x26,
-	0x00, 0x2D, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0xFF, 0xA6, 0x01, 0x42, 0x00, 0x0B, 0xB6, 0x01,
-	0x06, 0x03, 0x01, 0x01, 0x6C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xB1, 0x00, 0x00,
-	0x02, 0x52, 0x07, 0x42, 0x06, 0x26, 0x00, 0x2D, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x00, 0x36,
-	0x01, 0x42, 0x00, 0x0B, 0xB6, 0x01, 0x04, 0x03, 0x01, 0x01, 0x6C, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0xFF, 0xEA, 0x00, 0x00, 0x02, 0x47, 0x07, 0x42, 0x06, 0x26, 0x00, 0x2D, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x9E, 0xFF, 0x40, 0x01, 0x42, 0x00, 0x0B, 0xB6, 0x01, 0x07, 0x03, 0x01, 0x01,
-	0x77, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xD5, 0x00, 0x00, 0x02, 0x5F, 0x07, 0x08,
-	0x06, 0x26, 0x00, 0x2D, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0xFF, 0x70, 0x01, 0x42, 0x00, 0x0D,
-	0xB7, 0x02, 0x01, 0x19, 0x03, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0xA9, 0x00, 0x00, 0x05, 0x09, 0x07, 0x23, 0x06, 0x26, 0x00, 0x32, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0xA5, 0x00, 0xFA, 0x01, 0x3B, 0x00, 0x0B, 0xB6, 0x01, 0x18, 0x06, 0x01, 0x01, 0x6B, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x77, 0xFF, 0xEC, 0x05, 0x0A, 0x07, 0x39, 0x06, 0x26,
-	0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x01, 0x52, 0x01, 0x39, 0x00, 0x0B, 0xB6, 0x02,
-	0x2E, 0x11, 0x01, 0x01, 0x4F, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x77, 0xFF, 0xEC,
-	0x05, 0x0A, 0x07, 0x39, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0xE2,
-	0x01, 0x39, 0x00, 0x0B, 0xB6, 0x02, 0x2C, 0x11, 0x01, 0x01, 0x4F, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x77, 0xFF, 0xEC, 0x05, 0x0A, 0x07, 0x39, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x9E, 0x00, 0xEC, 0x01, 0x39, 0x00, 0x0B, 0xB6, 0x02, 0x2F, 0x11, 0x01, 0x01,
-	0x5A, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x77, 0xFF, 0xEC, 0x05, 0x0A, 0x07, 0x25,
-	0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA5, 0x00, 0xE7, 0x01, 0x3D, 0x00, 0x0B,
-	0xB6, 0x02, 0x3A, 0x11, 0x01, 0x01, 0x59, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x77,
-	0xFF, 0xEC, 0x05, 0x0A, 0x06, 0xFF, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A,
-	0x01, 0x1C, 0x01, 0x39, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x41, 0x11, 0x01, 0x01, 0x66, 0x56, 0x00,
-	0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8C, 0xFF, 0xEC, 0x04, 0xAA, 0x07, 0x37, 0x06, 0x26,
-	0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x01, 0x2A, 0x01, 0x37, 0x00, 0x0B, 0xB6, 0x01,
-	0x18, 0x00, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8C, 0xFF, 0xEC,
-	0x04, 0xAA, 0x07, 0x37, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0xBA,
-	0x01, 0x37, 0x00, 0x0B, 0xB6, 0x01, 0x16, 0x0B, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x8C, 0xFF, 0xEC, 0x04, 0xAA, 0x07, 0x37, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x9E, 0x00, 0xC4, 0x01, 0x37, 0x00, 0x0B, 0xB6, 0x01, 0x19, 0x00, 0x01, 0x01,
-	0x6C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8C, 0xFF, 0xEC, 0x04, 0xAA, 0x06, 0xFD,
-	0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x00, 0xF4, 0x01, 0x37, 0x00, 0x0D,
-	0xB7, 0x02, 0x01, 0x2B, 0x00, 0x01, 0x01, 0x78, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x0F, 0x00, 0x00, 0x04, 0xBC, 0x07, 0x36, 0x06, 0x26, 0x00, 0x3D, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x75, 0x01, 0x89, 0x01, 0x36, 0x00, 0x0B, 0xB6, 0x01, 0x09, 0x02, 0x01, 0x01, 0x60, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x6D, 0xFF, 0xEC, 0x03, 0xEA, 0x06, 0x00, 0x06, 0x26,
-	0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xD5, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02,
-	0x3D, 0x0F, 0x01, 0x01, 0x8C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x6D, 0xFF, 0xEC,
-	0x03, 0xEA, 0x06, 0x00, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x65,
-	0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x3B, 0x0F, 0x01, 0x01, 0x8C, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x6D, 0xFF, 0xEC, 0x03, 0xEA, 0x06, 0x00, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00,
-	0x01, 0x06, 0x00, 0x9E, 0x6F, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x3E, 0x0F, 0x01, 0x01, 0x97, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x6D, 0xFF, 0xEC, 0x03, 0xEA, 0x05, 0xEC, 0x06, 0x26,
-	0x00, 0x45, 0x00, 0x00, 0x01, 0x06, 0x00, 0xA5, 0x6A, 0x04, 0x00, 0x0B, 0xB6, 0x02, 0x49, 0x0F,
-	0x01, 0x01, 0x96, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x6D, 0xFF, 0xEC, 0x03, 0xEA,
-	0x05, 0xC6, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x00, 0x9F, 0x00, 0x00,
-	0x00, 0x0D, 0xB7, 0x03, 0x02, 0x50, 0x0F, 0x01, 0x01, 0xA3, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x6D, 0xFF, 0xEC, 0x03, 0xEA, 0x06, 0x5C, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0xA3, 0x00, 0xF6, 0x00, 0x0B, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x46, 0x0F, 0x01,
-	0x01, 0x72, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x6D, 0xFF, 0xEC, 0x03, 0xEA,
-	0x06, 0x5D, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x02, 0x41, 0x00, 0xFF, 0xFF, 0xEB,
-	0x00, 0x12, 0xB6, 0x04, 0x03, 0x02, 0x48, 0x0F, 0x00, 0x00, 0xB8, 0xFF, 0xDD, 0xB0, 0x56, 0x00,
-	0x2B, 0x34, 0x34, 0x34, 0xFF, 0xFF, 0x00, 0x5D, 0xFE, 0x43, 0x03, 0xED, 0x04, 0x4E, 0x06, 0x26,
-	0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x00, 0x79, 0x01, 0x40, 0xFF, 0xF6, 0x00, 0x0B, 0xB6, 0x01,
-	0x28, 0x09, 0x00, 0x00, 0x0A, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5D, 0xFF, 0xEC,
-	0x03, 0xF3, 0x06, 0x00, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xC4,
-	0x00, 0x00, 0x00, 0x0B, 0xB6, 0x01, 0x2E, 0x0B, 0x01, 0x01, 0x8C, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x5D, 0xFF, 0xEC, 0x03, 0xF3, 0x06, 0x00, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x75, 0x01, 0x54, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x01, 0x2C, 0x0B, 0x01, 0x01,
-	0x8C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5D, 0xFF, 0xEC, 0x03, 0xF3, 0x06, 0x00,
-	0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9E, 0x5E, 0x00, 0x00, 0x0B, 0xB6, 0x01,
-	0x2F, 0x0B, 0x01, 0x01, 0x97, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5D, 0xFF, 0xEC,
-	0x03, 0xF3, 0x05, 0xC6, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x00, 0x8E,
-	0x00, 0x00, 0x00, 0x0D, 0xB7, 0x02, 0x01, 0x41, 0x0B, 0x01, 0x01, 0xA3, 0x56, 0x00, 0x2B, 0x34,
-	0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xC4, 0x00, 0x00, 0x01, 0x65, 0x05, 0xFE, 0x06, 0x26, 0x00, 0x8D,
-	0x00, 0x00, 0x01, 0x06, 0x00, 0x44, 0x8B, 0xFE, 0x00, 0x0B, 0xB6, 0x01, 0x06, 0x03, 0x01, 0x01,
-	0x9E, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x96, 0x00, 0x00, 0x02, 0x37, 0x05, 0xFE,
-	0x06, 0x26, 0x00, 0x8D, 0x00, 0x00, 0x01, 0x06, 0x00, 0x75, 0x1B, 0xFE, 0x00, 0x0B, 0xB6, 0x01,
-	0x04, 0x03, 0x01, 0x01, 0x9E, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00,
-	0x02, 0x2C, 0x05, 0xFE, 0x06, 0x26, 0x00, 0x8D, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9E, 0xFF, 0x25,
-	0xFF, 0xFE, 0x00, 0x0B, 0xB6, 0x01, 0x07, 0x03, 0x01, 0x01, 0xA9, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x02, 0x44, 0x05, 0xC4, 0x06, 0x26, 0x00, 0x8D, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x6A, 0xFF, 0x55, 0xFF, 0xFE, 0x00, 0x0D, 0xB7, 0x02, 0x01, 0x19, 0x03, 0x01,
-	0x01, 0xB5, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8D, 0x00, 0x00, 0x03, 0xE0,
-	0x05, 0xEC, 0x06, 0x26, 0x00, 0x52, 0x00, 0x00, 0x01, 0x06, 0x00, 0xA5, 0x61, 0x04, 0x00, 0x0B,
-	0xB6, 0x02, 0x2A, 0x03, 0x01, 0x01, 0xAA, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5C,
-	0xFF, 0xEC, 0x04, 0x35, 0x06, 0x00, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44,
-	0x00, 0xCE, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x2E, 0x06, 0x01, 0x01, 0x8C, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5C, 0xFF, 0xEC, 0x04, 0x35, 0x06, 0x00, 0x06, 0x26, 0x00, 0x53,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x5E, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x2C, 0x06,
-	0x01, 0x01, 0x8C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5C, 0xFF, 0xEC, 0x04, 0x35,
-	0x06, 0x00, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9E, 0x68, 0x00, 0x00, 0x0B,
-	0xB6, 0x02, 0x2F, 0x06, 0x01, 0x01, 0x97, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5C,
-	0xFF, 0xEC, 0x04, 0x35, 0x05, 0xEC, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x06, 0x00, 0xA5,
-	0x63, 0x04, 0x00, 0x0B, 0xB6, 0x02, 0x3A, 0x06, 0x01, 0x01, 0x96, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x5C, 0xFF, 0xEC, 0x04, 0x35, 0x05, 0xC6, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x6A, 0x00, 0x98, 0x00, 0x00, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x41, 0x06, 0x01,
-	0x01, 0xA3, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x89, 0xFF, 0xEC, 0x03, 0xDD,
-	0x06, 0x00, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xC6, 0x00, 0x00,
-	0x00, 0x0B, 0xB6, 0x02, 0x1E, 0x11, 0x01, 0x01, 0xA0, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x89, 0xFF, 0xEC, 0x03, 0xDD, 0x06, 0x00, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x75, 0x01, 0x56, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x1C, 0x11, 0x01, 0x01, 0xA0, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x89, 0xFF, 0xEC, 0x03, 0xDD, 0x06, 0x00, 0x06, 0x26,
-	0x00, 0x59, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9E, 0x60, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x1F, 0x11,
-	0x01, 0x01, 0xAB, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x89, 0xFF, 0xEC, 0x03, 0xDD,
-	0x05, 0xC6, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x00, 0x90, 0x00, 0x00,
-	0x00, 0x0D, 0xB7, 0x03, 0x02, 0x31, 0x11, 0x01, 0x01, 0xB7, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x16, 0xFE, 0x4B, 0x03, 0xB0, 0x06, 0x00, 0x06, 0x26, 0x00, 0x5D, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x75, 0x01, 0x1B, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x19, 0x01, 0x01, 0x01,
-	0xA0, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x16, 0xFE, 0x4B, 0x03, 0xB0, 0x05, 0xC6,
-	0x06, 0x26, 0x00, 0x5D, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6A, 0x55, 0x00, 0x00, 0x0D, 0xB7, 0x03,
-	0x02, 0x2E, 0x01, 0x01, 0x01, 0xB7, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x1D,
-	0x00, 0x00, 0x05, 0x1E, 0x06, 0xE4, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70,
-	0x00, 0xC7, 0x01, 0x3F, 0x00, 0x0B, 0xB6, 0x03, 0x10, 0x03, 0x01, 0x01, 0xA6, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x6D, 0xFF, 0xEC, 0x03, 0xEA, 0x05, 0xAD, 0x06, 0x26, 0x00, 0x45,
-	0x00, 0x00, 0x01, 0x06, 0x00, 0x70, 0x6D, 0x08, 0x00, 0x0B, 0xB6, 0x02, 0x3D, 0x0F, 0x01, 0x01,
-	0xD1, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E, 0x07, 0x0E,
-	0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA1, 0x00, 0xF3, 0x01, 0x37, 0x00, 0x0B,
-	0xB6, 0x03, 0x13, 0x07, 0x01, 0x01, 0x53, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x6D,
-	0xFF, 0xEC, 0x03, 0xEA, 0x05, 0xD7, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA1,
-	0x00, 0x99, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x40, 0x0F, 0x01, 0x01, 0x7E, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0x00, 0x04, 0x00, 0x1D, 0xFE, 0x4E, 0x05, 0x1E, 0x05, 0xB0, 0x00, 0x04, 0x00, 0x09,
-	0x00, 0x0D, 0x00, 0x23, 0x00, 0x2B, 0x40, 0x15, 0x0D, 0x0C, 0x0C, 0x03, 0x16, 0x1D, 0x06, 0x00,
-	0x02, 0x07, 0x03, 0x02, 0x72, 0x0E, 0x0F, 0x0F, 0x05, 0x05, 0x02, 0x08, 0x72, 0x00, 0x2B, 0x32,
-	0x11, 0x33, 0x11, 0x33, 0x2B, 0x32, 0x12, 0x39, 0x39, 0x2F, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x30,
-	0x31, 0x41, 0x01, 0x23, 0x01, 0x33, 0x01, 0x01, 0x27, 0x33, 0x01, 0x03, 0x15, 0x21, 0x35, 0x01,
-	0x17, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26,
-	0x35, 0x34, 0x36, 0x36, 0x02, 0xC4, 0xFE, 0x1E, 0xC5, 0x02, 0x2B, 0x7F, 0x01, 0x91, 0xFE, 0x1D,
-	0x03, 0x7F, 0x02, 0x2D, 0xDF, 0xFC, 0xCE, 0x03, 0xA1, 0x4A, 0x2B, 0x4E, 0x32, 0x23, 0x2B, 0x21,
-	0x34, 0x0F, 0x0E, 0x19, 0x4D, 0x3B, 0x51, 0x6F, 0x35, 0x72, 0x05, 0x2F, 0xFA, 0xD1, 0x05, 0xB0,
-	0xFA, 0x50, 0x05, 0x2F, 0x81, 0xFA, 0x50, 0x02, 0x1B, 0x9E, 0x9E, 0xFE, 0x1E, 0x39, 0x20, 0x45,
-	0x4D, 0x2C, 0x21, 0x28, 0x13, 0x08, 0x7A, 0x0F, 0x1D, 0x61, 0x5E, 0x36, 0x6A, 0x62, 0x00, 0x03,
-	0x00, 0x6D, 0xFE, 0x4E, 0x03, 0xEA, 0x04, 0x4E, 0x00, 0x1B, 0x00, 0x3A, 0x00, 0x50, 0x00, 0x2B,
-	0x40, 0x17, 0x1E, 0x3A, 0x3A, 0x0F, 0x43, 0x4A, 0x0F, 0x72, 0x27, 0x31, 0x0B, 0x72, 0x3B, 0x3C,
-	0x3C, 0x19, 0x0A, 0x72, 0x09, 0x05, 0x0F, 0x07, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x2B, 0x32, 0x11,
-	0x33, 0x2B, 0x32, 0x2B, 0x32, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x65, 0x11, 0x34, 0x26, 0x26,
-	0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x14,
-	0x16, 0x17, 0x15, 0x23, 0x26, 0x26, 0x13, 0x17, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x16,
-	0x33, 0x32, 0x36, 0x36, 0x37, 0x17, 0x0E, 0x03, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02,
-	0x33, 0x01, 0x17, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23,
-	0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x03, 0x0B, 0x33, 0x66, 0x4B, 0x46, 0x69, 0x3B, 0xB9, 0x3C,
-	0x71, 0x9F, 0x62, 0x76, 0xB5, 0x67, 0x13, 0x13, 0xC1, 0x0E, 0x10, 0x20, 0x02, 0xBB, 0x4F, 0x7C,
-	0x54, 0x2C, 0x2E, 0x5D, 0x44, 0x55, 0x82, 0x4D, 0x03, 0x4F, 0x07, 0x3E, 0x67, 0x8D, 0x58, 0x6E,
-	0xA5, 0x5B, 0x44, 0x80, 0xB4, 0x6F, 0x01, 0x2C, 0x4A, 0x2B, 0x4E, 0x32, 0x23, 0x2B, 0x21, 0x34,
-	0x0F, 0x0E, 0x19, 0x4D, 0x3B, 0x51, 0x6F, 0x35, 0x72, 0xB9, 0x02, 0x2D, 0x40, 0x5F, 0x34, 0x30,
-	0x4E, 0x2D, 0x3A, 0x72, 0x5D, 0x37, 0x50, 0xA1, 0x79, 0xFE, 0x08, 0x36, 0x7A, 0x2C, 0x10, 0x20,
-	0x6B, 0x02, 0x05, 0x82, 0x19, 0x32, 0x4B, 0x32, 0x33, 0x54, 0x31, 0x48, 0x68, 0x31, 0x59, 0x2A,
-	0x66, 0x5D, 0x3D, 0x56, 0x91, 0x5A, 0x57, 0x85, 0x59, 0x2E, 0xFD, 0xA9, 0x39, 0x20, 0x45, 0x4D,
-	0x2C, 0x21, 0x28, 0x13, 0x08, 0x7A, 0x0F, 0x1D, 0x61, 0x5E, 0x36, 0x6A, 0x62, 0x00, 0xFF, 0xFF,
-	0x00, 0x78, 0xFF, 0xEC, 0x04, 0xD8, 0x07, 0x57, 0x06, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x75, 0x01, 0xC7, 0x01, 0x57, 0x00, 0x0B, 0xB6, 0x01, 0x28, 0x10, 0x01, 0x01, 0x6D, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5D, 0xFF, 0xEC, 0x03, 0xED, 0x06, 0x00, 0x06, 0x26,
-	0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x34, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x01,
-	0x28, 0x14, 0x01, 0x01, 0x8C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x78, 0xFF, 0xEC,
-	0x04, 0xD8, 0x07, 0x57, 0x06, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9E, 0x00, 0xD1,
-	0x01, 0x57, 0x00, 0x0B, 0xB6, 0x01, 0x2B, 0x10, 0x01, 0x01, 0x78, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x5D, 0xFF, 0xEC, 0x03, 0xED, 0x06, 0x00, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00,
-	0x01, 0x06, 0x00, 0x9E, 0x3E, 0x00, 0x00, 0x0B, 0xB6, 0x01, 0x2B, 0x14, 0x01, 0x01, 0x97, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x78, 0xFF, 0xEC, 0x04, 0xD8, 0x07, 0x19, 0x06, 0x26,
-	0x00, 0x27, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA2, 0x01, 0xAD, 0x01, 0x57, 0x00, 0x0B, 0xB6, 0x01,
-	0x31, 0x10, 0x01, 0x01, 0x82, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5D, 0xFF, 0xEC,
-	0x03, 0xED, 0x05, 0xC2, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA2, 0x01, 0x1A,
-	0x00, 0x00, 0x00, 0x0B, 0xB6, 0x01, 0x31, 0x14, 0x01, 0x01, 0xA1, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x78, 0xFF, 0xEC, 0x04, 0xD8, 0x07, 0x56, 0x06, 0x26, 0x00, 0x27, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x9F, 0x00, 0xE6, 0x01, 0x57, 0x00, 0x0B, 0xB6, 0x01, 0x2E, 0x10, 0x01, 0x01,
-	0x76, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5D, 0xFF, 0xEC, 0x03, 0xED, 0x05, 0xFF,
-	0x06, 0x26, 0x00, 0x47, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9F, 0x53, 0x00, 0x00, 0x0B, 0xB6, 0x01,
-	0x2E, 0x14, 0x01, 0x01, 0x95, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00,
-	0x04, 0xC7, 0x07, 0x41, 0x06, 0x26, 0x00, 0x28, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9F, 0x00, 0x9F,
-	0x01, 0x42, 0x00, 0x0B, 0xB6, 0x02, 0x25, 0x1E, 0x01, 0x01, 0x75, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x5F, 0xFF, 0xEC, 0x05, 0x2C, 0x06, 0x02, 0x04, 0x26, 0x00, 0x48, 0x00, 0x00,
-	0x01, 0x07, 0x01, 0xD4, 0x03, 0xD5, 0x05, 0x13, 0x00, 0x0B, 0xB6, 0x03, 0x39, 0x01, 0x01, 0x00,
-	0x00, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00, 0x04, 0x46, 0x06, 0xEF,
-	0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0x00, 0x92, 0x01, 0x4A, 0x00, 0x0B,
-	0xB6, 0x04, 0x12, 0x07, 0x01, 0x01, 0xB1, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5D,
-	0xFF, 0xEC, 0x03, 0xF3, 0x05, 0xAD, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x06, 0x00, 0x70,
-	0x5C, 0x08, 0x00, 0x0B, 0xB6, 0x01, 0x2E, 0x0B, 0x01, 0x01, 0xD1, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00, 0x04, 0x46, 0x07, 0x19, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0xA1, 0x00, 0xBE, 0x01, 0x42, 0x00, 0x0B, 0xB6, 0x04, 0x15, 0x07, 0x01, 0x01,
-	0x5E, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5D, 0xFF, 0xEC, 0x03, 0xF3, 0x05, 0xD7,
-	0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA1, 0x00, 0x88, 0x00, 0x00, 0x00, 0x0B,
-	0xB6, 0x01, 0x31, 0x0B, 0x01, 0x01, 0x7E, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9,
-	0x00, 0x00, 0x04, 0x46, 0x07, 0x04, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA2,
-	0x01, 0x70, 0x01, 0x42, 0x00, 0x0B, 0xB6, 0x04, 0x19, 0x07, 0x01, 0x01, 0x81, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5D, 0xFF, 0xEC, 0x03, 0xF3, 0x05, 0xC2, 0x06, 0x26, 0x00, 0x49,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0xA2, 0x01, 0x3A, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x01, 0x35, 0x0B,
-	0x01, 0x01, 0xA1, 0x56, 0x00, 0x2B, 0x34, 0x00, 0x00, 0x05, 0x00, 0xA9, 0xFE, 0x4E, 0x04, 0x46,
-	0x05, 0xB0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x25, 0x00, 0x29, 0x40, 0x14,
-	0x0A, 0x0B, 0x0B, 0x18, 0x1F, 0x0E, 0x0F, 0x0F, 0x07, 0x02, 0x72, 0x10, 0x11, 0x11, 0x03, 0x02,
-	0x02, 0x06, 0x08, 0x72, 0x00, 0x2B, 0x32, 0x11, 0x33, 0x32, 0x11, 0x33, 0x2B, 0x32, 0x11, 0x33,
-	0x2F, 0x33, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x01,
-	0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x17, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32,
-	0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x04, 0x46, 0xFC, 0xFD,
-	0x27, 0xC1, 0x03, 0x37, 0xFD, 0x63, 0x02, 0xF9, 0xFD, 0x07, 0x02, 0x71, 0x4A, 0x2B, 0x4E, 0x32,
-	0x23, 0x2B, 0x21, 0x34, 0x0F, 0x0E, 0x19, 0x4D, 0x3B, 0x51, 0x6F, 0x35, 0x72, 0x9D, 0x9D, 0x9D,
-	0x05, 0x13, 0xFA, 0x50, 0x05, 0xB0, 0xFD, 0x8E, 0x9D, 0x9D, 0x02, 0x72, 0x9E, 0x9E, 0xFA, 0x89,
-	0x39, 0x20, 0x45, 0x4D, 0x2C, 0x21, 0x28, 0x13, 0x08, 0x7A, 0x0F, 0x1D, 0x61, 0x5E, 0x36, 0x6A,
-	0x62, 0x00, 0x00, 0x02, 0x00, 0x5D, 0xFE, 0x68, 0x03, 0xF3, 0x04, 0x4E, 0x00, 0x2B, 0x00, 0x41,
-	0x00, 0x25, 0x40, 0x13, 0x12, 0x13, 0x13, 0x0B, 0x34, 0x3B, 0x0E, 0x72, 0x19, 0x0B, 0x07, 0x72,
-	0x2C, 0x2D, 0x24, 0x24, 0x00, 0x0B, 0x72, 0x00, 0x2B, 0x32, 0x11, 0x39, 0x39, 0x2B, 0x32, 0x2B,
-	0x32, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x45, 0x22, 0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02,
-	0x33, 0x32, 0x1E, 0x02, 0x15, 0x15, 0x21, 0x35, 0x21, 0x35, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02,
-	0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x37, 0x17, 0x0E, 0x02,
-	0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36,
-	0x36, 0x02, 0x4E, 0x71, 0xB7, 0x83, 0x46, 0x4E, 0x86, 0xAA, 0x5B, 0x74, 0xA9, 0x6C, 0x34, 0xFC,
-	0xD8, 0x02, 0x6F, 0x04, 0x33, 0x6E, 0x5F, 0x3F, 0x6A, 0x4C, 0x2A, 0x2B, 0x53, 0x77, 0x4C, 0x62,
-	0x88, 0x33, 0x70, 0x23, 0x6C, 0x9D, 0x29, 0x4A, 0x2B, 0x4E, 0x32, 0x23, 0x2B, 0x21, 0x34, 0x0F,
-	0x0E, 0x19, 0x4D, 0x3B, 0x51, 0x6F, 0x35, 0x72, 0x14, 0x4D, 0x8C, 0xC0, 0x72, 0x2A, 0x84, 0xCF,
-	0x90, 0x4A, 0x50, 0x8F, 0xC1, 0x72, 0x53, 0x97, 0x0E, 0x48, 0x88, 0x58, 0x35, 0x68, 0x96, 0x62,
-	0x2A, 0x4D, 0x87, 0x66, 0x3A, 0x50, 0x43, 0x59, 0x35, 0x60, 0x3C, 0x67, 0x39, 0x20, 0x45, 0x4D,
-	0x2C, 0x21, 0x28, 0x13, 0x08, 0x7A, 0x0F, 0x1D, 0x61, 0x5E, 0x36, 0x6A, 0x62, 0x00, 0xFF, 0xFF,
-	0x00, 0xA9, 0x00, 0x00, 0x04, 0x46, 0x07, 0x41, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x9F, 0x00, 0xA9, 0x01, 0x42, 0x00, 0x0B, 0xB6, 0x04, 0x16, 0x07, 0x01, 0x01, 0x75, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5D, 0xFF, 0xEC, 0x03, 0xF3, 0x05, 0xFF, 0x06, 0x26,
-	0x00, 0x49, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9F, 0x73, 0x00, 0x00, 0x0B, 0xB6, 0x01, 0x32, 0x0B,
-	0x01, 0x01, 0x95, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x7A, 0xFF, 0xEC, 0x04, 0xDD,
-	0x07, 0x57, 0x06, 0x26, 0x00, 0x2B, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9E, 0x00, 0xC9, 0x01, 0x57,
-	0x00, 0x0B, 0xB6, 0x01, 0x2F, 0x10, 0x01, 0x01, 0x78, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x61, 0xFE, 0x55, 0x03, 0xF2, 0x06, 0x00, 0x06, 0x26, 0x00, 0x4B, 0x00, 0x00, 0x01, 0x06,
-	0x00, 0x9E, 0x55, 0x00, 0x00, 0x0B, 0xB6, 0x03, 0x42, 0x1A, 0x01, 0x01, 0x97, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x7A, 0xFF, 0xEC, 0x04, 0xDD, 0x07, 0x2E, 0x06, 0x26, 0x00, 0x2B,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0xA1, 0x00, 0xF3, 0x01, 0x57, 0x00, 0x0B, 0xB6, 0x01, 0x31, 0x10,
-	0x01, 0x01, 0x5F, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x61, 0xFE, 0x55, 0x03, 0xF2,
-	0x05, 0xD7, 0x06, 0x26, 0x00, 0x4B, 0x00, 0x00, 0x01, 0x06, 0x00, 0xA1, 0x7F, 0x00, 0x00, 0x0B,
-	0xB6, 0x03, 0x44, 0x1A, 0x01, 0x01, 0x7E, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x7A,
-	0xFF, 0xEC, 0x04, 0xDD, 0x07, 0x19, 0x06, 0x26, 0x00, 0x2B, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA2,
-	0x01, 0xA5, 0x01, 0x57, 0x00, 0x0B, 0xB6, 0x01, 0x35, 0x10, 0x01, 0x01, 0x82, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x61, 0xFE, 0x55, 0x03, 0xF2, 0x05, 0xC2, 0x04, 0x26, 0x00, 0x4B,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0xA2, 0x01, 0x31, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x03, 0x48, 0x1A,
-	0x01, 0x01, 0xA1, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x7A, 0xFD, 0xF3, 0x04, 0xDD,
-	0x05, 0xC4, 0x06, 0x26, 0x00, 0x2B, 0x00, 0x00, 0x01, 0x07, 0x01, 0xD4, 0x01, 0xDA, 0xFE, 0x95,
-	0x00, 0x0E, 0xB4, 0x01, 0x35, 0x05, 0x01, 0x01, 0xB8, 0xFF, 0x98, 0xB0, 0x56, 0x00, 0x2B, 0x34,
-	0xFF, 0xFF, 0x00, 0x61, 0xFE, 0x55, 0x03, 0xF2, 0x06, 0x93, 0x04, 0x26, 0x00, 0x4B, 0x00, 0x00,
-	0x01, 0x07, 0x02, 0x4E, 0x01, 0x2B, 0x00, 0x57, 0x00, 0x0B, 0xB6, 0x03, 0x3F, 0x1A, 0x01, 0x01,
-	0x98, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00, 0x05, 0x08, 0x07, 0x42,
-	0x06, 0x26, 0x00, 0x2C, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9E, 0x00, 0xF1, 0x01, 0x42, 0x00, 0x0B,
-	0xB6, 0x03, 0x0F, 0x0B, 0x01, 0x01, 0x77, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8D,
-	0x00, 0x00, 0x03, 0xE0, 0x07, 0x41, 0x06, 0x26, 0x00, 0x4C, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9E,
-	0x00, 0x1E, 0x01, 0x41, 0x00, 0x0B, 0xB6, 0x02, 0x1E, 0x03, 0x01, 0x01, 0x26, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xB6, 0x00, 0x00, 0x02, 0x7A, 0x07, 0x2E, 0x06, 0x26, 0x00, 0x2D,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0xA5, 0xFF, 0x3B, 0x01, 0x46, 0x00, 0x0B, 0xB6, 0x01, 0x12, 0x03,
-	0x01, 0x01, 0x76, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0x9B, 0x00, 0x00, 0x02, 0x5F,
-	0x05, 0xEA, 0x06, 0x26, 0x00, 0x8D, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA5, 0xFF, 0x20, 0x00, 0x02,
-	0x00, 0x0B, 0xB6, 0x01, 0x12, 0x03, 0x01, 0x01, 0xA8, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0xFF, 0xCD, 0x00, 0x00, 0x02, 0x6C, 0x06, 0xEF, 0x06, 0x26, 0x00, 0x2D, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x70, 0xFF, 0x3E, 0x01, 0x4A, 0x00, 0x0B, 0xB6, 0x01, 0x06, 0x03, 0x01, 0x01, 0xB1, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x02, 0x51, 0x05, 0xAB, 0x06, 0x26,
-	0x00, 0x8D, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0xFF, 0x23, 0x00, 0x06, 0x00, 0x0B, 0xB6, 0x01,
-	0x06, 0x03, 0x01, 0x01, 0xE3, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xEC, 0x00, 0x00,
-	0x02, 0x42, 0x07, 0x19, 0x06, 0x26, 0x00, 0x2D, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA1, 0xFF, 0x6A,
-	0x01, 0x42, 0x00, 0x0B, 0xB6, 0x01, 0x09, 0x03, 0x01, 0x01, 0x5E, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x02, 0x27, 0x05, 0xD5, 0x06, 0x26, 0x00, 0x8D, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0xA1, 0xFF, 0x4F, 0xFF, 0xFE, 0x00, 0x0B, 0xB6, 0x01, 0x09, 0x03, 0x01, 0x01,
-	0x90, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x17, 0xFE, 0x57, 0x01, 0x78, 0x05, 0xB0,
-	0x06, 0x26, 0x00, 0x2D, 0x00, 0x00, 0x01, 0x06, 0x00, 0xA4, 0xE5, 0x09, 0x00, 0x0B, 0xB6, 0x01,
-	0x05, 0x02, 0x00, 0x00, 0x00, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xFA, 0xFE, 0x4E,
-	0x01, 0x69, 0x05, 0xC4, 0x06, 0x26, 0x00, 0x4D, 0x00, 0x00, 0x01, 0x06, 0x00, 0xA4, 0xC8, 0x00,
-	0x00, 0x0B, 0xB6, 0x02, 0x11, 0x02, 0x00, 0x00, 0x00, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0xAA, 0x00, 0x00, 0x01, 0x85, 0x07, 0x04, 0x06, 0x26, 0x00, 0x2D, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0xA2, 0x00, 0x1C, 0x01, 0x42, 0x00, 0x0B, 0xB6, 0x01, 0x0D, 0x03, 0x01, 0x01, 0x81, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xB7, 0xFF, 0xEC, 0x05, 0xF9, 0x05, 0xB0, 0x04, 0x26,
-	0x00, 0x2D, 0x00, 0x00, 0x00, 0x07, 0x00, 0x2E, 0x02, 0x2D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x8E,
-	0xFE, 0x4B, 0x03, 0x4C, 0x05, 0xC4, 0x04, 0x26, 0x00, 0x4D, 0x00, 0x00, 0x00, 0x07, 0x00, 0x4E,
-	0x01, 0xF2, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x35, 0xFF, 0xEC, 0x04, 0x84, 0x07, 0x35, 0x06, 0x26,
-	0x00, 0x2E, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9E, 0x01, 0x7D, 0x01, 0x35, 0x00, 0x0B, 0xB6, 0x01,
-	0x17, 0x01, 0x01, 0x01, 0x6A, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xB4, 0xFE, 0x4B,
-	0x02, 0x3A, 0x05, 0xD7, 0x06, 0x26, 0x00, 0x9C, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9E, 0xFF, 0x33,
-	0xFF, 0xD7, 0x00, 0x0B, 0xB6, 0x01, 0x15, 0x00, 0x01, 0x01, 0x82, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0xA9, 0xFE, 0x56, 0x05, 0x05, 0x05, 0xB0, 0x04, 0x26, 0x00, 0x2F, 0x00, 0x00,
-	0x01, 0x07, 0x01, 0xD4, 0x01, 0x94, 0xFE, 0xF8, 0x00, 0x0E, 0xB4, 0x03, 0x17, 0x02, 0x01, 0x00,
-	0xB8, 0xFF, 0xE7, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x8D, 0xFE, 0x43, 0x04, 0x0D,
-	0x06, 0x00, 0x06, 0x26, 0x00, 0x4F, 0x00, 0x00, 0x01, 0x07, 0x01, 0xD4, 0x01, 0x11, 0xFE, 0xE5,
-	0x00, 0x0E, 0xB4, 0x03, 0x17, 0x02, 0x01, 0x01, 0xB8, 0xFF, 0xD4, 0xB0, 0x56, 0x00, 0x2B, 0x34,
-	0xFF, 0xFF, 0x00, 0xA2, 0x00, 0x00, 0x04, 0x1C, 0x07, 0x32, 0x06, 0x26, 0x00, 0x30, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x75, 0x00, 0x27, 0x01, 0x32, 0x00, 0x0B, 0xB6, 0x02, 0x08, 0x07, 0x01, 0x01,
-	0x5C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x93, 0x00, 0x00, 0x02, 0x34, 0x07, 0x97,
-	0x06, 0x26, 0x00, 0x50, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x00, 0x18, 0x01, 0x97, 0x00, 0x0B,
-	0xB6, 0x01, 0x04, 0x03, 0x01, 0x01, 0x71, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9,
-	0xFE, 0x06, 0x04, 0x1C, 0x05, 0xB0, 0x04, 0x26, 0x00, 0x30, 0x00, 0x00, 0x01, 0x07, 0x01, 0xD4,
-	0x01, 0x6C, 0xFE, 0xA8, 0x00, 0x0E, 0xB4, 0x02, 0x11, 0x02, 0x01, 0x01, 0xB8, 0xFF, 0x97, 0xB0,
-	0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x56, 0xFE, 0x06, 0x01, 0x56, 0x06, 0x00, 0x04, 0x26,
-	0x00, 0x50, 0x00, 0x00, 0x01, 0x07, 0x01, 0xD4, 0xFF, 0xF9, 0xFE, 0xA8, 0x00, 0x0E, 0xB4, 0x01,
-	0x0D, 0x02, 0x01, 0x01, 0xB8, 0xFF, 0x97, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0xA9,
-	0x00, 0x00, 0x04, 0x1C, 0x05, 0xB1, 0x06, 0x26, 0x00, 0x30, 0x00, 0x00, 0x01, 0x07, 0x01, 0xD4,
-	0x01, 0xD6, 0x04, 0xC2, 0x00, 0x0B, 0xB6, 0x02, 0x11, 0x07, 0x00, 0x00, 0x01, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x9C, 0x00, 0x00, 0x02, 0xAD, 0x06, 0x02, 0x04, 0x26, 0x00, 0x50,
-	0x00, 0x00, 0x01, 0x07, 0x01, 0xD4, 0x01, 0x56, 0x05, 0x13, 0x00, 0x0B, 0xB6, 0x01, 0x0D, 0x03,
-	0x00, 0x00, 0x02, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00, 0x04, 0x1C,
-	0x05, 0xB0, 0x06, 0x26, 0x00, 0x30, 0x00, 0x00, 0x00, 0x07, 0x00, 0xA2, 0x01, 0xBC, 0xFD, 0xC4,
-	0xFF, 0xFF, 0x00, 0x9C, 0x00, 0x00, 0x02, 0xA2, 0x06, 0x00, 0x04, 0x26, 0x00, 0x50, 0x00, 0x00,
-	0x00, 0x07, 0x00, 0xA2, 0x01, 0x39, 0xFD, 0xB5, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00, 0x05, 0x09,
-	0x07, 0x37, 0x06, 0x26, 0x00, 0x32, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0xF5, 0x01, 0x37,
-	0x00, 0x0B, 0xB6, 0x01, 0x0A, 0x06, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x8D, 0x00, 0x00, 0x03, 0xE0, 0x06, 0x00, 0x06, 0x26, 0x00, 0x52, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x75, 0x01, 0x5C, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x1C, 0x03, 0x01, 0x01, 0xA0, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0xFE, 0x06, 0x05, 0x09, 0x05, 0xB0, 0x04, 0x26,
-	0x00, 0x32, 0x00, 0x00, 0x01, 0x07, 0x01, 0xD4, 0x01, 0xD0, 0xFE, 0xA8, 0x00, 0x0E, 0xB4, 0x01,
-	0x13, 0x05, 0x01, 0x01, 0xB8, 0xFF, 0x97, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x8D,
-	0xFE, 0x06, 0x03, 0xE0, 0x04, 0x4E, 0x04, 0x26, 0x00, 0x52, 0x00, 0x00, 0x01, 0x07, 0x01, 0xD4,
-	0x01, 0x33, 0xFE, 0xA8, 0x00, 0x0E, 0xB4, 0x02, 0x25, 0x02, 0x01, 0x01, 0xB8, 0xFF, 0x97, 0xB0,
-	0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00, 0x05, 0x09, 0x07, 0x36, 0x06, 0x26,
-	0x00, 0x32, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9F, 0x01, 0x14, 0x01, 0x37, 0x00, 0x0B, 0xB6, 0x01,
-	0x10, 0x09, 0x01, 0x01, 0x6A, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8D, 0x00, 0x00,
-	0x03, 0xE0, 0x05, 0xFF, 0x06, 0x26, 0x00, 0x52, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9F, 0x7B, 0x00,
-	0x00, 0x0B, 0xB6, 0x02, 0x22, 0x03, 0x01, 0x01, 0xA9, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0xFF, 0xBB, 0x00, 0x00, 0x03, 0xE0, 0x06, 0x05, 0x06, 0x26, 0x00, 0x52, 0x00, 0x00, 0x01, 0x07,
-	0x01, 0xD4, 0xFF, 0x5E, 0x05, 0x16, 0x00, 0x0B, 0xB6, 0x02, 0x20, 0x03, 0x01, 0x01, 0x3A, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x77, 0xFF, 0xEC, 0x05, 0x0A, 0x06, 0xE6, 0x06, 0x26,
-	0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0x00, 0xEA, 0x01, 0x41, 0x00, 0x0B, 0xB6, 0x02,
-	0x2E, 0x11, 0x01, 0x01, 0x94, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5C, 0xFF, 0xEC,
-	0x04, 0x35, 0x05, 0xAD, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x06, 0x00, 0x70, 0x66, 0x08,
-	0x00, 0x0B, 0xB6, 0x02, 0x2E, 0x06, 0x01, 0x01, 0xD1, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x77, 0xFF, 0xEC, 0x05, 0x0A, 0x07, 0x10, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0xA1, 0x01, 0x16, 0x01, 0x39, 0x00, 0x0B, 0xB6, 0x02, 0x31, 0x11, 0x01, 0x01, 0x41, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5C, 0xFF, 0xEC, 0x04, 0x35, 0x05, 0xD7, 0x06, 0x26,
-	0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA1, 0x00, 0x92, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02,
-	0x31, 0x06, 0x01, 0x01, 0x7E, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x77, 0xFF, 0xEC,
-	0x05, 0x0A, 0x07, 0x38, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA6, 0x01, 0x6B,
-	0x01, 0x39, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x2C, 0x11, 0x01, 0x01, 0x45, 0x56, 0x00, 0x2B, 0x34,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5C, 0xFF, 0xEC, 0x04, 0x35, 0x05, 0xFF, 0x06, 0x26, 0x00, 0x53,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0xA6, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x2C,
-	0x06, 0x01, 0x01, 0x82, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00,
-	0x04, 0xCA, 0x07, 0x37, 0x06, 0x26, 0x00, 0x36, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x81,
-	0x01, 0x37, 0x00, 0x0B, 0xB6, 0x02, 0x1E, 0x00, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x8D, 0x00, 0x00, 0x02, 0xD3, 0x06, 0x00, 0x06, 0x26, 0x00, 0x56, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x75, 0x00, 0xB7, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x17, 0x03, 0x01, 0x01,
-	0xA0, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0xFE, 0x06, 0x04, 0xCA, 0x05, 0xB0,
-	0x04, 0x26, 0x00, 0x36, 0x00, 0x00, 0x01, 0x07, 0x01, 0xD4, 0x01, 0x63, 0xFE, 0xA8, 0x00, 0x0E,
-	0xB4, 0x02, 0x27, 0x18, 0x01, 0x01, 0xB8, 0xFF, 0x97, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF,
-	0x00, 0x53, 0xFE, 0x07, 0x02, 0x98, 0x04, 0x4E, 0x04, 0x26, 0x00, 0x56, 0x00, 0x00, 0x01, 0x07,
-	0x01, 0xD4, 0xFF, 0xF6, 0xFE, 0xA9, 0x00, 0x0E, 0xB4, 0x02, 0x20, 0x02, 0x01, 0x01, 0xB8, 0xFF,
-	0x98, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00, 0x04, 0xCA, 0x07, 0x36,
-	0x06, 0x26, 0x00, 0x36, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9F, 0x00, 0xA0, 0x01, 0x37, 0x00, 0x0B,
-	0xB6, 0x02, 0x24, 0x00, 0x01, 0x01, 0x6A, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x64,
-	0x00, 0x00, 0x02, 0xCE, 0x05, 0xFF, 0x06, 0x26, 0x00, 0x56, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9F,
-	0xD6, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x1D, 0x03, 0x01, 0x01, 0xA9, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x51, 0xFF, 0xEC, 0x04, 0x73, 0x07, 0x39, 0x06, 0x26, 0x00, 0x37, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x75, 0x01, 0x8D, 0x01, 0x39, 0x00, 0x0B, 0xB6, 0x01, 0x3A, 0x0F, 0x01, 0x01,
-	0x4F, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5F, 0xFF, 0xEC, 0x03, 0xBC, 0x06, 0x00,
-	0x06, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x51, 0x00, 0x00, 0x00, 0x0B,
-	0xB6, 0x01, 0x36, 0x0E, 0x01, 0x01, 0x8C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x51,
-	0xFF, 0xEC, 0x04, 0x73, 0x07, 0x39, 0x06, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9E,
-	0x00, 0x97, 0x01, 0x39, 0x00, 0x0B, 0xB6, 0x01, 0x3D, 0x0F, 0x01, 0x01, 0x5A, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5F, 0xFF, 0xEC, 0x03, 0xBC, 0x06, 0x00, 0x06, 0x26, 0x00, 0x57,
-	0x00, 0x00, 0x01, 0x06, 0x00, 0x9E, 0x5B, 0x00, 0x00, 0x0B, 0xB6, 0x01, 0x39, 0x0E, 0x01, 0x01,
-	0x97, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x51, 0xFE, 0x4C, 0x04, 0x73, 0x05, 0xC4,
-	0x06, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0x79, 0x01, 0x9F, 0xFF, 0xFF, 0x00, 0x0B,
-	0xB6, 0x01, 0x3A, 0x2B, 0x00, 0x00, 0x13, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5F,
-	0xFE, 0x43, 0x03, 0xBC, 0x04, 0x4E, 0x06, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x07, 0x00, 0x79,
-	0x01, 0x5D, 0xFF, 0xF6, 0x00, 0x0B, 0xB6, 0x01, 0x36, 0x29, 0x00, 0x00, 0x0A, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x51, 0xFD, 0xFB, 0x04, 0x73, 0x05, 0xC4, 0x06, 0x26, 0x00, 0x37,
-	0x00, 0x00, 0x01, 0x07, 0x01, 0xD4, 0x01, 0x74, 0xFE, 0x9D, 0x00, 0x0E, 0xB4, 0x01, 0x43, 0x2B,
-	0x01, 0x01, 0xB8, 0xFF, 0xA0, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x5F, 0xFD, 0xF2,
-	0x03, 0xBC, 0x04, 0x4E, 0x06, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x07, 0x01, 0xD4, 0x01, 0x32,
-	0xFE, 0x94, 0x00, 0x0E, 0xB4, 0x01, 0x3F, 0x29, 0x01, 0x01, 0xB8, 0xFF, 0x97, 0xB0, 0x56, 0x00,
-	0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x51, 0xFF, 0xEC, 0x04, 0x73, 0x07, 0x38, 0x06, 0x26, 0x00, 0x37,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x9F, 0x00, 0xAC, 0x01, 0x39, 0x00, 0x0B, 0xB6, 0x01, 0x40, 0x0F,
-	0x01, 0x01, 0x58, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5F, 0xFF, 0xEC, 0x03, 0xBC,
-	0x05, 0xFF, 0x06, 0x26, 0x00, 0x57, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9F, 0x70, 0x00, 0x00, 0x0B,
-	0xB6, 0x01, 0x3C, 0x0E, 0x01, 0x01, 0x95, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x32,
-	0xFD, 0xFC, 0x04, 0x97, 0x05, 0xB0, 0x06, 0x26, 0x00, 0x38, 0x00, 0x00, 0x01, 0x07, 0x01, 0xD4,
-	0x01, 0x66, 0xFE, 0x9E, 0x00, 0x0E, 0xB4, 0x02, 0x11, 0x02, 0x01, 0x01, 0xB8, 0xFF, 0x8D, 0xB0,
-	0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x09, 0xFD, 0xFC, 0x02, 0x57, 0x05, 0x41, 0x06, 0x26,
-	0x00, 0x58, 0x00, 0x00, 0x01, 0x07, 0x01, 0xD4, 0x00, 0xC5, 0xFE, 0x9E, 0x00, 0x0E, 0xB4, 0x02,
-	0x1F, 0x11, 0x01, 0x01, 0xB8, 0xFF, 0xA1, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x32,
-	0xFE, 0x4D, 0x04, 0x97, 0x05, 0xB0, 0x06, 0x26, 0x00, 0x38, 0x00, 0x00, 0x01, 0x07, 0x00, 0x79,
-	0x01, 0x91, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x08, 0x02, 0x01, 0x00, 0x00, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x09, 0xFE, 0x4D, 0x02, 0x9A, 0x05, 0x41, 0x06, 0x26, 0x00, 0x58,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x79, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x16, 0x11,
-	0x00, 0x00, 0x14, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x32, 0x00, 0x00, 0x04, 0x97,
-	0x07, 0x35, 0x06, 0x26, 0x00, 0x38, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9F, 0x00, 0xA2, 0x01, 0x36,
-	0x00, 0x0B, 0xB6, 0x02, 0x0E, 0x03, 0x01, 0x01, 0x69, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x09, 0xFF, 0xEC, 0x02, 0xEC, 0x06, 0x7A, 0x04, 0x26, 0x00, 0x58, 0x00, 0x00, 0x01, 0x07,
-	0x01, 0xD4, 0x01, 0x95, 0x05, 0x8B, 0x00, 0x0E, 0xB4, 0x02, 0x1A, 0x04, 0x01, 0x00, 0xB8, 0xFF,
-	0xA8, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x8C, 0xFF, 0xEC, 0x04, 0xAA, 0x07, 0x23,
-	0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA5, 0x00, 0xBF, 0x01, 0x3B, 0x00, 0x0B,
-	0xB6, 0x01, 0x24, 0x0B, 0x01, 0x01, 0x6B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x89,
-	0xFF, 0xEC, 0x03, 0xDD, 0x05, 0xEC, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x06, 0x00, 0xA5,
-	0x5B, 0x04, 0x00, 0x0B, 0xB6, 0x02, 0x2A, 0x11, 0x01, 0x01, 0xAA, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x8C, 0xFF, 0xEC, 0x04, 0xAA, 0x06, 0xE4, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x70, 0x00, 0xC2, 0x01, 0x3F, 0x00, 0x0B, 0xB6, 0x01, 0x18, 0x0B, 0x01, 0x01,
-	0xA6, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x89, 0xFF, 0xEC, 0x03, 0xDD, 0x05, 0xAD,
-	0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x06, 0x00, 0x70, 0x5E, 0x08, 0x00, 0x0B, 0xB6, 0x02,
-	0x1E, 0x11, 0x01, 0x01, 0xE5, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8C, 0xFF, 0xEC,
-	0x04, 0xAA, 0x07, 0x0E, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA1, 0x00, 0xEE,
-	0x01, 0x37, 0x00, 0x0B, 0xB6, 0x01, 0x1B, 0x00, 0x01, 0x01, 0x53, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x89, 0xFF, 0xEC, 0x03, 0xDD, 0x05, 0xD7, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0xA1, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x21, 0x11, 0x01, 0x01,
-	0x92, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8C, 0xFF, 0xEC, 0x04, 0xAA, 0x07, 0x93,
-	0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA3, 0x01, 0x4B, 0x01, 0x42, 0x00, 0x0D,
-	0xB7, 0x02, 0x01, 0x21, 0x00, 0x01, 0x01, 0x47, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x89, 0xFF, 0xEC, 0x03, 0xDD, 0x06, 0x5C, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0xA3, 0x00, 0xE7, 0x00, 0x0B, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x27, 0x11, 0x01, 0x01, 0x86,
-	0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8C, 0xFF, 0xEC, 0x04, 0xAA, 0x07, 0x36,
-	0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA6, 0x01, 0x43, 0x01, 0x37, 0x00, 0x0D,
-	0xB7, 0x02, 0x01, 0x16, 0x00, 0x01, 0x01, 0x57, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x89, 0xFF, 0xEC, 0x04, 0x0B, 0x05, 0xFF, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0xA6, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x1C, 0x11, 0x01, 0x01, 0x96,
-	0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0x00, 0x02, 0x00, 0x8C, 0xFE, 0x7A, 0x04, 0xAA, 0x05, 0xB0,
-	0x00, 0x15, 0x00, 0x2B, 0x00, 0x1B, 0x40, 0x0D, 0x1E, 0x25, 0x01, 0x0B, 0x02, 0x72, 0x17, 0x16,
-	0x11, 0x11, 0x06, 0x09, 0x72, 0x00, 0x2B, 0x32, 0x12, 0x39, 0x39, 0x2B, 0x32, 0x2F, 0x33, 0x30,
-	0x31, 0x41, 0x33, 0x11, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14,
-	0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x03, 0x17, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32,
-	0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x03, 0xEA, 0xC0, 0x92,
-	0xF1, 0x8D, 0x94, 0xEF, 0x8B, 0xBF, 0x54, 0x97, 0x64, 0x65, 0x97, 0x54, 0x87, 0x4A, 0x2B, 0x4E,
-	0x32, 0x23, 0x2B, 0x21, 0x34, 0x0F, 0x0E, 0x19, 0x4D, 0x3B, 0x51, 0x6F, 0x35, 0x72, 0x05, 0xB0,
-	0xFC, 0x27, 0xA4, 0xDA, 0x6D, 0x6D, 0xDA, 0xA4, 0x03, 0xD9, 0xFC, 0x27, 0x72, 0x94, 0x48, 0x48,
-	0x94, 0x72, 0xFE, 0x8E, 0x39, 0x20, 0x45, 0x4D, 0x2C, 0x21, 0x28, 0x13, 0x08, 0x7A, 0x0F, 0x1D,
-	0x61, 0x5E, 0x36, 0x6A, 0x62, 0x00, 0x00, 0x03, 0x00, 0x89, 0xFE, 0x4E, 0x03, 0xE8, 0x04, 0x3A,
-	0x00, 0x04, 0x00, 0x1B, 0x00, 0x31, 0x00, 0x21, 0x40, 0x11, 0x24, 0x2B, 0x0F, 0x72, 0x01, 0x11,
-	0x06, 0x72, 0x1C, 0x1D, 0x1D, 0x04, 0x04, 0x18, 0x0B, 0x0B, 0x72, 0x00, 0x2B, 0x32, 0x32, 0x11,
-	0x33, 0x11, 0x33, 0x2B, 0x32, 0x2B, 0x32, 0x30, 0x31, 0x65, 0x11, 0x33, 0x11, 0x23, 0x13, 0x37,
-	0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x11, 0x33, 0x11, 0x14, 0x1E, 0x02, 0x33, 0x32,
-	0x36, 0x36, 0x13, 0x17, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06,
-	0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x03, 0x23, 0xBA, 0xB1, 0x1A, 0x4D, 0x2D, 0x64, 0xA2,
-	0x74, 0x4F, 0x83, 0x5E, 0x33, 0xB9, 0x21, 0x39, 0x47, 0x26, 0x76, 0x8A, 0x3D, 0x43, 0x4A, 0x2B,
-	0x4E, 0x32, 0x23, 0x2B, 0x21, 0x34, 0x0F, 0x0E, 0x19, 0x4D, 0x3B, 0x51, 0x6F, 0x35, 0x72, 0xFA,
-	0x03, 0x40, 0xFB, 0xC6, 0x01, 0xDE, 0x02, 0x6C, 0xB7, 0x86, 0x4B, 0x2E, 0x60, 0x9A, 0x6C, 0x02,
-	0xBA, 0xFD, 0x44, 0x49, 0x5F, 0x37, 0x16, 0x5B, 0x9B, 0xFE, 0xBA, 0x39, 0x20, 0x45, 0x4D, 0x2C,
-	0x21, 0x28, 0x13, 0x08, 0x7A, 0x0F, 0x1D, 0x61, 0x5E, 0x36, 0x6A, 0x62, 0xFF, 0xFF, 0x00, 0x3D,
-	0x00, 0x00, 0x06, 0xED, 0x07, 0x37, 0x06, 0x26, 0x00, 0x3B, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9E,
-	0x01, 0xC5, 0x01, 0x37, 0x00, 0x0B, 0xB6, 0x04, 0x19, 0x15, 0x01, 0x01, 0x6C, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x2B, 0x00, 0x00, 0x05, 0xD3, 0x06, 0x00, 0x06, 0x26, 0x00, 0x5B,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x9E, 0x01, 0x24, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x04, 0x19, 0x15,
-	0x01, 0x01, 0xAB, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x04, 0xBC,
-	0x07, 0x36, 0x06, 0x26, 0x00, 0x3D, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9E, 0x00, 0x93, 0x01, 0x36,
-	0x00, 0x0B, 0xB6, 0x01, 0x0C, 0x02, 0x01, 0x01, 0x6B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x16, 0xFE, 0x4B, 0x03, 0xB0, 0x06, 0x00, 0x06, 0x26, 0x00, 0x5D, 0x00, 0x00, 0x01, 0x06,
-	0x00, 0x9E, 0x25, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x1C, 0x01, 0x01, 0x01, 0xAB, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x04, 0xBC, 0x06, 0xFC, 0x06, 0x26, 0x00, 0x3D,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x00, 0xC3, 0x01, 0x36, 0x00, 0x0D, 0xB7, 0x02, 0x01, 0x1E,
-	0x02, 0x01, 0x01, 0x77, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x57, 0x00, 0x00,
-	0x04, 0x7A, 0x07, 0x37, 0x06, 0x26, 0x00, 0x3E, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x87,
-	0x01, 0x37, 0x00, 0x0B, 0xB6, 0x03, 0x0E, 0x0D, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x59, 0x00, 0x00, 0x03, 0xB3, 0x06, 0x00, 0x06, 0x26, 0x00, 0x5E, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x75, 0x01, 0x22, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x03, 0x0E, 0x0D, 0x01, 0x01,
-	0xA0, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x57, 0x00, 0x00, 0x04, 0x7A, 0x06, 0xF9,
-	0x06, 0x26, 0x00, 0x3E, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA2, 0x01, 0x6D, 0x01, 0x37, 0x00, 0x0B,
-	0xB6, 0x03, 0x17, 0x08, 0x01, 0x01, 0x76, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x59,
-	0x00, 0x00, 0x03, 0xB3, 0x05, 0xC2, 0x06, 0x26, 0x00, 0x5E, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA2,
-	0x01, 0x08, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x03, 0x17, 0x08, 0x01, 0x01, 0xB5, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x57, 0x00, 0x00, 0x04, 0x7A, 0x07, 0x36, 0x06, 0x26, 0x00, 0x3E,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x9F, 0x00, 0xA6, 0x01, 0x37, 0x00, 0x0B, 0xB6, 0x03, 0x14, 0x08,
-	0x01, 0x01, 0x6A, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x59, 0x00, 0x00, 0x03, 0xB3,
-	0x05, 0xFF, 0x06, 0x26, 0x00, 0x5E, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9F, 0x41, 0x00, 0x00, 0x0B,
-	0xB6, 0x03, 0x14, 0x08, 0x01, 0x01, 0xA9, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xF1,
-	0x00, 0x00, 0x07, 0x58, 0x07, 0x42, 0x06, 0x26, 0x00, 0x81, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75,
-	0x02, 0xCA, 0x01, 0x42, 0x00, 0x0B, 0xB6, 0x06, 0x19, 0x03, 0x01, 0x01, 0x6C, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x4F, 0xFF, 0xEB, 0x06, 0x7D, 0x06, 0x01, 0x06, 0x26, 0x00, 0x86,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x02, 0x7A, 0x00, 0x01, 0x00, 0x0B, 0xB6, 0x03, 0x5F, 0x0F,
-	0x01, 0x01, 0x8D, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x77, 0xFF, 0xA3, 0x05, 0x1D,
-	0x07, 0x80, 0x06, 0x26, 0x00, 0x83, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0xEA, 0x01, 0x80,
-	0x00, 0x0B, 0xB6, 0x03, 0x34, 0x16, 0x01, 0x01, 0x96, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x5C, 0xFF, 0x79, 0x04, 0x34, 0x05, 0xFF, 0x06, 0x26, 0x00, 0x89, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x75, 0x01, 0x38, 0xFF, 0xFF, 0x00, 0x0B, 0xB6, 0x03, 0x30, 0x0A, 0x01, 0x01, 0x8B, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xBD, 0x00, 0x00, 0x04, 0x20, 0x04, 0x8D, 0x06, 0x26,
-	0x02, 0x4A, 0x00, 0x00, 0x00, 0x07, 0x02, 0x40, 0xFF, 0x2E, 0xFF, 0x76, 0xFF, 0xFF, 0xFF, 0xBD,
-	0x00, 0x00, 0x04, 0x20, 0x04, 0x8D, 0x06, 0x26, 0x02, 0x4A, 0x00, 0x00, 0x00, 0x07, 0x02, 0x40,
-	0xFF, 0x2E, 0xFF, 0x76, 0xFF, 0xFF, 0x00, 0x29, 0x00, 0x00, 0x03, 0xFD, 0x04, 0x8D, 0x06, 0x26,
-	0x01, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x02, 0x40, 0x46, 0xDF, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00,
-	0x04, 0x71, 0x06, 0x1E, 0x06, 0x26, 0x02, 0x4D, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xD4,
-	0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x03, 0x10, 0x07, 0x01, 0x01, 0x6B, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x04, 0x71, 0x06, 0x1E, 0x06, 0x26, 0x02, 0x4D, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x75, 0x01, 0x64, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x03, 0x0E, 0x03, 0x01, 0x01,
-	0x6B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x04, 0x71, 0x06, 0x1E,
-	0x06, 0x26, 0x02, 0x4D, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9E, 0x6E, 0x1E, 0x00, 0x0B, 0xB6, 0x03,
-	0x13, 0x03, 0x01, 0x01, 0x6B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00,
-	0x04, 0x71, 0x06, 0x0A, 0x06, 0x26, 0x02, 0x4D, 0x00, 0x00, 0x01, 0x06, 0x00, 0xA5, 0x69, 0x22,
-	0x00, 0x0B, 0xB6, 0x03, 0x1B, 0x03, 0x01, 0x01, 0x6B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x14, 0x00, 0x00, 0x04, 0x71, 0x05, 0xE4, 0x06, 0x26, 0x02, 0x4D, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x6A, 0x00, 0x9E, 0x00, 0x1E, 0x00, 0x0D, 0xB7, 0x04, 0x03, 0x17, 0x03, 0x01, 0x01, 0x6B,
-	0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x04, 0x71, 0x06, 0x7A,
-	0x06, 0x26, 0x02, 0x4D, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA3, 0x00, 0xF5, 0x00, 0x29, 0x00, 0x0D,
-	0xB7, 0x04, 0x03, 0x19, 0x03, 0x01, 0x01, 0x51, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x14, 0x00, 0x00, 0x04, 0x71, 0x06, 0x7B, 0x06, 0x26, 0x02, 0x4D, 0x00, 0x00, 0x00, 0x07,
-	0x02, 0x41, 0x00, 0xFE, 0x00, 0x09, 0xFF, 0xFF, 0x00, 0x61, 0xFE, 0x49, 0x04, 0x31, 0x04, 0x9D,
-	0x06, 0x26, 0x02, 0x4B, 0x00, 0x00, 0x00, 0x07, 0x00, 0x79, 0x01, 0x75, 0xFF, 0xFC, 0xFF, 0xFF,
-	0x00, 0x8B, 0x00, 0x00, 0x03, 0xAF, 0x06, 0x1E, 0x06, 0x26, 0x02, 0x42, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x44, 0x00, 0xA8, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x04, 0x12, 0x07, 0x01, 0x01, 0x6C, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00, 0x03, 0xAF, 0x06, 0x1E, 0x06, 0x26,
-	0x02, 0x42, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x38, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x04,
-	0x10, 0x07, 0x01, 0x01, 0x6C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00,
-	0x03, 0xAF, 0x06, 0x1E, 0x06, 0x26, 0x02, 0x42, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9E, 0x42, 0x1E,
-	0x00, 0x0B, 0xB6, 0x04, 0x16, 0x07, 0x01, 0x01, 0x6C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x8B, 0x00, 0x00, 0x03, 0xAF, 0x05, 0xE4, 0x06, 0x26, 0x02, 0x42, 0x00, 0x00, 0x01, 0x06,
-	0x00, 0x6A, 0x72, 0x1E, 0x00, 0x0D, 0xB7, 0x05, 0x04, 0x19, 0x07, 0x01, 0x01, 0x84, 0x56, 0x00,
-	0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xBC, 0x00, 0x00, 0x01, 0x5D, 0x06, 0x1E, 0x06, 0x26,
-	0x01, 0xFD, 0x00, 0x00, 0x01, 0x06, 0x00, 0x44, 0x83, 0x1E, 0x00, 0x0B, 0xB6, 0x01, 0x06, 0x03,
-	0x01, 0x01, 0x6B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8E, 0x00, 0x00, 0x02, 0x2F,
-	0x06, 0x1E, 0x06, 0x26, 0x01, 0xFD, 0x00, 0x00, 0x01, 0x06, 0x00, 0x75, 0x13, 0x1E, 0x00, 0x0B,
-	0xB6, 0x01, 0x04, 0x03, 0x01, 0x01, 0x6B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xC7,
-	0x00, 0x00, 0x02, 0x24, 0x06, 0x1E, 0x06, 0x26, 0x01, 0xFD, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9E,
-	0xFF, 0x1D, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x01, 0x09, 0x03, 0x01, 0x01, 0x76, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x02, 0x3C, 0x05, 0xE4, 0x06, 0x26, 0x01, 0xFD,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0xFF, 0x4D, 0x00, 0x1E, 0x00, 0x0D, 0xB7, 0x02, 0x01, 0x0D,
-	0x03, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00,
-	0x04, 0x59, 0x06, 0x0A, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA5, 0x00, 0x94,
-	0x00, 0x22, 0x00, 0x0B, 0xB6, 0x01, 0x18, 0x06, 0x01, 0x01, 0x76, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x60, 0xFF, 0xF0, 0x04, 0x5B, 0x06, 0x1E, 0x06, 0x26, 0x01, 0xF7, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x44, 0x00, 0xED, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x02, 0x2E, 0x11, 0x01, 0x01,
-	0x5B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x60, 0xFF, 0xF0, 0x04, 0x5B, 0x06, 0x1E,
-	0x06, 0x26, 0x01, 0xF7, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x7D, 0x00, 0x1E, 0x00, 0x0B,
-	0xB6, 0x02, 0x2C, 0x11, 0x01, 0x01, 0x5B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x60,
-	0xFF, 0xF0, 0x04, 0x5B, 0x06, 0x1E, 0x06, 0x26, 0x01, 0xF7, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9E,
-	0x00, 0x87, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x02, 0x31, 0x11, 0x01, 0x01, 0x5B, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x60, 0xFF, 0xF0, 0x04, 0x5B, 0x06, 0x0A, 0x06, 0x26, 0x01, 0xF7,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0xA5, 0x00, 0x82, 0x00, 0x22, 0x00, 0x0B, 0xB6, 0x02, 0x31, 0x11,
-	0x01, 0x01, 0x6F, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x60, 0xFF, 0xF0, 0x04, 0x5B,
-	0x05, 0xE4, 0x06, 0x26, 0x01, 0xF7, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x00, 0xB7, 0x00, 0x1E,
-	0x00, 0x0D, 0xB7, 0x03, 0x02, 0x35, 0x11, 0x01, 0x01, 0x74, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x75, 0xFF, 0xF0, 0x04, 0x0B, 0x06, 0x1E, 0x06, 0x26, 0x01, 0xF1, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x44, 0x00, 0xCF, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x01, 0x18, 0x0B, 0x01, 0x01,
-	0x6B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x75, 0xFF, 0xF0, 0x04, 0x0B, 0x06, 0x1E,
-	0x06, 0x26, 0x01, 0xF1, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x5F, 0x00, 0x1E, 0x00, 0x0B,
-	0xB6, 0x01, 0x16, 0x0B, 0x01, 0x01, 0x6B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x75,
-	0xFF, 0xF0, 0x04, 0x0B, 0x06, 0x1E, 0x06, 0x26, 0x01, 0xF1, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9E,
-	0x69, 0x1E, 0x00, 0x0B, 0xB6, 0x01, 0x1B, 0x0B, 0x01, 0x01, 0x6B, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x75, 0xFF, 0xF0, 0x04, 0x0B, 0x05, 0xE4, 0x06, 0x26, 0x01, 0xF1, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x6A, 0x00, 0x99, 0x00, 0x1E, 0x00, 0x0D, 0xB7, 0x02, 0x01, 0x1F, 0x0B, 0x01,
-	0x01, 0x84, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x0E, 0x00, 0x00, 0x04, 0x1C,
-	0x06, 0x1E, 0x06, 0x26, 0x01, 0xED, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x34, 0x00, 0x1E,
-	0x00, 0x0B, 0xB6, 0x03, 0x0E, 0x09, 0x01, 0x01, 0x6B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x14, 0x00, 0x00, 0x04, 0x71, 0x05, 0xCB, 0x06, 0x26, 0x02, 0x4D, 0x00, 0x00, 0x01, 0x06,
-	0x00, 0x70, 0x6C, 0x26, 0x00, 0x0B, 0xB6, 0x03, 0x10, 0x03, 0x01, 0x01, 0xB0, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x04, 0x71, 0x05, 0xF5, 0x06, 0x26, 0x02, 0x4D,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0xA1, 0x00, 0x98, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x03, 0x13, 0x03,
-	0x01, 0x01, 0x5D, 0x56, 0x00, 0x2B, 0x34, 0x00, 0x00, 0x04, 0x00, 0x14, 0xFE, 0x4E, 0x04, 0x71,
-	0x04, 0x8D, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x23, 0x00, 0x21, 0x40, 0x0F, 0x0D, 0x0C,
-	0x0C, 0x03, 0x16, 0x1D, 0x08, 0x03, 0x7D, 0x0F, 0x0E, 0x05, 0x05, 0x01, 0x12, 0x00, 0x3F, 0x33,
-	0x11, 0x33, 0x33, 0x3F, 0x33, 0x2F, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x01, 0x23,
-	0x01, 0x33, 0x01, 0x01, 0x27, 0x33, 0x01, 0x03, 0x15, 0x21, 0x35, 0x01, 0x17, 0x0E, 0x02, 0x15,
-	0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36,
-	0x02, 0x5E, 0xFE, 0x73, 0xBD, 0x01, 0xDF, 0x79, 0x01, 0x49, 0xFE, 0x76, 0x0D, 0x7A, 0x01, 0xD9,
-	0xD7, 0xFD, 0x4C, 0x03, 0x1A, 0x4A, 0x2B, 0x4E, 0x32, 0x23, 0x2B, 0x21, 0x34, 0x0F, 0x0E, 0x19,
-	0x4D, 0x3B, 0x51, 0x6F, 0x35, 0x72, 0x03, 0xEA, 0xFC, 0x16, 0x04, 0x8D, 0xFB, 0x73, 0x03, 0xEE,
-	0x9F, 0xFB, 0x73, 0x01, 0xAF, 0x98, 0x98, 0xFE, 0x8A, 0x39, 0x20, 0x45, 0x4D, 0x2C, 0x21, 0x28,
-	0x13, 0x08, 0x7A, 0x0F, 0x1D, 0x61, 0x5E, 0x36, 0x6A, 0x62, 0xFF, 0xFF, 0x00, 0x61, 0xFF, 0xF0,
-	0x04, 0x31, 0x06, 0x1E, 0x06, 0x26, 0x02, 0x4B, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x6A,
-	0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x01, 0x28, 0x10, 0x01, 0x01, 0x5B, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x61, 0xFF, 0xF0, 0x04, 0x31, 0x06, 0x1E, 0x06, 0x26, 0x02, 0x4B, 0x00, 0x00,
-	0x01, 0x06, 0x00, 0x9E, 0x74, 0x1E, 0x00, 0x0B, 0xB6, 0x01, 0x2D, 0x10, 0x01, 0x01, 0x5B, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x61, 0xFF, 0xF0, 0x04, 0x31, 0x05, 0xE0, 0x06, 0x26,
-	0x02, 0x4B, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA2, 0x01, 0x50, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x01,
-	0x31, 0x10, 0x01, 0x01, 0x70, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x61, 0xFF, 0xF0,
-	0x04, 0x31, 0x06, 0x1D, 0x06, 0x26, 0x02, 0x4B, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9F, 0x00, 0x89,
-	0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x01, 0x2E, 0x10, 0x01, 0x01, 0x64, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00, 0x04, 0x20, 0x06, 0x1D, 0x06, 0x26, 0x02, 0x4A, 0x00, 0x00,
-	0x01, 0x06, 0x00, 0x9F, 0x32, 0x1E, 0x00, 0x0B, 0xB6, 0x02, 0x24, 0x1D, 0x01, 0x01, 0x74, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00, 0x03, 0xAF, 0x05, 0xCB, 0x06, 0x26,
-	0x02, 0x42, 0x00, 0x00, 0x01, 0x06, 0x00, 0x70, 0x40, 0x26, 0x00, 0x0B, 0xB6, 0x04, 0x12, 0x07,
-	0x01, 0x01, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00, 0x03, 0xAF,
-	0x05, 0xF5, 0x06, 0x26, 0x02, 0x42, 0x00, 0x00, 0x01, 0x06, 0x00, 0xA1, 0x6C, 0x1E, 0x00, 0x0B,
-	0xB6, 0x04, 0x15, 0x07, 0x01, 0x01, 0x5E, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8B,
-	0x00, 0x00, 0x03, 0xAF, 0x05, 0xE0, 0x06, 0x26, 0x02, 0x42, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA2,
-	0x01, 0x1E, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x04, 0x19, 0x07, 0x01, 0x01, 0x80, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0x00, 0x05, 0x00, 0x8B, 0xFE, 0x4E, 0x03, 0xAF, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x07,
-	0x00, 0x0B, 0x00, 0x0F, 0x00, 0x25, 0x00, 0x23, 0x40, 0x10, 0x18, 0x1F, 0x0B, 0x0A, 0x0A, 0x06,
-	0x0F, 0x0E, 0x07, 0x7D, 0x11, 0x10, 0x10, 0x05, 0x06, 0x12, 0x00, 0x3F, 0x33, 0x33, 0x11, 0x33,
-	0x3F, 0x33, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x2F, 0x33, 0x30, 0x31, 0x65, 0x15, 0x21, 0x35, 0x13,
-	0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35, 0x01, 0x15, 0x21, 0x35, 0x01, 0x17, 0x0E, 0x02, 0x15,
-	0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36,
-	0x03, 0xAF, 0xFD, 0x68, 0x2D, 0xB9, 0x02, 0xCD, 0xFD, 0xBF, 0x02, 0x92, 0xFD, 0x6E, 0x02, 0x11,
-	0x4A, 0x2B, 0x4E, 0x32, 0x23, 0x2B, 0x21, 0x34, 0x0F, 0x0E, 0x19, 0x4D, 0x3B, 0x51, 0x6F, 0x35,
-	0x72, 0x98, 0x98, 0x98, 0x03, 0xF5, 0xFB, 0x73, 0x04, 0x8D, 0xFE, 0x19, 0x97, 0x97, 0x01, 0xE7,
-	0x99, 0x99, 0xFB, 0xAC, 0x39, 0x20, 0x45, 0x4D, 0x2C, 0x21, 0x28, 0x13, 0x08, 0x7A, 0x0F, 0x1D,
-	0x61, 0x5E, 0x36, 0x6A, 0x62, 0x00, 0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00, 0x03, 0xAF, 0x06, 0x1D,
-	0x06, 0x26, 0x02, 0x42, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9F, 0x57, 0x1E, 0x00, 0x0B, 0xB6, 0x04,
-	0x16, 0x07, 0x01, 0x01, 0x74, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x64, 0xFF, 0xF0,
-	0x04, 0x36, 0x06, 0x1E, 0x06, 0x26, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9E, 0x71, 0x1E,
-	0x00, 0x0B, 0xB6, 0x01, 0x30, 0x10, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x64, 0xFF, 0xF0, 0x04, 0x36, 0x05, 0xF5, 0x06, 0x26, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0xA1, 0x00, 0x9B, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x01, 0x30, 0x10, 0x01, 0x01, 0x4D, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x64, 0xFF, 0xF0, 0x04, 0x36, 0x05, 0xE0, 0x06, 0x26,
-	0x01, 0xFF, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA2, 0x01, 0x4D, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x01,
-	0x34, 0x10, 0x01, 0x01, 0x70, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x64, 0xFD, 0xF8,
-	0x04, 0x36, 0x04, 0x9D, 0x06, 0x26, 0x01, 0xFF, 0x00, 0x00, 0x01, 0x07, 0x01, 0xD4, 0x01, 0x4F,
-	0xFE, 0x9A, 0x00, 0x0E, 0xB4, 0x01, 0x34, 0x05, 0x01, 0x01, 0xB8, 0xFF, 0x99, 0xB0, 0x56, 0x00,
-	0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00, 0x04, 0x59, 0x06, 0x1E, 0x06, 0x26, 0x01, 0xFE,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x9E, 0x00, 0x90, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x03, 0x11, 0x07,
-	0x01, 0x01, 0x76, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0x93, 0x00, 0x00, 0x02, 0x57,
-	0x06, 0x0A, 0x06, 0x26, 0x01, 0xFD, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA5, 0xFF, 0x18, 0x00, 0x22,
-	0x00, 0x0B, 0xB6, 0x01, 0x09, 0x03, 0x01, 0x01, 0x7F, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0xFF, 0xAA, 0x00, 0x00, 0x02, 0x49, 0x05, 0xCB, 0x06, 0x26, 0x01, 0xFD, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x70, 0xFF, 0x1B, 0x00, 0x26, 0x00, 0x0B, 0xB6, 0x01, 0x06, 0x03, 0x01, 0x01, 0xB0, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xC9, 0x00, 0x00, 0x02, 0x1F, 0x05, 0xF5, 0x06, 0x26,
-	0x01, 0xFD, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA1, 0xFF, 0x47, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x01,
-	0x09, 0x03, 0x01, 0x01, 0x5D, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x05, 0xFE, 0x4E,
-	0x01, 0x66, 0x04, 0x8D, 0x06, 0x26, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x06, 0x00, 0xA4, 0xD3, 0x00,
-	0xFF, 0xFF, 0x00, 0x87, 0x00, 0x00, 0x01, 0x62, 0x05, 0xE0, 0x06, 0x26, 0x01, 0xFD, 0x00, 0x00,
-	0x01, 0x06, 0x00, 0xA2, 0xF9, 0x1E, 0x00, 0x0B, 0xB6, 0x01, 0x0D, 0x03, 0x01, 0x01, 0x80, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x2C, 0xFF, 0xF0, 0x04, 0x0E, 0x06, 0x1E, 0x06, 0x26,
-	0x01, 0xFC, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9E, 0x01, 0x07, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x01,
-	0x19, 0x01, 0x01, 0x01, 0x76, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8B, 0xFE, 0x02,
-	0x04, 0x57, 0x04, 0x8D, 0x06, 0x26, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x07, 0x01, 0xD4, 0x01, 0x14,
-	0xFE, 0xA4, 0xFF, 0xFF, 0x00, 0x83, 0x00, 0x00, 0x03, 0x8B, 0x06, 0x1E, 0x06, 0x26, 0x01, 0xFA,
-	0x00, 0x00, 0x01, 0x06, 0x00, 0x75, 0x08, 0x1E, 0x00, 0x0B, 0xB6, 0x02, 0x08, 0x07, 0x01, 0x01,
-	0x6B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8B, 0xFE, 0x04, 0x03, 0x8B, 0x04, 0x8D,
-	0x06, 0x26, 0x01, 0xFA, 0x00, 0x00, 0x01, 0x07, 0x01, 0xD4, 0x01, 0x0F, 0xFE, 0xA6, 0x00, 0x0E,
-	0xB4, 0x02, 0x11, 0x06, 0x01, 0x01, 0xB8, 0xFF, 0x95, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF,
-	0x00, 0x8B, 0x00, 0x00, 0x03, 0x8B, 0x04, 0x8F, 0x06, 0x26, 0x01, 0xFA, 0x00, 0x00, 0x00, 0x07,
-	0x01, 0xD4, 0x01, 0x7E, 0x03, 0xA0, 0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00, 0x03, 0x8B, 0x04, 0x8D,
-	0x06, 0x26, 0x01, 0xFA, 0x00, 0x00, 0x00, 0x07, 0x00, 0xA2, 0x01, 0x66, 0xFD, 0x35, 0xFF, 0xFF,
-	0x00, 0x8B, 0x00, 0x00, 0x04, 0x59, 0x06, 0x1E, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x75, 0x01, 0x8F, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x01, 0x0A, 0x06, 0x01, 0x01, 0x6B, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8B, 0xFE, 0x00, 0x04, 0x59, 0x04, 0x8D, 0x06, 0x26,
-	0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0x01, 0xD4, 0x01, 0x6B, 0xFE, 0xA2, 0xFF, 0xFF, 0x00, 0x8B,
-	0x00, 0x00, 0x04, 0x59, 0x06, 0x1D, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9F,
-	0x00, 0xAE, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x01, 0x10, 0x06, 0x01, 0x01, 0x74, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x60, 0xFF, 0xF0, 0x04, 0x5B, 0x05, 0xCB, 0x06, 0x26, 0x01, 0xF7,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0x00, 0x85, 0x00, 0x26, 0x00, 0x0B, 0xB6, 0x02, 0x2E, 0x11,
-	0x01, 0x01, 0xA0, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x60, 0xFF, 0xF0, 0x04, 0x5B,
-	0x05, 0xF5, 0x06, 0x26, 0x01, 0xF7, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA1, 0x00, 0xB1, 0x00, 0x1E,
-	0x00, 0x0B, 0xB6, 0x02, 0x31, 0x11, 0x01, 0x01, 0x4D, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x60, 0xFF, 0xF0, 0x04, 0x5B, 0x06, 0x1D, 0x06, 0x26, 0x01, 0xF7, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0xA6, 0x01, 0x06, 0x00, 0x1E, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x30, 0x11, 0x01, 0x01, 0x51,
-	0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x04, 0x26, 0x06, 0x1E,
-	0x06, 0x26, 0x01, 0xF4, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x27, 0x00, 0x1E, 0x00, 0x0B,
-	0xB6, 0x02, 0x1F, 0x00, 0x01, 0x01, 0x6B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8A,
-	0xFE, 0x04, 0x04, 0x26, 0x04, 0x8D, 0x06, 0x26, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x07, 0x01, 0xD4,
-	0x01, 0x0D, 0xFE, 0xA6, 0xFF, 0xFF, 0x00, 0x8A, 0x00, 0x00, 0x04, 0x26, 0x06, 0x1D, 0x06, 0x26,
-	0x01, 0xF4, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9F, 0x46, 0x1E, 0x00, 0x0B, 0xB6, 0x02, 0x25, 0x00,
-	0x01, 0x01, 0x74, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x44, 0xFF, 0xF0, 0x03, 0xDE,
-	0x06, 0x1E, 0x06, 0x26, 0x01, 0xF3, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x3E, 0x00, 0x1E,
-	0x00, 0x0B, 0xB6, 0x01, 0x3A, 0x0F, 0x01, 0x01, 0x5B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x44, 0xFF, 0xF0, 0x03, 0xDE, 0x06, 0x1E, 0x06, 0x26, 0x01, 0xF3, 0x00, 0x00, 0x01, 0x06,
-	0x00, 0x9E, 0x48, 0x1E, 0x00, 0x0B, 0xB6, 0x01, 0x3F, 0x0F, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x44, 0xFE, 0x4D, 0x03, 0xDE, 0x04, 0x9D, 0x06, 0x26, 0x01, 0xF3,
-	0x00, 0x00, 0x00, 0x07, 0x00, 0x79, 0x01, 0x53, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x44, 0xFF, 0xF0,
-	0x03, 0xDE, 0x06, 0x1D, 0x06, 0x26, 0x01, 0xF3, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9F, 0x5D, 0x1E,
-	0x00, 0x0B, 0xB6, 0x01, 0x40, 0x0F, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x29, 0xFD, 0xFF, 0x03, 0xFD, 0x04, 0x8D, 0x06, 0x26, 0x01, 0xF2, 0x00, 0x00, 0x01, 0x07,
-	0x01, 0xD4, 0x01, 0x13, 0xFE, 0xA1, 0x00, 0x0E, 0xB4, 0x02, 0x11, 0x02, 0x01, 0x01, 0xB8, 0xFF,
-	0x90, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x29, 0x00, 0x00, 0x03, 0xFD, 0x06, 0x1D,
-	0x06, 0x26, 0x01, 0xF2, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9F, 0x50, 0x1E, 0x00, 0x0B, 0xB6, 0x02,
-	0x0E, 0x07, 0x01, 0x01, 0x74, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x29, 0xFE, 0x50,
-	0x03, 0xFD, 0x04, 0x8D, 0x06, 0x26, 0x01, 0xF2, 0x00, 0x00, 0x00, 0x07, 0x00, 0x79, 0x01, 0x3E,
-	0x00, 0x03, 0xFF, 0xFF, 0x00, 0x75, 0xFF, 0xF0, 0x04, 0x0B, 0x06, 0x0A, 0x06, 0x26, 0x01, 0xF1,
-	0x00, 0x00, 0x01, 0x06, 0x00, 0xA5, 0x64, 0x22, 0x00, 0x0B, 0xB6, 0x01, 0x1B, 0x0B, 0x01, 0x01,
-	0x7F, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x75, 0xFF, 0xF0, 0x04, 0x0B, 0x05, 0xCB,
-	0x06, 0x26, 0x01, 0xF1, 0x00, 0x00, 0x01, 0x06, 0x00, 0x70, 0x67, 0x26, 0x00, 0x0B, 0xB6, 0x01,
-	0x18, 0x0B, 0x01, 0x01, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x75, 0xFF, 0xF0,
-	0x04, 0x0B, 0x05, 0xF5, 0x06, 0x26, 0x01, 0xF1, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA1, 0x00, 0x93,
-	0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x01, 0x1B, 0x0B, 0x01, 0x01, 0x5D, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x75, 0xFF, 0xF0, 0x04, 0x0B, 0x06, 0x7A, 0x06, 0x26, 0x01, 0xF1, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0xA3, 0x00, 0xF0, 0x00, 0x29, 0x00, 0x0D, 0xB7, 0x02, 0x01, 0x21, 0x0B, 0x01,
-	0x01, 0x51, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x75, 0xFF, 0xF0, 0x04, 0x14,
-	0x06, 0x1D, 0x06, 0x26, 0x01, 0xF1, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA6, 0x00, 0xE8, 0x00, 0x1E,
-	0x00, 0x0D, 0xB7, 0x02, 0x01, 0x1A, 0x0B, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00,
-	0x00, 0x02, 0x00, 0x75, 0xFE, 0x73, 0x04, 0x0B, 0x04, 0x8D, 0x00, 0x15, 0x00, 0x2B, 0x00, 0x1A,
-	0x40, 0x0C, 0x1E, 0x25, 0x17, 0x16, 0x16, 0x11, 0x06, 0x0B, 0x72, 0x0C, 0x00, 0x7D, 0x00, 0x3F,
-	0x32, 0x2B, 0x32, 0x32, 0x11, 0x33, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x33, 0x11, 0x14, 0x06, 0x06,
-	0x23, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35,
-	0x03, 0x17, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22,
-	0x26, 0x35, 0x34, 0x36, 0x36, 0x03, 0x51, 0xBA, 0x7D, 0xD1, 0x7E, 0x83, 0xCF, 0x78, 0xB7, 0x45,
-	0x7C, 0x52, 0x53, 0x7B, 0x44, 0x6B, 0x4A, 0x2B, 0x4E, 0x32, 0x23, 0x2B, 0x21, 0x34, 0x0F, 0x0E,
-	0x19, 0x4D, 0x3B, 0x51, 0x6F, 0x35, 0x72, 0x04, 0x8D, 0xFC, 0xF4, 0x84, 0xB3, 0x5A, 0x5A, 0xB3,
-	0x84, 0x03, 0x0C, 0xFC, 0xF4, 0x56, 0x6F, 0x35, 0x35, 0x6F, 0x56, 0xFE, 0xDD, 0x39, 0x20, 0x45,
-	0x4D, 0x2C, 0x21, 0x28, 0x13, 0x08, 0x7A, 0x0F, 0x1D, 0x61, 0x5E, 0x36, 0x6A, 0x62, 0xFF, 0xFF,
-	0x00, 0x31, 0x00, 0x00, 0x05, 0xF1, 0x06, 0x1E, 0x06, 0x26, 0x01, 0xEF, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x9E, 0x01, 0x3B, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x04, 0x1B, 0x0A, 0x01, 0x01, 0x76, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x0E, 0x00, 0x00, 0x04, 0x1C, 0x06, 0x1E, 0x06, 0x26,
-	0x01, 0xED, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9E, 0x3E, 0x1E, 0x00, 0x0B, 0xB6, 0x03, 0x13, 0x09,
-	0x01, 0x01, 0x76, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x0E, 0x00, 0x00, 0x04, 0x1C,
-	0x05, 0xE4, 0x06, 0x26, 0x01, 0xED, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6A, 0x6E, 0x1E, 0x00, 0x0D,
-	0xB7, 0x04, 0x03, 0x17, 0x09, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x48, 0x00, 0x00, 0x03, 0xE1, 0x06, 0x1E, 0x06, 0x26, 0x01, 0xEC, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x75, 0x01, 0x34, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x03, 0x0E, 0x0D, 0x01, 0x01, 0x6B, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x48, 0x00, 0x00, 0x03, 0xE1, 0x05, 0xE0, 0x06, 0x26,
-	0x01, 0xEC, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA2, 0x01, 0x1A, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x03,
-	0x17, 0x0D, 0x01, 0x01, 0x80, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x48, 0x00, 0x00,
-	0x03, 0xE1, 0x06, 0x1D, 0x06, 0x26, 0x01, 0xEC, 0x00, 0x00, 0x01, 0x06, 0x00, 0x9F, 0x53, 0x1E,
-	0x00, 0x0B, 0xB6, 0x03, 0x14, 0x0D, 0x01, 0x01, 0x74, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E, 0x06, 0x3E, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x06,
-	0x00, 0xAE, 0x03, 0xFF, 0x00, 0x0E, 0xB4, 0x03, 0x0E, 0x03, 0x00, 0x00, 0xB8, 0xFF, 0x3E, 0xB0,
-	0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x04, 0xAA, 0x06, 0x3F, 0x04, 0x26,
-	0x00, 0x29, 0x64, 0x00, 0x01, 0x07, 0x00, 0xAE, 0xFE, 0xD4, 0x00, 0x00, 0x00, 0x0E, 0xB4, 0x04,
-	0x10, 0x07, 0x00, 0x00, 0xB8, 0xFF, 0x3F, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0xFF, 0x9A,
-	0x00, 0x00, 0x05, 0x6C, 0x06, 0x41, 0x04, 0x26, 0x00, 0x2C, 0x64, 0x00, 0x00, 0x07, 0x00, 0xAE,
-	0xFE, 0xE2, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x01, 0xDC, 0x06, 0x41, 0x04, 0x26,
-	0x00, 0x2D, 0x64, 0x00, 0x01, 0x07, 0x00, 0xAE, 0xFE, 0xE8, 0x00, 0x02, 0x00, 0x0E, 0xB4, 0x01,
-	0x04, 0x03, 0x00, 0x00, 0xB8, 0xFF, 0x41, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0xFF, 0xFA,
-	0xFF, 0xEC, 0x05, 0x1E, 0x06, 0x3E, 0x04, 0x26, 0x00, 0x33, 0x14, 0x00, 0x01, 0x07, 0x00, 0xAE,
-	0xFF, 0x42, 0xFF, 0xFF, 0x00, 0x0E, 0xB4, 0x02, 0x2C, 0x11, 0x00, 0x00, 0xB8, 0xFF, 0x2A, 0xB0,
-	0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0xFF, 0x76, 0x00, 0x00, 0x05, 0x20, 0x06, 0x3E, 0x04, 0x26,
-	0x00, 0x3D, 0x64, 0x00, 0x01, 0x07, 0x00, 0xAE, 0xFE, 0xBE, 0xFF, 0xFF, 0x00, 0x0B, 0xB6, 0x01,
-	0x0A, 0x08, 0x00, 0x00, 0x8E, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-	0x04, 0xE0, 0x06, 0x3E, 0x04, 0x26, 0x00, 0xBA, 0x14, 0x00, 0x01, 0x07, 0x00, 0xAE, 0xFF, 0x44,
-	0xFF, 0xFF, 0x00, 0x0E, 0xB4, 0x03, 0x36, 0x1D, 0x00, 0x00, 0xB8, 0xFF, 0x2A, 0xB0, 0x56, 0x00,
-	0x2B, 0x34, 0xFF, 0xFF, 0xFF, 0x9B, 0xFF, 0xF3, 0x02, 0xAC, 0x06, 0x74, 0x06, 0x26, 0x00, 0xC3,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0xAF, 0xFF, 0x29, 0xFF, 0xEB, 0x00, 0x10, 0x40, 0x09, 0x03, 0x02,
-	0x01, 0x2B, 0x00, 0x01, 0x01, 0xA2, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x34, 0xFF, 0xFF, 0x00, 0x1D,
-	0x00, 0x00, 0x05, 0x1E, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x25, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xA9,
-	0x00, 0x00, 0x04, 0x88, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x26, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xA9,
-	0x00, 0x00, 0x04, 0x46, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x29, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x57,
-	0x00, 0x00, 0x04, 0x7A, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x3E, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xA9,
-	0x00, 0x00, 0x05, 0x08, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x2C, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xB7,
-	0x00, 0x00, 0x01, 0x78, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x2D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xA9,
-	0x00, 0x00, 0x05, 0x05, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x2F, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xA9,
-	0x00, 0x00, 0x06, 0x52, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x31, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xA9,
-	0x00, 0x00, 0x05, 0x09, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x32, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x77,
-	0xFF, 0xEC, 0x05, 0x0A, 0x05, 0xC4, 0x06, 0x06, 0x00, 0x33, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xA9,
-	0x00, 0x00, 0x04, 0xC1, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x34, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x32,
-	0x00, 0x00, 0x04, 0x97, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x38, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F,
-	0x00, 0x00, 0x04, 0xBC, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x3D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x3A,
-	0x00, 0x00, 0x04, 0xCE, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x3C, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD5,
-	0x00, 0x00, 0x02, 0x5F, 0x07, 0x08, 0x06, 0x26, 0x00, 0x2D, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A,
-	0xFF, 0x70, 0x01, 0x42, 0x00, 0x0D, 0xB7, 0x02, 0x01, 0x19, 0x03, 0x01, 0x01, 0x83, 0x56, 0x00,
-	0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x04, 0xBC, 0x06, 0xFC, 0x06, 0x26,
-	0x00, 0x3D, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x00, 0xC3, 0x01, 0x36, 0x00, 0x0D, 0xB7, 0x02,
-	0x01, 0x1E, 0x02, 0x01, 0x01, 0x77, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x64,
-	0xFF, 0xEB, 0x04, 0x78, 0x06, 0x38, 0x06, 0x26, 0x00, 0xBB, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAE,
-	0x01, 0x75, 0xFF, 0xF9, 0x00, 0x0B, 0xB6, 0x03, 0x42, 0x06, 0x01, 0x01, 0x9A, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x64, 0xFF, 0xEC, 0x03, 0xEC, 0x06, 0x37, 0x06, 0x26, 0x00, 0xBF,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0xAE, 0x01, 0x2B, 0xFF, 0xF8, 0x00, 0x0B, 0xB6, 0x02, 0x40, 0x2B,
-	0x01, 0x01, 0x9A, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x92, 0xFE, 0x61, 0x03, 0xF1,
-	0x06, 0x38, 0x06, 0x26, 0x00, 0xC1, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAE, 0x01, 0x46, 0xFF, 0xF9,
-	0x00, 0x0B, 0xB6, 0x02, 0x1D, 0x03, 0x01, 0x01, 0xAE, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0xC3, 0xFF, 0xF3, 0x02, 0x4C, 0x06, 0x23, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x01, 0x06,
-	0x00, 0xAE, 0x2A, 0xE4, 0x00, 0x0B, 0xB6, 0x01, 0x12, 0x00, 0x01, 0x01, 0x99, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x90, 0xFF, 0xEB, 0x03, 0xF7, 0x06, 0x74, 0x06, 0x26, 0x00, 0xCB,
-	0x00, 0x00, 0x01, 0x06, 0x00, 0xAF, 0x22, 0xEB, 0x00, 0x10, 0x40, 0x09, 0x03, 0x02, 0x01, 0x38,
-	0x0F, 0x01, 0x01, 0xA2, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x34, 0xFF, 0xFF, 0x00, 0x9B, 0x00, 0x00,
-	0x04, 0x40, 0x04, 0x3A, 0x06, 0x06, 0x00, 0x8E, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5C, 0xFF, 0xEC,
-	0x04, 0x35, 0x04, 0x4E, 0x06, 0x06, 0x00, 0x53, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x9B, 0xFE, 0x60,
-	0x03, 0xEE, 0x04, 0x3A, 0x06, 0x06, 0x00, 0x76, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x21, 0x00, 0x00,
-	0x03, 0xBB, 0x04, 0x3A, 0x06, 0x06, 0x00, 0x5A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5A, 0xFE, 0x4C,
-	0x04, 0x75, 0x04, 0x49, 0x06, 0x06, 0x02, 0x8A, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE4, 0xFF, 0xF3,
-	0x02, 0x6E, 0x05, 0xB1, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0xFF, 0x7F,
-	0xFF, 0xEB, 0x00, 0x0D, 0xB7, 0x02, 0x01, 0x27, 0x00, 0x01, 0x01, 0xA2, 0x56, 0x00, 0x2B, 0x34,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x90, 0xFF, 0xEB, 0x03, 0xF7, 0x05, 0xB1, 0x06, 0x26, 0x00, 0xCB,
-	0x00, 0x00, 0x01, 0x06, 0x00, 0x6A, 0x78, 0xEB, 0x00, 0x0D, 0xB7, 0x02, 0x01, 0x34, 0x0F, 0x01,
-	0x01, 0xA2, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5C, 0xFF, 0xEC, 0x04, 0x35,
-	0x06, 0x38, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAE, 0x01, 0x43, 0xFF, 0xF9,
-	0x00, 0x0B, 0xB6, 0x02, 0x2C, 0x06, 0x01, 0x01, 0x9A, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x90, 0xFF, 0xEB, 0x03, 0xF7, 0x06, 0x23, 0x06, 0x26, 0x00, 0xCB, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0xAE, 0x01, 0x23, 0xFF, 0xE4, 0x00, 0x0B, 0xB6, 0x01, 0x1F, 0x0F, 0x01, 0x01, 0x99, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x7A, 0xFF, 0xEB, 0x06, 0x1A, 0x06, 0x20, 0x06, 0x26,
-	0x00, 0xCE, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAE, 0x02, 0x54, 0xFF, 0xE1, 0x00, 0x0B, 0xB6, 0x02,
-	0x40, 0x1F, 0x01, 0x01, 0x96, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00,
-	0x04, 0x46, 0x07, 0x08, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x00, 0xC4,
-	0x01, 0x42, 0x00, 0x0D, 0xB7, 0x05, 0x04, 0x25, 0x07, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2B, 0x34,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0xB2, 0x00, 0x00, 0x04, 0x30, 0x07, 0x42, 0x06, 0x26, 0x00, 0xB1,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x90, 0x01, 0x42, 0x00, 0x0B, 0xB6, 0x01, 0x06, 0x05,
-	0x01, 0x01, 0x6C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0x00, 0x01, 0x00, 0x51, 0xFF, 0xEC, 0x04, 0x73,
-	0x05, 0xC4, 0x00, 0x39, 0x00, 0x1B, 0x40, 0x0D, 0x0A, 0x26, 0x0F, 0x36, 0x31, 0x2B, 0x09, 0x72,
-	0x18, 0x14, 0x0F, 0x03, 0x72, 0x00, 0x2B, 0xCC, 0x33, 0x2B, 0xCC, 0x33, 0x12, 0x39, 0x39, 0x30,
-	0x31, 0x41, 0x34, 0x2E, 0x02, 0x27, 0x2E, 0x03, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16,
-	0x15, 0x23, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1E, 0x02, 0x17, 0x1E, 0x03,
-	0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35, 0x33, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36,
-	0x36, 0x03, 0xB1, 0x1F, 0x4D, 0x87, 0x67, 0x6C, 0xAE, 0x7C, 0x42, 0x46, 0x83, 0xB6, 0x70, 0xA4,
-	0xE5, 0x78, 0xC0, 0x46, 0x8E, 0x6D, 0x67, 0x86, 0x41, 0x27, 0x53, 0x81, 0x5A, 0x7C, 0xB4, 0x75,
-	0x39, 0x48, 0x86, 0xBB, 0x73, 0x65, 0xC3, 0x9F, 0x5F, 0xC0, 0x3A, 0x65, 0x81, 0x46, 0x65, 0x8C,
-	0x49, 0x01, 0x70, 0x33, 0x4F, 0x40, 0x3A, 0x1E, 0x20, 0x4F, 0x66, 0x84, 0x55, 0x55, 0x90, 0x6B,
-	0x3C, 0x7D, 0xC9, 0x72, 0x52, 0x7F, 0x49, 0x3E, 0x6A, 0x44, 0x2E, 0x4B, 0x40, 0x36, 0x19, 0x23,
-	0x56, 0x6B, 0x87, 0x55, 0x59, 0x90, 0x66, 0x37, 0x38, 0x70, 0xA5, 0x6D, 0x4B, 0x6B, 0x46, 0x21,
-	0x38, 0x68, 0xFF, 0xFF, 0x00, 0xB7, 0x00, 0x00, 0x01, 0x78, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x2D,
-	0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD5, 0x00, 0x00, 0x02, 0x5F, 0x07, 0x08, 0x06, 0x26, 0x00, 0x2D,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0xFF, 0x70, 0x01, 0x42, 0x00, 0x0D, 0xB7, 0x02, 0x01, 0x19,
-	0x03, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x35, 0xFF, 0xEC,
-	0x03, 0xCC, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x2E, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xB2, 0x00, 0x00,
-	0x05, 0x1E, 0x05, 0xB0, 0x06, 0x06, 0x02, 0x46, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00,
-	0x05, 0x05, 0x07, 0x31, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x7C,
-	0x01, 0x31, 0x00, 0x0B, 0xB6, 0x03, 0x0E, 0x03, 0x01, 0x01, 0x5B, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x4D, 0xFF, 0xEB, 0x04, 0xCB, 0x07, 0x19, 0x06, 0x26, 0x00, 0xDE, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0xA1, 0x00, 0xD9, 0x01, 0x42, 0x00, 0x0B, 0xB6, 0x02, 0x1E, 0x01, 0x01, 0x01,
-	0x5E, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E, 0x05, 0xB0,
-	0x06, 0x06, 0x00, 0x25, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00, 0x04, 0x88, 0x05, 0xB0,
-	0x06, 0x06, 0x00, 0x26, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xB2, 0x00, 0x00, 0x04, 0x30, 0x05, 0xB0,
-	0x06, 0x06, 0x00, 0xB1, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00, 0x04, 0x46, 0x05, 0xB0,
-	0x06, 0x06, 0x00, 0x29, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xB2, 0x00, 0x00, 0x05, 0x00, 0x07, 0x19,
-	0x06, 0x26, 0x00, 0xDC, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA1, 0x01, 0x30, 0x01, 0x42, 0x00, 0x0B,
-	0xB6, 0x01, 0x0F, 0x01, 0x01, 0x01, 0x5E, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9,
-	0x00, 0x00, 0x06, 0x52, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x31, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xA9,
-	0x00, 0x00, 0x05, 0x08, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x2C, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x77,
-	0xFF, 0xEC, 0x05, 0x0A, 0x05, 0xC4, 0x06, 0x06, 0x00, 0x33, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xB2,
-	0x00, 0x00, 0x05, 0x01, 0x05, 0xB0, 0x06, 0x06, 0x00, 0xB6, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xA9,
-	0x00, 0x00, 0x04, 0xC1, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x34, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x78,
-	0xFF, 0xEC, 0x04, 0xD8, 0x05, 0xC4, 0x06, 0x06, 0x00, 0x27, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x32,
-	0x00, 0x00, 0x04, 0x97, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x38, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x3A,
-	0x00, 0x00, 0x04, 0xCE, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x3C, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x6D,
-	0xFF, 0xEC, 0x03, 0xEA, 0x04, 0x4E, 0x06, 0x06, 0x00, 0x45, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5D,
-	0xFF, 0xEC, 0x03, 0xF3, 0x04, 0x4E, 0x06, 0x06, 0x00, 0x49, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x9D,
-	0x00, 0x00, 0x04, 0x02, 0x05, 0xC2, 0x06, 0x26, 0x00, 0xF0, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA1,
-	0x00, 0xA1, 0xFF, 0xEB, 0x00, 0x0B, 0xB6, 0x01, 0x0F, 0x01, 0x01, 0x01, 0x7D, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5C, 0xFF, 0xEC, 0x04, 0x35, 0x04, 0x4E, 0x06, 0x06, 0x00, 0x53,
-	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x8C, 0xFE, 0x60, 0x04, 0x1F, 0x04, 0x4E, 0x06, 0x06, 0x00, 0x54,
-	0x00, 0x00, 0x00, 0x01, 0x00, 0x5D, 0xFF, 0xEC, 0x03, 0xED, 0x04, 0x4E, 0x00, 0x27, 0x00, 0x13,
-	0x40, 0x09, 0x00, 0x09, 0x1D, 0x14, 0x07, 0x72, 0x09, 0x0B, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x11,
-	0x33, 0x30, 0x31, 0x65, 0x32, 0x36, 0x36, 0x37, 0x33, 0x0E, 0x02, 0x23, 0x22, 0x2E, 0x02, 0x35,
-	0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02,
-	0x15, 0x15, 0x14, 0x1E, 0x02, 0x02, 0x3E, 0x42, 0x70, 0x48, 0x05, 0xB0, 0x05, 0x77, 0xC0, 0x73,
-	0x7A, 0xB5, 0x77, 0x3B, 0x3B, 0x77, 0xB5, 0x7A, 0x7F, 0xBE, 0x6D, 0x05, 0xB0, 0x05, 0x41, 0x6F,
-	0x4A, 0x55, 0x73, 0x43, 0x1D, 0x1C, 0x43, 0x73, 0x84, 0x36, 0x5F, 0x3D, 0x60, 0xA5, 0x65, 0x56,
-	0x96, 0xC3, 0x6D, 0x2A, 0x6D, 0xC3, 0x96, 0x56, 0x67, 0xB1, 0x70, 0x43, 0x6C, 0x41, 0x43, 0x71,
-	0x89, 0x47, 0x2A, 0x47, 0x8A, 0x70, 0x43, 0x00, 0xFF, 0xFF, 0x00, 0x16, 0xFE, 0x4B, 0x03, 0xB0,
-	0x04, 0x3A, 0x06, 0x06, 0x00, 0x5D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2A, 0x00, 0x00, 0x03, 0xCB,
-	0x04, 0x3A, 0x06, 0x06, 0x00, 0x5C, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5D, 0xFF, 0xEC, 0x03, 0xF3,
-	0x05, 0xC6, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x00, 0x8E, 0x00, 0x00,
-	0x00, 0x0D, 0xB7, 0x02, 0x01, 0x41, 0x0B, 0x01, 0x01, 0xA3, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x9B, 0x00, 0x00, 0x03, 0x48, 0x05, 0xEB, 0x06, 0x26, 0x00, 0xEC, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x75, 0x00, 0xCE, 0xFF, 0xEB, 0x00, 0x0B, 0xB6, 0x01, 0x06, 0x05, 0x01, 0x01,
-	0x8B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5F, 0xFF, 0xEC, 0x03, 0xBC, 0x04, 0x4E,
-	0x06, 0x06, 0x00, 0x57, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x8E, 0x00, 0x00, 0x01, 0x69, 0x05, 0xC4,
-	0x06, 0x06, 0x00, 0x4D, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xBA, 0x00, 0x00, 0x02, 0x44, 0x05, 0xC4,
-	0x06, 0x26, 0x00, 0x8D, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0xFF, 0x55, 0xFF, 0xFE, 0x00, 0x0D,
-	0xB7, 0x02, 0x01, 0x19, 0x03, 0x01, 0x01, 0xB5, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF,
-	0xFF, 0xBE, 0xFE, 0x4B, 0x01, 0x5A, 0x05, 0xC4, 0x06, 0x06, 0x00, 0x4E, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x9D, 0x00, 0x00, 0x04, 0x40, 0x05, 0xEA, 0x06, 0x26, 0x00, 0xF1, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x75, 0x01, 0x3C, 0xFF, 0xEA, 0x00, 0x0B, 0xB6, 0x03, 0x0E, 0x03, 0x01, 0x01, 0x8A, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x16, 0xFE, 0x4B, 0x03, 0xB0, 0x05, 0xD7, 0x06, 0x26,
-	0x00, 0x5D, 0x00, 0x00, 0x01, 0x06, 0x00, 0xA1, 0x4F, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x1E, 0x01,
-	0x01, 0x01, 0x92, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x3D, 0x00, 0x00, 0x06, 0xED,
-	0x07, 0x37, 0x06, 0x26, 0x00, 0x3B, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x02, 0x2B, 0x01, 0x37,
-	0x00, 0x0B, 0xB6, 0x04, 0x18, 0x15, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x2B, 0x00, 0x00, 0x05, 0xD3, 0x06, 0x00, 0x06, 0x26, 0x00, 0x5B, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x44, 0x01, 0x8A, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x04, 0x18, 0x15, 0x01, 0x01, 0xA0, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x3D, 0x00, 0x00, 0x06, 0xED, 0x07, 0x37, 0x06, 0x26,
-	0x00, 0x3B, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x02, 0xBB, 0x01, 0x37, 0x00, 0x0B, 0xB6, 0x04,
-	0x16, 0x01, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x2B, 0x00, 0x00,
-	0x05, 0xD3, 0x06, 0x00, 0x06, 0x26, 0x00, 0x5B, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x02, 0x1A,
-	0x00, 0x00, 0x00, 0x0B, 0xB6, 0x04, 0x16, 0x01, 0x01, 0x01, 0xA0, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x3D, 0x00, 0x00, 0x06, 0xED, 0x06, 0xFD, 0x06, 0x26, 0x00, 0x3B, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x6A, 0x01, 0xF5, 0x01, 0x37, 0x00, 0x0D, 0xB7, 0x05, 0x04, 0x2B, 0x15, 0x01,
-	0x01, 0x78, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x2B, 0x00, 0x00, 0x05, 0xD3,
-	0x05, 0xC6, 0x06, 0x26, 0x00, 0x5B, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x01, 0x54, 0x00, 0x00,
-	0x00, 0x0D, 0xB7, 0x05, 0x04, 0x2B, 0x15, 0x01, 0x01, 0xB7, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x04, 0xBC, 0x07, 0x36, 0x06, 0x26, 0x00, 0x3D, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x44, 0x00, 0xF9, 0x01, 0x36, 0x00, 0x0B, 0xB6, 0x01, 0x0B, 0x02, 0x01, 0x01,
-	0x60, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x16, 0xFE, 0x4B, 0x03, 0xB0, 0x06, 0x00,
-	0x06, 0x26, 0x00, 0x5D, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x0B,
-	0xB6, 0x02, 0x1B, 0x01, 0x01, 0x01, 0xA0, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x68,
-	0x04, 0x22, 0x00, 0xFE, 0x06, 0x00, 0x06, 0x06, 0x00, 0x0B, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x89,
-	0x04, 0x13, 0x02, 0x24, 0x06, 0x00, 0x06, 0x06, 0x00, 0x06, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xA1,
-	0xFF, 0xF4, 0x03, 0x8C, 0x05, 0xB0, 0x04, 0x26, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x05,
-	0x02, 0x10, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xB4, 0xFE, 0x4B, 0x02, 0x40, 0x05, 0xD6, 0x06, 0x26,
-	0x00, 0x9C, 0x00, 0x00, 0x01, 0x07, 0x00, 0x9F, 0xFF, 0x48, 0xFF, 0xD7, 0x00, 0x0B, 0xB6, 0x01,
-	0x18, 0x00, 0x01, 0x01, 0x80, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x30, 0x04, 0x16,
-	0x01, 0x48, 0x06, 0x00, 0x06, 0x06, 0x01, 0x85, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00,
-	0x06, 0x52, 0x07, 0x37, 0x06, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x02, 0x99,
-	0x01, 0x37, 0x00, 0x0B, 0xB6, 0x03, 0x11, 0x00, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00, 0x06, 0x79, 0x06, 0x00, 0x06, 0x26, 0x00, 0x51, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x75, 0x02, 0xAE, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x03, 0x33, 0x03, 0x01, 0x01,
-	0xA0, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x1D, 0xFE, 0x6B, 0x05, 0x1E, 0x05, 0xB0,
-	0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA7, 0x01, 0x80, 0x00, 0x01, 0x00, 0x10,
-	0xB5, 0x04, 0x03, 0x11, 0x05, 0x01, 0x01, 0xB8, 0xFF, 0xB5, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0x34,
-	0xFF, 0xFF, 0x00, 0x6D, 0xFE, 0x6B, 0x03, 0xEA, 0x04, 0x4E, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0xA7, 0x00, 0xC8, 0x00, 0x01, 0x00, 0x10, 0xB5, 0x03, 0x02, 0x3E, 0x31, 0x01,
-	0x01, 0xB8, 0xFF, 0xC9, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0x34, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00,
-	0x04, 0x46, 0x07, 0x42, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xFA,
-	0x01, 0x42, 0x00, 0x0B, 0xB6, 0x04, 0x12, 0x07, 0x01, 0x01, 0x6C, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0xB2, 0x00, 0x00, 0x05, 0x00, 0x07, 0x42, 0x06, 0x26, 0x00, 0xDC, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x44, 0x01, 0x6C, 0x01, 0x42, 0x00, 0x0B, 0xB6, 0x01, 0x0C, 0x01, 0x01, 0x01,
-	0x6C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5D, 0xFF, 0xEC, 0x03, 0xF3, 0x06, 0x00,
-	0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xC4, 0x00, 0x00, 0x00, 0x0B,
-	0xB6, 0x01, 0x2E, 0x0B, 0x01, 0x01, 0x8C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x9D,
-	0x00, 0x00, 0x04, 0x02, 0x05, 0xEB, 0x06, 0x26, 0x00, 0xF0, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44,
-	0x00, 0xDD, 0xFF, 0xEB, 0x00, 0x0B, 0xB6, 0x01, 0x0C, 0x01, 0x01, 0x01, 0x8B, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5A, 0x00, 0x00, 0x05, 0x22, 0x05, 0xB0, 0x06, 0x06, 0x00, 0xB9,
-	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x60, 0xFE, 0x27, 0x05, 0x43, 0x04, 0x3A, 0x06, 0x06, 0x00, 0xCD,
-	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x16, 0x00, 0x00, 0x04, 0xDD, 0x06, 0xE7, 0x06, 0x26, 0x01, 0x19,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0xAC, 0x04, 0x3A, 0x00, 0xF9, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x15,
-	0x13, 0x01, 0x01, 0x2D, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00,
-	0x04, 0x0C, 0x05, 0xBF, 0x06, 0x26, 0x01, 0x1A, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAC, 0x03, 0xD4,
-	0xFF, 0xD1, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x19, 0x17, 0x01, 0x01, 0x7B, 0x56, 0x00, 0x2B, 0x34,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5C, 0xFE, 0x4B, 0x08, 0x40, 0x04, 0x4E, 0x04, 0x26, 0x00, 0x53,
-	0x00, 0x00, 0x00, 0x07, 0x00, 0x5D, 0x04, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x77, 0xFE, 0x4B,
-	0x09, 0x31, 0x05, 0xC4, 0x04, 0x26, 0x00, 0x33, 0x00, 0x00, 0x00, 0x07, 0x00, 0x5D, 0x05, 0x81,
-	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x50, 0xFE, 0x4F, 0x04, 0x6B, 0x05, 0xC4, 0x06, 0x26, 0x00, 0xDB,
-	0x00, 0x00, 0x01, 0x07, 0x02, 0x6B, 0x01, 0x9B, 0xFF, 0xB6, 0x00, 0x0B, 0xB6, 0x02, 0x42, 0x2A,
-	0x00, 0x00, 0x64, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x58, 0xFE, 0x50, 0x03, 0xAD,
-	0x04, 0x4D, 0x06, 0x26, 0x00, 0xEF, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6B, 0x01, 0x43, 0xFF, 0xB7,
-	0x00, 0x0B, 0xB6, 0x02, 0x3F, 0x29, 0x00, 0x00, 0x65, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x78, 0xFE, 0x4F, 0x04, 0xD8, 0x05, 0xC4, 0x06, 0x26, 0x00, 0x27, 0x00, 0x00, 0x01, 0x07,
-	0x02, 0x6B, 0x01, 0xE5, 0xFF, 0xB6, 0x00, 0x0B, 0xB6, 0x01, 0x2B, 0x05, 0x00, 0x00, 0x64, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5D, 0xFE, 0x4F, 0x03, 0xED, 0x04, 0x4E, 0x06, 0x26,
-	0x00, 0x47, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6B, 0x01, 0x52, 0xFF, 0xB6, 0x00, 0x0B, 0xB6, 0x01,
-	0x2B, 0x09, 0x00, 0x00, 0x64, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00,
-	0x04, 0xBC, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x3D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2F, 0xFE, 0x5F,
-	0x03, 0xE0, 0x04, 0x3A, 0x06, 0x06, 0x00, 0xBD, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xB7, 0x00, 0x00,
-	0x01, 0x78, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x2D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x1B, 0x00, 0x00,
-	0x07, 0x36, 0x07, 0x19, 0x06, 0x26, 0x00, 0xDA, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA1, 0x01, 0xF8,
-	0x01, 0x42, 0x00, 0x0B, 0xB6, 0x05, 0x1D, 0x0D, 0x01, 0x01, 0x5E, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x16, 0x00, 0x00, 0x06, 0x04, 0x05, 0xC2, 0x06, 0x26, 0x00, 0xEE, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0xA1, 0x01, 0x5F, 0xFF, 0xEB, 0x00, 0x0B, 0xB6, 0x05, 0x1D, 0x0D, 0x01, 0x01,
-	0x7D, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xB7, 0x00, 0x00, 0x01, 0x78, 0x05, 0xB0,
-	0x06, 0x06, 0x00, 0x2D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E, 0x07, 0x0E,
-	0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA1, 0x00, 0xF3, 0x01, 0x37, 0x00, 0x0B,
-	0xB6, 0x03, 0x13, 0x07, 0x01, 0x01, 0x53, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x6D,
-	0xFF, 0xEC, 0x03, 0xEA, 0x05, 0xD7, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA1,
-	0x00, 0x99, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x40, 0x0F, 0x01, 0x01, 0x7E, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E, 0x06, 0xFD, 0x06, 0x26, 0x00, 0x25,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x00, 0xF9, 0x01, 0x37, 0x00, 0x0D, 0xB7, 0x04, 0x03, 0x23,
-	0x07, 0x01, 0x01, 0x78, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x6D, 0xFF, 0xEC,
-	0x03, 0xEA, 0x05, 0xC6, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x00, 0x9F,
-	0x00, 0x00, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x50, 0x0F, 0x01, 0x01, 0xA3, 0x56, 0x00, 0x2B, 0x34,
-	0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x07, 0x58, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x81,
-	0x00, 0x00, 0xFF, 0xFF, 0x00, 0x4F, 0xFF, 0xEB, 0x06, 0x7D, 0x04, 0x4F, 0x06, 0x06, 0x00, 0x86,
-	0x00, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00, 0x04, 0x46, 0x07, 0x19, 0x06, 0x26, 0x00, 0x29,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0xA1, 0x00, 0xBE, 0x01, 0x42, 0x00, 0x0B, 0xB6, 0x04, 0x15, 0x07,
-	0x01, 0x01, 0x5E, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5D, 0xFF, 0xEC, 0x03, 0xF3,
-	0x05, 0xD7, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA1, 0x00, 0x88, 0x00, 0x00,
-	0x00, 0x0B, 0xB6, 0x01, 0x31, 0x0B, 0x01, 0x01, 0x7E, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x5E, 0xFF, 0xEB, 0x05, 0x12, 0x06, 0xDA, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x6A, 0x00, 0xD4, 0x01, 0x14, 0x00, 0x0D, 0xB7, 0x02, 0x01, 0x42, 0x00, 0x01, 0x01, 0x41,
-	0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x63, 0xFF, 0xEC, 0x03, 0xEA, 0x04, 0x50,
-	0x06, 0x06, 0x00, 0x9D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x63, 0xFF, 0xEC, 0x03, 0xEA, 0x05, 0xC7,
-	0x06, 0x26, 0x00, 0x9D, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x00, 0x88, 0x00, 0x01, 0x00, 0x0D,
-	0xB7, 0x02, 0x01, 0x40, 0x00, 0x01, 0x01, 0xA2, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x1B, 0x00, 0x00, 0x07, 0x36, 0x07, 0x08, 0x06, 0x26, 0x00, 0xDA, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x6A, 0x01, 0xFE, 0x01, 0x42, 0x00, 0x0D, 0xB7, 0x06, 0x05, 0x2D, 0x0D, 0x01, 0x01, 0x83,
-	0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x16, 0x00, 0x00, 0x06, 0x04, 0x05, 0xB1,
-	0x06, 0x26, 0x00, 0xEE, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x01, 0x65, 0xFF, 0xEB, 0x00, 0x0D,
-	0xB7, 0x06, 0x05, 0x2D, 0x0D, 0x01, 0x01, 0xA2, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x50, 0xFF, 0xEC, 0x04, 0x6B, 0x07, 0x1D, 0x06, 0x26, 0x00, 0xDB, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x6A, 0x00, 0xB7, 0x01, 0x57, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x54, 0x15, 0x01, 0x01, 0x84,
-	0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x58, 0xFF, 0xEC, 0x03, 0xAD, 0x05, 0xC5,
-	0x06, 0x26, 0x00, 0xEF, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6A, 0x5F, 0xFF, 0x00, 0x0D, 0xB7, 0x03,
-	0x02, 0x51, 0x14, 0x01, 0x01, 0xA3, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xB2,
-	0x00, 0x00, 0x05, 0x00, 0x06, 0xEF, 0x06, 0x26, 0x00, 0xDC, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70,
-	0x01, 0x04, 0x01, 0x4A, 0x00, 0x0B, 0xB6, 0x01, 0x0C, 0x08, 0x01, 0x01, 0xB1, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x9D, 0x00, 0x00, 0x04, 0x02, 0x05, 0x98, 0x06, 0x26, 0x00, 0xF0,
-	0x00, 0x00, 0x01, 0x06, 0x00, 0x70, 0x75, 0xF3, 0x00, 0x0B, 0xB6, 0x01, 0x0C, 0x08, 0x01, 0x01,
-	0xD0, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xB2, 0x00, 0x00, 0x05, 0x00, 0x07, 0x08,
-	0x06, 0x26, 0x00, 0xDC, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x01, 0x36, 0x01, 0x42, 0x00, 0x0D,
-	0xB7, 0x02, 0x01, 0x1F, 0x01, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x9D, 0x00, 0x00, 0x04, 0x02, 0x05, 0xB1, 0x06, 0x26, 0x00, 0xF0, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x6A, 0x00, 0xA7, 0xFF, 0xEB, 0x00, 0x0D, 0xB7, 0x02, 0x01, 0x1F, 0x01, 0x01, 0x01, 0xA2,
-	0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x77, 0xFF, 0xEC, 0x05, 0x0A, 0x06, 0xFF,
-	0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x01, 0x1C, 0x01, 0x39, 0x00, 0x0D,
-	0xB7, 0x03, 0x02, 0x41, 0x11, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x5C, 0xFF, 0xEC, 0x04, 0x35, 0x05, 0xC6, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x6A, 0x00, 0x98, 0x00, 0x00, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x41, 0x06, 0x01, 0x01, 0xA3,
-	0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x67, 0xFF, 0xEC, 0x04, 0xFA, 0x05, 0xC4,
-	0x06, 0x06, 0x01, 0x17, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5C, 0xFF, 0xEC, 0x04, 0x34, 0x04, 0x4E,
-	0x06, 0x06, 0x01, 0x18, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x67, 0xFF, 0xEC, 0x04, 0xFA, 0x07, 0x03,
-	0x06, 0x26, 0x01, 0x17, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x01, 0x28, 0x01, 0x3D, 0x00, 0x0D,
-	0xB7, 0x04, 0x03, 0x4F, 0x00, 0x01, 0x01, 0x6A, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x5C, 0xFF, 0xEC, 0x04, 0x34, 0x05, 0xC8, 0x06, 0x26, 0x01, 0x18, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x6A, 0x00, 0x88, 0x00, 0x02, 0x00, 0x0D, 0xB7, 0x04, 0x03, 0x41, 0x00, 0x01, 0x01, 0xA5,
-	0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x94, 0xFF, 0xEC, 0x04, 0xF4, 0x07, 0x1E,
-	0x06, 0x26, 0x00, 0xE7, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x01, 0x0D, 0x01, 0x58, 0x00, 0x0D,
-	0xB7, 0x03, 0x02, 0x42, 0x1E, 0x01, 0x01, 0x85, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x64, 0xFF, 0xEB, 0x03, 0xE1, 0x05, 0xC6, 0x06, 0x26, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x06,
-	0x00, 0x6A, 0x7C, 0x00, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x41, 0x09, 0x01, 0x01, 0xA3, 0x56, 0x00,
-	0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x4D, 0xFF, 0xEB, 0x04, 0xCB, 0x06, 0xEF, 0x06, 0x26,
-	0x00, 0xDE, 0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0x00, 0xAD, 0x01, 0x4A, 0x00, 0x0B, 0xB6, 0x02,
-	0x1B, 0x18, 0x01, 0x01, 0xB1, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x16, 0xFE, 0x4B,
-	0x03, 0xB0, 0x05, 0xAD, 0x06, 0x26, 0x00, 0x5D, 0x00, 0x00, 0x01, 0x06, 0x00, 0x70, 0x23, 0x08,
-	0x00, 0x0B, 0xB6, 0x02, 0x1B, 0x18, 0x01, 0x01, 0xE5, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x4D, 0xFF, 0xEB, 0x04, 0xCB, 0x07, 0x08, 0x06, 0x26, 0x00, 0xDE, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x6A, 0x00, 0xDF, 0x01, 0x42, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x2E, 0x01, 0x01, 0x01, 0x83,
-	0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x16, 0xFE, 0x4B, 0x03, 0xB0, 0x05, 0xC6,
-	0x06, 0x26, 0x00, 0x5D, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6A, 0x55, 0x00, 0x00, 0x0D, 0xB7, 0x03,
-	0x02, 0x2E, 0x01, 0x01, 0x01, 0xB7, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x4D,
-	0xFF, 0xEB, 0x04, 0xCB, 0x07, 0x41, 0x06, 0x26, 0x00, 0xDE, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA6,
-	0x01, 0x2E, 0x01, 0x42, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x19, 0x01, 0x01, 0x01, 0x62, 0x56, 0x00,
-	0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x16, 0xFE, 0x4B, 0x03, 0xD0, 0x05, 0xFF, 0x06, 0x26,
-	0x00, 0x5D, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA6, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x0D, 0xB7, 0x03,
-	0x02, 0x19, 0x01, 0x01, 0x01, 0x96, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x97,
-	0x00, 0x00, 0x04, 0xC9, 0x07, 0x08, 0x06, 0x26, 0x00, 0xE1, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A,
-	0x01, 0x09, 0x01, 0x42, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x2F, 0x16, 0x01, 0x01, 0x83, 0x56, 0x00,
-	0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x68, 0x00, 0x00, 0x03, 0xBD, 0x05, 0xB1, 0x06, 0x26,
-	0x00, 0xF9, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6A, 0x65, 0xEB, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x2D,
-	0x03, 0x01, 0x01, 0xA2, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xB2, 0x00, 0x00,
-	0x06, 0x31, 0x07, 0x08, 0x06, 0x26, 0x00, 0xE5, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x01, 0xD3,
-	0x01, 0x42, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x32, 0x1C, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2B, 0x34,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x9E, 0x00, 0x00, 0x05, 0x7F, 0x05, 0xB1, 0x06, 0x26, 0x00, 0xFD,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x01, 0x6D, 0xFF, 0xEB, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x32,
-	0x1C, 0x01, 0x01, 0xA2, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5F, 0xFF, 0xEC,
-	0x03, 0xF1, 0x06, 0x00, 0x06, 0x06, 0x00, 0x48, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x1D, 0xFE, 0xA2,
-	0x05, 0x1E, 0x05, 0xB0, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x05, 0x03,
-	0x00, 0x00, 0x00, 0x0E, 0xB4, 0x03, 0x11, 0x05, 0x01, 0x01, 0xB8, 0xFF, 0x75, 0xB0, 0x56, 0x00,
-	0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x6D, 0xFE, 0xA2, 0x03, 0xEA, 0x04, 0x4E, 0x06, 0x26, 0x00, 0x45,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x04, 0x4B, 0x00, 0x00, 0x00, 0x0E, 0xB4, 0x02, 0x3E, 0x31,
-	0x01, 0x01, 0xB8, 0xFF, 0x89, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00,
-	0x05, 0x1E, 0x07, 0xBB, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAB, 0x04, 0xEE,
-	0x01, 0x47, 0x00, 0x0B, 0xB6, 0x03, 0x0F, 0x07, 0x01, 0x01, 0x71, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x6D, 0xFF, 0xEC, 0x03, 0xEA, 0x06, 0x84, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0xAB, 0x04, 0x94, 0x00, 0x10, 0x00, 0x0B, 0xB6, 0x02, 0x3C, 0x0F, 0x01, 0x01,
-	0x9C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E, 0x07, 0xC4,
-	0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x02, 0x51, 0x00, 0xC2, 0x01, 0x2F, 0x00, 0x0D,
-	0xB7, 0x04, 0x03, 0x12, 0x07, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x6D, 0xFF, 0xEC, 0x04, 0xC0, 0x06, 0x8D, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x06,
-	0x02, 0x51, 0x68, 0xF8, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x41, 0x0F, 0x01, 0x01, 0x8C, 0x56, 0x00,
-	0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E, 0x07, 0xC0, 0x06, 0x26,
-	0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x02, 0x52, 0x00, 0xC6, 0x01, 0x3D, 0x00, 0x0D, 0xB7, 0x04,
-	0x03, 0x10, 0x07, 0x01, 0x01, 0x5C, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xC9,
-	0xFF, 0xEC, 0x03, 0xEA, 0x06, 0x89, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x06, 0x02, 0x52,
-	0x6C, 0x06, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x3D, 0x0F, 0x01, 0x01, 0x87, 0x56, 0x00, 0x2B, 0x34,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E, 0x07, 0xEC, 0x06, 0x26, 0x00, 0x25,
-	0x00, 0x00, 0x01, 0x07, 0x02, 0x53, 0x00, 0xC7, 0x01, 0x1C, 0x00, 0x0D, 0xB7, 0x04, 0x03, 0x13,
-	0x03, 0x01, 0x01, 0x50, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x6D, 0xFF, 0xEC,
-	0x04, 0x5A, 0x06, 0xB5, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x06, 0x02, 0x53, 0x6D, 0xE5,
-	0x00, 0x0D, 0xB7, 0x03, 0x02, 0x40, 0x0F, 0x01, 0x01, 0x7B, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E, 0x07, 0xDA, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00,
-	0x01, 0x07, 0x02, 0x54, 0x00, 0xC7, 0x01, 0x06, 0x00, 0x0D, 0xB7, 0x04, 0x03, 0x10, 0x07, 0x01,
-	0x01, 0x3A, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x6D, 0xFF, 0xEC, 0x03, 0xEA,
-	0x06, 0xA3, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x06, 0x02, 0x54, 0x6D, 0xCF, 0x00, 0x0D,
-	0xB7, 0x03, 0x02, 0x3D, 0x0F, 0x01, 0x01, 0x65, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x1D, 0xFE, 0xA2, 0x05, 0x1E, 0x07, 0x37, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x27,
-	0x00, 0x9E, 0x00, 0xC9, 0x01, 0x37, 0x01, 0x07, 0x00, 0xAD, 0x05, 0x03, 0x00, 0x00, 0x00, 0x17,
-	0xB4, 0x04, 0x1A, 0x05, 0x01, 0x01, 0xB8, 0xFF, 0x75, 0xB7, 0x56, 0x03, 0x11, 0x07, 0x01, 0x01,
-	0x6C, 0x56, 0x00, 0x2B, 0x34, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x6D, 0xFE, 0xA2, 0x03, 0xEA,
-	0x06, 0x00, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x00, 0x26, 0x00, 0x9E, 0x6F, 0x00, 0x01, 0x07,
-	0x00, 0xAD, 0x04, 0x4B, 0x00, 0x00, 0x00, 0x17, 0xB4, 0x03, 0x47, 0x31, 0x01, 0x01, 0xB8, 0xFF,
-	0x89, 0xB7, 0x56, 0x02, 0x3E, 0x0F, 0x01, 0x01, 0x97, 0x56, 0x00, 0x2B, 0x34, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E, 0x07, 0xB8, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00,
-	0x01, 0x07, 0x02, 0x56, 0x00, 0xEA, 0x01, 0x2D, 0x00, 0x0D, 0xB7, 0x04, 0x03, 0x13, 0x07, 0x01,
-	0x01, 0x5C, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x6D, 0xFF, 0xEC, 0x03, 0xEA,
-	0x06, 0x81, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x02, 0x56, 0x00, 0x90, 0xFF, 0xF6,
-	0x00, 0x0D, 0xB7, 0x03, 0x02, 0x40, 0x0F, 0x01, 0x01, 0x87, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E, 0x07, 0xB8, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00,
-	0x01, 0x07, 0x02, 0x4F, 0x00, 0xEA, 0x01, 0x2D, 0x00, 0x0D, 0xB7, 0x04, 0x03, 0x13, 0x07, 0x01,
-	0x01, 0x5C, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x6D, 0xFF, 0xEC, 0x03, 0xEA,
-	0x06, 0x81, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x02, 0x4F, 0x00, 0x90, 0xFF, 0xF6,
-	0x00, 0x0D, 0xB7, 0x03, 0x02, 0x40, 0x0F, 0x01, 0x01, 0x87, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E, 0x08, 0x42, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00,
-	0x01, 0x07, 0x02, 0x57, 0x00, 0xEE, 0x01, 0x3E, 0x00, 0x0D, 0xB7, 0x04, 0x03, 0x13, 0x07, 0x01,
-	0x01, 0x6E, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x6D, 0xFF, 0xEC, 0x03, 0xEA,
-	0x07, 0x0B, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x02, 0x57, 0x00, 0x94, 0x00, 0x07,
-	0x00, 0x0D, 0xB7, 0x03, 0x02, 0x40, 0x0F, 0x01, 0x01, 0x99, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E, 0x08, 0x16, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00,
-	0x01, 0x07, 0x02, 0x6A, 0x00, 0xEE, 0x01, 0x46, 0x00, 0x0D, 0xB7, 0x04, 0x03, 0x13, 0x07, 0x01,
-	0x01, 0x6F, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x6D, 0xFF, 0xEC, 0x03, 0xEA,
-	0x06, 0xDF, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6A, 0x00, 0x94, 0x00, 0x0F,
-	0x00, 0x0D, 0xB7, 0x03, 0x02, 0x40, 0x0F, 0x01, 0x01, 0x9A, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x1D, 0xFE, 0xA2, 0x05, 0x1E, 0x07, 0x0E, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00,
-	0x00, 0x27, 0x00, 0xA1, 0x00, 0xF3, 0x01, 0x37, 0x01, 0x07, 0x00, 0xAD, 0x05, 0x03, 0x00, 0x00,
-	0x00, 0x17, 0xB4, 0x04, 0x20, 0x05, 0x01, 0x01, 0xB8, 0xFF, 0x75, 0xB7, 0x56, 0x03, 0x13, 0x07,
-	0x01, 0x01, 0x53, 0x56, 0x00, 0x2B, 0x34, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x6D, 0xFE, 0xA2,
-	0x03, 0xEA, 0x05, 0xD7, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x00, 0x27, 0x00, 0xA1, 0x00, 0x99,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x04, 0x4B, 0x00, 0x00, 0x00, 0x17, 0xB4, 0x03, 0x4D, 0x31,
-	0x01, 0x01, 0xB8, 0xFF, 0x89, 0xB7, 0x56, 0x02, 0x40, 0x0F, 0x01, 0x01, 0x7E, 0x56, 0x00, 0x2B,
-	0x34, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0xFE, 0xAC, 0x04, 0x46, 0x05, 0xB0, 0x06, 0x26,
-	0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x04, 0xC0, 0x00, 0x0A, 0x00, 0x0E, 0xB4, 0x04,
-	0x13, 0x02, 0x01, 0x01, 0xB8, 0xFF, 0x7F, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x5D,
-	0xFE, 0xA2, 0x03, 0xF3, 0x04, 0x4E, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD,
-	0x04, 0x8D, 0x00, 0x00, 0x00, 0x0E, 0xB4, 0x01, 0x2F, 0x00, 0x01, 0x01, 0xB8, 0xFF, 0x89, 0xB0,
-	0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00, 0x04, 0x46, 0x07, 0xC6, 0x06, 0x26,
-	0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAB, 0x04, 0xB9, 0x01, 0x52, 0x00, 0x0B, 0xB6, 0x04,
-	0x11, 0x07, 0x01, 0x01, 0x7C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5D, 0xFF, 0xEC,
-	0x03, 0xF3, 0x06, 0x84, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAB, 0x04, 0x83,
-	0x00, 0x10, 0x00, 0x0B, 0xB6, 0x01, 0x2D, 0x0B, 0x01, 0x01, 0x9C, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00, 0x04, 0x46, 0x07, 0x2E, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0xA5, 0x00, 0x8F, 0x01, 0x46, 0x00, 0x0B, 0xB6, 0x04, 0x1E, 0x07, 0x01, 0x01,
-	0x76, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5D, 0xFF, 0xEC, 0x03, 0xF3, 0x05, 0xEC,
-	0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x06, 0x00, 0xA5, 0x59, 0x04, 0x00, 0x0B, 0xB6, 0x01,
-	0x3A, 0x0B, 0x01, 0x01, 0x96, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00,
-	0x04, 0xE5, 0x07, 0xCF, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x02, 0x51, 0x00, 0x8D,
-	0x01, 0x3A, 0x00, 0x0D, 0xB7, 0x05, 0x04, 0x14, 0x07, 0x01, 0x01, 0x6C, 0x56, 0x00, 0x2B, 0x34,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5D, 0xFF, 0xEC, 0x04, 0xAF, 0x06, 0x8D, 0x06, 0x26, 0x00, 0x49,
-	0x00, 0x00, 0x01, 0x06, 0x02, 0x51, 0x57, 0xF8, 0x00, 0x0D, 0xB7, 0x02, 0x01, 0x30, 0x0B, 0x01,
-	0x01, 0x8C, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xEE, 0x00, 0x00, 0x04, 0x46,
-	0x07, 0xCB, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x02, 0x52, 0x00, 0x91, 0x01, 0x48,
-	0x00, 0x0D, 0xB7, 0x05, 0x04, 0x12, 0x07, 0x01, 0x01, 0x67, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00,
-	0xFF, 0xFF, 0xFF, 0xB8, 0xFF, 0xEC, 0x03, 0xF3, 0x06, 0x89, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00,
-	0x01, 0x06, 0x02, 0x52, 0x5B, 0x06, 0x00, 0x0D, 0xB7, 0x02, 0x01, 0x2E, 0x0B, 0x01, 0x01, 0x87,
-	0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00, 0x04, 0x7F, 0x07, 0xF7,
-	0x06, 0x26, 0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x02, 0x53, 0x00, 0x92, 0x01, 0x27, 0x00, 0x0D,
-	0xB7, 0x05, 0x04, 0x15, 0x07, 0x01, 0x01, 0x5B, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x5D, 0xFF, 0xEC, 0x04, 0x49, 0x06, 0xB5, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x06,
-	0x02, 0x53, 0x5C, 0xE5, 0x00, 0x0D, 0xB7, 0x02, 0x01, 0x31, 0x0B, 0x01, 0x01, 0x7B, 0x56, 0x00,
-	0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00, 0x04, 0x46, 0x07, 0xE5, 0x06, 0x26,
-	0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x02, 0x54, 0x00, 0x92, 0x01, 0x11, 0x00, 0x0D, 0xB7, 0x05,
-	0x04, 0x12, 0x07, 0x01, 0x01, 0x45, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5D,
-	0xFF, 0xEC, 0x03, 0xF3, 0x06, 0xA3, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x06, 0x02, 0x54,
-	0x5C, 0xCF, 0x00, 0x0D, 0xB7, 0x02, 0x01, 0x2E, 0x0B, 0x01, 0x01, 0x65, 0x56, 0x00, 0x2B, 0x34,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0xFE, 0xAC, 0x04, 0x46, 0x07, 0x42, 0x06, 0x26, 0x00, 0x29,
-	0x00, 0x00, 0x00, 0x27, 0x00, 0x9E, 0x00, 0x94, 0x01, 0x42, 0x01, 0x07, 0x00, 0xAD, 0x04, 0xC0,
-	0x00, 0x0A, 0x00, 0x17, 0xB4, 0x05, 0x1C, 0x02, 0x01, 0x01, 0xB8, 0xFF, 0x7F, 0xB7, 0x56, 0x04,
-	0x13, 0x07, 0x01, 0x01, 0x77, 0x56, 0x00, 0x2B, 0x34, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5D,
-	0xFE, 0xA2, 0x03, 0xF3, 0x06, 0x00, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x00, 0x26, 0x00, 0x9E,
-	0x5E, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x04, 0x8D, 0x00, 0x00, 0x00, 0x17, 0xB4, 0x02, 0x38, 0x00,
-	0x01, 0x01, 0xB8, 0xFF, 0x89, 0xB7, 0x56, 0x01, 0x2F, 0x0B, 0x01, 0x01, 0x97, 0x56, 0x00, 0x2B,
-	0x34, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xB7, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xC6, 0x06, 0x26,
-	0x00, 0x2D, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAB, 0x03, 0x65, 0x01, 0x52, 0x00, 0x0B, 0xB6, 0x01,
-	0x05, 0x03, 0x01, 0x01, 0x7C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x9C, 0x00, 0x00,
-	0x01, 0xDD, 0x06, 0x82, 0x06, 0x26, 0x00, 0x8D, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAB, 0x03, 0x4A,
-	0x00, 0x0E, 0x00, 0x0B, 0xB6, 0x01, 0x05, 0x03, 0x01, 0x01, 0xAE, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0xA4, 0xFE, 0xAB, 0x01, 0x7F, 0x05, 0xB0, 0x06, 0x26, 0x00, 0x2D, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0xAD, 0x03, 0x6C, 0x00, 0x09, 0x00, 0x0E, 0xB4, 0x01, 0x07, 0x02, 0x01, 0x01,
-	0xB8, 0xFF, 0x7E, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x86, 0xFE, 0xAC, 0x01, 0x69,
-	0x05, 0xC4, 0x06, 0x26, 0x00, 0x4D, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x03, 0x4E, 0x00, 0x0A,
-	0x00, 0x0E, 0xB4, 0x02, 0x13, 0x02, 0x01, 0x01, 0xB8, 0xFF, 0x7F, 0xB0, 0x56, 0x00, 0x2B, 0x34,
-	0xFF, 0xFF, 0x00, 0x77, 0xFE, 0xA2, 0x05, 0x0A, 0x05, 0xC4, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0xAD, 0x05, 0x18, 0x00, 0x00, 0x00, 0x0E, 0xB4, 0x02, 0x2F, 0x06, 0x01, 0x01,
-	0xB8, 0xFF, 0x89, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x5C, 0xFE, 0xA1, 0x04, 0x35,
-	0x04, 0x4E, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x04, 0x9D, 0xFF, 0xFF,
-	0x00, 0x0E, 0xB4, 0x02, 0x2F, 0x11, 0x01, 0x01, 0xB8, 0xFF, 0x88, 0xB0, 0x56, 0x00, 0x2B, 0x34,
-	0xFF, 0xFF, 0x00, 0x77, 0xFF, 0xEC, 0x05, 0x0A, 0x07, 0xBD, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0xAB, 0x05, 0x11, 0x01, 0x49, 0x00, 0x0B, 0xB6, 0x02, 0x2D, 0x11, 0x01, 0x01,
-	0x5F, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5C, 0xFF, 0xEC, 0x04, 0x35, 0x06, 0x84,
-	0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAB, 0x04, 0x8D, 0x00, 0x10, 0x00, 0x0B,
-	0xB6, 0x02, 0x2D, 0x06, 0x01, 0x01, 0x9C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x77,
-	0xFF, 0xEC, 0x05, 0x3D, 0x07, 0xC6, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x02, 0x51,
-	0x00, 0xE5, 0x01, 0x31, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x30, 0x11, 0x01, 0x01, 0x4F, 0x56, 0x00,
-	0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5C, 0xFF, 0xEC, 0x04, 0xB9, 0x06, 0x8D, 0x06, 0x26,
-	0x00, 0x53, 0x00, 0x00, 0x01, 0x06, 0x02, 0x51, 0x61, 0xF8, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x30,
-	0x06, 0x01, 0x01, 0x8C, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x46, 0xFF, 0xEC,
-	0x05, 0x0A, 0x07, 0xC2, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x02, 0x52, 0x00, 0xE9,
-	0x01, 0x3F, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x2E, 0x11, 0x01, 0x01, 0x4A, 0x56, 0x00, 0x2B, 0x34,
-	0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0xEC, 0x04, 0x35, 0x06, 0x89, 0x06, 0x26, 0x00, 0x53,
-	0x00, 0x00, 0x01, 0x06, 0x02, 0x52, 0x65, 0x06, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x2E, 0x06, 0x01,
-	0x01, 0x87, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x77, 0xFF, 0xEC, 0x05, 0x0A,
-	0x07, 0xEE, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x02, 0x53, 0x00, 0xEA, 0x01, 0x1E,
-	0x00, 0x0D, 0xB7, 0x03, 0x02, 0x31, 0x11, 0x01, 0x01, 0x3E, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x5C, 0xFF, 0xEC, 0x04, 0x53, 0x06, 0xB5, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00,
-	0x01, 0x06, 0x02, 0x53, 0x66, 0xE5, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x31, 0x06, 0x01, 0x01, 0x7B,
-	0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x77, 0xFF, 0xEC, 0x05, 0x0A, 0x07, 0xDC,
-	0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x02, 0x54, 0x00, 0xEA, 0x01, 0x08, 0x00, 0x0D,
-	0xB7, 0x03, 0x02, 0x2E, 0x11, 0x01, 0x01, 0x28, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x5C, 0xFF, 0xEC, 0x04, 0x35, 0x06, 0xA3, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x06,
-	0x02, 0x54, 0x66, 0xCF, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x2E, 0x06, 0x01, 0x01, 0x65, 0x56, 0x00,
-	0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x77, 0xFE, 0xA2, 0x05, 0x0A, 0x07, 0x39, 0x06, 0x26,
-	0x00, 0x33, 0x00, 0x00, 0x00, 0x27, 0x00, 0x9E, 0x00, 0xEC, 0x01, 0x39, 0x01, 0x07, 0x00, 0xAD,
-	0x05, 0x18, 0x00, 0x00, 0x00, 0x17, 0xB4, 0x03, 0x38, 0x06, 0x01, 0x01, 0xB8, 0xFF, 0x89, 0xB7,
-	0x56, 0x02, 0x2F, 0x11, 0x01, 0x01, 0x5A, 0x56, 0x00, 0x2B, 0x34, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x5C, 0xFE, 0xA1, 0x04, 0x35, 0x06, 0x00, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x26,
-	0x00, 0x9E, 0x68, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x04, 0x9D, 0xFF, 0xFF, 0x00, 0x17, 0xB4, 0x03,
-	0x38, 0x11, 0x01, 0x01, 0xB8, 0xFF, 0x88, 0xB7, 0x56, 0x02, 0x2F, 0x06, 0x01, 0x01, 0x97, 0x56,
-	0x00, 0x2B, 0x34, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x66, 0xFF, 0xEC, 0x05, 0x9D, 0x07, 0x31,
-	0x06, 0x26, 0x00, 0x98, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0xDE, 0x01, 0x31, 0x00, 0x0B,
-	0xB6, 0x03, 0x3A, 0x1C, 0x01, 0x01, 0x47, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5C,
-	0xFF, 0xEC, 0x04, 0xBA, 0x06, 0x00, 0x06, 0x26, 0x00, 0x99, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75,
-	0x01, 0x65, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x03, 0x36, 0x10, 0x01, 0x01, 0x8C, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x66, 0xFF, 0xEC, 0x05, 0x9D, 0x07, 0x31, 0x06, 0x26, 0x00, 0x98,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x01, 0x4E, 0x01, 0x31, 0x00, 0x0B, 0xB6, 0x03, 0x3C, 0x1C,
-	0x01, 0x01, 0x47, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5C, 0xFF, 0xEC, 0x04, 0xBA,
-	0x06, 0x00, 0x06, 0x26, 0x00, 0x99, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xD5, 0x00, 0x00,
-	0x00, 0x0B, 0xB6, 0x03, 0x38, 0x10, 0x01, 0x01, 0x8C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x66, 0xFF, 0xEC, 0x05, 0x9D, 0x07, 0xB5, 0x06, 0x26, 0x00, 0x98, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0xAB, 0x05, 0x0D, 0x01, 0x41, 0x00, 0x0B, 0xB6, 0x03, 0x3B, 0x1C, 0x01, 0x01, 0x57, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5C, 0xFF, 0xEC, 0x04, 0xBA, 0x06, 0x84, 0x06, 0x26,
-	0x00, 0x99, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAB, 0x04, 0x94, 0x00, 0x10, 0x00, 0x0B, 0xB6, 0x03,
-	0x37, 0x10, 0x01, 0x01, 0x9C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x66, 0xFF, 0xEC,
-	0x05, 0x9D, 0x07, 0x1D, 0x06, 0x26, 0x00, 0x98, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA5, 0x00, 0xE3,
-	0x01, 0x35, 0x00, 0x0B, 0xB6, 0x03, 0x48, 0x1C, 0x01, 0x01, 0x51, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x5C, 0xFF, 0xEC, 0x04, 0xBA, 0x05, 0xEC, 0x06, 0x26, 0x00, 0x99, 0x00, 0x00,
-	0x01, 0x06, 0x00, 0xA5, 0x6A, 0x04, 0x00, 0x0B, 0xB6, 0x03, 0x44, 0x10, 0x01, 0x01, 0x96, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x66, 0xFE, 0xA2, 0x05, 0x9D, 0x06, 0x38, 0x06, 0x26,
-	0x00, 0x98, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x05, 0x09, 0x00, 0x00, 0x00, 0x0E, 0xB4, 0x03,
-	0x3D, 0x10, 0x01, 0x01, 0xB8, 0xFF, 0x89, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x5C,
-	0xFE, 0x98, 0x04, 0xBA, 0x04, 0xB1, 0x06, 0x26, 0x00, 0x99, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD,
-	0x04, 0x9B, 0xFF, 0xF6, 0x00, 0x0E, 0xB4, 0x03, 0x39, 0x1B, 0x01, 0x01, 0xB8, 0xFF, 0x7F, 0xB0,
-	0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x8C, 0xFE, 0xA2, 0x04, 0xAA, 0x05, 0xB0, 0x06, 0x26,
-	0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x04, 0xEF, 0x00, 0x00, 0x00, 0x0E, 0xB4, 0x01,
-	0x19, 0x06, 0x01, 0x01, 0xB8, 0xFF, 0x89, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x89,
-	0xFE, 0xA2, 0x03, 0xDD, 0x04, 0x3A, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD,
-	0x04, 0x52, 0x00, 0x00, 0x00, 0x0E, 0xB4, 0x02, 0x1F, 0x0B, 0x01, 0x01, 0xB8, 0xFF, 0x89, 0xB0,
-	0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x8C, 0xFF, 0xEC, 0x04, 0xAA, 0x07, 0xBB, 0x06, 0x26,
-	0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAB, 0x04, 0xE9, 0x01, 0x47, 0x00, 0x0B, 0xB6, 0x01,
-	0x17, 0x00, 0x01, 0x01, 0x71, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x89, 0xFF, 0xEC,
-	0x03, 0xDD, 0x06, 0x84, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAB, 0x04, 0x85,
-	0x00, 0x10, 0x00, 0x0B, 0xB6, 0x02, 0x1D, 0x11, 0x01, 0x01, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x8C, 0xFF, 0xEC, 0x06, 0x1D, 0x07, 0x42, 0x06, 0x26, 0x00, 0x9A, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x75, 0x01, 0xD5, 0x01, 0x42, 0x00, 0x0B, 0xB6, 0x02, 0x20, 0x0A, 0x01, 0x01,
-	0x6C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x89, 0xFF, 0xEC, 0x05, 0x10, 0x05, 0xEB,
-	0x06, 0x26, 0x00, 0x9B, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x63, 0xFF, 0xEB, 0x00, 0x0B,
-	0xB6, 0x03, 0x26, 0x1B, 0x01, 0x01, 0x8B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8C,
-	0xFF, 0xEC, 0x06, 0x1D, 0x07, 0x42, 0x06, 0x26, 0x00, 0x9A, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44,
-	0x01, 0x45, 0x01, 0x42, 0x00, 0x0B, 0xB6, 0x02, 0x22, 0x0A, 0x01, 0x01, 0x6C, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x89, 0xFF, 0xEC, 0x05, 0x10, 0x05, 0xEB, 0x06, 0x26, 0x00, 0x9B,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x00, 0xD3, 0xFF, 0xEB, 0x00, 0x0B, 0xB6, 0x03, 0x28, 0x1B,
-	0x01, 0x01, 0x8B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8C, 0xFF, 0xEC, 0x06, 0x1D,
-	0x07, 0xC6, 0x06, 0x26, 0x00, 0x9A, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAB, 0x05, 0x04, 0x01, 0x52,
-	0x00, 0x0B, 0xB6, 0x02, 0x21, 0x0A, 0x01, 0x01, 0x7C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x89, 0xFF, 0xEC, 0x05, 0x10, 0x06, 0x6F, 0x06, 0x26, 0x00, 0x9B, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0xAB, 0x04, 0x92, 0xFF, 0xFB, 0x00, 0x0B, 0xB6, 0x03, 0x27, 0x1B, 0x01, 0x01, 0x9B, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8C, 0xFF, 0xEC, 0x06, 0x1D, 0x07, 0x2E, 0x06, 0x26,
-	0x00, 0x9A, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA5, 0x00, 0xDA, 0x01, 0x46, 0x00, 0x0B, 0xB6, 0x02,
-	0x2E, 0x15, 0x01, 0x01, 0x76, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x89, 0xFF, 0xEC,
-	0x05, 0x10, 0x05, 0xD7, 0x06, 0x26, 0x00, 0x9B, 0x00, 0x00, 0x01, 0x06, 0x00, 0xA5, 0x68, 0xEF,
-	0x00, 0x0B, 0xB6, 0x03, 0x34, 0x1B, 0x01, 0x01, 0x95, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x8C, 0xFE, 0x99, 0x06, 0x1D, 0x06, 0x02, 0x06, 0x26, 0x00, 0x9A, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0xAD, 0x05, 0x09, 0xFF, 0xF7, 0x00, 0x0E, 0xB4, 0x02, 0x23, 0x10, 0x01, 0x01, 0xB8, 0xFF,
-	0x80, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x89, 0xFE, 0xA2, 0x05, 0x10, 0x04, 0x91,
-	0x06, 0x26, 0x00, 0x9B, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x04, 0x88, 0x00, 0x00, 0x00, 0x0E,
-	0xB4, 0x03, 0x29, 0x15, 0x01, 0x01, 0xB8, 0xFF, 0x89, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF,
-	0x00, 0x0F, 0xFE, 0xA3, 0x04, 0xBC, 0x05, 0xB0, 0x06, 0x26, 0x00, 0x3D, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0xAD, 0x04, 0xBC, 0x00, 0x01, 0x00, 0x0E, 0xB4, 0x01, 0x0C, 0x06, 0x01, 0x01, 0xB8, 0xFF,
-	0x76, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x16, 0xFE, 0x04, 0x03, 0xB0, 0x04, 0x3A,
-	0x06, 0x26, 0x00, 0x5D, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x05, 0x1D, 0xFF, 0x62, 0x00, 0x0E,
-	0xB4, 0x02, 0x22, 0x08, 0x00, 0x00, 0xB8, 0xFF, 0xB9, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF,
-	0x00, 0x0F, 0x00, 0x00, 0x04, 0xBC, 0x07, 0xBA, 0x06, 0x26, 0x00, 0x3D, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0xAB, 0x04, 0xB8, 0x01, 0x46, 0x00, 0x0B, 0xB6, 0x01, 0x0A, 0x02, 0x01, 0x01, 0x70, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x16, 0xFE, 0x4B, 0x03, 0xB0, 0x06, 0x84, 0x06, 0x26,
-	0x00, 0x5D, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAB, 0x04, 0x4A, 0x00, 0x10, 0x00, 0x0B, 0xB6, 0x02,
-	0x1A, 0x01, 0x01, 0x01, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00,
-	0x04, 0xBC, 0x07, 0x22, 0x06, 0x26, 0x00, 0x3D, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA5, 0x00, 0x8E,
-	0x01, 0x3A, 0x00, 0x0B, 0xB6, 0x01, 0x17, 0x08, 0x01, 0x01, 0x6A, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x16, 0xFE, 0x4B, 0x03, 0xB0, 0x05, 0xEC, 0x06, 0x26, 0x00, 0x5D, 0x00, 0x00,
-	0x01, 0x06, 0x00, 0xA5, 0x20, 0x04, 0x00, 0x0B, 0xB6, 0x02, 0x27, 0x18, 0x01, 0x01, 0xAA, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5F, 0xFE, 0xCB, 0x04, 0xAD, 0x06, 0x00, 0x04, 0x26,
-	0x00, 0x48, 0x00, 0x00, 0x00, 0x27, 0x02, 0x40, 0x01, 0xA1, 0x02, 0x46, 0x01, 0x07, 0x00, 0x43,
-	0x00, 0x9F, 0xFF, 0x63, 0x00, 0x17, 0xB4, 0x04, 0x37, 0x16, 0x01, 0x01, 0xB8, 0xFF, 0x77, 0xB7,
-	0x56, 0x03, 0x32, 0x0B, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2B, 0x34, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x32, 0xFE, 0x99, 0x04, 0x97, 0x05, 0xB0, 0x06, 0x26, 0x00, 0x38, 0x00, 0x00, 0x01, 0x07,
-	0x02, 0x6B, 0x02, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x0B, 0x02, 0x00, 0x00, 0x9A, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFE, 0x99, 0x03, 0xB1, 0x04, 0x3A, 0x06, 0x26,
-	0x00, 0xF6, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6B, 0x01, 0xC7, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02,
-	0x0B, 0x02, 0x00, 0x00, 0x9A, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x97, 0xFE, 0x99,
-	0x04, 0xC9, 0x05, 0xB0, 0x06, 0x26, 0x00, 0xE1, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6B, 0x02, 0xFE,
-	0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x1D, 0x19, 0x01, 0x00, 0x9A, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x68, 0xFE, 0x99, 0x03, 0xBD, 0x04, 0x3C, 0x06, 0x26, 0x00, 0xF9, 0x00, 0x00,
-	0x01, 0x07, 0x02, 0x6B, 0x01, 0xF6, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x1B, 0x02, 0x01, 0x00,
-	0x9A, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xB2, 0xFE, 0x99, 0x04, 0x30, 0x05, 0xB0,
-	0x06, 0x26, 0x00, 0xB1, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6B, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x0B,
-	0xB6, 0x01, 0x09, 0x04, 0x00, 0x00, 0x9A, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x9B,
-	0xFE, 0x99, 0x03, 0x48, 0x04, 0x3A, 0x06, 0x26, 0x00, 0xEC, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6B,
-	0x00, 0xD5, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x01, 0x09, 0x04, 0x00, 0x00, 0x9A, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFE, 0x53, 0x05, 0xBE, 0x05, 0xC4, 0x06, 0x26, 0x01, 0x4C,
-	0x00, 0x00, 0x01, 0x07, 0x02, 0x6B, 0x03, 0x06, 0xFF, 0xBA, 0x00, 0x0B, 0xB6, 0x02, 0x3A, 0x0A,
-	0x00, 0x00, 0x6B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0xDD, 0xFE, 0x56, 0x04, 0x64,
-	0x04, 0x4E, 0x06, 0x26, 0x01, 0x4D, 0x00, 0x00, 0x01, 0x07, 0x02, 0x6B, 0x02, 0x00, 0xFF, 0xBD,
-	0x00, 0x0B, 0xB6, 0x02, 0x39, 0x09, 0x00, 0x00, 0x6B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x8D, 0x00, 0x00, 0x03, 0xE0, 0x06, 0x00, 0x06, 0x06, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x02,
-	0xFF, 0xD4, 0x00, 0x00, 0x04, 0xB1, 0x05, 0xB0, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x1A, 0x40, 0x0C,
-	0x1C, 0x1B, 0x18, 0x00, 0x00, 0x0B, 0x0C, 0x02, 0x72, 0x0E, 0x0B, 0x08, 0x00, 0x3F, 0x33, 0x2B,
-	0x12, 0x39, 0x2F, 0x33, 0xCC, 0x32, 0x30, 0x31, 0x41, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E,
-	0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21,
-	0x01, 0x15, 0x21, 0x35, 0x01, 0x36, 0x01, 0x8D, 0xA0, 0xDC, 0x72, 0x40, 0x7E, 0xB8, 0x78, 0xFD,
-	0xE0, 0xC1, 0x01, 0x5F, 0x6B, 0x85, 0x3E, 0x3E, 0x85, 0x6B, 0xFE, 0x73, 0x01, 0x1B, 0xFD, 0x83,
-	0x03, 0x5F, 0x6B, 0xC0, 0x81, 0x60, 0x9F, 0x75, 0x3F, 0x05, 0xB0, 0xFA, 0xED, 0x4F, 0x80, 0x49,
-	0x49, 0x7A, 0x49, 0x02, 0x26, 0x98, 0x98, 0x00, 0x00, 0x02, 0xFF, 0xD4, 0x00, 0x00, 0x04, 0xB1,
-	0x05, 0xB0, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x19, 0x40, 0x0B, 0x1C, 0x1B, 0x18, 0x00, 0x00, 0x0B,
-	0x0C, 0x02, 0x0E, 0x0B, 0x08, 0x00, 0x3F, 0x33, 0x3F, 0x12, 0x39, 0x2F, 0x33, 0xCC, 0x32, 0x30,
-	0x31, 0x41, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x21, 0x11, 0x33, 0x11, 0x21,
-	0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x21, 0x01, 0x15, 0x21, 0x35, 0x01, 0x36, 0x01,
-	0x8D, 0xA0, 0xDC, 0x72, 0x40, 0x7E, 0xB8, 0x78, 0xFD, 0xE0, 0xC1, 0x01, 0x5F, 0x6B, 0x85, 0x3E,
-	0x3E, 0x85, 0x6B, 0xFE, 0x73, 0x01, 0x1B, 0xFD, 0x83, 0x03, 0x5F, 0x6B, 0xC0, 0x81, 0x60, 0x9F,
-	0x75, 0x3F, 0x05, 0xB0, 0xFA, 0xED, 0x4F, 0x80, 0x49, 0x49, 0x7A, 0x49, 0x02, 0x26, 0x98, 0x98,
-	0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x04, 0x30, 0x05, 0xB0, 0x00, 0x05, 0x00, 0x09, 0x00, 0x16,
-	0x40, 0x0A, 0x06, 0x07, 0x07, 0x04, 0x02, 0x05, 0x02, 0x72, 0x04, 0x08, 0x00, 0x3F, 0x2B, 0x32,
-	0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x11, 0x23, 0x11, 0x01, 0x15, 0x21, 0x35,
-	0x04, 0x30, 0xFD, 0x42, 0xC0, 0x01, 0xCE, 0xFD, 0x83, 0x05, 0xB0, 0x9E, 0xFA, 0xEE, 0x05, 0xB0,
-	0xFD, 0x93, 0x98, 0x98, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x03, 0x48, 0x04, 0x3A, 0x00, 0x05,
-	0x00, 0x09, 0x00, 0x16, 0x40, 0x0A, 0x09, 0x08, 0x08, 0x04, 0x02, 0x05, 0x06, 0x72, 0x04, 0x0A,
-	0x00, 0x3F, 0x2B, 0x32, 0x12, 0x39, 0x2F, 0x33, 0x30, 0x31, 0x41, 0x15, 0x21, 0x11, 0x23, 0x11,
-	0x01, 0x15, 0x21, 0x35, 0x03, 0x48, 0xFE, 0x0C, 0xB9, 0x01, 0xDF, 0xFD, 0x83, 0x04, 0x3A, 0x99,
-	0xFC, 0x5F, 0x04, 0x3A, 0xFE, 0x3C, 0x98, 0x98, 0x00, 0x04, 0x00, 0x0B, 0x00, 0x00, 0x05, 0x32,
-	0x05, 0xB0, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x2B, 0x40, 0x15, 0x0C, 0x0B,
-	0x0B, 0x07, 0x07, 0x06, 0x10, 0x11, 0x06, 0x11, 0x06, 0x11, 0x02, 0x09, 0x03, 0x02, 0x72, 0x0A,
-	0x02, 0x08, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x32, 0x11, 0x39, 0x39, 0x2F, 0x2F, 0x11, 0x33, 0x11,
-	0x33, 0x12, 0x39, 0x11, 0x33, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x21, 0x01, 0x21, 0x27, 0x21,
-	0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x15, 0x21, 0x35, 0x01, 0x87, 0xC1, 0x04, 0x42, 0xFD, 0x88,
-	0xFE, 0xAA, 0x1E, 0x01, 0x01, 0x01, 0xFC, 0x2D, 0xFD, 0xDD, 0x6C, 0x02, 0xA3, 0xFD, 0x56, 0xFD,
-	0x83, 0x05, 0xB0, 0xFA, 0x50, 0x05, 0xB0, 0xFC, 0xDF, 0xA0, 0x02, 0x81, 0xFA, 0x50, 0x02, 0xA8,
-	0xA9, 0xFC, 0xAF, 0x04, 0xCE, 0x98, 0x98, 0x00, 0x00, 0x04, 0xFF, 0xD3, 0x00, 0x00, 0x04, 0x29,
-	0x06, 0x00, 0x00, 0x03, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x2D, 0x40, 0x17, 0x04, 0x06,
-	0x72, 0x0C, 0x0B, 0x0B, 0x07, 0x07, 0x06, 0x10, 0x11, 0x06, 0x11, 0x06, 0x11, 0x02, 0x03, 0x00,
-	0x72, 0x0A, 0x02, 0x0A, 0x72, 0x00, 0x2B, 0x32, 0x2B, 0x11, 0x39, 0x39, 0x2F, 0x2F, 0x11, 0x33,
-	0x11, 0x33, 0x12, 0x39, 0x11, 0x33, 0x2B, 0x30, 0x31, 0x41, 0x11, 0x23, 0x11, 0x01, 0x01, 0x21,
-	0x27, 0x33, 0x01, 0x13, 0x01, 0x37, 0x01, 0x01, 0x15, 0x21, 0x35, 0x01, 0x60, 0xB9, 0x03, 0x4E,
-	0xFE, 0x43, 0xFE, 0xE6, 0x16, 0xD6, 0x01, 0x3B, 0x34, 0xFE, 0x8C, 0x62, 0x01, 0xEE, 0xFE, 0x27,
-	0xFD, 0x83, 0x06, 0x00, 0xFA, 0x00, 0x06, 0x00, 0xFE, 0x3A, 0xFD, 0xBB, 0x9A, 0x01, 0xAB, 0xFB,
-	0xC6, 0x02, 0x02, 0xA5, 0xFD, 0x59, 0x05, 0x58, 0x98, 0x98, 0x00, 0x02, 0x00, 0x0F, 0x00, 0x00,
-	0x04, 0xBC, 0x05, 0xB0, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x1D, 0x40, 0x0F, 0x0C, 0x01, 0x04, 0x07,
-	0x03, 0x0B, 0x0B, 0x06, 0x03, 0x08, 0x02, 0x72, 0x06, 0x08, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x11,
-	0x39, 0x2F, 0x17, 0x39, 0x33, 0x30, 0x31, 0x53, 0x01, 0x01, 0x33, 0x01, 0x11, 0x23, 0x11, 0x01,
-	0x01, 0x15, 0x21, 0x35, 0xEC, 0x01, 0x7A, 0x01, 0x7B, 0xDB, 0xFE, 0x0A, 0xC1, 0xFE, 0x0A, 0x03,
-	0x99, 0xFD, 0x83, 0x05, 0xB0, 0xFD, 0x25, 0x02, 0xDB, 0xFC, 0x70, 0xFD, 0xE0, 0x02, 0x20, 0x03,
-	0x90, 0xFC, 0xF0, 0x98, 0x98, 0x00, 0x00, 0x04, 0x00, 0x2F, 0xFE, 0x5F, 0x03, 0xE0, 0x04, 0x3A,
-	0x00, 0x03, 0x00, 0x08, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x17, 0x40, 0x0B, 0x11, 0x10, 0x10, 0x02,
-	0x05, 0x0D, 0x06, 0x72, 0x02, 0x0E, 0x72, 0x00, 0x2B, 0x2B, 0x32, 0x12, 0x39, 0x2F, 0x33, 0x30,
-	0x31, 0x65, 0x11, 0x23, 0x11, 0x37, 0x01, 0x33, 0x01, 0x23, 0x03, 0x01, 0x17, 0x23, 0x01, 0x01,
-	0x15, 0x21, 0x35, 0x02, 0x64, 0xB9, 0x57, 0x01, 0x20, 0xBE, 0xFE, 0x6F, 0x7B, 0xE8, 0x01, 0x28,
-	0x29, 0x7B, 0xFE, 0x6D, 0x03, 0x1D, 0xFD, 0x83, 0x84, 0xFD, 0xDB, 0x02, 0x25, 0x77, 0x03, 0x3F,
-	0xFB, 0xC6, 0x04, 0x3A, 0xFC, 0xC0, 0xFA, 0x04, 0x3A, 0xFC, 0x52, 0x98, 0x98, 0x00, 0x00, 0x02,
-	0x00, 0x3A, 0x00, 0x00, 0x04, 0xCE, 0x05, 0xB0, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x1F, 0x40, 0x0F,
-	0x0F, 0x07, 0x05, 0x01, 0x04, 0x0A, 0x03, 0x0E, 0x0E, 0x09, 0x05, 0x03, 0x00, 0x02, 0x72, 0x00,
-	0x2B, 0x32, 0x2F, 0x33, 0x39, 0x2F, 0x17, 0x39, 0x12, 0x39, 0x33, 0x30, 0x31, 0x49, 0x02, 0x33,
-	0x01, 0x01, 0x23, 0x01, 0x01, 0x23, 0x09, 0x02, 0x15, 0x21, 0x35, 0x01, 0x26, 0x01, 0x5E, 0x01,
-	0x5E, 0xE1, 0xFE, 0x34, 0x01, 0xD7, 0xE3, 0xFE, 0x99, 0xFE, 0x99, 0xE3, 0x01, 0xD7, 0xFE, 0x34,
-	0x03, 0x81, 0xFD, 0x83, 0x05, 0xB0, 0xFD, 0xD2, 0x02, 0x2E, 0xFD, 0x2F, 0xFD, 0x21, 0x02, 0x39,
-	0xFD, 0xC7, 0x02, 0xDF, 0x02, 0xD1, 0xFD, 0x85, 0x98, 0x98, 0x00, 0x02, 0x00, 0x2A, 0x00, 0x00,
-	0x03, 0xCB, 0x04, 0x3A, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x1F, 0x40, 0x0F, 0x0F, 0x07, 0x05, 0x01,
-	0x0A, 0x04, 0x03, 0x0E, 0x0E, 0x09, 0x05, 0x03, 0x00, 0x06, 0x72, 0x00, 0x2B, 0x32, 0x2F, 0x33,
-	0x39, 0x2F, 0x17, 0x39, 0x12, 0x39, 0x33, 0x30, 0x31, 0x41, 0x13, 0x13, 0x33, 0x01, 0x01, 0x23,
-	0x03, 0x03, 0x23, 0x09, 0x02, 0x15, 0x21, 0x35, 0x01, 0x0A, 0xED, 0xF0, 0xD9, 0xFE, 0x9E, 0x01,
-	0x6D, 0xD6, 0xFA, 0xFA, 0xD7, 0x01, 0x6C, 0xFE, 0x9F, 0x03, 0x08, 0xFD, 0x83, 0x04, 0x3A, 0xFE,
-	0x76, 0x01, 0x8A, 0xFD, 0xEA, 0xFD, 0xDC, 0x01, 0x96, 0xFE, 0x6A, 0x02, 0x24, 0x02, 0x16, 0xFE,
-	0x3E, 0x98, 0x98, 0x00, 0xFF, 0xFF, 0x00, 0x64, 0xFF, 0xEC, 0x03, 0xEC, 0x04, 0x4D, 0x06, 0x06,
-	0x00, 0xBF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x12, 0x00, 0x00, 0x04, 0x2F, 0x05, 0xB0, 0x06, 0x26,
-	0x00, 0x2A, 0x00, 0x00, 0x01, 0x07, 0x02, 0x40, 0xFF, 0x83, 0xFE, 0x7D, 0x00, 0x0E, 0xB4, 0x03,
-	0x0E, 0x02, 0x02, 0x00, 0xB8, 0x01, 0x08, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x90,
-	0x02, 0x8B, 0x05, 0xC8, 0x03, 0x23, 0x06, 0x06, 0x01, 0x82, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5E,
-	0x00, 0x00, 0x04, 0x33, 0x05, 0xC4, 0x06, 0x06, 0x00, 0x16, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5F,
-	0xFF, 0xEC, 0x03, 0xFA, 0x05, 0xC4, 0x06, 0x06, 0x00, 0x17, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x35,
-	0x00, 0x00, 0x04, 0x51, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x18, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x9A,
-	0xFF, 0xEC, 0x04, 0x2E, 0x05, 0xB0, 0x06, 0x06, 0x00, 0x19, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x99,
-	0xFF, 0xEC, 0x04, 0x31, 0x05, 0xB2, 0x04, 0x06, 0x00, 0x1A, 0x14, 0x00, 0xFF, 0xFF, 0x00, 0x85,
-	0xFF, 0xEC, 0x04, 0x23, 0x05, 0xC4, 0x04, 0x06, 0x00, 0x1C, 0x14, 0x00, 0xFF, 0xFF, 0x00, 0x64,
-	0xFF, 0xFE, 0x03, 0xF8, 0x05, 0xC4, 0x04, 0x06, 0x00, 0x1D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x87,
-	0xFF, 0xEC, 0x04, 0x1F, 0x05, 0xC4, 0x04, 0x06, 0x00, 0x14, 0x14, 0x00, 0xFF, 0xFF, 0x00, 0x7A,
-	0xFF, 0xEC, 0x04, 0xDD, 0x07, 0x57, 0x06, 0x26, 0x00, 0x2B, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75,
-	0x01, 0xBF, 0x01, 0x57, 0x00, 0x0B, 0xB6, 0x01, 0x2C, 0x10, 0x01, 0x01, 0x6D, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x61, 0xFE, 0x55, 0x03, 0xF2, 0x06, 0x00, 0x06, 0x26, 0x00, 0x4B,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x4B, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x03, 0x3F, 0x1A,
-	0x01, 0x01, 0x8C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00, 0x05, 0x09,
-	0x07, 0x37, 0x06, 0x26, 0x00, 0x32, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x01, 0x65, 0x01, 0x37,
-	0x00, 0x0B, 0xB6, 0x01, 0x0C, 0x09, 0x01, 0x01, 0x61, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x8D, 0x00, 0x00, 0x03, 0xE0, 0x06, 0x00, 0x06, 0x26, 0x00, 0x52, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x44, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x1E, 0x03, 0x01, 0x01, 0xA0, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x05, 0x1E, 0x07, 0x20, 0x06, 0x26,
-	0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAC, 0x04, 0x6D, 0x01, 0x32, 0x00, 0x0D, 0xB7, 0x04,
-	0x03, 0x0E, 0x03, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x3A,
-	0xFF, 0xEC, 0x03, 0xEA, 0x05, 0xE9, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAC,
-	0x04, 0x13, 0xFF, 0xFB, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x3C, 0x0F, 0x01, 0x01, 0x91, 0x56, 0x00,
-	0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5F, 0x00, 0x00, 0x04, 0x46, 0x07, 0x2B, 0x06, 0x26,
-	0x00, 0x29, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAC, 0x04, 0x38, 0x01, 0x3D, 0x00, 0x0D, 0xB7, 0x05,
-	0x04, 0x11, 0x07, 0x01, 0x01, 0x71, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x29,
-	0xFF, 0xEC, 0x03, 0xF3, 0x05, 0xE9, 0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAC,
-	0x04, 0x02, 0xFF, 0xFB, 0x00, 0x0D, 0xB7, 0x02, 0x01, 0x2D, 0x0B, 0x01, 0x01, 0x91, 0x56, 0x00,
-	0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x01, 0xEA, 0x07, 0x2B, 0x06, 0x26,
-	0x00, 0x2D, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAC, 0x02, 0xE4, 0x01, 0x3D, 0x00, 0x0D, 0xB7, 0x02,
-	0x01, 0x05, 0x03, 0x01, 0x01, 0x71, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0xFE, 0xF0,
-	0x00, 0x00, 0x01, 0xCF, 0x05, 0xE7, 0x06, 0x26, 0x00, 0x8D, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAC,
-	0x02, 0xC9, 0xFF, 0xF9, 0x00, 0x0D, 0xB7, 0x02, 0x01, 0x05, 0x03, 0x01, 0x01, 0xA3, 0x56, 0x00,
-	0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x77, 0xFF, 0xEC, 0x05, 0x0A, 0x07, 0x22, 0x06, 0x26,
-	0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAC, 0x04, 0x90, 0x01, 0x34, 0x00, 0x0D, 0xB7, 0x03,
-	0x02, 0x2D, 0x11, 0x01, 0x01, 0x54, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x33,
-	0xFF, 0xEC, 0x04, 0x35, 0x05, 0xE9, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAC,
-	0x04, 0x0C, 0xFF, 0xFB, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x2D, 0x06, 0x01, 0x01, 0x91, 0x56, 0x00,
-	0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x56, 0x00, 0x00, 0x04, 0xCA, 0x07, 0x20, 0x06, 0x26,
-	0x00, 0x36, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAC, 0x04, 0x2F, 0x01, 0x32, 0x00, 0x0D, 0xB7, 0x03,
-	0x02, 0x1F, 0x00, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0x8C,
-	0x00, 0x00, 0x02, 0x98, 0x05, 0xE9, 0x06, 0x26, 0x00, 0x56, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAC,
-	0x03, 0x65, 0xFF, 0xFB, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x18, 0x03, 0x01, 0x01, 0xA5, 0x56, 0x00,
-	0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8C, 0xFF, 0xEC, 0x04, 0xAA, 0x07, 0x20, 0x06, 0x26,
-	0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAC, 0x04, 0x68, 0x01, 0x32, 0x00, 0x0D, 0xB7, 0x02,
-	0x01, 0x17, 0x0B, 0x01, 0x01, 0x66, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x2B,
-	0xFF, 0xEC, 0x03, 0xDD, 0x05, 0xE9, 0x06, 0x26, 0x00, 0x59, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAC,
-	0x04, 0x04, 0xFF, 0xFB, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x1D, 0x11, 0x01, 0x01, 0xA5, 0x56, 0x00,
-	0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0xFF, 0x38, 0x00, 0x00, 0x04, 0xD3, 0x06, 0x3E, 0x04, 0x26,
-	0x00, 0xD0, 0x64, 0x00, 0x00, 0x07, 0x00, 0xAE, 0xFE, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xA9,
-	0xFE, 0xAC, 0x04, 0x88, 0x05, 0xB0, 0x06, 0x26, 0x00, 0x26, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD,
-	0x04, 0xBA, 0x00, 0x0A, 0x00, 0x0E, 0xB4, 0x02, 0x34, 0x1B, 0x01, 0x01, 0xB8, 0xFF, 0x7F, 0xB0,
-	0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x8C, 0xFE, 0x98, 0x04, 0x21, 0x06, 0x00, 0x06, 0x26,
-	0x00, 0x46, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x04, 0xAB, 0xFF, 0xF6, 0x00, 0x0E, 0xB4, 0x03,
-	0x33, 0x04, 0x01, 0x01, 0xB8, 0xFF, 0x6B, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0xA9,
-	0xFE, 0xAC, 0x04, 0xC7, 0x05, 0xB0, 0x06, 0x26, 0x00, 0x28, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD,
-	0x04, 0xBA, 0x00, 0x0A, 0x00, 0x0E, 0xB4, 0x02, 0x22, 0x1D, 0x01, 0x01, 0xB8, 0xFF, 0x7F, 0xB0,
-	0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x5F, 0xFE, 0xA2, 0x03, 0xF1, 0x06, 0x00, 0x06, 0x26,
-	0x00, 0x48, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x04, 0xBE, 0x00, 0x00, 0x00, 0x0E, 0xB4, 0x03,
-	0x33, 0x16, 0x01, 0x01, 0xB8, 0xFF, 0x89, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0xA9,
-	0xFE, 0x06, 0x04, 0xC7, 0x05, 0xB0, 0x06, 0x26, 0x00, 0x28, 0x00, 0x00, 0x01, 0x07, 0x01, 0xD4,
-	0x01, 0x65, 0xFE, 0xA8, 0x00, 0x0E, 0xB4, 0x02, 0x28, 0x1D, 0x01, 0x01, 0xB8, 0xFF, 0x97, 0xB0,
-	0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x5F, 0xFD, 0xFC, 0x03, 0xF1, 0x06, 0x00, 0x06, 0x26,
-	0x00, 0x48, 0x00, 0x00, 0x01, 0x07, 0x01, 0xD4, 0x01, 0x69, 0xFE, 0x9E, 0x00, 0x0E, 0xB4, 0x03,
-	0x39, 0x16, 0x01, 0x01, 0xB8, 0xFF, 0xA1, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0xA9,
-	0xFE, 0xAC, 0x05, 0x08, 0x05, 0xB0, 0x06, 0x26, 0x00, 0x2C, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD,
-	0x05, 0x1F, 0x00, 0x0A, 0x00, 0x0E, 0xB4, 0x03, 0x0F, 0x0A, 0x01, 0x01, 0xB8, 0xFF, 0x7F, 0xB0,
-	0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x8D, 0xFE, 0xAC, 0x03, 0xE0, 0x06, 0x00, 0x06, 0x26,
-	0x00, 0x4C, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x04, 0xA1, 0x00, 0x0A, 0x00, 0x0E, 0xB4, 0x02,
-	0x1E, 0x02, 0x01, 0x01, 0xB8, 0xFF, 0x7F, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0xA9,
-	0x00, 0x00, 0x05, 0x05, 0x07, 0x31, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75,
-	0x01, 0x7C, 0x01, 0x31, 0x00, 0x0B, 0xB6, 0x03, 0x0E, 0x03, 0x01, 0x01, 0x5B, 0x56, 0x00, 0x2B,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8D, 0x00, 0x00, 0x04, 0x0D, 0x07, 0x41, 0x06, 0x26, 0x00, 0x4F,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x44, 0x01, 0x41, 0x00, 0x0B, 0xB6, 0x03, 0x0E, 0x03,
-	0x01, 0x00, 0x1B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9, 0xFE, 0xFC, 0x05, 0x05,
-	0x05, 0xB0, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x04, 0xE9, 0x00, 0x5A,
-	0x00, 0x0E, 0xB4, 0x03, 0x11, 0x02, 0x01, 0x01, 0xB8, 0xFF, 0xCF, 0xB0, 0x56, 0x00, 0x2B, 0x34,
-	0xFF, 0xFF, 0x00, 0x8D, 0xFE, 0xE9, 0x04, 0x0D, 0x06, 0x00, 0x06, 0x26, 0x00, 0x4F, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0xAD, 0x04, 0x66, 0x00, 0x47, 0x00, 0x0E, 0xB4, 0x03, 0x11, 0x02, 0x01, 0x01,
-	0xB8, 0xFF, 0xBC, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0xA9, 0xFE, 0xAC, 0x04, 0x1C,
-	0x05, 0xB0, 0x06, 0x26, 0x00, 0x30, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x04, 0xC1, 0x00, 0x0A,
-	0x00, 0x0E, 0xB4, 0x02, 0x0B, 0x02, 0x01, 0x01, 0xB8, 0xFF, 0x7F, 0xB0, 0x56, 0x00, 0x2B, 0x34,
-	0xFF, 0xFF, 0x00, 0x86, 0xFE, 0xAC, 0x01, 0x61, 0x06, 0x00, 0x06, 0x26, 0x00, 0x50, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0xAD, 0x03, 0x4E, 0x00, 0x0A, 0x00, 0x0E, 0xB4, 0x01, 0x07, 0x02, 0x01, 0x01,
-	0xB8, 0xFF, 0x7F, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0xA9, 0xFE, 0xAC, 0x06, 0x52,
-	0x05, 0xB0, 0x06, 0x26, 0x00, 0x31, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x05, 0xD2, 0x00, 0x0A,
-	0x00, 0x0E, 0xB4, 0x03, 0x14, 0x06, 0x01, 0x01, 0xB8, 0xFF, 0x7F, 0xB0, 0x56, 0x00, 0x2B, 0x34,
-	0xFF, 0xFF, 0x00, 0x8B, 0xFE, 0xAC, 0x06, 0x79, 0x04, 0x4E, 0x06, 0x26, 0x00, 0x51, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0xAD, 0x05, 0xD6, 0x00, 0x0A, 0x00, 0x0E, 0xB4, 0x03, 0x36, 0x02, 0x01, 0x01,
-	0xB8, 0xFF, 0x7F, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0xA9, 0xFE, 0xAC, 0x05, 0x09,
-	0x05, 0xB0, 0x06, 0x26, 0x00, 0x32, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x05, 0x25, 0x00, 0x0A,
-	0x00, 0x0E, 0xB4, 0x01, 0x0D, 0x02, 0x01, 0x01, 0xB8, 0xFF, 0x7F, 0xB0, 0x56, 0x00, 0x2B, 0x34,
-	0xFF, 0xFF, 0x00, 0x8D, 0xFE, 0xAC, 0x03, 0xE0, 0x04, 0x4E, 0x06, 0x26, 0x00, 0x52, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0xAD, 0x04, 0x88, 0x00, 0x0A, 0x00, 0x0E, 0xB4, 0x02, 0x1F, 0x02, 0x01, 0x01,
-	0xB8, 0xFF, 0x7F, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x77, 0xFF, 0xEC, 0x05, 0x0A,
-	0x07, 0xE8, 0x06, 0x26, 0x00, 0x33, 0x00, 0x00, 0x01, 0x07, 0x02, 0x50, 0x05, 0x0C, 0x01, 0x54,
-	0x00, 0x0D, 0xB7, 0x03, 0x02, 0x31, 0x11, 0x01, 0x01, 0x5A, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0xA9, 0x00, 0x00, 0x04, 0xC1, 0x07, 0x42, 0x06, 0x26, 0x00, 0x34, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x75, 0x01, 0x7D, 0x01, 0x42, 0x00, 0x0B, 0xB6, 0x01, 0x18, 0x0F, 0x01, 0x01,
-	0x6C, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8C, 0xFE, 0x60, 0x04, 0x1F, 0x05, 0xF6,
-	0x06, 0x26, 0x00, 0x54, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x94, 0xFF, 0xF6, 0x00, 0x0B,
-	0xB6, 0x03, 0x30, 0x03, 0x01, 0x01, 0x96, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0xA9,
-	0xFE, 0xAC, 0x04, 0xCA, 0x05, 0xB0, 0x06, 0x26, 0x00, 0x36, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD,
-	0x04, 0xB8, 0x00, 0x0A, 0x00, 0x0E, 0xB4, 0x02, 0x21, 0x18, 0x01, 0x01, 0xB8, 0xFF, 0x7F, 0xB0,
-	0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x83, 0xFE, 0xAD, 0x02, 0x98, 0x04, 0x4E, 0x06, 0x26,
-	0x00, 0x56, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x03, 0x4B, 0x00, 0x0B, 0x00, 0x0E, 0xB4, 0x02,
-	0x1A, 0x02, 0x01, 0x01, 0xB8, 0xFF, 0x80, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x51,
-	0xFE, 0xA1, 0x04, 0x73, 0x05, 0xC4, 0x06, 0x26, 0x00, 0x37, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD,
-	0x04, 0xC9, 0xFF, 0xFF, 0x00, 0x0E, 0xB4, 0x01, 0x3D, 0x2B, 0x01, 0x01, 0xB8, 0xFF, 0x88, 0xB0,
-	0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x5F, 0xFE, 0x98, 0x03, 0xBC, 0x04, 0x4E, 0x06, 0x26,
-	0x00, 0x57, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x04, 0x87, 0xFF, 0xF6, 0x00, 0x0E, 0xB4, 0x01,
-	0x39, 0x29, 0x01, 0x01, 0xB8, 0xFF, 0x7F, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x32,
-	0xFE, 0xA2, 0x04, 0x97, 0x05, 0xB0, 0x06, 0x26, 0x00, 0x38, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD,
-	0x04, 0xBB, 0x00, 0x00, 0x00, 0x0E, 0xB4, 0x02, 0x0B, 0x02, 0x01, 0x01, 0xB8, 0xFF, 0x75, 0xB0,
-	0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x09, 0xFE, 0xA2, 0x02, 0x57, 0x05, 0x41, 0x06, 0x26,
-	0x00, 0x58, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x04, 0x1A, 0x00, 0x00, 0x00, 0x0E, 0xB4, 0x02,
-	0x19, 0x11, 0x01, 0x01, 0xB8, 0xFF, 0x89, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x8C,
-	0xFF, 0xEC, 0x04, 0xAA, 0x07, 0xE6, 0x06, 0x26, 0x00, 0x39, 0x00, 0x00, 0x01, 0x07, 0x02, 0x50,
-	0x04, 0xE4, 0x01, 0x52, 0x00, 0x0D, 0xB7, 0x02, 0x01, 0x1B, 0x00, 0x01, 0x01, 0x6C, 0x56, 0x00,
-	0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x04, 0xFD, 0x07, 0x2E, 0x06, 0x26,
-	0x00, 0x3A, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA5, 0x00, 0xB3, 0x01, 0x46, 0x00, 0x0B, 0xB6, 0x02,
-	0x18, 0x09, 0x01, 0x01, 0x76, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x21, 0x00, 0x00,
-	0x03, 0xBB, 0x05, 0xE2, 0x06, 0x26, 0x00, 0x5A, 0x00, 0x00, 0x01, 0x06, 0x00, 0xA5, 0x1D, 0xFA,
-	0x00, 0x0B, 0xB6, 0x02, 0x18, 0x09, 0x01, 0x01, 0xA0, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x1D, 0xFE, 0xAC, 0x04, 0xFD, 0x05, 0xB0, 0x06, 0x26, 0x00, 0x3A, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0xAD, 0x04, 0xE4, 0x00, 0x0A, 0x00, 0x0E, 0xB4, 0x02, 0x0D, 0x04, 0x01, 0x01, 0xB8, 0xFF,
-	0x7F, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x21, 0xFE, 0xAC, 0x03, 0xBB, 0x04, 0x3A,
-	0x06, 0x26, 0x00, 0x5A, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x04, 0x4D, 0x00, 0x0A, 0x00, 0x0E,
-	0xB4, 0x02, 0x0D, 0x04, 0x01, 0x01, 0xB8, 0xFF, 0x7F, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF,
-	0x00, 0x3D, 0xFE, 0xAC, 0x06, 0xED, 0x05, 0xB0, 0x06, 0x26, 0x00, 0x3B, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0xAD, 0x05, 0xEF, 0x00, 0x0A, 0x00, 0x0E, 0xB4, 0x04, 0x19, 0x13, 0x01, 0x01, 0xB8, 0xFF,
-	0x7F, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x2B, 0xFE, 0xAC, 0x05, 0xD3, 0x04, 0x3A,
-	0x06, 0x26, 0x00, 0x5B, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x05, 0x53, 0x00, 0x0A, 0x00, 0x0E,
-	0xB4, 0x04, 0x19, 0x13, 0x01, 0x01, 0xB8, 0xFF, 0x7F, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF,
-	0x00, 0x57, 0xFE, 0xAC, 0x04, 0x7A, 0x05, 0xB0, 0x06, 0x26, 0x00, 0x3E, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0xAD, 0x04, 0xBA, 0x00, 0x0A, 0x00, 0x0E, 0xB4, 0x03, 0x11, 0x02, 0x01, 0x01, 0xB8, 0xFF,
-	0x7F, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF, 0x00, 0x59, 0xFE, 0xAC, 0x03, 0xB3, 0x04, 0x3A,
-	0x06, 0x26, 0x00, 0x5E, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD, 0x04, 0x63, 0x00, 0x0A, 0x00, 0x0E,
-	0xB4, 0x03, 0x11, 0x02, 0x01, 0x01, 0xB8, 0xFF, 0x7F, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0xFF, 0xFF,
-	0xFE, 0x78, 0xFF, 0xEC, 0x05, 0x50, 0x05, 0xD6, 0x04, 0x26, 0x00, 0x33, 0x46, 0x00, 0x01, 0x07,
-	0x01, 0x71, 0xFE, 0x08, 0xFF, 0xFF, 0x00, 0x0D, 0xB7, 0x03, 0x02, 0x2E, 0x11, 0x00, 0x00, 0x12,
-	0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x04, 0x71, 0x05, 0x1B,
-	0x06, 0x26, 0x02, 0x4D, 0x00, 0x00, 0x00, 0x07, 0x00, 0xAE, 0xFF, 0xDB, 0xFE, 0xDC, 0xFF, 0xFF,
-	0xFF, 0x9F, 0x00, 0x00, 0x03, 0xEB, 0x05, 0x1E, 0x04, 0x26, 0x02, 0x42, 0x3C, 0x00, 0x00, 0x07,
-	0x00, 0xAE, 0xFE, 0xE7, 0xFE, 0xDF, 0xFF, 0xFF, 0xFF, 0xBB, 0x00, 0x00, 0x04, 0x95, 0x05, 0x1B,
-	0x04, 0x26, 0x01, 0xFE, 0x3C, 0x00, 0x00, 0x07, 0x00, 0xAE, 0xFF, 0x03, 0xFE, 0xDC, 0xFF, 0xFF,
-	0xFF, 0xC0, 0x00, 0x00, 0x01, 0x8D, 0x05, 0x1E, 0x04, 0x26, 0x01, 0xFD, 0x3C, 0x00, 0x00, 0x07,
-	0x00, 0xAE, 0xFF, 0x08, 0xFE, 0xDF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xF0, 0x04, 0x65, 0x05, 0x1B,
-	0x04, 0x26, 0x01, 0xF7, 0x0A, 0x00, 0x00, 0x07, 0x00, 0xAE, 0xFF, 0x27, 0xFE, 0xDC, 0xFF, 0xFF,
-	0xFF, 0x55, 0x00, 0x00, 0x04, 0x58, 0x05, 0x1B, 0x04, 0x26, 0x01, 0xED, 0x3C, 0x00, 0x00, 0x07,
-	0x00, 0xAE, 0xFE, 0x9D, 0xFE, 0xDC, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x04, 0x88, 0x05, 0x1A,
-	0x04, 0x26, 0x02, 0x0D, 0x0A, 0x00, 0x00, 0x07, 0x00, 0xAE, 0xFF, 0x3F, 0xFE, 0xDB, 0xFF, 0xFF,
-	0x00, 0x14, 0x00, 0x00, 0x04, 0x71, 0x04, 0x8D, 0x06, 0x06, 0x02, 0x4D, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x8B, 0x00, 0x00, 0x03, 0xF0, 0x04, 0x8D, 0x06, 0x06, 0x02, 0x4C, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x8B, 0x00, 0x00, 0x03, 0xAF, 0x04, 0x8D, 0x06, 0x06, 0x02, 0x42, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x48, 0x00, 0x00, 0x03, 0xE1, 0x04, 0x8D, 0x06, 0x06, 0x01, 0xEC, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x8B, 0x00, 0x00, 0x04, 0x59, 0x04, 0x8D, 0x06, 0x06, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x98, 0x00, 0x00, 0x01, 0x51, 0x04, 0x8D, 0x06, 0x06, 0x01, 0xFD, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x8B, 0x00, 0x00, 0x04, 0x57, 0x04, 0x8D, 0x06, 0x06, 0x01, 0xFB, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x8B, 0x00, 0x00, 0x05, 0x78, 0x04, 0x8D, 0x06, 0x06, 0x01, 0xF9, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x8B, 0x00, 0x00, 0x04, 0x59, 0x04, 0x8D, 0x06, 0x06, 0x01, 0xF8, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x60, 0xFF, 0xF0, 0x04, 0x5B, 0x04, 0x9D, 0x06, 0x06, 0x01, 0xF7, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x8B, 0x00, 0x00, 0x04, 0x1B, 0x04, 0x8D, 0x06, 0x06, 0x01, 0xF6, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x29, 0x00, 0x00, 0x03, 0xFD, 0x04, 0x8D, 0x06, 0x06, 0x01, 0xF2, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x0E, 0x00, 0x00, 0x04, 0x1C, 0x04, 0x8D, 0x06, 0x06, 0x01, 0xED, 0x00, 0x00, 0xFF, 0xFF,
-	0x00, 0x27, 0x00, 0x00, 0x04, 0x32, 0x04, 0x8D, 0x06, 0x06, 0x01, 0xEE, 0x00, 0x00, 0xFF, 0xFF,
-	0xFF, 0xB2, 0x00, 0x00, 0x02, 0x3C, 0x05, 0xE4, 0x06, 0x26, 0x01, 0xFD, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x6A, 0xFF, 0x4D, 0x00, 0x1E, 0x00, 0x0D, 0xB7, 0x02, 0x01, 0x0D, 0x03, 0x01, 0x01, 0x84,
-	0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x0E, 0x00, 0x00, 0x04, 0x1C, 0x05, 0xE4,
-	0x06, 0x26, 0x01, 0xED, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6A, 0x6E, 0x1E, 0x00, 0x0D, 0xB7, 0x04,
-	0x03, 0x17, 0x09, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8B,
-	0x00, 0x00, 0x03, 0xAF, 0x05, 0xE4, 0x06, 0x26, 0x02, 0x42, 0x00, 0x00, 0x01, 0x06, 0x00, 0x6A,
-	0x72, 0x1E, 0x00, 0x0D, 0xB7, 0x05, 0x04, 0x19, 0x07, 0x01, 0x01, 0x83, 0x56, 0x00, 0x2B, 0x34,
-	0x34, 0x00, 0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00, 0x03, 0x85, 0x06, 0x1E, 0x06, 0x26, 0x02, 0x04,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x35, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x02, 0x08, 0x03,
-	0x01, 0x01, 0x83, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x44, 0xFF, 0xF0, 0x03, 0xDE,
-	0x04, 0x9D, 0x06, 0x06, 0x01, 0xF3, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x98, 0x00, 0x00, 0x01, 0x51,
-	0x04, 0x8D, 0x06, 0x06, 0x01, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x02, 0x3C,
-	0x05, 0xE4, 0x06, 0x26, 0x01, 0xFD, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0xFF, 0x4D, 0x00, 0x1E,
-	0x00, 0x0D, 0xB7, 0x02, 0x01, 0x0D, 0x03, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x2C, 0xFF, 0xF0, 0x03, 0x4D, 0x04, 0x8D, 0x06, 0x06, 0x01, 0xFC, 0x00, 0x00,
-	0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00, 0x04, 0x57, 0x06, 0x1E, 0x06, 0x26, 0x01, 0xFB, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0x75, 0x01, 0x25, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x03, 0x0E, 0x03, 0x01, 0x01,
-	0x84, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x23, 0xFF, 0xEC, 0x04, 0x0C, 0x05, 0xF5,
-	0x06, 0x26, 0x02, 0x1B, 0x00, 0x00, 0x01, 0x06, 0x00, 0xA1, 0x67, 0x1E, 0x00, 0x0B, 0xB6, 0x02,
-	0x1D, 0x17, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00,
-	0x04, 0x71, 0x04, 0x8D, 0x06, 0x06, 0x02, 0x4D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00,
-	0x03, 0xF0, 0x04, 0x8D, 0x06, 0x06, 0x02, 0x4C, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00,
-	0x03, 0x85, 0x04, 0x8D, 0x06, 0x06, 0x02, 0x04, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00,
-	0x03, 0xAF, 0x04, 0x8D, 0x06, 0x06, 0x02, 0x42, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00,
-	0x04, 0x62, 0x05, 0xF5, 0x06, 0x26, 0x02, 0x18, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA1, 0x00, 0xC9,
-	0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x03, 0x11, 0x08, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00, 0x05, 0x78, 0x04, 0x8D, 0x06, 0x06, 0x01, 0xF9, 0x00, 0x00,
-	0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00, 0x04, 0x59, 0x04, 0x8D, 0x06, 0x06, 0x01, 0xFE, 0x00, 0x00,
-	0xFF, 0xFF, 0x00, 0x60, 0xFF, 0xF0, 0x04, 0x5B, 0x04, 0x9D, 0x06, 0x06, 0x01, 0xF7, 0x00, 0x00,
-	0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00, 0x04, 0x44, 0x04, 0x8D, 0x06, 0x06, 0x02, 0x09, 0x00, 0x00,
-	0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00, 0x04, 0x1B, 0x04, 0x8D, 0x06, 0x06, 0x01, 0xF6, 0x00, 0x00,
-	0xFF, 0xFF, 0x00, 0x61, 0xFF, 0xF0, 0x04, 0x31, 0x04, 0x9D, 0x06, 0x06, 0x02, 0x4B, 0x00, 0x00,
-	0xFF, 0xFF, 0x00, 0x29, 0x00, 0x00, 0x03, 0xFD, 0x04, 0x8D, 0x06, 0x06, 0x01, 0xF2, 0x00, 0x00,
-	0xFF, 0xFF, 0x00, 0x27, 0x00, 0x00, 0x04, 0x32, 0x04, 0x8D, 0x06, 0x06, 0x01, 0xEE, 0x00, 0x00,
-	0x00, 0x03, 0x00, 0x48, 0xFE, 0x4F, 0x03, 0xD5, 0x04, 0x9D, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x42,
-	0x00, 0x28, 0x40, 0x13, 0x1F, 0x01, 0x02, 0x02, 0x3E, 0x3E, 0x15, 0x3F, 0x34, 0x34, 0x40, 0x30,
-	0x2A, 0x0B, 0x72, 0x0F, 0x0B, 0x15, 0x7E, 0x00, 0x3F, 0x33, 0xCC, 0x2B, 0xCC, 0xCD, 0x33, 0x12,
-	0x39, 0x12, 0x39, 0x2F, 0x33, 0x12, 0x39, 0x39, 0x30, 0x31, 0x41, 0x23, 0x35, 0x33, 0x32, 0x36,
-	0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x23, 0x34, 0x3E, 0x02, 0x33, 0x32,
-	0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x27, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23,
-	0x22, 0x2E, 0x02, 0x35, 0x33, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2E, 0x02, 0x23,
-	0x23, 0x13, 0x11, 0x23, 0x11, 0x02, 0x10, 0x92, 0x8E, 0x5A, 0x70, 0x33, 0x38, 0x74, 0x5C, 0x42,
-	0x6C, 0x41, 0xB9, 0x41, 0x73, 0x9A, 0x5A, 0x5F, 0xA3, 0x7A, 0x45, 0x43, 0x77, 0x9E, 0xEC, 0x92,
-	0x75, 0xAB, 0x6F, 0x36, 0x4A, 0x83, 0xA8, 0x5F, 0x48, 0x9A, 0x85, 0x52, 0xB9, 0x05, 0x46, 0x71,
-	0x44, 0x5A, 0x7E, 0x42, 0x23, 0x45, 0x65, 0x42, 0x8E, 0xDC, 0xB9, 0x02, 0x2C, 0x74, 0x2B, 0x4F,
-	0x36, 0x33, 0x50, 0x2F, 0x24, 0x4A, 0x3A, 0x4B, 0x77, 0x54, 0x2D, 0x25, 0x4D, 0x79, 0x53, 0x45,
-	0x71, 0x51, 0x2C, 0x45, 0x2F, 0x53, 0x6E, 0x3F, 0x57, 0x80, 0x53, 0x28, 0x20, 0x4D, 0x82, 0x61,
-	0x42, 0x50, 0x24, 0x2C, 0x53, 0x39, 0x33, 0x4B, 0x31, 0x18, 0xFE, 0x47, 0xFD, 0xFF, 0x02, 0x01,
-	0x00, 0x04, 0x00, 0x8B, 0xFE, 0x99, 0x04, 0xFB, 0x04, 0x8D, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
-	0x00, 0x0F, 0x00, 0x1D, 0x40, 0x0D, 0x03, 0x02, 0x02, 0x06, 0x0B, 0x07, 0x7D, 0x0F, 0x0E, 0x0A,
-	0x0A, 0x06, 0x12, 0x00, 0x3F, 0x33, 0x10, 0xCE, 0x33, 0x3F, 0x33, 0x12, 0x39, 0x2F, 0x33, 0x30,
-	0x31, 0x41, 0x15, 0x21, 0x35, 0x13, 0x11, 0x23, 0x11, 0x21, 0x11, 0x23, 0x11, 0x01, 0x11, 0x23,
-	0x11, 0x03, 0xC0, 0xFD, 0x5F, 0x25, 0xB9, 0x03, 0xCE, 0xB9, 0x01, 0x5B, 0xB9, 0x02, 0x8B, 0x99,
-	0x99, 0x02, 0x02, 0xFB, 0x73, 0x04, 0x8D, 0xFB, 0x73, 0x04, 0x8D, 0xFC, 0x0D, 0xFD, 0xFF, 0x02,
-	0x01, 0x00, 0x00, 0x02, 0x00, 0x61, 0xFE, 0x55, 0x04, 0x31, 0x04, 0x9D, 0x00, 0x27, 0x00, 0x2B,
-	0x00, 0x18, 0x40, 0x0B, 0x19, 0x10, 0x7E, 0x28, 0x24, 0x24, 0x2A, 0x2A, 0x05, 0x0B, 0x72, 0x00,
-	0x2B, 0x32, 0x2F, 0x32, 0x11, 0x33, 0x3F, 0x33, 0x30, 0x31, 0x41, 0x33, 0x0E, 0x02, 0x23, 0x22,
-	0x2E, 0x02, 0x35, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x2E, 0x02, 0x23,
-	0x22, 0x0E, 0x02, 0x15, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x07, 0x11, 0x23, 0x11,
-	0x03, 0x77, 0xBA, 0x0C, 0x71, 0xCD, 0x97, 0x71, 0xB6, 0x82, 0x46, 0x46, 0x84, 0xBB, 0x74, 0x92,
-	0xC8, 0x71, 0x0C, 0xBA, 0x0A, 0x3E, 0x76, 0x5F, 0x4F, 0x78, 0x51, 0x29, 0x25, 0x4C, 0x76, 0x50,
-	0x64, 0x78, 0x3F, 0xC3, 0xB9, 0x01, 0x79, 0x71, 0xB2, 0x66, 0x4D, 0x8F, 0xCA, 0x7D, 0x66, 0x7D,
-	0xCA, 0x90, 0x4D, 0x65, 0xB4, 0x75, 0x4D, 0x6E, 0x3B, 0x35, 0x67, 0x92, 0x5D, 0x67, 0x58, 0x91,
-	0x6A, 0x39, 0x38, 0x6D, 0xD6, 0xFD, 0xFF, 0x02, 0x01, 0x00, 0xFF, 0xFF, 0x00, 0x0E, 0x00, 0x00,
-	0x04, 0x1C, 0x04, 0x8D, 0x06, 0x06, 0x01, 0xED, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x02, 0xFE, 0x4F,
-	0x05, 0x6C, 0x04, 0x9D, 0x06, 0x26, 0x02, 0x31, 0x00, 0x00, 0x00, 0x07, 0x02, 0x6B, 0x02, 0xBB,
-	0xFF, 0xB6, 0xFF, 0xFF, 0x00, 0x8B, 0x00, 0x00, 0x04, 0x62, 0x05, 0xCB, 0x06, 0x26, 0x02, 0x18,
-	0x00, 0x00, 0x01, 0x07, 0x00, 0x70, 0x00, 0x9D, 0x00, 0x26, 0x00, 0x0B, 0xB6, 0x03, 0x0E, 0x08,
-	0x01, 0x01, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x23, 0xFF, 0xEC, 0x04, 0x0C,
-	0x05, 0xCB, 0x06, 0x26, 0x02, 0x1B, 0x00, 0x00, 0x01, 0x06, 0x00, 0x70, 0x3B, 0x26, 0x00, 0x0B,
-	0xB6, 0x02, 0x1A, 0x17, 0x01, 0x01, 0xB0, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x61,
-	0x00, 0x00, 0x05, 0x06, 0x04, 0x8D, 0x06, 0x06, 0x02, 0x0B, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x98,
-	0xFF, 0xF0, 0x05, 0x36, 0x04, 0x8D, 0x04, 0x26, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x07, 0x01, 0xFC,
-	0x01, 0xE9, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x09, 0x00, 0x00, 0x05, 0xF2, 0x06, 0x00, 0x06, 0x26,
-	0x02, 0x8E, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x02, 0x9F, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x06,
-	0x19, 0x0F, 0x01, 0x01, 0x4D, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x60, 0xFF, 0xC6,
-	0x04, 0x5B, 0x06, 0x1E, 0x06, 0x26, 0x02, 0x90, 0x00, 0x00, 0x01, 0x07, 0x00, 0x75, 0x01, 0x7D,
-	0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x03, 0x30, 0x11, 0x01, 0x01, 0x5B, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0x44, 0xFD, 0xFC, 0x03, 0xDE, 0x04, 0x9D, 0x06, 0x26, 0x01, 0xF3, 0x00, 0x00,
-	0x00, 0x07, 0x01, 0xD4, 0x01, 0x28, 0xFE, 0x9E, 0xFF, 0xFF, 0x00, 0x31, 0x00, 0x00, 0x05, 0xF1,
-	0x06, 0x1E, 0x06, 0x26, 0x01, 0xEF, 0x00, 0x00, 0x01, 0x07, 0x00, 0x44, 0x01, 0xA1, 0x00, 0x1E,
-	0x00, 0x0B, 0xB6, 0x04, 0x18, 0x0A, 0x01, 0x01, 0x6B, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF,
-	0x00, 0x31, 0x00, 0x00, 0x05, 0xF1, 0x06, 0x1E, 0x06, 0x26, 0x01, 0xEF, 0x00, 0x00, 0x01, 0x07,
-	0x00, 0x75, 0x02, 0x31, 0x00, 0x1E, 0x00, 0x0B, 0xB6, 0x04, 0x16, 0x0A, 0x01, 0x01, 0x6B, 0x56,
-	0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x31, 0x00, 0x00, 0x05, 0xF1, 0x05, 0xE4, 0x06, 0x26,
-	0x01, 0xEF, 0x00, 0x00, 0x01, 0x07, 0x00, 0x6A, 0x01, 0x6B, 0x00, 0x1E, 0x00, 0x0D, 0xB7, 0x05,
-	0x04, 0x1F, 0x0A, 0x01, 0x01, 0x84, 0x56, 0x00, 0x2B, 0x34, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x0E,
-	0x00, 0x00, 0x04, 0x1C, 0x06, 0x1E, 0x06, 0x26, 0x01, 0xED, 0x00, 0x00, 0x00, 0x07, 0x00, 0x44,
-	0x00, 0xA4, 0x00, 0x1E, 0xFF, 0xFF, 0x00, 0x1D, 0xFE, 0x4E, 0x05, 0x1E, 0x05, 0xB0, 0x06, 0x26,
-	0x00, 0x25, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA4, 0x01, 0x7C, 0x00, 0x00, 0x00, 0x0B, 0xB6, 0x03,
-	0x0E, 0x05, 0x01, 0x01, 0x39, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x6D, 0xFE, 0x4E,
-	0x03, 0xEA, 0x04, 0x4E, 0x06, 0x26, 0x00, 0x45, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA4, 0x00, 0xC4,
-	0x00, 0x00, 0x00, 0x0B, 0xB6, 0x02, 0x3B, 0x31, 0x00, 0x00, 0x4D, 0x56, 0x00, 0x2B, 0x34, 0x00,
-	0xFF, 0xFF, 0x00, 0xA9, 0xFE, 0x58, 0x04, 0x46, 0x05, 0xB0, 0x06, 0x26, 0x00, 0x29, 0x00, 0x00,
-	0x01, 0x07, 0x00, 0xA4, 0x01, 0x39, 0x00, 0x0A, 0x00, 0x0B, 0xB6, 0x04, 0x10, 0x02, 0x00, 0x00,
-	0x43, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x5D, 0xFE, 0x4E, 0x03, 0xF3, 0x04, 0x4E,
-	0x06, 0x26, 0x00, 0x49, 0x00, 0x00, 0x01, 0x07, 0x00, 0xA4, 0x01, 0x06, 0x00, 0x00, 0x00, 0x0B,
-	0xB6, 0x01, 0x2C, 0x00, 0x00, 0x00, 0x4D, 0x56, 0x00, 0x2B, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x14,
-	0xFE, 0x4E, 0x04, 0x71, 0x04, 0x8D, 0x06, 0x26, 0x02, 0x4D, 0x00, 0x00, 0x00, 0x07, 0x00, 0xA4,
-	0x01, 0x1E, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x8B, 0xFE, 0x56, 0x03, 0xAF, 0x04, 0x8D, 0x06, 0x26,
-	0x02, 0x42, 0x00, 0x00, 0x00, 0x07, 0x00, 0xA4, 0x00, 0xE7, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x86,
-	0xFE, 0xAC, 0x01, 0x61, 0x04, 0x3A, 0x06, 0x26, 0x00, 0x8D, 0x00, 0x00, 0x01, 0x07, 0x00, 0xAD,
-	0x03, 0x4E, 0x00, 0x0A, 0x00, 0x0E, 0xB4, 0x01, 0x07, 0x02, 0x01, 0x01, 0xB8, 0xFF, 0x7F, 0xB0,
-	0x56, 0x00, 0x2B, 0x34
-};
-static const unsigned long long sg_FontSize = sizeof(sg_Font) / sizeof(*sg_Font);
-#endif // FONT_H
\ No newline at end of file
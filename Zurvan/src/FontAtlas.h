@@ -0,0 +1,1367 @@
+#ifndef FONT_ATLAS_H
+#define FONT_ATLAS_H
+// Generated by Tools/FontBaker from Roboto-Regular.ttf, do not edit
+
+#include "BakedFont.h"
+
+static const unsigned char sg_FontAtlasSdf32Alpha[] =
+{
+	0xED, 0xBD, 0x55, 0x77, 0xE3, 0x4A, 0xB7, 0xF7, 0xAB, 0x50, 0x07, 0x3B, 0xD4, 0x61, 0x66, 0x66,
+	0x8E, 0x1D, 0x66, 0x66, 0x46, 0x87, 0x99, 0xD9, 0x8E, 0x83, 0x8E, 0x43, 0x0E, 0x3B, 0x1C, 0x27,
+	0x0E, 0x33, 0x33, 0x75, 0xD2, 0xDC, 0x6B, 0x75, 0xAF, 0xF5, 0xBC, 0x07, 0xAE, 0xDF, 0x71, 0xC6,
+	0x38, 0x97, 0xE7, 0x43, 0xEC, 0x33, 0x64, 0x4B, 0xB2, 0x0C, 0x81, 0xDE, 0x0F, 0xEC, 0xB5, 0xF7,
+	0xA3, 0xFF, 0x45, 0x77, 0xA2, 0x58, 0xB2, 0x54, 0x3F, 0x55, 0xD5, 0xAC, 0x59, 0x73, 0x56, 0x01,
+	0x98, 0x30, 0x61, 0xC2, 0x04, 0xBC, 0x55, 0x87, 0x7F, 0x52, 0x52, 0xFE, 0x97, 0x7F, 0xB9, 0x88,
+	0x08, 0xEF, 0x11, 0x09, 0x29, 0x9E, 0x03, 0xC2, 0x92, 0xD2, 0xE2, 0xFF, 0x15, 0xE5, 0x22, 0x21,
+	0xF3, 0xE6, 0x99, 0xBF, 0x3E, 0x71, 0x53, 0x62, 0xD2, 0x92, 0x82, 0x3F, 0x2F, 0x24, 0x29, 0x2D,
+	0xF1, 0xD4, 0x71, 0x21, 0xFE, 0xC3, 0xFF, 0x90, 0x87, 0x96, 0x94, 0x79, 0xC5, 0x35, 0x74, 0x03,
+	0x52, 0x2C, 0xD8, 0x3F, 0xA9, 0x44, 0xC4, 0x58, 0x8B, 0xA2, 0xEF, 0xC1, 0xC4, 0x12, 0x94, 0x31,
+	0xFB, 0x37, 0x03, 0xD6, 0x2F, 0xE6, 0xBC, 0x0F, 0x21, 0xA9, 0xAA, 0x67, 0x64, 0xA4, 0xAB, 0x22,
+	0xF8, 0xA9, 0x65, 0x8D, 0x1C, 0xD4, 0xD8, 0x3F, 0xC9, 0xD9, 0x99, 0xBF, 0xE3, 0xFF, 0xBB, 0x9C,
+	0x87, 0xBF, 0x3F, 0xFE, 0x2D, 0xD7, 0x21, 0xAB, 0xA0, 0x30, 0x17, 0x39, 0xD4, 0xEF, 0x1A, 0xF6,
+	0xBE, 0xA1, 0xE1, 0x41, 0x78, 0x33, 0xF4, 0x31, 0x53, 0x1C, 0xCE, 0x5D, 0x1D, 0x7D, 0x92, 0x22,
+	0xCE, 0xCB, 0xCB, 0x53, 0xFB, 0xE9, 0x37, 0xDC, 0xCD, 0xCB, 0xCB, 0xCB, 0x80, 0xFB, 0x98, 0x29,
+	0x0E, 0x87, 0xD3, 0x83, 0x4A, 0x00, 0x87, 0xC3, 0xD9, 0xF1, 0xBE, 0x87, 0x5A, 0x6E, 0x21, 0x11,
+	0x81, 0x0E, 0x4A, 0x82, 0x2F, 0xA8, 0x6A, 0xEB, 0x1D, 0x12, 0x1E, 0xEC, 0x61, 0xA9, 0xC8, 0x7B,
+	0x92, 0x73, 0x40, 0x78, 0xA8, 0x97, 0xB9, 0x14, 0xDF, 0x09, 0xEA, 0x76, 0x3E, 0xA1, 0xE1, 0x21,
+	0x5E, 0x36, 0x2A, 0x3C, 0xC7, 0x35, 0xED, 0xC1, 0xE3, 0x3E, 0x76, 0x1A, 0xDC, 0x95, 0x42, 0xC7,
+	0xD1, 0x2F, 0x34, 0x3C, 0xD8, 0x13, 0x7D, 0x7D, 0x79, 0x17, 0x1C, 0x0E, 0xA7, 0xCD, 0xB9, 0x77,
+	0x7B, 0x31, 0xD4, 0x09, 0xD2, 0x7A, 0x36, 0xAE, 0x78, 0x1C, 0xA7, 0x48, 0xE4, 0x5D, 0xF1, 0x78,
+	0x57, 0x53, 0x8F, 0x90, 0x88, 0x60, 0x37, 0xBD, 0x17, 0xF0, 0x1B, 0xC5, 0xB4, 0xB4, 0x7A, 0x0B,
+	0xB3, 0x7E, 0xB4, 0x2C, 0xA2, 0x66, 0x3B, 0xA1, 0xDE, 0x79, 0xBD, 0x8C, 0x32, 0x50, 0x29, 0x5A,
+	0xE0, 0x2F, 0xCA, 0x71, 0xAC, 0x5F, 0xF2, 0xCC, 0xB8, 0x9F, 0xCB, 0x21, 0x38, 0x89, 0x90, 0x9F,
+	0x9F, 0x9D, 0x18, 0x04, 0x83, 0x46, 0x3F, 0x86, 0x59, 0x48, 0x4E, 0x0D, 0x8E, 0xFD, 0xB3, 0x75,
+	0x49, 0x41, 0x94, 0x9D, 0x34, 0xEF, 0x27, 0xF4, 0x08, 0xDD, 0xDD, 0xD9, 0xBA, 0xE8, 0x23, 0x06,
+	0x69, 0xDD, 0xFD, 0x25, 0x4E, 0x9C, 0x17, 0xC8, 0x29, 0xA1, 0xB2, 0xBD, 0x7F, 0x90, 0xDA, 0x92,
+	0x1F, 0x62, 0xCC, 0x79, 0xE5, 0x42, 0x89, 0xC4, 0x3A, 0x67, 0xF4, 0x59, 0x66, 0xC5, 0x6D, 0x6D,
+	0x8D, 0x2E, 0x4F, 0x3E, 0xA3, 0x7E, 0x4E, 0x5B, 0x5B, 0xAB, 0x27, 0xF7, 0x9B, 0x19, 0x46, 0x24,
+	0x12, 0xA1, 0x43, 0x1E, 0x2D, 0x44, 0x62, 0xAA, 0x0E, 0xCF, 0xEB, 0x11, 0x57, 0xD7, 0x4B, 0xA3,
+	0x94, 0x87, 0x68, 0x09, 0xAA, 0x56, 0x76, 0xB1, 0x65, 0x6D, 0x7D, 0x83, 0xBD, 0xA4, 0xA2, 0x70,
+	0x73, 0x61, 0xF4, 0x1F, 0xAC, 0x13, 0x6A, 0xBA, 0x07, 0xFB, 0x49, 0xB9, 0xDE, 0x3C, 0xAF, 0xCD,
+	0x5B, 0xC7, 0xF8, 0x72, 0xF0, 0x04, 0x72, 0x69, 0x8C, 0x0D, 0xBA, 0x4D, 0x51, 0x70, 0x49, 0xAC,
+	0x6C, 0xEF, 0x1B, 0xEC, 0x6B, 0xAB, 0x48, 0x70, 0x44, 0xD5, 0x02, 0x65, 0x5C, 0x6A, 0x75, 0x67,
+	0xFF, 0x20, 0x15, 0xBC, 0x3E, 0xD2, 0x34, 0x98, 0x15, 0x11, 0x89, 0xCD, 0xEC, 0xC2, 0x94, 0x08,
+	0x21, 0x12, 0x89, 0x69, 0x9C, 0x57, 0x46, 0xC2, 0x22, 0x38, 0xB3, 0xA2, 0x91, 0x54, 0xEB, 0x80,
+	0x2A, 0x0F, 0x12, 0xA9, 0x98, 0x40, 0xEC, 0xA3, 0x51, 0x1B, 0x52, 0x1C, 0x25, 0x9E, 0xC3, 0xAF,
+	0x17, 0xD3, 0xBE, 0x33, 0x12, 0xC7, 0xAE, 0x9A, 0x5E, 0xAD, 0x87, 0xC3, 0x39, 0xF6, 0x28, 0x16,
+	0xB9, 0x2B, 0xBB, 0xBB, 0xBB, 0x8B, 0x59, 0xAC, 0xA2, 0x51, 0x4D, 0x9E, 0xDE, 0xDD, 0xDD, 0xDD,
+	0x2D, 0xB3, 0x44, 0x3F, 0x97, 0x43, 0x5C, 0x05, 0x65, 0x72, 0x69, 0x6D, 0x6D, 0x89, 0x4E, 0xA9,
+	0x88, 0xB5, 0xE3, 0x79, 0xED, 0x45, 0x1C, 0x32, 0x3B, 0x16, 0x06, 0xA3, 0x59, 0xEF, 0xB0, 0x98,
+	0x5F, 0xFB, 0x4A, 0x6F, 0x81, 0x87, 0x2C, 0x1F, 0x7F, 0xE6, 0x12, 0x37, 0x7F, 0x87, 0xDA, 0xE3,
+	0x4F, 0xD4, 0x20, 0xB8, 0x90, 0x14, 0xBC, 0x8B, 0x69, 0xDB, 0xEF, 0x3F, 0x3D, 0x7E, 0xB9, 0x58,
+	0x6C, 0x4B, 0xB1, 0xE2, 0xF0, 0xEF, 0x3F, 0x6F, 0xE0, 0xE1, 0xBF, 0x75, 0xF1, 0x2C, 0xFF, 0xE5,
+	0x7B, 0x32, 0x37, 0x7F, 0xE3, 0x1C, 0xC6, 0x5A, 0x89, 0x35, 0xD4, 0xE4, 0x14, 0xAF, 0xEE, 0x55,
+	0x3B, 0x73, 0xBF, 0xD7, 0x31, 0x5D, 0xBB, 0x2B, 0x73, 0x5B, 0x2B, 0x8D, 0xFE, 0x32, 0x80, 0x94,
+	0x1B, 0x9E, 0xAB, 0x7A, 0x4A, 0xBB, 0xE7, 0xF5, 0x6D, 0xDC, 0x7D, 0x7E, 0xFC, 0x72, 0xB5, 0xDC,
+	0x95, 0x61, 0x8F, 0x7A, 0x01, 0x4C, 0xD3, 0xFA, 0x76, 0x3F, 0x9E, 0x5F, 0x5F, 0xCD, 0x54, 0x79,
+	0x71, 0x95, 0xB9, 0xBC, 0x67, 0xD1, 0xE0, 0xD6, 0xDD, 0xFB, 0xDB, 0x87, 0xDB, 0x75, 0x2A, 0xC1,
+	0x89, 0xD3, 0xC2, 0xBE, 0xF3, 0x2D, 0x1B, 0xDE, 0xB9, 0x7F, 0x7F, 0xFB, 0x70, 0xBF, 0x4D, 0x2B,
+	0xF2, 0x90, 0x81, 0x0F, 0xAB, 0x04, 0x56, 0x8D, 0xEF, 0x3F, 0xDC, 0xDF, 0x3E, 0x5E, 0xAF, 0x74,
+	0x65, 0xD8, 0xA1, 0x1E, 0xF1, 0x86, 0x08, 0xF3, 0xEF, 0xBB, 0x99, 0xE3, 0xF0, 0x57, 0xC0, 0x13,
+	0x3A, 0xE6, 0x76, 0x2F, 0x4E, 0xB8, 0xF8, 0x6F, 0xED, 0x55, 0x4D, 0x5F, 0x5C, 0xDD, 0x7D, 0x39,
+	0x1C, 0xCA, 0x73, 0x78, 0x06, 0xFF, 0xBB, 0x60, 0xE2, 0xEE, 0x54, 0x91, 0x17, 0xBB, 0xF5, 0x36,
+	0x4B, 0xA0, 0x5C, 0x0C, 0xA6, 0x1A, 0xA3, 0xF9, 0x3F, 0x4C, 0x4E, 0x4E, 0xC2, 0xFC, 0x27, 0x27,
+	0x27, 0xAF, 0xB8, 0xF8, 0x2B, 0xFB, 0x14, 0x0D, 0x6C, 0x1D, 0x2C, 0x8C, 0x0E, 0x0E, 0x8E, 0x2E,
+	0xEC, 0x6F, 0xF6, 0xE7, 0xE3, 0xE5, 0xB8, 0xAE, 0x6D, 0x9E, 0x39, 0x74, 0x31, 0xDB, 0x92, 0xA2,
+	0xC9, 0x7A, 0x53, 0xC2, 0xEB, 0xC7, 0x6E, 0xA7, 0x8A, 0xB9, 0x0B, 0x59, 0x58, 0xCF, 0x05, 0xE4,
+	0xEF, 0x84, 0xAE, 0x63, 0xD6, 0x25, 0x8C, 0x75, 0x92, 0x0F, 0x54, 0xA8, 0x62, 0xB8, 0xB2, 0xD9,
+	0x8F, 0x7B, 0xE3, 0xDD, 0x1D, 0x7D, 0xF3, 0x37, 0x27, 0xBD, 0xC9, 0x46, 0xFF, 0x38, 0xFE, 0x42,
+	0x1E, 0xCD, 0x67, 0x43, 0x71, 0x50, 0x6B, 0xAC, 0x1C, 0x4B, 0xFB, 0xD4, 0x1B, 0x2E, 0x8F, 0xFE,
+	0xBB, 0x63, 0xD5, 0xD6, 0x44, 0x51, 0x5A, 0x35, 0x73, 0x3E, 0xC7, 0x18, 0xB0, 0xCA, 0xAB, 0x8D,
+	0x31, 0x47, 0xFF, 0xAD, 0x80, 0x7E, 0x7F, 0x44, 0xA7, 0x74, 0x50, 0x67, 0x2F, 0x2E, 0x68, 0x19,
+	0x16, 0xC8, 0x71, 0xA9, 0xC0, 0xF6, 0xB3, 0x93, 0xFE, 0x46, 0xE2, 0xD4, 0xA7, 0xE9, 0x6C, 0x23,
+	0xD4, 0xE7, 0x45, 0xDD, 0x4A, 0x67, 0x1E, 0x77, 0x46, 0xDA, 0x49, 0x1D, 0x63, 0x87, 0x37, 0x23,
+	0x99, 0xC8, 0xA5, 0xDE, 0xE0, 0x2B, 0x16, 0x3E, 0xEF, 0x0C, 0xB7, 0x93, 0x3A, 0x46, 0xF7, 0x3F,
+	0x4C, 0x17, 0xC2, 0x98, 0x44, 0xF1, 0xD5, 0x4B, 0xDF, 0x56, 0xFA, 0xC9, 0xA4, 0xCE, 0x89, 0xE3,
+	0x8B, 0x81, 0x54, 0x23, 0x81, 0xFC, 0xBF, 0x73, 0xF8, 0xCB, 0x78, 0x95, 0x4D, 0x5E, 0x5F, 0x2C,
+	0x8D, 0x0D, 0x70, 0xF3, 0x9F, 0x1B, 0x62, 0x74, 0xB5, 0x90, 0xC7, 0x2F, 0xEE, 0x69, 0x49, 0x3A,
+	0x4F, 0xF3, 0x77, 0x29, 0x5F, 0x5E, 0xAE, 0x40, 0x7A, 0x60, 0x8B, 0x8C, 0xD1, 0xD3, 0xF6, 0x50,
+	0x45, 0x14, 0xFF, 0x5B, 0x52, 0x62, 0x62, 0x28, 0xCB, 0x2A, 0x94, 0x0B, 0x4C, 0x4C, 0xAC, 0x3B,
+	0x45, 0xF3, 0x7F, 0xE7, 0x5F, 0x3D, 0x77, 0x38, 0x5C, 0x97, 0x15, 0x1B, 0x1E, 0x1E, 0x9B, 0x59,
+	0x33, 0xB8, 0x37, 0x55, 0x8A, 0x43, 0x9B, 0x1B, 0x6F, 0x43, 0x3A, 0x2F, 0x19, 0x25, 0x3E, 0xA6,
+	0x50, 0x4D, 0x77, 0x27, 0x8C, 0x7F, 0x1C, 0x4A, 0x44, 0x57, 0x24, 0x39, 0xB7, 0xB4, 0x3A, 0xCA,
+	0xE0, 0x60, 0x57, 0x75, 0x82, 0x2D, 0xA7, 0x4E, 0x28, 0xFA, 0xE7, 0x15, 0x45, 0xC3, 0x5D, 0xB5,
+	0x69, 0xD6, 0xC4, 0x97, 0xE5, 0xA6, 0xA4, 0x00, 0x9F, 0xB0, 0x5C, 0xEA, 0xE9, 0x31, 0x39, 0x58,
+	0xF6, 0x1F, 0xC6, 0x5F, 0x2D, 0x7E, 0xE4, 0xA4, 0x11, 0x0F, 0xFF, 0x86, 0x6B, 0x3C, 0x5E, 0xCC,
+	0x35, 0x45, 0x37, 0x5D, 0x7E, 0x9D, 0xE7, 0x4D, 0x78, 0x8D, 0x50, 0xEA, 0x71, 0xAD, 0xA3, 0x5A,
+	0x54, 0xCF, 0x56, 0x13, 0x1E, 0xD5, 0x66, 0x25, 0x0F, 0x3D, 0x6C, 0x90, 0x52, 0x03, 0x7D, 0x42,
+	0xB2, 0xBA, 0x0E, 0x2E, 0xBA, 0x23, 0x11, 0x9B, 0x59, 0x33, 0x75, 0xFA, 0xB7, 0xE1, 0x14, 0x17,
+	0xCF, 0xD2, 0x95, 0x93, 0x7A, 0xF4, 0xDD, 0x19, 0x65, 0x8C, 0x7F, 0x66, 0x36, 0xC4, 0xFB, 0xE0,
+	0x7D, 0x93, 0xC9, 0xFB, 0x97, 0x1D, 0x21, 0x70, 0x23, 0x68, 0x92, 0x45, 0xFF, 0xC6, 0x3E, 0x9E,
+	0xD4, 0xB2, 0xF9, 0x38, 0x10, 0x07, 0x75, 0xA0, 0xDA, 0xA9, 0x13, 0xBF, 0xCD, 0x55, 0x44, 0x7A,
+	0xE1, 0xFD, 0x52, 0xDB, 0x0E, 0x4F, 0x5A, 0xFD, 0x24, 0x5E, 0xE0, 0x6F, 0x57, 0x38, 0xF3, 0x75,
+	0xA9, 0x35, 0x37, 0x2E, 0x2C, 0x44, 0x1F, 0x5D, 0x1E, 0x94, 0xFE, 0x92, 0x20, 0x77, 0xEF, 0x8C,
+	0xFE, 0xFB, 0xFD, 0x3A, 0xB7, 0x27, 0x0B, 0x46, 0x27, 0x79, 0xF8, 0xB2, 0x3D, 0x04, 0x31, 0xCC,
+	0x44, 0xDC, 0x2A, 0x37, 0x96, 0x4B, 0x1D, 0xB8, 0xF8, 0xE3, 0x95, 0xA1, 0x8A, 0x21, 0xAB, 0xEC,
+	0xC8, 0xC5, 0x5F, 0x1C, 0x5F, 0xC1, 0x58, 0x6F, 0x4D, 0x76, 0xD3, 0x57, 0x90, 0x96, 0x56, 0xD4,
+	0x75, 0x49, 0x68, 0x59, 0xA7, 0xE7, 0xA0, 0x3B, 0x07, 0xFD, 0xEC, 0x85, 0x87, 0xEE, 0x60, 0xA4,
+	0x49, 0x78, 0x83, 0x6B, 0x38, 0xDE, 0x2E, 0xB7, 0xE1, 0xFC, 0x5D, 0x1C, 0x57, 0x32, 0x76, 0xB8,
+	0xD4, 0xD1, 0xC1, 0xDC, 0xED, 0xCF, 0xE2, 0x1C, 0x96, 0x71, 0xC6, 0xE3, 0xF1, 0xD0, 0x0B, 0x2B,
+	0xE1, 0x4F, 0xBE, 0xD8, 0x6F, 0x0A, 0xD2, 0x11, 0x03, 0xDE, 0x5A, 0xA5, 0xD2, 0x3E, 0x31, 0xF2,
+	0xCD, 0x5F, 0xE0, 0x2F, 0x29, 0xC3, 0xDF, 0xD7, 0x89, 0x48, 0x4B, 0x8B, 0xF0, 0xF3, 0xB7, 0x2D,
+	0xDD, 0x98, 0xE7, 0x54, 0x52, 0xC3, 0xEC, 0xB9, 0xF3, 0x16, 0x2F, 0x54, 0x4B, 0xFE, 0x26, 0x88,
+	0x7A, 0x54, 0x6D, 0x07, 0x78, 0xB7, 0x5F, 0x36, 0xB9, 0xE2, 0xAA, 0x37, 0x06, 0x13, 0x75, 0x51,
+	0x2D, 0x47, 0xE3, 0xE1, 0x29, 0x39, 0x5C, 0x5F, 0x1C, 0x90, 0x32, 0x8B, 0xA7, 0xDE, 0xAF, 0x95,
+	0x21, 0x2D, 0xB4, 0x61, 0xDE, 0xCA, 0x6D, 0xAB, 0x27, 0xD8, 0x51, 0xC2, 0xA0, 0xD8, 0x8D, 0x98,
+	0x0F, 0xF1, 0xF4, 0xA0, 0x39, 0x48, 0x4B, 0x08, 0x10, 0x31, 0x48, 0x18, 0xFC, 0xCA, 0xC8, 0x81,
+	0xBE, 0x56, 0xCC, 0xB7, 0xF5, 0xFC, 0xB0, 0x39, 0x48, 0x53, 0x08, 0x10, 0xD6, 0x8D, 0xA4, 0xDC,
+	0x6F, 0x94, 0x41, 0x85, 0x60, 0x5D, 0xBE, 0x73, 0xDD, 0xEA, 0xFB, 0x0E, 0x00, 0xC4, 0x8C, 0x92,
+	0x46, 0x7E, 0x4C, 0xA5, 0x6A, 0x3E, 0xCF, 0x5F, 0x25, 0xA6, 0xEF, 0x81, 0x51, 0x19, 0x64, 0xFA,
+	0x4E, 0x4A, 0x12, 0x5D, 0x1E, 0xCC, 0x85, 0x46, 0x4F, 0x39, 0x40, 0xD4, 0xB6, 0x60, 0xE9, 0x6B,
+	0x7F, 0xF8, 0xDB, 0xA7, 0xF8, 0xE3, 0xEB, 0x0F, 0xE6, 0x08, 0xA8, 0x17, 0x5F, 0x35, 0x66, 0xE0,
+	0x43, 0x5F, 0xB4, 0x12, 0x17, 0x7F, 0x54, 0xC3, 0xC7, 0xC5, 0xDF, 0x82, 0x30, 0xB9, 0xDD, 0x1C,
+	0x6E, 0x00, 0x88, 0x69, 0x5B, 0x58, 0x99, 0xA8, 0x00, 0xBA, 0x61, 0xA4, 0xC3, 0xEE, 0x70, 0x05,
+	0xCE, 0xA7, 0x6D, 0x2A, 0xF6, 0x8E, 0x6B, 0x1D, 0x51, 0x3D, 0x6E, 0xFE, 0xEA, 0x35, 0x11, 0x75,
+	0x35, 0xD3, 0x6C, 0xFA, 0xE7, 0xCD, 0xC1, 0xB6, 0x8E, 0x89, 0x8B, 0xEB, 0xDE, 0x58, 0x35, 0x4E,
+	0x21, 0x92, 0x48, 0x2D, 0xD0, 0xA7, 0xB4, 0xD3, 0xA6, 0x7E, 0x8C, 0x42, 0xAD, 0x97, 0x53, 0xE5,
+	0xF6, 0x25, 0xC9, 0x4B, 0xE8, 0x59, 0xFE, 0xA0, 0xBD, 0xEB, 0xAE, 0xCF, 0x35, 0x98, 0x52, 0xB4,
+	0xF1, 0x0D, 0x0F, 0xF7, 0xB3, 0xE3, 0xE5, 0x2F, 0x15, 0xD4, 0x79, 0x4F, 0x09, 0x45, 0x8A, 0x45,
+	0x26, 0xA4, 0xFB, 0x61, 0x34, 0x51, 0x5D, 0x00, 0xFF, 0x8B, 0x46, 0x97, 0x8C, 0x71, 0x66, 0x09,
+	0xEA, 0x31, 0x54, 0xE2, 0x47, 0x7E, 0x4C, 0x67, 0xB0, 0x19, 0xDA, 0x14, 0xAD, 0x3C, 0x74, 0x05,
+	0xC1, 0xE5, 0x6E, 0x98, 0xBB, 0x72, 0xDF, 0xE6, 0x23, 0xE1, 0x50, 0xC0, 0x3C, 0xAA, 0x75, 0x42,
+	0x99, 0x12, 0x49, 0x13, 0x7F, 0x9B, 0x48, 0x61, 0xBF, 0x40, 0xAE, 0xF5, 0xC7, 0xC7, 0xB0, 0xE5,
+	0xAA, 0x96, 0x34, 0xF1, 0xB7, 0xC9, 0x34, 0xB6, 0x79, 0x6E, 0x53, 0xBA, 0x75, 0x4C, 0xF6, 0x42,
+	0x4A, 0xF9, 0xB8, 0x86, 0x65, 0x85, 0x09, 0x79, 0xB7, 0xED, 0xAE, 0x17, 0x9A, 0x3C, 0xCF, 0xDF,
+	0xB6, 0x6C, 0xFD, 0xA8, 0xD9, 0xFF, 0x9D, 0xAC, 0x34, 0x77, 0x79, 0x8C, 0x4E, 0xB1, 0xDA, 0x43,
+	0xF9, 0xC8, 0x81, 0xDF, 0x66, 0x52, 0xD5, 0x9F, 0xC0, 0xAF, 0x96, 0x30, 0x72, 0xDF, 0x19, 0x84,
+	0x3E, 0xD3, 0xB9, 0x7A, 0x77, 0xB5, 0xD8, 0xFA, 0x35, 0xFC, 0xE5, 0x43, 0xBB, 0xAE, 0xBB, 0xA3,
+	0x75, 0x00, 0x4D, 0xAF, 0xD4, 0xD2, 0xF2, 0x82, 0x38, 0x27, 0x45, 0xFD, 0xE4, 0x11, 0x66, 0xA1,
+	0x05, 0xD7, 0xA7, 0x77, 0x4A, 0x51, 0xBF, 0x6B, 0x67, 0x32, 0x3E, 0x74, 0xFA, 0x22, 0x74, 0x84,
+	0xBC, 0x49, 0x17, 0xBB, 0x4D, 0xD1, 0xDE, 0xBE, 0x19, 0xFD, 0xEF, 0x37, 0xCB, 0x51, 0x95, 0x68,
+	0x15, 0xF9, 0x4E, 0xEB, 0xF2, 0x9D, 0x2B, 0xA2, 0x27, 0xFB, 0x0C, 0x8D, 0xE4, 0xC9, 0x1F, 0xC3,
+	0xD1, 0x0A, 0xCF, 0xF1, 0xCF, 0x6E, 0x01, 0xED, 0xDD, 0x54, 0x27, 0x54, 0x3D, 0xD0, 0x0B, 0x29,
+	0x6E, 0x1F, 0x1C, 0xEC, 0x28, 0xE3, 0xE5, 0xAF, 0x9F, 0x31, 0xB3, 0x5D, 0x81, 0xB2, 0x8B, 0xEC,
+	0xCB, 0xB7, 0x50, 0xF7, 0xC0, 0x32, 0x85, 0x6F, 0xDA, 0x42, 0xEC, 0xE3, 0x69, 0xBB, 0x95, 0xC1,
+	0x6D, 0x67, 0x6D, 0x21, 0xA8, 0xD7, 0xDA, 0x24, 0x7F, 0xE5, 0xA1, 0x33, 0x80, 0xDD, 0xCE, 0xBC,
+	0x8B, 0x19, 0xFE, 0x39, 0x99, 0x0C, 0xBF, 0xBB, 0x6A, 0x49, 0xE3, 0x3F, 0xE9, 0x19, 0x9E, 0xB9,
+	0xB4, 0x7B, 0x7A, 0x06, 0x6A, 0xB0, 0x69, 0x56, 0xB4, 0x7E, 0xDF, 0xEE, 0xCB, 0x1E, 0xAD, 0x99,
+	0x14, 0xD0, 0xE9, 0xED, 0x3E, 0xD0, 0x85, 0x0A, 0xD6, 0x1E, 0xBB, 0x02, 0xD8, 0x3D, 0xA6, 0x76,
+	0x7A, 0x4D, 0x4D, 0x4D, 0x00, 0xFB, 0x33, 0xB6, 0x95, 0xFB, 0x57, 0xAD, 0x01, 0x2C, 0xBA, 0x6E,
+	0x65, 0x65, 0x65, 0x39, 0xCF, 0xF3, 0x7F, 0xE3, 0xDF, 0x79, 0x3F, 0x95, 0xE6, 0x15, 0x1E, 0x15,
+	0xE6, 0x69, 0x2C, 0x86, 0x2A, 0x0F, 0x0A, 0x8D, 0xDD, 0x1F, 0x7A, 0xB7, 0xBF, 0x67, 0xE6, 0xE8,
+	0x3F, 0xC1, 0xDF, 0xBA, 0x74, 0x63, 0xBB, 0xDC, 0x16, 0x7D, 0x44, 0x3B, 0x6D, 0xFA, 0xB6, 0xDD,
+	0x4F, 0xEC, 0x15, 0xFC, 0x2D, 0x0A, 0x96, 0xE6, 0x73, 0x2D, 0x01, 0x9D, 0x88, 0x7A, 0xFA, 0xF6,
+	0xDE, 0xEA, 0x60, 0x59, 0x90, 0x22, 0xAE, 0xE1, 0xB8, 0xD5, 0x9B, 0x53, 0xFB, 0x9C, 0xEA, 0xCF,
+	0xB8, 0xF8, 0x6B, 0x65, 0x2C, 0x7C, 0xEC, 0xF2, 0x43, 0x1A, 0xD9, 0xB7, 0x91, 0xB4, 0x1F, 0xF4,
+	0x24, 0x6D, 0x40, 0xD4, 0xB6, 0x68, 0xF5, 0xBE, 0xDD, 0x57, 0x58, 0x00, 0x7F, 0xB7, 0xE6, 0xCB,
+	0xDD, 0x32, 0xE8, 0x65, 0x94, 0x0A, 0xED, 0xFB, 0x36, 0x97, 0xAE, 0xF5, 0x1C, 0xFF, 0xC9, 0xF3,
+	0xEB, 0xDB, 0x2F, 0x47, 0xC3, 0x79, 0x9C, 0xCA, 0xAA, 0x15, 0x49, 0x64, 0xDE, 0x3D, 0x5E, 0xDD,
+	0xAF, 0xB5, 0xF1, 0xF0, 0x77, 0xAB, 0x3B, 0x1C, 0x4F, 0xD2, 0x44, 0x39, 0x19, 0x12, 0xC7, 0xDE,
+	0x77, 0x07, 0xA3, 0x2A, 0x82, 0x65, 0xC1, 0xC2, 0x4A, 0x6B, 0x4D, 0xD7, 0xFE, 0x48, 0x72, 0x09,
+	0x73, 0x3C, 0xC3, 0x04, 0x75, 0xAA, 0x7D, 0xF5, 0xE1, 0x49, 0x1D, 0x54, 0xBD, 0x85, 0x7D, 0x3B,
+	0x1E, 0x56, 0xF2, 0x0C, 0xE1, 0x9E, 0xC6, 0xB3, 0x71, 0xEF, 0xAC, 0xA3, 0x66, 0xEA, 0x6E, 0xAE,
+	0x1C, 0x2F, 0xC6, 0x35, 0xA2, 0x41, 0xDA, 0x41, 0xD5, 0xB0, 0x84, 0x84, 0x04, 0xE8, 0x64, 0xBB,
+	0xEA, 0xC3, 0x73, 0xD8, 0x66, 0x11, 0xB6, 0xB0, 0xB7, 0xB7, 0x87, 0x7A, 0x3D, 0xFD, 0xCC, 0x99,
+	0x3F, 0x97, 0xEA, 0xE2, 0xDC, 0x0C, 0x15, 0x80, 0x77, 0x96, 0x96, 0x96, 0x66, 0x6F, 0x9E, 0xE5,
+	0xAF, 0x14, 0x3F, 0xF6, 0xA1, 0x3B, 0x8F, 0x34, 0x30, 0xDC, 0xDF, 0x92, 0xE5, 0x2E, 0xC7, 0x29,
+	0x8F, 0x0E, 0x88, 0x3F, 0x8E, 0x78, 0xB3, 0x96, 0x6F, 0x24, 0x18, 0xBF, 0xB0, 0x37, 0xF9, 0x66,
+	0x26, 0x8D, 0x6B, 0x84, 0x2B, 0x19, 0xDC, 0xF3, 0x69, 0x3C, 0x51, 0xF5, 0x65, 0xFE, 0xA2, 0xBE,
+	0xE4, 0xEB, 0xCE, 0x20, 0x19, 0xC5, 0xE0, 0x96, 0x8D, 0xB5, 0xBE, 0x4E, 0xDA, 0x78, 0x7F, 0xBA,
+	0xA6, 0x61, 0xCE, 0xE2, 0x50, 0xB4, 0xFC, 0x6B, 0xF9, 0x2B, 0xC6, 0x8D, 0xFF, 0xA4, 0x45, 0xC8,
+	0x00, 0x80, 0x4A, 0x02, 0xFD, 0xD3, 0x40, 0x98, 0xB4, 0x00, 0xFE, 0xDE, 0xED, 0x0F, 0xAB, 0x79,
+	0xD0, 0xBD, 0x0B, 0xF9, 0x74, 0x3C, 0xAE, 0xE4, 0x1A, 0x3C, 0xCD, 0x7F, 0xA9, 0x7F, 0xB9, 0xA7,
+	0x85, 0x34, 0x7C, 0xF4, 0x9E, 0x96, 0x0C, 0x77, 0xD6, 0x6F, 0xBC, 0x1B, 0xB6, 0x3E, 0x2D, 0x74,
+	0x36, 0xB7, 0xD1, 0x17, 0xFB, 0xB8, 0xF8, 0xBF, 0x8B, 0x1E, 0xB8, 0x24, 0x79, 0xA3, 0x5C, 0x5D,
+	0x22, 0x5E, 0xC4, 0x8B, 0xB9, 0x2C, 0x54, 0xA5, 0x95, 0xF5, 0xAB, 0x99, 0x3E, 0x3C, 0xDE, 0x1D,
+	0x2D, 0x4A, 0x1C, 0xDC, 0xAC, 0xC6, 0xA1, 0x9D, 0x62, 0xAE, 0x4D, 0x97, 0x9C, 0x4A, 0xE0, 0xDE,
+	0x7C, 0xB5, 0xCD, 0x79, 0x46, 0x9D, 0xF8, 0xDE, 0xB5, 0x8E, 0x81, 0xCB, 0xB1, 0x52, 0x6F, 0xB4,
+	0x5F, 0xC8, 0xAD, 0x19, 0x35, 0x6A, 0x92, 0x53, 0x52, 0x52, 0x82, 0x3C, 0x4D, 0x2E, 0x0D, 0xE7,
+	0x87, 0x55, 0x60, 0xE5, 0x93, 0x82, 0x04, 0x23, 0xF0, 0x69, 0x58, 0xFB, 0x63, 0x9B, 0x56, 0x9F,
+	0x13, 0x8D, 0x37, 0x92, 0xE2, 0x7A, 0x44, 0x41, 0xFC, 0x75, 0xB3, 0x16, 0x2F, 0x9A, 0xE6, 0xAE,
+	0xCE, 0xCF, 0x3E, 0x9C, 0x4D, 0x94, 0xB8, 0x8B, 0xF1, 0xF1, 0xC7, 0x93, 0x6E, 0x57, 0x91, 0x37,
+	0x94, 0x47, 0x0A, 0xD1, 0xC3, 0xBF, 0x0D, 0x44, 0x70, 0x1B, 0x07, 0x6E, 0x8D, 0xE7, 0xAB, 0x05,
+	0x26, 0x2F, 0xF3, 0x57, 0x49, 0x18, 0xDF, 0x2A, 0xB3, 0x01, 0x1C, 0xCB, 0x98, 0x2B, 0xB5, 0x91,
+	0xBE, 0xC5, 0x83, 0xF4, 0x44, 0xE5, 0x77, 0x71, 0x63, 0x70, 0x0D, 0x7D, 0x05, 0x7F, 0xB9, 0xE8,
+	0xE1, 0x3F, 0x26, 0xC0, 0xCE, 0x5D, 0x36, 0xAA, 0xBB, 0xBB, 0x3B, 0x4A, 0x96, 0x9F, 0xBF, 0xB0,
+	0x5F, 0xD7, 0x47, 0x26, 0x01, 0xF6, 0x5F, 0x79, 0x92, 0xEF, 0xD7, 0x0B, 0x8C, 0x9F, 0xE6, 0xDF,
+	0xD9, 0x5F, 0x19, 0xE6, 0xEE, 0x91, 0xDC, 0x75, 0x79, 0x50, 0xEF, 0x8E, 0xF8, 0xAF, 0xA6, 0xFE,
+	0x98, 0x29, 0x09, 0x74, 0xF3, 0xC9, 0xEC, 0x9F, 0x5A, 0x45, 0xF3, 0xB7, 0x28, 0x5C, 0x66, 0xE6,
+	0x9B, 0x73, 0xB9, 0x7B, 0xF2, 0x96, 0x8E, 0x1B, 0xDC, 0xD1, 0x1E, 0x3E, 0xEF, 0xAC, 0xEA, 0x86,
+	0x8A, 0x14, 0xDF, 0xA6, 0xFD, 0x9E, 0x28, 0x35, 0x79, 0x59, 0x8E, 0x77, 0x10, 0x47, 0xBC, 0xD9,
+	0x2A, 0x86, 0x9D, 0x60, 0x2E, 0x8D, 0x17, 0x7B, 0xE5, 0x88, 0x5F, 0x42, 0xC3, 0xBF, 0x74, 0xE4,
+	0x6C, 0x89, 0x92, 0xE5, 0x26, 0x2F, 0xA1, 0xAD, 0xAD, 0x0D, 0xBF, 0x03, 0xEE, 0x2D, 0xD7, 0x5C,
+	0xE5, 0x80, 0x7A, 0x91, 0xF6, 0x2B, 0xAC, 0x01, 0xC0, 0x22, 0x0C, 0x12, 0xEC, 0x79, 0xD1, 0x0C,
+	0xAB, 0x9B, 0xBE, 0xF8, 0x76, 0xBC, 0x48, 0x6B, 0xCA, 0xF6, 0x37, 0x7C, 0x89, 0xBF, 0x69, 0xD1,
+	0xC6, 0xE4, 0xF0, 0x46, 0x6F, 0x63, 0x03, 0x75, 0xEB, 0xF3, 0x44, 0xA6, 0x31, 0xF2, 0x61, 0x2A,
+	0x9B, 0xBF, 0xA8, 0x7F, 0xD7, 0x07, 0x46, 0xD6, 0x13, 0x03, 0x40, 0xAD, 0xF4, 0xB9, 0x87, 0x76,
+	0x1F, 0x6E, 0xE7, 0xB3, 0x65, 0xE9, 0xF6, 0x51, 0x8D, 0xC3, 0xCB, 0xFC, 0x8D, 0xF3, 0x57, 0x66,
+	0x52, 0x35, 0xDF, 0x45, 0xF5, 0x5F, 0xB7, 0x87, 0xA8, 0xDA, 0x54, 0x1E, 0x8C, 0x44, 0xCB, 0x49,
+	0x86, 0xF6, 0xA3, 0x9B, 0x1A, 0xF7, 0xE6, 0xCB, 0x8D, 0x42, 0x94, 0x6D, 0xA9, 0x9E, 0x3A, 0xF3,
+	0x85, 0x1A, 0x8C, 0x18, 0xE8, 0xA2, 0x7E, 0xED, 0xB7, 0x7B, 0x2D, 0xD1, 0xF6, 0xEA, 0xA2, 0x0E,
+	0xFE, 0xFE, 0xFE, 0xF6, 0xC0, 0xDF, 0xC9, 0x7F, 0x73, 0x92, 0x18, 0xA0, 0x04, 0x00, 0x66, 0xD9,
+	0x73, 0xDF, 0x06, 0x22, 0xA1, 0x76, 0xD0, 0xB9, 0xF6, 0xF0, 0xA4, 0xC9, 0x5B, 0x16, 0x10, 0xB3,
+	0xCD, 0x67, 0x0C, 0xA3, 0xF8, 0x8B, 0xF9, 0x92, 0xAF, 0xFA, 0x23, 0xB9, 0x7C, 0xB7, 0xF2, 0x11,
+	0x7D, 0x9F, 0x69, 0x31, 0x68, 0xB7, 0x9D, 0x84, 0x81, 0xBD, 0xB3, 0xAD, 0x55, 0xDE, 0xEC, 0x6C,
+	0x9E, 0x7D, 0x50, 0x4C, 0x94, 0x8F, 0xA9, 0xE8, 0x8B, 0xFC, 0xB5, 0xC2, 0x1A, 0x18, 0xD3, 0xB3,
+	0x7D, 0xD3, 0x05, 0x4E, 0x22, 0x4E, 0x99, 0x99, 0x99, 0x81, 0xD2, 0xAF, 0xE3, 0xEF, 0x49, 0x1E,
+	0x60, 0x89, 0xE3, 0xF5, 0x52, 0xF7, 0x26, 0xB4, 0xD2, 0xB7, 0xEF, 0x7E, 0x3B, 0x9D, 0x25, 0xA5,
+	0xD8, 0x0A, 0x3D, 0xCF, 0xDF, 0xAA, 0x7C, 0xAF, 0x6F, 0xA4, 0x2E, 0xCA, 0xD5, 0x39, 0x8A, 0x78,
+	0x78, 0x46, 0x84, 0x1C, 0xB9, 0x80, 0x59, 0xF1, 0xC4, 0x02, 0x8B, 0xBF, 0x46, 0xE2, 0xD8, 0x9F,
+	0x63, 0xF1, 0x4F, 0x78, 0xB1, 0x8D, 0xF3, 0xD7, 0x2E, 0x9B, 0x78, 0x06, 0x87, 0x06, 0xB9, 0xCB,
+	0x37, 0xB0, 0x95, 0xFE, 0x1C, 0x7F, 0xBB, 0xAA, 0x03, 0x5A, 0xC4, 0x5B, 0xB3, 0x82, 0xE5, 0xE5,
+	0x02, 0x0B, 0xC0, 0xA9, 0xFE, 0xB4, 0x3F, 0x54, 0x52, 0x34, 0x80, 0xB2, 0x5D, 0x02, 0xD5, 0xAA,
+	0x37, 0x66, 0xB6, 0xF1, 0x83, 0x5F, 0x27, 0x53, 0x51, 0x7D, 0xAC, 0x6C, 0x44, 0xFF, 0xE7, 0xE9,
+	0x2C, 0x47, 0x0B, 0xB8, 0x87, 0xB0, 0xCA, 0x9F, 0xFD, 0x6D, 0xBB, 0xB7, 0x2C, 0xD1, 0xC7, 0x5C,
+	0x16, 0x35, 0x09, 0x84, 0xE2, 0x2F, 0xE4, 0xDB, 0xF9, 0x61, 0x19, 0xB1, 0x5D, 0xBC, 0xDA, 0xDE,
+	0xC3, 0x6F, 0x97, 0x20, 0xFE, 0x33, 0x4B, 0xAC, 0xE7, 0x95, 0x0E, 0xED, 0xFD, 0x32, 0x9B, 0xC6,
+	0xFE, 0x56, 0x51, 0xFF, 0xAE, 0xC7, 0x45, 0x82, 0x21, 0x6B, 0xFC, 0xDF, 0xD3, 0x89, 0xE2, 0xAF,
+	0x95, 0x42, 0x3F, 0xA8, 0xE5, 0xF1, 0x16, 0x38, 0xD7, 0xEC, 0xAF, 0x16, 0x59, 0xF2, 0xDA, 0xC7,
+	0x51, 0x94, 0xFD, 0x26, 0xFF, 0x12, 0xCA, 0xC8, 0x10, 0x39, 0x13, 0xF6, 0xDB, 0xB9, 0xB7, 0x5C,
+	0x23, 0x4F, 0xC9, 0xC5, 0x5F, 0x2E, 0xA0, 0x71, 0xFD, 0x66, 0xB4, 0x8A, 0xF9, 0x38, 0x9C, 0x69,
+	0xE5, 0x49, 0x66, 0x8C, 0xC6, 0xC8, 0xBF, 0xC8, 0xFF, 0xA0, 0xD2, 0x06, 0xE4, 0x7F, 0x73, 0x73,
+	0x73, 0xF3, 0xE1, 0x2B, 0x87, 0x3F, 0x20, 0x61, 0xEA, 0x9B, 0x52, 0xDE, 0x3E, 0xB1, 0xF3, 0xF5,
+	0xB8, 0x3F, 0xDD, 0xFC, 0x79, 0xFE, 0x36, 0x95, 0x4B, 0x8B, 0xE4, 0x10, 0x75, 0x00, 0xD0, 0x4F,
+	0x99, 0xF8, 0x63, 0x24, 0xF6, 0x1D, 0xFC, 0xE1, 0xB5, 0xE9, 0xF6, 0x70, 0x7D, 0x05, 0x35, 0xAF,
+	0x9A, 0xED, 0x1B, 0xC4, 0x9E, 0xE3, 0x95, 0x45, 0xE9, 0xCE, 0x09, 0x7A, 0x84, 0xC6, 0xB6, 0xD2,
+	0x17, 0x1E, 0x3B, 0x7C, 0x5E, 0xE6, 0xEF, 0xD6, 0x74, 0xD9, 0x1D, 0x20, 0xEA, 0xD6, 0x74, 0x3E,
+	0x1A, 0xAB, 0x04, 0xE0, 0x88, 0xD7, 0xDD, 0xFE, 0x22, 0x22, 0xFE, 0xDD, 0xC8, 0x83, 0x9A, 0xE4,
+	0x54, 0x76, 0xEF, 0xEF, 0xB5, 0xF8, 0xA2, 0x1D, 0x42, 0xCE, 0x15, 0xCC, 0xAB, 0xC1, 0x6A, 0xC4,
+	0xB9, 0x2F, 0xE3, 0x5D, 0x35, 0x73, 0xFB, 0xB8, 0x39, 0xD6, 0x9A, 0x17, 0xC4, 0x71, 0x39, 0x72,
+	0xF5, 0xFF, 0x9E, 0xAD, 0x77, 0x48, 0x0B, 0x22, 0xE2, 0xDF, 0xFD, 0x71, 0x09, 0x6A, 0x0C, 0x04,
+	0xF1, 0x1F, 0xA2, 0xB3, 0xFB, 0x3B, 0xCF, 0xD6, 0xBB, 0x95, 0x5C, 0x76, 0xAB, 0x29, 0x1D, 0x3E,
+	0xF8, 0x63, 0x22, 0x41, 0x89, 0xC5, 0x9F, 0x4A, 0x43, 0xF1, 0x77, 0xAC, 0xDA, 0x9D, 0x4E, 0xD7,
+	0xE5, 0xF1, 0x84, 0xA4, 0x4D, 0xDD, 0xB4, 0xF9, 0x71, 0x4F, 0x97, 0x89, 0xE0, 0xAA, 0x37, 0x68,
+	0x89, 0x55, 0x8C, 0x9D, 0xA9, 0xB9, 0xF3, 0xE1, 0x4C, 0xE8, 0x46, 0x9C, 0x1B, 0xCE, 0xF6, 0x2B,
+	0x61, 0x7F, 0x05, 0x9E, 0x74, 0xBB, 0x59, 0x04, 0x35, 0x06, 0xD6, 0x45, 0x8C, 0x8F, 0xC3, 0xD9,
+	0x41, 0x4D, 0xDB, 0x97, 0xD4, 0xC4, 0x40, 0xCA, 0xA7, 0xC1, 0x70, 0x19, 0xE4, 0x1D, 0x41, 0x4E,
+	0x10, 0x32, 0xB6, 0xB4, 0xB4, 0x54, 0x41, 0x4A, 0x93, 0x55, 0xFA, 0xE0, 0xEC, 0x03, 0x91, 0xC8,
+	0x40, 0xF8, 0x0B, 0x4B, 0x48, 0x48, 0x00, 0x62, 0x9A, 0xB6, 0x7E, 0xC9, 0xD5, 0x23, 0x57, 0x17,
+	0x9D, 0xA1, 0xB2, 0x2F, 0xF0, 0x1F, 0x9F, 0xAE, 0x06, 0x47, 0x2E, 0x62, 0xFE, 0x9D, 0x8F, 0x8C,
+	0x4C, 0x1D, 0xE4, 0xC3, 0xDD, 0xFD, 0xA4, 0x8C, 0x98, 0xC4, 0xAA, 0xD9, 0xDF, 0x19, 0x05, 0x96,
+	0x4F, 0x99, 0xFF, 0x15, 0xFB, 0x47, 0xD5, 0x76, 0xDC, 0xC7, 0x34, 0xD2, 0xE6, 0x3E, 0x75, 0xFB,
+	0x8B, 0xBC, 0xC8, 0xDF, 0xA3, 0xF5, 0xAE, 0xDD, 0x5B, 0x34, 0xA0, 0xFB, 0x23, 0x25, 0x40, 0x0C,
+	0xF0, 0xE9, 0x00, 0xCD, 0x2B, 0xB1, 0xC0, 0x1E, 0xA4, 0x65, 0x34, 0x2F, 0x99, 0x1A, 0xA2, 0xB4,
+	0xC6, 0x72, 0x4D, 0x3E, 0x29, 0x05, 0x56, 0x8F, 0x76, 0xD1, 0x9A, 0x5C, 0x91, 0xDF, 0xBD, 0xF2,
+	0xBA, 0x18, 0xA7, 0xDF, 0x2F, 0x19, 0xE4, 0x14, 0x6B, 0x81, 0xFC, 0x9D, 0xEA, 0x4E, 0x0E, 0xE1,
+	0xBE, 0x48, 0x2E, 0x92, 0xF6, 0x63, 0x0A, 0x1A, 0x6A, 0x09, 0xE2, 0xDF, 0x07, 0xF1, 0x77, 0x6B,
+	0xBE, 0x82, 0xBB, 0x09, 0xD9, 0xA8, 0xE1, 0x3F, 0x47, 0xA2, 0xE5, 0xD8, 0xFC, 0xC7, 0x39, 0xFC,
+	0x65, 0xC3, 0xA8, 0x77, 0x1D, 0x01, 0x3C, 0x13, 0x96, 0xE2, 0xFE, 0xED, 0x37, 0x93, 0xA9, 0xDC,
+	0x53, 0x88, 0xC6, 0x19, 0xE3, 0xCC, 0xD2, 0xA4, 0xB1, 0xED, 0xC6, 0xE4, 0xCC, 0x9E, 0x0B, 0xB2,
+	0xAF, 0x28, 0x3C, 0x28, 0xBD, 0x84, 0xE6, 0x61, 0x00, 0x89, 0x20, 0xCA, 0xA7, 0xC5, 0x6C, 0x3D,
+	0xC8, 0x40, 0x6D, 0xBB, 0x5D, 0x2F, 0x73, 0xD2, 0x8E, 0x6A, 0x3F, 0x3E, 0x6C, 0x4B, 0x18, 0x7F,
+	0xE8, 0xF0, 0x83, 0x1A, 0x35, 0xDB, 0xCA, 0xFD, 0x0B, 0xB8, 0x95, 0xD5, 0x4D, 0x2F, 0x2B, 0x2B,
+	0xF3, 0x42, 0x7A, 0xDA, 0x3B, 0xB2, 0xB7, 0x10, 0x6B, 0xF6, 0x11, 0x97, 0x89, 0xF0, 0x97, 0xF1,
+	0x08, 0x09, 0x09, 0x01, 0xBB, 0x43, 0x31, 0x4D, 0xD7, 0xCC, 0xB1, 0x1F, 0x0B, 0xD9, 0xFA, 0xCF,
+	0xF2, 0xB7, 0x2E, 0xDF, 0xDB, 0x62, 0x7B, 0x0B, 0x70, 0x2D, 0xD7, 0xB0, 0x81, 0x0C, 0x7E, 0x78,
+	0xA3, 0xFF, 0x68, 0x76, 0x94, 0xBE, 0xF9, 0xDB, 0x56, 0x73, 0xA0, 0xEC, 0x3F, 0x81, 0xBF, 0x57,
+	0xDB, 0x3D, 0xD9, 0x53, 0x3A, 0x7C, 0xF0, 0xAE, 0xD5, 0x03, 0x78, 0x13, 0xD4, 0x73, 0xD9, 0xE4,
+	0x0A, 0xBC, 0x8D, 0xA0, 0x2D, 0xC3, 0x37, 0x60, 0x5E, 0x42, 0xA1, 0x31, 0xC6, 0xF2, 0xB8, 0xC6,
+	0x96, 0x06, 0x49, 0x94, 0xCD, 0x49, 0x14, 0x7F, 0x40, 0xDA, 0x2A, 0x34, 0xA7, 0x91, 0xB6, 0xFE,
+	0xE5, 0xA4, 0x37, 0x49, 0x5F, 0x10, 0x7F, 0xD3, 0x02, 0xD0, 0xBD, 0x22, 0x03, 0xB9, 0xE8, 0x16,
+	0xBE, 0xF4, 0x85, 0xC9, 0xBC, 0xC8, 0xDF, 0xBD, 0xE5, 0x1A, 0xCD, 0x9F, 0xDD, 0x0A, 0xEB, 0xE7,
+	0x50, 0xC7, 0x38, 0xFC, 0x8D, 0x73, 0x18, 0xEB, 0x25, 0xD6, 0xBC, 0x85, 0x61, 0x55, 0xBC, 0xB6,
+	0x57, 0xED, 0xC4, 0x65, 0x1E, 0xB3, 0x86, 0xFE, 0x05, 0xEB, 0xE3, 0x09, 0x9A, 0x56, 0xC5, 0x1B,
+	0xA3, 0x31, 0x6C, 0x27, 0x80, 0x6E, 0xE6, 0xFC, 0x57, 0xD8, 0x78, 0xD0, 0x4A, 0xA1, 0xFF, 0x84,
+	0xDB, 0x5C, 0x10, 0xCA, 0x54, 0x92, 0x2A, 0x60, 0x9C, 0xD4, 0x77, 0xBD, 0xD9, 0xB8, 0xB9, 0x57,
+	0x0D, 0x37, 0xAC, 0x86, 0x39, 0x4B, 0x9F, 0xA8, 0x50, 0x2D, 0xB6, 0x2A, 0xDD, 0xDA, 0x25, 0x79,
+	0x40, 0x2D, 0x4E, 0xC6, 0xEC, 0x8F, 0x91, 0x78, 0x75, 0xD8, 0x37, 0x02, 0xF3, 0xD7, 0x48, 0xEB,
+	0xEB, 0xEB, 0x0B, 0x95, 0x64, 0x0F, 0x28, 0x5B, 0x6F, 0x39, 0x2D, 0x6A, 0xE1, 0xC6, 0x1D, 0xF4,
+	0x0C, 0x32, 0xE1, 0x83, 0x3F, 0x66, 0x52, 0xD4, 0x61, 0x2F, 0xC2, 0x55, 0x0B, 0xEB, 0xB5, 0xF0,
+	0x20, 0xDD, 0x22, 0xD6, 0x12, 0x6B, 0x3C, 0xDC, 0xC5, 0xD8, 0x3B, 0xDE, 0x99, 0x6A, 0x8C, 0x7C,
+	0xD2, 0xFD, 0x6F, 0x59, 0xB6, 0x0B, 0x79, 0x9A, 0x50, 0x13, 0xD2, 0xE9, 0xF3, 0x88, 0x97, 0xE6,
+	0x85, 0xFA, 0xDF, 0xE6, 0xFD, 0x36, 0x72, 0x08, 0x7C, 0x27, 0xE5, 0x23, 0x7A, 0xC7, 0x6A, 0xEC,
+	0x01, 0xED, 0xB4, 0x99, 0xC9, 0x24, 0xD8, 0x89, 0x1D, 0x9E, 0x50, 0xC5, 0xB8, 0xA7, 0x46, 0xA0,
+	0x26, 0x55, 0x44, 0xBC, 0x89, 0x47, 0xDB, 0x4D, 0xC9, 0xD1, 0x70, 0x87, 0x26, 0x2B, 0x2B, 0x2B,
+	0x21, 0x6B, 0x8C, 0x8B, 0xA9, 0x18, 0x7B, 0x7F, 0xD8, 0xEC, 0x29, 0x24, 0x80, 0xBF, 0x52, 0x2C,
+	0xED, 0xEB, 0x7C, 0x2E, 0x8B, 0x94, 0x9C, 0x6F, 0xF3, 0xC9, 0x61, 0x9D, 0xEB, 0xD3, 0xFE, 0xDF,
+	0xB1, 0x49, 0x16, 0x7F, 0x70, 0x44, 0xBE, 0x04, 0xD5, 0x48, 0xC9, 0x90, 0xBE, 0x6F, 0xD3, 0xAC,
+	0x62, 0xD2, 0xCF, 0xA1, 0xF4, 0x23, 0xFC, 0xC1, 0xA9, 0x9F, 0xE1, 0x38, 0xDE, 0x89, 0x78, 0x40,
+	0x39, 0x76, 0x88, 0x67, 0x12, 0xC8, 0x11, 0x1C, 0xFA, 0x9B, 0x97, 0x6C, 0x0F, 0x45, 0xBE, 0xD5,
+	0xCF, 0x59, 0xA6, 0x27, 0xB0, 0xAD, 0xA8, 0xB7, 0xA1, 0x3D, 0x8F, 0x2B, 0x25, 0x8E, 0x60, 0x63,
+	0x20, 0x89, 0xAF, 0xDD, 0xBD, 0x20, 0x42, 0x7E, 0xE3, 0x37, 0x41, 0xD4, 0x2F, 0x33, 0xA9, 0x5A,
+	0x00, 0x60, 0x9D, 0x35, 0xBA, 0x3D, 0x38, 0x36, 0x8E, 0x4C, 0x28, 0x2B, 0x46, 0x0D, 0x7C, 0x61,
+	0xE4, 0xB1, 0x9E, 0x42, 0xD2, 0x8F, 0x7C, 0xBD, 0x53, 0x61, 0x0B, 0x3B, 0x1D, 0x29, 0xEF, 0xB7,
+	0xAA, 0x70, 0x52, 0x3C, 0xFC, 0x95, 0x13, 0x26, 0xBE, 0x8F, 0x25, 0x68, 0x42, 0xDD, 0xCB, 0xCD,
+	0x4E, 0x29, 0x54, 0xE0, 0xBA, 0x99, 0x0B, 0xDF, 0xFA, 0x23, 0x59, 0xF7, 0xA0, 0x97, 0x36, 0xFD,
+	0x13, 0xF6, 0x85, 0xA9, 0x27, 0xD3, 0xBF, 0xF6, 0x47, 0x29, 0x83, 0xAD, 0x5A, 0xEF, 0x17, 0xC4,
+	0x17, 0xC5, 0xE2, 0x1F, 0x4A, 0xA8, 0xA8, 0x29, 0x4B, 0xF7, 0xD1, 0x7A, 0xD2, 0xFB, 0x6F, 0x5A,
+	0xB8, 0x71, 0xDE, 0xC0, 0x63, 0x07, 0xE9, 0x66, 0x2F, 0xC1, 0xAF, 0xD9, 0xB3, 0xFC, 0x5D, 0x9B,
+	0x2E, 0x28, 0x81, 0x52, 0x61, 0x03, 0x8F, 0x9D, 0xFE, 0x92, 0xF6, 0x85, 0x23, 0xA3, 0x55, 0xB6,
+	0x22, 0xAE, 0xD5, 0xBB, 0x5D, 0x41, 0xB0, 0x7D, 0x2F, 0xAB, 0x12, 0xD8, 0xF9, 0x7E, 0x91, 0x80,
+	0xF2, 0x3C, 0x29, 0xC5, 0x8D, 0xFD, 0x1C, 0x8E, 0xD3, 0x82, 0x4B, 0xD8, 0x2E, 0x2A, 0x2A, 0xCA,
+	0x4F, 0x1E, 0x00, 0x54, 0xDC, 0xF2, 0xE7, 0x7F, 0x0E, 0xC7, 0x28, 0x08, 0xE0, 0x0F, 0xB8, 0x56,
+	0x6F, 0xDD, 0xF4, 0xA6, 0x3A, 0xEB, 0x6A, 0x18, 0xF9, 0x94, 0xCC, 0x7D, 0x1F, 0x4F, 0xD5, 0x7B,
+	0x9A, 0x3F, 0x83, 0xC9, 0xE2, 0xAF, 0x1A, 0x37, 0xFC, 0x73, 0x22, 0x11, 0x82, 0xEB, 0x49, 0xBA,
+	0x5E, 0x67, 0x39, 0x33, 0xF5, 0x73, 0x46, 0xBA, 0x11, 0xFE, 0x6A, 0xF1, 0x23, 0xA7, 0xE8, 0xF9,
+	0x9C, 0xA7, 0x26, 0x81, 0x74, 0x59, 0x43, 0x7F, 0x16, 0x7F, 0x59, 0x83, 0xDC, 0x95, 0x89, 0x78,
+	0xC8, 0xB6, 0xB2, 0x2B, 0x5D, 0xFE, 0x30, 0x94, 0xE5, 0xA6, 0xA7, 0x61, 0xE0, 0x91, 0x4F, 0xFF,
+	0x6D, 0x16, 0x71, 0x9F, 0xE3, 0x5B, 0xCE, 0x77, 0x6A, 0xBC, 0x34, 0xE5, 0xD5, 0x9C, 0x8B, 0x3A,
+	0x8E, 0xA6, 0x6B, 0x3D, 0x10, 0x9B, 0xD6, 0xA5, 0x6A, 0xF3, 0x96, 0x9A, 0x64, 0xA3, 0xA6, 0xAC,
+	0xED, 0x9A, 0x37, 0xF3, 0xFB, 0x58, 0x32, 0x0C, 0xC4, 0xB6, 0x78, 0xE9, 0xDB, 0x44, 0xBE, 0x87,
+	0x9E, 0xB2, 0x8A, 0x8E, 0x13, 0x87, 0xBF, 0x78, 0x40, 0xC7, 0xF5, 0x4E, 0x43, 0x88, 0xB9, 0xBA,
+	0x92, 0x86, 0x6D, 0xF2, 0xD0, 0x77, 0x06, 0x01, 0x6A, 0x51, 0xE5, 0x23, 0xFB, 0x3E, 0xAD, 0x54,
+	0x78, 0xEB, 0x2B, 0xAB, 0x9A, 0x86, 0xB6, 0x1C, 0x9E, 0xC1, 0xAF, 0x9D, 0xB8, 0x7F, 0xDB, 0xD5,
+	0x6A, 0x85, 0x87, 0xAA, 0x92, 0x53, 0x01, 0xE3, 0xA1, 0x3B, 0x58, 0x0A, 0xED, 0x0F, 0x37, 0xB0,
+	0xB6, 0xB7, 0xD2, 0x79, 0x26, 0x02, 0x48, 0x37, 0x7B, 0xF1, 0x8E, 0x27, 0x2C, 0x02, 0x7C, 0x27,
+	0xCE, 0xE0, 0xB2, 0x7D, 0x8E, 0xBF, 0x4D, 0xE5, 0xDE, 0x70, 0xB4, 0x82, 0x37, 0xF9, 0x66, 0x2A,
+	0x27, 0x84, 0x40, 0xEB, 0xDF, 0x6A, 0xF1, 0x76, 0xCF, 0x1C, 0x59, 0x29, 0x41, 0x35, 0xF8, 0xCE,
+	0x0D, 0xE7, 0x1C, 0x43, 0x99, 0xDD, 0xB2, 0x7C, 0x84, 0x7B, 0x16, 0xB0, 0xA2, 0x76, 0x0E, 0x0F,
+	0x67, 0x80, 0x45, 0x21, 0x1D, 0xD2, 0xFB, 0x6D, 0x26, 0x45, 0x4D, 0x10, 0x7F, 0xF5, 0xE8, 0xEE,
+	0xD3, 0x33, 0x5A, 0x55, 0x66, 0x5A, 0x6E, 0xF3, 0xEC, 0xE3, 0x72, 0x15, 0x4E, 0xE4, 0x99, 0xF9,
+	0x9F, 0xA1, 0xFE, 0x64, 0x2B, 0x15, 0x75, 0x7C, 0xE5, 0xC6, 0x5D, 0x07, 0xE4, 0x54, 0x05, 0x9B,
+	0xF4, 0xBB, 0xEE, 0x28, 0x23, 0x25, 0x1D, 0xFF, 0xFA, 0xE5, 0x29, 0x84, 0xBF, 0x6D, 0xE9, 0xC6,
+	0x02, 0x41, 0x80, 0x47, 0x8C, 0x77, 0x12, 0x08, 0xD7, 0xB4, 0xD9, 0x13, 0xAD, 0xA6, 0x9F, 0xCD,
+	0x98, 0xCB, 0x71, 0xF5, 0xAE, 0x3D, 0xE8, 0x87, 0xED, 0xB9, 0x77, 0xA1, 0xE4, 0x83, 0xEB, 0xD1,
+	0x9A, 0xEC, 0x34, 0x42, 0xFD, 0xE4, 0xFB, 0xCD, 0x06, 0x5F, 0xD8, 0x47, 0x63, 0x42, 0x98, 0xF9,
+	0x6D, 0xA6, 0x3A, 0x25, 0x26, 0xA9, 0xB4, 0x7F, 0x94, 0xD9, 0x3D, 0x92, 0x89, 0xB8, 0x05, 0xD4,
+	0xA2, 0xBB, 0xCF, 0x8E, 0x7A, 0x8B, 0x93, 0x13, 0x33, 0xAA, 0x46, 0xEF, 0xD7, 0x6B, 0xF1, 0xF0,
+	0x57, 0xC8, 0x07, 0x11, 0x77, 0x1F, 0x26, 0xEB, 0xB3, 0x12, 0x93, 0x32, 0xAB, 0x86, 0xCE, 0x4F,
+	0xBB, 0x21, 0xFB, 0xCF, 0x22, 0x87, 0xFE, 0x69, 0xA5, 0xAD, 0x20, 0x25, 0x21, 0xB5, 0xA4, 0xF7,
+	0xE4, 0xB2, 0x2B, 0x0C, 0x76, 0xEA, 0x39, 0x96, 0x31, 0xBF, 0xCD, 0x36, 0x64, 0x27, 0x26, 0xE5,
+	0x91, 0x57, 0x3F, 0x8E, 0x23, 0x43, 0x7D, 0xF3, 0x9C, 0xE9, 0xAF, 0x53, 0x95, 0x89, 0xF1, 0xC5,
+	0xC3, 0x0F, 0xCC, 0x12, 0xBB, 0xD7, 0xCD, 0x87, 0xC2, 0x4D, 0x5E, 0xC2, 0x04, 0x7A, 0x44, 0x0E,
+	0xBB, 0x37, 0xB7, 0xE0, 0x26, 0xE7, 0x39, 0xFE, 0x06, 0x84, 0x45, 0x46, 0xB6, 0x81, 0x55, 0xD1,
+	0xD2, 0xDD, 0x54, 0xDF, 0xF4, 0x52, 0xE3, 0xC1, 0x6C, 0x53, 0xE3, 0xC8, 0x7E, 0x5B, 0x18, 0x2A,
+	0xC6, 0xEB, 0x05, 0xFF, 0x8F, 0x27, 0xF9, 0x6E, 0x35, 0x1F, 0xAC, 0x3B, 0x52, 0x21, 0xBD, 0xDF,
+	0xA6, 0x05, 0xF3, 0x07, 0xCC, 0x53, 0x7B, 0x76, 0x3F, 0xEF, 0x32, 0xE6, 0x96, 0x3B, 0x66, 0x87,
+	0x1B, 0x82, 0x55, 0x9E, 0x9B, 0xFF, 0xA7, 0x0D, 0xF6, 0xE4, 0x27, 0xA6, 0x54, 0x4E, 0x7D, 0x5B,
+	0x2A, 0x82, 0xFB, 0x76, 0xE5, 0xA8, 0xDE, 0xBB, 0x6D, 0x72, 0x56, 0x42, 0x7A, 0x03, 0x63, 0xE0,
+	0x00, 0xE6, 0x2F, 0x15, 0xD8, 0x79, 0xDF, 0x13, 0x2A, 0x60, 0x46, 0x8C, 0x77, 0x12, 0xC8, 0x34,
+	0xBA, 0x26, 0xCF, 0x1A, 0x90, 0x0B, 0xEB, 0x3A, 0x1B, 0x6A, 0x68, 0x99, 0x5B, 0xAF, 0x42, 0x8A,
+	0xD3, 0x30, 0xBE, 0x63, 0xF3, 0xDB, 0xFE, 0xE2, 0xDC, 0xD2, 0xD1, 0xE7, 0x15, 0x62, 0x24, 0xD2,
+	0xBC, 0x4A, 0x7A, 0xD7, 0x30, 0x3E, 0x6E, 0x4F, 0x8F, 0x4E, 0xAE, 0x3F, 0xEE, 0x52, 0x36, 0xAF,
+	0xA8, 0x89, 0xC8, 0x3B, 0x66, 0x9E, 0x46, 0xDD, 0xBF, 0x5F, 0x9B, 0x9E, 0x9C, 0xDF, 0xF9, 0xB2,
+	0x4A, 0x0C, 0x57, 0x47, 0xC5, 0xDE, 0xB4, 0xAE, 0x7E, 0x3A, 0x58, 0x98, 0x9C, 0x5A, 0xD8, 0xFD,
+	0xB4, 0x43, 0x49, 0x85, 0xEA, 0x8A, 0x04, 0xAE, 0x64, 0xEC, 0xEC, 0x6A, 0x75, 0x86, 0x3E, 0xBB,
+	0xF1, 0xFE, 0x68, 0x20, 0x13, 0x29, 0xC1, 0x77, 0x41, 0x0D, 0x4B, 0x1F, 0x8E, 0x18, 0x93, 0x53,
+	0xCB, 0x17, 0x97, 0x13, 0xC5, 0x6E, 0xB0, 0x3F, 0x42, 0xD2, 0xAB, 0x7A, 0xF1, 0xCB, 0x06, 0x7D,
+	0x62, 0xE5, 0x71, 0xA3, 0x25, 0x58, 0xE1, 0x97, 0xF8, 0x4B, 0x04, 0x51, 0x3E, 0x20, 0x8D, 0x25,
+	0x3C, 0x2B, 0x43, 0xBE, 0x9D, 0x4D, 0xD7, 0x7E, 0x99, 0xBF, 0x62, 0xF4, 0xE0, 0x51, 0x03, 0x4E,
+	0x3E, 0xA8, 0x89, 0x71, 0xB4, 0x3F, 0x55, 0x93, 0x48, 0x59, 0x3F, 0x3E, 0x58, 0x68, 0x8D, 0x47,
+	0x57, 0xAB, 0x17, 0xF8, 0x3B, 0x54, 0xED, 0x9D, 0xB7, 0x86, 0x1A, 0xAB, 0x69, 0x39, 0xE5, 0xCC,
+	0xFE, 0xCE, 0xF1, 0x1B, 0x73, 0xF3, 0x07, 0x2C, 0xE2, 0x1A, 0x46, 0x57, 0x0F, 0x8E, 0xA8, 0x8C,
+	0xDE, 0x29, 0x52, 0x82, 0x95, 0xE8, 0x33, 0xFC, 0xF7, 0x7B, 0x4E, 0x98, 0x93, 0xD3, 0x9B, 0xDF,
+	0xB6, 0x88, 0x41, 0x48, 0x27, 0x6E, 0x93, 0x37, 0x71, 0x7F, 0xBA, 0x40, 0x9F, 0xDB, 0x9F, 0x99,
+	0x41, 0xFC, 0xBF, 0xFA, 0x19, 0x33, 0x3B, 0x95, 0x02, 0x43, 0x62, 0x78, 0x27, 0x81, 0xD4, 0x70,
+	0x6E, 0xD2, 0x20, 0x3C, 0xCA, 0xEA, 0xF1, 0xC1, 0x7C, 0x73, 0x38, 0x27, 0xBE, 0xCD, 0x38, 0xAA,
+	0x66, 0x68, 0x65, 0xFF, 0x78, 0x6F, 0x69, 0xA0, 0x22, 0x14, 0x35, 0xC2, 0x51, 0xF5, 0x2F, 0xED,
+	0x5F, 0xDA, 0x3B, 0xDE, 0x5F, 0x19, 0xA9, 0x8F, 0x6B, 0x67, 0x32, 0xDB, 0x22, 0x11, 0xB7, 0x8B,
+	0x55, 0x42, 0xE3, 0xF8, 0xFA, 0xE1, 0xD1, 0xEE, 0xD2, 0x60, 0x65, 0x28, 0x7A, 0xDC, 0x69, 0x10,
+	0x56, 0xD1, 0xBF, 0xB8, 0x7B, 0x74, 0xB8, 0xB3, 0x44, 0xAB, 0x8D, 0x43, 0x8A, 0x4A, 0xD6, 0x2D,
+	0x83, 0x34, 0xB1, 0x7A, 0x70, 0xBC, 0xBF, 0x3A, 0xDE, 0x92, 0x62, 0xC7, 0x69, 0x90, 0x34, 0x03,
+	0x4B, 0x7B, 0x17, 0x76, 0x8E, 0x0E, 0x37, 0xA7, 0xDA, 0xB2, 0xDD, 0x39, 0x2F, 0xB0, 0x4A, 0x40,
+	0xF9, 0xF0, 0xFA, 0xE1, 0xD1, 0xC6, 0x78, 0x5D, 0x84, 0x0E, 0xF0, 0x4B, 0xFC, 0x01, 0xA7, 0x9A,
+	0x83, 0xD5, 0x02, 0xAE, 0x80, 0x3E, 0xC5, 0xE8, 0xA1, 0x4F, 0xD4, 0x50, 0x99, 0x57, 0xCC, 0xFF,
+	0xB8, 0xD7, 0x1F, 0x8C, 0xA6, 0x1A, 0x69, 0x05, 0xE6, 0x56, 0x57, 0x66, 0x7A, 0x59, 0x44, 0x17,
+	0xD7, 0x54, 0x12, 0x82, 0xB8, 0x42, 0x2C, 0x5F, 0xE0, 0xAF, 0x93, 0x32, 0xF6, 0x75, 0x95, 0x94,
+	0x93, 0x92, 0x5E, 0x3E, 0x74, 0x73, 0xD0, 0xE8, 0x01, 0x08, 0xE6, 0x0F, 0x68, 0x7B, 0x24, 0x14,
+	0x54, 0x56, 0x97, 0x57, 0x4D, 0x3F, 0xEC, 0x53, 0xB3, 0x5C, 0xDE, 0x3E, 0xC9, 0x9F, 0xC9, 0x2C,
+	0x6B, 0x5F, 0x60, 0xD9, 0xBB, 0x51, 0x9C, 0x12, 0x96, 0x74, 0xCB, 0xEF, 0x5B, 0x39, 0x3C, 0x5C,
+	0xA3, 0x95, 0x4C, 0x31, 0x61, 0xFE, 0x6E, 0x75, 0x87, 0x13, 0xC9, 0x9A, 0x82, 0x4A, 0x83, 0x6F,
+	0x12, 0x08, 0x7A, 0x05, 0xA3, 0x0A, 0x6B, 0xAA, 0x08, 0x01, 0x68, 0x2B, 0x5A, 0xDD, 0x2D, 0x36,
+	0xAF, 0xB2, 0xA6, 0x22, 0x27, 0xDA, 0x99, 0xCB, 0xB3, 0xA6, 0xE0, 0x18, 0x95, 0x53, 0x51, 0x53,
+	0x99, 0x17, 0x87, 0x37, 0x4E, 0x24, 0x10, 0x08, 0x1C, 0xFE, 0x80, 0xAE, 0x67, 0x52, 0x61, 0x55,
+	0x75, 0x79, 0x4E, 0xB4, 0x0B, 0x77, 0x84, 0xB5, 0xB2, 0x53, 0x14, 0xA1, 0xBC, 0xBA, 0xBA, 0x2C,
+	0x27, 0xC6, 0x0D, 0x75, 0x4B, 0xA2, 0xC6, 0x3E, 0x49, 0x05, 0x95, 0x35, 0x95, 0x05, 0x89, 0xDE,
+	0x5C, 0x25, 0xAA, 0xE0, 0x10, 0x91, 0x5D, 0x56, 0x5D, 0x55, 0x9C, 0x1A, 0x60, 0x86, 0x8E, 0x22,
+	0x7C, 0xE7, 0x1A, 0x5F, 0x58, 0x55, 0x5D, 0x9C, 0xE4, 0xA1, 0x81, 0x2A, 0x8F, 0xAE, 0xAE, 0x57,
+	0xF0, 0xD7, 0xCB, 0x98, 0x39, 0x6F, 0xF1, 0x44, 0x3B, 0x80, 0xCD, 0xF2, 0x99, 0x7B, 0x35, 0xCE,
+	0xAF, 0x99, 0xFF, 0xD5, 0x4D, 0x19, 0x39, 0x6E, 0x8B, 0xD4, 0x97, 0x35, 0xB6, 0xB3, 0xD5, 0x17,
+	0x07, 0x54, 0x2C, 0xEC, 0x6D, 0x0D, 0xB9, 0x1B, 0x55, 0x87, 0xDA, 0xE3, 0xBD, 0x72, 0x6B, 0x2E,
+	0x6B, 0xE3, 0xA1, 0xDD, 0x9B, 0x33, 0xF9, 0xE4, 0x56, 0x3E, 0xF7, 0x70, 0xC6, 0x9C, 0x99, 0xDF,
+	0xFA, 0x78, 0x48, 0x4D, 0xD4, 0x7B, 0x8A, 0x3F, 0x20, 0xA4, 0x6A, 0x62, 0x6B, 0x67, 0xE5, 0x59,
+	0x30, 0x74, 0x76, 0x35, 0x5A, 0x68, 0xF6, 0x04, 0x7F, 0x83, 0x14, 0x02, 0x21, 0x25, 0x38, 0x9B,
+	0x65, 0xEF, 0x6A, 0x73, 0x45, 0x6A, 0x46, 0x17, 0x54, 0x55, 0x15, 0xC6, 0x87, 0x12, 0x08, 0xD9,
+	0xEC, 0x13, 0xE4, 0xA2, 0x06, 0x06, 0x5A, 0x7D, 0x44, 0x05, 0x86, 0xA2, 0x7B, 0x11, 0x07, 0x06,
+	0xB2, 0x74, 0xF9, 0x8E, 0x2B, 0x99, 0xD9, 0xDB, 0x1A, 0xCA, 0xF0, 0x74, 0x9D, 0xC6, 0x36, 0xF6,
+	0xD6, 0x86, 0xBC, 0xE1, 0xBF, 0x80, 0xA2, 0xA1, 0xB5, 0xBD, 0x8D, 0xB1, 0x32, 0x00, 0x68, 0xE9,
+	0xE9, 0xE9, 0xA1, 0x03, 0x62, 0x45, 0xD4, 0x4D, 0x6D, 0xED, 0xAC, 0x0C, 0xF9, 0x43, 0xA0, 0x15,
+	0x0C, 0xAC, 0xEC, 0xEC, 0x2C, 0x0D, 0x78, 0xFE, 0x20, 0xA6, 0x66, 0x62, 0x63, 0x6F, 0x63, 0xA2,
+	0xC6, 0x7B, 0x9F, 0x72, 0x7A, 0x96, 0x76, 0xB6, 0xE6, 0x5A, 0xBC, 0x51, 0x2E, 0xAA, 0x66, 0x76,
+	0x76, 0xE6, 0x1A, 0xA8, 0x08, 0x66, 0x65, 0x2F, 0x3F, 0x3F, 0x3F, 0xBD, 0x97, 0xE3, 0xC3, 0x03,
+	0xDA, 0xAF, 0x46, 0x93, 0x50, 0x03, 0x04, 0x71, 0x5F, 0xD2, 0xC5, 0x04, 0x32, 0x72, 0x79, 0x3E,
+	0xFE, 0xC3, 0xB5, 0x8C, 0xB1, 0x45, 0x4A, 0x74, 0xD6, 0x96, 0x93, 0x90, 0x54, 0xD0, 0x73, 0x09,
+	0x35, 0xE6, 0xBD, 0xB8, 0x79, 0xF1, 0xC6, 0x79, 0x93, 0x3B, 0x7A, 0xB2, 0x79, 0xEB, 0xAC, 0xC1,
+	0x15, 0xF5, 0xE4, 0xDE, 0x45, 0xBD, 0x8B, 0xA3, 0xE3, 0x23, 0x1B, 0xF4, 0x96, 0x24, 0xE8, 0xA2,
+	0x42, 0x36, 0xCE, 0x0E, 0xC5, 0x9B, 0x57, 0xCD, 0xEE, 0x7C, 0x77, 0x2A, 0xED, 0x98, 0xD6, 0xC5,
+	0x6C, 0x08, 0xD3, 0x78, 0x82, 0x3F, 0xA0, 0xAD, 0xA7, 0xA7, 0xFD, 0x56, 0x5F, 0x80, 0xBD, 0xAB,
+	0x64, 0x6A, 0x67, 0x6B, 0xAA, 0xAA, 0xA2, 0xA7, 0xA7, 0x2B, 0x05, 0x85, 0x38, 0x85, 0x85, 0x85,
+	0x99, 0x3C, 0x11, 0x0A, 0x1D, 0x1A, 0x16, 0xE6, 0xAB, 0xF8, 0x3F, 0x23, 0xA9, 0x43, 0x58, 0x58,
+	0xF8, 0x15, 0x9F, 0x32, 0xCF, 0x9D, 0xDB, 0xAD, 0xC5, 0x73, 0xDE, 0x32, 0x93, 0xAC, 0xE9, 0xFD,
+	0x46, 0x4F, 0x51, 0x2E, 0xFE, 0xAA, 0x50, 0x89, 0xC8, 0xA9, 0x72, 0xF3, 0x57, 0xF0, 0xAF, 0x65,
+	0x1C, 0xD0, 0xAA, 0xD3, 0xA3, 0x42, 0x42, 0x63, 0x32, 0x6B, 0x88, 0x5E, 0xBC, 0x49, 0x0C, 0x1A,
+	0xC9, 0xE3, 0xDF, 0x68, 0x09, 0x86, 0xF0, 0xC5, 0x34, 0x42, 0x3B, 0x6E, 0x97, 0xF2, 0xD1, 0x41,
+	0x76, 0xB2, 0xF6, 0x91, 0x84, 0xAA, 0xE1, 0x91, 0xA2, 0x14, 0x1F, 0x78, 0x94, 0xA8, 0x9A, 0x54,
+	0x5F, 0xD3, 0x7F, 0xB7, 0x85, 0x8E, 0x12, 0x43, 0x9A, 0x01, 0xB3, 0x98, 0xEA, 0x20, 0x4D, 0xB8,
+	0xFF, 0xA7, 0x52, 0x79, 0xF8, 0xBF, 0x5E, 0x42, 0x9C, 0x99, 0x56, 0x3E, 0x49, 0x49, 0x49, 0xBD,
+	0xF9, 0xB7, 0x4A, 0xFD, 0x91, 0xF6, 0x6F, 0x39, 0x18, 0xE7, 0x44, 0xA4, 0xAA, 0x86, 0xB6, 0x9D,
+	0xD3, 0x38, 0xB1, 0x6E, 0x2C, 0xFE, 0xC9, 0xC9, 0xE1, 0x2C, 0x0B, 0x51, 0x2E, 0x28, 0x39, 0x99,
+	0x3B, 0xFE, 0x53, 0xD5, 0xBF, 0x74, 0x68, 0x67, 0x77, 0x76, 0xA8, 0xAF, 0x7F, 0x64, 0x7E, 0x7F,
+	0x24, 0x8E, 0x37, 0x77, 0x48, 0xC4, 0xB3, 0x6E, 0x63, 0x9F, 0x9C, 0xE2, 0xCD, 0xF2, 0x7C, 0x09,
+	0xBB, 0xC4, 0xD5, 0xAF, 0x1E, 0xB7, 0x87, 0xCA, 0x73, 0x37, 0x7E, 0xB6, 0x55, 0x87, 0x23, 0xD1,
+	0x1A, 0x48, 0x99, 0xAB, 0x26, 0x4F, 0x1F, 0x3F, 0x5E, 0x0C, 0x24, 0x68, 0x08, 0x8C, 0x55, 0xB4,
+	0x57, 0x85, 0x7F, 0xB4, 0x0B, 0x0A, 0x0A, 0xD4, 0xC7, 0x12, 0xB7, 0xFE, 0x01, 0xD2, 0x4B, 0xEC,
+	0xBF, 0xE8, 0x8E, 0x87, 0xDA, 0x43, 0x55, 0xDF, 0x9A, 0xD5, 0xB9, 0x22, 0x47, 0xAE, 0xF8, 0xEF,
+	0xE9, 0xE9, 0x69, 0x24, 0xFE, 0x7F, 0x7A, 0x9A, 0x3B, 0xFE, 0x5B, 0xC1, 0x39, 0xB1, 0xBA, 0x87,
+	0xCE, 0x58, 0x59, 0x9E, 0x1F, 0x69, 0x2F, 0x0A, 0x92, 0xE3, 0xB3, 0xA7, 0x22, 0x88, 0xCC, 0xA3,
+	0x71, 0x76, 0x44, 0x80, 0x6C, 0xE4, 0xC0, 0xF6, 0x56, 0x57, 0x12, 0x6F, 0x27, 0x61, 0x5B, 0x35,
+	0xC6, 0xF6, 0xD0, 0x43, 0x16, 0x77, 0x0A, 0x8D, 0x3E, 0xDA, 0x9E, 0x69, 0xF7, 0xE2, 0x6D, 0xBF,
+	0x79, 0x23, 0x86, 0xB1, 0xFB, 0x87, 0xC8, 0x96, 0x30, 0xB2, 0xDF, 0x01, 0xB9, 0xB0, 0x3D, 0x6A,
+	0x16, 0x96, 0x6A, 0x7C, 0x64, 0xD1, 0xFC, 0x77, 0x76, 0x76, 0x38, 0xF9, 0x1F, 0x3B, 0x3B, 0x3B,
+	0x3B, 0x5C, 0xF9, 0x1F, 0x80, 0xA6, 0x53, 0x70, 0x62, 0x56, 0x6E, 0x4E, 0x7A, 0xAC, 0x9F, 0x95,
+	0xBC, 0x00, 0xFF, 0x52, 0x70, 0x09, 0xA5, 0x3B, 0x88, 0xDD, 0xDA, 0xBA, 0x37, 0xF6, 0x57, 0x45,
+	0x9B, 0xF1, 0x7E, 0xC2, 0x20, 0x2A, 0x36, 0xD6, 0x93, 0xD3, 0xE4, 0x4A, 0xE2, 0x22, 0x13, 0x62,
+	0xFD, 0xCD, 0x44, 0x30, 0x2C, 0xFF, 0x32, 0xBD, 0x71, 0xCE, 0x19, 0xA4, 0x84, 0x48, 0x43, 0xF3,
+	0xA2, 0xB3, 0xD5, 0x81, 0x28, 0x77, 0x80, 0x5E, 0x7A, 0x29, 0x28, 0xF6, 0x68, 0x49, 0x39, 0x96,
+	0xF5, 0x4B, 0x0E, 0x0F, 0x43, 0x49, 0x15, 0x1D, 0x03, 0x7D, 0x2D, 0x45, 0x81, 0x06, 0x35, 0xA0,
+	0x68, 0x17, 0x92, 0x02, 0x55, 0x66, 0xA3, 0x84, 0x08, 0x67, 0x01, 0x61, 0xA8, 0xF2, 0x0A, 0x0A,
+	0x5C, 0x06, 0x9B, 0xAC, 0x92, 0xE2, 0x5F, 0xA8, 0x07, 0x16, 0x17, 0x94, 0xCC, 0x29, 0x21, 0x2D,
+	0xF1, 0xF7, 0x9C, 0xFE, 0xEA, 0xBC, 0x4E, 0x11, 0x69, 0x69, 0xD1, 0xBF, 0x27, 0xB1, 0x56, 0xF0,
+	0xE9, 0x52, 0xF2, 0xB2, 0xDC, 0x05, 0x2C, 0x6E, 0x9F, 0x52, 0xEE, 0x00, 0xCF, 0x81, 0xE7, 0x7B,
+	0xA3, 0xBD, 0x41, 0x42, 0xC6, 0x16, 0xA0, 0xA0, 0x18, 0x24, 0x7D, 0xD6, 0x2F, 0xA6, 0xBF, 0x96,
+	0x95, 0x2A, 0xAD, 0x06, 0x57, 0x66, 0x15, 0xB9, 0xFF, 0x12, 0x84, 0xAF, 0xA7, 0xC5, 0x57, 0x52,
+	0xA6, 0xF8, 0xA0, 0xF0, 0x50, 0x6F, 0x1B, 0xEE, 0x21, 0xBE, 0xA5, 0x17, 0x98, 0xF8, 0x69, 0x81,
+	0x6A, 0xED, 0x54, 0xDC, 0xC0, 0x09, 0x5C, 0xB6, 0x50, 0xEE, 0x6E, 0x49, 0x63, 0x1C, 0x78, 0xBA,
+	0x35, 0xD7, 0xE9, 0x72, 0x16, 0x5E, 0x21, 0xE1, 0x41, 0xEE, 0x06, 0x82, 0x5A, 0x38, 0x63, 0x1C,
+	0x0E, 0xE7, 0x20, 0xCE, 0x09, 0x5C, 0xF7, 0x03, 0x03, 0xD7, 0xAD, 0xF1, 0x78, 0xBC, 0xDE, 0x33,
+	0x39, 0xAE, 0xE0, 0x41, 0x2F, 0x01, 0x13, 0x7C, 0xEF, 0x6C, 0xFD, 0xC2, 0xC3, 0xFD, 0xED, 0x6D,
+	0xF0, 0x78, 0x3C, 0x7A, 0x40, 0xAB, 0xE3, 0x16, 0x1A, 0x13, 0x15, 0x68, 0xCE, 0x93, 0x1D, 0x63,
+	0x07, 0x59, 0xF8, 0x42, 0xE6, 0x96, 0xD2, 0xFF, 0x3D, 0x5B, 0x31, 0x0B, 0x3C, 0x1E, 0xEF, 0x28,
+	0x09, 0xA7, 0x8F, 0x20, 0x56, 0xC6, 0x5B, 0x33, 0x8F, 0xE0, 0xF0, 0x10, 0x0F, 0x73, 0x64, 0xF0,
+	0x6E, 0x85, 0xC3, 0xE1, 0x20, 0x97, 0x84, 0xB8, 0x93, 0x97, 0x97, 0x97, 0xE9, 0xD3, 0x97, 0x54,
+	0xF1, 0xC9, 0x69, 0xA6, 0x0E, 0xF6, 0x91, 0x4B, 0xC2, 0x8D, 0xD1, 0x23, 0xC4, 0xA2, 0x56, 0x30,
+	0xF1, 0xB3, 0x20, 0x84, 0xE3, 0x98, 0xB1, 0xAB, 0x06, 0xE3, 0x37, 0xD8, 0x8A, 0x40, 0xBE, 0x49,
+	0xCD, 0x87, 0xD0, 0xC4, 0x3A, 0x3D, 0x02, 0xF5, 0x1D, 0x3A, 0x81, 0x05, 0xAD, 0x7D, 0x83, 0x3D,
+	0x8D, 0xE9, 0x6E, 0xFC, 0x53, 0xF2, 0x6F, 0x82, 0x88, 0x44, 0x62, 0x06, 0xCC, 0x57, 0x3F, 0xB4,
+	0xA4, 0x63, 0x70, 0xB0, 0xB3, 0x2C, 0x96, 0x44, 0x82, 0xB3, 0x54, 0x4D, 0x8B, 0x04, 0xE4, 0xB8,
+	0xB2, 0x0E, 0xBA, 0xF2, 0x5D, 0xCC, 0x20, 0xB4, 0x14, 0x3C, 0xBD, 0x3C, 0x81, 0x93, 0x4C, 0xC1,
+	0x1A, 0x82, 0x27, 0xD6, 0xF7, 0x8D, 0x0E, 0x77, 0xFA, 0x09, 0xFF, 0x4F, 0x5B, 0xC1, 0x20, 0x92,
+	0x44, 0x22, 0x65, 0x83, 0x48, 0x4C, 0xF2, 0x48, 0x24, 0x52, 0x20, 0x64, 0x1C, 0x6A, 0xF9, 0xE7,
+	0xB5, 0xF4, 0x0E, 0xF6, 0x12, 0xF3, 0xFC, 0xA0, 0x01, 0x85, 0x42, 0x2C, 0x91, 0x48, 0x84, 0xE6,
+	0xF1, 0x34, 0xD2, 0xDA, 0xDA, 0xDA, 0xFC, 0x9F, 0x34, 0x35, 0xE4, 0xFC, 0x6A, 0x66, 0xCF, 0xEF,
+	0xCF, 0xAF, 0x6F, 0x57, 0xDB, 0xE3, 0x10, 0x47, 0x8A, 0x71, 0x62, 0xDB, 0xF2, 0xF5, 0xCD, 0xC5,
+	0xED, 0xD5, 0x52, 0x6B, 0x0C, 0x52, 0xAD, 0x5C, 0x1B, 0x2F, 0xC0, 0x00, 0x2E, 0x50, 0x34, 0x84,
+	0xBF, 0x52, 0x50, 0xDD, 0xCC, 0xD9, 0xFB, 0x8B, 0x9B, 0xDB, 0xD5, 0x0E, 0x8E, 0xD1, 0xAB, 0x19,
+	0xD1, 0xB2, 0x78, 0x7D, 0x7B, 0xF9, 0xE1, 0x78, 0xAC, 0x04, 0x27, 0xC1, 0xCF, 0x9F, 0x7A, 0xC3,
+	0xC8, 0x84, 0xF8, 0x6B, 0x45, 0x91, 0x96, 0xEF, 0x59, 0x81, 0xEB, 0x93, 0xB7, 0x64, 0x84, 0xFF,
+	0xE6, 0x85, 0x00, 0xFE, 0x9B, 0x97, 0x4D, 0x7C, 0xFC, 0x75, 0xA2, 0x5B, 0x57, 0xEE, 0xEF, 0xCF,
+	0xAF, 0xD7, 0x3B, 0x67, 0x6F, 0x5B, 0x3D, 0x38, 0x6F, 0x45, 0x72, 0xEF, 0xFE, 0xD7, 0xAB, 0x0B,
+	0x9E, 0x4C, 0xD8, 0xBF, 0xAE, 0x14, 0x5D, 0x71, 0x38, 0x77, 0x4D, 0xB8, 0xE2, 0xB2, 0x7F, 0x12,
+	0xB3, 0xC7, 0xE1, 0x70, 0x7C, 0xD5, 0xD6, 0xA3, 0xF9, 0xEC, 0xA8, 0xCE, 0x85, 0x65, 0x66, 0x9E,
+	0x1E, 0xC0, 0xFE, 0x4B, 0xB5, 0xB0, 0xA6, 0xF9, 0x8B, 0xCF, 0xEF, 0x3F, 0x5F, 0xCE, 0xD7, 0x07,
+	0xB2, 0x27, 0x46, 0xE4, 0x63, 0x46, 0x6F, 0x26, 0x10, 0xFE, 0x73, 0xEF, 0xBB, 0x9F, 0xE6, 0x6F,
+	0x57, 0xBC, 0xF0, 0x65, 0xA1, 0xA3, 0x81, 0x38, 0x76, 0xB9, 0xDF, 0xE2, 0x07, 0x39, 0x0C, 0xDE,
+	0x85, 0xB7, 0x1F, 0x9E, 0x8E, 0x92, 0x1A, 0x5B, 0xC7, 0xAF, 0x76, 0x9B, 0x7D, 0x25, 0x38, 0x81,
+	0xA9, 0x4B, 0xD3, 0x6C, 0x71, 0xF8, 0xBB, 0x54, 0x30, 0xBF, 0x32, 0x3A, 0x1B, 0x5B, 0x27, 0xAE,
+	0x8F, 0xDA, 0x43, 0xA0, 0xCE, 0x42, 0xC2, 0xA7, 0x61, 0xF3, 0x76, 0x92, 0xDC, 0xD4, 0xB3, 0xF6,
+	0x69, 0x32, 0xC7, 0x52, 0x00, 0xFF, 0xAF, 0x30, 0x7F, 0x24, 0x70, 0x7D, 0x62, 0x9D, 0x13, 0xB8,
+	0xFE, 0x7A, 0xFE, 0x12, 0xBE, 0x4D, 0x3B, 0x1F, 0xE7, 0xDA, 0x1B, 0x88, 0xA3, 0xCB, 0x94, 0x1B,
+	0x0E, 0x7F, 0x61, 0xAF, 0x96, 0xE3, 0xEB, 0x91, 0x96, 0xC6, 0x16, 0xF7, 0xFF, 0x26, 0xFC, 0x2D,
+	0xCB, 0x88, 0xC4, 0x46, 0x37, 0xF6, 0xE2, 0x03, 0x44, 0x62, 0x83, 0x1B, 0x3B, 0x66, 0x99, 0x48,
+	0x24, 0x86, 0xF0, 0xD6, 0x1E, 0x93, 0xDC, 0xC5, 0xCF, 0xBD, 0xE1, 0xB2, 0x60, 0x8C, 0xE9, 0xD7,
+	0xD9, 0x0C, 0xA8, 0xBE, 0xBA, 0xD7, 0xAC, 0x7D, 0x62, 0x50, 0xDB, 0xA8, 0xCB, 0x3F, 0x96, 0xA0,
+	0x89, 0x51, 0xB9, 0xE8, 0x91, 0xBF, 0x8D, 0xC7, 0x29, 0xF2, 0x05, 0x3A, 0x09, 0xA8, 0xFE, 0xE1,
+	0xD4, 0x87, 0xC5, 0xB2, 0x00, 0x67, 0x8F, 0x0C, 0xDA, 0xA7, 0x59, 0x38, 0x31, 0xC0, 0xBA, 0x64,
+	0xE5, 0x96, 0x9A, 0xEA, 0xE9, 0xE2, 0x95, 0x35, 0xF2, 0x7D, 0x3A, 0x1D, 0xEA, 0x75, 0x45, 0x03,
+	0xBA, 0x3F, 0x8D, 0x26, 0x43, 0xF2, 0x12, 0x83, 0x23, 0xEB, 0x07, 0xBF, 0x2C, 0x95, 0x07, 0xBA,
+	0x78, 0x65, 0x0F, 0x7F, 0x59, 0xCA, 0x83, 0xC3, 0xE9, 0x33, 0xA7, 0xBF, 0x8C, 0x10, 0x7C, 0x5C,
+	0xC3, 0xEB, 0x37, 0xAE, 0x3B, 0x43, 0xDE, 0x3E, 0xC3, 0x5F, 0x2F, 0x7D, 0xEA, 0x4F, 0x28, 0x70,
+	0x7D, 0x7A, 0xE5, 0xD7, 0xF9, 0x1B, 0x64, 0x4E, 0xFF, 0x39, 0x53, 0xEC, 0xEF, 0xEC, 0x91, 0x4A,
+	0x59, 0x60, 0x70, 0xF8, 0x2B, 0xC4, 0x0C, 0xFF, 0x9C, 0xCA, 0xC6, 0xB9, 0x78, 0xEA, 0xFE, 0x25,
+	0xE0, 0x82, 0xF6, 0x12, 0x6A, 0xBE, 0xD0, 0x82, 0xE7, 0x77, 0xB0, 0x18, 0xB2, 0x16, 0x6E, 0x7A,
+	0x58, 0x11, 0x25, 0x26, 0xF9, 0x43, 0x33, 0xD4, 0x50, 0xD0, 0x38, 0xB1, 0x2C, 0xD9, 0xBC, 0x26,
+	0x7A, 0xF0, 0x0D, 0x23, 0x22, 0xFA, 0xBF, 0x2C, 0x64, 0x1B, 0x80, 0x39, 0xA7, 0x8F, 0x14, 0x68,
+	0x0A, 0xE7, 0x5D, 0xCC, 0xD0, 0xF7, 0xD9, 0x92, 0x50, 0xAF, 0xB0, 0x9A, 0x8D, 0xF7, 0xDD, 0x81,
+	0xE2, 0x6C, 0xE7, 0xFF, 0xF0, 0x9F, 0x63, 0xB1, 0x0A, 0xAF, 0xE0, 0xCF, 0x4E, 0x5E, 0x55, 0x00,
+	0x84, 0x9D, 0x2A, 0x77, 0x8F, 0xE0, 0x8C, 0x3D, 0xAF, 0xD6, 0x9B, 0x95, 0x02, 0x2B, 0x21, 0x40,
+	0xD4, 0xBD, 0xF1, 0x6C, 0xA7, 0x0C, 0x9A, 0xDF, 0x97, 0x0A, 0x1B, 0xF8, 0xDE, 0x1F, 0xAA, 0xCA,
+	0x16, 0x6C, 0x3E, 0xE9, 0x64, 0x32, 0x3E, 0xF5, 0x84, 0x28, 0x00, 0x62, 0x2E, 0xD5, 0xFB, 0x48,
+	0xB6, 0x90, 0x4B, 0xDD, 0xD1, 0x4E, 0x95, 0x8B, 0x38, 0xA0, 0x11, 0xD9, 0xF3, 0x30, 0x9F, 0x6D,
+	0xF0, 0x0C, 0x7F, 0xA7, 0x9A, 0x03, 0x56, 0xE0, 0xBA, 0xA8, 0x4D, 0xDE, 0xC2, 0x10, 0x0F, 0x7F,
+	0x71, 0x19, 0xC9, 0x97, 0xF8, 0xBB, 0xD4, 0x1D, 0x9D, 0x34, 0x79, 0xBF, 0x05, 0x84, 0xCC, 0x73,
+	0xA7, 0x7A, 0x39, 0xFC, 0xD5, 0x53, 0x66, 0xBE, 0xF4, 0x04, 0xFD, 0x63, 0x97, 0xD2, 0x51, 0x72,
+	0xC3, 0xE1, 0x9C, 0xB8, 0x8D, 0x46, 0x13, 0x1C, 0x0E, 0xE7, 0xAA, 0x88, 0xC6, 0xEC, 0x24, 0xC0,
+	0xE1, 0x2A, 0x17, 0x0D, 0xDA, 0x4B, 0x41, 0xC8, 0x5F, 0x94, 0x62, 0xC0, 0xDF, 0x03, 0x44, 0xB9,
+	0xF3, 0x53, 0x86, 0xA0, 0x60, 0x1E, 0xB7, 0x86, 0xB9, 0x41, 0x76, 0xA6, 0x92, 0x7B, 0xD3, 0xC5,
+	0x4E, 0x99, 0x35, 0x7F, 0x30, 0x75, 0xDD, 0xE1, 0x51, 0x9D, 0x2B, 0xE0, 0x54, 0x7B, 0xB8, 0x5B,
+	0xE5, 0x80, 0x44, 0x32, 0x6F, 0x75, 0xFA, 0xCB, 0x02, 0xAA, 0x71, 0xA3, 0x7F, 0x8E, 0xC5, 0x2A,
+	0x72, 0x47, 0x04, 0xBE, 0xC4, 0xDF, 0xA6, 0x62, 0x8F, 0x1D, 0x7A, 0xAA, 0x93, 0x31, 0xFF, 0xD8,
+	0xE5, 0x2F, 0xCA, 0xAE, 0xE9, 0x94, 0x81, 0x01, 0x56, 0x2E, 0xA5, 0x75, 0xC5, 0x3E, 0x12, 0x38,
+	0xA7, 0x10, 0x33, 0xFA, 0xA1, 0xCB, 0x8F, 0x27, 0xF3, 0x18, 0x99, 0xC5, 0x32, 0xCA, 0x5F, 0xBB,
+	0x86, 0xDA, 0x5B, 0x30, 0x15, 0x83, 0xFD, 0x0C, 0xF6, 0x95, 0xBB, 0x07, 0xD5, 0xF6, 0x4F, 0xF3,
+	0x17, 0xF6, 0xEB, 0x7C, 0x58, 0x62, 0xA5, 0x09, 0xEB, 0x12, 0x7A, 0xBA, 0xB8, 0xF9, 0xBB, 0x06,
+	0x45, 0x84, 0x7A, 0x72, 0x06, 0x61, 0x30, 0x7F, 0x11, 0x5B, 0x3C, 0x1E, 0xEF, 0xA6, 0x88, 0x7C,
+	0x11, 0xFB, 0x74, 0x83, 0xDC, 0xAE, 0x7E, 0x98, 0xFF, 0x3B, 0x37, 0x3C, 0xEB, 0x89, 0xF1, 0x78,
+	0xD3, 0x7F, 0x20, 0x7F, 0xFB, 0x72, 0x22, 0x31, 0x97, 0x6B, 0x3A, 0x45, 0x1C, 0xB4, 0x63, 0x4B,
+	0x61, 0x42, 0x4A, 0xA0, 0xC5, 0x25, 0x28, 0xFF, 0x50, 0x2E, 0x7A, 0xA4, 0xBB, 0x73, 0x36, 0xD3,
+	0x80, 0x13, 0x7E, 0xB9, 0xDA, 0xDF, 0x43, 0xE1, 0xE6, 0x2F, 0xEC, 0xD3, 0x76, 0xB7, 0x92, 0x67,
+	0xCC, 0x8A, 0xEA, 0xDF, 0xEC, 0xDC, 0x06, 0xB1, 0x4B, 0x04, 0xF7, 0x7C, 0x9E, 0xCF, 0xE0, 0x1F,
+	0xF0, 0xE8, 0x67, 0xCE, 0x7E, 0xEE, 0x0B, 0x97, 0x0D, 0xEE, 0xF9, 0x38, 0x95, 0x06, 0xD9, 0x50,
+	0xDA, 0x29, 0xC5, 0xC5, 0xC5, 0xEE, 0xAC, 0xD9, 0xA2, 0xDF, 0xA0, 0xE0, 0xBD, 0xB7, 0x91, 0x43,
+	0x7F, 0xBC, 0x8E, 0xBF, 0x6B, 0xE3, 0x05, 0x3B, 0xF4, 0x5C, 0x31, 0x6E, 0xEC, 0xC7, 0x20, 0xD4,
+	0xAD, 0xDB, 0x85, 0x85, 0x85, 0x79, 0x81, 0x3F, 0x3A, 0xD6, 0x1C, 0xED, 0x55, 0xD8, 0x20, 0x3E,
+	0xEB, 0x1B, 0x92, 0x47, 0x48, 0x44, 0x08, 0xDE, 0x58, 0x82, 0x6B, 0xAE, 0xB3, 0x03, 0xCC, 0xF9,
+	0xB4, 0x2A, 0xD9, 0x3A, 0x85, 0xA6, 0x2A, 0xC0, 0xFB, 0x60, 0x37, 0x3E, 0x7A, 0x84, 0xA5, 0x5B,
+	0x92, 0xC7, 0xD3, 0xFC, 0xA5, 0xC2, 0xFA, 0x7F, 0xA3, 0x27, 0x2A, 0xB3, 0xF8, 0x53, 0xB9, 0xEB,
+	0x7F, 0x4A, 0x7D, 0x0F, 0xAD, 0x8F, 0x48, 0xC0, 0xC9, 0xF0, 0xF0, 0xB7, 0xCD, 0x22, 0x91, 0x48,
+	0xD0, 0x6C, 0x3B, 0x18, 0x1E, 0x4A, 0x4F, 0x50, 0x66, 0xF1, 0x1F, 0xA6, 0xC3, 0xFC, 0x2D, 0xCB,
+	0x48, 0x24, 0x0A, 0xA5, 0x9B, 0x44, 0x22, 0x21, 0x11, 0x3F, 0x6F, 0x9D, 0x51, 0xEB, 0x08, 0x81,
+	0x15, 0xD5, 0x0D, 0x1A, 0xFD, 0x5B, 0xE3, 0x70, 0x38, 0x17, 0x79, 0x54, 0x0D, 0x76, 0x55, 0x10,
+	0x5C, 0x4C, 0x32, 0xC1, 0xDD, 0x7D, 0x5D, 0xDC, 0x33, 0xC8, 0x80, 0x4B, 0xED, 0xC1, 0x4D, 0xBB,
+	0x1F, 0xE4, 0x64, 0x30, 0x2F, 0x5C, 0xB9, 0x19, 0x8C, 0x7E, 0x27, 0x90, 0x3F, 0xBD, 0xE3, 0xB8,
+	0x01, 0x87, 0xCC, 0x44, 0x76, 0x9C, 0x0D, 0x32, 0x78, 0xF8, 0x03, 0xF6, 0x55, 0xFB, 0x47, 0x60,
+	0x88, 0xBC, 0x76, 0xFA, 0xCC, 0xD1, 0xC0, 0x4D, 0xAB, 0x97, 0x10, 0xA0, 0x9A, 0x38, 0xF1, 0x3B,
+	0x2D, 0x92, 0xDF, 0x95, 0x20, 0x1D, 0x4C, 0x79, 0x5C, 0xC8, 0x36, 0x4C, 0x9B, 0x7E, 0xDF, 0x19,
+	0x08, 0x3F, 0x9E, 0x81, 0x99, 0x99, 0x99, 0x22, 0x00, 0x68, 0x24, 0x8C, 0xFD, 0x18, 0x8A, 0x62,
+	0x9D, 0x22, 0x13, 0x41, 0xFB, 0x09, 0xFB, 0x9B, 0x9F, 0xE7, 0x8F, 0x27, 0xDD, 0x2E, 0xE7, 0x18,
+	0x40, 0xA7, 0xC0, 0x5D, 0x06, 0x38, 0x3F, 0xA4, 0xA0, 0xA1, 0xA1, 0x65, 0x15, 0xDF, 0xF7, 0x61,
+	0x0A, 0x4E, 0x20, 0xD0, 0xC9, 0x64, 0x9C, 0xD6, 0xB7, 0xF4, 0xD1, 0x7A, 0x9B, 0xB3, 0x3D, 0x95,
+	0x39, 0x61, 0x14, 0x03, 0x9F, 0xE8, 0x59, 0x0E, 0x7A, 0x66, 0x91, 0x9D, 0x37, 0x8B, 0x79, 0xA6,
+	0x08, 0x7F, 0xB6, 0xF1, 0xA1, 0x91, 0xD6, 0xDD, 0x8D, 0xCA, 0x84, 0xE6, 0xE3, 0xCF, 0x79, 0x4D,
+	0x75, 0x09, 0xD4, 0x09, 0x2E, 0xFE, 0x43, 0x07, 0xD7, 0x37, 0xDF, 0x2E, 0xE8, 0x85, 0xF6, 0xDC,
+	0xFC, 0xAD, 0xD2, 0xFB, 0xAF, 0xD6, 0x1B, 0x43, 0xD4, 0x78, 0xE2, 0xDE, 0x0D, 0x72, 0x87, 0xE7,
+	0x38, 0xFC, 0x77, 0xD7, 0xE7, 0x6E, 0xBB, 0x6F, 0x6F, 0xFB, 0x10, 0xEB, 0xC9, 0x28, 0x9F, 0x48,
+	0x24, 0x42, 0x79, 0x0D, 0xDA, 0x09, 0x44, 0x22, 0xB1, 0x8A, 0x6D, 0x26, 0xBD, 0x8B, 0x23, 0x12,
+	0x89, 0x70, 0x2C, 0x99, 0x46, 0x3C, 0xF8, 0x8B, 0x85, 0xE0, 0x62, 0x32, 0xC8, 0x9A, 0xEB, 0xEA,
+	0x1D, 0x4D, 0x50, 0xE3, 0x09, 0x2A, 0xF8, 0x5F, 0x74, 0x28, 0xC2, 0x42, 0xD8, 0x8B, 0x74, 0xC9,
+	0x9D, 0x57, 0x87, 0xE2, 0xBF, 0xD7, 0x75, 0x8F, 0x2C, 0xC1, 0xA2, 0x9F, 0x31, 0x7D, 0xD2, 0x73,
+	0xC1, 0xCB, 0xDF, 0x80, 0xB0, 0xF8, 0x1E, 0x8C, 0xA3, 0xB7, 0x2D, 0xDF, 0x59, 0x25, 0xDF, 0x0D,
+	0x45, 0x2B, 0x02, 0xC6, 0x79, 0xCB, 0xB7, 0x70, 0xA2, 0x3C, 0x77, 0xB4, 0x41, 0xE5, 0xCE, 0x51,
+	0xBD, 0x6B, 0xC5, 0xCE, 0x76, 0x39, 0xCF, 0xEC, 0x81, 0xA2, 0x4F, 0xED, 0xF6, 0x09, 0xF4, 0x8A,
+	0x82, 0x19, 0x21, 0xC3, 0x50, 0xAA, 0xE1, 0xF3, 0xFC, 0x3D, 0xC9, 0xF7, 0xEC, 0x60, 0x6A, 0x56,
+	0x12, 0x49, 0x3C, 0xF2, 0x02, 0xCB, 0x04, 0xA6, 0xA5, 0x65, 0x14, 0x53, 0xF6, 0xD7, 0xEA, 0xBD,
+	0xC5, 0xE1, 0x42, 0x5C, 0x3D, 0x9B, 0xBF, 0xF8, 0xF0, 0xE9, 0xEB, 0xD9, 0x54, 0x95, 0x2F, 0x32,
+	0xAC, 0x77, 0x2A, 0x63, 0x5C, 0xD1, 0xCA, 0x09, 0x05, 0xED, 0x5B, 0x7B, 0xAD, 0xD0, 0x1A, 0x18,
+	0x60, 0xB3, 0xBC, 0x90, 0x05, 0x36, 0x85, 0x9A, 0x69, 0x63, 0x1D, 0x5D, 0xBC, 0x83, 0x70, 0x14,
+	0x7F, 0xCE, 0x3B, 0xA7, 0x4B, 0xE0, 0x24, 0x2E, 0x98, 0x16, 0x6D, 0xAE, 0xF5, 0xAF, 0xF7, 0xB6,
+	0x90, 0x86, 0x4E, 0x1E, 0xFB, 0xA3, 0x14, 0xD1, 0xFC, 0x2D, 0x52, 0x7A, 0xCF, 0xB7, 0x88, 0xE1,
+	0xD0, 0x44, 0x3E, 0xA7, 0x97, 0x33, 0xC8, 0x1D, 0x9E, 0xE5, 0xF0, 0x27, 0x93, 0xBB, 0xBA, 0xBA,
+	0xC8, 0x64, 0x32, 0xC2, 0xFF, 0x5D, 0x68, 0xFB, 0xF9, 0x79, 0x7B, 0xE8, 0x3B, 0x56, 0xF0, 0x5A,
+	0xE3, 0xDE, 0x4D, 0x7F, 0x3C, 0xBB, 0xE9, 0x14, 0xF5, 0xA8, 0xDF, 0xBB, 0xA1, 0x42, 0x0B, 0x9B,
+	0xB8, 0x55, 0x6F, 0xDF, 0xF4, 0xC5, 0xA8, 0x09, 0x2E, 0x26, 0xF7, 0x86, 0xE3, 0x09, 0xC6, 0x66,
+	0x19, 0x57, 0x98, 0xBF, 0x54, 0x50, 0xD7, 0xFB, 0x2D, 0x28, 0xAB, 0x5C, 0x35, 0x7E, 0xF4, 0x27,
+	0x57, 0x5E, 0x2D, 0x9A, 0xFF, 0x67, 0xCA, 0xC9, 0x7A, 0x29, 0xD4, 0x8A, 0xBA, 0xD5, 0x1F, 0x6E,
+	0x8D, 0x7C, 0xE6, 0xE5, 0xFF, 0x2E, 0x76, 0xE4, 0x8F, 0xE1, 0x18, 0x45, 0x61, 0x9F, 0xB6, 0xDB,
+	0x89, 0x8A, 0x5D, 0x30, 0x97, 0x8B, 0xD5, 0xF2, 0xDA, 0x0A, 0xCA, 0x65, 0x4C, 0xA1, 0x7F, 0xE9,
+	0x0B, 0xEF, 0xB8, 0xA7, 0xF3, 0xC4, 0xF6, 0xC8, 0x7B, 0x95, 0xCF, 0x7F, 0x19, 0x4B, 0x37, 0x84,
+	0x6D, 0xB5, 0xDF, 0x87, 0x22, 0xDF, 0xFE, 0x1D, 0xFC, 0x15, 0xE3, 0xFA, 0xFA, 0xFA, 0x06, 0xE9,
+	0xD3, 0xF5, 0x61, 0x1A, 0x9C, 0x24, 0xAA, 0xEF, 0x6B, 0x03, 0x9D, 0xDD, 0x13, 0x47, 0xBF, 0xCD,
+	0x17, 0xD9, 0x71, 0x26, 0xC7, 0xAB, 0xE8, 0x43, 0x1D, 0x94, 0xAE, 0xBE, 0x79, 0x52, 0x1C, 0xFC,
+	0xF8, 0x2E, 0xF5, 0xC7, 0x87, 0x0D, 0x5E, 0x72, 0x22, 0xEA, 0x7E, 0xF5, 0x73, 0x63, 0xCF, 0xF1,
+	0x17, 0x0F, 0xA6, 0x7E, 0x9D, 0x49, 0xD1, 0x60, 0xF1, 0xA7, 0x0C, 0xA0, 0xF8, 0x53, 0xFA, 0x6B,
+	0x23, 0x71, 0x1E, 0xC9, 0x03, 0x5F, 0x96, 0x72, 0x0C, 0xD0, 0xFC, 0x93, 0x28, 0xA7, 0xBB, 0x64,
+	0x24, 0xEE, 0x89, 0x13, 0xF7, 0x6E, 0x90, 0x4B, 0x1B, 0x85, 0xF9, 0x2B, 0xE3, 0x3C, 0xD3, 0xE6,
+	0x3E, 0x76, 0xFB, 0x7B, 0x7A, 0x72, 0xDC, 0x7F, 0xA6, 0x99, 0x13, 0xBF, 0x2D, 0x97, 0x81, 0xDD,
+	0x93, 0x65, 0xEE, 0xCC, 0x9F, 0x0B, 0x85, 0xF0, 0xED, 0x6B, 0x27, 0x0E, 0x7D, 0x59, 0x2B, 0x63,
+	0xD9, 0x51, 0x5A, 0x89, 0xC3, 0xDF, 0x56, 0x4A, 0xEC, 0x9F, 0xB0, 0xFE, 0x62, 0x68, 0x9F, 0xFB,
+	0xC6, 0xEF, 0xBB, 0x82, 0xB8, 0x0C, 0x3C, 0xDB, 0xF2, 0xAD, 0x7B, 0x68, 0x85, 0x04, 0xAB, 0xE2,
+	0xF5, 0x47, 0x4A, 0x88, 0x8C, 0x60, 0xFE, 0x5F, 0xA9, 0x73, 0xF7, 0x5D, 0xEC, 0xD5, 0x27, 0x94,
+	0x63, 0x68, 0xDF, 0x46, 0xC7, 0xF8, 0xF8, 0x8B, 0xFA, 0x75, 0xBC, 0x67, 0x64, 0xE9, 0x29, 0xC5,
+	0x8D, 0xBC, 0xEF, 0xCC, 0x98, 0x3D, 0xAC, 0x71, 0x12, 0xF6, 0x6D, 0x07, 0x0F, 0x08, 0x9A, 0xC7,
+	0xF0, 0x6B, 0xBF, 0x5D, 0x20, 0x4C, 0xDC, 0x22, 0x3D, 0x0F, 0xF4, 0x32, 0xE2, 0x4B, 0x67, 0xBE,
+	0xCD, 0x97, 0xB9, 0x89, 0x20, 0x4D, 0x30, 0x3C, 0x46, 0xFF, 0xCF, 0xF2, 0xA7, 0x50, 0x28, 0x1D,
+	0xB4, 0x69, 0x62, 0x82, 0x29, 0xB2, 0x60, 0x55, 0x2B, 0xAD, 0x32, 0xD2, 0x37, 0x20, 0xB5, 0xED,
+	0xE0, 0x81, 0x1A, 0x01, 0xF7, 0x4C, 0xDA, 0x11, 0x0D, 0xD3, 0xB4, 0xAE, 0xDE, 0x1E, 0xEA, 0x7C,
+	0x47, 0x9A, 0x35, 0x67, 0x58, 0xF6, 0x73, 0xBA, 0x24, 0xD4, 0x3F, 0xAE, 0x96, 0x41, 0xDB, 0x85,
+	0x73, 0xEC, 0x04, 0xDA, 0xFF, 0x1E, 0xC4, 0xAB, 0x0D, 0x56, 0x86, 0x8A, 0x2E, 0x61, 0x04, 0x6D,
+	0xFF, 0xD1, 0xC9, 0xC1, 0x6A, 0x00, 0xE0, 0xDA, 0x70, 0x86, 0x4C, 0xC3, 0xB2, 0xF8, 0xC7, 0x77,
+	0x1D, 0x1D, 0x74, 0xC4, 0x1A, 0xA0, 0x17, 0xAF, 0x60, 0xC7, 0xBD, 0x1B, 0xE4, 0xF6, 0x75, 0x73,
+	0xEC, 0x7F, 0xFE, 0x27, 0x16, 0xC3, 0x57, 0x6F, 0x7C, 0x1A, 0x4A, 0xD6, 0x03, 0x54, 0x23, 0x29,
+	0x37, 0x47, 0xC4, 0x00, 0xA4, 0xF9, 0x72, 0xA9, 0xDC, 0xFC, 0xD0, 0x17, 0xAD, 0x0A, 0x00, 0x42,
+	0xB8, 0xDA, 0xDD, 0xDB, 0xEE, 0xF0, 0x77, 0x4F, 0x8C, 0xE1, 0x8A, 0x56, 0x0F, 0x6A, 0xC9, 0xD7,
+	0xB3, 0x99, 0x5C, 0x06, 0x9E, 0x7A, 0xE2, 0xD8, 0x1F, 0x53, 0xAC, 0x54, 0x2A, 0x31, 0x5F, 0xF2,
+	0xCD, 0x13, 0xC1, 0x96, 0x72, 0xD1, 0x23, 0xDF, 0xFB, 0xBA, 0xEE, 0x67, 0xB3, 0x58, 0x35, 0xD3,
+	0xBA, 0x78, 0xF5, 0xB4, 0x79, 0x82, 0x8F, 0x3F, 0xE0, 0x58, 0x73, 0xB8, 0x5B, 0x61, 0x63, 0x9C,
+	0xB7, 0xBC, 0x57, 0x15, 0xD6, 0xF7, 0xD8, 0x15, 0x08, 0x8E, 0x08, 0xE0, 0xCC, 0x07, 0xDE, 0x64,
+	0xA6, 0x92, 0xF5, 0xE3, 0xFA, 0x8D, 0x8D, 0x52, 0xEE, 0xB1, 0x81, 0x5D, 0xDE, 0xE4, 0x17, 0x46,
+	0xB5, 0xAF, 0x02, 0x52, 0x33, 0xBE, 0xFF, 0x7D, 0xFC, 0xE5, 0xC2, 0x0B, 0x0B, 0x8B, 0x6B, 0xFB,
+	0xF6, 0x0E, 0x3A, 0x23, 0xA1, 0x9E, 0x4B, 0xD6, 0xC6, 0x2B, 0xCA, 0x43, 0x59, 0x58, 0xCC, 0x28,
+	0x71, 0xE8, 0x1B, 0x03, 0x4E, 0xD6, 0x92, 0x09, 0x68, 0xDE, 0xDC, 0xEF, 0x29, 0xCD, 0x29, 0x24,
+	0x31, 0xCF, 0x7A, 0xE1, 0x80, 0x0A, 0x09, 0x9F, 0xC6, 0xCD, 0xCF, 0x8B, 0xBD, 0xDD, 0xC3, 0x5B,
+	0x33, 0xD3, 0x37, 0x44, 0xFC, 0x33, 0xFC, 0x2D, 0x8B, 0x57, 0xD9, 0x81, 0xEB, 0x7E, 0x75, 0xCC,
+	0x49, 0x0E, 0xFF, 0x59, 0x76, 0x8E, 0xAB, 0x5D, 0xF5, 0xD1, 0x01, 0x9C, 0x50, 0xC8, 0xE2, 0xDF,
+	0xB6, 0xB7, 0xD9, 0x9D, 0x60, 0xCC, 0x55, 0x14, 0x77, 0xDD, 0x51, 0x06, 0xF2, 0xEA, 0x9E, 0x15,
+	0x2B, 0xC3, 0xCF, 0xF1, 0x07, 0x13, 0x5C, 0x6F, 0x0E, 0x5B, 0xFC, 0x64, 0xDC, 0xAB, 0xC0, 0xF7,
+	0x80, 0x43, 0x51, 0x2D, 0xA6, 0xEF, 0x71, 0xA3, 0xC2, 0x09, 0x5C, 0x20, 0x6A, 0xF4, 0xB7, 0x85,
+	0x7C, 0xAB, 0x27, 0xE6, 0x0E, 0xFD, 0xDA, 0xAE, 0x67, 0x33, 0x8A, 0x56, 0x0F, 0xEB, 0xB9, 0x92,
+	0x88, 0x45, 0xBC, 0x49, 0x97, 0x3B, 0x95, 0x60, 0x93, 0xA1, 0x91, 0x34, 0xFE, 0x37, 0x7A, 0x8A,
+	0xD6, 0x13, 0xFC, 0x7F, 0x1F, 0x28, 0x5D, 0x3F, 0x66, 0x2D, 0xC2, 0x25, 0x19, 0xD0, 0x71, 0x3B,
+	0x4F, 0x98, 0xE4, 0xE7, 0x6F, 0x94, 0xCB, 0xBC, 0x21, 0x79, 0xBA, 0x36, 0x9C, 0xCC, 0x65, 0xBA,
+	0x37, 0x9D, 0xD1, 0x93, 0x74, 0x33, 0x17, 0xEE, 0xDB, 0x7D, 0x04, 0xBA, 0xAF, 0x55, 0xE3, 0x47,
+	0x1E, 0xBB, 0xCF, 0xC6, 0x12, 0xB9, 0x7A, 0xAA, 0x77, 0x51, 0xBD, 0xF7, 0xCB, 0x55, 0xFE, 0xB0,
+	0x5D, 0x06, 0xE6, 0x68, 0x0D, 0x86, 0x4B, 0xBF, 0x8E, 0x3F, 0x3B, 0xF5, 0x18, 0xE4, 0x0F, 0xBB,
+	0x8C, 0x58, 0x3E, 0x5C, 0x13, 0x13, 0x33, 0xE7, 0xB8, 0x8E, 0xCB, 0xF5, 0x32, 0x4E, 0x90, 0x92,
+	0x1C, 0xAB, 0xC9, 0x71, 0x6F, 0xBA, 0xD8, 0x85, 0x9D, 0x02, 0xA6, 0xB9, 0xF3, 0xF7, 0x3D, 0xF1,
+	0x36, 0xFA, 0x66, 0x81, 0xF5, 0x3B, 0x9C, 0xE0, 0x56, 0xAD, 0xC8, 0xE6, 0x85, 0xF3, 0x87, 0xFB,
+	0xFD, 0x91, 0x52, 0xE6, 0x49, 0x9D, 0xE3, 0x33, 0xFC, 0x95, 0xE0, 0xC0, 0xF5, 0x7A, 0xC6, 0xE0,
+	0x3E, 0x87, 0xFF, 0xE8, 0x84, 0x60, 0xFE, 0x9B, 0x83, 0x1D, 0xC9, 0xE8, 0x69, 0x59, 0x95, 0x98,
+	0xBE, 0xF7, 0x5B, 0xAD, 0xE9, 0x31, 0x49, 0xD5, 0xD3, 0xA3, 0x9B, 0xCF, 0xF2, 0x07, 0xAC, 0x72,
+	0x67, 0xFE, 0x98, 0xCF, 0xB7, 0x49, 0x1F, 0xFB, 0xCE, 0xEE, 0x07, 0x10, 0xCB, 0xBB, 0x64, 0xF9,
+	0xD3, 0x40, 0xAC, 0x9A, 0x88, 0x47, 0xC3, 0xFE, 0x39, 0x39, 0xF0, 0x89, 0xF5, 0xA3, 0xB4, 0x53,
+	0xE9, 0x0F, 0xDD, 0xC1, 0xB1, 0x43, 0x5F, 0x79, 0x2C, 0x7C, 0xF3, 0x82, 0xE5, 0x07, 0xD6, 0xBC,
+	0xBF, 0x6D, 0xD9, 0xE6, 0x4D, 0x9B, 0xDF, 0x9B, 0x27, 0xF8, 0xFF, 0xA4, 0xC5, 0x0D, 0x7D, 0x1F,
+	0x8E, 0x53, 0x65, 0xC5, 0x64, 0xBF, 0xEF, 0x4E, 0x9E, 0xE6, 0xE7, 0xAF, 0x1C, 0x3F, 0xF6, 0x7D,
+	0x20, 0x3C, 0x84, 0xFA, 0xB9, 0x2F, 0xDC, 0xAC, 0x60, 0x75, 0xBD, 0xC8, 0xBA, 0x6C, 0x87, 0x7F,
+	0xE4, 0x0C, 0x4D, 0x5E, 0x79, 0x12, 0xF7, 0x47, 0xD6, 0x5A, 0x7D, 0xB8, 0x9E, 0xCF, 0x30, 0x97,
+	0xF9, 0xD8, 0x1D, 0x82, 0x98, 0xE5, 0xE2, 0xC1, 0xBD, 0xDF, 0x06, 0xC2, 0xA4, 0x5E, 0xC1, 0xDF,
+	0xBD, 0xE5, 0x9A, 0xBD, 0xF4, 0x08, 0x68, 0x4C, 0x0D, 0xB3, 0x47, 0x0F, 0x80, 0xA6, 0x99, 0x99,
+	0x19, 0xCB, 0xBA, 0x30, 0x43, 0x59, 0xA1, 0x7A, 0x26, 0x26, 0x26, 0xB2, 0xEC, 0x8C, 0x98, 0x03,
+	0x24, 0x9B, 0xD2, 0xAD, 0xF1, 0x6C, 0x93, 0xD5, 0x80, 0x6B, 0x26, 0x8C, 0xFD, 0x4E, 0x8B, 0x82,
+	0x7B, 0x05, 0x9D, 0x80, 0xBC, 0xA6, 0xF6, 0xB6, 0x9A, 0x94, 0xF2, 0x9D, 0x75, 0x38, 0x6B, 0x58,
+	0xC5, 0xC5, 0xD5, 0x95, 0x15, 0x14, 0x8C, 0xE6, 0x0F, 0x06, 0xAE, 0xBF, 0x67, 0x05, 0xAE, 0xCF,
+	0x4E, 0xA3, 0xFC, 0xBF, 0x33, 0x63, 0x82, 0xF8, 0x8F, 0xF5, 0xAD, 0xF6, 0xAD, 0xD7, 0x7A, 0xA1,
+	0x9D, 0x30, 0x76, 0x05, 0x93, 0x0F, 0xC7, 0xB3, 0xA3, 0x93, 0x5B, 0x0B, 0x13, 0x77, 0xCF, 0xF3,
+	0x97, 0xF4, 0x6E, 0xD8, 0xBD, 0xA7, 0xC6, 0x90, 0x4F, 0xCF, 0xDA, 0x42, 0xD0, 0x0C, 0x15, 0xC3,
+	0xBA, 0x6E, 0xB6, 0xAA, 0x5C, 0xF4, 0x52, 0xC7, 0x7F, 0x4C, 0x65, 0x99, 0x3C, 0x15, 0x3E, 0x5E,
+	0xB5, 0xBB, 0x5D, 0x61, 0x8F, 0x6F, 0x3A, 0x5D, 0x2E, 0xE4, 0x1A, 0x1F, 0xBC, 0x8B, 0x1E, 0xFC,
+	0x06, 0xFA, 0x47, 0xC5, 0x03, 0x3A, 0xEE, 0xF8, 0x93, 0xEA, 0x11, 0xFE, 0x7F, 0x0E, 0x47, 0x35,
+	0x1C, 0x6D, 0x94, 0xDA, 0x82, 0xB1, 0xE4, 0x87, 0x1B, 0x65, 0xA9, 0xB3, 0xFC, 0xFC, 0xDF, 0x04,
+	0x74, 0x3D, 0xCE, 0xA4, 0xA5, 0xCD, 0x9C, 0x36, 0xBA, 0xAB, 0x24, 0x8C, 0x5D, 0x34, 0xE3, 0x5B,
+	0xAE, 0x96, 0x08, 0x06, 0x82, 0xEF, 0xC6, 0x2C, 0x7F, 0x6E, 0x65, 0x92, 0xE7, 0xDB, 0xAC, 0xCA,
+	0x77, 0x4F, 0x51, 0x6B, 0xF1, 0xBD, 0x09, 0xA2, 0x7E, 0xE8, 0x67, 0xE7, 0x56, 0xBE, 0xC0, 0xDF,
+	0xA1, 0xF6, 0x98, 0xED, 0xE1, 0x53, 0x49, 0x9A, 0xFC, 0xDA, 0xCB, 0xB6, 0x98, 0x65, 0x42, 0x8B,
+	0x8B, 0x8B, 0x59, 0xB1, 0xF1, 0x1A, 0x69, 0x73, 0xF0, 0xBD, 0xAA, 0x27, 0x14, 0x16, 0x16, 0x3A,
+	0xB3, 0x63, 0x99, 0x0E, 0xD9, 0xEB, 0xB9, 0xB0, 0x57, 0xAE, 0x61, 0x87, 0xCD, 0xB0, 0xB3, 0x42,
+	0x91, 0x49, 0xF5, 0xB7, 0xA6, 0x6E, 0xDE, 0x5E, 0x8E, 0x81, 0xED, 0xB7, 0x13, 0x49, 0x50, 0x30,
+	0x84, 0x43, 0x75, 0x53, 0x53, 0x95, 0x3D, 0x2F, 0x7F, 0x49, 0x77, 0x76, 0xE0, 0xFA, 0x50, 0x29,
+	0x93, 0xDF, 0xFF, 0xCF, 0xC3, 0x9F, 0xDE, 0x37, 0x30, 0xF5, 0xDB, 0x4C, 0x01, 0xBA, 0x56, 0x48,
+	0xE3, 0x0B, 0xFA, 0x57, 0x0F, 0x0F, 0xD7, 0x87, 0xCB, 0x57, 0x5E, 0xE0, 0x0F, 0x68, 0xC7, 0xF7,
+	0x3F, 0x6C, 0xD7, 0x2E, 0x7D, 0xE7, 0x5E, 0xE4, 0x08, 0x00, 0x2C, 0xF3, 0xE6, 0xBF, 0xD0, 0xE2,
+	0xBD, 0x9A, 0x0E, 0x0F, 0x9B, 0xBC, 0x9F, 0x70, 0x19, 0xCA, 0x85, 0x51, 0x3F, 0x4E, 0x24, 0x6B,
+	0x1A, 0xE7, 0x30, 0xAE, 0xC8, 0xBE, 0x62, 0x3C, 0xC3, 0x02, 0x30, 0xFF, 0x55, 0x2B, 0x75, 0xF2,
+	0xB7, 0xA1, 0x58, 0xE5, 0xA7, 0xF8, 0xFF, 0x6D, 0x34, 0x26, 0x73, 0xE6, 0xBE, 0x2B, 0x58, 0x1A,
+	0xB4, 0xFE, 0x86, 0xE3, 0xD3, 0xE7, 0xF9, 0xF9, 0x03, 0xCE, 0x75, 0xC7, 0x1B, 0xC5, 0xE5, 0xDB,
+	0xCB, 0xF9, 0xA6, 0x62, 0x7E, 0x1D, 0xEF, 0xFB, 0xC3, 0x7B, 0xBF, 0x8E, 0xC6, 0x3E, 0x61, 0x8C,
+	0x28, 0x46, 0x51, 0xC6, 0x07, 0x79, 0xF2, 0x3A, 0x6D, 0xAB, 0xBA, 0xBA, 0xAA, 0x38, 0xC3, 0x05,
+	0xB1, 0xC0, 0xCE, 0xCE, 0x4E, 0x68, 0xF8, 0xF3, 0x3C, 0x7F, 0xD3, 0xC2, 0xB5, 0xCB, 0x16, 0x0F,
+	0x21, 0x00, 0x30, 0xCD, 0x5F, 0xBE, 0x26, 0x79, 0xC2, 0x2B, 0x56, 0x6D, 0x8D, 0xC5, 0x29, 0xB1,
+	0x1C, 0xD3, 0x8C, 0x47, 0x68, 0x00, 0xAF, 0x96, 0x3C, 0xBD, 0xD1, 0xE9, 0x2F, 0x0E, 0x00, 0xC2,
+	0x9E, 0xC4, 0xAB, 0x0D, 0xB8, 0x56, 0x7B, 0x92, 0xEF, 0x96, 0x73, 0x8D, 0xA0, 0xB4, 0xF5, 0x89,
+	0x04, 0xEE, 0x18, 0x00, 0xE7, 0xC2, 0xF9, 0x8B, 0x56, 0xB8, 0xC0, 0xEC, 0xAA, 0x0E, 0xCF, 0x59,
+	0x13, 0xB8, 0x8A, 0xD1, 0x43, 0x3F, 0xE1, 0xA4, 0x5E, 0x00, 0x30, 0x80, 0x02, 0xD7, 0x51, 0x11,
+	0xD8, 0x4F, 0xF1, 0x1F, 0xED, 0xCB, 0xAA, 0x5E, 0x7D, 0x3F, 0x98, 0x82, 0xF6, 0x9D, 0x4B, 0xDB,
+	0xC7, 0x14, 0x54, 0x55, 0x17, 0x25, 0xE4, 0xBE, 0xC8, 0x1F, 0xB0, 0x2B, 0x5C, 0xF8, 0xB1, 0xF8,
+	0x61, 0x83, 0x7B, 0x91, 0x23, 0xD0, 0x82, 0x69, 0x3D, 0xDB, 0xAE, 0x49, 0xA7, 0xFF, 0x36, 0x96,
+	0xF2, 0x54, 0x1C, 0xB9, 0x71, 0x0E, 0xE3, 0x9A, 0xEC, 0x2B, 0x26, 0x17, 0xDE, 0xFB, 0x79, 0x82,
+	0xBB, 0x93, 0x37, 0xC8, 0x9E, 0xFF, 0xD0, 0x13, 0x22, 0x63, 0x5F, 0xB9, 0x23, 0x30, 0xD3, 0x92,
+	0x33, 0x15, 0x13, 0xD8, 0x71, 0x3B, 0x97, 0x6D, 0x68, 0x5D, 0xBC, 0x76, 0xDC, 0x88, 0xCB, 0x64,
+	0x08, 0xE0, 0x6F, 0x92, 0xBF, 0x72, 0xDE, 0x48, 0xBE, 0x05, 0xA3, 0x4B, 0xED, 0xAB, 0xF6, 0xE6,
+	0x32, 0xA6, 0x1E, 0x3A, 0xFD, 0x9E, 0x88, 0x8A, 0x51, 0x4F, 0x1C, 0xD9, 0xE0, 0x71, 0x45, 0x01,
+	0x1A, 0xDE, 0x7E, 0x7E, 0xDE, 0xA8, 0x68, 0x52, 0x0B, 0x5F, 0x5F, 0x5F, 0x2B, 0xE0, 0x15, 0xFC,
+	0xD5, 0x12, 0xC7, 0x7E, 0x8C, 0xA6, 0x98, 0x2A, 0x68, 0x04, 0x90, 0xCE, 0x61, 0x9B, 0x52, 0xD4,
+	0xAF, 0xE3, 0x7E, 0xA5, 0xC4, 0x55, 0x4D, 0x5E, 0xC3, 0xAB, 0x6E, 0x1F, 0x9E, 0x14, 0x90, 0x09,
+	0xEB, 0xFD, 0x34, 0x95, 0x6D, 0xA3, 0xA4, 0x68, 0x91, 0x36, 0xF6, 0x83, 0x9E, 0xA2, 0x01, 0xDB,
+	0xAD, 0x07, 0x27, 0x4D, 0xFE, 0xDA, 0xF2, 0x2A, 0x8E, 0x05, 0x8B, 0x9F, 0xD8, 0x13, 0x17, 0xEC,
+	0xDA, 0x66, 0x64, 0xEA, 0x10, 0x5C, 0x34, 0xFA, 0x30, 0x95, 0x6D, 0xCA, 0x79, 0xC0, 0xCF, 0xFD,
+	0xB1, 0x26, 0xCA, 0x1A, 0x6E, 0x25, 0xCB, 0x5F, 0x90, 0x95, 0x1A, 0x75, 0xA3, 0x2B, 0x3C, 0x4D,
+	0xED, 0xEC, 0xCC, 0xDC, 0x6B, 0x0F, 0x91, 0x15, 0x10, 0x9E, 0xE2, 0x3F, 0xD8, 0xE4, 0x1A, 0x4A,
+	0x3E, 0x3A, 0x6E, 0x0B, 0x57, 0xE5, 0xEA, 0x39, 0xC1, 0xD3, 0x0D, 0x5E, 0xC1, 0x5F, 0x36, 0x80,
+	0x78, 0xF4, 0xBF, 0xAF, 0xBB, 0x23, 0x55, 0x79, 0xE9, 0x66, 0x4D, 0x7D, 0x1B, 0x6E, 0x39, 0xD9,
+	0xA9, 0xC5, 0x3D, 0x15, 0x2D, 0xE0, 0xD1, 0x7C, 0xB6, 0x56, 0x64, 0x69, 0x69, 0xE9, 0x5C, 0x73,
+	0xB0, 0x53, 0xE9, 0xC8, 0x9D, 0x4A, 0x47, 0x79, 0x9C, 0xCD, 0xD4, 0x0B, 0xEA, 0x7E, 0x60, 0xE4,
+	0x18, 0x3F, 0xCD, 0x9F, 0x9E, 0x60, 0x5D, 0xBC, 0x7A, 0xD2, 0x88, 0x0F, 0xEC, 0xB8, 0x9B, 0xCD,
+	0x32, 0xC8, 0x5E, 0x12, 0xC0, 0x5F, 0x35, 0x71, 0xE2, 0x43, 0xD7, 0xF0, 0x2D, 0xD9, 0x47, 0x04,
+	0xD0, 0xCB, 0x9C, 0xDF, 0x2D, 0x5F, 0x3E, 0xE2, 0x5D, 0xB0, 0x84, 0xF3, 0x22, 0x97, 0x6D, 0x2E,
+	0xE7, 0xF3, 0x44, 0xA7, 0x09, 0x59, 0x07, 0x85, 0x3A, 0xA1, 0x86, 0x9F, 0xEA, 0x9E, 0x61, 0xBE,
+	0xFA, 0xAF, 0xE1, 0x2F, 0xE2, 0xD5, 0x74, 0x78, 0xDC, 0x99, 0x15, 0x93, 0x54, 0xBB, 0xF8, 0x71,
+	0x10, 0x5E, 0x99, 0xD5, 0xA6, 0x78, 0xE9, 0xE3, 0x78, 0x79, 0x52, 0x4C, 0x4A, 0xD5, 0xCC, 0xF7,
+	0x89, 0x74, 0xE8, 0x3A, 0x4E, 0x95, 0x6B, 0x57, 0xFD, 0x05, 0xF1, 0xB1, 0x39, 0x94, 0xD3, 0x63,
+	0xA2, 0x2F, 0x64, 0xEB, 0xE8, 0xA6, 0x8D, 0x7F, 0x65, 0xD4, 0xA7, 0xC5, 0x24, 0x14, 0x0F, 0xBD,
+	0x5F, 0xAF, 0x44, 0x56, 0x15, 0x50, 0x8D, 0xCB, 0x2F, 0xAA, 0xE9, 0x5A, 0x7C, 0x5C, 0xAA, 0xF2,
+	0x94, 0x40, 0x86, 0xD0, 0xFD, 0x0F, 0xBB, 0xED, 0x39, 0x89, 0x29, 0x15, 0xE3, 0x1F, 0x37, 0xAA,
+	0xA1, 0xE9, 0x3D, 0xE5, 0x30, 0xE2, 0x4C, 0x65, 0x84, 0xBB, 0x8B, 0x7F, 0xDE, 0xF8, 0xF7, 0x19,
+	0x78, 0x70, 0xF5, 0x14, 0xFF, 0xD5, 0x26, 0x57, 0xC3, 0xA4, 0x81, 0xFB, 0xB5, 0x1A, 0x2F, 0xBE,
+	0x69, 0x96, 0xD7, 0xF0, 0x07, 0x5C, 0xCA, 0x57, 0xFE, 0xF7, 0x5E, 0x83, 0x37, 0xEF, 0xC9, 0xE2,
+	0xDE, 0x4D, 0x87, 0xBB, 0x53, 0x9F, 0x06, 0xE3, 0x35, 0x9F, 0x28, 0x22, 0xD5, 0xF8, 0x11, 0xFA,
+	0x30, 0x6B, 0x4D, 0xF8, 0x32, 0x3A, 0xBD, 0x27, 0x4C, 0x96, 0xC7, 0x1B, 0x77, 0x50, 0xEB, 0x9C,
+	0x3E, 0xF3, 0x89, 0x1A, 0x26, 0xFB, 0x1C, 0x7F, 0xE5, 0x98, 0xC1, 0x6F, 0xC3, 0xF1, 0x99, 0x33,
+	0x77, 0x9D, 0x41, 0xBA, 0x02, 0xF9, 0x4B, 0x04, 0x51, 0x3E, 0x0E, 0x2E, 0x6C, 0x83, 0xC6, 0xB6,
+	0x6C, 0x44, 0xFF, 0x35, 0x69, 0x77, 0x39, 0x4F, 0xD0, 0x62, 0x76, 0xC2, 0x36, 0x2E, 0xEE, 0x89,
+	0xBD, 0x0F, 0x7C, 0x9E, 0x66, 0xA3, 0x74, 0x4A, 0x5F, 0x11, 0xA7, 0x67, 0x94, 0xF0, 0xAB, 0x1F,
+	0x20, 0x45, 0x28, 0xBD, 0x82, 0x3F, 0xA0, 0x97, 0xD4, 0x77, 0x7E, 0x36, 0x37, 0x3A, 0xB9, 0xFD,
+	0x71, 0x16, 0x59, 0xB1, 0x46, 0x21, 0xA8, 0x69, 0xF5, 0xF3, 0xC6, 0xE4, 0xE8, 0xD4, 0xF6, 0xE3,
+	0x7C, 0x05, 0xBC, 0xC4, 0x9F, 0x4A, 0x38, 0x79, 0xFB, 0x8E, 0x39, 0x3E, 0xC6, 0xB8, 0x3A, 0xED,
+	0x4F, 0x46, 0x96, 0x02, 0x74, 0x2F, 0x9F, 0x7D, 0xD8, 0x9B, 0x19, 0xA5, 0xAF, 0x3E, 0x6E, 0xB6,
+	0x72, 0x2A, 0xA6, 0x66, 0xFA, 0xFC, 0xE6, 0xE1, 0xC3, 0xF1, 0x44, 0x65, 0x00, 0xA7, 0x53, 0xB4,
+	0x2F, 0x98, 0xBC, 0x3B, 0x5F, 0x9A, 0x9C, 0xDE, 0xFC, 0xB2, 0xD3, 0x16, 0x89, 0x2C, 0x01, 0x4C,
+	0xBB, 0x5E, 0xED, 0x6B, 0x6E, 0xE8, 0x98, 0xB9, 0xDF, 0x6A, 0xF2, 0x95, 0x7C, 0x9E, 0x3F, 0xE8,
+	0xFF, 0xB5, 0xCB, 0x9B, 0xFE, 0x7D, 0x3A, 0xDF, 0xFE, 0x3F, 0xC3, 0xDF, 0x30, 0x75, 0xE4, 0xF3,
+	0xCD, 0x9F, 0x33, 0xB9, 0x7C, 0x63, 0x3C, 0xBD, 0x94, 0xD1, 0xEF, 0x7F, 0xAC, 0x95, 0x3B, 0x3D,
+	0x55, 0x42, 0x36, 0xA5, 0x3D, 0xBB, 0xBD, 0xE0, 0x92, 0xF0, 0xBB, 0xBB, 0x5D, 0xBB, 0x1D, 0x04,
+	0x63, 0x1E, 0x6F, 0xDC, 0xA7, 0xDE, 0xB0, 0xEA, 0x7D, 0x9E, 0x15, 0x35, 0xF8, 0xF8, 0x2B, 0xB9,
+	0xD5, 0x1D, 0x6E, 0x94, 0xD5, 0x1F, 0xAD, 0x95, 0x58, 0x0B, 0xE6, 0x0F, 0xB8, 0x36, 0x9C, 0x4E,
+	0xEC, 0x4C, 0x83, 0xEB, 0x2A, 0x00, 0xB8, 0xE6, 0xF3, 0xFE, 0xB3, 0xF1, 0x04, 0x41, 0xF6, 0x84,
+	0x5A, 0x72, 0x63, 0xF3, 0xC0, 0xE1, 0x46, 0x15, 0xEF, 0xF4, 0xB8, 0x73, 0xC3, 0xE9, 0x63, 0xB7,
+	0x3F, 0x72, 0x51, 0x95, 0xC4, 0xC9, 0xDF, 0xE1, 0xF5, 0x1A, 0x5F, 0xE0, 0x0F, 0xD8, 0xA4, 0x77,
+	0xCC, 0xEF, 0x1E, 0x1D, 0xAC, 0x0C, 0x96, 0x78, 0x23, 0xD3, 0x0D, 0xDA, 0xA1, 0x95, 0xB4, 0x65,
+	0x30, 0xF1, 0xB3, 0xAF, 0xD8, 0x07, 0x79, 0xD3, 0x0C, 0xA2, 0xEB, 0xC1, 0xE4, 0xCE, 0xED, 0x19,
+	0x72, 0x2A, 0x67, 0x48, 0xA8, 0xE8, 0x5D, 0x48, 0x65, 0xEC, 0x1E, 0x1D, 0xAC, 0x8E, 0xD4, 0x46,
+	0x1A, 0xA0, 0x53, 0xE0, 0x17, 0xA7, 0x07, 0x1A, 0xD3, 0x71, 0x28, 0x83, 0x40, 0x1A, 0x97, 0x47,
+	0x99, 0xDF, 0x39, 0x3A, 0x5C, 0x1F, 0x6F, 0x88, 0x41, 0x5E, 0x6D, 0xFB, 0xEC, 0x9E, 0xD5, 0x9B,
+	0xAB, 0xF3, 0xF7, 0x97, 0x8C, 0x96, 0x28, 0x6D, 0xE0, 0x65, 0xFE, 0x52, 0x9E, 0xD5, 0xAB, 0xF7,
+	0x03, 0xC9, 0x46, 0xBF, 0xCE, 0x5F, 0x2E, 0x90, 0x74, 0x7C, 0xD9, 0x79, 0x70, 0xD3, 0x13, 0xCD,
+	0x1B, 0x9D, 0x2B, 0xE4, 0x5E, 0xB3, 0xFD, 0xD0, 0x13, 0xF9, 0xD4, 0x96, 0x30, 0x92, 0x81, 0x9D,
+	0x3D, 0x73, 0x90, 0x26, 0xE6, 0x3A, 0x9A, 0x3C, 0x78, 0x3C, 0x03, 0x37, 0xF3, 0xD9, 0xE0, 0x64,
+	0x9C, 0xCE, 0xF3, 0xFC, 0xF5, 0xD2, 0xA7, 0xDF, 0x77, 0xD3, 0xBE, 0xD1, 0x62, 0x95, 0x9F, 0xE0,
+	0x6F, 0x56, 0xB8, 0x46, 0x61, 0xF6, 0xB0, 0xD6, 0x35, 0x30, 0x2F, 0x5C, 0xEB, 0xD8, 0xE8, 0x0E,
+	0x10, 0x34, 0x9C, 0x54, 0x4D, 0x9E, 0xBE, 0xFC, 0xB2, 0xDB, 0x1E, 0xC9, 0xEB, 0xA6, 0xB6, 0x2D,
+	0x67, 0x6E, 0xB4, 0x78, 0xA2, 0x26, 0x94, 0xFB, 0x77, 0x26, 0xA0, 0xC0, 0x8D, 0x97, 0xF8, 0x0B,
+	0x99, 0x06, 0x67, 0x95, 0x55, 0x57, 0xE6, 0xC7, 0x3A, 0xA1, 0x66, 0x9B, 0x94, 0x5D, 0x62, 0xF2,
+	0x2A, 0x6A, 0x2A, 0x72, 0x22, 0xED, 0x51, 0x07, 0xB5, 0x3C, 0x92, 0x8A, 0xAA, 0xAA, 0x4B, 0x33,
+	0x02, 0xD0, 0x55, 0xE0, 0xAD, 0x5D, 0x78, 0x76, 0x79, 0x75, 0x65, 0x41, 0x3C, 0x0E, 0x65, 0x7E,
+	0xA8, 0xC6, 0xE4, 0x64, 0xA7, 0x44, 0xE0, 0x0C, 0xB8, 0x9E, 0x52, 0xD2, 0x3A, 0x34, 0xAB, 0xAC,
+	0xBA, 0xAA, 0x28, 0xC9, 0x93, 0x63, 0x43, 0x89, 0x5A, 0x45, 0x16, 0xB7, 0xF6, 0xD1, 0x7A, 0x89,
+	0xF9, 0x81, 0xBA, 0x9C, 0xA9, 0x5E, 0x26, 0x13, 0xE2, 0xCF, 0x64, 0x72, 0xF8, 0x33, 0x99, 0xE0,
+	0xFC, 0x9F, 0x6A, 0x18, 0x99, 0xC9, 0x24, 0x87, 0xC9, 0xF3, 0xF2, 0xEF, 0xEA, 0xE2, 0xE2, 0xCF,
+	0xE4, 0x7B, 0x62, 0x87, 0xE2, 0xC5, 0x1F, 0x93, 0xD9, 0xB4, 0x8F, 0x9B, 0x35, 0x78, 0xDE, 0x94,
+	0x0A, 0x93, 0xC2, 0x8D, 0xFB, 0xA7, 0x63, 0xC5, 0xF4, 0xD2, 0xA7, 0xD7, 0xFB, 0xD2, 0x20, 0x8D,
+	0xAF, 0xB3, 0xC6, 0xF1, 0x5C, 0xAB, 0xE9, 0x1C, 0xD5, 0xCF, 0xDD, 0x75, 0x04, 0x48, 0x3C, 0xCF,
+	0x5F, 0xC2, 0xBF, 0xFD, 0x66, 0x7E, 0xED, 0xB0, 0xDE, 0x1D, 0x78, 0x82, 0xBF, 0x5A, 0xF2, 0x64,
+	0xFF, 0x34, 0xDB, 0xD6, 0x52, 0x4D, 0x9C, 0x18, 0x98, 0xAE, 0x17, 0x98, 0xF7, 0xA5, 0x9A, 0x4C,
+	0xA3, 0x0F, 0x37, 0xC6, 0xF2, 0xD9, 0x1A, 0xCA, 0x41, 0x05, 0xC5, 0xD1, 0x28, 0xFB, 0xD5, 0x36,
+	0xB5, 0x34, 0xCB, 0x4D, 0xEC, 0xE9, 0xD2, 0xE0, 0x8E, 0x2A, 0xD4, 0xB3, 0xB2, 0x63, 0x25, 0x73,
+	0x72, 0xB9, 0xBC, 0x8D, 0xC0, 0xC4, 0x4F, 0x6E, 0x0F, 0xA4, 0x88, 0xBA, 0x99, 0xAD, 0x9D, 0xA5,
+	0x0E, 0x4F, 0x0F, 0x2A, 0xA7, 0x6F, 0x65, 0x67, 0x63, 0xC2, 0x6D, 0x56, 0x69, 0xE8, 0xEB, 0xAA,
+	0xF1, 0x3B, 0x53, 0x64, 0xC1, 0xAC, 0x4E, 0x33, 0x75, 0xAE, 0x7B, 0x51, 0xB2, 0xF2, 0x0A, 0x89,
+	0x08, 0xF1, 0x30, 0x47, 0x65, 0x63, 0x24, 0x13, 0x08, 0x59, 0xB6, 0xAC, 0x55, 0xFA, 0x09, 0x84,
+	0x74, 0x33, 0xD4, 0x41, 0xD0, 0xE9, 0x60, 0x94, 0x44, 0x20, 0x10, 0x78, 0xF9, 0xCB, 0x7B, 0xF8,
+	0xF9, 0xF9, 0x21, 0x8D, 0x82, 0x72, 0x14, 0x81, 0x40, 0xE0, 0x31, 0xC7, 0x75, 0x13, 0x07, 0x1E,
+	0xB7, 0xEB, 0x3C, 0x4B, 0x99, 0xBF, 0xD3, 0xB3, 0xCC, 0x7E, 0x89, 0xBF, 0x4B, 0xED, 0xC1, 0x61,
+	0x9D, 0x8B, 0x06, 0x4B, 0x3E, 0xAD, 0x57, 0x3C, 0x2B, 0x2A, 0x29, 0xC7, 0x0E, 0x7F, 0xE9, 0x3F,
+	0xDC, 0x28, 0xB5, 0x01, 0x9E, 0xE7, 0x0F, 0x58, 0x16, 0xAD, 0xFC, 0xFE, 0xE7, 0x74, 0x86, 0xDE,
+	0x53, 0xFC, 0x25, 0x43, 0xA8, 0xD3, 0x43, 0x39, 0x86, 0x6C, 0x67, 0x40, 0xE7, 0x44, 0x7F, 0x81,
+	0x40, 0x67, 0x04, 0x98, 0x38, 0x12, 0xED, 0x29, 0xA0, 0xAD, 0x51, 0x30, 0x31, 0xE3, 0x22, 0xA0,
+	0x63, 0x61, 0x20, 0xFE, 0x74, 0x69, 0xFC, 0xB5, 0xC4, 0xBB, 0x9A, 0xBD, 0x96, 0x9E, 0x9E, 0xEE,
+	0x1B, 0xD6, 0xEE, 0x40, 0x7A, 0x7A, 0x3A, 0xC2, 0xA8, 0x83, 0xE2, 0xD0, 0x0F, 0x7A, 0x2A, 0xCF,
+	0xA7, 0x81, 0xAA, 0xE9, 0xE9, 0xE9, 0x71, 0x9B, 0x63, 0xD2, 0xBE, 0x4D, 0xFB, 0xF7, 0xBD, 0xB1,
+	0x9A, 0x21, 0x6D, 0x67, 0x17, 0x1D, 0x61, 0xCA, 0xBF, 0xC0, 0x5F, 0x21, 0xB2, 0xFF, 0x0B, 0xE2,
+	0xF7, 0xB7, 0x28, 0x5C, 0xE5, 0x5D, 0x51, 0x0D, 0xDF, 0x74, 0xDA, 0xB3, 0x32, 0x12, 0xAF, 0xFA,
+	0x12, 0xFF, 0x77, 0xD1, 0x03, 0x5F, 0x6E, 0xDA, 0x03, 0x24, 0x9E, 0xE2, 0x0F, 0xB8, 0x66, 0x13,
+	0x08, 0xD0, 0xB2, 0xF2, 0xF6, 0xD9, 0x04, 0x42, 0xCC, 0x13, 0x57, 0x94, 0x55, 0x92, 0x17, 0xFA,
+	0xB5, 0xE2, 0x55, 0xE7, 0x2B, 0x8D, 0x7F, 0x3F, 0xD9, 0xE4, 0xCF, 0xFD, 0x6D, 0xBE, 0xC0, 0x16,
+	0x5C, 0xE9, 0xEE, 0xFB, 0x6A, 0x85, 0xAB, 0xD0, 0xEB, 0xF9, 0x9B, 0xE5, 0x33, 0x1F, 0x90, 0xC5,
+	0x12, 0x94, 0x62, 0x87, 0x7E, 0xE3, 0x59, 0x51, 0xD1, 0x38, 0x87, 0x31, 0x31, 0xC1, 0x3B, 0x1C,
+	0xE7, 0xE6, 0xCF, 0x64, 0x45, 0xE5, 0xB8, 0xD4, 0x32, 0x99, 0x45, 0x56, 0xAC, 0x85, 0xA7, 0x98,
+	0x82, 0xF8, 0x4B, 0xEB, 0xEA, 0xE9, 0x41, 0xCC, 0x25, 0x74, 0xF5, 0xF4, 0xD4, 0xB1, 0x94, 0xAD,
+	0x7F, 0x9C, 0x34, 0x62, 0xA8, 0x77, 0x87, 0x2D, 0xFE, 0x6F, 0x01, 0x11, 0xF7, 0xAA, 0x8D, 0x2F,
+	0xA3, 0x69, 0x46, 0xAF, 0xE6, 0x2F, 0xE2, 0x4D, 0x62, 0x32, 0x2B, 0xEC, 0x39, 0xB5, 0x9D, 0xC9,
+	0xE4, 0x5E, 0x51, 0x55, 0x2E, 0xBC, 0x97, 0x49, 0xC9, 0x7B, 0x3A, 0xD4, 0x4C, 0x3A, 0x88, 0x40,
+	0x20, 0x84, 0xCA, 0x01, 0x80, 0x4E, 0x22, 0x81, 0x10, 0xF9, 0x0E, 0x00, 0xD4, 0xE3, 0x08, 0x04,
+	0x82, 0x07, 0xC6, 0xE4, 0x5F, 0x99, 0xDE, 0xE6, 0x59, 0xB7, 0x0D, 0x4D, 0xFB, 0xA9, 0x46, 0x76,
+	0xDF, 0x9C, 0xB4, 0x06, 0xC9, 0xBF, 0x9A, 0xBF, 0x17, 0x81, 0x40, 0xE0, 0xB8, 0x06, 0x8C, 0x53,
+	0x09, 0x84, 0x6C, 0xEE, 0xC1, 0x97, 0x13, 0xA7, 0xDD, 0x16, 0x1C, 0x3B, 0x00, 0xF7, 0x57, 0x5A,
+	0xBA, 0xBA, 0x2C, 0xB3, 0x5D, 0x43, 0x4F, 0x4F, 0x4F, 0x0E, 0x83, 0xF2, 0x2F, 0x94, 0x19, 0x61,
+	0x92, 0xC9, 0x84, 0xA6, 0xFD, 0x2C, 0x73, 0xA6, 0x99, 0x4B, 0x25, 0x0E, 0xDC, 0xFC, 0x99, 0xCC,
+	0x27, 0xDB, 0x7F, 0x79, 0x3D, 0x3D, 0x3D, 0x94, 0x67, 0x48, 0x5B, 0x4F, 0x4F, 0x97, 0x3B, 0x0C,
+	0x58, 0x8A, 0xD3, 0x6E, 0x63, 0xFA, 0x8B, 0xF2, 0x4F, 0x27, 0x10, 0x08, 0x21, 0x8A, 0xD0, 0x44,
+	0x20, 0x81, 0x40, 0xC8, 0xE6, 0xE2, 0xAF, 0x9F, 0xCC, 0x57, 0xA9, 0xFF, 0x8A, 0x92, 0x78, 0x6A,
+	0xC7, 0xD5, 0x5F, 0x95, 0x3E, 0xB8, 0xC1, 0xA6, 0x8C, 0x33, 0x0E, 0x67, 0x23, 0x84, 0x0A, 0x7D,
+	0x85, 0x47, 0x30, 0x5A, 0xA8, 0xB0, 0x76, 0xD4, 0x71, 0x43, 0x30, 0x6D, 0xC1, 0x50, 0xC0, 0xE7,
+	0x35, 0xDD, 0x39, 0x9F, 0x57, 0x77, 0xE7, 0xA4, 0x88, 0xB2, 0x64, 0x26, 0x20, 0xF7, 0x93, 0x13,
+	0x25, 0x6F, 0xC9, 0xFE, 0x90, 0x9B, 0x83, 0xB1, 0x22, 0x5F, 0xC6, 0x04, 0x28, 0x57, 0x5B, 0x3D,
+	0x29, 0xFE, 0xC3, 0x6E, 0x0E, 0x26, 0xE8, 0x79, 0x26, 0x33, 0xEE, 0x6F, 0x84, 0xD7, 0x91, 0x37,
+	0xC2, 0xE1, 0x70, 0x8E, 0xD0, 0xD9, 0xC2, 0x3A, 0xA8, 0x31, 0x03, 0x58, 0xA1, 0x75, 0xF9, 0x07,
+	0x1C, 0x7F, 0xBD, 0x84, 0x50, 0x21, 0xEE, 0x7C, 0x5C, 0xCF, 0xE0, 0xF0, 0x10, 0x6F, 0x1B, 0xCE,
+	0xD0, 0x45, 0xDC, 0x81, 0xEB, 0xB9, 0xE1, 0xC8, 0x65, 0x54, 0x29, 0x3D, 0x31, 0x7F, 0x28, 0xE4,
+	0x03, 0x6E, 0xB0, 0x69, 0x94, 0x47, 0x24, 0x26, 0x2A, 0xA3, 0x72, 0x14, 0xE0, 0xC9, 0x3B, 0xB7,
+	0x46, 0x22, 0x11, 0x0A, 0xB0, 0x46, 0x1D, 0xD7, 0x8D, 0x02, 0xD3, 0x16, 0xA0, 0x58, 0x3E, 0xD6,
+	0xF1, 0x14, 0xE8, 0x65, 0x70, 0x69, 0x20, 0x12, 0xE1, 0x28, 0x2D, 0xE7, 0x3A, 0x4E, 0x8A, 0x28,
+	0x4B, 0x61, 0xDC, 0xBE, 0x02, 0x95, 0x08, 0x74, 0x94, 0x3C, 0x3B, 0x35, 0x82, 0x48, 0x6C, 0xAE,
+	0xC9, 0x8B, 0x72, 0x7C, 0xC7, 0x93, 0x31, 0x01, 0xAA, 0xA9, 0x22, 0x33, 0xD0, 0x98, 0xEF, 0x70,
+	0x73, 0x6D, 0x7E, 0x8C, 0x13, 0xD2, 0xE1, 0x4A, 0x85, 0x71, 0x7F, 0x23, 0x34, 0x07, 0x2D, 0xE2,
+	0x4F, 0x24, 0x12, 0x09, 0x7A, 0x7F, 0xF5, 0xC4, 0x2F, 0x2E, 0x84, 0xE8, 0x71, 0x85, 0x98, 0xA6,
+	0x83, 0xAF, 0x2D, 0x3A, 0x1F, 0xB7, 0x90, 0xD4, 0x3B, 0xD8, 0xD7, 0x56, 0x1A, 0x85, 0x04, 0x35,
+	0x6A, 0x67, 0x70, 0x3D, 0x77, 0x89, 0x05, 0x4F, 0x29, 0xD5, 0xE4, 0x47, 0xDB, 0xCB, 0x08, 0x74,
+	0xF7, 0x44, 0x0C, 0x1E, 0x54, 0xD9, 0xD9, 0x57, 0x1D, 0x0C, 0xC0, 0x2B, 0x7D, 0xCA, 0x45, 0x8F,
+	0xDC, 0xD0, 0x11, 0xFE, 0x9C, 0x6D, 0x5C, 0x38, 0xC7, 0x35, 0xC2, 0x5A, 0xB6, 0x6F, 0x06, 0xD3,
+	0x2D, 0x39, 0x9F, 0x3F, 0x26, 0x41, 0x46, 0x14, 0x7A, 0x9F, 0x18, 0xE7, 0x86, 0x73, 0x30, 0x3D,
+	0x74, 0x76, 0xE3, 0x86, 0xC2, 0xCA, 0x13, 0x1D, 0xE0, 0xE6, 0x2F, 0xE2, 0x5E, 0xD5, 0x3D, 0xB5,
+	0x8C, 0xE2, 0x3F, 0xD2, 0x47, 0xDF, 0xBD, 0xB9, 0xB9, 0x3A, 0x62, 0xF6, 0x97, 0x85, 0xE8, 0xA2,
+	0x46, 0x4C, 0x50, 0x9A, 0xE9, 0xC5, 0xDE, 0x2C, 0x39, 0xD5, 0x96, 0xF7, 0xF0, 0xD5, 0xF1, 0xCA,
+	0x40, 0xA9, 0x9F, 0x12, 0xC2, 0x7F, 0x00, 0xCE, 0x4A, 0xBD, 0xB9, 0xA1, 0x8E, 0x4E, 0x21, 0xFC,
+	0xBB, 0x6F, 0x98, 0x7F, 0x31, 0xFE, 0x62, 0xD2, 0x02, 0x73, 0x83, 0x60, 0xB5, 0x70, 0x06, 0x05,
+	0xEF, 0x2C, 0x7C, 0x93, 0x2B, 0x3B, 0x91, 0xBD, 0x62, 0x00, 0x93, 0xC4, 0x36, 0xE6, 0xF5, 0xED,
+	0xC5, 0xED, 0xDD, 0x5A, 0x37, 0xBC, 0x7A, 0x26, 0xB8, 0x94, 0x32, 0xE7, 0xC1, 0x6F, 0x76, 0x90,
+	0x2A, 0x0B, 0x97, 0xD2, 0xD1, 0x72, 0x7F, 0x21, 0x5E, 0xD0, 0x0A, 0x50, 0x1A, 0x29, 0xD3, 0xCB,
+	0x79, 0x46, 0x9E, 0xAD, 0xB7, 0x64, 0x6F, 0x1E, 0x1F, 0x85, 0x00, 0xFE, 0xEC, 0xE3, 0xCA, 0x81,
+	0xF5, 0x6B, 0x8F, 0xA3, 0x04, 0x3B, 0xD4, 0xE7, 0xFF, 0xEF, 0x45, 0x68, 0xB3, 0x38, 0x6E, 0xFE,
+	0x34, 0x48, 0x14, 0xD6, 0xBF, 0x3C, 0xFC, 0x4D, 0x32, 0xC6, 0xBB, 0xFB, 0xB8, 0xF9, 0x83, 0x9F,
+	0x1A, 0x9E, 0xD9, 0xFB, 0xB8, 0xDC, 0x12, 0xA9, 0x8D, 0xBA, 0xFA, 0x0C, 0xEB, 0xF4, 0xB1, 0xE5,
+	0xFB, 0xD3, 0x81, 0x34, 0x13, 0x9E, 0xC3, 0xC3, 0x73, 0xC7, 0x9F, 0x18, 0x95, 0xF0, 0x1A, 0xB9,
+	0x52, 0x61, 0x03, 0xF0, 0x77, 0x82, 0x1A, 0xE5, 0xF0, 0xFF, 0xF4, 0x4F, 0xE0, 0xAF, 0xA1, 0xA9,
+	0xA9, 0xC1, 0xED, 0x76, 0x42, 0x47, 0xF1, 0x0A, 0xAC, 0xD6, 0xEE, 0xB0, 0x71, 0x68, 0xEC, 0x1F,
+	0xEE, 0xA1, 0xCA, 0xEB, 0x1B, 0x38, 0xA5, 0xED, 0xC2, 0x08, 0x61, 0x13, 0x54, 0xDA, 0xC0, 0x3D,
+	0xBA, 0xB0, 0x75, 0x62, 0x67, 0x18, 0xE1, 0xAF, 0x14, 0xD1, 0x71, 0x78, 0x36, 0xD6, 0x0A, 0x66,
+	0xD9, 0x9E, 0x76, 0x45, 0xBC, 0x83, 0xF9, 0xF7, 0x72, 0x74, 0x3F, 0xC3, 0x8E, 0x2F, 0xE5, 0x94,
+	0xD2, 0xC8, 0xDC, 0xC9, 0xC3, 0x54, 0xBE, 0xB5, 0x80, 0x67, 0x30, 0x29, 0x58, 0x9D, 0x4C, 0x52,
+	0x0B, 0xED, 0x43, 0xB6, 0xBF, 0x79, 0x91, 0xBF, 0xBC, 0x4F, 0xF5, 0xD2, 0x97, 0xC9, 0x02, 0xE7,
+	0x37, 0xA8, 0xCF, 0xFF, 0xBF, 0x1F, 0x68, 0xEC, 0xC5, 0xEC, 0xD1, 0xFC, 0x8D, 0xC3, 0x23, 0x40,
+	0x15, 0x6E, 0x9C, 0x92, 0x58, 0x3F, 0x44, 0x70, 0x39, 0xB1, 0xDF, 0x85, 0xB6, 0x9F, 0x75, 0x6F,
+	0x72, 0xF1, 0x3F, 0xA5, 0x27, 0x44, 0x44, 0x44, 0xA5, 0xD5, 0x8C, 0xDF, 0x6E, 0x36, 0xC1, 0x51,
+	0xB9, 0xEC, 0x6F, 0x05, 0xCF, 0x8E, 0x2B, 0xEC, 0xBF, 0x3C, 0x6B, 0x0B, 0x94, 0xE2, 0x3E, 0x1C,
+	0x9D, 0x49, 0x5C, 0xFB, 0xCE, 0x59, 0x76, 0xDC, 0x99, 0xFD, 0x4D, 0x11, 0x11, 0x11, 0xA9, 0x43,
+	0xA7, 0xCB, 0xE5, 0xAE, 0x22, 0xFF, 0x08, 0xFE, 0x68, 0x03, 0x07, 0x1D, 0x2D, 0x93, 0x92, 0x9E,
+	0x9E, 0x6C, 0x82, 0x9A, 0xBD, 0xF0, 0xF3, 0x83, 0xD7, 0x6A, 0x05, 0xF4, 0x3D, 0x03, 0x9C, 0x15,
+	0x05, 0x54, 0x6B, 0x38, 0x8C, 0x4F, 0x35, 0xA6, 0x6D, 0xB0, 0xD6, 0x5B, 0x8C, 0x8F, 0x3F, 0x22,
+	0x88, 0xFF, 0x1B, 0xEF, 0xAC, 0xFA, 0xC1, 0x95, 0xAB, 0x2F, 0x7F, 0x72, 0xF8, 0xDB, 0x96, 0xAE,
+	0xDE, 0x50, 0xD3, 0xBC, 0x58, 0x59, 0xB6, 0x2B, 0x45, 0x50, 0x08, 0x9A, 0xAC, 0x67, 0x30, 0xAC,
+	0xB4, 0xC9, 0xEB, 0x36, 0xC8, 0x2B, 0x89, 0x2A, 0x25, 0xF2, 0xC1, 0x5D, 0x77, 0x30, 0x8F, 0xC9,
+	0x28, 0xA4, 0xAA, 0xAA, 0xEA, 0x50, 0x73, 0xD4, 0x1F, 0xA6, 0x9A, 0x48, 0x5F, 0x2B, 0x30, 0x51,
+	0x15, 0x7D, 0x0D, 0x7F, 0x19, 0x7C, 0xD9, 0xDC, 0xEF, 0x73, 0xA5, 0x78, 0x69, 0xB4, 0x4F, 0x73,
+	0xF3, 0xE2, 0xB0, 0x85, 0x45, 0x8C, 0x6B, 0x9F, 0x30, 0x69, 0x19, 0x19, 0x19, 0x19, 0x93, 0xC2,
+	0x8D, 0x5B, 0x12, 0x1E, 0xFC, 0x49, 0x86, 0x67, 0x02, 0x7E, 0x79, 0xB3, 0xF5, 0x8E, 0x8B, 0x3F,
+	0xEB, 0xF2, 0x72, 0xDA, 0xEE, 0x39, 0xA3, 0x9F, 0x17, 0x0A, 0xAC, 0xB8, 0x0F, 0xCB, 0xC8, 0xBC,
+	0xB3, 0xCD, 0xA4, 0xFF, 0x6D, 0x16, 0xCA, 0x82, 0x43, 0x0E, 0xCB, 0x19, 0x84, 0xB6, 0xDF, 0xEC,
+	0x55, 0x21, 0x3E, 0x19, 0xD6, 0x17, 0xC9, 0xC8, 0x28, 0x85, 0x90, 0x4F, 0x8E, 0x5B, 0xE1, 0xE0,
+	0xBE, 0x57, 0xF3, 0x7F, 0x23, 0x23, 0x25, 0x2C, 0x38, 0x69, 0x33, 0x81, 0x7F, 0x37, 0x21, 0xDB,
+	0xAA, 0xF9, 0xF9, 0x4A, 0xCE, 0x7B, 0x61, 0x99, 0xDD, 0xD1, 0x91, 0x05, 0x3D, 0xBA, 0x7A, 0x74,
+	0x0B, 0xA5, 0xDC, 0x43, 0x14, 0xBA, 0xD3, 0xE3, 0x61, 0xB8, 0x5A, 0x23, 0xF9, 0x93, 0x26, 0x05,
+	0xEB, 0xBF, 0x8F, 0xC7, 0xBF, 0xE3, 0xE1, 0xFF, 0x1B, 0xFB, 0x4D, 0x67, 0xC9, 0x12, 0xCE, 0x6A,
+	0x39, 0x7A, 0xD8, 0xA1, 0x8F, 0x72, 0xF8, 0x83, 0xF1, 0x38, 0xCC, 0x7C, 0x2B, 0x61, 0x56, 0x96,
+	0xED, 0x05, 0x92, 0x05, 0x2B, 0x2C, 0x0E, 0x09, 0xDF, 0x70, 0xB8, 0x94, 0x6F, 0xC1, 0x53, 0x78,
+	0xF2, 0x86, 0x49, 0xE3, 0xFF, 0x6B, 0x32, 0x89, 0x67, 0x64, 0x6A, 0x93, 0x94, 0x9C, 0x9C, 0x4C,
+	0xDE, 0x22, 0x27, 0x27, 0xE7, 0x32, 0xA7, 0x53, 0x93, 0x93, 0x1D, 0x5E, 0xC3, 0xDF, 0xA5, 0x70,
+	0xEA, 0xCB, 0x52, 0xB5, 0x8F, 0x3C, 0xB7, 0x4F, 0x7B, 0xE2, 0xB7, 0x05, 0x56, 0xC4, 0x01, 0x17,
+	0x7F, 0xD8, 0x9F, 0xC2, 0xBD, 0xB4, 0x29, 0x3C, 0x01, 0x3F, 0x7C, 0xDB, 0x23, 0x80, 0x3F, 0x68,
+	0xCB, 0xBA, 0x94, 0xAF, 0xDF, 0x76, 0x06, 0x4A, 0xF2, 0xDE, 0x8D, 0x98, 0x4F, 0xDB, 0xDD, 0x36,
+	0xA7, 0x67, 0x83, 0x0F, 0x5B, 0x95, 0x6E, 0xF3, 0x7D, 0x81, 0x88, 0x5B, 0xC5, 0xF2, 0x87, 0xA1,
+	0x14, 0x24, 0x30, 0x81, 0x8F, 0xBF, 0xA2, 0xB1, 0xB1, 0x31, 0xEF, 0xC4, 0x89, 0xA8, 0xBE, 0x5B,
+	0x50, 0x44, 0x98, 0x8F, 0xAD, 0x32, 0xBF, 0xD3, 0x96, 0x63, 0x10, 0x71, 0xF1, 0x3F, 0x3C, 0x40,
+	0xF1, 0xF7, 0x69, 0xBF, 0xBE, 0x6E, 0xF3, 0x81, 0xD3, 0x8E, 0xB6, 0x3E, 0x41, 0x73, 0xF6, 0x20,
+	0x7F, 0x4E, 0xB5, 0x86, 0xF9, 0xEB, 0x65, 0x4D, 0x6E, 0xF5, 0x44, 0xC8, 0x0A, 0x98, 0x1B, 0x80,
+	0x5E, 0x60, 0x19, 0x24, 0xAB, 0x69, 0xB6, 0xBB, 0x22, 0x79, 0x84, 0xC3, 0xFF, 0x6D, 0x24, 0xED,
+	0x64, 0x8C, 0xB5, 0x75, 0x3D, 0xF7, 0x3C, 0x37, 0x3C, 0x7A, 0x49, 0x1A, 0x7D, 0xE8, 0x81, 0x67,
+	0xC4, 0x38, 0xA5, 0x04, 0x46, 0x64, 0x2E, 0x64, 0x68, 0xF1, 0x86, 0xFB, 0x4E, 0x4F, 0x4F, 0xF7,
+	0x4F, 0x8F, 0x4C, 0x4F, 0x8F, 0x4D, 0x0F, 0x4E, 0x4F, 0x43, 0x4D, 0xCE, 0xF3, 0xFC, 0x1D, 0x72,
+	0xC6, 0x1E, 0xD7, 0x1B, 0x02, 0x95, 0x79, 0xEE, 0xBB, 0x7A, 0xE3, 0x61, 0x20, 0x41, 0xF7, 0xF5,
+	0xFC, 0xE5, 0x83, 0x48, 0xC7, 0x33, 0xB9, 0x82, 0xF9, 0x03, 0xCA, 0x31, 0x43, 0xBF, 0x4F, 0x43,
+	0x9B, 0x68, 0xA1, 0xEF, 0xC6, 0xA5, 0xF1, 0x02, 0x2E, 0x70, 0xD4, 0x61, 0xE3, 0x82, 0xF5, 0xF7,
+	0x6D, 0x3C, 0xC9, 0x71, 0x66, 0x19, 0x63, 0x5F, 0x19, 0xC5, 0x48, 0x14, 0x06, 0x3F, 0x7F, 0x8F,
+	0x82, 0x82, 0x82, 0x38, 0xEE, 0x79, 0xF3, 0x77, 0xB8, 0xF4, 0xFA, 0x1E, 0xDA, 0x40, 0x7B, 0x69,
+	0x94, 0x85, 0x90, 0xC0, 0x49, 0x1B, 0xEE, 0x37, 0xCC, 0x0E, 0x8F, 0x07, 0xF9, 0xE3, 0xF1, 0x70,
+	0x2A, 0xA9, 0x17, 0xE9, 0xF8, 0x98, 0x04, 0xDD, 0x87, 0x45, 0xF1, 0xCA, 0xD5, 0x30, 0x0B, 0x12,
+	0x78, 0xF6, 0x37, 0x4E, 0xB5, 0x0E, 0x83, 0xC2, 0x22, 0x24, 0xF0, 0xD9, 0xC5, 0x49, 0x96, 0x2F,
+	0x7F, 0xCD, 0xDB, 0xC8, 0xBA, 0xCC, 0x60, 0xFB, 0x68, 0x14, 0x7F, 0xB9, 0xA8, 0xDA, 0xDA, 0x5A,
+	0xD6, 0xF6, 0x85, 0xA6, 0x05, 0x6B, 0x67, 0x7C, 0xAB, 0xE0, 0xB8, 0xD6, 0xEC, 0xAE, 0x97, 0xD9,
+	0xF1, 0x5D, 0x52, 0x29, 0x7A, 0xE8, 0x07, 0xDF, 0x8E, 0xB8, 0xEE, 0x2D, 0x4B, 0x4B, 0x4B, 0x53,
+	0x4B, 0xF3, 0x4B, 0x4B, 0x3D, 0x4B, 0x1D, 0x4B, 0x4B, 0x5C, 0xFC, 0x8D, 0xD8, 0xE2, 0xE3, 0x9F,
+	0x41, 0xBB, 0xDB, 0x21, 0x86, 0x69, 0xF2, 0xDD, 0x77, 0xF7, 0xD5, 0x7E, 0x93, 0x9F, 0xCC, 0xAB,
+	0xF9, 0x3B, 0x14, 0x2F, 0xEE, 0x35, 0xFA, 0x3C, 0xC1, 0x1F, 0xF0, 0x6A, 0xBD, 0x85, 0x83, 0x4A,
+	0x51, 0x87, 0x85, 0xBC, 0xC0, 0x8D, 0x61, 0x2C, 0x79, 0x0F, 0x3B, 0x56, 0xED, 0x5F, 0xF2, 0xAC,
+	0x9D, 0xAB, 0x16, 0xD1, 0x79, 0xB1, 0xDF, 0x12, 0x20, 0xF7, 0x24, 0x7F, 0x61, 0xBF, 0xAE, 0xF5,
+	0xF9, 0x74, 0xAE, 0x18, 0x2F, 0x05, 0xDF, 0x8A, 0x89, 0xA3, 0x87, 0xF3, 0xAB, 0xBB, 0xB5, 0xEE,
+	0x74, 0xEB, 0x97, 0xC1, 0xA8, 0xA5, 0x90, 0xC0, 0xCC, 0x62, 0x12, 0x89, 0x04, 0x6F, 0x49, 0x6C,
+	0x9C, 0xDC, 0xD0, 0x00, 0xAF, 0x7A, 0xA3, 0x14, 0x52, 0xD5, 0x9C, 0xE7, 0x22, 0xA0, 0x5A, 0xC3,
+	0xBD, 0xA6, 0x98, 0x3D, 0x1E, 0x8F, 0x37, 0x7A, 0xF9, 0x6B, 0x00, 0x33, 0x17, 0x7D, 0x69, 0x39,
+	0x34, 0x7F, 0xC0, 0xC8, 0xC1, 0xC1, 0x01, 0x3C, 0x53, 0xDC, 0xAB, 0xF9, 0x6C, 0xB9, 0x80, 0xC7,
+	0xA7, 0xA2, 0x1A, 0x47, 0xFB, 0x32, 0x18, 0xA3, 0xC2, 0x75, 0x49, 0x73, 0x73, 0x73, 0x9B, 0x80,
+	0xCA, 0xD5, 0x5B, 0x4A, 0x28, 0xCF, 0x08, 0xD0, 0x21, 0x2B, 0x3B, 0x3B, 0x8F, 0x39, 0x9D, 0x9D,
+	0x9D, 0x4D, 0x65, 0xD6, 0x65, 0x67, 0x67, 0x23, 0x37, 0xFC, 0x81, 0x9E, 0x0F, 0xAB, 0x79, 0x9F,
+	0x8B, 0x7F, 0x4A, 0xEF, 0x01, 0xA5, 0x3D, 0x46, 0x8F, 0xFF, 0xBE, 0x09, 0x93, 0x3F, 0xE6, 0x0A,
+	0x6C, 0x5F, 0xCB, 0x5F, 0x37, 0x71, 0xF0, 0xA1, 0x3F, 0xDE, 0xE3, 0x29, 0xFE, 0x8E, 0xB5, 0x27,
+	0x87, 0xD5, 0x76, 0xE8, 0xC3, 0x6F, 0xDF, 0xBE, 0x7D, 0x67, 0x95, 0x3A, 0xFA, 0x63, 0x01, 0x4A,
+	0x83, 0x63, 0x1F, 0xD6, 0xD6, 0xD6, 0xD6, 0x73, 0x4C, 0x1D, 0xFC, 0xB4, 0xC2, 0x1D, 0x00, 0x2F,
+	0xEE, 0x51, 0xB3, 0xFE, 0xBE, 0x3F, 0x81, 0x73, 0x97, 0x82, 0xF8, 0x7F, 0xE4, 0xE1, 0xEF, 0x5A,
+	0xB6, 0xF0, 0x75, 0xB1, 0xB3, 0xA1, 0x85, 0x76, 0x78, 0xDE, 0x9B, 0xA8, 0xF7, 0x0A, 0xFE, 0x33,
+	0xB7, 0xA3, 0x87, 0x07, 0x63, 0xB7, 0x9C, 0x2D, 0xE9, 0x0D, 0x5C, 0x5C, 0x90, 0xA0, 0x27, 0x35,
+	0x07, 0x37, 0x4B, 0xA9, 0x67, 0xB0, 0x6A, 0xA4, 0x91, 0x48, 0x24, 0xEE, 0x38, 0x0C, 0xAE, 0x7A,
+	0x67, 0x20, 0xC6, 0x97, 0x35, 0xC0, 0x3B, 0x6B, 0x6B, 0x45, 0x98, 0x7A, 0x4F, 0x8D, 0xE4, 0x59,
+	0xB8, 0xD9, 0xA1, 0x7C, 0x63, 0xB7, 0xC6, 0x05, 0x6D, 0x52, 0xD2, 0x4B, 0x4A, 0x4A, 0x4A, 0x2A,
+	0xC8, 0x8C, 0xDB, 0xF1, 0x5C, 0x5E, 0xFB, 0x5F, 0x42, 0x47, 0xD7, 0xAE, 0xEA, 0x60, 0x20, 0x42,
+	0x37, 0x61, 0x62, 0xBD, 0xD0, 0x4C, 0x57, 0x17, 0xB9, 0xE1, 0x5B, 0xCA, 0x1A, 0xAC, 0xDE, 0x35,
+	0x2E, 0xFE, 0xDD, 0x27, 0x7D, 0x3D, 0x55, 0x1E, 0x92, 0xFC, 0xF7, 0xED, 0x59, 0xBB, 0x75, 0xDF,
+	0x17, 0xA7, 0xFD, 0x3A, 0xFE, 0x32, 0x7E, 0xCD, 0x07, 0x8C, 0x22, 0xFB, 0x27, 0xF9, 0xDB, 0x56,
+	0x1D, 0x9E, 0x42, 0xA9, 0x42, 0x60, 0xC6, 0x2C, 0x3D, 0x21, 0x32, 0x32, 0x32, 0x32, 0x2E, 0xBF,
+	0xE7, 0xF4, 0xBA, 0x0B, 0xDA, 0x52, 0x4A, 0x2E, 0x7A, 0xE4, 0x8A, 0x9E, 0x99, 0x99, 0x99, 0x49,
+	0xA8, 0x1C, 0x38, 0x3D, 0x47, 0x86, 0x41, 0x70, 0xC9, 0x4C, 0xFE, 0x3E, 0x5B, 0x80, 0xCA, 0x88,
+	0x7E, 0x05, 0x7F, 0xAD, 0xA4, 0x91, 0xCF, 0xF3, 0x65, 0x41, 0x2E, 0xB8, 0xC4, 0x8E, 0x93, 0x83,
+	0x26, 0x2F, 0xD1, 0x97, 0xF9, 0x93, 0xC1, 0xCC, 0x62, 0x32, 0x99, 0x9C, 0xA6, 0xF1, 0xAC, 0x49,
+	0xF9, 0x14, 0xFF, 0xB9, 0xDB, 0x6E, 0x3E, 0xFE, 0x37, 0x48, 0xBD, 0xCB, 0x36, 0x7F, 0x89, 0xBF,
+	0x61, 0x02, 0xF5, 0x9A, 0x51, 0xC4, 0x93, 0x14, 0xFC, 0x2E, 0xB2, 0xF7, 0x03, 0x67, 0xAB, 0x1D,
+	0xF0, 0xC4, 0xC3, 0xD1, 0xCE, 0xED, 0xED, 0xED, 0xED, 0xB9, 0x7E, 0x4A, 0x8E, 0x9B, 0x80, 0xA8,
+	0x24, 0x0F, 0xD2, 0x4D, 0x9B, 0xB7, 0x3E, 0x61, 0x09, 0xDE, 0x3D, 0x12, 0xE6, 0xBF, 0x0C, 0x8B,
+	0x8B, 0xFF, 0x51, 0xC7, 0xEE, 0x0C, 0x75, 0x73, 0x2A, 0xCF, 0x8E, 0xFF, 0x01, 0x35, 0xA2, 0x7B,
+	0x6E, 0x76, 0x1B, 0x7C, 0x5E, 0xC7, 0xDF, 0xB6, 0x60, 0x1E, 0xCC, 0xBB, 0x7C, 0x25, 0xFF, 0x83,
+	0x21, 0x96, 0xC6, 0x96, 0x6E, 0xAE, 0x46, 0xB2, 0x39, 0x4E, 0xA7, 0xFD, 0x71, 0x06, 0x83, 0xC1,
+	0x58, 0xDA, 0xDD, 0xDD, 0xA5, 0xA6, 0x71, 0xAD, 0xED, 0xA7, 0x19, 0xD3, 0x73, 0xBD, 0xD3, 0xE0,
+	0x23, 0xF3, 0x4B, 0xFC, 0x1D, 0xAB, 0x76, 0x4F, 0x9A, 0xC1, 0x8C, 0x49, 0xE3, 0xD4, 0xF1, 0x9F,
+	0x13, 0x49, 0x1A, 0x2F, 0x11, 0x14, 0x73, 0xF0, 0xF4, 0x04, 0xFB, 0x7F, 0x4F, 0x4F, 0x27, 0xF1,
+	0xD7, 0xF0, 0x97, 0x66, 0xE9, 0xCD, 0x33, 0x51, 0x89, 0xAC, 0xF1, 0x1F, 0x5C, 0xED, 0x2A, 0x6D,
+	0x5E, 0xE0, 0xAF, 0x1D, 0x49, 0x3E, 0xD8, 0x69, 0x0A, 0xE0, 0x79, 0x29, 0x6C, 0x8A, 0x57, 0x4E,
+	0x9A, 0x3C, 0x85, 0xB9, 0xF8, 0x77, 0xCC, 0xCD, 0xCD, 0x0D, 0x8C, 0x2E, 0xAE, 0x52, 0xD2, 0x78,
+	0x72, 0x92, 0xD4, 0x1C, 0x1D, 0x1D, 0x43, 0xFB, 0x8E, 0x6B, 0x1D, 0x1D, 0xCB, 0x77, 0x87, 0xA2,
+	0x1C, 0x1D, 0x35, 0x90, 0x93, 0x3E, 0xD2, 0x73, 0x60, 0x35, 0x1F, 0xA2, 0xF8, 0xF7, 0xD0, 0x77,
+	0xFB, 0x88, 0xFB, 0x77, 0xFD, 0x49, 0x86, 0xFC, 0x0F, 0x08, 0xE6, 0xD4, 0xCD, 0xE4, 0xBD, 0x8A,
+	0xBF, 0x56, 0x5C, 0xDF, 0xFD, 0x70, 0x8A, 0x81, 0x30, 0x9B, 0xBF, 0x30, 0x7F, 0x29, 0xDB, 0x55,
+	0x1F, 0x9D, 0xD4, 0x22, 0xA3, 0x91, 0x83, 0xB1, 0xDD, 0xAB, 0xAB, 0xAB, 0xAB, 0xF3, 0xBD, 0xF9,
+	0xCE, 0x2C, 0x27, 0x31, 0x14, 0xFF, 0xAD, 0xAD, 0xAD, 0xC5, 0x89, 0x09, 0x5A, 0x5D, 0x3C, 0x57,
+	0x14, 0xAF, 0xB4, 0x4F, 0xC3, 0xF6, 0x4D, 0x4F, 0x2C, 0xDA, 0xD6, 0x45, 0xF3, 0x67, 0x7B, 0xCA,
+	0x59, 0xFC, 0x59, 0x0E, 0x19, 0x0D, 0x78, 0x99, 0x82, 0x47, 0x06, 0x6B, 0xD7, 0x54, 0x61, 0x2F,
+	0xD2, 0xD5, 0x46, 0xB1, 0xF9, 0x8B, 0x35, 0x98, 0xCF, 0xFE, 0x7F, 0x9A, 0xFF, 0x37, 0x7A, 0x42,
+	0x38, 0x5B, 0xBE, 0xF2, 0x2F, 0xF0, 0x87, 0xAB, 0xDD, 0x4B, 0xFC, 0xD5, 0x42, 0x9A, 0x36, 0x4F,
+	0x3A, 0x63, 0x78, 0x86, 0x30, 0x72, 0xA1, 0xDD, 0xF7, 0x33, 0x99, 0x86, 0xE8, 0x13, 0xEF, 0xE8,
+	0x60, 0xA4, 0x62, 0x7A, 0x3E, 0x79, 0xE3, 0x9C, 0x12, 0xC5, 0x3D, 0xB2, 0x71, 0xAF, 0xAD, 0xAB,
+	0xAB, 0xA3, 0xD1, 0xEA, 0xEA, 0xEA, 0x5A, 0x68, 0x9D, 0x75, 0x75, 0x75, 0x1E, 0xE8, 0xC7, 0xD5,
+	0x67, 0x8B, 0xDB, 0xFE, 0x1B, 0xA0, 0x0F, 0x64, 0xC4, 0x53, 0xAF, 0x8F, 0xC8, 0x61, 0xAA, 0x7C,
+	0xC5, 0x23, 0xE9, 0xDD, 0xB0, 0x73, 0x4B, 0x8D, 0x79, 0x05, 0x7F, 0xF0, 0x93, 0xCB, 0x65, 0x7E,
+	0x7E, 0x7E, 0x7E, 0x20, 0x7F, 0x3F, 0x3F, 0x7B, 0xBE, 0x52, 0x76, 0x6D, 0xBC, 0xD8, 0xAB, 0xB0,
+	0x46, 0x5E, 0xE1, 0xDE, 0x66, 0x50, 0x0D, 0x15, 0x59, 0x21, 0xE6, 0xA2, 0x9C, 0x2F, 0x3D, 0xA3,
+	0x17, 0x17, 0x17, 0x17, 0x93, 0xE6, 0xF7, 0xEA, 0x3D, 0xB8, 0xE2, 0x67, 0xEC, 0xF2, 0x67, 0x7F,
+	0x9F, 0xCA, 0xE1, 0x7A, 0x25, 0xD0, 0xFC, 0x21, 0x4F, 0x79, 0x57, 0x4F, 0x0F, 0xEB, 0x7F, 0x28,
+	0xB2, 0x52, 0x36, 0x72, 0xE8, 0x27, 0xB4, 0x5C, 0x92, 0x75, 0xC5, 0x1E, 0x77, 0x9E, 0xEA, 0xDF,
+	0xCD, 0xFF, 0x78, 0x10, 0x16, 0x9C, 0xE9, 0xF6, 0x04, 0xFF, 0x5B, 0xA4, 0xDE, 0x65, 0x3E, 0xDF,
+	0xFE, 0xBF, 0xF3, 0xAF, 0x5B, 0x39, 0xA7, 0x26, 0xF3, 0x06, 0x9A, 0x98, 0xE7, 0x2D, 0x5E, 0x91,
+	0xFD, 0x25, 0x79, 0x9B, 0x66, 0x0D, 0x0D, 0x4D, 0xD3, 0xF0, 0x8E, 0xDB, 0xB5, 0x12, 0xEE, 0x68,
+	0x77, 0x1C, 0xF1, 0xF4, 0x74, 0x91, 0x39, 0xB3, 0x71, 0x7A, 0xDA, 0x73, 0x3A, 0x78, 0x7A, 0x0A,
+	0x7B, 0x1C, 0x9F, 0x19, 0xFF, 0x4D, 0xD0, 0x32, 0x6D, 0xAD, 0xB2, 0xC7, 0xBF, 0xAC, 0xD5, 0xA0,
+	0x12, 0x2F, 0xE1, 0xCF, 0x6B, 0xC5, 0xF5, 0xDE, 0x6F, 0xD7, 0xBD, 0x82, 0xBF, 0x65, 0xEE, 0xF4,
+	0x63, 0x17, 0x4A, 0xEC, 0x27, 0x43, 0x7D, 0xAD, 0x64, 0x50, 0xF7, 0x07, 0x76, 0x22, 0x19, 0x7C,
+	0xD8, 0xCD, 0xCD, 0xCD, 0xCD, 0xC5, 0x46, 0xEF, 0x2D, 0xCF, 0x97, 0x9A, 0x99, 0x99, 0x65, 0x4E,
+	0xFE, 0x98, 0x48, 0x47, 0x37, 0x47, 0xBA, 0x09, 0xFD, 0xF7, 0x1B, 0x35, 0x9E, 0x12, 0x4F, 0xF2,
+	0x67, 0x7B, 0xCA, 0xBB, 0x6E, 0xE6, 0xD7, 0xC0, 0x49, 0x05, 0x68, 0x6D, 0x39, 0x85, 0xD8, 0xB1,
+	0x9F, 0x50, 0x8E, 0x3C, 0xDF, 0x8A, 0x73, 0x7F, 0x3F, 0xFF, 0xE1, 0xDD, 0x5B, 0x96, 0x18, 0x2F,
+	0xF0, 0xE7, 0xD4, 0x3B, 0x3D, 0x91, 0xE7, 0xF8, 0xCB, 0x79, 0x55, 0x32, 0xAE, 0x07, 0xD2, 0x79,
+	0x93, 0x17, 0xA4, 0x02, 0xDA, 0xAE, 0x16, 0xF3, 0xCC, 0x05, 0xDE, 0xB9, 0x75, 0xD9, 0x0E, 0xB4,
+	0x63, 0x26, 0x8A, 0x3F, 0x9A, 0x42, 0xD7, 0x2B, 0xF8, 0x2F, 0xD2, 0x13, 0x94, 0xDE, 0xB8, 0x97,
+	0x2F, 0x71, 0x65, 0x5D, 0x20, 0x9F, 0xB7, 0xCD, 0x9F, 0xFB, 0x39, 0xF5, 0x0A, 0xFE, 0x0E, 0xB5,
+	0x27, 0x0F, 0x6C, 0x75, 0xDF, 0x2D, 0x2F, 0x3E, 0x0C, 0xF3, 0xF1, 0x37, 0xCA, 0x9C, 0xF9, 0x01,
+	0xEF, 0xAC, 0xF0, 0x44, 0xE1, 0xC3, 0x87, 0xDF, 0x78, 0x37, 0x1D, 0x1E, 0xB7, 0xF8, 0xA2, 0x5E,
+	0xF9, 0x80, 0xE6, 0xFD, 0x8B, 0x2E, 0x9E, 0x90, 0x78, 0x6E, 0xFE, 0xAC, 0xE0, 0xFD, 0x2E, 0x28,
+	0x88, 0x1F, 0x22, 0x2D, 0x1F, 0x33, 0xFA, 0x07, 0xB4, 0x46, 0x8A, 0x39, 0xEF, 0x2E, 0x52, 0xAF,
+	0xE5, 0xAF, 0x8E, 0x9E, 0x0E, 0x78, 0xAB, 0x28, 0xCE, 0xE1, 0x0F, 0x0E, 0x13, 0x59, 0x7A, 0x99,
+	0xBF, 0xD2, 0x93, 0x59, 0xC3, 0x1C, 0xFE, 0x52, 0xEE, 0x25, 0xB3, 0xF7, 0xC3, 0xD9, 0x76, 0xBC,
+	0x61, 0x86, 0xC6, 0xD9, 0xB3, 0xEF, 0x29, 0xA1, 0x72, 0x02, 0x2F, 0x29, 0x20, 0xAC, 0xC9, 0xC0,
+	0xD7, 0xCF, 0x8F, 0x78, 0xD5, 0xE1, 0xE7, 0x97, 0xCD, 0x98, 0xCF, 0xF0, 0xF3, 0xF3, 0x33, 0x7E,
+	0x9D, 0xFF, 0x5F, 0x31, 0xB0, 0x79, 0xF7, 0xFD, 0x60, 0x8A, 0x31, 0xDF, 0x97, 0xC8, 0xF8, 0x36,
+	0xED, 0x5D, 0x77, 0xBF, 0x86, 0x7F, 0x3B, 0xAC, 0x8E, 0x8E, 0xF6, 0xF6, 0x76, 0x5E, 0xFE, 0x3A,
+	0x61, 0xE4, 0xD3, 0xA3, 0x26, 0x0F, 0xA1, 0xD7, 0xF0, 0x07, 0xF4, 0x52, 0xC7, 0x7E, 0x9F, 0x21,
+	0x70, 0x46, 0xC1, 0x4E, 0xC5, 0x8C, 0x6F, 0xE3, 0x99, 0x3C, 0x6B, 0x3D, 0xA3, 0xF9, 0xAB, 0x44,
+	0xB0, 0x62, 0xF7, 0xC1, 0xF1, 0x3F, 0xF8, 0x7F, 0x8A, 0x15, 0x34, 0x71, 0xD4, 0xFF, 0x1D, 0xF2,
+	0x8F, 0x3A, 0xD6, 0x1C, 0x1D, 0x54, 0xD9, 0xFD, 0x3A, 0x7F, 0xFD, 0x84, 0xF4, 0x74, 0x64, 0x3E,
+	0xCE, 0x3A, 0x3C, 0xCE, 0x4F, 0x0B, 0x75, 0x36, 0x9E, 0x2D, 0x47, 0xF1, 0x7F, 0x00, 0x7F, 0x31,
+	0xA7, 0x7C, 0xFA, 0xE3, 0x58, 0xAE, 0x23, 0x6F, 0xD4, 0xE8, 0x1B, 0x1F, 0xE2, 0xD9, 0x5A, 0xA9,
+	0xAD, 0xE0, 0x4B, 0x3A, 0xF0, 0x7B, 0x49, 0x00, 0x61, 0x89, 0x60, 0xEA, 0x49, 0xBD, 0xB3, 0x55,
+	0xD9, 0xCE, 0x70, 0x8C, 0x02, 0x32, 0x79, 0xF5, 0xE2, 0xFC, 0x9F, 0x4E, 0x2C, 0xE5, 0xF2, 0xA4,
+	0x3D, 0x42, 0x9D, 0xEF, 0xF3, 0x3A, 0x09, 0xFD, 0x0F, 0x37, 0x7F, 0x7B, 0x91, 0xBF, 0xA6, 0x97,
+	0x37, 0x24, 0xB0, 0xFF, 0xF7, 0xF6, 0xB6, 0x45, 0x5D, 0xC6, 0xD8, 0xD8, 0xC2, 0x2D, 0xAE, 0x79,
+	0xED, 0xC3, 0x70, 0x8A, 0x3E, 0xF0, 0x2A, 0xFE, 0xC2, 0xF8, 0xBA, 0xDD, 0xCB, 0xF6, 0x60, 0xF8,
+	0xA5, 0x37, 0x4C, 0x19, 0xFA, 0xB0, 0x52, 0xE9, 0x6E, 0x0C, 0xC9, 0x48, 0x82, 0xDF, 0xFE, 0x57,
+	0x02, 0x63, 0xF7, 0xD9, 0xF6, 0xBF, 0x86, 0x86, 0x86, 0x3A, 0xF4, 0xD8, 0x9E, 0xA4, 0xAB, 0xB5,
+	0x62, 0x10, 0xA6, 0x6C, 0x70, 0xD7, 0xC3, 0x52, 0xAE, 0xD1, 0xAF, 0xF3, 0x37, 0x2B, 0x9E, 0x9F,
+	0x87, 0xDD, 0xBB, 0xBA, 0x29, 0xD4, 0xF1, 0x26, 0x7F, 0x89, 0x67, 0xC7, 0x7F, 0xFF, 0x69, 0xFE,
+	0x76, 0xD9, 0x23, 0xEF, 0x27, 0x0B, 0x5D, 0xA1, 0x9E, 0x42, 0x1C, 0x95, 0x9B, 0x32, 0xF9, 0x65,
+	0x20, 0x46, 0x99, 0xEF, 0x92, 0xC6, 0xC6, 0xC6, 0xA6, 0x2E, 0x29, 0xFD, 0x1F, 0x36, 0x4A, 0x78,
+	0x3B, 0x0C, 0xA5, 0xF8, 0xF1, 0x8D, 0x22, 0x33, 0xB7, 0xA6, 0x8B, 0x2E, 0x4E, 0xB6, 0xD8, 0xCB,
+	0xFC, 0x01, 0x8B, 0xCC, 0xD1, 0x4F, 0xEB, 0xB5, 0xDE, 0x32, 0x7C, 0x9F, 0xB7, 0x2F, 0x5C, 0xF8,
+	0x3F, 0xFF, 0xBF, 0xD7, 0xF9, 0xFF, 0x01, 0xF6, 0x6E, 0xCA, 0x5C, 0xE3, 0xBF, 0x39, 0x7A, 0x41,
+	0x41, 0x41, 0x49, 0xC3, 0xE0, 0xEE, 0xFB, 0xC9, 0x42, 0x27, 0xE0, 0x75, 0xFC, 0x01, 0xAD, 0xC4,
+	0xA1, 0x2F, 0x8B, 0x85, 0x10, 0x06, 0xB9, 0x90, 0xD6, 0xB9, 0xB9, 0xB6, 0x02, 0x44, 0x90, 0xCB,
+	0xE3, 0x15, 0xE3, 0x3F, 0x8B, 0x42, 0xE6, 0x7D, 0x4F, 0xAC, 0x89, 0x82, 0x8A, 0x6B, 0x11, 0xE3,
+	0x43, 0x5F, 0xA4, 0xC2, 0x7F, 0x86, 0xFF, 0x16, 0x32, 0xBD, 0x63, 0x53, 0xB1, 0xFF, 0x7F, 0xB0,
+	0xD7, 0x32, 0xFC, 0x55, 0xFE, 0xF0, 0x9B, 0x6B, 0xAC, 0xF4, 0x14, 0x7F, 0x8B, 0xB4, 0x81, 0x9B,
+	0xD9, 0x52, 0xD8, 0x50, 0xCC, 0x46, 0xEA, 0xBB, 0x10, 0xBE, 0xE1, 0x70, 0xA7, 0xDA, 0x85, 0xE7,
+	0x92, 0x7F, 0x80, 0x65, 0x5A, 0x50, 0x58, 0x4B, 0x3B, 0xBD, 0xE9, 0xE5, 0xCB, 0x22, 0xD0, 0xCF,
+	0x5E, 0x9C, 0x4B, 0xD7, 0x0A, 0xE8, 0x3E, 0x47, 0xBB, 0x91, 0x5F, 0xE6, 0x2F, 0xEA, 0x5A, 0xCA,
+	0xF8, 0x39, 0x5B, 0xE8, 0xC8, 0xF7, 0x79, 0x59, 0xFF, 0x96, 0xC3, 0xFF, 0xE7, 0x3F, 0xCF, 0xBF,
+	0x93, 0xBE, 0xBE, 0xBE, 0xBE, 0x7D, 0xFA, 0x71, 0x67, 0xA0, 0x00, 0x59, 0xEA, 0xF1, 0x45, 0xFE,
+	0xE0, 0x46, 0xC3, 0xF7, 0x70, 0xC2, 0x9E, 0x72, 0xE2, 0xE4, 0xF4, 0xF0, 0x3A, 0x47, 0x10, 0x8F,
+	0x57, 0xF0, 0x57, 0x08, 0xEB, 0x38, 0xDB, 0xED, 0xC8, 0x8E, 0x4D, 0x28, 0x1B, 0xFB, 0xB0, 0x54,
+	0xEA, 0x00, 0xBC, 0x9A, 0xBF, 0x16, 0x7C, 0x15, 0xF3, 0x92, 0x6D, 0x64, 0x25, 0x14, 0xD3, 0xFC,
+	0xD9, 0x6D, 0x2A, 0x7B, 0xC1, 0xC6, 0x5F, 0xE1, 0x7F, 0x4D, 0xE7, 0xBC, 0xBA, 0xA8, 0xF5, 0x7E,
+	0xB8, 0xF9, 0xBB, 0x36, 0x9D, 0xFF, 0xB9, 0x82, 0xF8, 0x67, 0x38, 0x3B, 0x82, 0x69, 0x25, 0x8D,
+	0xFE, 0x3E, 0x9A, 0xA4, 0xC9, 0x73, 0xC9, 0xED, 0x41, 0xB0, 0x1C, 0x36, 0x8E, 0xBE, 0x1C, 0x0E,
+	0x12, 0xF8, 0x6C, 0x55, 0xEB, 0x72, 0xE6, 0x70, 0xB4, 0x62, 0xEC, 0x28, 0xB3, 0xD4, 0x52, 0x40,
+	0x8E, 0x02, 0x9B, 0x3F, 0x93, 0xC9, 0xE1, 0x0F, 0x1F, 0x97, 0xF7, 0x6F, 0x64, 0x32, 0x69, 0xA9,
+	0x06, 0x7C, 0x9F, 0xD7, 0x4B, 0xA2, 0x21, 0x9F, 0x47, 0xC5, 0xD3, 0x3E, 0xC9, 0x9F, 0xC9, 0x44,
+	0xF3, 0xEF, 0xA2, 0x33, 0x99, 0x4C, 0x06, 0xBD, 0xA7, 0x2A, 0xDE, 0x5E, 0x4A, 0xE0, 0xDD, 0x08,
+	0xBC, 0x49, 0xB5, 0xD8, 0x7E, 0x26, 0xB3, 0xDC, 0x11, 0xE1, 0x3F, 0xC9, 0xE4, 0x88, 0xC3, 0x9F,
+	0xF9, 0x92, 0xFF, 0xD7, 0x34, 0xAD, 0xFF, 0xF8, 0x7C, 0x7E, 0x6C, 0x62, 0xED, 0xD3, 0x72, 0x63,
+	0xA0, 0xC2, 0x6B, 0xF8, 0x5B, 0x96, 0xEE, 0x5C, 0xB6, 0xA6, 0xA4, 0xC7, 0xA9, 0x23, 0x8B, 0x76,
+	0xAC, 0x16, 0x40, 0x23, 0xB2, 0xB7, 0xDE, 0x39, 0x25, 0xC9, 0x56, 0xC0, 0xAF, 0xF2, 0x3F, 0xA5,
+	0x21, 0x6F, 0x6E, 0x4F, 0xA0, 0xD8, 0x93, 0xFC, 0x51, 0x0F, 0xC8, 0xE4, 0xF0, 0x77, 0xAD, 0x61,
+	0x32, 0x1B, 0x3D, 0x84, 0x78, 0x2E, 0x49, 0x01, 0xCB, 0x94, 0xB9, 0x34, 0x4B, 0x6B, 0x4C, 0xB6,
+	0xE7, 0xDB, 0x3D, 0xCA, 0x32, 0x93, 0x40, 0xF0, 0x56, 0x08, 0x27, 0x10, 0x12, 0x75, 0x78, 0x72,
+	0x14, 0xE0, 0x19, 0x44, 0x30, 0xF9, 0x28, 0xD5, 0x98, 0xEF, 0xB8, 0x56, 0x34, 0x81, 0x40, 0x48,
+	0x31, 0xE0, 0xFF, 0xBC, 0x63, 0x36, 0x81, 0x90, 0x66, 0xC2, 0x17, 0x4F, 0x2B, 0x38, 0x1F, 0x1A,
+	0x0C, 0x96, 0x8F, 0xD7, 0x42, 0x7F, 0x2D, 0x81, 0x40, 0xC8, 0x4C, 0x0C, 0x71, 0xD2, 0x78, 0xE2,
+	0x6E, 0x04, 0x1F, 0x76, 0xC8, 0x86, 0x52, 0x04, 0x01, 0x00, 0x7C, 0x16, 0xB4, 0x32, 0xA1, 0x57,
+	0x11, 0xCF, 0x15, 0xB7, 0xCF, 0xE2, 0xBF, 0xCA, 0xC3, 0x1F, 0xB0, 0x49, 0x21, 0x4D, 0x6F, 0x1F,
+	0x1D, 0xAC, 0x0E, 0x55, 0x04, 0x6B, 0x02, 0x4F, 0x37, 0xCC, 0x9C, 0xE5, 0xC2, 0x74, 0xD2, 0xA7,
+	0x7F, 0xEE, 0x4C, 0xCF, 0xB1, 0x37, 0x8A, 0x02, 0x54, 0x22, 0x7B, 0x3F, 0x71, 0x96, 0x7D, 0x91,
+	0x31, 0x32, 0xD7, 0x06, 0x7E, 0x99, 0x3F, 0x93, 0x86, 0x70, 0xE5, 0xE1, 0xCF, 0xE4, 0xF0, 0xB7,
+	0xCF, 0x42, 0x3F, 0x61, 0x96, 0x0D, 0x3A, 0x65, 0x2C, 0xD9, 0x80, 0xBF, 0x94, 0x40, 0x65, 0xA7,
+	0x45, 0xE1, 0x05, 0x84, 0x3F, 0x88, 0xEA, 0xE8, 0xEA, 0xCA, 0x03, 0xAA, 0x5C, 0x31, 0xED, 0xA8,
+	0x1C, 0x05, 0x28, 0xF9, 0x48, 0x5B, 0xC0, 0x71, 0x30, 0x8D, 0x4C, 0xFB, 0x85, 0xCF, 0xA3, 0xE2,
+	0x69, 0x05, 0xC7, 0x2A, 0x83, 0xC1, 0xF2, 0x9A, 0x5C, 0x5F, 0x0B, 0x5E, 0x55, 0x45, 0x0A, 0x78,
+	0xEA, 0x6E, 0x04, 0x1F, 0x06, 0xBF, 0x53, 0x17, 0xF2, 0xAC, 0xAA, 0xB2, 0x2F, 0x02, 0x4B, 0x47,
+	0x14, 0xCE, 0x35, 0xE5, 0x79, 0x46, 0x7C, 0x5E, 0x5E, 0x5E, 0x2C, 0x4F, 0x77, 0x68, 0xE8, 0x9F,
+	0x5E, 0x5A, 0x5D, 0x55, 0x10, 0xE7, 0xAA, 0x24, 0x60, 0xFE, 0x1F, 0x69, 0x97, 0x53, 0x74, 0x38,
+	0x6B, 0x45, 0xD4, 0xCE, 0x1E, 0x1C, 0x41, 0x1B, 0x85, 0x01, 0x6E, 0x95, 0x6B, 0xAB, 0x55, 0xAE,
+	0xBF, 0xE0, 0xFF, 0xE7, 0xE5, 0x8F, 0xC0, 0x62, 0x0B, 0x95, 0x44, 0xC6, 0xFA, 0x0B, 0x92, 0x68,
+	0x28, 0xAE, 0xCB, 0xA5, 0x37, 0xE8, 0x94, 0x31, 0x2D, 0x01, 0xA5, 0x04, 0x4A, 0x57, 0x03, 0xCB,
+	0x31, 0xE1, 0x8E, 0x3F, 0x30, 0x34, 0x34, 0xE4, 0x5B, 0xA1, 0x4F, 0x52, 0xDB, 0xD2, 0xCE, 0xD6,
+	0x44, 0x45, 0x00, 0xC1, 0xB3, 0x41, 0xB8, 0x5D, 0x5E, 0x46, 0x2D, 0xEB, 0xAD, 0xEA, 0x9B, 0x5D,
+	0x59, 0x5D, 0x0C, 0xB5, 0xFF, 0x0E, 0xD9, 0xDD, 0xC4, 0x30, 0x95, 0x67, 0x52, 0xFE, 0x78, 0xF9,
+	0xF3, 0xE5, 0x61, 0x2B, 0x71, 0xBD, 0xBA, 0x72, 0x3C, 0x7F, 0x79, 0x87, 0x41, 0xFB, 0x2F, 0x12,
+	0x48, 0x70, 0x10, 0x69, 0x98, 0xD1, 0xCB, 0xBA, 0x4B, 0x19, 0xD8, 0xDA, 0x99, 0x43, 0x9D, 0xD5,
+	0x1B, 0x8B, 0xE8, 0x30, 0xDD, 0xA7, 0x52, 0xFE, 0xF8, 0x3A, 0xB0, 0xBF, 0x7E, 0x1E, 0x36, 0x26,
+	0xC1, 0x0D, 0x73, 0xBC, 0xD6, 0x93, 0xB9, 0x7D, 0x8A, 0xCF, 0xA7, 0xFC, 0x61, 0x79, 0xD8, 0xFF,
+	0x4D, 0xC5, 0xD5, 0x30, 0x6B, 0xFE, 0x4F, 0x79, 0x2A, 0x49, 0x19, 0x41, 0xDB, 0x3C, 0xCA, 0x08,
+	0x48, 0x12, 0x10, 0x97, 0x79, 0x65, 0xAE, 0x99, 0x08, 0x6A, 0x86, 0x1B, 0x7D, 0x4D, 0x68, 0x32,
+	0x46, 0x4A, 0xE6, 0x17, 0xB7, 0x61, 0x79, 0xF5, 0x17, 0xFF, 0xBB, 0x49, 0x94, 0xB3, 0x48, 0x86,
+	0xE4, 0x0B, 0xDB, 0xDA, 0xBD, 0x11, 0xF8, 0x77, 0x05, 0x4B, 0xAF, 0xD0, 0x88, 0x10, 0x2F, 0x4B,
+	0xAE, 0x7E, 0x49, 0xCA, 0x14, 0x1F, 0x1C, 0x11, 0xEA, 0xCD, 0x7D, 0x50, 0x44, 0xDF, 0x2D, 0x38,
+	0x22, 0xD4, 0xCB, 0x82, 0x33, 0xF7, 0xA6, 0xE8, 0x86, 0xC7, 0xE3, 0xC0, 0x09, 0x16, 0x35, 0x1C,
+	0x1E, 0xEF, 0xC6, 0xB1, 0x4B, 0x34, 0x1C, 0xFC, 0xC2, 0xC3, 0x03, 0xDD, 0x38, 0xDB, 0x3C, 0x2A,
+	0xB8, 0xE2, 0xF1, 0x6E, 0xC6, 0xF8, 0x90, 0x88, 0x10, 0x9C, 0x91, 0x88, 0xAC, 0xA5, 0x77, 0x58,
+	0x44, 0x90, 0x1B, 0x67, 0x14, 0xA2, 0x83, 0xC7, 0xE3, 0x9D, 0x41, 0x37, 0x8F, 0x15, 0x1E, 0xEF,
+	0x0E, 0x8E, 0x9B, 0x8C, 0xF1, 0x78, 0xBC, 0x1D, 0xFB, 0x64, 0x79, 0xF0, 0x4C, 0x5D, 0x9E, 0x5D,
+	0x5F, 0x8C, 0x40, 0x07, 0x3A, 0xEB, 0xB9, 0xC1, 0xFD, 0x21, 0xA1, 0x91, 0x1D, 0x78, 0x0F, 0xAC,
+	0x40, 0x3A, 0x59, 0x17, 0x3C, 0x1E, 0x0F, 0x45, 0x38, 0x59, 0x40, 0xEE, 0x76, 0x50, 0xEE, 0x2A,
+	0xFF, 0x15, 0x39, 0xA6, 0x5E, 0x5E, 0x5E, 0xFF, 0x9C, 0xFD, 0xA6, 0xC0, 0x92, 0x71, 0xB7, 0xF1,
+	0x8F, 0x08, 0x76, 0x62, 0x0F, 0x6D, 0xB4, 0x83, 0x3D, 0x0D, 0x9F, 0xA9, 0x24, 0xB2, 0xE6, 0x01,
+	0x78, 0x01, 0x7F, 0x36, 0x06, 0x77, 0x74, 0xA4, 0xF5, 0xB5, 0x16, 0x06, 0xA1, 0x06, 0xFE, 0x1A,
+	0xBE, 0x39, 0x2D, 0xBD, 0xB4, 0x7E, 0x72, 0x61, 0x30, 0xCA, 0xC4, 0x51, 0x70, 0x4F, 0x6F, 0xA0,
+	0xD2, 0xFA, 0x48, 0xF9, 0xFE, 0x48, 0xBF, 0x67, 0x51, 0x4A, 0x22, 0xB1, 0xB2, 0x45, 0x1C, 0x6A,
+	0x48, 0x24, 0xC4, 0xD9, 0x23, 0x62, 0x13, 0x57, 0xD9, 0x39, 0x30, 0xD8, 0xD3, 0x90, 0xEE, 0x0E,
+	0xBF, 0x3F, 0xE6, 0xC5, 0x24, 0x52, 0x79, 0x76, 0x73, 0x2F, 0xAD, 0xB7, 0x29, 0xC3, 0x25, 0xB0,
+	0xA0, 0xB5, 0x9F, 0xD6, 0xD3, 0x90, 0x62, 0x0F, 0xBF, 0x1E, 0xF8, 0x16, 0x12, 0x09, 0xF4, 0xB3,
+	0x2B, 0xC5, 0x92, 0x48, 0x15, 0x76, 0x00, 0x20, 0x1E, 0x48, 0x22, 0x91, 0x52, 0xD8, 0x13, 0x77,
+	0xA6, 0x45, 0x24, 0x52, 0x05, 0xCF, 0xAE, 0x2F, 0x22, 0xFE, 0x24, 0x12, 0x89, 0xB5, 0x93, 0x84,
+	0x4A, 0x3C, 0x89, 0x44, 0x82, 0xC6, 0xC3, 0xE0, 0x3D, 0x90, 0x42, 0x15, 0x01, 0xC0, 0xAE, 0x88,
+	0x44, 0x22, 0xB1, 0x43, 0x6E, 0x59, 0x1B, 0x23, 0xC2, 0xAA, 0xE4, 0xDD, 0x37, 0x41, 0x03, 0x35,
+	0x78, 0xD2, 0xFE, 0xE7, 0xE0, 0x7F, 0x13, 0xD4, 0xD6, 0xD6, 0xEC, 0xF6, 0x2B, 0x67, 0x80, 0x6F,
+	0xAF, 0x03, 0x4F, 0xDB, 0xA9, 0xE0, 0xCA, 0xC9, 0xB1, 0xE5, 0xB8, 0xA9, 0x8A, 0x48, 0xA4, 0x9A,
+	0xA2, 0xCE, 0x41, 0x2A, 0x94, 0xDA, 0x64, 0x55, 0xDE, 0x94, 0xE9, 0x6F, 0x2E, 0x2F, 0xF8, 0xAA,
+	0x8A, 0xD6, 0x21, 0x79, 0x6D, 0xC9, 0xFC, 0xF9, 0xE8, 0x26, 0x89, 0xED, 0xCB, 0xD7, 0x17, 0x27,
+	0x37, 0xD7, 0x8B, 0x2D, 0x9C, 0x21, 0x8B, 0x5A, 0x48, 0xFD, 0xEC, 0xF9, 0xDD, 0xF9, 0xF5, 0xCD,
+	0x12, 0x29, 0x9A, 0x93, 0x7E, 0xE7, 0x5D, 0x36, 0x7E, 0x74, 0x7F, 0x7E, 0x73, 0xB5, 0xD0, 0x18,
+	0x02, 0x7F, 0xD2, 0xB2, 0x6C, 0x97, 0x1D, 0x9D, 0xE3, 0x50, 0x7B, 0xC2, 0x71, 0xF6, 0x5A, 0x67,
+	0xF5, 0x6D, 0x3F, 0x5C, 0x5E, 0x7C, 0x38, 0x1A, 0x2F, 0xC5, 0x8B, 0x23, 0x1E, 0xD1, 0xC3, 0xAA,
+	0xA9, 0xB3, 0xAB, 0xBB, 0xAF, 0xA7, 0xA3, 0xB9, 0x4D, 0x8C, 0xEB, 0xAB, 0xFB, 0xCF, 0x87, 0x83,
+	0x99, 0xF0, 0x5C, 0x9D, 0x75, 0xE9, 0xD6, 0x51, 0xAD, 0x13, 0xE8, 0x2B, 0xED, 0x1D, 0xE9, 0xF0,
+	0x7F, 0x03, 0x2E, 0x74, 0x75, 0x0B, 0x2F, 0x1A, 0x6A, 0x5A, 0xB4, 0x79, 0x54, 0xCD, 0xBB, 0xEB,
+	0x8B, 0x63, 0xD5, 0xEE, 0x61, 0xAD, 0x33, 0x6B, 0x49, 0xB4, 0xD5, 0x0B, 0x78, 0x91, 0x15, 0x9D,
+	0x84, 0xFE, 0xDB, 0xE5, 0x52, 0x47, 0x40, 0x33, 0xB6, 0xEF, 0x76, 0xAD, 0xCA, 0x5D, 0x94, 0xCD,
+	0x7F, 0x88, 0x3D, 0xDF, 0x7E, 0x3B, 0x33, 0x3F, 0x55, 0xC5, 0xC3, 0x5F, 0x3D, 0x16, 0x65, 0xCC,
+	0xC1, 0x19, 0x02, 0x4A, 0x78, 0x2F, 0x2F, 0x6B, 0x2F, 0x2F, 0xCF, 0x5F, 0xE9, 0xDC, 0x85, 0x34,
+	0x34, 0x35, 0x39, 0xD3, 0xCC, 0xD2, 0xEF, 0xA4, 0xD0, 0xFC, 0xA9, 0x57, 0x68, 0xFE, 0x42, 0xD2,
+	0x32, 0x2F, 0xEC, 0xEE, 0x6D, 0x5C, 0x40, 0x22, 0xF1, 0xF8, 0xA3, 0x00, 0x9B, 0x12, 0x22, 0x31,
+	0x50, 0x8A, 0x8F, 0xFF, 0xE6, 0x69, 0xDD, 0xFC, 0xFD, 0x8F, 0x29, 0x84, 0xFF, 0xDE, 0x4C, 0x5B,
+	0x7E, 0x98, 0x9D, 0x80, 0x56, 0x4E, 0xD5, 0x21, 0xA2, 0xA8, 0x8B, 0x31, 0xCD, 0xCF, 0x5F, 0x21,
+	0xAC, 0xFD, 0xE8, 0x90, 0xD6, 0x54, 0xDB, 0x3A, 0xFD, 0x61, 0xAD, 0x12, 0xF6, 0x1F, 0x8A, 0x79,
+	0xD4, 0xAC, 0xBE, 0x9F, 0x6E, 0x6B, 0x20, 0x4D, 0x5C, 0xED, 0x34, 0xC3, 0x7B, 0x3F, 0x02, 0x4E,
+	0x25, 0x73, 0x1F, 0xE6, 0xDA, 0x1B, 0x48, 0xF4, 0xBB, 0xD5, 0x2A, 0xB7, 0xE7, 0xF8, 0x2B, 0xC7,
+	0x50, 0xAF, 0xB6, 0x7A, 0x9B, 0x1A, 0x7B, 0xD6, 0x3F, 0x4F, 0x66, 0x9B, 0x20, 0xFC, 0xE7, 0x86,
+	0x66, 0x3B, 0x9B, 0xC9, 0x63, 0x17, 0x77, 0xD4, 0xF5, 0xF9, 0xCE, 0xE6, 0xB6, 0xF1, 0xAB, 0x8B,
+	0x76, 0x28, 0xB1, 0x03, 0xD0, 0x4C, 0x9D, 0x7A, 0xEC, 0x0A, 0x14, 0x07, 0x70, 0x4D, 0xA3, 0x54,
+	0x70, 0x61, 0x68, 0x93, 0xFC, 0x95, 0x93, 0x7A, 0x57, 0xE4, 0x29, 0xD7, 0x68, 0xBC, 0xBB, 0xBE,
+	0x68, 0xA7, 0x4E, 0x7E, 0xA2, 0x86, 0xBD, 0x05, 0x00, 0x4F, 0xE2, 0x25, 0x13, 0x59, 0xF3, 0xD4,
+	0xAE, 0x70, 0xFE, 0xE3, 0x60, 0x82, 0xB6, 0x47, 0xDD, 0xF6, 0x45, 0x67, 0xB8, 0x0A, 0x14, 0x34,
+	0xCF, 0xC9, 0x85, 0x9B, 0x2A, 0xE3, 0xF1, 0x7A, 0xEB, 0x64, 0x2D, 0x72, 0xBC, 0xA7, 0x25, 0xE6,
+	0xF0, 0x23, 0xB5, 0xB5, 0x45, 0xB6, 0xB5, 0xD5, 0x39, 0xFE, 0x02, 0x7F, 0x8B, 0xD4, 0xF4, 0x74,
+	0x24, 0xC6, 0xD8, 0x34, 0x24, 0x3E, 0xC8, 0x10, 0xCD, 0x1F, 0x15, 0x42, 0x20, 0x6A, 0xE2, 0x15,
+	0x1E, 0xE1, 0x6B, 0x09, 0x36, 0x63, 0xF2, 0x4E, 0xAE, 0xAE, 0x02, 0xB7, 0x15, 0x30, 0xCA, 0x5F,
+	0x9B, 0xE3, 0x09, 0x24, 0x95, 0x0E, 0xEA, 0x9A, 0xA0, 0x67, 0x1A, 0xF0, 0xF3, 0xDF, 0x18, 0xD8,
+	0x9D, 0x18, 0x1C, 0x86, 0xD2, 0xB5, 0xAD, 0xCA, 0x37, 0xDE, 0x5F, 0x2D, 0xF6, 0x94, 0xC5, 0xBA,
+	0x6A, 0x73, 0xBF, 0x62, 0x9A, 0x2E, 0xB1, 0xE5, 0xBD, 0xCB, 0x77, 0xF7, 0x02, 0xF8, 0x9B, 0xE4,
+	0x33, 0xEF, 0x28, 0x89, 0xEE, 0x0E, 0xDE, 0x45, 0x8C, 0xCF, 0x7D, 0x61, 0x32, 0xF0, 0xEC, 0x21,
+	0xFD, 0xFB, 0x44, 0x9E, 0xAF, 0xB3, 0x67, 0x16, 0xED, 0x23, 0xB2, 0xF7, 0xA3, 0x46, 0x02, 0xED,
+	0xE3, 0x74, 0x91, 0xBF, 0xB3, 0x57, 0x2E, 0xFD, 0xDB, 0x30, 0xBC, 0xE1, 0x91, 0x40, 0xFE, 0x66,
+	0x45, 0x6B, 0xD7, 0xED, 0xD1, 0xAE, 0x2E, 0x11, 0x4D, 0xFB, 0xE7, 0x70, 0xEE, 0xAA, 0x79, 0xC9,
+	0x36, 0x65, 0xA0, 0xC0, 0xDF, 0xCD, 0x3B, 0x63, 0x78, 0x63, 0x62, 0xA6, 0x38, 0xC0, 0xCD, 0x3B,
+	0x6B, 0xFC, 0xE7, 0x14, 0xBC, 0x5A, 0xB0, 0x64, 0x30, 0xE5, 0xE3, 0x44, 0xA2, 0xAA, 0x7C, 0xE4,
+	0xC0, 0x62, 0x2F, 0x38, 0x35, 0xE9, 0x52, 0x7F, 0xC2, 0xCC, 0x33, 0x46, 0x9E, 0x92, 0x32, 0xC0,
+	0xBB, 0xEB, 0x8B, 0xB8, 0x7F, 0xFB, 0xDD, 0x5C, 0x96, 0x3E, 0xA0, 0x14, 0x3B, 0xFC, 0x6D, 0x00,
+	0x7E, 0x29, 0x80, 0xB7, 0xFE, 0xCD, 0xFB, 0x7B, 0x0D, 0x5E, 0x99, 0xF4, 0xEF, 0x13, 0x48, 0xD3,
+	0xE2, 0xC8, 0xCE, 0x84, 0x8B, 0xEA, 0x3C, 0xDB, 0x6D, 0x0E, 0x54, 0xE4, 0xE3, 0x0F, 0x06, 0xC4,
+	0xB2, 0xC5, 0xE1, 0xBF, 0x3B, 0x14, 0x49, 0x81, 0x63, 0x4E, 0x01, 0x35, 0x0F, 0x2F, 0x2F, 0x2F,
+	0xCE, 0x7B, 0xA3, 0x61, 0xCF, 0x96, 0xA5, 0x28, 0x77, 0x18, 0xC3, 0xFC, 0x7C, 0x91, 0x29, 0x9C,
+	0xCE, 0xD7, 0x39, 0x41, 0xE6, 0xAC, 0xFB, 0xF2, 0x26, 0x88, 0x8A, 0x5C, 0x0B, 0x10, 0x77, 0xC9,
+	0x24, 0x0D, 0x0E, 0xB6, 0xE7, 0xFB, 0x69, 0x82, 0x53, 0x06, 0x4D, 0x4D, 0x7C, 0x4B, 0x79, 0x8A,
+	0x59, 0xDB, 0xA8, 0x1A, 0xE4, 0xAE, 0xCC, 0xA4, 0xA8, 0xA9, 0x5A, 0xA3, 0x70, 0x1B, 0x65, 0xCF,
+	0xF5, 0x2D, 0x36, 0xE0, 0xF8, 0xF9, 0x0F, 0xF7, 0xD7, 0x27, 0x85, 0x47, 0xFB, 0xB2, 0xB9, 0x19,
+	0xC6, 0x97, 0x75, 0xCD, 0x1E, 0x3D, 0xAC, 0x0F, 0xD6, 0x24, 0x7B, 0x19, 0x21, 0x8D, 0x85, 0x98,
+	0x1E, 0x2E, 0xB1, 0x7A, 0x70, 0xE3, 0xC3, 0xC9, 0x5C, 0x57, 0x49, 0xB8, 0x22, 0xFF, 0xC4, 0x15,
+	0x85, 0x52, 0x69, 0x23, 0x2D, 0x27, 0x17, 0x3E, 0xF0, 0x1B, 0x1D, 0xBE, 0x1D, 0x97, 0xBA, 0xC3,
+	0xFD, 0x5A, 0x9C, 0x24, 0x20, 0xEA, 0x58, 0xBE, 0x85, 0xAC, 0xBE, 0x6C, 0x5F, 0xB9, 0x7D, 0xDC,
+	0xE8, 0xF5, 0x56, 0x58, 0xDC, 0xA3, 0xE9, 0x74, 0xBD, 0xD8, 0xE2, 0x19, 0xFE, 0xEC, 0x75, 0xE0,
+	0xA5, 0x00, 0x9D, 0x54, 0x3A, 0x1D, 0xF6, 0x5D, 0x9B, 0x97, 0xAC, 0xCC, 0x37, 0xE0, 0xA5, 0x01,
+	0x61, 0xF7, 0xA6, 0xB1, 0x6D, 0xA2, 0xCF, 0x5B, 0x40, 0xD4, 0x9B, 0x7C, 0xBF, 0x92, 0x0B, 0xD7,
+	0x13, 0xE7, 0xDA, 0xA3, 0xD5, 0x02, 0x53, 0x43, 0x02, 0x63, 0x65, 0xE0, 0xBA, 0xD5, 0x1B, 0x5C,
+	0xF3, 0x76, 0x18, 0x5E, 0xE5, 0x5C, 0xE0, 0xAE, 0x2F, 0x80, 0x4D, 0xE9, 0x06, 0xD8, 0x01, 0x98,
+	0x15, 0x2C, 0xA3, 0x77, 0xD7, 0xD2, 0x4D, 0x1C, 0x78, 0x98, 0xCA, 0x6E, 0x3F, 0x5F, 0xAF, 0xC2,
+	0x21, 0x2E, 0x73, 0x30, 0x11, 0x4E, 0xD6, 0xB7, 0x7E, 0xEB, 0xAA, 0x27, 0x96, 0x37, 0xCB, 0x4B,
+	0x33, 0x19, 0x0C, 0x88, 0x87, 0x44, 0x30, 0x41, 0x1E, 0x89, 0x16, 0x41, 0x39, 0x81, 0x57, 0x59,
+	0xB6, 0xAD, 0x6A, 0x6B, 0x6B, 0x4B, 0x42, 0xAC, 0x20, 0xCF, 0x1A, 0xB6, 0x32, 0x75, 0x79, 0xC2,
+	0x98, 0x36, 0x61, 0xFE, 0x46, 0xF9, 0x6B, 0xFF, 0x17, 0xEC, 0x08, 0x66, 0xF3, 0x47, 0x16, 0xC5,
+	0x07, 0x6C, 0x72, 0x47, 0xCF, 0x1F, 0x1F, 0x6E, 0xE6, 0x1B, 0x22, 0x0C, 0x85, 0x9D, 0x6A, 0x8F,
+	0xC6, 0xE2, 0x78, 0x79, 0xE8, 0x65, 0x96, 0x26, 0x78, 0xE6, 0x2C, 0x4F, 0x25, 0x79, 0xC6, 0x97,
+	0x46, 0x21, 0xEF, 0x90, 0x90, 0x47, 0xD3, 0x49, 0xF7, 0xF6, 0x30, 0xEF, 0x5A, 0x72, 0xA6, 0x45,
+	0x9B, 0x9D, 0xE4, 0x60, 0x2D, 0x69, 0x79, 0x98, 0xB5, 0x9A, 0x6D, 0x50, 0x56, 0x03, 0x6D, 0xF5,
+	0x76, 0x6F, 0xBC, 0x39, 0x2B, 0x00, 0xEA, 0x41, 0x14, 0xBD, 0xD3, 0x1A, 0x46, 0x76, 0x1E, 0xB7,
+	0x46, 0x9B, 0xB2, 0x83, 0x6C, 0xF8, 0x7B, 0x06, 0x4D, 0xBF, 0x80, 0x00, 0x3F, 0xDF, 0xB0, 0xE8,
+	0xE8, 0xE8, 0xDE, 0x0F, 0x70, 0x3F, 0x22, 0x16, 0xD0, 0xFD, 0x71, 0x2E, 0x43, 0x97, 0x15, 0x20,
+	0xD9, 0xD5, 0x05, 0x6D, 0xDE, 0x28, 0x02, 0xEE, 0x44, 0x94, 0x0D, 0x46, 0x6A, 0xFA, 0x15, 0xAC,
+	0x9D, 0x35, 0xB8, 0x3C, 0xC3, 0xDF, 0xBC, 0x78, 0xFD, 0x96, 0x92, 0x15, 0xEC, 0x6A, 0x16, 0x90,
+	0x90, 0x90, 0xE0, 0x0A, 0xD7, 0x7F, 0xFA, 0x22, 0x6B, 0x7E, 0xCA, 0xBE, 0xA6, 0x67, 0xB5, 0xDC,
+	0x8A, 0x3D, 0x9D, 0xBC, 0x5E, 0x00, 0x47, 0x0E, 0x19, 0xE6, 0x2C, 0x9E, 0x36, 0xB8, 0xB9, 0xD4,
+	0x1D, 0x0D, 0x37, 0x9D, 0x8D, 0xC4, 0xA9, 0x26, 0x4E, 0xDC, 0xB4, 0x7A, 0x0B, 0xC3, 0x4F, 0x29,
+	0x60, 0xD7, 0x17, 0x40, 0x2D, 0x61, 0xF4, 0x13, 0x35, 0x54, 0x06, 0xDF, 0x7C, 0x3E, 0x9F, 0x8D,
+	0x32, 0x8C, 0xEC, 0x8B, 0x16, 0x2E, 0x3B, 0x98, 0x97, 0x9D, 0x11, 0x5C, 0x45, 0x25, 0xE4, 0x5C,
+	0x3C, 0xFF, 0x79, 0x2C, 0x8B, 0x7F, 0x1F, 0x06, 0x43, 0x73, 0x8E, 0x4C, 0xC4, 0x90, 0x47, 0xA2,
+	0x06, 0x53, 0xF6, 0xA1, 0x98, 0x53, 0x40, 0x3D, 0x8C, 0xB8, 0x73, 0x48, 0x44, 0xF2, 0x87, 0xBC,
+	0xDB, 0x8F, 0x41, 0xF1, 0x64, 0x90, 0x3A, 0xD6, 0x9D, 0x6E, 0x14, 0x9A, 0xC0, 0x53, 0x41, 0x13,
+	0x3B, 0x43, 0x9C, 0x4D, 0x58, 0xDE, 0x04, 0x51, 0x91, 0x4D, 0x51, 0x14, 0x23, 0xA9, 0xB7, 0x8B,
+	0x9D, 0x1D, 0x33, 0x77, 0x9B, 0xE4, 0x24, 0xBF, 0x94, 0x81, 0xF7, 0x5D, 0x81, 0xBC, 0x83, 0x60,
+	0xA7, 0x9A, 0x8D, 0x51, 0x62, 0xDE, 0x12, 0x3D, 0xAF, 0x65, 0x64, 0x31, 0x07, 0x79, 0x2E, 0xF5,
+	0x84, 0x91, 0xCB, 0x56, 0xE6, 0x46, 0x99, 0x1D, 0x1F, 0xFF, 0x01, 0x9E, 0xFD, 0x70, 0xA5, 0x0D,
+	0xDC, 0x63, 0x8A, 0xDB, 0xA7, 0xF6, 0x97, 0xA7, 0x61, 0x18, 0x06, 0xB9, 0x74, 0xE6, 0x19, 0xA3,
+	0xA7, 0x22, 0xC1, 0xC3, 0x48, 0xE0, 0x4A, 0x26, 0x52, 0x8E, 0x09, 0x95, 0xED, 0x03, 0x23, 0x23,
+	0x23, 0xBD, 0xBB, 0x30, 0x7F, 0x59, 0xD6, 0xEE, 0x7B, 0xE0, 0xDB, 0x27, 0xE5, 0xE6, 0xE7, 0xE7,
+	0xCB, 0x6E, 0x87, 0x64, 0x22, 0x68, 0x43, 0x70, 0x78, 0xE0, 0xD2, 0x1D, 0x6A, 0x4F, 0x3D, 0x7E,
+	0xFE, 0x2A, 0x31, 0x3D, 0xA7, 0xE7, 0xB3, 0x3D, 0x0D, 0x85, 0xF1, 0x9E, 0xFA, 0x4A, 0x62, 0x30,
+	0xFF, 0xA1, 0x29, 0x88, 0x7F, 0xEF, 0x2C, 0x3F, 0x7F, 0x85, 0x68, 0xDA, 0x67, 0x6A, 0x48, 0x28,
+	0xF5, 0x8A, 0x94, 0xC7, 0x5C, 0x29, 0x30, 0x2B, 0x58, 0xDD, 0x42, 0xB6, 0x38, 0x15, 0xB8, 0xEB,
+	0x0B, 0x20, 0xEC, 0x45, 0xBC, 0x98, 0xCB, 0xD4, 0x8F, 0xA6, 0x7D, 0xA4, 0x86, 0xA2, 0xD6, 0x13,
+	0x95, 0xF5, 0x6F, 0x39, 0xD8, 0xFF, 0x38, 0x91, 0x65, 0xCE, 0xB3, 0xCC, 0xCF, 0xF0, 0x87, 0xC5,
+	0x32, 0x37, 0xBE, 0xA5, 0xF5, 0xA4, 0x9C, 0x3D, 0x39, 0xC2, 0xBD, 0x43, 0x1E, 0xA9, 0x33, 0x80,
+	0xB2, 0x59, 0x0C, 0x77, 0x20, 0xBA, 0x31, 0x1D, 0x47, 0x8C, 0x22, 0x07, 0x84, 0xFF, 0x28, 0x4B,
+	0x5C, 0xFC, 0x85, 0xBD, 0xC9, 0xB7, 0xB3, 0xE9, 0xD0, 0x00, 0x42, 0xCC, 0x2D, 0xAB, 0x34, 0x9D,
+	0x63, 0x3C, 0x88, 0x07, 0xF7, 0xCE, 0xC2, 0xD7, 0x32, 0xCA, 0x65, 0xEE, 0xD6, 0x06, 0xFA, 0xE5,
+	0x0D, 0x9E, 0x1F, 0x0E, 0x77, 0x0D, 0x9F, 0x32, 0x4B, 0x78, 0xC7, 0x23, 0xE2, 0x41, 0x94, 0xA5,
+	0xE3, 0x0B, 0xE6, 0xFA, 0xEC, 0xD2, 0xF9, 0xD9, 0x4A, 0x1D, 0x82, 0xD6, 0xBE, 0x62, 0x8B, 0x99,
+	0xDF, 0xFF, 0xBE, 0x9B, 0x67, 0xCB, 0x64, 0xD3, 0xA2, 0xCD, 0x2E, 0xBE, 0xFD, 0x90, 0x15, 0xCC,
+	0x7D, 0x52, 0xAA, 0x7A, 0x7B, 0x27, 0x38, 0xFC, 0x67, 0xC6, 0x28, 0x95, 0x49, 0x5E, 0x26, 0x82,
+	0x3D, 0x8C, 0x22, 0xAE, 0x05, 0x83, 0xDB, 0x57, 0xDB, 0xCB, 0x4B, 0x4B, 0xBD, 0x3B, 0x30, 0x7F,
+	0x54, 0x00, 0x24, 0x20, 0x2C, 0x0C, 0xCD, 0x3D, 0xC9, 0xC7, 0x8C, 0x0E, 0x0D, 0x1F, 0xBF, 0x87,
+	0x04, 0x27, 0x59, 0x0A, 0xB6, 0xFF, 0x2D, 0x53, 0xDB, 0xE6, 0x8F, 0x3F, 0x9E, 0xAD, 0x8E, 0x36,
+	0x25, 0xDB, 0x09, 0xC3, 0xFC, 0xA7, 0xC6, 0x20, 0xFE, 0xC7, 0x7B, 0xFC, 0xFC, 0x01, 0x4F, 0xE2,
+	0xD5, 0x54, 0x4A, 0xC6, 0xEC, 0x7A, 0x71, 0x0C, 0xED, 0xBC, 0x19, 0xDF, 0x70, 0x3A, 0x95, 0xAA,
+	0x89, 0x3C, 0xA5, 0x80, 0x5D, 0x5F, 0xC0, 0xE5, 0x17, 0x97, 0x0F, 0x6A, 0x9D, 0xF3, 0x98, 0x3C,
+	0x0B, 0x6C, 0xEB, 0x25, 0x0D, 0x7E, 0xDD, 0xAC, 0xE6, 0x5E, 0xC9, 0x57, 0x33, 0xAA, 0xEB, 0x7C,
+	0xA7, 0x29, 0x80, 0x7F, 0x29, 0x36, 0x9D, 0x2C, 0x32, 0x47, 0xA8, 0xFE, 0xBF, 0x35, 0x80, 0xB2,
+	0x92, 0x8B, 0x74, 0xBF, 0xC6, 0x89, 0xD4, 0x8B, 0x01, 0x78, 0x0B, 0x2B, 0xBB, 0x18, 0xB6, 0x82,
+	0xD1, 0x3D, 0xB7, 0x4E, 0xD2, 0xD8, 0x7D, 0x37, 0xB2, 0xC9, 0x9B, 0xB8, 0x81, 0x05, 0x2A, 0x64,
+	0x57, 0x08, 0x9F, 0x9A, 0x0A, 0x77, 0x3C, 0x36, 0x95, 0xBB, 0xF3, 0x19, 0xDA, 0x92, 0xF6, 0xE9,
+	0x5D, 0xEB, 0x0F, 0x1F, 0xDF, 0x33, 0x9B, 0x82, 0xF8, 0x6E, 0xC9, 0x31, 0x26, 0xB7, 0x9E, 0x3A,
+	0xFB, 0xFB, 0xDD, 0x7C, 0x7F, 0x53, 0x41, 0x1C, 0x5C, 0x9C, 0x72, 0x61, 0x3D, 0x8F, 0x7D, 0x11,
+	0x35, 0xFB, 0xF3, 0xDC, 0x4B, 0x8C, 0x0B, 0xD8, 0x0F, 0xFB, 0x8D, 0xB6, 0x73, 0x44, 0x7E, 0xEB,
+	0xC4, 0xEE, 0xED, 0x72, 0x6F, 0x31, 0x74, 0xB6, 0x3E, 0x81, 0xB2, 0x74, 0xB3, 0x33, 0x4E, 0xCC,
+	0x0D, 0x73, 0xD0, 0x10, 0xB0, 0x16, 0xA5, 0x41, 0xFA, 0xD8, 0x03, 0xA3, 0xB5, 0x34, 0x27, 0x3B,
+	0xBB, 0xF7, 0x9C, 0x9B, 0x3F, 0xFB, 0x7D, 0x11, 0x11, 0x11, 0xE1, 0xF0, 0xEF, 0x6C, 0x43, 0xC4,
+	0xCF, 0xBF, 0x97, 0xCE, 0x09, 0xF6, 0x30, 0x09, 0x22, 0xD4, 0x53, 0xC6, 0x57, 0xEF, 0x0E, 0x07,
+	0x32, 0x4C, 0x11, 0xFB, 0xEF, 0xFC, 0x39, 0xFE, 0x96, 0x25, 0x1B, 0x1B, 0xC5, 0x55, 0x7B, 0xE3,
+	0x89, 0x1E, 0x2D, 0x17, 0x83, 0x51, 0x94, 0x8F, 0x14, 0x64, 0x81, 0x02, 0x81, 0xAB, 0x7E, 0x83,
+	0xBB, 0x85, 0x0C, 0x7E, 0xA4, 0x86, 0x36, 0x9E, 0x4E, 0x73, 0x2D, 0xB0, 0x2D, 0xE4, 0x52, 0xB6,
+	0xFC, 0xED, 0x96, 0x1A, 0x83, 0x1E, 0x3E, 0xC9, 0xFA, 0x35, 0x6C, 0x5D, 0x52, 0x62, 0x05, 0xAC,
+	0x8D, 0xAB, 0x93, 0xB5, 0x78, 0x0F, 0x0B, 0x65, 0xFF, 0xAD, 0x37, 0x06, 0x50, 0x38, 0xE1, 0xD9,
+	0x00, 0x60, 0x99, 0xDE, 0xDA, 0x0A, 0x6F, 0x61, 0x0D, 0xC8, 0xB3, 0x85, 0x4E, 0x9F, 0x14, 0xF5,
+	0x6D, 0xDA, 0x9F, 0x2F, 0x7C, 0x2A, 0xFA, 0x5B, 0x4A, 0x5D, 0x1D, 0xEE, 0x76, 0xAD, 0x0B, 0xCB,
+	0x4A, 0xE3, 0x55, 0x00, 0x21, 0xF3, 0xC8, 0x8A, 0xCE, 0xBE, 0x8E, 0x92, 0x60, 0x01, 0xD3, 0x07,
+	0x8A, 0x46, 0xAE, 0xC5, 0x0B, 0x1B, 0x57, 0xBD, 0xF1, 0x38, 0x53, 0xE4, 0x0D, 0x33, 0xCD, 0x65,
+	0xEC, 0x55, 0x3B, 0xA7, 0x4D, 0x9E, 0x35, 0x7B, 0x0A, 0x3F, 0xC7, 0x5F, 0xD2, 0xDC, 0x37, 0xB5,
+	0xBA, 0x8F, 0x79, 0x79, 0x36, 0xD7, 0x51, 0x18, 0xE1, 0x00, 0xF5, 0x58, 0x12, 0xB6, 0x61, 0x05,
+	0x1D, 0xF3, 0x17, 0xE7, 0x8C, 0x9E, 0x8A, 0x44, 0x4F, 0xFE, 0x9D, 0x03, 0x5C, 0x1B, 0x8E, 0xB7,
+	0xAB, 0xFD, 0x2D, 0xF5, 0x75, 0x83, 0x7B, 0x3F, 0xC1, 0xFC, 0xA5, 0xC3, 0x06, 0x7E, 0x9B, 0x60,
+	0xD9, 0x82, 0xD2, 0x38, 0x7F, 0x7F, 0x7F, 0x43, 0xA8, 0xFD, 0x1F, 0xFC, 0x48, 0x4F, 0xF4, 0x82,
+	0x65, 0xC8, 0xC7, 0x7F, 0x66, 0x12, 0xE6, 0x6F, 0xE5, 0xE9, 0xE9, 0x69, 0xED, 0x12, 0x94, 0x50,
+	0x44, 0x39, 0x3A, 0x27, 0xFB, 0x8A, 0xBE, 0x8A, 0xBF, 0x7A, 0x32, 0xFD, 0xB2, 0xA5, 0xEB, 0xAE,
+	0xDD, 0xCF, 0xAC, 0x60, 0x65, 0x31, 0x87, 0x8E, 0xEC, 0x38, 0xFE, 0x24, 0x7F, 0x70, 0x8B, 0x9D,
+	0xB9, 0xCC, 0x81, 0x7B, 0xCE, 0x6E, 0xB7, 0xAC, 0x16, 0x36, 0x75, 0xE4, 0xF3, 0xD8, 0xEE, 0x76,
+	0xBD, 0x37, 0xC7, 0xD1, 0x25, 0xCC, 0xEA, 0xFC, 0x33, 0x05, 0xED, 0xDF, 0xAA, 0x93, 0x85, 0x64,
+	0x63, 0x0C, 0x0E, 0xC2, 0xFC, 0x4D, 0xB3, 0x0A, 0xF2, 0xBC, 0x0B, 0x0A, 0x62, 0x39, 0xB6, 0x92,
+	0x90, 0x8D, 0x87, 0x07, 0xFE, 0x99, 0xCC, 0x3E, 0x21, 0x7C, 0x7E, 0x7F, 0xAD, 0xDF, 0x2B, 0x66,
+	0x70, 0x64, 0x2C, 0x2C, 0x2D, 0xF4, 0xD9, 0xC3, 0x71, 0xBF, 0x10, 0x3F, 0x5B, 0x81, 0x73, 0x44,
+	0xA6, 0x69, 0xC3, 0xE7, 0xED, 0x93, 0xFB, 0x2D, 0x9C, 0xB8, 0x23, 0x51, 0x6F, 0xE2, 0x05, 0x3D,
+	0x55, 0xDB, 0xAF, 0xED, 0x66, 0x2C, 0x51, 0xE3, 0x39, 0xFE, 0x16, 0x79, 0x64, 0xFA, 0xDE, 0xA7,
+	0x03, 0x3A, 0x91, 0x10, 0x64, 0x85, 0xBA, 0xB6, 0xBC, 0x65, 0x50, 0x4E, 0xEB, 0xF4, 0xC9, 0xE3,
+	0xD6, 0x68, 0x73, 0x3C, 0xAF, 0x01, 0x28, 0xE4, 0xDB, 0xF9, 0x61, 0x1E, 0x5C, 0x0B, 0x40, 0x3A,
+	0xB8, 0x7B, 0x16, 0xD9, 0xA6, 0xC9, 0x9B, 0x7C, 0xCB, 0xCC, 0x33, 0x63, 0x05, 0xC8, 0x77, 0x77,
+	0x43, 0xF6, 0x1F, 0xB8, 0x15, 0xF5, 0x2A, 0x2B, 0x2A, 0x16, 0xD0, 0x0D, 0xF5, 0x50, 0x42, 0xFC,
+	0x7F, 0xDB, 0x67, 0xF5, 0x4E, 0x2C, 0xFE, 0x2B, 0x0B, 0x65, 0xF0, 0x3A, 0x15, 0x64, 0x32, 0x39,
+	0x5A, 0x4E, 0x5C, 0xC5, 0x2A, 0x65, 0xE2, 0x0F, 0x38, 0x56, 0xE5, 0x25, 0xFE, 0xE2, 0x81, 0x5D,
+	0x8F, 0xFD, 0x53, 0xDB, 0xE5, 0xB6, 0xCA, 0x71, 0x23, 0xC7, 0xF5, 0x6B, 0x28, 0xE3, 0xE7, 0x29,
+	0xFE, 0x86, 0xD9, 0xF3, 0x07, 0x35, 0x8B, 0x5B, 0x5C, 0x5B, 0xAF, 0x2A, 0x86, 0x90, 0x4F, 0x36,
+	0xAA, 0xFA, 0x1F, 0xA7, 0x51, 0xF9, 0xAD, 0x66, 0xE9, 0x23, 0x1F, 0x19, 0xA5, 0xAE, 0x82, 0xF6,
+	0xCC, 0x51, 0xF0, 0x85, 0x72, 0xB1, 0x40, 0x05, 0x41, 0x65, 0x2B, 0x6A, 0x68, 0x6C, 0xAC, 0xC4,
+	0xBF, 0x22, 0xC4, 0xB3, 0xB3, 0x82, 0x76, 0x09, 0x01, 0x6A, 0xBF, 0xE6, 0x16, 0x14, 0x91, 0x10,
+	0xEC, 0x05, 0x52, 0x8B, 0xE8, 0x38, 0x1B, 0xCF, 0xAC, 0xDD, 0x5A, 0x2A, 0x73, 0x85, 0x3F, 0xA0,
+	0x95, 0x32, 0x71, 0x4C, 0xF6, 0x7D, 0x63, 0x59, 0xB4, 0xB2, 0xCD, 0xBD, 0xC9, 0x0C, 0x2F, 0x7F,
+	0xAB, 0xF2, 0xBD, 0x0F, 0x9B, 0x43, 0x75, 0xA9, 0xDE, 0xC6, 0x3C, 0x96, 0x9E, 0x8C, 0xA9, 0x5F,
+	0x66, 0xF3, 0xF8, 0xFE, 0x77, 0xFE, 0xF1, 0xBF, 0x90, 0x6F, 0xE7, 0xE3, 0x4A, 0xA1, 0xAD, 0xBA,
+	0xAE, 0x47, 0x41, 0x6F, 0x1F, 0xC2, 0xDF, 0xA6, 0x74, 0xFD, 0x92, 0x1C, 0xAA, 0x2B, 0xAF, 0xE1,
+	0x55, 0xB3, 0xBB, 0x53, 0x69, 0x07, 0x1F, 0x5C, 0xBB, 0xA7, 0xC6, 0x9B, 0x2B, 0x2A, 0x18, 0x87,
+	0xB7, 0x54, 0x06, 0x41, 0x4D, 0x97, 0x51, 0xDE, 0xCA, 0x7D, 0x47, 0xA0, 0x9A, 0x8A, 0x49, 0x64,
+	0x27, 0x7D, 0x1B, 0xE2, 0x2F, 0x15, 0xDA, 0x7B, 0x3F, 0x97, 0x6D, 0xAD, 0xAC, 0xA0, 0x17, 0x3B,
+	0xF2, 0x73, 0xE8, 0x95, 0xFC, 0x01, 0xC7, 0xEA, 0x83, 0x89, 0xB5, 0xA9, 0x54, 0x2D, 0x21, 0x2F,
+	0xD2, 0x55, 0xEF, 0x19, 0x8D, 0xB3, 0xC5, 0xE5, 0x53, 0xFC, 0xDF, 0x86, 0x52, 0x3F, 0xF6, 0x9C,
+	0x8C, 0x27, 0xA1, 0x17, 0x32, 0x70, 0x29, 0x63, 0xDE, 0x50, 0x22, 0x8B, 0x17, 0x51, 0x3D, 0x80,
+	0x56, 0x34, 0xAB, 0xF3, 0x67, 0x07, 0x48, 0xF3, 0xD6, 0xB8, 0x37, 0xEC, 0x54, 0x4C, 0x96, 0xFE,
+	0xAE, 0xE9, 0x25, 0x95, 0x7F, 0xD4, 0xFC, 0xAD, 0x7D, 0x0D, 0x73, 0xA3, 0x1A, 0x17, 0xD3, 0x73,
+	0x3B, 0x8A, 0xB8, 0x80, 0xCC, 0x0A, 0x6A, 0x6A, 0x0A, 0x2C, 0x00, 0xA5, 0xE8, 0x9A, 0x9A, 0x1A,
+	0xEF, 0xE7, 0xF9, 0x33, 0xA9, 0xE5, 0xF1, 0xEE, 0xBA, 0x62, 0x02, 0xE6, 0xDD, 0x0C, 0xBD, 0x52,
+	0xEA, 0x86, 0x05, 0xF8, 0x7F, 0x9C, 0x6B, 0xF7, 0xEF, 0x06, 0x0A, 0x53, 0xB3, 0xEA, 0x26, 0x7B,
+	0x47, 0x67, 0x20, 0x8F, 0x3B, 0xA0, 0x1C, 0x4D, 0xBD, 0x5D, 0x6D, 0x4E, 0x8B, 0x49, 0xAE, 0x99,
+	0xFD, 0x30, 0x94, 0xA4, 0x05, 0x87, 0x29, 0x50, 0xAE, 0xF6, 0xBB, 0x73, 0x63, 0x63, 0xB3, 0xC9,
+	0xEB, 0x4C, 0x28, 0x23, 0x13, 0x50, 0x4D, 0x18, 0xFB, 0xC1, 0xA8, 0x4C, 0x4E, 0xCA, 0x6D, 0x1B,
+	0xE9, 0x42, 0xEC, 0x3F, 0x97, 0x9A, 0xED, 0xCB, 0xBE, 0x82, 0x84, 0xD8, 0xF4, 0xE6, 0xCD, 0x0B,
+	0x32, 0xB4, 0x1D, 0xE1, 0x8B, 0xFC, 0xF5, 0xB3, 0x17, 0x3A, 0x27, 0xBA, 0x83, 0x24, 0x01, 0xCB,
+	0xE2, 0xF5, 0x9E, 0x0D, 0x92, 0x27, 0xF0, 0x12, 0x7F, 0xC0, 0xA9, 0x7A, 0xAF, 0x6F, 0xA5, 0xD5,
+	0x47, 0x14, 0xDD, 0xFA, 0x0F, 0x7F, 0x9E, 0xCD, 0xB5, 0x0A, 0x22, 0x9F, 0x22, 0x3D, 0x80, 0xB4,
+	0x5F, 0xC3, 0xE2, 0x62, 0x37, 0x1C, 0x21, 0xED, 0x23, 0xFA, 0x57, 0x9F, 0xCD, 0xD3, 0x0E, 0x2E,
+	0xEF, 0x8E, 0x54, 0xB5, 0xCE, 0xEB, 0xCF, 0xF3, 0x84, 0x4D, 0x0C, 0x69, 0x1B, 0x7B, 0x7B, 0x1B,
+	0x69, 0x00, 0x30, 0xB6, 0xB7, 0xB7, 0xD7, 0x7C, 0x96, 0x7F, 0x59, 0x61, 0x84, 0xC3, 0x53, 0xED,
+	0x90, 0x88, 0x8E, 0x7B, 0x42, 0x55, 0x12, 0x1F, 0x7F, 0x9D, 0xA4, 0x81, 0xCB, 0xBB, 0x95, 0x59,
+	0xC6, 0xFE, 0x56, 0xF7, 0xD9, 0x12, 0x01, 0x76, 0x73, 0x58, 0xE7, 0x8C, 0x5C, 0x1D, 0xCC, 0x8C,
+	0x4E, 0x6E, 0xDF, 0xD2, 0x91, 0xE8, 0x7B, 0xC0, 0x32, 0x6B, 0xF0, 0xF4, 0x6A, 0x71, 0x6C, 0x6C,
+	0xE1, 0x6C, 0x8B, 0x1C, 0x05, 0xDD, 0x88, 0xB0, 0x47, 0xFD, 0xE6, 0xF7, 0x8D, 0xA9, 0xA9, 0xA5,
+	0xF3, 0xD1, 0x15, 0x84, 0xBF, 0x46, 0x4C, 0xE7, 0xDE, 0xED, 0xF2, 0xC4, 0xD8, 0xEC, 0xE1, 0xD5,
+	0x48, 0xD6, 0x2B, 0xED, 0x3F, 0x40, 0x2E, 0x72, 0x80, 0x3A, 0x54, 0xED, 0xC8, 0x7A, 0xA5, 0x46,
+	0x16, 0x4A, 0x2C, 0x5F, 0xE6, 0xAF, 0x93, 0x36, 0x35, 0x35, 0x5D, 0x84, 0xEA, 0xD7, 0x15, 0x83,
+	0x5B, 0x4F, 0x0E, 0x9A, 0x7C, 0xA5, 0x8C, 0xD3, 0xC7, 0xBF, 0xC3, 0x3D, 0x80, 0x52, 0x02, 0x7D,
+	0x7A, 0x14, 0x0E, 0x90, 0xE6, 0x6C, 0xFC, 0xFE, 0x4F, 0x94, 0xBA, 0xA0, 0xA0, 0xC3, 0xD7, 0xEB,
+	0x9D, 0x7B, 0x8C, 0x05, 0x20, 0xE5, 0x93, 0x60, 0xF7, 0x72, 0x7B, 0xC4, 0xCB, 0x5F, 0xC1, 0xD9,
+	0x52, 0xE1, 0xB9, 0xCF, 0x6B, 0x38, 0xD9, 0xF0, 0x8F, 0x00, 0x6C, 0x33, 0xBA, 0x16, 0xF7, 0x8F,
+	0xB6, 0x27, 0xEA, 0x9B, 0x99, 0x4C, 0x64, 0x28, 0xF5, 0xC6, 0x39, 0xAB, 0x73, 0x61, 0xF7, 0x68,
+	0x7F, 0x91, 0x92, 0x8B, 0x44, 0xDF, 0x03, 0x22, 0xF6, 0x69, 0xE4, 0x99, 0xED, 0xA3, 0xC3, 0x8D,
+	0xB1, 0xFA, 0x28, 0xA4, 0x77, 0xD6, 0x8C, 0x6C, 0x9E, 0xD9, 0x39, 0xDE, 0x67, 0x52, 0xCB, 0x51,
+	0xC1, 0xDE, 0x26, 0x71, 0x8D, 0x13, 0x1B, 0x87, 0x47, 0x3B, 0xF3, 0x9D, 0xD9, 0xCE, 0xA2, 0x30,
+	0x7F, 0x28, 0x3E, 0xD9, 0xBE, 0x86, 0xC9, 0x84, 0xF8, 0x33, 0x99, 0x28, 0xFE, 0x00, 0xBE, 0x79,
+	0xA4, 0x37, 0x53, 0x0F, 0xB4, 0xA6, 0xC9, 0x33, 0x13, 0xC9, 0xEA, 0xA8, 0xA7, 0x14, 0xB0, 0xEB,
+	0x0B, 0xAB, 0x4D, 0x0B, 0xE8, 0x60, 0x72, 0x6D, 0xAE, 0xE8, 0x54, 0xC6, 0x64, 0xD2, 0x92, 0x74,
+	0x01, 0x11, 0xF7, 0x6A, 0x26, 0x93, 0xCA, 0xCE, 0x70, 0x00, 0xF9, 0x23, 0x51, 0xE0, 0xFF, 0x0A,
+	0xFE, 0xAA, 0x31, 0x82, 0x82, 0x8E, 0x7F, 0xC5, 0x32, 0x00, 0x19, 0xCA, 0xBC, 0x66, 0xA6, 0x1A,
+	0x29, 0x99, 0xBF, 0x47, 0xC2, 0x16, 0x61, 0x39, 0x95, 0xD5, 0xA5, 0x29, 0x9E, 0xE9, 0xD0, 0x3E,
+	0x2A, 0x6C, 0x27, 0x86, 0x45, 0x48, 0x76, 0x79, 0x75, 0x45, 0x4E, 0xB8, 0x35, 0xBA, 0xC4, 0x8C,
+	0x03, 0xC0, 0xA8, 0xD8, 0xA2, 0x24, 0x0F, 0x54, 0x33, 0xA4, 0xE3, 0x97, 0x51, 0x56, 0x53, 0x91,
+	0x1B, 0x99, 0x8A, 0x0E, 0xF6, 0xD6, 0xF1, 0x4A, 0x2E, 0xAA, 0xAA, 0x2E, 0xCB, 0x0C, 0xB1, 0x10,
+	0x43, 0x92, 0xB1, 0xA0, 0xF8, 0x64, 0x70, 0xEF, 0x16, 0xD6, 0x07, 0xC1, 0x70, 0xF2, 0x24, 0x94,
+	0x17, 0xC5, 0x3C, 0x9D, 0x40, 0x08, 0x06, 0x5F, 0x36, 0xEB, 0x4C, 0x02, 0xC1, 0x9F, 0xF3, 0xB5,
+	0x02, 0x77, 0x7D, 0x61, 0x5B, 0x24, 0x59, 0xDC, 0x71, 0x73, 0x60, 0x0C, 0x39, 0x2B, 0xBC, 0x5C,
+	0x0D, 0x8C, 0xA8, 0x63, 0xF3, 0x97, 0x0B, 0x45, 0xE3, 0xF0, 0x16, 0xF9, 0xA7, 0xF3, 0xD7, 0xCA,
+	0x58, 0xE0, 0x4F, 0x3A, 0xF8, 0xE7, 0x08, 0x29, 0x99, 0xBF, 0x33, 0xA6, 0xD1, 0xD0, 0xC6, 0xCE,
+	0x52, 0x4B, 0x54, 0x07, 0xDE, 0x47, 0x05, 0x32, 0xAF, 0xC0, 0xCD, 0x7B, 0x0C, 0xE5, 0x79, 0xA3,
+	0x62, 0x2D, 0xC0, 0x7D, 0x7A, 0xB8, 0x46, 0xA1, 0x92, 0xBA, 0x56, 0xF6, 0x36, 0x46, 0x8A, 0xDA,
+	0x5C, 0xC1, 0xDE, 0x62, 0x1A, 0xE0, 0x86, 0x40, 0x7A, 0xA8, 0x51, 0xB2, 0x36, 0x7A, 0xEF, 0x16,
+	0x38, 0x54, 0x1B, 0x3D, 0x00, 0x06, 0xD7, 0x62, 0x66, 0x55, 0x66, 0x31, 0x5D, 0x3D, 0x3D, 0x45,
+	0x9E, 0xA0, 0x71, 0xBE, 0x5D, 0x5F, 0x58, 0xAD, 0x94, 0xAE, 0xAE, 0xAE, 0x2C, 0x4F, 0x0C, 0x39,
+	0x3B, 0xBC, 0x1C, 0xDC, 0xE7, 0x05, 0x6A, 0x41, 0x54, 0xD0, 0xCD, 0xB1, 0x3C, 0xF0, 0xAF, 0xE0,
+	0x8F, 0x24, 0xE4, 0x2C, 0x2F, 0xFF, 0x53, 0xF9, 0x23, 0x25, 0x83, 0xE9, 0xAF, 0x23, 0xB5, 0x58,
+	0x64, 0xBD, 0x94, 0x9C, 0x9C, 0x9C, 0x2C, 0x2B, 0xAC, 0x44, 0xFE, 0xCD, 0xA4, 0x09, 0x25, 0xE3,
+	0xB2, 0xD7, 0x6E, 0x10, 0xC3, 0x0A, 0x04, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09,
+	0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2,
+	0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30,
+	0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C,
+	0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13,
+	0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84,
+	0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61,
+	0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98,
+	0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26,
+	0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09,
+	0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2,
+	0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30,
+	0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C,
+	0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13,
+	0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84,
+	0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61,
+	0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98,
+	0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26,
+	0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09,
+	0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2, 0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xC2,
+	0x84, 0x09, 0x13, 0x26, 0x4C, 0x98, 0x30, 0x61, 0xFA, 0xA7, 0xE9, 0x3F, 0xFE, 0xE3, 0x3F, 0xB0,
+	0x42, 0xC0, 0xF8, 0x63, 0xFA, 0xF7, 0xE5, 0xFF, 0xFF, 0x03,
+};
+
+static const BakedFont::Glyph sg_FontAtlasSdf32Glyphs[] =
+{
+	{ 32, 0, 0, 6, 196.f, 0.f, 6.f, 32.f },
+	{ 33, -2, 1, 7, 242.f, 30.f, 12.f, 29.f },
+	{ 34, -3, 0, 8, 20.f, 89.f, 15.f, 16.f },
+	{ 35, -3, 1, 16, 265.f, 58.f, 24.f, 28.f },
+	{ 36, -3, -2, 15, 125.f, 0.f, 21.f, 34.f },
+	{ 37, -3, 1, 20, 283.f, 0.f, 26.f, 29.f },
+	{ 38, -3, 1, 16, 334.f, 0.f, 24.f, 29.f },
+	{ 39, -3, 0, 4, 100.f, 87.f, 11.f, 15.f },
+	{ 40, -3, -1, 9, 0.f, 0.f, 16.f, 37.f },
+	{ 41, -4, -1, 9, 16.f, 0.f, 16.f, 37.f },
+	{ 42, -4, 1, 11, 145.f, 88.f, 20.f, 20.f },
+	{ 43, -3, 4, 15, 0.f, 65.f, 22.f, 24.f },
+	{ 44, -4, 18, 5, 71.f, 90.f, 13.f, 15.f },
+	{ 45, -4, 11, 7, 50.f, 91.f, 16.f, 11.f },
+	{ 46, -3, 18, 7, 84.f, 90.f, 12.f, 12.f },
+	{ 47, -4, 1, 11, 245.f, 0.f, 19.f, 30.f },
+	{ 48, -3, 1, 15, 283.f, 29.f, 21.f, 29.f },
+	{ 49, -2, 1, 15, 174.f, 60.f, 16.f, 28.f },
+	{ 50, -3, 1, 15, 192.f, 59.f, 22.f, 28.f },
+	{ 51, -3, 1, 15, 304.f, 29.f, 21.f, 29.f },
+	{ 52, -4, 1, 15, 385.f, 58.f, 23.f, 28.f },
+	{ 53, -2, 1, 15, 325.f, 29.f, 21.f, 29.f },
+	{ 54, -3, 1, 15, 452.f, 0.f, 22.f, 29.f },
+	{ 55, -3, 1, 15, 214.f, 59.f, 22.f, 28.f },
+	{ 56, -3, 1, 15, 346.f, 29.f, 21.f, 29.f },
+	{ 57, -3, 1, 15, 367.f, 29.f, 21.f, 29.f },
+	{ 58, -3, 6, 6, 100.f, 63.f, 12.f, 24.f },
+	{ 59, -4, 6, 5, 87.f, 63.f, 13.f, 27.f },
+	{ 60, -4, 6, 13, 227.f, 87.f, 20.f, 21.f },
+	{ 61, -2, 8, 14, 0.f, 89.f, 20.f, 16.f },
+	{ 62, -3, 6, 14, 206.f, 87.f, 21.f, 21.f },
+	{ 63, -3, 1, 12, 223.f, 30.f, 19.f, 29.f },
+	{ 64, -3, 1, 24, 60.f, 0.f, 31.f, 35.f },
+	{ 65, -4, 1, 17, 60.f, 35.f, 26.f, 28.f },
+	{ 66, -2, 1, 17, 236.f, 59.f, 22.f, 28.f },
+	{ 67, -3, 1, 17, 358.f, 0.f, 24.f, 29.f },
+	{ 68, -2, 1, 17, 408.f, 58.f, 23.f, 28.f },
+	{ 69, -2, 1, 15, 153.f, 60.f, 21.f, 28.f },
+	{ 70, -2, 1, 15, 112.f, 62.f, 21.f, 28.f },
+	{ 71, -3, 1, 18, 382.f, 0.f, 24.f, 29.f },
+	{ 72, -2, 1, 19, 289.f, 58.f, 24.f, 28.f },
+	{ 73, -2, 1, 7, 500.f, 58.f, 12.f, 28.f },
+	{ 74, -4, 1, 15, 388.f, 29.f, 21.f, 29.f },
+	{ 75, -2, 1, 17, 313.f, 58.f, 24.f, 28.f },
+	{ 76, -2, 1, 14, 50.f, 63.f, 21.f, 28.f },
+	{ 77, -2, 1, 23, 125.f, 34.f, 28.f, 28.f },
+	{ 78, -2, 1, 19, 337.f, 58.f, 24.f, 28.f },
+	{ 79, -3, 1, 18, 309.f, 0.f, 25.f, 29.f },
+	{ 80, -2, 1, 17, 431.f, 58.f, 23.f, 28.f },
+	{ 81, -3, 1, 18, 160.f, 0.f, 25.f, 32.f },
+	{ 82, -2, 1, 16, 454.f, 58.f, 23.f, 28.f },
+	{ 83, -3, 1, 16, 406.f, 0.f, 23.f, 29.f },
+	{ 84, -4, 1, 16, 361.f, 58.f, 24.f, 28.f },
+	{ 85, -3, 1, 17, 429.f, 0.f, 23.f, 29.f },
+	{ 86, -4, 1, 17, 86.f, 35.f, 26.f, 28.f },
+	{ 87, -4, 1, 24, 160.f, 32.f, 32.f, 28.f },
+	{ 88, -4, 1, 17, 0.f, 37.f, 25.f, 28.f },
+	{ 89, -4, 1, 16, 25.f, 37.f, 25.f, 28.f },
+	{ 90, -3, 1, 16, 477.f, 58.f, 23.f, 28.f },
+	{ 91, -3, -2, 7, 32.f, 0.f, 14.f, 36.f },
+	{ 92, -4, 1, 11, 264.f, 0.f, 19.f, 30.f },
+	{ 93, -4, -2, 7, 46.f, 0.f, 14.f, 36.f },
+	{ 94, -4, 1, 11, 165.f, 88.f, 19.f, 19.f },
+	{ 95, -4, 21, 12, 84.f, 102.f, 21.f, 11.f },
+	{ 96, -4, 0, 8, 35.f, 91.f, 15.f, 13.f },
+	{ 97, -3, 6, 14, 258.f, 86.f, 21.f, 24.f },
+	{ 98, -3, 0, 15, 202.f, 0.f, 22.f, 30.f },
+	{ 99, -3, 6, 14, 279.f, 86.f, 21.f, 24.f },
+	{ 100, -3, 0, 15, 224.f, 0.f, 21.f, 30.f },
+	{ 101, -3, 6, 14, 300.f, 86.f, 21.f, 24.f },
+	{ 102, -4, 0, 9, 493.f, 29.f, 18.f, 29.f },
+	{ 103, -3, 6, 15, 409.f, 29.f, 21.f, 29.f },
+	{ 104, -3, 0, 15, 430.f, 29.f, 21.f, 29.f },
+	{ 105, -3, 1, 6, 133.f, 62.f, 12.f, 28.f },
+	{ 106, -5, 1, 6, 146.f, 0.f, 14.f, 34.f },
+	{ 107, -3, 0, 13, 451.f, 29.f, 21.f, 29.f },
+	{ 108, -2, 0, 6, 254.f, 30.f, 11.f, 29.f },
+	{ 109, -3, 6, 23, 362.f, 86.f, 30.f, 23.f },
+	{ 110, -3, 6, 15, 420.f, 86.f, 21.f, 23.f },
+	{ 111, -3, 6, 15, 22.f, 65.f, 22.f, 24.f },
+	{ 112, -3, 6, 15, 474.f, 0.f, 22.f, 29.f },
+	{ 113, -3, 6, 15, 472.f, 29.f, 21.f, 29.f },
+	{ 114, -3, 6, 9, 190.f, 87.f, 16.f, 23.f },
+	{ 115, -3, 6, 14, 342.f, 86.f, 20.f, 24.f },
+	{ 116, -4, 3, 8, 71.f, 63.f, 16.f, 27.f },
+	{ 117, -3, 6, 15, 321.f, 86.f, 21.f, 24.f },
+	{ 118, -4, 6, 13, 441.f, 86.f, 21.f, 23.f },
+	{ 119, -4, 6, 20, 392.f, 86.f, 28.f, 23.f },
+	{ 120, -4, 6, 13, 462.f, 86.f, 21.f, 23.f },
+	{ 121, -4, 6, 12, 202.f, 30.f, 21.f, 29.f },
+	{ 122, -3, 6, 13, 483.f, 86.f, 20.f, 23.f },
+	{ 123, -4, -1, 9, 91.f, 0.f, 17.f, 35.f },
+	{ 124, -2, 1, 6, 185.f, 0.f, 11.f, 32.f },
+	{ 125, -4, -1, 9, 108.f, 0.f, 17.f, 35.f },
+	{ 126, -3, 10, 18, 111.f, 90.f, 24.f, 14.f },
+};
+
+static const BakedFont::Atlas sg_FontAtlasSdf32 = { 32, 95, 0, 512, 256, true, sg_FontAtlasSdf32Glyphs, sg_FontAtlasSdf32Alpha, sizeof(sg_FontAtlasSdf32Alpha) };
+
+#endif // FONT_ATLAS_H
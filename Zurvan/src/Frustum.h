@@ -0,0 +1,104 @@
+#pragma once
+#include <array>
+#include <cmath>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include "raylib.h"
+
+// Bounding spheres as separate arrays so the culling loop vectorizes
+struct SphereBatch
+{
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+    std::vector<float> radius;
+
+    void Resize(std::size_t count)
+    {
+        x.resize(count);
+        y.resize(count);
+        z.resize(count);
+        radius.resize(count);
+    }
+
+    void Set(std::size_t i, Vector3 center, float r) noexcept
+    {
+        x[i] = center.x;
+        y[i] = center.y;
+        z[i] = center.z;
+        radius[i] = r;
+    }
+
+    std::size_t Size() const noexcept
+    {
+        return x.size();
+    }
+};
+
+
+// The six clip planes of a view-projection matrix, normals point inwards
+class Frustum
+{
+private:
+    struct Plane
+    {
+        float a, b, c, d;
+    };
+private:
+    std::array<Plane, 6> m_Planes{};
+    std::size_t m_Count = 0;
+private:
+    // A plane at infinity (far plane of an infinite projection) has no normal and culls nothing, it's skipped
+    void Add(float a, float b, float c, float d) noexcept
+    {
+        const float length = std::sqrt(a * a + b * b + c * c);
+        if (!(length > 0.f)) return;
+
+        const float invLength = 1.f / length;
+        m_Planes[m_Count++] = { a * invLength, b * invLength, c * invLength, d * invLength };
+    }
+public:
+    // Gribb/Hartmann extraction, m is laid out like raylib's MatrixMultiply(view, projection)
+    explicit Frustum(const Matrix& m) noexcept
+    {
+        Add(m.m3 + m.m0, m.m7 + m.m4, m.m11 + m.m8, m.m15 + m.m12);  // left
+        Add(m.m3 - m.m0, m.m7 - m.m4, m.m11 - m.m8, m.m15 - m.m12);  // right
+        Add(m.m3 + m.m1, m.m7 + m.m5, m.m11 + m.m9, m.m15 + m.m13);  // bottom
+        Add(m.m3 - m.m1, m.m7 - m.m5, m.m11 - m.m9, m.m15 - m.m13);  // top
+        Add(m.m3 + m.m2, m.m7 + m.m6, m.m11 + m.m10, m.m15 + m.m14); // near
+        Add(m.m3 - m.m2, m.m7 - m.m6, m.m11 - m.m10, m.m15 - m.m14); // far
+    }
+
+    bool TestSphere(Vector3 center, float radius) const noexcept
+    {
+        for (std::size_t i = 0; i < m_Count; ++i)
+        {
+            const Plane& p = m_Planes[i];
+            if (p.a * center.x + p.b * center.y + p.c * center.z + p.d < -radius)
+                return false;
+        }
+        return true;
+    }
+
+    // Writes 1 for every sphere that intersects the frustum and 0 otherwise. The loop runs plane by plane
+    // over all spheres without branches so the compiler can vectorize it.
+    void TestSpheres(const SphereBatch& spheres, std::vector<uint8_t>* visible) const
+    {
+        const std::size_t count = spheres.Size();
+        visible->assign(count, 1);
+        uint8_t* out = visible->data();
+        const float* x = spheres.x.data();
+        const float* y = spheres.y.data();
+        const float* z = spheres.z.data();
+        const float* r = spheres.radius.data();
+
+        for (std::size_t plane = 0; plane < m_Count; ++plane)
+        {
+            const Plane& p = m_Planes[plane];
+            for (std::size_t i = 0; i < count; ++i)
+                out[i] &= static_cast<uint8_t>(p.a * x[i] + p.b * y[i] + p.c * z[i] + p.d >= -r[i]);
+        }
+    }
+};
@@ -1,6 +1,8 @@
 #pragma once
 #include <array>
+#include <cstdio>
 #include <cstddef>
+#include <algorithm>
 
 // needed because otherwise raygui will define them internally
 #define RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT 24
@@ -9,12 +11,15 @@
 #include "raygui.h"
 
 #include "Renderer.h"
+#include "PerformanceStats.h"
+#include "TrajectoryPlayer.h"
 
 class FloatingWindow
 {
 private:
     static constexpr int StatusBarHeight = RAYGUI_WINDOWBOX_STATUSBAR_HEIGHT;
     static constexpr int CloseButtonSize = RAYGUI_WINDOWBOX_CLOSEBUTTON_HEIGHT;
+    static inline int s_VisibleWindows = 0;
 private:
     Vector2 m_MinSize;
     Rectangle m_Bounds;
@@ -154,13 +159,12 @@ public:
             GuiSetStyle(prop.controlId, prop.propertyId, prop.propertyValue);
         }
 
-        GuiSetStyle(DEFAULT, TEXT_SIZE, 20);
+        GuiSetStyle(DEFAULT, TEXT_SIZE, Renderer::FontSizeUI);
         GuiSetFont(Renderer::GetFontUI());
 
         // Setup a white rectangle on the font to be used on shapes drawing,
         // it makes possible to draw shapes and text (full UI) in a single draw call
-        Rectangle fontWhiteRec = { 510, 254, 1, 1 };
-        SetShapesTexture(Renderer::GetFontUI().texture, fontWhiteRec);
+        SetShapesTexture(Renderer::GetFontUI().texture, Renderer::GetWhiteRec());
     }
 
     ~FloatingWindow() noexcept = default;
@@ -177,12 +181,19 @@ public:
 
     void ToggleCursor() const noexcept
     {
-        if (Visible())
+        // The cursor has to stay enabled as long as any window is open
+        s_VisibleWindows += Visible() ? 1 : -1;
+        if (s_VisibleWindows > 0)
             EnableCursor();
         else
             DisableCursor();
     }
 
+    static bool AnyVisible() noexcept
+    {
+        return s_VisibleWindows > 0;
+    }
+
     void Show() noexcept
     {
         if (IsKeyPressed(m_ActivationKey))
@@ -205,6 +216,11 @@ public:
     {
         return m_Visible;
     }
+
+    const Rectangle& Bounds() const noexcept
+    {
+        return m_Bounds;
+    }
 };
 
 
@@ -222,6 +238,23 @@ private:
 
     int m_SimulationRate = 10000;
     bool m_SimulationRateEditMode = false;
+
+    bool m_ShowAsteroidBelt = false; // 50k particles, off by default
+private:
+    void DrawReplayControls(Trajectory::Player* player) noexcept
+    {
+        if (player == nullptr || !player->IsOpen()) return;
+
+        float playhead = static_cast<float>(player->Playhead());
+        const float lastFrame = static_cast<float>(player->FrameCount() - 1);
+        GuiSliderBar(ToWindowSpace(10, 130, 220, 20), NULL, NULL, &playhead, 0.f, lastFrame);
+        if (playhead != static_cast<float>(player->Playhead()))
+            player->Seek(playhead);
+
+        char text[64];
+        std::snprintf(text, sizeof(text), "Replay frame %.0f / %.0f (%.0f fps)", playhead, lastFrame, player->Speed());
+        GuiLabel(ToWindowSpace(235, 130, 260, 20), text);
+    }
 public:
     SettingsWindow() : FloatingWindow(20, 20, 500, 500, "Settings", KEY_F1, 500, 200) {}
 
@@ -245,8 +278,14 @@ public:
         return m_SelectedSimulationMode;
     }
 
-    void Draw() noexcept
+    bool ShowAsteroidBelt() const noexcept
     {
+        return m_ShowAsteroidBelt;
+    }
+
+    void Draw(Trajectory::Player* player = nullptr) noexcept
+    {
+        PROFILE_SCOPE("SettingsWindow::Draw");
         FloatingWindow::Show();
         if (!Visible()) return;
 
@@ -310,8 +349,140 @@ public:
         }
         GuiDisableTooltip();
 
+        GuiCheckBox(ToWindowSpace(10, 155, 20, 20), "Asteroid belt", &m_ShowAsteroidBelt);
+
+        DrawReplayControls(player);
+
         GuiUnlock();
         if (GuiDropdownBox(ToWindowSpace(10, 30, 220, 20), "Euler integration;Velocity Verlet algorithm;Runge-Kutta 4th", &m_SelectedSimulationMode, (int)m_SimulationModeDropdownEditMode))
             m_SimulationModeDropdownEditMode = !m_SimulationModeDropdownEditMode;
     }
+};
+
+
+class PerformanceWindow : public FloatingWindow
+{
+private:
+    static constexpr int HistogramBins = 32;
+    static constexpr int GraphHeight = 90;
+    static constexpr int HistogramHeight = 70;
+    static constexpr std::array<const char*, PerformanceStats::PhaseCount> PhaseNames = { "Physics", "Render", "GUI", "Present" };
+    static constexpr std::array<Color, PerformanceStats::PhaseCount> PhaseColors = { ORANGE, SKYBLUE, LIME, VIOLET };
+private:
+    std::array<int, HistogramBins> m_Histogram{};
+private:
+    void DrawFrameGraph(const PerformanceStats& stats, Rectangle area, double scale) const noexcept
+    {
+        const auto& frameTimes = stats.FrameTimes();
+        const float barWidth = area.width / static_cast<float>(frameTimes.Capacity());
+
+        DrawRectangleRec(area, Fade(BLACK, 0.4f));
+        for (std::size_t i = 0; i < frameTimes.Size(); ++i)
+        {
+            const float height = static_cast<float>(frameTimes[i] / scale) * area.height;
+            const Color color = frameTimes[i] > 33.3 ? RED : (frameTimes[i] > 16.7 ? YELLOW : GREEN);
+            DrawRectangleRec({ area.x + static_cast<float>(i) * barWidth, area.y + area.height - height, barWidth, height }, color);
+        }
+
+        // 60 and 30 FPS reference lines
+        for (const double budget : { 16.7, 33.3 })
+        {
+            const float y = area.y + area.height - static_cast<float>(budget / scale) * area.height;
+            if (y > area.y)
+                DrawLineEx({ area.x, y }, { area.x + area.width, y }, 1.f, Fade(WHITE, 0.5f));
+        }
+    }
+
+    void DrawHistogram(const PerformanceStats& stats, Rectangle area, double scale, const std::array<double, 3>& percentiles) noexcept
+    {
+        const auto& frameTimes = stats.FrameTimes();
+        m_Histogram.fill(0);
+        for (std::size_t i = 0; i < frameTimes.Size(); ++i)
+        {
+            const int bin = static_cast<int>(frameTimes[i] / scale * HistogramBins);
+            m_Histogram[static_cast<std::size_t>(bin < 0 ? 0 : (bin >= HistogramBins ? HistogramBins - 1 : bin))]++;
+        }
+
+        const int highest = *std::max_element(m_Histogram.begin(), m_Histogram.end());
+        const float binWidth = area.width / HistogramBins;
+
+        DrawRectangleRec(area, Fade(BLACK, 0.4f));
+        for (int i = 0; i < HistogramBins && highest > 0; ++i)
+        {
+            const float height = static_cast<float>(m_Histogram[static_cast<std::size_t>(i)]) / static_cast<float>(highest) * area.height;
+            DrawRectangleRec({ area.x + static_cast<float>(i) * binWidth + 1, area.y + area.height - height, binWidth - 2, height }, SKYBLUE);
+        }
+
+        for (const double p : percentiles)
+        {
+            const float x = area.x + static_cast<float>(p / scale) * area.width;
+            DrawLineEx({ x, area.y }, { x, area.y + area.height }, 1.f, RED);
+        }
+    }
+
+    void DrawPhases(const PerformanceStats& stats, int y) const noexcept
+    {
+        double total = 0.0;
+        for (std::size_t i = 0; i < PerformanceStats::PhaseCount; ++i)
+            total += stats.AveragePhaseTime(static_cast<FramePhase>(i));
+
+        char text[64];
+        const float barMaxWidth = Bounds().width - 230;
+        for (std::size_t i = 0; i < PerformanceStats::PhaseCount; ++i)
+        {
+            const int rowY = y + static_cast<int>(i) * 22;
+            const double ms = stats.AveragePhaseTime(static_cast<FramePhase>(i));
+            std::snprintf(text, sizeof(text), "%s %.2f ms", PhaseNames[i], ms);
+            GuiLabel(ToWindowSpace(10, rowY, 140, 20), text);
+
+            const float width = total > 0.0 ? static_cast<float>(ms / total) * barMaxWidth : 0.f;
+            DrawRectangleRec(ToWindowSpace(160, rowY + 4, static_cast<int>(width), 12), PhaseColors[i]);
+        }
+    }
+public:
+    PerformanceWindow() : FloatingWindow(540, 20, 480, 470, "Performance", KEY_F5, 400, 470) {}
+
+    void Draw(const PerformanceStats& stats) noexcept
+    {
+        PROFILE_SCOPE("PerformanceWindow::Draw");
+        FloatingWindow::Show();
+        if (!Visible()) return;
+
+        const std::array<double, 3> percentiles = { stats.FrameTimePercentile(0.5), stats.FrameTimePercentile(0.95), stats.FrameTimePercentile(0.99) };
+        const double scale = std::max(33.3, stats.FrameTimes().Max() * 1.1); // milliseconds at the top of the graph
+        const int width = static_cast<int>(Bounds().width) - 20;
+
+        char text[128];
+        std::snprintf(text, sizeof(text), "Frame p50 %.2f ms  p95 %.2f ms  p99 %.2f ms", percentiles[0], percentiles[1], percentiles[2]);
+        GuiLabel(ToWindowSpace(10, 5, width, 20), text);
+
+        DrawFrameGraph(stats, ToWindowSpace(10, 30, width, GraphHeight), scale);
+        DrawHistogram(stats, ToWindowSpace(10, 35 + GraphHeight, width, HistogramHeight), scale, percentiles);
+        DrawPhases(stats, 45 + GraphHeight + HistogramHeight);
+
+        const int infoY = 50 + GraphHeight + HistogramHeight + static_cast<int>(PerformanceStats::PhaseCount) * 22;
+        std::snprintf(text, sizeof(text), "Interactions/s: %.3e", stats.InteractionsPerSecond());
+        GuiLabel(ToWindowSpace(10, infoY, width, 20), text);
+
+        std::snprintf(text, sizeof(text), "Simulated days/s: %.1f", stats.SimulatedDaysPerSecond());
+        GuiLabel(ToWindowSpace(10, infoY + 22, width, 20), text);
+
+        if (!PerfCounters::Available())
+        {
+            GuiLabel(ToWindowSpace(10, infoY + 44, width, 20), "Hardware counters unavailable");
+            return;
+        }
+
+        // Counters the kernel refused are shown as n/a instead of a misleading zero
+        char values[3][24];
+        std::snprintf(text, sizeof(text), "Physics IPC: %s",
+            PerfCounters::Format(values[0], sizeof(values[0]), PerfCounters::Counter::Instructions, stats.InstructionsPerCycle(), 2));
+        GuiLabel(ToWindowSpace(10, infoY + 44, width, 20), text);
+
+        std::snprintf(text, sizeof(text), "Misses/interaction: L1D %s  LLC %s  branch %s",
+            PerfCounters::Format(values[0], sizeof(values[0]), PerfCounters::Counter::L1DMisses, stats.CounterPerInteraction(PerfCounters::Counter::L1DMisses), 3),
+            PerfCounters::Format(values[1], sizeof(values[1]), PerfCounters::Counter::LLCMisses, stats.CounterPerInteraction(PerfCounters::Counter::LLCMisses), 4),
+            PerfCounters::Format(values[2], sizeof(values[2]), PerfCounters::Counter::BranchMisses, stats.CounterPerInteraction(PerfCounters::Counter::BranchMisses), 4));
+        GuiLabel(ToWindowSpace(10, infoY + 66, width, 20), text);
+    }
 };
\ No newline at end of file
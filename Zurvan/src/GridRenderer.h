@@ -0,0 +1,160 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+
+#include "raylib.h"
+#include "raymath.h"
+#include "rlgl.h"
+
+#include "Shaders.h"
+#include "Profiler.h"
+
+// The reference grid and the coordinate axes baked into a static vertex buffer, one instance per line.
+// The buffer is only rebuilt when size or spacing change, drawing it is a single instanced call.
+class GridRenderer
+{
+private:
+    struct Line
+    {
+        float sx, sy, sz, fade; // fade 1 lets the line fade out with camera distance
+        float ex, ey, ez;
+        Color color;
+    };
+
+    static constexpr float Width = 0.5f; // half width in pixels
+    static constexpr float AxisLength = 100.f;
+private:
+    static inline Shader s_Shader;
+    static inline int s_MvpLoc = -1;
+    static inline int s_FarPlaneLoc = -1;
+    static inline int s_ViewportLoc = -1;
+    static inline int s_WidthLoc = -1;
+    static inline int s_CameraPositionLoc = -1;
+    static inline int s_FadeDistanceLoc = -1;
+    static inline int s_CornerLoc = -1;
+    static inline int s_StartLoc = -1;
+    static inline int s_EndLoc = -1;
+    static inline int s_ColorLoc = -1;
+    static inline unsigned int s_Vao = 0;
+    static inline unsigned int s_QuadVbo = 0;
+    static inline unsigned int s_LineVbo = 0;
+
+    static inline int s_Size = -1;
+    static inline float s_Spacing = 0.f;
+    static inline int s_LineCount = 0;
+private:
+    static void Build(int size, float spacing) noexcept
+    {
+        const float extent = static_cast<float>(size) * spacing;
+        const Color gridColor = Fade(DARKGRAY, 0.3f);
+
+        std::vector<Line> lines;
+        lines.reserve(static_cast<std::size_t>(2 * size + 1) * 2 + 3);
+        for (int i = -size; i <= size; i++)
+        {
+            // XZ plane (Y=0)
+            const float offset = static_cast<float>(i) * spacing;
+            lines.push_back({ offset, 0, -extent, 1.f, offset, 0, extent, gridColor });
+            lines.push_back({ -extent, 0, offset, 1.f, extent, 0, offset, gridColor });
+        }
+
+        lines.push_back({ 0, 0, 0, 0.f, AxisLength, 0, 0, RED });   // X axis
+        lines.push_back({ 0, 0, 0, 0.f, 0, AxisLength, 0, GREEN }); // Y axis
+        lines.push_back({ 0, 0, 0, 0.f, 0, 0, AxisLength, BLUE });  // Z axis
+
+        rlUnloadVertexBuffer(s_LineVbo);
+        rlEnableVertexArray(s_Vao);
+        s_LineVbo = rlLoadVertexBuffer(lines.data(), static_cast<int>(lines.size() * sizeof(Line)), false);
+        rlSetVertexAttribute(static_cast<unsigned int>(s_StartLoc), 4, RL_FLOAT, false, sizeof(Line), 0);
+        rlEnableVertexAttribute(static_cast<unsigned int>(s_StartLoc));
+        rlSetVertexAttributeDivisor(static_cast<unsigned int>(s_StartLoc), 1);
+        rlSetVertexAttribute(static_cast<unsigned int>(s_EndLoc), 3, RL_FLOAT, false, sizeof(Line), 4 * sizeof(float));
+        rlEnableVertexAttribute(static_cast<unsigned int>(s_EndLoc));
+        rlSetVertexAttributeDivisor(static_cast<unsigned int>(s_EndLoc), 1);
+        rlSetVertexAttribute(static_cast<unsigned int>(s_ColorLoc), 4, RL_UNSIGNED_BYTE, true, sizeof(Line), 7 * sizeof(float));
+        rlEnableVertexAttribute(static_cast<unsigned int>(s_ColorLoc));
+        rlSetVertexAttributeDivisor(static_cast<unsigned int>(s_ColorLoc), 1);
+        rlDisableVertexArray();
+
+        s_Size = size;
+        s_Spacing = spacing;
+        s_LineCount = static_cast<int>(lines.size());
+    }
+public:
+    static void Init() noexcept
+    {
+        s_Shader = LoadShaderFromMemory(Shaders::LineVertex, Shaders::LineFragment);
+        s_MvpLoc = GetShaderLocation(s_Shader, "mvp");
+        s_FarPlaneLoc = GetShaderLocation(s_Shader, "farPlane");
+        s_ViewportLoc = GetShaderLocation(s_Shader, "viewport");
+        s_WidthLoc = GetShaderLocation(s_Shader, "width");
+        s_CameraPositionLoc = GetShaderLocation(s_Shader, "cameraPosition");
+        s_FadeDistanceLoc = GetShaderLocation(s_Shader, "fadeDistance");
+        s_CornerLoc = GetShaderLocationAttrib(s_Shader, "vertexPosition");
+        s_StartLoc = GetShaderLocationAttrib(s_Shader, "lineStart");
+        s_EndLoc = GetShaderLocationAttrib(s_Shader, "lineEnd");
+        s_ColorLoc = GetShaderLocationAttrib(s_Shader, "lineColor");
+
+        if (IsShaderValid(s_Shader) && s_CornerLoc >= 0 && s_StartLoc >= 0 && s_EndLoc >= 0 && s_ColorLoc >= 0)
+            s_Vao = rlLoadVertexArray();
+
+        if (s_Vao == 0)
+        {
+            TraceLog(LOG_WARNING, "GRID: Instancing unavailable, falling back to DrawLine3D");
+            return;
+        }
+
+        static constexpr float quad[] = { 0.f, -1.f,  1.f, -1.f,  1.f, 1.f,  0.f, -1.f,  1.f, 1.f,  0.f, 1.f };
+        rlEnableVertexArray(s_Vao);
+        s_QuadVbo = rlLoadVertexBuffer(quad, sizeof(quad), false);
+        rlSetVertexAttribute(static_cast<unsigned int>(s_CornerLoc), 2, RL_FLOAT, false, 0, 0);
+        rlEnableVertexAttribute(static_cast<unsigned int>(s_CornerLoc));
+        rlDisableVertexArray();
+    }
+
+    static void Shutdown() noexcept
+    {
+        if (s_Vao != 0)
+        {
+            rlUnloadVertexBuffer(s_LineVbo);
+            rlUnloadVertexBuffer(s_QuadVbo);
+            rlUnloadVertexArray(s_Vao);
+            s_Vao = 0;
+        }
+        UnloadShader(s_Shader);
+        s_Size = -1;
+    }
+
+    static bool Available() noexcept
+    {
+        return s_Vao != 0;
+    }
+
+    // Must be called inside BeginMode3D with the camera at the render origin. The grid is fixed to the world
+    // origin, cameraPosition is the camera's world position and the grid fades out towards fadeDistance from it.
+    static void Draw(int size, float spacing, Vector3 cameraPosition, float fadeDistance) noexcept
+    {
+        if (s_Vao == 0) return;
+        if (size != s_Size || spacing != s_Spacing)
+            Build(size, spacing);
+
+        rlDrawRenderBatchActive(); // keep the order with everything drawn through the batch so far
+
+        const Vector2 viewport = { 0.5f * static_cast<float>(GetScreenWidth()), 0.5f * static_cast<float>(GetScreenHeight()) };
+        const float width = Width;
+        const float farPlane = static_cast<float>(rlGetCullDistanceFar());
+        const Matrix mvp = MatrixMultiply(MatrixTranslate(-cameraPosition.x, -cameraPosition.y, -cameraPosition.z), MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()));
+        rlEnableShader(s_Shader.id);
+        rlSetUniformMatrix(s_MvpLoc, mvp);
+        rlSetUniform(s_FarPlaneLoc, &farPlane, RL_SHADER_UNIFORM_FLOAT, 1);
+        rlSetUniform(s_ViewportLoc, &viewport, RL_SHADER_UNIFORM_VEC2, 1);
+        rlSetUniform(s_WidthLoc, &width, RL_SHADER_UNIFORM_FLOAT, 1);
+        rlSetUniform(s_CameraPositionLoc, &cameraPosition, RL_SHADER_UNIFORM_VEC3, 1);
+        rlSetUniform(s_FadeDistanceLoc, &fadeDistance, RL_SHADER_UNIFORM_FLOAT, 1);
+
+        rlEnableVertexArray(s_Vao);
+        rlDrawVertexArrayInstanced(0, 6, s_LineCount);
+        rlDisableVertexArray();
+        rlDisableShader();
+    }
+};
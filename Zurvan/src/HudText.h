@@ -0,0 +1,277 @@
+#pragma once
+#include <array>
+#include <cstdio>
+#include <cstdarg>
+#include <cstring>
+#include <cstddef>
+
+#include "raylib.h"
+#include "raymath.h"
+#include "rlgl.h"
+
+#include "Shaders.h"
+#include "Profiler.h"
+
+enum class HudLine
+{
+    Fps,
+    DaysPassed,
+    SimulationTime,
+    Info,
+    Recording,
+    Encounters,
+    EnergyDrift,
+    MomentumDrift,
+    AngularMomentumDrift,
+    BodyName,
+    PositionX,
+    PositionY,
+    PositionZ,
+    VelocityX,
+    VelocityY,
+    VelocityZ,
+    Mass,
+    Inclination,
+    Count
+};
+
+
+// Cached layout for the HUD. Every line owns a fixed range of a vertex buffer holding its glyph quads,
+// a line is only formatted and laid out again if its values, text or position change. All lines are
+// drawn with a single draw call, lines that aren't set during a frame are hidden.
+class HudText
+{
+private:
+    static constexpr std::size_t LineCount = static_cast<std::size_t>(HudLine::Count);
+    static constexpr std::size_t MaxGlyphs = 64;
+    static constexpr std::size_t LineVertices = MaxGlyphs * 6;
+
+    struct Vertex
+    {
+        float x, y, u, v;
+        Color color;
+    };
+
+    struct Line
+    {
+        char text[MaxGlyphs];
+        float x, y;
+        Color color;
+        bool centered;
+        bool used;     // set during the current frame
+        bool uploaded; // vertices on the GPU are visible
+        bool dirty;
+    };
+private:
+    static inline const Font* s_Font = nullptr;
+    static inline float s_FontSize = 0.f;
+    static inline Shader s_Shader;
+    static inline int s_MvpLoc = -1;
+    static inline int s_PositionLoc = -1;
+    static inline int s_TexCoordLoc = -1;
+    static inline int s_ColorLoc = -1;
+    static inline unsigned int s_Vao = 0;
+    static inline unsigned int s_Vbo = 0;
+    static inline std::array<Line, LineCount> s_Lines{};
+    static inline std::array<Vertex, LineVertices> s_Staging;
+private:
+    static float Advance(int index, float scale) noexcept
+    {
+        const Font& font = *s_Font;
+        return font.glyphs[index].advanceX == 0 ? font.recs[index].width * scale : static_cast<float>(font.glyphs[index].advanceX) * scale;
+    }
+
+    // Same placement as DrawTextEx with zero spacing, unused vertices collapse to degenerate triangles
+    static void Layout(std::size_t lineIndex) noexcept
+    {
+        const Line& line = s_Lines[lineIndex];
+        const Font& font = *s_Font;
+        const float scale = s_FontSize / static_cast<float>(font.baseSize);
+        const float padding = static_cast<float>(font.glyphPadding);
+        const float invWidth = 1.f / static_cast<float>(font.texture.width);
+        const float invHeight = 1.f / static_cast<float>(font.texture.height);
+
+        float x = line.x;
+        if (line.centered)
+        {
+            float width = 0.f;
+            for (const char* c = line.text; *c != '\0'; ++c)
+                width += Advance(GetGlyphIndex(font, *c), scale);
+            x -= width / 2;
+        }
+
+        s_Staging.fill(Vertex{ 0.f, 0.f, 0.f, 0.f, BLANK });
+        std::size_t v = 0;
+        for (const char* c = line.text; *c != '\0' && v < LineVertices; ++c)
+        {
+            const int index = GetGlyphIndex(font, *c);
+            if (*c != ' ' && *c != '\t')
+            {
+                const Rectangle rec = font.recs[index];
+                const float x0 = x + (static_cast<float>(font.glyphs[index].offsetX) - padding) * scale;
+                const float y0 = line.y + (static_cast<float>(font.glyphs[index].offsetY) - padding) * scale;
+                const float x1 = x0 + (rec.width + 2.f * padding) * scale;
+                const float y1 = y0 + (rec.height + 2.f * padding) * scale;
+                const float u0 = (rec.x - padding) * invWidth;
+                const float v0 = (rec.y - padding) * invHeight;
+                const float u1 = (rec.x + rec.width + padding) * invWidth;
+                const float v1 = (rec.y + rec.height + padding) * invHeight;
+
+                s_Staging[v++] = { x0, y0, u0, v0, line.color };
+                s_Staging[v++] = { x0, y1, u0, v1, line.color };
+                s_Staging[v++] = { x1, y1, u1, v1, line.color };
+                s_Staging[v++] = { x0, y0, u0, v0, line.color };
+                s_Staging[v++] = { x1, y1, u1, v1, line.color };
+                s_Staging[v++] = { x1, y0, u1, v0, line.color };
+            }
+            x += Advance(index, scale);
+        }
+    }
+
+    static void Upload(std::size_t lineIndex) noexcept
+    {
+        constexpr int bytes = static_cast<int>(LineVertices * sizeof(Vertex));
+        rlUpdateVertexBuffer(s_Vbo, s_Staging.data(), bytes, static_cast<int>(lineIndex) * bytes);
+    }
+
+    static bool SameColor(Color a, Color b) noexcept
+    {
+        return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+    }
+
+    static Line& Touch(HudLine id, float x, float y, Color color, bool centered) noexcept
+    {
+        Line& line = s_Lines[static_cast<std::size_t>(id)];
+        line.dirty = line.dirty || !line.uploaded || line.x != x || line.y != y || line.centered != centered || !SameColor(line.color, color);
+        line.x = x;
+        line.y = y;
+        line.color = color;
+        line.centered = centered;
+        line.used = true;
+        return line;
+    }
+public:
+    static void Init(const Font* font, float fontSize) noexcept
+    {
+        s_Font = font;
+        s_FontSize = fontSize;
+        s_Shader = LoadShaderFromMemory(Shaders::TextVertex, Shaders::TextFragment);
+        s_MvpLoc = GetShaderLocation(s_Shader, "mvp");
+        s_PositionLoc = GetShaderLocationAttrib(s_Shader, "vertexPosition");
+        s_TexCoordLoc = GetShaderLocationAttrib(s_Shader, "vertexTexCoord");
+        s_ColorLoc = GetShaderLocationAttrib(s_Shader, "vertexColor");
+
+        if (IsShaderValid(s_Shader) && s_PositionLoc >= 0 && s_TexCoordLoc >= 0 && s_ColorLoc >= 0)
+            s_Vao = rlLoadVertexArray();
+
+        if (s_Vao == 0)
+        {
+            TraceLog(LOG_WARNING, "HUD: Vertex arrays unavailable, falling back to DrawTextEx");
+            return;
+        }
+
+        rlEnableVertexArray(s_Vao);
+        s_Vbo = rlLoadVertexBuffer(nullptr, static_cast<int>(LineCount * LineVertices * sizeof(Vertex)), true);
+        rlSetVertexAttribute(static_cast<unsigned int>(s_PositionLoc), 2, RL_FLOAT, false, sizeof(Vertex), 0);
+        rlEnableVertexAttribute(static_cast<unsigned int>(s_PositionLoc));
+        rlSetVertexAttribute(static_cast<unsigned int>(s_TexCoordLoc), 2, RL_FLOAT, false, sizeof(Vertex), 2 * sizeof(float));
+        rlEnableVertexAttribute(static_cast<unsigned int>(s_TexCoordLoc));
+        rlSetVertexAttribute(static_cast<unsigned int>(s_ColorLoc), 4, RL_UNSIGNED_BYTE, true, sizeof(Vertex), 4 * sizeof(float));
+        rlEnableVertexAttribute(static_cast<unsigned int>(s_ColorLoc));
+        rlDisableVertexArray();
+
+        // Start with an all degenerate buffer
+        s_Staging.fill(Vertex{ 0.f, 0.f, 0.f, 0.f, BLANK });
+        for (std::size_t i = 0; i < LineCount; ++i)
+            Upload(i);
+    }
+
+    static void Shutdown() noexcept
+    {
+        if (s_Vao != 0)
+        {
+            rlUnloadVertexBuffer(s_Vbo);
+            rlUnloadVertexArray(s_Vao);
+            s_Vao = 0;
+        }
+        UnloadShader(s_Shader);
+        s_Lines = {};
+    }
+
+    // Call once per frame before setting any line
+    static void Begin() noexcept
+    {
+        for (Line& line : s_Lines)
+            line.used = false;
+    }
+
+    // Only laid out again if the text differs from the last frame
+    static void Set(HudLine id, const char* text, float x, float y, Color color = WHITE, bool centered = false) noexcept
+    {
+        Line& line = Touch(id, x, y, color, centered);
+        if (std::strncmp(line.text, text, MaxGlyphs - 1) == 0)
+            return;
+
+        std::snprintf(line.text, MaxGlyphs, "%s", text);
+        line.dirty = true;
+    }
+
+    // printf style, formatting is cheap compared to laying the line out again, which Set() avoids
+#if defined(__GNUC__)
+    __attribute__((format(printf, 5, 6)))
+#endif
+    static void Format(HudLine id, float x, float y, Color color, const char* format, ...) noexcept
+    {
+        char text[MaxGlyphs];
+        va_list args;
+        va_start(args, format);
+        std::vsnprintf(text, MaxGlyphs, format, args);
+        va_end(args);
+        Set(id, text, x, y, color);
+    }
+
+    static void Draw() noexcept
+    {
+        PROFILE_FUNCTION();
+        if (s_Vao == 0)
+        {
+            for (const Line& line : s_Lines)
+            {
+                if (!line.used) continue;
+                const float offset = line.centered ? MeasureTextEx(*s_Font, line.text, s_FontSize, 0).x / 2 : 0.f;
+                DrawTextEx(*s_Font, line.text, { line.x - offset, line.y }, s_FontSize, 0, line.color);
+            }
+            return;
+        }
+
+        for (std::size_t i = 0; i < LineCount; ++i)
+        {
+            Line& line = s_Lines[i];
+            if (line.used && line.dirty)
+            {
+                Layout(i);
+                Upload(i);
+                line.uploaded = true;
+                line.dirty = false;
+            }
+            else if (!line.used && line.uploaded)
+            {
+                s_Staging.fill(Vertex{ 0.f, 0.f, 0.f, 0.f, BLANK });
+                Upload(i);
+                line.uploaded = false;
+            }
+        }
+
+        rlDrawRenderBatchActive(); // keep the order with everything drawn through the batch so far
+
+        rlEnableShader(s_Shader.id);
+        rlSetUniformMatrix(s_MvpLoc, MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()));
+        rlActiveTextureSlot(0);
+        rlEnableTexture(s_Font->texture.id);
+        rlEnableVertexArray(s_Vao);
+        rlDrawVertexArray(0, static_cast<int>(LineCount * LineVertices));
+        rlDisableVertexArray();
+        rlDisableTexture();
+        rlDisableShader();
+    }
+};
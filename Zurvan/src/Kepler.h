@@ -0,0 +1,205 @@
+#pragma once
+#include <cmath>
+#include <thread>
+#include <functional>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+#include "Profiler.h"
+
+// Keplerian orbital elements to state vectors for whole populations at once. The conversion loop has
+// no calls and no branches (sine and cosine are inlined polynomials, Kepler's equation gets a fixed
+// number of Newton steps) so the compiler can vectorize it, large batches are split across threads.
+namespace Kepler
+{
+    // One orbit per index, distances in meters and angles in radians. mu is G * (central + body mass).
+    // Only elliptic orbits (0 <= e < 1) are supported.
+    struct Elements
+    {
+        std::vector<double> semiMajorAxis;
+        std::vector<double> eccentricity;
+        std::vector<double> inclination;
+        std::vector<double> node;       // longitude of the ascending node
+        std::vector<double> periapsis;  // argument of periapsis
+        std::vector<double> meanAnomaly;
+        std::vector<double> mu;
+
+        void Clear() noexcept
+        {
+            semiMajorAxis.clear();
+            eccentricity.clear();
+            inclination.clear();
+            node.clear();
+            periapsis.clear();
+            meanAnomaly.clear();
+            mu.clear();
+        }
+
+        void Add(double a, double e, double i, double ascendingNode, double argumentOfPeriapsis, double m, double gravitationalParameter)
+        {
+            semiMajorAxis.push_back(a);
+            eccentricity.push_back(e);
+            inclination.push_back(i);
+            node.push_back(ascendingNode);
+            periapsis.push_back(argumentOfPeriapsis);
+            meanAnomaly.push_back(m);
+            mu.push_back(gravitationalParameter);
+        }
+
+        std::size_t Size() const noexcept
+        {
+            return semiMajorAxis.size();
+        }
+    };
+
+    // Output columns, each has to hold Elements::Size() values
+    struct StateVectors
+    {
+        double* x;
+        double* y;
+        double* z;
+        double* vx;
+        double* vy;
+        double* vz;
+    };
+
+    namespace Detail
+    {
+        constexpr int NewtonSteps = 10; // converged to rounding for e <= 0.99, within 1e-11 radians up to 0.999
+        constexpr std::size_t MinRowsPerThread = 16384;
+
+        // Round to nearest without a call, valid for |x| < 2^51. Relies on strict floating point semantics
+        // (floatingpoint "Default" in premake), fast math would fold it away.
+        inline double Round(double x) noexcept
+        {
+            constexpr double Magic = 6755399441055744.0; // 1.5 * 2^52
+            return (x + Magic) - Magic;
+        }
+
+        // Both within an ulp or two of std::sin/std::cos for the small arguments used here
+        inline void SinCos(double x, double* sine, double* cosine) noexcept
+        {
+            constexpr double TwoOverPi = 0.63661977236758134308;
+            constexpr double HalfPiHigh = 1.5707963267948966;     // pi / 2 split in two parts so the
+            constexpr double HalfPiLow = 6.123233995736766036e-17; // reduction stays exact
+
+            const double q = Round(x * TwoOverPi);
+            const double r = (x - q * HalfPiHigh) - q * HalfPiLow; // |r| <= pi / 4
+            const double r2 = r * r;
+
+            // Taylor series, the first omitted terms are below 1e-19 on [-pi / 4, pi / 4]
+            const double s = r + r * r2 * (-1.0 / 6 + r2 * (1.0 / 120 + r2 * (-1.0 / 5040 + r2 * (1.0 / 362880 + r2 * (-1.0 / 39916800
+                + r2 * (1.0 / 6227020800 + r2 * (-1.0 / 1307674368000 + r2 * (1.0 / 355687428096000))))))));
+            const double c = 1.0 + r2 * (-1.0 / 2 + r2 * (1.0 / 24 + r2 * (-1.0 / 720 + r2 * (1.0 / 40320 + r2 * (-1.0 / 3628800
+                + r2 * (1.0 / 479001600 + r2 * (-1.0 / 87178291200 + r2 * (1.0 / 20922789888000))))))));
+
+            // Quadrant q mod 4 without integer conversion, q / 2 - 0.25 and q / 4 - 0.375 never round to a tie
+            const double half = Round(q * 0.5 - 0.25);
+            const double quarter = Round(q * 0.25 - 0.375);
+            const bool odd = q - 2.0 * half != 0.0;
+            const bool sineNegative = q - 4.0 * quarter >= 2.0;
+            const bool cosineNegative = q - 4.0 * quarter == 1.0 || q - 4.0 * quarter == 2.0;
+
+            const double sineValue = odd ? c : s;
+            const double cosineValue = odd ? s : c;
+            *sine = sineNegative ? -sineValue : sineValue;
+            *cosine = cosineNegative ? -cosineValue : cosineValue;
+        }
+
+        // Eccentric anomaly from the mean anomaly
+        inline double Solve(double meanAnomaly, double e) noexcept
+        {
+            constexpr double TwoPi = 6.28318530717958647692;
+            const double m = meanAnomaly - TwoPi * Round(meanAnomaly * (1.0 / TwoPi)); // [-pi, pi]
+
+            // Danby's starting value converges for every elliptic orbit
+            double E = m + (m >= 0.0 ? 0.85 : -0.85) * e;
+#if defined(__GNUC__)
+    #pragma GCC unroll 16 // an inner loop would keep the conversion loop from vectorizing
+#endif
+            for (int step = 0; step < NewtonSteps; ++step)
+            {
+                double s, c;
+                SinCos(E, &s, &c);
+                E -= (E - e * s - m) / (1.0 - e * c);
+            }
+            return E;
+        }
+
+        // Vectorizable, rows [begin, end)
+        inline void Convert(const Elements& elements, const StateVectors& out, std::size_t begin, std::size_t end) noexcept
+        {
+            const double* a = elements.semiMajorAxis.data();
+            const double* ecc = elements.eccentricity.data();
+            const double* inc = elements.inclination.data();
+            const double* node = elements.node.data();
+            const double* peri = elements.periapsis.data();
+            const double* mean = elements.meanAnomaly.data();
+            const double* mu = elements.mu.data();
+            double* x = out.x;
+            double* y = out.y;
+            double* z = out.z;
+            double* vx = out.vx;
+            double* vy = out.vy;
+            double* vz = out.vz;
+
+            // The output columns never overlap the inputs, without the hint there are too many pairs to check at runtime
+#if defined(__GNUC__)
+    #pragma GCC ivdep
+#endif
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                const double e = ecc[i];
+                double sinE, cosE, sinI, cosI, sinO, cosO, sinW, cosW;
+                SinCos(Solve(mean[i], e), &sinE, &cosE);
+                SinCos(inc[i], &sinI, &cosI);
+                SinCos(node[i], &sinO, &cosO);
+                SinCos(peri[i], &sinW, &cosW);
+
+                // Perifocal frame, x towards periapsis
+                const double root = std::sqrt(1.0 - e * e);
+                const double px = a[i] * (cosE - e);
+                const double py = a[i] * root * sinE;
+                const double speed = std::sqrt(mu[i] * a[i]) / (a[i] * (1.0 - e * cosE));
+                const double pvx = -speed * sinE;
+                const double pvy = speed * root * cosE;
+
+                // Rotate by periapsis, inclination and node into the ecliptic frame (Z north)
+                const double P[3] = { cosW * cosO - sinW * sinO * cosI, cosW * sinO + sinW * cosO * cosI, sinW * sinI };
+                const double Q[3] = { -sinW * cosO - cosW * sinO * cosI, -sinW * sinO + cosW * cosO * cosI, cosW * sinI };
+
+                // Zurvan is y up with prograde motion towards -z, so (x, y, z) = (X, Z, -Y)
+                x[i] = px * P[0] + py * Q[0];
+                y[i] = px * P[2] + py * Q[2];
+                z[i] = -(px * P[1] + py * Q[1]);
+                vx[i] = pvx * P[0] + pvy * Q[0];
+                vy[i] = pvx * P[2] + pvy * Q[2];
+                vz[i] = -(pvx * P[1] + pvy * Q[1]);
+            }
+        }
+    }
+
+    // Positions and velocities relative to the central body
+    inline void ToStateVectors(const Elements& elements, const StateVectors& out)
+    {
+        PROFILE_FUNCTION();
+        const std::size_t count = elements.Size();
+        const std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+        const std::size_t threads = std::min(hardware, count / Detail::MinRowsPerThread + 1);
+        if (threads <= 1)
+        {
+            Detail::Convert(elements, out, 0, count);
+            return;
+        }
+
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1);
+        const std::size_t perThread = (count + threads - 1) / threads;
+        for (std::size_t t = 1; t < threads; ++t)
+            workers.emplace_back(Detail::Convert, std::cref(elements), std::cref(out), t * perThread, std::min(count, (t + 1) * perThread));
+        Detail::Convert(elements, out, 0, perThread);
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+}
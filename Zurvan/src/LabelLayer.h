@@ -0,0 +1,126 @@
+#pragma once
+#include <cmath>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+#include "raylib.h"
+#include "raymath.h"
+#include "rlgl.h"
+
+// Screen space label placement. Anchors are projected in one pass with a single view-projection matrix,
+// labels are then placed in priority order and rejected if they overlap one that is already placed.
+// Overlap tests only look at the rectangles registered in the grid cells the label covers.
+class LabelLayer
+{
+private:
+    static constexpr int CellSize = 64; // pixels
+
+    struct Box
+    {
+        float x0, y0, x1, y1;
+    };
+private:
+    static inline std::vector<float> s_ScreenX;
+    static inline std::vector<float> s_ScreenY;
+    static inline std::vector<Box> s_Placed;
+    static inline std::vector<std::vector<uint32_t>> s_Cells; // indices into s_Placed
+    static inline int s_Columns = 0;
+    static inline int s_Rows = 0;
+    static inline float s_Width = 0.f;
+    static inline float s_Height = 0.f;
+private:
+    static int CellX(float x) noexcept { return std::max(0, std::min(s_Columns - 1, static_cast<int>(x) / CellSize)); }
+    static int CellY(float y) noexcept { return std::max(0, std::min(s_Rows - 1, static_cast<int>(y) / CellSize)); }
+public:
+    // The view and projection BeginMode3D uses, but with the far plane at infinity. The real far plane is so far
+    // away that raylib's float matrix rounds to this anyway, written out exactly the far clip plane has a zero
+    // normal and Frustum drops it instead of normalizing rounding noise.
+    static Matrix ViewProjection(const Camera& camera, int width, int height) noexcept
+    {
+        const Matrix view = MatrixLookAt(camera.position, camera.target, camera.up);
+        const double focal = 1.0 / std::tan(0.5 * static_cast<double>(camera.fovy) * DEG2RAD);
+        const double aspect = static_cast<double>(width) / static_cast<double>(height);
+        Matrix projection = {};
+        projection.m0 = static_cast<float>(focal / aspect);
+        projection.m5 = static_cast<float>(focal);
+        projection.m10 = -1.f;
+        projection.m11 = -1.f;
+        projection.m14 = static_cast<float>(-2.0 * rlGetCullDistanceNear());
+        return MatrixMultiply(view, projection);
+    }
+
+    // Clears all placed labels and resizes the bucket grid to the screen
+    static void Begin(int width, int height)
+    {
+        s_Width = static_cast<float>(width);
+        s_Height = static_cast<float>(height);
+        s_Columns = (std::max(width, 1) - 1) / CellSize + 1; // rounded up, at least one cell
+        s_Rows = (std::max(height, 1) - 1) / CellSize + 1;
+        s_Cells.resize(static_cast<std::size_t>(s_Columns * s_Rows));
+        for (auto& cell : s_Cells)
+            cell.clear();
+        s_Placed.clear();
+    }
+
+    // Projects count anchors given as separate x, y, z arrays. Anchors behind the camera get NaN coordinates.
+    static void Project(const Matrix& m, const float* x, const float* y, const float* z, std::size_t count)
+    {
+        s_ScreenX.resize(count);
+        s_ScreenY.resize(count);
+        const float halfWidth = 0.5f * s_Width;
+        const float halfHeight = 0.5f * s_Height;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const float cx = m.m0 * x[i] + m.m4 * y[i] + m.m8 * z[i] + m.m12;
+            const float cy = m.m1 * x[i] + m.m5 * y[i] + m.m9 * z[i] + m.m13;
+            const float cw = m.m3 * x[i] + m.m7 * y[i] + m.m11 * z[i] + m.m15;
+            const float invW = cw > 0.f ? 1.f / cw : NAN;
+            s_ScreenX[i] = (cx * invW + 1.f) * halfWidth;
+            s_ScreenY[i] = (1.f - cy * invW) * halfHeight;
+        }
+    }
+
+    // Screen position of a projected anchor, returns false if it's behind the camera or off screen
+    static bool Anchor(std::size_t i, Vector2* position) noexcept
+    {
+        const float x = s_ScreenX[i];
+        const float y = s_ScreenY[i];
+        if (!(x >= 0.f && x < s_Width && y >= 0.f && y < s_Height)) // also rejects NaN
+            return false;
+        *position = { x, y };
+        return true;
+    }
+
+    // Places the rectangle if it doesn't overlap any label placed so far
+    static bool TryPlace(Rectangle rect)
+    {
+        const Box box = { rect.x, rect.y, rect.x + rect.width, rect.y + rect.height };
+        if (box.x1 < 0.f || box.y1 < 0.f || box.x0 >= s_Width || box.y0 >= s_Height)
+            return false;
+
+        const int cx0 = CellX(box.x0), cx1 = CellX(box.x1);
+        const int cy0 = CellY(box.y0), cy1 = CellY(box.y1);
+        for (int cy = cy0; cy <= cy1; ++cy)
+        {
+            for (int cx = cx0; cx <= cx1; ++cx)
+            {
+                for (const uint32_t index : s_Cells[static_cast<std::size_t>(cy * s_Columns + cx)])
+                {
+                    const Box& other = s_Placed[index];
+                    if (box.x0 < other.x1 && other.x0 < box.x1 && box.y0 < other.y1 && other.y0 < box.y1)
+                        return false;
+                }
+            }
+        }
+
+        const uint32_t index = static_cast<uint32_t>(s_Placed.size());
+        s_Placed.push_back(box);
+        for (int cy = cy0; cy <= cy1; ++cy)
+            for (int cx = cx0; cx <= cx1; ++cx)
+                s_Cells[static_cast<std::size_t>(cy * s_Columns + cx)].push_back(index);
+        return true;
+    }
+};
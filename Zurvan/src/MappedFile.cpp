@@ -0,0 +1,102 @@
+#include "MappedFile.h"
+
+#ifdef SYSTEM_WINDOWS
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+#ifdef SYSTEM_WINDOWS
+bool MappedFile::Open(const char* path) noexcept
+{
+    Close();
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size))
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    m_File = file;
+    m_Size = static_cast<std::size_t>(size.QuadPart);
+    m_Open = true;
+    if (m_Size == 0)
+        return true;
+
+    m_Mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (m_Mapping != nullptr)
+        m_Data = static_cast<const char*>(MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0));
+    if (m_Data == nullptr)
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void MappedFile::Close() noexcept
+{
+    if (m_Data != nullptr) UnmapViewOfFile(m_Data);
+    if (m_Mapping != nullptr) CloseHandle(m_Mapping);
+    if (m_File != nullptr) CloseHandle(m_File);
+    m_Data = nullptr;
+    m_Mapping = nullptr;
+    m_File = nullptr;
+    m_Size = 0;
+    m_Open = false;
+}
+#else
+bool MappedFile::Open(const char* path) noexcept
+{
+    Close();
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    m_Size = static_cast<std::size_t>(info.st_size);
+    if (m_Size > 0)
+    {
+        void* data = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            close(fd);
+            m_Size = 0;
+            return false;
+        }
+        m_Data = static_cast<const char*>(data);
+#ifdef MADV_SEQUENTIAL
+        madvise(data, m_Size, MADV_SEQUENTIAL);
+#endif
+    }
+
+    // The mapping stays valid without the descriptor
+    close(fd);
+    m_Open = true;
+    return true;
+}
+
+void MappedFile::Close() noexcept
+{
+    if (m_Data != nullptr)
+        munmap(const_cast<char*>(m_Data), m_Size);
+    m_Data = nullptr;
+    m_Size = 0;
+    m_Open = false;
+}
+#endif
@@ -0,0 +1,29 @@
+#pragma once
+#include <cstddef>
+
+// Read only view of a whole file mapped into memory. Kept free of raylib so the implementation can
+// include the platform headers (windows.h clashes with raylib's names).
+class MappedFile
+{
+private:
+    const char* m_Data = nullptr;
+    std::size_t m_Size = 0;
+    bool m_Open = false;
+#ifdef SYSTEM_WINDOWS
+    void* m_File = nullptr;
+    void* m_Mapping = nullptr;
+#endif
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile() { Close(); }
+
+    // An empty file opens successfully with Data() == nullptr
+    bool Open(const char* path) noexcept;
+    void Close() noexcept;
+
+    const char* Data() const noexcept { return m_Data; }
+    std::size_t Size() const noexcept { return m_Size; }
+    bool IsOpen() const noexcept { return m_Open; }
+};
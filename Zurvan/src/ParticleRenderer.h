@@ -0,0 +1,144 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "raylib.h"
+#include "raymath.h"
+#include "rlgl.h"
+
+#include "Shaders.h"
+#include "Profiler.h"
+
+// Draws up to millions of particles (belts, debris) as camera facing discs with one instanced draw call.
+// Positions live in a persistent vertex buffer that is updated in place, Upload() skips the transfer if
+// the caller hands in the same version twice, e.g. while the simulation is paused.
+class ParticleRenderer
+{
+private:
+    static constexpr std::size_t InitialCapacity = 1 << 14; // particles
+    static constexpr std::size_t Stride = 3 * sizeof(float);
+    static constexpr uint64_t NoVersion = ~uint64_t(0);
+private:
+    static inline Shader s_Shader;
+    static inline int s_ModelviewLoc = -1;
+    static inline int s_ProjectionLoc = -1;
+    static inline int s_FarPlaneLoc = -1;
+    static inline int s_RadiusLoc = -1;
+    static inline int s_PixelToWorldLoc = -1;
+    static inline int s_MinPixelsLoc = -1;
+    static inline int s_ColorLoc = -1;
+    static inline int s_CornerLoc = -1;
+    static inline int s_InstancePositionLoc = -1;
+    static inline unsigned int s_Vao = 0;
+    static inline unsigned int s_QuadVbo = 0;
+    static inline unsigned int s_InstanceVbo = 0;
+    static inline std::size_t s_Capacity = 0;
+    static inline std::size_t s_Count = 0;
+    static inline uint64_t s_Version = NoVersion;
+private:
+    static void Reserve(std::size_t particles) noexcept
+    {
+        if (particles <= s_Capacity) return;
+
+        while (s_Capacity < particles)
+            s_Capacity = s_Capacity == 0 ? InitialCapacity : s_Capacity * 2;
+
+        rlUnloadVertexBuffer(s_InstanceVbo);
+        s_InstanceVbo = rlLoadVertexBuffer(nullptr, static_cast<int>(s_Capacity * Stride), true);
+        rlEnableVertexArray(s_Vao);
+        rlSetVertexAttribute(static_cast<unsigned int>(s_InstancePositionLoc), 3, RL_FLOAT, false, Stride, 0);
+        rlEnableVertexAttribute(static_cast<unsigned int>(s_InstancePositionLoc));
+        rlSetVertexAttributeDivisor(static_cast<unsigned int>(s_InstancePositionLoc), 1);
+        rlDisableVertexArray();
+    }
+public:
+    static void Init() noexcept
+    {
+        s_Shader = LoadShaderFromMemory(Shaders::ParticleVertex, Shaders::ParticleFragment);
+        s_ModelviewLoc = GetShaderLocation(s_Shader, "modelview");
+        s_ProjectionLoc = GetShaderLocation(s_Shader, "projection");
+        s_FarPlaneLoc = GetShaderLocation(s_Shader, "farPlane");
+        s_RadiusLoc = GetShaderLocation(s_Shader, "radius");
+        s_PixelToWorldLoc = GetShaderLocation(s_Shader, "pixelToWorld");
+        s_MinPixelsLoc = GetShaderLocation(s_Shader, "minPixels");
+        s_ColorLoc = GetShaderLocation(s_Shader, "color");
+        s_CornerLoc = GetShaderLocationAttrib(s_Shader, "vertexPosition");
+        s_InstancePositionLoc = GetShaderLocationAttrib(s_Shader, "instancePosition");
+
+        if (IsShaderValid(s_Shader) && s_CornerLoc >= 0 && s_InstancePositionLoc >= 0)
+            s_Vao = rlLoadVertexArray();
+
+        if (s_Vao == 0)
+        {
+            // There is no sensible immediate mode fallback for this many particles
+            TraceLog(LOG_WARNING, "PARTICLES: Instancing unavailable, particles are disabled");
+            return;
+        }
+
+        static constexpr float quad[] = { -1.f, -1.f,  1.f, -1.f,  1.f, 1.f,  -1.f, -1.f,  1.f, 1.f,  -1.f, 1.f };
+        rlEnableVertexArray(s_Vao);
+        s_QuadVbo = rlLoadVertexBuffer(quad, sizeof(quad), false);
+        rlSetVertexAttribute(static_cast<unsigned int>(s_CornerLoc), 2, RL_FLOAT, false, 0, 0);
+        rlEnableVertexAttribute(static_cast<unsigned int>(s_CornerLoc));
+        rlDisableVertexArray();
+
+        Reserve(InitialCapacity);
+    }
+
+    static void Shutdown() noexcept
+    {
+        if (s_Vao != 0)
+        {
+            rlUnloadVertexBuffer(s_InstanceVbo);
+            rlUnloadVertexBuffer(s_QuadVbo);
+            rlUnloadVertexArray(s_Vao);
+            s_Vao = 0;
+        }
+        UnloadShader(s_Shader);
+        s_Capacity = 0;
+        s_Count = 0;
+        s_Version = NoVersion;
+    }
+
+    // positions holds x, y, z in world units for every particle. Nothing is transferred if version
+    // matches the previous upload, bump it whenever the positions change.
+    static void Upload(const float* positions, std::size_t count, uint64_t version) noexcept
+    {
+        PROFILE_FUNCTION();
+        if (s_Vao == 0 || (version == s_Version && count == s_Count)) return;
+
+        Reserve(count);
+        if (count != 0)
+            rlUpdateVertexBuffer(s_InstanceVbo, positions, static_cast<int>(count * Stride), 0);
+        s_Count = count;
+        s_Version = version;
+    }
+
+    // Must be called inside BeginMode3D, radius is in world units. The uploaded positions are moved by offset,
+    // which keeps them small if they are stored relative to something other than the camera.
+    static void Draw(const Camera3D& camera, Vector3 offset, float radius, float minPixels, Color color) noexcept
+    {
+        PROFILE_FUNCTION();
+        if (s_Vao == 0 || s_Count == 0) return;
+
+        rlDrawRenderBatchActive(); // keep the order with everything drawn through the batch so far
+
+        const float pixelToWorld = std::tan(0.5f * camera.fovy * DEG2RAD) / (0.5f * static_cast<float>(GetScreenHeight()));
+        const Vector4 tint = ColorNormalize(color);
+        const float farPlane = static_cast<float>(rlGetCullDistanceFar());
+        rlEnableShader(s_Shader.id);
+        rlSetUniformMatrix(s_ModelviewLoc, MatrixMultiply(MatrixTranslate(offset.x, offset.y, offset.z), rlGetMatrixModelview()));
+        rlSetUniformMatrix(s_ProjectionLoc, rlGetMatrixProjection());
+        rlSetUniform(s_FarPlaneLoc, &farPlane, RL_SHADER_UNIFORM_FLOAT, 1);
+        rlSetUniform(s_RadiusLoc, &radius, RL_SHADER_UNIFORM_FLOAT, 1);
+        rlSetUniform(s_PixelToWorldLoc, &pixelToWorld, RL_SHADER_UNIFORM_FLOAT, 1);
+        rlSetUniform(s_MinPixelsLoc, &minPixels, RL_SHADER_UNIFORM_FLOAT, 1);
+        rlSetUniform(s_ColorLoc, &tint, RL_SHADER_UNIFORM_VEC4, 1);
+
+        rlEnableVertexArray(s_Vao);
+        rlDrawVertexArrayInstanced(0, 6, static_cast<int>(s_Count));
+        rlDisableVertexArray();
+        rlDisableShader();
+    }
+};
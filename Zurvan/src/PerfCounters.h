@@ -0,0 +1,246 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <utility>
+
+#include "Profiler.h"
+
+/*
+    Hardware performance counters via perf_event_open (Linux only).
+    Every thread opens its own counter group lazily on first use. If the kernel refuses
+    (perf_event_paranoid, containers, VMs without PMU) the affected counters simply stay at zero
+    and Available() reports false for them, nothing else changes.
+*/
+#if defined(__linux__) && !defined(SYSTEM_WEB) && !defined(CONFIG_DISTRIBUTION)
+    #define PERF_COUNTERS_ENABLED
+    #include <cstring>
+    #include <unistd.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <linux/perf_event.h>
+#endif
+
+namespace PerfCounters
+{
+    enum class Counter
+    {
+        Cycles,
+        Instructions,
+        L1DMisses,
+        LLCMisses,
+        BranchMisses,
+        Count
+    };
+
+    enum class Phase
+    {
+        Accelerations,
+        Update,
+        Count
+    };
+
+    constexpr std::size_t CounterCount = static_cast<std::size_t>(Counter::Count);
+    constexpr std::size_t PhaseCount = static_cast<std::size_t>(Phase::Count);
+    using Values = std::array<uint64_t, CounterCount>;
+
+    namespace Detail
+    {
+        // Accumulated over all threads, read once per frame by the performance window
+        inline std::array<std::array<std::atomic<uint64_t>, CounterCount>, PhaseCount> s_Totals{};
+        // One bit per counter: opened by at least one thread / failed to open in at least one thread
+        inline std::atomic<uint32_t> s_Opened{ 0 };
+        inline std::atomic<uint32_t> s_Failed{ 0 };
+    }
+
+#ifdef PERF_COUNTERS_ENABLED
+    class ThreadCounters
+    {
+    private:
+        std::array<int, CounterCount> m_Fds;
+        std::array<int, CounterCount> m_Slot; // position of the counter in the group read, -1 if unavailable
+        int m_Opened = 0;
+    private:
+        static int Open(uint32_t type, uint64_t config, int groupFd) noexcept
+        {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = type;
+            attr.config = config;
+            attr.disabled = groupFd == -1 ? 1 : 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0)); // this thread, any cpu
+        }
+
+        static constexpr uint64_t CacheConfig(uint64_t cache) noexcept
+        {
+            return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        }
+    public:
+        // Raw counts plus how long the group was enabled and actually counting. The kernel multiplexes
+        // groups when there are more events than hardware counters, running is shorter than enabled then.
+        struct Sample
+        {
+            Values values;
+            uint64_t enabled;
+            uint64_t running;
+        };
+    public:
+        ThreadCounters() noexcept
+        {
+            m_Fds.fill(-1);
+            m_Slot.fill(-1);
+
+            const std::array<std::pair<uint32_t, uint64_t>, CounterCount> events = {{
+                { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+                { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+                { PERF_TYPE_HW_CACHE, CacheConfig(PERF_COUNT_HW_CACHE_L1D) },
+                { PERF_TYPE_HW_CACHE, CacheConfig(PERF_COUNT_HW_CACHE_LL) },
+                { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES }
+            }};
+
+            // Cycles lead the group, without them there is nothing to normalize against
+            m_Fds[0] = Open(events[0].first, events[0].second, -1);
+            if (m_Fds[0] == -1) return;
+            m_Slot[0] = m_Opened++;
+
+            uint32_t opened = 1;
+            for (std::size_t i = 1; i < CounterCount; ++i)
+            {
+                m_Fds[i] = Open(events[i].first, events[i].second, m_Fds[0]);
+                if (m_Fds[i] != -1)
+                {
+                    m_Slot[i] = m_Opened++;
+                    opened |= 1u << i;
+                }
+            }
+
+            ioctl(m_Fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(m_Fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+            Detail::s_Opened.fetch_or(opened, std::memory_order_relaxed);
+            Detail::s_Failed.fetch_or(~opened & ((1u << CounterCount) - 1), std::memory_order_relaxed);
+        }
+
+        ThreadCounters(const ThreadCounters&) = delete;
+        ThreadCounters& operator=(const ThreadCounters&) = delete;
+
+        ~ThreadCounters()
+        {
+            for (const int fd : m_Fds)
+                if (fd != -1) close(fd);
+        }
+
+        bool Read(Sample* sample) const noexcept
+        {
+            sample->values.fill(0);
+            sample->enabled = 0;
+            sample->running = 0;
+            if (m_Opened == 0) return false;
+
+            uint64_t buffer[3 + CounterCount]; // count, time enabled, time running, values
+            const ssize_t expected = static_cast<ssize_t>(sizeof(uint64_t) * (3 + static_cast<std::size_t>(m_Opened)));
+            if (read(m_Fds[0], buffer, sizeof(buffer)) != expected)
+                return false;
+
+            sample->enabled = buffer[1];
+            sample->running = buffer[2];
+            for (std::size_t i = 0; i < CounterCount; ++i)
+                if (m_Slot[i] != -1) sample->values[i] = buffer[3 + m_Slot[i]];
+            return true;
+        }
+
+        static ThreadCounters& Local() noexcept
+        {
+            thread_local ThreadCounters counters;
+            return counters;
+        }
+    };
+
+
+    class Scope
+    {
+    private:
+        Phase m_Phase;
+        ThreadCounters::Sample m_Start;
+        bool m_Valid;
+    public:
+        explicit Scope(Phase phase) noexcept : m_Phase(phase), m_Valid(ThreadCounters::Local().Read(&m_Start)) {}
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        ~Scope()
+        {
+            ThreadCounters::Sample end;
+            if (!m_Valid || !ThreadCounters::Local().Read(&end)) return;
+
+            // Extrapolate multiplexed counts to the whole scope, nothing was counted if the group never ran
+            const uint64_t enabled = end.enabled - m_Start.enabled;
+            const uint64_t running = end.running - m_Start.running;
+            if (running == 0) return;
+            const double scale = static_cast<double>(enabled) / static_cast<double>(running);
+
+            auto& totals = Detail::s_Totals[static_cast<std::size_t>(m_Phase)];
+            for (std::size_t i = 0; i < CounterCount; ++i)
+            {
+                const uint64_t delta = end.values[i] - m_Start.values[i];
+                totals[i].fetch_add(running < enabled ? static_cast<uint64_t>(static_cast<double>(delta) * scale) : delta, std::memory_order_relaxed);
+            }
+        }
+    };
+#endif // PERF_COUNTERS_ENABLED
+
+    // A counter is only available if every thread that counts managed to open it, partial totals would mislead
+    inline bool Available(Counter counter) noexcept
+    {
+        const uint32_t bit = 1u << static_cast<uint32_t>(counter);
+        return (Detail::s_Opened.load(std::memory_order_relaxed) & ~Detail::s_Failed.load(std::memory_order_relaxed) & bit) != 0;
+    }
+
+    // Without cycles no counter is open at all
+    inline bool Available() noexcept
+    {
+        return Available(Counter::Cycles);
+    }
+
+    // Writes value with the given precision, or "n/a" if the counter it was derived from is unavailable
+    inline const char* Format(char* text, std::size_t size, Counter counter, double value, int precision, bool scientific = false) noexcept
+    {
+        if (!Available(counter))
+            std::snprintf(text, size, "n/a");
+        else if (scientific)
+            std::snprintf(text, size, "%.*e", precision, value);
+        else
+            std::snprintf(text, size, "%.*f", precision, value);
+        return text;
+    }
+
+    // Totals since program start, summed over all phases
+    inline Values Totals() noexcept
+    {
+        Values values{};
+        for (const auto& phase : Detail::s_Totals)
+            for (std::size_t i = 0; i < CounterCount; ++i)
+                values[i] += phase[i].load(std::memory_order_relaxed);
+        return values;
+    }
+
+    inline Values Totals(Phase phase) noexcept
+    {
+        Values values{};
+        const auto& totals = Detail::s_Totals[static_cast<std::size_t>(phase)];
+        for (std::size_t i = 0; i < CounterCount; ++i)
+            values[i] = totals[i].load(std::memory_order_relaxed);
+        return values;
+    }
+}
+
+#ifdef PERF_COUNTERS_ENABLED
+    #define PERF_COUNTERS_SCOPE(phase) const PerfCounters::Scope PROFILE_CONCAT(perfCountersScope, __LINE__)(phase)
+#else
+    #define PERF_COUNTERS_SCOPE(phase)
+#endif
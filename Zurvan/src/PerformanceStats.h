@@ -0,0 +1,162 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <algorithm>
+
+#include "PerfCounters.h"
+
+template <typename T, std::size_t N>
+class RingBuffer
+{
+private:
+    std::array<T, N> m_Data{};
+    std::size_t m_Head = 0; // next write position
+    std::size_t m_Size = 0;
+public:
+    void Push(T value) noexcept
+    {
+        m_Data[m_Head] = value;
+        m_Head = (m_Head + 1) % N;
+        if (m_Size < N) m_Size++;
+    }
+
+    // Index 0 is the oldest element
+    T operator[](std::size_t i) const noexcept
+    {
+        return m_Data[(m_Head + N - m_Size + i) % N];
+    }
+
+    T Latest() const noexcept
+    {
+        return m_Size == 0 ? T{} : m_Data[(m_Head + N - 1) % N];
+    }
+
+    T Sum() const noexcept
+    {
+        T sum{};
+        for (std::size_t i = 0; i < m_Size; ++i)
+            sum += m_Data[i];
+        return sum;
+    }
+
+    T Average() const noexcept
+    {
+        return m_Size == 0 ? T{} : Sum() / static_cast<T>(m_Size);
+    }
+
+    T Max() const noexcept
+    {
+        return m_Size == 0 ? T{} : *std::max_element(m_Data.begin(), m_Data.begin() + static_cast<std::ptrdiff_t>(m_Size));
+    }
+
+    std::size_t Size() const noexcept
+    {
+        return m_Size;
+    }
+
+    static constexpr std::size_t Capacity() noexcept
+    {
+        return N;
+    }
+
+    // Copies the contents into out (oldest first) and returns the number of elements copied
+    std::size_t CopyTo(std::array<T, N>* out) const noexcept
+    {
+        for (std::size_t i = 0; i < m_Size; ++i)
+            (*out)[i] = (*this)[i];
+        return m_Size;
+    }
+};
+
+
+enum class FramePhase
+{
+    Physics,
+    Render,
+    GUI,
+    Present,
+    Count
+};
+
+
+// Per frame timings for the performance window, everything lives in fixed size ring buffers
+// so recording a frame never allocates
+class PerformanceStats
+{
+public:
+    static constexpr std::size_t History = 240; // frames
+    static constexpr std::size_t PhaseCount = static_cast<std::size_t>(FramePhase::Count);
+private:
+    RingBuffer<double, History> m_FrameTimes; // milliseconds
+    RingBuffer<double, History> m_Interactions; // pairwise force evaluations per frame
+    RingBuffer<double, History> m_SimulatedTime; // simulated seconds per frame
+    std::array<RingBuffer<double, History>, PhaseCount> m_PhaseTimes; // milliseconds
+    std::array<RingBuffer<double, History>, PerfCounters::CounterCount> m_Counters; // hardware events of the physics phases per frame
+    std::array<double, PhaseCount> m_CurrentPhases{};
+    mutable std::array<double, History> m_Scratch{};
+public:
+    void AddPhaseTime(FramePhase phase, double milliseconds) noexcept
+    {
+        m_CurrentPhases[static_cast<std::size_t>(phase)] += milliseconds;
+    }
+
+    // counters holds the events counted during this frame, i.e. the difference of PerfCounters::Totals()
+    void EndFrame(double frameMilliseconds, double interactions, double simulatedSeconds, const PerfCounters::Values& counters) noexcept
+    {
+        m_FrameTimes.Push(frameMilliseconds);
+        for (std::size_t i = 0; i < PerfCounters::CounterCount; ++i)
+            m_Counters[i].Push(static_cast<double>(counters[i]));
+        m_Interactions.Push(interactions);
+        m_SimulatedTime.Push(simulatedSeconds);
+        for (std::size_t i = 0; i < PhaseCount; ++i)
+        {
+            m_PhaseTimes[i].Push(m_CurrentPhases[i]);
+            m_CurrentPhases[i] = 0.0;
+        }
+    }
+
+    // p in [0, 1]
+    double FrameTimePercentile(double p) const noexcept
+    {
+        const std::size_t count = m_FrameTimes.CopyTo(&m_Scratch);
+        if (count == 0) return 0.0;
+
+        const std::size_t k = std::min(count - 1, static_cast<std::size_t>(p * static_cast<double>(count - 1) + 0.5));
+        std::nth_element(m_Scratch.begin(), m_Scratch.begin() + static_cast<std::ptrdiff_t>(k), m_Scratch.begin() + static_cast<std::ptrdiff_t>(count));
+        return m_Scratch[k];
+    }
+
+    double AveragePhaseTime(FramePhase phase) const noexcept
+    {
+        return m_PhaseTimes[static_cast<std::size_t>(phase)].Average();
+    }
+
+    double InteractionsPerSecond() const noexcept
+    {
+        const double seconds = m_FrameTimes.Sum() / 1000.0;
+        return seconds > 0.0 ? m_Interactions.Sum() / seconds : 0.0;
+    }
+
+    double SimulatedDaysPerSecond() const noexcept
+    {
+        const double seconds = m_FrameTimes.Sum() / 1000.0;
+        return seconds > 0.0 ? m_SimulatedTime.Sum() / seconds / (60.0 * 60.0 * 24.0) : 0.0;
+    }
+
+    double InstructionsPerCycle() const noexcept
+    {
+        const double cycles = m_Counters[static_cast<std::size_t>(PerfCounters::Counter::Cycles)].Sum();
+        return cycles > 0.0 ? m_Counters[static_cast<std::size_t>(PerfCounters::Counter::Instructions)].Sum() / cycles : 0.0;
+    }
+
+    double CounterPerInteraction(PerfCounters::Counter counter) const noexcept
+    {
+        const double interactions = m_Interactions.Sum();
+        return interactions > 0.0 ? m_Counters[static_cast<std::size_t>(counter)].Sum() / interactions : 0.0;
+    }
+
+    const RingBuffer<double, History>& FrameTimes() const noexcept
+    {
+        return m_FrameTimes;
+    }
+};
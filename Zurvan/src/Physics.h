@@ -1,7 +1,11 @@
 #pragma once
+#include <cmath>
+#include <vector>
 
 #include "Math.h"
 #include "Config.h"
+#include "Profiler.h"
+#include "PerfCounters.h"
 
 namespace Physics
 {
@@ -10,77 +14,101 @@ namespace Physics
         constexpr FLOAT G = static_cast<FLOAT>(6.67430e-11); // m^3 / (kg * s^2)
         constexpr FLOAT Pi = static_cast<FLOAT>(3.14159265358979323846f);
 
-        /*
-            Mass in KG
-            Sun distance in meters
-            Speed (around the sun) in meters per second
-            Incline (approximate orbital inclinations of the major planets relative to the ecliptic plane (the Earth's orbital plane)) in radians
-            Radius in meters
-        */
-        constexpr FLOAT SUN_MASS             = static_cast<FLOAT>(1.988416e30);
-        constexpr FLOAT SUN_INCLINE          = static_cast<FLOAT>(0);
-        constexpr FLOAT SUN_RADIUS           = static_cast<FLOAT>(696265000);
-
-        constexpr FLOAT EARTH_MASS           = static_cast<FLOAT>(5.972e24);
-        constexpr FLOAT EARTH_SUN_DISTANCE   = static_cast<FLOAT>(149000000000);
-        constexpr FLOAT EARTH_SPEED          = static_cast<FLOAT>(29722.2222);
-        constexpr FLOAT EARTH_INCLINE        = static_cast<FLOAT>(0);
-        constexpr FLOAT EARTH_RADIUS         = static_cast<FLOAT>(6378000);
-
-        constexpr FLOAT JUPITER_MASS         = static_cast<FLOAT>(1.89813e27);
-        constexpr FLOAT JUPTIER_SPEED        = static_cast<FLOAT>(13000);
-        constexpr FLOAT JUPTIER_SUN_DISTANCE = static_cast<FLOAT>(778000000000);
-        constexpr FLOAT JUPTIER_INCLINE      = static_cast<FLOAT>(0.023);
-        constexpr FLOAT JUPITER_RADIUS       = static_cast<FLOAT>(69911000);
-
-        constexpr FLOAT MERCURY_MASS         = static_cast<FLOAT>(3.30104e23);
-        constexpr FLOAT MERCURY_SPEED        = static_cast<FLOAT>(47870);
-        constexpr FLOAT MERCURY_SUN_DISTANCE = static_cast<FLOAT>(58000000000);
-        constexpr FLOAT MERCURY_INCLINE      = static_cast<FLOAT>(0.122);
-        constexpr FLOAT MERCURY_RADIUS       = static_cast<FLOAT>(2439700);
-
-        constexpr FLOAT VENUS_MASS           = static_cast<FLOAT>(4.867e24);
-        constexpr FLOAT VENUS_SPEED          = static_cast<FLOAT>(35000);
-        constexpr FLOAT VENUS_SUN_DISTANCE   = static_cast<FLOAT>(108000000000);
-        constexpr FLOAT VENUS_INCLINE        = static_cast<FLOAT>(0.059);
-        constexpr FLOAT VENUS_RADIUS         = static_cast<FLOAT>(6051800);
-
-        constexpr FLOAT MARS_MASS            = static_cast<FLOAT>(6.39e23);
-        constexpr FLOAT MARS_SPEED           = static_cast<FLOAT>(24100);
-        constexpr FLOAT MARS_SUN_DISTANCE    = static_cast<FLOAT>(227900000000);
-        constexpr FLOAT MARS_INCLINE         = static_cast<FLOAT>(0.032);
-        constexpr FLOAT MARS_RADIUS          = static_cast<FLOAT>(3389500);
-
-        constexpr FLOAT SATURN_MASS          = static_cast<FLOAT>(5.683e26);
-        constexpr FLOAT SATURN_SPEED         = static_cast<FLOAT>(9672);
-        constexpr FLOAT SATURN_SUN_DISTANCE  = static_cast<FLOAT>(1400000000000);
-        constexpr FLOAT SATURN_INCLINE       = static_cast<FLOAT>(0.044);
-        constexpr FLOAT SATURN_RADIUS        = static_cast<FLOAT>(58232000);
-
-        constexpr FLOAT URANUS_MASS          = static_cast<FLOAT>(8.681e25);
-        constexpr FLOAT URANUS_SPEED         = static_cast<FLOAT>(6835);
-        constexpr FLOAT URANUS_SUN_DISTANCE  = static_cast<FLOAT>(2900000000000);
-        constexpr FLOAT URANUS_INCLINE       = static_cast<FLOAT>(0.013);
-        constexpr FLOAT URANUS_RADIUS        = static_cast<FLOAT>(25362000);
-
-        constexpr FLOAT NEPTUN_MASS          = static_cast<FLOAT>(1.024e26);
-        constexpr FLOAT NEPTUN_SPEED         = static_cast<FLOAT>(5430);
-        constexpr FLOAT NEPTUN_SUN_DISTANCE  = static_cast<FLOAT>(4500000000000);
-        constexpr FLOAT NEPTUN_INCLINE       = static_cast<FLOAT>(0.031);
-        constexpr FLOAT NEPTUN_RADIUS        = static_cast<FLOAT>(24622000);
-
-        constexpr FLOAT PLUTO_MASS = static_cast<FLOAT>(1.303e22);
-        constexpr FLOAT PLUTO_SPEED = static_cast<FLOAT>(4748);
-        constexpr FLOAT PLUTO_SUN_DISTANCE = static_cast<FLOAT>(5900000000000);
-        constexpr FLOAT PLUTO_INCLINE = static_cast<FLOAT>(0.2994985);
-        constexpr FLOAT PLUTO_RADIUS = static_cast<FLOAT>(1188000);
-
-        // Commented out because unused (yet)
-        //constexpr FLOAT MOON_MASS = 7.347e22; // kg
-        //constexpr FLOAT MOON_EARTH_DISTANCE = 384400000; // meters
-        //constexpr FLOAT MOON_SPEED = 1022; // meters per second
-        //constexpr FLOAT MOON_INCLINE = 0.0872665;
-        //constexpr FLOAT MOON_RADIUS = static_cast<FLOAT>(1737000);
+        // The bodies themselves, moons included (Earth/Moon rows), come from a catalog (Catalog.h), the
+        // asteroid belt orbits a sun of this mass
+        constexpr FLOAT SUN_MASS = static_cast<FLOAT>(1.988416e30); // kg
+    };
+
+
+    // Conserved quantities of a state. The integrators accumulate them for the state at the start of the step
+    // during their first pairwise pass, only the potential needs the pairs and it reuses their distances.
+    struct Invariants
+    {
+        double kinetic = 0.0;
+        double potential = 0.0;
+        Math::Vector3<double> momentum;
+        Math::Vector3<double> angularMomentum; // about the origin
+        double momentumScale = 0.0; // sum of |m * v|, the reference for the momentum drift
+
+        double Energy() const noexcept
+        {
+            return kinetic + potential;
+        }
+
+        template <typename T>
+        void AddBody(const Math::Vector3<T>& position, const Math::Vector3<T>& velocity, T mass) noexcept
+        {
+            const double m = static_cast<double>(mass);
+            const Math::Vector3<double> r(static_cast<double>(position.x), static_cast<double>(position.y), static_cast<double>(position.z));
+            const Math::Vector3<double> v(static_cast<double>(velocity.x), static_cast<double>(velocity.y), static_cast<double>(velocity.z));
+            const double speed = v.Length();
+            kinetic += 0.5 * m * speed * speed;
+            momentum += v * m;
+            angularMomentum += Math::Vector3<double>(r.y * v.z - r.z * v.y, r.z * v.x - r.x * v.z, r.x * v.y - r.y * v.x) * m;
+            momentumScale += m * speed;
+        }
+
+        // Potential energy of one pair
+        void AddPair(double massA, double massB, double distance) noexcept
+        {
+            potential -= static_cast<double>(Const::G) * massA * massB / distance;
+        }
+
+        Invariants& operator+=(const Invariants& other) noexcept
+        {
+            kinetic += other.kinetic;
+            potential += other.potential;
+            momentum += other.momentum;
+            angularMomentum += other.angularMomentum;
+            momentumScale += other.momentumScale;
+            return *this;
+        }
+    };
+
+
+    // Relative drift of the invariants since Reset(), which has to be called whenever the bodies change
+    // other than by integration (loading, merging)
+    class DriftMonitor
+    {
+    private:
+        Invariants m_Initial;
+        Invariants m_Current;
+        bool m_HasInitial = false;
+    public:
+        void Reset() noexcept
+        {
+            m_HasInitial = false;
+        }
+
+        void Update(const Invariants& invariants) noexcept
+        {
+            if (!m_HasInitial)
+                m_Initial = invariants;
+            m_Current = invariants;
+            m_HasInitial = true;
+        }
+
+        bool HasValues() const noexcept
+        {
+            return m_HasInitial;
+        }
+
+        double EnergyDrift() const noexcept
+        {
+            return m_Initial.Energy() != 0.0 ? std::abs((m_Current.Energy() - m_Initial.Energy()) / m_Initial.Energy()) : 0.0;
+        }
+
+        // The total momentum is zero in the barycentric frame, so the drift is relative to the momentum of the parts
+        double MomentumDrift() const noexcept
+        {
+            return m_Initial.momentumScale != 0.0 ? (m_Current.momentum - m_Initial.momentum).Length() / m_Initial.momentumScale : 0.0;
+        }
+
+        double AngularMomentumDrift() const noexcept
+        {
+            const double initial = m_Initial.angularMomentum.Length();
+            return initial != 0.0 ? (m_Current.angularMomentum - m_Initial.angularMomentum).Length() / initial : 0.0;
+        }
     };
 
 
@@ -108,23 +136,23 @@ namespace Physics
     public:
         RigidBody() = default;
 
-        RigidBody(T distanceToCenter, T velocityAroundCenter, T mass, double radius, double inclination, const char* name, Color color)
-            : m_Mass(mass), m_Radius(radius), m_Label(name), m_Color(color)
-        {
-            m_Position.x = distanceToCenter;
-            m_Position.y = distanceToCenter * static_cast<FLOAT>(std::sin(inclination));
-            m_Position.z = 0;
+        RigidBody(const Math::Vector3<T>& position, const Math::Vector3<T>& velocity, T mass, double radius, const char* name, Color color)
+            : m_Position(position), m_Velocity(velocity), m_Mass(mass), m_Radius(radius), m_Label(name), m_Color(color)
+        {}
 
-            m_Velocity.x = 0;
-            m_Velocity.y = velocityAroundCenter * static_cast<FLOAT>(std::sin(inclination));
-            m_Velocity.z = velocityAroundCenter * static_cast<FLOAT>(std::cos(inclination));
+        Math::Vector3<T> ComputeAcceleration(const RigidBody& other) const noexcept
+        {
+            T distance;
+            return ComputeAcceleration(other, &distance);
         }
 
-        Math::Vector3<T> ComputeAcceleration(const RigidBody& other) const noexcept
+        // Also returns the (clamped) distance, e.g. for the potential energy
+        Math::Vector3<T> ComputeAcceleration(const RigidBody& other, T* distanceOut) const noexcept
         {
             Math::Vector3<T> direction = other.m_Position - m_Position;
             T distance = direction.Length();
             if (distance < static_cast<T>(1)) distance = static_cast<T>(1);
+            *distanceOut = distance;
 
             const T force = static_cast<T>(Const::G * other.m_Mass) / (distance * distance);
             direction = direction.Normalize() * force;
@@ -163,6 +191,11 @@ namespace Physics
             m_Mass = mass;
         }
 
+        constexpr void SetRadius(double radius) noexcept
+        {
+            m_Radius = radius;
+        }
+
         constexpr void SetColor(Color color) noexcept
         {
             m_Color = color;
@@ -210,35 +243,63 @@ namespace Physics
     };
 
 
-    //template <typename T>
-    //constexpr Math::Vector3<T> ComputeBarycenter(Physics::RigidBody<T>* bodies[], int count)
-    //{
-    //    T totalMass = static_cast<T>(0);
-    //    Math::Vector3<T> weighted;
-    //
-    //    for (int i = 0; i < count; i++)
-    //    {
-    //        totalMass += bodies[i].GetMass();
-    //        weighted += bodies[i].GetPosition() * bodies[i].GetMass();
-    //    }
-    //
-    //    return weighted * (static_cast<T>(1) / totalMass);
-    //}
+    template <typename T>
+    void ComputeBarycenter(const std::vector<RigidBody<T>>& bodies, Math::Vector3<T>* position, Math::Vector3<T>* velocity) noexcept
+    {
+        T totalMass = static_cast<T>(0);
+        Math::Vector3<T> weightedPosition, weightedVelocity;
+        for (const RigidBody<T>& body : bodies)
+        {
+            totalMass += body.GetMass();
+            weightedPosition += body.GetPosition() * body.GetMass();
+            weightedVelocity += body.GetVelocity() * body.GetMass();
+        }
+
+        const T inverse = totalMass != static_cast<T>(0) ? static_cast<T>(1) / totalMass : static_cast<T>(0);
+        *position = weightedPosition * inverse;
+        *velocity = weightedVelocity * inverse;
+    }
+
+
+    // Catalogs place the sun at rest at the origin, which leaves the whole system drifting with the
+    // momentum of the planets. Afterwards the barycenter is at rest at the origin.
+    template <typename T>
+    void ToBarycentricFrame(std::vector<RigidBody<T>>* bodies) noexcept
+    {
+        Math::Vector3<T> position, velocity;
+        ComputeBarycenter(*bodies, &position, &velocity);
+        for (RigidBody<T>& body : *bodies)
+        {
+            body.SetPosition(body.GetPosition() - position);
+            body.SetVelocity(body.GetVelocity() - velocity);
+        }
+    }
 
 
-    inline void EulerIntegration(std::vector<Physics::RigidBody<FLOAT>>* bodies, double timeStep, float dt) noexcept
+    // invariants (optional) receives the conserved quantities of the state before the step
+    inline void EulerIntegration(std::vector<Physics::RigidBody<FLOAT>>* bodies, double timeStep, float dt, Invariants* invariants = nullptr) noexcept
     {
+        PROFILE_SCOPE("EulerIntegration");
+        PERF_COUNTERS_SCOPE(PerfCounters::Phase::Accelerations); // forces and updates are interleaved
         std::vector<Physics::RigidBody<FLOAT>>& bodiesRef = *bodies;
+        if (invariants != nullptr) *invariants = Invariants();
 
         for (size_t i = 0; i < bodiesRef.size(); ++i)
         {
+            // Bodies after i aren't moved yet, so pairs with them still see the state before the step
+            if (invariants != nullptr)
+                invariants->AddBody(bodiesRef[i].GetPosition(), bodiesRef[i].GetVelocity(), bodiesRef[i].GetMass());
+
             Math::Vector3<FLOAT> acc;
             for (size_t k = 0; k < bodiesRef.size(); ++k)
             {
                 if (i != k)
                 {
-                    Math::Vector3<FLOAT> a = bodiesRef[i].ComputeAcceleration(bodiesRef[k]);
+                    FLOAT distance;
+                    Math::Vector3<FLOAT> a = bodiesRef[i].ComputeAcceleration(bodiesRef[k], &distance);
                     acc += a;
+                    if (invariants != nullptr && k > i)
+                        invariants->AddPair(bodiesRef[i].GetMass(), bodiesRef[k].GetMass(), distance);
                 }
             }
             bodiesRef[i].SetVelocity(bodiesRef[i].GetVelocity() + (acc * (timeStep * dt)));
@@ -247,51 +308,75 @@ namespace Physics
     }
 
 
-    inline void VelocityVerlet(std::vector<Physics::RigidBody<FLOAT>>* bodies, double timeStep, float delatTime) noexcept
+    inline void VelocityVerlet(std::vector<Physics::RigidBody<FLOAT>>* bodies, double timeStep, float delatTime, Invariants* invariants = nullptr) noexcept
     {
+        PROFILE_SCOPE("VelocityVerlet");
         std::vector<Physics::RigidBody<FLOAT>>& bodiesRef = *bodies;
         std::vector<Math::Vector3<FLOAT>> oldAccelerations(bodiesRef.size());
+        if (invariants != nullptr) *invariants = Invariants();
 
         // First, compute all initial accelerations
-        for (size_t i = 0; i < bodiesRef.size(); ++i)
         {
-            Math::Vector3<FLOAT> acc;
-            for (size_t j = 0; j < bodiesRef.size(); ++j)
+            PROFILE_SCOPE("ComputeAccelerations");
+            PERF_COUNTERS_SCOPE(PerfCounters::Phase::Accelerations);
+            for (size_t i = 0; i < bodiesRef.size(); ++i)
             {
-                if (i != j)
-                    acc += bodiesRef[i].ComputeAcceleration(bodiesRef[j]);
+                if (invariants != nullptr)
+                    invariants->AddBody(bodiesRef[i].GetPosition(), bodiesRef[i].GetVelocity(), bodiesRef[i].GetMass());
+
+                Math::Vector3<FLOAT> acc;
+                for (size_t j = 0; j < bodiesRef.size(); ++j)
+                {
+                    if (i != j)
+                    {
+                        FLOAT distance;
+                        acc += bodiesRef[i].ComputeAcceleration(bodiesRef[j], &distance);
+                        if (invariants != nullptr && j > i)
+                            invariants->AddPair(bodiesRef[i].GetMass(), bodiesRef[j].GetMass(), distance);
+                    }
+                }
+                oldAccelerations[i] = acc;
             }
-            oldAccelerations[i] = acc;
         }
 
         // Now do Velocity Verlet integration
-        for (size_t i = 0; i < bodiesRef.size(); ++i)
         {
-            const FLOAT dt = static_cast<FLOAT>(timeStep * delatTime);
+            PROFILE_SCOPE("UpdatePositions");
+            PERF_COUNTERS_SCOPE(PerfCounters::Phase::Update);
+            for (size_t i = 0; i < bodiesRef.size(); ++i)
+            {
+                const FLOAT dt = static_cast<FLOAT>(timeStep * delatTime);
 
-            auto pos = bodiesRef[i].GetPosition();
-            auto vel = bodiesRef[i].GetVelocity();
-            auto acc = oldAccelerations[i];
+                auto pos = bodiesRef[i].GetPosition();
+                auto vel = bodiesRef[i].GetVelocity();
+                auto acc = oldAccelerations[i];
 
-            // Update position
-            Math::Vector3<FLOAT> newPos = pos + vel * dt + acc * (0.5 * dt * dt);
-            bodiesRef[i].SetPosition(newPos);
+                // Update position
+                Math::Vector3<FLOAT> newPos = pos + vel * dt + acc * (0.5 * dt * dt);
+                bodiesRef[i].SetPosition(newPos);
+            }
         }
 
         // Recompute accelerations at new positions
         std::vector<Math::Vector3<FLOAT>> newAccelerations(bodiesRef.size());
-        for (size_t i = 0; i < bodiesRef.size(); ++i)
         {
-            Math::Vector3<FLOAT> acc;
-            for (size_t j = 0; j < bodiesRef.size(); ++j)
+            PROFILE_SCOPE("ComputeAccelerations");
+            PERF_COUNTERS_SCOPE(PerfCounters::Phase::Accelerations);
+            for (size_t i = 0; i < bodiesRef.size(); ++i)
             {
-                if (i != j)
-                    acc += bodiesRef[i].ComputeAcceleration(bodiesRef[j]);
+                Math::Vector3<FLOAT> acc;
+                for (size_t j = 0; j < bodiesRef.size(); ++j)
+                {
+                    if (i != j)
+                        acc += bodiesRef[i].ComputeAcceleration(bodiesRef[j]);
+                }
+                newAccelerations[i] = acc;
             }
-            newAccelerations[i] = acc;
         }
 
         // Update velocities using average of old and new accelerations
+        PROFILE_SCOPE("UpdateVelocities");
+        PERF_COUNTERS_SCOPE(PerfCounters::Phase::Update);
         for (size_t i = 0; i < bodiesRef.size(); ++i)
         {
             const FLOAT dt = static_cast<FLOAT>(timeStep * delatTime);
@@ -306,8 +391,9 @@ namespace Physics
     }
 
 
-    inline void RungeKutta4th(std::vector<Physics::RigidBody<FLOAT>>* bodies, double timeStep, float delatTime)
+    inline void RungeKutta4th(std::vector<Physics::RigidBody<FLOAT>>* bodies, double timeStep, float delatTime, Invariants* invariants = nullptr)
     {
+        PROFILE_SCOPE("RungeKutta4th");
         std::vector<Physics::RigidBody<FLOAT>>& bodiesRef = *bodies;
 
         const FLOAT dt = static_cast<FLOAT>(timeStep * delatTime);
@@ -321,7 +407,10 @@ namespace Physics
         }
         
         // Helper: Compute all accelerations from positions
-        auto ComputeAllAccelerations = [&](const std::vector<Math::Vector3<FLOAT>>& pos) {
+        // Accumulates the potential into invariants if it isn't null
+        auto ComputeAllAccelerations = [&](const std::vector<Math::Vector3<FLOAT>>& pos, Invariants* invariants) {
+            PROFILE_SCOPE("ComputeAccelerations");
+            PERF_COUNTERS_SCOPE(PerfCounters::Phase::Accelerations);
             std::vector<Math::Vector3<FLOAT>> accs(N);
             for (size_t i = 0; i < N; ++i) {
                 Math::Vector3<FLOAT> acc;
@@ -332,12 +421,20 @@ namespace Physics
                         if (dist < 1.0) dist = 1.0;
                         FLOAT force = static_cast<FLOAT>(Physics::Const::G * bodiesRef[j].GetMass()) / (dist * dist);
                         acc += dir.Normalize() * force;
+                        if (invariants != nullptr && j > i)
+                            invariants->AddPair(bodiesRef[i].GetMass(), bodiesRef[j].GetMass(), dist);
                     }
                 }
                 accs[i] = acc;
             }
             return accs;
             };
+
+        if (invariants != nullptr) {
+            *invariants = Invariants();
+            for (size_t i = 0; i < N; ++i)
+                invariants->AddBody(positions[i], velocities[i], bodiesRef[i].GetMass());
+        }
         
         // --- RK4 Steps ---
         std::vector<Math::Vector3<FLOAT>> k1_v(N), k1_p(N);
@@ -346,7 +443,7 @@ namespace Physics
         std::vector<Math::Vector3<FLOAT>> k4_v(N), k4_p(N);
         
         // k1
-        auto acc1 = ComputeAllAccelerations(positions);
+        auto acc1 = ComputeAllAccelerations(positions, invariants);
         for (size_t i = 0; i < N; ++i) {
             k1_v[i] = acc1[i] * dt;
             k1_p[i] = velocities[i] * dt;
@@ -358,7 +455,7 @@ namespace Physics
             pos_k2[i] = positions[i] + k1_p[i] * 0.5f;
             vel_k2[i] = velocities[i] + k1_v[i] * 0.5f;
         }
-        auto acc2 = ComputeAllAccelerations(pos_k2);
+        auto acc2 = ComputeAllAccelerations(pos_k2, nullptr);
         for (size_t i = 0; i < N; ++i) {
             k2_v[i] = acc2[i] * dt;
             k2_p[i] = vel_k2[i] * dt;
@@ -370,7 +467,7 @@ namespace Physics
             pos_k3[i] = positions[i] + k2_p[i] * 0.5f;
             vel_k3[i] = velocities[i] + k2_v[i] * 0.5f;
         }
-        auto acc3 = ComputeAllAccelerations(pos_k3);
+        auto acc3 = ComputeAllAccelerations(pos_k3, nullptr);
         for (size_t i = 0; i < N; ++i) {
             k3_v[i] = acc3[i] * dt;
             k3_p[i] = vel_k3[i] * dt;
@@ -382,13 +479,14 @@ namespace Physics
             pos_k4[i] = positions[i] + k3_p[i];
             vel_k4[i] = velocities[i] + k3_v[i];
         }
-        auto acc4 = ComputeAllAccelerations(pos_k4);
+        auto acc4 = ComputeAllAccelerations(pos_k4, nullptr);
         for (size_t i = 0; i < N; ++i) {
             k4_v[i] = acc4[i] * dt;
             k4_p[i] = vel_k4[i] * dt;
         }
         
         // Final update
+        PERF_COUNTERS_SCOPE(PerfCounters::Phase::Update);
         for (size_t i = 0; i < N; ++i) {
             Math::Vector3<FLOAT> newVel = velocities[i] + (k1_v[i] + k2_v[i] * 2.0 + k3_v[i] * 2.0 + k4_v[i]) / 6.0;
             Math::Vector3<FLOAT> newPos = positions[i] + (k1_p[i] + k2_p[i] * 2.0 + k3_p[i] * 2.0 + k4_p[i]) / 6.0;
@@ -0,0 +1,153 @@
+#pragma once
+
+/*
+    Scoped zone profiler with Chrome trace-event export (open the file in chrome://tracing or ui.perfetto.dev).
+    Every thread records into its own ring buffer, the hot path is a clock read and a store without locks.
+    Distribution builds compile all zones away, use PROFILE_SCOPE / PROFILE_FUNCTION instead of Profiler::Scope.
+*/
+#if !defined(CONFIG_DISTRIBUTION)
+    #define PROFILER_ENABLED
+#endif
+
+#ifdef PROFILER_ENABLED
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstddef>
+
+namespace Profiler
+{
+    struct Event
+    {
+        const char* name;
+        int64_t start;    // nanoseconds
+        int64_t duration; // nanoseconds
+    };
+
+
+    class ThreadBuffer
+    {
+    public:
+        static constexpr std::size_t Capacity = 1 << 16; // power of two, ~1 minute of history at 60 FPS
+    private:
+        std::unique_ptr<Event[]> m_Events;
+        std::atomic<uint64_t> m_Head{ 0 }; // only ever written by the owning thread
+        uint32_t m_ThreadId;
+    public:
+        explicit ThreadBuffer(uint32_t threadId) : m_Events(new Event[Capacity]), m_ThreadId(threadId) {}
+
+        void Push(const char* name, int64_t start, int64_t duration) noexcept
+        {
+            const uint64_t head = m_Head.load(std::memory_order_relaxed);
+            m_Events[head & (Capacity - 1)] = Event{ name, start, duration };
+            m_Head.store(head + 1, std::memory_order_release);
+        }
+
+        // Events that are overwritten while exporting may come out torn, that's acceptable for a debug dump
+        template <typename Func>
+        void ForEach(Func&& func) const
+        {
+            const uint64_t head = m_Head.load(std::memory_order_acquire);
+            const uint64_t first = head > Capacity ? head - Capacity : 0;
+            for (uint64_t i = first; i < head; ++i)
+                func(m_Events[i & (Capacity - 1)]);
+        }
+
+        uint32_t ThreadId() const noexcept
+        {
+            return m_ThreadId;
+        }
+    };
+
+
+    namespace Detail
+    {
+        // Buffers are never freed so events of finished threads can still be exported
+        inline std::mutex s_RegistryMutex;
+        inline std::vector<std::unique_ptr<ThreadBuffer>> s_Buffers;
+
+        inline ThreadBuffer* RegisterThread()
+        {
+            std::lock_guard<std::mutex> lock(s_RegistryMutex);
+            s_Buffers.push_back(std::make_unique<ThreadBuffer>(static_cast<uint32_t>(s_Buffers.size())));
+            return s_Buffers.back().get();
+        }
+
+        inline ThreadBuffer& LocalBuffer()
+        {
+            thread_local ThreadBuffer* buffer = RegisterThread();
+            return *buffer;
+        }
+
+        inline int64_t Now() noexcept
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        inline void WriteEscaped(std::FILE* file, const char* text)
+        {
+            for (; *text != '\0'; ++text)
+            {
+                if (*text == '"' || *text == '\\')
+                    std::fputc('\\', file);
+                std::fputc(*text, file);
+            }
+        }
+    }
+
+
+    class Scope
+    {
+    private:
+        const char* m_Name;
+        int64_t m_Start;
+    public:
+        explicit Scope(const char* name) noexcept : m_Name(name), m_Start(Detail::Now()) {}
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        ~Scope()
+        {
+            Detail::LocalBuffer().Push(m_Name, m_Start, Detail::Now() - m_Start);
+        }
+    };
+
+
+    inline bool WriteChromeTrace(const char* path)
+    {
+        std::FILE* file = std::fopen(path, "w");
+        if (file == nullptr)
+            return false;
+
+        std::fputs("{\"traceEvents\":[\n", file);
+        bool first = true;
+        {
+            std::lock_guard<std::mutex> lock(Detail::s_RegistryMutex);
+            for (const auto& buffer : Detail::s_Buffers)
+            {
+                buffer->ForEach([&](const Event& event)
+                {
+                    std::fputs(first ? "{\"name\":\"" : ",\n{\"name\":\"", file);
+                    Detail::WriteEscaped(file, event.name);
+                    std::fprintf(file, "\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", buffer->ThreadId(), static_cast<double>(event.start) / 1000.0, static_cast<double>(event.duration) / 1000.0);
+                    first = false;
+                });
+            }
+        }
+        std::fputs("\n],\"displayTimeUnit\":\"ms\"}\n", file);
+        return std::fclose(file) == 0;
+    }
+}
+
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+#define PROFILE_SCOPE(name) const Profiler::Scope PROFILE_CONCAT(profilerScope, __LINE__)(name)
+#define PROFILE_FUNCTION() PROFILE_SCOPE(__func__)
+#else
+#define PROFILE_SCOPE(name)
+#define PROFILE_FUNCTION()
+#endif // PROFILER_ENABLED
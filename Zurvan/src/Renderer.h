@@ -4,57 +4,128 @@
 #include <cstdio>
 #include <cstring>
 #include <cstddef>
+#include <algorithm>
+#include <utility>
 
 #include "raylib.h"
 #include "raymath.h"
+#include "rlgl.h"
 
-#include "Font.h"
+#include "FontAtlas.h"
 #include "Physics.h"
+#include "Profiler.h"
+#include "SphereRenderer.h"
+#include "ParticleRenderer.h"
+#include "TrailRenderer.h"
+#include "GridRenderer.h"
+#include "LabelLayer.h"
+#include "Frustum.h"
+#include "HudText.h"
 
 #define ARRAY_SIZE(x) (sizeof(x) / sizeof(*x))
 
 class Renderer
 {
 private:
-    static inline Font s_RenderFontText;
-    static inline Font s_RenderFontUI;
+    static inline Font s_Font;
+    static inline Shader s_TextShader;
 public:
     static constexpr int FontSize = 25;
+    static constexpr int FontSizeUI = 20;
+
+    // Clip planes in world units. The camera always sits at the render origin and depth is logarithmic
+    // (see Shaders.h), so the far plane can cover everything out to the Oort cloud.
+    static constexpr double NearPlane = 0.01;
+    static constexpr double FarPlane = 1e12;
 public:
     static void Init() noexcept
     {
-        // We have to load the same font twice with different sizes, otherwise the font will look really
-        // bad even though we scale it down
-        s_RenderFontText = LoadFontFromMemory(".ttf", sg_Font, sg_FontSize, 25, NULL, 0);
-        SetTextureFilter(s_RenderFontText.texture, TEXTURE_FILTER_POINT);
-
-        s_RenderFontUI = LoadFontFromMemory(".ttf", sg_Font, sg_FontSize, 20, NULL, 0);
-        SetTextureFilter(s_RenderFontUI.texture, TEXTURE_FILTER_POINT);
+        // One signed distance field atlas baked at build time (Tools/FontBaker) serves every text size, it
+        // has to be sampled bilinearly and drawn between BeginText and EndText
+        s_Font = BakedFont::Load(sg_FontAtlasSdf32);
+        SetTextureFilter(s_Font.texture, TEXTURE_FILTER_BILINEAR);
+        s_TextShader = LoadShaderFromMemory(Shaders::TextVertex, Shaders::TextFragment);
+
+        rlSetClipPlanes(NearPlane, FarPlane);
+
+        HudText::Init(&s_Font, FontSize);
+        SphereRenderer::Init();
+        ParticleRenderer::Init();
+        TrailRenderer::Init();
+        GridRenderer::Init();
     }
 
     static void Shutdown() noexcept
     {
-        UnloadFont(s_RenderFontText);
-        UnloadFont(s_RenderFontUI);
+        UnloadFont(s_Font);
+        UnloadShader(s_TextShader);
+        HudText::Shutdown();
+        SphereRenderer::Shutdown();
+        ParticleRenderer::Shutdown();
+        TrailRenderer::Shutdown();
+        GridRenderer::Shutdown();
+    }
+
+    static Math::Vector3<double> MetersToWorld(const Math::Vector3<double>& meters, double distanceScale) noexcept
+    {
+        return meters / distanceScale;
+    }
+
+    // Everything is rendered relative to the camera. The subtraction happens in double precision so only
+    // the small camera relative offset is rounded to float.
+    static Vector3 WorldToRender(const Math::Vector3<double>& world, const Math::Vector3<double>& cameraPosition) noexcept
+    {
+        return (world - cameraPosition).ToRaylibVector();
+    }
+
+    // Everything drawn in between uses the distance field shader, the GUI draws its shapes from the
+    // atlas' white texel so it can be drawn in the same pass (see GetWhiteRec)
+    static void BeginText() noexcept
+    {
+        BeginShaderMode(s_TextShader);
     }
 
-    static Vector3 MetersToWorld(Vector3 meters, float distanceScale) noexcept
+    static void EndText() noexcept
     {
-        return Vector3{ meters.x / distanceScale, meters.y / distanceScale, meters.z / distanceScale };
+        EndShaderMode();
     }
 
-    static void DrawText(const char* text, int x, int y, Color color = WHITE) noexcept
+    static void DrawText(const char* text, int x, int y, Color color = WHITE, float size = FontSize) noexcept
     {
-        DrawTextEx(s_RenderFontText, text, { static_cast<float>(x), static_cast<float>(y)}, FontSize, 0, color);
+        DrawTextEx(s_Font, text, { static_cast<float>(x), static_cast<float>(y)}, size, 0, color);
     }
 
+    static Vector2 MeasureText(const char* text, float size = FontSize) noexcept
+    {
+        return MeasureTextEx(s_Font, text, size, 0);
+    }
+
+    // The same atlas as DrawText, raygui scales it to its own text size
     static const Font& GetFontUI() noexcept
     {
-        return s_RenderFontUI;
+        return s_Font;
+    }
+
+    // GenImageFontAtlas leaves a 3x3 white block in the bottom right corner, its center texel is
+    // safe to sample with bilinear filtering
+    static Rectangle GetWhiteRec() noexcept
+    {
+        return { static_cast<float>(s_Font.texture.width - 2), static_cast<float>(s_Font.texture.height - 2), 1.f, 1.f };
     }
 
-    static void Draw3DGridWithAxes(int size, float spacing) noexcept
+    // The grid is fixed to the world origin, cameraPosition is the world position of the camera
+    static void Draw3DGridWithAxes(int size, float spacing, Vector3 cameraPosition) noexcept
     {
+        PROFILE_FUNCTION();
+        if (GridRenderer::Available())
+        {
+            GridRenderer::Draw(size, spacing, cameraPosition, 2.f * static_cast<float>(size) * spacing);
+            return;
+        }
+
+        rlPushMatrix();
+        rlTranslatef(-cameraPosition.x, -cameraPosition.y, -cameraPosition.z);
+
         // Draw grid lines along each axis
         for (int i = -size; i <= size; i++)
         {
@@ -78,35 +149,65 @@ public:
 
         // Draw origin
         //DrawSphere(Vector3{ 0, 0, 0 }, 1.0f, YELLOW);
+        rlPopMatrix();
     }
 
-    static void RenderPlanetLabels(const std::vector<Physics::RigidBody<FLOAT>>& bodies, const Camera& camera, float renderRadiusScale)
+    // Labels are placed by priority (selected body first, then by mass), labels that would overlap an
+    // already placed one are skipped. Bodies culled by the frustum (bodyVisible[i] == 0) get no label.
+    static void RenderPlanetLabels(const std::vector<Physics::RigidBody<FLOAT>>& bodies, const std::vector<uint8_t>& bodyVisible, const Camera& camera, float renderRadiusScale, const Physics::RigidBody<FLOAT>* selected)
     {
-        for (const auto& body : bodies)
+        PROFILE_FUNCTION();
+        static std::vector<float> anchorX, anchorY, anchorZ;
+        static std::vector<std::pair<std::size_t, Vector2>> visible; // body index and projected anchor
+        anchorX.resize(bodies.size());
+        anchorY.resize(bodies.size());
+        anchorZ.resize(bodies.size());
+        for (std::size_t i = 0; i < bodies.size(); ++i)
         {
-            // Get their 3D position
-            Vector3 pos = body.GetRenderPos();
-            pos.y = pos.y + (float)body.GetRadius() / renderRadiusScale;
+            // Anchor on top of the sphere
+            const Vector3 pos = bodies[i].GetRenderPos();
+            anchorX[i] = pos.x;
+            anchorY[i] = pos.y + (float)bodies[i].GetRadius() / renderRadiusScale;
+            anchorZ[i] = pos.z;
+        }
 
-            const Matrix cameraMatrix = GetCameraMatrix(camera);
-            const Vector4 cameraSpace = Vector4{ pos.x, pos.y, pos.z, 1.0f } * cameraMatrix;
+        const int width = GetScreenWidth();
+        const int height = GetScreenHeight();
+        LabelLayer::Begin(width, height);
+        LabelLayer::Project(LabelLayer::ViewProjection(camera, width, height), anchorX.data(), anchorY.data(), anchorZ.data(), bodies.size());
 
-            if (cameraSpace.z > 0) // body not visible
-                continue;
+        visible.clear();
+        for (std::size_t i = 0; i < bodies.size(); ++i)
+        {
+            Vector2 screenPos = { 0.f, 0.f };
+            if (bodyVisible[i] && LabelLayer::Anchor(i, &screenPos))
+                visible.emplace_back(i, screenPos);
+        }
 
-            // Transform to 2D screen coordinates
-            const Vector2 screenPos = GetWorldToScreen(pos, camera);
+        std::sort(visible.begin(), visible.end(), [&](const std::pair<std::size_t, Vector2>& a, const std::pair<std::size_t, Vector2>& b)
+        {
+            const bool selectedA = &bodies[a.first] == selected;
+            const bool selectedB = &bodies[b.first] == selected;
+            if (selectedA != selectedB) return selectedA;
+            return bodies[a.first].GetMass() > bodies[b.first].GetMass();
+        });
 
-            // Draw label above the sphere
-            Renderer::DrawText(body.GetLabel(), (int)screenPos.x - MeasureText(body.GetLabel(), Renderer::FontSize) / 2, (int)screenPos.y - 20);
+        for (const auto& [i, screenPos] : visible)
+        {
+            const Vector2 size = MeasureText(bodies[i].GetLabel());
+            const Rectangle rect = { screenPos.x - size.x / 2, screenPos.y - 20, size.x, size.y };
+            if (LabelLayer::TryPlace(rect))
+                Renderer::DrawText(bodies[i].GetLabel(), (int)rect.x, (int)rect.y);
         }
     }
 
-    static void RenderCoordinateAxis(const Camera& camera) noexcept
+    // cameraPosition is the world position of the camera, the camera itself sits at the render origin
+    static void RenderCoordinateAxis(const Camera& camera, Vector3 cameraPosition) noexcept
     {
-        const Vector3 axisX = { 105, 0, 0 };
-        const Vector3 axisY = { 0, 105, 0 };
-        const Vector3 axisZ = { 0, 0, 105 };
+        PROFILE_FUNCTION();
+        const Vector3 axisX = Vector3Subtract({ 105, 0, 0 }, cameraPosition);
+        const Vector3 axisY = Vector3Subtract({ 0, 105, 0 }, cameraPosition);
+        const Vector3 axisZ = Vector3Subtract({ 0, 0, 105 }, cameraPosition);
 
         const Matrix cameraMatrix = GetCameraMatrix(camera);
         const Vector4 cameraSpaceX = Vector4{ axisX.x, axisX.y, axisX.z, 1.0f } * cameraMatrix;
@@ -122,9 +223,9 @@ public:
         const Vector2 screenZ = GetWorldToScreen(axisZ, camera);
 
         // Get text width/height for centering
-        const int widthX = MeasureText("X", Renderer::FontSize);
-        const int widthY = MeasureText("Y", Renderer::FontSize);
-        const int widthZ = MeasureText("Z", Renderer::FontSize);
+        const int widthX = static_cast<int>(MeasureText("X").x);
+        const int widthY = static_cast<int>(MeasureText("Y").x);
+        const int widthZ = static_cast<int>(MeasureText("Z").x);
 
         // Draw centered labels
         Renderer::DrawText("X", (int)screenX.x - widthX / 2, (int)screenX.y - Renderer::FontSize / 2, RED);
@@ -134,40 +235,25 @@ public:
 
     static void RenderPlanetStats(const Physics::RigidBody<FLOAT>* const body) noexcept
     {
+        PROFILE_FUNCTION();
         if (body != nullptr)
         {
-            char text[64];
-            constexpr std::size_t textSize = ARRAY_SIZE(text);
-            std::snprintf(text, textSize, "Name: %s", body->GetLabel());
-            Renderer::DrawText(text, 10, 100);
-
-            std::snprintf(text, textSize, "Position X: %.f", body->GetPosition().x);
-            Renderer::DrawText(text, 10, 120);
-
-            std::snprintf(text, textSize, "Position Y: %.f", body->GetPosition().y);
-            Renderer::DrawText(text, 10, 140);
-
-            std::snprintf(text, textSize, "Position Z: %.f", body->GetPosition().z);
-            Renderer::DrawText(text, 10, 160);
-
-            std::snprintf(text, textSize, "Velocity X: %.f M/S", body->GetVelocity().x);
-            Renderer::DrawText(text, 10, 200);
-
-            std::snprintf(text, textSize, "Velocity Y: %.f M/S", body->GetVelocity().y);
-            Renderer::DrawText(text, 10, 220);
-
-            std::snprintf(text, textSize, "Velocity Z: %.f M/S", body->GetVelocity().z);
-            Renderer::DrawText(text, 10, 240);
-
-            std::snprintf(text, textSize, "Mass: %e KG", body->GetMass());
-            Renderer::DrawText(text, 10, 280);
+            char name[64];
+            std::snprintf(name, ARRAY_SIZE(name), "Name: %s", body->GetLabel());
+            HudText::Set(HudLine::BodyName, name, 10, 100);
+            HudText::Format(HudLine::PositionX, 10, 120, WHITE, "Position X: %.f", body->GetPosition().x);
+            HudText::Format(HudLine::PositionY, 10, 140, WHITE, "Position Y: %.f", body->GetPosition().y);
+            HudText::Format(HudLine::PositionZ, 10, 160, WHITE, "Position Z: %.f", body->GetPosition().z);
+            HudText::Format(HudLine::VelocityX, 10, 200, WHITE, "Velocity X: %.f M/S", body->GetVelocity().x);
+            HudText::Format(HudLine::VelocityY, 10, 220, WHITE, "Velocity Y: %.f M/S", body->GetVelocity().y);
+            HudText::Format(HudLine::VelocityZ, 10, 240, WHITE, "Velocity Z: %.f M/S", body->GetVelocity().z);
+            HudText::Format(HudLine::Mass, 10, 280, WHITE, "Mass: %e KG", body->GetMass());
 
             const double dist = body->GetPosition().Distance({ 0, 0, 0 });
             if (dist != 0.0)
             {
                 const double angle = std::asin(body->GetPosition().y / dist);
-                std::snprintf(text, textSize, "Inclination: %.4f Radians %.2f Degrees", angle, angle * (180 / Physics::Const::Pi));
-                Renderer::DrawText(text, 10, 300);
+                HudText::Format(HudLine::Inclination, 10, 300, WHITE, "Inclination: %.4f Radians %.2f Degrees", angle, angle * (180 / Physics::Const::Pi));
             }
         }
     }
@@ -175,25 +261,15 @@ public:
 
     static void RenderStats(double elapsedTime, bool showInfoText, double simulationTime, int screenWidth) noexcept
     {
+        PROFILE_FUNCTION();
         const double daysPassed = elapsedTime / (60.0 * 60.0 * 24.0);  // seconds to days
 
-        char text[64];
-        const std::size_t textSize = ARRAY_SIZE(text);
-
-        std::snprintf(text, textSize, "%d FPS", GetFPS());
-        Renderer::DrawText(text, 10, 10);
-
-        std::snprintf(text, textSize, "Days passed: %.2f", daysPassed);
-        Renderer::DrawText(text, 10, 40);
-
-        std::snprintf(text, textSize, "Simulation time: %.4f ms", simulationTime);
-        Renderer::DrawText(text, 10, 60);
+        HudText::Format(HudLine::Fps, 10, 10, WHITE, "%d FPS", GetFPS());
+        HudText::Format(HudLine::DaysPassed, 10, 40, WHITE, "Days passed: %.2f", daysPassed);
+        HudText::Format(HudLine::SimulationTime, 10, 60, WHITE, "Simulation time: %.4f ms", simulationTime);
 
         if (showInfoText)
-        {
-            std::strncpy(text, "Press F1 to open the settings window", textSize);
-            Renderer::DrawText(text, (screenWidth - MeasureText(text, Renderer::FontSize)) / 2, 10);
-        }
+            HudText::Set(HudLine::Info, "Press F1 to open the settings window", screenWidth / 2.f, 10, WHITE, true);
     }
 
 };
\ No newline at end of file
@@ -0,0 +1,240 @@
+#pragma once
+
+/*
+    GLSL sources are written once against these macros and prefixed with the prelude of the target.
+    Desktop builds use GLSL 330, the web build runs on WebGL 1 which only understands GLSL 100 and needs
+    an extension for fwidth.
+*/
+#ifdef SYSTEM_WEB
+    #define SHADER_VERTEX_PRELUDE   "#version 100\n#define ATTRIBUTE attribute\n#define VARYING varying\n"
+    #define SHADER_FRAGMENT_PRELUDE "#version 100\n#extension GL_OES_standard_derivatives : enable\nprecision mediump float;\n#define VARYING varying\n#define FRAG_COLOR gl_FragColor\n#define TEXTURE texture2D\n"
+#else
+    #define SHADER_VERTEX_PRELUDE   "#version 330\n#define ATTRIBUTE in\n#define VARYING out\n"
+    #define SHADER_FRAGMENT_PRELUDE "#version 330\n#define VARYING in\nout vec4 fragColor;\n#define FRAG_COLOR fragColor\n#define TEXTURE texture\n"
+#endif
+
+/*
+    Logarithmic depth for every shader drawing the scene. The clip space z is replaced by the log of the
+    view distance so the whole range up to the far plane keeps its precision, this is what allows a near
+    plane close to the camera and a far plane at the edge of the solar system. It's written per vertex
+    which WebGL 1 can do too, very long primitives may show small depth errors between their vertices.
+*/
+#define SHADER_LOG_DEPTH \
+    "uniform float farPlane;\n" \
+    "vec4 LogDepth(vec4 position)\n" \
+    "{\n" \
+    "    position.z = (log2(max(1e-6, 1.0 + position.w)) * 2.0 / log2(farPlane + 1.0) - 1.0) * position.w;\n" \
+    "    return position;\n" \
+    "}\n"
+
+namespace Shaders
+{
+    // Unlit spheres, one instance per body. The unit sphere is scaled and moved in the vertex shader.
+    inline constexpr const char* SphereVertex = SHADER_VERTEX_PRELUDE SHADER_LOG_DEPTH R"(
+        ATTRIBUTE vec3 vertexPosition;
+        ATTRIBUTE vec4 instancePosition; // xyz center, w radius
+        ATTRIBUTE vec4 instanceColor;
+        uniform mat4 mvp;
+        VARYING vec4 fragTint;
+
+        void main()
+        {
+            fragTint = instanceColor;
+            gl_Position = LogDepth(mvp * vec4(instancePosition.xyz + vertexPosition * instancePosition.w, 1.0));
+        }
+    )";
+
+    inline constexpr const char* SphereFragment = SHADER_FRAGMENT_PRELUDE R"(
+        VARYING vec4 fragTint;
+
+        void main()
+        {
+            FRAG_COLOR = fragTint;
+        }
+    )";
+
+
+    // Camera facing discs for large particle populations. The quad is expanded in view space so the size
+    // shrinks with distance, but never below minPixels so far away particles don't disappear.
+    inline constexpr const char* ParticleVertex = SHADER_VERTEX_PRELUDE SHADER_LOG_DEPTH R"(
+        ATTRIBUTE vec2 vertexPosition; // quad corner in [-1, 1]
+        ATTRIBUTE vec3 instancePosition;
+        uniform mat4 modelview;
+        uniform mat4 projection;
+        uniform float radius;       // world units
+        uniform float pixelToWorld; // world size of one pixel at distance one
+        uniform float minPixels;
+        VARYING vec2 fragCorner;
+
+        void main()
+        {
+            vec4 viewPosition = modelview * vec4(instancePosition, 1.0);
+            float size = max(radius, minPixels * pixelToWorld * -viewPosition.z);
+            viewPosition.xy += vertexPosition * size;
+            fragCorner = vertexPosition;
+            gl_Position = LogDepth(projection * viewPosition);
+        }
+    )";
+
+    inline constexpr const char* ParticleFragment = SHADER_FRAGMENT_PRELUDE R"(
+        uniform vec4 color;
+        VARYING vec2 fragCorner;
+
+        void main()
+        {
+            float distanceSquared = dot(fragCorner, fragCorner);
+            if (distanceSquared > 1.0) discard;
+            FRAG_COLOR = vec4(color.rgb, color.a * (1.0 - smoothstep(0.5, 1.0, distanceSquared)));
+        }
+    )";
+
+
+    // Orbit trails, every instance is one segment between two consecutive ring buffer slots of a body,
+    // extruded to a screen space ribbon. The w component of the positions holds the slot index.
+    inline constexpr const char* TrailVertex = SHADER_VERTEX_PRELUDE SHADER_LOG_DEPTH R"(
+        ATTRIBUTE vec2 vertexPosition; // x 0 at the start, 1 at the end of the segment, y side of the ribbon
+        ATTRIBUTE vec4 segmentStart;
+        ATTRIBUTE vec4 segmentEnd;
+        ATTRIBUTE vec4 instanceColor;
+        uniform mat4 mvp;
+        uniform vec2 viewport;
+        uniform float head;   // slot of the newest sample
+        uniform float slots;
+        uniform float filled; // number of valid samples
+        uniform float width;  // pixels
+        VARYING vec4 fragTint;
+
+        void main()
+        {
+            float ageStart = mod(head - segmentStart.w + slots, slots);
+            float ageEnd = mod(head - segmentEnd.w + slots, slots);
+            vec4 clipStart = mvp * vec4(segmentStart.xyz, 1.0);
+            vec4 clipEnd = mvp * vec4(segmentEnd.xyz, 1.0);
+
+            // The segment starting at the newest sample would connect it to the oldest one
+            if (ageStart < 0.5 || ageStart >= filled || clipStart.w <= 0.0 || clipEnd.w <= 0.0)
+            {
+                fragTint = vec4(0.0);
+                gl_Position = vec4(2.0, 2.0, 2.0, 1.0); // degenerate, outside the clip volume
+                return;
+            }
+
+            vec2 screenStart = clipStart.xy / clipStart.w * viewport;
+            vec2 screenEnd = clipEnd.xy / clipEnd.w * viewport;
+            vec2 direction = normalize(screenEnd - screenStart + vec2(1e-6, 0.0));
+            vec2 normal = vec2(-direction.y, direction.x);
+
+            vec4 position = mix(clipStart, clipEnd, vertexPosition.x);
+            position.xy += normal * vertexPosition.y * width / viewport * position.w;
+
+            float age = mix(ageStart, ageEnd, vertexPosition.x);
+            fragTint = vec4(instanceColor.rgb, instanceColor.a * (1.0 - age / slots));
+            gl_Position = LogDepth(position);
+        }
+    )";
+
+    inline constexpr const char* TrailFragment = SHADER_FRAGMENT_PRELUDE R"(
+        VARYING vec4 fragTint;
+
+        void main()
+        {
+            FRAG_COLOR = fragTint;
+        }
+    )";
+
+
+    // Static world space lines extruded to screen space ribbons, one instance per line. Lines crossing the
+    // camera plane are clipped in the vertex shader. Lines with start.w = 1 fade out with camera distance.
+    inline constexpr const char* LineVertex = SHADER_VERTEX_PRELUDE SHADER_LOG_DEPTH R"(
+        ATTRIBUTE vec2 vertexPosition; // x 0 at the start, 1 at the end of the line, y side of the ribbon
+        ATTRIBUTE vec4 lineStart;
+        ATTRIBUTE vec3 lineEnd;
+        ATTRIBUTE vec4 lineColor;
+        uniform mat4 mvp;
+        uniform vec2 viewport;
+        uniform float width; // pixels
+        VARYING vec4 fragTint;
+        VARYING vec3 fragWorld;
+        VARYING float fragFade;
+
+        void main()
+        {
+            const float nearW = 1e-3;
+            vec4 clipStart = mvp * vec4(lineStart.xyz, 1.0);
+            vec4 clipEnd = mvp * vec4(lineEnd, 1.0);
+            float tStart = 0.0;
+            float tEnd = 1.0;
+            if (clipStart.w < nearW && clipEnd.w < nearW)
+            {
+                fragTint = vec4(0.0);
+                fragWorld = vec3(0.0);
+                fragFade = 0.0;
+                gl_Position = vec4(2.0, 2.0, 2.0, 1.0); // degenerate, outside the clip volume
+                return;
+            }
+            if (clipStart.w < nearW) tStart = (nearW - clipStart.w) / (clipEnd.w - clipStart.w);
+            if (clipEnd.w < nearW) tEnd = (nearW - clipStart.w) / (clipEnd.w - clipStart.w);
+
+            vec4 start = mix(clipStart, clipEnd, tStart);
+            vec4 end = mix(clipStart, clipEnd, tEnd);
+            vec2 direction = normalize((end.xy / end.w - start.xy / start.w) * viewport + vec2(1e-6, 0.0));
+            vec2 normal = vec2(-direction.y, direction.x);
+
+            vec4 position = mix(start, end, vertexPosition.x);
+            position.xy += normal * vertexPosition.y * width / viewport * position.w;
+
+            fragTint = lineColor;
+            fragWorld = mix(lineStart.xyz, lineEnd, mix(tStart, tEnd, vertexPosition.x));
+            fragFade = lineStart.w;
+            gl_Position = LogDepth(position);
+        }
+    )";
+
+    inline constexpr const char* LineFragment = SHADER_FRAGMENT_PRELUDE R"(
+        uniform vec3 cameraPosition;
+        uniform float fadeDistance;
+        VARYING vec4 fragTint;
+        VARYING vec3 fragWorld;
+        VARYING float fragFade;
+
+        void main()
+        {
+            float fade = 1.0 - fragFade * smoothstep(0.25 * fadeDistance, fadeDistance, distance(fragWorld, cameraPosition));
+            FRAG_COLOR = vec4(fragTint.rgb, fragTint.a * fade);
+        }
+    )";
+
+
+    // Screen space text, used for the HUD's glyph quads and with raylib's batch for everything else.
+    // vertexPosition only reads xy, the batch's z is not needed in 2D.
+    inline constexpr const char* TextVertex = SHADER_VERTEX_PRELUDE R"(
+        ATTRIBUTE vec2 vertexPosition;
+        ATTRIBUTE vec2 vertexTexCoord;
+        ATTRIBUTE vec4 vertexColor;
+        uniform mat4 mvp;
+        VARYING vec2 fragTexCoord;
+        VARYING vec4 fragTint;
+
+        void main()
+        {
+            fragTexCoord = vertexTexCoord;
+            fragTint = vertexColor;
+            gl_Position = mvp * vec4(vertexPosition, 0.0, 1.0);
+        }
+    )";
+
+    inline constexpr const char* TextFragment = SHADER_FRAGMENT_PRELUDE R"(
+        uniform sampler2D texture0;
+        VARYING vec2 fragTexCoord;
+        VARYING vec4 fragTint;
+
+        void main()
+        {
+            // The atlas stores signed distances with the outline at 0.5. The edge is smoothed over about one
+            // screen pixel whatever the scale, the white texel for shapes has no gradient and stays opaque.
+            float dist = TEXTURE(texture0, fragTexCoord).a;
+            float width = max(0.7 * fwidth(dist), 1e-4);
+            FRAG_COLOR = vec4(fragTint.rgb, fragTint.a * smoothstep(0.5 - width, 0.5 + width, dist));
+        }
+    )";
+}
@@ -0,0 +1,171 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+// Refers to an item of a SlotMap. It stays valid while the item lives no matter how many other items
+// are added or removed, afterwards it's stale and lookups fail instead of returning another item.
+struct SlotHandle
+{
+    uint32_t slot = UINT32_MAX;
+    uint32_t generation = 0;
+
+    constexpr bool IsNull() const noexcept
+    {
+        return slot == UINT32_MAX;
+    }
+
+    constexpr bool operator==(const SlotHandle& other) const noexcept
+    {
+        return slot == other.slot && generation == other.generation;
+    }
+
+    constexpr bool operator!=(const SlotHandle& other) const noexcept
+    {
+        return !(*this == other);
+    }
+};
+
+
+// Generational slot map. Items are kept packed in one vector so kernels iterate them densely, handles
+// go through a slot that knows the item's current index. Removal moves the last item into the hole,
+// so adding and removing are O(1) and never rescan, but the order of the items isn't stable.
+template <typename T>
+class SlotMap
+{
+private:
+    static constexpr uint32_t NoSlot = UINT32_MAX;
+
+    struct Slot
+    {
+        uint32_t index;      // item index while used, next free slot otherwise
+        uint32_t generation; // incremented on removal, stale handles don't match anymore
+    };
+private:
+    std::vector<T> m_Items;
+    std::vector<uint32_t> m_ItemSlots; // slot of every item, parallel to m_Items
+    std::vector<Slot> m_Slots;
+    uint32_t m_FreeSlot = NoSlot; // head of the free list threaded through Slot::index
+public:
+    void Reserve(std::size_t count)
+    {
+        m_Items.reserve(count);
+        m_ItemSlots.reserve(count);
+        m_Slots.reserve(count);
+    }
+
+    void Clear() noexcept
+    {
+        // Slots are kept with bumped generations so handles into the old items go stale
+        for (const uint32_t slot : m_ItemSlots)
+        {
+            ++m_Slots[slot].generation;
+            m_Slots[slot].index = m_FreeSlot;
+            m_FreeSlot = slot;
+        }
+        m_Items.clear();
+        m_ItemSlots.clear();
+    }
+
+    template <typename... Args>
+    SlotHandle Emplace(Args&&... args)
+    {
+        uint32_t slot = m_FreeSlot;
+        if (slot != NoSlot)
+            m_FreeSlot = m_Slots[slot].index;
+        else
+        {
+            slot = static_cast<uint32_t>(m_Slots.size());
+            m_Slots.push_back({ 0, 0 });
+        }
+
+        m_Slots[slot].index = static_cast<uint32_t>(m_Items.size());
+        m_Items.emplace_back(std::forward<Args>(args)...);
+        m_ItemSlots.push_back(slot);
+        return { slot, m_Slots[slot].generation };
+    }
+
+    // Returns false for stale or null handles
+    bool Remove(SlotHandle handle) noexcept
+    {
+        if (!Contains(handle))
+            return false;
+
+        Slot& slot = m_Slots[handle.slot];
+        const uint32_t index = slot.index;
+        const uint32_t last = static_cast<uint32_t>(m_Items.size() - 1);
+        if (index != last)
+        {
+            m_Items[index] = std::move(m_Items[last]);
+            m_ItemSlots[index] = m_ItemSlots[last];
+            m_Slots[m_ItemSlots[index]].index = index;
+        }
+        m_Items.pop_back();
+        m_ItemSlots.pop_back();
+
+        ++slot.generation;
+        slot.index = m_FreeSlot;
+        m_FreeSlot = handle.slot;
+        return true;
+    }
+
+    bool Contains(SlotHandle handle) const noexcept
+    {
+        return handle.slot < m_Slots.size() && m_Slots[handle.slot].generation == handle.generation;
+    }
+
+    // nullptr for stale handles, the pointer is invalidated by the next Emplace() or Remove()
+    T* Get(SlotHandle handle) noexcept
+    {
+        return Contains(handle) ? &m_Items[m_Slots[handle.slot].index] : nullptr;
+    }
+
+    const T* Get(SlotHandle handle) const noexcept
+    {
+        return Contains(handle) ? &m_Items[m_Slots[handle.slot].index] : nullptr;
+    }
+
+    // Current index into Items(), -1 for stale handles
+    int64_t IndexOf(SlotHandle handle) const noexcept
+    {
+        return Contains(handle) ? static_cast<int64_t>(m_Slots[handle.slot].index) : -1;
+    }
+
+    SlotHandle HandleAt(std::size_t index) const noexcept
+    {
+        const uint32_t slot = m_ItemSlots[index];
+        return { slot, m_Slots[slot].generation };
+    }
+
+    // The packed items, they may be modified in place but not added or erased through the vector
+    std::vector<T>& Items() noexcept
+    {
+        return m_Items;
+    }
+
+    const std::vector<T>& Items() const noexcept
+    {
+        return m_Items;
+    }
+
+    T& operator[](std::size_t index) noexcept
+    {
+        return m_Items[index];
+    }
+
+    const T& operator[](std::size_t index) const noexcept
+    {
+        return m_Items[index];
+    }
+
+    std::size_t Size() const noexcept
+    {
+        return m_Items.size();
+    }
+
+    bool Empty() const noexcept
+    {
+        return m_Items.empty();
+    }
+};
@@ -0,0 +1,211 @@
+#pragma once
+#include <array>
+#include <cmath>
+#include <vector>
+#include <cstddef>
+
+#include "raylib.h"
+#include "raymath.h"
+#include "rlgl.h"
+
+#include "Shaders.h"
+#include "Profiler.h"
+
+// Draws all bodies with one instanced draw call per level of detail. The sphere meshes live on the GPU,
+// every frame only a small per-instance buffer (center, radius, color) is uploaded. The level of detail is
+// picked from the projected screen radius, sub-pixel bodies become one pixel sized points.
+// Falls back to DrawSphere if the context has no vertex array objects (plain WebGL 1).
+class SphereRenderer
+{
+private:
+    struct Instance
+    {
+        float x, y, z, radius;
+        unsigned char r, g, b, a;
+    };
+
+    struct LodLevel
+    {
+        int rings;
+        int slices;
+        float maxPixels; // projected radius up to which this level is used
+    };
+
+    struct Lod
+    {
+        unsigned int vao;
+        unsigned int meshVbo;
+        unsigned int instanceVbo;
+        int vertexCount;
+        std::size_t capacity;
+        std::vector<Instance> instances;
+    };
+
+    static constexpr std::size_t LodCount = 4;
+    static constexpr std::size_t PointLod = 0;
+    static constexpr float PointPixels = 1.f; // on-screen radius of bodies drawn as points
+    static constexpr std::array<LodLevel, LodCount> Levels = {{
+        { 3, 4, PointPixels },
+        { 6, 8, 8.f },
+        { 16, 16, 48.f },
+        { 32, 32, INFINITY }
+    }};
+    static constexpr std::size_t InitialCapacity = 256; // instances
+private:
+    static inline Shader s_Shader;
+    static inline int s_MvpLoc = -1;
+    static inline int s_FarPlaneLoc = -1;
+    static inline int s_PositionLoc = -1;
+    static inline int s_InstancePositionLoc = -1;
+    static inline int s_InstanceColorLoc = -1;
+    static inline bool s_Instanced = false;
+    static inline std::array<Lod, LodCount> s_Lods{};
+
+    static inline Vector3 s_CameraPosition = { 0, 0, 0 };
+    static inline float s_PixelsPerUnit = 1.f; // projected size of one world unit at distance one
+private:
+    // Expects the vao of the level to be bound
+    static void BindInstanceBuffer(const Lod& lod) noexcept
+    {
+        rlEnableVertexBuffer(lod.instanceVbo);
+        rlSetVertexAttribute(static_cast<unsigned int>(s_InstancePositionLoc), 4, RL_FLOAT, false, sizeof(Instance), 0);
+        rlEnableVertexAttribute(static_cast<unsigned int>(s_InstancePositionLoc));
+        rlSetVertexAttributeDivisor(static_cast<unsigned int>(s_InstancePositionLoc), 1);
+        rlSetVertexAttribute(static_cast<unsigned int>(s_InstanceColorLoc), 4, RL_UNSIGNED_BYTE, true, sizeof(Instance), 4 * sizeof(float));
+        rlEnableVertexAttribute(static_cast<unsigned int>(s_InstanceColorLoc));
+        rlSetVertexAttributeDivisor(static_cast<unsigned int>(s_InstanceColorLoc), 1);
+    }
+
+    static void Reserve(Lod* lod, std::size_t instances) noexcept
+    {
+        if (instances <= lod->capacity) return;
+
+        while (lod->capacity < instances)
+            lod->capacity = lod->capacity == 0 ? InitialCapacity : lod->capacity * 2;
+
+        rlUnloadVertexBuffer(lod->instanceVbo);
+        lod->instanceVbo = rlLoadVertexBuffer(nullptr, static_cast<int>(lod->capacity * sizeof(Instance)), true);
+        rlEnableVertexArray(lod->vao);
+        BindInstanceBuffer(*lod);
+        rlDisableVertexArray();
+    }
+
+    static bool LoadLod(Lod* lod, const LodLevel& level) noexcept
+    {
+        lod->vao = rlLoadVertexArray();
+        if (lod->vao == 0) return false;
+
+        // Only the positions are needed, the mesh itself never goes to the GPU through raylib
+        Mesh sphere = GenMeshSphere(1.f, level.rings, level.slices);
+        lod->vertexCount = sphere.vertexCount;
+
+        rlEnableVertexArray(lod->vao);
+        lod->meshVbo = rlLoadVertexBuffer(sphere.vertices, sphere.vertexCount * 3 * static_cast<int>(sizeof(float)), false);
+        rlSetVertexAttribute(static_cast<unsigned int>(s_PositionLoc), 3, RL_FLOAT, false, 0, 0);
+        rlEnableVertexAttribute(static_cast<unsigned int>(s_PositionLoc));
+        rlDisableVertexArray();
+        UnloadMesh(sphere);
+
+        Reserve(lod, InitialCapacity);
+        return true;
+    }
+
+    static void DrawLod(const Lod& lod, const LodLevel& level) noexcept
+    {
+        if (!s_Instanced)
+        {
+            for (const Instance& i : lod.instances)
+                DrawSphereEx({ i.x, i.y, i.z }, i.radius, level.rings, level.slices, { i.r, i.g, i.b, i.a });
+            return;
+        }
+
+        rlUpdateVertexBuffer(lod.instanceVbo, lod.instances.data(), static_cast<int>(lod.instances.size() * sizeof(Instance)), 0);
+        rlEnableVertexArray(lod.vao);
+        rlDrawVertexArrayInstanced(0, lod.vertexCount, static_cast<int>(lod.instances.size()));
+    }
+public:
+    static void Init() noexcept
+    {
+        s_Shader = LoadShaderFromMemory(Shaders::SphereVertex, Shaders::SphereFragment);
+        s_MvpLoc = GetShaderLocation(s_Shader, "mvp");
+        s_FarPlaneLoc = GetShaderLocation(s_Shader, "farPlane");
+        s_PositionLoc = GetShaderLocationAttrib(s_Shader, "vertexPosition");
+        s_InstancePositionLoc = GetShaderLocationAttrib(s_Shader, "instancePosition");
+        s_InstanceColorLoc = GetShaderLocationAttrib(s_Shader, "instanceColor");
+
+        s_Instanced = IsShaderValid(s_Shader) && s_PositionLoc >= 0 && s_InstancePositionLoc >= 0 && s_InstanceColorLoc >= 0;
+        for (std::size_t i = 0; i < LodCount; ++i)
+            s_Instanced = s_Instanced && LoadLod(&s_Lods[i], Levels[i]);
+
+        if (!s_Instanced)
+            TraceLog(LOG_WARNING, "SPHERES: Instancing unavailable, falling back to DrawSphere");
+    }
+
+    static void Shutdown() noexcept
+    {
+        for (Lod& lod : s_Lods)
+        {
+            if (lod.vao == 0) continue;
+            rlUnloadVertexBuffer(lod.instanceVbo);
+            rlUnloadVertexBuffer(lod.meshVbo);
+            rlUnloadVertexArray(lod.vao);
+            lod.vao = 0;
+            lod.capacity = 0;
+        }
+        UnloadShader(s_Shader);
+        s_Instanced = false;
+    }
+
+    // Sets the camera the level of detail is computed for, call once per frame before Add()
+    static void Begin(const Camera3D& camera) noexcept
+    {
+        s_CameraPosition = camera.position;
+        s_PixelsPerUnit = 0.5f * static_cast<float>(GetScreenHeight()) / std::tan(0.5f * camera.fovy * DEG2RAD);
+    }
+
+    static void Add(Vector3 center, float radius, Color color)
+    {
+        const float distance = Vector3Distance(center, s_CameraPosition);
+        const float pixels = distance > 0.f ? radius * s_PixelsPerUnit / distance : INFINITY;
+
+        std::size_t level = 0;
+        while (level + 1 < LodCount && pixels > Levels[level].maxPixels)
+            level++;
+
+        // Points keep a minimum size so far away bodies don't vanish between pixels
+        if (level == PointLod)
+            radius = PointPixels * distance / s_PixelsPerUnit;
+
+        s_Lods[level].instances.push_back({ center.x, center.y, center.z, radius, color.r, color.g, color.b, color.a });
+    }
+
+    // Draws everything added since the last flush, must be called inside BeginMode3D
+    static void Flush() noexcept
+    {
+        PROFILE_FUNCTION();
+        rlDrawRenderBatchActive(); // keep the order with everything drawn through the batch so far
+
+        if (s_Instanced)
+        {
+            const float farPlane = static_cast<float>(rlGetCullDistanceFar());
+            rlEnableShader(s_Shader.id);
+            rlSetUniformMatrix(s_MvpLoc, MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()));
+            rlSetUniform(s_FarPlaneLoc, &farPlane, RL_SHADER_UNIFORM_FLOAT, 1);
+        }
+
+        for (std::size_t i = 0; i < LodCount; ++i)
+        {
+            Lod& lod = s_Lods[i];
+            if (lod.instances.empty()) continue;
+            if (s_Instanced) Reserve(&lod, lod.instances.size());
+            DrawLod(lod, Levels[i]);
+            lod.instances.clear();
+        }
+
+        if (s_Instanced)
+        {
+            rlDisableVertexArray();
+            rlDisableShader();
+        }
+    }
+};
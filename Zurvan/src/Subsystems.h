@@ -0,0 +1,302 @@
+#pragma once
+#include <cmath>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+#include "raylib.h"
+
+#include "Math.h"
+#include "Config.h"
+#include "Physics.h"
+#include "SlotMap.h"
+#include "Profiler.h"
+
+namespace Physics
+{
+    // Planets with moons integrated hierarchically. The system's barycenter takes part in the heliocentric
+    // integration as a single body carrying the total mass at the slow global step. Within the system the
+    // members move relative to the barycenter with leapfrog substeps short enough for the fastest moon,
+    // pulled by the massive members and by the tide of everything outside. The tide is linearized around
+    // the barycenter (Hill's approximation), its tensor is taken at the start of the step.
+    //
+    // Moons lighter than MasslessRatio of their planet are test particles, they feel the massive members
+    // but don't pull on anything. This keeps the cost per substep linear in the number of small moons.
+    //
+    // The invariants of the whole system are those of the primaries plus the motion relative to each
+    // barycenter and the potential within each system. The tidal potential is left out, it's of the order
+    // of the tide itself.
+    class Subsystems
+    {
+    private:
+        static constexpr double StepsPerOrbit = 200.0;  // leapfrog substeps per period of the fastest moon
+        static constexpr double MasslessRatio = 1e-9;
+        static constexpr double MaxSubsteps = 10000.0;  // per step, a moon grazing its host would stall the frame
+
+        struct System
+        {
+            SlotHandle host;
+            std::vector<SlotHandle> members; // the host first
+            bool clamped = false;            // warned about MaxSubsteps
+        };
+    private:
+        std::vector<System> m_Systems;
+        std::vector<RigidBody<FLOAT>> m_Primaries; // loose bodies followed by one barycenter per system
+        std::vector<uint32_t> m_Loose;             // index of every loose primary in the slot map
+        std::vector<uint8_t> m_InSystem;
+        std::vector<uint32_t> m_Members; // index of every system member in the slot map, in order of m_Systems
+        std::size_t m_PrimaryCount = 0;
+        std::vector<Math::Vector3<FLOAT>> m_Relative; // positions then velocities of every system after substepping
+
+        // Scratch of the system being substepped, relative to its barycenter
+        std::vector<Math::Vector3<FLOAT>> m_Position;
+        std::vector<Math::Vector3<FLOAT>> m_Velocity;
+        std::vector<Math::Vector3<FLOAT>> m_Acceleration;
+        FLOAT m_Tide[6] = {}; // symmetric tidal tensor xx, yy, zz, xy, xz, yz
+        std::vector<FLOAT> m_Mass;
+        std::vector<uint32_t> m_Massive; // indices into the scratch arrays
+        Invariants m_Internal; // of the motion relative to the barycenters, added to those of the primaries
+    private:
+        // G * mass * direction / distance^3 with the same 1 m clamp as RigidBody::ComputeAcceleration
+        static Math::Vector3<FLOAT> Pull(const Math::Vector3<FLOAT>& direction, FLOAT mass) noexcept
+        {
+            FLOAT distance = direction.Length();
+            if (distance < static_cast<FLOAT>(1)) distance = static_cast<FLOAT>(1);
+            return direction * (static_cast<FLOAT>(Const::G) * mass / (distance * distance * distance));
+        }
+
+        // Accumulates the state's invariants into m_Internal if requested
+        void Accelerations(bool invariants = false) noexcept
+        {
+            for (std::size_t j = 0; j < m_Position.size(); ++j)
+            {
+                const Math::Vector3<FLOAT>& r = m_Position[j];
+                Math::Vector3<FLOAT> acc(m_Tide[0] * r.x + m_Tide[3] * r.y + m_Tide[4] * r.z, m_Tide[3] * r.x + m_Tide[1] * r.y + m_Tide[5] * r.z, m_Tide[4] * r.x + m_Tide[5] * r.y + m_Tide[2] * r.z);
+                for (const uint32_t k : m_Massive)
+                {
+                    if (k == j) continue;
+                    const Math::Vector3<FLOAT> direction = m_Position[k] - m_Position[j];
+                    acc += Pull(direction, m_Mass[k]);
+
+                    // Pairs of massive members are visited twice
+                    if (invariants)
+                    {
+                        const bool massive = j == 0 || m_Mass[j] >= m_Mass[0] * static_cast<FLOAT>(MasslessRatio);
+                        const double distance = std::max(static_cast<double>(direction.Length()), 1.0);
+                        m_Internal.AddPair(static_cast<double>(m_Mass[j]) * (massive ? 0.5 : 1.0), static_cast<double>(m_Mass[k]), distance);
+                    }
+                }
+                m_Acceleration[j] = acc;
+                if (invariants)
+                    m_Internal.AddBody(r, m_Velocity[j], m_Mass[j]);
+            }
+        }
+
+        // Drops removed (merged) bodies, a system without its host or moons dissolves
+        void Prune(const SlotMap<RigidBody<FLOAT>>& bodies)
+        {
+            for (System& system : m_Systems)
+                system.members.erase(std::remove_if(system.members.begin(), system.members.end(), [&bodies](SlotHandle h) { return !bodies.Contains(h); }), system.members.end());
+            m_Systems.erase(std::remove_if(m_Systems.begin(), m_Systems.end(), [&bodies](const System& s) { return !bodies.Contains(s.host) || s.members.size() < 2; }), m_Systems.end());
+        }
+
+        // Returns the number of pairwise interactions
+        // members are the indices of the system's bodies in items
+        double Substep(System& system, const std::vector<RigidBody<FLOAT>>& items, const uint32_t* members, std::size_t firstBarycenter, std::size_t self, double step, bool invariants)
+        {
+            const std::size_t count = system.members.size();
+            m_Position.resize(count);
+            m_Velocity.resize(count);
+            m_Acceleration.resize(count);
+            m_Mass.resize(count);
+            m_Massive.clear();
+
+            const RigidBody<FLOAT>& barycenter = m_Primaries[self];
+            const FLOAT hostMass = items[members[0]].GetMass();
+            for (std::size_t j = 0; j < count; ++j)
+            {
+                const RigidBody<FLOAT>& body = items[members[j]];
+                m_Position[j] = body.GetPosition() - barycenter.GetPosition();
+                m_Velocity[j] = body.GetVelocity() - barycenter.GetVelocity();
+                m_Mass[j] = body.GetMass();
+                if (j == 0 || body.GetMass() >= hostMass * static_cast<FLOAT>(MasslessRatio))
+                    m_Massive.push_back(static_cast<uint32_t>(j));
+            }
+
+            // G * m * (3 * n * n^T - I) / d^3 summed over every other primary
+            std::fill(m_Tide, m_Tide + 6, static_cast<FLOAT>(0));
+            for (std::size_t p = 0; p < firstBarycenter + m_Systems.size(); ++p)
+            {
+                if (p == self) continue;
+                Math::Vector3<FLOAT> n = m_Primaries[p].GetPosition() - barycenter.GetPosition();
+                const FLOAT distance = n.Length();
+                if (distance < static_cast<FLOAT>(1)) continue;
+                n = n / distance;
+                const FLOAT k = static_cast<FLOAT>(Const::G) * m_Primaries[p].GetMass() / (distance * distance * distance);
+                m_Tide[0] += k * (3 * n.x * n.x - 1);
+                m_Tide[1] += k * (3 * n.y * n.y - 1);
+                m_Tide[2] += k * (3 * n.z * n.z - 1);
+                m_Tide[3] += k * 3 * n.x * n.y;
+                m_Tide[4] += k * 3 * n.x * n.z;
+                m_Tide[5] += k * 3 * n.y * n.z;
+            }
+
+            // The fastest orbit around the host sets the substep
+            double shortest = std::abs(step);
+            for (std::size_t j = 1; j < count; ++j)
+            {
+                const double r = static_cast<double>((m_Position[j] - m_Position[0]).Length());
+                const double period = 2.0 * 3.14159265358979323846 * std::sqrt(r * r * r / (Const::G * static_cast<double>(hostMass + m_Mass[j])));
+                shortest = std::min(shortest, period / StepsPerOrbit);
+            }
+            double substeps = std::max(1.0, std::ceil(std::abs(step) / std::max(shortest, 1e-3)));
+            if (substeps > MaxSubsteps)
+            {
+                if (!system.clamped)
+                    TraceLog(LOG_WARNING, "PHYSICS: The moons of %s need %.0f substeps per step, clamped to %.0f, they lose accuracy", items[members[0]].GetLabel(), substeps, MaxSubsteps);
+                system.clamped = true;
+                substeps = MaxSubsteps;
+            }
+            const FLOAT h = static_cast<FLOAT>(step / substeps);
+
+            // Kick, drift, kick
+            Accelerations(invariants);
+            for (double s = 0.0; s < substeps; s += 1.0)
+            {
+                for (std::size_t j = 0; j < count; ++j)
+                {
+                    m_Velocity[j] += m_Acceleration[j] * (h * static_cast<FLOAT>(0.5));
+                    m_Position[j] += m_Velocity[j] * h;
+                }
+                Accelerations();
+                for (std::size_t j = 0; j < count; ++j)
+                    m_Velocity[j] += m_Acceleration[j] * (h * static_cast<FLOAT>(0.5));
+            }
+            return (substeps + 1.0) * static_cast<double>(count) * static_cast<double>(m_Massive.size());
+        }
+    public:
+        // member orbits host, a moon of a moon is added to the planet's system
+        void Add(SlotHandle host, SlotHandle member)
+        {
+            auto system = std::find_if(m_Systems.begin(), m_Systems.end(), [host](const System& s) { return s.host == host; });
+            if (system == m_Systems.end())
+            {
+                m_Systems.push_back({ host, { host }, false });
+                system = m_Systems.end() - 1;
+            }
+            system->members.push_back(member);
+        }
+
+        void Clear() noexcept
+        {
+            m_Systems.clear();
+        }
+
+        bool Empty() const noexcept
+        {
+            return m_Systems.empty();
+        }
+
+        // Bodies integrated at the global step by the last Advance()
+        std::size_t PrimaryCount() const noexcept
+        {
+            return m_PrimaryCount;
+        }
+
+        // Advances everything by step seconds, integrate(std::vector<RigidBody<FLOAT>>*) steps the given
+        // bodies at the global step. Returns the pairwise interactions spent within the systems.
+        // If integrate fills invariants with those of the given bodies, the internal ones are added to them.
+        template <typename Integrate>
+        double Advance(SlotMap<RigidBody<FLOAT>>* bodies, double step, Integrate&& integrate, Invariants* invariants = nullptr)
+        {
+            PROFILE_FUNCTION();
+            Prune(*bodies);
+            std::vector<RigidBody<FLOAT>>& items = bodies->Items();
+            if (m_Systems.empty())
+            {
+                integrate(&items);
+                m_PrimaryCount = items.size();
+                return 0.0;
+            }
+
+            // Prune() left only live handles
+            m_InSystem.assign(items.size(), 0);
+            m_Members.clear();
+            for (const System& system : m_Systems)
+                for (const SlotHandle member : system.members)
+                {
+                    const uint32_t index = static_cast<uint32_t>(bodies->IndexOf(member));
+                    m_InSystem[index] = 1;
+                    m_Members.push_back(index);
+                }
+
+            m_Primaries.clear();
+            m_Loose.clear();
+            for (std::size_t i = 0; i < items.size(); ++i)
+            {
+                if (m_InSystem[i]) continue;
+                m_Primaries.push_back(items[i]);
+                m_Loose.push_back(static_cast<uint32_t>(i));
+            }
+
+            const std::size_t firstBarycenter = m_Primaries.size();
+            const uint32_t* members = m_Members.data();
+            for (const System& system : m_Systems)
+            {
+                FLOAT mass = static_cast<FLOAT>(0);
+                Math::Vector3<FLOAT> position, velocity;
+                for (std::size_t j = 0; j < system.members.size(); ++j)
+                {
+                    const RigidBody<FLOAT>& body = items[members[j]];
+                    mass += body.GetMass();
+                    position += body.GetPosition() * body.GetMass();
+                    velocity += body.GetVelocity() * body.GetMass();
+                }
+                const RigidBody<FLOAT>& host = items[members[0]];
+                m_Primaries.emplace_back(position / mass, velocity / mass, mass, host.GetRadius(), host.GetLabel(), host.GetColor());
+                members += system.members.size();
+            }
+
+            // Substepping first, it needs the primaries at the start of the step for the tides
+            double interactions = 0.0;
+            m_Relative.clear();
+            m_Internal = Invariants();
+            members = m_Members.data();
+            for (std::size_t s = 0; s < m_Systems.size(); ++s)
+            {
+                interactions += Substep(m_Systems[s], items, members, firstBarycenter, firstBarycenter + s, step, invariants != nullptr);
+                members += m_Systems[s].members.size();
+                m_Relative.insert(m_Relative.end(), m_Position.begin(), m_Position.end());
+                m_Relative.insert(m_Relative.end(), m_Velocity.begin(), m_Velocity.end());
+            }
+
+            integrate(&m_Primaries);
+            m_PrimaryCount = m_Primaries.size();
+            if (invariants != nullptr)
+                *invariants += m_Internal;
+
+            for (std::size_t k = 0; k < m_Loose.size(); ++k)
+            {
+                items[m_Loose[k]].SetPosition(m_Primaries[k].GetPosition());
+                items[m_Loose[k]].SetVelocity(m_Primaries[k].GetVelocity());
+            }
+            const Math::Vector3<FLOAT>* relative = m_Relative.data();
+            members = m_Members.data();
+            for (std::size_t s = 0; s < m_Systems.size(); ++s)
+            {
+                const RigidBody<FLOAT>& barycenter = m_Primaries[firstBarycenter + s];
+                const std::size_t count = m_Systems[s].members.size();
+                for (std::size_t j = 0; j < count; ++j)
+                {
+                    RigidBody<FLOAT>& body = items[members[j]];
+                    body.SetPosition(barycenter.GetPosition() + relative[j]);
+                    body.SetVelocity(barycenter.GetVelocity() + relative[count + j]);
+                }
+                relative += 2 * count;
+                members += count;
+            }
+            return interactions;
+        }
+    };
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+#include "Math.h"
+#include "Config.h"
+#include "Physics.h"
+#include "Profiler.h"
+
+// Broad phase over intervals along one axis. The order of the previous call is kept and fixed up with
+// an insertion sort, which is close to linear because bodies hardly change their order between two steps.
+class SweepAndPrune
+{
+private:
+    std::vector<uint32_t> m_Order; // indices sorted by their interval's minimum
+    int m_Axis = -1;
+public:
+    static double Component(const Math::Vector3<FLOAT>& v, int axis) noexcept
+    {
+        return static_cast<double>(axis == 0 ? v.x : (axis == 1 ? v.y : v.z));
+    }
+
+    // Sorting along the widest axis leaves the fewest overlapping intervals
+    static int LargestSpreadAxis(const std::vector<Physics::RigidBody<FLOAT>>& bodies) noexcept
+    {
+        if (bodies.empty()) return 0;
+
+        double spread[3] = {};
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            double lo = Component(bodies[0].GetPosition(), axis), hi = lo;
+            for (const Physics::RigidBody<FLOAT>& body : bodies)
+            {
+                lo = std::min(lo, Component(body.GetPosition(), axis));
+                hi = std::max(hi, Component(body.GetPosition(), axis));
+            }
+            spread[axis] = hi - lo;
+        }
+        return static_cast<int>(std::max_element(spread, spread + 3) - spread);
+    }
+
+    // Calls pair(a, b) for every two intervals [min, max] that overlap, axis only tells whether the
+    // previous order still applies
+    template <typename Pair>
+    void ForEachOverlap(const std::vector<double>& min, const std::vector<double>& max, int axis, Pair&& pair)
+    {
+        PROFILE_FUNCTION();
+        const std::size_t n = min.size();
+        if (m_Order.size() != n || axis != m_Axis)
+        {
+            // Any permutation is a valid start, only the previous order makes the insertion sort cheap
+            m_Order.resize(n);
+            for (std::size_t i = 0; i < n; ++i)
+                m_Order[i] = static_cast<uint32_t>(i);
+            std::sort(m_Order.begin(), m_Order.end(), [&min](uint32_t a, uint32_t b) { return min[a] < min[b]; });
+            m_Axis = axis;
+        }
+        else
+        {
+            for (std::size_t i = 1; i < n; ++i)
+            {
+                const uint32_t index = m_Order[i];
+                std::size_t k = i;
+                for (; k > 0 && min[m_Order[k - 1]] > min[index]; --k)
+                    m_Order[k] = m_Order[k - 1];
+                m_Order[k] = index;
+            }
+        }
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const uint32_t a = m_Order[i];
+            for (std::size_t k = i + 1; k < n && min[m_Order[k]] <= max[a]; ++k)
+                pair(a, m_Order[k]);
+        }
+    }
+};
@@ -0,0 +1,220 @@
+#pragma once
+#include <limits>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+#include "raylib.h"
+#include "raymath.h"
+#include "rlgl.h"
+
+#include "Config.h"
+#include "Physics.h"
+#include "Shaders.h"
+#include "Frustum.h"
+#include "Profiler.h"
+
+// Orbit trails of all bodies in one shared vertex buffer. The buffer is slot major: slot s of body b
+// lives at s * bodies + b, so pushing a new sample for every body is a single contiguous upload.
+// Slot Slots duplicates slot 0 which lets every segment read its end point at a fixed offset of one slot.
+class TrailRenderer
+{
+private:
+    struct Sample
+    {
+        float x, y, z, slot;
+    };
+
+    static constexpr std::size_t Slots = 256;
+    static constexpr float Width = 1.f; // half width in pixels
+private:
+    static inline Shader s_Shader;
+    static inline int s_MvpLoc = -1;
+    static inline int s_FarPlaneLoc = -1;
+    static inline int s_ViewportLoc = -1;
+    static inline int s_HeadLoc = -1;
+    static inline int s_SlotsLoc = -1;
+    static inline int s_FilledLoc = -1;
+    static inline int s_WidthLoc = -1;
+    static inline int s_CornerLoc = -1;
+    static inline int s_StartLoc = -1;
+    static inline int s_EndLoc = -1;
+    static inline int s_ColorLoc = -1;
+    static inline unsigned int s_Vao = 0;
+    static inline unsigned int s_QuadVbo = 0;
+    static inline unsigned int s_SampleVbo = 0;
+    static inline unsigned int s_ColorVbo = 0;
+
+    static inline std::size_t s_Bodies = 0;
+    static inline std::size_t s_Head = 0;
+    static inline std::size_t s_Filled = 0;
+    static inline std::vector<Sample> s_Staging;
+
+    // Bounding box of every trail since the last clear, wrapped samples aren't removed so it only grows
+    static inline std::vector<Vector3> s_Min;
+    static inline std::vector<Vector3> s_Max;
+    static inline SphereBatch s_Bounds;
+    static inline std::vector<uint8_t> s_Visible;
+private:
+    static void ResetBounds() noexcept
+    {
+        constexpr float inf = std::numeric_limits<float>::infinity();
+        s_Min.assign(s_Bodies, { inf, inf, inf });
+        s_Max.assign(s_Bodies, { -inf, -inf, -inf });
+    }
+
+    static void Allocate(const std::vector<Physics::RigidBody<FLOAT>>& bodies) noexcept
+    {
+        s_Bodies = bodies.size();
+        s_Head = Slots - 1;
+        s_Filled = 0;
+        s_Staging.resize(s_Bodies);
+        s_Bounds.Resize(s_Bodies);
+        ResetBounds();
+
+        rlUnloadVertexBuffer(s_SampleVbo);
+        rlUnloadVertexBuffer(s_ColorVbo);
+
+        // Colors never change, one entry per segment so they can share the instance divisor
+        std::vector<Color> colors(Slots * s_Bodies);
+        for (std::size_t i = 0; i < colors.size(); ++i)
+            colors[i] = bodies[i % s_Bodies].GetColor();
+
+        rlEnableVertexArray(s_Vao);
+        s_SampleVbo = rlLoadVertexBuffer(nullptr, static_cast<int>((Slots + 1) * s_Bodies * sizeof(Sample)), true);
+        rlSetVertexAttribute(static_cast<unsigned int>(s_StartLoc), 4, RL_FLOAT, false, sizeof(Sample), 0);
+        rlEnableVertexAttribute(static_cast<unsigned int>(s_StartLoc));
+        rlSetVertexAttributeDivisor(static_cast<unsigned int>(s_StartLoc), 1);
+        rlSetVertexAttribute(static_cast<unsigned int>(s_EndLoc), 4, RL_FLOAT, false, sizeof(Sample), static_cast<int>(s_Bodies * sizeof(Sample)));
+        rlEnableVertexAttribute(static_cast<unsigned int>(s_EndLoc));
+        rlSetVertexAttributeDivisor(static_cast<unsigned int>(s_EndLoc), 1);
+
+        s_ColorVbo = rlLoadVertexBuffer(colors.data(), static_cast<int>(colors.size() * sizeof(Color)), false);
+        rlSetVertexAttribute(static_cast<unsigned int>(s_ColorLoc), 4, RL_UNSIGNED_BYTE, true, sizeof(Color), 0);
+        rlEnableVertexAttribute(static_cast<unsigned int>(s_ColorLoc));
+        rlSetVertexAttributeDivisor(static_cast<unsigned int>(s_ColorLoc), 1);
+        rlDisableVertexArray();
+    }
+public:
+    static void Init() noexcept
+    {
+        s_Shader = LoadShaderFromMemory(Shaders::TrailVertex, Shaders::TrailFragment);
+        s_MvpLoc = GetShaderLocation(s_Shader, "mvp");
+        s_FarPlaneLoc = GetShaderLocation(s_Shader, "farPlane");
+        s_ViewportLoc = GetShaderLocation(s_Shader, "viewport");
+        s_HeadLoc = GetShaderLocation(s_Shader, "head");
+        s_SlotsLoc = GetShaderLocation(s_Shader, "slots");
+        s_FilledLoc = GetShaderLocation(s_Shader, "filled");
+        s_WidthLoc = GetShaderLocation(s_Shader, "width");
+        s_CornerLoc = GetShaderLocationAttrib(s_Shader, "vertexPosition");
+        s_StartLoc = GetShaderLocationAttrib(s_Shader, "segmentStart");
+        s_EndLoc = GetShaderLocationAttrib(s_Shader, "segmentEnd");
+        s_ColorLoc = GetShaderLocationAttrib(s_Shader, "instanceColor");
+
+        if (IsShaderValid(s_Shader) && s_CornerLoc >= 0 && s_StartLoc >= 0 && s_EndLoc >= 0 && s_ColorLoc >= 0)
+            s_Vao = rlLoadVertexArray();
+
+        if (s_Vao == 0)
+        {
+            TraceLog(LOG_WARNING, "TRAILS: Instancing unavailable, orbit trails are disabled");
+            return;
+        }
+
+        // Two triangles spanning the segment, x along it and y across
+        static constexpr float quad[] = { 0.f, -1.f,  1.f, -1.f,  1.f, 1.f,  0.f, -1.f,  1.f, 1.f,  0.f, 1.f };
+        rlEnableVertexArray(s_Vao);
+        s_QuadVbo = rlLoadVertexBuffer(quad, sizeof(quad), false);
+        rlSetVertexAttribute(static_cast<unsigned int>(s_CornerLoc), 2, RL_FLOAT, false, 0, 0);
+        rlEnableVertexAttribute(static_cast<unsigned int>(s_CornerLoc));
+        rlDisableVertexArray();
+    }
+
+    static void Shutdown() noexcept
+    {
+        if (s_Vao != 0)
+        {
+            rlUnloadVertexBuffer(s_SampleVbo);
+            rlUnloadVertexBuffer(s_ColorVbo);
+            rlUnloadVertexBuffer(s_QuadVbo);
+            rlUnloadVertexArray(s_Vao);
+            s_Vao = 0;
+        }
+        UnloadShader(s_Shader);
+        s_Bodies = 0;
+    }
+
+    // Forgets the history, e.g. after the render scale changed and the old samples no longer line up
+    static void Clear() noexcept
+    {
+        s_Filled = 0;
+        ResetBounds();
+    }
+
+    // Appends the current render position of every body moved by shift, only the newest slot is uploaded.
+    // Samples are kept relative to an anchor of the caller's choosing, shift moves render positions there.
+    static void Push(const std::vector<Physics::RigidBody<FLOAT>>& bodies, Vector3 shift) noexcept
+    {
+        PROFILE_FUNCTION();
+        if (s_Vao == 0 || bodies.empty()) return;
+        if (bodies.size() != s_Bodies)
+            Allocate(bodies);
+
+        s_Head = (s_Head + 1) % Slots;
+        for (std::size_t i = 0; i < s_Bodies; ++i)
+        {
+            const Vector3 p = Vector3Add(bodies[i].GetRenderPos(), shift);
+            s_Staging[i] = { p.x, p.y, p.z, static_cast<float>(s_Head) };
+            s_Min[i] = Vector3Min(s_Min[i], p);
+            s_Max[i] = Vector3Max(s_Max[i], p);
+        }
+
+        const int bytes = static_cast<int>(s_Bodies * sizeof(Sample));
+        rlUpdateVertexBuffer(s_SampleVbo, s_Staging.data(), bytes, static_cast<int>(s_Head) * bytes);
+        if (s_Head == 0)
+            rlUpdateVertexBuffer(s_SampleVbo, s_Staging.data(), bytes, static_cast<int>(Slots) * bytes);
+
+        if (s_Filled < Slots)
+            s_Filled++;
+    }
+
+    // Must be called inside BeginMode3D, offset moves the samples from their anchor back to render space.
+    // All trails share one draw call, it's skipped entirely if no trail's bounding sphere intersects the frustum.
+    static void Draw(const Frustum& frustum, Vector3 offset) noexcept
+    {
+        PROFILE_FUNCTION();
+        if (s_Vao == 0 || s_Filled < 2) return;
+
+        for (std::size_t i = 0; i < s_Bodies; ++i)
+            s_Bounds.Set(i, Vector3Add(Vector3Lerp(s_Min[i], s_Max[i], 0.5f), offset), 0.5f * Vector3Distance(s_Min[i], s_Max[i]));
+        frustum.TestSpheres(s_Bounds, &s_Visible);
+        if (std::find(s_Visible.begin(), s_Visible.end(), uint8_t{ 1 }) == s_Visible.end())
+            return;
+
+        rlDrawRenderBatchActive(); // keep the order with everything drawn through the batch so far
+
+        const Vector2 viewport = { 0.5f * static_cast<float>(GetScreenWidth()), 0.5f * static_cast<float>(GetScreenHeight()) };
+        const float head = static_cast<float>(s_Head);
+        const float slots = static_cast<float>(Slots);
+        const float filled = static_cast<float>(s_Filled);
+        const float width = Width;
+        const float farPlane = static_cast<float>(rlGetCullDistanceFar());
+        const Matrix mvp = MatrixMultiply(MatrixTranslate(offset.x, offset.y, offset.z), MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()));
+
+        rlEnableShader(s_Shader.id);
+        rlSetUniformMatrix(s_MvpLoc, mvp);
+        rlSetUniform(s_FarPlaneLoc, &farPlane, RL_SHADER_UNIFORM_FLOAT, 1);
+        rlSetUniform(s_ViewportLoc, &viewport, RL_SHADER_UNIFORM_VEC2, 1);
+        rlSetUniform(s_HeadLoc, &head, RL_SHADER_UNIFORM_FLOAT, 1);
+        rlSetUniform(s_SlotsLoc, &slots, RL_SHADER_UNIFORM_FLOAT, 1);
+        rlSetUniform(s_FilledLoc, &filled, RL_SHADER_UNIFORM_FLOAT, 1);
+        rlSetUniform(s_WidthLoc, &width, RL_SHADER_UNIFORM_FLOAT, 1);
+
+        rlDisableDepthMask(); // translucent, don't hide the bodies behind their own trails
+        rlEnableVertexArray(s_Vao);
+        rlDrawVertexArrayInstanced(0, 6, static_cast<int>(Slots * s_Bodies));
+        rlDisableVertexArray();
+        rlEnableDepthMask();
+        rlDisableShader();
+    }
+};
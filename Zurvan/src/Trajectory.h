@@ -0,0 +1,604 @@
+#pragma once
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+#include <algorithm>
+
+#include "Math.h"
+#include "Config.h"
+#include "Physics.h"
+
+/*
+    Compressed trajectory container (.ztr)
+
+    Positions are stored in chunks of up to ChunkFrames frames. The first frame of every chunk is
+    stored raw (keyframe), every following sample is predicted linearly from the two previous
+    reconstructed samples, the residual is quantized to the error bound and Rice coded.
+    Because the encoder predicts from the reconstructed values the error never accumulates,
+    every decoded position is within errorBound meters of the recorded one.
+
+    Layout (little endian):
+        Header  magic "ZTRJ", u32 version, u32 bodyCount, u32 chunkFrames, f64 errorBound
+        Chunks  u64 payloadSize, u32 frameCount, f64 times[frameCount], f64 keyframe[bodyCount * 3], u8 riceK[3], bitstream
+        Index   u64 chunkOffsets[chunkCount]
+        Footer  u64 chunkCount, u64 frameCount, u64 indexOffset, "ZIDX", u32 reserved
+*/
+namespace Trajectory
+{
+    constexpr char HeaderMagic[4] = { 'Z', 'T', 'R', 'J' };
+    constexpr char FooterMagic[4] = { 'Z', 'I', 'D', 'X' };
+    constexpr uint32_t Version = 1;
+    constexpr std::size_t HeaderSize = 24;
+    constexpr std::size_t FooterSize = 32;
+    constexpr uint32_t DefaultChunkFrames = 256;
+
+    namespace Detail
+    {
+        // Quotients above this are written as an escape followed by the raw 64 bit value
+        constexpr uint64_t RiceEscape = 32;
+        constexpr int64_t MaxQuantized = static_cast<int64_t>(1) << 62;
+
+        inline uint64_t ZigZag(int64_t v) noexcept
+        {
+            return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+        }
+
+        inline int64_t UnZigZag(uint64_t v) noexcept
+        {
+            return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1);
+        }
+
+        // Optimal Rice parameter for a geometric distribution is roughly log2 of the mean
+        inline uint8_t RiceParameter(const std::vector<uint64_t>& values) noexcept
+        {
+            if (values.empty()) return 0;
+
+            double sum = 0.0;
+            for (const uint64_t v : values)
+                sum += static_cast<double>(v);
+            const double mean = sum / static_cast<double>(values.size());
+
+            uint8_t k = 0;
+            while (k < 62 && static_cast<double>(static_cast<uint64_t>(1) << (k + 1)) <= mean)
+                k++;
+            return k;
+        }
+
+        inline Math::Vector3<FLOAT> Predict(const Math::Vector3<FLOAT>& prev2, const Math::Vector3<FLOAT>& prev1, double ratio) noexcept
+        {
+            return prev1 + (prev1 - prev2) * static_cast<FLOAT>(ratio);
+        }
+
+        inline double StepRatio(const double* times, std::size_t frame) noexcept
+        {
+            const double previousStep = times[frame - 1] - times[frame - 2];
+            return previousStep > 0.0 ? (times[frame] - times[frame - 1]) / previousStep : 1.0;
+        }
+
+        class BitWriter
+        {
+        private:
+            std::vector<uint8_t>* m_Out;
+            uint64_t m_Accumulator = 0;
+            unsigned m_Count = 0; // unsigned bit counts, gcc can't prove the signed arithmetic doesn't overflow
+        public:
+            explicit BitWriter(std::vector<uint8_t>* out) noexcept : m_Out(out) {}
+
+            void Write(uint64_t value, unsigned bits)
+            {
+                while (bits > 0)
+                {
+                    const unsigned take = bits > 32 ? 32 : bits;
+                    m_Accumulator |= (value & ((static_cast<uint64_t>(1) << take) - 1)) << m_Count;
+                    m_Count += take;
+                    value >>= take;
+                    bits -= take;
+
+                    while (m_Count >= 8)
+                    {
+                        m_Out->push_back(static_cast<uint8_t>(m_Accumulator & 0xFF));
+                        m_Accumulator >>= 8;
+                        m_Count -= 8;
+                    }
+                }
+            }
+
+            void WriteRice(uint64_t value, uint8_t k)
+            {
+                const uint64_t quotient = value >> k;
+                if (quotient < RiceEscape)
+                {
+                    Write((static_cast<uint64_t>(1) << quotient) - 1, static_cast<unsigned>(quotient) + 1); // quotient ones then a zero
+                    Write(value, k);
+                }
+                else
+                {
+                    Write((static_cast<uint64_t>(1) << RiceEscape) - 1, static_cast<unsigned>(RiceEscape));
+                    Write(value, 64);
+                }
+            }
+
+            void Flush()
+            {
+                if (m_Count > 0)
+                    m_Out->push_back(static_cast<uint8_t>(m_Accumulator & 0xFF));
+                m_Accumulator = 0;
+                m_Count = 0;
+            }
+        };
+
+        class BitReader
+        {
+        private:
+            const uint8_t* m_Data;
+            std::size_t m_Size;
+            std::size_t m_Position = 0;
+            uint64_t m_Buffer = 0;
+            unsigned m_Available = 0;
+        private:
+            void Refill() noexcept
+            {
+                while (m_Available <= 56)
+                {
+                    const uint64_t byte = m_Position < m_Size ? m_Data[m_Position] : 0;
+                    m_Buffer |= byte << m_Available;
+                    m_Available += 8;
+                    m_Position++;
+                }
+            }
+        public:
+            BitReader(const uint8_t* data, std::size_t size) noexcept : m_Data(data), m_Size(size) {}
+
+            uint64_t Read(unsigned bits) noexcept
+            {
+                if (bits == 0) return 0;
+                if (bits > 32)
+                {
+                    const uint64_t low = Read(32);
+                    return low | (Read(bits - 32) << 32);
+                }
+
+                Refill();
+                const uint64_t value = m_Buffer & ((static_cast<uint64_t>(1) << bits) - 1);
+                m_Buffer >>= bits;
+                m_Available -= bits;
+                return value;
+            }
+
+            uint64_t ReadRice(uint8_t k) noexcept
+            {
+                Refill();
+                uint64_t quotient = 0;
+                while (quotient < RiceEscape && (m_Buffer & 1))
+                {
+                    m_Buffer >>= 1;
+                    m_Available--;
+                    quotient++;
+                }
+
+                if (quotient == RiceEscape)
+                    return Read(64);
+
+                m_Buffer >>= 1; // terminating zero
+                m_Available--;
+                return (quotient << k) | Read(k);
+            }
+
+            bool Overrun() const noexcept
+            {
+                return m_Position * 8 - static_cast<std::size_t>(m_Available) > m_Size * 8;
+            }
+        };
+
+        // 64 bit file offsets, long is 32 bits on Windows
+        inline int64_t Tell(std::FILE* file) noexcept
+        {
+#if defined(_WIN32)
+            return _ftelli64(file);
+#else
+            return static_cast<int64_t>(ftello(file));
+#endif
+        }
+
+        inline bool Seek(std::FILE* file, int64_t offset, int origin) noexcept
+        {
+#if defined(_WIN32)
+            return _fseeki64(file, offset, origin) == 0;
+#else
+            return fseeko(file, static_cast<off_t>(offset), origin) == 0;
+#endif
+        }
+
+        template <typename T>
+        inline void Append(std::vector<uint8_t>* out, const T& value)
+        {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+            out->insert(out->end(), bytes, bytes + sizeof(T));
+        }
+
+        template <typename T>
+        inline T Load(const uint8_t* data) noexcept
+        {
+            T value;
+            std::memcpy(&value, data, sizeof(T));
+            return value;
+        }
+    }
+
+
+    class Writer
+    {
+    private:
+        std::FILE* m_File = nullptr;
+        uint32_t m_BodyCount = 0;
+        uint32_t m_ChunkFrames = DefaultChunkFrames;
+        double m_ErrorBound = 0.0;
+        uint64_t m_FrameCount = 0;
+        bool m_Failed = false; // a chunk couldn't be written, the file can't be finished anymore
+        std::vector<uint64_t> m_Index;
+        std::vector<double> m_Times;
+        std::vector<Math::Vector3<FLOAT>> m_Positions; // raw positions of the chunk currently being buffered
+        std::vector<Math::Vector3<FLOAT>> m_Reconstructed;
+        std::vector<uint64_t> m_Residuals[3];
+        std::vector<uint8_t> m_Payload;
+    private:
+        bool FlushChunk()
+        {
+            const std::size_t frames = m_Times.size();
+            if (frames == 0) return true;
+
+            const std::size_t bodies = m_BodyCount;
+            const double step = 2.0 * m_ErrorBound;
+
+            // Keyframe is stored losslessly, the rest is predicted from the reconstructed history
+            m_Reconstructed.assign(m_Positions.begin(), m_Positions.begin() + static_cast<std::ptrdiff_t>(bodies));
+            m_Reconstructed.resize(frames * bodies);
+            for (auto& residuals : m_Residuals)
+                residuals.clear();
+
+            for (std::size_t f = 1; f < frames; ++f)
+            {
+                const double ratio = f >= 2 ? Detail::StepRatio(m_Times.data(), f) : 0.0;
+                for (std::size_t b = 0; b < bodies; ++b)
+                {
+                    const Math::Vector3<FLOAT>& prev1 = m_Reconstructed[(f - 1) * bodies + b];
+                    const Math::Vector3<FLOAT> predicted = f >= 2 ? Detail::Predict(m_Reconstructed[(f - 2) * bodies + b], prev1, ratio) : prev1;
+                    const Math::Vector3<FLOAT>& actual = m_Positions[f * bodies + b];
+
+                    const FLOAT predictedAxes[3] = { predicted.x, predicted.y, predicted.z };
+                    const FLOAT actualAxes[3] = { actual.x, actual.y, actual.z };
+                    FLOAT reconstructed[3];
+                    for (int axis = 0; axis < 3; ++axis)
+                    {
+                        double q = std::round(static_cast<double>(actualAxes[axis] - predictedAxes[axis]) / step);
+                        if (q > static_cast<double>(Detail::MaxQuantized)) q = static_cast<double>(Detail::MaxQuantized);
+                        if (q < -static_cast<double>(Detail::MaxQuantized)) q = -static_cast<double>(Detail::MaxQuantized);
+
+                        const int64_t quantized = static_cast<int64_t>(q);
+                        m_Residuals[axis].push_back(Detail::ZigZag(quantized));
+                        reconstructed[axis] = predictedAxes[axis] + static_cast<FLOAT>(static_cast<double>(quantized) * step);
+                    }
+                    m_Reconstructed[f * bodies + b] = Math::Vector3<FLOAT>(reconstructed[0], reconstructed[1], reconstructed[2]);
+                }
+            }
+
+            const uint8_t k[3] = { Detail::RiceParameter(m_Residuals[0]), Detail::RiceParameter(m_Residuals[1]), Detail::RiceParameter(m_Residuals[2]) };
+
+            m_Payload.clear();
+            Detail::Append(&m_Payload, static_cast<uint32_t>(frames));
+            for (const double t : m_Times)
+                Detail::Append(&m_Payload, t);
+            for (std::size_t b = 0; b < bodies; ++b)
+            {
+                Detail::Append(&m_Payload, static_cast<double>(m_Positions[b].x));
+                Detail::Append(&m_Payload, static_cast<double>(m_Positions[b].y));
+                Detail::Append(&m_Payload, static_cast<double>(m_Positions[b].z));
+            }
+            m_Payload.insert(m_Payload.end(), k, k + 3);
+
+            Detail::BitWriter bits(&m_Payload);
+            const std::size_t count = m_Residuals[0].size();
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                bits.WriteRice(m_Residuals[0][i], k[0]);
+                bits.WriteRice(m_Residuals[1][i], k[1]);
+                bits.WriteRice(m_Residuals[2][i], k[2]);
+            }
+            bits.Flush();
+
+            const int64_t offset = Detail::Tell(m_File);
+            const uint64_t payloadSize = m_Payload.size();
+            if (offset < 0 || std::fwrite(&payloadSize, sizeof(payloadSize), 1, m_File) != 1 || std::fwrite(m_Payload.data(), 1, m_Payload.size(), m_File) != m_Payload.size()
+                || std::fflush(m_File) != 0) // surfaces write errors per chunk instead of only on close
+            {
+                m_Failed = true;
+                return false;
+            }
+
+            m_Index.push_back(static_cast<uint64_t>(offset));
+            m_Times.clear();
+            m_Positions.clear();
+            return true;
+        }
+    public:
+        Writer() = default;
+        Writer(const Writer&) = delete;
+        Writer& operator=(const Writer&) = delete;
+        ~Writer() { Close(); }
+
+        // errorBound is the maximum reconstruction error in meters per axis, must be > 0
+        bool Open(const char* path, std::size_t bodyCount, double errorBound, uint32_t chunkFrames = DefaultChunkFrames)
+        {
+            Close();
+            if (bodyCount == 0 || errorBound <= 0.0 || chunkFrames < 2)
+                return false;
+
+            m_File = std::fopen(path, "wb");
+            if (m_File == nullptr)
+                return false;
+
+            m_BodyCount = static_cast<uint32_t>(bodyCount);
+            m_ChunkFrames = chunkFrames;
+            m_ErrorBound = errorBound;
+            m_FrameCount = 0;
+            m_Failed = false;
+            m_Index.clear();
+            m_Times.clear();
+            m_Positions.clear();
+            m_Positions.reserve(static_cast<std::size_t>(chunkFrames) * bodyCount);
+
+            bool ok = std::fwrite(HeaderMagic, 1, sizeof(HeaderMagic), m_File) == sizeof(HeaderMagic);
+            ok = ok && std::fwrite(&Version, sizeof(Version), 1, m_File) == 1;
+            ok = ok && std::fwrite(&m_BodyCount, sizeof(m_BodyCount), 1, m_File) == 1;
+            ok = ok && std::fwrite(&m_ChunkFrames, sizeof(m_ChunkFrames), 1, m_File) == 1;
+            ok = ok && std::fwrite(&m_ErrorBound, sizeof(m_ErrorBound), 1, m_File) == 1;
+            if (!ok)
+            {
+                std::fclose(m_File);
+                m_File = nullptr;
+            }
+            return ok;
+        }
+
+        // Returns false if the recording failed, it should be closed then and the file is unusable
+        bool AddFrame(double time, const Math::Vector3<FLOAT>* positions)
+        {
+            if (m_File == nullptr || m_Failed) return false;
+
+            m_Times.push_back(time);
+            m_Positions.insert(m_Positions.end(), positions, positions + m_BodyCount);
+            m_FrameCount++;
+
+            return m_Times.size() < m_ChunkFrames || FlushChunk();
+        }
+
+        bool AddFrame(double time, const std::vector<Physics::RigidBody<FLOAT>>& bodies)
+        {
+            if (m_File == nullptr || m_Failed || bodies.size() != m_BodyCount) return false;
+
+            m_Times.push_back(time);
+            for (const auto& body : bodies)
+                m_Positions.push_back(body.GetPosition());
+            m_FrameCount++;
+
+            return m_Times.size() < m_ChunkFrames || FlushChunk();
+        }
+
+        // Writes the remaining frames together with the seek index, the file is unusable without it
+        bool Close()
+        {
+            if (m_File == nullptr) return true;
+
+            bool ok = !m_Failed && FlushChunk();
+            const int64_t indexOffset = Detail::Tell(m_File);
+            ok = ok && indexOffset >= 0;
+            if (ok && !m_Index.empty())
+                ok = std::fwrite(m_Index.data(), sizeof(uint64_t), m_Index.size(), m_File) == m_Index.size();
+
+            const uint64_t footer[3] = { m_Index.size(), m_FrameCount, static_cast<uint64_t>(indexOffset) };
+            const uint32_t reserved = 0;
+            ok = ok && std::fwrite(footer, sizeof(footer), 1, m_File) == 1;
+            ok = ok && std::fwrite(FooterMagic, 1, sizeof(FooterMagic), m_File) == sizeof(FooterMagic);
+            ok = ok && std::fwrite(&reserved, sizeof(reserved), 1, m_File) == 1;
+
+            ok = std::fclose(m_File) == 0 && ok;
+            m_File = nullptr;
+            return ok;
+        }
+
+        bool IsOpen() const noexcept
+        {
+            return m_File != nullptr;
+        }
+
+        uint64_t FrameCount() const noexcept
+        {
+            return m_FrameCount;
+        }
+    };
+
+
+    class Reader
+    {
+    private:
+        std::FILE* m_File = nullptr;
+        uint32_t m_BodyCount = 0;
+        uint32_t m_ChunkFrames = 0;
+        double m_ErrorBound = 0.0;
+        uint64_t m_FrameCount = 0;
+        uint64_t m_IndexOffset = 0; // end of the last chunk
+        std::vector<uint64_t> m_Index;
+        std::vector<uint8_t> m_Payload;
+
+        std::size_t m_CachedChunk = std::numeric_limits<std::size_t>::max();
+        std::vector<double> m_CachedTimes;
+        std::vector<Math::Vector3<FLOAT>> m_CachedPositions;
+    public:
+        Reader() = default;
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+        ~Reader() { Close(); }
+
+        bool Open(const char* path)
+        {
+            Close();
+            m_File = std::fopen(path, "rb");
+            if (m_File == nullptr)
+                return false;
+
+            char magic[4];
+            uint32_t version = 0;
+            bool ok = std::fread(magic, 1, sizeof(magic), m_File) == sizeof(magic) && std::memcmp(magic, HeaderMagic, sizeof(magic)) == 0;
+            ok = ok && std::fread(&version, sizeof(version), 1, m_File) == 1 && version == Version;
+            ok = ok && std::fread(&m_BodyCount, sizeof(m_BodyCount), 1, m_File) == 1;
+            ok = ok && std::fread(&m_ChunkFrames, sizeof(m_ChunkFrames), 1, m_File) == 1;
+            ok = ok && std::fread(&m_ErrorBound, sizeof(m_ErrorBound), 1, m_File) == 1;
+
+            ok = ok && m_BodyCount > 0 && m_ChunkFrames >= 2 && m_ErrorBound > 0.0 && std::isfinite(m_ErrorBound);
+
+            // Nothing read from the footer is trusted before it's checked against the file size
+            int64_t fileSize = -1;
+            ok = ok && Detail::Seek(m_File, 0, SEEK_END) && (fileSize = Detail::Tell(m_File)) >= static_cast<int64_t>(HeaderSize + FooterSize);
+
+            uint64_t footer[3] = { 0, 0, 0 };
+            ok = ok && Detail::Seek(m_File, fileSize - static_cast<int64_t>(FooterSize), SEEK_SET);
+            ok = ok && std::fread(footer, sizeof(footer), 1, m_File) == 1;
+            ok = ok && std::fread(magic, 1, sizeof(magic), m_File) == sizeof(magic) && std::memcmp(magic, FooterMagic, sizeof(magic)) == 0;
+
+            // The index sits between the last chunk and the footer, every chunk holds at most m_ChunkFrames frames
+            const uint64_t end = static_cast<uint64_t>(fileSize) - FooterSize;
+            ok = ok && footer[2] >= HeaderSize && footer[2] <= end && (end - footer[2]) / sizeof(uint64_t) == footer[0] && (end - footer[2]) % sizeof(uint64_t) == 0;
+            ok = ok && footer[1] <= footer[0] * m_ChunkFrames && (footer[0] == 0 || footer[1] > (footer[0] - 1) * m_ChunkFrames);
+
+            if (ok)
+            {
+                m_Index.resize(footer[0]);
+                m_FrameCount = footer[1];
+                m_IndexOffset = footer[2];
+                ok = Detail::Seek(m_File, static_cast<int64_t>(footer[2]), SEEK_SET);
+                ok = ok && (m_Index.empty() || std::fread(m_Index.data(), sizeof(uint64_t), m_Index.size(), m_File) == m_Index.size());
+                for (std::size_t i = 0; ok && i < m_Index.size(); ++i)
+                    ok = m_Index[i] >= HeaderSize && m_Index[i] + sizeof(uint64_t) <= m_IndexOffset;
+            }
+
+            if (!ok)
+                Close();
+            return ok;
+        }
+
+        void Close() noexcept
+        {
+            if (m_File != nullptr)
+                std::fclose(m_File);
+            m_File = nullptr;
+            m_Index.clear();
+            m_FrameCount = 0;
+            m_IndexOffset = 0;
+            m_CachedChunk = std::numeric_limits<std::size_t>::max();
+        }
+
+        // Decodes a whole chunk, positions are stored frame major (frame * BodyCount() + body)
+        bool DecodeChunk(std::size_t chunk, std::vector<Math::Vector3<FLOAT>>* positions, std::vector<double>* times)
+        {
+            if (m_File == nullptr || chunk >= m_Index.size())
+                return false;
+
+            // Open() checked that the offset plus the size field lies before the index
+            uint64_t payloadSize = 0;
+            if (!Detail::Seek(m_File, static_cast<int64_t>(m_Index[chunk]), SEEK_SET) || std::fread(&payloadSize, sizeof(payloadSize), 1, m_File) != 1)
+                return false;
+            if (payloadSize > m_IndexOffset - m_Index[chunk] - sizeof(uint64_t))
+                return false;
+
+            m_Payload.resize(payloadSize);
+            if (std::fread(m_Payload.data(), 1, m_Payload.size(), m_File) != m_Payload.size())
+                return false;
+
+            const std::size_t bodies = m_BodyCount;
+            const uint8_t* data = m_Payload.data();
+            if (payloadSize < sizeof(uint32_t)) return false;
+            const std::size_t frames = Detail::Load<uint32_t>(data);
+
+            const std::size_t headerSize = sizeof(uint32_t) + frames * sizeof(double) + bodies * 3 * sizeof(double) + 3;
+            // Only the last chunk may be partially filled, readers index chunks by frame / ChunkFrames()
+            const uint64_t expected = std::min<uint64_t>(m_ChunkFrames, m_FrameCount - static_cast<uint64_t>(chunk) * m_ChunkFrames);
+            if (frames != expected || payloadSize < headerSize) return false;
+
+            // Every residual takes at least one bit, this bounds the allocation below by the payload size
+            if ((frames - 1) * bodies * 3 > (payloadSize - headerSize) * 8) return false;
+
+            times->resize(frames);
+            positions->resize(frames * bodies);
+            const uint8_t* cursor = data + sizeof(uint32_t);
+            for (std::size_t f = 0; f < frames; ++f, cursor += sizeof(double))
+                (*times)[f] = Detail::Load<double>(cursor);
+
+            for (std::size_t b = 0; b < bodies; ++b, cursor += 3 * sizeof(double))
+            {
+                (*positions)[b] = Math::Vector3<FLOAT>(
+                    static_cast<FLOAT>(Detail::Load<double>(cursor)),
+                    static_cast<FLOAT>(Detail::Load<double>(cursor + sizeof(double))),
+                    static_cast<FLOAT>(Detail::Load<double>(cursor + 2 * sizeof(double))));
+            }
+
+            const uint8_t k[3] = { cursor[0], cursor[1], cursor[2] };
+            cursor += 3;
+            if (k[0] > 62 || k[1] > 62 || k[2] > 62) return false; // RiceParameter() never writes more
+
+            const double step = 2.0 * m_ErrorBound;
+            Detail::BitReader bits(cursor, payloadSize - headerSize);
+            for (std::size_t f = 1; f < frames; ++f)
+            {
+                const double ratio = f >= 2 ? Detail::StepRatio(times->data(), f) : 0.0;
+                for (std::size_t b = 0; b < bodies; ++b)
+                {
+                    const Math::Vector3<FLOAT>& prev1 = (*positions)[(f - 1) * bodies + b];
+                    const Math::Vector3<FLOAT> predicted = f >= 2 ? Detail::Predict((*positions)[(f - 2) * bodies + b], prev1, ratio) : prev1;
+
+                    const int64_t qx = Detail::UnZigZag(bits.ReadRice(k[0]));
+                    const int64_t qy = Detail::UnZigZag(bits.ReadRice(k[1]));
+                    const int64_t qz = Detail::UnZigZag(bits.ReadRice(k[2]));
+                    (*positions)[f * bodies + b] = Math::Vector3<FLOAT>(
+                        predicted.x + static_cast<FLOAT>(static_cast<double>(qx) * step),
+                        predicted.y + static_cast<FLOAT>(static_cast<double>(qy) * step),
+                        predicted.z + static_cast<FLOAT>(static_cast<double>(qz) * step));
+                }
+            }
+            return !bits.Overrun();
+        }
+
+        // Random access to a single frame, keeps the last decoded chunk around for sequential reads
+        bool ReadFrame(std::size_t frame, Math::Vector3<FLOAT>* positions, double* time = nullptr)
+        {
+            if (frame >= m_FrameCount)
+                return false;
+
+            const std::size_t chunk = frame / m_ChunkFrames;
+            if (chunk != m_CachedChunk)
+            {
+                if (!DecodeChunk(chunk, &m_CachedPositions, &m_CachedTimes))
+                    return false;
+                m_CachedChunk = chunk;
+            }
+
+            const std::size_t local = frame % m_ChunkFrames;
+            if (local >= m_CachedTimes.size())
+                return false;
+            std::memcpy(static_cast<void*>(positions), m_CachedPositions.data() + local * m_BodyCount, m_BodyCount * sizeof(Math::Vector3<FLOAT>));
+            if (time != nullptr)
+                *time = m_CachedTimes[local];
+            return true;
+        }
+
+        bool IsOpen() const noexcept { return m_File != nullptr; }
+        std::size_t BodyCount() const noexcept { return m_BodyCount; }
+        std::size_t FrameCount() const noexcept { return static_cast<std::size_t>(m_FrameCount); }
+        std::size_t ChunkCount() const noexcept { return m_Index.size(); }
+        std::size_t ChunkFrames() const noexcept { return m_ChunkFrames; }
+        double ErrorBound() const noexcept { return m_ErrorBound; }
+    };
+}
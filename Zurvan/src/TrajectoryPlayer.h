@@ -0,0 +1,274 @@
+#pragma once
+#include <array>
+#include <mutex>
+#include <limits>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <condition_variable>
+
+#include "raylib.h"
+
+#include "Math.h"
+#include "Config.h"
+#include "Physics.h"
+#include "Trajectory.h"
+
+namespace Trajectory
+{
+    // Plays back a recorded trajectory instead of integrating. Chunks around the playhead are decoded
+    // on a background thread so the main thread only interpolates between two cached frames.
+    class Player
+    {
+    private:
+        static constexpr std::size_t NoChunk = std::numeric_limits<std::size_t>::max();
+        static constexpr std::size_t CacheSlots = 6;
+        static constexpr std::size_t PrefetchChunks = 2; // chunks decoded ahead of the playhead in playback direction
+        static constexpr std::size_t WantedChunks = PrefetchChunks + 2; // + the chunk holding the frame we interpolate towards
+
+        struct Chunk
+        {
+            std::size_t index = NoChunk;
+            uint64_t lastUse = 0;
+            std::vector<double> times;
+            std::vector<Math::Vector3<FLOAT>> positions;
+        };
+    private:
+        Reader m_Reader; // only touched by the worker after Open()
+        std::size_t m_BodyCount = 0;
+        std::size_t m_FrameCount = 0;
+        std::size_t m_ChunkFrames = 1;
+        std::size_t m_ChunkCount = 0;
+
+        double m_Playhead = 0.0; // fractional frame index
+        double m_Speed = 0.0;    // frames per second, negative plays backwards
+        double m_Time = 0.0;     // simulated time of the playhead
+
+        std::thread m_Worker;
+        std::mutex m_Mutex;
+        std::condition_variable m_Wake;
+        bool m_Stop = false;
+        uint64_t m_UseCounter = 0;
+        std::array<std::size_t, WantedChunks> m_Wanted;
+        std::array<Chunk, CacheSlots> m_Cache;
+        std::vector<uint8_t> m_Failed; // per chunk, broken chunks are never decoded again
+    private:
+        // Must be called with m_Mutex held
+        const Chunk* FindChunk(std::size_t index) noexcept
+        {
+            for (Chunk& chunk : m_Cache)
+            {
+                if (chunk.index == index)
+                {
+                    chunk.lastUse = ++m_UseCounter;
+                    return &chunk;
+                }
+            }
+            return nullptr;
+        }
+
+        // Must be called with m_Mutex held
+        std::size_t NextMissingChunk() const noexcept
+        {
+            for (const std::size_t wanted : m_Wanted)
+            {
+                if (wanted == NoChunk || m_Failed[wanted]) continue;
+
+                bool cached = false;
+                for (const Chunk& chunk : m_Cache)
+                    cached = cached || chunk.index == wanted;
+                if (!cached) return wanted;
+            }
+            return NoChunk;
+        }
+
+        // Must be called with m_Mutex held, evicts the least recently used chunk that isn't wanted
+        Chunk& EvictionSlot() noexcept
+        {
+            Chunk* victim = nullptr;
+            for (Chunk& chunk : m_Cache)
+            {
+                bool wanted = false;
+                for (const std::size_t w : m_Wanted)
+                    wanted = wanted || (w == chunk.index && w != NoChunk);
+                if (wanted) continue;
+
+                if (victim == nullptr || chunk.index == NoChunk || (victim->index != NoChunk && chunk.lastUse < victim->lastUse))
+                    victim = &chunk;
+            }
+            return victim != nullptr ? *victim : m_Cache[0];
+        }
+
+        void WorkerLoop()
+        {
+            Chunk decoded;
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            while (true)
+            {
+                m_Wake.wait(lock, [this] { return m_Stop || NextMissingChunk() != NoChunk; });
+                if (m_Stop) return;
+
+                const std::size_t index = NextMissingChunk();
+                lock.unlock();
+                const bool ok = m_Reader.DecodeChunk(index, &decoded.positions, &decoded.times);
+                lock.lock();
+
+                if (!ok)
+                {
+                    // Don't spin on a broken chunk, its frames are simply never shown
+                    m_Failed[index] = 1;
+                    TraceLog(LOG_WARNING, "TRAJECTORY: Chunk %zu of the replay is corrupted", index);
+                    continue;
+                }
+
+                Chunk& slot = EvictionSlot();
+                slot.index = index;
+                slot.lastUse = ++m_UseCounter;
+                slot.times.swap(decoded.times);
+                slot.positions.swap(decoded.positions);
+            }
+        }
+
+        void RequestChunks() noexcept
+        {
+            const std::size_t frame = static_cast<std::size_t>(m_Playhead);
+            const std::size_t current = frame / m_ChunkFrames;
+            const bool backwards = m_Speed < 0.0;
+
+            std::array<std::size_t, WantedChunks> wanted;
+            wanted[WantedChunks - 1] = frame + 1 < m_FrameCount ? (frame + 1) / m_ChunkFrames : current;
+            for (std::size_t i = 0; i < WantedChunks - 1; ++i)
+            {
+                if (backwards)
+                    wanted[i] = current >= i ? current - i : NoChunk;
+                else
+                    wanted[i] = current + i < m_ChunkCount ? current + i : NoChunk;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                if (wanted == m_Wanted) return;
+                m_Wanted = wanted;
+            }
+            m_Wake.notify_one();
+        }
+    public:
+        Player() noexcept
+        {
+            m_Wanted.fill(NoChunk);
+        }
+
+        Player(const Player&) = delete;
+        Player& operator=(const Player&) = delete;
+        ~Player() { Close(); }
+
+        bool Open(const char* path)
+        {
+            Close();
+            if (!m_Reader.Open(path) || m_Reader.FrameCount() == 0)
+            {
+                m_Reader.Close();
+                return false;
+            }
+
+            m_BodyCount = m_Reader.BodyCount();
+            m_FrameCount = m_Reader.FrameCount();
+            m_ChunkFrames = m_Reader.ChunkFrames();
+            m_ChunkCount = m_Reader.ChunkCount();
+            m_Playhead = 0.0;
+            m_Time = 0.0;
+            m_Failed.assign(m_ChunkCount, 0);
+            m_Stop = false;
+            m_Worker = std::thread(&Player::WorkerLoop, this);
+            RequestChunks();
+            return true;
+        }
+
+        void Close()
+        {
+            if (m_Worker.joinable())
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    m_Stop = true;
+                }
+                m_Wake.notify_one();
+                m_Worker.join();
+            }
+
+            m_Reader.Close();
+            m_Wanted.fill(NoChunk);
+            for (Chunk& chunk : m_Cache)
+                chunk.index = NoChunk;
+            m_FrameCount = 0;
+        }
+
+        void Update(float dt) noexcept
+        {
+            if (!IsOpen()) return;
+            Seek(m_Playhead + m_Speed * dt);
+        }
+
+        // Jumps to any (fractional) frame, e.g. for scrubbing
+        void Seek(double frame) noexcept
+        {
+            if (!IsOpen()) return;
+
+            const double last = static_cast<double>(m_FrameCount - 1);
+            m_Playhead = frame < 0.0 ? 0.0 : (frame > last ? last : frame);
+            RequestChunks();
+        }
+
+        // Writes the interpolated positions of the playhead into the bodies, returns false and leaves
+        // them untouched if the required chunks haven't been decoded yet
+        bool Apply(std::vector<Physics::RigidBody<FLOAT>>* bodies)
+        {
+            std::vector<Physics::RigidBody<FLOAT>>& bodiesRef = *bodies;
+            if (!IsOpen() || bodiesRef.size() != m_BodyCount)
+                return false;
+
+            const std::size_t frame0 = static_cast<std::size_t>(m_Playhead);
+            const std::size_t frame1 = frame0 + 1 < m_FrameCount ? frame0 + 1 : frame0;
+            const FLOAT t = static_cast<FLOAT>(m_Playhead - static_cast<double>(frame0));
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            const Chunk* chunk0 = FindChunk(frame0 / m_ChunkFrames);
+            const Chunk* chunk1 = FindChunk(frame1 / m_ChunkFrames);
+            if (chunk0 == nullptr || chunk1 == nullptr)
+                return false;
+
+            const std::size_t local0 = frame0 % m_ChunkFrames;
+            const std::size_t local1 = frame1 % m_ChunkFrames;
+            const Math::Vector3<FLOAT>* p0 = chunk0->positions.data() + local0 * m_BodyCount;
+            const Math::Vector3<FLOAT>* p1 = chunk1->positions.data() + local1 * m_BodyCount;
+
+            const double t0 = chunk0->times[local0];
+            const double t1 = chunk1->times[local1];
+            const FLOAT invFrameTime = t1 > t0 ? static_cast<FLOAT>(1.0 / (t1 - t0)) : static_cast<FLOAT>(0);
+
+            // Velocities are only needed for the stats panel, the finite difference is good enough
+            for (std::size_t i = 0; i < m_BodyCount; ++i)
+            {
+                const Math::Vector3<FLOAT> delta = p1[i] - p0[i];
+                bodiesRef[i].SetPosition(p0[i] + delta * t);
+                bodiesRef[i].SetVelocity(delta * invFrameTime);
+            }
+
+            m_Time = t0 + (t1 - t0) * static_cast<double>(t);
+            return true;
+        }
+
+        void SetSpeed(double framesPerSecond) noexcept
+        {
+            m_Speed = framesPerSecond;
+            RequestChunks();
+        }
+
+        double Speed() const noexcept { return m_Speed; }
+        double Playhead() const noexcept { return m_Playhead; }
+        double Time() const noexcept { return m_Time; }
+        std::size_t FrameCount() const noexcept { return m_FrameCount; }
+        std::size_t BodyCount() const noexcept { return m_BodyCount; }
+        bool IsOpen() const noexcept { return m_FrameCount != 0; }
+    };
+}
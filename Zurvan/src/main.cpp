@@ -1,15 +1,25 @@
 /*
     This project uses raylib (zlib/libpng license).
-
-    We have overridden the default RL_CULL_DISTANCE_FAR clipping distance (original 1000.0) to 20000.0
 */
 
 #ifdef SYSTEM_WEB
 #include <emscripten/emscripten.h>
 #endif
 
+#include <cmath>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
 #include "Clang.h"
+#include "Catalog.h"
 #include "Renderer.h"
+#include "SlotMap.h"
+#include "Physics.h"
+#include "Ensemble.h"
+#include "Collisions.h"
+#include "Encounters.h"
+#include "Subsystems.h"
 #include "Application.h"
 
 //const double MOON_MASS = 7.347e22; // kg
@@ -66,15 +76,141 @@ void ApplicationLoop(void* args)
 }
 
 
-int main()
+// Zurvan --convert <catalog> <output> writes any catalog as a binary one, which loads without parsing
+static int ConvertCatalog(const char* input, const char* output)
+{
+    Catalog::Bodies bodies;
+    if (!Catalog::Load(input, &bodies))
+        return 1;
+
+    if (!Catalog::SaveBinary(output, bodies))
+    {
+        TraceLog(LOG_ERROR, "CATALOG: Failed to write %s", output);
+        return 1;
+    }
+    TraceLog(LOG_INFO, "CATALOG: Wrote %zu bodies to %s", bodies.Size(), output);
+    return 0;
+}
+
+
+// Zurvan --encounters <years> <distance [m]> <log> [catalog] integrates without a window and logs every
+// close approach below distance, with RK4 at a fixed step of an hour
+static int FindEncounters(double years, double distance, const char* log, const char* catalogPath)
+{
+    constexpr double Step = 60 * 60;
+    Catalog::Bodies catalog;
+    if (catalogPath != nullptr ? !Catalog::Load(catalogPath, &catalog) : !Catalog::ParseText(Catalog::SolarSystem, std::strlen(Catalog::SolarSystem), &catalog, "built-in"))
+        return 1;
+
+    SlotMap<Physics::RigidBody<FLOAT>> bodies;
+    Physics::Subsystems subsystems;
+    Catalog::AddBodies(catalog, &bodies, &subsystems);
+    Physics::ToBarycentricFrame(&bodies.Items());
+    Physics::Collisions collisions;
+    Physics::Encounters encounters;
+    if (!encounters.Open(log, distance))
+    {
+        TraceLog(LOG_ERROR, "ENCOUNTERS: Failed to open %s", log);
+        return 1;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<Math::Vector3<FLOAT>> positions, velocities;
+    Physics::Invariants invariants;
+    Physics::DriftMonitor drift;
+    const uint64_t steps = static_cast<uint64_t>(years * 365.25 * 24 * 60 * 60 / Step);
+    for (uint64_t step = 0; step < steps; ++step)
+    {
+        positions.resize(bodies.Size());
+        velocities.resize(bodies.Size());
+        for (std::size_t i = 0; i < bodies.Size(); ++i)
+        {
+            positions[i] = bodies[i].GetPosition();
+            velocities[i] = bodies[i].GetVelocity();
+        }
+
+        subsystems.Advance(&bodies, Step, [&invariants](std::vector<Physics::RigidBody<FLOAT>>* primaries) { Physics::RungeKutta4th(primaries, Step, 1.f, &invariants); }, &invariants);
+        drift.Update(invariants);
+        encounters.Detect(bodies.Items(), positions, velocities, static_cast<double>(step) * Step, Step);
+        if (collisions.Resolve(&bodies, positions) > 0)
+            drift.Reset();
+    }
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    TraceLog(LOG_INFO, "ENCOUNTERS: %zu encounters and %zu merges in %.1f years written to %s in %.1f s", encounters.EventCount(), collisions.MergeCount(), years, log, seconds);
+    TraceLog(LOG_INFO, "ENCOUNTERS: Relative drift since the last merge: energy %.3e, momentum %.3e, angular momentum %.3e", drift.EnergyDrift(), drift.MomentumDrift(), drift.AngularMomentumDrift());
+    return 0;
+}
+
+
+// Zurvan --ensemble <members> <years> <sigma> [catalog] integrates perturbed copies of the system without a
+// window, sigma is the relative perturbation of every position and velocity, see Physics::Ensemble
+static int RunEnsemble(std::size_t members, double years, double sigma, const char* catalogPath)
+{
+    constexpr double Step = 60 * 60;
+    Catalog::Bodies catalog;
+    if (catalogPath != nullptr ? !Catalog::Load(catalogPath, &catalog) : !Catalog::ParseText(Catalog::SolarSystem, std::strlen(Catalog::SolarSystem), &catalog, "built-in"))
+        return 1;
+
+    SlotMap<Physics::RigidBody<FLOAT>> bodies;
+    Physics::Subsystems subsystems; // unused, the ensemble integrates moons directly
+    Catalog::AddBodies(catalog, &bodies, &subsystems);
+    Physics::ToBarycentricFrame(&bodies.Items());
+
+    Physics::Ensemble ensemble;
+    ensemble.Generate(bodies.Items(), members, sigma);
+    const uint64_t steps = static_cast<uint64_t>(years * 365.25 * 24 * 60 * 60 / Step);
+    const auto start = std::chrono::steady_clock::now();
+    ensemble.Advance(Step, steps);
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const std::vector<Physics::Ensemble::MemberStatistics> statistics = ensemble.Statistics();
+    for (std::size_t m = 0; m < statistics.size(); ++m)
+    {
+        const Physics::Ensemble::MemberStatistics& s = statistics[m];
+        TraceLog(LOG_INFO, "ENSEMBLE: Member %zu deviates %.6e m (%s), energy drift %.3e, angular momentum drift %.3e", m, s.deviation, ensemble.Label(s.farthestBody), s.energyDrift, s.angularMomentumDrift);
+    }
+    TraceLog(LOG_INFO, "ENSEMBLE: %zu members of %zu bodies for %.1f years in %.1f s (%.3e member steps / s)", ensemble.Members(), ensemble.BodyCount(), years, seconds, static_cast<double>(ensemble.Members()) * static_cast<double>(steps) / seconds);
+    return 0;
+}
+
+
+int main(int argc, char** argv)
 {
+    if (argc == 4 && std::strcmp(argv[1], "--convert") == 0)
+        return ConvertCatalog(argv[2], argv[3]);
+
+    if ((argc == 5 || argc == 6) && std::strcmp(argv[1], "--encounters") == 0)
+    {
+        const double years = std::atof(argv[2]), distance = std::atof(argv[3]);
+        if (!(years > 0.0) || !std::isfinite(years) || !(distance > 0.0))
+        {
+            TraceLog(LOG_ERROR, "Usage: Zurvan --encounters <years > 0> <distance [m] > 0> <log> [catalog]");
+            return 1;
+        }
+        return FindEncounters(years, distance, argv[4], argc == 6 ? argv[5] : nullptr);
+    }
+
+    if ((argc == 5 || argc == 6) && std::strcmp(argv[1], "--ensemble") == 0)
+    {
+        char* end = nullptr;
+        const long long members = std::strtoll(argv[2], &end, 10);
+        const double years = std::atof(argv[3]), sigma = std::atof(argv[4]);
+        if (*end != '\0' || members < 1 || !(years > 0.0) || !std::isfinite(years) || !(sigma >= 0.0) || !std::isfinite(sigma))
+        {
+            TraceLog(LOG_ERROR, "Usage: Zurvan --ensemble <members >= 1> <years > 0> <sigma >= 0> [catalog]");
+            return 1;
+        }
+        return RunEnsemble(static_cast<std::size_t>(members), years, sigma, argc == 6 ? argv[5] : nullptr);
+    }
+
     InitWindow(1280, 720, "Zurvan");
     SetWindowState(FLAG_WINDOW_RESIZABLE);
     DisableCursor();
 
     Renderer::Init();
 
-    Application app(GetScreenWidth(), GetScreenHeight());
+    Application app(GetScreenWidth(), GetScreenHeight(), argc > 1 ? argv[1] : nullptr);
 
 #ifdef SYSTEM_WEB
     emscripten_set_main_loop_arg(ApplicationLoop, (void*)&app, 0, 1);
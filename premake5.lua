@@ -100,3 +100,8 @@ removeunreferencedcodedata "on"
 include "Zurvan"
 include "Dependencies/raylib"
 include "Dependencies/raygui"
+
+-- host tools, they run during the build so they can't be compiled to wasm
+if os.target() ~= "emscripten" then
+    include "Tools/FontBaker"
+end